@@ -0,0 +1,122 @@
+#include "BatchDetector.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <fstream>
+#include <thread>
+#include <opencv2/core/utils/filesystem.hpp>
+
+static bool _isImageFile(const std::string& filename)
+{
+	static const char* extensions[] = { ".png", ".jpg", ".jpeg", ".bmp", ".tif", ".tiff", ".pgm", ".ppm" };
+	std::string::size_type dot = filename.find_last_of('.');
+	if (dot == std::string::npos)
+		return false;
+	std::string extension = filename.substr(dot);
+	std::transform(extension.begin(), extension.end(), extension.begin(),
+		[](unsigned char c) { return (char)std::tolower(c); });
+	for (const char* e : extensions)
+		if (extension == e)
+			return true;
+	return false;
+}
+
+bool listImageFiles(const std::string& input, vector<std::string>& files)
+{
+	files.clear();
+	vector<String> found;
+	if (utils::fs::isDirectory(input))
+	{
+		glob(input, found, false);
+		for (const auto& file : found)
+			if (_isImageFile(file))
+				files.push_back(file);
+	}
+	else if (input.find_first_of("*?") != std::string::npos)
+	{
+		glob(input, found, false);
+		files.assign(found.begin(), found.end());
+	}
+	else
+	{
+		// list file, one image path per line
+		std::ifstream list(input.c_str());
+		std::string line;
+		while (std::getline(list, line))
+		{
+			if (!line.empty() && line[line.size() - 1] == '\r')
+				line.erase(line.size() - 1);
+			if (!line.empty())
+				files.push_back(line);
+		}
+	}
+	return !files.empty();
+}
+
+BatchStatistics detectBatch(const vector<std::string>& files, const param& params,
+	const Mat& camMatrix, const Mat& distCoeffs, float markerSize, int workers, DetectionWriter& writer)
+{
+	CV_Assert(workers > 0);
+
+	// the detector shows its intermediate images only in the single image mode
+	param batchParams = params;
+	batchParams.showImage = false;
+	batchParams.verbal = false;
+
+	std::atomic<int> next(0), failed(0), markers(0);
+	int64 start = getTickCount();
+
+	auto work = [&]() {
+		MarkerDetector detector;
+		detector.setParameters(batchParams);
+		for (int i = next++; i < (int)files.size(); i = next++)
+		{
+			DetectionResult result;
+			result.index = i;
+			result.file = files[i];
+			try
+			{
+				Mat image = imread(files[i], IMREAD_COLOR);
+				if (image.empty())
+				{
+					result.error = "cannot read image";
+				}
+				else
+				{
+					result.imageSize = image.size();
+					detector.detectMarkers(image, result.markers, batchParams);
+					if (!camMatrix.empty())
+						estimateMarkerPoses(result.markers, markerSize, camMatrix, distCoeffs, result.poses);
+				}
+			}
+			catch (const std::exception& e)
+			{
+				result.markers.clear();
+				result.poses.clear();
+				result.error = e.what();
+			}
+
+			if (!result.error.empty())
+				failed++;
+			markers += (int)result.markers.size();
+			writer.write(result);
+
+			if (params.verbal && (i + 1) % 1000 == 0)
+				cout << i + 1 << " images processed" << endl;
+		}
+	};
+
+	vector<std::thread> threads;
+	for (int w = 1; w < workers; w++)
+		threads.push_back(std::thread(work));
+	work();
+	for (auto& thread : threads)
+		thread.join();
+
+	BatchStatistics stats;
+	stats.images = (int)files.size();
+	stats.failed = failed;
+	stats.markers = markers;
+	stats.seconds = (getTickCount() - start) / getTickFrequency();
+	return stats;
+}
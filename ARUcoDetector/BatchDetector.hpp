@@ -0,0 +1,27 @@
+#ifndef ARUCO_BATCH_DETECTOR_HPP
+#define ARUCO_BATCH_DETECTOR_HPP
+#include <string>
+#include <vector>
+#include <opencv2/opencv.hpp>
+#include "MarkerDetector.hpp"
+#include "DetectionWriter.hpp"
+
+struct BatchStatistics {
+	int images;
+	int failed; // images that could not be read or processed
+	int markers;
+	double seconds;
+	BatchStatistics() : images(0), failed(0), markers(0), seconds(0) {}
+};
+
+// Collect the image files of a directory, of a glob pattern (e.g. "data/*.png") or of a list file
+// with one path per line. Returns false if nothing matches the input.
+bool listImageFiles(const std::string& input, vector<std::string>& files);
+
+// Detect the markers of every file on `workers` threads, each one with its own MarkerDetector, and
+// pass the results to writer as they are ready (so not in file order, see DetectionResult::index).
+// Poses are estimated only if camMatrix is not empty.
+BatchStatistics detectBatch(const vector<std::string>& files, const param& params,
+	const Mat& camMatrix, const Mat& distCoeffs, float markerSize, int workers, DetectionWriter& writer);
+
+#endif
@@ -0,0 +1,345 @@
+#include "DetectionLog.hpp"
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static_assert(sizeof(DetectionRecord) == 80, "the detection record layout is part of the file format");
+static_assert(sizeof(DetectionLogHeader) == 16, "the detection log header is part of the file format");
+
+static const uint32_t LOG_VERSION = 1;
+static const uint32_t INDEX_VERSION = 1;
+
+MappedFile::MappedFile()
+	: data(NULL), length(0),
+#ifdef _WIN32
+	file(NULL), mapping(NULL)
+#else
+	fd(-1)
+#endif
+{
+}
+
+MappedFile::~MappedFile()
+{
+	close();
+}
+
+bool MappedFile::open(const std::string& filename)
+{
+	close();
+#ifdef _WIN32
+	HANDLE handle = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (handle == INVALID_HANDLE_VALUE)
+		return false;
+	file = handle;
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(handle, &fileSize))
+	{
+		close();
+		return false;
+	}
+	length = (size_t)fileSize.QuadPart;
+	if (length == 0) // empty files cannot be mapped
+		return true;
+	mapping = CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (mapping == NULL)
+	{
+		close();
+		return false;
+	}
+	data = (const char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+#else
+	fd = ::open(filename.c_str(), O_RDONLY);
+	if (fd < 0)
+		return false;
+	struct stat info;
+	if (fstat(fd, &info) != 0)
+	{
+		close();
+		return false;
+	}
+	length = (size_t)info.st_size;
+	if (length == 0) // empty files cannot be mapped
+		return true;
+	void* address = mmap(NULL, length, PROT_READ, MAP_SHARED, fd, 0);
+	data = address == MAP_FAILED ? NULL : (const char*)address;
+#endif
+	if (data == NULL)
+	{
+		close();
+		return false;
+	}
+	return true;
+}
+
+void MappedFile::close()
+{
+#ifdef _WIN32
+	if (data != NULL)
+		UnmapViewOfFile(data);
+	if (mapping != NULL)
+		CloseHandle(mapping);
+	if (file != NULL)
+		CloseHandle(file);
+	mapping = NULL;
+	file = NULL;
+#else
+	if (data != NULL)
+		munmap((void*)data, length);
+	if (fd >= 0)
+		::close(fd);
+	fd = -1;
+#endif
+	data = NULL;
+	length = 0;
+}
+
+
+DetectionLogWriter::DetectionLogWriter()
+{
+}
+
+DetectionLogWriter::~DetectionLogWriter()
+{
+	close();
+}
+
+bool DetectionLogWriter::open(const std::string& filename)
+{
+	close();
+
+	// appending to an existing log requires the same format
+	DetectionLogHeader header;
+	std::ifstream existing(filename.c_str(), std::ios::binary | std::ios::ate);
+	bool exists = existing.is_open() && existing.tellg() > 0;
+	if (exists)
+	{
+		existing.seekg(0);
+		existing.read((char*)&header, sizeof(header));
+		if (!existing || memcmp(header.magic, "ARDL", 4) != 0 ||
+			header.version != LOG_VERSION || header.recordSize != sizeof(DetectionRecord))
+			return false;
+	}
+	existing.close();
+
+	file.open(filename.c_str(), std::ios::binary | std::ios::app);
+	if (!file.is_open())
+		return false;
+	if (!exists)
+	{
+		memcpy(header.magic, "ARDL", 4);
+		header.version = LOG_VERSION;
+		header.recordSize = sizeof(DetectionRecord);
+		header.reserved = 0;
+		file.write((const char*)&header, sizeof(header));
+	}
+	this->filename = filename;
+	return true;
+}
+
+void DetectionLogWriter::append(const DetectionRecord& record)
+{
+	CV_Assert(file.is_open());
+	file.write((const char*)&record, sizeof(record));
+}
+
+void DetectionLogWriter::append(uint32_t frame, double timestamp, const vector<MarkerInfo>& markers, const vector<MarkerPose>& poses)
+{
+	for (size_t i = 0; i < markers.size(); i++)
+	{
+		DetectionRecord record;
+		memset(&record, 0, sizeof(record));
+		record.frame = frame;
+		record.markerId = markers[i].markerId;
+		record.timestamp = timestamp;
+		for (size_t c = 0; c < 4 && c < markers[i].markerCorners.size(); c++)
+		{
+			record.corners[2 * c] = markers[i].markerCorners[c].x;
+			record.corners[2 * c + 1] = markers[i].markerCorners[c].y;
+		}
+		record.reprojectionError = -1;
+		if (i < poses.size())
+		{
+			for (int k = 0; k < 3; k++)
+			{
+				record.rotationVector[k] = (float)poses[i].rotationVector[k];
+				record.translationVector[k] = (float)poses[i].translationVector[k];
+			}
+			record.reprojectionError = (float)poses[i].reprojectionError;
+			record.flags |= DETECTION_HAS_POSE;
+		}
+		append(record);
+	}
+}
+
+void DetectionLogWriter::close()
+{
+	if (!file.is_open())
+		return;
+	file.close();
+
+	DetectionLogReader log;
+	if (log.open(filename))
+		DetectionLogIndex::build(log, DetectionLogIndex::getIndexFilename(filename));
+}
+
+
+DetectionLogReader::DetectionLogReader()
+	: records(NULL), count(0)
+{
+}
+
+bool DetectionLogReader::open(const std::string& filename)
+{
+	records = NULL;
+	count = 0;
+	if (!mapped.open(filename) || mapped.getSize() < sizeof(DetectionLogHeader))
+		return false;
+
+	const DetectionLogHeader* header = (const DetectionLogHeader*)mapped.getData();
+	if (memcmp(header->magic, "ARDL", 4) != 0 || header->version != LOG_VERSION ||
+		header->recordSize != sizeof(DetectionRecord))
+		return false;
+
+	// a partially written last record is ignored
+	records = (const DetectionRecord*)(mapped.getData() + sizeof(DetectionLogHeader));
+	count = (mapped.getSize() - sizeof(DetectionLogHeader)) / sizeof(DetectionRecord);
+	return true;
+}
+
+
+DetectionLogIndex::DetectionLogIndex()
+	: header(NULL), entries(NULL), ranges(NULL)
+{
+}
+
+std::string DetectionLogIndex::getIndexFilename(const std::string& logFilename)
+{
+	return logFilename + ".idx";
+}
+
+bool DetectionLogIndex::build(const DetectionLogReader& log, const std::string& indexFilename)
+{
+	// sort the (id, frame) pairs, the log is not in frame order in batch mode
+	vector<std::pair<int32_t, uint32_t> > detections(log.size());
+	for (size_t i = 0; i < log.size(); i++)
+		detections[i] = std::make_pair(log[i].markerId, log[i].frame);
+	std::sort(detections.begin(), detections.end());
+
+	vector<Entry> entryList;
+	vector<FrameRange> rangeList;
+	for (size_t i = 0; i < detections.size(); i++)
+	{
+		int32_t id = detections[i].first;
+		uint32_t frame = detections[i].second;
+		if (entryList.empty() || entryList.back().markerId != id)
+		{
+			Entry entry;
+			entry.markerId = id;
+			entry.firstRange = (uint32_t)rangeList.size();
+			entry.rangeCount = 0;
+			entry.records = 0;
+			entryList.push_back(entry);
+		}
+		Entry& entry = entryList.back();
+		entry.records++;
+
+		// merge consecutive frames
+		if (entry.rangeCount > 0 && frame <= rangeList.back().last + 1)
+		{
+			rangeList.back().last = std::max(rangeList.back().last, frame);
+		}
+		else
+		{
+			FrameRange range;
+			range.first = range.last = frame;
+			rangeList.push_back(range);
+			entry.rangeCount++;
+		}
+	}
+
+	std::ofstream file(indexFilename.c_str(), std::ios::binary | std::ios::trunc);
+	if (!file.is_open())
+		return false;
+	Header indexHeader;
+	memset(&indexHeader, 0, sizeof(indexHeader));
+	memcpy(indexHeader.magic, "ARDI", 4);
+	indexHeader.version = INDEX_VERSION;
+	indexHeader.logRecords = log.size();
+	indexHeader.idCount = (uint32_t)entryList.size();
+	indexHeader.rangeCount = (uint32_t)rangeList.size();
+	file.write((const char*)&indexHeader, sizeof(indexHeader));
+	if (!entryList.empty())
+		file.write((const char*)&entryList[0], entryList.size() * sizeof(Entry));
+	if (!rangeList.empty())
+		file.write((const char*)&rangeList[0], rangeList.size() * sizeof(FrameRange));
+	file.close();
+	return !file.fail();
+}
+
+bool DetectionLogIndex::open(const std::string& logFilename)
+{
+	header = NULL;
+	DetectionLogReader log;
+	if (!log.open(logFilename))
+		return false;
+
+	std::string indexFilename = getIndexFilename(logFilename);
+	for (int attempt = 0; attempt < 2; attempt++)
+	{
+		if (mapped.open(indexFilename) && mapped.getSize() >= sizeof(Header))
+		{
+			const Header* h = (const Header*)mapped.getData();
+			size_t expectedSize = sizeof(Header) + h->idCount * sizeof(Entry) + h->rangeCount * sizeof(FrameRange);
+			if (memcmp(h->magic, "ARDI", 4) == 0 && h->version == INDEX_VERSION &&
+				h->logRecords == log.size() && mapped.getSize() == expectedSize)
+			{
+				header = h;
+				entries = (const Entry*)(mapped.getData() + sizeof(Header));
+				ranges = (const FrameRange*)(entries + h->idCount);
+				return true;
+			}
+		}
+		// missing or out of date
+		mapped.close();
+		if (attempt == 0 && !build(log, indexFilename))
+			return false;
+	}
+	return false;
+}
+
+const DetectionLogIndex::Entry* DetectionLogIndex::_find(int markerId) const
+{
+	if (header == NULL)
+		return NULL;
+	const Entry* end = entries + header->idCount;
+	const Entry* entry = std::lower_bound(entries, end, markerId,
+		[](const Entry& e, int id) { return e.markerId < id; });
+	return entry != end && entry->markerId == markerId ? entry : NULL;
+}
+
+vector<FrameRange> DetectionLogIndex::getFrameRanges(int markerId) const
+{
+	const Entry* entry = _find(markerId);
+	if (entry == NULL)
+		return vector<FrameRange>();
+	return vector<FrameRange>(ranges + entry->firstRange, ranges + entry->firstRange + entry->rangeCount);
+}
+
+size_t DetectionLogIndex::getRecordCount(int markerId) const
+{
+	const Entry* entry = _find(markerId);
+	return entry == NULL ? 0 : entry->records;
+}
@@ -0,0 +1,136 @@
+#ifndef ARUCO_DETECTION_LOG_HPP
+#define ARUCO_DETECTION_LOG_HPP
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "MarkerDetector.hpp"
+#include "MarkerPose.hpp"
+
+// Binary detection log: a 16 byte header followed by fixed size records, one per detected marker,
+// in little endian. The log is append-only and read through a memory mapping. A sidecar index
+// (log filename + ".idx") maps every marker id to the frame ranges where it was detected.
+
+enum DetectionRecordFlags {
+	DETECTION_HAS_POSE = 1
+};
+
+struct DetectionRecord {
+	uint32_t frame;
+	int32_t markerId;
+	double timestamp; // milliseconds
+	float corners[8]; // x0, y0, ..., x3, y3
+	float rotationVector[3];
+	float translationVector[3];
+	float reprojectionError; // RMS in pixels, -1 without pose
+	uint32_t flags;
+};
+
+struct DetectionLogHeader {
+	char magic[4]; // "ARDL"
+	uint32_t version;
+	uint32_t recordSize;
+	uint32_t reserved;
+};
+
+// Read-only memory mapping of a whole file
+class MappedFile
+{
+	const char* data;
+	size_t length;
+#ifdef _WIN32
+	void* file;
+	void* mapping;
+#else
+	int fd;
+#endif
+
+public:
+	MappedFile();
+	~MappedFile();
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	bool open(const std::string& filename);
+	void close();
+	const char* getData() const { return data; }
+	size_t getSize() const { return length; }
+};
+
+class DetectionLogWriter
+{
+	std::string filename;
+	std::ofstream file;
+
+public:
+	DetectionLogWriter();
+	~DetectionLogWriter();
+
+	// Open for appending, the log is created if it does not exist
+	bool open(const std::string& filename);
+	bool isOpened() const { return file.is_open(); }
+	void append(const DetectionRecord& record);
+	// One record per marker. poses may be empty.
+	void append(uint32_t frame, double timestamp, const vector<MarkerInfo>& markers, const vector<MarkerPose>& poses);
+	// Flush the records and rebuild the sidecar index
+	void close();
+};
+
+class DetectionLogReader
+{
+	MappedFile mapped;
+	const DetectionRecord* records;
+	size_t count;
+
+public:
+	DetectionLogReader();
+	bool open(const std::string& filename);
+	size_t size() const { return count; }
+	const DetectionRecord& operator[](size_t i) const { return records[i]; }
+};
+
+struct FrameRange {
+	uint32_t first;
+	uint32_t last; // inclusive
+};
+
+// Inverted index from marker id to the frame ranges where it was detected
+class DetectionLogIndex
+{
+	struct Header {
+		char magic[4]; // "ARDI"
+		uint32_t version;
+		uint64_t logRecords; // records of the log when the index was built
+		uint32_t idCount;
+		uint32_t rangeCount;
+	};
+	struct Entry {
+		int32_t markerId;
+		uint32_t firstRange;
+		uint32_t rangeCount;
+		uint32_t records;
+	};
+
+	MappedFile mapped;
+	const Header* header;
+	const Entry* entries;
+	const FrameRange* ranges;
+
+public:
+	DetectionLogIndex();
+
+	static std::string getIndexFilename(const std::string& logFilename);
+	static bool build(const DetectionLogReader& log, const std::string& indexFilename);
+
+	// Open the index of a log, rebuilding it if it is missing or older than the log
+	bool open(const std::string& logFilename);
+	// Frame ranges where markerId was detected, in increasing order
+	vector<FrameRange> getFrameRanges(int markerId) const;
+	// Number of records of markerId
+	size_t getRecordCount(int markerId) const;
+
+private:
+	const Entry* _find(int markerId) const;
+};
+
+#endif
@@ -0,0 +1,85 @@
+#include "DetectionWriter.hpp"
+#include <sstream>
+
+static void _writeJsonString(std::ostream& out, const std::string& str)
+{
+	out << '"';
+	for (char c : str)
+	{
+		switch (c)
+		{
+		case '"': out << "\\\""; break;
+		case '\\': out << "\\\\"; break;
+		case '\n': out << "\\n"; break;
+		case '\r': out << "\\r"; break;
+		case '\t': out << "\\t"; break;
+		default:
+			if ((unsigned char)c < 0x20)
+				out << "\\u00" << "0123456789abcdef"[(c >> 4) & 0xf] << "0123456789abcdef"[c & 0xf];
+			else
+				out << c;
+		}
+	}
+	out << '"';
+}
+
+static void _writeJsonVector(std::ostream& out, const Vec3d& v)
+{
+	out << '[' << v[0] << ',' << v[1] << ',' << v[2] << ']';
+}
+
+JsonLinesWriter::JsonLinesWriter(const std::string& filename)
+	: out(filename.c_str())
+{
+}
+
+void JsonLinesWriter::write(const DetectionResult& result)
+{
+	// format outside of the lock, the workers only wait for the file write
+	std::ostringstream line;
+	line.precision(9);
+	line << "{\"index\":" << result.index << ",\"file\":";
+	_writeJsonString(line, result.file);
+	if (!result.error.empty())
+	{
+		line << ",\"error\":";
+		_writeJsonString(line, result.error);
+		line << "}\n";
+	}
+	else
+	{
+		line << ",\"width\":" << result.imageSize.width << ",\"height\":" << result.imageSize.height
+			<< ",\"markers\":[";
+		for (size_t i = 0; i < result.markers.size(); i++)
+		{
+			const MarkerInfo& marker = result.markers[i];
+			line << (i > 0 ? "," : "") << "{\"id\":" << marker.markerId << ",\"corners\":[";
+			for (size_t c = 0; c < marker.markerCorners.size(); c++)
+				line << (c > 0 ? "," : "") << '[' << marker.markerCorners[c].x << ',' << marker.markerCorners[c].y << ']';
+			line << ']';
+			if (i < result.poses.size())
+			{
+				line << ",\"rvec\":";
+				_writeJsonVector(line, result.poses[i].rotationVector);
+				line << ",\"tvec\":";
+				_writeJsonVector(line, result.poses[i].translationVector);
+			}
+			line << '}';
+		}
+		line << "]}\n";
+	}
+
+	std::lock_guard<std::mutex> lock(mutex);
+	out << line.str();
+}
+
+BinaryLogWriter::BinaryLogWriter(const std::string& filename)
+{
+	log.open(filename);
+}
+
+void BinaryLogWriter::write(const DetectionResult& result)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	log.append((uint32_t)result.index, 0, result.markers, result.poses);
+}
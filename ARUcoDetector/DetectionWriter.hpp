@@ -0,0 +1,57 @@
+#ifndef ARUCO_DETECTION_WRITER_HPP
+#define ARUCO_DETECTION_WRITER_HPP
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <opencv2/opencv.hpp>
+#include "MarkerDetector.hpp"
+#include "MarkerPose.hpp"
+#include "DetectionLog.hpp"
+
+// Detection result of one image (or video frame)
+struct DetectionResult {
+	int index;
+	std::string file;
+	std::string error; // empty unless the image could not be read or processed
+	Size imageSize;
+	vector<MarkerInfo> markers;
+	vector<MarkerPose> poses; // empty if no camera parameters are given
+	DetectionResult() : index(-1) {}
+};
+
+// Output of the batch detection. write may be called from several threads at once.
+class DetectionWriter
+{
+public:
+	virtual ~DetectionWriter() {}
+	virtual bool isOpened() const = 0;
+	virtual void write(const DetectionResult& result) = 0;
+};
+
+// One JSON object per line and per image:
+// {"index":0,"file":"a.png","width":640,"height":480,"markers":[{"id":17,"corners":[[x,y],...],"rvec":[...],"tvec":[...]}]}
+class JsonLinesWriter : public DetectionWriter
+{
+	std::ofstream out;
+	std::mutex mutex;
+
+public:
+	explicit JsonLinesWriter(const std::string& filename);
+	bool isOpened() const { return out.is_open(); }
+	void write(const DetectionResult& result);
+};
+
+// Binary detection log, one record per marker with the image index as frame number
+class BinaryLogWriter : public DetectionWriter
+{
+	DetectionLogWriter log;
+	std::mutex mutex;
+
+public:
+	explicit BinaryLogWriter(const std::string& filename);
+	bool isOpened() const { return log.isOpened(); }
+	void write(const DetectionResult& result);
+};
+
+#endif
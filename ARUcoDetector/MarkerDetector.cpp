@@ -7,11 +7,17 @@ void MarkerDetector::setParameters(const param& params)
 void MarkerDetector::detectMarkers(std::string filename, vector<MarkerInfo>& output, const param& params)
 {
 	// step 0. Load image
-	inputImage = imread(filename, IMREAD_COLOR);
+	Mat image = imread(filename, IMREAD_COLOR);
 
 	if (params.verbal)
 		cout << "Load image succes" << endl;
 
+	detectMarkers(image, output, params);
+}
+void MarkerDetector::detectMarkers(const Mat& image, vector<MarkerInfo>& output, const param& params)
+{
+	inputImage = image;
+
 
 
 	// step 1. Convert to grey image
@@ -135,9 +141,23 @@ void MarkerDetector::_detectMarkerCandidates(const ContourArray& inputMarkerCont
 		Mat	warpedInputImage;
 		warpPerspective(greyInputImage, warpedInputImage, PerspectiveTransformMatrix, Size(markerSampleSize, markerSampleSize));
 
-		// step 4.2.2. Binarize candidate images using Otsu's method (histogram based global threshold)
-		threshold(warpedInputImage, warpedInputImage, 125, 255, THRESH_BINARY | THRESH_OTSU); 
-		// Threshold 125 will be disregarded in Otsu's method
+		// step 4.2.2. Binarize candidate images using Otsu's method (histogram based global threshold),
+		// or threshold the mean values of the cells
+		bool otsu = params.bitThresholdMethod == BIT_THRESHOLD_OTSU;
+		Mat cells;
+		if (otsu)
+		{
+			threshold(warpedInputImage, warpedInputImage, 125, 255, THRESH_BINARY | THRESH_OTSU); 
+			// Threshold 125 will be disregarded in Otsu's method
+		}
+		else
+		{
+			cells.create(markerBitsWithBorder, markerBitsWithBorder, CV_8UC1);
+			_getCellsFromMeans(warpedInputImage, cellSize, cells);
+		}
+		auto isWhiteCell = [&](int x, int y) {
+			return otsu ? _isWhiteCell(x, y, cellSize, warpedInputImage) : cells.at<uchar>(y, x) != 0;
+		};
 
 
 		// step 4.2.3. Vheck wheather boundary contains white cell
@@ -148,7 +168,7 @@ void MarkerDetector::_detectMarkerCandidates(const ContourArray& inputMarkerCont
 				if (
 					!whiteBorderCellExist &&
 					_isBorder(x, y, BorderBits, markerBitsWithBorder) &&
-					_isWhiteCell(x, y, cellSize, warpedInputImage)
+					isWhiteCell(x, y)
 					)
 					whiteBorderCellExist = true;
 			}
@@ -160,7 +180,7 @@ void MarkerDetector::_detectMarkerCandidates(const ContourArray& inputMarkerCont
 			for (int x = BorderBits; x < markerBits + BorderBits; x++)
 				for (int y = BorderBits; y < markerBits + BorderBits; y++)
 				{
-					if (_isWhiteCell(x, y, cellSize, warpedInputImage))
+					if (isWhiteCell(x, y))
 						bitMatrix.at<uchar>(y - BorderBits, x - BorderBits) = 1;
 					else
 						bitMatrix.at<uchar>(y - BorderBits, x - BorderBits) = 0;
@@ -184,10 +204,77 @@ bool MarkerDetector::_isWhiteCell(int x, int y, int cellSize, const Mat& warpedI
 	return  countNonZero(cell) > (cellSize * cellSize) / 2;
 }
 
+// Cells from their mean value in one pass over the candidate image, thresholded at the mean of the cells minus
+// adaptiveThresC or at the middle of the two clusters of the cell means. Cells closer than minCellContrast are
+// all black or all white.
+void MarkerDetector::_getCellsFromMeans(const Mat& warpedInputImage, int cellSize, Mat& cells)
+{
+	int nCells = cells.rows * cells.cols;
+	float area = (float)(cellSize * cellSize);
+	vector<float> means(nCells);
+	float minMean = 255, maxMean = 0, mean = 0;
+	for (int y = 0; y < cells.rows; y++)
+		for (int x = 0; x < cells.cols; x++)
+		{
+			int sum = 0;
+			for (int r = 0; r < cellSize; r++)
+			{
+				const uchar* pixels = warpedInputImage.ptr(y * cellSize + r) + x * cellSize;
+				for (int c = 0; c < cellSize; c++)
+					sum += pixels[c];
+			}
+			float cellMean = sum / area;
+			means[y * cells.cols + x] = cellMean;
+			minMean = std::min(minMean, cellMean);
+			maxMean = std::max(maxMean, cellMean);
+			mean += cellMean;
+		}
+	mean /= nCells;
+
+	if (maxMean - minMean < params.minCellContrast)
+	{
+		cells.setTo(mean > 127 ? 1 : 0);
+		return;
+	}
+
+	float thresholdValue;
+	if (params.bitThresholdMethod == BIT_THRESHOLD_LOCAL_MEAN)
+		thresholdValue = mean - params.adaptiveThresC;
+	else
+	{
+		// two means clustering, both clusters are never empty
+		thresholdValue = (minMean + maxMean) / 2;
+		for (int iter = 0; iter < 10; iter++)
+		{
+			float darkSum = 0, brightSum = 0;
+			int dark = 0;
+			for (float cellMean : means)
+			{
+				if (cellMean > thresholdValue)
+					brightSum += cellMean;
+				else
+				{
+					darkSum += cellMean;
+					dark++;
+				}
+			}
+			float next = (darkSum / dark + brightSum / (nCells - dark)) / 2;
+			bool converged = std::abs(next - thresholdValue) < 0.5f;
+			thresholdValue = next;
+			if (converged)
+				break;
+		}
+	}
+
+	for (int k = 0; k < nCells; k++)
+		cells.ptr()[k] = means[k] > thresholdValue ? 1 : 0;
+}
+
 void MarkerDetector::_identifyCandidates(const vector<Mat>& bitMatrices, const ContourArray& candidateMarkerContours, vector<MarkerInfo>& output)
 {
 	int rotation = -1;
 	int markerInputId = -1;
+	finalDetectedMarkers.clear();
 	// step 5.1. Identify bitmaps and insert only valid id into output
 	for (int i = 0; i < candidateMarkerContours.size(); i++)
 	{
@@ -12,6 +12,13 @@ using namespace cv;
 typedef vector<Point2f> Contour;
 typedef vector<Contour> ContourArray;
 
+// How the cells of a candidate are thresholded once its perspective is removed
+enum BitThresholdMethod {
+	BIT_THRESHOLD_OTSU,       // Otsu's method on the whole candidate image
+	BIT_THRESHOLD_LOCAL_MEAN, // mean of the cells minus adaptiveThresC, the rule of the adaptive threshold
+	BIT_THRESHOLD_CLUSTERS    // middle of the two clusters of the cell means
+};
+
 struct param {
 
 	int borderBits, cellSize, dictionaryId;
@@ -25,6 +32,9 @@ struct param {
 	bool verbal; // print intermediate process
 
 	float errorCorrectionRate;
+
+	int bitThresholdMethod;
+	float minCellContrast; // below this difference between the cell means, all the cells have the same value
 	param() {
 		borderBits = 1;
 		cellSize = 10;
@@ -40,6 +50,9 @@ struct param {
 
 		errorCorrectionRate = 1.0f;
 
+		bitThresholdMethod = BIT_THRESHOLD_OTSU;
+		minCellContrast = 10.0f;
+
 		showImage = false;
 	}
 };
@@ -69,6 +82,7 @@ class MarkerDetector
 	void _detectMarkerCandidates(const ContourArray& inputMarkerContours, const Mat& greyInputImage, vector<Mat>& bitMatrices, ContourArray& candidateMarkerContours);
 	bool _isBorder(int x, int y, int BorderBits, int markerBitsWithBorder);
 	bool _isWhiteCell(int x, int y, int cellSize, const Mat& warpedInputImage);
+	void _getCellsFromMeans(const Mat& warpedInputImage, int cellSize, Mat& cells);
 
 	void _identifyCandidates(const vector<Mat>& bitMatrices, const ContourArray& candidateMarkerContours, vector<MarkerInfo>& output);
 	bool _identify(const Mat& onlyBits, int& idx, int& rotation, float maxCorrectionRate);
@@ -76,6 +90,7 @@ class MarkerDetector
 
 public:
 	void detectMarkers(std::string filename, vector<MarkerInfo>& output, const param& params);
+	void detectMarkers(const Mat& image, vector<MarkerInfo>& output, const param& params);
 	void setParameters(const param& params);
 	void getInputImage(Mat& output);
 };
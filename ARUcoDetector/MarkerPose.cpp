@@ -0,0 +1,51 @@
+#include "MarkerPose.hpp"
+#include <sstream>
+
+void estimateMarkerPoses(const vector<MarkerInfo>& markers, float markerSize,
+	const Mat& camMatrix, const Mat& distCoeffs, vector<MarkerPose>& poses)
+{
+	vector<cv::Point3f> markerCorners3d;
+	markerCorners3d.push_back(cv::Point3f(markerSize, markerSize, 0));
+	markerCorners3d.push_back(cv::Point3f(-markerSize, markerSize, 0));
+	markerCorners3d.push_back(cv::Point3f(-markerSize, -markerSize, 0));
+	markerCorners3d.push_back(cv::Point3f(markerSize, -markerSize, 0));
+
+	poses.resize(markers.size());
+	for (size_t i = 0; i < markers.size(); i++)
+	{
+		//Compute translation and rotation vectors
+		solvePnP(markerCorners3d, markers[i].markerCorners, camMatrix, distCoeffs,
+			poses[i].rotationVector, poses[i].translationVector);
+
+		vector<Point2f> projected;
+		projectPoints(markerCorners3d, poses[i].rotationVector, poses[i].translationVector, camMatrix, distCoeffs, projected);
+		double squaredError = 0;
+		for (size_t c = 0; c < projected.size(); c++)
+		{
+			Point2f diff = projected[c] - markers[i].markerCorners[c];
+			squaredError += diff.dot(diff);
+		}
+		poses[i].reprojectionError = std::sqrt(squaredError / projected.size());
+	}
+}
+
+void drawMarkerPoses(Mat& image, const vector<MarkerInfo>& markers, const vector<MarkerPose>& poses,
+	const Mat& camMatrix, const Mat& distCoeffs, float axisLength)
+{
+	for (size_t i = 0; i < markers.size(); i++)
+	{
+		drawFrameAxes(image, camMatrix, distCoeffs, poses[i].rotationVector, poses[i].translationVector, axisLength, 4);
+
+
+		// Find Id display position using projection matrix
+		vector<Point3f> idPos3d;
+		vector<Point2f> idPos;
+		idPos3d.push_back(Point3f(0, 0, 0));
+		projectPoints(idPos3d, poses[i].rotationVector, poses[i].translationVector, camMatrix, distCoeffs, idPos);
+
+		std::stringstream s;
+		s << "Id=" << markers[i].markerId;
+		putText(image, s.str(), idPos[0], FONT_HERSHEY_SIMPLEX, 0.6,
+			cv::Scalar(100, 200, 0), 2);
+	}
+}
@@ -0,0 +1,21 @@
+#ifndef ARUCO_MARKER_POSE_HPP
+#define ARUCO_MARKER_POSE_HPP
+#include <vector>
+#include <opencv2/opencv.hpp>
+#include "MarkerDetector.hpp"
+
+struct MarkerPose {
+	Vec3d rotationVector;
+	Vec3d translationVector;
+	double reprojectionError; // RMS of the corner reprojection, in pixels
+};
+
+// Estimate the pose of each marker with solvePnP. markerSize is the half side of the marker.
+void estimateMarkerPoses(const vector<MarkerInfo>& markers, float markerSize,
+	const Mat& camMatrix, const Mat& distCoeffs, vector<MarkerPose>& poses);
+
+// Draw the axes and the id of each marker on image
+void drawMarkerPoses(Mat& image, const vector<MarkerInfo>& markers, const vector<MarkerPose>& poses,
+	const Mat& camMatrix, const Mat& distCoeffs, float axisLength);
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef ARUCO_SPSC_QUEUE_HPP
+#define ARUCO_SPSC_QUEUE_HPP
+#include <atomic>
+#include <vector>
+#include <cstddef>
+
+// Bounded lock-free ring buffer for exactly one producer thread and one consumer thread.
+// One slot is kept empty to tell a full buffer from an empty one.
+template <typename T>
+class SpscQueue
+{
+	std::vector<T> buffer;
+
+	// head is written only by the consumer and tail only by the producer.
+	// Keep them on different cache lines so both sides do not invalidate each other.
+	char padding0[64];
+	std::atomic<size_t> head;
+	char padding1[64];
+	std::atomic<size_t> tail;
+	char padding2[64];
+
+	size_t _next(size_t index) const { return index + 1 == buffer.size() ? 0 : index + 1; }
+
+public:
+	explicit SpscQueue(size_t capacity) : buffer(capacity + 1), head(0), tail(0) {}
+
+	SpscQueue(const SpscQueue&) = delete;
+	SpscQueue& operator=(const SpscQueue&) = delete;
+
+	// Producer side. Returns false if the queue is full, item is left untouched then.
+	bool tryPush(T& item)
+	{
+		size_t t = tail.load(std::memory_order_relaxed);
+		size_t next = _next(t);
+		if (next == head.load(std::memory_order_acquire))
+			return false;
+		buffer[t] = std::move(item);
+		tail.store(next, std::memory_order_release);
+		return true;
+	}
+
+	// Consumer side. Returns false if the queue is empty.
+	bool tryPop(T& item)
+	{
+		size_t h = head.load(std::memory_order_relaxed);
+		if (h == tail.load(std::memory_order_acquire))
+			return false;
+		item = std::move(buffer[h]);
+		buffer[h] = T();
+		head.store(_next(h), std::memory_order_release);
+		return true;
+	}
+
+	// Number of queued items. Exact only when called from the producer or the consumer thread
+	// while the other side is idle, an estimate otherwise.
+	size_t size() const
+	{
+		size_t h = head.load(std::memory_order_acquire);
+		size_t t = tail.load(std::memory_order_acquire);
+		return t >= h ? t - h : t + buffer.size() - h;
+	}
+
+	size_t capacity() const { return buffer.size() - 1; }
+};
+
+#endif
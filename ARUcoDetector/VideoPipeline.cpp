@@ -0,0 +1,223 @@
+#include "VideoPipeline.hpp"
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <iomanip>
+#include <mutex>
+#include <thread>
+
+// Wait strategy for full/empty queues: spin first, then give up the time slice, then sleep
+static void _backoff(int spins)
+{
+	if (spins < 64)
+		return;
+	else if (spins < 256)
+		std::this_thread::yield();
+	else
+		std::this_thread::sleep_for(std::chrono::microseconds(100));
+}
+
+VideoPipeline::VideoPipeline(size_t queueCapacity)
+	: queueCapacity(queueCapacity), wallTime(0), frames(0), aborted(false)
+{
+	CV_Assert(queueCapacity > 0);
+}
+
+void VideoPipeline::setSource(const std::string& name, const SourceFunction& source)
+{
+	this->source = source;
+	Stage stage;
+	stage.name = name;
+	stage.workers = 1;
+	if (stages.empty())
+		stages.push_back(stage);
+	else
+		stages[0] = stage;
+}
+
+void VideoPipeline::addStage(const std::string& name, int workers, const StageFunction& function)
+{
+	CV_Assert(!stages.empty()); // the source comes first
+	CV_Assert(workers > 0);
+	Stage stage;
+	stage.name = name;
+	stage.workers = workers;
+	stage.function = function;
+	stages.push_back(stage);
+}
+
+void VideoPipeline::setSink(const std::string& name, const StageFunction& sink)
+{
+	addStage(name, 1, sink);
+}
+
+bool VideoPipeline::_pop(Queue& queue, FrameJob& job, WorkerCounters& counters)
+{
+	size_t depth = queue.size();
+	counters.maxQueueDepth = std::max(counters.maxQueueDepth, depth);
+	counters.queueDepthSum += (double)depth;
+	counters.pops++;
+
+	for (int spins = 0; !queue.tryPop(job); spins++)
+	{
+		if (aborted)
+			return false;
+		_backoff(spins);
+	}
+	return true;
+}
+
+bool VideoPipeline::_push(Queue& queue, FrameJob& job)
+{
+	for (int spins = 0; !queue.tryPush(job); spins++)
+	{
+		if (aborted)
+			return false;
+		_backoff(spins);
+	}
+	return true;
+}
+
+void VideoPipeline::_runWorker(int s, int w, WorkerCounters& counters)
+{
+	int workers = stages[s].workers;
+	int prevWorkers = s > 0 ? stages[s - 1].workers : 0;
+	int nextWorkers = s + 1 < (int)stages.size() ? stages[s + 1].workers : 0;
+
+	for (int i = w; !aborted; i += workers)
+	{
+		FrameJob job;
+		int64 start = getTickCount();
+		if (s == 0)
+		{
+			if (!source(job))
+				job.endOfStream = true;
+			job.index = i;
+		}
+		else
+		{
+			// frame i comes from worker i % prevWorkers of the previous stage
+			if (!_pop(*queues[s - 1][(i % prevWorkers) * workers + w], job, counters))
+				return;
+			start = getTickCount();
+		}
+
+		if (job.endOfStream)
+		{
+			// every worker of the next stage may be waiting for a frame of this one
+			for (int c = 0; c < nextWorkers; c++)
+			{
+				FrameJob end;
+				end.index = i;
+				end.endOfStream = true;
+				if (!_push(*queues[s][w * nextWorkers + c], end))
+					return;
+			}
+			return;
+		}
+
+		if (s > 0)
+			stages[s].function(job, w);
+		counters.busyTime += (getTickCount() - start) / getTickFrequency();
+		counters.frames++;
+
+		if (nextWorkers > 0 && !_push(*queues[s][w * nextWorkers + i % nextWorkers], job))
+			return;
+	}
+}
+
+void VideoPipeline::run()
+{
+	CV_Assert(stages.size() >= 2 && source);
+
+	// queue mesh between consecutive stages
+	queues.clear();
+	queues.resize(stages.size() - 1);
+	for (size_t s = 0; s + 1 < stages.size(); s++)
+		for (int k = 0; k < stages[s].workers * stages[s + 1].workers; k++)
+			queues[s].push_back(std::unique_ptr<Queue>(new Queue(queueCapacity)));
+
+	vector<vector<WorkerCounters> > counters(stages.size());
+	for (size_t s = 0; s < stages.size(); s++)
+		counters[s].resize(stages[s].workers);
+
+	aborted = false;
+	std::mutex errorMutex;
+	std::exception_ptr error;
+
+	int64 start = getTickCount();
+	vector<std::thread> threads;
+	for (int s = 0; s < (int)stages.size(); s++)
+	{
+		for (int w = 0; w < stages[s].workers; w++)
+		{
+			threads.push_back(std::thread([&, s, w]() {
+				try
+				{
+					_runWorker(s, w, counters[s][w]);
+				}
+				catch (...)
+				{
+					std::lock_guard<std::mutex> lock(errorMutex);
+					if (!error)
+						error = std::current_exception();
+					aborted = true;
+				}
+			}));
+		}
+	}
+	for (auto& thread : threads)
+		thread.join();
+	wallTime = (getTickCount() - start) / getTickFrequency();
+
+	// merge the counters of the workers of each stage
+	statistics.clear();
+	for (size_t s = 0; s < stages.size(); s++)
+	{
+		StageStatistics stats;
+		stats.name = stages[s].name;
+		stats.workers = stages[s].workers;
+		stats.frames = 0;
+		stats.busyTime = 0;
+		stats.maxQueueDepth = 0;
+		double depthSum = 0;
+		int pops = 0;
+		for (const auto& c : counters[s])
+		{
+			stats.frames += c.frames;
+			stats.busyTime += c.busyTime;
+			stats.maxQueueDepth = std::max(stats.maxQueueDepth, c.maxQueueDepth);
+			depthSum += c.queueDepthSum;
+			pops += c.pops;
+		}
+		stats.meanQueueDepth = pops > 0 ? depthSum / pops : 0;
+		statistics.push_back(stats);
+	}
+	frames = statistics.back().frames;
+	queues.clear();
+
+	if (error)
+		std::rethrow_exception(error);
+}
+
+double VideoPipeline::getThroughput() const
+{
+	return wallTime > 0 ? frames / wallTime : 0;
+}
+
+void VideoPipeline::printStatistics(std::ostream& out) const
+{
+	out << "Processed " << frames << " frames in " << wallTime << " s (" << getThroughput() << " fps)" << endl;
+	out << std::left << std::setw(10) << "stage" << std::right << std::setw(9) << "workers"
+		<< std::setw(14) << "ms/frame" << std::setw(14) << "max fps" << std::setw(12) << "max queue"
+		<< std::setw(13) << "mean queue" << endl;
+	for (const auto& stats : statistics)
+	{
+		// a stage cannot go faster than its workers busy all the time
+		double msPerFrame = stats.frames > 0 ? 1000. * stats.busyTime / stats.frames : 0;
+		double maxFps = msPerFrame > 0 ? 1000. * stats.workers / msPerFrame : 0;
+		out << std::left << std::setw(10) << stats.name << std::right << std::setw(9) << stats.workers
+			<< std::setw(14) << msPerFrame << std::setw(14) << maxFps << std::setw(12) << stats.maxQueueDepth
+			<< std::setw(13) << stats.meanQueueDepth << endl;
+	}
+}
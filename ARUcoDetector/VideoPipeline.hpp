@@ -0,0 +1,92 @@
+#ifndef ARUCO_VIDEO_PIPELINE_HPP
+#define ARUCO_VIDEO_PIPELINE_HPP
+#include <atomic>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <opencv2/opencv.hpp>
+#include "MarkerDetector.hpp"
+#include "MarkerPose.hpp"
+#include "SpscQueue.hpp"
+
+// Work item travelling through the pipeline, one per video frame
+struct FrameJob {
+	int index;
+	bool endOfStream;
+	double timestamp; // milliseconds
+	Mat image;
+	vector<MarkerInfo> markers;
+	vector<MarkerPose> poses;
+	FrameJob() : index(-1), endOfStream(false), timestamp(0) {}
+};
+
+// Multi-stage pipeline. The first stage (source) and the last one (sink) run on a single thread,
+// the others on any number of workers. Frame i is handled by worker i % n of a stage with n
+// workers and each pair of workers of consecutive stages is connected by its own bounded SPSC
+// queue, so every queue has one producer and one consumer and frames keep their order.
+class VideoPipeline
+{
+public:
+	// fills the job of the next frame, returns false at the end of the stream
+	typedef std::function<bool(FrameJob&)> SourceFunction;
+	// processes a job, worker is the index of the worker of the stage
+	typedef std::function<void(FrameJob&, int worker)> StageFunction;
+
+	struct StageStatistics {
+		std::string name;
+		int workers;
+		int frames;
+		double busyTime; // seconds, summed over the workers
+		size_t maxQueueDepth; // depth of the input queues, sampled on each pop
+		double meanQueueDepth;
+	};
+
+	explicit VideoPipeline(size_t queueCapacity);
+
+	void setSource(const std::string& name, const SourceFunction& source);
+	void addStage(const std::string& name, int workers, const StageFunction& function);
+	void setSink(const std::string& name, const StageFunction& sink);
+
+	// run until the source is exhausted. Rethrows the first exception thrown by a stage.
+	void run();
+
+	double getThroughput() const; // frames per second of the last run
+	const vector<StageStatistics>& getStatistics() const { return statistics; }
+	void printStatistics(std::ostream& out) const;
+
+private:
+	struct Stage {
+		std::string name;
+		int workers;
+		StageFunction function;
+	};
+	typedef SpscQueue<FrameJob> Queue;
+	// queues[s][p * workers of stage s + c] connects worker p of stage s to worker c of stage s + 1
+	vector<vector<std::unique_ptr<Queue> > > queues;
+
+	size_t queueCapacity;
+	SourceFunction source;
+	vector<Stage> stages; // stages[0] is the source
+	vector<StageStatistics> statistics;
+	double wallTime;
+	int frames;
+
+	struct WorkerCounters {
+		int frames;
+		double busyTime;
+		size_t maxQueueDepth;
+		double queueDepthSum;
+		int pops;
+		WorkerCounters() : frames(0), busyTime(0), maxQueueDepth(0), queueDepthSum(0), pops(0) {}
+	};
+
+	std::atomic<bool> aborted;
+
+	void _runWorker(int stage, int worker, WorkerCounters& counters);
+	bool _pop(Queue& queue, FrameJob& job, WorkerCounters& counters);
+	bool _push(Queue& queue, FrameJob& job);
+};
+
+#endif
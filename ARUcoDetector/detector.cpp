@@ -2,6 +2,12 @@
 #include "opencv2/core/hal/hal.hpp"
 #include "dictionary.hpp"
 #include "MarkerDetector.hpp"
+#include "MarkerPose.hpp"
+#include "VideoPipeline.hpp"
+#include "BatchDetector.hpp"
+#include "DetectionLog.hpp"
+#include <memory>
+#include <thread>
 #include <vector>
 #include <sstream>
 using namespace cv;
@@ -13,8 +19,10 @@ const int WAIT_TIME = 0;
 namespace {
 	const char* about = "Detect ArUco markers from image";
 	const char* keys =
-		"{@outfile |<none> | Output image }"
+		"{@outfile |<none> | Output image (output video in video mode, JSON lines file or binary detection log if it ends with .bin in batch mode) }"
 		"{name     |       | Input filename }"
+		"{video    |       | Input video filename. Runs the pipelined video mode }"
+		"{batch    |       | Input directory, glob pattern or list file of images. Runs the batch mode }"
 		"{d        |       | dictionary: DICT_4X4_50=0, DICT_4X4_100=1, DICT_4X4_250=2,"
 		"DICT_4X4_1000=3, DICT_5X5_50=4, DICT_5X5_100=5, DICT_5X5_250=6, DICT_5X5_1000=7, "
 		"DICT_6X6_50=8, DICT_6X6_100=9, DICT_6X6_250=10, DICT_6X6_1000=11, DICT_7X7_50=12,"
@@ -24,13 +32,167 @@ namespace {
 		"{si       | false | show generated image }"
 		"{ml       | 0.035 | marker size }"
 		"{al       | 1     | axis size (relative to ml) }"
-		"{verb     | false | print pipeline completion message }";
+		"{verb     | false | print pipeline completion message }"
+		"{dw       | 2     | number of detection workers (video mode) }"
+		"{pw       | 1     | number of pose estimation workers (video mode) }"
+		"{rw       | 1     | number of rendering workers (video mode) }"
+		"{qc       | 8     | capacity of the queues between pipeline stages (video mode) }"
+		"{threads  | 0     | number of worker threads (batch mode), 0 for one per core }"
+		"{log      |       | binary detection log to append the detections to (video mode), or to query }"
+		"{query    |       | print the frames where this marker id was detected in the detection log and exit }";
+}
+
+static bool readDetectorParameters(const std::string& filename, param& params)
+{
+	FileStorage fs_param(filename, FileStorage::READ);
+	if (!fs_param.isOpened())
+		return false;
+	fs_param["adaptiveThresC"] >> params.adaptiveThresC;
+	fs_param["adaptiveThresWindowSize"] >> params.adaptiveThresWindowSize;
+	fs_param["borderBits"] >> params.borderBits;
+	fs_param["cellSize"] >> params.cellSize;
+	fs_param["errorCorrectionRate"] >> params.errorCorrectionRate;
+	fs_param["polyApproxAccuracyRate"] >> params.polyApproxAccuracyRate;
+	// optional keys, files written before they existed keep the defaults
+	if (!fs_param["bitThresholdMethod"].empty())
+		fs_param["bitThresholdMethod"] >> params.bitThresholdMethod;
+	if (!fs_param["minCellContrast"].empty())
+		fs_param["minCellContrast"] >> params.minCellContrast;
+	fs_param.release();
+	return true;
+}
+
+static bool readCameraParameters(const std::string& filename, Mat& camMatrix, Mat& distCoeffs)
+{
+	FileStorage fs_cam(filename, FileStorage::READ);
+	if (!fs_cam.isOpened())
+		return false;
+	fs_cam["camera_matrix"] >> camMatrix;
+	fs_cam["distortion_coefficients"] >> distCoeffs;
+	fs_cam.release();
+	return true;
+}
+
+// Streaming mode: decode -> detect -> pose -> render -> encode, each stage on its own threads
+static int runVideo(const std::string& videoFilename, const std::string& outFilename, const std::string& logFilename,
+	const param& params, const Mat& camMatrix, const Mat& distCoeffs, float markerSize, float axisSize,
+	int detectWorkers, int poseWorkers, int renderWorkers, int queueCapacity)
+{
+	VideoCapture capture(videoFilename);
+	if (!capture.isOpened())
+	{
+		cout << "Cannot open video " << videoFilename << endl;
+		return 0;
+	}
+	double fps = capture.get(CAP_PROP_FPS);
+	if (fps <= 0)
+		fps = 30;
+
+	// the detector shows its intermediate images only in the single image mode
+	param pipelineParams = params;
+	pipelineParams.showImage = false;
+
+	// each detection worker owns its detector
+	vector<MarkerDetector> detectors(detectWorkers);
+	for (auto& detector : detectors)
+		detector.setParameters(pipelineParams);
+
+	DetectionLogWriter log;
+	if (!logFilename.empty() && !log.open(logFilename))
+	{
+		cout << "Cannot open detection log " << logFilename << endl;
+		return 0;
+	}
+
+	VideoWriter writer;
+	VideoPipeline pipeline(queueCapacity);
+
+	pipeline.setSource("decode", [&](FrameJob& job) {
+		if (!capture.read(job.image) || job.image.empty())
+			return false;
+		job.timestamp = capture.get(CAP_PROP_POS_MSEC);
+		return true;
+	});
+	pipeline.addStage("detect", detectWorkers, [&](FrameJob& job, int worker) {
+		detectors[worker].detectMarkers(job.image, job.markers, pipelineParams);
+	});
+	pipeline.addStage("pose", poseWorkers, [&](FrameJob& job, int) {
+		estimateMarkerPoses(job.markers, markerSize, camMatrix, distCoeffs, job.poses);
+	});
+	pipeline.addStage("render", renderWorkers, [&](FrameJob& job, int) {
+		drawMarkerPoses(job.image, job.markers, job.poses, camMatrix, distCoeffs, markerSize * axisSize);
+	});
+	pipeline.setSink("encode", [&](FrameJob& job, int) {
+		if (!writer.isOpened())
+			writer.open(outFilename, VideoWriter::fourcc('M', 'J', 'P', 'G'), fps, job.image.size());
+		writer.write(job.image);
+		if (log.isOpened())
+			log.append((uint32_t)job.index, job.timestamp, job.markers, job.poses);
+		if (params.verbal)
+			cout << "frame " << job.index << ": " << job.markers.size() << " markers" << endl;
+	});
+
+	pipeline.run();
+	log.close();
+	pipeline.printStatistics(cout);
+	return 0;
+}
+
+// Print the frame ranges where a marker was detected, using the sidecar index of the log
+static int queryLog(const std::string& logFilename, int markerId)
+{
+	DetectionLogIndex index;
+	if (!index.open(logFilename))
+	{
+		cout << "Cannot open detection log " << logFilename << endl;
+		return 0;
+	}
+	vector<FrameRange> ranges = index.getFrameRanges(markerId);
+	cout << "Marker " << markerId << ": " << index.getRecordCount(markerId) << " detections" << endl;
+	for (const auto& range : ranges)
+		cout << range.first << " - " << range.last << endl;
+	return 0;
+}
+
+// Batch mode: detect the markers of many images concurrently and write them to one file
+static int runBatch(const std::string& input, const std::string& outFilename, const param& params,
+	const Mat& camMatrix, const Mat& distCoeffs, float markerSize, int threads)
+{
+	vector<std::string> files;
+	if (!listImageFiles(input, files))
+	{
+		cout << "No images found in " << input << endl;
+		return 0;
+	}
+	if (threads <= 0)
+		threads = std::max(1, (int)std::thread::hardware_concurrency());
+
+	std::unique_ptr<DetectionWriter> writer;
+	bool binary = outFilename.size() >= 4 && outFilename.compare(outFilename.size() - 4, 4, ".bin") == 0;
+	if (binary)
+		writer.reset(new BinaryLogWriter(outFilename));
+	else
+		writer.reset(new JsonLinesWriter(outFilename));
+	if (!writer->isOpened())
+	{
+		cout << "Cannot open " << outFilename << endl;
+		return 0;
+	}
+
+	BatchStatistics stats = detectBatch(files, params, camMatrix, distCoeffs, markerSize, threads, *writer);
+	cout << "Processed " << stats.images << " images (" << stats.failed << " failed, " << stats.markers
+		<< " markers) in " << stats.seconds << " s on " << threads << " threads ("
+		<< (stats.seconds > 0 ? stats.images / stats.seconds : 0) << " images/s)" << endl;
+	return 0;
 }
 
 int main(int argc, char* argv[]) {
 	CommandLineParser parser(argc, argv, keys);
 	parser.about(about);
 
+	if (parser.has("query") && parser.has("log"))
+		return queryLog(parser.get<String>("log"), parser.get<int>("query"));
+
 	if (argc < 5) {
 		parser.printMessage();
 		return 0;
@@ -38,6 +200,8 @@ int main(int argc, char* argv[]) {
 	MarkerDetector detector;
 
 	String filename = parser.get<String>("name");
+	String videoFilename = parser.get<String>("video");
+	String batchInput = parser.get<String>("batch");
 	String camParams = parser.get<String>("cam");
 	String detectionParams = parser.get<String>("param");
 	int dictionaryId = parser.get<int>("d");
@@ -45,6 +209,12 @@ int main(int argc, char* argv[]) {
 	float axisSize = parser.get<float>("al");
 	bool showImage = parser.get<bool>("si");
 	bool verbal = parser.get<bool>("verb");
+	int detectWorkers = parser.get<int>("dw");
+	int poseWorkers = parser.get<int>("pw");
+	int renderWorkers = parser.get<int>("rw");
+	int queueCapacity = parser.get<int>("qc");
+	int threads = parser.get<int>("threads");
+	String logFilename = parser.get<String>("log");
 	String outFilename = parser.get<String>(0);
 	if (!parser.check()) {
 		parser.printErrors();
@@ -53,73 +223,60 @@ int main(int argc, char* argv[]) {
 
 
 	// Parameter setting
-	FileStorage fs_param(detectionParams, FileStorage::READ);
-	if (!fs_param.isOpened())
-		return false;
 	param params;
-	fs_param["adaptiveThresC"] >> params.adaptiveThresC;
-	fs_param["adaptiveThresWindowSize"] >> params.adaptiveThresWindowSize;
-	fs_param["borderBits"] >> params.borderBits;
-	fs_param["cellSize"] >> params.cellSize;
-	fs_param["errorCorrectionRate"] >> params.errorCorrectionRate;
-	fs_param["polyApproxAccuracyRate"] >> params.polyApproxAccuracyRate;
-	fs_param.release();
+	if (!readDetectorParameters(detectionParams, params))
+		return false;
 	params.showImage = showImage;
 	params.dictionaryId = dictionaryId;
 	params.verbal = verbal;
 	detector.setParameters(params);
 
 
-	vector<MarkerInfo> finalDetectedMarkers;
-	detector.detectMarkers(filename, finalDetectedMarkers, params);
-
-
 	Mat camMatrix, distCoeffs;
-	FileStorage fs_cam(camParams, FileStorage::READ);
-	if (!fs_cam.isOpened())
+	if (!batchInput.empty())
+	{
+		// the camera is optional in batch mode, poses are written only if it is given
+		if (!camParams.empty() && !readCameraParameters(camParams, camMatrix, distCoeffs))
+			return false;
+		return runBatch(batchInput, outFilename, params, camMatrix, distCoeffs, markerSize, threads);
+	}
+	if (!readCameraParameters(camParams, camMatrix, distCoeffs))
 		return false;
-	fs_cam["camera_matrix"] >> camMatrix;
-	fs_cam["distortion_coefficients"] >> distCoeffs;
-	fs_cam.release();
-
-
-	vector<cv::Point3f> markerCorners3d;
-	markerCorners3d.push_back(cv::Point3f(markerSize, markerSize, 0));
-	markerCorners3d.push_back(cv::Point3f(-markerSize, markerSize, 0));
-	markerCorners3d.push_back(cv::Point3f(-markerSize, -markerSize, 0));
-	markerCorners3d.push_back(cv::Point3f(markerSize, -markerSize, 0));
 
 
-	Mat OutputImage;
-	detector.getInputImage(OutputImage);
-	for (const auto& marker : finalDetectedMarkers)
+	if (!videoFilename.empty())
 	{
-		//Compute translation and rotation vectors
-		Mat rotation_vector, translation_vector;
-		solvePnP(markerCorners3d, marker.markerCorners, camMatrix, distCoeffs, rotation_vector, translation_vector);
-		if (params.verbal)
+		if (detectWorkers < 1 || poseWorkers < 1 || renderWorkers < 1 || queueCapacity < 1)
 		{
-			cout << "markerID " << marker.markerId << endl;
-			cout << "rotation_vector" << endl << rotation_vector << endl;
-			cout << "translation_vector" << endl << translation_vector << endl;
+			cout << "Worker counts and queue capacity must be positive" << endl;
+			return 0;
 		}
-
-		drawFrameAxes(OutputImage, camMatrix, distCoeffs, rotation_vector, translation_vector, markerSize* axisSize, 4);
+		return runVideo(videoFilename, outFilename, logFilename, params, camMatrix, distCoeffs, markerSize, axisSize,
+			detectWorkers, poseWorkers, renderWorkers, queueCapacity);
+	}
 
 
-		// Find Id display position using projection matrix
-		vector<Point3f> idPos3d;
-		vector<Point2f> idPos;
-		idPos3d.push_back(Point3f(0, 0, 0));
-		projectPoints(idPos3d, rotation_vector, translation_vector, camMatrix, distCoeffs, idPos);
+	vector<MarkerInfo> finalDetectedMarkers;
+	detector.detectMarkers(filename, finalDetectedMarkers, params);
 
-		std::stringstream s;
-		s << "Id=" << marker.markerId;
-		putText(OutputImage, s.str(), idPos[0], FONT_HERSHEY_SIMPLEX, 0.6,
-			cv::Scalar(100,200, 0), 2);
 
+	vector<MarkerPose> poses;
+	estimateMarkerPoses(finalDetectedMarkers, markerSize, camMatrix, distCoeffs, poses);
+	if (params.verbal)
+	{
+		for (size_t i = 0; i < finalDetectedMarkers.size(); i++)
+		{
+			cout << "markerID " << finalDetectedMarkers[i].markerId << endl;
+			cout << "rotation_vector" << endl << poses[i].rotationVector << endl;
+			cout << "translation_vector" << endl << poses[i].translationVector << endl;
+		}
 	}
-	
+
+
+	Mat OutputImage;
+	detector.getInputImage(OutputImage);
+	drawMarkerPoses(OutputImage, finalDetectedMarkers, poses, camMatrix, distCoeffs, markerSize * axisSize);
+
 	if (params.showImage)
 	{
 		imshow("Axis Image", OutputImage);
@@ -38,6 +38,7 @@ the use of this software, even if advised of the possibility of such damage.
 
 
 #include "dictionary.hpp"
+#include "predefined_dictionaries.hpp"
 
 
 namespace cv {
@@ -269,31 +270,57 @@ Mat Dictionary::getBitsFromByteList(const Mat &byteList, int markerSize) {
 
 
 
+/**
+  * Codes of a predefined family of markers in the bytesList layout
+  */
+static Mat _unpackPredefinedCodes(const uint64 (*codes)[4], int nMarkers, int markerSize) {
+    int nbits = markerSize * markerSize;
+    int nbytes = (nbits + 7) / 8;
+    Mat bytesList(nMarkers, nbytes, CV_8UC4);
+    for(int i = 0; i < nMarkers; i++) {
+        for(int r = 0; r < 4; r++) {
+            // whole bytes first, the remaining bits in the low bits of the last byte
+            uchar *bytes = bytesList.ptr(i) + r * nbytes;
+            for(int j = 0; j < nbytes - 1; j++)
+                bytes[j] = (uchar)(codes[i][r] >> (nbits - 8 * (j + 1)));
+            bytes[nbytes - 1] = (uchar)(codes[i][r] & ((uint64(1) << (nbits - 8 * (nbytes - 1))) - 1));
+        }
+    }
+    return bytesList;
+}
+
+
 Ptr<Dictionary> getPredefinedDictionary(PREDEFINED_DICTIONARY_NAME name)
 {
     // DictionaryData constructors calls
     //    moved out of globals so construted on first use, which allows lazy-loading of opencv dll
-    static const Dictionary DICT_ARUCO_DATA = Dictionary(Mat(1024, (5 * 5 + 7) / 8, CV_8UC4, (uchar*)DICT_ARUCO_BYTES), 5, 0);
-
-    static const Dictionary DICT_4X4_50_DATA = Dictionary(Mat(50, (4 * 4 + 7) / 8, CV_8UC4, (uchar*)DICT_4X4_1000_BYTES), 4, 1);
-    static const Dictionary DICT_4X4_100_DATA = Dictionary(Mat(100, (4 * 4 + 7) / 8, CV_8UC4, (uchar*)DICT_4X4_1000_BYTES), 4, 1);
-    static const Dictionary DICT_4X4_250_DATA = Dictionary(Mat(250, (4 * 4 + 7) / 8, CV_8UC4, (uchar*)DICT_4X4_1000_BYTES), 4, 1);
-    static const Dictionary DICT_4X4_1000_DATA = Dictionary(Mat(1000, (4 * 4 + 7) / 8, CV_8UC4, (uchar*)DICT_4X4_1000_BYTES), 4, 0);
-
-    static const Dictionary DICT_5X5_50_DATA = Dictionary(Mat(50, (5 * 5 + 7) / 8, CV_8UC4, (uchar*)DICT_5X5_1000_BYTES), 5, 3);
-    static const Dictionary DICT_5X5_100_DATA = Dictionary(Mat(100, (5 * 5 + 7) / 8, CV_8UC4, (uchar*)DICT_5X5_1000_BYTES), 5, 3);
-    static const Dictionary DICT_5X5_250_DATA = Dictionary(Mat(250, (5 * 5 + 7) / 8, CV_8UC4, (uchar*)DICT_5X5_1000_BYTES), 5, 2);
-    static const Dictionary DICT_5X5_1000_DATA = Dictionary(Mat(1000, (5 * 5 + 7) / 8, CV_8UC4, (uchar*)DICT_5X5_1000_BYTES), 5, 2);
-
-    static const Dictionary DICT_6X6_50_DATA = Dictionary(Mat(50, (6 * 6 + 7) / 8, CV_8UC4, (uchar*)DICT_6X6_1000_BYTES), 6, 6);
-    static const Dictionary DICT_6X6_100_DATA = Dictionary(Mat(100, (6 * 6 + 7) / 8, CV_8UC4, (uchar*)DICT_6X6_1000_BYTES), 6, 5);
-    static const Dictionary DICT_6X6_250_DATA = Dictionary(Mat(250, (6 * 6 + 7) / 8, CV_8UC4, (uchar*)DICT_6X6_1000_BYTES), 6, 5);
-    static const Dictionary DICT_6X6_1000_DATA = Dictionary(Mat(1000, (6 * 6 + 7) / 8, CV_8UC4, (uchar*)DICT_6X6_1000_BYTES), 6, 4);
-
-    static const Dictionary DICT_7X7_50_DATA = Dictionary(Mat(50, (7 * 7 + 7) / 8, CV_8UC4, (uchar*)DICT_7X7_1000_BYTES), 7, 9);
-    static const Dictionary DICT_7X7_100_DATA = Dictionary(Mat(100, (7 * 7 + 7) / 8, CV_8UC4, (uchar*)DICT_7X7_1000_BYTES), 7, 8);
-    static const Dictionary DICT_7X7_250_DATA = Dictionary(Mat(250, (7 * 7 + 7) / 8, CV_8UC4, (uchar*)DICT_7X7_1000_BYTES), 7, 8);
-    static const Dictionary DICT_7X7_1000_DATA = Dictionary(Mat(1000, (7 * 7 + 7) / 8, CV_8UC4, (uchar*)DICT_7X7_1000_BYTES), 7, 6);
+    static const Mat DICT_ARUCO_BYTES = _unpackPredefinedCodes(DICT_ARUCO_CODES, 1024, 5);
+    static const Mat DICT_4X4_1000_BYTES = _unpackPredefinedCodes(DICT_4X4_1000_CODES, 1000, 4);
+    static const Mat DICT_5X5_1000_BYTES = _unpackPredefinedCodes(DICT_5X5_1000_CODES, 1000, 5);
+    static const Mat DICT_6X6_1000_BYTES = _unpackPredefinedCodes(DICT_6X6_1000_CODES, 1000, 6);
+    static const Mat DICT_7X7_1000_BYTES = _unpackPredefinedCodes(DICT_7X7_1000_CODES, 1000, 7);
+
+    static const Dictionary DICT_ARUCO_DATA = Dictionary(DICT_ARUCO_BYTES, 5, 0);
+
+    static const Dictionary DICT_4X4_50_DATA = Dictionary(DICT_4X4_1000_BYTES.rowRange(0, 50), 4, 1);
+    static const Dictionary DICT_4X4_100_DATA = Dictionary(DICT_4X4_1000_BYTES.rowRange(0, 100), 4, 1);
+    static const Dictionary DICT_4X4_250_DATA = Dictionary(DICT_4X4_1000_BYTES.rowRange(0, 250), 4, 1);
+    static const Dictionary DICT_4X4_1000_DATA = Dictionary(DICT_4X4_1000_BYTES.rowRange(0, 1000), 4, 0);
+
+    static const Dictionary DICT_5X5_50_DATA = Dictionary(DICT_5X5_1000_BYTES.rowRange(0, 50), 5, 3);
+    static const Dictionary DICT_5X5_100_DATA = Dictionary(DICT_5X5_1000_BYTES.rowRange(0, 100), 5, 3);
+    static const Dictionary DICT_5X5_250_DATA = Dictionary(DICT_5X5_1000_BYTES.rowRange(0, 250), 5, 2);
+    static const Dictionary DICT_5X5_1000_DATA = Dictionary(DICT_5X5_1000_BYTES.rowRange(0, 1000), 5, 2);
+
+    static const Dictionary DICT_6X6_50_DATA = Dictionary(DICT_6X6_1000_BYTES.rowRange(0, 50), 6, 6);
+    static const Dictionary DICT_6X6_100_DATA = Dictionary(DICT_6X6_1000_BYTES.rowRange(0, 100), 6, 5);
+    static const Dictionary DICT_6X6_250_DATA = Dictionary(DICT_6X6_1000_BYTES.rowRange(0, 250), 6, 5);
+    static const Dictionary DICT_6X6_1000_DATA = Dictionary(DICT_6X6_1000_BYTES.rowRange(0, 1000), 6, 4);
+
+    static const Dictionary DICT_7X7_50_DATA = Dictionary(DICT_7X7_1000_BYTES.rowRange(0, 50), 7, 9);
+    static const Dictionary DICT_7X7_100_DATA = Dictionary(DICT_7X7_1000_BYTES.rowRange(0, 100), 7, 8);
+    static const Dictionary DICT_7X7_250_DATA = Dictionary(DICT_7X7_1000_BYTES.rowRange(0, 250), 7, 8);
+    static const Dictionary DICT_7X7_1000_DATA = Dictionary(DICT_7X7_1000_BYTES.rowRange(0, 1000), 7, 6);
 
 
     switch(name) {
@@ -44,7 +44,6 @@ the use of this software, even if advised of the possibility of such damage.
 #include <opencv2/imgproc.hpp>
 #include <opencv2/core/hal/hal.hpp>
 #include <vector>
-#include "predefined_dictionaries.hpp"
 
 namespace cv {
 namespace aruco {
@@ -36,20126 +36,5054 @@ or tort (including negligence or otherwise) arising in any way out of
 the use of this software, even if advised of the possibility of such damage.
 */
 
-namespace {
-
 
+namespace {
 
 /**
-  * Dictionaries are stored as a list of bytes in its four rotations
-  * On each rotation, the marker is divided in bytes assuming a row-major order
-  * This format allows a faster marker identification.
-  * For a dictionary composed by M markers of NxN bits, the structure dimensions should be:
-  * const char name[nMarkers][4rotations][nBytes], or more specifically:
-  * const char name[M][4][ceil(NxN/8)]
-  * The element [i][j][k] represents the k-th byte of the i-th marker in the dictionary
-  * in its j-th rotation.
+  * Dictionaries are stored as the codes of their markers in their four rotations, one marker per line.
+  * A marker of NxN bits is packed in a 64 bits integer in row-major order, starting from the most
+  * significant of its N*N bits: bit (row, col) of the marker is bit N*N - 1 - (row*N + col).
+  * For a dictionary composed by M markers, the structure dimensions are uint64 name[M][4].
+  * The element [i][j] is the code of the i-th marker in the dictionary in its j-th rotation.
   * Each rotation implies a 90 degree rotation of the marker in anticlockwise direction.
   */
+static constexpr uint64 DICT_ARUCO_CODES[][4] = {
+    { 0x1084210ULL, 0x000001fULL, 0x0108421ULL, 0x1f00000ULL },
+    { 0x1084217ULL, 0x010841fULL, 0x1d08421ULL, 0x1f04210ULL },
+    { 0x1084209ULL, 0x010003eULL, 0x1208421ULL, 0x0f80010ULL },
+    { 0x108420eULL, 0x000843eULL, 0x0e08421ULL, 0x0f84200ULL },
+    { 0x10842f0ULL, 0x021081fULL, 0x01e8421ULL, 0x1f02108ULL },
+    { 0x10842f7ULL, 0x0318c1fULL, 0x1de8421ULL, 0x1f06318ULL },
+    { 0x10842e9ULL, 0x031083eULL, 0x12e8421ULL, 0x0f82118ULL },
+    { 0x10842eeULL, 0x0218c3eULL, 0x0ee8421ULL, 0x0f86308ULL },
+    { 0x1084130ULL, 0x020005dULL, 0x0190421ULL, 0x1740008ULL },
+    { 0x1084137ULL, 0x030845dULL, 0x1d90421ULL, 0x1744218ULL },
+    { 0x1084129ULL, 0x030007cULL, 0x1290421ULL, 0x07c0018ULL },
+    { 0x108412eULL, 0x020847cULL, 0x0e90421ULL, 0x07c4208ULL },
+    { 0x10841d0ULL, 0x001085dULL, 0x0170421ULL, 0x1742100ULL },
+    { 0x10841d7ULL, 0x0118c5dULL, 0x1d70421ULL, 0x1746310ULL },
+    { 0x10841c9ULL, 0x011087cULL, 0x1270421ULL, 0x07c2110ULL },
+    { 0x10841ceULL, 0x0018c7cULL, 0x0e70421ULL, 0x07c6300ULL },
+    { 0x1085e10ULL, 0x042101fULL, 0x010f421ULL, 0x1f01084ULL },
+    { 0x1085e17ULL, 0x052941fULL, 0x1d0f421ULL, 0x1f05294ULL },
+    { 0x1085e09ULL, 0x052103eULL, 0x120f421ULL, 0x0f81094ULL },
+    { 0x1085e0eULL, 0x042943eULL, 0x0e0f421ULL, 0x0f85284ULL },
+    { 0x1085ef0ULL, 0x063181fULL, 0x01ef421ULL, 0x1f0318cULL },
+    { 0x1085ef7ULL, 0x0739c1fULL, 0x1def421ULL, 0x1f0739cULL },
+    { 0x1085ee9ULL, 0x073183eULL, 0x12ef421ULL, 0x0f8319cULL },
+    { 0x1085eeeULL, 0x0639c3eULL, 0x0eef421ULL, 0x0f8738cULL },
+    { 0x1085d30ULL, 0x062105dULL, 0x0197421ULL, 0x174108cULL },
+    { 0x1085d37ULL, 0x072945dULL, 0x1d97421ULL, 0x174529cULL },
+    { 0x1085d29ULL, 0x072107cULL, 0x1297421ULL, 0x07c109cULL },
+    { 0x1085d2eULL, 0x062947cULL, 0x0e97421ULL, 0x07c528cULL },
+    { 0x1085dd0ULL, 0x043185dULL, 0x0177421ULL, 0x1743184ULL },
+    { 0x1085dd7ULL, 0x0539c5dULL, 0x1d77421ULL, 0x1747394ULL },
+    { 0x1085dc9ULL, 0x053187cULL, 0x1277421ULL, 0x07c3194ULL },
+    { 0x1085dceULL, 0x0439c7cULL, 0x0e77421ULL, 0x07c7384ULL },
+    { 0x1082610ULL, 0x040009bULL, 0x010c821ULL, 0x1b20004ULL },
+    { 0x1082617ULL, 0x050849bULL, 0x1d0c821ULL, 0x1b24214ULL },
+    { 0x1082609ULL, 0x05000baULL, 0x120c821ULL, 0x0ba0014ULL },
+    { 0x108260eULL, 0x04084baULL, 0x0e0c821ULL, 0x0ba4204ULL },
+    { 0x10826f0ULL, 0x061089bULL, 0x01ec821ULL, 0x1b2210cULL },
+    { 0x10826f7ULL, 0x0718c9bULL, 0x1dec821ULL, 0x1b2631cULL },
+    { 0x10826e9ULL, 0x07108baULL, 0x12ec821ULL, 0x0ba211cULL },
+    { 0x10826eeULL, 0x0618cbaULL, 0x0eec821ULL, 0x0ba630cULL },
+    { 0x1082530ULL, 0x06000d9ULL, 0x0194821ULL, 0x136000cULL },
+    { 0x1082537ULL, 0x07084d9ULL, 0x1d94821ULL, 0x136421cULL },
+    { 0x1082529ULL, 0x07000f8ULL, 0x1294821ULL, 0x03e001cULL },
+    { 0x108252eULL, 0x06084f8ULL, 0x0e94821ULL, 0x03e420cULL },
+    { 0x10825d0ULL, 0x04108d9ULL, 0x0174821ULL, 0x1362104ULL },
+    { 0x10825d7ULL, 0x0518cd9ULL, 0x1d74821ULL, 0x1366314ULL },
+    { 0x10825c9ULL, 0x05108f8ULL, 0x1274821ULL, 0x03e2114ULL },
+    { 0x10825ceULL, 0x0418cf8ULL, 0x0e74821ULL, 0x03e6304ULL },
+    { 0x1083a10ULL, 0x002109bULL, 0x010b821ULL, 0x1b21080ULL },
+    { 0x1083a17ULL, 0x012949bULL, 0x1d0b821ULL, 0x1b25290ULL },
+    { 0x1083a09ULL, 0x01210baULL, 0x120b821ULL, 0x0ba1090ULL },
+    { 0x1083a0eULL, 0x00294baULL, 0x0e0b821ULL, 0x0ba5280ULL },
+    { 0x1083af0ULL, 0x023189bULL, 0x01eb821ULL, 0x1b23188ULL },
+    { 0x1083af7ULL, 0x0339c9bULL, 0x1deb821ULL, 0x1b27398ULL },
+    { 0x1083ae9ULL, 0x03318baULL, 0x12eb821ULL, 0x0ba3198ULL },
+    { 0x1083aeeULL, 0x0239cbaULL, 0x0eeb821ULL, 0x0ba7388ULL },
+    { 0x1083930ULL, 0x02210d9ULL, 0x0193821ULL, 0x1361088ULL },
+    { 0x1083937ULL, 0x03294d9ULL, 0x1d93821ULL, 0x1365298ULL },
+    { 0x1083929ULL, 0x03210f8ULL, 0x1293821ULL, 0x03e1098ULL },
+    { 0x108392eULL, 0x02294f8ULL, 0x0e93821ULL, 0x03e5288ULL },
+    { 0x10839d0ULL, 0x00318d9ULL, 0x0173821ULL, 0x1363180ULL },
+    { 0x10839d7ULL, 0x0139cd9ULL, 0x1d73821ULL, 0x1367390ULL },
+    { 0x10839c9ULL, 0x01318f8ULL, 0x1273821ULL, 0x03e3190ULL },
+    { 0x10839ceULL, 0x0039cf8ULL, 0x0e73821ULL, 0x03e7380ULL },
+    { 0x10bc210ULL, 0x084201fULL, 0x01087a1ULL, 0x1f00842ULL },
+    { 0x10bc217ULL, 0x094a41fULL, 0x1d087a1ULL, 0x1f04a52ULL },
+    { 0x10bc209ULL, 0x094203eULL, 0x12087a1ULL, 0x0f80852ULL },
+    { 0x10bc20eULL, 0x084a43eULL, 0x0e087a1ULL, 0x0f84a42ULL },
+    { 0x10bc2f0ULL, 0x0a5281fULL, 0x01e87a1ULL, 0x1f0294aULL },
+    { 0x10bc2f7ULL, 0x0b5ac1fULL, 0x1de87a1ULL, 0x1f06b5aULL },
+    { 0x10bc2e9ULL, 0x0b5283eULL, 0x12e87a1ULL, 0x0f8295aULL },
+    { 0x10bc2eeULL, 0x0a5ac3eULL, 0x0ee87a1ULL, 0x0f86b4aULL },
+    { 0x10bc130ULL, 0x0a4205dULL, 0x01907a1ULL, 0x174084aULL },
+    { 0x10bc137ULL, 0x0b4a45dULL, 0x1d907a1ULL, 0x1744a5aULL },
+    { 0x10bc129ULL, 0x0b4207cULL, 0x12907a1ULL, 0x07c085aULL },
+    { 0x10bc12eULL, 0x0a4a47cULL, 0x0e907a1ULL, 0x07c4a4aULL },
+    { 0x10bc1d0ULL, 0x085285dULL, 0x01707a1ULL, 0x1742942ULL },
+    { 0x10bc1d7ULL, 0x095ac5dULL, 0x1d707a1ULL, 0x1746b52ULL },
+    { 0x10bc1c9ULL, 0x095287cULL, 0x12707a1ULL, 0x07c2952ULL },
+    { 0x10bc1ceULL, 0x085ac7cULL, 0x0e707a1ULL, 0x07c6b42ULL },
+    { 0x10bde10ULL, 0x0c6301fULL, 0x010f7a1ULL, 0x1f018c6ULL },
+    { 0x10bde17ULL, 0x0d6b41fULL, 0x1d0f7a1ULL, 0x1f05ad6ULL },
+    { 0x10bde09ULL, 0x0d6303eULL, 0x120f7a1ULL, 0x0f818d6ULL },
+    { 0x10bde0eULL, 0x0c6b43eULL, 0x0e0f7a1ULL, 0x0f85ac6ULL },
+    { 0x10bdef0ULL, 0x0e7381fULL, 0x01ef7a1ULL, 0x1f039ceULL },
+    { 0x10bdef7ULL, 0x0f7bc1fULL, 0x1def7a1ULL, 0x1f07bdeULL },
+    { 0x10bdee9ULL, 0x0f7383eULL, 0x12ef7a1ULL, 0x0f839deULL },
+    { 0x10bdeeeULL, 0x0e7bc3eULL, 0x0eef7a1ULL, 0x0f87bceULL },
+    { 0x10bdd30ULL, 0x0e6305dULL, 0x01977a1ULL, 0x17418ceULL },
+    { 0x10bdd37ULL, 0x0f6b45dULL, 0x1d977a1ULL, 0x1745adeULL },
+    { 0x10bdd29ULL, 0x0f6307cULL, 0x12977a1ULL, 0x07c18deULL },
+    { 0x10bdd2eULL, 0x0e6b47cULL, 0x0e977a1ULL, 0x07c5aceULL },
+    { 0x10bddd0ULL, 0x0c7385dULL, 0x01777a1ULL, 0x17439c6ULL },
+    { 0x10bddd7ULL, 0x0d7bc5dULL, 0x1d777a1ULL, 0x1747bd6ULL },
+    { 0x10bddc9ULL, 0x0d7387cULL, 0x12777a1ULL, 0x07c39d6ULL },
+    { 0x10bddceULL, 0x0c7bc7cULL, 0x0e777a1ULL, 0x07c7bc6ULL },
+    { 0x10ba610ULL, 0x0c4209bULL, 0x010cba1ULL, 0x1b20846ULL },
+    { 0x10ba617ULL, 0x0d4a49bULL, 0x1d0cba1ULL, 0x1b24a56ULL },
+    { 0x10ba609ULL, 0x0d420baULL, 0x120cba1ULL, 0x0ba0856ULL },
+    { 0x10ba60eULL, 0x0c4a4baULL, 0x0e0cba1ULL, 0x0ba4a46ULL },
+    { 0x10ba6f0ULL, 0x0e5289bULL, 0x01ecba1ULL, 0x1b2294eULL },
+    { 0x10ba6f7ULL, 0x0f5ac9bULL, 0x1decba1ULL, 0x1b26b5eULL },
+    { 0x10ba6e9ULL, 0x0f528baULL, 0x12ecba1ULL, 0x0ba295eULL },
+    { 0x10ba6eeULL, 0x0e5acbaULL, 0x0eecba1ULL, 0x0ba6b4eULL },
+    { 0x10ba530ULL, 0x0e420d9ULL, 0x0194ba1ULL, 0x136084eULL },
+    { 0x10ba537ULL, 0x0f4a4d9ULL, 0x1d94ba1ULL, 0x1364a5eULL },
+    { 0x10ba529ULL, 0x0f420f8ULL, 0x1294ba1ULL, 0x03e085eULL },
+    { 0x10ba52eULL, 0x0e4a4f8ULL, 0x0e94ba1ULL, 0x03e4a4eULL },
+    { 0x10ba5d0ULL, 0x0c528d9ULL, 0x0174ba1ULL, 0x1362946ULL },
+    { 0x10ba5d7ULL, 0x0d5acd9ULL, 0x1d74ba1ULL, 0x1366b56ULL },
+    { 0x10ba5c9ULL, 0x0d528f8ULL, 0x1274ba1ULL, 0x03e2956ULL },
+    { 0x10ba5ceULL, 0x0c5acf8ULL, 0x0e74ba1ULL, 0x03e6b46ULL },
+    { 0x10bba10ULL, 0x086309bULL, 0x010bba1ULL, 0x1b218c2ULL },
+    { 0x10bba17ULL, 0x096b49bULL, 0x1d0bba1ULL, 0x1b25ad2ULL },
+    { 0x10bba09ULL, 0x09630baULL, 0x120bba1ULL, 0x0ba18d2ULL },
+    { 0x10bba0eULL, 0x086b4baULL, 0x0e0bba1ULL, 0x0ba5ac2ULL },
+    { 0x10bbaf0ULL, 0x0a7389bULL, 0x01ebba1ULL, 0x1b239caULL },
+    { 0x10bbaf7ULL, 0x0b7bc9bULL, 0x1debba1ULL, 0x1b27bdaULL },
+    { 0x10bbae9ULL, 0x0b738baULL, 0x12ebba1ULL, 0x0ba39daULL },
+    { 0x10bbaeeULL, 0x0a7bcbaULL, 0x0eebba1ULL, 0x0ba7bcaULL },
+    { 0x10bb930ULL, 0x0a630d9ULL, 0x0193ba1ULL, 0x13618caULL },
+    { 0x10bb937ULL, 0x0b6b4d9ULL, 0x1d93ba1ULL, 0x1365adaULL },
+    { 0x10bb929ULL, 0x0b630f8ULL, 0x1293ba1ULL, 0x03e18daULL },
+    { 0x10bb92eULL, 0x0a6b4f8ULL, 0x0e93ba1ULL, 0x03e5acaULL },
+    { 0x10bb9d0ULL, 0x08738d9ULL, 0x0173ba1ULL, 0x13639c2ULL },
+    { 0x10bb9d7ULL, 0x097bcd9ULL, 0x1d73ba1ULL, 0x1367bd2ULL },
+    { 0x10bb9c9ULL, 0x09738f8ULL, 0x1273ba1ULL, 0x03e39d2ULL },
+    { 0x10bb9ceULL, 0x087bcf8ULL, 0x0e73ba1ULL, 0x03e7bc2ULL },
+    { 0x104c210ULL, 0x0800117ULL, 0x0108641ULL, 0x1d10002ULL },
+    { 0x104c217ULL, 0x0908517ULL, 0x1d08641ULL, 0x1d14212ULL },
+    { 0x104c209ULL, 0x0900136ULL, 0x1208641ULL, 0x0d90012ULL },
+    { 0x104c20eULL, 0x0808536ULL, 0x0e08641ULL, 0x0d94202ULL },
+    { 0x104c2f0ULL, 0x0a10917ULL, 0x01e8641ULL, 0x1d1210aULL },
+    { 0x104c2f7ULL, 0x0b18d17ULL, 0x1de8641ULL, 0x1d1631aULL },
+    { 0x104c2e9ULL, 0x0b10936ULL, 0x12e8641ULL, 0x0d9211aULL },
+    { 0x104c2eeULL, 0x0a18d36ULL, 0x0ee8641ULL, 0x0d9630aULL },
+    { 0x104c130ULL, 0x0a00155ULL, 0x0190641ULL, 0x155000aULL },
+    { 0x104c137ULL, 0x0b08555ULL, 0x1d90641ULL, 0x155421aULL },
+    { 0x104c129ULL, 0x0b00174ULL, 0x1290641ULL, 0x05d001aULL },
+    { 0x104c12eULL, 0x0a08574ULL, 0x0e90641ULL, 0x05d420aULL },
+    { 0x104c1d0ULL, 0x0810955ULL, 0x0170641ULL, 0x1552102ULL },
+    { 0x104c1d7ULL, 0x0918d55ULL, 0x1d70641ULL, 0x1556312ULL },
+    { 0x104c1c9ULL, 0x0910974ULL, 0x1270641ULL, 0x05d2112ULL },
+    { 0x104c1ceULL, 0x0818d74ULL, 0x0e70641ULL, 0x05d6302ULL },
+    { 0x104de10ULL, 0x0c21117ULL, 0x010f641ULL, 0x1d11086ULL },
+    { 0x104de17ULL, 0x0d29517ULL, 0x1d0f641ULL, 0x1d15296ULL },
+    { 0x104de09ULL, 0x0d21136ULL, 0x120f641ULL, 0x0d91096ULL },
+    { 0x104de0eULL, 0x0c29536ULL, 0x0e0f641ULL, 0x0d95286ULL },
+    { 0x104def0ULL, 0x0e31917ULL, 0x01ef641ULL, 0x1d1318eULL },
+    { 0x104def7ULL, 0x0f39d17ULL, 0x1def641ULL, 0x1d1739eULL },
+    { 0x104dee9ULL, 0x0f31936ULL, 0x12ef641ULL, 0x0d9319eULL },
+    { 0x104deeeULL, 0x0e39d36ULL, 0x0eef641ULL, 0x0d9738eULL },
+    { 0x104dd30ULL, 0x0e21155ULL, 0x0197641ULL, 0x155108eULL },
+    { 0x104dd37ULL, 0x0f29555ULL, 0x1d97641ULL, 0x155529eULL },
+    { 0x104dd29ULL, 0x0f21174ULL, 0x1297641ULL, 0x05d109eULL },
+    { 0x104dd2eULL, 0x0e29574ULL, 0x0e97641ULL, 0x05d528eULL },
+    { 0x104ddd0ULL, 0x0c31955ULL, 0x0177641ULL, 0x1553186ULL },
+    { 0x104ddd7ULL, 0x0d39d55ULL, 0x1d77641ULL, 0x1557396ULL },
+    { 0x104ddc9ULL, 0x0d31974ULL, 0x1277641ULL, 0x05d3196ULL },
+    { 0x104ddceULL, 0x0c39d74ULL, 0x0e77641ULL, 0x05d7386ULL },
+    { 0x104a610ULL, 0x0c00193ULL, 0x010ca41ULL, 0x1930006ULL },
+    { 0x104a617ULL, 0x0d08593ULL, 0x1d0ca41ULL, 0x1934216ULL },
+    { 0x104a609ULL, 0x0d001b2ULL, 0x120ca41ULL, 0x09b0016ULL },
+    { 0x104a60eULL, 0x0c085b2ULL, 0x0e0ca41ULL, 0x09b4206ULL },
+    { 0x104a6f0ULL, 0x0e10993ULL, 0x01eca41ULL, 0x193210eULL },
+    { 0x104a6f7ULL, 0x0f18d93ULL, 0x1deca41ULL, 0x193631eULL },
+    { 0x104a6e9ULL, 0x0f109b2ULL, 0x12eca41ULL, 0x09b211eULL },
+    { 0x104a6eeULL, 0x0e18db2ULL, 0x0eeca41ULL, 0x09b630eULL },
+    { 0x104a530ULL, 0x0e001d1ULL, 0x0194a41ULL, 0x117000eULL },
+    { 0x104a537ULL, 0x0f085d1ULL, 0x1d94a41ULL, 0x117421eULL },
+    { 0x104a529ULL, 0x0f001f0ULL, 0x1294a41ULL, 0x01f001eULL },
+    { 0x104a52eULL, 0x0e085f0ULL, 0x0e94a41ULL, 0x01f420eULL },
+    { 0x104a5d0ULL, 0x0c109d1ULL, 0x0174a41ULL, 0x1172106ULL },
+    { 0x104a5d7ULL, 0x0d18dd1ULL, 0x1d74a41ULL, 0x1176316ULL },
+    { 0x104a5c9ULL, 0x0d109f0ULL, 0x1274a41ULL, 0x01f2116ULL },
+    { 0x104a5ceULL, 0x0c18df0ULL, 0x0e74a41ULL, 0x01f6306ULL },
+    { 0x104ba10ULL, 0x0821193ULL, 0x010ba41ULL, 0x1931082ULL },
+    { 0x104ba17ULL, 0x0929593ULL, 0x1d0ba41ULL, 0x1935292ULL },
+    { 0x104ba09ULL, 0x09211b2ULL, 0x120ba41ULL, 0x09b1092ULL },
+    { 0x104ba0eULL, 0x08295b2ULL, 0x0e0ba41ULL, 0x09b5282ULL },
+    { 0x104baf0ULL, 0x0a31993ULL, 0x01eba41ULL, 0x193318aULL },
+    { 0x104baf7ULL, 0x0b39d93ULL, 0x1deba41ULL, 0x193739aULL },
+    { 0x104bae9ULL, 0x0b319b2ULL, 0x12eba41ULL, 0x09b319aULL },
+    { 0x104baeeULL, 0x0a39db2ULL, 0x0eeba41ULL, 0x09b738aULL },
+    { 0x104b930ULL, 0x0a211d1ULL, 0x0193a41ULL, 0x117108aULL },
+    { 0x104b937ULL, 0x0b295d1ULL, 0x1d93a41ULL, 0x117529aULL },
+    { 0x104b929ULL, 0x0b211f0ULL, 0x1293a41ULL, 0x01f109aULL },
+    { 0x104b92eULL, 0x0a295f0ULL, 0x0e93a41ULL, 0x01f528aULL },
+    { 0x104b9d0ULL, 0x08319d1ULL, 0x0173a41ULL, 0x1173182ULL },
+    { 0x104b9d7ULL, 0x0939dd1ULL, 0x1d73a41ULL, 0x1177392ULL },
+    { 0x104b9c9ULL, 0x09319f0ULL, 0x1273a41ULL, 0x01f3192ULL },
+    { 0x104b9ceULL, 0x0839df0ULL, 0x0e73a41ULL, 0x01f7382ULL },
+    { 0x1074210ULL, 0x0042117ULL, 0x01085c1ULL, 0x1d10840ULL },
+    { 0x1074217ULL, 0x014a517ULL, 0x1d085c1ULL, 0x1d14a50ULL },
+    { 0x1074209ULL, 0x0142136ULL, 0x12085c1ULL, 0x0d90850ULL },
+    { 0x107420eULL, 0x004a536ULL, 0x0e085c1ULL, 0x0d94a40ULL },
+    { 0x10742f0ULL, 0x0252917ULL, 0x01e85c1ULL, 0x1d12948ULL },
+    { 0x10742f7ULL, 0x035ad17ULL, 0x1de85c1ULL, 0x1d16b58ULL },
+    { 0x10742e9ULL, 0x0352936ULL, 0x12e85c1ULL, 0x0d92958ULL },
+    { 0x10742eeULL, 0x025ad36ULL, 0x0ee85c1ULL, 0x0d96b48ULL },
+    { 0x1074130ULL, 0x0242155ULL, 0x01905c1ULL, 0x1550848ULL },
+    { 0x1074137ULL, 0x034a555ULL, 0x1d905c1ULL, 0x1554a58ULL },
+    { 0x1074129ULL, 0x0342174ULL, 0x12905c1ULL, 0x05d0858ULL },
+    { 0x107412eULL, 0x024a574ULL, 0x0e905c1ULL, 0x05d4a48ULL },
+    { 0x10741d0ULL, 0x0052955ULL, 0x01705c1ULL, 0x1552940ULL },
+    { 0x10741d7ULL, 0x015ad55ULL, 0x1d705c1ULL, 0x1556b50ULL },
+    { 0x10741c9ULL, 0x0152974ULL, 0x12705c1ULL, 0x05d2950ULL },
+    { 0x10741ceULL, 0x005ad74ULL, 0x0e705c1ULL, 0x05d6b40ULL },
+    { 0x1075e10ULL, 0x0463117ULL, 0x010f5c1ULL, 0x1d118c4ULL },
+    { 0x1075e17ULL, 0x056b517ULL, 0x1d0f5c1ULL, 0x1d15ad4ULL },
+    { 0x1075e09ULL, 0x0563136ULL, 0x120f5c1ULL, 0x0d918d4ULL },
+    { 0x1075e0eULL, 0x046b536ULL, 0x0e0f5c1ULL, 0x0d95ac4ULL },
+    { 0x1075ef0ULL, 0x0673917ULL, 0x01ef5c1ULL, 0x1d139ccULL },
+    { 0x1075ef7ULL, 0x077bd17ULL, 0x1def5c1ULL, 0x1d17bdcULL },
+    { 0x1075ee9ULL, 0x0773936ULL, 0x12ef5c1ULL, 0x0d939dcULL },
+    { 0x1075eeeULL, 0x067bd36ULL, 0x0eef5c1ULL, 0x0d97bccULL },
+    { 0x1075d30ULL, 0x0663155ULL, 0x01975c1ULL, 0x15518ccULL },
+    { 0x1075d37ULL, 0x076b555ULL, 0x1d975c1ULL, 0x1555adcULL },
+    { 0x1075d29ULL, 0x0763174ULL, 0x12975c1ULL, 0x05d18dcULL },
+    { 0x1075d2eULL, 0x066b574ULL, 0x0e975c1ULL, 0x05d5accULL },
+    { 0x1075dd0ULL, 0x0473955ULL, 0x01775c1ULL, 0x15539c4ULL },
+    { 0x1075dd7ULL, 0x057bd55ULL, 0x1d775c1ULL, 0x1557bd4ULL },
+    { 0x1075dc9ULL, 0x0573974ULL, 0x12775c1ULL, 0x05d39d4ULL },
+    { 0x1075dceULL, 0x047bd74ULL, 0x0e775c1ULL, 0x05d7bc4ULL },
+    { 0x1072610ULL, 0x0442193ULL, 0x010c9c1ULL, 0x1930844ULL },
+    { 0x1072617ULL, 0x054a593ULL, 0x1d0c9c1ULL, 0x1934a54ULL },
+    { 0x1072609ULL, 0x05421b2ULL, 0x120c9c1ULL, 0x09b0854ULL },
+    { 0x107260eULL, 0x044a5b2ULL, 0x0e0c9c1ULL, 0x09b4a44ULL },
+    { 0x10726f0ULL, 0x0652993ULL, 0x01ec9c1ULL, 0x193294cULL },
+    { 0x10726f7ULL, 0x075ad93ULL, 0x1dec9c1ULL, 0x1936b5cULL },
+    { 0x10726e9ULL, 0x07529b2ULL, 0x12ec9c1ULL, 0x09b295cULL },
+    { 0x10726eeULL, 0x065adb2ULL, 0x0eec9c1ULL, 0x09b6b4cULL },
+    { 0x1072530ULL, 0x06421d1ULL, 0x01949c1ULL, 0x117084cULL },
+    { 0x1072537ULL, 0x074a5d1ULL, 0x1d949c1ULL, 0x1174a5cULL },
+    { 0x1072529ULL, 0x07421f0ULL, 0x12949c1ULL, 0x01f085cULL },
+    { 0x107252eULL, 0x064a5f0ULL, 0x0e949c1ULL, 0x01f4a4cULL },
+    { 0x10725d0ULL, 0x04529d1ULL, 0x01749c1ULL, 0x1172944ULL },
+    { 0x10725d7ULL, 0x055add1ULL, 0x1d749c1ULL, 0x1176b54ULL },
+    { 0x10725c9ULL, 0x05529f0ULL, 0x12749c1ULL, 0x01f2954ULL },
+    { 0x10725ceULL, 0x045adf0ULL, 0x0e749c1ULL, 0x01f6b44ULL },
+    { 0x1073a10ULL, 0x0063193ULL, 0x010b9c1ULL, 0x19318c0ULL },
+    { 0x1073a17ULL, 0x016b593ULL, 0x1d0b9c1ULL, 0x1935ad0ULL },
+    { 0x1073a09ULL, 0x01631b2ULL, 0x120b9c1ULL, 0x09b18d0ULL },
+    { 0x1073a0eULL, 0x006b5b2ULL, 0x0e0b9c1ULL, 0x09b5ac0ULL },
+    { 0x1073af0ULL, 0x0273993ULL, 0x01eb9c1ULL, 0x19339c8ULL },
+    { 0x1073af7ULL, 0x037bd93ULL, 0x1deb9c1ULL, 0x1937bd8ULL },
+    { 0x1073ae9ULL, 0x03739b2ULL, 0x12eb9c1ULL, 0x09b39d8ULL },
+    { 0x1073aeeULL, 0x027bdb2ULL, 0x0eeb9c1ULL, 0x09b7bc8ULL },
+    { 0x1073930ULL, 0x02631d1ULL, 0x01939c1ULL, 0x11718c8ULL },
+    { 0x1073937ULL, 0x036b5d1ULL, 0x1d939c1ULL, 0x1175ad8ULL },
+    { 0x1073929ULL, 0x03631f0ULL, 0x12939c1ULL, 0x01f18d8ULL },
+    { 0x107392eULL, 0x026b5f0ULL, 0x0e939c1ULL, 0x01f5ac8ULL },
+    { 0x10739d0ULL, 0x00739d1ULL, 0x01739c1ULL, 0x11739c0ULL },
+    { 0x10739d7ULL, 0x017bdd1ULL, 0x1d739c1ULL, 0x1177bd0ULL },
+    { 0x10739c9ULL, 0x01739f0ULL, 0x12739c1ULL, 0x01f39d0ULL },
+    { 0x10739ceULL, 0x007bdf0ULL, 0x0e739c1ULL, 0x01f7bc0ULL },
+    { 0x1784210ULL, 0x108401fULL, 0x010843dULL, 0x1f00421ULL },
+    { 0x1784217ULL, 0x118c41fULL, 0x1d0843dULL, 0x1f04631ULL },
+    { 0x1784209ULL, 0x118403eULL, 0x120843dULL, 0x0f80431ULL },
+    { 0x178420eULL, 0x108c43eULL, 0x0e0843dULL, 0x0f84621ULL },
+    { 0x17842f0ULL, 0x129481fULL, 0x01e843dULL, 0x1f02529ULL },
+    { 0x17842f7ULL, 0x139cc1fULL, 0x1de843dULL, 0x1f06739ULL },
+    { 0x17842e9ULL, 0x139483eULL, 0x12e843dULL, 0x0f82539ULL },
+    { 0x17842eeULL, 0x129cc3eULL, 0x0ee843dULL, 0x0f86729ULL },
+    { 0x1784130ULL, 0x128405dULL, 0x019043dULL, 0x1740429ULL },
+    { 0x1784137ULL, 0x138c45dULL, 0x1d9043dULL, 0x1744639ULL },
+    { 0x1784129ULL, 0x138407cULL, 0x129043dULL, 0x07c0439ULL },
+    { 0x178412eULL, 0x128c47cULL, 0x0e9043dULL, 0x07c4629ULL },
+    { 0x17841d0ULL, 0x109485dULL, 0x017043dULL, 0x1742521ULL },
+    { 0x17841d7ULL, 0x119cc5dULL, 0x1d7043dULL, 0x1746731ULL },
+    { 0x17841c9ULL, 0x119487cULL, 0x127043dULL, 0x07c2531ULL },
+    { 0x17841ceULL, 0x109cc7cULL, 0x0e7043dULL, 0x07c6721ULL },
+    { 0x1785e10ULL, 0x14a501fULL, 0x010f43dULL, 0x1f014a5ULL },
+    { 0x1785e17ULL, 0x15ad41fULL, 0x1d0f43dULL, 0x1f056b5ULL },
+    { 0x1785e09ULL, 0x15a503eULL, 0x120f43dULL, 0x0f814b5ULL },
+    { 0x1785e0eULL, 0x14ad43eULL, 0x0e0f43dULL, 0x0f856a5ULL },
+    { 0x1785ef0ULL, 0x16b581fULL, 0x01ef43dULL, 0x1f035adULL },
+    { 0x1785ef7ULL, 0x17bdc1fULL, 0x1def43dULL, 0x1f077bdULL },
+    { 0x1785ee9ULL, 0x17b583eULL, 0x12ef43dULL, 0x0f835bdULL },
+    { 0x1785eeeULL, 0x16bdc3eULL, 0x0eef43dULL, 0x0f877adULL },
+    { 0x1785d30ULL, 0x16a505dULL, 0x019743dULL, 0x17414adULL },
+    { 0x1785d37ULL, 0x17ad45dULL, 0x1d9743dULL, 0x17456bdULL },
+    { 0x1785d29ULL, 0x17a507cULL, 0x129743dULL, 0x07c14bdULL },
+    { 0x1785d2eULL, 0x16ad47cULL, 0x0e9743dULL, 0x07c56adULL },
+    { 0x1785dd0ULL, 0x14b585dULL, 0x017743dULL, 0x17435a5ULL },
+    { 0x1785dd7ULL, 0x15bdc5dULL, 0x1d7743dULL, 0x17477b5ULL },
+    { 0x1785dc9ULL, 0x15b587cULL, 0x127743dULL, 0x07c35b5ULL },
+    { 0x1785dceULL, 0x14bdc7cULL, 0x0e7743dULL, 0x07c77a5ULL },
+    { 0x1782610ULL, 0x148409bULL, 0x010c83dULL, 0x1b20425ULL },
+    { 0x1782617ULL, 0x158c49bULL, 0x1d0c83dULL, 0x1b24635ULL },
+    { 0x1782609ULL, 0x15840baULL, 0x120c83dULL, 0x0ba0435ULL },
+    { 0x178260eULL, 0x148c4baULL, 0x0e0c83dULL, 0x0ba4625ULL },
+    { 0x17826f0ULL, 0x169489bULL, 0x01ec83dULL, 0x1b2252dULL },
+    { 0x17826f7ULL, 0x179cc9bULL, 0x1dec83dULL, 0x1b2673dULL },
+    { 0x17826e9ULL, 0x17948baULL, 0x12ec83dULL, 0x0ba253dULL },
+    { 0x17826eeULL, 0x169ccbaULL, 0x0eec83dULL, 0x0ba672dULL },
+    { 0x1782530ULL, 0x16840d9ULL, 0x019483dULL, 0x136042dULL },
+    { 0x1782537ULL, 0x178c4d9ULL, 0x1d9483dULL, 0x136463dULL },
+    { 0x1782529ULL, 0x17840f8ULL, 0x129483dULL, 0x03e043dULL },
+    { 0x178252eULL, 0x168c4f8ULL, 0x0e9483dULL, 0x03e462dULL },
+    { 0x17825d0ULL, 0x14948d9ULL, 0x017483dULL, 0x1362525ULL },
+    { 0x17825d7ULL, 0x159ccd9ULL, 0x1d7483dULL, 0x1366735ULL },
+    { 0x17825c9ULL, 0x15948f8ULL, 0x127483dULL, 0x03e2535ULL },
+    { 0x17825ceULL, 0x149ccf8ULL, 0x0e7483dULL, 0x03e6725ULL },
+    { 0x1783a10ULL, 0x10a509bULL, 0x010b83dULL, 0x1b214a1ULL },
+    { 0x1783a17ULL, 0x11ad49bULL, 0x1d0b83dULL, 0x1b256b1ULL },
+    { 0x1783a09ULL, 0x11a50baULL, 0x120b83dULL, 0x0ba14b1ULL },
+    { 0x1783a0eULL, 0x10ad4baULL, 0x0e0b83dULL, 0x0ba56a1ULL },
+    { 0x1783af0ULL, 0x12b589bULL, 0x01eb83dULL, 0x1b235a9ULL },
+    { 0x1783af7ULL, 0x13bdc9bULL, 0x1deb83dULL, 0x1b277b9ULL },
+    { 0x1783ae9ULL, 0x13b58baULL, 0x12eb83dULL, 0x0ba35b9ULL },
+    { 0x1783aeeULL, 0x12bdcbaULL, 0x0eeb83dULL, 0x0ba77a9ULL },
+    { 0x1783930ULL, 0x12a50d9ULL, 0x019383dULL, 0x13614a9ULL },
+    { 0x1783937ULL, 0x13ad4d9ULL, 0x1d9383dULL, 0x13656b9ULL },
+    { 0x1783929ULL, 0x13a50f8ULL, 0x129383dULL, 0x03e14b9ULL },
+    { 0x178392eULL, 0x12ad4f8ULL, 0x0e9383dULL, 0x03e56a9ULL },
+    { 0x17839d0ULL, 0x10b58d9ULL, 0x017383dULL, 0x13635a1ULL },
+    { 0x17839d7ULL, 0x11bdcd9ULL, 0x1d7383dULL, 0x13677b1ULL },
+    { 0x17839c9ULL, 0x11b58f8ULL, 0x127383dULL, 0x03e35b1ULL },
+    { 0x17839ceULL, 0x10bdcf8ULL, 0x0e7383dULL, 0x03e77a1ULL },
+    { 0x17bc210ULL, 0x18c601fULL, 0x01087bdULL, 0x1f00c63ULL },
+    { 0x17bc217ULL, 0x19ce41fULL, 0x1d087bdULL, 0x1f04e73ULL },
+    { 0x17bc209ULL, 0x19c603eULL, 0x12087bdULL, 0x0f80c73ULL },
+    { 0x17bc20eULL, 0x18ce43eULL, 0x0e087bdULL, 0x0f84e63ULL },
+    { 0x17bc2f0ULL, 0x1ad681fULL, 0x01e87bdULL, 0x1f02d6bULL },
+    { 0x17bc2f7ULL, 0x1bdec1fULL, 0x1de87bdULL, 0x1f06f7bULL },
+    { 0x17bc2e9ULL, 0x1bd683eULL, 0x12e87bdULL, 0x0f82d7bULL },
+    { 0x17bc2eeULL, 0x1adec3eULL, 0x0ee87bdULL, 0x0f86f6bULL },
+    { 0x17bc130ULL, 0x1ac605dULL, 0x01907bdULL, 0x1740c6bULL },
+    { 0x17bc137ULL, 0x1bce45dULL, 0x1d907bdULL, 0x1744e7bULL },
+    { 0x17bc129ULL, 0x1bc607cULL, 0x12907bdULL, 0x07c0c7bULL },
+    { 0x17bc12eULL, 0x1ace47cULL, 0x0e907bdULL, 0x07c4e6bULL },
+    { 0x17bc1d0ULL, 0x18d685dULL, 0x01707bdULL, 0x1742d63ULL },
+    { 0x17bc1d7ULL, 0x19dec5dULL, 0x1d707bdULL, 0x1746f73ULL },
+    { 0x17bc1c9ULL, 0x19d687cULL, 0x12707bdULL, 0x07c2d73ULL },
+    { 0x17bc1ceULL, 0x18dec7cULL, 0x0e707bdULL, 0x07c6f63ULL },
+    { 0x17bde10ULL, 0x1ce701fULL, 0x010f7bdULL, 0x1f01ce7ULL },
+    { 0x17bde17ULL, 0x1def41fULL, 0x1d0f7bdULL, 0x1f05ef7ULL },
+    { 0x17bde09ULL, 0x1de703eULL, 0x120f7bdULL, 0x0f81cf7ULL },
+    { 0x17bde0eULL, 0x1cef43eULL, 0x0e0f7bdULL, 0x0f85ee7ULL },
+    { 0x17bdef0ULL, 0x1ef781fULL, 0x01ef7bdULL, 0x1f03defULL },
+    { 0x17bdef7ULL, 0x1fffc1fULL, 0x1def7bdULL, 0x1f07fffULL },
+    { 0x17bdee9ULL, 0x1ff783eULL, 0x12ef7bdULL, 0x0f83dffULL },
+    { 0x17bdeeeULL, 0x1effc3eULL, 0x0eef7bdULL, 0x0f87fefULL },
+    { 0x17bdd30ULL, 0x1ee705dULL, 0x01977bdULL, 0x1741cefULL },
+    { 0x17bdd37ULL, 0x1fef45dULL, 0x1d977bdULL, 0x1745effULL },
+    { 0x17bdd29ULL, 0x1fe707cULL, 0x12977bdULL, 0x07c1cffULL },
+    { 0x17bdd2eULL, 0x1eef47cULL, 0x0e977bdULL, 0x07c5eefULL },
+    { 0x17bddd0ULL, 0x1cf785dULL, 0x01777bdULL, 0x1743de7ULL },
+    { 0x17bddd7ULL, 0x1dffc5dULL, 0x1d777bdULL, 0x1747ff7ULL },
+    { 0x17bddc9ULL, 0x1df787cULL, 0x12777bdULL, 0x07c3df7ULL },
+    { 0x17bddceULL, 0x1cffc7cULL, 0x0e777bdULL, 0x07c7fe7ULL },
+    { 0x17ba610ULL, 0x1cc609bULL, 0x010cbbdULL, 0x1b20c67ULL },
+    { 0x17ba617ULL, 0x1dce49bULL, 0x1d0cbbdULL, 0x1b24e77ULL },
+    { 0x17ba609ULL, 0x1dc60baULL, 0x120cbbdULL, 0x0ba0c77ULL },
+    { 0x17ba60eULL, 0x1cce4baULL, 0x0e0cbbdULL, 0x0ba4e67ULL },
+    { 0x17ba6f0ULL, 0x1ed689bULL, 0x01ecbbdULL, 0x1b22d6fULL },
+    { 0x17ba6f7ULL, 0x1fdec9bULL, 0x1decbbdULL, 0x1b26f7fULL },
+    { 0x17ba6e9ULL, 0x1fd68baULL, 0x12ecbbdULL, 0x0ba2d7fULL },
+    { 0x17ba6eeULL, 0x1edecbaULL, 0x0eecbbdULL, 0x0ba6f6fULL },
+    { 0x17ba530ULL, 0x1ec60d9ULL, 0x0194bbdULL, 0x1360c6fULL },
+    { 0x17ba537ULL, 0x1fce4d9ULL, 0x1d94bbdULL, 0x1364e7fULL },
+    { 0x17ba529ULL, 0x1fc60f8ULL, 0x1294bbdULL, 0x03e0c7fULL },
+    { 0x17ba52eULL, 0x1ece4f8ULL, 0x0e94bbdULL, 0x03e4e6fULL },
+    { 0x17ba5d0ULL, 0x1cd68d9ULL, 0x0174bbdULL, 0x1362d67ULL },
+    { 0x17ba5d7ULL, 0x1ddecd9ULL, 0x1d74bbdULL, 0x1366f77ULL },
+    { 0x17ba5c9ULL, 0x1dd68f8ULL, 0x1274bbdULL, 0x03e2d77ULL },
+    { 0x17ba5ceULL, 0x1cdecf8ULL, 0x0e74bbdULL, 0x03e6f67ULL },
+    { 0x17bba10ULL, 0x18e709bULL, 0x010bbbdULL, 0x1b21ce3ULL },
+    { 0x17bba17ULL, 0x19ef49bULL, 0x1d0bbbdULL, 0x1b25ef3ULL },
+    { 0x17bba09ULL, 0x19e70baULL, 0x120bbbdULL, 0x0ba1cf3ULL },
+    { 0x17bba0eULL, 0x18ef4baULL, 0x0e0bbbdULL, 0x0ba5ee3ULL },
+    { 0x17bbaf0ULL, 0x1af789bULL, 0x01ebbbdULL, 0x1b23debULL },
+    { 0x17bbaf7ULL, 0x1bffc9bULL, 0x1debbbdULL, 0x1b27ffbULL },
+    { 0x17bbae9ULL, 0x1bf78baULL, 0x12ebbbdULL, 0x0ba3dfbULL },
+    { 0x17bbaeeULL, 0x1affcbaULL, 0x0eebbbdULL, 0x0ba7febULL },
+    { 0x17bb930ULL, 0x1ae70d9ULL, 0x0193bbdULL, 0x1361cebULL },
+    { 0x17bb937ULL, 0x1bef4d9ULL, 0x1d93bbdULL, 0x1365efbULL },
+    { 0x17bb929ULL, 0x1be70f8ULL, 0x1293bbdULL, 0x03e1cfbULL },
+    { 0x17bb92eULL, 0x1aef4f8ULL, 0x0e93bbdULL, 0x03e5eebULL },
+    { 0x17bb9d0ULL, 0x18f78d9ULL, 0x0173bbdULL, 0x1363de3ULL },
+    { 0x17bb9d7ULL, 0x19ffcd9ULL, 0x1d73bbdULL, 0x1367ff3ULL },
+    { 0x17bb9c9ULL, 0x19f78f8ULL, 0x1273bbdULL, 0x03e3df3ULL },
+    { 0x17bb9ceULL, 0x18ffcf8ULL, 0x0e73bbdULL, 0x03e7fe3ULL },
+    { 0x174c210ULL, 0x1884117ULL, 0x010865dULL, 0x1d10423ULL },
+    { 0x174c217ULL, 0x198c517ULL, 0x1d0865dULL, 0x1d14633ULL },
+    { 0x174c209ULL, 0x1984136ULL, 0x120865dULL, 0x0d90433ULL },
+    { 0x174c20eULL, 0x188c536ULL, 0x0e0865dULL, 0x0d94623ULL },
+    { 0x174c2f0ULL, 0x1a94917ULL, 0x01e865dULL, 0x1d1252bULL },
+    { 0x174c2f7ULL, 0x1b9cd17ULL, 0x1de865dULL, 0x1d1673bULL },
+    { 0x174c2e9ULL, 0x1b94936ULL, 0x12e865dULL, 0x0d9253bULL },
+    { 0x174c2eeULL, 0x1a9cd36ULL, 0x0ee865dULL, 0x0d9672bULL },
+    { 0x174c130ULL, 0x1a84155ULL, 0x019065dULL, 0x155042bULL },
+    { 0x174c137ULL, 0x1b8c555ULL, 0x1d9065dULL, 0x155463bULL },
+    { 0x174c129ULL, 0x1b84174ULL, 0x129065dULL, 0x05d043bULL },
+    { 0x174c12eULL, 0x1a8c574ULL, 0x0e9065dULL, 0x05d462bULL },
+    { 0x174c1d0ULL, 0x1894955ULL, 0x017065dULL, 0x1552523ULL },
+    { 0x174c1d7ULL, 0x199cd55ULL, 0x1d7065dULL, 0x1556733ULL },
+    { 0x174c1c9ULL, 0x1994974ULL, 0x127065dULL, 0x05d2533ULL },
+    { 0x174c1ceULL, 0x189cd74ULL, 0x0e7065dULL, 0x05d6723ULL },
+    { 0x174de10ULL, 0x1ca5117ULL, 0x010f65dULL, 0x1d114a7ULL },
+    { 0x174de17ULL, 0x1dad517ULL, 0x1d0f65dULL, 0x1d156b7ULL },
+    { 0x174de09ULL, 0x1da5136ULL, 0x120f65dULL, 0x0d914b7ULL },
+    { 0x174de0eULL, 0x1cad536ULL, 0x0e0f65dULL, 0x0d956a7ULL },
+    { 0x174def0ULL, 0x1eb5917ULL, 0x01ef65dULL, 0x1d135afULL },
+    { 0x174def7ULL, 0x1fbdd17ULL, 0x1def65dULL, 0x1d177bfULL },
+    { 0x174dee9ULL, 0x1fb5936ULL, 0x12ef65dULL, 0x0d935bfULL },
+    { 0x174deeeULL, 0x1ebdd36ULL, 0x0eef65dULL, 0x0d977afULL },
+    { 0x174dd30ULL, 0x1ea5155ULL, 0x019765dULL, 0x15514afULL },
+    { 0x174dd37ULL, 0x1fad555ULL, 0x1d9765dULL, 0x15556bfULL },
+    { 0x174dd29ULL, 0x1fa5174ULL, 0x129765dULL, 0x05d14bfULL },
+    { 0x174dd2eULL, 0x1ead574ULL, 0x0e9765dULL, 0x05d56afULL },
+    { 0x174ddd0ULL, 0x1cb5955ULL, 0x017765dULL, 0x15535a7ULL },
+    { 0x174ddd7ULL, 0x1dbdd55ULL, 0x1d7765dULL, 0x15577b7ULL },
+    { 0x174ddc9ULL, 0x1db5974ULL, 0x127765dULL, 0x05d35b7ULL },
+    { 0x174ddceULL, 0x1cbdd74ULL, 0x0e7765dULL, 0x05d77a7ULL },
+    { 0x174a610ULL, 0x1c84193ULL, 0x010ca5dULL, 0x1930427ULL },
+    { 0x174a617ULL, 0x1d8c593ULL, 0x1d0ca5dULL, 0x1934637ULL },
+    { 0x174a609ULL, 0x1d841b2ULL, 0x120ca5dULL, 0x09b0437ULL },
+    { 0x174a60eULL, 0x1c8c5b2ULL, 0x0e0ca5dULL, 0x09b4627ULL },
+    { 0x174a6f0ULL, 0x1e94993ULL, 0x01eca5dULL, 0x193252fULL },
+    { 0x174a6f7ULL, 0x1f9cd93ULL, 0x1deca5dULL, 0x193673fULL },
+    { 0x174a6e9ULL, 0x1f949b2ULL, 0x12eca5dULL, 0x09b253fULL },
+    { 0x174a6eeULL, 0x1e9cdb2ULL, 0x0eeca5dULL, 0x09b672fULL },
+    { 0x174a530ULL, 0x1e841d1ULL, 0x0194a5dULL, 0x117042fULL },
+    { 0x174a537ULL, 0x1f8c5d1ULL, 0x1d94a5dULL, 0x117463fULL },
+    { 0x174a529ULL, 0x1f841f0ULL, 0x1294a5dULL, 0x01f043fULL },
+    { 0x174a52eULL, 0x1e8c5f0ULL, 0x0e94a5dULL, 0x01f462fULL },
+    { 0x174a5d0ULL, 0x1c949d1ULL, 0x0174a5dULL, 0x1172527ULL },
+    { 0x174a5d7ULL, 0x1d9cdd1ULL, 0x1d74a5dULL, 0x1176737ULL },
+    { 0x174a5c9ULL, 0x1d949f0ULL, 0x1274a5dULL, 0x01f2537ULL },
+    { 0x174a5ceULL, 0x1c9cdf0ULL, 0x0e74a5dULL, 0x01f6727ULL },
+    { 0x174ba10ULL, 0x18a5193ULL, 0x010ba5dULL, 0x19314a3ULL },
+    { 0x174ba17ULL, 0x19ad593ULL, 0x1d0ba5dULL, 0x19356b3ULL },
+    { 0x174ba09ULL, 0x19a51b2ULL, 0x120ba5dULL, 0x09b14b3ULL },
+    { 0x174ba0eULL, 0x18ad5b2ULL, 0x0e0ba5dULL, 0x09b56a3ULL },
+    { 0x174baf0ULL, 0x1ab5993ULL, 0x01eba5dULL, 0x19335abULL },
+    { 0x174baf7ULL, 0x1bbdd93ULL, 0x1deba5dULL, 0x19377bbULL },
+    { 0x174bae9ULL, 0x1bb59b2ULL, 0x12eba5dULL, 0x09b35bbULL },
+    { 0x174baeeULL, 0x1abddb2ULL, 0x0eeba5dULL, 0x09b77abULL },
+    { 0x174b930ULL, 0x1aa51d1ULL, 0x0193a5dULL, 0x11714abULL },
+    { 0x174b937ULL, 0x1bad5d1ULL, 0x1d93a5dULL, 0x11756bbULL },
+    { 0x174b929ULL, 0x1ba51f0ULL, 0x1293a5dULL, 0x01f14bbULL },
+    { 0x174b92eULL, 0x1aad5f0ULL, 0x0e93a5dULL, 0x01f56abULL },
+    { 0x174b9d0ULL, 0x18b59d1ULL, 0x0173a5dULL, 0x11735a3ULL },
+    { 0x174b9d7ULL, 0x19bddd1ULL, 0x1d73a5dULL, 0x11777b3ULL },
+    { 0x174b9c9ULL, 0x19b59f0ULL, 0x1273a5dULL, 0x01f35b3ULL },
+    { 0x174b9ceULL, 0x18bddf0ULL, 0x0e73a5dULL, 0x01f77a3ULL },
+    { 0x1774210ULL, 0x10c6117ULL, 0x01085ddULL, 0x1d10c61ULL },
+    { 0x1774217ULL, 0x11ce517ULL, 0x1d085ddULL, 0x1d14e71ULL },
+    { 0x1774209ULL, 0x11c6136ULL, 0x12085ddULL, 0x0d90c71ULL },
+    { 0x177420eULL, 0x10ce536ULL, 0x0e085ddULL, 0x0d94e61ULL },
+    { 0x17742f0ULL, 0x12d6917ULL, 0x01e85ddULL, 0x1d12d69ULL },
+    { 0x17742f7ULL, 0x13ded17ULL, 0x1de85ddULL, 0x1d16f79ULL },
+    { 0x17742e9ULL, 0x13d6936ULL, 0x12e85ddULL, 0x0d92d79ULL },
+    { 0x17742eeULL, 0x12ded36ULL, 0x0ee85ddULL, 0x0d96f69ULL },
+    { 0x1774130ULL, 0x12c6155ULL, 0x01905ddULL, 0x1550c69ULL },
+    { 0x1774137ULL, 0x13ce555ULL, 0x1d905ddULL, 0x1554e79ULL },
+    { 0x1774129ULL, 0x13c6174ULL, 0x12905ddULL, 0x05d0c79ULL },
+    { 0x177412eULL, 0x12ce574ULL, 0x0e905ddULL, 0x05d4e69ULL },
+    { 0x17741d0ULL, 0x10d6955ULL, 0x01705ddULL, 0x1552d61ULL },
+    { 0x17741d7ULL, 0x11ded55ULL, 0x1d705ddULL, 0x1556f71ULL },
+    { 0x17741c9ULL, 0x11d6974ULL, 0x12705ddULL, 0x05d2d71ULL },
+    { 0x17741ceULL, 0x10ded74ULL, 0x0e705ddULL, 0x05d6f61ULL },
+    { 0x1775e10ULL, 0x14e7117ULL, 0x010f5ddULL, 0x1d11ce5ULL },
+    { 0x1775e17ULL, 0x15ef517ULL, 0x1d0f5ddULL, 0x1d15ef5ULL },
+    { 0x1775e09ULL, 0x15e7136ULL, 0x120f5ddULL, 0x0d91cf5ULL },
+    { 0x1775e0eULL, 0x14ef536ULL, 0x0e0f5ddULL, 0x0d95ee5ULL },
+    { 0x1775ef0ULL, 0x16f7917ULL, 0x01ef5ddULL, 0x1d13dedULL },
+    { 0x1775ef7ULL, 0x17ffd17ULL, 0x1def5ddULL, 0x1d17ffdULL },
+    { 0x1775ee9ULL, 0x17f7936ULL, 0x12ef5ddULL, 0x0d93dfdULL },
+    { 0x1775eeeULL, 0x16ffd36ULL, 0x0eef5ddULL, 0x0d97fedULL },
+    { 0x1775d30ULL, 0x16e7155ULL, 0x01975ddULL, 0x1551cedULL },
+    { 0x1775d37ULL, 0x17ef555ULL, 0x1d975ddULL, 0x1555efdULL },
+    { 0x1775d29ULL, 0x17e7174ULL, 0x12975ddULL, 0x05d1cfdULL },
+    { 0x1775d2eULL, 0x16ef574ULL, 0x0e975ddULL, 0x05d5eedULL },
+    { 0x1775dd0ULL, 0x14f7955ULL, 0x01775ddULL, 0x1553de5ULL },
+    { 0x1775dd7ULL, 0x15ffd55ULL, 0x1d775ddULL, 0x1557ff5ULL },
+    { 0x1775dc9ULL, 0x15f7974ULL, 0x12775ddULL, 0x05d3df5ULL },
+    { 0x1775dceULL, 0x14ffd74ULL, 0x0e775ddULL, 0x05d7fe5ULL },
+    { 0x1772610ULL, 0x14c6193ULL, 0x010c9ddULL, 0x1930c65ULL },
+    { 0x1772617ULL, 0x15ce593ULL, 0x1d0c9ddULL, 0x1934e75ULL },
+    { 0x1772609ULL, 0x15c61b2ULL, 0x120c9ddULL, 0x09b0c75ULL },
+    { 0x177260eULL, 0x14ce5b2ULL, 0x0e0c9ddULL, 0x09b4e65ULL },
+    { 0x17726f0ULL, 0x16d6993ULL, 0x01ec9ddULL, 0x1932d6dULL },
+    { 0x17726f7ULL, 0x17ded93ULL, 0x1dec9ddULL, 0x1936f7dULL },
+    { 0x17726e9ULL, 0x17d69b2ULL, 0x12ec9ddULL, 0x09b2d7dULL },
+    { 0x17726eeULL, 0x16dedb2ULL, 0x0eec9ddULL, 0x09b6f6dULL },
+    { 0x1772530ULL, 0x16c61d1ULL, 0x01949ddULL, 0x1170c6dULL },
+    { 0x1772537ULL, 0x17ce5d1ULL, 0x1d949ddULL, 0x1174e7dULL },
+    { 0x1772529ULL, 0x17c61f0ULL, 0x12949ddULL, 0x01f0c7dULL },
+    { 0x177252eULL, 0x16ce5f0ULL, 0x0e949ddULL, 0x01f4e6dULL },
+    { 0x17725d0ULL, 0x14d69d1ULL, 0x01749ddULL, 0x1172d65ULL },
+    { 0x17725d7ULL, 0x15dedd1ULL, 0x1d749ddULL, 0x1176f75ULL },
+    { 0x17725c9ULL, 0x15d69f0ULL, 0x12749ddULL, 0x01f2d75ULL },
+    { 0x17725ceULL, 0x14dedf0ULL, 0x0e749ddULL, 0x01f6f65ULL },
+    { 0x1773a10ULL, 0x10e7193ULL, 0x010b9ddULL, 0x1931ce1ULL },
+    { 0x1773a17ULL, 0x11ef593ULL, 0x1d0b9ddULL, 0x1935ef1ULL },
+    { 0x1773a09ULL, 0x11e71b2ULL, 0x120b9ddULL, 0x09b1cf1ULL },
+    { 0x1773a0eULL, 0x10ef5b2ULL, 0x0e0b9ddULL, 0x09b5ee1ULL },
+    { 0x1773af0ULL, 0x12f7993ULL, 0x01eb9ddULL, 0x1933de9ULL },
+    { 0x1773af7ULL, 0x13ffd93ULL, 0x1deb9ddULL, 0x1937ff9ULL },
+    { 0x1773ae9ULL, 0x13f79b2ULL, 0x12eb9ddULL, 0x09b3df9ULL },
+    { 0x1773aeeULL, 0x12ffdb2ULL, 0x0eeb9ddULL, 0x09b7fe9ULL },
+    { 0x1773930ULL, 0x12e71d1ULL, 0x01939ddULL, 0x1171ce9ULL },
+    { 0x1773937ULL, 0x13ef5d1ULL, 0x1d939ddULL, 0x1175ef9ULL },
+    { 0x1773929ULL, 0x13e71f0ULL, 0x12939ddULL, 0x01f1cf9ULL },
+    { 0x177392eULL, 0x12ef5f0ULL, 0x0e939ddULL, 0x01f5ee9ULL },
+    { 0x17739d0ULL, 0x10f79d1ULL, 0x01739ddULL, 0x1173de1ULL },
+    { 0x17739d7ULL, 0x11ffdd1ULL, 0x1d739ddULL, 0x1177ff1ULL },
+    { 0x17739c9ULL, 0x11f79f0ULL, 0x12739ddULL, 0x01f3df1ULL },
+    { 0x17739ceULL, 0x10ffdf0ULL, 0x0e739ddULL, 0x01f7fe1ULL },
+    { 0x0984210ULL, 0x100020fULL, 0x0108432ULL, 0x1e08001ULL },
+    { 0x0984217ULL, 0x110860fULL, 0x1d08432ULL, 0x1e0c211ULL },
+    { 0x0984209ULL, 0x110022eULL, 0x1208432ULL, 0x0e88011ULL },
+    { 0x098420eULL, 0x100862eULL, 0x0e08432ULL, 0x0e8c201ULL },
+    { 0x09842f0ULL, 0x1210a0fULL, 0x01e8432ULL, 0x1e0a109ULL },
+    { 0x09842f7ULL, 0x1318e0fULL, 0x1de8432ULL, 0x1e0e319ULL },
+    { 0x09842e9ULL, 0x1310a2eULL, 0x12e8432ULL, 0x0e8a119ULL },
+    { 0x09842eeULL, 0x1218e2eULL, 0x0ee8432ULL, 0x0e8e309ULL },
+    { 0x0984130ULL, 0x120024dULL, 0x0190432ULL, 0x1648009ULL },
+    { 0x0984137ULL, 0x130864dULL, 0x1d90432ULL, 0x164c219ULL },
+    { 0x0984129ULL, 0x130026cULL, 0x1290432ULL, 0x06c8019ULL },
+    { 0x098412eULL, 0x120866cULL, 0x0e90432ULL, 0x06cc209ULL },
+    { 0x09841d0ULL, 0x1010a4dULL, 0x0170432ULL, 0x164a101ULL },
+    { 0x09841d7ULL, 0x1118e4dULL, 0x1d70432ULL, 0x164e311ULL },
+    { 0x09841c9ULL, 0x1110a6cULL, 0x1270432ULL, 0x06ca111ULL },
+    { 0x09841ceULL, 0x1018e6cULL, 0x0e70432ULL, 0x06ce301ULL },
+    { 0x0985e10ULL, 0x142120fULL, 0x010f432ULL, 0x1e09085ULL },
+    { 0x0985e17ULL, 0x152960fULL, 0x1d0f432ULL, 0x1e0d295ULL },
+    { 0x0985e09ULL, 0x152122eULL, 0x120f432ULL, 0x0e89095ULL },
+    { 0x0985e0eULL, 0x142962eULL, 0x0e0f432ULL, 0x0e8d285ULL },
+    { 0x0985ef0ULL, 0x1631a0fULL, 0x01ef432ULL, 0x1e0b18dULL },
+    { 0x0985ef7ULL, 0x1739e0fULL, 0x1def432ULL, 0x1e0f39dULL },
+    { 0x0985ee9ULL, 0x1731a2eULL, 0x12ef432ULL, 0x0e8b19dULL },
+    { 0x0985eeeULL, 0x1639e2eULL, 0x0eef432ULL, 0x0e8f38dULL },
+    { 0x0985d30ULL, 0x162124dULL, 0x0197432ULL, 0x164908dULL },
+    { 0x0985d37ULL, 0x172964dULL, 0x1d97432ULL, 0x164d29dULL },
+    { 0x0985d29ULL, 0x172126cULL, 0x1297432ULL, 0x06c909dULL },
+    { 0x0985d2eULL, 0x162966cULL, 0x0e97432ULL, 0x06cd28dULL },
+    { 0x0985dd0ULL, 0x1431a4dULL, 0x0177432ULL, 0x164b185ULL },
+    { 0x0985dd7ULL, 0x1539e4dULL, 0x1d77432ULL, 0x164f395ULL },
+    { 0x0985dc9ULL, 0x1531a6cULL, 0x1277432ULL, 0x06cb195ULL },
+    { 0x0985dceULL, 0x1439e6cULL, 0x0e77432ULL, 0x06cf385ULL },
+    { 0x0982610ULL, 0x140028bULL, 0x010c832ULL, 0x1a28005ULL },
+    { 0x0982617ULL, 0x150868bULL, 0x1d0c832ULL, 0x1a2c215ULL },
+    { 0x0982609ULL, 0x15002aaULL, 0x120c832ULL, 0x0aa8015ULL },
+    { 0x098260eULL, 0x14086aaULL, 0x0e0c832ULL, 0x0aac205ULL },
+    { 0x09826f0ULL, 0x1610a8bULL, 0x01ec832ULL, 0x1a2a10dULL },
+    { 0x09826f7ULL, 0x1718e8bULL, 0x1dec832ULL, 0x1a2e31dULL },
+    { 0x09826e9ULL, 0x1710aaaULL, 0x12ec832ULL, 0x0aaa11dULL },
+    { 0x09826eeULL, 0x1618eaaULL, 0x0eec832ULL, 0x0aae30dULL },
+    { 0x0982530ULL, 0x16002c9ULL, 0x0194832ULL, 0x126800dULL },
+    { 0x0982537ULL, 0x17086c9ULL, 0x1d94832ULL, 0x126c21dULL },
+    { 0x0982529ULL, 0x17002e8ULL, 0x1294832ULL, 0x02e801dULL },
+    { 0x098252eULL, 0x16086e8ULL, 0x0e94832ULL, 0x02ec20dULL },
+    { 0x09825d0ULL, 0x1410ac9ULL, 0x0174832ULL, 0x126a105ULL },
+    { 0x09825d7ULL, 0x1518ec9ULL, 0x1d74832ULL, 0x126e315ULL },
+    { 0x09825c9ULL, 0x1510ae8ULL, 0x1274832ULL, 0x02ea115ULL },
+    { 0x09825ceULL, 0x1418ee8ULL, 0x0e74832ULL, 0x02ee305ULL },
+    { 0x0983a10ULL, 0x102128bULL, 0x010b832ULL, 0x1a29081ULL },
+    { 0x0983a17ULL, 0x112968bULL, 0x1d0b832ULL, 0x1a2d291ULL },
+    { 0x0983a09ULL, 0x11212aaULL, 0x120b832ULL, 0x0aa9091ULL },
+    { 0x0983a0eULL, 0x10296aaULL, 0x0e0b832ULL, 0x0aad281ULL },
+    { 0x0983af0ULL, 0x1231a8bULL, 0x01eb832ULL, 0x1a2b189ULL },
+    { 0x0983af7ULL, 0x1339e8bULL, 0x1deb832ULL, 0x1a2f399ULL },
+    { 0x0983ae9ULL, 0x1331aaaULL, 0x12eb832ULL, 0x0aab199ULL },
+    { 0x0983aeeULL, 0x1239eaaULL, 0x0eeb832ULL, 0x0aaf389ULL },
+    { 0x0983930ULL, 0x12212c9ULL, 0x0193832ULL, 0x1269089ULL },
+    { 0x0983937ULL, 0x13296c9ULL, 0x1d93832ULL, 0x126d299ULL },
+    { 0x0983929ULL, 0x13212e8ULL, 0x1293832ULL, 0x02e9099ULL },
+    { 0x098392eULL, 0x12296e8ULL, 0x0e93832ULL, 0x02ed289ULL },
+    { 0x09839d0ULL, 0x1031ac9ULL, 0x0173832ULL, 0x126b181ULL },
+    { 0x09839d7ULL, 0x1139ec9ULL, 0x1d73832ULL, 0x126f391ULL },
+    { 0x09839c9ULL, 0x1131ae8ULL, 0x1273832ULL, 0x02eb191ULL },
+    { 0x09839ceULL, 0x1039ee8ULL, 0x0e73832ULL, 0x02ef381ULL },
+    { 0x09bc210ULL, 0x184220fULL, 0x01087b2ULL, 0x1e08843ULL },
+    { 0x09bc217ULL, 0x194a60fULL, 0x1d087b2ULL, 0x1e0ca53ULL },
+    { 0x09bc209ULL, 0x194222eULL, 0x12087b2ULL, 0x0e88853ULL },
+    { 0x09bc20eULL, 0x184a62eULL, 0x0e087b2ULL, 0x0e8ca43ULL },
+    { 0x09bc2f0ULL, 0x1a52a0fULL, 0x01e87b2ULL, 0x1e0a94bULL },
+    { 0x09bc2f7ULL, 0x1b5ae0fULL, 0x1de87b2ULL, 0x1e0eb5bULL },
+    { 0x09bc2e9ULL, 0x1b52a2eULL, 0x12e87b2ULL, 0x0e8a95bULL },
+    { 0x09bc2eeULL, 0x1a5ae2eULL, 0x0ee87b2ULL, 0x0e8eb4bULL },
+    { 0x09bc130ULL, 0x1a4224dULL, 0x01907b2ULL, 0x164884bULL },
+    { 0x09bc137ULL, 0x1b4a64dULL, 0x1d907b2ULL, 0x164ca5bULL },
+    { 0x09bc129ULL, 0x1b4226cULL, 0x12907b2ULL, 0x06c885bULL },
+    { 0x09bc12eULL, 0x1a4a66cULL, 0x0e907b2ULL, 0x06cca4bULL },
+    { 0x09bc1d0ULL, 0x1852a4dULL, 0x01707b2ULL, 0x164a943ULL },
+    { 0x09bc1d7ULL, 0x195ae4dULL, 0x1d707b2ULL, 0x164eb53ULL },
+    { 0x09bc1c9ULL, 0x1952a6cULL, 0x12707b2ULL, 0x06ca953ULL },
+    { 0x09bc1ceULL, 0x185ae6cULL, 0x0e707b2ULL, 0x06ceb43ULL },
+    { 0x09bde10ULL, 0x1c6320fULL, 0x010f7b2ULL, 0x1e098c7ULL },
+    { 0x09bde17ULL, 0x1d6b60fULL, 0x1d0f7b2ULL, 0x1e0dad7ULL },
+    { 0x09bde09ULL, 0x1d6322eULL, 0x120f7b2ULL, 0x0e898d7ULL },
+    { 0x09bde0eULL, 0x1c6b62eULL, 0x0e0f7b2ULL, 0x0e8dac7ULL },
+    { 0x09bdef0ULL, 0x1e73a0fULL, 0x01ef7b2ULL, 0x1e0b9cfULL },
+    { 0x09bdef7ULL, 0x1f7be0fULL, 0x1def7b2ULL, 0x1e0fbdfULL },
+    { 0x09bdee9ULL, 0x1f73a2eULL, 0x12ef7b2ULL, 0x0e8b9dfULL },
+    { 0x09bdeeeULL, 0x1e7be2eULL, 0x0eef7b2ULL, 0x0e8fbcfULL },
+    { 0x09bdd30ULL, 0x1e6324dULL, 0x01977b2ULL, 0x16498cfULL },
+    { 0x09bdd37ULL, 0x1f6b64dULL, 0x1d977b2ULL, 0x164dadfULL },
+    { 0x09bdd29ULL, 0x1f6326cULL, 0x12977b2ULL, 0x06c98dfULL },
+    { 0x09bdd2eULL, 0x1e6b66cULL, 0x0e977b2ULL, 0x06cdacfULL },
+    { 0x09bddd0ULL, 0x1c73a4dULL, 0x01777b2ULL, 0x164b9c7ULL },
+    { 0x09bddd7ULL, 0x1d7be4dULL, 0x1d777b2ULL, 0x164fbd7ULL },
+    { 0x09bddc9ULL, 0x1d73a6cULL, 0x12777b2ULL, 0x06cb9d7ULL },
+    { 0x09bddceULL, 0x1c7be6cULL, 0x0e777b2ULL, 0x06cfbc7ULL },
+    { 0x09ba610ULL, 0x1c4228bULL, 0x010cbb2ULL, 0x1a28847ULL },
+    { 0x09ba617ULL, 0x1d4a68bULL, 0x1d0cbb2ULL, 0x1a2ca57ULL },
+    { 0x09ba609ULL, 0x1d422aaULL, 0x120cbb2ULL, 0x0aa8857ULL },
+    { 0x09ba60eULL, 0x1c4a6aaULL, 0x0e0cbb2ULL, 0x0aaca47ULL },
+    { 0x09ba6f0ULL, 0x1e52a8bULL, 0x01ecbb2ULL, 0x1a2a94fULL },
+    { 0x09ba6f7ULL, 0x1f5ae8bULL, 0x1decbb2ULL, 0x1a2eb5fULL },
+    { 0x09ba6e9ULL, 0x1f52aaaULL, 0x12ecbb2ULL, 0x0aaa95fULL },
+    { 0x09ba6eeULL, 0x1e5aeaaULL, 0x0eecbb2ULL, 0x0aaeb4fULL },
+    { 0x09ba530ULL, 0x1e422c9ULL, 0x0194bb2ULL, 0x126884fULL },
+    { 0x09ba537ULL, 0x1f4a6c9ULL, 0x1d94bb2ULL, 0x126ca5fULL },
+    { 0x09ba529ULL, 0x1f422e8ULL, 0x1294bb2ULL, 0x02e885fULL },
+    { 0x09ba52eULL, 0x1e4a6e8ULL, 0x0e94bb2ULL, 0x02eca4fULL },
+    { 0x09ba5d0ULL, 0x1c52ac9ULL, 0x0174bb2ULL, 0x126a947ULL },
+    { 0x09ba5d7ULL, 0x1d5aec9ULL, 0x1d74bb2ULL, 0x126eb57ULL },
+    { 0x09ba5c9ULL, 0x1d52ae8ULL, 0x1274bb2ULL, 0x02ea957ULL },
+    { 0x09ba5ceULL, 0x1c5aee8ULL, 0x0e74bb2ULL, 0x02eeb47ULL },
+    { 0x09bba10ULL, 0x186328bULL, 0x010bbb2ULL, 0x1a298c3ULL },
+    { 0x09bba17ULL, 0x196b68bULL, 0x1d0bbb2ULL, 0x1a2dad3ULL },
+    { 0x09bba09ULL, 0x19632aaULL, 0x120bbb2ULL, 0x0aa98d3ULL },
+    { 0x09bba0eULL, 0x186b6aaULL, 0x0e0bbb2ULL, 0x0aadac3ULL },
+    { 0x09bbaf0ULL, 0x1a73a8bULL, 0x01ebbb2ULL, 0x1a2b9cbULL },
+    { 0x09bbaf7ULL, 0x1b7be8bULL, 0x1debbb2ULL, 0x1a2fbdbULL },
+    { 0x09bbae9ULL, 0x1b73aaaULL, 0x12ebbb2ULL, 0x0aab9dbULL },
+    { 0x09bbaeeULL, 0x1a7beaaULL, 0x0eebbb2ULL, 0x0aafbcbULL },
+    { 0x09bb930ULL, 0x1a632c9ULL, 0x0193bb2ULL, 0x12698cbULL },
+    { 0x09bb937ULL, 0x1b6b6c9ULL, 0x1d93bb2ULL, 0x126dadbULL },
+    { 0x09bb929ULL, 0x1b632e8ULL, 0x1293bb2ULL, 0x02e98dbULL },
+    { 0x09bb92eULL, 0x1a6b6e8ULL, 0x0e93bb2ULL, 0x02edacbULL },
+    { 0x09bb9d0ULL, 0x1873ac9ULL, 0x0173bb2ULL, 0x126b9c3ULL },
+    { 0x09bb9d7ULL, 0x197bec9ULL, 0x1d73bb2ULL, 0x126fbd3ULL },
+    { 0x09bb9c9ULL, 0x1973ae8ULL, 0x1273bb2ULL, 0x02eb9d3ULL },
+    { 0x09bb9ceULL, 0x187bee8ULL, 0x0e73bb2ULL, 0x02efbc3ULL },
+    { 0x094c210ULL, 0x1800307ULL, 0x0108652ULL, 0x1c18003ULL },
+    { 0x094c217ULL, 0x1908707ULL, 0x1d08652ULL, 0x1c1c213ULL },
+    { 0x094c209ULL, 0x1900326ULL, 0x1208652ULL, 0x0c98013ULL },
+    { 0x094c20eULL, 0x1808726ULL, 0x0e08652ULL, 0x0c9c203ULL },
+    { 0x094c2f0ULL, 0x1a10b07ULL, 0x01e8652ULL, 0x1c1a10bULL },
+    { 0x094c2f7ULL, 0x1b18f07ULL, 0x1de8652ULL, 0x1c1e31bULL },
+    { 0x094c2e9ULL, 0x1b10b26ULL, 0x12e8652ULL, 0x0c9a11bULL },
+    { 0x094c2eeULL, 0x1a18f26ULL, 0x0ee8652ULL, 0x0c9e30bULL },
+    { 0x094c130ULL, 0x1a00345ULL, 0x0190652ULL, 0x145800bULL },
+    { 0x094c137ULL, 0x1b08745ULL, 0x1d90652ULL, 0x145c21bULL },
+    { 0x094c129ULL, 0x1b00364ULL, 0x1290652ULL, 0x04d801bULL },
+    { 0x094c12eULL, 0x1a08764ULL, 0x0e90652ULL, 0x04dc20bULL },
+    { 0x094c1d0ULL, 0x1810b45ULL, 0x0170652ULL, 0x145a103ULL },
+    { 0x094c1d7ULL, 0x1918f45ULL, 0x1d70652ULL, 0x145e313ULL },
+    { 0x094c1c9ULL, 0x1910b64ULL, 0x1270652ULL, 0x04da113ULL },
+    { 0x094c1ceULL, 0x1818f64ULL, 0x0e70652ULL, 0x04de303ULL },
+    { 0x094de10ULL, 0x1c21307ULL, 0x010f652ULL, 0x1c19087ULL },
+    { 0x094de17ULL, 0x1d29707ULL, 0x1d0f652ULL, 0x1c1d297ULL },
+    { 0x094de09ULL, 0x1d21326ULL, 0x120f652ULL, 0x0c99097ULL },
+    { 0x094de0eULL, 0x1c29726ULL, 0x0e0f652ULL, 0x0c9d287ULL },
+    { 0x094def0ULL, 0x1e31b07ULL, 0x01ef652ULL, 0x1c1b18fULL },
+    { 0x094def7ULL, 0x1f39f07ULL, 0x1def652ULL, 0x1c1f39fULL },
+    { 0x094dee9ULL, 0x1f31b26ULL, 0x12ef652ULL, 0x0c9b19fULL },
+    { 0x094deeeULL, 0x1e39f26ULL, 0x0eef652ULL, 0x0c9f38fULL },
+    { 0x094dd30ULL, 0x1e21345ULL, 0x0197652ULL, 0x145908fULL },
+    { 0x094dd37ULL, 0x1f29745ULL, 0x1d97652ULL, 0x145d29fULL },
+    { 0x094dd29ULL, 0x1f21364ULL, 0x1297652ULL, 0x04d909fULL },
+    { 0x094dd2eULL, 0x1e29764ULL, 0x0e97652ULL, 0x04dd28fULL },
+    { 0x094ddd0ULL, 0x1c31b45ULL, 0x0177652ULL, 0x145b187ULL },
+    { 0x094ddd7ULL, 0x1d39f45ULL, 0x1d77652ULL, 0x145f397ULL },
+    { 0x094ddc9ULL, 0x1d31b64ULL, 0x1277652ULL, 0x04db197ULL },
+    { 0x094ddceULL, 0x1c39f64ULL, 0x0e77652ULL, 0x04df387ULL },
+    { 0x094a610ULL, 0x1c00383ULL, 0x010ca52ULL, 0x1838007ULL },
+    { 0x094a617ULL, 0x1d08783ULL, 0x1d0ca52ULL, 0x183c217ULL },
+    { 0x094a609ULL, 0x1d003a2ULL, 0x120ca52ULL, 0x08b8017ULL },
+    { 0x094a60eULL, 0x1c087a2ULL, 0x0e0ca52ULL, 0x08bc207ULL },
+    { 0x094a6f0ULL, 0x1e10b83ULL, 0x01eca52ULL, 0x183a10fULL },
+    { 0x094a6f7ULL, 0x1f18f83ULL, 0x1deca52ULL, 0x183e31fULL },
+    { 0x094a6e9ULL, 0x1f10ba2ULL, 0x12eca52ULL, 0x08ba11fULL },
+    { 0x094a6eeULL, 0x1e18fa2ULL, 0x0eeca52ULL, 0x08be30fULL },
+    { 0x094a530ULL, 0x1e003c1ULL, 0x0194a52ULL, 0x107800fULL },
+    { 0x094a537ULL, 0x1f087c1ULL, 0x1d94a52ULL, 0x107c21fULL },
+    { 0x094a529ULL, 0x1f003e0ULL, 0x1294a52ULL, 0x00f801fULL },
+    { 0x094a52eULL, 0x1e087e0ULL, 0x0e94a52ULL, 0x00fc20fULL },
+    { 0x094a5d0ULL, 0x1c10bc1ULL, 0x0174a52ULL, 0x107a107ULL },
+    { 0x094a5d7ULL, 0x1d18fc1ULL, 0x1d74a52ULL, 0x107e317ULL },
+    { 0x094a5c9ULL, 0x1d10be0ULL, 0x1274a52ULL, 0x00fa117ULL },
+    { 0x094a5ceULL, 0x1c18fe0ULL, 0x0e74a52ULL, 0x00fe307ULL },
+    { 0x094ba10ULL, 0x1821383ULL, 0x010ba52ULL, 0x1839083ULL },
+    { 0x094ba17ULL, 0x1929783ULL, 0x1d0ba52ULL, 0x183d293ULL },
+    { 0x094ba09ULL, 0x19213a2ULL, 0x120ba52ULL, 0x08b9093ULL },
+    { 0x094ba0eULL, 0x18297a2ULL, 0x0e0ba52ULL, 0x08bd283ULL },
+    { 0x094baf0ULL, 0x1a31b83ULL, 0x01eba52ULL, 0x183b18bULL },
+    { 0x094baf7ULL, 0x1b39f83ULL, 0x1deba52ULL, 0x183f39bULL },
+    { 0x094bae9ULL, 0x1b31ba2ULL, 0x12eba52ULL, 0x08bb19bULL },
+    { 0x094baeeULL, 0x1a39fa2ULL, 0x0eeba52ULL, 0x08bf38bULL },
+    { 0x094b930ULL, 0x1a213c1ULL, 0x0193a52ULL, 0x107908bULL },
+    { 0x094b937ULL, 0x1b297c1ULL, 0x1d93a52ULL, 0x107d29bULL },
+    { 0x094b929ULL, 0x1b213e0ULL, 0x1293a52ULL, 0x00f909bULL },
+    { 0x094b92eULL, 0x1a297e0ULL, 0x0e93a52ULL, 0x00fd28bULL },
+    { 0x094b9d0ULL, 0x1831bc1ULL, 0x0173a52ULL, 0x107b183ULL },
+    { 0x094b9d7ULL, 0x1939fc1ULL, 0x1d73a52ULL, 0x107f393ULL },
+    { 0x094b9c9ULL, 0x1931be0ULL, 0x1273a52ULL, 0x00fb193ULL },
+    { 0x094b9ceULL, 0x1839fe0ULL, 0x0e73a52ULL, 0x00ff383ULL },
+    { 0x0974210ULL, 0x1042307ULL, 0x01085d2ULL, 0x1c18841ULL },
+    { 0x0974217ULL, 0x114a707ULL, 0x1d085d2ULL, 0x1c1ca51ULL },
+    { 0x0974209ULL, 0x1142326ULL, 0x12085d2ULL, 0x0c98851ULL },
+    { 0x097420eULL, 0x104a726ULL, 0x0e085d2ULL, 0x0c9ca41ULL },
+    { 0x09742f0ULL, 0x1252b07ULL, 0x01e85d2ULL, 0x1c1a949ULL },
+    { 0x09742f7ULL, 0x135af07ULL, 0x1de85d2ULL, 0x1c1eb59ULL },
+    { 0x09742e9ULL, 0x1352b26ULL, 0x12e85d2ULL, 0x0c9a959ULL },
+    { 0x09742eeULL, 0x125af26ULL, 0x0ee85d2ULL, 0x0c9eb49ULL },
+    { 0x0974130ULL, 0x1242345ULL, 0x01905d2ULL, 0x1458849ULL },
+    { 0x0974137ULL, 0x134a745ULL, 0x1d905d2ULL, 0x145ca59ULL },
+    { 0x0974129ULL, 0x1342364ULL, 0x12905d2ULL, 0x04d8859ULL },
+    { 0x097412eULL, 0x124a764ULL, 0x0e905d2ULL, 0x04dca49ULL },
+    { 0x09741d0ULL, 0x1052b45ULL, 0x01705d2ULL, 0x145a941ULL },
+    { 0x09741d7ULL, 0x115af45ULL, 0x1d705d2ULL, 0x145eb51ULL },
+    { 0x09741c9ULL, 0x1152b64ULL, 0x12705d2ULL, 0x04da951ULL },
+    { 0x09741ceULL, 0x105af64ULL, 0x0e705d2ULL, 0x04deb41ULL },
+    { 0x0975e10ULL, 0x1463307ULL, 0x010f5d2ULL, 0x1c198c5ULL },
+    { 0x0975e17ULL, 0x156b707ULL, 0x1d0f5d2ULL, 0x1c1dad5ULL },
+    { 0x0975e09ULL, 0x1563326ULL, 0x120f5d2ULL, 0x0c998d5ULL },
+    { 0x0975e0eULL, 0x146b726ULL, 0x0e0f5d2ULL, 0x0c9dac5ULL },
+    { 0x0975ef0ULL, 0x1673b07ULL, 0x01ef5d2ULL, 0x1c1b9cdULL },
+    { 0x0975ef7ULL, 0x177bf07ULL, 0x1def5d2ULL, 0x1c1fbddULL },
+    { 0x0975ee9ULL, 0x1773b26ULL, 0x12ef5d2ULL, 0x0c9b9ddULL },
+    { 0x0975eeeULL, 0x167bf26ULL, 0x0eef5d2ULL, 0x0c9fbcdULL },
+    { 0x0975d30ULL, 0x1663345ULL, 0x01975d2ULL, 0x14598cdULL },
+    { 0x0975d37ULL, 0x176b745ULL, 0x1d975d2ULL, 0x145daddULL },
+    { 0x0975d29ULL, 0x1763364ULL, 0x12975d2ULL, 0x04d98ddULL },
+    { 0x0975d2eULL, 0x166b764ULL, 0x0e975d2ULL, 0x04ddacdULL },
+    { 0x0975dd0ULL, 0x1473b45ULL, 0x01775d2ULL, 0x145b9c5ULL },
+    { 0x0975dd7ULL, 0x157bf45ULL, 0x1d775d2ULL, 0x145fbd5ULL },
+    { 0x0975dc9ULL, 0x1573b64ULL, 0x12775d2ULL, 0x04db9d5ULL },
+    { 0x0975dceULL, 0x147bf64ULL, 0x0e775d2ULL, 0x04dfbc5ULL },
+    { 0x0972610ULL, 0x1442383ULL, 0x010c9d2ULL, 0x1838845ULL },
+    { 0x0972617ULL, 0x154a783ULL, 0x1d0c9d2ULL, 0x183ca55ULL },
+    { 0x0972609ULL, 0x15423a2ULL, 0x120c9d2ULL, 0x08b8855ULL },
+    { 0x097260eULL, 0x144a7a2ULL, 0x0e0c9d2ULL, 0x08bca45ULL },
+    { 0x09726f0ULL, 0x1652b83ULL, 0x01ec9d2ULL, 0x183a94dULL },
+    { 0x09726f7ULL, 0x175af83ULL, 0x1dec9d2ULL, 0x183eb5dULL },
+    { 0x09726e9ULL, 0x1752ba2ULL, 0x12ec9d2ULL, 0x08ba95dULL },
+    { 0x09726eeULL, 0x165afa2ULL, 0x0eec9d2ULL, 0x08beb4dULL },
+    { 0x0972530ULL, 0x16423c1ULL, 0x01949d2ULL, 0x107884dULL },
+    { 0x0972537ULL, 0x174a7c1ULL, 0x1d949d2ULL, 0x107ca5dULL },
+    { 0x0972529ULL, 0x17423e0ULL, 0x12949d2ULL, 0x00f885dULL },
+    { 0x097252eULL, 0x164a7e0ULL, 0x0e949d2ULL, 0x00fca4dULL },
+    { 0x09725d0ULL, 0x1452bc1ULL, 0x01749d2ULL, 0x107a945ULL },
+    { 0x09725d7ULL, 0x155afc1ULL, 0x1d749d2ULL, 0x107eb55ULL },
+    { 0x09725c9ULL, 0x1552be0ULL, 0x12749d2ULL, 0x00fa955ULL },
+    { 0x09725ceULL, 0x145afe0ULL, 0x0e749d2ULL, 0x00feb45ULL },
+    { 0x0973a10ULL, 0x1063383ULL, 0x010b9d2ULL, 0x18398c1ULL },
+    { 0x0973a17ULL, 0x116b783ULL, 0x1d0b9d2ULL, 0x183dad1ULL },
+    { 0x0973a09ULL, 0x11633a2ULL, 0x120b9d2ULL, 0x08b98d1ULL },
+    { 0x0973a0eULL, 0x106b7a2ULL, 0x0e0b9d2ULL, 0x08bdac1ULL },
+    { 0x0973af0ULL, 0x1273b83ULL, 0x01eb9d2ULL, 0x183b9c9ULL },
+    { 0x0973af7ULL, 0x137bf83ULL, 0x1deb9d2ULL, 0x183fbd9ULL },
+    { 0x0973ae9ULL, 0x1373ba2ULL, 0x12eb9d2ULL, 0x08bb9d9ULL },
+    { 0x0973aeeULL, 0x127bfa2ULL, 0x0eeb9d2ULL, 0x08bfbc9ULL },
+    { 0x0973930ULL, 0x12633c1ULL, 0x01939d2ULL, 0x10798c9ULL },
+    { 0x0973937ULL, 0x136b7c1ULL, 0x1d939d2ULL, 0x107dad9ULL },
+    { 0x0973929ULL, 0x13633e0ULL, 0x12939d2ULL, 0x00f98d9ULL },
+    { 0x097392eULL, 0x126b7e0ULL, 0x0e939d2ULL, 0x00fdac9ULL },
+    { 0x09739d0ULL, 0x1073bc1ULL, 0x01739d2ULL, 0x107b9c1ULL },
+    { 0x09739d7ULL, 0x117bfc1ULL, 0x1d739d2ULL, 0x107fbd1ULL },
+    { 0x09739c9ULL, 0x1173be0ULL, 0x12739d2ULL, 0x00fb9d1ULL },
+    { 0x09739ceULL, 0x107bfe0ULL, 0x0e739d2ULL, 0x00ffbc1ULL },
+    { 0x0e84210ULL, 0x008420fULL, 0x010842eULL, 0x1e08420ULL },
+    { 0x0e84217ULL, 0x018c60fULL, 0x1d0842eULL, 0x1e0c630ULL },
+    { 0x0e84209ULL, 0x018422eULL, 0x120842eULL, 0x0e88430ULL },
+    { 0x0e8420eULL, 0x008c62eULL, 0x0e0842eULL, 0x0e8c620ULL },
+    { 0x0e842f0ULL, 0x0294a0fULL, 0x01e842eULL, 0x1e0a528ULL },
+    { 0x0e842f7ULL, 0x039ce0fULL, 0x1de842eULL, 0x1e0e738ULL },
+    { 0x0e842e9ULL, 0x0394a2eULL, 0x12e842eULL, 0x0e8a538ULL },
+    { 0x0e842eeULL, 0x029ce2eULL, 0x0ee842eULL, 0x0e8e728ULL },
+    { 0x0e84130ULL, 0x028424dULL, 0x019042eULL, 0x1648428ULL },
+    { 0x0e84137ULL, 0x038c64dULL, 0x1d9042eULL, 0x164c638ULL },
+    { 0x0e84129ULL, 0x038426cULL, 0x129042eULL, 0x06c8438ULL },
+    { 0x0e8412eULL, 0x028c66cULL, 0x0e9042eULL, 0x06cc628ULL },
+    { 0x0e841d0ULL, 0x0094a4dULL, 0x017042eULL, 0x164a520ULL },
+    { 0x0e841d7ULL, 0x019ce4dULL, 0x1d7042eULL, 0x164e730ULL },
+    { 0x0e841c9ULL, 0x0194a6cULL, 0x127042eULL, 0x06ca530ULL },
+    { 0x0e841ceULL, 0x009ce6cULL, 0x0e7042eULL, 0x06ce720ULL },
+    { 0x0e85e10ULL, 0x04a520fULL, 0x010f42eULL, 0x1e094a4ULL },
+    { 0x0e85e17ULL, 0x05ad60fULL, 0x1d0f42eULL, 0x1e0d6b4ULL },
+    { 0x0e85e09ULL, 0x05a522eULL, 0x120f42eULL, 0x0e894b4ULL },
+    { 0x0e85e0eULL, 0x04ad62eULL, 0x0e0f42eULL, 0x0e8d6a4ULL },
+    { 0x0e85ef0ULL, 0x06b5a0fULL, 0x01ef42eULL, 0x1e0b5acULL },
+    { 0x0e85ef7ULL, 0x07bde0fULL, 0x1def42eULL, 0x1e0f7bcULL },
+    { 0x0e85ee9ULL, 0x07b5a2eULL, 0x12ef42eULL, 0x0e8b5bcULL },
+    { 0x0e85eeeULL, 0x06bde2eULL, 0x0eef42eULL, 0x0e8f7acULL },
+    { 0x0e85d30ULL, 0x06a524dULL, 0x019742eULL, 0x16494acULL },
+    { 0x0e85d37ULL, 0x07ad64dULL, 0x1d9742eULL, 0x164d6bcULL },
+    { 0x0e85d29ULL, 0x07a526cULL, 0x129742eULL, 0x06c94bcULL },
+    { 0x0e85d2eULL, 0x06ad66cULL, 0x0e9742eULL, 0x06cd6acULL },
+    { 0x0e85dd0ULL, 0x04b5a4dULL, 0x017742eULL, 0x164b5a4ULL },
+    { 0x0e85dd7ULL, 0x05bde4dULL, 0x1d7742eULL, 0x164f7b4ULL },
+    { 0x0e85dc9ULL, 0x05b5a6cULL, 0x127742eULL, 0x06cb5b4ULL },
+    { 0x0e85dceULL, 0x04bde6cULL, 0x0e7742eULL, 0x06cf7a4ULL },
+    { 0x0e82610ULL, 0x048428bULL, 0x010c82eULL, 0x1a28424ULL },
+    { 0x0e82617ULL, 0x058c68bULL, 0x1d0c82eULL, 0x1a2c634ULL },
+    { 0x0e82609ULL, 0x05842aaULL, 0x120c82eULL, 0x0aa8434ULL },
+    { 0x0e8260eULL, 0x048c6aaULL, 0x0e0c82eULL, 0x0aac624ULL },
+    { 0x0e826f0ULL, 0x0694a8bULL, 0x01ec82eULL, 0x1a2a52cULL },
+    { 0x0e826f7ULL, 0x079ce8bULL, 0x1dec82eULL, 0x1a2e73cULL },
+    { 0x0e826e9ULL, 0x0794aaaULL, 0x12ec82eULL, 0x0aaa53cULL },
+    { 0x0e826eeULL, 0x069ceaaULL, 0x0eec82eULL, 0x0aae72cULL },
+    { 0x0e82530ULL, 0x06842c9ULL, 0x019482eULL, 0x126842cULL },
+    { 0x0e82537ULL, 0x078c6c9ULL, 0x1d9482eULL, 0x126c63cULL },
+    { 0x0e82529ULL, 0x07842e8ULL, 0x129482eULL, 0x02e843cULL },
+    { 0x0e8252eULL, 0x068c6e8ULL, 0x0e9482eULL, 0x02ec62cULL },
+    { 0x0e825d0ULL, 0x0494ac9ULL, 0x017482eULL, 0x126a524ULL },
+    { 0x0e825d7ULL, 0x059cec9ULL, 0x1d7482eULL, 0x126e734ULL },
+    { 0x0e825c9ULL, 0x0594ae8ULL, 0x127482eULL, 0x02ea534ULL },
+    { 0x0e825ceULL, 0x049cee8ULL, 0x0e7482eULL, 0x02ee724ULL },
+    { 0x0e83a10ULL, 0x00a528bULL, 0x010b82eULL, 0x1a294a0ULL },
+    { 0x0e83a17ULL, 0x01ad68bULL, 0x1d0b82eULL, 0x1a2d6b0ULL },
+    { 0x0e83a09ULL, 0x01a52aaULL, 0x120b82eULL, 0x0aa94b0ULL },
+    { 0x0e83a0eULL, 0x00ad6aaULL, 0x0e0b82eULL, 0x0aad6a0ULL },
+    { 0x0e83af0ULL, 0x02b5a8bULL, 0x01eb82eULL, 0x1a2b5a8ULL },
+    { 0x0e83af7ULL, 0x03bde8bULL, 0x1deb82eULL, 0x1a2f7b8ULL },
+    { 0x0e83ae9ULL, 0x03b5aaaULL, 0x12eb82eULL, 0x0aab5b8ULL },
+    { 0x0e83aeeULL, 0x02bdeaaULL, 0x0eeb82eULL, 0x0aaf7a8ULL },
+    { 0x0e83930ULL, 0x02a52c9ULL, 0x019382eULL, 0x12694a8ULL },
+    { 0x0e83937ULL, 0x03ad6c9ULL, 0x1d9382eULL, 0x126d6b8ULL },
+    { 0x0e83929ULL, 0x03a52e8ULL, 0x129382eULL, 0x02e94b8ULL },
+    { 0x0e8392eULL, 0x02ad6e8ULL, 0x0e9382eULL, 0x02ed6a8ULL },
+    { 0x0e839d0ULL, 0x00b5ac9ULL, 0x017382eULL, 0x126b5a0ULL },
+    { 0x0e839d7ULL, 0x01bdec9ULL, 0x1d7382eULL, 0x126f7b0ULL },
+    { 0x0e839c9ULL, 0x01b5ae8ULL, 0x127382eULL, 0x02eb5b0ULL },
+    { 0x0e839ceULL, 0x00bdee8ULL, 0x0e7382eULL, 0x02ef7a0ULL },
+    { 0x0ebc210ULL, 0x08c620fULL, 0x01087aeULL, 0x1e08c62ULL },
+    { 0x0ebc217ULL, 0x09ce60fULL, 0x1d087aeULL, 0x1e0ce72ULL },
+    { 0x0ebc209ULL, 0x09c622eULL, 0x12087aeULL, 0x0e88c72ULL },
+    { 0x0ebc20eULL, 0x08ce62eULL, 0x0e087aeULL, 0x0e8ce62ULL },
+    { 0x0ebc2f0ULL, 0x0ad6a0fULL, 0x01e87aeULL, 0x1e0ad6aULL },
+    { 0x0ebc2f7ULL, 0x0bdee0fULL, 0x1de87aeULL, 0x1e0ef7aULL },
+    { 0x0ebc2e9ULL, 0x0bd6a2eULL, 0x12e87aeULL, 0x0e8ad7aULL },
+    { 0x0ebc2eeULL, 0x0adee2eULL, 0x0ee87aeULL, 0x0e8ef6aULL },
+    { 0x0ebc130ULL, 0x0ac624dULL, 0x01907aeULL, 0x1648c6aULL },
+    { 0x0ebc137ULL, 0x0bce64dULL, 0x1d907aeULL, 0x164ce7aULL },
+    { 0x0ebc129ULL, 0x0bc626cULL, 0x12907aeULL, 0x06c8c7aULL },
+    { 0x0ebc12eULL, 0x0ace66cULL, 0x0e907aeULL, 0x06cce6aULL },
+    { 0x0ebc1d0ULL, 0x08d6a4dULL, 0x01707aeULL, 0x164ad62ULL },
+    { 0x0ebc1d7ULL, 0x09dee4dULL, 0x1d707aeULL, 0x164ef72ULL },
+    { 0x0ebc1c9ULL, 0x09d6a6cULL, 0x12707aeULL, 0x06cad72ULL },
+    { 0x0ebc1ceULL, 0x08dee6cULL, 0x0e707aeULL, 0x06cef62ULL },
+    { 0x0ebde10ULL, 0x0ce720fULL, 0x010f7aeULL, 0x1e09ce6ULL },
+    { 0x0ebde17ULL, 0x0def60fULL, 0x1d0f7aeULL, 0x1e0def6ULL },
+    { 0x0ebde09ULL, 0x0de722eULL, 0x120f7aeULL, 0x0e89cf6ULL },
+    { 0x0ebde0eULL, 0x0cef62eULL, 0x0e0f7aeULL, 0x0e8dee6ULL },
+    { 0x0ebdef0ULL, 0x0ef7a0fULL, 0x01ef7aeULL, 0x1e0bdeeULL },
+    { 0x0ebdef7ULL, 0x0fffe0fULL, 0x1def7aeULL, 0x1e0fffeULL },
+    { 0x0ebdee9ULL, 0x0ff7a2eULL, 0x12ef7aeULL, 0x0e8bdfeULL },
+    { 0x0ebdeeeULL, 0x0effe2eULL, 0x0eef7aeULL, 0x0e8ffeeULL },
+    { 0x0ebdd30ULL, 0x0ee724dULL, 0x01977aeULL, 0x1649ceeULL },
+    { 0x0ebdd37ULL, 0x0fef64dULL, 0x1d977aeULL, 0x164defeULL },
+    { 0x0ebdd29ULL, 0x0fe726cULL, 0x12977aeULL, 0x06c9cfeULL },
+    { 0x0ebdd2eULL, 0x0eef66cULL, 0x0e977aeULL, 0x06cdeeeULL },
+    { 0x0ebddd0ULL, 0x0cf7a4dULL, 0x01777aeULL, 0x164bde6ULL },
+    { 0x0ebddd7ULL, 0x0dffe4dULL, 0x1d777aeULL, 0x164fff6ULL },
+    { 0x0ebddc9ULL, 0x0df7a6cULL, 0x12777aeULL, 0x06cbdf6ULL },
+    { 0x0ebddceULL, 0x0cffe6cULL, 0x0e777aeULL, 0x06cffe6ULL },
+    { 0x0eba610ULL, 0x0cc628bULL, 0x010cbaeULL, 0x1a28c66ULL },
+    { 0x0eba617ULL, 0x0dce68bULL, 0x1d0cbaeULL, 0x1a2ce76ULL },
+    { 0x0eba609ULL, 0x0dc62aaULL, 0x120cbaeULL, 0x0aa8c76ULL },
+    { 0x0eba60eULL, 0x0cce6aaULL, 0x0e0cbaeULL, 0x0aace66ULL },
+    { 0x0eba6f0ULL, 0x0ed6a8bULL, 0x01ecbaeULL, 0x1a2ad6eULL },
+    { 0x0eba6f7ULL, 0x0fdee8bULL, 0x1decbaeULL, 0x1a2ef7eULL },
+    { 0x0eba6e9ULL, 0x0fd6aaaULL, 0x12ecbaeULL, 0x0aaad7eULL },
+    { 0x0eba6eeULL, 0x0edeeaaULL, 0x0eecbaeULL, 0x0aaef6eULL },
+    { 0x0eba530ULL, 0x0ec62c9ULL, 0x0194baeULL, 0x1268c6eULL },
+    { 0x0eba537ULL, 0x0fce6c9ULL, 0x1d94baeULL, 0x126ce7eULL },
+    { 0x0eba529ULL, 0x0fc62e8ULL, 0x1294baeULL, 0x02e8c7eULL },
+    { 0x0eba52eULL, 0x0ece6e8ULL, 0x0e94baeULL, 0x02ece6eULL },
+    { 0x0eba5d0ULL, 0x0cd6ac9ULL, 0x0174baeULL, 0x126ad66ULL },
+    { 0x0eba5d7ULL, 0x0ddeec9ULL, 0x1d74baeULL, 0x126ef76ULL },
+    { 0x0eba5c9ULL, 0x0dd6ae8ULL, 0x1274baeULL, 0x02ead76ULL },
+    { 0x0eba5ceULL, 0x0cdeee8ULL, 0x0e74baeULL, 0x02eef66ULL },
+    { 0x0ebba10ULL, 0x08e728bULL, 0x010bbaeULL, 0x1a29ce2ULL },
+    { 0x0ebba17ULL, 0x09ef68bULL, 0x1d0bbaeULL, 0x1a2def2ULL },
+    { 0x0ebba09ULL, 0x09e72aaULL, 0x120bbaeULL, 0x0aa9cf2ULL },
+    { 0x0ebba0eULL, 0x08ef6aaULL, 0x0e0bbaeULL, 0x0aadee2ULL },
+    { 0x0ebbaf0ULL, 0x0af7a8bULL, 0x01ebbaeULL, 0x1a2bdeaULL },
+    { 0x0ebbaf7ULL, 0x0bffe8bULL, 0x1debbaeULL, 0x1a2fffaULL },
+    { 0x0ebbae9ULL, 0x0bf7aaaULL, 0x12ebbaeULL, 0x0aabdfaULL },
+    { 0x0ebbaeeULL, 0x0affeaaULL, 0x0eebbaeULL, 0x0aaffeaULL },
+    { 0x0ebb930ULL, 0x0ae72c9ULL, 0x0193baeULL, 0x1269ceaULL },
+    { 0x0ebb937ULL, 0x0bef6c9ULL, 0x1d93baeULL, 0x126defaULL },
+    { 0x0ebb929ULL, 0x0be72e8ULL, 0x1293baeULL, 0x02e9cfaULL },
+    { 0x0ebb92eULL, 0x0aef6e8ULL, 0x0e93baeULL, 0x02edeeaULL },
+    { 0x0ebb9d0ULL, 0x08f7ac9ULL, 0x0173baeULL, 0x126bde2ULL },
+    { 0x0ebb9d7ULL, 0x09ffec9ULL, 0x1d73baeULL, 0x126fff2ULL },
+    { 0x0ebb9c9ULL, 0x09f7ae8ULL, 0x1273baeULL, 0x02ebdf2ULL },
+    { 0x0ebb9ceULL, 0x08ffee8ULL, 0x0e73baeULL, 0x02effe2ULL },
+    { 0x0e4c210ULL, 0x0884307ULL, 0x010864eULL, 0x1c18422ULL },
+    { 0x0e4c217ULL, 0x098c707ULL, 0x1d0864eULL, 0x1c1c632ULL },
+    { 0x0e4c209ULL, 0x0984326ULL, 0x120864eULL, 0x0c98432ULL },
+    { 0x0e4c20eULL, 0x088c726ULL, 0x0e0864eULL, 0x0c9c622ULL },
+    { 0x0e4c2f0ULL, 0x0a94b07ULL, 0x01e864eULL, 0x1c1a52aULL },
+    { 0x0e4c2f7ULL, 0x0b9cf07ULL, 0x1de864eULL, 0x1c1e73aULL },
+    { 0x0e4c2e9ULL, 0x0b94b26ULL, 0x12e864eULL, 0x0c9a53aULL },
+    { 0x0e4c2eeULL, 0x0a9cf26ULL, 0x0ee864eULL, 0x0c9e72aULL },
+    { 0x0e4c130ULL, 0x0a84345ULL, 0x019064eULL, 0x145842aULL },
+    { 0x0e4c137ULL, 0x0b8c745ULL, 0x1d9064eULL, 0x145c63aULL },
+    { 0x0e4c129ULL, 0x0b84364ULL, 0x129064eULL, 0x04d843aULL },
+    { 0x0e4c12eULL, 0x0a8c764ULL, 0x0e9064eULL, 0x04dc62aULL },
+    { 0x0e4c1d0ULL, 0x0894b45ULL, 0x017064eULL, 0x145a522ULL },
+    { 0x0e4c1d7ULL, 0x099cf45ULL, 0x1d7064eULL, 0x145e732ULL },
+    { 0x0e4c1c9ULL, 0x0994b64ULL, 0x127064eULL, 0x04da532ULL },
+    { 0x0e4c1ceULL, 0x089cf64ULL, 0x0e7064eULL, 0x04de722ULL },
+    { 0x0e4de10ULL, 0x0ca5307ULL, 0x010f64eULL, 0x1c194a6ULL },
+    { 0x0e4de17ULL, 0x0dad707ULL, 0x1d0f64eULL, 0x1c1d6b6ULL },
+    { 0x0e4de09ULL, 0x0da5326ULL, 0x120f64eULL, 0x0c994b6ULL },
+    { 0x0e4de0eULL, 0x0cad726ULL, 0x0e0f64eULL, 0x0c9d6a6ULL },
+    { 0x0e4def0ULL, 0x0eb5b07ULL, 0x01ef64eULL, 0x1c1b5aeULL },
+    { 0x0e4def7ULL, 0x0fbdf07ULL, 0x1def64eULL, 0x1c1f7beULL },
+    { 0x0e4dee9ULL, 0x0fb5b26ULL, 0x12ef64eULL, 0x0c9b5beULL },
+    { 0x0e4deeeULL, 0x0ebdf26ULL, 0x0eef64eULL, 0x0c9f7aeULL },
+    { 0x0e4dd30ULL, 0x0ea5345ULL, 0x019764eULL, 0x14594aeULL },
+    { 0x0e4dd37ULL, 0x0fad745ULL, 0x1d9764eULL, 0x145d6beULL },
+    { 0x0e4dd29ULL, 0x0fa5364ULL, 0x129764eULL, 0x04d94beULL },
+    { 0x0e4dd2eULL, 0x0ead764ULL, 0x0e9764eULL, 0x04dd6aeULL },
+    { 0x0e4ddd0ULL, 0x0cb5b45ULL, 0x017764eULL, 0x145b5a6ULL },
+    { 0x0e4ddd7ULL, 0x0dbdf45ULL, 0x1d7764eULL, 0x145f7b6ULL },
+    { 0x0e4ddc9ULL, 0x0db5b64ULL, 0x127764eULL, 0x04db5b6ULL },
+    { 0x0e4ddceULL, 0x0cbdf64ULL, 0x0e7764eULL, 0x04df7a6ULL },
+    { 0x0e4a610ULL, 0x0c84383ULL, 0x010ca4eULL, 0x1838426ULL },
+    { 0x0e4a617ULL, 0x0d8c783ULL, 0x1d0ca4eULL, 0x183c636ULL },
+    { 0x0e4a609ULL, 0x0d843a2ULL, 0x120ca4eULL, 0x08b8436ULL },
+    { 0x0e4a60eULL, 0x0c8c7a2ULL, 0x0e0ca4eULL, 0x08bc626ULL },
+    { 0x0e4a6f0ULL, 0x0e94b83ULL, 0x01eca4eULL, 0x183a52eULL },
+    { 0x0e4a6f7ULL, 0x0f9cf83ULL, 0x1deca4eULL, 0x183e73eULL },
+    { 0x0e4a6e9ULL, 0x0f94ba2ULL, 0x12eca4eULL, 0x08ba53eULL },
+    { 0x0e4a6eeULL, 0x0e9cfa2ULL, 0x0eeca4eULL, 0x08be72eULL },
+    { 0x0e4a530ULL, 0x0e843c1ULL, 0x0194a4eULL, 0x107842eULL },
+    { 0x0e4a537ULL, 0x0f8c7c1ULL, 0x1d94a4eULL, 0x107c63eULL },
+    { 0x0e4a529ULL, 0x0f843e0ULL, 0x1294a4eULL, 0x00f843eULL },
+    { 0x0e4a52eULL, 0x0e8c7e0ULL, 0x0e94a4eULL, 0x00fc62eULL },
+    { 0x0e4a5d0ULL, 0x0c94bc1ULL, 0x0174a4eULL, 0x107a526ULL },
+    { 0x0e4a5d7ULL, 0x0d9cfc1ULL, 0x1d74a4eULL, 0x107e736ULL },
+    { 0x0e4a5c9ULL, 0x0d94be0ULL, 0x1274a4eULL, 0x00fa536ULL },
+    { 0x0e4a5ceULL, 0x0c9cfe0ULL, 0x0e74a4eULL, 0x00fe726ULL },
+    { 0x0e4ba10ULL, 0x08a5383ULL, 0x010ba4eULL, 0x18394a2ULL },
+    { 0x0e4ba17ULL, 0x09ad783ULL, 0x1d0ba4eULL, 0x183d6b2ULL },
+    { 0x0e4ba09ULL, 0x09a53a2ULL, 0x120ba4eULL, 0x08b94b2ULL },
+    { 0x0e4ba0eULL, 0x08ad7a2ULL, 0x0e0ba4eULL, 0x08bd6a2ULL },
+    { 0x0e4baf0ULL, 0x0ab5b83ULL, 0x01eba4eULL, 0x183b5aaULL },
+    { 0x0e4baf7ULL, 0x0bbdf83ULL, 0x1deba4eULL, 0x183f7baULL },
+    { 0x0e4bae9ULL, 0x0bb5ba2ULL, 0x12eba4eULL, 0x08bb5baULL },
+    { 0x0e4baeeULL, 0x0abdfa2ULL, 0x0eeba4eULL, 0x08bf7aaULL },
+    { 0x0e4b930ULL, 0x0aa53c1ULL, 0x0193a4eULL, 0x10794aaULL },
+    { 0x0e4b937ULL, 0x0bad7c1ULL, 0x1d93a4eULL, 0x107d6baULL },
+    { 0x0e4b929ULL, 0x0ba53e0ULL, 0x1293a4eULL, 0x00f94baULL },
+    { 0x0e4b92eULL, 0x0aad7e0ULL, 0x0e93a4eULL, 0x00fd6aaULL },
+    { 0x0e4b9d0ULL, 0x08b5bc1ULL, 0x0173a4eULL, 0x107b5a2ULL },
+    { 0x0e4b9d7ULL, 0x09bdfc1ULL, 0x1d73a4eULL, 0x107f7b2ULL },
+    { 0x0e4b9c9ULL, 0x09b5be0ULL, 0x1273a4eULL, 0x00fb5b2ULL },
+    { 0x0e4b9ceULL, 0x08bdfe0ULL, 0x0e73a4eULL, 0x00ff7a2ULL },
+    { 0x0e74210ULL, 0x00c6307ULL, 0x01085ceULL, 0x1c18c60ULL },
+    { 0x0e74217ULL, 0x01ce707ULL, 0x1d085ceULL, 0x1c1ce70ULL },
+    { 0x0e74209ULL, 0x01c6326ULL, 0x12085ceULL, 0x0c98c70ULL },
+    { 0x0e7420eULL, 0x00ce726ULL, 0x0e085ceULL, 0x0c9ce60ULL },
+    { 0x0e742f0ULL, 0x02d6b07ULL, 0x01e85ceULL, 0x1c1ad68ULL },
+    { 0x0e742f7ULL, 0x03def07ULL, 0x1de85ceULL, 0x1c1ef78ULL },
+    { 0x0e742e9ULL, 0x03d6b26ULL, 0x12e85ceULL, 0x0c9ad78ULL },
+    { 0x0e742eeULL, 0x02def26ULL, 0x0ee85ceULL, 0x0c9ef68ULL },
+    { 0x0e74130ULL, 0x02c6345ULL, 0x01905ceULL, 0x1458c68ULL },
+    { 0x0e74137ULL, 0x03ce745ULL, 0x1d905ceULL, 0x145ce78ULL },
+    { 0x0e74129ULL, 0x03c6364ULL, 0x12905ceULL, 0x04d8c78ULL },
+    { 0x0e7412eULL, 0x02ce764ULL, 0x0e905ceULL, 0x04dce68ULL },
+    { 0x0e741d0ULL, 0x00d6b45ULL, 0x01705ceULL, 0x145ad60ULL },
+    { 0x0e741d7ULL, 0x01def45ULL, 0x1d705ceULL, 0x145ef70ULL },
+    { 0x0e741c9ULL, 0x01d6b64ULL, 0x12705ceULL, 0x04dad70ULL },
+    { 0x0e741ceULL, 0x00def64ULL, 0x0e705ceULL, 0x04def60ULL },
+    { 0x0e75e10ULL, 0x04e7307ULL, 0x010f5ceULL, 0x1c19ce4ULL },
+    { 0x0e75e17ULL, 0x05ef707ULL, 0x1d0f5ceULL, 0x1c1def4ULL },
+    { 0x0e75e09ULL, 0x05e7326ULL, 0x120f5ceULL, 0x0c99cf4ULL },
+    { 0x0e75e0eULL, 0x04ef726ULL, 0x0e0f5ceULL, 0x0c9dee4ULL },
+    { 0x0e75ef0ULL, 0x06f7b07ULL, 0x01ef5ceULL, 0x1c1bdecULL },
+    { 0x0e75ef7ULL, 0x07fff07ULL, 0x1def5ceULL, 0x1c1fffcULL },
+    { 0x0e75ee9ULL, 0x07f7b26ULL, 0x12ef5ceULL, 0x0c9bdfcULL },
+    { 0x0e75eeeULL, 0x06fff26ULL, 0x0eef5ceULL, 0x0c9ffecULL },
+    { 0x0e75d30ULL, 0x06e7345ULL, 0x01975ceULL, 0x1459cecULL },
+    { 0x0e75d37ULL, 0x07ef745ULL, 0x1d975ceULL, 0x145defcULL },
+    { 0x0e75d29ULL, 0x07e7364ULL, 0x12975ceULL, 0x04d9cfcULL },
+    { 0x0e75d2eULL, 0x06ef764ULL, 0x0e975ceULL, 0x04ddeecULL },
+    { 0x0e75dd0ULL, 0x04f7b45ULL, 0x01775ceULL, 0x145bde4ULL },
+    { 0x0e75dd7ULL, 0x05fff45ULL, 0x1d775ceULL, 0x145fff4ULL },
+    { 0x0e75dc9ULL, 0x05f7b64ULL, 0x12775ceULL, 0x04dbdf4ULL },
+    { 0x0e75dceULL, 0x04fff64ULL, 0x0e775ceULL, 0x04dffe4ULL },
+    { 0x0e72610ULL, 0x04c6383ULL, 0x010c9ceULL, 0x1838c64ULL },
+    { 0x0e72617ULL, 0x05ce783ULL, 0x1d0c9ceULL, 0x183ce74ULL },
+    { 0x0e72609ULL, 0x05c63a2ULL, 0x120c9ceULL, 0x08b8c74ULL },
+    { 0x0e7260eULL, 0x04ce7a2ULL, 0x0e0c9ceULL, 0x08bce64ULL },
+    { 0x0e726f0ULL, 0x06d6b83ULL, 0x01ec9ceULL, 0x183ad6cULL },
+    { 0x0e726f7ULL, 0x07def83ULL, 0x1dec9ceULL, 0x183ef7cULL },
+    { 0x0e726e9ULL, 0x07d6ba2ULL, 0x12ec9ceULL, 0x08bad7cULL },
+    { 0x0e726eeULL, 0x06defa2ULL, 0x0eec9ceULL, 0x08bef6cULL },
+    { 0x0e72530ULL, 0x06c63c1ULL, 0x01949ceULL, 0x1078c6cULL },
+    { 0x0e72537ULL, 0x07ce7c1ULL, 0x1d949ceULL, 0x107ce7cULL },
+    { 0x0e72529ULL, 0x07c63e0ULL, 0x12949ceULL, 0x00f8c7cULL },
+    { 0x0e7252eULL, 0x06ce7e0ULL, 0x0e949ceULL, 0x00fce6cULL },
+    { 0x0e725d0ULL, 0x04d6bc1ULL, 0x01749ceULL, 0x107ad64ULL },
+    { 0x0e725d7ULL, 0x05defc1ULL, 0x1d749ceULL, 0x107ef74ULL },
+    { 0x0e725c9ULL, 0x05d6be0ULL, 0x12749ceULL, 0x00fad74ULL },
+    { 0x0e725ceULL, 0x04defe0ULL, 0x0e749ceULL, 0x00fef64ULL },
+    { 0x0e73a10ULL, 0x00e7383ULL, 0x010b9ceULL, 0x1839ce0ULL },
+    { 0x0e73a17ULL, 0x01ef783ULL, 0x1d0b9ceULL, 0x183def0ULL },
+    { 0x0e73a09ULL, 0x01e73a2ULL, 0x120b9ceULL, 0x08b9cf0ULL },
+    { 0x0e73a0eULL, 0x00ef7a2ULL, 0x0e0b9ceULL, 0x08bdee0ULL },
+    { 0x0e73af0ULL, 0x02f7b83ULL, 0x01eb9ceULL, 0x183bde8ULL },
+    { 0x0e73af7ULL, 0x03fff83ULL, 0x1deb9ceULL, 0x183fff8ULL },
+    { 0x0e73ae9ULL, 0x03f7ba2ULL, 0x12eb9ceULL, 0x08bbdf8ULL },
+    { 0x0e73aeeULL, 0x02fffa2ULL, 0x0eeb9ceULL, 0x08bffe8ULL },
+    { 0x0e73930ULL, 0x02e73c1ULL, 0x01939ceULL, 0x1079ce8ULL },
+    { 0x0e73937ULL, 0x03ef7c1ULL, 0x1d939ceULL, 0x107def8ULL },
+    { 0x0e73929ULL, 0x03e73e0ULL, 0x12939ceULL, 0x00f9cf8ULL },
+    { 0x0e7392eULL, 0x02ef7e0ULL, 0x0e939ceULL, 0x00fdee8ULL },
+    { 0x0e739d0ULL, 0x00f7bc1ULL, 0x01739ceULL, 0x107bde0ULL },
+    { 0x0e739d7ULL, 0x01fffc1ULL, 0x1d739ceULL, 0x107fff0ULL },
+    { 0x0e739c9ULL, 0x01f7be0ULL, 0x12739ceULL, 0x00fbdf0ULL },
+    { 0x0e739ceULL, 0x00fffe0ULL, 0x0e739ceULL, 0x00fffe0ULL },
+};
 
-static unsigned char DICT_ARUCO_BYTES[][4][4] = {
-    { { 132, 33, 8, 0 },
-      { 0, 0, 15, 1 },
-      { 8, 66, 16, 1 },
-      { 248, 0, 0, 0 }, },
-    { { 132, 33, 11, 1 },
-      { 8, 66, 15, 1 },
-      { 232, 66, 16, 1 },
-      { 248, 33, 8, 0 }, },
-    { { 132, 33, 4, 1 },
-      { 8, 0, 31, 0 },
-      { 144, 66, 16, 1 },
-      { 124, 0, 8, 0 }, },
-    { { 132, 33, 7, 0 },
-      { 0, 66, 31, 0 },
-      { 112, 66, 16, 1 },
-      { 124, 33, 0, 0 }, },
-    { { 132, 33, 120, 0 },
-      { 16, 132, 15, 1 },
-      { 15, 66, 16, 1 },
-      { 248, 16, 132, 0 }, },
-    { { 132, 33, 123, 1 },
-      { 24, 198, 15, 1 },
-      { 239, 66, 16, 1 },
-      { 248, 49, 140, 0 }, },
-    { { 132, 33, 116, 1 },
-      { 24, 132, 31, 0 },
-      { 151, 66, 16, 1 },
-      { 124, 16, 140, 0 }, },
-    { { 132, 33, 119, 0 },
-      { 16, 198, 31, 0 },
-      { 119, 66, 16, 1 },
-      { 124, 49, 132, 0 }, },
-    { { 132, 32, 152, 0 },
-      { 16, 0, 46, 1 },
-      { 12, 130, 16, 1 },
-      { 186, 0, 4, 0 }, },
-    { { 132, 32, 155, 1 },
-      { 24, 66, 46, 1 },
-      { 236, 130, 16, 1 },
-      { 186, 33, 12, 0 }, },
-    { { 132, 32, 148, 1 },
-      { 24, 0, 62, 0 },
-      { 148, 130, 16, 1 },
-      { 62, 0, 12, 0 }, },
-    { { 132, 32, 151, 0 },
-      { 16, 66, 62, 0 },
-      { 116, 130, 16, 1 },
-      { 62, 33, 4, 0 }, },
-    { { 132, 32, 232, 0 },
-      { 0, 132, 46, 1 },
-      { 11, 130, 16, 1 },
-      { 186, 16, 128, 0 }, },
-    { { 132, 32, 235, 1 },
-      { 8, 198, 46, 1 },
-      { 235, 130, 16, 1 },
-      { 186, 49, 136, 0 }, },
-    { { 132, 32, 228, 1 },
-      { 8, 132, 62, 0 },
-      { 147, 130, 16, 1 },
-      { 62, 16, 136, 0 }, },
-    { { 132, 32, 231, 0 },
-      { 0, 198, 62, 0 },
-      { 115, 130, 16, 1 },
-      { 62, 49, 128, 0 }, },
-    { { 132, 47, 8, 0 },
-      { 33, 8, 15, 1 },
-      { 8, 122, 16, 1 },
-      { 248, 8, 66, 0 }, },
-    { { 132, 47, 11, 1 },
-      { 41, 74, 15, 1 },
-      { 232, 122, 16, 1 },
-      { 248, 41, 74, 0 }, },
-    { { 132, 47, 4, 1 },
-      { 41, 8, 31, 0 },
-      { 144, 122, 16, 1 },
-      { 124, 8, 74, 0 }, },
-    { { 132, 47, 7, 0 },
-      { 33, 74, 31, 0 },
-      { 112, 122, 16, 1 },
-      { 124, 41, 66, 0 }, },
-    { { 132, 47, 120, 0 },
-      { 49, 140, 15, 1 },
-      { 15, 122, 16, 1 },
-      { 248, 24, 198, 0 }, },
-    { { 132, 47, 123, 1 },
-      { 57, 206, 15, 1 },
-      { 239, 122, 16, 1 },
-      { 248, 57, 206, 0 }, },
-    { { 132, 47, 116, 1 },
-      { 57, 140, 31, 0 },
-      { 151, 122, 16, 1 },
-      { 124, 24, 206, 0 }, },
-    { { 132, 47, 119, 0 },
-      { 49, 206, 31, 0 },
-      { 119, 122, 16, 1 },
-      { 124, 57, 198, 0 }, },
-    { { 132, 46, 152, 0 },
-      { 49, 8, 46, 1 },
-      { 12, 186, 16, 1 },
-      { 186, 8, 70, 0 }, },
-    { { 132, 46, 155, 1 },
-      { 57, 74, 46, 1 },
-      { 236, 186, 16, 1 },
-      { 186, 41, 78, 0 }, },
-    { { 132, 46, 148, 1 },
-      { 57, 8, 62, 0 },
-      { 148, 186, 16, 1 },
-      { 62, 8, 78, 0 }, },
-    { { 132, 46, 151, 0 },
-      { 49, 74, 62, 0 },
-      { 116, 186, 16, 1 },
-      { 62, 41, 70, 0 }, },
-    { { 132, 46, 232, 0 },
-      { 33, 140, 46, 1 },
-      { 11, 186, 16, 1 },
-      { 186, 24, 194, 0 }, },
-    { { 132, 46, 235, 1 },
-      { 41, 206, 46, 1 },
-      { 235, 186, 16, 1 },
-      { 186, 57, 202, 0 }, },
-    { { 132, 46, 228, 1 },
-      { 41, 140, 62, 0 },
-      { 147, 186, 16, 1 },
-      { 62, 24, 202, 0 }, },
-    { { 132, 46, 231, 0 },
-      { 33, 206, 62, 0 },
-      { 115, 186, 16, 1 },
-      { 62, 57, 194, 0 }, },
-    { { 132, 19, 8, 0 },
-      { 32, 0, 77, 1 },
-      { 8, 100, 16, 1 },
-      { 217, 0, 2, 0 }, },
-    { { 132, 19, 11, 1 },
-      { 40, 66, 77, 1 },
-      { 232, 100, 16, 1 },
-      { 217, 33, 10, 0 }, },
-    { { 132, 19, 4, 1 },
-      { 40, 0, 93, 0 },
-      { 144, 100, 16, 1 },
-      { 93, 0, 10, 0 }, },
-    { { 132, 19, 7, 0 },
-      { 32, 66, 93, 0 },
-      { 112, 100, 16, 1 },
-      { 93, 33, 2, 0 }, },
-    { { 132, 19, 120, 0 },
-      { 48, 132, 77, 1 },
-      { 15, 100, 16, 1 },
-      { 217, 16, 134, 0 }, },
-    { { 132, 19, 123, 1 },
-      { 56, 198, 77, 1 },
-      { 239, 100, 16, 1 },
-      { 217, 49, 142, 0 }, },
-    { { 132, 19, 116, 1 },
-      { 56, 132, 93, 0 },
-      { 151, 100, 16, 1 },
-      { 93, 16, 142, 0 }, },
-    { { 132, 19, 119, 0 },
-      { 48, 198, 93, 0 },
-      { 119, 100, 16, 1 },
-      { 93, 49, 134, 0 }, },
-    { { 132, 18, 152, 0 },
-      { 48, 0, 108, 1 },
-      { 12, 164, 16, 1 },
-      { 155, 0, 6, 0 }, },
-    { { 132, 18, 155, 1 },
-      { 56, 66, 108, 1 },
-      { 236, 164, 16, 1 },
-      { 155, 33, 14, 0 }, },
-    { { 132, 18, 148, 1 },
-      { 56, 0, 124, 0 },
-      { 148, 164, 16, 1 },
-      { 31, 0, 14, 0 }, },
-    { { 132, 18, 151, 0 },
-      { 48, 66, 124, 0 },
-      { 116, 164, 16, 1 },
-      { 31, 33, 6, 0 }, },
-    { { 132, 18, 232, 0 },
-      { 32, 132, 108, 1 },
-      { 11, 164, 16, 1 },
-      { 155, 16, 130, 0 }, },
-    { { 132, 18, 235, 1 },
-      { 40, 198, 108, 1 },
-      { 235, 164, 16, 1 },
-      { 155, 49, 138, 0 }, },
-    { { 132, 18, 228, 1 },
-      { 40, 132, 124, 0 },
-      { 147, 164, 16, 1 },
-      { 31, 16, 138, 0 }, },
-    { { 132, 18, 231, 0 },
-      { 32, 198, 124, 0 },
-      { 115, 164, 16, 1 },
-      { 31, 49, 130, 0 }, },
-    { { 132, 29, 8, 0 },
-      { 1, 8, 77, 1 },
-      { 8, 92, 16, 1 },
-      { 217, 8, 64, 0 }, },
-    { { 132, 29, 11, 1 },
-      { 9, 74, 77, 1 },
-      { 232, 92, 16, 1 },
-      { 217, 41, 72, 0 }, },
-    { { 132, 29, 4, 1 },
-      { 9, 8, 93, 0 },
-      { 144, 92, 16, 1 },
-      { 93, 8, 72, 0 }, },
-    { { 132, 29, 7, 0 },
-      { 1, 74, 93, 0 },
-      { 112, 92, 16, 1 },
-      { 93, 41, 64, 0 }, },
-    { { 132, 29, 120, 0 },
-      { 17, 140, 77, 1 },
-      { 15, 92, 16, 1 },
-      { 217, 24, 196, 0 }, },
-    { { 132, 29, 123, 1 },
-      { 25, 206, 77, 1 },
-      { 239, 92, 16, 1 },
-      { 217, 57, 204, 0 }, },
-    { { 132, 29, 116, 1 },
-      { 25, 140, 93, 0 },
-      { 151, 92, 16, 1 },
-      { 93, 24, 204, 0 }, },
-    { { 132, 29, 119, 0 },
-      { 17, 206, 93, 0 },
-      { 119, 92, 16, 1 },
-      { 93, 57, 196, 0 }, },
-    { { 132, 28, 152, 0 },
-      { 17, 8, 108, 1 },
-      { 12, 156, 16, 1 },
-      { 155, 8, 68, 0 }, },
-    { { 132, 28, 155, 1 },
-      { 25, 74, 108, 1 },
-      { 236, 156, 16, 1 },
-      { 155, 41, 76, 0 }, },
-    { { 132, 28, 148, 1 },
-      { 25, 8, 124, 0 },
-      { 148, 156, 16, 1 },
-      { 31, 8, 76, 0 }, },
-    { { 132, 28, 151, 0 },
-      { 17, 74, 124, 0 },
-      { 116, 156, 16, 1 },
-      { 31, 41, 68, 0 }, },
-    { { 132, 28, 232, 0 },
-      { 1, 140, 108, 1 },
-      { 11, 156, 16, 1 },
-      { 155, 24, 192, 0 }, },
-    { { 132, 28, 235, 1 },
-      { 9, 206, 108, 1 },
-      { 235, 156, 16, 1 },
-      { 155, 57, 200, 0 }, },
-    { { 132, 28, 228, 1 },
-      { 9, 140, 124, 0 },
-      { 147, 156, 16, 1 },
-      { 31, 24, 200, 0 }, },
-    { { 132, 28, 231, 0 },
-      { 1, 206, 124, 0 },
-      { 115, 156, 16, 1 },
-      { 31, 57, 192, 0 }, },
-    { { 133, 225, 8, 0 },
-      { 66, 16, 15, 1 },
-      { 8, 67, 208, 1 },
-      { 248, 4, 33, 0 }, },
-    { { 133, 225, 11, 1 },
-      { 74, 82, 15, 1 },
-      { 232, 67, 208, 1 },
-      { 248, 37, 41, 0 }, },
-    { { 133, 225, 4, 1 },
-      { 74, 16, 31, 0 },
-      { 144, 67, 208, 1 },
-      { 124, 4, 41, 0 }, },
-    { { 133, 225, 7, 0 },
-      { 66, 82, 31, 0 },
-      { 112, 67, 208, 1 },
-      { 124, 37, 33, 0 }, },
-    { { 133, 225, 120, 0 },
-      { 82, 148, 15, 1 },
-      { 15, 67, 208, 1 },
-      { 248, 20, 165, 0 }, },
-    { { 133, 225, 123, 1 },
-      { 90, 214, 15, 1 },
-      { 239, 67, 208, 1 },
-      { 248, 53, 173, 0 }, },
-    { { 133, 225, 116, 1 },
-      { 90, 148, 31, 0 },
-      { 151, 67, 208, 1 },
-      { 124, 20, 173, 0 }, },
-    { { 133, 225, 119, 0 },
-      { 82, 214, 31, 0 },
-      { 119, 67, 208, 1 },
-      { 124, 53, 165, 0 }, },
-    { { 133, 224, 152, 0 },
-      { 82, 16, 46, 1 },
-      { 12, 131, 208, 1 },
-      { 186, 4, 37, 0 }, },
-    { { 133, 224, 155, 1 },
-      { 90, 82, 46, 1 },
-      { 236, 131, 208, 1 },
-      { 186, 37, 45, 0 }, },
-    { { 133, 224, 148, 1 },
-      { 90, 16, 62, 0 },
-      { 148, 131, 208, 1 },
-      { 62, 4, 45, 0 }, },
-    { { 133, 224, 151, 0 },
-      { 82, 82, 62, 0 },
-      { 116, 131, 208, 1 },
-      { 62, 37, 37, 0 }, },
-    { { 133, 224, 232, 0 },
-      { 66, 148, 46, 1 },
-      { 11, 131, 208, 1 },
-      { 186, 20, 161, 0 }, },
-    { { 133, 224, 235, 1 },
-      { 74, 214, 46, 1 },
-      { 235, 131, 208, 1 },
-      { 186, 53, 169, 0 }, },
-    { { 133, 224, 228, 1 },
-      { 74, 148, 62, 0 },
-      { 147, 131, 208, 1 },
-      { 62, 20, 169, 0 }, },
-    { { 133, 224, 231, 0 },
-      { 66, 214, 62, 0 },
-      { 115, 131, 208, 1 },
-      { 62, 53, 161, 0 }, },
-    { { 133, 239, 8, 0 },
-      { 99, 24, 15, 1 },
-      { 8, 123, 208, 1 },
-      { 248, 12, 99, 0 }, },
-    { { 133, 239, 11, 1 },
-      { 107, 90, 15, 1 },
-      { 232, 123, 208, 1 },
-      { 248, 45, 107, 0 }, },
-    { { 133, 239, 4, 1 },
-      { 107, 24, 31, 0 },
-      { 144, 123, 208, 1 },
-      { 124, 12, 107, 0 }, },
-    { { 133, 239, 7, 0 },
-      { 99, 90, 31, 0 },
-      { 112, 123, 208, 1 },
-      { 124, 45, 99, 0 }, },
-    { { 133, 239, 120, 0 },
-      { 115, 156, 15, 1 },
-      { 15, 123, 208, 1 },
-      { 248, 28, 231, 0 }, },
-    { { 133, 239, 123, 1 },
-      { 123, 222, 15, 1 },
-      { 239, 123, 208, 1 },
-      { 248, 61, 239, 0 }, },
-    { { 133, 239, 116, 1 },
-      { 123, 156, 31, 0 },
-      { 151, 123, 208, 1 },
-      { 124, 28, 239, 0 }, },
-    { { 133, 239, 119, 0 },
-      { 115, 222, 31, 0 },
-      { 119, 123, 208, 1 },
-      { 124, 61, 231, 0 }, },
-    { { 133, 238, 152, 0 },
-      { 115, 24, 46, 1 },
-      { 12, 187, 208, 1 },
-      { 186, 12, 103, 0 }, },
-    { { 133, 238, 155, 1 },
-      { 123, 90, 46, 1 },
-      { 236, 187, 208, 1 },
-      { 186, 45, 111, 0 }, },
-    { { 133, 238, 148, 1 },
-      { 123, 24, 62, 0 },
-      { 148, 187, 208, 1 },
-      { 62, 12, 111, 0 }, },
-    { { 133, 238, 151, 0 },
-      { 115, 90, 62, 0 },
-      { 116, 187, 208, 1 },
-      { 62, 45, 103, 0 }, },
-    { { 133, 238, 232, 0 },
-      { 99, 156, 46, 1 },
-      { 11, 187, 208, 1 },
-      { 186, 28, 227, 0 }, },
-    { { 133, 238, 235, 1 },
-      { 107, 222, 46, 1 },
-      { 235, 187, 208, 1 },
-      { 186, 61, 235, 0 }, },
-    { { 133, 238, 228, 1 },
-      { 107, 156, 62, 0 },
-      { 147, 187, 208, 1 },
-      { 62, 28, 235, 0 }, },
-    { { 133, 238, 231, 0 },
-      { 99, 222, 62, 0 },
-      { 115, 187, 208, 1 },
-      { 62, 61, 227, 0 }, },
-    { { 133, 211, 8, 0 },
-      { 98, 16, 77, 1 },
-      { 8, 101, 208, 1 },
-      { 217, 4, 35, 0 }, },
-    { { 133, 211, 11, 1 },
-      { 106, 82, 77, 1 },
-      { 232, 101, 208, 1 },
-      { 217, 37, 43, 0 }, },
-    { { 133, 211, 4, 1 },
-      { 106, 16, 93, 0 },
-      { 144, 101, 208, 1 },
-      { 93, 4, 43, 0 }, },
-    { { 133, 211, 7, 0 },
-      { 98, 82, 93, 0 },
-      { 112, 101, 208, 1 },
-      { 93, 37, 35, 0 }, },
-    { { 133, 211, 120, 0 },
-      { 114, 148, 77, 1 },
-      { 15, 101, 208, 1 },
-      { 217, 20, 167, 0 }, },
-    { { 133, 211, 123, 1 },
-      { 122, 214, 77, 1 },
-      { 239, 101, 208, 1 },
-      { 217, 53, 175, 0 }, },
-    { { 133, 211, 116, 1 },
-      { 122, 148, 93, 0 },
-      { 151, 101, 208, 1 },
-      { 93, 20, 175, 0 }, },
-    { { 133, 211, 119, 0 },
-      { 114, 214, 93, 0 },
-      { 119, 101, 208, 1 },
-      { 93, 53, 167, 0 }, },
-    { { 133, 210, 152, 0 },
-      { 114, 16, 108, 1 },
-      { 12, 165, 208, 1 },
-      { 155, 4, 39, 0 }, },
-    { { 133, 210, 155, 1 },
-      { 122, 82, 108, 1 },
-      { 236, 165, 208, 1 },
-      { 155, 37, 47, 0 }, },
-    { { 133, 210, 148, 1 },
-      { 122, 16, 124, 0 },
-      { 148, 165, 208, 1 },
-      { 31, 4, 47, 0 }, },
-    { { 133, 210, 151, 0 },
-      { 114, 82, 124, 0 },
-      { 116, 165, 208, 1 },
-      { 31, 37, 39, 0 }, },
-    { { 133, 210, 232, 0 },
-      { 98, 148, 108, 1 },
-      { 11, 165, 208, 1 },
-      { 155, 20, 163, 0 }, },
-    { { 133, 210, 235, 1 },
-      { 106, 214, 108, 1 },
-      { 235, 165, 208, 1 },
-      { 155, 53, 171, 0 }, },
-    { { 133, 210, 228, 1 },
-      { 106, 148, 124, 0 },
-      { 147, 165, 208, 1 },
-      { 31, 20, 171, 0 }, },
-    { { 133, 210, 231, 0 },
-      { 98, 214, 124, 0 },
-      { 115, 165, 208, 1 },
-      { 31, 53, 163, 0 }, },
-    { { 133, 221, 8, 0 },
-      { 67, 24, 77, 1 },
-      { 8, 93, 208, 1 },
-      { 217, 12, 97, 0 }, },
-    { { 133, 221, 11, 1 },
-      { 75, 90, 77, 1 },
-      { 232, 93, 208, 1 },
-      { 217, 45, 105, 0 }, },
-    { { 133, 221, 4, 1 },
-      { 75, 24, 93, 0 },
-      { 144, 93, 208, 1 },
-      { 93, 12, 105, 0 }, },
-    { { 133, 221, 7, 0 },
-      { 67, 90, 93, 0 },
-      { 112, 93, 208, 1 },
-      { 93, 45, 97, 0 }, },
-    { { 133, 221, 120, 0 },
-      { 83, 156, 77, 1 },
-      { 15, 93, 208, 1 },
-      { 217, 28, 229, 0 }, },
-    { { 133, 221, 123, 1 },
-      { 91, 222, 77, 1 },
-      { 239, 93, 208, 1 },
-      { 217, 61, 237, 0 }, },
-    { { 133, 221, 116, 1 },
-      { 91, 156, 93, 0 },
-      { 151, 93, 208, 1 },
-      { 93, 28, 237, 0 }, },
-    { { 133, 221, 119, 0 },
-      { 83, 222, 93, 0 },
-      { 119, 93, 208, 1 },
-      { 93, 61, 229, 0 }, },
-    { { 133, 220, 152, 0 },
-      { 83, 24, 108, 1 },
-      { 12, 157, 208, 1 },
-      { 155, 12, 101, 0 }, },
-    { { 133, 220, 155, 1 },
-      { 91, 90, 108, 1 },
-      { 236, 157, 208, 1 },
-      { 155, 45, 109, 0 }, },
-    { { 133, 220, 148, 1 },
-      { 91, 24, 124, 0 },
-      { 148, 157, 208, 1 },
-      { 31, 12, 109, 0 }, },
-    { { 133, 220, 151, 0 },
-      { 83, 90, 124, 0 },
-      { 116, 157, 208, 1 },
-      { 31, 45, 101, 0 }, },
-    { { 133, 220, 232, 0 },
-      { 67, 156, 108, 1 },
-      { 11, 157, 208, 1 },
-      { 155, 28, 225, 0 }, },
-    { { 133, 220, 235, 1 },
-      { 75, 222, 108, 1 },
-      { 235, 157, 208, 1 },
-      { 155, 61, 233, 0 }, },
-    { { 133, 220, 228, 1 },
-      { 75, 156, 124, 0 },
-      { 147, 157, 208, 1 },
-      { 31, 28, 233, 0 }, },
-    { { 133, 220, 231, 0 },
-      { 67, 222, 124, 0 },
-      { 115, 157, 208, 1 },
-      { 31, 61, 225, 0 }, },
-    { { 130, 97, 8, 0 },
-      { 64, 0, 139, 1 },
-      { 8, 67, 32, 1 },
-      { 232, 128, 1, 0 }, },
-    { { 130, 97, 11, 1 },
-      { 72, 66, 139, 1 },
-      { 232, 67, 32, 1 },
-      { 232, 161, 9, 0 }, },
-    { { 130, 97, 4, 1 },
-      { 72, 0, 155, 0 },
-      { 144, 67, 32, 1 },
-      { 108, 128, 9, 0 }, },
-    { { 130, 97, 7, 0 },
-      { 64, 66, 155, 0 },
-      { 112, 67, 32, 1 },
-      { 108, 161, 1, 0 }, },
-    { { 130, 97, 120, 0 },
-      { 80, 132, 139, 1 },
-      { 15, 67, 32, 1 },
-      { 232, 144, 133, 0 }, },
-    { { 130, 97, 123, 1 },
-      { 88, 198, 139, 1 },
-      { 239, 67, 32, 1 },
-      { 232, 177, 141, 0 }, },
-    { { 130, 97, 116, 1 },
-      { 88, 132, 155, 0 },
-      { 151, 67, 32, 1 },
-      { 108, 144, 141, 0 }, },
-    { { 130, 97, 119, 0 },
-      { 80, 198, 155, 0 },
-      { 119, 67, 32, 1 },
-      { 108, 177, 133, 0 }, },
-    { { 130, 96, 152, 0 },
-      { 80, 0, 170, 1 },
-      { 12, 131, 32, 1 },
-      { 170, 128, 5, 0 }, },
-    { { 130, 96, 155, 1 },
-      { 88, 66, 170, 1 },
-      { 236, 131, 32, 1 },
-      { 170, 161, 13, 0 }, },
-    { { 130, 96, 148, 1 },
-      { 88, 0, 186, 0 },
-      { 148, 131, 32, 1 },
-      { 46, 128, 13, 0 }, },
-    { { 130, 96, 151, 0 },
-      { 80, 66, 186, 0 },
-      { 116, 131, 32, 1 },
-      { 46, 161, 5, 0 }, },
-    { { 130, 96, 232, 0 },
-      { 64, 132, 170, 1 },
-      { 11, 131, 32, 1 },
-      { 170, 144, 129, 0 }, },
-    { { 130, 96, 235, 1 },
-      { 72, 198, 170, 1 },
-      { 235, 131, 32, 1 },
-      { 170, 177, 137, 0 }, },
-    { { 130, 96, 228, 1 },
-      { 72, 132, 186, 0 },
-      { 147, 131, 32, 1 },
-      { 46, 144, 137, 0 }, },
-    { { 130, 96, 231, 0 },
-      { 64, 198, 186, 0 },
-      { 115, 131, 32, 1 },
-      { 46, 177, 129, 0 }, },
-    { { 130, 111, 8, 0 },
-      { 97, 8, 139, 1 },
-      { 8, 123, 32, 1 },
-      { 232, 136, 67, 0 }, },
-    { { 130, 111, 11, 1 },
-      { 105, 74, 139, 1 },
-      { 232, 123, 32, 1 },
-      { 232, 169, 75, 0 }, },
-    { { 130, 111, 4, 1 },
-      { 105, 8, 155, 0 },
-      { 144, 123, 32, 1 },
-      { 108, 136, 75, 0 }, },
-    { { 130, 111, 7, 0 },
-      { 97, 74, 155, 0 },
-      { 112, 123, 32, 1 },
-      { 108, 169, 67, 0 }, },
-    { { 130, 111, 120, 0 },
-      { 113, 140, 139, 1 },
-      { 15, 123, 32, 1 },
-      { 232, 152, 199, 0 }, },
-    { { 130, 111, 123, 1 },
-      { 121, 206, 139, 1 },
-      { 239, 123, 32, 1 },
-      { 232, 185, 207, 0 }, },
-    { { 130, 111, 116, 1 },
-      { 121, 140, 155, 0 },
-      { 151, 123, 32, 1 },
-      { 108, 152, 207, 0 }, },
-    { { 130, 111, 119, 0 },
-      { 113, 206, 155, 0 },
-      { 119, 123, 32, 1 },
-      { 108, 185, 199, 0 }, },
-    { { 130, 110, 152, 0 },
-      { 113, 8, 170, 1 },
-      { 12, 187, 32, 1 },
-      { 170, 136, 71, 0 }, },
-    { { 130, 110, 155, 1 },
-      { 121, 74, 170, 1 },
-      { 236, 187, 32, 1 },
-      { 170, 169, 79, 0 }, },
-    { { 130, 110, 148, 1 },
-      { 121, 8, 186, 0 },
-      { 148, 187, 32, 1 },
-      { 46, 136, 79, 0 }, },
-    { { 130, 110, 151, 0 },
-      { 113, 74, 186, 0 },
-      { 116, 187, 32, 1 },
-      { 46, 169, 71, 0 }, },
-    { { 130, 110, 232, 0 },
-      { 97, 140, 170, 1 },
-      { 11, 187, 32, 1 },
-      { 170, 152, 195, 0 }, },
-    { { 130, 110, 235, 1 },
-      { 105, 206, 170, 1 },
-      { 235, 187, 32, 1 },
-      { 170, 185, 203, 0 }, },
-    { { 130, 110, 228, 1 },
-      { 105, 140, 186, 0 },
-      { 147, 187, 32, 1 },
-      { 46, 152, 203, 0 }, },
-    { { 130, 110, 231, 0 },
-      { 97, 206, 186, 0 },
-      { 115, 187, 32, 1 },
-      { 46, 185, 195, 0 }, },
-    { { 130, 83, 8, 0 },
-      { 96, 0, 201, 1 },
-      { 8, 101, 32, 1 },
-      { 201, 128, 3, 0 }, },
-    { { 130, 83, 11, 1 },
-      { 104, 66, 201, 1 },
-      { 232, 101, 32, 1 },
-      { 201, 161, 11, 0 }, },
-    { { 130, 83, 4, 1 },
-      { 104, 0, 217, 0 },
-      { 144, 101, 32, 1 },
-      { 77, 128, 11, 0 }, },
-    { { 130, 83, 7, 0 },
-      { 96, 66, 217, 0 },
-      { 112, 101, 32, 1 },
-      { 77, 161, 3, 0 }, },
-    { { 130, 83, 120, 0 },
-      { 112, 132, 201, 1 },
-      { 15, 101, 32, 1 },
-      { 201, 144, 135, 0 }, },
-    { { 130, 83, 123, 1 },
-      { 120, 198, 201, 1 },
-      { 239, 101, 32, 1 },
-      { 201, 177, 143, 0 }, },
-    { { 130, 83, 116, 1 },
-      { 120, 132, 217, 0 },
-      { 151, 101, 32, 1 },
-      { 77, 144, 143, 0 }, },
-    { { 130, 83, 119, 0 },
-      { 112, 198, 217, 0 },
-      { 119, 101, 32, 1 },
-      { 77, 177, 135, 0 }, },
-    { { 130, 82, 152, 0 },
-      { 112, 0, 232, 1 },
-      { 12, 165, 32, 1 },
-      { 139, 128, 7, 0 }, },
-    { { 130, 82, 155, 1 },
-      { 120, 66, 232, 1 },
-      { 236, 165, 32, 1 },
-      { 139, 161, 15, 0 }, },
-    { { 130, 82, 148, 1 },
-      { 120, 0, 248, 0 },
-      { 148, 165, 32, 1 },
-      { 15, 128, 15, 0 }, },
-    { { 130, 82, 151, 0 },
-      { 112, 66, 248, 0 },
-      { 116, 165, 32, 1 },
-      { 15, 161, 7, 0 }, },
-    { { 130, 82, 232, 0 },
-      { 96, 132, 232, 1 },
-      { 11, 165, 32, 1 },
-      { 139, 144, 131, 0 }, },
-    { { 130, 82, 235, 1 },
-      { 104, 198, 232, 1 },
-      { 235, 165, 32, 1 },
-      { 139, 177, 139, 0 }, },
-    { { 130, 82, 228, 1 },
-      { 104, 132, 248, 0 },
-      { 147, 165, 32, 1 },
-      { 15, 144, 139, 0 }, },
-    { { 130, 82, 231, 0 },
-      { 96, 198, 248, 0 },
-      { 115, 165, 32, 1 },
-      { 15, 177, 131, 0 }, },
-    { { 130, 93, 8, 0 },
-      { 65, 8, 201, 1 },
-      { 8, 93, 32, 1 },
-      { 201, 136, 65, 0 }, },
-    { { 130, 93, 11, 1 },
-      { 73, 74, 201, 1 },
-      { 232, 93, 32, 1 },
-      { 201, 169, 73, 0 }, },
-    { { 130, 93, 4, 1 },
-      { 73, 8, 217, 0 },
-      { 144, 93, 32, 1 },
-      { 77, 136, 73, 0 }, },
-    { { 130, 93, 7, 0 },
-      { 65, 74, 217, 0 },
-      { 112, 93, 32, 1 },
-      { 77, 169, 65, 0 }, },
-    { { 130, 93, 120, 0 },
-      { 81, 140, 201, 1 },
-      { 15, 93, 32, 1 },
-      { 201, 152, 197, 0 }, },
-    { { 130, 93, 123, 1 },
-      { 89, 206, 201, 1 },
-      { 239, 93, 32, 1 },
-      { 201, 185, 205, 0 }, },
-    { { 130, 93, 116, 1 },
-      { 89, 140, 217, 0 },
-      { 151, 93, 32, 1 },
-      { 77, 152, 205, 0 }, },
-    { { 130, 93, 119, 0 },
-      { 81, 206, 217, 0 },
-      { 119, 93, 32, 1 },
-      { 77, 185, 197, 0 }, },
-    { { 130, 92, 152, 0 },
-      { 81, 8, 232, 1 },
-      { 12, 157, 32, 1 },
-      { 139, 136, 69, 0 }, },
-    { { 130, 92, 155, 1 },
-      { 89, 74, 232, 1 },
-      { 236, 157, 32, 1 },
-      { 139, 169, 77, 0 }, },
-    { { 130, 92, 148, 1 },
-      { 89, 8, 248, 0 },
-      { 148, 157, 32, 1 },
-      { 15, 136, 77, 0 }, },
-    { { 130, 92, 151, 0 },
-      { 81, 74, 248, 0 },
-      { 116, 157, 32, 1 },
-      { 15, 169, 69, 0 }, },
-    { { 130, 92, 232, 0 },
-      { 65, 140, 232, 1 },
-      { 11, 157, 32, 1 },
-      { 139, 152, 193, 0 }, },
-    { { 130, 92, 235, 1 },
-      { 73, 206, 232, 1 },
-      { 235, 157, 32, 1 },
-      { 139, 185, 201, 0 }, },
-    { { 130, 92, 228, 1 },
-      { 73, 140, 248, 0 },
-      { 147, 157, 32, 1 },
-      { 15, 152, 201, 0 }, },
-    { { 130, 92, 231, 0 },
-      { 65, 206, 248, 0 },
-      { 115, 157, 32, 1 },
-      { 15, 185, 193, 0 }, },
-    { { 131, 161, 8, 0 },
-      { 2, 16, 139, 1 },
-      { 8, 66, 224, 1 },
-      { 232, 132, 32, 0 }, },
-    { { 131, 161, 11, 1 },
-      { 10, 82, 139, 1 },
-      { 232, 66, 224, 1 },
-      { 232, 165, 40, 0 }, },
-    { { 131, 161, 4, 1 },
-      { 10, 16, 155, 0 },
-      { 144, 66, 224, 1 },
-      { 108, 132, 40, 0 }, },
-    { { 131, 161, 7, 0 },
-      { 2, 82, 155, 0 },
-      { 112, 66, 224, 1 },
-      { 108, 165, 32, 0 }, },
-    { { 131, 161, 120, 0 },
-      { 18, 148, 139, 1 },
-      { 15, 66, 224, 1 },
-      { 232, 148, 164, 0 }, },
-    { { 131, 161, 123, 1 },
-      { 26, 214, 139, 1 },
-      { 239, 66, 224, 1 },
-      { 232, 181, 172, 0 }, },
-    { { 131, 161, 116, 1 },
-      { 26, 148, 155, 0 },
-      { 151, 66, 224, 1 },
-      { 108, 148, 172, 0 }, },
-    { { 131, 161, 119, 0 },
-      { 18, 214, 155, 0 },
-      { 119, 66, 224, 1 },
-      { 108, 181, 164, 0 }, },
-    { { 131, 160, 152, 0 },
-      { 18, 16, 170, 1 },
-      { 12, 130, 224, 1 },
-      { 170, 132, 36, 0 }, },
-    { { 131, 160, 155, 1 },
-      { 26, 82, 170, 1 },
-      { 236, 130, 224, 1 },
-      { 170, 165, 44, 0 }, },
-    { { 131, 160, 148, 1 },
-      { 26, 16, 186, 0 },
-      { 148, 130, 224, 1 },
-      { 46, 132, 44, 0 }, },
-    { { 131, 160, 151, 0 },
-      { 18, 82, 186, 0 },
-      { 116, 130, 224, 1 },
-      { 46, 165, 36, 0 }, },
-    { { 131, 160, 232, 0 },
-      { 2, 148, 170, 1 },
-      { 11, 130, 224, 1 },
-      { 170, 148, 160, 0 }, },
-    { { 131, 160, 235, 1 },
-      { 10, 214, 170, 1 },
-      { 235, 130, 224, 1 },
-      { 170, 181, 168, 0 }, },
-    { { 131, 160, 228, 1 },
-      { 10, 148, 186, 0 },
-      { 147, 130, 224, 1 },
-      { 46, 148, 168, 0 }, },
-    { { 131, 160, 231, 0 },
-      { 2, 214, 186, 0 },
-      { 115, 130, 224, 1 },
-      { 46, 181, 160, 0 }, },
-    { { 131, 175, 8, 0 },
-      { 35, 24, 139, 1 },
-      { 8, 122, 224, 1 },
-      { 232, 140, 98, 0 }, },
-    { { 131, 175, 11, 1 },
-      { 43, 90, 139, 1 },
-      { 232, 122, 224, 1 },
-      { 232, 173, 106, 0 }, },
-    { { 131, 175, 4, 1 },
-      { 43, 24, 155, 0 },
-      { 144, 122, 224, 1 },
-      { 108, 140, 106, 0 }, },
-    { { 131, 175, 7, 0 },
-      { 35, 90, 155, 0 },
-      { 112, 122, 224, 1 },
-      { 108, 173, 98, 0 }, },
-    { { 131, 175, 120, 0 },
-      { 51, 156, 139, 1 },
-      { 15, 122, 224, 1 },
-      { 232, 156, 230, 0 }, },
-    { { 131, 175, 123, 1 },
-      { 59, 222, 139, 1 },
-      { 239, 122, 224, 1 },
-      { 232, 189, 238, 0 }, },
-    { { 131, 175, 116, 1 },
-      { 59, 156, 155, 0 },
-      { 151, 122, 224, 1 },
-      { 108, 156, 238, 0 }, },
-    { { 131, 175, 119, 0 },
-      { 51, 222, 155, 0 },
-      { 119, 122, 224, 1 },
-      { 108, 189, 230, 0 }, },
-    { { 131, 174, 152, 0 },
-      { 51, 24, 170, 1 },
-      { 12, 186, 224, 1 },
-      { 170, 140, 102, 0 }, },
-    { { 131, 174, 155, 1 },
-      { 59, 90, 170, 1 },
-      { 236, 186, 224, 1 },
-      { 170, 173, 110, 0 }, },
-    { { 131, 174, 148, 1 },
-      { 59, 24, 186, 0 },
-      { 148, 186, 224, 1 },
-      { 46, 140, 110, 0 }, },
-    { { 131, 174, 151, 0 },
-      { 51, 90, 186, 0 },
-      { 116, 186, 224, 1 },
-      { 46, 173, 102, 0 }, },
-    { { 131, 174, 232, 0 },
-      { 35, 156, 170, 1 },
-      { 11, 186, 224, 1 },
-      { 170, 156, 226, 0 }, },
-    { { 131, 174, 235, 1 },
-      { 43, 222, 170, 1 },
-      { 235, 186, 224, 1 },
-      { 170, 189, 234, 0 }, },
-    { { 131, 174, 228, 1 },
-      { 43, 156, 186, 0 },
-      { 147, 186, 224, 1 },
-      { 46, 156, 234, 0 }, },
-    { { 131, 174, 231, 0 },
-      { 35, 222, 186, 0 },
-      { 115, 186, 224, 1 },
-      { 46, 189, 226, 0 }, },
-    { { 131, 147, 8, 0 },
-      { 34, 16, 201, 1 },
-      { 8, 100, 224, 1 },
-      { 201, 132, 34, 0 }, },
-    { { 131, 147, 11, 1 },
-      { 42, 82, 201, 1 },
-      { 232, 100, 224, 1 },
-      { 201, 165, 42, 0 }, },
-    { { 131, 147, 4, 1 },
-      { 42, 16, 217, 0 },
-      { 144, 100, 224, 1 },
-      { 77, 132, 42, 0 }, },
-    { { 131, 147, 7, 0 },
-      { 34, 82, 217, 0 },
-      { 112, 100, 224, 1 },
-      { 77, 165, 34, 0 }, },
-    { { 131, 147, 120, 0 },
-      { 50, 148, 201, 1 },
-      { 15, 100, 224, 1 },
-      { 201, 148, 166, 0 }, },
-    { { 131, 147, 123, 1 },
-      { 58, 214, 201, 1 },
-      { 239, 100, 224, 1 },
-      { 201, 181, 174, 0 }, },
-    { { 131, 147, 116, 1 },
-      { 58, 148, 217, 0 },
-      { 151, 100, 224, 1 },
-      { 77, 148, 174, 0 }, },
-    { { 131, 147, 119, 0 },
-      { 50, 214, 217, 0 },
-      { 119, 100, 224, 1 },
-      { 77, 181, 166, 0 }, },
-    { { 131, 146, 152, 0 },
-      { 50, 16, 232, 1 },
-      { 12, 164, 224, 1 },
-      { 139, 132, 38, 0 }, },
-    { { 131, 146, 155, 1 },
-      { 58, 82, 232, 1 },
-      { 236, 164, 224, 1 },
-      { 139, 165, 46, 0 }, },
-    { { 131, 146, 148, 1 },
-      { 58, 16, 248, 0 },
-      { 148, 164, 224, 1 },
-      { 15, 132, 46, 0 }, },
-    { { 131, 146, 151, 0 },
-      { 50, 82, 248, 0 },
-      { 116, 164, 224, 1 },
-      { 15, 165, 38, 0 }, },
-    { { 131, 146, 232, 0 },
-      { 34, 148, 232, 1 },
-      { 11, 164, 224, 1 },
-      { 139, 148, 162, 0 }, },
-    { { 131, 146, 235, 1 },
-      { 42, 214, 232, 1 },
-      { 235, 164, 224, 1 },
-      { 139, 181, 170, 0 }, },
-    { { 131, 146, 228, 1 },
-      { 42, 148, 248, 0 },
-      { 147, 164, 224, 1 },
-      { 15, 148, 170, 0 }, },
-    { { 131, 146, 231, 0 },
-      { 34, 214, 248, 0 },
-      { 115, 164, 224, 1 },
-      { 15, 181, 162, 0 }, },
-    { { 131, 157, 8, 0 },
-      { 3, 24, 201, 1 },
-      { 8, 92, 224, 1 },
-      { 201, 140, 96, 0 }, },
-    { { 131, 157, 11, 1 },
-      { 11, 90, 201, 1 },
-      { 232, 92, 224, 1 },
-      { 201, 173, 104, 0 }, },
-    { { 131, 157, 4, 1 },
-      { 11, 24, 217, 0 },
-      { 144, 92, 224, 1 },
-      { 77, 140, 104, 0 }, },
-    { { 131, 157, 7, 0 },
-      { 3, 90, 217, 0 },
-      { 112, 92, 224, 1 },
-      { 77, 173, 96, 0 }, },
-    { { 131, 157, 120, 0 },
-      { 19, 156, 201, 1 },
-      { 15, 92, 224, 1 },
-      { 201, 156, 228, 0 }, },
-    { { 131, 157, 123, 1 },
-      { 27, 222, 201, 1 },
-      { 239, 92, 224, 1 },
-      { 201, 189, 236, 0 }, },
-    { { 131, 157, 116, 1 },
-      { 27, 156, 217, 0 },
-      { 151, 92, 224, 1 },
-      { 77, 156, 236, 0 }, },
-    { { 131, 157, 119, 0 },
-      { 19, 222, 217, 0 },
-      { 119, 92, 224, 1 },
-      { 77, 189, 228, 0 }, },
-    { { 131, 156, 152, 0 },
-      { 19, 24, 232, 1 },
-      { 12, 156, 224, 1 },
-      { 139, 140, 100, 0 }, },
-    { { 131, 156, 155, 1 },
-      { 27, 90, 232, 1 },
-      { 236, 156, 224, 1 },
-      { 139, 173, 108, 0 }, },
-    { { 131, 156, 148, 1 },
-      { 27, 24, 248, 0 },
-      { 148, 156, 224, 1 },
-      { 15, 140, 108, 0 }, },
-    { { 131, 156, 151, 0 },
-      { 19, 90, 248, 0 },
-      { 116, 156, 224, 1 },
-      { 15, 173, 100, 0 }, },
-    { { 131, 156, 232, 0 },
-      { 3, 156, 232, 1 },
-      { 11, 156, 224, 1 },
-      { 139, 156, 224, 0 }, },
-    { { 131, 156, 235, 1 },
-      { 11, 222, 232, 1 },
-      { 235, 156, 224, 1 },
-      { 139, 189, 232, 0 }, },
-    { { 131, 156, 228, 1 },
-      { 11, 156, 248, 0 },
-      { 147, 156, 224, 1 },
-      { 15, 156, 232, 0 }, },
-    { { 131, 156, 231, 0 },
-      { 3, 222, 248, 0 },
-      { 115, 156, 224, 1 },
-      { 15, 189, 224, 0 }, },
-    { { 188, 33, 8, 0 },
-      { 132, 32, 15, 1 },
-      { 8, 66, 30, 1 },
-      { 248, 2, 16, 1 }, },
-    { { 188, 33, 11, 1 },
-      { 140, 98, 15, 1 },
-      { 232, 66, 30, 1 },
-      { 248, 35, 24, 1 }, },
-    { { 188, 33, 4, 1 },
-      { 140, 32, 31, 0 },
-      { 144, 66, 30, 1 },
-      { 124, 2, 24, 1 }, },
-    { { 188, 33, 7, 0 },
-      { 132, 98, 31, 0 },
-      { 112, 66, 30, 1 },
-      { 124, 35, 16, 1 }, },
-    { { 188, 33, 120, 0 },
-      { 148, 164, 15, 1 },
-      { 15, 66, 30, 1 },
-      { 248, 18, 148, 1 }, },
-    { { 188, 33, 123, 1 },
-      { 156, 230, 15, 1 },
-      { 239, 66, 30, 1 },
-      { 248, 51, 156, 1 }, },
-    { { 188, 33, 116, 1 },
-      { 156, 164, 31, 0 },
-      { 151, 66, 30, 1 },
-      { 124, 18, 156, 1 }, },
-    { { 188, 33, 119, 0 },
-      { 148, 230, 31, 0 },
-      { 119, 66, 30, 1 },
-      { 124, 51, 148, 1 }, },
-    { { 188, 32, 152, 0 },
-      { 148, 32, 46, 1 },
-      { 12, 130, 30, 1 },
-      { 186, 2, 20, 1 }, },
-    { { 188, 32, 155, 1 },
-      { 156, 98, 46, 1 },
-      { 236, 130, 30, 1 },
-      { 186, 35, 28, 1 }, },
-    { { 188, 32, 148, 1 },
-      { 156, 32, 62, 0 },
-      { 148, 130, 30, 1 },
-      { 62, 2, 28, 1 }, },
-    { { 188, 32, 151, 0 },
-      { 148, 98, 62, 0 },
-      { 116, 130, 30, 1 },
-      { 62, 35, 20, 1 }, },
-    { { 188, 32, 232, 0 },
-      { 132, 164, 46, 1 },
-      { 11, 130, 30, 1 },
-      { 186, 18, 144, 1 }, },
-    { { 188, 32, 235, 1 },
-      { 140, 230, 46, 1 },
-      { 235, 130, 30, 1 },
-      { 186, 51, 152, 1 }, },
-    { { 188, 32, 228, 1 },
-      { 140, 164, 62, 0 },
-      { 147, 130, 30, 1 },
-      { 62, 18, 152, 1 }, },
-    { { 188, 32, 231, 0 },
-      { 132, 230, 62, 0 },
-      { 115, 130, 30, 1 },
-      { 62, 51, 144, 1 }, },
-    { { 188, 47, 8, 0 },
-      { 165, 40, 15, 1 },
-      { 8, 122, 30, 1 },
-      { 248, 10, 82, 1 }, },
-    { { 188, 47, 11, 1 },
-      { 173, 106, 15, 1 },
-      { 232, 122, 30, 1 },
-      { 248, 43, 90, 1 }, },
-    { { 188, 47, 4, 1 },
-      { 173, 40, 31, 0 },
-      { 144, 122, 30, 1 },
-      { 124, 10, 90, 1 }, },
-    { { 188, 47, 7, 0 },
-      { 165, 106, 31, 0 },
-      { 112, 122, 30, 1 },
-      { 124, 43, 82, 1 }, },
-    { { 188, 47, 120, 0 },
-      { 181, 172, 15, 1 },
-      { 15, 122, 30, 1 },
-      { 248, 26, 214, 1 }, },
-    { { 188, 47, 123, 1 },
-      { 189, 238, 15, 1 },
-      { 239, 122, 30, 1 },
-      { 248, 59, 222, 1 }, },
-    { { 188, 47, 116, 1 },
-      { 189, 172, 31, 0 },
-      { 151, 122, 30, 1 },
-      { 124, 26, 222, 1 }, },
-    { { 188, 47, 119, 0 },
-      { 181, 238, 31, 0 },
-      { 119, 122, 30, 1 },
-      { 124, 59, 214, 1 }, },
-    { { 188, 46, 152, 0 },
-      { 181, 40, 46, 1 },
-      { 12, 186, 30, 1 },
-      { 186, 10, 86, 1 }, },
-    { { 188, 46, 155, 1 },
-      { 189, 106, 46, 1 },
-      { 236, 186, 30, 1 },
-      { 186, 43, 94, 1 }, },
-    { { 188, 46, 148, 1 },
-      { 189, 40, 62, 0 },
-      { 148, 186, 30, 1 },
-      { 62, 10, 94, 1 }, },
-    { { 188, 46, 151, 0 },
-      { 181, 106, 62, 0 },
-      { 116, 186, 30, 1 },
-      { 62, 43, 86, 1 }, },
-    { { 188, 46, 232, 0 },
-      { 165, 172, 46, 1 },
-      { 11, 186, 30, 1 },
-      { 186, 26, 210, 1 }, },
-    { { 188, 46, 235, 1 },
-      { 173, 238, 46, 1 },
-      { 235, 186, 30, 1 },
-      { 186, 59, 218, 1 }, },
-    { { 188, 46, 228, 1 },
-      { 173, 172, 62, 0 },
-      { 147, 186, 30, 1 },
-      { 62, 26, 218, 1 }, },
-    { { 188, 46, 231, 0 },
-      { 165, 238, 62, 0 },
-      { 115, 186, 30, 1 },
-      { 62, 59, 210, 1 }, },
-    { { 188, 19, 8, 0 },
-      { 164, 32, 77, 1 },
-      { 8, 100, 30, 1 },
-      { 217, 2, 18, 1 }, },
-    { { 188, 19, 11, 1 },
-      { 172, 98, 77, 1 },
-      { 232, 100, 30, 1 },
-      { 217, 35, 26, 1 }, },
-    { { 188, 19, 4, 1 },
-      { 172, 32, 93, 0 },
-      { 144, 100, 30, 1 },
-      { 93, 2, 26, 1 }, },
-    { { 188, 19, 7, 0 },
-      { 164, 98, 93, 0 },
-      { 112, 100, 30, 1 },
-      { 93, 35, 18, 1 }, },
-    { { 188, 19, 120, 0 },
-      { 180, 164, 77, 1 },
-      { 15, 100, 30, 1 },
-      { 217, 18, 150, 1 }, },
-    { { 188, 19, 123, 1 },
-      { 188, 230, 77, 1 },
-      { 239, 100, 30, 1 },
-      { 217, 51, 158, 1 }, },
-    { { 188, 19, 116, 1 },
-      { 188, 164, 93, 0 },
-      { 151, 100, 30, 1 },
-      { 93, 18, 158, 1 }, },
-    { { 188, 19, 119, 0 },
-      { 180, 230, 93, 0 },
-      { 119, 100, 30, 1 },
-      { 93, 51, 150, 1 }, },
-    { { 188, 18, 152, 0 },
-      { 180, 32, 108, 1 },
-      { 12, 164, 30, 1 },
-      { 155, 2, 22, 1 }, },
-    { { 188, 18, 155, 1 },
-      { 188, 98, 108, 1 },
-      { 236, 164, 30, 1 },
-      { 155, 35, 30, 1 }, },
-    { { 188, 18, 148, 1 },
-      { 188, 32, 124, 0 },
-      { 148, 164, 30, 1 },
-      { 31, 2, 30, 1 }, },
-    { { 188, 18, 151, 0 },
-      { 180, 98, 124, 0 },
-      { 116, 164, 30, 1 },
-      { 31, 35, 22, 1 }, },
-    { { 188, 18, 232, 0 },
-      { 164, 164, 108, 1 },
-      { 11, 164, 30, 1 },
-      { 155, 18, 146, 1 }, },
-    { { 188, 18, 235, 1 },
-      { 172, 230, 108, 1 },
-      { 235, 164, 30, 1 },
-      { 155, 51, 154, 1 }, },
-    { { 188, 18, 228, 1 },
-      { 172, 164, 124, 0 },
-      { 147, 164, 30, 1 },
-      { 31, 18, 154, 1 }, },
-    { { 188, 18, 231, 0 },
-      { 164, 230, 124, 0 },
-      { 115, 164, 30, 1 },
-      { 31, 51, 146, 1 }, },
-    { { 188, 29, 8, 0 },
-      { 133, 40, 77, 1 },
-      { 8, 92, 30, 1 },
-      { 217, 10, 80, 1 }, },
-    { { 188, 29, 11, 1 },
-      { 141, 106, 77, 1 },
-      { 232, 92, 30, 1 },
-      { 217, 43, 88, 1 }, },
-    { { 188, 29, 4, 1 },
-      { 141, 40, 93, 0 },
-      { 144, 92, 30, 1 },
-      { 93, 10, 88, 1 }, },
-    { { 188, 29, 7, 0 },
-      { 133, 106, 93, 0 },
-      { 112, 92, 30, 1 },
-      { 93, 43, 80, 1 }, },
-    { { 188, 29, 120, 0 },
-      { 149, 172, 77, 1 },
-      { 15, 92, 30, 1 },
-      { 217, 26, 212, 1 }, },
-    { { 188, 29, 123, 1 },
-      { 157, 238, 77, 1 },
-      { 239, 92, 30, 1 },
-      { 217, 59, 220, 1 }, },
-    { { 188, 29, 116, 1 },
-      { 157, 172, 93, 0 },
-      { 151, 92, 30, 1 },
-      { 93, 26, 220, 1 }, },
-    { { 188, 29, 119, 0 },
-      { 149, 238, 93, 0 },
-      { 119, 92, 30, 1 },
-      { 93, 59, 212, 1 }, },
-    { { 188, 28, 152, 0 },
-      { 149, 40, 108, 1 },
-      { 12, 156, 30, 1 },
-      { 155, 10, 84, 1 }, },
-    { { 188, 28, 155, 1 },
-      { 157, 106, 108, 1 },
-      { 236, 156, 30, 1 },
-      { 155, 43, 92, 1 }, },
-    { { 188, 28, 148, 1 },
-      { 157, 40, 124, 0 },
-      { 148, 156, 30, 1 },
-      { 31, 10, 92, 1 }, },
-    { { 188, 28, 151, 0 },
-      { 149, 106, 124, 0 },
-      { 116, 156, 30, 1 },
-      { 31, 43, 84, 1 }, },
-    { { 188, 28, 232, 0 },
-      { 133, 172, 108, 1 },
-      { 11, 156, 30, 1 },
-      { 155, 26, 208, 1 }, },
-    { { 188, 28, 235, 1 },
-      { 141, 238, 108, 1 },
-      { 235, 156, 30, 1 },
-      { 155, 59, 216, 1 }, },
-    { { 188, 28, 228, 1 },
-      { 141, 172, 124, 0 },
-      { 147, 156, 30, 1 },
-      { 31, 26, 216, 1 }, },
-    { { 188, 28, 231, 0 },
-      { 133, 238, 124, 0 },
-      { 115, 156, 30, 1 },
-      { 31, 59, 208, 1 }, },
-    { { 189, 225, 8, 0 },
-      { 198, 48, 15, 1 },
-      { 8, 67, 222, 1 },
-      { 248, 6, 49, 1 }, },
-    { { 189, 225, 11, 1 },
-      { 206, 114, 15, 1 },
-      { 232, 67, 222, 1 },
-      { 248, 39, 57, 1 }, },
-    { { 189, 225, 4, 1 },
-      { 206, 48, 31, 0 },
-      { 144, 67, 222, 1 },
-      { 124, 6, 57, 1 }, },
-    { { 189, 225, 7, 0 },
-      { 198, 114, 31, 0 },
-      { 112, 67, 222, 1 },
-      { 124, 39, 49, 1 }, },
-    { { 189, 225, 120, 0 },
-      { 214, 180, 15, 1 },
-      { 15, 67, 222, 1 },
-      { 248, 22, 181, 1 }, },
-    { { 189, 225, 123, 1 },
-      { 222, 246, 15, 1 },
-      { 239, 67, 222, 1 },
-      { 248, 55, 189, 1 }, },
-    { { 189, 225, 116, 1 },
-      { 222, 180, 31, 0 },
-      { 151, 67, 222, 1 },
-      { 124, 22, 189, 1 }, },
-    { { 189, 225, 119, 0 },
-      { 214, 246, 31, 0 },
-      { 119, 67, 222, 1 },
-      { 124, 55, 181, 1 }, },
-    { { 189, 224, 152, 0 },
-      { 214, 48, 46, 1 },
-      { 12, 131, 222, 1 },
-      { 186, 6, 53, 1 }, },
-    { { 189, 224, 155, 1 },
-      { 222, 114, 46, 1 },
-      { 236, 131, 222, 1 },
-      { 186, 39, 61, 1 }, },
-    { { 189, 224, 148, 1 },
-      { 222, 48, 62, 0 },
-      { 148, 131, 222, 1 },
-      { 62, 6, 61, 1 }, },
-    { { 189, 224, 151, 0 },
-      { 214, 114, 62, 0 },
-      { 116, 131, 222, 1 },
-      { 62, 39, 53, 1 }, },
-    { { 189, 224, 232, 0 },
-      { 198, 180, 46, 1 },
-      { 11, 131, 222, 1 },
-      { 186, 22, 177, 1 }, },
-    { { 189, 224, 235, 1 },
-      { 206, 246, 46, 1 },
-      { 235, 131, 222, 1 },
-      { 186, 55, 185, 1 }, },
-    { { 189, 224, 228, 1 },
-      { 206, 180, 62, 0 },
-      { 147, 131, 222, 1 },
-      { 62, 22, 185, 1 }, },
-    { { 189, 224, 231, 0 },
-      { 198, 246, 62, 0 },
-      { 115, 131, 222, 1 },
-      { 62, 55, 177, 1 }, },
-    { { 189, 239, 8, 0 },
-      { 231, 56, 15, 1 },
-      { 8, 123, 222, 1 },
-      { 248, 14, 115, 1 }, },
-    { { 189, 239, 11, 1 },
-      { 239, 122, 15, 1 },
-      { 232, 123, 222, 1 },
-      { 248, 47, 123, 1 }, },
-    { { 189, 239, 4, 1 },
-      { 239, 56, 31, 0 },
-      { 144, 123, 222, 1 },
-      { 124, 14, 123, 1 }, },
-    { { 189, 239, 7, 0 },
-      { 231, 122, 31, 0 },
-      { 112, 123, 222, 1 },
-      { 124, 47, 115, 1 }, },
-    { { 189, 239, 120, 0 },
-      { 247, 188, 15, 1 },
-      { 15, 123, 222, 1 },
-      { 248, 30, 247, 1 }, },
-    { { 189, 239, 123, 1 },
-      { 255, 254, 15, 1 },
-      { 239, 123, 222, 1 },
-      { 248, 63, 255, 1 }, },
-    { { 189, 239, 116, 1 },
-      { 255, 188, 31, 0 },
-      { 151, 123, 222, 1 },
-      { 124, 30, 255, 1 }, },
-    { { 189, 239, 119, 0 },
-      { 247, 254, 31, 0 },
-      { 119, 123, 222, 1 },
-      { 124, 63, 247, 1 }, },
-    { { 189, 238, 152, 0 },
-      { 247, 56, 46, 1 },
-      { 12, 187, 222, 1 },
-      { 186, 14, 119, 1 }, },
-    { { 189, 238, 155, 1 },
-      { 255, 122, 46, 1 },
-      { 236, 187, 222, 1 },
-      { 186, 47, 127, 1 }, },
-    { { 189, 238, 148, 1 },
-      { 255, 56, 62, 0 },
-      { 148, 187, 222, 1 },
-      { 62, 14, 127, 1 }, },
-    { { 189, 238, 151, 0 },
-      { 247, 122, 62, 0 },
-      { 116, 187, 222, 1 },
-      { 62, 47, 119, 1 }, },
-    { { 189, 238, 232, 0 },
-      { 231, 188, 46, 1 },
-      { 11, 187, 222, 1 },
-      { 186, 30, 243, 1 }, },
-    { { 189, 238, 235, 1 },
-      { 239, 254, 46, 1 },
-      { 235, 187, 222, 1 },
-      { 186, 63, 251, 1 }, },
-    { { 189, 238, 228, 1 },
-      { 239, 188, 62, 0 },
-      { 147, 187, 222, 1 },
-      { 62, 30, 251, 1 }, },
-    { { 189, 238, 231, 0 },
-      { 231, 254, 62, 0 },
-      { 115, 187, 222, 1 },
-      { 62, 63, 243, 1 }, },
-    { { 189, 211, 8, 0 },
-      { 230, 48, 77, 1 },
-      { 8, 101, 222, 1 },
-      { 217, 6, 51, 1 }, },
-    { { 189, 211, 11, 1 },
-      { 238, 114, 77, 1 },
-      { 232, 101, 222, 1 },
-      { 217, 39, 59, 1 }, },
-    { { 189, 211, 4, 1 },
-      { 238, 48, 93, 0 },
-      { 144, 101, 222, 1 },
-      { 93, 6, 59, 1 }, },
-    { { 189, 211, 7, 0 },
-      { 230, 114, 93, 0 },
-      { 112, 101, 222, 1 },
-      { 93, 39, 51, 1 }, },
-    { { 189, 211, 120, 0 },
-      { 246, 180, 77, 1 },
-      { 15, 101, 222, 1 },
-      { 217, 22, 183, 1 }, },
-    { { 189, 211, 123, 1 },
-      { 254, 246, 77, 1 },
-      { 239, 101, 222, 1 },
-      { 217, 55, 191, 1 }, },
-    { { 189, 211, 116, 1 },
-      { 254, 180, 93, 0 },
-      { 151, 101, 222, 1 },
-      { 93, 22, 191, 1 }, },
-    { { 189, 211, 119, 0 },
-      { 246, 246, 93, 0 },
-      { 119, 101, 222, 1 },
-      { 93, 55, 183, 1 }, },
-    { { 189, 210, 152, 0 },
-      { 246, 48, 108, 1 },
-      { 12, 165, 222, 1 },
-      { 155, 6, 55, 1 }, },
-    { { 189, 210, 155, 1 },
-      { 254, 114, 108, 1 },
-      { 236, 165, 222, 1 },
-      { 155, 39, 63, 1 }, },
-    { { 189, 210, 148, 1 },
-      { 254, 48, 124, 0 },
-      { 148, 165, 222, 1 },
-      { 31, 6, 63, 1 }, },
-    { { 189, 210, 151, 0 },
-      { 246, 114, 124, 0 },
-      { 116, 165, 222, 1 },
-      { 31, 39, 55, 1 }, },
-    { { 189, 210, 232, 0 },
-      { 230, 180, 108, 1 },
-      { 11, 165, 222, 1 },
-      { 155, 22, 179, 1 }, },
-    { { 189, 210, 235, 1 },
-      { 238, 246, 108, 1 },
-      { 235, 165, 222, 1 },
-      { 155, 55, 187, 1 }, },
-    { { 189, 210, 228, 1 },
-      { 238, 180, 124, 0 },
-      { 147, 165, 222, 1 },
-      { 31, 22, 187, 1 }, },
-    { { 189, 210, 231, 0 },
-      { 230, 246, 124, 0 },
-      { 115, 165, 222, 1 },
-      { 31, 55, 179, 1 }, },
-    { { 189, 221, 8, 0 },
-      { 199, 56, 77, 1 },
-      { 8, 93, 222, 1 },
-      { 217, 14, 113, 1 }, },
-    { { 189, 221, 11, 1 },
-      { 207, 122, 77, 1 },
-      { 232, 93, 222, 1 },
-      { 217, 47, 121, 1 }, },
-    { { 189, 221, 4, 1 },
-      { 207, 56, 93, 0 },
-      { 144, 93, 222, 1 },
-      { 93, 14, 121, 1 }, },
-    { { 189, 221, 7, 0 },
-      { 199, 122, 93, 0 },
-      { 112, 93, 222, 1 },
-      { 93, 47, 113, 1 }, },
-    { { 189, 221, 120, 0 },
-      { 215, 188, 77, 1 },
-      { 15, 93, 222, 1 },
-      { 217, 30, 245, 1 }, },
-    { { 189, 221, 123, 1 },
-      { 223, 254, 77, 1 },
-      { 239, 93, 222, 1 },
-      { 217, 63, 253, 1 }, },
-    { { 189, 221, 116, 1 },
-      { 223, 188, 93, 0 },
-      { 151, 93, 222, 1 },
-      { 93, 30, 253, 1 }, },
-    { { 189, 221, 119, 0 },
-      { 215, 254, 93, 0 },
-      { 119, 93, 222, 1 },
-      { 93, 63, 245, 1 }, },
-    { { 189, 220, 152, 0 },
-      { 215, 56, 108, 1 },
-      { 12, 157, 222, 1 },
-      { 155, 14, 117, 1 }, },
-    { { 189, 220, 155, 1 },
-      { 223, 122, 108, 1 },
-      { 236, 157, 222, 1 },
-      { 155, 47, 125, 1 }, },
-    { { 189, 220, 148, 1 },
-      { 223, 56, 124, 0 },
-      { 148, 157, 222, 1 },
-      { 31, 14, 125, 1 }, },
-    { { 189, 220, 151, 0 },
-      { 215, 122, 124, 0 },
-      { 116, 157, 222, 1 },
-      { 31, 47, 117, 1 }, },
-    { { 189, 220, 232, 0 },
-      { 199, 188, 108, 1 },
-      { 11, 157, 222, 1 },
-      { 155, 30, 241, 1 }, },
-    { { 189, 220, 235, 1 },
-      { 207, 254, 108, 1 },
-      { 235, 157, 222, 1 },
-      { 155, 63, 249, 1 }, },
-    { { 189, 220, 228, 1 },
-      { 207, 188, 124, 0 },
-      { 147, 157, 222, 1 },
-      { 31, 30, 249, 1 }, },
-    { { 189, 220, 231, 0 },
-      { 199, 254, 124, 0 },
-      { 115, 157, 222, 1 },
-      { 31, 63, 241, 1 }, },
-    { { 186, 97, 8, 0 },
-      { 196, 32, 139, 1 },
-      { 8, 67, 46, 1 },
-      { 232, 130, 17, 1 }, },
-    { { 186, 97, 11, 1 },
-      { 204, 98, 139, 1 },
-      { 232, 67, 46, 1 },
-      { 232, 163, 25, 1 }, },
-    { { 186, 97, 4, 1 },
-      { 204, 32, 155, 0 },
-      { 144, 67, 46, 1 },
-      { 108, 130, 25, 1 }, },
-    { { 186, 97, 7, 0 },
-      { 196, 98, 155, 0 },
-      { 112, 67, 46, 1 },
-      { 108, 163, 17, 1 }, },
-    { { 186, 97, 120, 0 },
-      { 212, 164, 139, 1 },
-      { 15, 67, 46, 1 },
-      { 232, 146, 149, 1 }, },
-    { { 186, 97, 123, 1 },
-      { 220, 230, 139, 1 },
-      { 239, 67, 46, 1 },
-      { 232, 179, 157, 1 }, },
-    { { 186, 97, 116, 1 },
-      { 220, 164, 155, 0 },
-      { 151, 67, 46, 1 },
-      { 108, 146, 157, 1 }, },
-    { { 186, 97, 119, 0 },
-      { 212, 230, 155, 0 },
-      { 119, 67, 46, 1 },
-      { 108, 179, 149, 1 }, },
-    { { 186, 96, 152, 0 },
-      { 212, 32, 170, 1 },
-      { 12, 131, 46, 1 },
-      { 170, 130, 21, 1 }, },
-    { { 186, 96, 155, 1 },
-      { 220, 98, 170, 1 },
-      { 236, 131, 46, 1 },
-      { 170, 163, 29, 1 }, },
-    { { 186, 96, 148, 1 },
-      { 220, 32, 186, 0 },
-      { 148, 131, 46, 1 },
-      { 46, 130, 29, 1 }, },
-    { { 186, 96, 151, 0 },
-      { 212, 98, 186, 0 },
-      { 116, 131, 46, 1 },
-      { 46, 163, 21, 1 }, },
-    { { 186, 96, 232, 0 },
-      { 196, 164, 170, 1 },
-      { 11, 131, 46, 1 },
-      { 170, 146, 145, 1 }, },
-    { { 186, 96, 235, 1 },
-      { 204, 230, 170, 1 },
-      { 235, 131, 46, 1 },
-      { 170, 179, 153, 1 }, },
-    { { 186, 96, 228, 1 },
-      { 204, 164, 186, 0 },
-      { 147, 131, 46, 1 },
-      { 46, 146, 153, 1 }, },
-    { { 186, 96, 231, 0 },
-      { 196, 230, 186, 0 },
-      { 115, 131, 46, 1 },
-      { 46, 179, 145, 1 }, },
-    { { 186, 111, 8, 0 },
-      { 229, 40, 139, 1 },
-      { 8, 123, 46, 1 },
-      { 232, 138, 83, 1 }, },
-    { { 186, 111, 11, 1 },
-      { 237, 106, 139, 1 },
-      { 232, 123, 46, 1 },
-      { 232, 171, 91, 1 }, },
-    { { 186, 111, 4, 1 },
-      { 237, 40, 155, 0 },
-      { 144, 123, 46, 1 },
-      { 108, 138, 91, 1 }, },
-    { { 186, 111, 7, 0 },
-      { 229, 106, 155, 0 },
-      { 112, 123, 46, 1 },
-      { 108, 171, 83, 1 }, },
-    { { 186, 111, 120, 0 },
-      { 245, 172, 139, 1 },
-      { 15, 123, 46, 1 },
-      { 232, 154, 215, 1 }, },
-    { { 186, 111, 123, 1 },
-      { 253, 238, 139, 1 },
-      { 239, 123, 46, 1 },
-      { 232, 187, 223, 1 }, },
-    { { 186, 111, 116, 1 },
-      { 253, 172, 155, 0 },
-      { 151, 123, 46, 1 },
-      { 108, 154, 223, 1 }, },
-    { { 186, 111, 119, 0 },
-      { 245, 238, 155, 0 },
-      { 119, 123, 46, 1 },
-      { 108, 187, 215, 1 }, },
-    { { 186, 110, 152, 0 },
-      { 245, 40, 170, 1 },
-      { 12, 187, 46, 1 },
-      { 170, 138, 87, 1 }, },
-    { { 186, 110, 155, 1 },
-      { 253, 106, 170, 1 },
-      { 236, 187, 46, 1 },
-      { 170, 171, 95, 1 }, },
-    { { 186, 110, 148, 1 },
-      { 253, 40, 186, 0 },
-      { 148, 187, 46, 1 },
-      { 46, 138, 95, 1 }, },
-    { { 186, 110, 151, 0 },
-      { 245, 106, 186, 0 },
-      { 116, 187, 46, 1 },
-      { 46, 171, 87, 1 }, },
-    { { 186, 110, 232, 0 },
-      { 229, 172, 170, 1 },
-      { 11, 187, 46, 1 },
-      { 170, 154, 211, 1 }, },
-    { { 186, 110, 235, 1 },
-      { 237, 238, 170, 1 },
-      { 235, 187, 46, 1 },
-      { 170, 187, 219, 1 }, },
-    { { 186, 110, 228, 1 },
-      { 237, 172, 186, 0 },
-      { 147, 187, 46, 1 },
-      { 46, 154, 219, 1 }, },
-    { { 186, 110, 231, 0 },
-      { 229, 238, 186, 0 },
-      { 115, 187, 46, 1 },
-      { 46, 187, 211, 1 }, },
-    { { 186, 83, 8, 0 },
-      { 228, 32, 201, 1 },
-      { 8, 101, 46, 1 },
-      { 201, 130, 19, 1 }, },
-    { { 186, 83, 11, 1 },
-      { 236, 98, 201, 1 },
-      { 232, 101, 46, 1 },
-      { 201, 163, 27, 1 }, },
-    { { 186, 83, 4, 1 },
-      { 236, 32, 217, 0 },
-      { 144, 101, 46, 1 },
-      { 77, 130, 27, 1 }, },
-    { { 186, 83, 7, 0 },
-      { 228, 98, 217, 0 },
-      { 112, 101, 46, 1 },
-      { 77, 163, 19, 1 }, },
-    { { 186, 83, 120, 0 },
-      { 244, 164, 201, 1 },
-      { 15, 101, 46, 1 },
-      { 201, 146, 151, 1 }, },
-    { { 186, 83, 123, 1 },
-      { 252, 230, 201, 1 },
-      { 239, 101, 46, 1 },
-      { 201, 179, 159, 1 }, },
-    { { 186, 83, 116, 1 },
-      { 252, 164, 217, 0 },
-      { 151, 101, 46, 1 },
-      { 77, 146, 159, 1 }, },
-    { { 186, 83, 119, 0 },
-      { 244, 230, 217, 0 },
-      { 119, 101, 46, 1 },
-      { 77, 179, 151, 1 }, },
-    { { 186, 82, 152, 0 },
-      { 244, 32, 232, 1 },
-      { 12, 165, 46, 1 },
-      { 139, 130, 23, 1 }, },
-    { { 186, 82, 155, 1 },
-      { 252, 98, 232, 1 },
-      { 236, 165, 46, 1 },
-      { 139, 163, 31, 1 }, },
-    { { 186, 82, 148, 1 },
-      { 252, 32, 248, 0 },
-      { 148, 165, 46, 1 },
-      { 15, 130, 31, 1 }, },
-    { { 186, 82, 151, 0 },
-      { 244, 98, 248, 0 },
-      { 116, 165, 46, 1 },
-      { 15, 163, 23, 1 }, },
-    { { 186, 82, 232, 0 },
-      { 228, 164, 232, 1 },
-      { 11, 165, 46, 1 },
-      { 139, 146, 147, 1 }, },
-    { { 186, 82, 235, 1 },
-      { 236, 230, 232, 1 },
-      { 235, 165, 46, 1 },
-      { 139, 179, 155, 1 }, },
-    { { 186, 82, 228, 1 },
-      { 236, 164, 248, 0 },
-      { 147, 165, 46, 1 },
-      { 15, 146, 155, 1 }, },
-    { { 186, 82, 231, 0 },
-      { 228, 230, 248, 0 },
-      { 115, 165, 46, 1 },
-      { 15, 179, 147, 1 }, },
-    { { 186, 93, 8, 0 },
-      { 197, 40, 201, 1 },
-      { 8, 93, 46, 1 },
-      { 201, 138, 81, 1 }, },
-    { { 186, 93, 11, 1 },
-      { 205, 106, 201, 1 },
-      { 232, 93, 46, 1 },
-      { 201, 171, 89, 1 }, },
-    { { 186, 93, 4, 1 },
-      { 205, 40, 217, 0 },
-      { 144, 93, 46, 1 },
-      { 77, 138, 89, 1 }, },
-    { { 186, 93, 7, 0 },
-      { 197, 106, 217, 0 },
-      { 112, 93, 46, 1 },
-      { 77, 171, 81, 1 }, },
-    { { 186, 93, 120, 0 },
-      { 213, 172, 201, 1 },
-      { 15, 93, 46, 1 },
-      { 201, 154, 213, 1 }, },
-    { { 186, 93, 123, 1 },
-      { 221, 238, 201, 1 },
-      { 239, 93, 46, 1 },
-      { 201, 187, 221, 1 }, },
-    { { 186, 93, 116, 1 },
-      { 221, 172, 217, 0 },
-      { 151, 93, 46, 1 },
-      { 77, 154, 221, 1 }, },
-    { { 186, 93, 119, 0 },
-      { 213, 238, 217, 0 },
-      { 119, 93, 46, 1 },
-      { 77, 187, 213, 1 }, },
-    { { 186, 92, 152, 0 },
-      { 213, 40, 232, 1 },
-      { 12, 157, 46, 1 },
-      { 139, 138, 85, 1 }, },
-    { { 186, 92, 155, 1 },
-      { 221, 106, 232, 1 },
-      { 236, 157, 46, 1 },
-      { 139, 171, 93, 1 }, },
-    { { 186, 92, 148, 1 },
-      { 221, 40, 248, 0 },
-      { 148, 157, 46, 1 },
-      { 15, 138, 93, 1 }, },
-    { { 186, 92, 151, 0 },
-      { 213, 106, 248, 0 },
-      { 116, 157, 46, 1 },
-      { 15, 171, 85, 1 }, },
-    { { 186, 92, 232, 0 },
-      { 197, 172, 232, 1 },
-      { 11, 157, 46, 1 },
-      { 139, 154, 209, 1 }, },
-    { { 186, 92, 235, 1 },
-      { 205, 238, 232, 1 },
-      { 235, 157, 46, 1 },
-      { 139, 187, 217, 1 }, },
-    { { 186, 92, 228, 1 },
-      { 205, 172, 248, 0 },
-      { 147, 157, 46, 1 },
-      { 15, 154, 217, 1 }, },
-    { { 186, 92, 231, 0 },
-      { 197, 238, 248, 0 },
-      { 115, 157, 46, 1 },
-      { 15, 187, 209, 1 }, },
-    { { 187, 161, 8, 0 },
-      { 134, 48, 139, 1 },
-      { 8, 66, 238, 1 },
-      { 232, 134, 48, 1 }, },
-    { { 187, 161, 11, 1 },
-      { 142, 114, 139, 1 },
-      { 232, 66, 238, 1 },
-      { 232, 167, 56, 1 }, },
-    { { 187, 161, 4, 1 },
-      { 142, 48, 155, 0 },
-      { 144, 66, 238, 1 },
-      { 108, 134, 56, 1 }, },
-    { { 187, 161, 7, 0 },
-      { 134, 114, 155, 0 },
-      { 112, 66, 238, 1 },
-      { 108, 167, 48, 1 }, },
-    { { 187, 161, 120, 0 },
-      { 150, 180, 139, 1 },
-      { 15, 66, 238, 1 },
-      { 232, 150, 180, 1 }, },
-    { { 187, 161, 123, 1 },
-      { 158, 246, 139, 1 },
-      { 239, 66, 238, 1 },
-      { 232, 183, 188, 1 }, },
-    { { 187, 161, 116, 1 },
-      { 158, 180, 155, 0 },
-      { 151, 66, 238, 1 },
-      { 108, 150, 188, 1 }, },
-    { { 187, 161, 119, 0 },
-      { 150, 246, 155, 0 },
-      { 119, 66, 238, 1 },
-      { 108, 183, 180, 1 }, },
-    { { 187, 160, 152, 0 },
-      { 150, 48, 170, 1 },
-      { 12, 130, 238, 1 },
-      { 170, 134, 52, 1 }, },
-    { { 187, 160, 155, 1 },
-      { 158, 114, 170, 1 },
-      { 236, 130, 238, 1 },
-      { 170, 167, 60, 1 }, },
-    { { 187, 160, 148, 1 },
-      { 158, 48, 186, 0 },
-      { 148, 130, 238, 1 },
-      { 46, 134, 60, 1 }, },
-    { { 187, 160, 151, 0 },
-      { 150, 114, 186, 0 },
-      { 116, 130, 238, 1 },
-      { 46, 167, 52, 1 }, },
-    { { 187, 160, 232, 0 },
-      { 134, 180, 170, 1 },
-      { 11, 130, 238, 1 },
-      { 170, 150, 176, 1 }, },
-    { { 187, 160, 235, 1 },
-      { 142, 246, 170, 1 },
-      { 235, 130, 238, 1 },
-      { 170, 183, 184, 1 }, },
-    { { 187, 160, 228, 1 },
-      { 142, 180, 186, 0 },
-      { 147, 130, 238, 1 },
-      { 46, 150, 184, 1 }, },
-    { { 187, 160, 231, 0 },
-      { 134, 246, 186, 0 },
-      { 115, 130, 238, 1 },
-      { 46, 183, 176, 1 }, },
-    { { 187, 175, 8, 0 },
-      { 167, 56, 139, 1 },
-      { 8, 122, 238, 1 },
-      { 232, 142, 114, 1 }, },
-    { { 187, 175, 11, 1 },
-      { 175, 122, 139, 1 },
-      { 232, 122, 238, 1 },
-      { 232, 175, 122, 1 }, },
-    { { 187, 175, 4, 1 },
-      { 175, 56, 155, 0 },
-      { 144, 122, 238, 1 },
-      { 108, 142, 122, 1 }, },
-    { { 187, 175, 7, 0 },
-      { 167, 122, 155, 0 },
-      { 112, 122, 238, 1 },
-      { 108, 175, 114, 1 }, },
-    { { 187, 175, 120, 0 },
-      { 183, 188, 139, 1 },
-      { 15, 122, 238, 1 },
-      { 232, 158, 246, 1 }, },
-    { { 187, 175, 123, 1 },
-      { 191, 254, 139, 1 },
-      { 239, 122, 238, 1 },
-      { 232, 191, 254, 1 }, },
-    { { 187, 175, 116, 1 },
-      { 191, 188, 155, 0 },
-      { 151, 122, 238, 1 },
-      { 108, 158, 254, 1 }, },
-    { { 187, 175, 119, 0 },
-      { 183, 254, 155, 0 },
-      { 119, 122, 238, 1 },
-      { 108, 191, 246, 1 }, },
-    { { 187, 174, 152, 0 },
-      { 183, 56, 170, 1 },
-      { 12, 186, 238, 1 },
-      { 170, 142, 118, 1 }, },
-    { { 187, 174, 155, 1 },
-      { 191, 122, 170, 1 },
-      { 236, 186, 238, 1 },
-      { 170, 175, 126, 1 }, },
-    { { 187, 174, 148, 1 },
-      { 191, 56, 186, 0 },
-      { 148, 186, 238, 1 },
-      { 46, 142, 126, 1 }, },
-    { { 187, 174, 151, 0 },
-      { 183, 122, 186, 0 },
-      { 116, 186, 238, 1 },
-      { 46, 175, 118, 1 }, },
-    { { 187, 174, 232, 0 },
-      { 167, 188, 170, 1 },
-      { 11, 186, 238, 1 },
-      { 170, 158, 242, 1 }, },
-    { { 187, 174, 235, 1 },
-      { 175, 254, 170, 1 },
-      { 235, 186, 238, 1 },
-      { 170, 191, 250, 1 }, },
-    { { 187, 174, 228, 1 },
-      { 175, 188, 186, 0 },
-      { 147, 186, 238, 1 },
-      { 46, 158, 250, 1 }, },
-    { { 187, 174, 231, 0 },
-      { 167, 254, 186, 0 },
-      { 115, 186, 238, 1 },
-      { 46, 191, 242, 1 }, },
-    { { 187, 147, 8, 0 },
-      { 166, 48, 201, 1 },
-      { 8, 100, 238, 1 },
-      { 201, 134, 50, 1 }, },
-    { { 187, 147, 11, 1 },
-      { 174, 114, 201, 1 },
-      { 232, 100, 238, 1 },
-      { 201, 167, 58, 1 }, },
-    { { 187, 147, 4, 1 },
-      { 174, 48, 217, 0 },
-      { 144, 100, 238, 1 },
-      { 77, 134, 58, 1 }, },
-    { { 187, 147, 7, 0 },
-      { 166, 114, 217, 0 },
-      { 112, 100, 238, 1 },
-      { 77, 167, 50, 1 }, },
-    { { 187, 147, 120, 0 },
-      { 182, 180, 201, 1 },
-      { 15, 100, 238, 1 },
-      { 201, 150, 182, 1 }, },
-    { { 187, 147, 123, 1 },
-      { 190, 246, 201, 1 },
-      { 239, 100, 238, 1 },
-      { 201, 183, 190, 1 }, },
-    { { 187, 147, 116, 1 },
-      { 190, 180, 217, 0 },
-      { 151, 100, 238, 1 },
-      { 77, 150, 190, 1 }, },
-    { { 187, 147, 119, 0 },
-      { 182, 246, 217, 0 },
-      { 119, 100, 238, 1 },
-      { 77, 183, 182, 1 }, },
-    { { 187, 146, 152, 0 },
-      { 182, 48, 232, 1 },
-      { 12, 164, 238, 1 },
-      { 139, 134, 54, 1 }, },
-    { { 187, 146, 155, 1 },
-      { 190, 114, 232, 1 },
-      { 236, 164, 238, 1 },
-      { 139, 167, 62, 1 }, },
-    { { 187, 146, 148, 1 },
-      { 190, 48, 248, 0 },
-      { 148, 164, 238, 1 },
-      { 15, 134, 62, 1 }, },
-    { { 187, 146, 151, 0 },
-      { 182, 114, 248, 0 },
-      { 116, 164, 238, 1 },
-      { 15, 167, 54, 1 }, },
-    { { 187, 146, 232, 0 },
-      { 166, 180, 232, 1 },
-      { 11, 164, 238, 1 },
-      { 139, 150, 178, 1 }, },
-    { { 187, 146, 235, 1 },
-      { 174, 246, 232, 1 },
-      { 235, 164, 238, 1 },
-      { 139, 183, 186, 1 }, },
-    { { 187, 146, 228, 1 },
-      { 174, 180, 248, 0 },
-      { 147, 164, 238, 1 },
-      { 15, 150, 186, 1 }, },
-    { { 187, 146, 231, 0 },
-      { 166, 246, 248, 0 },
-      { 115, 164, 238, 1 },
-      { 15, 183, 178, 1 }, },
-    { { 187, 157, 8, 0 },
-      { 135, 56, 201, 1 },
-      { 8, 92, 238, 1 },
-      { 201, 142, 112, 1 }, },
-    { { 187, 157, 11, 1 },
-      { 143, 122, 201, 1 },
-      { 232, 92, 238, 1 },
-      { 201, 175, 120, 1 }, },
-    { { 187, 157, 4, 1 },
-      { 143, 56, 217, 0 },
-      { 144, 92, 238, 1 },
-      { 77, 142, 120, 1 }, },
-    { { 187, 157, 7, 0 },
-      { 135, 122, 217, 0 },
-      { 112, 92, 238, 1 },
-      { 77, 175, 112, 1 }, },
-    { { 187, 157, 120, 0 },
-      { 151, 188, 201, 1 },
-      { 15, 92, 238, 1 },
-      { 201, 158, 244, 1 }, },
-    { { 187, 157, 123, 1 },
-      { 159, 254, 201, 1 },
-      { 239, 92, 238, 1 },
-      { 201, 191, 252, 1 }, },
-    { { 187, 157, 116, 1 },
-      { 159, 188, 217, 0 },
-      { 151, 92, 238, 1 },
-      { 77, 158, 252, 1 }, },
-    { { 187, 157, 119, 0 },
-      { 151, 254, 217, 0 },
-      { 119, 92, 238, 1 },
-      { 77, 191, 244, 1 }, },
-    { { 187, 156, 152, 0 },
-      { 151, 56, 232, 1 },
-      { 12, 156, 238, 1 },
-      { 139, 142, 116, 1 }, },
-    { { 187, 156, 155, 1 },
-      { 159, 122, 232, 1 },
-      { 236, 156, 238, 1 },
-      { 139, 175, 124, 1 }, },
-    { { 187, 156, 148, 1 },
-      { 159, 56, 248, 0 },
-      { 148, 156, 238, 1 },
-      { 15, 142, 124, 1 }, },
-    { { 187, 156, 151, 0 },
-      { 151, 122, 248, 0 },
-      { 116, 156, 238, 1 },
-      { 15, 175, 116, 1 }, },
-    { { 187, 156, 232, 0 },
-      { 135, 188, 232, 1 },
-      { 11, 156, 238, 1 },
-      { 139, 158, 240, 1 }, },
-    { { 187, 156, 235, 1 },
-      { 143, 254, 232, 1 },
-      { 235, 156, 238, 1 },
-      { 139, 191, 248, 1 }, },
-    { { 187, 156, 228, 1 },
-      { 143, 188, 248, 0 },
-      { 147, 156, 238, 1 },
-      { 15, 158, 248, 1 }, },
-    { { 187, 156, 231, 0 },
-      { 135, 254, 248, 0 },
-      { 115, 156, 238, 1 },
-      { 15, 191, 240, 1 }, },
-    { { 76, 33, 8, 0 },
-      { 128, 1, 7, 1 },
-      { 8, 66, 25, 0 },
-      { 240, 64, 0, 1 }, },
-    { { 76, 33, 11, 1 },
-      { 136, 67, 7, 1 },
-      { 232, 66, 25, 0 },
-      { 240, 97, 8, 1 }, },
-    { { 76, 33, 4, 1 },
-      { 136, 1, 23, 0 },
-      { 144, 66, 25, 0 },
-      { 116, 64, 8, 1 }, },
-    { { 76, 33, 7, 0 },
-      { 128, 67, 23, 0 },
-      { 112, 66, 25, 0 },
-      { 116, 97, 0, 1 }, },
-    { { 76, 33, 120, 0 },
-      { 144, 133, 7, 1 },
-      { 15, 66, 25, 0 },
-      { 240, 80, 132, 1 }, },
-    { { 76, 33, 123, 1 },
-      { 152, 199, 7, 1 },
-      { 239, 66, 25, 0 },
-      { 240, 113, 140, 1 }, },
-    { { 76, 33, 116, 1 },
-      { 152, 133, 23, 0 },
-      { 151, 66, 25, 0 },
-      { 116, 80, 140, 1 }, },
-    { { 76, 33, 119, 0 },
-      { 144, 199, 23, 0 },
-      { 119, 66, 25, 0 },
-      { 116, 113, 132, 1 }, },
-    { { 76, 32, 152, 0 },
-      { 144, 1, 38, 1 },
-      { 12, 130, 25, 0 },
-      { 178, 64, 4, 1 }, },
-    { { 76, 32, 155, 1 },
-      { 152, 67, 38, 1 },
-      { 236, 130, 25, 0 },
-      { 178, 97, 12, 1 }, },
-    { { 76, 32, 148, 1 },
-      { 152, 1, 54, 0 },
-      { 148, 130, 25, 0 },
-      { 54, 64, 12, 1 }, },
-    { { 76, 32, 151, 0 },
-      { 144, 67, 54, 0 },
-      { 116, 130, 25, 0 },
-      { 54, 97, 4, 1 }, },
-    { { 76, 32, 232, 0 },
-      { 128, 133, 38, 1 },
-      { 11, 130, 25, 0 },
-      { 178, 80, 128, 1 }, },
-    { { 76, 32, 235, 1 },
-      { 136, 199, 38, 1 },
-      { 235, 130, 25, 0 },
-      { 178, 113, 136, 1 }, },
-    { { 76, 32, 228, 1 },
-      { 136, 133, 54, 0 },
-      { 147, 130, 25, 0 },
-      { 54, 80, 136, 1 }, },
-    { { 76, 32, 231, 0 },
-      { 128, 199, 54, 0 },
-      { 115, 130, 25, 0 },
-      { 54, 113, 128, 1 }, },
-    { { 76, 47, 8, 0 },
-      { 161, 9, 7, 1 },
-      { 8, 122, 25, 0 },
-      { 240, 72, 66, 1 }, },
-    { { 76, 47, 11, 1 },
-      { 169, 75, 7, 1 },
-      { 232, 122, 25, 0 },
-      { 240, 105, 74, 1 }, },
-    { { 76, 47, 4, 1 },
-      { 169, 9, 23, 0 },
-      { 144, 122, 25, 0 },
-      { 116, 72, 74, 1 }, },
-    { { 76, 47, 7, 0 },
-      { 161, 75, 23, 0 },
-      { 112, 122, 25, 0 },
-      { 116, 105, 66, 1 }, },
-    { { 76, 47, 120, 0 },
-      { 177, 141, 7, 1 },
-      { 15, 122, 25, 0 },
-      { 240, 88, 198, 1 }, },
-    { { 76, 47, 123, 1 },
-      { 185, 207, 7, 1 },
-      { 239, 122, 25, 0 },
-      { 240, 121, 206, 1 }, },
-    { { 76, 47, 116, 1 },
-      { 185, 141, 23, 0 },
-      { 151, 122, 25, 0 },
-      { 116, 88, 206, 1 }, },
-    { { 76, 47, 119, 0 },
-      { 177, 207, 23, 0 },
-      { 119, 122, 25, 0 },
-      { 116, 121, 198, 1 }, },
-    { { 76, 46, 152, 0 },
-      { 177, 9, 38, 1 },
-      { 12, 186, 25, 0 },
-      { 178, 72, 70, 1 }, },
-    { { 76, 46, 155, 1 },
-      { 185, 75, 38, 1 },
-      { 236, 186, 25, 0 },
-      { 178, 105, 78, 1 }, },
-    { { 76, 46, 148, 1 },
-      { 185, 9, 54, 0 },
-      { 148, 186, 25, 0 },
-      { 54, 72, 78, 1 }, },
-    { { 76, 46, 151, 0 },
-      { 177, 75, 54, 0 },
-      { 116, 186, 25, 0 },
-      { 54, 105, 70, 1 }, },
-    { { 76, 46, 232, 0 },
-      { 161, 141, 38, 1 },
-      { 11, 186, 25, 0 },
-      { 178, 88, 194, 1 }, },
-    { { 76, 46, 235, 1 },
-      { 169, 207, 38, 1 },
-      { 235, 186, 25, 0 },
-      { 178, 121, 202, 1 }, },
-    { { 76, 46, 228, 1 },
-      { 169, 141, 54, 0 },
-      { 147, 186, 25, 0 },
-      { 54, 88, 202, 1 }, },
-    { { 76, 46, 231, 0 },
-      { 161, 207, 54, 0 },
-      { 115, 186, 25, 0 },
-      { 54, 121, 194, 1 }, },
-    { { 76, 19, 8, 0 },
-      { 160, 1, 69, 1 },
-      { 8, 100, 25, 0 },
-      { 209, 64, 2, 1 }, },
-    { { 76, 19, 11, 1 },
-      { 168, 67, 69, 1 },
-      { 232, 100, 25, 0 },
-      { 209, 97, 10, 1 }, },
-    { { 76, 19, 4, 1 },
-      { 168, 1, 85, 0 },
-      { 144, 100, 25, 0 },
-      { 85, 64, 10, 1 }, },
-    { { 76, 19, 7, 0 },
-      { 160, 67, 85, 0 },
-      { 112, 100, 25, 0 },
-      { 85, 97, 2, 1 }, },
-    { { 76, 19, 120, 0 },
-      { 176, 133, 69, 1 },
-      { 15, 100, 25, 0 },
-      { 209, 80, 134, 1 }, },
-    { { 76, 19, 123, 1 },
-      { 184, 199, 69, 1 },
-      { 239, 100, 25, 0 },
-      { 209, 113, 142, 1 }, },
-    { { 76, 19, 116, 1 },
-      { 184, 133, 85, 0 },
-      { 151, 100, 25, 0 },
-      { 85, 80, 142, 1 }, },
-    { { 76, 19, 119, 0 },
-      { 176, 199, 85, 0 },
-      { 119, 100, 25, 0 },
-      { 85, 113, 134, 1 }, },
-    { { 76, 18, 152, 0 },
-      { 176, 1, 100, 1 },
-      { 12, 164, 25, 0 },
-      { 147, 64, 6, 1 }, },
-    { { 76, 18, 155, 1 },
-      { 184, 67, 100, 1 },
-      { 236, 164, 25, 0 },
-      { 147, 97, 14, 1 }, },
-    { { 76, 18, 148, 1 },
-      { 184, 1, 116, 0 },
-      { 148, 164, 25, 0 },
-      { 23, 64, 14, 1 }, },
-    { { 76, 18, 151, 0 },
-      { 176, 67, 116, 0 },
-      { 116, 164, 25, 0 },
-      { 23, 97, 6, 1 }, },
-    { { 76, 18, 232, 0 },
-      { 160, 133, 100, 1 },
-      { 11, 164, 25, 0 },
-      { 147, 80, 130, 1 }, },
-    { { 76, 18, 235, 1 },
-      { 168, 199, 100, 1 },
-      { 235, 164, 25, 0 },
-      { 147, 113, 138, 1 }, },
-    { { 76, 18, 228, 1 },
-      { 168, 133, 116, 0 },
-      { 147, 164, 25, 0 },
-      { 23, 80, 138, 1 }, },
-    { { 76, 18, 231, 0 },
-      { 160, 199, 116, 0 },
-      { 115, 164, 25, 0 },
-      { 23, 113, 130, 1 }, },
-    { { 76, 29, 8, 0 },
-      { 129, 9, 69, 1 },
-      { 8, 92, 25, 0 },
-      { 209, 72, 64, 1 }, },
-    { { 76, 29, 11, 1 },
-      { 137, 75, 69, 1 },
-      { 232, 92, 25, 0 },
-      { 209, 105, 72, 1 }, },
-    { { 76, 29, 4, 1 },
-      { 137, 9, 85, 0 },
-      { 144, 92, 25, 0 },
-      { 85, 72, 72, 1 }, },
-    { { 76, 29, 7, 0 },
-      { 129, 75, 85, 0 },
-      { 112, 92, 25, 0 },
-      { 85, 105, 64, 1 }, },
-    { { 76, 29, 120, 0 },
-      { 145, 141, 69, 1 },
-      { 15, 92, 25, 0 },
-      { 209, 88, 196, 1 }, },
-    { { 76, 29, 123, 1 },
-      { 153, 207, 69, 1 },
-      { 239, 92, 25, 0 },
-      { 209, 121, 204, 1 }, },
-    { { 76, 29, 116, 1 },
-      { 153, 141, 85, 0 },
-      { 151, 92, 25, 0 },
-      { 85, 88, 204, 1 }, },
-    { { 76, 29, 119, 0 },
-      { 145, 207, 85, 0 },
-      { 119, 92, 25, 0 },
-      { 85, 121, 196, 1 }, },
-    { { 76, 28, 152, 0 },
-      { 145, 9, 100, 1 },
-      { 12, 156, 25, 0 },
-      { 147, 72, 68, 1 }, },
-    { { 76, 28, 155, 1 },
-      { 153, 75, 100, 1 },
-      { 236, 156, 25, 0 },
-      { 147, 105, 76, 1 }, },
-    { { 76, 28, 148, 1 },
-      { 153, 9, 116, 0 },
-      { 148, 156, 25, 0 },
-      { 23, 72, 76, 1 }, },
-    { { 76, 28, 151, 0 },
-      { 145, 75, 116, 0 },
-      { 116, 156, 25, 0 },
-      { 23, 105, 68, 1 }, },
-    { { 76, 28, 232, 0 },
-      { 129, 141, 100, 1 },
-      { 11, 156, 25, 0 },
-      { 147, 88, 192, 1 }, },
-    { { 76, 28, 235, 1 },
-      { 137, 207, 100, 1 },
-      { 235, 156, 25, 0 },
-      { 147, 121, 200, 1 }, },
-    { { 76, 28, 228, 1 },
-      { 137, 141, 116, 0 },
-      { 147, 156, 25, 0 },
-      { 23, 88, 200, 1 }, },
-    { { 76, 28, 231, 0 },
-      { 129, 207, 116, 0 },
-      { 115, 156, 25, 0 },
-      { 23, 121, 192, 1 }, },
-    { { 77, 225, 8, 0 },
-      { 194, 17, 7, 1 },
-      { 8, 67, 217, 0 },
-      { 240, 68, 33, 1 }, },
-    { { 77, 225, 11, 1 },
-      { 202, 83, 7, 1 },
-      { 232, 67, 217, 0 },
-      { 240, 101, 41, 1 }, },
-    { { 77, 225, 4, 1 },
-      { 202, 17, 23, 0 },
-      { 144, 67, 217, 0 },
-      { 116, 68, 41, 1 }, },
-    { { 77, 225, 7, 0 },
-      { 194, 83, 23, 0 },
-      { 112, 67, 217, 0 },
-      { 116, 101, 33, 1 }, },
-    { { 77, 225, 120, 0 },
-      { 210, 149, 7, 1 },
-      { 15, 67, 217, 0 },
-      { 240, 84, 165, 1 }, },
-    { { 77, 225, 123, 1 },
-      { 218, 215, 7, 1 },
-      { 239, 67, 217, 0 },
-      { 240, 117, 173, 1 }, },
-    { { 77, 225, 116, 1 },
-      { 218, 149, 23, 0 },
-      { 151, 67, 217, 0 },
-      { 116, 84, 173, 1 }, },
-    { { 77, 225, 119, 0 },
-      { 210, 215, 23, 0 },
-      { 119, 67, 217, 0 },
-      { 116, 117, 165, 1 }, },
-    { { 77, 224, 152, 0 },
-      { 210, 17, 38, 1 },
-      { 12, 131, 217, 0 },
-      { 178, 68, 37, 1 }, },
-    { { 77, 224, 155, 1 },
-      { 218, 83, 38, 1 },
-      { 236, 131, 217, 0 },
-      { 178, 101, 45, 1 }, },
-    { { 77, 224, 148, 1 },
-      { 218, 17, 54, 0 },
-      { 148, 131, 217, 0 },
-      { 54, 68, 45, 1 }, },
-    { { 77, 224, 151, 0 },
-      { 210, 83, 54, 0 },
-      { 116, 131, 217, 0 },
-      { 54, 101, 37, 1 }, },
-    { { 77, 224, 232, 0 },
-      { 194, 149, 38, 1 },
-      { 11, 131, 217, 0 },
-      { 178, 84, 161, 1 }, },
-    { { 77, 224, 235, 1 },
-      { 202, 215, 38, 1 },
-      { 235, 131, 217, 0 },
-      { 178, 117, 169, 1 }, },
-    { { 77, 224, 228, 1 },
-      { 202, 149, 54, 0 },
-      { 147, 131, 217, 0 },
-      { 54, 84, 169, 1 }, },
-    { { 77, 224, 231, 0 },
-      { 194, 215, 54, 0 },
-      { 115, 131, 217, 0 },
-      { 54, 117, 161, 1 }, },
-    { { 77, 239, 8, 0 },
-      { 227, 25, 7, 1 },
-      { 8, 123, 217, 0 },
-      { 240, 76, 99, 1 }, },
-    { { 77, 239, 11, 1 },
-      { 235, 91, 7, 1 },
-      { 232, 123, 217, 0 },
-      { 240, 109, 107, 1 }, },
-    { { 77, 239, 4, 1 },
-      { 235, 25, 23, 0 },
-      { 144, 123, 217, 0 },
-      { 116, 76, 107, 1 }, },
-    { { 77, 239, 7, 0 },
-      { 227, 91, 23, 0 },
-      { 112, 123, 217, 0 },
-      { 116, 109, 99, 1 }, },
-    { { 77, 239, 120, 0 },
-      { 243, 157, 7, 1 },
-      { 15, 123, 217, 0 },
-      { 240, 92, 231, 1 }, },
-    { { 77, 239, 123, 1 },
-      { 251, 223, 7, 1 },
-      { 239, 123, 217, 0 },
-      { 240, 125, 239, 1 }, },
-    { { 77, 239, 116, 1 },
-      { 251, 157, 23, 0 },
-      { 151, 123, 217, 0 },
-      { 116, 92, 239, 1 }, },
-    { { 77, 239, 119, 0 },
-      { 243, 223, 23, 0 },
-      { 119, 123, 217, 0 },
-      { 116, 125, 231, 1 }, },
-    { { 77, 238, 152, 0 },
-      { 243, 25, 38, 1 },
-      { 12, 187, 217, 0 },
-      { 178, 76, 103, 1 }, },
-    { { 77, 238, 155, 1 },
-      { 251, 91, 38, 1 },
-      { 236, 187, 217, 0 },
-      { 178, 109, 111, 1 }, },
-    { { 77, 238, 148, 1 },
-      { 251, 25, 54, 0 },
-      { 148, 187, 217, 0 },
-      { 54, 76, 111, 1 }, },
-    { { 77, 238, 151, 0 },
-      { 243, 91, 54, 0 },
-      { 116, 187, 217, 0 },
-      { 54, 109, 103, 1 }, },
-    { { 77, 238, 232, 0 },
-      { 227, 157, 38, 1 },
-      { 11, 187, 217, 0 },
-      { 178, 92, 227, 1 }, },
-    { { 77, 238, 235, 1 },
-      { 235, 223, 38, 1 },
-      { 235, 187, 217, 0 },
-      { 178, 125, 235, 1 }, },
-    { { 77, 238, 228, 1 },
-      { 235, 157, 54, 0 },
-      { 147, 187, 217, 0 },
-      { 54, 92, 235, 1 }, },
-    { { 77, 238, 231, 0 },
-      { 227, 223, 54, 0 },
-      { 115, 187, 217, 0 },
-      { 54, 125, 227, 1 }, },
-    { { 77, 211, 8, 0 },
-      { 226, 17, 69, 1 },
-      { 8, 101, 217, 0 },
-      { 209, 68, 35, 1 }, },
-    { { 77, 211, 11, 1 },
-      { 234, 83, 69, 1 },
-      { 232, 101, 217, 0 },
-      { 209, 101, 43, 1 }, },
-    { { 77, 211, 4, 1 },
-      { 234, 17, 85, 0 },
-      { 144, 101, 217, 0 },
-      { 85, 68, 43, 1 }, },
-    { { 77, 211, 7, 0 },
-      { 226, 83, 85, 0 },
-      { 112, 101, 217, 0 },
-      { 85, 101, 35, 1 }, },
-    { { 77, 211, 120, 0 },
-      { 242, 149, 69, 1 },
-      { 15, 101, 217, 0 },
-      { 209, 84, 167, 1 }, },
-    { { 77, 211, 123, 1 },
-      { 250, 215, 69, 1 },
-      { 239, 101, 217, 0 },
-      { 209, 117, 175, 1 }, },
-    { { 77, 211, 116, 1 },
-      { 250, 149, 85, 0 },
-      { 151, 101, 217, 0 },
-      { 85, 84, 175, 1 }, },
-    { { 77, 211, 119, 0 },
-      { 242, 215, 85, 0 },
-      { 119, 101, 217, 0 },
-      { 85, 117, 167, 1 }, },
-    { { 77, 210, 152, 0 },
-      { 242, 17, 100, 1 },
-      { 12, 165, 217, 0 },
-      { 147, 68, 39, 1 }, },
-    { { 77, 210, 155, 1 },
-      { 250, 83, 100, 1 },
-      { 236, 165, 217, 0 },
-      { 147, 101, 47, 1 }, },
-    { { 77, 210, 148, 1 },
-      { 250, 17, 116, 0 },
-      { 148, 165, 217, 0 },
-      { 23, 68, 47, 1 }, },
-    { { 77, 210, 151, 0 },
-      { 242, 83, 116, 0 },
-      { 116, 165, 217, 0 },
-      { 23, 101, 39, 1 }, },
-    { { 77, 210, 232, 0 },
-      { 226, 149, 100, 1 },
-      { 11, 165, 217, 0 },
-      { 147, 84, 163, 1 }, },
-    { { 77, 210, 235, 1 },
-      { 234, 215, 100, 1 },
-      { 235, 165, 217, 0 },
-      { 147, 117, 171, 1 }, },
-    { { 77, 210, 228, 1 },
-      { 234, 149, 116, 0 },
-      { 147, 165, 217, 0 },
-      { 23, 84, 171, 1 }, },
-    { { 77, 210, 231, 0 },
-      { 226, 215, 116, 0 },
-      { 115, 165, 217, 0 },
-      { 23, 117, 163, 1 }, },
-    { { 77, 221, 8, 0 },
-      { 195, 25, 69, 1 },
-      { 8, 93, 217, 0 },
-      { 209, 76, 97, 1 }, },
-    { { 77, 221, 11, 1 },
-      { 203, 91, 69, 1 },
-      { 232, 93, 217, 0 },
-      { 209, 109, 105, 1 }, },
-    { { 77, 221, 4, 1 },
-      { 203, 25, 85, 0 },
-      { 144, 93, 217, 0 },
-      { 85, 76, 105, 1 }, },
-    { { 77, 221, 7, 0 },
-      { 195, 91, 85, 0 },
-      { 112, 93, 217, 0 },
-      { 85, 109, 97, 1 }, },
-    { { 77, 221, 120, 0 },
-      { 211, 157, 69, 1 },
-      { 15, 93, 217, 0 },
-      { 209, 92, 229, 1 }, },
-    { { 77, 221, 123, 1 },
-      { 219, 223, 69, 1 },
-      { 239, 93, 217, 0 },
-      { 209, 125, 237, 1 }, },
-    { { 77, 221, 116, 1 },
-      { 219, 157, 85, 0 },
-      { 151, 93, 217, 0 },
-      { 85, 92, 237, 1 }, },
-    { { 77, 221, 119, 0 },
-      { 211, 223, 85, 0 },
-      { 119, 93, 217, 0 },
-      { 85, 125, 229, 1 }, },
-    { { 77, 220, 152, 0 },
-      { 211, 25, 100, 1 },
-      { 12, 157, 217, 0 },
-      { 147, 76, 101, 1 }, },
-    { { 77, 220, 155, 1 },
-      { 219, 91, 100, 1 },
-      { 236, 157, 217, 0 },
-      { 147, 109, 109, 1 }, },
-    { { 77, 220, 148, 1 },
-      { 219, 25, 116, 0 },
-      { 148, 157, 217, 0 },
-      { 23, 76, 109, 1 }, },
-    { { 77, 220, 151, 0 },
-      { 211, 91, 116, 0 },
-      { 116, 157, 217, 0 },
-      { 23, 109, 101, 1 }, },
-    { { 77, 220, 232, 0 },
-      { 195, 157, 100, 1 },
-      { 11, 157, 217, 0 },
-      { 147, 92, 225, 1 }, },
-    { { 77, 220, 235, 1 },
-      { 203, 223, 100, 1 },
-      { 235, 157, 217, 0 },
-      { 147, 125, 233, 1 }, },
-    { { 77, 220, 228, 1 },
-      { 203, 157, 116, 0 },
-      { 147, 157, 217, 0 },
-      { 23, 92, 233, 1 }, },
-    { { 77, 220, 231, 0 },
-      { 195, 223, 116, 0 },
-      { 115, 157, 217, 0 },
-      { 23, 125, 225, 1 }, },
-    { { 74, 97, 8, 0 },
-      { 192, 1, 131, 1 },
-      { 8, 67, 41, 0 },
-      { 224, 192, 1, 1 }, },
-    { { 74, 97, 11, 1 },
-      { 200, 67, 131, 1 },
-      { 232, 67, 41, 0 },
-      { 224, 225, 9, 1 }, },
-    { { 74, 97, 4, 1 },
-      { 200, 1, 147, 0 },
-      { 144, 67, 41, 0 },
-      { 100, 192, 9, 1 }, },
-    { { 74, 97, 7, 0 },
-      { 192, 67, 147, 0 },
-      { 112, 67, 41, 0 },
-      { 100, 225, 1, 1 }, },
-    { { 74, 97, 120, 0 },
-      { 208, 133, 131, 1 },
-      { 15, 67, 41, 0 },
-      { 224, 208, 133, 1 }, },
-    { { 74, 97, 123, 1 },
-      { 216, 199, 131, 1 },
-      { 239, 67, 41, 0 },
-      { 224, 241, 141, 1 }, },
-    { { 74, 97, 116, 1 },
-      { 216, 133, 147, 0 },
-      { 151, 67, 41, 0 },
-      { 100, 208, 141, 1 }, },
-    { { 74, 97, 119, 0 },
-      { 208, 199, 147, 0 },
-      { 119, 67, 41, 0 },
-      { 100, 241, 133, 1 }, },
-    { { 74, 96, 152, 0 },
-      { 208, 1, 162, 1 },
-      { 12, 131, 41, 0 },
-      { 162, 192, 5, 1 }, },
-    { { 74, 96, 155, 1 },
-      { 216, 67, 162, 1 },
-      { 236, 131, 41, 0 },
-      { 162, 225, 13, 1 }, },
-    { { 74, 96, 148, 1 },
-      { 216, 1, 178, 0 },
-      { 148, 131, 41, 0 },
-      { 38, 192, 13, 1 }, },
-    { { 74, 96, 151, 0 },
-      { 208, 67, 178, 0 },
-      { 116, 131, 41, 0 },
-      { 38, 225, 5, 1 }, },
-    { { 74, 96, 232, 0 },
-      { 192, 133, 162, 1 },
-      { 11, 131, 41, 0 },
-      { 162, 208, 129, 1 }, },
-    { { 74, 96, 235, 1 },
-      { 200, 199, 162, 1 },
-      { 235, 131, 41, 0 },
-      { 162, 241, 137, 1 }, },
-    { { 74, 96, 228, 1 },
-      { 200, 133, 178, 0 },
-      { 147, 131, 41, 0 },
-      { 38, 208, 137, 1 }, },
-    { { 74, 96, 231, 0 },
-      { 192, 199, 178, 0 },
-      { 115, 131, 41, 0 },
-      { 38, 241, 129, 1 }, },
-    { { 74, 111, 8, 0 },
-      { 225, 9, 131, 1 },
-      { 8, 123, 41, 0 },
-      { 224, 200, 67, 1 }, },
-    { { 74, 111, 11, 1 },
-      { 233, 75, 131, 1 },
-      { 232, 123, 41, 0 },
-      { 224, 233, 75, 1 }, },
-    { { 74, 111, 4, 1 },
-      { 233, 9, 147, 0 },
-      { 144, 123, 41, 0 },
-      { 100, 200, 75, 1 }, },
-    { { 74, 111, 7, 0 },
-      { 225, 75, 147, 0 },
-      { 112, 123, 41, 0 },
-      { 100, 233, 67, 1 }, },
-    { { 74, 111, 120, 0 },
-      { 241, 141, 131, 1 },
-      { 15, 123, 41, 0 },
-      { 224, 216, 199, 1 }, },
-    { { 74, 111, 123, 1 },
-      { 249, 207, 131, 1 },
-      { 239, 123, 41, 0 },
-      { 224, 249, 207, 1 }, },
-    { { 74, 111, 116, 1 },
-      { 249, 141, 147, 0 },
-      { 151, 123, 41, 0 },
-      { 100, 216, 207, 1 }, },
-    { { 74, 111, 119, 0 },
-      { 241, 207, 147, 0 },
-      { 119, 123, 41, 0 },
-      { 100, 249, 199, 1 }, },
-    { { 74, 110, 152, 0 },
-      { 241, 9, 162, 1 },
-      { 12, 187, 41, 0 },
-      { 162, 200, 71, 1 }, },
-    { { 74, 110, 155, 1 },
-      { 249, 75, 162, 1 },
-      { 236, 187, 41, 0 },
-      { 162, 233, 79, 1 }, },
-    { { 74, 110, 148, 1 },
-      { 249, 9, 178, 0 },
-      { 148, 187, 41, 0 },
-      { 38, 200, 79, 1 }, },
-    { { 74, 110, 151, 0 },
-      { 241, 75, 178, 0 },
-      { 116, 187, 41, 0 },
-      { 38, 233, 71, 1 }, },
-    { { 74, 110, 232, 0 },
-      { 225, 141, 162, 1 },
-      { 11, 187, 41, 0 },
-      { 162, 216, 195, 1 }, },
-    { { 74, 110, 235, 1 },
-      { 233, 207, 162, 1 },
-      { 235, 187, 41, 0 },
-      { 162, 249, 203, 1 }, },
-    { { 74, 110, 228, 1 },
-      { 233, 141, 178, 0 },
-      { 147, 187, 41, 0 },
-      { 38, 216, 203, 1 }, },
-    { { 74, 110, 231, 0 },
-      { 225, 207, 178, 0 },
-      { 115, 187, 41, 0 },
-      { 38, 249, 195, 1 }, },
-    { { 74, 83, 8, 0 },
-      { 224, 1, 193, 1 },
-      { 8, 101, 41, 0 },
-      { 193, 192, 3, 1 }, },
-    { { 74, 83, 11, 1 },
-      { 232, 67, 193, 1 },
-      { 232, 101, 41, 0 },
-      { 193, 225, 11, 1 }, },
-    { { 74, 83, 4, 1 },
-      { 232, 1, 209, 0 },
-      { 144, 101, 41, 0 },
-      { 69, 192, 11, 1 }, },
-    { { 74, 83, 7, 0 },
-      { 224, 67, 209, 0 },
-      { 112, 101, 41, 0 },
-      { 69, 225, 3, 1 }, },
-    { { 74, 83, 120, 0 },
-      { 240, 133, 193, 1 },
-      { 15, 101, 41, 0 },
-      { 193, 208, 135, 1 }, },
-    { { 74, 83, 123, 1 },
-      { 248, 199, 193, 1 },
-      { 239, 101, 41, 0 },
-      { 193, 241, 143, 1 }, },
-    { { 74, 83, 116, 1 },
-      { 248, 133, 209, 0 },
-      { 151, 101, 41, 0 },
-      { 69, 208, 143, 1 }, },
-    { { 74, 83, 119, 0 },
-      { 240, 199, 209, 0 },
-      { 119, 101, 41, 0 },
-      { 69, 241, 135, 1 }, },
-    { { 74, 82, 152, 0 },
-      { 240, 1, 224, 1 },
-      { 12, 165, 41, 0 },
-      { 131, 192, 7, 1 }, },
-    { { 74, 82, 155, 1 },
-      { 248, 67, 224, 1 },
-      { 236, 165, 41, 0 },
-      { 131, 225, 15, 1 }, },
-    { { 74, 82, 148, 1 },
-      { 248, 1, 240, 0 },
-      { 148, 165, 41, 0 },
-      { 7, 192, 15, 1 }, },
-    { { 74, 82, 151, 0 },
-      { 240, 67, 240, 0 },
-      { 116, 165, 41, 0 },
-      { 7, 225, 7, 1 }, },
-    { { 74, 82, 232, 0 },
-      { 224, 133, 224, 1 },
-      { 11, 165, 41, 0 },
-      { 131, 208, 131, 1 }, },
-    { { 74, 82, 235, 1 },
-      { 232, 199, 224, 1 },
-      { 235, 165, 41, 0 },
-      { 131, 241, 139, 1 }, },
-    { { 74, 82, 228, 1 },
-      { 232, 133, 240, 0 },
-      { 147, 165, 41, 0 },
-      { 7, 208, 139, 1 }, },
-    { { 74, 82, 231, 0 },
-      { 224, 199, 240, 0 },
-      { 115, 165, 41, 0 },
-      { 7, 241, 131, 1 }, },
-    { { 74, 93, 8, 0 },
-      { 193, 9, 193, 1 },
-      { 8, 93, 41, 0 },
-      { 193, 200, 65, 1 }, },
-    { { 74, 93, 11, 1 },
-      { 201, 75, 193, 1 },
-      { 232, 93, 41, 0 },
-      { 193, 233, 73, 1 }, },
-    { { 74, 93, 4, 1 },
-      { 201, 9, 209, 0 },
-      { 144, 93, 41, 0 },
-      { 69, 200, 73, 1 }, },
-    { { 74, 93, 7, 0 },
-      { 193, 75, 209, 0 },
-      { 112, 93, 41, 0 },
-      { 69, 233, 65, 1 }, },
-    { { 74, 93, 120, 0 },
-      { 209, 141, 193, 1 },
-      { 15, 93, 41, 0 },
-      { 193, 216, 197, 1 }, },
-    { { 74, 93, 123, 1 },
-      { 217, 207, 193, 1 },
-      { 239, 93, 41, 0 },
-      { 193, 249, 205, 1 }, },
-    { { 74, 93, 116, 1 },
-      { 217, 141, 209, 0 },
-      { 151, 93, 41, 0 },
-      { 69, 216, 205, 1 }, },
-    { { 74, 93, 119, 0 },
-      { 209, 207, 209, 0 },
-      { 119, 93, 41, 0 },
-      { 69, 249, 197, 1 }, },
-    { { 74, 92, 152, 0 },
-      { 209, 9, 224, 1 },
-      { 12, 157, 41, 0 },
-      { 131, 200, 69, 1 }, },
-    { { 74, 92, 155, 1 },
-      { 217, 75, 224, 1 },
-      { 236, 157, 41, 0 },
-      { 131, 233, 77, 1 }, },
-    { { 74, 92, 148, 1 },
-      { 217, 9, 240, 0 },
-      { 148, 157, 41, 0 },
-      { 7, 200, 77, 1 }, },
-    { { 74, 92, 151, 0 },
-      { 209, 75, 240, 0 },
-      { 116, 157, 41, 0 },
-      { 7, 233, 69, 1 }, },
-    { { 74, 92, 232, 0 },
-      { 193, 141, 224, 1 },
-      { 11, 157, 41, 0 },
-      { 131, 216, 193, 1 }, },
-    { { 74, 92, 235, 1 },
-      { 201, 207, 224, 1 },
-      { 235, 157, 41, 0 },
-      { 131, 249, 201, 1 }, },
-    { { 74, 92, 228, 1 },
-      { 201, 141, 240, 0 },
-      { 147, 157, 41, 0 },
-      { 7, 216, 201, 1 }, },
-    { { 74, 92, 231, 0 },
-      { 193, 207, 240, 0 },
-      { 115, 157, 41, 0 },
-      { 7, 249, 193, 1 }, },
-    { { 75, 161, 8, 0 },
-      { 130, 17, 131, 1 },
-      { 8, 66, 233, 0 },
-      { 224, 196, 32, 1 }, },
-    { { 75, 161, 11, 1 },
-      { 138, 83, 131, 1 },
-      { 232, 66, 233, 0 },
-      { 224, 229, 40, 1 }, },
-    { { 75, 161, 4, 1 },
-      { 138, 17, 147, 0 },
-      { 144, 66, 233, 0 },
-      { 100, 196, 40, 1 }, },
-    { { 75, 161, 7, 0 },
-      { 130, 83, 147, 0 },
-      { 112, 66, 233, 0 },
-      { 100, 229, 32, 1 }, },
-    { { 75, 161, 120, 0 },
-      { 146, 149, 131, 1 },
-      { 15, 66, 233, 0 },
-      { 224, 212, 164, 1 }, },
-    { { 75, 161, 123, 1 },
-      { 154, 215, 131, 1 },
-      { 239, 66, 233, 0 },
-      { 224, 245, 172, 1 }, },
-    { { 75, 161, 116, 1 },
-      { 154, 149, 147, 0 },
-      { 151, 66, 233, 0 },
-      { 100, 212, 172, 1 }, },
-    { { 75, 161, 119, 0 },
-      { 146, 215, 147, 0 },
-      { 119, 66, 233, 0 },
-      { 100, 245, 164, 1 }, },
-    { { 75, 160, 152, 0 },
-      { 146, 17, 162, 1 },
-      { 12, 130, 233, 0 },
-      { 162, 196, 36, 1 }, },
-    { { 75, 160, 155, 1 },
-      { 154, 83, 162, 1 },
-      { 236, 130, 233, 0 },
-      { 162, 229, 44, 1 }, },
-    { { 75, 160, 148, 1 },
-      { 154, 17, 178, 0 },
-      { 148, 130, 233, 0 },
-      { 38, 196, 44, 1 }, },
-    { { 75, 160, 151, 0 },
-      { 146, 83, 178, 0 },
-      { 116, 130, 233, 0 },
-      { 38, 229, 36, 1 }, },
-    { { 75, 160, 232, 0 },
-      { 130, 149, 162, 1 },
-      { 11, 130, 233, 0 },
-      { 162, 212, 160, 1 }, },
-    { { 75, 160, 235, 1 },
-      { 138, 215, 162, 1 },
-      { 235, 130, 233, 0 },
-      { 162, 245, 168, 1 }, },
-    { { 75, 160, 228, 1 },
-      { 138, 149, 178, 0 },
-      { 147, 130, 233, 0 },
-      { 38, 212, 168, 1 }, },
-    { { 75, 160, 231, 0 },
-      { 130, 215, 178, 0 },
-      { 115, 130, 233, 0 },
-      { 38, 245, 160, 1 }, },
-    { { 75, 175, 8, 0 },
-      { 163, 25, 131, 1 },
-      { 8, 122, 233, 0 },
-      { 224, 204, 98, 1 }, },
-    { { 75, 175, 11, 1 },
-      { 171, 91, 131, 1 },
-      { 232, 122, 233, 0 },
-      { 224, 237, 106, 1 }, },
-    { { 75, 175, 4, 1 },
-      { 171, 25, 147, 0 },
-      { 144, 122, 233, 0 },
-      { 100, 204, 106, 1 }, },
-    { { 75, 175, 7, 0 },
-      { 163, 91, 147, 0 },
-      { 112, 122, 233, 0 },
-      { 100, 237, 98, 1 }, },
-    { { 75, 175, 120, 0 },
-      { 179, 157, 131, 1 },
-      { 15, 122, 233, 0 },
-      { 224, 220, 230, 1 }, },
-    { { 75, 175, 123, 1 },
-      { 187, 223, 131, 1 },
-      { 239, 122, 233, 0 },
-      { 224, 253, 238, 1 }, },
-    { { 75, 175, 116, 1 },
-      { 187, 157, 147, 0 },
-      { 151, 122, 233, 0 },
-      { 100, 220, 238, 1 }, },
-    { { 75, 175, 119, 0 },
-      { 179, 223, 147, 0 },
-      { 119, 122, 233, 0 },
-      { 100, 253, 230, 1 }, },
-    { { 75, 174, 152, 0 },
-      { 179, 25, 162, 1 },
-      { 12, 186, 233, 0 },
-      { 162, 204, 102, 1 }, },
-    { { 75, 174, 155, 1 },
-      { 187, 91, 162, 1 },
-      { 236, 186, 233, 0 },
-      { 162, 237, 110, 1 }, },
-    { { 75, 174, 148, 1 },
-      { 187, 25, 178, 0 },
-      { 148, 186, 233, 0 },
-      { 38, 204, 110, 1 }, },
-    { { 75, 174, 151, 0 },
-      { 179, 91, 178, 0 },
-      { 116, 186, 233, 0 },
-      { 38, 237, 102, 1 }, },
-    { { 75, 174, 232, 0 },
-      { 163, 157, 162, 1 },
-      { 11, 186, 233, 0 },
-      { 162, 220, 226, 1 }, },
-    { { 75, 174, 235, 1 },
-      { 171, 223, 162, 1 },
-      { 235, 186, 233, 0 },
-      { 162, 253, 234, 1 }, },
-    { { 75, 174, 228, 1 },
-      { 171, 157, 178, 0 },
-      { 147, 186, 233, 0 },
-      { 38, 220, 234, 1 }, },
-    { { 75, 174, 231, 0 },
-      { 163, 223, 178, 0 },
-      { 115, 186, 233, 0 },
-      { 38, 253, 226, 1 }, },
-    { { 75, 147, 8, 0 },
-      { 162, 17, 193, 1 },
-      { 8, 100, 233, 0 },
-      { 193, 196, 34, 1 }, },
-    { { 75, 147, 11, 1 },
-      { 170, 83, 193, 1 },
-      { 232, 100, 233, 0 },
-      { 193, 229, 42, 1 }, },
-    { { 75, 147, 4, 1 },
-      { 170, 17, 209, 0 },
-      { 144, 100, 233, 0 },
-      { 69, 196, 42, 1 }, },
-    { { 75, 147, 7, 0 },
-      { 162, 83, 209, 0 },
-      { 112, 100, 233, 0 },
-      { 69, 229, 34, 1 }, },
-    { { 75, 147, 120, 0 },
-      { 178, 149, 193, 1 },
-      { 15, 100, 233, 0 },
-      { 193, 212, 166, 1 }, },
-    { { 75, 147, 123, 1 },
-      { 186, 215, 193, 1 },
-      { 239, 100, 233, 0 },
-      { 193, 245, 174, 1 }, },
-    { { 75, 147, 116, 1 },
-      { 186, 149, 209, 0 },
-      { 151, 100, 233, 0 },
-      { 69, 212, 174, 1 }, },
-    { { 75, 147, 119, 0 },
-      { 178, 215, 209, 0 },
-      { 119, 100, 233, 0 },
-      { 69, 245, 166, 1 }, },
-    { { 75, 146, 152, 0 },
-      { 178, 17, 224, 1 },
-      { 12, 164, 233, 0 },
-      { 131, 196, 38, 1 }, },
-    { { 75, 146, 155, 1 },
-      { 186, 83, 224, 1 },
-      { 236, 164, 233, 0 },
-      { 131, 229, 46, 1 }, },
-    { { 75, 146, 148, 1 },
-      { 186, 17, 240, 0 },
-      { 148, 164, 233, 0 },
-      { 7, 196, 46, 1 }, },
-    { { 75, 146, 151, 0 },
-      { 178, 83, 240, 0 },
-      { 116, 164, 233, 0 },
-      { 7, 229, 38, 1 }, },
-    { { 75, 146, 232, 0 },
-      { 162, 149, 224, 1 },
-      { 11, 164, 233, 0 },
-      { 131, 212, 162, 1 }, },
-    { { 75, 146, 235, 1 },
-      { 170, 215, 224, 1 },
-      { 235, 164, 233, 0 },
-      { 131, 245, 170, 1 }, },
-    { { 75, 146, 228, 1 },
-      { 170, 149, 240, 0 },
-      { 147, 164, 233, 0 },
-      { 7, 212, 170, 1 }, },
-    { { 75, 146, 231, 0 },
-      { 162, 215, 240, 0 },
-      { 115, 164, 233, 0 },
-      { 7, 245, 162, 1 }, },
-    { { 75, 157, 8, 0 },
-      { 131, 25, 193, 1 },
-      { 8, 92, 233, 0 },
-      { 193, 204, 96, 1 }, },
-    { { 75, 157, 11, 1 },
-      { 139, 91, 193, 1 },
-      { 232, 92, 233, 0 },
-      { 193, 237, 104, 1 }, },
-    { { 75, 157, 4, 1 },
-      { 139, 25, 209, 0 },
-      { 144, 92, 233, 0 },
-      { 69, 204, 104, 1 }, },
-    { { 75, 157, 7, 0 },
-      { 131, 91, 209, 0 },
-      { 112, 92, 233, 0 },
-      { 69, 237, 96, 1 }, },
-    { { 75, 157, 120, 0 },
-      { 147, 157, 193, 1 },
-      { 15, 92, 233, 0 },
-      { 193, 220, 228, 1 }, },
-    { { 75, 157, 123, 1 },
-      { 155, 223, 193, 1 },
-      { 239, 92, 233, 0 },
-      { 193, 253, 236, 1 }, },
-    { { 75, 157, 116, 1 },
-      { 155, 157, 209, 0 },
-      { 151, 92, 233, 0 },
-      { 69, 220, 236, 1 }, },
-    { { 75, 157, 119, 0 },
-      { 147, 223, 209, 0 },
-      { 119, 92, 233, 0 },
-      { 69, 253, 228, 1 }, },
-    { { 75, 156, 152, 0 },
-      { 147, 25, 224, 1 },
-      { 12, 156, 233, 0 },
-      { 131, 204, 100, 1 }, },
-    { { 75, 156, 155, 1 },
-      { 155, 91, 224, 1 },
-      { 236, 156, 233, 0 },
-      { 131, 237, 108, 1 }, },
-    { { 75, 156, 148, 1 },
-      { 155, 25, 240, 0 },
-      { 148, 156, 233, 0 },
-      { 7, 204, 108, 1 }, },
-    { { 75, 156, 151, 0 },
-      { 147, 91, 240, 0 },
-      { 116, 156, 233, 0 },
-      { 7, 237, 100, 1 }, },
-    { { 75, 156, 232, 0 },
-      { 131, 157, 224, 1 },
-      { 11, 156, 233, 0 },
-      { 131, 220, 224, 1 }, },
-    { { 75, 156, 235, 1 },
-      { 139, 223, 224, 1 },
-      { 235, 156, 233, 0 },
-      { 131, 253, 232, 1 }, },
-    { { 75, 156, 228, 1 },
-      { 139, 157, 240, 0 },
-      { 147, 156, 233, 0 },
-      { 7, 220, 232, 1 }, },
-    { { 75, 156, 231, 0 },
-      { 131, 223, 240, 0 },
-      { 115, 156, 233, 0 },
-      { 7, 253, 224, 1 }, },
-    { { 116, 33, 8, 0 },
-      { 4, 33, 7, 1 },
-      { 8, 66, 23, 0 },
-      { 240, 66, 16, 0 }, },
-    { { 116, 33, 11, 1 },
-      { 12, 99, 7, 1 },
-      { 232, 66, 23, 0 },
-      { 240, 99, 24, 0 }, },
-    { { 116, 33, 4, 1 },
-      { 12, 33, 23, 0 },
-      { 144, 66, 23, 0 },
-      { 116, 66, 24, 0 }, },
-    { { 116, 33, 7, 0 },
-      { 4, 99, 23, 0 },
-      { 112, 66, 23, 0 },
-      { 116, 99, 16, 0 }, },
-    { { 116, 33, 120, 0 },
-      { 20, 165, 7, 1 },
-      { 15, 66, 23, 0 },
-      { 240, 82, 148, 0 }, },
-    { { 116, 33, 123, 1 },
-      { 28, 231, 7, 1 },
-      { 239, 66, 23, 0 },
-      { 240, 115, 156, 0 }, },
-    { { 116, 33, 116, 1 },
-      { 28, 165, 23, 0 },
-      { 151, 66, 23, 0 },
-      { 116, 82, 156, 0 }, },
-    { { 116, 33, 119, 0 },
-      { 20, 231, 23, 0 },
-      { 119, 66, 23, 0 },
-      { 116, 115, 148, 0 }, },
-    { { 116, 32, 152, 0 },
-      { 20, 33, 38, 1 },
-      { 12, 130, 23, 0 },
-      { 178, 66, 20, 0 }, },
-    { { 116, 32, 155, 1 },
-      { 28, 99, 38, 1 },
-      { 236, 130, 23, 0 },
-      { 178, 99, 28, 0 }, },
-    { { 116, 32, 148, 1 },
-      { 28, 33, 54, 0 },
-      { 148, 130, 23, 0 },
-      { 54, 66, 28, 0 }, },
-    { { 116, 32, 151, 0 },
-      { 20, 99, 54, 0 },
-      { 116, 130, 23, 0 },
-      { 54, 99, 20, 0 }, },
-    { { 116, 32, 232, 0 },
-      { 4, 165, 38, 1 },
-      { 11, 130, 23, 0 },
-      { 178, 82, 144, 0 }, },
-    { { 116, 32, 235, 1 },
-      { 12, 231, 38, 1 },
-      { 235, 130, 23, 0 },
-      { 178, 115, 152, 0 }, },
-    { { 116, 32, 228, 1 },
-      { 12, 165, 54, 0 },
-      { 147, 130, 23, 0 },
-      { 54, 82, 152, 0 }, },
-    { { 116, 32, 231, 0 },
-      { 4, 231, 54, 0 },
-      { 115, 130, 23, 0 },
-      { 54, 115, 144, 0 }, },
-    { { 116, 47, 8, 0 },
-      { 37, 41, 7, 1 },
-      { 8, 122, 23, 0 },
-      { 240, 74, 82, 0 }, },
-    { { 116, 47, 11, 1 },
-      { 45, 107, 7, 1 },
-      { 232, 122, 23, 0 },
-      { 240, 107, 90, 0 }, },
-    { { 116, 47, 4, 1 },
-      { 45, 41, 23, 0 },
-      { 144, 122, 23, 0 },
-      { 116, 74, 90, 0 }, },
-    { { 116, 47, 7, 0 },
-      { 37, 107, 23, 0 },
-      { 112, 122, 23, 0 },
-      { 116, 107, 82, 0 }, },
-    { { 116, 47, 120, 0 },
-      { 53, 173, 7, 1 },
-      { 15, 122, 23, 0 },
-      { 240, 90, 214, 0 }, },
-    { { 116, 47, 123, 1 },
-      { 61, 239, 7, 1 },
-      { 239, 122, 23, 0 },
-      { 240, 123, 222, 0 }, },
-    { { 116, 47, 116, 1 },
-      { 61, 173, 23, 0 },
-      { 151, 122, 23, 0 },
-      { 116, 90, 222, 0 }, },
-    { { 116, 47, 119, 0 },
-      { 53, 239, 23, 0 },
-      { 119, 122, 23, 0 },
-      { 116, 123, 214, 0 }, },
-    { { 116, 46, 152, 0 },
-      { 53, 41, 38, 1 },
-      { 12, 186, 23, 0 },
-      { 178, 74, 86, 0 }, },
-    { { 116, 46, 155, 1 },
-      { 61, 107, 38, 1 },
-      { 236, 186, 23, 0 },
-      { 178, 107, 94, 0 }, },
-    { { 116, 46, 148, 1 },
-      { 61, 41, 54, 0 },
-      { 148, 186, 23, 0 },
-      { 54, 74, 94, 0 }, },
-    { { 116, 46, 151, 0 },
-      { 53, 107, 54, 0 },
-      { 116, 186, 23, 0 },
-      { 54, 107, 86, 0 }, },
-    { { 116, 46, 232, 0 },
-      { 37, 173, 38, 1 },
-      { 11, 186, 23, 0 },
-      { 178, 90, 210, 0 }, },
-    { { 116, 46, 235, 1 },
-      { 45, 239, 38, 1 },
-      { 235, 186, 23, 0 },
-      { 178, 123, 218, 0 }, },
-    { { 116, 46, 228, 1 },
-      { 45, 173, 54, 0 },
-      { 147, 186, 23, 0 },
-      { 54, 90, 218, 0 }, },
-    { { 116, 46, 231, 0 },
-      { 37, 239, 54, 0 },
-      { 115, 186, 23, 0 },
-      { 54, 123, 210, 0 }, },
-    { { 116, 19, 8, 0 },
-      { 36, 33, 69, 1 },
-      { 8, 100, 23, 0 },
-      { 209, 66, 18, 0 }, },
-    { { 116, 19, 11, 1 },
-      { 44, 99, 69, 1 },
-      { 232, 100, 23, 0 },
-      { 209, 99, 26, 0 }, },
-    { { 116, 19, 4, 1 },
-      { 44, 33, 85, 0 },
-      { 144, 100, 23, 0 },
-      { 85, 66, 26, 0 }, },
-    { { 116, 19, 7, 0 },
-      { 36, 99, 85, 0 },
-      { 112, 100, 23, 0 },
-      { 85, 99, 18, 0 }, },
-    { { 116, 19, 120, 0 },
-      { 52, 165, 69, 1 },
-      { 15, 100, 23, 0 },
-      { 209, 82, 150, 0 }, },
-    { { 116, 19, 123, 1 },
-      { 60, 231, 69, 1 },
-      { 239, 100, 23, 0 },
-      { 209, 115, 158, 0 }, },
-    { { 116, 19, 116, 1 },
-      { 60, 165, 85, 0 },
-      { 151, 100, 23, 0 },
-      { 85, 82, 158, 0 }, },
-    { { 116, 19, 119, 0 },
-      { 52, 231, 85, 0 },
-      { 119, 100, 23, 0 },
-      { 85, 115, 150, 0 }, },
-    { { 116, 18, 152, 0 },
-      { 52, 33, 100, 1 },
-      { 12, 164, 23, 0 },
-      { 147, 66, 22, 0 }, },
-    { { 116, 18, 155, 1 },
-      { 60, 99, 100, 1 },
-      { 236, 164, 23, 0 },
-      { 147, 99, 30, 0 }, },
-    { { 116, 18, 148, 1 },
-      { 60, 33, 116, 0 },
-      { 148, 164, 23, 0 },
-      { 23, 66, 30, 0 }, },
-    { { 116, 18, 151, 0 },
-      { 52, 99, 116, 0 },
-      { 116, 164, 23, 0 },
-      { 23, 99, 22, 0 }, },
-    { { 116, 18, 232, 0 },
-      { 36, 165, 100, 1 },
-      { 11, 164, 23, 0 },
-      { 147, 82, 146, 0 }, },
-    { { 116, 18, 235, 1 },
-      { 44, 231, 100, 1 },
-      { 235, 164, 23, 0 },
-      { 147, 115, 154, 0 }, },
-    { { 116, 18, 228, 1 },
-      { 44, 165, 116, 0 },
-      { 147, 164, 23, 0 },
-      { 23, 82, 154, 0 }, },
-    { { 116, 18, 231, 0 },
-      { 36, 231, 116, 0 },
-      { 115, 164, 23, 0 },
-      { 23, 115, 146, 0 }, },
-    { { 116, 29, 8, 0 },
-      { 5, 41, 69, 1 },
-      { 8, 92, 23, 0 },
-      { 209, 74, 80, 0 }, },
-    { { 116, 29, 11, 1 },
-      { 13, 107, 69, 1 },
-      { 232, 92, 23, 0 },
-      { 209, 107, 88, 0 }, },
-    { { 116, 29, 4, 1 },
-      { 13, 41, 85, 0 },
-      { 144, 92, 23, 0 },
-      { 85, 74, 88, 0 }, },
-    { { 116, 29, 7, 0 },
-      { 5, 107, 85, 0 },
-      { 112, 92, 23, 0 },
-      { 85, 107, 80, 0 }, },
-    { { 116, 29, 120, 0 },
-      { 21, 173, 69, 1 },
-      { 15, 92, 23, 0 },
-      { 209, 90, 212, 0 }, },
-    { { 116, 29, 123, 1 },
-      { 29, 239, 69, 1 },
-      { 239, 92, 23, 0 },
-      { 209, 123, 220, 0 }, },
-    { { 116, 29, 116, 1 },
-      { 29, 173, 85, 0 },
-      { 151, 92, 23, 0 },
-      { 85, 90, 220, 0 }, },
-    { { 116, 29, 119, 0 },
-      { 21, 239, 85, 0 },
-      { 119, 92, 23, 0 },
-      { 85, 123, 212, 0 }, },
-    { { 116, 28, 152, 0 },
-      { 21, 41, 100, 1 },
-      { 12, 156, 23, 0 },
-      { 147, 74, 84, 0 }, },
-    { { 116, 28, 155, 1 },
-      { 29, 107, 100, 1 },
-      { 236, 156, 23, 0 },
-      { 147, 107, 92, 0 }, },
-    { { 116, 28, 148, 1 },
-      { 29, 41, 116, 0 },
-      { 148, 156, 23, 0 },
-      { 23, 74, 92, 0 }, },
-    { { 116, 28, 151, 0 },
-      { 21, 107, 116, 0 },
-      { 116, 156, 23, 0 },
-      { 23, 107, 84, 0 }, },
-    { { 116, 28, 232, 0 },
-      { 5, 173, 100, 1 },
-      { 11, 156, 23, 0 },
-      { 147, 90, 208, 0 }, },
-    { { 116, 28, 235, 1 },
-      { 13, 239, 100, 1 },
-      { 235, 156, 23, 0 },
-      { 147, 123, 216, 0 }, },
-    { { 116, 28, 228, 1 },
-      { 13, 173, 116, 0 },
-      { 147, 156, 23, 0 },
-      { 23, 90, 216, 0 }, },
-    { { 116, 28, 231, 0 },
-      { 5, 239, 116, 0 },
-      { 115, 156, 23, 0 },
-      { 23, 123, 208, 0 }, },
-    { { 117, 225, 8, 0 },
-      { 70, 49, 7, 1 },
-      { 8, 67, 215, 0 },
-      { 240, 70, 49, 0 }, },
-    { { 117, 225, 11, 1 },
-      { 78, 115, 7, 1 },
-      { 232, 67, 215, 0 },
-      { 240, 103, 57, 0 }, },
-    { { 117, 225, 4, 1 },
-      { 78, 49, 23, 0 },
-      { 144, 67, 215, 0 },
-      { 116, 70, 57, 0 }, },
-    { { 117, 225, 7, 0 },
-      { 70, 115, 23, 0 },
-      { 112, 67, 215, 0 },
-      { 116, 103, 49, 0 }, },
-    { { 117, 225, 120, 0 },
-      { 86, 181, 7, 1 },
-      { 15, 67, 215, 0 },
-      { 240, 86, 181, 0 }, },
-    { { 117, 225, 123, 1 },
-      { 94, 247, 7, 1 },
-      { 239, 67, 215, 0 },
-      { 240, 119, 189, 0 }, },
-    { { 117, 225, 116, 1 },
-      { 94, 181, 23, 0 },
-      { 151, 67, 215, 0 },
-      { 116, 86, 189, 0 }, },
-    { { 117, 225, 119, 0 },
-      { 86, 247, 23, 0 },
-      { 119, 67, 215, 0 },
-      { 116, 119, 181, 0 }, },
-    { { 117, 224, 152, 0 },
-      { 86, 49, 38, 1 },
-      { 12, 131, 215, 0 },
-      { 178, 70, 53, 0 }, },
-    { { 117, 224, 155, 1 },
-      { 94, 115, 38, 1 },
-      { 236, 131, 215, 0 },
-      { 178, 103, 61, 0 }, },
-    { { 117, 224, 148, 1 },
-      { 94, 49, 54, 0 },
-      { 148, 131, 215, 0 },
-      { 54, 70, 61, 0 }, },
-    { { 117, 224, 151, 0 },
-      { 86, 115, 54, 0 },
-      { 116, 131, 215, 0 },
-      { 54, 103, 53, 0 }, },
-    { { 117, 224, 232, 0 },
-      { 70, 181, 38, 1 },
-      { 11, 131, 215, 0 },
-      { 178, 86, 177, 0 }, },
-    { { 117, 224, 235, 1 },
-      { 78, 247, 38, 1 },
-      { 235, 131, 215, 0 },
-      { 178, 119, 185, 0 }, },
-    { { 117, 224, 228, 1 },
-      { 78, 181, 54, 0 },
-      { 147, 131, 215, 0 },
-      { 54, 86, 185, 0 }, },
-    { { 117, 224, 231, 0 },
-      { 70, 247, 54, 0 },
-      { 115, 131, 215, 0 },
-      { 54, 119, 177, 0 }, },
-    { { 117, 239, 8, 0 },
-      { 103, 57, 7, 1 },
-      { 8, 123, 215, 0 },
-      { 240, 78, 115, 0 }, },
-    { { 117, 239, 11, 1 },
-      { 111, 123, 7, 1 },
-      { 232, 123, 215, 0 },
-      { 240, 111, 123, 0 }, },
-    { { 117, 239, 4, 1 },
-      { 111, 57, 23, 0 },
-      { 144, 123, 215, 0 },
-      { 116, 78, 123, 0 }, },
-    { { 117, 239, 7, 0 },
-      { 103, 123, 23, 0 },
-      { 112, 123, 215, 0 },
-      { 116, 111, 115, 0 }, },
-    { { 117, 239, 120, 0 },
-      { 119, 189, 7, 1 },
-      { 15, 123, 215, 0 },
-      { 240, 94, 247, 0 }, },
-    { { 117, 239, 123, 1 },
-      { 127, 255, 7, 1 },
-      { 239, 123, 215, 0 },
-      { 240, 127, 255, 0 }, },
-    { { 117, 239, 116, 1 },
-      { 127, 189, 23, 0 },
-      { 151, 123, 215, 0 },
-      { 116, 94, 255, 0 }, },
-    { { 117, 239, 119, 0 },
-      { 119, 255, 23, 0 },
-      { 119, 123, 215, 0 },
-      { 116, 127, 247, 0 }, },
-    { { 117, 238, 152, 0 },
-      { 119, 57, 38, 1 },
-      { 12, 187, 215, 0 },
-      { 178, 78, 119, 0 }, },
-    { { 117, 238, 155, 1 },
-      { 127, 123, 38, 1 },
-      { 236, 187, 215, 0 },
-      { 178, 111, 127, 0 }, },
-    { { 117, 238, 148, 1 },
-      { 127, 57, 54, 0 },
-      { 148, 187, 215, 0 },
-      { 54, 78, 127, 0 }, },
-    { { 117, 238, 151, 0 },
-      { 119, 123, 54, 0 },
-      { 116, 187, 215, 0 },
-      { 54, 111, 119, 0 }, },
-    { { 117, 238, 232, 0 },
-      { 103, 189, 38, 1 },
-      { 11, 187, 215, 0 },
-      { 178, 94, 243, 0 }, },
-    { { 117, 238, 235, 1 },
-      { 111, 255, 38, 1 },
-      { 235, 187, 215, 0 },
-      { 178, 127, 251, 0 }, },
-    { { 117, 238, 228, 1 },
-      { 111, 189, 54, 0 },
-      { 147, 187, 215, 0 },
-      { 54, 94, 251, 0 }, },
-    { { 117, 238, 231, 0 },
-      { 103, 255, 54, 0 },
-      { 115, 187, 215, 0 },
-      { 54, 127, 243, 0 }, },
-    { { 117, 211, 8, 0 },
-      { 102, 49, 69, 1 },
-      { 8, 101, 215, 0 },
-      { 209, 70, 51, 0 }, },
-    { { 117, 211, 11, 1 },
-      { 110, 115, 69, 1 },
-      { 232, 101, 215, 0 },
-      { 209, 103, 59, 0 }, },
-    { { 117, 211, 4, 1 },
-      { 110, 49, 85, 0 },
-      { 144, 101, 215, 0 },
-      { 85, 70, 59, 0 }, },
-    { { 117, 211, 7, 0 },
-      { 102, 115, 85, 0 },
-      { 112, 101, 215, 0 },
-      { 85, 103, 51, 0 }, },
-    { { 117, 211, 120, 0 },
-      { 118, 181, 69, 1 },
-      { 15, 101, 215, 0 },
-      { 209, 86, 183, 0 }, },
-    { { 117, 211, 123, 1 },
-      { 126, 247, 69, 1 },
-      { 239, 101, 215, 0 },
-      { 209, 119, 191, 0 }, },
-    { { 117, 211, 116, 1 },
-      { 126, 181, 85, 0 },
-      { 151, 101, 215, 0 },
-      { 85, 86, 191, 0 }, },
-    { { 117, 211, 119, 0 },
-      { 118, 247, 85, 0 },
-      { 119, 101, 215, 0 },
-      { 85, 119, 183, 0 }, },
-    { { 117, 210, 152, 0 },
-      { 118, 49, 100, 1 },
-      { 12, 165, 215, 0 },
-      { 147, 70, 55, 0 }, },
-    { { 117, 210, 155, 1 },
-      { 126, 115, 100, 1 },
-      { 236, 165, 215, 0 },
-      { 147, 103, 63, 0 }, },
-    { { 117, 210, 148, 1 },
-      { 126, 49, 116, 0 },
-      { 148, 165, 215, 0 },
-      { 23, 70, 63, 0 }, },
-    { { 117, 210, 151, 0 },
-      { 118, 115, 116, 0 },
-      { 116, 165, 215, 0 },
-      { 23, 103, 55, 0 }, },
-    { { 117, 210, 232, 0 },
-      { 102, 181, 100, 1 },
-      { 11, 165, 215, 0 },
-      { 147, 86, 179, 0 }, },
-    { { 117, 210, 235, 1 },
-      { 110, 247, 100, 1 },
-      { 235, 165, 215, 0 },
-      { 147, 119, 187, 0 }, },
-    { { 117, 210, 228, 1 },
-      { 110, 181, 116, 0 },
-      { 147, 165, 215, 0 },
-      { 23, 86, 187, 0 }, },
-    { { 117, 210, 231, 0 },
-      { 102, 247, 116, 0 },
-      { 115, 165, 215, 0 },
-      { 23, 119, 179, 0 }, },
-    { { 117, 221, 8, 0 },
-      { 71, 57, 69, 1 },
-      { 8, 93, 215, 0 },
-      { 209, 78, 113, 0 }, },
-    { { 117, 221, 11, 1 },
-      { 79, 123, 69, 1 },
-      { 232, 93, 215, 0 },
-      { 209, 111, 121, 0 }, },
-    { { 117, 221, 4, 1 },
-      { 79, 57, 85, 0 },
-      { 144, 93, 215, 0 },
-      { 85, 78, 121, 0 }, },
-    { { 117, 221, 7, 0 },
-      { 71, 123, 85, 0 },
-      { 112, 93, 215, 0 },
-      { 85, 111, 113, 0 }, },
-    { { 117, 221, 120, 0 },
-      { 87, 189, 69, 1 },
-      { 15, 93, 215, 0 },
-      { 209, 94, 245, 0 }, },
-    { { 117, 221, 123, 1 },
-      { 95, 255, 69, 1 },
-      { 239, 93, 215, 0 },
-      { 209, 127, 253, 0 }, },
-    { { 117, 221, 116, 1 },
-      { 95, 189, 85, 0 },
-      { 151, 93, 215, 0 },
-      { 85, 94, 253, 0 }, },
-    { { 117, 221, 119, 0 },
-      { 87, 255, 85, 0 },
-      { 119, 93, 215, 0 },
-      { 85, 127, 245, 0 }, },
-    { { 117, 220, 152, 0 },
-      { 87, 57, 100, 1 },
-      { 12, 157, 215, 0 },
-      { 147, 78, 117, 0 }, },
-    { { 117, 220, 155, 1 },
-      { 95, 123, 100, 1 },
-      { 236, 157, 215, 0 },
-      { 147, 111, 125, 0 }, },
-    { { 117, 220, 148, 1 },
-      { 95, 57, 116, 0 },
-      { 148, 157, 215, 0 },
-      { 23, 78, 125, 0 }, },
-    { { 117, 220, 151, 0 },
-      { 87, 123, 116, 0 },
-      { 116, 157, 215, 0 },
-      { 23, 111, 117, 0 }, },
-    { { 117, 220, 232, 0 },
-      { 71, 189, 100, 1 },
-      { 11, 157, 215, 0 },
-      { 147, 94, 241, 0 }, },
-    { { 117, 220, 235, 1 },
-      { 79, 255, 100, 1 },
-      { 235, 157, 215, 0 },
-      { 147, 127, 249, 0 }, },
-    { { 117, 220, 228, 1 },
-      { 79, 189, 116, 0 },
-      { 147, 157, 215, 0 },
-      { 23, 94, 249, 0 }, },
-    { { 117, 220, 231, 0 },
-      { 71, 255, 116, 0 },
-      { 115, 157, 215, 0 },
-      { 23, 127, 241, 0 }, },
-    { { 114, 97, 8, 0 },
-      { 68, 33, 131, 1 },
-      { 8, 67, 39, 0 },
-      { 224, 194, 17, 0 }, },
-    { { 114, 97, 11, 1 },
-      { 76, 99, 131, 1 },
-      { 232, 67, 39, 0 },
-      { 224, 227, 25, 0 }, },
-    { { 114, 97, 4, 1 },
-      { 76, 33, 147, 0 },
-      { 144, 67, 39, 0 },
-      { 100, 194, 25, 0 }, },
-    { { 114, 97, 7, 0 },
-      { 68, 99, 147, 0 },
-      { 112, 67, 39, 0 },
-      { 100, 227, 17, 0 }, },
-    { { 114, 97, 120, 0 },
-      { 84, 165, 131, 1 },
-      { 15, 67, 39, 0 },
-      { 224, 210, 149, 0 }, },
-    { { 114, 97, 123, 1 },
-      { 92, 231, 131, 1 },
-      { 239, 67, 39, 0 },
-      { 224, 243, 157, 0 }, },
-    { { 114, 97, 116, 1 },
-      { 92, 165, 147, 0 },
-      { 151, 67, 39, 0 },
-      { 100, 210, 157, 0 }, },
-    { { 114, 97, 119, 0 },
-      { 84, 231, 147, 0 },
-      { 119, 67, 39, 0 },
-      { 100, 243, 149, 0 }, },
-    { { 114, 96, 152, 0 },
-      { 84, 33, 162, 1 },
-      { 12, 131, 39, 0 },
-      { 162, 194, 21, 0 }, },
-    { { 114, 96, 155, 1 },
-      { 92, 99, 162, 1 },
-      { 236, 131, 39, 0 },
-      { 162, 227, 29, 0 }, },
-    { { 114, 96, 148, 1 },
-      { 92, 33, 178, 0 },
-      { 148, 131, 39, 0 },
-      { 38, 194, 29, 0 }, },
-    { { 114, 96, 151, 0 },
-      { 84, 99, 178, 0 },
-      { 116, 131, 39, 0 },
-      { 38, 227, 21, 0 }, },
-    { { 114, 96, 232, 0 },
-      { 68, 165, 162, 1 },
-      { 11, 131, 39, 0 },
-      { 162, 210, 145, 0 }, },
-    { { 114, 96, 235, 1 },
-      { 76, 231, 162, 1 },
-      { 235, 131, 39, 0 },
-      { 162, 243, 153, 0 }, },
-    { { 114, 96, 228, 1 },
-      { 76, 165, 178, 0 },
-      { 147, 131, 39, 0 },
-      { 38, 210, 153, 0 }, },
-    { { 114, 96, 231, 0 },
-      { 68, 231, 178, 0 },
-      { 115, 131, 39, 0 },
-      { 38, 243, 145, 0 }, },
-    { { 114, 111, 8, 0 },
-      { 101, 41, 131, 1 },
-      { 8, 123, 39, 0 },
-      { 224, 202, 83, 0 }, },
-    { { 114, 111, 11, 1 },
-      { 109, 107, 131, 1 },
-      { 232, 123, 39, 0 },
-      { 224, 235, 91, 0 }, },
-    { { 114, 111, 4, 1 },
-      { 109, 41, 147, 0 },
-      { 144, 123, 39, 0 },
-      { 100, 202, 91, 0 }, },
-    { { 114, 111, 7, 0 },
-      { 101, 107, 147, 0 },
-      { 112, 123, 39, 0 },
-      { 100, 235, 83, 0 }, },
-    { { 114, 111, 120, 0 },
-      { 117, 173, 131, 1 },
-      { 15, 123, 39, 0 },
-      { 224, 218, 215, 0 }, },
-    { { 114, 111, 123, 1 },
-      { 125, 239, 131, 1 },
-      { 239, 123, 39, 0 },
-      { 224, 251, 223, 0 }, },
-    { { 114, 111, 116, 1 },
-      { 125, 173, 147, 0 },
-      { 151, 123, 39, 0 },
-      { 100, 218, 223, 0 }, },
-    { { 114, 111, 119, 0 },
-      { 117, 239, 147, 0 },
-      { 119, 123, 39, 0 },
-      { 100, 251, 215, 0 }, },
-    { { 114, 110, 152, 0 },
-      { 117, 41, 162, 1 },
-      { 12, 187, 39, 0 },
-      { 162, 202, 87, 0 }, },
-    { { 114, 110, 155, 1 },
-      { 125, 107, 162, 1 },
-      { 236, 187, 39, 0 },
-      { 162, 235, 95, 0 }, },
-    { { 114, 110, 148, 1 },
-      { 125, 41, 178, 0 },
-      { 148, 187, 39, 0 },
-      { 38, 202, 95, 0 }, },
-    { { 114, 110, 151, 0 },
-      { 117, 107, 178, 0 },
-      { 116, 187, 39, 0 },
-      { 38, 235, 87, 0 }, },
-    { { 114, 110, 232, 0 },
-      { 101, 173, 162, 1 },
-      { 11, 187, 39, 0 },
-      { 162, 218, 211, 0 }, },
-    { { 114, 110, 235, 1 },
-      { 109, 239, 162, 1 },
-      { 235, 187, 39, 0 },
-      { 162, 251, 219, 0 }, },
-    { { 114, 110, 228, 1 },
-      { 109, 173, 178, 0 },
-      { 147, 187, 39, 0 },
-      { 38, 218, 219, 0 }, },
-    { { 114, 110, 231, 0 },
-      { 101, 239, 178, 0 },
-      { 115, 187, 39, 0 },
-      { 38, 251, 211, 0 }, },
-    { { 114, 83, 8, 0 },
-      { 100, 33, 193, 1 },
-      { 8, 101, 39, 0 },
-      { 193, 194, 19, 0 }, },
-    { { 114, 83, 11, 1 },
-      { 108, 99, 193, 1 },
-      { 232, 101, 39, 0 },
-      { 193, 227, 27, 0 }, },
-    { { 114, 83, 4, 1 },
-      { 108, 33, 209, 0 },
-      { 144, 101, 39, 0 },
-      { 69, 194, 27, 0 }, },
-    { { 114, 83, 7, 0 },
-      { 100, 99, 209, 0 },
-      { 112, 101, 39, 0 },
-      { 69, 227, 19, 0 }, },
-    { { 114, 83, 120, 0 },
-      { 116, 165, 193, 1 },
-      { 15, 101, 39, 0 },
-      { 193, 210, 151, 0 }, },
-    { { 114, 83, 123, 1 },
-      { 124, 231, 193, 1 },
-      { 239, 101, 39, 0 },
-      { 193, 243, 159, 0 }, },
-    { { 114, 83, 116, 1 },
-      { 124, 165, 209, 0 },
-      { 151, 101, 39, 0 },
-      { 69, 210, 159, 0 }, },
-    { { 114, 83, 119, 0 },
-      { 116, 231, 209, 0 },
-      { 119, 101, 39, 0 },
-      { 69, 243, 151, 0 }, },
-    { { 114, 82, 152, 0 },
-      { 116, 33, 224, 1 },
-      { 12, 165, 39, 0 },
-      { 131, 194, 23, 0 }, },
-    { { 114, 82, 155, 1 },
-      { 124, 99, 224, 1 },
-      { 236, 165, 39, 0 },
-      { 131, 227, 31, 0 }, },
-    { { 114, 82, 148, 1 },
-      { 124, 33, 240, 0 },
-      { 148, 165, 39, 0 },
-      { 7, 194, 31, 0 }, },
-    { { 114, 82, 151, 0 },
-      { 116, 99, 240, 0 },
-      { 116, 165, 39, 0 },
-      { 7, 227, 23, 0 }, },
-    { { 114, 82, 232, 0 },
-      { 100, 165, 224, 1 },
-      { 11, 165, 39, 0 },
-      { 131, 210, 147, 0 }, },
-    { { 114, 82, 235, 1 },
-      { 108, 231, 224, 1 },
-      { 235, 165, 39, 0 },
-      { 131, 243, 155, 0 }, },
-    { { 114, 82, 228, 1 },
-      { 108, 165, 240, 0 },
-      { 147, 165, 39, 0 },
-      { 7, 210, 155, 0 }, },
-    { { 114, 82, 231, 0 },
-      { 100, 231, 240, 0 },
-      { 115, 165, 39, 0 },
-      { 7, 243, 147, 0 }, },
-    { { 114, 93, 8, 0 },
-      { 69, 41, 193, 1 },
-      { 8, 93, 39, 0 },
-      { 193, 202, 81, 0 }, },
-    { { 114, 93, 11, 1 },
-      { 77, 107, 193, 1 },
-      { 232, 93, 39, 0 },
-      { 193, 235, 89, 0 }, },
-    { { 114, 93, 4, 1 },
-      { 77, 41, 209, 0 },
-      { 144, 93, 39, 0 },
-      { 69, 202, 89, 0 }, },
-    { { 114, 93, 7, 0 },
-      { 69, 107, 209, 0 },
-      { 112, 93, 39, 0 },
-      { 69, 235, 81, 0 }, },
-    { { 114, 93, 120, 0 },
-      { 85, 173, 193, 1 },
-      { 15, 93, 39, 0 },
-      { 193, 218, 213, 0 }, },
-    { { 114, 93, 123, 1 },
-      { 93, 239, 193, 1 },
-      { 239, 93, 39, 0 },
-      { 193, 251, 221, 0 }, },
-    { { 114, 93, 116, 1 },
-      { 93, 173, 209, 0 },
-      { 151, 93, 39, 0 },
-      { 69, 218, 221, 0 }, },
-    { { 114, 93, 119, 0 },
-      { 85, 239, 209, 0 },
-      { 119, 93, 39, 0 },
-      { 69, 251, 213, 0 }, },
-    { { 114, 92, 152, 0 },
-      { 85, 41, 224, 1 },
-      { 12, 157, 39, 0 },
-      { 131, 202, 85, 0 }, },
-    { { 114, 92, 155, 1 },
-      { 93, 107, 224, 1 },
-      { 236, 157, 39, 0 },
-      { 131, 235, 93, 0 }, },
-    { { 114, 92, 148, 1 },
-      { 93, 41, 240, 0 },
-      { 148, 157, 39, 0 },
-      { 7, 202, 93, 0 }, },
-    { { 114, 92, 151, 0 },
-      { 85, 107, 240, 0 },
-      { 116, 157, 39, 0 },
-      { 7, 235, 85, 0 }, },
-    { { 114, 92, 232, 0 },
-      { 69, 173, 224, 1 },
-      { 11, 157, 39, 0 },
-      { 131, 218, 209, 0 }, },
-    { { 114, 92, 235, 1 },
-      { 77, 239, 224, 1 },
-      { 235, 157, 39, 0 },
-      { 131, 251, 217, 0 }, },
-    { { 114, 92, 228, 1 },
-      { 77, 173, 240, 0 },
-      { 147, 157, 39, 0 },
-      { 7, 218, 217, 0 }, },
-    { { 114, 92, 231, 0 },
-      { 69, 239, 240, 0 },
-      { 115, 157, 39, 0 },
-      { 7, 251, 209, 0 }, },
-    { { 115, 161, 8, 0 },
-      { 6, 49, 131, 1 },
-      { 8, 66, 231, 0 },
-      { 224, 198, 48, 0 }, },
-    { { 115, 161, 11, 1 },
-      { 14, 115, 131, 1 },
-      { 232, 66, 231, 0 },
-      { 224, 231, 56, 0 }, },
-    { { 115, 161, 4, 1 },
-      { 14, 49, 147, 0 },
-      { 144, 66, 231, 0 },
-      { 100, 198, 56, 0 }, },
-    { { 115, 161, 7, 0 },
-      { 6, 115, 147, 0 },
-      { 112, 66, 231, 0 },
-      { 100, 231, 48, 0 }, },
-    { { 115, 161, 120, 0 },
-      { 22, 181, 131, 1 },
-      { 15, 66, 231, 0 },
-      { 224, 214, 180, 0 }, },
-    { { 115, 161, 123, 1 },
-      { 30, 247, 131, 1 },
-      { 239, 66, 231, 0 },
-      { 224, 247, 188, 0 }, },
-    { { 115, 161, 116, 1 },
-      { 30, 181, 147, 0 },
-      { 151, 66, 231, 0 },
-      { 100, 214, 188, 0 }, },
-    { { 115, 161, 119, 0 },
-      { 22, 247, 147, 0 },
-      { 119, 66, 231, 0 },
-      { 100, 247, 180, 0 }, },
-    { { 115, 160, 152, 0 },
-      { 22, 49, 162, 1 },
-      { 12, 130, 231, 0 },
-      { 162, 198, 52, 0 }, },
-    { { 115, 160, 155, 1 },
-      { 30, 115, 162, 1 },
-      { 236, 130, 231, 0 },
-      { 162, 231, 60, 0 }, },
-    { { 115, 160, 148, 1 },
-      { 30, 49, 178, 0 },
-      { 148, 130, 231, 0 },
-      { 38, 198, 60, 0 }, },
-    { { 115, 160, 151, 0 },
-      { 22, 115, 178, 0 },
-      { 116, 130, 231, 0 },
-      { 38, 231, 52, 0 }, },
-    { { 115, 160, 232, 0 },
-      { 6, 181, 162, 1 },
-      { 11, 130, 231, 0 },
-      { 162, 214, 176, 0 }, },
-    { { 115, 160, 235, 1 },
-      { 14, 247, 162, 1 },
-      { 235, 130, 231, 0 },
-      { 162, 247, 184, 0 }, },
-    { { 115, 160, 228, 1 },
-      { 14, 181, 178, 0 },
-      { 147, 130, 231, 0 },
-      { 38, 214, 184, 0 }, },
-    { { 115, 160, 231, 0 },
-      { 6, 247, 178, 0 },
-      { 115, 130, 231, 0 },
-      { 38, 247, 176, 0 }, },
-    { { 115, 175, 8, 0 },
-      { 39, 57, 131, 1 },
-      { 8, 122, 231, 0 },
-      { 224, 206, 114, 0 }, },
-    { { 115, 175, 11, 1 },
-      { 47, 123, 131, 1 },
-      { 232, 122, 231, 0 },
-      { 224, 239, 122, 0 }, },
-    { { 115, 175, 4, 1 },
-      { 47, 57, 147, 0 },
-      { 144, 122, 231, 0 },
-      { 100, 206, 122, 0 }, },
-    { { 115, 175, 7, 0 },
-      { 39, 123, 147, 0 },
-      { 112, 122, 231, 0 },
-      { 100, 239, 114, 0 }, },
-    { { 115, 175, 120, 0 },
-      { 55, 189, 131, 1 },
-      { 15, 122, 231, 0 },
-      { 224, 222, 246, 0 }, },
-    { { 115, 175, 123, 1 },
-      { 63, 255, 131, 1 },
-      { 239, 122, 231, 0 },
-      { 224, 255, 254, 0 }, },
-    { { 115, 175, 116, 1 },
-      { 63, 189, 147, 0 },
-      { 151, 122, 231, 0 },
-      { 100, 222, 254, 0 }, },
-    { { 115, 175, 119, 0 },
-      { 55, 255, 147, 0 },
-      { 119, 122, 231, 0 },
-      { 100, 255, 246, 0 }, },
-    { { 115, 174, 152, 0 },
-      { 55, 57, 162, 1 },
-      { 12, 186, 231, 0 },
-      { 162, 206, 118, 0 }, },
-    { { 115, 174, 155, 1 },
-      { 63, 123, 162, 1 },
-      { 236, 186, 231, 0 },
-      { 162, 239, 126, 0 }, },
-    { { 115, 174, 148, 1 },
-      { 63, 57, 178, 0 },
-      { 148, 186, 231, 0 },
-      { 38, 206, 126, 0 }, },
-    { { 115, 174, 151, 0 },
-      { 55, 123, 178, 0 },
-      { 116, 186, 231, 0 },
-      { 38, 239, 118, 0 }, },
-    { { 115, 174, 232, 0 },
-      { 39, 189, 162, 1 },
-      { 11, 186, 231, 0 },
-      { 162, 222, 242, 0 }, },
-    { { 115, 174, 235, 1 },
-      { 47, 255, 162, 1 },
-      { 235, 186, 231, 0 },
-      { 162, 255, 250, 0 }, },
-    { { 115, 174, 228, 1 },
-      { 47, 189, 178, 0 },
-      { 147, 186, 231, 0 },
-      { 38, 222, 250, 0 }, },
-    { { 115, 174, 231, 0 },
-      { 39, 255, 178, 0 },
-      { 115, 186, 231, 0 },
-      { 38, 255, 242, 0 }, },
-    { { 115, 147, 8, 0 },
-      { 38, 49, 193, 1 },
-      { 8, 100, 231, 0 },
-      { 193, 198, 50, 0 }, },
-    { { 115, 147, 11, 1 },
-      { 46, 115, 193, 1 },
-      { 232, 100, 231, 0 },
-      { 193, 231, 58, 0 }, },
-    { { 115, 147, 4, 1 },
-      { 46, 49, 209, 0 },
-      { 144, 100, 231, 0 },
-      { 69, 198, 58, 0 }, },
-    { { 115, 147, 7, 0 },
-      { 38, 115, 209, 0 },
-      { 112, 100, 231, 0 },
-      { 69, 231, 50, 0 }, },
-    { { 115, 147, 120, 0 },
-      { 54, 181, 193, 1 },
-      { 15, 100, 231, 0 },
-      { 193, 214, 182, 0 }, },
-    { { 115, 147, 123, 1 },
-      { 62, 247, 193, 1 },
-      { 239, 100, 231, 0 },
-      { 193, 247, 190, 0 }, },
-    { { 115, 147, 116, 1 },
-      { 62, 181, 209, 0 },
-      { 151, 100, 231, 0 },
-      { 69, 214, 190, 0 }, },
-    { { 115, 147, 119, 0 },
-      { 54, 247, 209, 0 },
-      { 119, 100, 231, 0 },
-      { 69, 247, 182, 0 }, },
-    { { 115, 146, 152, 0 },
-      { 54, 49, 224, 1 },
-      { 12, 164, 231, 0 },
-      { 131, 198, 54, 0 }, },
-    { { 115, 146, 155, 1 },
-      { 62, 115, 224, 1 },
-      { 236, 164, 231, 0 },
-      { 131, 231, 62, 0 }, },
-    { { 115, 146, 148, 1 },
-      { 62, 49, 240, 0 },
-      { 148, 164, 231, 0 },
-      { 7, 198, 62, 0 }, },
-    { { 115, 146, 151, 0 },
-      { 54, 115, 240, 0 },
-      { 116, 164, 231, 0 },
-      { 7, 231, 54, 0 }, },
-    { { 115, 146, 232, 0 },
-      { 38, 181, 224, 1 },
-      { 11, 164, 231, 0 },
-      { 131, 214, 178, 0 }, },
-    { { 115, 146, 235, 1 },
-      { 46, 247, 224, 1 },
-      { 235, 164, 231, 0 },
-      { 131, 247, 186, 0 }, },
-    { { 115, 146, 228, 1 },
-      { 46, 181, 240, 0 },
-      { 147, 164, 231, 0 },
-      { 7, 214, 186, 0 }, },
-    { { 115, 146, 231, 0 },
-      { 38, 247, 240, 0 },
-      { 115, 164, 231, 0 },
-      { 7, 247, 178, 0 }, },
-    { { 115, 157, 8, 0 },
-      { 7, 57, 193, 1 },
-      { 8, 92, 231, 0 },
-      { 193, 206, 112, 0 }, },
-    { { 115, 157, 11, 1 },
-      { 15, 123, 193, 1 },
-      { 232, 92, 231, 0 },
-      { 193, 239, 120, 0 }, },
-    { { 115, 157, 4, 1 },
-      { 15, 57, 209, 0 },
-      { 144, 92, 231, 0 },
-      { 69, 206, 120, 0 }, },
-    { { 115, 157, 7, 0 },
-      { 7, 123, 209, 0 },
-      { 112, 92, 231, 0 },
-      { 69, 239, 112, 0 }, },
-    { { 115, 157, 120, 0 },
-      { 23, 189, 193, 1 },
-      { 15, 92, 231, 0 },
-      { 193, 222, 244, 0 }, },
-    { { 115, 157, 123, 1 },
-      { 31, 255, 193, 1 },
-      { 239, 92, 231, 0 },
-      { 193, 255, 252, 0 }, },
-    { { 115, 157, 116, 1 },
-      { 31, 189, 209, 0 },
-      { 151, 92, 231, 0 },
-      { 69, 222, 252, 0 }, },
-    { { 115, 157, 119, 0 },
-      { 23, 255, 209, 0 },
-      { 119, 92, 231, 0 },
-      { 69, 255, 244, 0 }, },
-    { { 115, 156, 152, 0 },
-      { 23, 57, 224, 1 },
-      { 12, 156, 231, 0 },
-      { 131, 206, 116, 0 }, },
-    { { 115, 156, 155, 1 },
-      { 31, 123, 224, 1 },
-      { 236, 156, 231, 0 },
-      { 131, 239, 124, 0 }, },
-    { { 115, 156, 148, 1 },
-      { 31, 57, 240, 0 },
-      { 148, 156, 231, 0 },
-      { 7, 206, 124, 0 }, },
-    { { 115, 156, 151, 0 },
-      { 23, 123, 240, 0 },
-      { 116, 156, 231, 0 },
-      { 7, 239, 116, 0 }, },
-    { { 115, 156, 232, 0 },
-      { 7, 189, 224, 1 },
-      { 11, 156, 231, 0 },
-      { 131, 222, 240, 0 }, },
-    { { 115, 156, 235, 1 },
-      { 15, 255, 224, 1 },
-      { 235, 156, 231, 0 },
-      { 131, 255, 248, 0 }, },
-    { { 115, 156, 228, 1 },
-      { 15, 189, 240, 0 },
-      { 147, 156, 231, 0 },
-      { 7, 222, 248, 0 }, },
-    { { 115, 156, 231, 0 },
-      { 7, 255, 240, 0 },
-      { 115, 156, 231, 0 },
-      { 7, 255, 240, 0 }, },
+static constexpr uint64 DICT_4X4_1000_CODES[][4] = {
+    { 0xb532ULL, 0xeb48ULL, 0x4cadULL, 0x12d7ULL },
+    { 0x0f9aULL, 0x6547ULL, 0x59f0ULL, 0xe2a6ULL },
+    { 0x332dULL, 0xde11ULL, 0xb4ccULL, 0x887bULL },
+    { 0x9946ULL, 0xc13cULL, 0x6299ULL, 0x3c83ULL },
+    { 0x549eULL, 0xa1d3ULL, 0x792aULL, 0xcb85ULL },
+    { 0x79cdULL, 0xd8b7ULL, 0xb39eULL, 0xed1bULL },
+    { 0x9e2eULL, 0x875dULL, 0x7479ULL, 0xbae1ULL },
+    { 0xc4f2ULL, 0x23eaULL, 0x4f23ULL, 0x57c4ULL },
+    { 0xfedaULL, 0xadefULL, 0x5b7fULL, 0xf7b5ULL },
+    { 0xcf56ULL, 0x65fcULL, 0x6af3ULL, 0x3fa6ULL },
+    { 0xf991ULL, 0xf88eULL, 0x899fULL, 0x711fULL },
+    { 0x11a7ULL, 0xd312ULL, 0xe588ULL, 0x48cbULL },
+    { 0x0eb7ULL, 0x3756ULL, 0xed70ULL, 0x6aecULL },
+    { 0x2a0fULL, 0x1d15ULL, 0xf054ULL, 0xa8b8ULL },
+    { 0x24b1ULL, 0x3a42ULL, 0x8d24ULL, 0x425cULL },
+    { 0x263eULL, 0x2f51ULL, 0x7c64ULL, 0x8af4ULL },
+    { 0x4665ULL, 0x16f0ULL, 0xa662ULL, 0x0f68ULL },
+    { 0x6600ULL, 0x0cc0ULL, 0x0066ULL, 0x0330ULL },
+    { 0x6c5eULL, 0x29f5ULL, 0x7a36ULL, 0xaf94ULL },
+    { 0x76afULL, 0x9fd3ULL, 0xf56eULL, 0xcbf9ULL },
+    { 0x868bULL, 0x154bULL, 0xd161ULL, 0xd2a8ULL },
+    { 0xb02bULL, 0x9b09ULL, 0xd40dULL, 0x90d9ULL },
+    { 0xccd5ULL, 0x30feULL, 0xab33ULL, 0x7f0cULL },
+    { 0xdd82ULL, 0xc1ceULL, 0x41bbULL, 0x7383ULL },
+    { 0xfe47ULL, 0x9dfcULL, 0xe27fULL, 0x3fb9ULL },
+    { 0x9471ULL, 0xb268ULL, 0x8e29ULL, 0x164dULL },
+    { 0xace4ULL, 0x0a7eULL, 0x2735ULL, 0x7e50ULL },
+    { 0xa554ULL, 0x6878ULL, 0x2aa5ULL, 0x1e16ULL },
+    { 0x2123ULL, 0x5b00ULL, 0xc484ULL, 0x00daULL },
+    { 0x346fULL, 0x9b71ULL, 0xf62cULL, 0x8ed9ULL },
+    { 0x4415ULL, 0x30d0ULL, 0xa822ULL, 0x0b0cULL },
+    { 0x57b2ULL, 0xe7c2ULL, 0x4deaULL, 0x43e7ULL },
+    { 0x9ecfULL, 0x957fULL, 0xf379ULL, 0xfea9ULL },
+    { 0xf0cbULL, 0x99abULL, 0xd30fULL, 0xd599ULL },
+    { 0x08aeULL, 0x0317ULL, 0x7510ULL, 0xe8c0ULL },
+    { 0x0929ULL, 0x5205ULL, 0x9490ULL, 0xa04aULL },
+    { 0x1875ULL, 0xb234ULL, 0xae18ULL, 0x2c4dULL },
+    { 0x04ffULL, 0x3373ULL, 0xff20ULL, 0xceccULL },
+    { 0x0df6ULL, 0x6376ULL, 0x6fb0ULL, 0x6ec6ULL },
+    { 0x1c5aULL, 0xa165ULL, 0x5a38ULL, 0xa685ULL },
+    { 0x1718ULL, 0xe441ULL, 0x18e8ULL, 0x8227ULL },
+    { 0x2a28ULL, 0x0e05ULL, 0x1454ULL, 0xa070ULL },
+    { 0x328cULL, 0x8c13ULL, 0x314cULL, 0xc831ULL },
+    { 0x38b2ULL, 0xab06ULL, 0x4d1cULL, 0x60d5ULL },
+    { 0x24e8ULL, 0x0a63ULL, 0x1724ULL, 0xc650ULL },
+    { 0x2eebULL, 0x1f67ULL, 0xd774ULL, 0xe6f8ULL },
+    { 0x2d3fULL, 0x7b55ULL, 0xfcb4ULL, 0xaadeULL },
+    { 0x4b64ULL, 0x46b4ULL, 0x26d2ULL, 0x2d62ULL },
+    { 0x502eULL, 0x8391ULL, 0x740aULL, 0x89c1ULL },
+    { 0x5013ULL, 0xb180ULL, 0xc80aULL, 0x018dULL },
+    { 0x5194ULL, 0xe092ULL, 0x298aULL, 0x4907ULL },
+    { 0x5568ULL, 0xc2e1ULL, 0x16aaULL, 0x8743ULL },
+    { 0x5d41ULL, 0xd0e4ULL, 0x82baULL, 0x270bULL },
+    { 0x5f97ULL, 0xf5d6ULL, 0xe9faULL, 0x6bafULL },
+    { 0x6801ULL, 0x1884ULL, 0x8016ULL, 0x2118ULL },
+    { 0x6867ULL, 0x1bb4ULL, 0xe616ULL, 0x2dd8ULL },
+    { 0x6124ULL, 0x4a90ULL, 0x2486ULL, 0x0952ULL },
+    { 0x61e9ULL, 0x5aa3ULL, 0x9786ULL, 0xc55aULL },
+    { 0x6b12ULL, 0x6d84ULL, 0x48d6ULL, 0x21b6ULL },
+    { 0x6fe5ULL, 0x5ef6ULL, 0xa7f6ULL, 0x6f7aULL },
+    { 0x67dfULL, 0x7df3ULL, 0xfbe6ULL, 0xcfbeULL },
+    { 0x7e1bULL, 0xbdc5ULL, 0xd87eULL, 0xa3bdULL },
+    { 0x80a0ULL, 0x020aULL, 0x0501ULL, 0x5040ULL },
+    { 0x8344ULL, 0x4438ULL, 0x22c1ULL, 0x1c22ULL },
+    { 0x8ba2ULL, 0x470eULL, 0x45d1ULL, 0x70e2ULL },
+    { 0x937aULL, 0xe729ULL, 0x5ec9ULL, 0x94e7ULL },
+    { 0x846cULL, 0x0279ULL, 0x3621ULL, 0x9e40ULL },
+    { 0x852aULL, 0x4349ULL, 0x54a1ULL, 0x92c2ULL },
+    { 0x859cULL, 0x605bULL, 0x39a1ULL, 0xda06ULL },
+    { 0x9c89ULL, 0x904fULL, 0x9139ULL, 0xf209ULL },
+    { 0x9fa1ULL, 0xd64eULL, 0x85f9ULL, 0x726bULL },
+    { 0xbb7cULL, 0xee3dULL, 0x3eddULL, 0xbc77ULL },
+    { 0xbc04ULL, 0x885cULL, 0x203dULL, 0x3a11ULL },
+    { 0xb65bULL, 0xbd69ULL, 0xda6dULL, 0x96bdULL },
+    { 0xbfc8ULL, 0xcc6fULL, 0x13fdULL, 0xf633ULL },
+    { 0xb7abULL, 0xdf4bULL, 0xd5edULL, 0xd2fbULL },
+    { 0xca1fULL, 0x359dULL, 0xf853ULL, 0xb9acULL },
+    { 0xc962ULL, 0x43acULL, 0x4693ULL, 0x35c2ULL },
+    { 0xd958ULL, 0xe0adULL, 0x1a9bULL, 0xb507ULL },
+    { 0xd3d5ULL, 0xf4baULL, 0xabcbULL, 0x5d2fULL },
+    { 0xcc98ULL, 0x20cfULL, 0x1933ULL, 0xf304ULL },
+    { 0xc7a0ULL, 0x46caULL, 0x05e3ULL, 0x5362ULL },
+    { 0xc537ULL, 0x73d8ULL, 0xeca3ULL, 0x1bceULL },
+    { 0xe95dULL, 0x78bdULL, 0xba97ULL, 0xbd1eULL },
+    { 0xf925ULL, 0xda9cULL, 0xa49fULL, 0x395bULL },
+    { 0xfbbbULL, 0xff8fULL, 0xdddfULL, 0xf1ffULL },
+    { 0xee2aULL, 0x0fcdULL, 0x5477ULL, 0xb3f0ULL },
+    { 0xf74dULL, 0xdcf9ULL, 0xb2efULL, 0x9f3bULL },
+    { 0x3575ULL, 0xfa70ULL, 0xaeacULL, 0x0e5fULL },
+    { 0x8aadULL, 0x161fULL, 0xb551ULL, 0xf868ULL },
+    { 0x7617ULL, 0xbdd0ULL, 0xe86eULL, 0x0bbdULL },
+    { 0x0acfULL, 0x1537ULL, 0xf350ULL, 0xeca8ULL },
+    { 0x064bULL, 0x1561ULL, 0xd260ULL, 0x86a8ULL },
+    { 0x2dc1ULL, 0x5866ULL, 0x83b4ULL, 0x661aULL },
+    { 0x49d8ULL, 0x60a7ULL, 0x1b92ULL, 0xe506ULL },
+    { 0x43f4ULL, 0x66b2ULL, 0x2fc2ULL, 0x4d66ULL },
+    { 0x4f36ULL, 0x67d4ULL, 0x6cf2ULL, 0x2be6ULL },
+    { 0x4fd3ULL, 0x75e6ULL, 0xcbf2ULL, 0x67aeULL },
+    { 0x69e4ULL, 0x4ab6ULL, 0x2796ULL, 0x6d52ULL },
+    { 0x70c7ULL, 0x99b2ULL, 0xe30eULL, 0x4d99ULL },
+    { 0x7a6eULL, 0x8fb5ULL, 0x765eULL, 0xadf1ULL },
+    { 0xb4eaULL, 0x8b6bULL, 0x572dULL, 0xd6d1ULL },
+    { 0xed4fULL, 0x59fdULL, 0xf2b7ULL, 0xbf9aULL },
+    { 0xfce7ULL, 0x9bfeULL, 0xe73fULL, 0x7fd9ULL },
+    { 0xfea6ULL, 0x8fdeULL, 0x657fULL, 0x7bf1ULL },
+    { 0x0025ULL, 0x1210ULL, 0xa400ULL, 0x0848ULL },
+    { 0x0043ULL, 0x1120ULL, 0xc200ULL, 0x0488ULL },
+    { 0x0a88ULL, 0x0407ULL, 0x1150ULL, 0xe020ULL },
+    { 0x0a86ULL, 0x0516ULL, 0x6150ULL, 0x68a0ULL },
+    { 0x026fULL, 0x1731ULL, 0xf640ULL, 0x8ce8ULL },
+    { 0x001cULL, 0x2011ULL, 0x3800ULL, 0x8804ULL },
+    { 0x0097ULL, 0x3112ULL, 0xe900ULL, 0x488cULL },
+    { 0x0837ULL, 0x3314ULL, 0xec10ULL, 0x28ccULL },
+    { 0x0a31ULL, 0x3604ULL, 0x8c50ULL, 0x206cULL },
+    { 0x09c6ULL, 0x4136ULL, 0x6390ULL, 0x6c82ULL },
+    { 0x0b01ULL, 0x5404ULL, 0x80d0ULL, 0x202aULL },
+    { 0x09fbULL, 0x7327ULL, 0xdf90ULL, 0xe4ceULL },
+    { 0x0b58ULL, 0x6425ULL, 0x1ad0ULL, 0xa426ULL },
+    { 0x1082ULL, 0x8102ULL, 0x4108ULL, 0x4081ULL },
+    { 0x182dULL, 0x9215ULL, 0xb418ULL, 0xa849ULL },
+    { 0x1078ULL, 0xa221ULL, 0x1e08ULL, 0x8445ULL },
+    { 0x1073ULL, 0xb320ULL, 0xce08ULL, 0x04cdULL },
+    { 0x1274ULL, 0xa630ULL, 0x2e48ULL, 0x0c65ULL },
+    { 0x12b1ULL, 0xb602ULL, 0x8d48ULL, 0x406dULL },
+    { 0x1af9ULL, 0xb627ULL, 0x9f58ULL, 0xe46dULL },
+    { 0x1306ULL, 0xc510ULL, 0x60c8ULL, 0x08a3ULL },
+    { 0x0c0eULL, 0x0155ULL, 0x7030ULL, 0xaa80ULL },
+    { 0x0cf1ULL, 0x3266ULL, 0x8f30ULL, 0x664cULL },
+    { 0x0433ULL, 0x3340ULL, 0xcc20ULL, 0x02ccULL },
+    { 0x0c9fULL, 0x3157ULL, 0xf930ULL, 0xea8cULL },
+    { 0x0ef2ULL, 0x2766ULL, 0x4f70ULL, 0x66e4ULL },
+    { 0x0efdULL, 0x3677ULL, 0xbf70ULL, 0xee6cULL },
+    { 0x074cULL, 0x4471ULL, 0x32e0ULL, 0x8e22ULL },
+    { 0x0fa4ULL, 0x4656ULL, 0x25f0ULL, 0x6a62ULL },
+    { 0x072fULL, 0x5751ULL, 0xf4e0ULL, 0x8aeaULL },
+    { 0x05b5ULL, 0x7252ULL, 0xada0ULL, 0x4a4eULL },
+    { 0x0f91ULL, 0x7446ULL, 0x89f0ULL, 0x622eULL },
+    { 0x07dbULL, 0x7563ULL, 0xdbe0ULL, 0xc6aeULL },
+    { 0x1ee4ULL, 0x8676ULL, 0x2778ULL, 0x6e61ULL },
+    { 0x1439ULL, 0xb241ULL, 0x9c28ULL, 0x824dULL },
+    { 0x1d80ULL, 0xc046ULL, 0x01b8ULL, 0x6203ULL },
+    { 0x15c8ULL, 0xc063ULL, 0x13a8ULL, 0xc603ULL },
+    { 0x1f8bULL, 0xd547ULL, 0xd1f8ULL, 0xe2abULL },
+    { 0x15baULL, 0xe343ULL, 0x5da8ULL, 0xc2c7ULL },
+    { 0x1db1ULL, 0xf246ULL, 0x8db8ULL, 0x624fULL },
+    { 0x2080ULL, 0x0802ULL, 0x0104ULL, 0x4010ULL },
+    { 0x28e9ULL, 0x1a27ULL, 0x9714ULL, 0xe458ULL },
+    { 0x22a2ULL, 0x0f02ULL, 0x4544ULL, 0x40f0ULL },
+    { 0x2853ULL, 0x3924ULL, 0xca14ULL, 0x249cULL },
+    { 0x2af0ULL, 0x2e26ULL, 0x0f54ULL, 0x6474ULL },
+    { 0x22f7ULL, 0x3f32ULL, 0xef44ULL, 0x4cfcULL },
+    { 0x2940ULL, 0x4824ULL, 0x0294ULL, 0x2412ULL },
+    { 0x2146ULL, 0x4930ULL, 0x6284ULL, 0x0c92ULL },
+    { 0x29b9ULL, 0x7a07ULL, 0x9d94ULL, 0xe05eULL },
+    { 0x2b9cULL, 0x6c17ULL, 0x39d4ULL, 0xe836ULL },
+    { 0x2bb2ULL, 0x6f06ULL, 0x4dd4ULL, 0x60f6ULL },
+    { 0x38caULL, 0x8927ULL, 0x531cULL, 0xe491ULL },
+    { 0x382eULL, 0x8b15ULL, 0x741cULL, 0xa8d1ULL },
+    { 0x3007ULL, 0x9910ULL, 0xe00cULL, 0x0899ULL },
+    { 0x38e7ULL, 0x9b36ULL, 0xe71cULL, 0x6cd9ULL },
+    { 0x3a49ULL, 0x9c25ULL, 0x925cULL, 0xa439ULL },
+    { 0x3a65ULL, 0x9e34ULL, 0xa65cULL, 0x2c79ULL },
+    { 0x325dULL, 0xbc31ULL, 0xba4cULL, 0x8c3dULL },
+    { 0x3b88ULL, 0xcc07ULL, 0x11dcULL, 0xe033ULL },
+    { 0x391dULL, 0xf815ULL, 0xb89cULL, 0xa81fULL },
+    { 0x3bd3ULL, 0xfd26ULL, 0xcbdcULL, 0x64bfULL },
+    { 0x2647ULL, 0x1d70ULL, 0xe264ULL, 0x0eb8ULL },
+    { 0x2780ULL, 0x4c42ULL, 0x01e4ULL, 0x4232ULL },
+    { 0x2faaULL, 0x4f47ULL, 0x55f4ULL, 0xe2f2ULL },
+    { 0x2d14ULL, 0x6854ULL, 0x28b4ULL, 0x2a16ULL },
+    { 0x25deULL, 0x6973ULL, 0x7ba4ULL, 0xce96ULL },
+    { 0x2553ULL, 0x7960ULL, 0xcaa4ULL, 0x069eULL },
+    { 0x2f77ULL, 0x7f74ULL, 0xeef4ULL, 0x2efeULL },
+    { 0x3448ULL, 0x8861ULL, 0x122cULL, 0x8611ULL },
+    { 0x3ca8ULL, 0x8a47ULL, 0x153cULL, 0xe251ULL },
+    { 0x3c41ULL, 0x9864ULL, 0x823cULL, 0x2619ULL },
+    { 0x340dULL, 0x9851ULL, 0xb02cULL, 0x8a19ULL },
+    { 0x34fbULL, 0xbb63ULL, 0xdf2cULL, 0xc6ddULL },
+    { 0x369aULL, 0xad43ULL, 0x596cULL, 0xc2b5ULL },
+    { 0x3de0ULL, 0xca66ULL, 0x07bcULL, 0x6653ULL },
+    { 0x356aULL, 0xcb61ULL, 0x56acULL, 0x86d3ULL },
+    { 0x3d09ULL, 0xd845ULL, 0x90bcULL, 0xa21bULL },
+    { 0x3dedULL, 0xda77ULL, 0xb7bcULL, 0xee5bULL },
+    { 0x3fc4ULL, 0xcc76ULL, 0x23fcULL, 0x6e33ULL },
+    { 0x3f6cULL, 0xce75ULL, 0x36fcULL, 0xae73ULL },
+    { 0x37ceULL, 0xcd73ULL, 0x73ecULL, 0xceb3ULL },
+    { 0x3d5cULL, 0xe875ULL, 0x3abcULL, 0xae17ULL },
+    { 0x3d76ULL, 0xeb74ULL, 0x6ebcULL, 0x2ed7ULL },
+    { 0x37b0ULL, 0xee42ULL, 0x0decULL, 0x4277ULL },
+    { 0x3f17ULL, 0xfd54ULL, 0xe8fcULL, 0x2abfULL },
+    { 0x3fffULL, 0xff77ULL, 0xfffcULL, 0xeeffULL },
+    { 0x48e5ULL, 0x12b6ULL, 0xa712ULL, 0x6d48ULL },
+    { 0x4268ULL, 0x06a1ULL, 0x1642ULL, 0x8560ULL },
+    { 0x4a2dULL, 0x1695ULL, 0xb452ULL, 0xa968ULL },
+    { 0x4160ULL, 0x42a0ULL, 0x0682ULL, 0x0542ULL },
+    { 0x4951ULL, 0x70a4ULL, 0x8a92ULL, 0x250eULL },
+    { 0x41ddULL, 0x70b3ULL, 0xbb82ULL, 0xcd0eULL },
+    { 0x4bdfULL, 0x75b7ULL, 0xfbd2ULL, 0xedaeULL },
+    { 0x584fULL, 0x91b5ULL, 0xf21aULL, 0xad89ULL },
+    { 0x5a48ULL, 0x84a5ULL, 0x125aULL, 0xa521ULL },
+    { 0x5816ULL, 0xa194ULL, 0x681aULL, 0x2985ULL },
+    { 0x505dULL, 0xb0b1ULL, 0xba0aULL, 0x8d0dULL },
+    { 0x5afaULL, 0xa7a7ULL, 0x5f5aULL, 0xe5e5ULL },
+    { 0x5ab5ULL, 0xb696ULL, 0xad5aULL, 0x696dULL },
+    { 0x5123ULL, 0xd380ULL, 0xc48aULL, 0x01cbULL },
+    { 0x5b8aULL, 0xc587ULL, 0x51daULL, 0xe1a3ULL },
+    { 0x5919ULL, 0xf085ULL, 0x989aULL, 0xa10fULL },
+    { 0x5135ULL, 0xf290ULL, 0xac8aULL, 0x094fULL },
+    { 0x4c69ULL, 0x12e5ULL, 0x9632ULL, 0xa748ULL },
+    { 0x46c1ULL, 0x14e2ULL, 0x8362ULL, 0x4728ULL },
+    { 0x4e0bULL, 0x15c5ULL, 0xd072ULL, 0xa3a8ULL },
+    { 0x445fULL, 0x31f1ULL, 0xfa22ULL, 0x8f8cULL },
+    { 0x4e59ULL, 0x34e5ULL, 0x9a72ULL, 0xa72cULL },
+    { 0x4d83ULL, 0x51c6ULL, 0xc1b2ULL, 0x638aULL },
+    { 0x4d7dULL, 0x72f5ULL, 0xbeb2ULL, 0xaf4eULL },
+    { 0x47d8ULL, 0x64e3ULL, 0x1be2ULL, 0xc726ULL },
+    { 0x4773ULL, 0x77e0ULL, 0xcee2ULL, 0x07eeULL },
+    { 0x5c85ULL, 0x90d6ULL, 0xa13aULL, 0x6b09ULL },
+    { 0x5e44ULL, 0x84f4ULL, 0x227aULL, 0x2f21ULL },
+    { 0x562bULL, 0x97c1ULL, 0xd46aULL, 0x83e9ULL },
+    { 0x5cbbULL, 0xb3c7ULL, 0xdd3aULL, 0xe3cdULL },
+    { 0x55c3ULL, 0xd1e2ULL, 0xc3aaULL, 0x478bULL },
+    { 0x5f6eULL, 0xc7f5ULL, 0x76faULL, 0xafe3ULL },
+    { 0x5febULL, 0xd7e7ULL, 0xd7faULL, 0xe7ebULL },
+    { 0x5d12ULL, 0xe1c4ULL, 0x48baULL, 0x2387ULL },
+    { 0x555eULL, 0xe1f1ULL, 0x7aaaULL, 0x8f87ULL },
+    { 0x6270ULL, 0x2ea0ULL, 0x0e46ULL, 0x0574ULL },
+    { 0x6215ULL, 0x3c90ULL, 0xa846ULL, 0x093cULL },
+    { 0x61c2ULL, 0x49a2ULL, 0x4386ULL, 0x4592ULL },
+    { 0x6b20ULL, 0x4e84ULL, 0x04d6ULL, 0x2172ULL },
+    { 0x6345ULL, 0x5cb0ULL, 0xa2c6ULL, 0x0d3aULL },
+    { 0x6b5cULL, 0x6cb5ULL, 0x3ad6ULL, 0xad36ULL },
+    { 0x6b5bULL, 0x7da5ULL, 0xdad6ULL, 0xa5beULL },
+    { 0x780cULL, 0x8895ULL, 0x301eULL, 0xa911ULL },
+    { 0x7acfULL, 0x9db7ULL, 0xf35eULL, 0xedb9ULL },
+    { 0x787fULL, 0xbbb5ULL, 0xfe1eULL, 0xadddULL },
+    { 0x7980ULL, 0xc886ULL, 0x019eULL, 0x6113ULL },
+    { 0x71e5ULL, 0xdab2ULL, 0xa78eULL, 0x4d5bULL },
+    { 0x7174ULL, 0xeab0ULL, 0x2e8eULL, 0x0d57ULL },
+    { 0x79b6ULL, 0xeb96ULL, 0x6d9eULL, 0x69d7ULL },
+    { 0x71d3ULL, 0xf9a2ULL, 0xcb8eULL, 0x459fULL },
+    { 0x7b33ULL, 0xff84ULL, 0xccdeULL, 0x21ffULL },
+    { 0x646aULL, 0x0be1ULL, 0x5626ULL, 0x87d0ULL },
+    { 0x66a8ULL, 0x0ec3ULL, 0x1566ULL, 0xc370ULL },
+    { 0x6ea7ULL, 0x1fd6ULL, 0xe576ULL, 0x6bf8ULL },
+    { 0x6e91ULL, 0x3cc6ULL, 0x8976ULL, 0x633cULL },
+    { 0x6522ULL, 0x4bc0ULL, 0x44a6ULL, 0x03d2ULL },
+    { 0x6dcbULL, 0x59e7ULL, 0xd3b6ULL, 0xe79aULL },
+    { 0x678dULL, 0x5cd3ULL, 0xb1e6ULL, 0xcb3aULL },
+    { 0x6d31ULL, 0x7ac4ULL, 0x8cb6ULL, 0x235eULL },
+    { 0x7e80ULL, 0x8cc6ULL, 0x017eULL, 0x6331ULL },
+    { 0x7ee2ULL, 0x8fe6ULL, 0x477eULL, 0x67f1ULL },
+    { 0x7e8dULL, 0x9cd7ULL, 0xb17eULL, 0xeb39ULL },
+    { 0x74d2ULL, 0xa9e2ULL, 0x4b2eULL, 0x4795ULL },
+    { 0x7c32ULL, 0xabc4ULL, 0x4c3eULL, 0x23d5ULL },
+    { 0x7e35ULL, 0xbed4ULL, 0xac7eULL, 0x2b7dULL },
+    { 0x75abULL, 0xdbc3ULL, 0xd5aeULL, 0xc3dbULL },
+    { 0x7705ULL, 0xdcd0ULL, 0xa0eeULL, 0x0b3bULL },
+    { 0x7f2bULL, 0xdfc5ULL, 0xd4feULL, 0xa3fbULL },
+    { 0x7ddaULL, 0xe9e7ULL, 0x5bbeULL, 0xe797ULL },
+    { 0x7f92ULL, 0xedc6ULL, 0x49feULL, 0x63b7ULL },
+    { 0x8075ULL, 0x3238ULL, 0xae01ULL, 0x1c4cULL },
+    { 0x80f3ULL, 0x332aULL, 0xcf01ULL, 0x54ccULL },
+    { 0x81a6ULL, 0x431aULL, 0x6581ULL, 0x58c2ULL },
+    { 0x89edULL, 0x523fULL, 0xb791ULL, 0xfc4aULL },
+    { 0x81fcULL, 0x623bULL, 0x3f81ULL, 0xdc46ULL },
+    { 0x98a6ULL, 0x831eULL, 0x6519ULL, 0x78c1ULL },
+    { 0x9a20ULL, 0x860cULL, 0x0459ULL, 0x3061ULL },
+    { 0x9143ULL, 0xd128ULL, 0xc289ULL, 0x148bULL },
+    { 0x99f9ULL, 0xf22fULL, 0x9f99ULL, 0xf44fULL },
+    { 0x9193ULL, 0xf10aULL, 0xc989ULL, 0x508fULL },
+    { 0x9bd4ULL, 0xe43eULL, 0x2bd9ULL, 0x7c27ULL },
+    { 0x8409ULL, 0x1049ULL, 0x9021ULL, 0x9208ULL },
+    { 0x846bULL, 0x1369ULL, 0xd621ULL, 0x96c8ULL },
+    { 0x86c4ULL, 0x047aULL, 0x2361ULL, 0x5e20ULL },
+    { 0x8e64ULL, 0x067cULL, 0x2671ULL, 0x3e60ULL },
+    { 0x861aULL, 0x2549ULL, 0x5861ULL, 0x92a4ULL },
+    { 0x854eULL, 0x4179ULL, 0x72a1ULL, 0x9e82ULL },
+    { 0x8dcbULL, 0x516fULL, 0xd3b1ULL, 0xf68aULL },
+    { 0x8567ULL, 0x5378ULL, 0xe6a1ULL, 0x1ecaULL },
+    { 0x85afULL, 0x535bULL, 0xf5a1ULL, 0xdacaULL },
+    { 0x85d7ULL, 0x717aULL, 0xeba1ULL, 0x5e8eULL },
+    { 0x87b3ULL, 0x774aULL, 0xcde1ULL, 0x52eeULL },
+    { 0x9ce1ULL, 0x926eULL, 0x8739ULL, 0x7649ULL },
+    { 0x9cf2ULL, 0xa36eULL, 0x4f39ULL, 0x76c5ULL },
+    { 0x9417ULL, 0xb158ULL, 0xe829ULL, 0x1a8dULL },
+    { 0x9500ULL, 0xc048ULL, 0x00a9ULL, 0x1203ULL },
+    { 0x95a2ULL, 0xc34aULL, 0x45a9ULL, 0x52c3ULL },
+    { 0x9d23ULL, 0xd34cULL, 0xc4b9ULL, 0x32cbULL },
+    { 0x9f62ULL, 0xc76cULL, 0x46f9ULL, 0x36e3ULL },
+    { 0x9d52ULL, 0xe16cULL, 0x4ab9ULL, 0x3687ULL },
+    { 0x95daULL, 0xe16bULL, 0x5ba9ULL, 0xd687ULL },
+    { 0xa0c5ULL, 0x183aULL, 0xa305ULL, 0x5c18ULL },
+    { 0xaacdULL, 0x1c3fULL, 0xb355ULL, 0xfc38ULL },
+    { 0xa2d8ULL, 0x2c2bULL, 0x1b45ULL, 0xd434ULL },
+    { 0xa257ULL, 0x3d38ULL, 0xea45ULL, 0x1cbcULL },
+    { 0xa93dULL, 0x7a1dULL, 0xbc95ULL, 0xb85eULL },
+    { 0xa957ULL, 0x793cULL, 0xea95ULL, 0x3c9eULL },
+    { 0xab52ULL, 0x6d2cULL, 0x4ad5ULL, 0x34b6ULL },
+    { 0xa336ULL, 0x6f18ULL, 0x6cc5ULL, 0x18f6ULL },
+    { 0xa359ULL, 0x7c29ULL, 0x9ac5ULL, 0x943eULL },
+    { 0xb0f4ULL, 0xaa3aULL, 0x2f0dULL, 0x5c55ULL },
+    { 0xb812ULL, 0xa90cULL, 0x481dULL, 0x3095ULL },
+    { 0xb0bfULL, 0xbb1bULL, 0xfd0dULL, 0xd8ddULL },
+    { 0xb29dULL, 0xbc1bULL, 0xb94dULL, 0xd83dULL },
+    { 0xbbedULL, 0xde3fULL, 0xb7ddULL, 0xfc7bULL },
+    { 0xb972ULL, 0xeb2cULL, 0x4e9dULL, 0x34d7ULL },
+    { 0xb996ULL, 0xe91eULL, 0x699dULL, 0x7897ULL },
+    { 0xa4c3ULL, 0x196aULL, 0xc325ULL, 0x5698ULL },
+    { 0xacd2ULL, 0x296eULL, 0x4b35ULL, 0x7694ULL },
+    { 0xaeb1ULL, 0x3e4eULL, 0x8d75ULL, 0x727cULL },
+    { 0xa582ULL, 0x494aULL, 0x41a5ULL, 0x5292ULL },
+    { 0xaf65ULL, 0x5e7cULL, 0xa6f5ULL, 0x3e7aULL },
+    { 0xa57bULL, 0x7b69ULL, 0xdea5ULL, 0x96deULL },
+    { 0xaffaULL, 0x6f6fULL, 0x5ff5ULL, 0xf6f6ULL },
+    { 0xb464ULL, 0x8a78ULL, 0x262dULL, 0x1e51ULL },
+    { 0xbc62ULL, 0x8b6cULL, 0x463dULL, 0x36d1ULL },
+    { 0xb481ULL, 0x984aULL, 0x812dULL, 0x5219ULL },
+    { 0xb6a0ULL, 0x8e4aULL, 0x056dULL, 0x5271ULL },
+    { 0xbeeeULL, 0x8f7fULL, 0x777dULL, 0xfef1ULL },
+    { 0xbe0dULL, 0x9c5dULL, 0xb07dULL, 0xba39ULL },
+    { 0xbcd9ULL, 0xb86fULL, 0x9b3dULL, 0xf61dULL },
+    { 0xbef8ULL, 0xae6fULL, 0x1f7dULL, 0xf675ULL },
+    { 0xb528ULL, 0xca49ULL, 0x14adULL, 0x9253ULL },
+    { 0xb709ULL, 0xdc49ULL, 0x90edULL, 0x923bULL },
+    { 0xb7d2ULL, 0xed6aULL, 0x4bedULL, 0x56b7ULL },
+    { 0xc0eaULL, 0x03abULL, 0x5703ULL, 0xd5c0ULL },
+    { 0xc019ULL, 0x3089ULL, 0x9803ULL, 0x910cULL },
+    { 0xc0fdULL, 0x32bbULL, 0xbf03ULL, 0xdd4cULL },
+    { 0xc8d3ULL, 0x31aeULL, 0xcb13ULL, 0x758cULL },
+    { 0xca5aULL, 0x25adULL, 0x5a53ULL, 0xb5a4ULL },
+    { 0xc14dULL, 0x50b9ULL, 0xb283ULL, 0x9d0aULL },
+    { 0xc9b4ULL, 0x629eULL, 0x2d93ULL, 0x7946ULL },
+    { 0xc157ULL, 0x71b8ULL, 0xea83ULL, 0x1d8eULL },
+    { 0xc398ULL, 0x648bULL, 0x19c3ULL, 0xd126ULL },
+    { 0xc31dULL, 0x7499ULL, 0xb8c3ULL, 0x992eULL },
+    { 0xd880ULL, 0x808eULL, 0x011bULL, 0x7101ULL },
+    { 0xd8efULL, 0x93bfULL, 0xf71bULL, 0xfdc9ULL },
+    { 0xda2bULL, 0x978dULL, 0xd45bULL, 0xb1e9ULL },
+    { 0xd01eULL, 0xa199ULL, 0x780bULL, 0x9985ULL },
+    { 0xd105ULL, 0xd098ULL, 0xa08bULL, 0x190bULL },
+    { 0xd3adULL, 0xd69bULL, 0xb5cbULL, 0xd96bULL },
+    { 0xdba7ULL, 0xd79eULL, 0xe5dbULL, 0x79ebULL },
+    { 0xc4c9ULL, 0x10ebULL, 0x9323ULL, 0xd708ULL },
+    { 0xcc78ULL, 0x22edULL, 0x1e33ULL, 0xb744ULL },
+    { 0xcd45ULL, 0x50fcULL, 0xa2b3ULL, 0x3f0aULL },
+    { 0xc50bULL, 0x51c9ULL, 0xd0a3ULL, 0x938aULL },
+    { 0xcfcfULL, 0x55ffULL, 0xf3f3ULL, 0xffaaULL },
+    { 0xdcacULL, 0x82dfULL, 0x353bULL, 0xfb41ULL },
+    { 0xd402ULL, 0x81c8ULL, 0x402bULL, 0x1381ULL },
+    { 0xdc63ULL, 0x93ecULL, 0xc63bULL, 0x37c9ULL },
+    { 0xd427ULL, 0x93d8ULL, 0xe42bULL, 0x1bc9ULL },
+    { 0xd4f5ULL, 0xb2faULL, 0xaf2bULL, 0x5f4dULL },
+    { 0xd678ULL, 0xa6e9ULL, 0x1e6bULL, 0x9765ULL },
+    { 0xdeb8ULL, 0xa6cfULL, 0x1d7bULL, 0xf365ULL },
+    { 0xdde6ULL, 0xc3feULL, 0x67bbULL, 0x7fc3ULL },
+    { 0xd55dULL, 0xf0f9ULL, 0xbaabULL, 0x9f0fULL },
+    { 0xddbdULL, 0xf2dfULL, 0xbdbbULL, 0xfb4fULL },
+    { 0xdf1dULL, 0xf4ddULL, 0xb8fbULL, 0xbb2fULL },
+    { 0xe2caULL, 0x0dabULL, 0x5347ULL, 0xd5b0ULL },
+    { 0xea6bULL, 0x1fadULL, 0xd657ULL, 0xb5f8ULL },
+    { 0xe0b4ULL, 0x2a9aULL, 0x2d07ULL, 0x5954ULL },
+    { 0xe238ULL, 0x2e89ULL, 0x1c47ULL, 0x9174ULL },
+    { 0xe2d4ULL, 0x2cbaULL, 0x2b47ULL, 0x5d34ULL },
+    { 0xe322ULL, 0x4f88ULL, 0x44c7ULL, 0x11f2ULL },
+    { 0xe1d8ULL, 0x68abULL, 0x1b87ULL, 0xd516ULL },
+    { 0xf003ULL, 0x9988ULL, 0xc00fULL, 0x1199ULL },
+    { 0xf2ccULL, 0x8cbbULL, 0x334fULL, 0xdd31ULL },
+    { 0xf8f6ULL, 0xabbeULL, 0x6f1fULL, 0x7dd5ULL },
+    { 0xf149ULL, 0xd8a9ULL, 0x928fULL, 0x951bULL },
+    { 0xf3eaULL, 0xcfabULL, 0x57cfULL, 0xd5f3ULL },
+    { 0xf19cULL, 0xe89bULL, 0x398fULL, 0xd917ULL },
+    { 0xf9f5ULL, 0xfabeULL, 0xaf9fULL, 0x7d5fULL },
+    { 0xf13bULL, 0xfb89ULL, 0xdc8fULL, 0x91dfULL },
+    { 0xec8dULL, 0x18dfULL, 0xb137ULL, 0xfb18ULL },
+    { 0xeec9ULL, 0x1cefULL, 0x9377ULL, 0xf738ULL },
+    { 0xe60fULL, 0x1dd9ULL, 0xf067ULL, 0x9bb8ULL },
+    { 0xe4f7ULL, 0x3bfaULL, 0xef27ULL, 0x5fdcULL },
+    { 0xe760ULL, 0x4ee8ULL, 0x06e7ULL, 0x1772ULL },
+    { 0xefe8ULL, 0x4eefULL, 0x17f7ULL, 0xf772ULL },
+    { 0xedb2ULL, 0x6bceULL, 0x4db7ULL, 0x73d6ULL },
+    { 0xe515ULL, 0x78d8ULL, 0xa8a7ULL, 0x1b1eULL },
+    { 0xefd1ULL, 0x7ceeULL, 0x8bf7ULL, 0x773eULL },
+    { 0xf486ULL, 0x89daULL, 0x612fULL, 0x5b91ULL },
+    { 0xfc01ULL, 0x98ccULL, 0x803fULL, 0x3319ULL },
+    { 0xf6c3ULL, 0x9deaULL, 0xc36fULL, 0x57b9ULL },
+    { 0xf47cULL, 0xaaf9ULL, 0x3e2fULL, 0x9f55ULL },
+    { 0xfc93ULL, 0xb9ceULL, 0xc93fULL, 0x739dULL },
+    { 0xf542ULL, 0xc9e8ULL, 0x42afULL, 0x1793ULL },
+    { 0xfd98ULL, 0xe8cfULL, 0x19bfULL, 0xf317ULL },
+    { 0xf53dULL, 0xfad9ULL, 0xbcafULL, 0x9b5fULL },
+    { 0x02bdULL, 0x3613ULL, 0xbd40ULL, 0xc86cULL },
+    { 0x00e1ULL, 0x1222ULL, 0x8700ULL, 0x4448ULL },
+    { 0x02e2ULL, 0x0722ULL, 0x4740ULL, 0x44e0ULL },
+    { 0x02aeULL, 0x0713ULL, 0x7540ULL, 0xc8e0ULL },
+    { 0x0878ULL, 0x2225ULL, 0x1e10ULL, 0xa444ULL },
+    { 0x0074ULL, 0x2230ULL, 0x2e00ULL, 0x0c44ULL },
+    { 0x089eULL, 0x2117ULL, 0x7910ULL, 0xe884ULL },
+    { 0x08d1ULL, 0x3026ULL, 0x8b10ULL, 0x640cULL },
+    { 0x087dULL, 0x3235ULL, 0xbe10ULL, 0xac4cULL },
+    { 0x0a32ULL, 0x2704ULL, 0x4c50ULL, 0x20e4ULL },
+    { 0x0adeULL, 0x2537ULL, 0x7b50ULL, 0xeca4ULL },
+    { 0x0251ULL, 0x3420ULL, 0x8a40ULL, 0x042cULL },
+    { 0x01a2ULL, 0x4302ULL, 0x4580ULL, 0x40c2ULL },
+    { 0x0380ULL, 0x4402ULL, 0x01c0ULL, 0x4022ULL },
+    { 0x0b83ULL, 0x5506ULL, 0xc1d0ULL, 0x60aaULL },
+    { 0x0b4bULL, 0x5525ULL, 0xd2d0ULL, 0xa4aaULL },
+    { 0x0b27ULL, 0x5714ULL, 0xe4d0ULL, 0x28eaULL },
+    { 0x0befULL, 0x5737ULL, 0xf7d0ULL, 0xeceaULL },
+    { 0x09b6ULL, 0x6316ULL, 0x6d90ULL, 0x68c6ULL },
+    { 0x0959ULL, 0x7025ULL, 0x9a90ULL, 0xa40eULL },
+    { 0x0993ULL, 0x7106ULL, 0xc990ULL, 0x608eULL },
+    { 0x0bf8ULL, 0x6627ULL, 0x1fd0ULL, 0xe466ULL },
+    { 0x03d9ULL, 0x7423ULL, 0x9bc0ULL, 0xc42eULL },
+    { 0x03f1ULL, 0x7622ULL, 0x8fc0ULL, 0x446eULL },
+    { 0x10c4ULL, 0x8032ULL, 0x2308ULL, 0x4c01ULL },
+    { 0x18abULL, 0x9307ULL, 0xd518ULL, 0xe0c9ULL },
+    { 0x1aa0ULL, 0x8606ULL, 0x0558ULL, 0x6061ULL },
+    { 0x1a04ULL, 0x8414ULL, 0x2058ULL, 0x2821ULL },
+    { 0x1a6cULL, 0x8635ULL, 0x3658ULL, 0xac61ULL },
+    { 0x1aaeULL, 0x8717ULL, 0x7558ULL, 0xe8e1ULL },
+    { 0x1289ULL, 0x9403ULL, 0x9148ULL, 0xc029ULL },
+    { 0x1017ULL, 0xb110ULL, 0xe808ULL, 0x088dULL },
+    { 0x1af3ULL, 0xb726ULL, 0xcf58ULL, 0x64edULL },
+    { 0x1940ULL, 0xc024ULL, 0x0298ULL, 0x2403ULL },
+    { 0x1102ULL, 0xc100ULL, 0x4088ULL, 0x0083ULL },
+    { 0x112bULL, 0xd301ULL, 0xd488ULL, 0x80cbULL },
+    { 0x11cfULL, 0xd133ULL, 0xf388ULL, 0xcc8bULL },
+    { 0x1b22ULL, 0xc704ULL, 0x44d8ULL, 0x20e3ULL },
+    { 0x132eULL, 0xc711ULL, 0x74c8ULL, 0x88e3ULL },
+    { 0x1115ULL, 0xf010ULL, 0xa888ULL, 0x080fULL },
+    { 0x13bbULL, 0xf703ULL, 0xddc8ULL, 0xc0efULL },
+    { 0x0c20ULL, 0x0244ULL, 0x0430ULL, 0x2240ULL },
+    { 0x0cc9ULL, 0x1067ULL, 0x9330ULL, 0xe608ULL },
+    { 0x0cdcULL, 0x2077ULL, 0x3b30ULL, 0xee04ULL },
+    { 0x0c36ULL, 0x2354ULL, 0x6c30ULL, 0x2ac4ULL },
+    { 0x0614ULL, 0x2450ULL, 0x2860ULL, 0x0a24ULL },
+    { 0x0672ULL, 0x2760ULL, 0x4e60ULL, 0x06e4ULL },
+    { 0x0d61ULL, 0x5264ULL, 0x86b0ULL, 0x264aULL },
+    { 0x050dULL, 0x5051ULL, 0xb0a0ULL, 0x8a0aULL },
+    { 0x0d8fULL, 0x5157ULL, 0xf1b0ULL, 0xea8aULL },
+    { 0x0fe0ULL, 0x4666ULL, 0x07f0ULL, 0x6662ULL },
+    { 0x0f49ULL, 0x5465ULL, 0x92f0ULL, 0xa62aULL },
+    { 0x0785ULL, 0x5452ULL, 0xa1e0ULL, 0x4a2aULL },
+    { 0x0590ULL, 0x6042ULL, 0x09a0ULL, 0x4206ULL },
+    { 0x0d33ULL, 0x7344ULL, 0xccb0ULL, 0x22ceULL },
+    { 0x0f96ULL, 0x6556ULL, 0x69f0ULL, 0x6aa6ULL },
+    { 0x0f76ULL, 0x6774ULL, 0x6ef0ULL, 0x2ee6ULL },
+    { 0x1460ULL, 0x8260ULL, 0x0628ULL, 0x0641ULL },
+    { 0x1c8dULL, 0x9057ULL, 0xb138ULL, 0xea09ULL },
+    { 0x14daULL, 0xa163ULL, 0x5b28ULL, 0xc685ULL },
+    { 0x1c73ULL, 0xb364ULL, 0xce38ULL, 0x26cdULL },
+    { 0x1e94ULL, 0xa456ULL, 0x2978ULL, 0x6a25ULL },
+    { 0x1ebaULL, 0xa747ULL, 0x5d78ULL, 0xe2e5ULL },
+    { 0x16d9ULL, 0xb463ULL, 0x9b68ULL, 0xc62dULL },
+    { 0x1e3dULL, 0xb655ULL, 0xbc78ULL, 0xaa6dULL },
+    { 0x16fbULL, 0xb763ULL, 0xdf68ULL, 0xc6edULL },
+    { 0x1de9ULL, 0xd267ULL, 0x97b8ULL, 0xe64bULL },
+    { 0x1dfeULL, 0xe377ULL, 0x7fb8ULL, 0xeec7ULL },
+    { 0x1f9fULL, 0xf557ULL, 0xf9f8ULL, 0xeaafULL },
+    { 0x288bULL, 0x1907ULL, 0xd114ULL, 0xe098ULL },
+    { 0x20afULL, 0x1b13ULL, 0xf504ULL, 0xc8d8ULL },
+    { 0x220eULL, 0x0d11ULL, 0x7044ULL, 0x88b0ULL },
+    { 0x22a9ULL, 0x1e03ULL, 0x9544ULL, 0xc078ULL },
+    { 0x2a8dULL, 0x1c17ULL, 0xb154ULL, 0xe838ULL },
+    { 0x2aa3ULL, 0x1f06ULL, 0xc554ULL, 0x60f8ULL },
+    { 0x2aefULL, 0x1f37ULL, 0xf754ULL, 0xecf8ULL },
+    { 0x2890ULL, 0x2806ULL, 0x0914ULL, 0x6014ULL },
+    { 0x283bULL, 0x3b05ULL, 0xdc14ULL, 0xa0dcULL },
+    { 0x2a58ULL, 0x2c25ULL, 0x1a54ULL, 0xa434ULL },
+    { 0x2233ULL, 0x3f00ULL, 0xcc44ULL, 0x00fcULL },
+    { 0x21a0ULL, 0x4a02ULL, 0x0584ULL, 0x4052ULL },
+    { 0x2102ULL, 0x4900ULL, 0x4084ULL, 0x0092ULL },
+    { 0x21a5ULL, 0x5a12ULL, 0xa584ULL, 0x485aULL },
+    { 0x21c7ULL, 0x5932ULL, 0xe384ULL, 0x4c9aULL },
+    { 0x2b03ULL, 0x5d04ULL, 0xc0d4ULL, 0x20baULL },
+    { 0x2367ULL, 0x5f30ULL, 0xe6c4ULL, 0x0cfaULL },
+    { 0x2930ULL, 0x6a04ULL, 0x0c94ULL, 0x2056ULL },
+    { 0x29d2ULL, 0x6926ULL, 0x4b94ULL, 0x6496ULL },
+    { 0x2b19ULL, 0x7c05ULL, 0x98d4ULL, 0xa03eULL },
+    { 0x2b9bULL, 0x7d07ULL, 0xd9d4ULL, 0xe0beULL },
+    { 0x2b97ULL, 0x7d16ULL, 0xe9d4ULL, 0x68beULL },
+    { 0x3828ULL, 0x8a05ULL, 0x141cULL, 0xa051ULL },
+    { 0x38a5ULL, 0x9a16ULL, 0xa51cULL, 0x6859ULL },
+    { 0x3a86ULL, 0x8d16ULL, 0x615cULL, 0x68b1ULL },
+    { 0x3201ULL, 0x9c00ULL, 0x804cULL, 0x0039ULL },
+    { 0x389fULL, 0xb917ULL, 0xf91cULL, 0xe89dULL },
+    { 0x32d2ULL, 0xad22ULL, 0x4b4cULL, 0x44b5ULL },
+    { 0x3a99ULL, 0xbc07ULL, 0x995cULL, 0xe03dULL },
+    { 0x3ad5ULL, 0xbc36ULL, 0xab5cULL, 0x6c3dULL },
+    { 0x39e8ULL, 0xca27ULL, 0x179cULL, 0xe453ULL },
+    { 0x3bc1ULL, 0xdc26ULL, 0x83dcULL, 0x643bULL },
+    { 0x3343ULL, 0xdd20ULL, 0xc2ccULL, 0x04bbULL },
+    { 0x3be7ULL, 0xdf36ULL, 0xe7dcULL, 0x6cfbULL },
+    { 0x319aULL, 0xe903ULL, 0x598cULL, 0xc097ULL },
+    { 0x3390ULL, 0xec02ULL, 0x09ccULL, 0x4037ULL },
+    { 0x3b9eULL, 0xed17ULL, 0x79dcULL, 0xe8b7ULL },
+    { 0x24c4ULL, 0x0872ULL, 0x2324ULL, 0x4e10ULL },
+    { 0x2c4aULL, 0x0965ULL, 0x5234ULL, 0xa690ULL },
+    { 0x2cadULL, 0x1a57ULL, 0xb534ULL, 0xea58ULL },
+    { 0x2ccfULL, 0x1977ULL, 0xf334ULL, 0xee98ULL },
+    { 0x2c67ULL, 0x1b74ULL, 0xe634ULL, 0x2ed8ULL },
+    { 0x26eaULL, 0x0f63ULL, 0x5764ULL, 0xc6f0ULL },
+    { 0x2ee5ULL, 0x1e76ULL, 0xa774ULL, 0x6e78ULL },
+    { 0x2c70ULL, 0x2a64ULL, 0x0e34ULL, 0x2654ULL },
+    { 0x2e12ULL, 0x2d44ULL, 0x4874ULL, 0x22b4ULL },
+    { 0x2ed1ULL, 0x3c66ULL, 0x8b74ULL, 0x663cULL },
+    { 0x2e39ULL, 0x3e45ULL, 0x9c74ULL, 0xa27cULL },
+    { 0x2564ULL, 0x4a70ULL, 0x26a4ULL, 0x0e52ULL },
+    { 0x25e7ULL, 0x5b72ULL, 0xe7a4ULL, 0x4edaULL },
+    { 0x2fccULL, 0x4c77ULL, 0x33f4ULL, 0xee32ULL },
+    { 0x2dbcULL, 0x6a57ULL, 0x3db4ULL, 0xea56ULL },
+    { 0x2d71ULL, 0x7a64ULL, 0x8eb4ULL, 0x265eULL },
+    { 0x25d5ULL, 0x7872ULL, 0xaba4ULL, 0x4e1eULL },
+    { 0x259bULL, 0x7943ULL, 0xd9a4ULL, 0xc29eULL },
+    { 0x2710ULL, 0x6c40ULL, 0x08e4ULL, 0x0236ULL },
+    { 0x2f7cULL, 0x6e75ULL, 0x3ef4ULL, 0xae76ULL },
+    { 0x27f2ULL, 0x6f62ULL, 0x4fe4ULL, 0x46f6ULL },
+    { 0x273aULL, 0x6f41ULL, 0x5ce4ULL, 0x82f6ULL },
+    { 0x2fb6ULL, 0x6f56ULL, 0x6df4ULL, 0x6af6ULL },
+    { 0x27d3ULL, 0x7d62ULL, 0xcbe4ULL, 0x46beULL },
+    { 0x2fb3ULL, 0x7f46ULL, 0xcdf4ULL, 0x62feULL },
+    { 0x271fULL, 0x7d51ULL, 0xf8e4ULL, 0x8abeULL },
+    { 0x3c4bULL, 0x9965ULL, 0xd23cULL, 0xa699ULL },
+    { 0x36c0ULL, 0x8c62ULL, 0x036cULL, 0x4631ULL },
+    { 0x36eeULL, 0x8f73ULL, 0x776cULL, 0xcef1ULL },
+    { 0x3ee9ULL, 0x9e67ULL, 0x977cULL, 0xe679ULL },
+    { 0x34b8ULL, 0xaa43ULL, 0x1d2cULL, 0xc255ULL },
+    { 0x3c14ULL, 0xa854ULL, 0x283cULL, 0x2a15ULL },
+    { 0x3c52ULL, 0xa964ULL, 0x4a3cULL, 0x2695ULL },
+    { 0x3472ULL, 0xab60ULL, 0x4e2cULL, 0x06d5ULL },
+    { 0x347eULL, 0xab71ULL, 0x7e2cULL, 0x8ed5ULL },
+    { 0x34bfULL, 0xbb53ULL, 0xfd2cULL, 0xcaddULL },
+    { 0x3e71ULL, 0xbe64ULL, 0x8e7cULL, 0x267dULL },
+    { 0x3e53ULL, 0xbd64ULL, 0xca7cULL, 0x26bdULL },
+    { 0x3d8cULL, 0xc857ULL, 0x31bcULL, 0xea13ULL },
+    { 0x35a2ULL, 0xcb42ULL, 0x45acULL, 0x42d3ULL },
+    { 0x352eULL, 0xcb51ULL, 0x74acULL, 0x8ad3ULL },
+    { 0x352dULL, 0xda51ULL, 0xb4acULL, 0x8a5bULL },
+    { 0x37acULL, 0xce53ULL, 0x35ecULL, 0xca73ULL },
+    { 0x3570ULL, 0xea60ULL, 0x0eacULL, 0x0657ULL },
+    { 0x37faULL, 0xef63ULL, 0x5fecULL, 0xc6f7ULL },
+    { 0x3ff1ULL, 0xfe66ULL, 0x8ffcULL, 0x667fULL },
+    { 0x3fdbULL, 0xfd67ULL, 0xdbfcULL, 0xe6bfULL },
+    { 0x48c4ULL, 0x00b6ULL, 0x2312ULL, 0x6d00ULL },
+    { 0x48e9ULL, 0x12a7ULL, 0x9712ULL, 0xe548ULL },
+    { 0x4ac2ULL, 0x05a6ULL, 0x4352ULL, 0x65a0ULL },
+    { 0x4a41ULL, 0x14a4ULL, 0x8252ULL, 0x2528ULL },
+    { 0x42ebULL, 0x17a3ULL, 0xd742ULL, 0xc5e8ULL },
+    { 0x4813ULL, 0x3184ULL, 0xc812ULL, 0x218cULL },
+    { 0x4ad8ULL, 0x24a7ULL, 0x1b52ULL, 0xe524ULL },
+    { 0x42fdULL, 0x36b3ULL, 0xbf42ULL, 0xcd6cULL },
+    { 0x4a17ULL, 0x3594ULL, 0xe852ULL, 0x29acULL },
+    { 0x4963ULL, 0x53a4ULL, 0xc692ULL, 0x25caULL },
+    { 0x436eULL, 0x47b1ULL, 0x76c2ULL, 0x8de2ULL },
+    { 0x413aULL, 0x6381ULL, 0x5c82ULL, 0x81c6ULL },
+    { 0x49b1ULL, 0x7286ULL, 0x8d92ULL, 0x614eULL },
+    { 0x413dULL, 0x7291ULL, 0xbc82ULL, 0x894eULL },
+    { 0x4b92ULL, 0x6586ULL, 0x49d2ULL, 0x61a6ULL },
+    { 0x4b9bULL, 0x7587ULL, 0xd9d2ULL, 0xe1aeULL },
+    { 0x433fULL, 0x7791ULL, 0xfcc2ULL, 0x89eeULL },
+    { 0x5822ULL, 0x8384ULL, 0x441aULL, 0x21c1ULL },
+    { 0x50aaULL, 0x8383ULL, 0x550aULL, 0xc1c1ULL },
+    { 0x5827ULL, 0x9394ULL, 0xe41aULL, 0x29c9ULL },
+    { 0x52c8ULL, 0x84a3ULL, 0x134aULL, 0xc521ULL },
+    { 0x5284ULL, 0x8492ULL, 0x214aULL, 0x4921ULL },
+    { 0x520aULL, 0x8581ULL, 0x504aULL, 0x81a1ULL },
+    { 0x5a0fULL, 0x9595ULL, 0xf05aULL, 0xa9a9ULL },
+    { 0x5898ULL, 0xa087ULL, 0x191aULL, 0xe105ULL },
+    { 0x585cULL, 0xa0b5ULL, 0x3a1aULL, 0xad05ULL },
+    { 0x50dbULL, 0xb1a3ULL, 0xdb0aULL, 0xc58dULL },
+    { 0x50f7ULL, 0xb3b2ULL, 0xef0aULL, 0x4dcdULL },
+    { 0x5af4ULL, 0xa6b6ULL, 0x2f5aULL, 0x6d65ULL },
+    { 0x51ecULL, 0xc2b3ULL, 0x378aULL, 0xcd43ULL },
+    { 0x5142ULL, 0xc1a0ULL, 0x428aULL, 0x0583ULL },
+    { 0x510dULL, 0xd091ULL, 0xb08aULL, 0x890bULL },
+    { 0x5b03ULL, 0xd584ULL, 0xc0daULL, 0x21abULL },
+    { 0x53ebULL, 0xd7a3ULL, 0xd7caULL, 0xc5ebULL },
+    { 0x5176ULL, 0xe3b0ULL, 0x6e8aULL, 0x0dc7ULL },
+    { 0x5971ULL, 0xf2a4ULL, 0x8e9aULL, 0x254fULL },
+    { 0x5193ULL, 0xf182ULL, 0xc98aULL, 0x418fULL },
+    { 0x53f9ULL, 0xf6a3ULL, 0x9fcaULL, 0xc56fULL },
+    { 0x5bb3ULL, 0xf786ULL, 0xcddaULL, 0x61efULL },
+    { 0x5397ULL, 0xf592ULL, 0xe9caULL, 0x49afULL },
+    { 0x4c4cULL, 0x00f5ULL, 0x3232ULL, 0xaf00ULL },
+    { 0x444bULL, 0x11e1ULL, 0xd222ULL, 0x8788ULL },
+    { 0x4c23ULL, 0x13c4ULL, 0xc432ULL, 0x23c8ULL },
+    { 0x468cULL, 0x04d3ULL, 0x3162ULL, 0xcb20ULL },
+    { 0x4e27ULL, 0x17d4ULL, 0xe472ULL, 0x2be8ULL },
+    { 0x4690ULL, 0x24c2ULL, 0x0962ULL, 0x4324ULL },
+    { 0x4ed4ULL, 0x24f6ULL, 0x2b72ULL, 0x6f24ULL },
+    { 0x45ceULL, 0x41f3ULL, 0x73a2ULL, 0xcf82ULL },
+    { 0x45e5ULL, 0x52f2ULL, 0xa7a2ULL, 0x4f4aULL },
+    { 0x4527ULL, 0x53d0ULL, 0xe4a2ULL, 0x0bcaULL },
+    { 0x4fc1ULL, 0x54e6ULL, 0x83f2ULL, 0x672aULL },
+    { 0x4705ULL, 0x54d0ULL, 0xa0e2ULL, 0x0b2aULL },
+    { 0x4534ULL, 0x62d0ULL, 0x2ca2ULL, 0x0b46ULL },
+    { 0x4572ULL, 0x63e0ULL, 0x4ea2ULL, 0x07c6ULL },
+    { 0x5cc8ULL, 0x80e7ULL, 0x133aULL, 0xe701ULL },
+    { 0x5c0eULL, 0x81d5ULL, 0x703aULL, 0xab81ULL },
+    { 0x54ebULL, 0x93e3ULL, 0xd72aULL, 0xc7c9ULL },
+    { 0x5689ULL, 0x94c3ULL, 0x916aULL, 0xc329ULL },
+    { 0x5643ULL, 0x95e0ULL, 0xc26aULL, 0x07a9ULL },
+    { 0x5ee7ULL, 0x97f6ULL, 0xe77aULL, 0x6fe9ULL },
+    { 0x5c70ULL, 0xa2e4ULL, 0x0e3aULL, 0x2745ULL },
+    { 0x54b2ULL, 0xa3c2ULL, 0x4d2aULL, 0x43c5ULL },
+    { 0x5e79ULL, 0xb6e5ULL, 0x9e7aULL, 0xa76dULL },
+    { 0x56f3ULL, 0xb7e2ULL, 0xcf6aULL, 0x47edULL },
+    { 0x5da3ULL, 0xd3c6ULL, 0xc5baULL, 0x63cbULL },
+    { 0x5df2ULL, 0xe3e6ULL, 0x4fbaULL, 0x67c7ULL },
+    { 0x551dULL, 0xf0d1ULL, 0xb8aaULL, 0x8b0fULL },
+    { 0x5d9dULL, 0xf0d7ULL, 0xb9baULL, 0xeb0fULL },
+    { 0x57fcULL, 0xe6f3ULL, 0x3feaULL, 0xcf67ULL },
+    { 0x57d2ULL, 0xe5e2ULL, 0x4beaULL, 0x47a7ULL },
+    { 0x5f73ULL, 0xf7e4ULL, 0xcefaULL, 0x27efULL },
+    { 0x682dULL, 0x1a95ULL, 0xb416ULL, 0xa958ULL },
+    { 0x68c3ULL, 0x19a6ULL, 0xc316ULL, 0x6598ULL },
+    { 0x6887ULL, 0x1996ULL, 0xe116ULL, 0x6998ULL },
+    { 0x6a4aULL, 0x0da5ULL, 0x5256ULL, 0xa5b0ULL },
+    { 0x6269ULL, 0x1ea1ULL, 0x9646ULL, 0x8578ULL },
+    { 0x60b9ULL, 0x3a83ULL, 0x9d06ULL, 0xc15cULL },
+    { 0x68ffULL, 0x3bb7ULL, 0xff16ULL, 0xeddcULL },
+    { 0x6adcULL, 0x2cb7ULL, 0x3b56ULL, 0xed34ULL },
+    { 0x6adaULL, 0x2da7ULL, 0x5b56ULL, 0xe5b4ULL },
+    { 0x6a3eULL, 0x2f95ULL, 0x7c56ULL, 0xa9f4ULL },
+    { 0x6a51ULL, 0x3ca4ULL, 0x8a56ULL, 0x253cULL },
+    { 0x6a31ULL, 0x3e84ULL, 0x8c56ULL, 0x217cULL },
+    { 0x62d7ULL, 0x3db2ULL, 0xeb46ULL, 0x4dbcULL },
+    { 0x61ccULL, 0x48b3ULL, 0x3386ULL, 0xcd12ULL },
+    { 0x6b82ULL, 0x4d86ULL, 0x41d6ULL, 0x61b2ULL },
+    { 0x6be3ULL, 0x5fa6ULL, 0xc7d6ULL, 0x65faULL },
+    { 0x693aULL, 0x6b85ULL, 0x5c96ULL, 0xa1d6ULL },
+    { 0x619eULL, 0x6993ULL, 0x7986ULL, 0xc996ULL },
+    { 0x6195ULL, 0x7892ULL, 0xa986ULL, 0x491eULL },
+    { 0x6175ULL, 0x7ab0ULL, 0xae86ULL, 0x0d5eULL },
+    { 0x695fULL, 0x79b5ULL, 0xfa96ULL, 0xad9eULL },
+    { 0x6937ULL, 0x7b94ULL, 0xec96ULL, 0x29deULL },
+    { 0x63daULL, 0x6da3ULL, 0x5bc6ULL, 0xc5b6ULL },
+    { 0x7002ULL, 0x8980ULL, 0x400eULL, 0x0191ULL },
+    { 0x7863ULL, 0x9ba4ULL, 0xc61eULL, 0x25d9ULL },
+    { 0x704fULL, 0x99b1ULL, 0xf20eULL, 0x8d99ULL },
+    { 0x72caULL, 0x8da3ULL, 0x534eULL, 0xc5b1ULL },
+    { 0x7aadULL, 0x9e97ULL, 0xb55eULL, 0xe979ULL },
+    { 0x707bULL, 0xbba1ULL, 0xde0eULL, 0x85ddULL },
+    { 0x7a14ULL, 0xac94ULL, 0x285eULL, 0x2935ULL },
+    { 0x7af9ULL, 0xbea7ULL, 0x9f5eULL, 0xe57dULL },
+    { 0x7ad3ULL, 0xbda6ULL, 0xcb5eULL, 0x65bdULL },
+    { 0x7abbULL, 0xbf87ULL, 0xdd5eULL, 0xe1fdULL },
+    { 0x79e2ULL, 0xcba6ULL, 0x479eULL, 0x65d3ULL },
+    { 0x7129ULL, 0xda81ULL, 0x948eULL, 0x815bULL },
+    { 0x7b67ULL, 0xdfb4ULL, 0xe6deULL, 0x2dfbULL },
+    { 0x71d0ULL, 0xe8a2ULL, 0x0b8eULL, 0x4517ULL },
+    { 0x7939ULL, 0xfa85ULL, 0x9c9eULL, 0xa15fULL },
+    { 0x7330ULL, 0xee80ULL, 0x0cceULL, 0x0177ULL },
+    { 0x73b9ULL, 0xfe83ULL, 0x9dceULL, 0xc17fULL },
+    { 0x7353ULL, 0xfda0ULL, 0xcaceULL, 0x05bfULL },
+    { 0x73ffULL, 0xffb3ULL, 0xffceULL, 0xcdffULL },
+    { 0x6c88ULL, 0x08c7ULL, 0x1136ULL, 0xe310ULL },
+    { 0x6409ULL, 0x18c1ULL, 0x9026ULL, 0x8318ULL },
+    { 0x6c43ULL, 0x19e4ULL, 0xc236ULL, 0x2798ULL },
+    { 0x6606ULL, 0x0dd0ULL, 0x6066ULL, 0x0bb0ULL },
+    { 0x6683ULL, 0x1dc2ULL, 0xc166ULL, 0x43b8ULL },
+    { 0x64b0ULL, 0x2ac2ULL, 0x0d26ULL, 0x4354ULL },
+    { 0x64daULL, 0x29e3ULL, 0x5b26ULL, 0xc794ULL },
+    { 0x6e9fULL, 0x3dd7ULL, 0xf976ULL, 0xebbcULL },
+    { 0x67c8ULL, 0x4ce3ULL, 0x13e6ULL, 0xc732ULL },
+    { 0x6feeULL, 0x4ff7ULL, 0x77f6ULL, 0xeff2ULL },
+    { 0x6d3bULL, 0x7bc5ULL, 0xdcb6ULL, 0xa3deULL },
+    { 0x6fd2ULL, 0x6de6ULL, 0x4bf6ULL, 0x67b6ULL },
+    { 0x7480ULL, 0x88c2ULL, 0x012eULL, 0x4311ULL },
+    { 0x7cabULL, 0x9bc7ULL, 0xd53eULL, 0xe3d9ULL },
+    { 0x7e68ULL, 0x8ee5ULL, 0x167eULL, 0xa771ULL },
+    { 0x7e02ULL, 0x8dc4ULL, 0x407eULL, 0x23b1ULL },
+    { 0x7c9cULL, 0xa8d7ULL, 0x393eULL, 0xeb15ULL },
+    { 0x7436ULL, 0xabd0ULL, 0x6c2eULL, 0x0bd5ULL },
+    { 0x7c11ULL, 0xb8c4ULL, 0x883eULL, 0x231dULL },
+    { 0x7edeULL, 0xadf7ULL, 0x7b7eULL, 0xefb5ULL },
+    { 0x7eb6ULL, 0xafd6ULL, 0x6d7eULL, 0x6bf5ULL },
+    { 0x76dbULL, 0xbde3ULL, 0xdb6eULL, 0xc7bdULL },
+    { 0x7dc4ULL, 0xc8f6ULL, 0x23beULL, 0x6f13ULL },
+    { 0x7d8aULL, 0xc9c7ULL, 0x51beULL, 0xe393ULL },
+    { 0x756dULL, 0xdaf1ULL, 0xb6aeULL, 0x8f5bULL },
+    { 0x7788ULL, 0xccc3ULL, 0x11eeULL, 0xc333ULL },
+    { 0x7720ULL, 0xcec0ULL, 0x04eeULL, 0x0373ULL },
+    { 0x7741ULL, 0xdce0ULL, 0x82eeULL, 0x073bULL },
+    { 0x7538ULL, 0xeac1ULL, 0x1caeULL, 0x8357ULL },
+    { 0x75beULL, 0xebd3ULL, 0x7daeULL, 0xcbd7ULL },
+    { 0x7d9bULL, 0xf9c7ULL, 0xd9beULL, 0xe39fULL },
+    { 0x7757ULL, 0xfdf0ULL, 0xeaeeULL, 0x0fbfULL },
+    { 0x8828ULL, 0x020dULL, 0x1411ULL, 0xb040ULL },
+    { 0x80acULL, 0x021bULL, 0x3501ULL, 0xd840ULL },
+    { 0x880dULL, 0x101dULL, 0xb011ULL, 0xb808ULL },
+    { 0x8867ULL, 0x133cULL, 0xe611ULL, 0x3cc8ULL },
+    { 0x824eULL, 0x0539ULL, 0x7241ULL, 0x9ca0ULL },
+    { 0x8aa1ULL, 0x160eULL, 0x8551ULL, 0x7068ULL },
+    { 0x822bULL, 0x1709ULL, 0xd441ULL, 0x90e8ULL },
+    { 0x8018ULL, 0x2009ULL, 0x1801ULL, 0x9004ULL },
+    { 0x88f9ULL, 0x322fULL, 0x9f11ULL, 0xf44cULL },
+    { 0x809dULL, 0x301bULL, 0xb901ULL, 0xd80cULL },
+    { 0x8a9cULL, 0x241fULL, 0x3951ULL, 0xf824ULL },
+    { 0x8231ULL, 0x3608ULL, 0x8c41ULL, 0x106cULL },
+    { 0x8a75ULL, 0x363cULL, 0xae51ULL, 0x3c6cULL },
+    { 0x8297ULL, 0x351aULL, 0xe941ULL, 0x58acULL },
+    { 0x8109ULL, 0x5009ULL, 0x9081ULL, 0x900aULL },
+    { 0x81ebULL, 0x532bULL, 0xd781ULL, 0xd4caULL },
+    { 0x8107ULL, 0x5118ULL, 0xe081ULL, 0x188aULL },
+    { 0x8b28ULL, 0x460dULL, 0x14d1ULL, 0xb062ULL },
+    { 0x8bacULL, 0x461fULL, 0x35d1ULL, 0xf862ULL },
+    { 0x832eULL, 0x4719ULL, 0x74c1ULL, 0x98e2ULL },
+    { 0x83e5ULL, 0x563aULL, 0xa7c1ULL, 0x5c6aULL },
+    { 0x8150ULL, 0x6028ULL, 0x0a81ULL, 0x1406ULL },
+    { 0x8932ULL, 0x630cULL, 0x4c91ULL, 0x30c6ULL },
+    { 0x8b7aULL, 0x672dULL, 0x5ed1ULL, 0xb4e6ULL },
+    { 0x8b96ULL, 0x651eULL, 0x69d1ULL, 0x78a6ULL },
+    { 0x837dULL, 0x7639ULL, 0xbec1ULL, 0x9c6eULL },
+    { 0x9087ULL, 0x911aULL, 0xe109ULL, 0x5889ULL },
+    { 0x9afcULL, 0xa63fULL, 0x3f59ULL, 0xfc65ULL },
+    { 0x92f5ULL, 0xb63aULL, 0xaf49ULL, 0x5c6dULL },
+    { 0x91aaULL, 0xc30bULL, 0x5589ULL, 0xd0c3ULL },
+    { 0x9341ULL, 0xd428ULL, 0x82c9ULL, 0x142bULL },
+    { 0x9325ULL, 0xd618ULL, 0xa4c9ULL, 0x186bULL },
+    { 0x9bebULL, 0xd72fULL, 0xd7d9ULL, 0xf4ebULL },
+    { 0x9934ULL, 0xe21cULL, 0x2c99ULL, 0x3847ULL },
+    { 0x91f7ULL, 0xf33aULL, 0xef89ULL, 0x5ccfULL },
+    { 0x9bdaULL, 0xe52fULL, 0x5bd9ULL, 0xf4a7ULL },
+    { 0x9356ULL, 0xe538ULL, 0x6ac9ULL, 0x1ca7ULL },
+    { 0x8442ULL, 0x0168ULL, 0x4221ULL, 0x1680ULL },
+    { 0x8c81ULL, 0x104eULL, 0x8131ULL, 0x7208ULL },
+    { 0x8c4fULL, 0x117dULL, 0xf231ULL, 0xbe88ULL },
+    { 0x8648ULL, 0x0469ULL, 0x1261ULL, 0x9620ULL },
+    { 0x86a6ULL, 0x075aULL, 0x6561ULL, 0x5ae0ULL },
+    { 0x8e03ULL, 0x154cULL, 0xc071ULL, 0x32a8ULL },
+    { 0x86e3ULL, 0x176aULL, 0xc761ULL, 0x56e8ULL },
+    { 0x866fULL, 0x1779ULL, 0xf661ULL, 0x9ee8ULL },
+    { 0x8eafULL, 0x175fULL, 0xf571ULL, 0xfae8ULL },
+    { 0x845eULL, 0x2179ULL, 0x7a21ULL, 0x9e84ULL },
+    { 0x8477ULL, 0x3378ULL, 0xee21ULL, 0x1eccULL },
+    { 0x86faULL, 0x276bULL, 0x5f61ULL, 0xd6e4ULL },
+    { 0x8e1eULL, 0x255dULL, 0x7871ULL, 0xbaa4ULL },
+    { 0x8e37ULL, 0x375cULL, 0xec71ULL, 0x3aecULL },
+    { 0x870aULL, 0x4549ULL, 0x50e1ULL, 0x92a2ULL },
+    { 0x8f8aULL, 0x454fULL, 0x51f1ULL, 0xf2a2ULL },
+    { 0x8f26ULL, 0x475cULL, 0x64f1ULL, 0x3ae2ULL },
+    { 0x8721ULL, 0x5648ULL, 0x84e1ULL, 0x126aULL },
+    { 0x870dULL, 0x5459ULL, 0xb0e1ULL, 0x9a2aULL },
+    { 0x8572ULL, 0x6368ULL, 0x4ea1ULL, 0x16c6ULL },
+    { 0x873eULL, 0x6759ULL, 0x7ce1ULL, 0x9ae6ULL },
+    { 0x9c43ULL, 0x916cULL, 0xc239ULL, 0x3689ULL },
+    { 0x9e61ULL, 0x966cULL, 0x8679ULL, 0x3669ULL },
+    { 0x9458ULL, 0xa069ULL, 0x1a29ULL, 0x9605ULL },
+    { 0x94f8ULL, 0xa26bULL, 0x1f29ULL, 0xd645ULL },
+    { 0x9c32ULL, 0xa34cULL, 0x4c39ULL, 0x32c5ULL },
+    { 0x9476ULL, 0xa378ULL, 0x6e29ULL, 0x1ec5ULL },
+    { 0x94b1ULL, 0xb24aULL, 0x8d29ULL, 0x524dULL },
+    { 0x94ddULL, 0xb07bULL, 0xbb29ULL, 0xde0dULL },
+    { 0x949bULL, 0xb14bULL, 0xd929ULL, 0xd28dULL },
+    { 0x9cdbULL, 0xb16fULL, 0xdb39ULL, 0xf68dULL },
+    { 0x9e9cULL, 0xa45fULL, 0x3979ULL, 0xfa25ULL },
+    { 0x9ed2ULL, 0xa56eULL, 0x4b79ULL, 0x76a5ULL },
+    { 0x9619ULL, 0xb449ULL, 0x9869ULL, 0x922dULL },
+    { 0x9eb1ULL, 0xb64eULL, 0x8d79ULL, 0x726dULL },
+    { 0x9569ULL, 0xd269ULL, 0x96a9ULL, 0x964bULL },
+    { 0x9f6dULL, 0xd67dULL, 0xb6f9ULL, 0xbe6bULL },
+    { 0x972bULL, 0xd749ULL, 0xd4e9ULL, 0x92ebULL },
+    { 0x95b6ULL, 0xe35aULL, 0x6da9ULL, 0x5ac7ULL },
+    { 0x95b9ULL, 0xf24bULL, 0x9da9ULL, 0xd24fULL },
+    { 0x9d3dULL, 0xf25dULL, 0xbcb9ULL, 0xba4fULL },
+    { 0x9d57ULL, 0xf17cULL, 0xeab9ULL, 0x3e8fULL },
+    { 0xa8ecULL, 0x0a3fULL, 0x3715ULL, 0xfc50ULL },
+    { 0xa825ULL, 0x1a1cULL, 0xa415ULL, 0x3858ULL },
+    { 0xa2acULL, 0x0e1bULL, 0x3545ULL, 0xd870ULL },
+    { 0xa202ULL, 0x0d08ULL, 0x4045ULL, 0x10b0ULL },
+    { 0xaa66ULL, 0x0f3cULL, 0x6655ULL, 0x3cf0ULL },
+    { 0xaa8fULL, 0x1d1fULL, 0xf155ULL, 0xf8b8ULL },
+    { 0xaae7ULL, 0x1f3eULL, 0xe755ULL, 0x7cf8ULL },
+    { 0xa830ULL, 0x2a0cULL, 0x0c15ULL, 0x3054ULL },
+    { 0xa87aULL, 0x2b2dULL, 0x5e15ULL, 0xb4d4ULL },
+    { 0xa8f6ULL, 0x2b3eULL, 0x6f15ULL, 0x7cd4ULL },
+    { 0xa893ULL, 0x390eULL, 0xc915ULL, 0x709cULL },
+    { 0xa214ULL, 0x2c18ULL, 0x2845ULL, 0x1834ULL },
+    { 0xaa34ULL, 0x2e1cULL, 0x2c55ULL, 0x3874ULL },
+    { 0xa272ULL, 0x2f28ULL, 0x4e45ULL, 0x14f4ULL },
+    { 0xaaf2ULL, 0x2f2eULL, 0x4f55ULL, 0x74f4ULL },
+    { 0xa2f1ULL, 0x3e2aULL, 0x8f45ULL, 0x547cULL },
+    { 0xa140ULL, 0x4828ULL, 0x0285ULL, 0x1412ULL },
+    { 0xa90aULL, 0x490dULL, 0x5095ULL, 0xb092ULL },
+    { 0xa126ULL, 0x4b18ULL, 0x6485ULL, 0x18d2ULL },
+    { 0xa9c5ULL, 0x583eULL, 0xa395ULL, 0x7c1aULL },
+    { 0xa9cfULL, 0x593fULL, 0xf395ULL, 0xfc9aULL },
+    { 0xa134ULL, 0x6a18ULL, 0x2c85ULL, 0x1856ULL },
+    { 0xa912ULL, 0x690cULL, 0x4895ULL, 0x3096ULL },
+    { 0xa1faULL, 0x6b2bULL, 0x5f85ULL, 0xd4d6ULL },
+    { 0xab98ULL, 0x6c0fULL, 0x19d5ULL, 0xf036ULL },
+    { 0xa3f7ULL, 0x7f3aULL, 0xefc5ULL, 0x5cfeULL },
+    { 0xb006ULL, 0x8918ULL, 0x600dULL, 0x1891ULL },
+    { 0xb045ULL, 0x9838ULL, 0xa20dULL, 0x1c19ULL },
+    { 0xb88dULL, 0x981fULL, 0xb11dULL, 0xf819ULL },
+    { 0xb284ULL, 0x8c1aULL, 0x214dULL, 0x5831ULL },
+    { 0xb8f0ULL, 0xaa2eULL, 0x0f1dULL, 0x7455ULL },
+    { 0xb855ULL, 0xb83cULL, 0xaa1dULL, 0x3c1dULL },
+    { 0xb276ULL, 0xaf38ULL, 0x6e4dULL, 0x1cf5ULL },
+    { 0xba91ULL, 0xbc0eULL, 0x895dULL, 0x703dULL },
+    { 0xb271ULL, 0xbe28ULL, 0x8e4dULL, 0x147dULL },
+    { 0xb9c0ULL, 0xc82eULL, 0x039dULL, 0x7413ULL },
+    { 0xb942ULL, 0xc92cULL, 0x429dULL, 0x3493ULL },
+    { 0xb92aULL, 0xcb0dULL, 0x549dULL, 0xb0d3ULL },
+    { 0xb38cULL, 0xcc1bULL, 0x31cdULL, 0xd833ULL },
+    { 0xb3caULL, 0xcd2bULL, 0x53cdULL, 0xd4b3ULL },
+    { 0xbb66ULL, 0xcf3cULL, 0x66ddULL, 0x3cf3ULL },
+    { 0xb30fULL, 0xdd19ULL, 0xf0cdULL, 0x98bbULL },
+    { 0xb1daULL, 0xe92bULL, 0x5b8dULL, 0xd497ULL },
+    { 0xbb14ULL, 0xec1cULL, 0x28ddULL, 0x3837ULL },
+    { 0xbbf6ULL, 0xef3eULL, 0x6fddULL, 0x7cf7ULL },
+    { 0xb313ULL, 0xfd08ULL, 0xc8cdULL, 0x10bfULL },
+    { 0xa468ULL, 0x0a69ULL, 0x1625ULL, 0x9650ULL },
+    { 0xac2cULL, 0x0a5dULL, 0x3435ULL, 0xba50ULL },
+    { 0xaca1ULL, 0x1a4eULL, 0x8535ULL, 0x7258ULL },
+    { 0xacebULL, 0x1b6fULL, 0xd735ULL, 0xf6d8ULL },
+    { 0xacc7ULL, 0x197eULL, 0xe335ULL, 0x7e98ULL },
+    { 0xa467ULL, 0x1b78ULL, 0xe625ULL, 0x1ed8ULL },
+    { 0xa6c0ULL, 0x0c6aULL, 0x0365ULL, 0x5630ULL },
+    { 0xaee0ULL, 0x0e6eULL, 0x0775ULL, 0x7670ULL },
+    { 0xa623ULL, 0x1f48ULL, 0xc465ULL, 0x12f8ULL },
+    { 0xade8ULL, 0x4a6fULL, 0x17b5ULL, 0xf652ULL },
+    { 0xa5ccULL, 0x487bULL, 0x33a5ULL, 0xde12ULL },
+    { 0xa7ecULL, 0x4e7bULL, 0x37e5ULL, 0xde72ULL },
+    { 0xad7cULL, 0x6a7dULL, 0x3eb5ULL, 0xbe56ULL },
+    { 0xa51aULL, 0x6949ULL, 0x58a5ULL, 0x9296ULL },
+    { 0xa591ULL, 0x784aULL, 0x89a5ULL, 0x521eULL },
+    { 0xad19ULL, 0x784dULL, 0x98b5ULL, 0xb21eULL },
+    { 0xa597ULL, 0x795aULL, 0xe9a5ULL, 0x5a9eULL },
+    { 0xb46dULL, 0x9a79ULL, 0xb62dULL, 0x9e59ULL },
+    { 0xbecbULL, 0x9d6fULL, 0xd37dULL, 0xf6b9ULL },
+    { 0xbc3aULL, 0xab4dULL, 0x5c3dULL, 0xb2d5ULL },
+    { 0xbcf5ULL, 0xba7eULL, 0xaf3dULL, 0x7e5dULL },
+    { 0xbebdULL, 0xbe5fULL, 0xbd7dULL, 0xfa7dULL },
+    { 0xbef3ULL, 0xbf6eULL, 0xcf7dULL, 0x76fdULL },
+    { 0xb525ULL, 0xda58ULL, 0xa4adULL, 0x1a5bULL },
+    { 0xb58fULL, 0xd95bULL, 0xf1adULL, 0xda9bULL },
+    { 0xb768ULL, 0xce69ULL, 0x16edULL, 0x9673ULL },
+    { 0xbfe4ULL, 0xce7eULL, 0x27fdULL, 0x7e73ULL },
+    { 0xbdfeULL, 0xeb7fULL, 0x7fbdULL, 0xfed7ULL },
+    { 0xbd9dULL, 0xf85fULL, 0xb9bdULL, 0xfa1fULL },
+    { 0xb5f5ULL, 0xfa7aULL, 0xafadULL, 0x5e5fULL },
+    { 0xb5f3ULL, 0xfb6aULL, 0xcfadULL, 0x56dfULL },
+    { 0xbfb0ULL, 0xee4eULL, 0x0dfdULL, 0x7277ULL },
+    { 0xb75aULL, 0xed69ULL, 0x5aedULL, 0x96b7ULL },
+    { 0xbf3eULL, 0xef5dULL, 0x7cfdULL, 0xbaf7ULL },
+    { 0xb739ULL, 0xfe49ULL, 0x9cedULL, 0x927fULL },
+    { 0xbfd5ULL, 0xfc7eULL, 0xabfdULL, 0x7e3fULL },
+    { 0xb71dULL, 0xfc59ULL, 0xb8edULL, 0x9a3fULL },
+    { 0xbf35ULL, 0xfe5cULL, 0xacfdULL, 0x3a7fULL },
+    { 0xb77fULL, 0xff79ULL, 0xfeedULL, 0x9effULL },
+    { 0xc801ULL, 0x108cULL, 0x8013ULL, 0x3108ULL },
+    { 0xc0a5ULL, 0x129aULL, 0xa503ULL, 0x5948ULL },
+    { 0xc282ULL, 0x058aULL, 0x4143ULL, 0x51a0ULL },
+    { 0xc8bdULL, 0x329fULL, 0xbd13ULL, 0xf94cULL },
+    { 0xc2fcULL, 0x26bbULL, 0x3f43ULL, 0xdd64ULL },
+    { 0xca91ULL, 0x348eULL, 0x8953ULL, 0x712cULL },
+    { 0xc25bULL, 0x35a9ULL, 0xda43ULL, 0x95acULL },
+    { 0xc944ULL, 0x40bcULL, 0x2293ULL, 0x3d02ULL },
+    { 0xc12aULL, 0x4389ULL, 0x5483ULL, 0x91c2ULL },
+    { 0xc3c0ULL, 0x44aaULL, 0x03c3ULL, 0x5522ULL },
+    { 0xc97aULL, 0x63adULL, 0x5e93ULL, 0xb5c6ULL },
+    { 0xc1b9ULL, 0x728bULL, 0x9d83ULL, 0xd14eULL },
+    { 0xc975ULL, 0x72bcULL, 0xae93ULL, 0x3d4eULL },
+    { 0xc1f7ULL, 0x73baULL, 0xef83ULL, 0x5dceULL },
+    { 0xcbb1ULL, 0x768eULL, 0x8dd3ULL, 0x716eULL },
+    { 0xd06cULL, 0x82b9ULL, 0x360bULL, 0x9d41ULL },
+    { 0xd887ULL, 0x919eULL, 0xe11bULL, 0x7989ULL },
+    { 0xd0afULL, 0x939bULL, 0xf50bULL, 0xd9c9ULL },
+    { 0xdac4ULL, 0x84beULL, 0x235bULL, 0x7d21ULL },
+    { 0xd20cULL, 0x8499ULL, 0x304bULL, 0x9921ULL },
+    { 0xda09ULL, 0x948dULL, 0x905bULL, 0xb129ULL },
+    { 0xd030ULL, 0xa288ULL, 0x0c0bULL, 0x1145ULL },
+    { 0xd894ULL, 0xa09eULL, 0x291bULL, 0x7905ULL },
+    { 0xd03aULL, 0xa389ULL, 0x5c0bULL, 0x91c5ULL },
+    { 0xd0b6ULL, 0xa39aULL, 0x6d0bULL, 0x59c5ULL },
+    { 0xd075ULL, 0xb2b8ULL, 0xae0bULL, 0x1d4dULL },
+    { 0xd276ULL, 0xa7b8ULL, 0x6e4bULL, 0x1de5ULL },
+    { 0xda5dULL, 0xb4bdULL, 0xba5bULL, 0xbd2dULL },
+    { 0xda35ULL, 0xb69cULL, 0xac5bULL, 0x396dULL },
+    { 0xd217ULL, 0xb598ULL, 0xe84bULL, 0x19adULL },
+    { 0xd902ULL, 0xc18cULL, 0x409bULL, 0x3183ULL },
+    { 0xd3e8ULL, 0xc6abULL, 0x17cbULL, 0xd563ULL },
+    { 0xd3e5ULL, 0xd6baULL, 0xa7cbULL, 0x5d6bULL },
+    { 0xd19aULL, 0xe18bULL, 0x598bULL, 0xd187ULL },
+    { 0xd1f6ULL, 0xe3baULL, 0x6f8bULL, 0x5dc7ULL },
+    { 0xd151ULL, 0xf0a8ULL, 0x8a8bULL, 0x150fULL },
+    { 0xdb14ULL, 0xe49cULL, 0x28dbULL, 0x3927ULL },
+    { 0xd33eULL, 0xe799ULL, 0x7ccbULL, 0x99e7ULL },
+    { 0xd3d3ULL, 0xf5aaULL, 0xcbcbULL, 0x55afULL },
+    { 0xc460ULL, 0x02e8ULL, 0x0623ULL, 0x1740ULL },
+    { 0xcca7ULL, 0x13deULL, 0xe533ULL, 0x7bc8ULL },
+    { 0xc642ULL, 0x05e8ULL, 0x4263ULL, 0x17a0ULL },
+    { 0xc647ULL, 0x15f8ULL, 0xe263ULL, 0x1fa8ULL },
+    { 0xcee7ULL, 0x17feULL, 0xe773ULL, 0x7fe8ULL },
+    { 0xc45cULL, 0x20f9ULL, 0x3a23ULL, 0x9f04ULL },
+    { 0xcc1dULL, 0x30ddULL, 0xb833ULL, 0xbb0cULL },
+    { 0xcc35ULL, 0x32dcULL, 0xac33ULL, 0x3b4cULL },
+    { 0xc6bcULL, 0x26dbULL, 0x3d63ULL, 0xdb64ULL },
+    { 0xcda8ULL, 0x42cfULL, 0x15b3ULL, 0xf342ULL },
+    { 0xc50cULL, 0x40d9ULL, 0x30a3ULL, 0x9b02ULL },
+    { 0xc5e4ULL, 0x42faULL, 0x27a3ULL, 0x5f42ULL },
+    { 0xc5c2ULL, 0x41eaULL, 0x43a3ULL, 0x5782ULL },
+    { 0xcd2dULL, 0x52ddULL, 0xb4b3ULL, 0xbb4aULL },
+    { 0xcd59ULL, 0x70edULL, 0x9ab3ULL, 0xb70eULL },
+    { 0xcd95ULL, 0x70deULL, 0xa9b3ULL, 0x7b0eULL },
+    { 0xc593ULL, 0x71caULL, 0xc9a3ULL, 0x538eULL },
+    { 0xc75fULL, 0x75f9ULL, 0xfae3ULL, 0x9faeULL },
+    { 0xd4c5ULL, 0x90faULL, 0xa32bULL, 0x5f09ULL },
+    { 0xde88ULL, 0x84cfULL, 0x117bULL, 0xf321ULL },
+    { 0xd624ULL, 0x86d8ULL, 0x246bULL, 0x1b61ULL },
+    { 0xdeecULL, 0x86ffULL, 0x377bULL, 0xff61ULL },
+    { 0xd6e2ULL, 0x87eaULL, 0x476bULL, 0x57e1ULL },
+    { 0xdec6ULL, 0x85feULL, 0x637bULL, 0x7fa1ULL },
+    { 0xde23ULL, 0x97ccULL, 0xc47bULL, 0x33e9ULL },
+    { 0xdcdcULL, 0xa0ffULL, 0x3b3bULL, 0xff05ULL },
+    { 0xdc1aULL, 0xa1cdULL, 0x583bULL, 0xb385ULL },
+    { 0xd411ULL, 0xb0c8ULL, 0x882bULL, 0x130dULL },
+    { 0xde54ULL, 0xa4fcULL, 0x2a7bULL, 0x3f25ULL },
+    { 0xd694ULL, 0xa4daULL, 0x296bULL, 0x5b25ULL },
+    { 0xde9dULL, 0xb4dfULL, 0xb97bULL, 0xfb2dULL },
+    { 0xdd81ULL, 0xd0ceULL, 0x81bbULL, 0x730bULL },
+    { 0xd5a5ULL, 0xd2daULL, 0xa5abULL, 0x5b4bULL },
+    { 0xd7acULL, 0xc6dbULL, 0x35ebULL, 0xdb63ULL },
+    { 0xd766ULL, 0xc7f8ULL, 0x66ebULL, 0x1fe3ULL },
+    { 0xdfa9ULL, 0xd6cfULL, 0x95fbULL, 0xf36bULL },
+    { 0xd5dcULL, 0xe0fbULL, 0x3babULL, 0xdf07ULL },
+    { 0xdd1fULL, 0xf1ddULL, 0xf8bbULL, 0xbb8fULL },
+    { 0xdff0ULL, 0xe6eeULL, 0x0ffbULL, 0x7767ULL },
+    { 0xe248ULL, 0x0ca9ULL, 0x1247ULL, 0x9530ULL },
+    { 0xe2e8ULL, 0x0eabULL, 0x1747ULL, 0xd570ULL },
+    { 0xe207ULL, 0x1d98ULL, 0xe047ULL, 0x19b8ULL },
+    { 0xe05dULL, 0x38b9ULL, 0xba07ULL, 0x9d1cULL },
+    { 0xeaf5ULL, 0x3ebeULL, 0xaf57ULL, 0x7d7cULL },
+    { 0xeb26ULL, 0x4f9cULL, 0x64d7ULL, 0x39f2ULL },
+    { 0xebedULL, 0x5ebfULL, 0xb7d7ULL, 0xfd7aULL },
+    { 0xe152ULL, 0x69a8ULL, 0x4a87ULL, 0x1596ULL },
+    { 0xe17eULL, 0x6bb9ULL, 0x7e87ULL, 0x9dd6ULL },
+    { 0xe9dbULL, 0x79afULL, 0xdb97ULL, 0xf59eULL },
+    { 0xf806ULL, 0x899cULL, 0x601fULL, 0x3991ULL },
+    { 0xf0eeULL, 0x8bbbULL, 0x770fULL, 0xddd1ULL },
+    { 0xf8a1ULL, 0x9a8eULL, 0x851fULL, 0x7159ULL },
+    { 0xfa00ULL, 0x8c8cULL, 0x005fULL, 0x3131ULL },
+    { 0xfac2ULL, 0x8daeULL, 0x435fULL, 0x75b1ULL },
+    { 0xf09bULL, 0xb98bULL, 0xd90fULL, 0xd19dULL },
+    { 0xfaf4ULL, 0xaebeULL, 0x2f5fULL, 0x7d75ULL },
+    { 0xfa3cULL, 0xae9dULL, 0x3c5fULL, 0xb975ULL },
+    { 0xf2fcULL, 0xaebbULL, 0x3f4fULL, 0xdd75ULL },
+    { 0xf2bdULL, 0xbe9bULL, 0xbd4fULL, 0xd97dULL },
+    { 0xf293ULL, 0xbd8aULL, 0xc94fULL, 0x51bdULL },
+    { 0xf160ULL, 0xcaa8ULL, 0x068fULL, 0x1553ULL },
+    { 0xf9ecULL, 0xcabfULL, 0x379fULL, 0xfd53ULL },
+    { 0xf146ULL, 0xc9b8ULL, 0x628fULL, 0x1d93ULL },
+    { 0xf9e1ULL, 0xdaaeULL, 0x879fULL, 0x755bULL },
+    { 0xf348ULL, 0xcca9ULL, 0x12cfULL, 0x9533ULL },
+    { 0xf3aeULL, 0xcf9bULL, 0x75cfULL, 0xd9f3ULL },
+    { 0xf3c1ULL, 0xdcaaULL, 0x83cfULL, 0x553bULL },
+    { 0xf38bULL, 0xdd8bULL, 0xd1cfULL, 0xd1bbULL },
+    { 0xf3a7ULL, 0xdf9aULL, 0xe5cfULL, 0x59fbULL },
+    { 0xf173ULL, 0xfba8ULL, 0xce8fULL, 0x15dfULL },
+    { 0xf197ULL, 0xf99aULL, 0xe98fULL, 0x599fULL },
+    { 0xf3f4ULL, 0xeebaULL, 0x2fcfULL, 0x5d77ULL },
+    { 0xfb32ULL, 0xef8cULL, 0x4cdfULL, 0x31f7ULL },
+    { 0xe407ULL, 0x19d8ULL, 0xe027ULL, 0x1b98ULL },
+    { 0xe64dULL, 0x1cf9ULL, 0xb267ULL, 0x9f38ULL },
+    { 0xec55ULL, 0x38fcULL, 0xaa37ULL, 0x3f1cULL },
+    { 0xedc0ULL, 0x48eeULL, 0x03b7ULL, 0x7712ULL },
+    { 0xed85ULL, 0x58deULL, 0xa1b7ULL, 0x7b1aULL },
+    { 0xefa2ULL, 0x4fceULL, 0x45f7ULL, 0x73f2ULL },
+    { 0xe74eULL, 0x4df9ULL, 0x72e7ULL, 0x9fb2ULL },
+    { 0xe5d5ULL, 0x78faULL, 0xaba7ULL, 0x5f1eULL },
+    { 0xef50ULL, 0x6cecULL, 0x0af7ULL, 0x3736ULL },
+    { 0xf422ULL, 0x8bc8ULL, 0x442fULL, 0x13d1ULL },
+    { 0xf489ULL, 0x98cbULL, 0x912fULL, 0xd319ULL },
+    { 0xf429ULL, 0x9ac9ULL, 0x942fULL, 0x9359ULL },
+    { 0xf66aULL, 0x8fe9ULL, 0x566fULL, 0x97f1ULL },
+    { 0xfe0bULL, 0x9dcdULL, 0xd07fULL, 0xb3b9ULL },
+    { 0xfe6fULL, 0x9ffdULL, 0xf67fULL, 0xbff9ULL },
+    { 0xf495ULL, 0xb8daULL, 0xa92fULL, 0x5b1dULL },
+    { 0xf435ULL, 0xbad8ULL, 0xac2fULL, 0x1b5dULL },
+    { 0xf41fULL, 0xb9d9ULL, 0xf82fULL, 0x9b9dULL },
+    { 0xf6b0ULL, 0xaecaULL, 0x0d6fULL, 0x5375ULL },
+    { 0xf5e8ULL, 0xcaebULL, 0x17afULL, 0xd753ULL },
+    { 0xf5c5ULL, 0xd8faULL, 0xa3afULL, 0x5f1bULL },
+    { 0xfd23ULL, 0xdbccULL, 0xc4bfULL, 0x33dbULL },
+    { 0xffc0ULL, 0xcceeULL, 0x03ffULL, 0x7733ULL },
+    { 0xf7ccULL, 0xccfbULL, 0x33efULL, 0xdf33ULL },
+    { 0xf7e9ULL, 0xdeebULL, 0x97efULL, 0xd77bULL },
+    { 0xf5bcULL, 0xeadbULL, 0x3dafULL, 0xdb57ULL },
+    { 0xfdf6ULL, 0xebfeULL, 0x6fbfULL, 0x7fd7ULL },
+    { 0xf5d9ULL, 0xf8ebULL, 0x9bafULL, 0xd71fULL },
+    { 0xfd97ULL, 0xf9deULL, 0xe9bfULL, 0x7b9fULL },
+    { 0xfd3fULL, 0xfbddULL, 0xfcbfULL, 0xbbdfULL },
+    { 0xff9cULL, 0xecdfULL, 0x39ffULL, 0xfb37ULL },
+    { 0xff5aULL, 0xededULL, 0x5affULL, 0xb7b7ULL },
+    { 0xf7feULL, 0xeffbULL, 0x7fefULL, 0xdff7ULL },
+    { 0xff11ULL, 0xfcccULL, 0x88ffULL, 0x333fULL },
+    { 0xf7bfULL, 0xffdbULL, 0xfdefULL, 0xdbffULL },
 };
 
-static unsigned char DICT_4X4_1000_BYTES[][4][2] =
-    { { { 181, 50 },
-        { 235, 72 },
-        { 76, 173 },
-        { 18, 215 }, },
-      { { 15, 154 },
-        { 101, 71 },
-        { 89, 240 },
-        { 226, 166 }, },
-      { { 51, 45 },
-        { 222, 17 },
-        { 180, 204 },
-        { 136, 123 }, },
-      { { 153, 70 },
-        { 193, 60 },
-        { 98, 153 },
-        { 60, 131 }, },
-      { { 84, 158 },
-        { 161, 211 },
-        { 121, 42 },
-        { 203, 133 }, },
-      { { 121, 205 },
-        { 216, 183 },
-        { 179, 158 },
-        { 237, 27 }, },
-      { { 158, 46 },
-        { 135, 93 },
-        { 116, 121 },
-        { 186, 225 }, },
-      { { 196, 242 },
-        { 35, 234 },
-        { 79, 35 },
-        { 87, 196 }, },
-      { { 254, 218 },
-        { 173, 239 },
-        { 91, 127 },
-        { 247, 181 }, },
-      { { 207, 86 },
-        { 101, 252 },
-        { 106, 243 },
-        { 63, 166 }, },
-      { { 249, 145 },
-        { 248, 142 },
-        { 137, 159 },
-        { 113, 31 }, },
-      { { 17, 167 },
-        { 211, 18 },
-        { 229, 136 },
-        { 72, 203 }, },
-      { { 14, 183 },
-        { 55, 86 },
-        { 237, 112 },
-        { 106, 236 }, },
-      { { 42, 15 },
-        { 29, 21 },
-        { 240, 84 },
-        { 168, 184 }, },
-      { { 36, 177 },
-        { 58, 66 },
-        { 141, 36 },
-        { 66, 92 }, },
-      { { 38, 62 },
-        { 47, 81 },
-        { 124, 100 },
-        { 138, 244 }, },
-      { { 70, 101 },
-        { 22, 240 },
-        { 166, 98 },
-        { 15, 104 }, },
-      { { 102, 0 },
-        { 12, 192 },
-        { 0, 102 },
-        { 3, 48 }, },
-      { { 108, 94 },
-        { 41, 245 },
-        { 122, 54 },
-        { 175, 148 }, },
-      { { 118, 175 },
-        { 159, 211 },
-        { 245, 110 },
-        { 203, 249 }, },
-      { { 134, 139 },
-        { 21, 75 },
-        { 209, 97 },
-        { 210, 168 }, },
-      { { 176, 43 },
-        { 155, 9 },
-        { 212, 13 },
-        { 144, 217 }, },
-      { { 204, 213 },
-        { 48, 254 },
-        { 171, 51 },
-        { 127, 12 }, },
-      { { 221, 130 },
-        { 193, 206 },
-        { 65, 187 },
-        { 115, 131 }, },
-      { { 254, 71 },
-        { 157, 252 },
-        { 226, 127 },
-        { 63, 185 }, },
-      { { 148, 113 },
-        { 178, 104 },
-        { 142, 41 },
-        { 22, 77 }, },
-      { { 172, 228 },
-        { 10, 126 },
-        { 39, 53 },
-        { 126, 80 }, },
-      { { 165, 84 },
-        { 104, 120 },
-        { 42, 165 },
-        { 30, 22 }, },
-      { { 33, 35 },
-        { 91, 0 },
-        { 196, 132 },
-        { 0, 218 }, },
-      { { 52, 111 },
-        { 155, 113 },
-        { 246, 44 },
-        { 142, 217 }, },
-      { { 68, 21 },
-        { 48, 208 },
-        { 168, 34 },
-        { 11, 12 }, },
-      { { 87, 178 },
-        { 231, 194 },
-        { 77, 234 },
-        { 67, 231 }, },
-      { { 158, 207 },
-        { 149, 127 },
-        { 243, 121 },
-        { 254, 169 }, },
-      { { 240, 203 },
-        { 153, 171 },
-        { 211, 15 },
-        { 213, 153 }, },
-      { { 8, 174 },
-        { 3, 23 },
-        { 117, 16 },
-        { 232, 192 }, },
-      { { 9, 41 },
-        { 82, 5 },
-        { 148, 144 },
-        { 160, 74 }, },
-      { { 24, 117 },
-        { 178, 52 },
-        { 174, 24 },
-        { 44, 77 }, },
-      { { 4, 255 },
-        { 51, 115 },
-        { 255, 32 },
-        { 206, 204 }, },
-      { { 13, 246 },
-        { 99, 118 },
-        { 111, 176 },
-        { 110, 198 }, },
-      { { 28, 90 },
-        { 161, 101 },
-        { 90, 56 },
-        { 166, 133 }, },
-      { { 23, 24 },
-        { 228, 65 },
-        { 24, 232 },
-        { 130, 39 }, },
-      { { 42, 40 },
-        { 14, 5 },
-        { 20, 84 },
-        { 160, 112 }, },
-      { { 50, 140 },
-        { 140, 19 },
-        { 49, 76 },
-        { 200, 49 }, },
-      { { 56, 178 },
-        { 171, 6 },
-        { 77, 28 },
-        { 96, 213 }, },
-      { { 36, 232 },
-        { 10, 99 },
-        { 23, 36 },
-        { 198, 80 }, },
-      { { 46, 235 },
-        { 31, 103 },
-        { 215, 116 },
-        { 230, 248 }, },
-      { { 45, 63 },
-        { 123, 85 },
-        { 252, 180 },
-        { 170, 222 }, },
-      { { 75, 100 },
-        { 70, 180 },
-        { 38, 210 },
-        { 45, 98 }, },
-      { { 80, 46 },
-        { 131, 145 },
-        { 116, 10 },
-        { 137, 193 }, },
-      { { 80, 19 },
-        { 177, 128 },
-        { 200, 10 },
-        { 1, 141 }, },
-      { { 81, 148 },
-        { 224, 146 },
-        { 41, 138 },
-        { 73, 7 }, },
-      { { 85, 104 },
-        { 194, 225 },
-        { 22, 170 },
-        { 135, 67 }, },
-      { { 93, 65 },
-        { 208, 228 },
-        { 130, 186 },
-        { 39, 11 }, },
-      { { 95, 151 },
-        { 245, 214 },
-        { 233, 250 },
-        { 107, 175 }, },
-      { { 104, 1 },
-        { 24, 132 },
-        { 128, 22 },
-        { 33, 24 }, },
-      { { 104, 103 },
-        { 27, 180 },
-        { 230, 22 },
-        { 45, 216 }, },
-      { { 97, 36 },
-        { 74, 144 },
-        { 36, 134 },
-        { 9, 82 }, },
-      { { 97, 233 },
-        { 90, 163 },
-        { 151, 134 },
-        { 197, 90 }, },
-      { { 107, 18 },
-        { 109, 132 },
-        { 72, 214 },
-        { 33, 182 }, },
-      { { 111, 229 },
-        { 94, 246 },
-        { 167, 246 },
-        { 111, 122 }, },
-      { { 103, 223 },
-        { 125, 243 },
-        { 251, 230 },
-        { 207, 190 }, },
-      { { 126, 27 },
-        { 189, 197 },
-        { 216, 126 },
-        { 163, 189 }, },
-      { { 128, 160 },
-        { 2, 10 },
-        { 5, 1 },
-        { 80, 64 }, },
-      { { 131, 68 },
-        { 68, 56 },
-        { 34, 193 },
-        { 28, 34 }, },
-      { { 139, 162 },
-        { 71, 14 },
-        { 69, 209 },
-        { 112, 226 }, },
-      { { 147, 122 },
-        { 231, 41 },
-        { 94, 201 },
-        { 148, 231 }, },
-      { { 132, 108 },
-        { 2, 121 },
-        { 54, 33 },
-        { 158, 64 }, },
-      { { 133, 42 },
-        { 67, 73 },
-        { 84, 161 },
-        { 146, 194 }, },
-      { { 133, 156 },
-        { 96, 91 },
-        { 57, 161 },
-        { 218, 6 }, },
-      { { 156, 137 },
-        { 144, 79 },
-        { 145, 57 },
-        { 242, 9 }, },
-      { { 159, 161 },
-        { 214, 78 },
-        { 133, 249 },
-        { 114, 107 }, },
-      { { 187, 124 },
-        { 238, 61 },
-        { 62, 221 },
-        { 188, 119 }, },
-      { { 188, 4 },
-        { 136, 92 },
-        { 32, 61 },
-        { 58, 17 }, },
-      { { 182, 91 },
-        { 189, 105 },
-        { 218, 109 },
-        { 150, 189 }, },
-      { { 191, 200 },
-        { 204, 111 },
-        { 19, 253 },
-        { 246, 51 }, },
-      { { 183, 171 },
-        { 223, 75 },
-        { 213, 237 },
-        { 210, 251 }, },
-      { { 202, 31 },
-        { 53, 157 },
-        { 248, 83 },
-        { 185, 172 }, },
-      { { 201, 98 },
-        { 67, 172 },
-        { 70, 147 },
-        { 53, 194 }, },
-      { { 217, 88 },
-        { 224, 173 },
-        { 26, 155 },
-        { 181, 7 }, },
-      { { 211, 213 },
-        { 244, 186 },
-        { 171, 203 },
-        { 93, 47 }, },
-      { { 204, 152 },
-        { 32, 207 },
-        { 25, 51 },
-        { 243, 4 }, },
-      { { 199, 160 },
-        { 70, 202 },
-        { 5, 227 },
-        { 83, 98 }, },
-      { { 197, 55 },
-        { 115, 216 },
-        { 236, 163 },
-        { 27, 206 }, },
-      { { 233, 93 },
-        { 120, 189 },
-        { 186, 151 },
-        { 189, 30 }, },
-      { { 249, 37 },
-        { 218, 156 },
-        { 164, 159 },
-        { 57, 91 }, },
-      { { 251, 187 },
-        { 255, 143 },
-        { 221, 223 },
-        { 241, 255 }, },
-      { { 238, 42 },
-        { 15, 205 },
-        { 84, 119 },
-        { 179, 240 }, },
-      { { 247, 77 },
-        { 220, 249 },
-        { 178, 239 },
-        { 159, 59 }, },
-      { { 53, 117 },
-        { 250, 112 },
-        { 174, 172 },
-        { 14, 95 }, },
-      { { 138, 173 },
-        { 22, 31 },
-        { 181, 81 },
-        { 248, 104 }, },
-      { { 118, 23 },
-        { 189, 208 },
-        { 232, 110 },
-        { 11, 189 }, },
-      { { 10, 207 },
-        { 21, 55 },
-        { 243, 80 },
-        { 236, 168 }, },
-      { { 6, 75 },
-        { 21, 97 },
-        { 210, 96 },
-        { 134, 168 }, },
-      { { 45, 193 },
-        { 88, 102 },
-        { 131, 180 },
-        { 102, 26 }, },
-      { { 73, 216 },
-        { 96, 167 },
-        { 27, 146 },
-        { 229, 6 }, },
-      { { 67, 244 },
-        { 102, 178 },
-        { 47, 194 },
-        { 77, 102 }, },
-      { { 79, 54 },
-        { 103, 212 },
-        { 108, 242 },
-        { 43, 230 }, },
-      { { 79, 211 },
-        { 117, 230 },
-        { 203, 242 },
-        { 103, 174 }, },
-      { { 105, 228 },
-        { 74, 182 },
-        { 39, 150 },
-        { 109, 82 }, },
-      { { 112, 199 },
-        { 153, 178 },
-        { 227, 14 },
-        { 77, 153 }, },
-      { { 122, 110 },
-        { 143, 181 },
-        { 118, 94 },
-        { 173, 241 }, },
-      { { 180, 234 },
-        { 139, 107 },
-        { 87, 45 },
-        { 214, 209 }, },
-      { { 237, 79 },
-        { 89, 253 },
-        { 242, 183 },
-        { 191, 154 }, },
-      { { 252, 231 },
-        { 155, 254 },
-        { 231, 63 },
-        { 127, 217 }, },
-      { { 254, 166 },
-        { 143, 222 },
-        { 101, 127 },
-        { 123, 241 }, },
-      { { 0, 37 },
-        { 18, 16 },
-        { 164, 0 },
-        { 8, 72 }, },
-      { { 0, 67 },
-        { 17, 32 },
-        { 194, 0 },
-        { 4, 136 }, },
-      { { 10, 136 },
-        { 4, 7 },
-        { 17, 80 },
-        { 224, 32 }, },
-      { { 10, 134 },
-        { 5, 22 },
-        { 97, 80 },
-        { 104, 160 }, },
-      { { 2, 111 },
-        { 23, 49 },
-        { 246, 64 },
-        { 140, 232 }, },
-      { { 0, 28 },
-        { 32, 17 },
-        { 56, 0 },
-        { 136, 4 }, },
-      { { 0, 151 },
-        { 49, 18 },
-        { 233, 0 },
-        { 72, 140 }, },
-      { { 8, 55 },
-        { 51, 20 },
-        { 236, 16 },
-        { 40, 204 }, },
-      { { 10, 49 },
-        { 54, 4 },
-        { 140, 80 },
-        { 32, 108 }, },
-      { { 9, 198 },
-        { 65, 54 },
-        { 99, 144 },
-        { 108, 130 }, },
-      { { 11, 1 },
-        { 84, 4 },
-        { 128, 208 },
-        { 32, 42 }, },
-      { { 9, 251 },
-        { 115, 39 },
-        { 223, 144 },
-        { 228, 206 }, },
-      { { 11, 88 },
-        { 100, 37 },
-        { 26, 208 },
-        { 164, 38 }, },
-      { { 16, 130 },
-        { 129, 2 },
-        { 65, 8 },
-        { 64, 129 }, },
-      { { 24, 45 },
-        { 146, 21 },
-        { 180, 24 },
-        { 168, 73 }, },
-      { { 16, 120 },
-        { 162, 33 },
-        { 30, 8 },
-        { 132, 69 }, },
-      { { 16, 115 },
-        { 179, 32 },
-        { 206, 8 },
-        { 4, 205 }, },
-      { { 18, 116 },
-        { 166, 48 },
-        { 46, 72 },
-        { 12, 101 }, },
-      { { 18, 177 },
-        { 182, 2 },
-        { 141, 72 },
-        { 64, 109 }, },
-      { { 26, 249 },
-        { 182, 39 },
-        { 159, 88 },
-        { 228, 109 }, },
-      { { 19, 6 },
-        { 197, 16 },
-        { 96, 200 },
-        { 8, 163 }, },
-      { { 12, 14 },
-        { 1, 85 },
-        { 112, 48 },
-        { 170, 128 }, },
-      { { 12, 241 },
-        { 50, 102 },
-        { 143, 48 },
-        { 102, 76 }, },
-      { { 4, 51 },
-        { 51, 64 },
-        { 204, 32 },
-        { 2, 204 }, },
-      { { 12, 159 },
-        { 49, 87 },
-        { 249, 48 },
-        { 234, 140 }, },
-      { { 14, 242 },
-        { 39, 102 },
-        { 79, 112 },
-        { 102, 228 }, },
-      { { 14, 253 },
-        { 54, 119 },
-        { 191, 112 },
-        { 238, 108 }, },
-      { { 7, 76 },
-        { 68, 113 },
-        { 50, 224 },
-        { 142, 34 }, },
-      { { 15, 164 },
-        { 70, 86 },
-        { 37, 240 },
-        { 106, 98 }, },
-      { { 7, 47 },
-        { 87, 81 },
-        { 244, 224 },
-        { 138, 234 }, },
-      { { 5, 181 },
-        { 114, 82 },
-        { 173, 160 },
-        { 74, 78 }, },
-      { { 15, 145 },
-        { 116, 70 },
-        { 137, 240 },
-        { 98, 46 }, },
-      { { 7, 219 },
-        { 117, 99 },
-        { 219, 224 },
-        { 198, 174 }, },
-      { { 30, 228 },
-        { 134, 118 },
-        { 39, 120 },
-        { 110, 97 }, },
-      { { 20, 57 },
-        { 178, 65 },
-        { 156, 40 },
-        { 130, 77 }, },
-      { { 29, 128 },
-        { 192, 70 },
-        { 1, 184 },
-        { 98, 3 }, },
-      { { 21, 200 },
-        { 192, 99 },
-        { 19, 168 },
-        { 198, 3 }, },
-      { { 31, 139 },
-        { 213, 71 },
-        { 209, 248 },
-        { 226, 171 }, },
-      { { 21, 186 },
-        { 227, 67 },
-        { 93, 168 },
-        { 194, 199 }, },
-      { { 29, 177 },
-        { 242, 70 },
-        { 141, 184 },
-        { 98, 79 }, },
-      { { 32, 128 },
-        { 8, 2 },
-        { 1, 4 },
-        { 64, 16 }, },
-      { { 40, 233 },
-        { 26, 39 },
-        { 151, 20 },
-        { 228, 88 }, },
-      { { 34, 162 },
-        { 15, 2 },
-        { 69, 68 },
-        { 64, 240 }, },
-      { { 40, 83 },
-        { 57, 36 },
-        { 202, 20 },
-        { 36, 156 }, },
-      { { 42, 240 },
-        { 46, 38 },
-        { 15, 84 },
-        { 100, 116 }, },
-      { { 34, 247 },
-        { 63, 50 },
-        { 239, 68 },
-        { 76, 252 }, },
-      { { 41, 64 },
-        { 72, 36 },
-        { 2, 148 },
-        { 36, 18 }, },
-      { { 33, 70 },
-        { 73, 48 },
-        { 98, 132 },
-        { 12, 146 }, },
-      { { 41, 185 },
-        { 122, 7 },
-        { 157, 148 },
-        { 224, 94 }, },
-      { { 43, 156 },
-        { 108, 23 },
-        { 57, 212 },
-        { 232, 54 }, },
-      { { 43, 178 },
-        { 111, 6 },
-        { 77, 212 },
-        { 96, 246 }, },
-      { { 56, 202 },
-        { 137, 39 },
-        { 83, 28 },
-        { 228, 145 }, },
-      { { 56, 46 },
-        { 139, 21 },
-        { 116, 28 },
-        { 168, 209 }, },
-      { { 48, 7 },
-        { 153, 16 },
-        { 224, 12 },
-        { 8, 153 }, },
-      { { 56, 231 },
-        { 155, 54 },
-        { 231, 28 },
-        { 108, 217 }, },
-      { { 58, 73 },
-        { 156, 37 },
-        { 146, 92 },
-        { 164, 57 }, },
-      { { 58, 101 },
-        { 158, 52 },
-        { 166, 92 },
-        { 44, 121 }, },
-      { { 50, 93 },
-        { 188, 49 },
-        { 186, 76 },
-        { 140, 61 }, },
-      { { 59, 136 },
-        { 204, 7 },
-        { 17, 220 },
-        { 224, 51 }, },
-      { { 57, 29 },
-        { 248, 21 },
-        { 184, 156 },
-        { 168, 31 }, },
-      { { 59, 211 },
-        { 253, 38 },
-        { 203, 220 },
-        { 100, 191 }, },
-      { { 38, 71 },
-        { 29, 112 },
-        { 226, 100 },
-        { 14, 184 }, },
-      { { 39, 128 },
-        { 76, 66 },
-        { 1, 228 },
-        { 66, 50 }, },
-      { { 47, 170 },
-        { 79, 71 },
-        { 85, 244 },
-        { 226, 242 }, },
-      { { 45, 20 },
-        { 104, 84 },
-        { 40, 180 },
-        { 42, 22 }, },
-      { { 37, 222 },
-        { 105, 115 },
-        { 123, 164 },
-        { 206, 150 }, },
-      { { 37, 83 },
-        { 121, 96 },
-        { 202, 164 },
-        { 6, 158 }, },
-      { { 47, 119 },
-        { 127, 116 },
-        { 238, 244 },
-        { 46, 254 }, },
-      { { 52, 72 },
-        { 136, 97 },
-        { 18, 44 },
-        { 134, 17 }, },
-      { { 60, 168 },
-        { 138, 71 },
-        { 21, 60 },
-        { 226, 81 }, },
-      { { 60, 65 },
-        { 152, 100 },
-        { 130, 60 },
-        { 38, 25 }, },
-      { { 52, 13 },
-        { 152, 81 },
-        { 176, 44 },
-        { 138, 25 }, },
-      { { 52, 251 },
-        { 187, 99 },
-        { 223, 44 },
-        { 198, 221 }, },
-      { { 54, 154 },
-        { 173, 67 },
-        { 89, 108 },
-        { 194, 181 }, },
-      { { 61, 224 },
-        { 202, 102 },
-        { 7, 188 },
-        { 102, 83 }, },
-      { { 53, 106 },
-        { 203, 97 },
-        { 86, 172 },
-        { 134, 211 }, },
-      { { 61, 9 },
-        { 216, 69 },
-        { 144, 188 },
-        { 162, 27 }, },
-      { { 61, 237 },
-        { 218, 119 },
-        { 183, 188 },
-        { 238, 91 }, },
-      { { 63, 196 },
-        { 204, 118 },
-        { 35, 252 },
-        { 110, 51 }, },
-      { { 63, 108 },
-        { 206, 117 },
-        { 54, 252 },
-        { 174, 115 }, },
-      { { 55, 206 },
-        { 205, 115 },
-        { 115, 236 },
-        { 206, 179 }, },
-      { { 61, 92 },
-        { 232, 117 },
-        { 58, 188 },
-        { 174, 23 }, },
-      { { 61, 118 },
-        { 235, 116 },
-        { 110, 188 },
-        { 46, 215 }, },
-      { { 55, 176 },
-        { 238, 66 },
-        { 13, 236 },
-        { 66, 119 }, },
-      { { 63, 23 },
-        { 253, 84 },
-        { 232, 252 },
-        { 42, 191 }, },
-      { { 63, 255 },
-        { 255, 119 },
-        { 255, 252 },
-        { 238, 255 }, },
-      { { 72, 229 },
-        { 18, 182 },
-        { 167, 18 },
-        { 109, 72 }, },
-      { { 66, 104 },
-        { 6, 161 },
-        { 22, 66 },
-        { 133, 96 }, },
-      { { 74, 45 },
-        { 22, 149 },
-        { 180, 82 },
-        { 169, 104 }, },
-      { { 65, 96 },
-        { 66, 160 },
-        { 6, 130 },
-        { 5, 66 }, },
-      { { 73, 81 },
-        { 112, 164 },
-        { 138, 146 },
-        { 37, 14 }, },
-      { { 65, 221 },
-        { 112, 179 },
-        { 187, 130 },
-        { 205, 14 }, },
-      { { 75, 223 },
-        { 117, 183 },
-        { 251, 210 },
-        { 237, 174 }, },
-      { { 88, 79 },
-        { 145, 181 },
-        { 242, 26 },
-        { 173, 137 }, },
-      { { 90, 72 },
-        { 132, 165 },
-        { 18, 90 },
-        { 165, 33 }, },
-      { { 88, 22 },
-        { 161, 148 },
-        { 104, 26 },
-        { 41, 133 }, },
-      { { 80, 93 },
-        { 176, 177 },
-        { 186, 10 },
-        { 141, 13 }, },
-      { { 90, 250 },
-        { 167, 167 },
-        { 95, 90 },
-        { 229, 229 }, },
-      { { 90, 181 },
-        { 182, 150 },
-        { 173, 90 },
-        { 105, 109 }, },
-      { { 81, 35 },
-        { 211, 128 },
-        { 196, 138 },
-        { 1, 203 }, },
-      { { 91, 138 },
-        { 197, 135 },
-        { 81, 218 },
-        { 225, 163 }, },
-      { { 89, 25 },
-        { 240, 133 },
-        { 152, 154 },
-        { 161, 15 }, },
-      { { 81, 53 },
-        { 242, 144 },
-        { 172, 138 },
-        { 9, 79 }, },
-      { { 76, 105 },
-        { 18, 229 },
-        { 150, 50 },
-        { 167, 72 }, },
-      { { 70, 193 },
-        { 20, 226 },
-        { 131, 98 },
-        { 71, 40 }, },
-      { { 78, 11 },
-        { 21, 197 },
-        { 208, 114 },
-        { 163, 168 }, },
-      { { 68, 95 },
-        { 49, 241 },
-        { 250, 34 },
-        { 143, 140 }, },
-      { { 78, 89 },
-        { 52, 229 },
-        { 154, 114 },
-        { 167, 44 }, },
-      { { 77, 131 },
-        { 81, 198 },
-        { 193, 178 },
-        { 99, 138 }, },
-      { { 77, 125 },
-        { 114, 245 },
-        { 190, 178 },
-        { 175, 78 }, },
-      { { 71, 216 },
-        { 100, 227 },
-        { 27, 226 },
-        { 199, 38 }, },
-      { { 71, 115 },
-        { 119, 224 },
-        { 206, 226 },
-        { 7, 238 }, },
-      { { 92, 133 },
-        { 144, 214 },
-        { 161, 58 },
-        { 107, 9 }, },
-      { { 94, 68 },
-        { 132, 244 },
-        { 34, 122 },
-        { 47, 33 }, },
-      { { 86, 43 },
-        { 151, 193 },
-        { 212, 106 },
-        { 131, 233 }, },
-      { { 92, 187 },
-        { 179, 199 },
-        { 221, 58 },
-        { 227, 205 }, },
-      { { 85, 195 },
-        { 209, 226 },
-        { 195, 170 },
-        { 71, 139 }, },
-      { { 95, 110 },
-        { 199, 245 },
-        { 118, 250 },
-        { 175, 227 }, },
-      { { 95, 235 },
-        { 215, 231 },
-        { 215, 250 },
-        { 231, 235 }, },
-      { { 93, 18 },
-        { 225, 196 },
-        { 72, 186 },
-        { 35, 135 }, },
-      { { 85, 94 },
-        { 225, 241 },
-        { 122, 170 },
-        { 143, 135 }, },
-      { { 98, 112 },
-        { 46, 160 },
-        { 14, 70 },
-        { 5, 116 }, },
-      { { 98, 21 },
-        { 60, 144 },
-        { 168, 70 },
-        { 9, 60 }, },
-      { { 97, 194 },
-        { 73, 162 },
-        { 67, 134 },
-        { 69, 146 }, },
-      { { 107, 32 },
-        { 78, 132 },
-        { 4, 214 },
-        { 33, 114 }, },
-      { { 99, 69 },
-        { 92, 176 },
-        { 162, 198 },
-        { 13, 58 }, },
-      { { 107, 92 },
-        { 108, 181 },
-        { 58, 214 },
-        { 173, 54 }, },
-      { { 107, 91 },
-        { 125, 165 },
-        { 218, 214 },
-        { 165, 190 }, },
-      { { 120, 12 },
-        { 136, 149 },
-        { 48, 30 },
-        { 169, 17 }, },
-      { { 122, 207 },
-        { 157, 183 },
-        { 243, 94 },
-        { 237, 185 }, },
-      { { 120, 127 },
-        { 187, 181 },
-        { 254, 30 },
-        { 173, 221 }, },
-      { { 121, 128 },
-        { 200, 134 },
-        { 1, 158 },
-        { 97, 19 }, },
-      { { 113, 229 },
-        { 218, 178 },
-        { 167, 142 },
-        { 77, 91 }, },
-      { { 113, 116 },
-        { 234, 176 },
-        { 46, 142 },
-        { 13, 87 }, },
-      { { 121, 182 },
-        { 235, 150 },
-        { 109, 158 },
-        { 105, 215 }, },
-      { { 113, 211 },
-        { 249, 162 },
-        { 203, 142 },
-        { 69, 159 }, },
-      { { 123, 51 },
-        { 255, 132 },
-        { 204, 222 },
-        { 33, 255 }, },
-      { { 100, 106 },
-        { 11, 225 },
-        { 86, 38 },
-        { 135, 208 }, },
-      { { 102, 168 },
-        { 14, 195 },
-        { 21, 102 },
-        { 195, 112 }, },
-      { { 110, 167 },
-        { 31, 214 },
-        { 229, 118 },
-        { 107, 248 }, },
-      { { 110, 145 },
-        { 60, 198 },
-        { 137, 118 },
-        { 99, 60 }, },
-      { { 101, 34 },
-        { 75, 192 },
-        { 68, 166 },
-        { 3, 210 }, },
-      { { 109, 203 },
-        { 89, 231 },
-        { 211, 182 },
-        { 231, 154 }, },
-      { { 103, 141 },
-        { 92, 211 },
-        { 177, 230 },
-        { 203, 58 }, },
-      { { 109, 49 },
-        { 122, 196 },
-        { 140, 182 },
-        { 35, 94 }, },
-      { { 126, 128 },
-        { 140, 198 },
-        { 1, 126 },
-        { 99, 49 }, },
-      { { 126, 226 },
-        { 143, 230 },
-        { 71, 126 },
-        { 103, 241 }, },
-      { { 126, 141 },
-        { 156, 215 },
-        { 177, 126 },
-        { 235, 57 }, },
-      { { 116, 210 },
-        { 169, 226 },
-        { 75, 46 },
-        { 71, 149 }, },
-      { { 124, 50 },
-        { 171, 196 },
-        { 76, 62 },
-        { 35, 213 }, },
-      { { 126, 53 },
-        { 190, 212 },
-        { 172, 126 },
-        { 43, 125 }, },
-      { { 117, 171 },
-        { 219, 195 },
-        { 213, 174 },
-        { 195, 219 }, },
-      { { 119, 5 },
-        { 220, 208 },
-        { 160, 238 },
-        { 11, 59 }, },
-      { { 127, 43 },
-        { 223, 197 },
-        { 212, 254 },
-        { 163, 251 }, },
-      { { 125, 218 },
-        { 233, 231 },
-        { 91, 190 },
-        { 231, 151 }, },
-      { { 127, 146 },
-        { 237, 198 },
-        { 73, 254 },
-        { 99, 183 }, },
-      { { 128, 117 },
-        { 50, 56 },
-        { 174, 1 },
-        { 28, 76 }, },
-      { { 128, 243 },
-        { 51, 42 },
-        { 207, 1 },
-        { 84, 204 }, },
-      { { 129, 166 },
-        { 67, 26 },
-        { 101, 129 },
-        { 88, 194 }, },
-      { { 137, 237 },
-        { 82, 63 },
-        { 183, 145 },
-        { 252, 74 }, },
-      { { 129, 252 },
-        { 98, 59 },
-        { 63, 129 },
-        { 220, 70 }, },
-      { { 152, 166 },
-        { 131, 30 },
-        { 101, 25 },
-        { 120, 193 }, },
-      { { 154, 32 },
-        { 134, 12 },
-        { 4, 89 },
-        { 48, 97 }, },
-      { { 145, 67 },
-        { 209, 40 },
-        { 194, 137 },
-        { 20, 139 }, },
-      { { 153, 249 },
-        { 242, 47 },
-        { 159, 153 },
-        { 244, 79 }, },
-      { { 145, 147 },
-        { 241, 10 },
-        { 201, 137 },
-        { 80, 143 }, },
-      { { 155, 212 },
-        { 228, 62 },
-        { 43, 217 },
-        { 124, 39 }, },
-      { { 132, 9 },
-        { 16, 73 },
-        { 144, 33 },
-        { 146, 8 }, },
-      { { 132, 107 },
-        { 19, 105 },
-        { 214, 33 },
-        { 150, 200 }, },
-      { { 134, 196 },
-        { 4, 122 },
-        { 35, 97 },
-        { 94, 32 }, },
-      { { 142, 100 },
-        { 6, 124 },
-        { 38, 113 },
-        { 62, 96 }, },
-      { { 134, 26 },
-        { 37, 73 },
-        { 88, 97 },
-        { 146, 164 }, },
-      { { 133, 78 },
-        { 65, 121 },
-        { 114, 161 },
-        { 158, 130 }, },
-      { { 141, 203 },
-        { 81, 111 },
-        { 211, 177 },
-        { 246, 138 }, },
-      { { 133, 103 },
-        { 83, 120 },
-        { 230, 161 },
-        { 30, 202 }, },
-      { { 133, 175 },
-        { 83, 91 },
-        { 245, 161 },
-        { 218, 202 }, },
-      { { 133, 215 },
-        { 113, 122 },
-        { 235, 161 },
-        { 94, 142 }, },
-      { { 135, 179 },
-        { 119, 74 },
-        { 205, 225 },
-        { 82, 238 }, },
-      { { 156, 225 },
-        { 146, 110 },
-        { 135, 57 },
-        { 118, 73 }, },
-      { { 156, 242 },
-        { 163, 110 },
-        { 79, 57 },
-        { 118, 197 }, },
-      { { 148, 23 },
-        { 177, 88 },
-        { 232, 41 },
-        { 26, 141 }, },
-      { { 149, 0 },
-        { 192, 72 },
-        { 0, 169 },
-        { 18, 3 }, },
-      { { 149, 162 },
-        { 195, 74 },
-        { 69, 169 },
-        { 82, 195 }, },
-      { { 157, 35 },
-        { 211, 76 },
-        { 196, 185 },
-        { 50, 203 }, },
-      { { 159, 98 },
-        { 199, 108 },
-        { 70, 249 },
-        { 54, 227 }, },
-      { { 157, 82 },
-        { 225, 108 },
-        { 74, 185 },
-        { 54, 135 }, },
-      { { 149, 218 },
-        { 225, 107 },
-        { 91, 169 },
-        { 214, 135 }, },
-      { { 160, 197 },
-        { 24, 58 },
-        { 163, 5 },
-        { 92, 24 }, },
-      { { 170, 205 },
-        { 28, 63 },
-        { 179, 85 },
-        { 252, 56 }, },
-      { { 162, 216 },
-        { 44, 43 },
-        { 27, 69 },
-        { 212, 52 }, },
-      { { 162, 87 },
-        { 61, 56 },
-        { 234, 69 },
-        { 28, 188 }, },
-      { { 169, 61 },
-        { 122, 29 },
-        { 188, 149 },
-        { 184, 94 }, },
-      { { 169, 87 },
-        { 121, 60 },
-        { 234, 149 },
-        { 60, 158 }, },
-      { { 171, 82 },
-        { 109, 44 },
-        { 74, 213 },
-        { 52, 182 }, },
-      { { 163, 54 },
-        { 111, 24 },
-        { 108, 197 },
-        { 24, 246 }, },
-      { { 163, 89 },
-        { 124, 41 },
-        { 154, 197 },
-        { 148, 62 }, },
-      { { 176, 244 },
-        { 170, 58 },
-        { 47, 13 },
-        { 92, 85 }, },
-      { { 184, 18 },
-        { 169, 12 },
-        { 72, 29 },
-        { 48, 149 }, },
-      { { 176, 191 },
-        { 187, 27 },
-        { 253, 13 },
-        { 216, 221 }, },
-      { { 178, 157 },
-        { 188, 27 },
-        { 185, 77 },
-        { 216, 61 }, },
-      { { 187, 237 },
-        { 222, 63 },
-        { 183, 221 },
-        { 252, 123 }, },
-      { { 185, 114 },
-        { 235, 44 },
-        { 78, 157 },
-        { 52, 215 }, },
-      { { 185, 150 },
-        { 233, 30 },
-        { 105, 157 },
-        { 120, 151 }, },
-      { { 164, 195 },
-        { 25, 106 },
-        { 195, 37 },
-        { 86, 152 }, },
-      { { 172, 210 },
-        { 41, 110 },
-        { 75, 53 },
-        { 118, 148 }, },
-      { { 174, 177 },
-        { 62, 78 },
-        { 141, 117 },
-        { 114, 124 }, },
-      { { 165, 130 },
-        { 73, 74 },
-        { 65, 165 },
-        { 82, 146 }, },
-      { { 175, 101 },
-        { 94, 124 },
-        { 166, 245 },
-        { 62, 122 }, },
-      { { 165, 123 },
-        { 123, 105 },
-        { 222, 165 },
-        { 150, 222 }, },
-      { { 175, 250 },
-        { 111, 111 },
-        { 95, 245 },
-        { 246, 246 }, },
-      { { 180, 100 },
-        { 138, 120 },
-        { 38, 45 },
-        { 30, 81 }, },
-      { { 188, 98 },
-        { 139, 108 },
-        { 70, 61 },
-        { 54, 209 }, },
-      { { 180, 129 },
-        { 152, 74 },
-        { 129, 45 },
-        { 82, 25 }, },
-      { { 182, 160 },
-        { 142, 74 },
-        { 5, 109 },
-        { 82, 113 }, },
-      { { 190, 238 },
-        { 143, 127 },
-        { 119, 125 },
-        { 254, 241 }, },
-      { { 190, 13 },
-        { 156, 93 },
-        { 176, 125 },
-        { 186, 57 }, },
-      { { 188, 217 },
-        { 184, 111 },
-        { 155, 61 },
-        { 246, 29 }, },
-      { { 190, 248 },
-        { 174, 111 },
-        { 31, 125 },
-        { 246, 117 }, },
-      { { 181, 40 },
-        { 202, 73 },
-        { 20, 173 },
-        { 146, 83 }, },
-      { { 183, 9 },
-        { 220, 73 },
-        { 144, 237 },
-        { 146, 59 }, },
-      { { 183, 210 },
-        { 237, 106 },
-        { 75, 237 },
-        { 86, 183 }, },
-      { { 192, 234 },
-        { 3, 171 },
-        { 87, 3 },
-        { 213, 192 }, },
-      { { 192, 25 },
-        { 48, 137 },
-        { 152, 3 },
-        { 145, 12 }, },
-      { { 192, 253 },
-        { 50, 187 },
-        { 191, 3 },
-        { 221, 76 }, },
-      { { 200, 211 },
-        { 49, 174 },
-        { 203, 19 },
-        { 117, 140 }, },
-      { { 202, 90 },
-        { 37, 173 },
-        { 90, 83 },
-        { 181, 164 }, },
-      { { 193, 77 },
-        { 80, 185 },
-        { 178, 131 },
-        { 157, 10 }, },
-      { { 201, 180 },
-        { 98, 158 },
-        { 45, 147 },
-        { 121, 70 }, },
-      { { 193, 87 },
-        { 113, 184 },
-        { 234, 131 },
-        { 29, 142 }, },
-      { { 195, 152 },
-        { 100, 139 },
-        { 25, 195 },
-        { 209, 38 }, },
-      { { 195, 29 },
-        { 116, 153 },
-        { 184, 195 },
-        { 153, 46 }, },
-      { { 216, 128 },
-        { 128, 142 },
-        { 1, 27 },
-        { 113, 1 }, },
-      { { 216, 239 },
-        { 147, 191 },
-        { 247, 27 },
-        { 253, 201 }, },
-      { { 218, 43 },
-        { 151, 141 },
-        { 212, 91 },
-        { 177, 233 }, },
-      { { 208, 30 },
-        { 161, 153 },
-        { 120, 11 },
-        { 153, 133 }, },
-      { { 209, 5 },
-        { 208, 152 },
-        { 160, 139 },
-        { 25, 11 }, },
-      { { 211, 173 },
-        { 214, 155 },
-        { 181, 203 },
-        { 217, 107 }, },
-      { { 219, 167 },
-        { 215, 158 },
-        { 229, 219 },
-        { 121, 235 }, },
-      { { 196, 201 },
-        { 16, 235 },
-        { 147, 35 },
-        { 215, 8 }, },
-      { { 204, 120 },
-        { 34, 237 },
-        { 30, 51 },
-        { 183, 68 }, },
-      { { 205, 69 },
-        { 80, 252 },
-        { 162, 179 },
-        { 63, 10 }, },
-      { { 197, 11 },
-        { 81, 201 },
-        { 208, 163 },
-        { 147, 138 }, },
-      { { 207, 207 },
-        { 85, 255 },
-        { 243, 243 },
-        { 255, 170 }, },
-      { { 220, 172 },
-        { 130, 223 },
-        { 53, 59 },
-        { 251, 65 }, },
-      { { 212, 2 },
-        { 129, 200 },
-        { 64, 43 },
-        { 19, 129 }, },
-      { { 220, 99 },
-        { 147, 236 },
-        { 198, 59 },
-        { 55, 201 }, },
-      { { 212, 39 },
-        { 147, 216 },
-        { 228, 43 },
-        { 27, 201 }, },
-      { { 212, 245 },
-        { 178, 250 },
-        { 175, 43 },
-        { 95, 77 }, },
-      { { 214, 120 },
-        { 166, 233 },
-        { 30, 107 },
-        { 151, 101 }, },
-      { { 222, 184 },
-        { 166, 207 },
-        { 29, 123 },
-        { 243, 101 }, },
-      { { 221, 230 },
-        { 195, 254 },
-        { 103, 187 },
-        { 127, 195 }, },
-      { { 213, 93 },
-        { 240, 249 },
-        { 186, 171 },
-        { 159, 15 }, },
-      { { 221, 189 },
-        { 242, 223 },
-        { 189, 187 },
-        { 251, 79 }, },
-      { { 223, 29 },
-        { 244, 221 },
-        { 184, 251 },
-        { 187, 47 }, },
-      { { 226, 202 },
-        { 13, 171 },
-        { 83, 71 },
-        { 213, 176 }, },
-      { { 234, 107 },
-        { 31, 173 },
-        { 214, 87 },
-        { 181, 248 }, },
-      { { 224, 180 },
-        { 42, 154 },
-        { 45, 7 },
-        { 89, 84 }, },
-      { { 226, 56 },
-        { 46, 137 },
-        { 28, 71 },
-        { 145, 116 }, },
-      { { 226, 212 },
-        { 44, 186 },
-        { 43, 71 },
-        { 93, 52 }, },
-      { { 227, 34 },
-        { 79, 136 },
-        { 68, 199 },
-        { 17, 242 }, },
-      { { 225, 216 },
-        { 104, 171 },
-        { 27, 135 },
-        { 213, 22 }, },
-      { { 240, 3 },
-        { 153, 136 },
-        { 192, 15 },
-        { 17, 153 }, },
-      { { 242, 204 },
-        { 140, 187 },
-        { 51, 79 },
-        { 221, 49 }, },
-      { { 248, 246 },
-        { 171, 190 },
-        { 111, 31 },
-        { 125, 213 }, },
-      { { 241, 73 },
-        { 216, 169 },
-        { 146, 143 },
-        { 149, 27 }, },
-      { { 243, 234 },
-        { 207, 171 },
-        { 87, 207 },
-        { 213, 243 }, },
-      { { 241, 156 },
-        { 232, 155 },
-        { 57, 143 },
-        { 217, 23 }, },
-      { { 249, 245 },
-        { 250, 190 },
-        { 175, 159 },
-        { 125, 95 }, },
-      { { 241, 59 },
-        { 251, 137 },
-        { 220, 143 },
-        { 145, 223 }, },
-      { { 236, 141 },
-        { 24, 223 },
-        { 177, 55 },
-        { 251, 24 }, },
-      { { 238, 201 },
-        { 28, 239 },
-        { 147, 119 },
-        { 247, 56 }, },
-      { { 230, 15 },
-        { 29, 217 },
-        { 240, 103 },
-        { 155, 184 }, },
-      { { 228, 247 },
-        { 59, 250 },
-        { 239, 39 },
-        { 95, 220 }, },
-      { { 231, 96 },
-        { 78, 232 },
-        { 6, 231 },
-        { 23, 114 }, },
-      { { 239, 232 },
-        { 78, 239 },
-        { 23, 247 },
-        { 247, 114 }, },
-      { { 237, 178 },
-        { 107, 206 },
-        { 77, 183 },
-        { 115, 214 }, },
-      { { 229, 21 },
-        { 120, 216 },
-        { 168, 167 },
-        { 27, 30 }, },
-      { { 239, 209 },
-        { 124, 238 },
-        { 139, 247 },
-        { 119, 62 }, },
-      { { 244, 134 },
-        { 137, 218 },
-        { 97, 47 },
-        { 91, 145 }, },
-      { { 252, 1 },
-        { 152, 204 },
-        { 128, 63 },
-        { 51, 25 }, },
-      { { 246, 195 },
-        { 157, 234 },
-        { 195, 111 },
-        { 87, 185 }, },
-      { { 244, 124 },
-        { 170, 249 },
-        { 62, 47 },
-        { 159, 85 }, },
-      { { 252, 147 },
-        { 185, 206 },
-        { 201, 63 },
-        { 115, 157 }, },
-      { { 245, 66 },
-        { 201, 232 },
-        { 66, 175 },
-        { 23, 147 }, },
-      { { 253, 152 },
-        { 232, 207 },
-        { 25, 191 },
-        { 243, 23 }, },
-      { { 245, 61 },
-        { 250, 217 },
-        { 188, 175 },
-        { 155, 95 }, },
-      { { 2, 189 },
-        { 54, 19 },
-        { 189, 64 },
-        { 200, 108 }, },
-      { { 0, 225 },
-        { 18, 34 },
-        { 135, 0 },
-        { 68, 72 }, },
-      { { 2, 226 },
-        { 7, 34 },
-        { 71, 64 },
-        { 68, 224 }, },
-      { { 2, 174 },
-        { 7, 19 },
-        { 117, 64 },
-        { 200, 224 }, },
-      { { 8, 120 },
-        { 34, 37 },
-        { 30, 16 },
-        { 164, 68 }, },
-      { { 0, 116 },
-        { 34, 48 },
-        { 46, 0 },
-        { 12, 68 }, },
-      { { 8, 158 },
-        { 33, 23 },
-        { 121, 16 },
-        { 232, 132 }, },
-      { { 8, 209 },
-        { 48, 38 },
-        { 139, 16 },
-        { 100, 12 }, },
-      { { 8, 125 },
-        { 50, 53 },
-        { 190, 16 },
-        { 172, 76 }, },
-      { { 10, 50 },
-        { 39, 4 },
-        { 76, 80 },
-        { 32, 228 }, },
-      { { 10, 222 },
-        { 37, 55 },
-        { 123, 80 },
-        { 236, 164 }, },
-      { { 2, 81 },
-        { 52, 32 },
-        { 138, 64 },
-        { 4, 44 }, },
-      { { 1, 162 },
-        { 67, 2 },
-        { 69, 128 },
-        { 64, 194 }, },
-      { { 3, 128 },
-        { 68, 2 },
-        { 1, 192 },
-        { 64, 34 }, },
-      { { 11, 131 },
-        { 85, 6 },
-        { 193, 208 },
-        { 96, 170 }, },
-      { { 11, 75 },
-        { 85, 37 },
-        { 210, 208 },
-        { 164, 170 }, },
-      { { 11, 39 },
-        { 87, 20 },
-        { 228, 208 },
-        { 40, 234 }, },
-      { { 11, 239 },
-        { 87, 55 },
-        { 247, 208 },
-        { 236, 234 }, },
-      { { 9, 182 },
-        { 99, 22 },
-        { 109, 144 },
-        { 104, 198 }, },
-      { { 9, 89 },
-        { 112, 37 },
-        { 154, 144 },
-        { 164, 14 }, },
-      { { 9, 147 },
-        { 113, 6 },
-        { 201, 144 },
-        { 96, 142 }, },
-      { { 11, 248 },
-        { 102, 39 },
-        { 31, 208 },
-        { 228, 102 }, },
-      { { 3, 217 },
-        { 116, 35 },
-        { 155, 192 },
-        { 196, 46 }, },
-      { { 3, 241 },
-        { 118, 34 },
-        { 143, 192 },
-        { 68, 110 }, },
-      { { 16, 196 },
-        { 128, 50 },
-        { 35, 8 },
-        { 76, 1 }, },
-      { { 24, 171 },
-        { 147, 7 },
-        { 213, 24 },
-        { 224, 201 }, },
-      { { 26, 160 },
-        { 134, 6 },
-        { 5, 88 },
-        { 96, 97 }, },
-      { { 26, 4 },
-        { 132, 20 },
-        { 32, 88 },
-        { 40, 33 }, },
-      { { 26, 108 },
-        { 134, 53 },
-        { 54, 88 },
-        { 172, 97 }, },
-      { { 26, 174 },
-        { 135, 23 },
-        { 117, 88 },
-        { 232, 225 }, },
-      { { 18, 137 },
-        { 148, 3 },
-        { 145, 72 },
-        { 192, 41 }, },
-      { { 16, 23 },
-        { 177, 16 },
-        { 232, 8 },
-        { 8, 141 }, },
-      { { 26, 243 },
-        { 183, 38 },
-        { 207, 88 },
-        { 100, 237 }, },
-      { { 25, 64 },
-        { 192, 36 },
-        { 2, 152 },
-        { 36, 3 }, },
-      { { 17, 2 },
-        { 193, 0 },
-        { 64, 136 },
-        { 0, 131 }, },
-      { { 17, 43 },
-        { 211, 1 },
-        { 212, 136 },
-        { 128, 203 }, },
-      { { 17, 207 },
-        { 209, 51 },
-        { 243, 136 },
-        { 204, 139 }, },
-      { { 27, 34 },
-        { 199, 4 },
-        { 68, 216 },
-        { 32, 227 }, },
-      { { 19, 46 },
-        { 199, 17 },
-        { 116, 200 },
-        { 136, 227 }, },
-      { { 17, 21 },
-        { 240, 16 },
-        { 168, 136 },
-        { 8, 15 }, },
-      { { 19, 187 },
-        { 247, 3 },
-        { 221, 200 },
-        { 192, 239 }, },
-      { { 12, 32 },
-        { 2, 68 },
-        { 4, 48 },
-        { 34, 64 }, },
-      { { 12, 201 },
-        { 16, 103 },
-        { 147, 48 },
-        { 230, 8 }, },
-      { { 12, 220 },
-        { 32, 119 },
-        { 59, 48 },
-        { 238, 4 }, },
-      { { 12, 54 },
-        { 35, 84 },
-        { 108, 48 },
-        { 42, 196 }, },
-      { { 6, 20 },
-        { 36, 80 },
-        { 40, 96 },
-        { 10, 36 }, },
-      { { 6, 114 },
-        { 39, 96 },
-        { 78, 96 },
-        { 6, 228 }, },
-      { { 13, 97 },
-        { 82, 100 },
-        { 134, 176 },
-        { 38, 74 }, },
-      { { 5, 13 },
-        { 80, 81 },
-        { 176, 160 },
-        { 138, 10 }, },
-      { { 13, 143 },
-        { 81, 87 },
-        { 241, 176 },
-        { 234, 138 }, },
-      { { 15, 224 },
-        { 70, 102 },
-        { 7, 240 },
-        { 102, 98 }, },
-      { { 15, 73 },
-        { 84, 101 },
-        { 146, 240 },
-        { 166, 42 }, },
-      { { 7, 133 },
-        { 84, 82 },
-        { 161, 224 },
-        { 74, 42 }, },
-      { { 5, 144 },
-        { 96, 66 },
-        { 9, 160 },
-        { 66, 6 }, },
-      { { 13, 51 },
-        { 115, 68 },
-        { 204, 176 },
-        { 34, 206 }, },
-      { { 15, 150 },
-        { 101, 86 },
-        { 105, 240 },
-        { 106, 166 }, },
-      { { 15, 118 },
-        { 103, 116 },
-        { 110, 240 },
-        { 46, 230 }, },
-      { { 20, 96 },
-        { 130, 96 },
-        { 6, 40 },
-        { 6, 65 }, },
-      { { 28, 141 },
-        { 144, 87 },
-        { 177, 56 },
-        { 234, 9 }, },
-      { { 20, 218 },
-        { 161, 99 },
-        { 91, 40 },
-        { 198, 133 }, },
-      { { 28, 115 },
-        { 179, 100 },
-        { 206, 56 },
-        { 38, 205 }, },
-      { { 30, 148 },
-        { 164, 86 },
-        { 41, 120 },
-        { 106, 37 }, },
-      { { 30, 186 },
-        { 167, 71 },
-        { 93, 120 },
-        { 226, 229 }, },
-      { { 22, 217 },
-        { 180, 99 },
-        { 155, 104 },
-        { 198, 45 }, },
-      { { 30, 61 },
-        { 182, 85 },
-        { 188, 120 },
-        { 170, 109 }, },
-      { { 22, 251 },
-        { 183, 99 },
-        { 223, 104 },
-        { 198, 237 }, },
-      { { 29, 233 },
-        { 210, 103 },
-        { 151, 184 },
-        { 230, 75 }, },
-      { { 29, 254 },
-        { 227, 119 },
-        { 127, 184 },
-        { 238, 199 }, },
-      { { 31, 159 },
-        { 245, 87 },
-        { 249, 248 },
-        { 234, 175 }, },
-      { { 40, 139 },
-        { 25, 7 },
-        { 209, 20 },
-        { 224, 152 }, },
-      { { 32, 175 },
-        { 27, 19 },
-        { 245, 4 },
-        { 200, 216 }, },
-      { { 34, 14 },
-        { 13, 17 },
-        { 112, 68 },
-        { 136, 176 }, },
-      { { 34, 169 },
-        { 30, 3 },
-        { 149, 68 },
-        { 192, 120 }, },
-      { { 42, 141 },
-        { 28, 23 },
-        { 177, 84 },
-        { 232, 56 }, },
-      { { 42, 163 },
-        { 31, 6 },
-        { 197, 84 },
-        { 96, 248 }, },
-      { { 42, 239 },
-        { 31, 55 },
-        { 247, 84 },
-        { 236, 248 }, },
-      { { 40, 144 },
-        { 40, 6 },
-        { 9, 20 },
-        { 96, 20 }, },
-      { { 40, 59 },
-        { 59, 5 },
-        { 220, 20 },
-        { 160, 220 }, },
-      { { 42, 88 },
-        { 44, 37 },
-        { 26, 84 },
-        { 164, 52 }, },
-      { { 34, 51 },
-        { 63, 0 },
-        { 204, 68 },
-        { 0, 252 }, },
-      { { 33, 160 },
-        { 74, 2 },
-        { 5, 132 },
-        { 64, 82 }, },
-      { { 33, 2 },
-        { 73, 0 },
-        { 64, 132 },
-        { 0, 146 }, },
-      { { 33, 165 },
-        { 90, 18 },
-        { 165, 132 },
-        { 72, 90 }, },
-      { { 33, 199 },
-        { 89, 50 },
-        { 227, 132 },
-        { 76, 154 }, },
-      { { 43, 3 },
-        { 93, 4 },
-        { 192, 212 },
-        { 32, 186 }, },
-      { { 35, 103 },
-        { 95, 48 },
-        { 230, 196 },
-        { 12, 250 }, },
-      { { 41, 48 },
-        { 106, 4 },
-        { 12, 148 },
-        { 32, 86 }, },
-      { { 41, 210 },
-        { 105, 38 },
-        { 75, 148 },
-        { 100, 150 }, },
-      { { 43, 25 },
-        { 124, 5 },
-        { 152, 212 },
-        { 160, 62 }, },
-      { { 43, 155 },
-        { 125, 7 },
-        { 217, 212 },
-        { 224, 190 }, },
-      { { 43, 151 },
-        { 125, 22 },
-        { 233, 212 },
-        { 104, 190 }, },
-      { { 56, 40 },
-        { 138, 5 },
-        { 20, 28 },
-        { 160, 81 }, },
-      { { 56, 165 },
-        { 154, 22 },
-        { 165, 28 },
-        { 104, 89 }, },
-      { { 58, 134 },
-        { 141, 22 },
-        { 97, 92 },
-        { 104, 177 }, },
-      { { 50, 1 },
-        { 156, 0 },
-        { 128, 76 },
-        { 0, 57 }, },
-      { { 56, 159 },
-        { 185, 23 },
-        { 249, 28 },
-        { 232, 157 }, },
-      { { 50, 210 },
-        { 173, 34 },
-        { 75, 76 },
-        { 68, 181 }, },
-      { { 58, 153 },
-        { 188, 7 },
-        { 153, 92 },
-        { 224, 61 }, },
-      { { 58, 213 },
-        { 188, 54 },
-        { 171, 92 },
-        { 108, 61 }, },
-      { { 57, 232 },
-        { 202, 39 },
-        { 23, 156 },
-        { 228, 83 }, },
-      { { 59, 193 },
-        { 220, 38 },
-        { 131, 220 },
-        { 100, 59 }, },
-      { { 51, 67 },
-        { 221, 32 },
-        { 194, 204 },
-        { 4, 187 }, },
-      { { 59, 231 },
-        { 223, 54 },
-        { 231, 220 },
-        { 108, 251 }, },
-      { { 49, 154 },
-        { 233, 3 },
-        { 89, 140 },
-        { 192, 151 }, },
-      { { 51, 144 },
-        { 236, 2 },
-        { 9, 204 },
-        { 64, 55 }, },
-      { { 59, 158 },
-        { 237, 23 },
-        { 121, 220 },
-        { 232, 183 }, },
-      { { 36, 196 },
-        { 8, 114 },
-        { 35, 36 },
-        { 78, 16 }, },
-      { { 44, 74 },
-        { 9, 101 },
-        { 82, 52 },
-        { 166, 144 }, },
-      { { 44, 173 },
-        { 26, 87 },
-        { 181, 52 },
-        { 234, 88 }, },
-      { { 44, 207 },
-        { 25, 119 },
-        { 243, 52 },
-        { 238, 152 }, },
-      { { 44, 103 },
-        { 27, 116 },
-        { 230, 52 },
-        { 46, 216 }, },
-      { { 38, 234 },
-        { 15, 99 },
-        { 87, 100 },
-        { 198, 240 }, },
-      { { 46, 229 },
-        { 30, 118 },
-        { 167, 116 },
-        { 110, 120 }, },
-      { { 44, 112 },
-        { 42, 100 },
-        { 14, 52 },
-        { 38, 84 }, },
-      { { 46, 18 },
-        { 45, 68 },
-        { 72, 116 },
-        { 34, 180 }, },
-      { { 46, 209 },
-        { 60, 102 },
-        { 139, 116 },
-        { 102, 60 }, },
-      { { 46, 57 },
-        { 62, 69 },
-        { 156, 116 },
-        { 162, 124 }, },
-      { { 37, 100 },
-        { 74, 112 },
-        { 38, 164 },
-        { 14, 82 }, },
-      { { 37, 231 },
-        { 91, 114 },
-        { 231, 164 },
-        { 78, 218 }, },
-      { { 47, 204 },
-        { 76, 119 },
-        { 51, 244 },
-        { 238, 50 }, },
-      { { 45, 188 },
-        { 106, 87 },
-        { 61, 180 },
-        { 234, 86 }, },
-      { { 45, 113 },
-        { 122, 100 },
-        { 142, 180 },
-        { 38, 94 }, },
-      { { 37, 213 },
-        { 120, 114 },
-        { 171, 164 },
-        { 78, 30 }, },
-      { { 37, 155 },
-        { 121, 67 },
-        { 217, 164 },
-        { 194, 158 }, },
-      { { 39, 16 },
-        { 108, 64 },
-        { 8, 228 },
-        { 2, 54 }, },
-      { { 47, 124 },
-        { 110, 117 },
-        { 62, 244 },
-        { 174, 118 }, },
-      { { 39, 242 },
-        { 111, 98 },
-        { 79, 228 },
-        { 70, 246 }, },
-      { { 39, 58 },
-        { 111, 65 },
-        { 92, 228 },
-        { 130, 246 }, },
-      { { 47, 182 },
-        { 111, 86 },
-        { 109, 244 },
-        { 106, 246 }, },
-      { { 39, 211 },
-        { 125, 98 },
-        { 203, 228 },
-        { 70, 190 }, },
-      { { 47, 179 },
-        { 127, 70 },
-        { 205, 244 },
-        { 98, 254 }, },
-      { { 39, 31 },
-        { 125, 81 },
-        { 248, 228 },
-        { 138, 190 }, },
-      { { 60, 75 },
-        { 153, 101 },
-        { 210, 60 },
-        { 166, 153 }, },
-      { { 54, 192 },
-        { 140, 98 },
-        { 3, 108 },
-        { 70, 49 }, },
-      { { 54, 238 },
-        { 143, 115 },
-        { 119, 108 },
-        { 206, 241 }, },
-      { { 62, 233 },
-        { 158, 103 },
-        { 151, 124 },
-        { 230, 121 }, },
-      { { 52, 184 },
-        { 170, 67 },
-        { 29, 44 },
-        { 194, 85 }, },
-      { { 60, 20 },
-        { 168, 84 },
-        { 40, 60 },
-        { 42, 21 }, },
-      { { 60, 82 },
-        { 169, 100 },
-        { 74, 60 },
-        { 38, 149 }, },
-      { { 52, 114 },
-        { 171, 96 },
-        { 78, 44 },
-        { 6, 213 }, },
-      { { 52, 126 },
-        { 171, 113 },
-        { 126, 44 },
-        { 142, 213 }, },
-      { { 52, 191 },
-        { 187, 83 },
-        { 253, 44 },
-        { 202, 221 }, },
-      { { 62, 113 },
-        { 190, 100 },
-        { 142, 124 },
-        { 38, 125 }, },
-      { { 62, 83 },
-        { 189, 100 },
-        { 202, 124 },
-        { 38, 189 }, },
-      { { 61, 140 },
-        { 200, 87 },
-        { 49, 188 },
-        { 234, 19 }, },
-      { { 53, 162 },
-        { 203, 66 },
-        { 69, 172 },
-        { 66, 211 }, },
-      { { 53, 46 },
-        { 203, 81 },
-        { 116, 172 },
-        { 138, 211 }, },
-      { { 53, 45 },
-        { 218, 81 },
-        { 180, 172 },
-        { 138, 91 }, },
-      { { 55, 172 },
-        { 206, 83 },
-        { 53, 236 },
-        { 202, 115 }, },
-      { { 53, 112 },
-        { 234, 96 },
-        { 14, 172 },
-        { 6, 87 }, },
-      { { 55, 250 },
-        { 239, 99 },
-        { 95, 236 },
-        { 198, 247 }, },
-      { { 63, 241 },
-        { 254, 102 },
-        { 143, 252 },
-        { 102, 127 }, },
-      { { 63, 219 },
-        { 253, 103 },
-        { 219, 252 },
-        { 230, 191 }, },
-      { { 72, 196 },
-        { 0, 182 },
-        { 35, 18 },
-        { 109, 0 }, },
-      { { 72, 233 },
-        { 18, 167 },
-        { 151, 18 },
-        { 229, 72 }, },
-      { { 74, 194 },
-        { 5, 166 },
-        { 67, 82 },
-        { 101, 160 }, },
-      { { 74, 65 },
-        { 20, 164 },
-        { 130, 82 },
-        { 37, 40 }, },
-      { { 66, 235 },
-        { 23, 163 },
-        { 215, 66 },
-        { 197, 232 }, },
-      { { 72, 19 },
-        { 49, 132 },
-        { 200, 18 },
-        { 33, 140 }, },
-      { { 74, 216 },
-        { 36, 167 },
-        { 27, 82 },
-        { 229, 36 }, },
-      { { 66, 253 },
-        { 54, 179 },
-        { 191, 66 },
-        { 205, 108 }, },
-      { { 74, 23 },
-        { 53, 148 },
-        { 232, 82 },
-        { 41, 172 }, },
-      { { 73, 99 },
-        { 83, 164 },
-        { 198, 146 },
-        { 37, 202 }, },
-      { { 67, 110 },
-        { 71, 177 },
-        { 118, 194 },
-        { 141, 226 }, },
-      { { 65, 58 },
-        { 99, 129 },
-        { 92, 130 },
-        { 129, 198 }, },
-      { { 73, 177 },
-        { 114, 134 },
-        { 141, 146 },
-        { 97, 78 }, },
-      { { 65, 61 },
-        { 114, 145 },
-        { 188, 130 },
-        { 137, 78 }, },
-      { { 75, 146 },
-        { 101, 134 },
-        { 73, 210 },
-        { 97, 166 }, },
-      { { 75, 155 },
-        { 117, 135 },
-        { 217, 210 },
-        { 225, 174 }, },
-      { { 67, 63 },
-        { 119, 145 },
-        { 252, 194 },
-        { 137, 238 }, },
-      { { 88, 34 },
-        { 131, 132 },
-        { 68, 26 },
-        { 33, 193 }, },
-      { { 80, 170 },
-        { 131, 131 },
-        { 85, 10 },
-        { 193, 193 }, },
-      { { 88, 39 },
-        { 147, 148 },
-        { 228, 26 },
-        { 41, 201 }, },
-      { { 82, 200 },
-        { 132, 163 },
-        { 19, 74 },
-        { 197, 33 }, },
-      { { 82, 132 },
-        { 132, 146 },
-        { 33, 74 },
-        { 73, 33 }, },
-      { { 82, 10 },
-        { 133, 129 },
-        { 80, 74 },
-        { 129, 161 }, },
-      { { 90, 15 },
-        { 149, 149 },
-        { 240, 90 },
-        { 169, 169 }, },
-      { { 88, 152 },
-        { 160, 135 },
-        { 25, 26 },
-        { 225, 5 }, },
-      { { 88, 92 },
-        { 160, 181 },
-        { 58, 26 },
-        { 173, 5 }, },
-      { { 80, 219 },
-        { 177, 163 },
-        { 219, 10 },
-        { 197, 141 }, },
-      { { 80, 247 },
-        { 179, 178 },
-        { 239, 10 },
-        { 77, 205 }, },
-      { { 90, 244 },
-        { 166, 182 },
-        { 47, 90 },
-        { 109, 101 }, },
-      { { 81, 236 },
-        { 194, 179 },
-        { 55, 138 },
-        { 205, 67 }, },
-      { { 81, 66 },
-        { 193, 160 },
-        { 66, 138 },
-        { 5, 131 }, },
-      { { 81, 13 },
-        { 208, 145 },
-        { 176, 138 },
-        { 137, 11 }, },
-      { { 91, 3 },
-        { 213, 132 },
-        { 192, 218 },
-        { 33, 171 }, },
-      { { 83, 235 },
-        { 215, 163 },
-        { 215, 202 },
-        { 197, 235 }, },
-      { { 81, 118 },
-        { 227, 176 },
-        { 110, 138 },
-        { 13, 199 }, },
-      { { 89, 113 },
-        { 242, 164 },
-        { 142, 154 },
-        { 37, 79 }, },
-      { { 81, 147 },
-        { 241, 130 },
-        { 201, 138 },
-        { 65, 143 }, },
-      { { 83, 249 },
-        { 246, 163 },
-        { 159, 202 },
-        { 197, 111 }, },
-      { { 91, 179 },
-        { 247, 134 },
-        { 205, 218 },
-        { 97, 239 }, },
-      { { 83, 151 },
-        { 245, 146 },
-        { 233, 202 },
-        { 73, 175 }, },
-      { { 76, 76 },
-        { 0, 245 },
-        { 50, 50 },
-        { 175, 0 }, },
-      { { 68, 75 },
-        { 17, 225 },
-        { 210, 34 },
-        { 135, 136 }, },
-      { { 76, 35 },
-        { 19, 196 },
-        { 196, 50 },
-        { 35, 200 }, },
-      { { 70, 140 },
-        { 4, 211 },
-        { 49, 98 },
-        { 203, 32 }, },
-      { { 78, 39 },
-        { 23, 212 },
-        { 228, 114 },
-        { 43, 232 }, },
-      { { 70, 144 },
-        { 36, 194 },
-        { 9, 98 },
-        { 67, 36 }, },
-      { { 78, 212 },
-        { 36, 246 },
-        { 43, 114 },
-        { 111, 36 }, },
-      { { 69, 206 },
-        { 65, 243 },
-        { 115, 162 },
-        { 207, 130 }, },
-      { { 69, 229 },
-        { 82, 242 },
-        { 167, 162 },
-        { 79, 74 }, },
-      { { 69, 39 },
-        { 83, 208 },
-        { 228, 162 },
-        { 11, 202 }, },
-      { { 79, 193 },
-        { 84, 230 },
-        { 131, 242 },
-        { 103, 42 }, },
-      { { 71, 5 },
-        { 84, 208 },
-        { 160, 226 },
-        { 11, 42 }, },
-      { { 69, 52 },
-        { 98, 208 },
-        { 44, 162 },
-        { 11, 70 }, },
-      { { 69, 114 },
-        { 99, 224 },
-        { 78, 162 },
-        { 7, 198 }, },
-      { { 92, 200 },
-        { 128, 231 },
-        { 19, 58 },
-        { 231, 1 }, },
-      { { 92, 14 },
-        { 129, 213 },
-        { 112, 58 },
-        { 171, 129 }, },
-      { { 84, 235 },
-        { 147, 227 },
-        { 215, 42 },
-        { 199, 201 }, },
-      { { 86, 137 },
-        { 148, 195 },
-        { 145, 106 },
-        { 195, 41 }, },
-      { { 86, 67 },
-        { 149, 224 },
-        { 194, 106 },
-        { 7, 169 }, },
-      { { 94, 231 },
-        { 151, 246 },
-        { 231, 122 },
-        { 111, 233 }, },
-      { { 92, 112 },
-        { 162, 228 },
-        { 14, 58 },
-        { 39, 69 }, },
-      { { 84, 178 },
-        { 163, 194 },
-        { 77, 42 },
-        { 67, 197 }, },
-      { { 94, 121 },
-        { 182, 229 },
-        { 158, 122 },
-        { 167, 109 }, },
-      { { 86, 243 },
-        { 183, 226 },
-        { 207, 106 },
-        { 71, 237 }, },
-      { { 93, 163 },
-        { 211, 198 },
-        { 197, 186 },
-        { 99, 203 }, },
-      { { 93, 242 },
-        { 227, 230 },
-        { 79, 186 },
-        { 103, 199 }, },
-      { { 85, 29 },
-        { 240, 209 },
-        { 184, 170 },
-        { 139, 15 }, },
-      { { 93, 157 },
-        { 240, 215 },
-        { 185, 186 },
-        { 235, 15 }, },
-      { { 87, 252 },
-        { 230, 243 },
-        { 63, 234 },
-        { 207, 103 }, },
-      { { 87, 210 },
-        { 229, 226 },
-        { 75, 234 },
-        { 71, 167 }, },
-      { { 95, 115 },
-        { 247, 228 },
-        { 206, 250 },
-        { 39, 239 }, },
-      { { 104, 45 },
-        { 26, 149 },
-        { 180, 22 },
-        { 169, 88 }, },
-      { { 104, 195 },
-        { 25, 166 },
-        { 195, 22 },
-        { 101, 152 }, },
-      { { 104, 135 },
-        { 25, 150 },
-        { 225, 22 },
-        { 105, 152 }, },
-      { { 106, 74 },
-        { 13, 165 },
-        { 82, 86 },
-        { 165, 176 }, },
-      { { 98, 105 },
-        { 30, 161 },
-        { 150, 70 },
-        { 133, 120 }, },
-      { { 96, 185 },
-        { 58, 131 },
-        { 157, 6 },
-        { 193, 92 }, },
-      { { 104, 255 },
-        { 59, 183 },
-        { 255, 22 },
-        { 237, 220 }, },
-      { { 106, 220 },
-        { 44, 183 },
-        { 59, 86 },
-        { 237, 52 }, },
-      { { 106, 218 },
-        { 45, 167 },
-        { 91, 86 },
-        { 229, 180 }, },
-      { { 106, 62 },
-        { 47, 149 },
-        { 124, 86 },
-        { 169, 244 }, },
-      { { 106, 81 },
-        { 60, 164 },
-        { 138, 86 },
-        { 37, 60 }, },
-      { { 106, 49 },
-        { 62, 132 },
-        { 140, 86 },
-        { 33, 124 }, },
-      { { 98, 215 },
-        { 61, 178 },
-        { 235, 70 },
-        { 77, 188 }, },
-      { { 97, 204 },
-        { 72, 179 },
-        { 51, 134 },
-        { 205, 18 }, },
-      { { 107, 130 },
-        { 77, 134 },
-        { 65, 214 },
-        { 97, 178 }, },
-      { { 107, 227 },
-        { 95, 166 },
-        { 199, 214 },
-        { 101, 250 }, },
-      { { 105, 58 },
-        { 107, 133 },
-        { 92, 150 },
-        { 161, 214 }, },
-      { { 97, 158 },
-        { 105, 147 },
-        { 121, 134 },
-        { 201, 150 }, },
-      { { 97, 149 },
-        { 120, 146 },
-        { 169, 134 },
-        { 73, 30 }, },
-      { { 97, 117 },
-        { 122, 176 },
-        { 174, 134 },
-        { 13, 94 }, },
-      { { 105, 95 },
-        { 121, 181 },
-        { 250, 150 },
-        { 173, 158 }, },
-      { { 105, 55 },
-        { 123, 148 },
-        { 236, 150 },
-        { 41, 222 }, },
-      { { 99, 218 },
-        { 109, 163 },
-        { 91, 198 },
-        { 197, 182 }, },
-      { { 112, 2 },
-        { 137, 128 },
-        { 64, 14 },
-        { 1, 145 }, },
-      { { 120, 99 },
-        { 155, 164 },
-        { 198, 30 },
-        { 37, 217 }, },
-      { { 112, 79 },
-        { 153, 177 },
-        { 242, 14 },
-        { 141, 153 }, },
-      { { 114, 202 },
-        { 141, 163 },
-        { 83, 78 },
-        { 197, 177 }, },
-      { { 122, 173 },
-        { 158, 151 },
-        { 181, 94 },
-        { 233, 121 }, },
-      { { 112, 123 },
-        { 187, 161 },
-        { 222, 14 },
-        { 133, 221 }, },
-      { { 122, 20 },
-        { 172, 148 },
-        { 40, 94 },
-        { 41, 53 }, },
-      { { 122, 249 },
-        { 190, 167 },
-        { 159, 94 },
-        { 229, 125 }, },
-      { { 122, 211 },
-        { 189, 166 },
-        { 203, 94 },
-        { 101, 189 }, },
-      { { 122, 187 },
-        { 191, 135 },
-        { 221, 94 },
-        { 225, 253 }, },
-      { { 121, 226 },
-        { 203, 166 },
-        { 71, 158 },
-        { 101, 211 }, },
-      { { 113, 41 },
-        { 218, 129 },
-        { 148, 142 },
-        { 129, 91 }, },
-      { { 123, 103 },
-        { 223, 180 },
-        { 230, 222 },
-        { 45, 251 }, },
-      { { 113, 208 },
-        { 232, 162 },
-        { 11, 142 },
-        { 69, 23 }, },
-      { { 121, 57 },
-        { 250, 133 },
-        { 156, 158 },
-        { 161, 95 }, },
-      { { 115, 48 },
-        { 238, 128 },
-        { 12, 206 },
-        { 1, 119 }, },
-      { { 115, 185 },
-        { 254, 131 },
-        { 157, 206 },
-        { 193, 127 }, },
-      { { 115, 83 },
-        { 253, 160 },
-        { 202, 206 },
-        { 5, 191 }, },
-      { { 115, 255 },
-        { 255, 179 },
-        { 255, 206 },
-        { 205, 255 }, },
-      { { 108, 136 },
-        { 8, 199 },
-        { 17, 54 },
-        { 227, 16 }, },
-      { { 100, 9 },
-        { 24, 193 },
-        { 144, 38 },
-        { 131, 24 }, },
-      { { 108, 67 },
-        { 25, 228 },
-        { 194, 54 },
-        { 39, 152 }, },
-      { { 102, 6 },
-        { 13, 208 },
-        { 96, 102 },
-        { 11, 176 }, },
-      { { 102, 131 },
-        { 29, 194 },
-        { 193, 102 },
-        { 67, 184 }, },
-      { { 100, 176 },
-        { 42, 194 },
-        { 13, 38 },
-        { 67, 84 }, },
-      { { 100, 218 },
-        { 41, 227 },
-        { 91, 38 },
-        { 199, 148 }, },
-      { { 110, 159 },
-        { 61, 215 },
-        { 249, 118 },
-        { 235, 188 }, },
-      { { 103, 200 },
-        { 76, 227 },
-        { 19, 230 },
-        { 199, 50 }, },
-      { { 111, 238 },
-        { 79, 247 },
-        { 119, 246 },
-        { 239, 242 }, },
-      { { 109, 59 },
-        { 123, 197 },
-        { 220, 182 },
-        { 163, 222 }, },
-      { { 111, 210 },
-        { 109, 230 },
-        { 75, 246 },
-        { 103, 182 }, },
-      { { 116, 128 },
-        { 136, 194 },
-        { 1, 46 },
-        { 67, 17 }, },
-      { { 124, 171 },
-        { 155, 199 },
-        { 213, 62 },
-        { 227, 217 }, },
-      { { 126, 104 },
-        { 142, 229 },
-        { 22, 126 },
-        { 167, 113 }, },
-      { { 126, 2 },
-        { 141, 196 },
-        { 64, 126 },
-        { 35, 177 }, },
-      { { 124, 156 },
-        { 168, 215 },
-        { 57, 62 },
-        { 235, 21 }, },
-      { { 116, 54 },
-        { 171, 208 },
-        { 108, 46 },
-        { 11, 213 }, },
-      { { 124, 17 },
-        { 184, 196 },
-        { 136, 62 },
-        { 35, 29 }, },
-      { { 126, 222 },
-        { 173, 247 },
-        { 123, 126 },
-        { 239, 181 }, },
-      { { 126, 182 },
-        { 175, 214 },
-        { 109, 126 },
-        { 107, 245 }, },
-      { { 118, 219 },
-        { 189, 227 },
-        { 219, 110 },
-        { 199, 189 }, },
-      { { 125, 196 },
-        { 200, 246 },
-        { 35, 190 },
-        { 111, 19 }, },
-      { { 125, 138 },
-        { 201, 199 },
-        { 81, 190 },
-        { 227, 147 }, },
-      { { 117, 109 },
-        { 218, 241 },
-        { 182, 174 },
-        { 143, 91 }, },
-      { { 119, 136 },
-        { 204, 195 },
-        { 17, 238 },
-        { 195, 51 }, },
-      { { 119, 32 },
-        { 206, 192 },
-        { 4, 238 },
-        { 3, 115 }, },
-      { { 119, 65 },
-        { 220, 224 },
-        { 130, 238 },
-        { 7, 59 }, },
-      { { 117, 56 },
-        { 234, 193 },
-        { 28, 174 },
-        { 131, 87 }, },
-      { { 117, 190 },
-        { 235, 211 },
-        { 125, 174 },
-        { 203, 215 }, },
-      { { 125, 155 },
-        { 249, 199 },
-        { 217, 190 },
-        { 227, 159 }, },
-      { { 119, 87 },
-        { 253, 240 },
-        { 234, 238 },
-        { 15, 191 }, },
-      { { 136, 40 },
-        { 2, 13 },
-        { 20, 17 },
-        { 176, 64 }, },
-      { { 128, 172 },
-        { 2, 27 },
-        { 53, 1 },
-        { 216, 64 }, },
-      { { 136, 13 },
-        { 16, 29 },
-        { 176, 17 },
-        { 184, 8 }, },
-      { { 136, 103 },
-        { 19, 60 },
-        { 230, 17 },
-        { 60, 200 }, },
-      { { 130, 78 },
-        { 5, 57 },
-        { 114, 65 },
-        { 156, 160 }, },
-      { { 138, 161 },
-        { 22, 14 },
-        { 133, 81 },
-        { 112, 104 }, },
-      { { 130, 43 },
-        { 23, 9 },
-        { 212, 65 },
-        { 144, 232 }, },
-      { { 128, 24 },
-        { 32, 9 },
-        { 24, 1 },
-        { 144, 4 }, },
-      { { 136, 249 },
-        { 50, 47 },
-        { 159, 17 },
-        { 244, 76 }, },
-      { { 128, 157 },
-        { 48, 27 },
-        { 185, 1 },
-        { 216, 12 }, },
-      { { 138, 156 },
-        { 36, 31 },
-        { 57, 81 },
-        { 248, 36 }, },
-      { { 130, 49 },
-        { 54, 8 },
-        { 140, 65 },
-        { 16, 108 }, },
-      { { 138, 117 },
-        { 54, 60 },
-        { 174, 81 },
-        { 60, 108 }, },
-      { { 130, 151 },
-        { 53, 26 },
-        { 233, 65 },
-        { 88, 172 }, },
-      { { 129, 9 },
-        { 80, 9 },
-        { 144, 129 },
-        { 144, 10 }, },
-      { { 129, 235 },
-        { 83, 43 },
-        { 215, 129 },
-        { 212, 202 }, },
-      { { 129, 7 },
-        { 81, 24 },
-        { 224, 129 },
-        { 24, 138 }, },
-      { { 139, 40 },
-        { 70, 13 },
-        { 20, 209 },
-        { 176, 98 }, },
-      { { 139, 172 },
-        { 70, 31 },
-        { 53, 209 },
-        { 248, 98 }, },
-      { { 131, 46 },
-        { 71, 25 },
-        { 116, 193 },
-        { 152, 226 }, },
-      { { 131, 229 },
-        { 86, 58 },
-        { 167, 193 },
-        { 92, 106 }, },
-      { { 129, 80 },
-        { 96, 40 },
-        { 10, 129 },
-        { 20, 6 }, },
-      { { 137, 50 },
-        { 99, 12 },
-        { 76, 145 },
-        { 48, 198 }, },
-      { { 139, 122 },
-        { 103, 45 },
-        { 94, 209 },
-        { 180, 230 }, },
-      { { 139, 150 },
-        { 101, 30 },
-        { 105, 209 },
-        { 120, 166 }, },
-      { { 131, 125 },
-        { 118, 57 },
-        { 190, 193 },
-        { 156, 110 }, },
-      { { 144, 135 },
-        { 145, 26 },
-        { 225, 9 },
-        { 88, 137 }, },
-      { { 154, 252 },
-        { 166, 63 },
-        { 63, 89 },
-        { 252, 101 }, },
-      { { 146, 245 },
-        { 182, 58 },
-        { 175, 73 },
-        { 92, 109 }, },
-      { { 145, 170 },
-        { 195, 11 },
-        { 85, 137 },
-        { 208, 195 }, },
-      { { 147, 65 },
-        { 212, 40 },
-        { 130, 201 },
-        { 20, 43 }, },
-      { { 147, 37 },
-        { 214, 24 },
-        { 164, 201 },
-        { 24, 107 }, },
-      { { 155, 235 },
-        { 215, 47 },
-        { 215, 217 },
-        { 244, 235 }, },
-      { { 153, 52 },
-        { 226, 28 },
-        { 44, 153 },
-        { 56, 71 }, },
-      { { 145, 247 },
-        { 243, 58 },
-        { 239, 137 },
-        { 92, 207 }, },
-      { { 155, 218 },
-        { 229, 47 },
-        { 91, 217 },
-        { 244, 167 }, },
-      { { 147, 86 },
-        { 229, 56 },
-        { 106, 201 },
-        { 28, 167 }, },
-      { { 132, 66 },
-        { 1, 104 },
-        { 66, 33 },
-        { 22, 128 }, },
-      { { 140, 129 },
-        { 16, 78 },
-        { 129, 49 },
-        { 114, 8 }, },
-      { { 140, 79 },
-        { 17, 125 },
-        { 242, 49 },
-        { 190, 136 }, },
-      { { 134, 72 },
-        { 4, 105 },
-        { 18, 97 },
-        { 150, 32 }, },
-      { { 134, 166 },
-        { 7, 90 },
-        { 101, 97 },
-        { 90, 224 }, },
-      { { 142, 3 },
-        { 21, 76 },
-        { 192, 113 },
-        { 50, 168 }, },
-      { { 134, 227 },
-        { 23, 106 },
-        { 199, 97 },
-        { 86, 232 }, },
-      { { 134, 111 },
-        { 23, 121 },
-        { 246, 97 },
-        { 158, 232 }, },
-      { { 142, 175 },
-        { 23, 95 },
-        { 245, 113 },
-        { 250, 232 }, },
-      { { 132, 94 },
-        { 33, 121 },
-        { 122, 33 },
-        { 158, 132 }, },
-      { { 132, 119 },
-        { 51, 120 },
-        { 238, 33 },
-        { 30, 204 }, },
-      { { 134, 250 },
-        { 39, 107 },
-        { 95, 97 },
-        { 214, 228 }, },
-      { { 142, 30 },
-        { 37, 93 },
-        { 120, 113 },
-        { 186, 164 }, },
-      { { 142, 55 },
-        { 55, 92 },
-        { 236, 113 },
-        { 58, 236 }, },
-      { { 135, 10 },
-        { 69, 73 },
-        { 80, 225 },
-        { 146, 162 }, },
-      { { 143, 138 },
-        { 69, 79 },
-        { 81, 241 },
-        { 242, 162 }, },
-      { { 143, 38 },
-        { 71, 92 },
-        { 100, 241 },
-        { 58, 226 }, },
-      { { 135, 33 },
-        { 86, 72 },
-        { 132, 225 },
-        { 18, 106 }, },
-      { { 135, 13 },
-        { 84, 89 },
-        { 176, 225 },
-        { 154, 42 }, },
-      { { 133, 114 },
-        { 99, 104 },
-        { 78, 161 },
-        { 22, 198 }, },
-      { { 135, 62 },
-        { 103, 89 },
-        { 124, 225 },
-        { 154, 230 }, },
-      { { 156, 67 },
-        { 145, 108 },
-        { 194, 57 },
-        { 54, 137 }, },
-      { { 158, 97 },
-        { 150, 108 },
-        { 134, 121 },
-        { 54, 105 }, },
-      { { 148, 88 },
-        { 160, 105 },
-        { 26, 41 },
-        { 150, 5 }, },
-      { { 148, 248 },
-        { 162, 107 },
-        { 31, 41 },
-        { 214, 69 }, },
-      { { 156, 50 },
-        { 163, 76 },
-        { 76, 57 },
-        { 50, 197 }, },
-      { { 148, 118 },
-        { 163, 120 },
-        { 110, 41 },
-        { 30, 197 }, },
-      { { 148, 177 },
-        { 178, 74 },
-        { 141, 41 },
-        { 82, 77 }, },
-      { { 148, 221 },
-        { 176, 123 },
-        { 187, 41 },
-        { 222, 13 }, },
-      { { 148, 155 },
-        { 177, 75 },
-        { 217, 41 },
-        { 210, 141 }, },
-      { { 156, 219 },
-        { 177, 111 },
-        { 219, 57 },
-        { 246, 141 }, },
-      { { 158, 156 },
-        { 164, 95 },
-        { 57, 121 },
-        { 250, 37 }, },
-      { { 158, 210 },
-        { 165, 110 },
-        { 75, 121 },
-        { 118, 165 }, },
-      { { 150, 25 },
-        { 180, 73 },
-        { 152, 105 },
-        { 146, 45 }, },
-      { { 158, 177 },
-        { 182, 78 },
-        { 141, 121 },
-        { 114, 109 }, },
-      { { 149, 105 },
-        { 210, 105 },
-        { 150, 169 },
-        { 150, 75 }, },
-      { { 159, 109 },
-        { 214, 125 },
-        { 182, 249 },
-        { 190, 107 }, },
-      { { 151, 43 },
-        { 215, 73 },
-        { 212, 233 },
-        { 146, 235 }, },
-      { { 149, 182 },
-        { 227, 90 },
-        { 109, 169 },
-        { 90, 199 }, },
-      { { 149, 185 },
-        { 242, 75 },
-        { 157, 169 },
-        { 210, 79 }, },
-      { { 157, 61 },
-        { 242, 93 },
-        { 188, 185 },
-        { 186, 79 }, },
-      { { 157, 87 },
-        { 241, 124 },
-        { 234, 185 },
-        { 62, 143 }, },
-      { { 168, 236 },
-        { 10, 63 },
-        { 55, 21 },
-        { 252, 80 }, },
-      { { 168, 37 },
-        { 26, 28 },
-        { 164, 21 },
-        { 56, 88 }, },
-      { { 162, 172 },
-        { 14, 27 },
-        { 53, 69 },
-        { 216, 112 }, },
-      { { 162, 2 },
-        { 13, 8 },
-        { 64, 69 },
-        { 16, 176 }, },
-      { { 170, 102 },
-        { 15, 60 },
-        { 102, 85 },
-        { 60, 240 }, },
-      { { 170, 143 },
-        { 29, 31 },
-        { 241, 85 },
-        { 248, 184 }, },
-      { { 170, 231 },
-        { 31, 62 },
-        { 231, 85 },
-        { 124, 248 }, },
-      { { 168, 48 },
-        { 42, 12 },
-        { 12, 21 },
-        { 48, 84 }, },
-      { { 168, 122 },
-        { 43, 45 },
-        { 94, 21 },
-        { 180, 212 }, },
-      { { 168, 246 },
-        { 43, 62 },
-        { 111, 21 },
-        { 124, 212 }, },
-      { { 168, 147 },
-        { 57, 14 },
-        { 201, 21 },
-        { 112, 156 }, },
-      { { 162, 20 },
-        { 44, 24 },
-        { 40, 69 },
-        { 24, 52 }, },
-      { { 170, 52 },
-        { 46, 28 },
-        { 44, 85 },
-        { 56, 116 }, },
-      { { 162, 114 },
-        { 47, 40 },
-        { 78, 69 },
-        { 20, 244 }, },
-      { { 170, 242 },
-        { 47, 46 },
-        { 79, 85 },
-        { 116, 244 }, },
-      { { 162, 241 },
-        { 62, 42 },
-        { 143, 69 },
-        { 84, 124 }, },
-      { { 161, 64 },
-        { 72, 40 },
-        { 2, 133 },
-        { 20, 18 }, },
-      { { 169, 10 },
-        { 73, 13 },
-        { 80, 149 },
-        { 176, 146 }, },
-      { { 161, 38 },
-        { 75, 24 },
-        { 100, 133 },
-        { 24, 210 }, },
-      { { 169, 197 },
-        { 88, 62 },
-        { 163, 149 },
-        { 124, 26 }, },
-      { { 169, 207 },
-        { 89, 63 },
-        { 243, 149 },
-        { 252, 154 }, },
-      { { 161, 52 },
-        { 106, 24 },
-        { 44, 133 },
-        { 24, 86 }, },
-      { { 169, 18 },
-        { 105, 12 },
-        { 72, 149 },
-        { 48, 150 }, },
-      { { 161, 250 },
-        { 107, 43 },
-        { 95, 133 },
-        { 212, 214 }, },
-      { { 171, 152 },
-        { 108, 15 },
-        { 25, 213 },
-        { 240, 54 }, },
-      { { 163, 247 },
-        { 127, 58 },
-        { 239, 197 },
-        { 92, 254 }, },
-      { { 176, 6 },
-        { 137, 24 },
-        { 96, 13 },
-        { 24, 145 }, },
-      { { 176, 69 },
-        { 152, 56 },
-        { 162, 13 },
-        { 28, 25 }, },
-      { { 184, 141 },
-        { 152, 31 },
-        { 177, 29 },
-        { 248, 25 }, },
-      { { 178, 132 },
-        { 140, 26 },
-        { 33, 77 },
-        { 88, 49 }, },
-      { { 184, 240 },
-        { 170, 46 },
-        { 15, 29 },
-        { 116, 85 }, },
-      { { 184, 85 },
-        { 184, 60 },
-        { 170, 29 },
-        { 60, 29 }, },
-      { { 178, 118 },
-        { 175, 56 },
-        { 110, 77 },
-        { 28, 245 }, },
-      { { 186, 145 },
-        { 188, 14 },
-        { 137, 93 },
-        { 112, 61 }, },
-      { { 178, 113 },
-        { 190, 40 },
-        { 142, 77 },
-        { 20, 125 }, },
-      { { 185, 192 },
-        { 200, 46 },
-        { 3, 157 },
-        { 116, 19 }, },
-      { { 185, 66 },
-        { 201, 44 },
-        { 66, 157 },
-        { 52, 147 }, },
-      { { 185, 42 },
-        { 203, 13 },
-        { 84, 157 },
-        { 176, 211 }, },
-      { { 179, 140 },
-        { 204, 27 },
-        { 49, 205 },
-        { 216, 51 }, },
-      { { 179, 202 },
-        { 205, 43 },
-        { 83, 205 },
-        { 212, 179 }, },
-      { { 187, 102 },
-        { 207, 60 },
-        { 102, 221 },
-        { 60, 243 }, },
-      { { 179, 15 },
-        { 221, 25 },
-        { 240, 205 },
-        { 152, 187 }, },
-      { { 177, 218 },
-        { 233, 43 },
-        { 91, 141 },
-        { 212, 151 }, },
-      { { 187, 20 },
-        { 236, 28 },
-        { 40, 221 },
-        { 56, 55 }, },
-      { { 187, 246 },
-        { 239, 62 },
-        { 111, 221 },
-        { 124, 247 }, },
-      { { 179, 19 },
-        { 253, 8 },
-        { 200, 205 },
-        { 16, 191 }, },
-      { { 164, 104 },
-        { 10, 105 },
-        { 22, 37 },
-        { 150, 80 }, },
-      { { 172, 44 },
-        { 10, 93 },
-        { 52, 53 },
-        { 186, 80 }, },
-      { { 172, 161 },
-        { 26, 78 },
-        { 133, 53 },
-        { 114, 88 }, },
-      { { 172, 235 },
-        { 27, 111 },
-        { 215, 53 },
-        { 246, 216 }, },
-      { { 172, 199 },
-        { 25, 126 },
-        { 227, 53 },
-        { 126, 152 }, },
-      { { 164, 103 },
-        { 27, 120 },
-        { 230, 37 },
-        { 30, 216 }, },
-      { { 166, 192 },
-        { 12, 106 },
-        { 3, 101 },
-        { 86, 48 }, },
-      { { 174, 224 },
-        { 14, 110 },
-        { 7, 117 },
-        { 118, 112 }, },
-      { { 166, 35 },
-        { 31, 72 },
-        { 196, 101 },
-        { 18, 248 }, },
-      { { 173, 232 },
-        { 74, 111 },
-        { 23, 181 },
-        { 246, 82 }, },
-      { { 165, 204 },
-        { 72, 123 },
-        { 51, 165 },
-        { 222, 18 }, },
-      { { 167, 236 },
-        { 78, 123 },
-        { 55, 229 },
-        { 222, 114 }, },
-      { { 173, 124 },
-        { 106, 125 },
-        { 62, 181 },
-        { 190, 86 }, },
-      { { 165, 26 },
-        { 105, 73 },
-        { 88, 165 },
-        { 146, 150 }, },
-      { { 165, 145 },
-        { 120, 74 },
-        { 137, 165 },
-        { 82, 30 }, },
-      { { 173, 25 },
-        { 120, 77 },
-        { 152, 181 },
-        { 178, 30 }, },
-      { { 165, 151 },
-        { 121, 90 },
-        { 233, 165 },
-        { 90, 158 }, },
-      { { 180, 109 },
-        { 154, 121 },
-        { 182, 45 },
-        { 158, 89 }, },
-      { { 190, 203 },
-        { 157, 111 },
-        { 211, 125 },
-        { 246, 185 }, },
-      { { 188, 58 },
-        { 171, 77 },
-        { 92, 61 },
-        { 178, 213 }, },
-      { { 188, 245 },
-        { 186, 126 },
-        { 175, 61 },
-        { 126, 93 }, },
-      { { 190, 189 },
-        { 190, 95 },
-        { 189, 125 },
-        { 250, 125 }, },
-      { { 190, 243 },
-        { 191, 110 },
-        { 207, 125 },
-        { 118, 253 }, },
-      { { 181, 37 },
-        { 218, 88 },
-        { 164, 173 },
-        { 26, 91 }, },
-      { { 181, 143 },
-        { 217, 91 },
-        { 241, 173 },
-        { 218, 155 }, },
-      { { 183, 104 },
-        { 206, 105 },
-        { 22, 237 },
-        { 150, 115 }, },
-      { { 191, 228 },
-        { 206, 126 },
-        { 39, 253 },
-        { 126, 115 }, },
-      { { 189, 254 },
-        { 235, 127 },
-        { 127, 189 },
-        { 254, 215 }, },
-      { { 189, 157 },
-        { 248, 95 },
-        { 185, 189 },
-        { 250, 31 }, },
-      { { 181, 245 },
-        { 250, 122 },
-        { 175, 173 },
-        { 94, 95 }, },
-      { { 181, 243 },
-        { 251, 106 },
-        { 207, 173 },
-        { 86, 223 }, },
-      { { 191, 176 },
-        { 238, 78 },
-        { 13, 253 },
-        { 114, 119 }, },
-      { { 183, 90 },
-        { 237, 105 },
-        { 90, 237 },
-        { 150, 183 }, },
-      { { 191, 62 },
-        { 239, 93 },
-        { 124, 253 },
-        { 186, 247 }, },
-      { { 183, 57 },
-        { 254, 73 },
-        { 156, 237 },
-        { 146, 127 }, },
-      { { 191, 213 },
-        { 252, 126 },
-        { 171, 253 },
-        { 126, 63 }, },
-      { { 183, 29 },
-        { 252, 89 },
-        { 184, 237 },
-        { 154, 63 }, },
-      { { 191, 53 },
-        { 254, 92 },
-        { 172, 253 },
-        { 58, 127 }, },
-      { { 183, 127 },
-        { 255, 121 },
-        { 254, 237 },
-        { 158, 255 }, },
-      { { 200, 1 },
-        { 16, 140 },
-        { 128, 19 },
-        { 49, 8 }, },
-      { { 192, 165 },
-        { 18, 154 },
-        { 165, 3 },
-        { 89, 72 }, },
-      { { 194, 130 },
-        { 5, 138 },
-        { 65, 67 },
-        { 81, 160 }, },
-      { { 200, 189 },
-        { 50, 159 },
-        { 189, 19 },
-        { 249, 76 }, },
-      { { 194, 252 },
-        { 38, 187 },
-        { 63, 67 },
-        { 221, 100 }, },
-      { { 202, 145 },
-        { 52, 142 },
-        { 137, 83 },
-        { 113, 44 }, },
-      { { 194, 91 },
-        { 53, 169 },
-        { 218, 67 },
-        { 149, 172 }, },
-      { { 201, 68 },
-        { 64, 188 },
-        { 34, 147 },
-        { 61, 2 }, },
-      { { 193, 42 },
-        { 67, 137 },
-        { 84, 131 },
-        { 145, 194 }, },
-      { { 195, 192 },
-        { 68, 170 },
-        { 3, 195 },
-        { 85, 34 }, },
-      { { 201, 122 },
-        { 99, 173 },
-        { 94, 147 },
-        { 181, 198 }, },
-      { { 193, 185 },
-        { 114, 139 },
-        { 157, 131 },
-        { 209, 78 }, },
-      { { 201, 117 },
-        { 114, 188 },
-        { 174, 147 },
-        { 61, 78 }, },
-      { { 193, 247 },
-        { 115, 186 },
-        { 239, 131 },
-        { 93, 206 }, },
-      { { 203, 177 },
-        { 118, 142 },
-        { 141, 211 },
-        { 113, 110 }, },
-      { { 208, 108 },
-        { 130, 185 },
-        { 54, 11 },
-        { 157, 65 }, },
-      { { 216, 135 },
-        { 145, 158 },
-        { 225, 27 },
-        { 121, 137 }, },
-      { { 208, 175 },
-        { 147, 155 },
-        { 245, 11 },
-        { 217, 201 }, },
-      { { 218, 196 },
-        { 132, 190 },
-        { 35, 91 },
-        { 125, 33 }, },
-      { { 210, 12 },
-        { 132, 153 },
-        { 48, 75 },
-        { 153, 33 }, },
-      { { 218, 9 },
-        { 148, 141 },
-        { 144, 91 },
-        { 177, 41 }, },
-      { { 208, 48 },
-        { 162, 136 },
-        { 12, 11 },
-        { 17, 69 }, },
-      { { 216, 148 },
-        { 160, 158 },
-        { 41, 27 },
-        { 121, 5 }, },
-      { { 208, 58 },
-        { 163, 137 },
-        { 92, 11 },
-        { 145, 197 }, },
-      { { 208, 182 },
-        { 163, 154 },
-        { 109, 11 },
-        { 89, 197 }, },
-      { { 208, 117 },
-        { 178, 184 },
-        { 174, 11 },
-        { 29, 77 }, },
-      { { 210, 118 },
-        { 167, 184 },
-        { 110, 75 },
-        { 29, 229 }, },
-      { { 218, 93 },
-        { 180, 189 },
-        { 186, 91 },
-        { 189, 45 }, },
-      { { 218, 53 },
-        { 182, 156 },
-        { 172, 91 },
-        { 57, 109 }, },
-      { { 210, 23 },
-        { 181, 152 },
-        { 232, 75 },
-        { 25, 173 }, },
-      { { 217, 2 },
-        { 193, 140 },
-        { 64, 155 },
-        { 49, 131 }, },
-      { { 211, 232 },
-        { 198, 171 },
-        { 23, 203 },
-        { 213, 99 }, },
-      { { 211, 229 },
-        { 214, 186 },
-        { 167, 203 },
-        { 93, 107 }, },
-      { { 209, 154 },
-        { 225, 139 },
-        { 89, 139 },
-        { 209, 135 }, },
-      { { 209, 246 },
-        { 227, 186 },
-        { 111, 139 },
-        { 93, 199 }, },
-      { { 209, 81 },
-        { 240, 168 },
-        { 138, 139 },
-        { 21, 15 }, },
-      { { 219, 20 },
-        { 228, 156 },
-        { 40, 219 },
-        { 57, 39 }, },
-      { { 211, 62 },
-        { 231, 153 },
-        { 124, 203 },
-        { 153, 231 }, },
-      { { 211, 211 },
-        { 245, 170 },
-        { 203, 203 },
-        { 85, 175 }, },
-      { { 196, 96 },
-        { 2, 232 },
-        { 6, 35 },
-        { 23, 64 }, },
-      { { 204, 167 },
-        { 19, 222 },
-        { 229, 51 },
-        { 123, 200 }, },
-      { { 198, 66 },
-        { 5, 232 },
-        { 66, 99 },
-        { 23, 160 }, },
-      { { 198, 71 },
-        { 21, 248 },
-        { 226, 99 },
-        { 31, 168 }, },
-      { { 206, 231 },
-        { 23, 254 },
-        { 231, 115 },
-        { 127, 232 }, },
-      { { 196, 92 },
-        { 32, 249 },
-        { 58, 35 },
-        { 159, 4 }, },
-      { { 204, 29 },
-        { 48, 221 },
-        { 184, 51 },
-        { 187, 12 }, },
-      { { 204, 53 },
-        { 50, 220 },
-        { 172, 51 },
-        { 59, 76 }, },
-      { { 198, 188 },
-        { 38, 219 },
-        { 61, 99 },
-        { 219, 100 }, },
-      { { 205, 168 },
-        { 66, 207 },
-        { 21, 179 },
-        { 243, 66 }, },
-      { { 197, 12 },
-        { 64, 217 },
-        { 48, 163 },
-        { 155, 2 }, },
-      { { 197, 228 },
-        { 66, 250 },
-        { 39, 163 },
-        { 95, 66 }, },
-      { { 197, 194 },
-        { 65, 234 },
-        { 67, 163 },
-        { 87, 130 }, },
-      { { 205, 45 },
-        { 82, 221 },
-        { 180, 179 },
-        { 187, 74 }, },
-      { { 205, 89 },
-        { 112, 237 },
-        { 154, 179 },
-        { 183, 14 }, },
-      { { 205, 149 },
-        { 112, 222 },
-        { 169, 179 },
-        { 123, 14 }, },
-      { { 197, 147 },
-        { 113, 202 },
-        { 201, 163 },
-        { 83, 142 }, },
-      { { 199, 95 },
-        { 117, 249 },
-        { 250, 227 },
-        { 159, 174 }, },
-      { { 212, 197 },
-        { 144, 250 },
-        { 163, 43 },
-        { 95, 9 }, },
-      { { 222, 136 },
-        { 132, 207 },
-        { 17, 123 },
-        { 243, 33 }, },
-      { { 214, 36 },
-        { 134, 216 },
-        { 36, 107 },
-        { 27, 97 }, },
-      { { 222, 236 },
-        { 134, 255 },
-        { 55, 123 },
-        { 255, 97 }, },
-      { { 214, 226 },
-        { 135, 234 },
-        { 71, 107 },
-        { 87, 225 }, },
-      { { 222, 198 },
-        { 133, 254 },
-        { 99, 123 },
-        { 127, 161 }, },
-      { { 222, 35 },
-        { 151, 204 },
-        { 196, 123 },
-        { 51, 233 }, },
-      { { 220, 220 },
-        { 160, 255 },
-        { 59, 59 },
-        { 255, 5 }, },
-      { { 220, 26 },
-        { 161, 205 },
-        { 88, 59 },
-        { 179, 133 }, },
-      { { 212, 17 },
-        { 176, 200 },
-        { 136, 43 },
-        { 19, 13 }, },
-      { { 222, 84 },
-        { 164, 252 },
-        { 42, 123 },
-        { 63, 37 }, },
-      { { 214, 148 },
-        { 164, 218 },
-        { 41, 107 },
-        { 91, 37 }, },
-      { { 222, 157 },
-        { 180, 223 },
-        { 185, 123 },
-        { 251, 45 }, },
-      { { 221, 129 },
-        { 208, 206 },
-        { 129, 187 },
-        { 115, 11 }, },
-      { { 213, 165 },
-        { 210, 218 },
-        { 165, 171 },
-        { 91, 75 }, },
-      { { 215, 172 },
-        { 198, 219 },
-        { 53, 235 },
-        { 219, 99 }, },
-      { { 215, 102 },
-        { 199, 248 },
-        { 102, 235 },
-        { 31, 227 }, },
-      { { 223, 169 },
-        { 214, 207 },
-        { 149, 251 },
-        { 243, 107 }, },
-      { { 213, 220 },
-        { 224, 251 },
-        { 59, 171 },
-        { 223, 7 }, },
-      { { 221, 31 },
-        { 241, 221 },
-        { 248, 187 },
-        { 187, 143 }, },
-      { { 223, 240 },
-        { 230, 238 },
-        { 15, 251 },
-        { 119, 103 }, },
-      { { 226, 72 },
-        { 12, 169 },
-        { 18, 71 },
-        { 149, 48 }, },
-      { { 226, 232 },
-        { 14, 171 },
-        { 23, 71 },
-        { 213, 112 }, },
-      { { 226, 7 },
-        { 29, 152 },
-        { 224, 71 },
-        { 25, 184 }, },
-      { { 224, 93 },
-        { 56, 185 },
-        { 186, 7 },
-        { 157, 28 }, },
-      { { 234, 245 },
-        { 62, 190 },
-        { 175, 87 },
-        { 125, 124 }, },
-      { { 235, 38 },
-        { 79, 156 },
-        { 100, 215 },
-        { 57, 242 }, },
-      { { 235, 237 },
-        { 94, 191 },
-        { 183, 215 },
-        { 253, 122 }, },
-      { { 225, 82 },
-        { 105, 168 },
-        { 74, 135 },
-        { 21, 150 }, },
-      { { 225, 126 },
-        { 107, 185 },
-        { 126, 135 },
-        { 157, 214 }, },
-      { { 233, 219 },
-        { 121, 175 },
-        { 219, 151 },
-        { 245, 158 }, },
-      { { 248, 6 },
-        { 137, 156 },
-        { 96, 31 },
-        { 57, 145 }, },
-      { { 240, 238 },
-        { 139, 187 },
-        { 119, 15 },
-        { 221, 209 }, },
-      { { 248, 161 },
-        { 154, 142 },
-        { 133, 31 },
-        { 113, 89 }, },
-      { { 250, 0 },
-        { 140, 140 },
-        { 0, 95 },
-        { 49, 49 }, },
-      { { 250, 194 },
-        { 141, 174 },
-        { 67, 95 },
-        { 117, 177 }, },
-      { { 240, 155 },
-        { 185, 139 },
-        { 217, 15 },
-        { 209, 157 }, },
-      { { 250, 244 },
-        { 174, 190 },
-        { 47, 95 },
-        { 125, 117 }, },
-      { { 250, 60 },
-        { 174, 157 },
-        { 60, 95 },
-        { 185, 117 }, },
-      { { 242, 252 },
-        { 174, 187 },
-        { 63, 79 },
-        { 221, 117 }, },
-      { { 242, 189 },
-        { 190, 155 },
-        { 189, 79 },
-        { 217, 125 }, },
-      { { 242, 147 },
-        { 189, 138 },
-        { 201, 79 },
-        { 81, 189 }, },
-      { { 241, 96 },
-        { 202, 168 },
-        { 6, 143 },
-        { 21, 83 }, },
-      { { 249, 236 },
-        { 202, 191 },
-        { 55, 159 },
-        { 253, 83 }, },
-      { { 241, 70 },
-        { 201, 184 },
-        { 98, 143 },
-        { 29, 147 }, },
-      { { 249, 225 },
-        { 218, 174 },
-        { 135, 159 },
-        { 117, 91 }, },
-      { { 243, 72 },
-        { 204, 169 },
-        { 18, 207 },
-        { 149, 51 }, },
-      { { 243, 174 },
-        { 207, 155 },
-        { 117, 207 },
-        { 217, 243 }, },
-      { { 243, 193 },
-        { 220, 170 },
-        { 131, 207 },
-        { 85, 59 }, },
-      { { 243, 139 },
-        { 221, 139 },
-        { 209, 207 },
-        { 209, 187 }, },
-      { { 243, 167 },
-        { 223, 154 },
-        { 229, 207 },
-        { 89, 251 }, },
-      { { 241, 115 },
-        { 251, 168 },
-        { 206, 143 },
-        { 21, 223 }, },
-      { { 241, 151 },
-        { 249, 154 },
-        { 233, 143 },
-        { 89, 159 }, },
-      { { 243, 244 },
-        { 238, 186 },
-        { 47, 207 },
-        { 93, 119 }, },
-      { { 251, 50 },
-        { 239, 140 },
-        { 76, 223 },
-        { 49, 247 }, },
-      { { 228, 7 },
-        { 25, 216 },
-        { 224, 39 },
-        { 27, 152 }, },
-      { { 230, 77 },
-        { 28, 249 },
-        { 178, 103 },
-        { 159, 56 }, },
-      { { 236, 85 },
-        { 56, 252 },
-        { 170, 55 },
-        { 63, 28 }, },
-      { { 237, 192 },
-        { 72, 238 },
-        { 3, 183 },
-        { 119, 18 }, },
-      { { 237, 133 },
-        { 88, 222 },
-        { 161, 183 },
-        { 123, 26 }, },
-      { { 239, 162 },
-        { 79, 206 },
-        { 69, 247 },
-        { 115, 242 }, },
-      { { 231, 78 },
-        { 77, 249 },
-        { 114, 231 },
-        { 159, 178 }, },
-      { { 229, 213 },
-        { 120, 250 },
-        { 171, 167 },
-        { 95, 30 }, },
-      { { 239, 80 },
-        { 108, 236 },
-        { 10, 247 },
-        { 55, 54 }, },
-      { { 244, 34 },
-        { 139, 200 },
-        { 68, 47 },
-        { 19, 209 }, },
-      { { 244, 137 },
-        { 152, 203 },
-        { 145, 47 },
-        { 211, 25 }, },
-      { { 244, 41 },
-        { 154, 201 },
-        { 148, 47 },
-        { 147, 89 }, },
-      { { 246, 106 },
-        { 143, 233 },
-        { 86, 111 },
-        { 151, 241 }, },
-      { { 254, 11 },
-        { 157, 205 },
-        { 208, 127 },
-        { 179, 185 }, },
-      { { 254, 111 },
-        { 159, 253 },
-        { 246, 127 },
-        { 191, 249 }, },
-      { { 244, 149 },
-        { 184, 218 },
-        { 169, 47 },
-        { 91, 29 }, },
-      { { 244, 53 },
-        { 186, 216 },
-        { 172, 47 },
-        { 27, 93 }, },
-      { { 244, 31 },
-        { 185, 217 },
-        { 248, 47 },
-        { 155, 157 }, },
-      { { 246, 176 },
-        { 174, 202 },
-        { 13, 111 },
-        { 83, 117 }, },
-      { { 245, 232 },
-        { 202, 235 },
-        { 23, 175 },
-        { 215, 83 }, },
-      { { 245, 197 },
-        { 216, 250 },
-        { 163, 175 },
-        { 95, 27 }, },
-      { { 253, 35 },
-        { 219, 204 },
-        { 196, 191 },
-        { 51, 219 }, },
-      { { 255, 192 },
-        { 204, 238 },
-        { 3, 255 },
-        { 119, 51 }, },
-      { { 247, 204 },
-        { 204, 251 },
-        { 51, 239 },
-        { 223, 51 }, },
-      { { 247, 233 },
-        { 222, 235 },
-        { 151, 239 },
-        { 215, 123 }, },
-      { { 245, 188 },
-        { 234, 219 },
-        { 61, 175 },
-        { 219, 87 }, },
-      { { 253, 246 },
-        { 235, 254 },
-        { 111, 191 },
-        { 127, 215 }, },
-      { { 245, 217 },
-        { 248, 235 },
-        { 155, 175 },
-        { 215, 31 }, },
-      { { 253, 151 },
-        { 249, 222 },
-        { 233, 191 },
-        { 123, 159 }, },
-      { { 253, 63 },
-        { 251, 221 },
-        { 252, 191 },
-        { 187, 223 }, },
-      { { 255, 156 },
-        { 236, 223 },
-        { 57, 255 },
-        { 251, 55 }, },
-      { { 255, 90 },
-        { 237, 237 },
-        { 90, 255 },
-        { 183, 183 }, },
-      { { 247, 254 },
-        { 239, 251 },
-        { 127, 239 },
-        { 223, 247 }, },
-      { { 255, 17 },
-        { 252, 204 },
-        { 136, 255 },
-        { 51, 63 }, },
-      { { 247, 191 },
-        { 255, 219 },
-        { 253, 239 },
-        { 219, 255 }, }, };
+static constexpr uint64 DICT_5X5_1000_CODES[][4] = {
+    { 0x145b2bcULL, 0x0a45db3ULL, 0x07a9b45ULL, 0x19b744aULL },
+    { 0x01c06e6ULL, 0x1618d0aULL, 0x0cec070ULL, 0x0a1630dULL },
+    { 0x1af0eddULL, 0x05f2f3bULL, 0x176e1ebULL, 0x1b9e9f4ULL },
+    { 0x10395f7ULL, 0x0f5bc51ULL, 0x1df5381ULL, 0x1147b5eULL },
+    { 0x1aeb524ULL, 0x0e837d8ULL, 0x0495aebULL, 0x037d82eULL },
+    { 0x1d4082dULL, 0x1324730ULL, 0x1682057ULL, 0x019c499ULL },
+    { 0x0d3d7ecULL, 0x1e57e66ULL, 0x06fd796ULL, 0x0ccfd4fULL },
+    { 0x0e2146bULL, 0x079f220ULL, 0x1ac508eULL, 0x0089f3cULL },
+    { 0x10d6132ULL, 0x02481ddULL, 0x0990d61ULL, 0x1770248ULL },
+    { 0x1313fa5ULL, 0x17e1cd2ULL, 0x14bf919ULL, 0x09670fdULL },
+    { 0x13cee03ULL, 0x1da819eULL, 0x180ee79ULL, 0x0f302b7ULL },
+    { 0x1a2dac0ULL, 0x08b3a16ULL, 0x006b68bULL, 0x0d0b9a2ULL },
+    { 0x1e62b11ULL, 0x01a63d3ULL, 0x111a8cfULL, 0x1978cb0ULL },
+    { 0x05e7166ULL, 0x121f5ccULL, 0x0cd1cf4ULL, 0x0675f09ULL },
+    { 0x1fcfca8ULL, 0x1ea5bbcULL, 0x02a7e7fULL, 0x07bb4afULL },
+    { 0x051e37fULL, 0x1b5c4e7ULL, 0x1fd8f14ULL, 0x1ce475bULL },
+    { 0x097a758ULL, 0x1c523e3ULL, 0x035cbd2ULL, 0x18f8947ULL },
+    { 0x0bea26fULL, 0x1b9a7aaULL, 0x1ec8afaULL, 0x0abcb3bULL },
+    { 0x0f64dc4ULL, 0x14b6f44ULL, 0x04764deULL, 0x045eda5ULL },
+    { 0x1061de8ULL, 0x0633970ULL, 0x02f70c1ULL, 0x01d398cULL },
+    { 0x12dda75ULL, 0x0bf151fULL, 0x15cb769ULL, 0x1f151faULL },
+    { 0x150e440ULL, 0x1c14094ULL, 0x0044e15ULL, 0x0520507ULL },
+    { 0x16b0ca1ULL, 0x07e6818ULL, 0x10a61adULL, 0x0302cfcULL },
+    { 0x0ba12deULL, 0x109be2bULL, 0x0f690baULL, 0x1a8fb21ULL },
+    { 0x19cd023ULL, 0x1b0931cULL, 0x1881673ULL, 0x071921bULL },
+    { 0x1a59972ULL, 0x0af9351ULL, 0x09d334bULL, 0x11593eaULL },
+    { 0x1c3ce8bULL, 0x0d6ea36ULL, 0x1a2e787ULL, 0x0d8aed6ULL },
+    { 0x0224246ULL, 0x009a406ULL, 0x0c48488ULL, 0x0c04b20ULL },
+    { 0x03b9672ULL, 0x1edb00bULL, 0x09cd3b8ULL, 0x1a01b6fULL },
+    { 0x024223bULL, 0x03881a3ULL, 0x1b88848ULL, 0x18b0238ULL },
+    { 0x027376eULL, 0x06db5e2ULL, 0x0edd9c8ULL, 0x08f5b6cULL },
+    { 0x0368873ULL, 0x1bba101ULL, 0x19c22d8ULL, 0x1010bbbULL },
+    { 0x040d0ceULL, 0x081dc24ULL, 0x0e61604ULL, 0x0487702ULL },
+    { 0x04aaac8ULL, 0x08368aaULL, 0x026aaa4ULL, 0x0aa2d82ULL },
+    { 0x04643baULL, 0x020e967ULL, 0x0bb84c4ULL, 0x1cd2e08ULL },
+    { 0x07a6feaULL, 0x16be8eeULL, 0x0afecbcULL, 0x0ee2fadULL },
+    { 0x0998aacULL, 0x1a60e2aULL, 0x06aa332ULL, 0x0a8e0cbULL },
+    { 0x082d101ULL, 0x0903244ULL, 0x1011682ULL, 0x0449812ULL },
+    { 0x09aad1dULL, 0x1d226e9ULL, 0x1716ab2ULL, 0x12ec897ULL },
+    { 0x0863c72ULL, 0x063b381ULL, 0x09c78c2ULL, 0x1039b8cULL },
+    { 0x0ad2825ULL, 0x03e0788ULL, 0x148296aULL, 0x023c0f8ULL },
+    { 0x0a52f9eULL, 0x04e8fe3ULL, 0x0f3e94aULL, 0x18fe2e4ULL },
+    { 0x0d849f7ULL, 0x133ce4dULL, 0x1df2436ULL, 0x164e799ULL },
+    { 0x0c309d9ULL, 0x0176a61ULL, 0x1372186ULL, 0x10cadd0ULL },
+    { 0x0da7e31ULL, 0x172728fULL, 0x118fcb6ULL, 0x1e29c9dULL },
+    { 0x0e9627aULL, 0x02dc2afULL, 0x0bc8d2eULL, 0x1ea8768ULL },
+    { 0x0e9b997ULL, 0x09edec9ULL, 0x1d33b2eULL, 0x126f6f2ULL },
+    { 0x0f94806ULL, 0x10ec60cULL, 0x0c0253eULL, 0x060c6e1ULL },
+    { 0x0f59125ULL, 0x1bc5740ULL, 0x149135eULL, 0x005d47bULL },
+    { 0x0f6b7d7ULL, 0x1d9ffc3ULL, 0x1d7dadeULL, 0x187ff37ULL },
+    { 0x11b58e4ULL, 0x1273c1cULL, 0x04e35b1ULL, 0x07079c9ULL },
+    { 0x11ad279ULL, 0x1b1303fULL, 0x13c96b1ULL, 0x1f8191bULL },
+    { 0x11e380bULL, 0x112b1b8ULL, 0x1a038f1ULL, 0x03b1a91ULL },
+    { 0x1169445ULL, 0x1d13510ULL, 0x14452d1ULL, 0x0115917ULL },
+    { 0x12ffb4aULL, 0x08fb1feULL, 0x0a5bfe9ULL, 0x0ff1be2ULL },
+    { 0x158cb8dULL, 0x1924c7eULL, 0x163a635ULL, 0x0fc6493ULL },
+    { 0x15987f0ULL, 0x1e5485bULL, 0x01fc335ULL, 0x1b4254fULL },
+    { 0x1422fdfULL, 0x053ecf3ULL, 0x1f7e885ULL, 0x19e6f94ULL },
+    { 0x14e1227ULL, 0x030f51aULL, 0x1c890e5ULL, 0x0b15e18ULL },
+    { 0x156df22ULL, 0x1e2f156ULL, 0x089f6d5ULL, 0x0d51e8fULL },
+    { 0x173dbf1ULL, 0x1bf7857ULL, 0x11fb79dULL, 0x1d43dfbULL },
+    { 0x164c93cULL, 0x0aa4575ULL, 0x079264dULL, 0x15d44aaULL },
+    { 0x17cbb86ULL, 0x18adddaULL, 0x0c3ba7dULL, 0x0b776a3ULL },
+    { 0x1880a87ULL, 0x0128e1aULL, 0x1c2a023ULL, 0x0b0e290ULL },
+    { 0x19147ddULL, 0x1550e77ULL, 0x177c513ULL, 0x1dce155ULL },
+    { 0x184eb8aULL, 0x0828bf6ULL, 0x0a3ae43ULL, 0x0dfa282ULL },
+    { 0x18d85adULL, 0x0f40f78ULL, 0x16b4363ULL, 0x03de05eULL },
+    { 0x1b2cda9ULL, 0x1fa2a74ULL, 0x12b669bULL, 0x05ca8bfULL },
+    { 0x1babd73ULL, 0x1fbb2d9ULL, 0x19d7abbULL, 0x1369bbfULL },
+    { 0x1e9d432ULL, 0x0ecd21dULL, 0x098572fULL, 0x170966eULL },
+    { 0x1e76528ULL, 0x06c63f4ULL, 0x0294dcfULL, 0x05f8c6cULL },
+    { 0x0f5740aULL, 0x14cd3a4ULL, 0x0a05d5eULL, 0x04b9665ULL },
+    { 0x1b11a53ULL, 0x11f9213ULL, 0x194b11bULL, 0x19093f1ULL },
+    { 0x018ce65ULL, 0x1f3040eULL, 0x14ce630ULL, 0x0e0419fULL },
+    { 0x02ab219ULL, 0x09830abULL, 0x1309aa8ULL, 0x1aa1832ULL },
+    { 0x098e981ULL, 0x1920accULL, 0x1032e32ULL, 0x066a093ULL },
+    { 0x0a8061cULL, 0x048062bULL, 0x070c02aULL, 0x1a8c024ULL },
+    { 0x141a158ULL, 0x08540f1ULL, 0x0350b05ULL, 0x11e0542ULL },
+    { 0x185314cULL, 0x00517f0ULL, 0x0651943ULL, 0x01fd140ULL },
+    { 0x196d12cULL, 0x1a03774ULL, 0x06916d3ULL, 0x05dd80bULL },
+    { 0x1fad3a2ULL, 0x1a8fa5eULL, 0x08b96bfULL, 0x0f4be2bULL },
+    { 0x00922b5ULL, 0x0340c8bULL, 0x15a8920ULL, 0x1a26058ULL },
+    { 0x019bce0ULL, 0x1e71888ULL, 0x00e7b30ULL, 0x02231cfULL },
+    { 0x00b547cULL, 0x065342dULL, 0x07c55a0ULL, 0x168594cULL },
+    { 0x002c76fULL, 0x0f1a466ULL, 0x1edc680ULL, 0x0cc4b1eULL },
+    { 0x0132289ULL, 0x11428a2ULL, 0x1228990ULL, 0x08a2851ULL },
+    { 0x012d2a7ULL, 0x1b0bc06ULL, 0x1ca9690ULL, 0x0c07a1bULL },
+    { 0x00c4b43ULL, 0x013814eULL, 0x185a460ULL, 0x0e50390ULL },
+    { 0x0067bc5ULL, 0x0133dc6ULL, 0x147bcc0ULL, 0x0c77990ULL },
+    { 0x00faa0dULL, 0x09625aaULL, 0x160abe0ULL, 0x0ab48d2ULL },
+    { 0x01f1f54ULL, 0x147354bULL, 0x055f1f0ULL, 0x1a559c5ULL },
+    { 0x038e879ULL, 0x1bb00adULL, 0x13c2e38ULL, 0x16a01bbULL },
+    { 0x0323b23ULL, 0x13ab0c2ULL, 0x189b898ULL, 0x0861ab9ULL },
+    { 0x02c3647ULL, 0x059958aULL, 0x1c4d868ULL, 0x0a35334ULL },
+    { 0x02da51bULL, 0x0dc81e9ULL, 0x1b14b68ULL, 0x12f0276ULL },
+    { 0x02e9d8dULL, 0x0da3d68ULL, 0x16372e8ULL, 0x02d78b6ULL },
+    { 0x027c562ULL, 0x0eda144ULL, 0x08d47c8ULL, 0x0450b6eULL },
+    { 0x03efdf5ULL, 0x1fb3dcdULL, 0x15f7ef8ULL, 0x16779bfULL },
+    { 0x0521ee0ULL, 0x1637802ULL, 0x00ef094ULL, 0x0803d8dULL },
+    { 0x0448efdULL, 0x0f34d23ULL, 0x17ee244ULL, 0x189659eULL },
+    { 0x0542f81ULL, 0x15249c2ULL, 0x103e854ULL, 0x0872495ULL },
+    { 0x055f6c9ULL, 0x1d559a6ULL, 0x126df54ULL, 0x0cb3557ULL },
+    { 0x047e008ULL, 0x08461a4ULL, 0x0200fc4ULL, 0x04b0c42ULL },
+    { 0x04f9bf8ULL, 0x0a7796bULL, 0x03fb3e4ULL, 0x1ad3dcaULL },
+    { 0x046d558ULL, 0x0c17165ULL, 0x03556c4ULL, 0x14d1d06ULL },
+    { 0x05ef65eULL, 0x1c1f5afULL, 0x0f4def4ULL, 0x1eb5f07ULL },
+    { 0x0692188ULL, 0x00c48e8ULL, 0x023092cULL, 0x02e2460ULL },
+    { 0x06013adULL, 0x0385c62ULL, 0x16b900cULL, 0x08c7438ULL },
+    { 0x068bc21ULL, 0x0fa5088ULL, 0x1087a2cULL, 0x02214beULL },
+    { 0x072a5d0ULL, 0x1c968c1ULL, 0x0174a9cULL, 0x1062d27ULL },
+    { 0x06400e2ULL, 0x029c900ULL, 0x08e004cULL, 0x0012728ULL },
+    { 0x06dce3aULL, 0x0eec12fULL, 0x0b8e76cULL, 0x1e906eeULL },
+    { 0x0891409ULL, 0x0541228ULL, 0x1205122ULL, 0x0289054ULL },
+    { 0x089d9fdULL, 0x0b71e6dULL, 0x17f3722ULL, 0x16cf1daULL },
+    { 0x08a3ee5ULL, 0x0733e8aULL, 0x14ef8a2ULL, 0x0a2f99cULL },
+    { 0x08a952aULL, 0x0e0b268ULL, 0x0a952a2ULL, 0x02c9a0eULL },
+    { 0x08c277dULL, 0x07107ebULL, 0x17dc862ULL, 0x1afc11cULL },
+    { 0x09d0612ULL, 0x144830bULL, 0x090c172ULL, 0x1a18245ULL },
+    { 0x08ee533ULL, 0x0f0a3cdULL, 0x1994ee2ULL, 0x1678a1eULL },
+    { 0x09f04fbULL, 0x175ab29ULL, 0x1be41f2ULL, 0x129ab5dULL },
+    { 0x0b86f1bULL, 0x15a82efULL, 0x1b1ec3aULL, 0x1ee82b5ULL },
+    { 0x0b1faeeULL, 0x1af9ea6ULL, 0x0eebf1aULL, 0x0caf3ebULL },
+    { 0x0a36ff0ULL, 0x06f2ac7ULL, 0x01fed8aULL, 0x1c6a9ecULL },
+    { 0x0b275f6ULL, 0x169bec5ULL, 0x0df5c9aULL, 0x146fb2dULL },
+    { 0x0b53332ULL, 0x12c93c3ULL, 0x099995aULL, 0x1879269ULL },
+    { 0x0a603e1ULL, 0x0392b42ULL, 0x10f80caULL, 0x085a938ULL },
+    { 0x0a798cfULL, 0x09fbf20ULL, 0x1e633caULL, 0x009fbf2ULL },
+    { 0x0a6dc02ULL, 0x0cab304ULL, 0x08076caULL, 0x0419aa6ULL },
+    { 0x0b64b5fULL, 0x11ba767ULL, 0x1f5a4daULL, 0x1cdcbb1ULL },
+    { 0x0bfab99ULL, 0x19e2bebULL, 0x133abfaULL, 0x1afa8f3ULL },
+    { 0x0cacc85ULL, 0x0d26e0cULL, 0x14266a6ULL, 0x060ec96ULL },
+    { 0x0cb8f5eULL, 0x0c7e66bULL, 0x0f5e3a6ULL, 0x1accfc6ULL },
+    { 0x0cc6ea2ULL, 0x062cb8eULL, 0x08aec66ULL, 0x0e3a68cULL },
+    { 0x0ce198bULL, 0x012fb68ULL, 0x1a330e6ULL, 0x02dbe90ULL },
+    { 0x0e12cbbULL, 0x07ecaa1ULL, 0x1ba690eULL, 0x10aa6fcULL },
+    { 0x0f8c701ULL, 0x1d8424eULL, 0x101c63eULL, 0x0e48437ULL },
+    { 0x0f35752ULL, 0x14df247ULL, 0x095d59eULL, 0x1c49f65ULL },
+    { 0x0e47a8cULL, 0x00a5fa6ULL, 0x062bc4eULL, 0x0cbf4a0ULL },
+    { 0x0e7cb65ULL, 0x0bf6746ULL, 0x14da7ceULL, 0x0c5cdfaULL },
+    { 0x1084d18ULL, 0x042007dULL, 0x0316421ULL, 0x17c0084ULL },
+    { 0x113e202ULL, 0x184a096ULL, 0x0808f91ULL, 0x0d20a43ULL },
+    { 0x10d5dd3ULL, 0x057995dULL, 0x1977561ULL, 0x17533d4ULL },
+    { 0x11447f3ULL, 0x1718957ULL, 0x19fc451ULL, 0x1d5231dULL },
+    { 0x1286ae3ULL, 0x03b889eULL, 0x18eac29ULL, 0x0f223b8ULL },
+    { 0x1388a36ULL, 0x1aa841bULL, 0x0d8a239ULL, 0x1b042abULL },
+    { 0x12a3f49ULL, 0x05b30faULL, 0x125f8a9ULL, 0x0be19b4ULL },
+    { 0x12d1b20ULL, 0x02e115aULL, 0x009b169ULL, 0x0b510e8ULL },
+    { 0x12e4d6eULL, 0x06ba57cULL, 0x0ed64e9ULL, 0x07d4bacULL },
+    { 0x1366eceULL, 0x14badb6ULL, 0x0e6ecd9ULL, 0x0db6ba5ULL },
+    { 0x1378dc1ULL, 0x1df2950ULL, 0x10763d9ULL, 0x01529f7ULL },
+    { 0x14134ddULL, 0x0555cb1ULL, 0x1765905ULL, 0x11a7554ULL },
+    { 0x148a50dULL, 0x0d044f8ULL, 0x1614a25ULL, 0x03e4416ULL },
+    { 0x151610bULL, 0x114c0f4ULL, 0x1a10d15ULL, 0x05e0651ULL },
+    { 0x15b3684ULL, 0x1447c9aULL, 0x042d9b5ULL, 0x0b27c45ULL },
+    { 0x15fe0b1ULL, 0x1b4699dULL, 0x11a0ff5ULL, 0x1732c5bULL },
+    { 0x1605cc7ULL, 0x05bdc14ULL, 0x1c6740dULL, 0x05077b4ULL },
+    { 0x1601e30ULL, 0x06a5013ULL, 0x018f00dULL, 0x19014acULL },
+    { 0x179d565ULL, 0x1fd545cULL, 0x14d573dULL, 0x074557fULL },
+    { 0x17d8899ULL, 0x19e4939ULL, 0x132237dULL, 0x13924f3ULL },
+    { 0x16705f4ULL, 0x06d6d51ULL, 0x05f41cdULL, 0x1156d6cULL },
+    { 0x166b079ULL, 0x0b971b1ULL, 0x13c1acdULL, 0x11b1d3aULL },
+    { 0x17e8bdcULL, 0x18b6d7bULL, 0x077a2fdULL, 0x1bd6da3ULL },
+    { 0x17eac67ULL, 0x1fbe598ULL, 0x1cc6afdULL, 0x0334fbfULL },
+    { 0x18875e0ULL, 0x0611adcULL, 0x00f5c23ULL, 0x076b10cULL },
+    { 0x199d306ULL, 0x184965eULL, 0x0c19733ULL, 0x0f4d243ULL },
+    { 0x18a6601ULL, 0x050229eULL, 0x100cca3ULL, 0x0f28814ULL },
+    { 0x19a44c7ULL, 0x151ae1cULL, 0x1c644b3ULL, 0x070eb15ULL },
+    { 0x18c1115ULL, 0x0101759ULL, 0x1511063ULL, 0x135d010ULL },
+    { 0x18d287eULL, 0x02787b9ULL, 0x0fc2963ULL, 0x13bc3c8ULL },
+    { 0x195dd09ULL, 0x1d61374ULL, 0x1217753ULL, 0x05d90d7ULL },
+    { 0x19f4e25ULL, 0x176271eULL, 0x148e5f3ULL, 0x0f1c8ddULL },
+    { 0x196c3c5ULL, 0x1912f56ULL, 0x14786d3ULL, 0x0d5e913ULL },
+    { 0x1a005d2ULL, 0x0498a51ULL, 0x097400bULL, 0x114a324ULL },
+    { 0x1b96e8cULL, 0x14e0ebeULL, 0x062ed3bULL, 0x0fae0e5ULL },
+    { 0x1b31709ULL, 0x15c3272ULL, 0x121d19bULL, 0x09c9875ULL },
+    { 0x1b39d64ULL, 0x1ef3650ULL, 0x04d739bULL, 0x014d9efULL },
+    { 0x1a53281ULL, 0x01c1b92ULL, 0x102994bULL, 0x093b070ULL },
+    { 0x1a5a22eULL, 0x0ac87b2ULL, 0x0e88b4bULL, 0x09bc26aULL },
+    { 0x1bcb4ddULL, 0x1d91fb9ULL, 0x1765a7bULL, 0x13bf137ULL },
+    { 0x1b48e85ULL, 0x1da0f12ULL, 0x142e25bULL, 0x091e0b7ULL },
+    { 0x1b67820ULL, 0x12a3394ULL, 0x0083cdbULL, 0x05398a9ULL },
+    { 0x1b71f92ULL, 0x14ebb53ULL, 0x093f1dbULL, 0x195bae5ULL },
+    { 0x1d031c7ULL, 0x111ded0ULL, 0x1c71817ULL, 0x016f711ULL },
+    { 0x1ca38deULL, 0x003feb9ULL, 0x0f638a7ULL, 0x13aff80ULL },
+    { 0x1c35c71ULL, 0x0777215ULL, 0x11c7587ULL, 0x1509ddcULL },
+    { 0x1db72f7ULL, 0x135fe9fULL, 0x1de9db7ULL, 0x1f2ff59ULL },
+    { 0x1d3c064ULL, 0x1a56614ULL, 0x04c0797ULL, 0x050cd4bULL },
+    { 0x1d6ba18ULL, 0x18273b3ULL, 0x030bad7ULL, 0x19b9c83ULL },
+    { 0x1dff33aULL, 0x1a4f3ffULL, 0x0b99ff7ULL, 0x1ff9e4bULL },
+    { 0x1f02202ULL, 0x108c292ULL, 0x080881fULL, 0x0928621ULL },
+    { 0x1f00fa6ULL, 0x16ace52ULL, 0x0cbe01fULL, 0x094e6adULL },
+    { 0x1ec0441ULL, 0x0594318ULL, 0x104406fULL, 0x0318534ULL },
+    { 0x1ec36bfULL, 0x078dfbbULL, 0x1fad86fULL, 0x1bbf63cULL },
+    { 0x1fd6bdaULL, 0x10fcbffULL, 0x0b7ad7fULL, 0x1ffa7e1ULL },
+    { 0x1f46671ULL, 0x1794397ULL, 0x11ccc5fULL, 0x1d3853dULL },
+    { 0x1f49583ULL, 0x1d8db50ULL, 0x183525fULL, 0x015b637ULL },
+    { 0x1ee5ee1ULL, 0x07b7b1eULL, 0x10ef4efULL, 0x0f1bdbcULL },
+    { 0x1efd5f9ULL, 0x0fd7b7dULL, 0x13f57efULL, 0x17dbd7eULL },
+    { 0x1fe3129ULL, 0x13873f8ULL, 0x12918ffULL, 0x03f9c39ULL },
+    { 0x1f746bcULL, 0x16c6f37ULL, 0x07ac5dfULL, 0x1d9ec6dULL },
+    { 0x0d1705eULL, 0x105d6a5ULL, 0x0f41d16ULL, 0x14ad741ULL },
+    { 0x1321e17ULL, 0x15ab413ULL, 0x1d0f099ULL, 0x1905ab5ULL },
+    { 0x133b04dULL, 0x19d34b0ULL, 0x1641b99ULL, 0x01a5973ULL },
+    { 0x1c8be1dULL, 0x0d256bbULL, 0x170fa27ULL, 0x1bad496ULL },
+    { 0x03a20ddULL, 0x1192ca9ULL, 0x17608b8ULL, 0x12a6931ULL },
+    { 0x0558261ULL, 0x1b54102ULL, 0x10c8354ULL, 0x081055bULL },
+    { 0x06882c7ULL, 0x099cc0aULL, 0x1c6822cULL, 0x0a06732ULL },
+    { 0x06f80e9ULL, 0x0bd6928ULL, 0x12e03ecULL, 0x0292d7aULL },
+    { 0x07e6b97ULL, 0x11aedcfULL, 0x1d3acfcULL, 0x1e76eb1ULL },
+    { 0x0ad4098ULL, 0x00c0b2dULL, 0x032056aULL, 0x169a060ULL },
+    { 0x0ae7073ULL, 0x039b38dULL, 0x19c1ceaULL, 0x1639b38ULL },
+    { 0x0cd3170ULL, 0x02553c9ULL, 0x01d1966ULL, 0x1279548ULL },
+    { 0x0e74a2eULL, 0x02ee726ULL, 0x0e8a5ceULL, 0x0c9cee8ULL },
+    { 0x0fe59fbULL, 0x13bfb6dULL, 0x1bf34feULL, 0x16dbfb9ULL },
+    { 0x1168fd2ULL, 0x1c3a953ULL, 0x097e2d1ULL, 0x1952b87ULL },
+    { 0x14b872eULL, 0x0e4e47aULL, 0x0e9c3a5ULL, 0x0bc4e4eULL },
+    { 0x15353d6ULL, 0x105fc57ULL, 0x0d79595ULL, 0x1d47f41ULL },
+    { 0x16a336eULL, 0x029f4faULL, 0x0ed98adULL, 0x0be5f28ULL },
+    { 0x165b533ULL, 0x0fcd1d1ULL, 0x1995b4dULL, 0x117167eULL },
+    { 0x18983e8ULL, 0x0a50a7aULL, 0x02f8323ULL, 0x0bca14aULL },
+    { 0x195723cULL, 0x12417b7ULL, 0x0789d53ULL, 0x1dbd049ULL },
+    { 0x1b0df47ULL, 0x1db9656ULL, 0x1c5f61bULL, 0x0d4d3b7ULL },
+    { 0x1bf1b1cULL, 0x10e377bULL, 0x071b1fbULL, 0x1bdd8e1ULL },
+    { 0x1cacd1fULL, 0x0d2e67dULL, 0x1f166a7ULL, 0x17cce96ULL },
+    { 0x1da8e35ULL, 0x1f2661bULL, 0x158e2b7ULL, 0x1b0cc9fULL },
+    { 0x1e0cf0dULL, 0x0da4676ULL, 0x161e60fULL, 0x0dcc4b6ULL },
+    { 0x00853ddULL, 0x0111c6fULL, 0x1779420ULL, 0x1ec7110ULL },
+    { 0x000468fULL, 0x0508c26ULL, 0x1e2c400ULL, 0x0c86214ULL },
+    { 0x00145f6ULL, 0x0658c45ULL, 0x0df4500ULL, 0x144634cULL },
+    { 0x009919cULL, 0x0841c69ULL, 0x0731320ULL, 0x12c7042ULL },
+    { 0x001a5c3ULL, 0x0d588c0ULL, 0x1874b00ULL, 0x0062356ULL },
+    { 0x018141eULL, 0x1409429ULL, 0x0f05030ULL, 0x1285205ULL },
+    { 0x011178cULL, 0x1441c62ULL, 0x063d110ULL, 0x08c7045ULL },
+    { 0x0190cb6ULL, 0x1668c09ULL, 0x0da6130ULL, 0x12062cdULL },
+    { 0x00b03faULL, 0x025a86bULL, 0x0bf81a0ULL, 0x1ac2b48ULL },
+    { 0x002e23cULL, 0x0a024a7ULL, 0x0788e80ULL, 0x1ca480aULL },
+    { 0x003842bULL, 0x0f4a020ULL, 0x1a84380ULL, 0x0080a5eULL },
+    { 0x003cee2ULL, 0x0e7a806ULL, 0x08ee780ULL, 0x0c02bceULL },
+    { 0x012537eULL, 0x121b467ULL, 0x0fd9490ULL, 0x1cc5b09ULL },
+    { 0x01a2037ULL, 0x130a489ULL, 0x1d808b0ULL, 0x1224a19ULL },
+    { 0x01a0a30ULL, 0x122200bULL, 0x018a0b0ULL, 0x1a00889ULL },
+    { 0x01bda5fULL, 0x197b42fULL, 0x1f4b7b0ULL, 0x1e85bd3ULL },
+    { 0x01acdbcULL, 0x1e22c6dULL, 0x07b66b0ULL, 0x16c688fULL },
+    { 0x013e4ecULL, 0x1e52ca4ULL, 0x06e4f90ULL, 0x04a694fULL },
+    { 0x005a105ULL, 0x09405c0ULL, 0x1410b40ULL, 0x0074052ULL },
+    { 0x004c592ULL, 0x0c08945ULL, 0x0934640ULL, 0x1452206ULL },
+    { 0x00de752ULL, 0x0c581cfULL, 0x095cf60ULL, 0x1e70346ULL },
+    { 0x00dde46ULL, 0x0c7950eULL, 0x0c4f760ULL, 0x0e153c6ULL },
+    { 0x01c7c24ULL, 0x162158cULL, 0x0487c70ULL, 0x063508dULL },
+    { 0x01535bbULL, 0x17499e1ULL, 0x1bb5950ULL, 0x10f325dULL },
+    { 0x014c2dbULL, 0x1918927ULL, 0x1b68650ULL, 0x1c92313ULL },
+    { 0x015fea2ULL, 0x1e69986ULL, 0x08aff50ULL, 0x0c332cfULL },
+    { 0x00fcce5ULL, 0x0f72d0cULL, 0x14e67e0ULL, 0x06169deULL },
+    { 0x0173402ULL, 0x144b180ULL, 0x08059d0ULL, 0x0031a45ULL },
+    { 0x01fa11cULL, 0x18425e9ULL, 0x0710bf0ULL, 0x12f4843ULL },
+    { 0x01e9326ULL, 0x1a0b54aULL, 0x0c992f0ULL, 0x0a55a0bULL },
+    { 0x01feef6ULL, 0x1e7ad8fULL, 0x0deeff0ULL, 0x1e36bcfULL },
+    { 0x0213cc1ULL, 0x05f1880ULL, 0x1067908ULL, 0x00231f4ULL },
+    { 0x020a3daULL, 0x08988e3ULL, 0x0b78a08ULL, 0x18e2322ULL },
+    { 0x028f5bdULL, 0x0f81cedULL, 0x17b5e28ULL, 0x16e703eULL },
+    { 0x0390a7dULL, 0x13f042bULL, 0x17ca138ULL, 0x1a841f9ULL },
+    { 0x03846d0ULL, 0x149080fULL, 0x016c438ULL, 0x1e02125ULL },
+    { 0x0318e68ULL, 0x1ef0022ULL, 0x02ce318ULL, 0x08801efULL },
+    { 0x02bf705ULL, 0x0dc34ceULL, 0x141dfa8ULL, 0x0e65876ULL },
+    { 0x0229d27ULL, 0x0fab440ULL, 0x1c97288ULL, 0x0045abeULL },
+    { 0x03341d5ULL, 0x11d2c45ULL, 0x1570598ULL, 0x1446971ULL },
+    { 0x0243098ULL, 0x00819a1ULL, 0x0321848ULL, 0x10b3020ULL },
+    { 0x025475cULL, 0x04d0567ULL, 0x075c548ULL, 0x1cd4164ULL },
+    { 0x03d5878ULL, 0x12f112dULL, 0x03c3578ULL, 0x16911e9ULL },
+    { 0x03d92d8ULL, 0x18d192bULL, 0x0369378ULL, 0x1a93163ULL },
+    { 0x03dd347ULL, 0x19d954eULL, 0x1c59778ULL, 0x0e55373ULL },
+    { 0x034edb0ULL, 0x1ea09c5ULL, 0x01b6e58ULL, 0x14720afULL },
+    { 0x0276c0fULL, 0x05ea5a4ULL, 0x1e06dc8ULL, 0x04b4af4ULL },
+    { 0x02e8d78ULL, 0x0eb2169ULL, 0x03d62e8ULL, 0x12d09aeULL },
+    { 0x03e2af2ULL, 0x12ba98bULL, 0x09ea8f8ULL, 0x1a32ba9ULL },
+    { 0x03646faULL, 0x169a927ULL, 0x0bec4d8ULL, 0x1c92b2dULL },
+    { 0x0377f24ULL, 0x16e35c6ULL, 0x049fdd8ULL, 0x0c758edULL },
+    { 0x03f2d35ULL, 0x17e25c9ULL, 0x15969f8ULL, 0x12748fdULL },
+    { 0x03691d6ULL, 0x189bd41ULL, 0x0d712d8ULL, 0x1057b23ULL },
+    { 0x04019faULL, 0x023d861ULL, 0x0bf3004ULL, 0x10c3788ULL },
+    { 0x0402eacULL, 0x0624ca2ULL, 0x06ae804ULL, 0x08a648cULL },
+    { 0x0500333ULL, 0x130c043ULL, 0x1998014ULL, 0x1840619ULL },
+    { 0x058646fULL, 0x171c4acULL, 0x1ec4c34ULL, 0x06a471dULL },
+    { 0x04b19ccULL, 0x0077c68ULL, 0x06731a4ULL, 0x02c7dc0ULL },
+    { 0x0423d18ULL, 0x04270e1ULL, 0x0317884ULL, 0x10e1c84ULL },
+    { 0x05afad2ULL, 0x183f88fULL, 0x096beb4ULL, 0x1e23f83ULL },
+    { 0x0538092ULL, 0x184e801ULL, 0x0920394ULL, 0x1002e43ULL },
+    { 0x04d6240ULL, 0x005418eULL, 0x0048d64ULL, 0x0e30540ULL },
+    { 0x04d0039ULL, 0x0344129ULL, 0x1380164ULL, 0x1290458ULL },
+    { 0x0456834ULL, 0x0264585ULL, 0x0582d44ULL, 0x14344c8ULL },
+    { 0x04c5489ULL, 0x050592cULL, 0x1225464ULL, 0x0693414ULL },
+    { 0x04d56b2ULL, 0x064d90fULL, 0x09ad564ULL, 0x1e1364cULL },
+    { 0x04d9308ULL, 0x084516aULL, 0x0219364ULL, 0x0ad1442ULL },
+    { 0x05460c5ULL, 0x1114d84ULL, 0x1460c54ULL, 0x0436511ULL },
+    { 0x05c655aULL, 0x141c1edULL, 0x0b54c74ULL, 0x16f0705ULL },
+    { 0x0467e03ULL, 0x052f186ULL, 0x180fcc4ULL, 0x0c31e94ULL },
+    { 0x04706a0ULL, 0x0646902ULL, 0x00ac1c4ULL, 0x0812c4cULL },
+    { 0x04ec85dULL, 0x093652dULL, 0x17426e4ULL, 0x1694d92ULL },
+    { 0x04fa961ULL, 0x0b761c8ULL, 0x10d2be4ULL, 0x0270ddaULL },
+    { 0x05f7459ULL, 0x15571adULL, 0x1345df4ULL, 0x16b1d55ULL },
+    { 0x0564d75ULL, 0x1736545ULL, 0x15d64d4ULL, 0x1454d9dULL },
+    { 0x060171aULL, 0x048d063ULL, 0x0b1d00cULL, 0x18c1624ULL },
+    { 0x0684d25ULL, 0x07a444cULL, 0x149642cULL, 0x06444bcULL },
+    { 0x0610432ULL, 0x06cc001ULL, 0x098410cULL, 0x100066cULL },
+    { 0x060f659ULL, 0x0d950a7ULL, 0x134de0cULL, 0x1ca1536ULL },
+    { 0x0797077ULL, 0x13dd48dULL, 0x1dc1d3cULL, 0x1625779ULL },
+    { 0x0784c1fULL, 0x15ac42dULL, 0x1f0643cULL, 0x16846b5ULL },
+    { 0x071d3b8ULL, 0x1ac5867ULL, 0x03b971cULL, 0x1cc346bULL },
+    { 0x07981eeULL, 0x1adcc68ULL, 0x0ef033cULL, 0x02c676bULL },
+    { 0x071eea9ULL, 0x1fe48a6ULL, 0x12aef1cULL, 0x0ca24ffULL },
+    { 0x0620b69ULL, 0x03b6062ULL, 0x12da08cULL, 0x08c0db8ULL },
+    { 0x06b71fdULL, 0x03d7cedULL, 0x17f1dacULL, 0x16e7d78ULL },
+    { 0x06b65a7ULL, 0x07cecccULL, 0x1cb4dacULL, 0x0666e7cULL },
+    { 0x073379dULL, 0x15c7ce3ULL, 0x173d99cULL, 0x18e7c75ULL },
+    { 0x072da5cULL, 0x18b7427ULL, 0x074b69cULL, 0x1c85da3ULL },
+    { 0x07bc107ULL, 0x19ce44cULL, 0x1c107bcULL, 0x0644e73ULL },
+    { 0x073e9a0ULL, 0x1ae68c4ULL, 0x00b2f9cULL, 0x0462cebULL },
+    { 0x073fe40ULL, 0x1cf7086ULL, 0x004ff9cULL, 0x0c21de7ULL },
+    { 0x0738f11ULL, 0x1de6043ULL, 0x111e39cULL, 0x1840cf7ULL },
+    { 0x06c1e48ULL, 0x04b512aULL, 0x024f06cULL, 0x0a915a4ULL },
+    { 0x0643daaULL, 0x06ad9e0ULL, 0x0ab784cULL, 0x00f36acULL },
+    { 0x06d7fa3ULL, 0x07ed9ceULL, 0x18bfd6cULL, 0x0e736fcULL },
+    { 0x06c8dd6ULL, 0x0cbcd49ULL, 0x0d7626cULL, 0x12567a6ULL },
+    { 0x0745b50ULL, 0x10b5147ULL, 0x015b45cULL, 0x1c515a1ULL },
+    { 0x0752776ULL, 0x16dc5c3ULL, 0x0ddc95cULL, 0x187476dULL },
+    { 0x06f2b5aULL, 0x00fe1ebULL, 0x0b5a9ecULL, 0x1af0fe0ULL },
+    { 0x06e0926ULL, 0x02ae548ULL, 0x0c920ecULL, 0x0254ea8ULL },
+    { 0x06741b1ULL, 0x03c6945ULL, 0x11b05ccULL, 0x1452c78ULL },
+    { 0x06e874eULL, 0x0c9e56aULL, 0x0e5c2ecULL, 0x0ad4f26ULL },
+    { 0x067f4b8ULL, 0x0ec79a5ULL, 0x03a5fccULL, 0x14b3c6eULL },
+    { 0x07f06dcULL, 0x14d6d2bULL, 0x076c1fcULL, 0x1a96d65ULL },
+    { 0x07ed6c0ULL, 0x1c9790eULL, 0x006d6fcULL, 0x0e13d27ULL },
+    { 0x081c39aULL, 0x0848a67ULL, 0x0b38702ULL, 0x1cca242ULL },
+    { 0x09921d4ULL, 0x1050ec9ULL, 0x0570932ULL, 0x126e141ULL },
+    { 0x09134d3ULL, 0x1559a81ULL, 0x1965912ULL, 0x102b355ULL },
+    { 0x0997deeULL, 0x1679eecULL, 0x0ef7d32ULL, 0x06ef3cdULL },
+    { 0x091d715ULL, 0x1d41647ULL, 0x151d712ULL, 0x1c4d057ULL },
+    { 0x091a60fULL, 0x1d486a2ULL, 0x1e0cb12ULL, 0x08ac257ULL },
+    { 0x098b531ULL, 0x1f012c9ULL, 0x1195a32ULL, 0x126901fULL },
+    { 0x0824827ULL, 0x032a604ULL, 0x1c82482ULL, 0x040ca98ULL },
+    { 0x09a17f0ULL, 0x1613a4bULL, 0x01fd0b2ULL, 0x1a4b90dULL },
+    { 0x092b77bULL, 0x1f1b2e3ULL, 0x1bdda92ULL, 0x18e9b1fULL },
+    { 0x08d1acaULL, 0x0079b2aULL, 0x0a6b162ULL, 0x0a9b3c0ULL },
+    { 0x0856ad7ULL, 0x0178f87ULL, 0x1d6ad42ULL, 0x1c3e3d0ULL },
+    { 0x08cb906ULL, 0x08297c8ULL, 0x0c13a62ULL, 0x027d282ULL },
+    { 0x08de8ceULL, 0x0878facULL, 0x0e62f62ULL, 0x06be3c2ULL },
+    { 0x08cf376ULL, 0x0a197cfULL, 0x0dd9e62ULL, 0x1e7d30aULL },
+    { 0x095473bULL, 0x1748367ULL, 0x1b9c552ULL, 0x1cd825dULL },
+    { 0x09c829dULL, 0x1900f2bULL, 0x1728272ULL, 0x1a9e013ULL },
+    { 0x09c9784ULL, 0x1c01f4aULL, 0x043d272ULL, 0x0a5f007ULL },
+    { 0x08713a7ULL, 0x034bf42ULL, 0x1cb91c2ULL, 0x085fa58ULL },
+    { 0x08f5591ULL, 0x0543b4dULL, 0x11355e2ULL, 0x165b854ULL },
+    { 0x0867626ULL, 0x060b786ULL, 0x0c8dcc2ULL, 0x0c3da0cULL },
+    { 0x08e94d3ULL, 0x0d1bb09ULL, 0x19652e2ULL, 0x121bb16ULL },
+    { 0x09e2dd7ULL, 0x153afc9ULL, 0x1d768f2ULL, 0x127eb95ULL },
+    { 0x09e8b40ULL, 0x183234aULL, 0x005a2f2ULL, 0x0a58983ULL },
+    { 0x0a122d9ULL, 0x01d0aa3ULL, 0x136890aULL, 0x18aa170ULL },
+    { 0x0a82176ULL, 0x02986c9ULL, 0x0dd082aULL, 0x126c328ULL },
+    { 0x0a0b49bULL, 0x0d89aa1ULL, 0x1b25a0aULL, 0x10ab236ULL },
+    { 0x0a0e5a8ULL, 0x0e80ae4ULL, 0x02b4e0aULL, 0x04ea02eULL },
+    { 0x0a9d5e3ULL, 0x0fd9a4cULL, 0x18f572aULL, 0x064b37eULL },
+    { 0x0b01387ULL, 0x1189e42ULL, 0x1c3901aULL, 0x084f231ULL },
+    { 0x0b8b2f2ULL, 0x1a99a8bULL, 0x09e9a3aULL, 0x1a2b32bULL },
+    { 0x0b0d636ULL, 0x1e89607ULL, 0x0d8d61aULL, 0x1c0d22fULL },
+    { 0x0a269edULL, 0x03b2ee4ULL, 0x16f2c8aULL, 0x04ee9b8ULL },
+    { 0x0ab52edULL, 0x03d3e2eULL, 0x16e95aaULL, 0x0e8f978ULL },
+    { 0x0ab2f6fULL, 0x07fa6eaULL, 0x1ede9aaULL, 0x0aecbfcULL },
+    { 0x0aa9087ULL, 0x098be08ULL, 0x1c212aaULL, 0x020fa32ULL },
+    { 0x0a39638ULL, 0x0ec3223ULL, 0x038d38aULL, 0x188986eULL },
+    { 0x0b2ced3ULL, 0x1dbaa07ULL, 0x196e69aULL, 0x1c0abb7ULL },
+    { 0x0b2af36ULL, 0x1eaa6c3ULL, 0x0d9ea9aULL, 0x186caafULL },
+    { 0x0ad4157ULL, 0x01d874dULL, 0x1d5056aULL, 0x165c370ULL },
+    { 0x0a498b0ULL, 0x0aa1b01ULL, 0x01a324aULL, 0x101b0aaULL },
+    { 0x0acae89ULL, 0x0da0baaULL, 0x122ea6aULL, 0x0aba0b6ULL },
+    { 0x0bc0270ULL, 0x129030bULL, 0x01c807aULL, 0x1a18129ULL },
+    { 0x0b403feULL, 0x1298f63ULL, 0x0ff805aULL, 0x18de329ULL },
+    { 0x0b46a27ULL, 0x13a8786ULL, 0x1c8ac5aULL, 0x0c3c2b9ULL },
+    { 0x0bc3bafULL, 0x13a9feaULL, 0x1ebb87aULL, 0x0aff2b9ULL },
+    { 0x0bd248dULL, 0x15c0fa8ULL, 0x162497aULL, 0x02be075ULL },
+    { 0x0b4d944ULL, 0x18b1744ULL, 0x045365aULL, 0x045d1a3ULL },
+    { 0x0ae720aULL, 0x008b3aeULL, 0x0a09ceaULL, 0x0eb9a20ULL },
+    { 0x0af73dcULL, 0x00d3fefULL, 0x0779deaULL, 0x1eff960ULL },
+    { 0x0a63659ULL, 0x05933a3ULL, 0x134d8caULL, 0x18b9934ULL },
+    { 0x0af0c10ULL, 0x04e2309ULL, 0x01061eaULL, 0x12188e4ULL },
+    { 0x0af663fULL, 0x07ca7afULL, 0x1f8cdeaULL, 0x1ebca7cULL },
+    { 0x0af5efaULL, 0x06fbb2fULL, 0x0bef5eaULL, 0x1e9bbecULL },
+    { 0x0a7e1d6ULL, 0x08dafc5ULL, 0x0d70fcaULL, 0x147eb62ULL },
+    { 0x0b63dd8ULL, 0x14b3be1ULL, 0x03778daULL, 0x10fb9a5ULL },
+    { 0x0be0d4dULL, 0x15b2768ULL, 0x16560faULL, 0x02dc9b5ULL },
+    { 0x0be5cafULL, 0x17abf2cULL, 0x1ea74faULL, 0x069fabdULL },
+    { 0x0b6b380ULL, 0x1883bc2ULL, 0x0039adaULL, 0x087b823ULL },
+    { 0x0b7bafbULL, 0x1bfbba3ULL, 0x1bebbdaULL, 0x18bbbfbULL },
+    { 0x0b69c5eULL, 0x1cbb721ULL, 0x0f472daULL, 0x109dba7ULL },
+    { 0x0bedf13ULL, 0x1dab34fULL, 0x191f6faULL, 0x1e59ab7ULL },
+    { 0x0b6c7b4ULL, 0x1e82f47ULL, 0x05bc6daULL, 0x1c5e82fULL },
+    { 0x0c04049ULL, 0x0114224ULL, 0x1240406ULL, 0x0488510ULL },
+    { 0x0c94e3dULL, 0x076462fULL, 0x178e526ULL, 0x1e8c4dcULL },
+    { 0x0c0a8a9ULL, 0x0b24aa0ULL, 0x12a2a06ULL, 0x00aa49aULL },
+    { 0x0d14cceULL, 0x147ce24ULL, 0x0e66516ULL, 0x048e7c5ULL },
+    { 0x0d9d779ULL, 0x1f5526fULL, 0x13dd736ULL, 0x1ec955fULL },
+    { 0x0d28d9bULL, 0x1d2ea61ULL, 0x1b36296ULL, 0x10cae97ULL },
+    { 0x0dbe753ULL, 0x1d5e2cfULL, 0x195cfb6ULL, 0x1e68f57ULL },
+    { 0x0dabc3eULL, 0x1e2f6a9ULL, 0x0f87ab6ULL, 0x12ade8fULL },
+    { 0x0cc40c6ULL, 0x001cf0cULL, 0x0c60466ULL, 0x061e700ULL },
+    { 0x0cdb6a7ULL, 0x0f4df8aULL, 0x1cadb66ULL, 0x0a3f65eULL },
+    { 0x0c5ae21ULL, 0x0f64382ULL, 0x108eb46ULL, 0x08384deULL },
+    { 0x0d54aa9ULL, 0x1364b26ULL, 0x12aa556ULL, 0x0c9a4d9ULL },
+    { 0x0dc5c53ULL, 0x153d30dULL, 0x1947476ULL, 0x1619795ULL },
+    { 0x0ce6d24ULL, 0x06267ccULL, 0x0496ce6ULL, 0x067cc8cULL },
+    { 0x0cf8994ULL, 0x0866f49ULL, 0x05323e6ULL, 0x125ecc2ULL },
+    { 0x0c6a645ULL, 0x0d16782ULL, 0x144cac6ULL, 0x083cd16ULL },
+    { 0x0d67789ULL, 0x1507be6ULL, 0x123dcd6ULL, 0x0cfbc15ULL },
+    { 0x0de2ca1ULL, 0x1726b88ULL, 0x10a68f6ULL, 0x023ac9dULL },
+    { 0x0d6b04bULL, 0x191f3a0ULL, 0x1a41ad6ULL, 0x00b9f13ULL },
+    { 0x0dec7abULL, 0x1f0eb6eULL, 0x1abc6f6ULL, 0x0edae1fULL },
+    { 0x0e181f1ULL, 0x0bd4a41ULL, 0x11f030eULL, 0x104a57aULL },
+    { 0x0e9afa0ULL, 0x0ee4acaULL, 0x00beb2eULL, 0x0a6a4eeULL },
+    { 0x0e256ddULL, 0x0597e27ULL, 0x176d48eULL, 0x1c8fd34ULL },
+    { 0x0e2f237ULL, 0x0b8f687ULL, 0x1d89e8eULL, 0x1c2de3aULL },
+    { 0x0e285a4ULL, 0x0e86e40ULL, 0x04b428eULL, 0x004ec2eULL },
+    { 0x0e2c7faULL, 0x0e9ea67ULL, 0x0bfc68eULL, 0x1ccaf2eULL },
+    { 0x0ebfcf5ULL, 0x0ff7e8dULL, 0x15e7faeULL, 0x162fdfeULL },
+    { 0x0fb3118ULL, 0x10c72e9ULL, 0x03119beULL, 0x12e9c61ULL },
+    { 0x0fb73eeULL, 0x12dfeeeULL, 0x0ef9dbeULL, 0x0eeff69ULL },
+    { 0x0fa2727ULL, 0x178e6caULL, 0x1c9c8beULL, 0x0a6ce3dULL },
+    { 0x0f28eceULL, 0x1cbee22ULL, 0x0e6e29eULL, 0x088efa7ULL },
+    { 0x0fbbf86ULL, 0x1cefecaULL, 0x0c3fbbeULL, 0x0a6fee7ULL },
+    { 0x0f3dea5ULL, 0x1fe7e06ULL, 0x14af79eULL, 0x0c0fcffULL },
+    { 0x0e4016cULL, 0x0294760ULL, 0x06d004eULL, 0x00dc528ULL },
+    { 0x0ec8931ULL, 0x0ba4349ULL, 0x119226eULL, 0x12584baULL },
+    { 0x0ecf484ULL, 0x0c85f8cULL, 0x0425e6eULL, 0x063f426ULL },
+    { 0x0fc176bULL, 0x179d36aULL, 0x1add07eULL, 0x0ad973dULL },
+    { 0x0e675c3ULL, 0x059fbc4ULL, 0x1875cceULL, 0x047bf34ULL },
+    { 0x0ef1677ULL, 0x07df70bULL, 0x1dcd1eeULL, 0x1a1df7cULL },
+    { 0x0eebbd4ULL, 0x08b7fcbULL, 0x057baeeULL, 0x1a7fda2ULL },
+    { 0x0fe9801ULL, 0x19a7308ULL, 0x10032feULL, 0x0219cb3ULL },
+    { 0x0f6ebc1ULL, 0x19b6bc6ULL, 0x107aedeULL, 0x0c7adb3ULL },
+    { 0x0ffc574ULL, 0x1ed674dULL, 0x05d47feULL, 0x165cd6fULL },
+    { 0x1016087ULL, 0x0148c94ULL, 0x1c20d01ULL, 0x0526250ULL },
+    { 0x101787aULL, 0x02790b5ULL, 0x0bc3d01ULL, 0x15a13c8ULL },
+    { 0x10064b0ULL, 0x0600895ULL, 0x01a4c01ULL, 0x152200cULL },
+    { 0x100b835ULL, 0x0b21491ULL, 0x1583a01ULL, 0x112509aULL },
+    { 0x109f648ULL, 0x0c510beULL, 0x024df21ULL, 0x0fa1146ULL },
+    { 0x100ffebULL, 0x0f398f6ULL, 0x1affe01ULL, 0x0de339eULL },
+    { 0x1105b8bULL, 0x1129876ULL, 0x1a3b411ULL, 0x0dc3291ULL },
+    { 0x11133c1ULL, 0x11518d2ULL, 0x1079911ULL, 0x0963151ULL },
+    { 0x110332aULL, 0x12090f2ULL, 0x0a99811ULL, 0x09e1209ULL },
+    { 0x10a3b8fULL, 0x012bcfaULL, 0x1e3b8a1ULL, 0x0be7a90ULL },
+    { 0x103770eULL, 0x044b4f6ULL, 0x0e1dd81ULL, 0x0de5a44ULL },
+    { 0x103c2c1ULL, 0x0952816ULL, 0x1068781ULL, 0x0d02952ULL },
+    { 0x10afc43ULL, 0x0d3b09cULL, 0x1847ea1ULL, 0x0721b96ULL },
+    { 0x103e524ULL, 0x0e424d4ULL, 0x0494f81ULL, 0x056484eULL },
+    { 0x1127ad9ULL, 0x11338b7ULL, 0x136bc91ULL, 0x1da3991ULL },
+    { 0x112c965ULL, 0x1b32454ULL, 0x14d2691ULL, 0x054499bULL },
+    { 0x11ba83dULL, 0x1b624b9ULL, 0x1782bb1ULL, 0x13a48dbULL },
+    { 0x112bda3ULL, 0x1f2b8d0ULL, 0x18b7a91ULL, 0x0163a9fULL },
+    { 0x1140958ULL, 0x1030171ULL, 0x0352051ULL, 0x11d0181ULL },
+    { 0x11d902cULL, 0x1a41538ULL, 0x0681371ULL, 0x039504bULL },
+    { 0x11de5f9ULL, 0x1f509fdULL, 0x13f4f71ULL, 0x17f215fULL },
+    { 0x1061712ULL, 0x040b153ULL, 0x091d0c1ULL, 0x1951a04ULL },
+    { 0x10e56daULL, 0x041b93fULL, 0x0b6d4e1ULL, 0x1f93b04ULL },
+    { 0x10e8a62ULL, 0x0a3a11aULL, 0x08ca2e1ULL, 0x0b10b8aULL },
+    { 0x106d8f1ULL, 0x0b33915ULL, 0x11e36c1ULL, 0x151399aULL },
+    { 0x10fdc1aULL, 0x0c6b13dULL, 0x0b077e1ULL, 0x1791ac6ULL },
+    { 0x1176257ULL, 0x115a597ULL, 0x1d48dd1ULL, 0x1d34b51ULL },
+    { 0x11723b0ULL, 0x12429d3ULL, 0x01b89d1ULL, 0x1972849ULL },
+    { 0x116b2ccULL, 0x1813db2ULL, 0x0669ad1ULL, 0x09b7903ULL },
+    { 0x11fcaaaULL, 0x1a6a93eULL, 0x0aaa7f1ULL, 0x0f92acbULL },
+    { 0x11fe6cbULL, 0x1d5a9beULL, 0x1a6cff1ULL, 0x0fb2b57ULL },
+    { 0x128342aULL, 0x06890b8ULL, 0x0a85829ULL, 0x03a122cULL },
+    { 0x121c34eULL, 0x08d8476ULL, 0x0e58709ULL, 0x0dc4362ULL },
+    { 0x1208ffeULL, 0x0eb8c73ULL, 0x0ffe209ULL, 0x19c63aeULL },
+    { 0x13979aaULL, 0x12e98fcULL, 0x0ab3d39ULL, 0x07e32e9ULL },
+    { 0x13125e8ULL, 0x16d08f0ULL, 0x02f4919ULL, 0x01e216dULL },
+    { 0x138a751ULL, 0x1d900dbULL, 0x115ca39ULL, 0x1b60137ULL },
+    { 0x13186d6ULL, 0x1cd8c13ULL, 0x0d6c319ULL, 0x1906367ULL },
+    { 0x130e47fULL, 0x1f984b5ULL, 0x1fc4e19ULL, 0x15a433fULL },
+    { 0x12227aaULL, 0x068a8f2ULL, 0x0abc889ULL, 0x09e2a2cULL },
+    { 0x12b7ff6ULL, 0x06fbcdfULL, 0x0dffda9ULL, 0x1f67becULL },
+    { 0x12a8a2dULL, 0x0ba243aULL, 0x168a2a9ULL, 0x0b848baULL },
+    { 0x12bddb0ULL, 0x0ee385dULL, 0x01b77a9ULL, 0x17438eeULL },
+    { 0x13bac08ULL, 0x1ce20b8ULL, 0x0206bb9ULL, 0x03a08e7ULL },
+    { 0x13ac4e0ULL, 0x1e9281cULL, 0x00e46b9ULL, 0x070292fULL },
+    { 0x12d5f9cULL, 0x04e1d7fULL, 0x073f569ULL, 0x1fd70e4ULL },
+    { 0x12d7431ULL, 0x07c119dULL, 0x1185d69ULL, 0x173107cULL },
+    { 0x12db27bULL, 0x0bd91bbULL, 0x1bc9b69ULL, 0x1bb137aULL },
+    { 0x13c425cULL, 0x109053fULL, 0x0748479ULL, 0x1f94121ULL },
+    { 0x1357308ULL, 0x10c11f6ULL, 0x0219d59ULL, 0x0df1061ULL },
+    { 0x135029fULL, 0x11c8d33ULL, 0x1f28159ULL, 0x1996271ULL },
+    { 0x134766dULL, 0x17915b6ULL, 0x16cdc59ULL, 0x0db513dULL },
+    { 0x13d864aULL, 0x1cd813aULL, 0x0a4c379ULL, 0x0b90367ULL },
+    { 0x1272a50ULL, 0x00f2193ULL, 0x014a9c9ULL, 0x19309e0ULL },
+    { 0x12e645dULL, 0x05925bdULL, 0x1744ce9ULL, 0x17b4934ULL },
+    { 0x12fa730ULL, 0x0ec21dbULL, 0x019cbe9ULL, 0x1b7086eULL },
+    { 0x1373b47ULL, 0x11fb5d2ULL, 0x1c5b9d9ULL, 0x0975bf1ULL },
+    { 0x13e39e0ULL, 0x12b39d8ULL, 0x00f38f9ULL, 0x03739a9ULL },
+    { 0x13e66a5ULL, 0x1782d9eULL, 0x14accf9ULL, 0x0f3683dULL },
+    { 0x137f594ULL, 0x1cc3dd5ULL, 0x0535fd9ULL, 0x1577867ULL },
+    { 0x13ff528ULL, 0x1ec31fcULL, 0x0295ff9ULL, 0x07f186fULL },
+    { 0x1407997ULL, 0x012dcd5ULL, 0x1d33c05ULL, 0x1567690ULL },
+    { 0x14950d2ULL, 0x005d81dULL, 0x0961525ULL, 0x1703740ULL },
+    { 0x14167eaULL, 0x065c8f6ULL, 0x0afcd05ULL, 0x0de274cULL },
+    { 0x148d57eULL, 0x0e1d47dULL, 0x0fd5625ULL, 0x17c570eULL },
+    { 0x140b6f1ULL, 0x0f15893ULL, 0x11eda05ULL, 0x192351eULL },
+    { 0x150d131ULL, 0x1b05055ULL, 0x1191615ULL, 0x154141bULL },
+    { 0x1599a6dULL, 0x1b7543aULL, 0x16cb335ULL, 0x0b855dbULL },
+    { 0x159b8f3ULL, 0x1b7d899ULL, 0x19e3b35ULL, 0x13237dbULL },
+    { 0x1429246ULL, 0x081f412ULL, 0x0c49285ULL, 0x0905f02ULL },
+    { 0x14287b2ULL, 0x0e0e853ULL, 0x09bc285ULL, 0x1942e0eULL },
+    { 0x15b61a2ULL, 0x124e8dcULL, 0x08b0db5ULL, 0x0762e49ULL },
+    { 0x1533639ULL, 0x17470b3ULL, 0x138d995ULL, 0x19a1c5dULL },
+    { 0x15315afULL, 0x174fc70ULL, 0x1eb5195ULL, 0x01c7e5dULL },
+    { 0x15aa8d5ULL, 0x1936c99ULL, 0x1562ab5ULL, 0x1326d93ULL },
+    { 0x15bd6a3ULL, 0x1f4f81eULL, 0x18ad7b5ULL, 0x0f03e5fULL },
+    { 0x14c3b1cULL, 0x00255fbULL, 0x071b865ULL, 0x1bf5480ULL },
+    { 0x14cb8cdULL, 0x0935db8ULL, 0x1663a65ULL, 0x03b7592ULL },
+    { 0x15d7848ULL, 0x10751bcULL, 0x0243d75ULL, 0x07b15c1ULL },
+    { 0x1555660ULL, 0x1655116ULL, 0x00cd555ULL, 0x0d1154dULL },
+    { 0x15d99b0ULL, 0x1a65959ULL, 0x01b3375ULL, 0x13534cbULL },
+    { 0x155db76ULL, 0x1a7d557ULL, 0x0ddb755ULL, 0x1d557cbULL },
+    { 0x15dc79bULL, 0x1d4c97fULL, 0x1b3c775ULL, 0x1fd2657ULL },
+    { 0x14e6c11ULL, 0x052619dULL, 0x1106ce5ULL, 0x1730c94ULL },
+    { 0x147d9caULL, 0x087f974ULL, 0x0a737c5ULL, 0x05d3fc2ULL },
+    { 0x1478337ULL, 0x0b4e553ULL, 0x1d983c5ULL, 0x1954e5aULL },
+    { 0x14ff474ULL, 0x0e5759dULL, 0x05c5fe5ULL, 0x1735d4eULL },
+    { 0x15f4ad3ULL, 0x117e91fULL, 0x196a5f5ULL, 0x1f12fd1ULL },
+    { 0x15f917bULL, 0x1b5f179ULL, 0x1bd13f5ULL, 0x13d1f5bULL },
+    { 0x15fdf48ULL, 0x1c7717eULL, 0x025f7f5ULL, 0x0fd1dc7ULL },
+    { 0x156cfecULL, 0x1e36d76ULL, 0x06fe6d5ULL, 0x0dd6d8fULL },
+    { 0x16838a4ULL, 0x02a5c98ULL, 0x04a382dULL, 0x03274a8ULL },
+    { 0x1687e89ULL, 0x05a58beULL, 0x122fc2dULL, 0x0fa34b4ULL },
+    { 0x169e194ULL, 0x08c4cddULL, 0x0530f2dULL, 0x1766462ULL },
+    { 0x170305aULL, 0x109d0b1ULL, 0x0b4181dULL, 0x11a1721ULL },
+    { 0x1797f11ULL, 0x15e50dfULL, 0x111fd3dULL, 0x1f614f5ULL },
+    { 0x1711c09ULL, 0x15e5030ULL, 0x120711dULL, 0x01814f5ULL },
+    { 0x178f051ULL, 0x199509dULL, 0x1141e3dULL, 0x1721533ULL },
+    { 0x1719087ULL, 0x19cdc10ULL, 0x1c2131dULL, 0x0107673ULL },
+    { 0x179e679ULL, 0x1fd40bfULL, 0x13ccf3dULL, 0x1fa057fULL },
+    { 0x16a2618ULL, 0x04860bbULL, 0x030c8adULL, 0x1ba0c24ULL },
+    { 0x1627ed4ULL, 0x04b7c97ULL, 0x056fc8dULL, 0x1d27da4ULL },
+    { 0x162caf7ULL, 0x0bbec17ULL, 0x1dea68dULL, 0x1d06fbaULL },
+    { 0x16397daULL, 0x0cdf873ULL, 0x0b7d38dULL, 0x19c3f66ULL },
+    { 0x16384cfULL, 0x0ddec30ULL, 0x1e6438dULL, 0x0186f76ULL },
+    { 0x162b5e5ULL, 0x0f97cd0ULL, 0x14f5a8dULL, 0x0167d3eULL },
+    { 0x16bdc3fULL, 0x0fef43dULL, 0x1f877adULL, 0x1785efeULL },
+    { 0x17320e1ULL, 0x13d6890ULL, 0x10e099dULL, 0x0122d79ULL },
+    { 0x1734681ULL, 0x15c6816ULL, 0x102c59dULL, 0x0d02c75ULL },
+    { 0x172f0b4ULL, 0x1a87c95ULL, 0x05a1e9dULL, 0x1527c2bULL },
+    { 0x173ef96ULL, 0x1ceecd7ULL, 0x0d3ef9dULL, 0x1d66ee7ULL },
+    { 0x16c0a03ULL, 0x01ac11aULL, 0x180a06dULL, 0x0b106b0ULL },
+    { 0x165ff84ULL, 0x0ce5dd6ULL, 0x043ff4dULL, 0x0d774e6ULL },
+    { 0x164f62aULL, 0x0e8d1b6ULL, 0x0a8de4dULL, 0x0db162eULL },
+    { 0x164dcb5ULL, 0x0fa5d15ULL, 0x15a764dULL, 0x15174beULL },
+    { 0x17d6be7ULL, 0x13fcddeULL, 0x1cfad7dULL, 0x0f767f9ULL },
+    { 0x1754f42ULL, 0x14fc156ULL, 0x085e55dULL, 0x0d507e5ULL },
+    { 0x174e415ULL, 0x1d84595ULL, 0x1504e5dULL, 0x1534437ULL },
+    { 0x1666080ULL, 0x0086994ULL, 0x0020ccdULL, 0x0532c20ULL },
+    { 0x16f6a69ULL, 0x03f61beULL, 0x12cadedULL, 0x0fb0df8ULL },
+    { 0x16ed298ULL, 0x088793fULL, 0x03296edULL, 0x1f93c22ULL },
+    { 0x16f8b82ULL, 0x08ee95aULL, 0x083a3edULL, 0x0b52ee2ULL },
+    { 0x166afbcULL, 0x0ea6df3ULL, 0x07beacdULL, 0x19f6caeULL },
+    { 0x176a9f6ULL, 0x1abedd1ULL, 0x0df2addULL, 0x1176fabULL },
+    { 0x17794d9ULL, 0x1dd7931ULL, 0x13653ddULL, 0x1193d77ULL },
+    { 0x177f7c3ULL, 0x1ddf9d6ULL, 0x187dfddULL, 0x0d73f77ULL },
+    { 0x17fed0dULL, 0x1de65fcULL, 0x1616ffdULL, 0x07f4cf7ULL },
+    { 0x1885af8ULL, 0x0231a3fULL, 0x03eb423ULL, 0x1f8b188ULL },
+    { 0x1903868ULL, 0x12312b0ULL, 0x02c3813ULL, 0x01a9189ULL },
+    { 0x19887cbULL, 0x1d18a7aULL, 0x1a7c233ULL, 0x0bca317ULL },
+    { 0x18a6b5dULL, 0x01326ffULL, 0x175aca3ULL, 0x1fec990ULL },
+    { 0x1832580ULL, 0x0442ad0ULL, 0x0034983ULL, 0x016a844ULL },
+    { 0x18a47eeULL, 0x061ae7eULL, 0x0efc4a3ULL, 0x0fceb0cULL },
+    { 0x1833ffcULL, 0x0673ef3ULL, 0x07ff983ULL, 0x19ef9ccULL },
+    { 0x182a8c2ULL, 0x083aa90ULL, 0x0862a83ULL, 0x012ab82ULL },
+    { 0x182af04ULL, 0x0c226d2ULL, 0x041ea83ULL, 0x096c886ULL },
+    { 0x1838e6fULL, 0x0f7a632ULL, 0x1ece383ULL, 0x098cbdeULL },
+    { 0x19319dfULL, 0x117be71ULL, 0x1f73193ULL, 0x11cfbd1ULL },
+    { 0x19be0deULL, 0x185aebdULL, 0x0f60fb3ULL, 0x17aeb43ULL },
+    { 0x192becfULL, 0x1d3beb2ULL, 0x1e6fa93ULL, 0x09afb97ULL },
+    { 0x192efe2ULL, 0x1e3aad6ULL, 0x08fee93ULL, 0x0d6ab8fULL },
+    { 0x19bc52bULL, 0x1f4a27cULL, 0x1a947b3ULL, 0x07c8a5fULL },
+    { 0x18d7e0fULL, 0x05697beULL, 0x1e0fd63ULL, 0x0fbd2d4ULL },
+    { 0x18d7f70ULL, 0x06713dfULL, 0x01dfd63ULL, 0x1f791ccULL },
+    { 0x18db793ULL, 0x0d49bdbULL, 0x193db63ULL, 0x1b7b256ULL },
+    { 0x1946310ULL, 0x10003d7ULL, 0x0118c53ULL, 0x1d78001ULL },
+    { 0x19dbc5bULL, 0x1d793b9ULL, 0x1b47b73ULL, 0x13b93d7ULL },
+    { 0x18ef059ULL, 0x09133bdULL, 0x1341ee3ULL, 0x17b9912ULL },
+    { 0x1975697ULL, 0x154bf17ULL, 0x1d2d5d3ULL, 0x1d1fa55ULL },
+    { 0x19e877eULL, 0x1e1a77bULL, 0x0fdc2f3ULL, 0x1bdcb0fULL },
+    { 0x1a15cadULL, 0x07e1e34ULL, 0x16a750bULL, 0x058f0fcULL },
+    { 0x1a0e666ULL, 0x0e98696ULL, 0x0ccce0bULL, 0x0d2c32eULL },
+    { 0x1b02930ULL, 0x12a02d1ULL, 0x019281bULL, 0x11680a9ULL },
+    { 0x1b8c13fULL, 0x1b8867dULL, 0x1f9063bULL, 0x17cc23bULL },
+    { 0x1aaeab0ULL, 0x0aa2a9fULL, 0x01aaeabULL, 0x1f2a8aaULL },
+    { 0x1a3c1aeULL, 0x0acae74ULL, 0x0eb078bULL, 0x05cea6aULL },
+    { 0x1abf762ULL, 0x0edb2deULL, 0x08ddfabULL, 0x0f69b6eULL },
+    { 0x1abb4e9ULL, 0x0fd3ab8ULL, 0x12e5babULL, 0x03ab97eULL },
+    { 0x1ba78e9ULL, 0x13b3abcULL, 0x12e3cbbULL, 0x07ab9b9ULL },
+    { 0x1bb2edaULL, 0x14faabbULL, 0x0b6e9bbULL, 0x1baabe5ULL },
+    { 0x1b23662ULL, 0x169b292ULL, 0x08cd89bULL, 0x0929b2dULL },
+    { 0x1b2c54cULL, 0x1c92674ULL, 0x065469bULL, 0x05cc927ULL },
+    { 0x1a556f9ULL, 0x07d1b37ULL, 0x13ed54bULL, 0x1d9b17cULL },
+    { 0x1a58bd8ULL, 0x08f0b73ULL, 0x037a34bULL, 0x19da1e2ULL },
+    { 0x1a594d4ULL, 0x0cd1f11ULL, 0x056534bULL, 0x111f166ULL },
+    { 0x1a4d7acULL, 0x0e81f76ULL, 0x06bd64bULL, 0x0ddf02eULL },
+    { 0x1bd3668ULL, 0x16d13baULL, 0x02cd97bULL, 0x0bb916dULL },
+    { 0x1bd253cULL, 0x16c07f9ULL, 0x079497bULL, 0x13fc06dULL },
+    { 0x1b4c1b1ULL, 0x1b80b55ULL, 0x11b065bULL, 0x155a03bULL },
+    { 0x1ae7365ULL, 0x03937deULL, 0x14d9cebULL, 0x0f7d938ULL },
+    { 0x1aebe4cULL, 0x0cb37baULL, 0x064faebULL, 0x0bbd9a6ULL },
+    { 0x1be0283ULL, 0x118ab1aULL, 0x18280fbULL, 0x0b1aa31ULL },
+    { 0x1bef21fULL, 0x198b7bfULL, 0x1f09efbULL, 0x1fbda33ULL },
+    { 0x1b7eee8ULL, 0x1ef2bb6ULL, 0x02eefdbULL, 0x0dba9efULL },
+    { 0x1c0869fULL, 0x0d0ce33ULL, 0x1f2c207ULL, 0x198e616ULL },
+    { 0x1c18dc6ULL, 0x0c7ce50ULL, 0x0c76307ULL, 0x014e7c6ULL },
+    { 0x1d8717bULL, 0x131d2fdULL, 0x1bd1c37ULL, 0x17e9719ULL },
+    { 0x1d8a3faULL, 0x1a1cafbULL, 0x0bf8a37ULL, 0x1bea70bULL },
+    { 0x1cb1a48ULL, 0x007723aULL, 0x024b1a7ULL, 0x0b89dc0ULL },
+    { 0x1ca0af3ULL, 0x033ea1bULL, 0x19ea0a7ULL, 0x1b0af98ULL },
+    { 0x1c29df0ULL, 0x0e37a51ULL, 0x01f7287ULL, 0x114bd8eULL },
+    { 0x1caafb9ULL, 0x0f26afbULL, 0x13beaa7ULL, 0x1beac9eULL },
+    { 0x1c3efe5ULL, 0x0f76ed6ULL, 0x14fef87ULL, 0x0d6eddeULL },
+    { 0x1c50a9aULL, 0x006cb33ULL, 0x0b2a147ULL, 0x199a6c0ULL },
+    { 0x1c43034ULL, 0x0205791ULL, 0x0581847ULL, 0x113d408ULL },
+    { 0x1c45796ULL, 0x040df57ULL, 0x0d3d447ULL, 0x1d5f604ULL },
+    { 0x1cdd804ULL, 0x086571cULL, 0x0403767ULL, 0x071d4c2ULL },
+    { 0x1ccc502ULL, 0x0c0c35cULL, 0x0814667ULL, 0x0758606ULL },
+    { 0x1d44c80ULL, 0x1424b14ULL, 0x0026457ULL, 0x051a485ULL },
+    { 0x1d5c188ULL, 0x1844b74ULL, 0x0230757ULL, 0x05da443ULL },
+    { 0x1d4e529ULL, 0x1f043f4ULL, 0x1294e57ULL, 0x05f841fULL },
+    { 0x1c6227fULL, 0x031e7b3ULL, 0x1fc88c7ULL, 0x19bcf18ULL },
+    { 0x1ce17cdULL, 0x0517f7aULL, 0x167d0e7ULL, 0x0bdfd14ULL },
+    { 0x1c6c9e3ULL, 0x0b3eb54ULL, 0x18f26c7ULL, 0x055af9aULL },
+    { 0x1cff5c5ULL, 0x0d57fdcULL, 0x1475fe7ULL, 0x077fd56ULL },
+    { 0x1c7b7e6ULL, 0x0e5ffd2ULL, 0x0cfdbc7ULL, 0x097ff4eULL },
+    { 0x1df0ec4ULL, 0x1476f1aULL, 0x046e1f7ULL, 0x0b1edc5ULL },
+    { 0x1debae0ULL, 0x1a37b9aULL, 0x00ebaf7ULL, 0x0b3bd8bULL },
+    { 0x1d6cc1cULL, 0x1c26735ULL, 0x07066d7ULL, 0x159cc87ULL },
+    { 0x1de9478ULL, 0x1e17339ULL, 0x03c52f7ULL, 0x1399d0fULL },
+    { 0x1e16443ULL, 0x05dc294ULL, 0x1844d0fULL, 0x0528774ULL },
+    { 0x1e15e9eULL, 0x04ede37ULL, 0x0f2f50fULL, 0x1d8f6e4ULL },
+    { 0x1e93e79ULL, 0x07f52bbULL, 0x13cf92fULL, 0x1ba95fcULL },
+    { 0x1e1ea08ULL, 0x08e42b6ULL, 0x020af0fULL, 0x0da84e2ULL },
+    { 0x1e1e4f0ULL, 0x0ed4a95ULL, 0x01e4f0fULL, 0x152a56eULL },
+    { 0x1f068c6ULL, 0x10bce94ULL, 0x0c62c1fULL, 0x052e7a1ULL },
+    { 0x1f9b71eULL, 0x1ccd6fbULL, 0x0f1db3fULL, 0x1bed667ULL },
+    { 0x1f9fc9bULL, 0x1dedabdULL, 0x1b27f3fULL, 0x17ab6f7ULL },
+    { 0x1fb608bULL, 0x11ceabcULL, 0x1a20dbfULL, 0x07aae71ULL },
+    { 0x1fa67d6ULL, 0x149eedfULL, 0x0d7ccbfULL, 0x1f6ef25ULL },
+    { 0x1f389b3ULL, 0x1beea51ULL, 0x19b239fULL, 0x114aefbULL },
+    { 0x1e44723ULL, 0x078c356ULL, 0x189c44fULL, 0x0d5863cULL },
+    { 0x1eda5f7ULL, 0x0fdcfd9ULL, 0x1df4b6fULL, 0x137e77eULL },
+    { 0x1fddfa7ULL, 0x1fedf5eULL, 0x1cbf77fULL, 0x0f5f6ffULL },
+    { 0x1e76075ULL, 0x03d6795ULL, 0x15c0dcfULL, 0x153cd78ULL },
+    { 0x1ef149bULL, 0x05cfb39ULL, 0x1b251efULL, 0x139be74ULL },
+    { 0x1e71f3bULL, 0x07ef373ULL, 0x1b9f1cfULL, 0x19d9efcULL },
+    { 0x1efe44eULL, 0x0cde7bcULL, 0x0e44fefULL, 0x07bcf66ULL },
+    { 0x1ff7b0bULL, 0x11ef3feULL, 0x1a1bdffULL, 0x0ff9ef1ULL },
+    { 0x1fe4d8bULL, 0x15aeb7cULL, 0x1a364ffULL, 0x07daeb5ULL },
+    { 0x1f7c0c2ULL, 0x18deb14ULL, 0x08607dfULL, 0x051af63ULL },
+    { 0x1ffb834ULL, 0x1ae7799ULL, 0x0583bffULL, 0x133dcebULL },
+    { 0x033f0c7ULL, 0x19dbc84ULL, 0x1c61f98ULL, 0x0427b73ULL },
+    { 0x152ba3fULL, 0x1b2f4b3ULL, 0x1f8ba95ULL, 0x19a5e9bULL },
+    { 0x0017091ULL, 0x0141885ULL, 0x1121d00ULL, 0x1423050ULL },
+    { 0x001d9c2ULL, 0x0879844ULL, 0x0873700ULL, 0x04433c2ULL },
+    { 0x010c2ccULL, 0x1810c26ULL, 0x0668610ULL, 0x0c86103ULL },
+    { 0x011e906ULL, 0x18684c4ULL, 0x0c12f10ULL, 0x04642c3ULL },
+    { 0x019f13aULL, 0x1a490edULL, 0x0b91f30ULL, 0x16e124bULL },
+    { 0x011807dULL, 0x1b50421ULL, 0x17c0310ULL, 0x108415bULL },
+    { 0x0027380ULL, 0x00038c6ULL, 0x0039c80ULL, 0x0c63800ULL },
+    { 0x0025014ULL, 0x0003405ULL, 0x0501480ULL, 0x1405800ULL },
+    { 0x0037d67ULL, 0x077b4c4ULL, 0x1cd7d80ULL, 0x0465bdcULL },
+    { 0x01b00aaULL, 0x124a828ULL, 0x0aa01b0ULL, 0x0282a49ULL },
+    { 0x01b5ec7ULL, 0x157bc0eULL, 0x1c6f5b0ULL, 0x0e07bd5ULL },
+    { 0x00d6bd8ULL, 0x00709efULL, 0x037ad60ULL, 0x1ef21c0ULL },
+    { 0x005326dULL, 0x03515a2ULL, 0x16c9940ULL, 0x08b5158ULL },
+    { 0x00d6d1eULL, 0x04685edULL, 0x0f16d60ULL, 0x16f42c4ULL },
+    { 0x00cfa81ULL, 0x092198eULL, 0x102be60ULL, 0x0e33092ULL },
+    { 0x004e4d1ULL, 0x0d10985ULL, 0x1164e40ULL, 0x1432116ULL },
+    { 0x00d97dbULL, 0x0d5996bULL, 0x1b7d360ULL, 0x1ad3356ULL },
+    { 0x01c1e7aULL, 0x163912bULL, 0x0bcf070ULL, 0x1a9138dULL },
+    { 0x01dab96ULL, 0x1868dcbULL, 0x0d3ab70ULL, 0x1a762c3ULL },
+    { 0x006fa4fULL, 0x093b5a6ULL, 0x1e4bec0ULL, 0x0cb5b92ULL },
+    { 0x007d31eULL, 0x084b567ULL, 0x0f197c0ULL, 0x1cd5a42ULL },
+    { 0x00ff53fULL, 0x0f4b5edULL, 0x1f95fe0ULL, 0x16f5a5eULL },
+    { 0x0169820ULL, 0x1a23100ULL, 0x00832d0ULL, 0x001188bULL },
+    { 0x02172afULL, 0x03c9ca6ULL, 0x1ea9d08ULL, 0x0ca7278ULL },
+    { 0x0202c52ULL, 0x04b8081ULL, 0x0946808ULL, 0x10203a4ULL },
+    { 0x020c517ULL, 0x0d88445ULL, 0x1d14608ULL, 0x1444236ULL },
+    { 0x0313b6cULL, 0x12f14e2ULL, 0x06db918ULL, 0x08e51e9ULL },
+    { 0x030da01ULL, 0x19a1006ULL, 0x100b618ULL, 0x0c010b3ULL },
+    { 0x038ec54ULL, 0x1cb048dULL, 0x0546e38ULL, 0x16241a7ULL },
+    { 0x030bfc9ULL, 0x1db18e2ULL, 0x127fa18ULL, 0x08e31b7ULL },
+    { 0x038842cULL, 0x1e80428ULL, 0x0684238ULL, 0x028402fULL },
+    { 0x0227952ULL, 0x00bb0c5ULL, 0x0953c88ULL, 0x1461ba0ULL },
+    { 0x0233073ULL, 0x03db081ULL, 0x19c1988ULL, 0x1021b78ULL },
+    { 0x02a74c6ULL, 0x049bc8cULL, 0x0c65ca8ULL, 0x0627b24ULL },
+    { 0x02a24ebULL, 0x079a8a8ULL, 0x1ae48a8ULL, 0x02a2b3cULL },
+    { 0x02bbd44ULL, 0x0cf34c8ULL, 0x0457ba8ULL, 0x02659e6ULL },
+    { 0x02ad431ULL, 0x0f8300dULL, 0x11856a8ULL, 0x160183eULL },
+    { 0x03ba250ULL, 0x18d208bULL, 0x0148bb8ULL, 0x1a20963ULL },
+    { 0x03ae329ULL, 0x1b820eeULL, 0x1298eb8ULL, 0x0ee083bULL },
+    { 0x0247317ULL, 0x01895c7ULL, 0x1d19c48ULL, 0x1c75230ULL },
+    { 0x0240b30ULL, 0x02a0143ULL, 0x019a048ULL, 0x18500a8ULL },
+    { 0x02c0531ULL, 0x0780149ULL, 0x1194068ULL, 0x125003cULL },
+    { 0x03468ffULL, 0x13b8da5ULL, 0x1fe2c58ULL, 0x14b63b9ULL },
+    { 0x03db9dfULL, 0x19f9de9ULL, 0x1f73b78ULL, 0x12f73f3ULL },
+    { 0x03ce0e6ULL, 0x1a98d8cULL, 0x0ce0e78ULL, 0x063632bULL },
+    { 0x034872aULL, 0x1e88162ULL, 0x0a9c258ULL, 0x08d022fULL },
+    { 0x034fc37ULL, 0x1fa9585ULL, 0x1d87e58ULL, 0x14352bfULL },
+    { 0x02f5b84ULL, 0x00e3d4eULL, 0x043b5e8ULL, 0x0e578e0ULL },
+    { 0x02633bdULL, 0x0383de3ULL, 0x17b98c8ULL, 0x18f7838ULL },
+    { 0x0375127ULL, 0x13cb544ULL, 0x1c915d8ULL, 0x0455a79ULL },
+    { 0x0372693ULL, 0x15ca983ULL, 0x192c9d8ULL, 0x1832a75ULL },
+    { 0x037a036ULL, 0x1aca581ULL, 0x0d80bd8ULL, 0x1034a6bULL },
+    { 0x03e85b7ULL, 0x1f8ad49ULL, 0x1db42f8ULL, 0x1256a3fULL },
+    { 0x0417354ULL, 0x00554c7ULL, 0x0559d04ULL, 0x1c65540ULL },
+    { 0x0498974ULL, 0x0a74449ULL, 0x05d2324ULL, 0x12445caULL },
+    { 0x0515a0aULL, 0x106d026ULL, 0x0a0b514ULL, 0x0c816c1ULL },
+    { 0x05846c9ULL, 0x151482eULL, 0x126c434ULL, 0x0e82515ULL },
+    { 0x0581d35ULL, 0x1725449ULL, 0x1597034ULL, 0x124549dULL },
+    { 0x058a207ULL, 0x190c48aULL, 0x1c08a34ULL, 0x0a24613ULL },
+    { 0x04b8b9fULL, 0x096ec6bULL, 0x1f3a3a4ULL, 0x1ac6ed2ULL },
+    { 0x04b91a7ULL, 0x0b4fc48ULL, 0x1cb13a4ULL, 0x0247e5aULL },
+    { 0x042efd1ULL, 0x0d368c7ULL, 0x117ee84ULL, 0x1c62d96ULL },
+    { 0x0451bb5ULL, 0x0365d43ULL, 0x15bb144ULL, 0x18574d8ULL },
+    { 0x04415dcULL, 0x0415d61ULL, 0x0775044ULL, 0x10d7504ULL },
+    { 0x05d0c58ULL, 0x1474129ULL, 0x0346174ULL, 0x12905c5ULL },
+    { 0x0556c5fULL, 0x157c5a5ULL, 0x1f46d54ULL, 0x14b47d5ULL },
+    { 0x04e785aULL, 0x003f1adULL, 0x0b43ce4ULL, 0x16b1f80ULL },
+    { 0x04f3a94ULL, 0x0067d8bULL, 0x052b9e4ULL, 0x1a37cc0ULL },
+    { 0x04f360fULL, 0x054f5aaULL, 0x1e0d9e4ULL, 0x0ab5e54ULL },
+    { 0x046af08ULL, 0x0c261e2ULL, 0x021eac4ULL, 0x08f0c86ULL },
+    { 0x0469c87ULL, 0x0d2fd00ULL, 0x1c272c4ULL, 0x0017e96ULL },
+    { 0x05f5773ULL, 0x175f14fULL, 0x19dd5f4ULL, 0x1e51f5dULL },
+    { 0x061605dULL, 0x01d44a5ULL, 0x1740d0cULL, 0x14a4570ULL },
+    { 0x06050f4ULL, 0x0295c05ULL, 0x05e140cULL, 0x1407528ULL },
+    { 0x069fb41ULL, 0x09f50ceULL, 0x105bf2cULL, 0x0e615f2ULL },
+    { 0x079ad12ULL, 0x1cec0c9ULL, 0x0916b3cULL, 0x12606e7ULL },
+    { 0x070fd6cULL, 0x1eb54e4ULL, 0x06d7e1cULL, 0x04e55afULL },
+    { 0x06200daULL, 0x009e821ULL, 0x0b6008cULL, 0x1082f20ULL },
+    { 0x0622fb7ULL, 0x07aecc3ULL, 0x1dbe88cULL, 0x1866ebcULL },
+    { 0x0634eefULL, 0x07fec26ULL, 0x1eee58cULL, 0x0c86ffcULL },
+    { 0x07b0015ULL, 0x11c6409ULL, 0x15001bcULL, 0x1204c71ULL },
+    { 0x07bc53aULL, 0x1ece06dULL, 0x0b947bcULL, 0x16c0e6fULL },
+    { 0x06cd4efULL, 0x0f9dd2cULL, 0x1ee566cULL, 0x069773eULL },
+    { 0x06d8f7dULL, 0x0ff456bULL, 0x17de36cULL, 0x1ad45feULL },
+    { 0x07d7652ULL, 0x14dd18fULL, 0x094dd7cULL, 0x1e31765ULL },
+    { 0x07cd134ULL, 0x1a8554dULL, 0x059167cULL, 0x165542bULL },
+    { 0x07cbe05ULL, 0x1da558aULL, 0x140fa7cULL, 0x0a354b7ULL },
+    { 0x074ad9dULL, 0x1da4de1ULL, 0x1736a5cULL, 0x10f64b7ULL },
+    { 0x07cbff8ULL, 0x1eb59ebULL, 0x03ffa7cULL, 0x1af35afULL },
+    { 0x0677358ULL, 0x00d71e7ULL, 0x0359dccULL, 0x1cf1d60ULL },
+    { 0x066a95cULL, 0x08b65e1ULL, 0x0752accULL, 0x10f4da2ULL },
+    { 0x07e3340ULL, 0x10971caULL, 0x00598fcULL, 0x0a71d21ULL },
+    { 0x0775ac3ULL, 0x11ff906ULL, 0x186b5dcULL, 0x0c13ff1ULL },
+    { 0x076e05fULL, 0x199e5a5ULL, 0x1f40edcULL, 0x14b4f33ULL },
+    { 0x077d675ULL, 0x1fd7507ULL, 0x15cd7dcULL, 0x1c15d7fULL },
+    { 0x080a6b4ULL, 0x0e00e83ULL, 0x05aca02ULL, 0x182e00eULL },
+    { 0x083302cULL, 0x02436a0ULL, 0x0681982ULL, 0x00ad848ULL },
+    { 0x0831f62ULL, 0x067b242ULL, 0x08df182ULL, 0x0849bccULL },
+    { 0x08bb243ULL, 0x095b28aULL, 0x1849ba2ULL, 0x0a29b52ULL },
+    { 0x08bd602ULL, 0x0c4b20eULL, 0x080d7a2ULL, 0x0e09a46ULL },
+    { 0x0933aa4ULL, 0x1263e82ULL, 0x04ab992ULL, 0x082f8c9ULL },
+    { 0x084709fULL, 0x0109fa5ULL, 0x1f21c42ULL, 0x14bf210ULL },
+    { 0x0954d47ULL, 0x1578744ULL, 0x1c56552ULL, 0x045c3d5ULL },
+    { 0x0958a55ULL, 0x1970703ULL, 0x154a352ULL, 0x181c1d3ULL },
+    { 0x09590e6ULL, 0x1a59f00ULL, 0x0ce1352ULL, 0x001f34bULL },
+    { 0x08f698dULL, 0x0162fecULL, 0x1632de2ULL, 0x06fe8d0ULL },
+    { 0x08726baULL, 0x064aba3ULL, 0x0bac9c2ULL, 0x18baa4cULL },
+    { 0x086f0eaULL, 0x0a1bba4ULL, 0x0ae1ec2ULL, 0x04bbb0aULL },
+    { 0x09e755fULL, 0x151b7edULL, 0x1f55cf2ULL, 0x16fdb15ULL },
+    { 0x09f0e89ULL, 0x1562b2aULL, 0x122e1f2ULL, 0x0a9a8d5ULL },
+    { 0x09f0fbeULL, 0x166af6bULL, 0x0fbe1f2ULL, 0x1adeacdULL },
+    { 0x09f89bdULL, 0x1b62f69ULL, 0x17b23f2ULL, 0x12de8dbULL },
+    { 0x0a83e8eULL, 0x04a9eaaULL, 0x0e2f82aULL, 0x0aaf2a4ULL },
+    { 0x0a03f28ULL, 0x06a12e2ULL, 0x029f80aULL, 0x08e90acULL },
+    { 0x0b92286ULL, 0x10c8e8aULL, 0x0c2893aULL, 0x0a2e261ULL },
+    { 0x0b17bdfULL, 0x11f9ee7ULL, 0x1f7bd1aULL, 0x1cef3f1ULL },
+    { 0x0b9ba0fULL, 0x19e96aaULL, 0x1e0bb3aULL, 0x0aad2f3ULL },
+    { 0x0b8ccb1ULL, 0x1fa0a0dULL, 0x11a663aULL, 0x160a0bfULL },
+    { 0x0b9b665ULL, 0x1fd168aULL, 0x14cdb3aULL, 0x0a2d17fULL },
+    { 0x0aa8ba8ULL, 0x0aa2a6aULL, 0x02ba2aaULL, 0x0aca8aaULL },
+    { 0x0a2887cULL, 0x0ab2621ULL, 0x07c228aULL, 0x108c9aaULL },
+    { 0x0a3cfccULL, 0x0cf2e66ULL, 0x067e78aULL, 0x0cce9e6ULL },
+    { 0x0b2174eULL, 0x149b662ULL, 0x0e5d09aULL, 0x08cdb25ULL },
+    { 0x0bb7471ULL, 0x17d328dULL, 0x11c5dbaULL, 0x162997dULL },
+    { 0x0bb4c6fULL, 0x17fa62cULL, 0x1ec65baULL, 0x068cbfdULL },
+    { 0x0b3f32aULL, 0x1acb2e6ULL, 0x0a99f9aULL, 0x0ce9a6bULL },
+    { 0x0bbffd8ULL, 0x1cf3aefULL, 0x037ffbaULL, 0x1eeb9e7ULL },
+    { 0x0a53a74ULL, 0x02f1783ULL, 0x05cb94aULL, 0x183d1e8ULL },
+    { 0x0ac752eULL, 0x06897ecULL, 0x0e95c6aULL, 0x06fd22cULL },
+    { 0x0a4c644ULL, 0x0c90706ULL, 0x044c64aULL, 0x0c1c126ULL },
+    { 0x0a59663ULL, 0x0fd9302ULL, 0x18cd34aULL, 0x081937eULL },
+    { 0x0b51799ULL, 0x15c1b63ULL, 0x133d15aULL, 0x18db075ULL },
+    { 0x0a642d4ULL, 0x0092f07ULL, 0x05684caULL, 0x1c1e920ULL },
+    { 0x0afea22ULL, 0x0aea38eULL, 0x088afeaULL, 0x0e38aeaULL },
+    { 0x0bfb842ULL, 0x18fb388ULL, 0x0843bfaULL, 0x0239be3ULL },
+    { 0x0c11838ULL, 0x0265221ULL, 0x0383106ULL, 0x10894c8ULL },
+    { 0x0c145abULL, 0x074ca64ULL, 0x1ab4506ULL, 0x04ca65cULL },
+    { 0x0c1bc0bULL, 0x0d6d2a0ULL, 0x1a07b06ULL, 0x00a96d6ULL },
+    { 0x0d898dcULL, 0x1835e29ULL, 0x0763236ULL, 0x128f583ULL },
+    { 0x0d0a418ULL, 0x1c042a1ULL, 0x0304a16ULL, 0x10a8407ULL },
+    { 0x0ca774eULL, 0x041f6eeULL, 0x0e5dca6ULL, 0x0eedf04ULL },
+    { 0x0c355d4ULL, 0x0457e45ULL, 0x0575586ULL, 0x144fd44ULL },
+    { 0x0cae2ddULL, 0x0916eafULL, 0x1768ea6ULL, 0x1eaed12ULL },
+    { 0x0caf8b3ULL, 0x0b2fa8dULL, 0x19a3ea6ULL, 0x162be9aULL },
+    { 0x0d3065dULL, 0x1556623ULL, 0x174c196ULL, 0x188cd55ULL },
+    { 0x0db8818ULL, 0x1866229ULL, 0x03023b6ULL, 0x1288cc3ULL },
+    { 0x0dba429ULL, 0x1f462a8ULL, 0x1284bb6ULL, 0x02a8c5fULL },
+    { 0x0c52d4bULL, 0x057c3e0ULL, 0x1a56946ULL, 0x00f87d4ULL },
+    { 0x0c4ea4dULL, 0x09347a6ULL, 0x164ae46ULL, 0x0cbc592ULL },
+    { 0x0c4c9adULL, 0x0b24f64ULL, 0x16b2646ULL, 0x04de49aULL },
+    { 0x0c4b7b9ULL, 0x0f05be3ULL, 0x13bda46ULL, 0x18fb41eULL },
+    { 0x0dc6605ULL, 0x150478eULL, 0x140cc76ULL, 0x0e3c415ULL },
+    { 0x0dcb512ULL, 0x1c0d3c9ULL, 0x0915a76ULL, 0x1279607ULL },
+    { 0x0c7a3a8ULL, 0x0a46be2ULL, 0x02b8bc6ULL, 0x08fac4aULL },
+    { 0x0c69703ULL, 0x0d0f342ULL, 0x181d2c6ULL, 0x0859e16ULL },
+    { 0x0d67123ULL, 0x130f3c4ULL, 0x1891cd6ULL, 0x0479e19ULL },
+    { 0x0d6f454ULL, 0x1c17785ULL, 0x0545ed6ULL, 0x143dd07ULL },
+    { 0x0e87066ULL, 0x029d68cULL, 0x0cc1c2eULL, 0x062d728ULL },
+    { 0x0e00c58ULL, 0x04b4221ULL, 0x034600eULL, 0x10885a4ULL },
+    { 0x0e9551bULL, 0x05cd26dULL, 0x1b1552eULL, 0x16c9674ULL },
+    { 0x0e8991eULL, 0x08ad669ULL, 0x0f1322eULL, 0x12cd6a2ULL },
+    { 0x0f96f4eULL, 0x14fc6eeULL, 0x0e5ed3eULL, 0x0eec7e5ULL },
+    { 0x0f0062dULL, 0x1784622ULL, 0x168c01eULL, 0x088c43dULL },
+    { 0x0f98f8dULL, 0x1de4e6aULL, 0x163e33eULL, 0x0ace4f7ULL },
+    { 0x0eb6c09ULL, 0x05e62acULL, 0x1206daeULL, 0x06a8cf4ULL },
+    { 0x0e3fccaULL, 0x0cffaa4ULL, 0x0a67f8eULL, 0x04abfe6ULL },
+    { 0x0e29f35ULL, 0x0fa7643ULL, 0x159f28eULL, 0x184dcbeULL },
+    { 0x0f240eeULL, 0x129ee24ULL, 0x0ee049eULL, 0x048ef29ULL },
+    { 0x0faf39aULL, 0x188faefULL, 0x0b39ebeULL, 0x1eebe23ULL },
+    { 0x0fa86b8ULL, 0x1e86a2bULL, 0x03ac2beULL, 0x1a8ac2fULL },
+    { 0x0fafe76ULL, 0x1ebf68fULL, 0x0dcfebeULL, 0x1e2dfafULL },
+    { 0x0ecaa10ULL, 0x08a438bULL, 0x010aa6eULL, 0x1a384a2ULL },
+    { 0x0f5318eULL, 0x10cdfe0ULL, 0x0e3195eULL, 0x00ff661ULL },
+    { 0x0fc2780ULL, 0x1484bcaULL, 0x003c87eULL, 0x0a7a425ULL },
+    { 0x0fcbcb3ULL, 0x1fadb89ULL, 0x19a7a7eULL, 0x123b6bfULL },
+    { 0x0e64908ULL, 0x00a6364ULL, 0x02124ceULL, 0x04d8ca0ULL },
+    { 0x0e65c4fULL, 0x05bf724ULL, 0x1e474ceULL, 0x049dfb4ULL },
+    { 0x0e716a9ULL, 0x07c7b22ULL, 0x12ad1ceULL, 0x089bc7cULL },
+    { 0x1080844ULL, 0x0030418ULL, 0x0442021ULL, 0x0304180ULL },
+    { 0x101d05cULL, 0x0851435ULL, 0x0741701ULL, 0x1585142ULL },
+    { 0x101da60ULL, 0x0a71016ULL, 0x00cb701ULL, 0x0d011caULL },
+    { 0x1186ac0ULL, 0x103089eULL, 0x006ac31ULL, 0x0f22181ULL },
+    { 0x118f1e1ULL, 0x1b118dcULL, 0x10f1e31ULL, 0x076311bULL },
+    { 0x1118501ULL, 0x1d40050ULL, 0x1014311ULL, 0x0140057ULL },
+    { 0x10234c9ULL, 0x05138b0ULL, 0x1265881ULL, 0x01a3914ULL },
+    { 0x1024d46ULL, 0x043a454ULL, 0x0c56481ULL, 0x0544b84ULL },
+    { 0x10b3519ULL, 0x05430f9ULL, 0x13159a1ULL, 0x13e1854ULL },
+    { 0x112262fULL, 0x170a4b2ULL, 0x1e8c891ULL, 0x09a4a1dULL },
+    { 0x104124aULL, 0x0019132ULL, 0x0a49041ULL, 0x0991300ULL },
+    { 0x1056f93ULL, 0x05689d7ULL, 0x193ed41ULL, 0x1d722d4ULL },
+    { 0x11d737fULL, 0x13595ffULL, 0x1fd9d71ULL, 0x1ff5359ULL },
+    { 0x1153fd8ULL, 0x14719f3ULL, 0x037f951ULL, 0x19f31c5ULL },
+    { 0x11dc9c4ULL, 0x1870d5cULL, 0x0472771ULL, 0x07561c3ULL },
+    { 0x10e41d0ULL, 0x001295dULL, 0x01704e1ULL, 0x1752900ULL },
+    { 0x10f9ac1ULL, 0x097391aULL, 0x106b3e1ULL, 0x0b139d2ULL },
+    { 0x10e8f59ULL, 0x0d3217bULL, 0x135e2e1ULL, 0x1bd0996ULL },
+    { 0x11614b6ULL, 0x160bd11ULL, 0x0da50d1ULL, 0x1117a0dULL },
+    { 0x116b97dULL, 0x1b335f1ULL, 0x17d3ad1ULL, 0x11f599bULL },
+    { 0x11fab68ULL, 0x1a721faULL, 0x02dabf1ULL, 0x0bf09cbULL },
+    { 0x116ec52ULL, 0x1c3a195ULL, 0x0946ed1ULL, 0x1530b87ULL },
+    { 0x128675eULL, 0x04984ffULL, 0x0f5cc29ULL, 0x1fe4324ULL },
+    { 0x120aa91ULL, 0x09a0893ULL, 0x112aa09ULL, 0x19220b2ULL },
+    { 0x1387c4eULL, 0x14b94bcULL, 0x0e47c39ULL, 0x07a53a5ULL },
+    { 0x1312f3eULL, 0x16e84f3ULL, 0x0f9e919ULL, 0x19e42edULL },
+    { 0x130b121ULL, 0x1b810d0ULL, 0x1091a19ULL, 0x016103bULL },
+    { 0x12b6c3eULL, 0x06ea4bdULL, 0x0f86da9ULL, 0x17a4aecULL },
+    { 0x122806eULL, 0x0a9a430ULL, 0x0ec0289ULL, 0x0184b2aULL },
+    { 0x13b6700ULL, 0x14c20deULL, 0x001cdb9ULL, 0x0f60865ULL },
+    { 0x1328313ULL, 0x198a053ULL, 0x1918299ULL, 0x1940a33ULL },
+    { 0x1255a4cULL, 0x00f1536ULL, 0x064b549ULL, 0x0d951e0ULL },
+    { 0x124cbc9ULL, 0x09b0976ULL, 0x127a649ULL, 0x0dd21b2ULL },
+    { 0x124df1bULL, 0x0da9177ULL, 0x1b1f649ULL, 0x1dd12b6ULL },
+    { 0x12cbd32ULL, 0x0ea91d9ULL, 0x0997a69ULL, 0x13712aeULL },
+    { 0x134169aULL, 0x1489933ULL, 0x0b2d059ULL, 0x1993225ULL },
+    { 0x135ba22ULL, 0x1ae9192ULL, 0x088bb59ULL, 0x09312ebULL },
+    { 0x127ed39ULL, 0x0fe21f5ULL, 0x1396fc9ULL, 0x15f08feULL },
+    { 0x13e697bULL, 0x13ba1fdULL, 0x1bd2cf9ULL, 0x17f0bb9ULL },
+    { 0x13ea012ULL, 0x188a199ULL, 0x0900af9ULL, 0x1330a23ULL },
+    { 0x1413237ULL, 0x034d493ULL, 0x1d89905ULL, 0x1925658ULL },
+    { 0x1481fd4ULL, 0x0435c5bULL, 0x057f025ULL, 0x1b47584ULL },
+    { 0x1401ea7ULL, 0x072dc12ULL, 0x1caf005ULL, 0x090769cULL },
+    { 0x15004d3ULL, 0x151c811ULL, 0x1964015ULL, 0x1102715ULL },
+    { 0x158379bULL, 0x150d8fbULL, 0x1b3d835ULL, 0x1be3615ULL },
+    { 0x1590e9aULL, 0x146c83bULL, 0x0b2e135ULL, 0x1b826c5ULL },
+    { 0x158ed90ULL, 0x1c248ddULL, 0x0136e35ULL, 0x1762487ULL },
+    { 0x14a894eULL, 0x083e478ULL, 0x0e522a5ULL, 0x03c4f82ULL },
+    { 0x143e8b8ULL, 0x0a668b5ULL, 0x03a2f85ULL, 0x15a2ccaULL },
+    { 0x1533b52ULL, 0x107f0d3ULL, 0x095b995ULL, 0x1961fc1ULL },
+    { 0x1530ffeULL, 0x167ec73ULL, 0x0ffe195ULL, 0x19c6fcdULL },
+    { 0x1528ec5ULL, 0x1d36c12ULL, 0x146e295ULL, 0x0906d97ULL },
+    { 0x14d02e5ULL, 0x0354d1aULL, 0x14e8165ULL, 0x0b16558ULL },
+    { 0x14df359ULL, 0x09551ffULL, 0x1359f65ULL, 0x1ff1552ULL },
+    { 0x145884cULL, 0x0874530ULL, 0x0642345ULL, 0x01945c2ULL },
+    { 0x1546acbULL, 0x113c9b6ULL, 0x1a6ac55ULL, 0x0db2791ULL },
+    { 0x15550ccULL, 0x1055d34ULL, 0x0661555ULL, 0x0597541ULL },
+    { 0x155911eULL, 0x184d571ULL, 0x0f11355ULL, 0x11d5643ULL },
+    { 0x14edd29ULL, 0x0f2717cULL, 0x12976e5ULL, 0x07d1c9eULL },
+    { 0x15e0849ULL, 0x1136138ULL, 0x12420f5ULL, 0x0390d91ULL },
+    { 0x1608258ULL, 0x0894033ULL, 0x034820dULL, 0x1980522ULL },
+    { 0x161a1c6ULL, 0x08dccd0ULL, 0x0c70b0dULL, 0x0166762ULL },
+    { 0x161db03ULL, 0x09ed056ULL, 0x181b70dULL, 0x0d416f2ULL },
+    { 0x169cfd8ULL, 0x0cf487fULL, 0x037e72dULL, 0x1fc25e6ULL },
+    { 0x17141d9ULL, 0x11d4875ULL, 0x137051dULL, 0x15c2571ULL },
+    { 0x1717879ULL, 0x13f50b5ULL, 0x13c3d1dULL, 0x15a15f9ULL },
+    { 0x162cdc1ULL, 0x0db6854ULL, 0x107668dULL, 0x0542db6ULL },
+    { 0x17a6215ULL, 0x118649fULL, 0x1508cbdULL, 0x1f24c31ULL },
+    { 0x17a7f75ULL, 0x17b74dfULL, 0x15dfcbdULL, 0x1f65dbdULL },
+    { 0x1737db8ULL, 0x16e78f5ULL, 0x03b7d9dULL, 0x15e3cedULL },
+    { 0x16475e1ULL, 0x07959d4ULL, 0x10f5c4dULL, 0x057353cULL },
+    { 0x16d9f52ULL, 0x0cfd15bULL, 0x095f36dULL, 0x1b517e6ULL },
+    { 0x17447c5ULL, 0x1594d56ULL, 0x147c45dULL, 0x0d56535ULL },
+    { 0x16e4957ULL, 0x01be55dULL, 0x1d524edULL, 0x1754fb0ULL },
+    { 0x16e53f6ULL, 0x029fd5fULL, 0x0df94edULL, 0x1f57f28ULL },
+    { 0x1675c10ULL, 0x04e7115ULL, 0x01075cdULL, 0x1511ce4ULL },
+    { 0x16ead95ULL, 0x0da6dd9ULL, 0x1536aedULL, 0x1376cb6ULL },
+    { 0x17f51e8ULL, 0x12d797cULL, 0x02f15fdULL, 0x07d3d69ULL },
+    { 0x17f2825ULL, 0x13e6598ULL, 0x14829fdULL, 0x0334cf9ULL },
+    { 0x17ef481ULL, 0x1d8799cULL, 0x1025efdULL, 0x0733c37ULL },
+    { 0x1890b90ULL, 0x0060a5bULL, 0x013a123ULL, 0x1b4a0c0ULL },
+    { 0x1801c13ULL, 0x0529211ULL, 0x1907003ULL, 0x1109294ULL },
+    { 0x180e1fcULL, 0x0a10ef5ULL, 0x07f0e03ULL, 0x15ee10aULL },
+    { 0x198e822ULL, 0x1a2829cULL, 0x0882e33ULL, 0x072828bULL },
+    { 0x18210b5ULL, 0x0303e11ULL, 0x15a1083ULL, 0x110f818ULL },
+    { 0x1825f05ULL, 0x0523656ULL, 0x141f483ULL, 0x0d4d894ULL },
+    { 0x18246f0ULL, 0x0612a17ULL, 0x01ec483ULL, 0x1d0a90cULL },
+    { 0x18c69b7ULL, 0x0328fddULL, 0x1db2c63ULL, 0x177e298ULL },
+    { 0x18d49e9ULL, 0x0370b7cULL, 0x12f2563ULL, 0x07da1d8ULL },
+    { 0x185c832ULL, 0x0a68315ULL, 0x0982743ULL, 0x15182caULL },
+    { 0x1863a46ULL, 0x003b792ULL, 0x0c4b8c3ULL, 0x093db80ULL },
+    { 0x187e589ULL, 0x0d42bf4ULL, 0x1234fc3ULL, 0x05fa856ULL },
+    { 0x18ebfbeULL, 0x0e2bffbULL, 0x0fbfae3ULL, 0x1bffa8eULL },
+    { 0x196cb7aULL, 0x1a3a377ULL, 0x0bda6d3ULL, 0x1dd8b8bULL },
+    { 0x1978e1fULL, 0x1d6a733ULL, 0x1f0e3d3ULL, 0x199cad7ULL },
+    { 0x19fed72ULL, 0x1e7a3ddULL, 0x09d6ff3ULL, 0x1778bcfULL },
+    { 0x1a8a9deULL, 0x08b8ef9ULL, 0x0f72a2bULL, 0x13ee3a2ULL },
+    { 0x1a9f7b8ULL, 0x0ec1affULL, 0x03bdf2bULL, 0x1feb06eULL },
+    { 0x1b9d0a8ULL, 0x1ac1a3cULL, 0x02a173bULL, 0x078b06bULL },
+    { 0x1ab632cULL, 0x02c26feULL, 0x0698dabULL, 0x0fec868ULL },
+    { 0x1a33e0fULL, 0x05eb6b2ULL, 0x1e0f98bULL, 0x09adaf4ULL },
+    { 0x1a2bafdULL, 0x0bb3eb3ULL, 0x17eba8bULL, 0x19af9baULL },
+    { 0x1b3490dULL, 0x11e2674ULL, 0x161259bULL, 0x05cc8f1ULL },
+    { 0x1ba1261ULL, 0x139321aULL, 0x10c90bbULL, 0x0b09939ULL },
+    { 0x1b36873ULL, 0x13fa295ULL, 0x19c2d9bULL, 0x1528bf9ULL },
+    { 0x1bb56d3ULL, 0x15dba1fULL, 0x196d5bbULL, 0x1f0bb75ULL },
+    { 0x1b39684ULL, 0x1cc3e12ULL, 0x042d39bULL, 0x090f867ULL },
+    { 0x1a4421aULL, 0x0088337ULL, 0x0b0844bULL, 0x1d98220ULL },
+    { 0x1ac9208ULL, 0x088133aULL, 0x020926bULL, 0x0b99022ULL },
+    { 0x1a5b1b6ULL, 0x0ac9fd1ULL, 0x0db1b4bULL, 0x117f26aULL },
+    { 0x1b47e8bULL, 0x15a9bb6ULL, 0x1a2fc5bULL, 0x0dbb2b5ULL },
+    { 0x1b4fbb4ULL, 0x1aa1fd7ULL, 0x05bbe5bULL, 0x1d7f0abULL },
+    { 0x1b5a7ccULL, 0x1cd0ff2ULL, 0x067cb5bULL, 0x09fe167ULL },
+    { 0x1a6677aULL, 0x069a3f7ULL, 0x0bdcccbULL, 0x1df8b2cULL },
+    { 0x1afc3dbULL, 0x09dab7fULL, 0x1b787ebULL, 0x1fdab72ULL },
+    { 0x1b78af4ULL, 0x1af2f13ULL, 0x05ea3dbULL, 0x191e9ebULL },
+    { 0x1c10077ULL, 0x035c611ULL, 0x1dc0107ULL, 0x110c758ULL },
+    { 0x1c19ed3ULL, 0x0d7da13ULL, 0x196f307ULL, 0x190b7d6ULL },
+    { 0x1c88e61ULL, 0x0f3421aULL, 0x10ce227ULL, 0x0b0859eULL },
+    { 0x1d03aadULL, 0x1325eb2ULL, 0x16ab817ULL, 0x09af499ULL },
+    { 0x1d1e691ULL, 0x1d44a97ULL, 0x112cf17ULL, 0x1d2a457ULL },
+    { 0x1d1fd5eULL, 0x1c7d6f5ULL, 0x0f57f17ULL, 0x15ed7c7ULL },
+    { 0x1d9cf3eULL, 0x1e6c67fULL, 0x0f9e737ULL, 0x1fcc6cfULL },
+    { 0x1c279a9ULL, 0x0327af4ULL, 0x12b3c87ULL, 0x05ebc98ULL },
+    { 0x1cb98d5ULL, 0x0977e19ULL, 0x15633a7ULL, 0x130fdd2ULL },
+    { 0x1d35f34ULL, 0x1667657ULL, 0x059f597ULL, 0x1d4dccdULL },
+    { 0x1c601daULL, 0x001eb71ULL, 0x0b700c7ULL, 0x11daf00ULL },
+    { 0x1cf621cULL, 0x00467bfULL, 0x0708de7ULL, 0x1fbcc40ULL },
+    { 0x1c780fcULL, 0x0a56f31ULL, 0x07e03c7ULL, 0x119ed4aULL },
+    { 0x1d71946ULL, 0x107f750ULL, 0x0c531d7ULL, 0x015dfc1ULL },
+    { 0x1d73edbULL, 0x157fbb3ULL, 0x1b6f9d7ULL, 0x19bbfd5ULL },
+    { 0x1de8216ULL, 0x180e71bULL, 0x0d082f7ULL, 0x1b1ce03ULL },
+    { 0x1df8586ULL, 0x1c4ef58ULL, 0x0c343f7ULL, 0x035ee47ULL },
+    { 0x1e15040ULL, 0x00d5214ULL, 0x004150fULL, 0x0509560ULL },
+    { 0x1e833a6ULL, 0x028dedaULL, 0x0cb982fULL, 0x0b6f628ULL },
+    { 0x1e90b7fULL, 0x03fc67bULL, 0x1fda12fULL, 0x1bcc7f8ULL },
+    { 0x1e0d598ULL, 0x0c85a75ULL, 0x033560fULL, 0x15cb426ULL },
+    { 0x1e0f6d7ULL, 0x0d9de97ULL, 0x1d6de0fULL, 0x1d2f736ULL },
+    { 0x1e9f754ULL, 0x0cd56dfULL, 0x055df2fULL, 0x1f6d566ULL },
+    { 0x1f98c5eULL, 0x1cfc639ULL, 0x0f4633fULL, 0x138c7e7ULL },
+    { 0x1f0de20ULL, 0x1ea5216ULL, 0x008f61fULL, 0x0d094afULL },
+    { 0x1f8fef1ULL, 0x1fb5a9fULL, 0x11efe3fULL, 0x1f2b5bfULL },
+    { 0x1e357b2ULL, 0x06cfa57ULL, 0x09bd58fULL, 0x1d4be6cULL },
+    { 0x1eaa31fULL, 0x098e6fbULL, 0x1f18aafULL, 0x1bece32ULL },
+    { 0x1e3f14dULL, 0x09d76f4ULL, 0x1651f8fULL, 0x05edd72ULL },
+    { 0x1e2ac30ULL, 0x0ea6291ULL, 0x0186a8fULL, 0x1128caeULL },
+    { 0x1fb0988ULL, 0x10e6a78ULL, 0x02321bfULL, 0x03cace1ULL },
+    { 0x1f31ae5ULL, 0x13f7e12ULL, 0x14eb19fULL, 0x090fdf9ULL },
+    { 0x1fa1eabULL, 0x17afa3aULL, 0x1aaf0bfULL, 0x0b8bebdULL },
+    { 0x1e538dfULL, 0x01fdfb1ULL, 0x1f6394fULL, 0x11bf7f0ULL },
+    { 0x1ed1031ULL, 0x03c5319ULL, 0x118116fULL, 0x1319478ULL },
+    { 0x1ec0f8aULL, 0x04acb7aULL, 0x0a3e06fULL, 0x0bda6a4ULL },
+    { 0x1e483aeULL, 0x0a8cf72ULL, 0x0eb824fULL, 0x09de62aULL },
+    { 0x1ede236ULL, 0x0acc79fULL, 0x0d88f6fULL, 0x1f3c66aULL },
+    { 0x1e5cd97ULL, 0x0decf55ULL, 0x1d3674fULL, 0x155e6f6ULL },
+    { 0x1f5aa41ULL, 0x19f4392ULL, 0x104ab5fULL, 0x09385f3ULL },
+    { 0x1fc87d2ULL, 0x1c9cb5bULL, 0x097c27fULL, 0x1b5a727ULL },
+    { 0x1e7f71cULL, 0x0cc77f7ULL, 0x071dfcfULL, 0x1dfdc66ULL },
+    { 0x1ff77b4ULL, 0x16c7fdfULL, 0x05bddffULL, 0x1f7fc6dULL },
+    { 0x1f7921dULL, 0x19c7733ULL, 0x17093dfULL, 0x199dc73ULL },
+};
 
-static unsigned char DICT_5X5_1000_BYTES[][4][4] =
-    { { { 162, 217, 94, 0 },
-        { 82, 46, 217, 1 },
-        { 61, 77, 162, 1 },
-        { 205, 186, 37, 0 }, },
-      { { 14, 3, 115, 0 },
-        { 176, 198, 133, 0 },
-        { 103, 96, 56, 0 },
-        { 80, 177, 134, 1 }, },
-      { { 215, 135, 110, 1 },
-        { 47, 151, 157, 1 },
-        { 187, 112, 245, 1 },
-        { 220, 244, 250, 0 }, },
-      { { 129, 202, 251, 1 },
-        { 122, 222, 40, 1 },
-        { 239, 169, 192, 1 },
-        { 138, 61, 175, 0 }, },
-      { { 215, 90, 146, 0 },
-        { 116, 27, 236, 0 },
-        { 36, 173, 117, 1 },
-        { 27, 236, 23, 0 }, },
-      { { 234, 4, 22, 1 },
-        { 153, 35, 152, 0 },
-        { 180, 16, 43, 1 },
-        { 12, 226, 76, 1 }, },
-      { { 105, 235, 246, 0 },
-        { 242, 191, 51, 0 },
-        { 55, 235, 203, 0 },
-        { 102, 126, 167, 1 }, },
-      { { 113, 10, 53, 1 },
-        { 60, 249, 16, 0 },
-        { 214, 40, 71, 0 },
-        { 4, 79, 158, 0 }, },
-      { { 134, 176, 153, 0 },
-        { 18, 64, 238, 1 },
-        { 76, 134, 176, 1 },
-        { 187, 129, 36, 0 }, },
-      { { 152, 159, 210, 1 },
-        { 191, 14, 105, 0 },
-        { 165, 252, 140, 1 },
-        { 75, 56, 126, 1 }, },
-      { { 158, 119, 1, 1 },
-        { 237, 64, 207, 0 },
-        { 192, 119, 60, 1 },
-        { 121, 129, 91, 1 }, },
-      { { 209, 109, 96, 0 },
-        { 69, 157, 11, 0 },
-        { 3, 91, 69, 1 },
-        { 104, 92, 209, 0 }, },
-      { { 243, 21, 136, 1 },
-        { 13, 49, 233, 1 },
-        { 136, 212, 103, 1 },
-        { 203, 198, 88, 0 }, },
-      { { 47, 56, 179, 0 },
-        { 144, 250, 230, 0 },
-        { 102, 142, 122, 0 },
-        { 51, 175, 132, 1 }, },
-      { { 254, 126, 84, 0 },
-        { 245, 45, 222, 0 },
-        { 21, 63, 63, 1 },
-        { 61, 218, 87, 1 }, },
-      { { 40, 241, 191, 1 },
-        { 218, 226, 115, 1 },
-        { 254, 199, 138, 0 },
-        { 231, 35, 173, 1 }, },
-      { { 75, 211, 172, 0 },
-        { 226, 145, 241, 1 },
-        { 26, 229, 233, 0 },
-        { 199, 196, 163, 1 }, },
-      { { 95, 81, 55, 1 },
-        { 220, 211, 213, 0 },
-        { 246, 69, 125, 0 },
-        { 85, 229, 157, 1 }, },
-      { { 123, 38, 226, 0 },
-        { 165, 183, 162, 0 },
-        { 35, 178, 111, 0 },
-        { 34, 246, 210, 1 }, },
-      { { 131, 14, 244, 0 },
-        { 49, 156, 184, 0 },
-        { 23, 184, 96, 1 },
-        { 14, 156, 198, 0 }, },
-      { { 150, 237, 58, 1 },
-        { 95, 138, 143, 1 },
-        { 174, 91, 180, 1 },
-        { 248, 168, 253, 0 }, },
-      { { 168, 114, 32, 0 },
-        { 224, 160, 74, 0 },
-        { 2, 39, 10, 1 },
-        { 41, 2, 131, 1 }, },
-      { { 181, 134, 80, 1 },
-        { 63, 52, 12, 0 },
-        { 133, 48, 214, 1 },
-        { 24, 22, 126, 0 }, },
-      { { 93, 9, 111, 0 },
-        { 132, 223, 21, 1 },
-        { 123, 72, 93, 0 },
-        { 212, 125, 144, 1 }, },
-      { { 206, 104, 17, 1 },
-        { 216, 73, 142, 0 },
-        { 196, 11, 57, 1 },
-        { 56, 201, 13, 1 }, },
-      { { 210, 204, 185, 0 },
-        { 87, 201, 168, 1 },
-        { 78, 153, 165, 1 },
-        { 138, 201, 245, 0 }, },
-      { { 225, 231, 69, 1 },
-        { 107, 117, 27, 0 },
-        { 209, 115, 195, 1 },
-        { 108, 87, 107, 0 }, },
-      { { 17, 33, 35, 0 },
-        { 4, 210, 3, 0 },
-        { 98, 66, 68, 0 },
-        { 96, 37, 144, 0 }, },
-      { { 29, 203, 57, 0 },
-        { 246, 216, 5, 1 },
-        { 78, 105, 220, 0 },
-        { 208, 13, 183, 1 }, },
-      { { 18, 17, 29, 1 },
-        { 28, 64, 209, 1 },
-        { 220, 68, 36, 0 },
-        { 197, 129, 28, 0 }, },
-      { { 19, 155, 183, 0 },
-        { 54, 218, 241, 0 },
-        { 118, 236, 228, 0 },
-        { 71, 173, 182, 0 }, },
-      { { 27, 68, 57, 1 },
-        { 221, 208, 128, 1 },
-        { 206, 17, 108, 0 },
-        { 128, 133, 221, 1 }, },
-      { { 32, 104, 103, 0 },
-        { 64, 238, 18, 0 },
-        { 115, 11, 2, 0 },
-        { 36, 59, 129, 0 }, },
-      { { 37, 85, 100, 0 },
-        { 65, 180, 85, 0 },
-        { 19, 85, 82, 0 },
-        { 85, 22, 193, 0 }, },
-      { { 35, 33, 221, 0 },
-        { 16, 116, 179, 1 },
-        { 93, 194, 98, 0 },
-        { 230, 151, 4, 0 }, },
-      { { 61, 55, 245, 0 },
-        { 181, 244, 119, 0 },
-        { 87, 246, 94, 0 },
-        { 119, 23, 214, 1 }, },
-      { { 76, 197, 86, 0 },
-        { 211, 7, 21, 0 },
-        { 53, 81, 153, 0 },
-        { 84, 112, 101, 1 }, },
-      { { 65, 104, 128, 1 },
-        { 72, 25, 34, 0 },
-        { 128, 139, 65, 0 },
-        { 34, 76, 9, 0 }, },
-      { { 77, 86, 142, 1 },
-        { 233, 19, 116, 1 },
-        { 184, 181, 89, 0 },
-        { 151, 100, 75, 1 }, },
-      { { 67, 30, 57, 0 },
-        { 49, 217, 192, 1 },
-        { 78, 60, 97, 0 },
-        { 129, 205, 198, 0 }, },
-      { { 86, 148, 18, 1 },
-        { 31, 3, 196, 0 },
-        { 164, 20, 181, 0 },
-        { 17, 224, 124, 0 }, },
-      { { 82, 151, 207, 0 },
-        { 39, 71, 241, 1 },
-        { 121, 244, 165, 0 },
-        { 199, 241, 114, 0 }, },
-      { { 108, 36, 251, 1 },
-        { 153, 231, 38, 1 },
-        { 239, 146, 27, 0 },
-        { 178, 115, 204, 1 }, },
-      { { 97, 132, 236, 1 },
-        { 11, 181, 48, 1 },
-        { 155, 144, 195, 0 },
-        { 134, 86, 232, 0 }, },
-      { { 109, 63, 24, 1 },
-        { 185, 57, 71, 1 },
-        { 140, 126, 91, 0 },
-        { 241, 78, 78, 1 }, },
-      { { 116, 177, 61, 0 },
-        { 22, 225, 87, 1 },
-        { 94, 70, 151, 0 },
-        { 245, 67, 180, 0 }, },
-      { { 116, 220, 203, 1 },
-        { 79, 111, 100, 1 },
-        { 233, 157, 151, 0 },
-        { 147, 123, 121, 0 }, },
-      { { 124, 164, 3, 0 },
-        { 135, 99, 6, 0 },
-        { 96, 18, 159, 0 },
-        { 48, 99, 112, 1 }, },
-      { { 122, 200, 146, 1 },
-        { 222, 43, 160, 0 },
-        { 164, 137, 175, 0 },
-        { 2, 234, 61, 1 }, },
-      { { 123, 91, 235, 1 },
-        { 236, 255, 225, 1 },
-        { 235, 237, 111, 0 },
-        { 195, 255, 155, 1 }, },
-      { { 141, 172, 114, 0 },
-        { 147, 158, 14, 0 },
-        { 39, 26, 216, 1 },
-        { 56, 60, 228, 1 }, },
-      { { 141, 105, 60, 1 },
-        { 216, 152, 31, 1 },
-        { 158, 75, 88, 1 },
-        { 252, 12, 141, 1 }, },
-      { { 143, 28, 5, 1 },
-        { 137, 88, 220, 0 },
-        { 208, 28, 120, 1 },
-        { 29, 141, 72, 1 }, },
-      { { 139, 74, 34, 1 },
-        { 232, 154, 136, 0 },
-        { 162, 41, 104, 1 },
-        { 8, 172, 139, 1 }, },
-      { { 151, 253, 165, 0 },
-        { 71, 216, 255, 0 },
-        { 82, 223, 244, 1 },
-        { 127, 141, 241, 0 }, },
-      { { 172, 101, 198, 1 },
-        { 201, 38, 63, 0 },
-        { 177, 211, 26, 1 },
-        { 126, 50, 73, 1 }, },
-      { { 172, 195, 248, 0 },
-        { 242, 164, 45, 1 },
-        { 15, 225, 154, 1 },
-        { 218, 18, 167, 1 }, },
-      { { 161, 23, 239, 1 },
-        { 41, 246, 121, 1 },
-        { 251, 244, 66, 1 },
-        { 207, 55, 202, 0 }, },
-      { { 167, 9, 19, 1 },
-        { 24, 122, 141, 0 },
-        { 228, 72, 114, 1 },
-        { 88, 175, 12, 0 }, },
-      { { 171, 111, 145, 0 },
-        { 241, 120, 171, 0 },
-        { 68, 251, 106, 1 },
-        { 106, 143, 71, 1 }, },
-      { { 185, 237, 248, 1 },
-        { 223, 188, 43, 1 },
-        { 143, 219, 206, 1 },
-        { 234, 30, 253, 1 }, },
-      { { 178, 100, 158, 0 },
-        { 85, 34, 186, 1 },
-        { 60, 147, 38, 1 },
-        { 174, 162, 85, 0 }, },
-      { { 190, 93, 195, 0 },
-        { 197, 110, 237, 0 },
-        { 97, 221, 62, 1 },
-        { 91, 187, 81, 1 }, },
-      { { 196, 5, 67, 1 },
-        { 9, 71, 13, 0 },
-        { 225, 80, 17, 1 },
-        { 88, 113, 72, 0 }, },
-      { { 200, 163, 238, 1 },
-        { 170, 135, 59, 1 },
-        { 187, 226, 137, 1 },
-        { 238, 112, 170, 1 }, },
-      { { 194, 117, 197, 0 },
-        { 65, 69, 251, 0 },
-        { 81, 215, 33, 1 },
-        { 111, 209, 65, 0 }, },
-      { { 198, 194, 214, 1 },
-        { 122, 7, 188, 0 },
-        { 181, 161, 177, 1 },
-        { 30, 240, 47, 0 }, },
-      { { 217, 102, 212, 1 },
-        { 253, 21, 58, 0 },
-        { 149, 179, 77, 1 },
-        { 46, 84, 95, 1 }, },
-      { { 221, 94, 185, 1 },
-        { 253, 217, 108, 1 },
-        { 206, 189, 93, 1 },
-        { 155, 77, 223, 1 }, },
-      { { 244, 234, 25, 0 },
-        { 118, 105, 14, 1 },
-        { 76, 43, 151, 1 },
-        { 184, 75, 55, 0 }, },
-      { { 243, 178, 148, 0 },
-        { 54, 49, 250, 0 },
-        { 20, 166, 231, 1 },
-        { 47, 198, 54, 0 }, },
-      { { 122, 186, 5, 0 },
-        { 166, 105, 210, 0 },
-        { 80, 46, 175, 0 },
-        { 37, 203, 50, 1 }, },
-      { { 216, 141, 41, 1 },
-        { 143, 201, 9, 1 },
-        { 202, 88, 141, 1 },
-        { 200, 73, 248, 1 }, },
-      { { 12, 103, 50, 1 },
-        { 249, 130, 7, 0 },
-        { 166, 115, 24, 0 },
-        { 112, 32, 207, 1 }, },
-      { { 21, 89, 12, 1 },
-        { 76, 24, 85, 1 },
-        { 152, 77, 84, 0 },
-        { 213, 12, 25, 0 }, },
-      { { 76, 116, 192, 1 },
-        { 201, 5, 102, 0 },
-        { 129, 151, 25, 0 },
-        { 51, 80, 73, 1 }, },
-      { { 84, 3, 14, 0 },
-        { 36, 3, 21, 1 },
-        { 56, 96, 21, 0 },
-        { 212, 96, 18, 0 }, },
-      { { 160, 208, 172, 0 },
-        { 66, 160, 120, 1 },
-        { 26, 133, 130, 1 },
-        { 143, 2, 161, 0 }, },
-      { { 194, 152, 166, 0 },
-        { 2, 139, 248, 0 },
-        { 50, 140, 161, 1 },
-        { 15, 232, 160, 0 }, },
-      { { 203, 104, 150, 0 },
-        { 208, 27, 186, 0 },
-        { 52, 139, 105, 1 },
-        { 46, 236, 5, 1 }, },
-      { { 253, 105, 209, 0 },
-        { 212, 125, 47, 0 },
-        { 69, 203, 95, 1 },
-        { 122, 95, 21, 1 }, },
-      { { 4, 145, 90, 1 },
-        { 26, 6, 69, 1 },
-        { 173, 68, 144, 0 },
-        { 209, 48, 44, 0 }, },
-      { { 12, 222, 112, 0 },
-        { 243, 140, 68, 0 },
-        { 7, 61, 152, 0 },
-        { 17, 24, 231, 1 }, },
-      { { 5, 170, 62, 0 },
-        { 50, 154, 22, 1 },
-        { 62, 42, 208, 0 },
-        { 180, 44, 166, 0 }, },
-      { { 1, 99, 183, 1 },
-        { 120, 210, 51, 0 },
-        { 246, 227, 64, 0 },
-        { 102, 37, 143, 0 }, },
-      { { 9, 145, 68, 1 },
-        { 138, 20, 81, 0 },
-        { 145, 68, 200, 0 },
-        { 69, 20, 40, 1 }, },
-      { { 9, 105, 83, 1 },
-        { 216, 94, 3, 0 },
-        { 229, 75, 72, 0 },
-        { 96, 61, 13, 1 }, },
-      { { 6, 37, 161, 1 },
-        { 9, 192, 167, 0 },
-        { 194, 210, 48, 0 },
-        { 114, 129, 200, 0 }, },
-      { { 3, 61, 226, 1 },
-        { 9, 158, 227, 0 },
-        { 163, 222, 96, 0 },
-        { 99, 188, 200, 0 }, },
-      { { 7, 213, 6, 1 },
-        { 75, 18, 213, 0 },
-        { 176, 85, 240, 0 },
-        { 85, 164, 105, 0 }, },
-      { { 15, 143, 170, 0 },
-        { 163, 154, 165, 1 },
-        { 42, 248, 248, 0 },
-        { 210, 172, 226, 1 }, },
-      { { 28, 116, 60, 1 },
-        { 221, 128, 86, 1 },
-        { 158, 23, 28, 0 },
-        { 181, 0, 221, 1 }, },
-      { { 25, 29, 145, 1 },
-        { 157, 88, 97, 0 },
-        { 196, 220, 76, 0 },
-        { 67, 13, 92, 1 }, },
-      { { 22, 27, 35, 1 },
-        { 44, 202, 197, 0 },
-        { 226, 108, 52, 0 },
-        { 81, 169, 154, 0 }, },
-      { { 22, 210, 141, 1 },
-        { 110, 64, 244, 1 },
-        { 216, 165, 180, 0 },
-        { 151, 129, 59, 0 }, },
-      { { 23, 78, 198, 1 },
-        { 109, 30, 180, 0 },
-        { 177, 185, 116, 0 },
-        { 22, 188, 91, 0 }, },
-      { { 19, 226, 177, 0 },
-        { 118, 208, 162, 0 },
-        { 70, 163, 228, 0 },
-        { 34, 133, 183, 0 }, },
-      { { 31, 126, 250, 1 },
-        { 253, 158, 230, 1 },
-        { 175, 191, 124, 0 },
-        { 179, 188, 223, 1 }, },
-      { { 41, 15, 112, 0 },
-        { 177, 188, 1, 0 },
-        { 7, 120, 74, 0 },
-        { 64, 30, 198, 1 }, },
-      { { 34, 71, 126, 1 },
-        { 121, 166, 145, 1 },
-        { 191, 113, 34, 0 },
-        { 196, 178, 207, 0 }, },
-      { { 42, 23, 192, 1 },
-        { 169, 36, 225, 0 },
-        { 129, 244, 42, 0 },
-        { 67, 146, 74, 1 }, },
-      { { 42, 251, 100, 1 },
-        { 234, 172, 211, 0 },
-        { 147, 111, 170, 0 },
-        { 101, 154, 171, 1 }, },
-      { { 35, 240, 4, 0 },
-        { 66, 48, 210, 0 },
-        { 16, 7, 226, 0 },
-        { 37, 134, 33, 0 }, },
-      { { 39, 205, 252, 0 },
-        { 83, 188, 181, 1 },
-        { 31, 217, 242, 0 },
-        { 214, 158, 229, 0 }, },
-      { { 35, 106, 172, 0 },
-        { 96, 184, 178, 1 },
-        { 26, 171, 98, 0 },
-        { 166, 142, 131, 0 }, },
-      { { 47, 123, 47, 0 },
-        { 224, 250, 215, 1 },
-        { 122, 111, 122, 0 },
-        { 245, 175, 131, 1 }, },
-      { { 52, 144, 196, 0 },
-        { 6, 36, 116, 0 },
-        { 17, 132, 150, 0 },
-        { 23, 18, 48, 0 }, },
-      { { 48, 9, 214, 1 },
-        { 28, 46, 49, 0 },
-        { 181, 200, 6, 0 },
-        { 70, 58, 28, 0 }, },
-      { { 52, 94, 16, 1 },
-        { 125, 40, 68, 0 },
-        { 132, 61, 22, 0 },
-        { 17, 10, 95, 0 }, },
-      { { 57, 82, 232, 0 },
-        { 228, 180, 96, 1 },
-        { 11, 165, 78, 0 },
-        { 131, 22, 147, 1 }, },
-      { { 50, 0, 113, 0 },
-        { 20, 228, 128, 0 },
-        { 71, 0, 38, 0 },
-        { 0, 147, 148, 0 }, },
-      { { 54, 231, 29, 0 },
-        { 119, 96, 151, 1 },
-        { 92, 115, 182, 0 },
-        { 244, 131, 119, 0 }, },
-      { { 68, 138, 4, 1 },
-        { 42, 9, 20, 0 },
-        { 144, 40, 145, 0 },
-        { 20, 72, 42, 0 }, },
-      { { 68, 236, 254, 1 },
-        { 91, 143, 54, 1 },
-        { 191, 155, 145, 0 },
-        { 182, 120, 237, 0 }, },
-      { { 69, 31, 114, 1 },
-        { 57, 159, 69, 0 },
-        { 167, 124, 81, 0 },
-        { 81, 124, 206, 0 }, },
-      { { 69, 74, 149, 0 },
-        { 112, 89, 52, 0 },
-        { 84, 169, 81, 0 },
-        { 22, 77, 7, 0 }, },
-      { { 70, 19, 190, 1 },
-        { 56, 131, 245, 1 },
-        { 190, 228, 49, 0 },
-        { 215, 224, 142, 0 }, },
-      { { 78, 131, 9, 0 },
-        { 162, 65, 133, 1 },
-        { 72, 96, 185, 0 },
-        { 208, 193, 34, 1 }, },
-      { { 71, 114, 153, 1 },
-        { 120, 81, 230, 1 },
-        { 204, 167, 113, 0 },
-        { 179, 197, 15, 0 }, },
-      { { 79, 130, 125, 1 },
-        { 186, 213, 148, 1 },
-        { 223, 32, 249, 0 },
-        { 148, 213, 174, 1 }, },
-      { { 92, 55, 141, 1 },
-        { 173, 65, 119, 1 },
-        { 216, 246, 29, 0 },
-        { 247, 65, 90, 1 }, },
-      { { 88, 253, 119, 0 },
-        { 215, 207, 83, 0 },
-        { 119, 95, 141, 0 },
-        { 101, 121, 245, 1 }, },
-      { { 81, 183, 248, 0 },
-        { 55, 149, 99, 1 },
-        { 15, 246, 197, 0 },
-        { 227, 84, 246, 0 }, },
-      { { 89, 58, 251, 0 },
-        { 180, 223, 98, 1 },
-        { 111, 174, 77, 0 },
-        { 163, 125, 150, 1 }, },
-      { { 90, 153, 153, 0 },
-        { 150, 73, 225, 1 },
-        { 76, 204, 173, 0 },
-        { 195, 201, 52, 1 }, },
-      { { 83, 1, 240, 1 },
-        { 28, 149, 161, 0 },
-        { 135, 192, 101, 0 },
-        { 66, 212, 156, 0 }, },
-      { { 83, 204, 103, 1 },
-        { 79, 223, 144, 0 },
-        { 243, 25, 229, 0 },
-        { 4, 253, 249, 0 }, },
-      { { 83, 110, 1, 0 },
-        { 101, 89, 130, 0 },
-        { 64, 59, 101, 0 },
-        { 32, 205, 83, 0 }, },
-      { { 91, 37, 175, 1 },
-        { 141, 211, 179, 1 },
-        { 250, 210, 109, 0 },
-        { 230, 229, 216, 1 }, },
-      { { 95, 213, 204, 1 },
-        { 207, 21, 245, 1 },
-        { 153, 213, 253, 0 },
-        { 215, 212, 121, 1 }, },
-      { { 101, 102, 66, 1 },
-        { 105, 55, 6, 0 },
-        { 161, 51, 83, 0 },
-        { 48, 118, 75, 0 }, },
-      { { 101, 199, 175, 0 },
-        { 99, 243, 53, 1 },
-        { 122, 241, 211, 0 },
-        { 214, 103, 227, 0 }, },
-      { { 102, 55, 81, 0 },
-        { 49, 101, 199, 0 },
-        { 69, 118, 51, 0 },
-        { 113, 211, 70, 0 }, },
-      { { 103, 12, 197, 1 },
-        { 9, 125, 180, 0 },
-        { 209, 152, 115, 0 },
-        { 22, 223, 72, 0 }, },
-      { { 112, 150, 93, 1 },
-        { 63, 101, 80, 1 },
-        { 221, 52, 135, 0 },
-        { 133, 83, 126, 0 }, },
-      { { 124, 99, 128, 1 },
-        { 236, 33, 39, 0 },
-        { 128, 227, 31, 0 },
-        { 114, 66, 27, 1 }, },
-      { { 121, 171, 169, 0 },
-        { 166, 249, 35, 1 },
-        { 74, 234, 207, 0 },
-        { 226, 79, 178, 1 }, },
-      { { 114, 61, 70, 0 },
-        { 5, 47, 211, 0 },
-        { 49, 94, 39, 0 },
-        { 101, 250, 80, 0 }, },
-      { { 115, 229, 178, 1 },
-        { 95, 179, 163, 0 },
-        { 166, 211, 231, 0 },
-        { 98, 230, 253, 0 }, },
-      { { 132, 38, 140, 0 },
-        { 33, 0, 62, 1 },
-        { 24, 178, 16, 1 },
-        { 190, 0, 66, 0 }, },
-      { { 137, 241, 1, 0 },
-        { 194, 80, 75, 0 },
-        { 64, 71, 200, 1 },
-        { 105, 5, 33, 1 }, },
-      { { 134, 174, 233, 1 },
-        { 43, 204, 174, 1 },
-        { 203, 186, 176, 1 },
-        { 186, 153, 234, 0 }, },
-      { { 138, 35, 249, 1 },
-        { 184, 196, 171, 1 },
-        { 207, 226, 40, 1 },
-        { 234, 145, 142, 1 }, },
-      { { 148, 53, 113, 1 },
-        { 29, 196, 79, 0 },
-        { 199, 86, 20, 1 },
-        { 121, 17, 220, 0 }, },
-      { { 156, 69, 27, 0 },
-        { 213, 66, 13, 1 },
-        { 108, 81, 28, 1 },
-        { 216, 33, 85, 1 }, },
-      { { 149, 31, 164, 1 },
-        { 45, 152, 125, 0 },
-        { 146, 252, 84, 1 },
-        { 95, 12, 218, 0 }, },
-      { { 150, 141, 144, 0 },
-        { 23, 8, 173, 0 },
-        { 4, 216, 180, 1 },
-        { 90, 136, 116, 0 }, },
-      { { 151, 38, 183, 0 },
-        { 53, 210, 190, 0 },
-        { 118, 178, 116, 1 },
-        { 62, 165, 214, 0 }, },
-      { { 155, 55, 103, 0 },
-        { 165, 214, 219, 0 },
-        { 115, 118, 108, 1 },
-        { 109, 181, 210, 1 }, },
-      { { 155, 198, 224, 1 },
-        { 239, 148, 168, 0 },
-        { 131, 177, 236, 1 },
-        { 10, 148, 251, 1 }, },
-      { { 160, 154, 110, 1 },
-        { 42, 174, 88, 1 },
-        { 187, 44, 130, 1 },
-        { 141, 58, 170, 0 }, },
-      { { 164, 82, 134, 1 },
-        { 104, 34, 124, 0 },
-        { 176, 165, 18, 1 },
-        { 31, 34, 11, 0 }, },
-      { { 168, 176, 133, 1 },
-        { 138, 96, 122, 0 },
-        { 208, 134, 138, 1 },
-        { 47, 3, 40, 1 }, },
-      { { 173, 155, 66, 0 },
-        { 162, 62, 77, 0 },
-        { 33, 108, 218, 1 },
-        { 89, 62, 34, 1 }, },
-      { { 175, 240, 88, 1 },
-        { 218, 52, 206, 1 },
-        { 141, 7, 250, 1 },
-        { 185, 150, 45, 1 }, },
-      { { 176, 46, 99, 1 },
-        { 45, 238, 10, 0 },
-        { 227, 58, 6, 1 },
-        { 40, 59, 218, 0 }, },
-      { { 176, 15, 24, 0 },
-        { 53, 40, 9, 1 },
-        { 12, 120, 6, 1 },
-        { 200, 10, 86, 0 }, },
-      { { 188, 234, 178, 1 },
-        { 254, 170, 46, 0 },
-        { 166, 171, 158, 1 },
-        { 58, 42, 191, 1 }, },
-      { { 190, 196, 76, 1 },
-        { 207, 36, 156, 1 },
-        { 153, 17, 190, 1 },
-        { 156, 146, 121, 1 }, },
-      { { 179, 130, 250, 0 },
-        { 54, 182, 168, 1 },
-        { 47, 160, 230, 1 },
-        { 138, 182, 182, 0 }, },
-      { { 179, 88, 60, 1 },
-        { 92, 184, 216, 1 },
-        { 158, 13, 102, 1 },
-        { 141, 142, 157, 0 }, },
-      { { 191, 69, 238, 0 },
-        { 197, 182, 189, 1 },
-        { 59, 209, 126, 1 },
-        { 222, 182, 209, 1 }, },
-      { { 191, 86, 51, 1 },
-        { 253, 242, 204, 0 },
-        { 230, 53, 126, 1 },
-        { 25, 167, 223, 1 }, },
-      { { 196, 58, 240, 0 },
-        { 48, 141, 110, 0 },
-        { 7, 174, 17, 1 },
-        { 59, 88, 134, 0 }, },
-      { { 204, 233, 131, 0 },
-        { 194, 75, 47, 0 },
-        { 96, 203, 153, 1 },
-        { 122, 105, 33, 1 }, },
-      { { 197, 51, 0, 1 },
-        { 40, 17, 79, 0 },
-        { 128, 102, 81, 1 },
-        { 121, 68, 10, 0 }, },
-      { { 205, 34, 99, 1 },
-        { 168, 215, 14, 0 },
-        { 227, 34, 89, 1 },
-        { 56, 117, 138, 1 }, },
-      { { 198, 8, 138, 1 },
-        { 8, 11, 172, 1 },
-        { 168, 136, 49, 1 },
-        { 154, 232, 8, 0 }, },
-      { { 198, 148, 63, 0 },
-        { 19, 195, 220, 1 },
-        { 126, 20, 177, 1 },
-        { 157, 225, 228, 0 }, },
-      { { 202, 238, 132, 1 },
-        { 235, 9, 186, 0 },
-        { 144, 187, 169, 1 },
-        { 46, 200, 107, 1 }, },
-      { { 207, 167, 18, 1 },
-        { 187, 19, 143, 0 },
-        { 164, 114, 249, 1 },
-        { 120, 228, 110, 1 }, },
-      { { 203, 97, 226, 1 },
-        { 200, 151, 171, 0 },
-        { 163, 195, 105, 1 },
-        { 106, 244, 137, 1 }, },
-      { { 208, 2, 233, 0 },
-        { 36, 197, 40, 1 },
-        { 75, 160, 5, 1 },
-        { 138, 81, 146, 0 }, },
-      { { 220, 183, 70, 0 },
-        { 167, 7, 95, 0 },
-        { 49, 118, 157, 1 },
-        { 125, 112, 114, 1 }, },
-      { { 217, 139, 132, 1 },
-        { 174, 25, 57, 0 },
-        { 144, 232, 205, 1 },
-        { 78, 76, 58, 1 }, },
-      { { 217, 206, 178, 0 },
-        { 247, 155, 40, 0 },
-        { 38, 185, 205, 1 },
-        { 10, 108, 247, 1 }, },
-      { { 210, 153, 64, 1 },
-        { 14, 13, 201, 0 },
-        { 129, 76, 165, 1 },
-        { 73, 216, 56, 0 }, },
-      { { 210, 209, 23, 0 },
-        { 86, 67, 217, 0 },
-        { 116, 69, 165, 1 },
-        { 77, 225, 53, 0 }, },
-      { { 222, 90, 110, 1 },
-        { 236, 143, 220, 1 },
-        { 187, 45, 61, 1 },
-        { 157, 248, 155, 1 }, },
-      { { 218, 71, 66, 1 },
-        { 237, 7, 137, 0 },
-        { 161, 113, 45, 1 },
-        { 72, 240, 91, 1 }, },
-      { { 219, 60, 16, 0 },
-        { 149, 25, 202, 0 },
-        { 4, 30, 109, 1 },
-        { 41, 204, 84, 1 }, },
-      { { 219, 143, 201, 0 },
-        { 167, 93, 169, 1 },
-        { 73, 248, 237, 1 },
-        { 202, 221, 114, 1 }, },
-      { { 232, 24, 227, 1 },
-        { 136, 239, 104, 0 },
-        { 227, 140, 11, 1 },
-        { 11, 123, 136, 1 }, },
-      { { 229, 28, 111, 0 },
-        { 1, 255, 92, 1 },
-        { 123, 28, 83, 1 },
-        { 157, 127, 192, 0 }, },
-      { { 225, 174, 56, 1 },
-        { 59, 185, 10, 1 },
-        { 142, 58, 195, 1 },
-        { 168, 78, 238, 0 }, },
-      { { 237, 185, 123, 1 },
-        { 154, 255, 79, 1 },
-        { 239, 78, 219, 1 },
-        { 249, 127, 172, 1 }, },
-      { { 233, 224, 50, 0 },
-        { 210, 179, 10, 0 },
-        { 38, 3, 203, 1 },
-        { 40, 102, 165, 1 }, },
-      { { 235, 93, 12, 0 },
-        { 193, 57, 217, 1 },
-        { 24, 93, 107, 1 },
-        { 205, 206, 65, 1 }, },
-      { { 239, 249, 157, 0 },
-        { 210, 121, 255, 1 },
-        { 92, 207, 251, 1 },
-        { 255, 207, 37, 1 }, },
-      { { 248, 17, 1, 0 },
-        { 132, 97, 73, 0 },
-        { 64, 68, 15, 1 },
-        { 73, 67, 16, 1 }, },
-      { { 248, 7, 211, 0 },
-        { 181, 103, 41, 0 },
-        { 101, 240, 15, 1 },
-        { 74, 115, 86, 1 }, },
-      { { 246, 2, 32, 1 },
-        { 44, 161, 140, 0 },
-        { 130, 32, 55, 1 },
-        { 24, 194, 154, 0 }, },
-      { { 246, 27, 95, 1 },
-        { 60, 111, 221, 1 },
-        { 253, 108, 55, 1 },
-        { 221, 251, 30, 0 }, },
-      { { 254, 181, 237, 0 },
-        { 135, 229, 255, 1 },
-        { 91, 214, 191, 1 },
-        { 255, 211, 240, 1 }, },
-      { { 250, 51, 56, 1 },
-        { 188, 161, 203, 1 },
-        { 142, 102, 47, 1 },
-        { 233, 194, 158, 1 }, },
-      { { 250, 74, 193, 1 },
-        { 236, 109, 168, 0 },
-        { 193, 169, 47, 1 },
-        { 10, 219, 27, 1 }, },
-      { { 247, 47, 112, 1 },
-        { 61, 189, 143, 0 },
-        { 135, 122, 119, 1 },
-        { 120, 222, 222, 0 }, },
-      { { 247, 234, 252, 1 },
-        { 126, 189, 190, 1 },
-        { 159, 171, 247, 1 },
-        { 190, 222, 191, 0 }, },
-      { { 255, 24, 148, 1 },
-        { 156, 57, 252, 0 },
-        { 148, 140, 127, 1 },
-        { 31, 206, 28, 1 }, },
-      { { 251, 163, 94, 0 },
-        { 182, 55, 155, 1 },
-        { 61, 98, 239, 1 },
-        { 236, 246, 54, 1 }, },
-      { { 104, 184, 47, 0 },
-        { 130, 235, 82, 1 },
-        { 122, 14, 139, 0 },
-        { 165, 107, 160, 1 }, },
-      { { 153, 15, 11, 1 },
-        { 173, 90, 9, 1 },
-        { 232, 120, 76, 1 },
-        { 200, 45, 90, 1 }, },
-      { { 153, 216, 38, 1 },
-        { 206, 154, 88, 0 },
-        { 178, 13, 204, 1 },
-        { 13, 44, 185, 1 }, },
-      { { 228, 95, 14, 1 },
-        { 105, 43, 93, 1 },
-        { 184, 125, 19, 1 },
-        { 221, 106, 75, 0 }, },
-      { { 29, 16, 110, 1 },
-        { 140, 150, 84, 1 },
-        { 187, 4, 92, 0 },
-        { 149, 52, 152, 1 }, },
-      { { 42, 193, 48, 1 },
-        { 218, 160, 129, 0 },
-        { 134, 65, 170, 0 },
-        { 64, 130, 173, 1 }, },
-      { { 52, 65, 99, 1 },
-        { 76, 230, 5, 0 },
-        { 227, 65, 22, 0 },
-        { 80, 51, 153, 0 }, },
-      { { 55, 192, 116, 1 },
-        { 94, 180, 148, 0 },
-        { 151, 1, 246, 0 },
-        { 20, 150, 189, 0 }, },
-      { { 63, 53, 203, 1 },
-        { 141, 118, 231, 1 },
-        { 233, 214, 126, 0 },
-        { 243, 183, 88, 1 }, },
-      { { 86, 160, 76, 0 },
-        { 6, 5, 150, 1 },
-        { 25, 2, 181, 0 },
-        { 180, 208, 48, 0 }, },
-      { { 87, 56, 57, 1 },
-        { 28, 217, 198, 1 },
-        { 206, 14, 117, 0 },
-        { 177, 205, 156, 0 }, },
-      { { 102, 152, 184, 0 },
-        { 18, 169, 228, 1 },
-        { 14, 140, 179, 0 },
-        { 147, 202, 164, 0 }, },
-      { { 115, 165, 23, 0 },
-        { 23, 115, 147, 0 },
-        { 116, 82, 231, 0 },
-        { 100, 231, 116, 0 }, },
-      { { 127, 44, 253, 1 },
-        { 157, 253, 182, 1 },
-        { 223, 154, 127, 0 },
-        { 182, 223, 220, 1 }, },
-      { { 139, 71, 233, 0 },
-        { 225, 212, 169, 1 },
-        { 75, 241, 104, 1 },
-        { 202, 149, 195, 1 }, },
-      { { 165, 195, 151, 0 },
-        { 114, 114, 61, 0 },
-        { 116, 225, 210, 1 },
-        { 94, 39, 39, 0 }, },
-      { { 169, 169, 235, 0 },
-        { 130, 254, 43, 1 },
-        { 107, 202, 202, 1 },
-        { 234, 63, 160, 1 }, },
-      { { 181, 25, 183, 0 },
-        { 20, 250, 125, 0 },
-        { 118, 204, 86, 1 },
-        { 95, 47, 148, 0 }, },
-      { { 178, 218, 153, 1 },
-        { 126, 104, 232, 1 },
-        { 204, 173, 166, 1 },
-        { 139, 139, 63, 0 }, },
-      { { 196, 193, 244, 0 },
-        { 82, 133, 61, 0 },
-        { 23, 193, 145, 1 },
-        { 94, 80, 165, 0 }, },
-      { { 202, 185, 30, 0 },
-        { 146, 11, 219, 1 },
-        { 60, 78, 169, 1 },
-        { 237, 232, 36, 1 }, },
-      { { 216, 111, 163, 1 },
-        { 237, 203, 43, 0 },
-        { 226, 251, 13, 1 },
-        { 106, 105, 219, 1 }, },
-      { { 223, 141, 142, 0 },
-        { 135, 27, 189, 1 },
-        { 56, 216, 253, 1 },
-        { 222, 236, 112, 1 }, },
-      { { 229, 102, 143, 1 },
-        { 105, 115, 62, 1 },
-        { 248, 179, 83, 1 },
-        { 190, 103, 75, 0 }, },
-      { { 237, 71, 26, 1 },
-        { 249, 51, 13, 1 },
-        { 172, 113, 91, 1 },
-        { 216, 102, 79, 1 }, },
-      { { 240, 103, 134, 1 },
-        { 109, 35, 59, 0 },
-        { 176, 243, 7, 1 },
-        { 110, 98, 91, 0 }, },
-      { { 4, 41, 238, 1 },
-        { 8, 142, 55, 1 },
-        { 187, 202, 16, 0 },
-        { 246, 56, 136, 0 }, },
-      { { 0, 35, 71, 1 },
-        { 40, 70, 19, 0 },
-        { 241, 98, 0, 0 },
-        { 100, 49, 10, 0 }, },
-      { { 0, 162, 251, 0 },
-        { 50, 198, 34, 1 },
-        { 111, 162, 128, 0 },
-        { 162, 49, 166, 0 }, },
-      { { 4, 200, 206, 0 },
-        { 66, 14, 52, 1 },
-        { 57, 137, 144, 0 },
-        { 150, 56, 33, 0 }, },
-      { { 0, 210, 225, 1 },
-        { 106, 196, 96, 0 },
-        { 195, 165, 128, 0 },
-        { 3, 17, 171, 0 }, },
-      { { 12, 10, 15, 0 },
-        { 160, 74, 20, 1 },
-        { 120, 40, 24, 0 },
-        { 148, 41, 2, 1 }, },
-      { { 8, 139, 198, 0 },
-        { 162, 14, 49, 0 },
-        { 49, 232, 136, 0 },
-        { 70, 56, 34, 1 }, },
-      { { 12, 134, 91, 0 },
-        { 179, 70, 4, 1 },
-        { 109, 48, 152, 0 },
-        { 144, 49, 102, 1 }, },
-      { { 5, 129, 253, 0 },
-        { 18, 212, 53, 1 },
-        { 95, 192, 208, 0 },
-        { 214, 21, 164, 0 }, },
-      { { 1, 113, 30, 0 },
-        { 80, 18, 83, 1 },
-        { 60, 71, 64, 0 },
-        { 229, 36, 5, 0 }, },
-      { { 1, 194, 21, 1 },
-        { 122, 80, 16, 0 },
-        { 212, 33, 192, 0 },
-        { 4, 5, 47, 0 }, },
-      { { 1, 231, 113, 0 },
-        { 115, 212, 3, 0 },
-        { 71, 115, 192, 0 },
-        { 96, 21, 231, 0 }, },
-      { { 9, 41, 191, 0 },
-        { 144, 218, 51, 1 },
-        { 126, 202, 72, 0 },
-        { 230, 45, 132, 1 }, },
-      { { 13, 16, 27, 1 },
-        { 152, 82, 68, 1 },
-        { 236, 4, 88, 0 },
-        { 145, 37, 12, 1 }, },
-      { { 13, 5, 24, 0 },
-        { 145, 16, 5, 1 },
-        { 12, 80, 88, 0 },
-        { 208, 4, 68, 1 }, },
-      { { 13, 237, 47, 1 },
-        { 203, 218, 23, 1 },
-        { 250, 91, 216, 0 },
-        { 244, 45, 233, 1 }, },
-      { { 13, 102, 222, 0 },
-        { 241, 22, 54, 1 },
-        { 61, 179, 88, 0 },
-        { 182, 52, 71, 1 }, },
-      { { 9, 242, 118, 0 },
-        { 242, 150, 82, 0 },
-        { 55, 39, 200, 0 },
-        { 37, 52, 167, 1 }, },
-      { { 2, 208, 130, 1 },
-        { 74, 2, 224, 0 },
-        { 160, 133, 160, 0 },
-        { 3, 160, 41, 0 }, },
-      { { 2, 98, 201, 0 },
-        { 96, 68, 162, 1 },
-        { 73, 163, 32, 0 },
-        { 162, 145, 3, 0 }, },
-      { { 6, 243, 169, 0 },
-        { 98, 192, 231, 1 },
-        { 74, 231, 176, 0 },
-        { 243, 129, 163, 0 }, },
-      { { 6, 239, 35, 0 },
-        { 99, 202, 135, 0 },
-        { 98, 123, 176, 0 },
-        { 112, 169, 227, 0 }, },
-      { { 14, 62, 18, 0 },
-        { 177, 10, 198, 0 },
-        { 36, 62, 56, 0 },
-        { 49, 168, 70, 1 }, },
-      { { 10, 154, 221, 1 },
-        { 186, 76, 240, 1 },
-        { 221, 172, 168, 0 },
-        { 135, 153, 46, 1 }, },
-      { { 10, 97, 109, 1 },
-        { 200, 196, 147, 1 },
-        { 219, 67, 40, 0 },
-        { 228, 145, 137, 1 }, },
-      { { 10, 255, 81, 0 },
-        { 243, 76, 195, 0 },
-        { 69, 127, 168, 0 },
-        { 97, 153, 103, 1 }, },
-      { { 7, 230, 114, 1 },
-        { 123, 150, 134, 0 },
-        { 167, 51, 240, 0 },
-        { 48, 180, 239, 0 }, },
-      { { 11, 154, 1, 0 },
-        { 162, 88, 192, 0 },
-        { 64, 44, 232, 0 },
-        { 1, 141, 34, 1 }, },
-      { { 15, 208, 142, 0 },
-        { 194, 18, 244, 1 },
-        { 56, 133, 248, 0 },
-        { 151, 164, 33, 1 }, },
-      { { 15, 73, 147, 0 },
-        { 208, 90, 165, 0 },
-        { 100, 201, 120, 0 },
-        { 82, 173, 5, 1 }, },
-      { { 15, 247, 123, 0 },
-        { 243, 214, 199, 1 },
-        { 111, 119, 248, 0 },
-        { 241, 181, 231, 1 }, },
-      { { 16, 158, 96, 1 },
-        { 47, 140, 64, 0 },
-        { 131, 60, 132, 0 },
-        { 1, 24, 250, 0 }, },
-      { { 16, 81, 237, 0 },
-        { 68, 196, 113, 1 },
-        { 91, 197, 4, 0 },
-        { 199, 17, 145, 0 }, },
-      { { 20, 122, 222, 1 },
-        { 124, 14, 118, 1 },
-        { 189, 175, 20, 0 },
-        { 183, 56, 31, 0 }, },
-      { { 28, 133, 62, 1 },
-        { 159, 130, 21, 1 },
-        { 190, 80, 156, 0 },
-        { 212, 32, 252, 1 }, },
-      { { 28, 35, 104, 0 },
-        { 164, 132, 7, 1 },
-        { 11, 98, 28, 0 },
-        { 240, 16, 146, 1 }, },
-      { { 24, 199, 52, 0 },
-        { 247, 128, 17, 0 },
-        { 22, 113, 140, 0 },
-        { 68, 0, 247, 1 }, },
-      { { 21, 251, 130, 1 },
-        { 110, 26, 103, 0 },
-        { 160, 239, 212, 0 },
-        { 115, 44, 59, 0 }, },
-      { { 17, 78, 147, 1 },
-        { 125, 90, 32, 0 },
-        { 228, 185, 68, 0 },
-        { 2, 45, 95, 0 }, },
-      { { 25, 160, 234, 1 },
-        { 142, 150, 34, 1 },
-        { 171, 130, 204, 0 },
-        { 162, 52, 184, 1 }, },
-      { { 18, 24, 76, 0 },
-        { 4, 12, 208, 1 },
-        { 25, 12, 36, 0 },
-        { 133, 152, 16, 0 }, },
-      { { 18, 163, 174, 0 },
-        { 38, 130, 179, 1 },
-        { 58, 226, 164, 0 },
-        { 230, 160, 178, 0 }, },
-      { { 30, 172, 60, 0 },
-        { 151, 136, 150, 1 },
-        { 30, 26, 188, 0 },
-        { 180, 136, 244, 1 }, },
-      { { 30, 201, 108, 0 },
-        { 198, 140, 149, 1 },
-        { 27, 73, 188, 0 },
-        { 212, 152, 177, 1 }, },
-      { { 30, 233, 163, 1 },
-        { 206, 202, 167, 0 },
-        { 226, 203, 188, 0 },
-        { 114, 169, 185, 1 }, },
-      { { 26, 118, 216, 0 },
-        { 245, 4, 226, 1 },
-        { 13, 183, 44, 0 },
-        { 163, 144, 87, 1 }, },
-      { { 19, 182, 7, 1 },
-        { 47, 82, 210, 0 },
-        { 240, 54, 228, 0 },
-        { 37, 165, 122, 0 }, },
-      { { 23, 70, 188, 0 },
-        { 117, 144, 180, 1 },
-        { 30, 177, 116, 0 },
-        { 150, 132, 215, 0 }, },
-      { { 31, 21, 121, 0 },
-        { 149, 212, 197, 1 },
-        { 79, 84, 124, 0 },
-        { 209, 149, 212, 1 }, },
-      { { 27, 35, 125, 0 },
-        { 180, 212, 147, 1 },
-        { 95, 98, 108, 0 },
-        { 228, 149, 150, 1 }, },
-      { { 27, 191, 146, 0 },
-        { 183, 26, 227, 0 },
-        { 36, 254, 236, 0 },
-        { 99, 172, 118, 1 }, },
-      { { 31, 150, 154, 1 },
-        { 191, 18, 228, 1 },
-        { 172, 180, 252, 0 },
-        { 147, 164, 126, 1 }, },
-      { { 27, 72, 235, 0 },
-        { 196, 222, 160, 1 },
-        { 107, 137, 108, 0 },
-        { 130, 189, 145, 1 }, },
-      { { 32, 12, 253, 0 },
-        { 17, 236, 48, 1 },
-        { 95, 152, 2, 0 },
-        { 134, 27, 196, 0 }, },
-      { { 32, 23, 86, 0 },
-        { 49, 38, 81, 0 },
-        { 53, 116, 2, 0 },
-        { 69, 50, 70, 0 }, },
-      { { 40, 1, 153, 1 },
-        { 152, 96, 33, 1 },
-        { 204, 192, 10, 0 },
-        { 194, 3, 12, 1 }, },
-      { { 44, 50, 55, 1 },
-        { 184, 226, 86, 0 },
-        { 246, 38, 26, 0 },
-        { 53, 35, 142, 1 }, },
-      { { 37, 140, 230, 0 },
-        { 3, 190, 52, 0 },
-        { 51, 152, 210, 0 },
-        { 22, 62, 224, 0 }, },
-      { { 33, 30, 140, 0 },
-        { 33, 56, 112, 1 },
-        { 24, 188, 66, 0 },
-        { 135, 14, 66, 0 }, },
-      { { 45, 125, 105, 0 },
-        { 193, 252, 71, 1 },
-        { 75, 95, 90, 0 },
-        { 241, 31, 193, 1 }, },
-      { { 41, 192, 73, 0 },
-        { 194, 116, 0, 1 },
-        { 73, 1, 202, 0 },
-        { 128, 23, 33, 1 }, },
-      { { 38, 177, 32, 0 },
-        { 2, 160, 199, 0 },
-        { 2, 70, 178, 0 },
-        { 113, 130, 160, 0 }, },
-      { { 38, 128, 28, 1 },
-        { 26, 32, 148, 1 },
-        { 156, 0, 178, 0 },
-        { 148, 130, 44, 0 }, },
-      { { 34, 180, 26, 0 },
-        { 19, 34, 194, 1 },
-        { 44, 22, 162, 0 },
-        { 161, 162, 100, 0 }, },
-      { { 38, 42, 68, 1 },
-        { 40, 44, 150, 0 },
-        { 145, 42, 50, 0 },
-        { 52, 154, 10, 0 }, },
-      { { 38, 171, 89, 0 },
-        { 50, 108, 135, 1 },
-        { 77, 106, 178, 0 },
-        { 240, 155, 38, 0 }, },
-      { { 38, 201, 132, 0 },
-        { 66, 40, 181, 0 },
-        { 16, 201, 178, 0 },
-        { 86, 138, 33, 0 }, },
-      { { 42, 48, 98, 1 },
-        { 136, 166, 194, 0 },
-        { 163, 6, 42, 0 },
-        { 33, 178, 136, 1 }, },
-      { { 46, 50, 173, 0 },
-        { 160, 224, 246, 1 },
-        { 90, 166, 58, 0 },
-        { 183, 131, 130, 1 }, },
-      { { 35, 63, 1, 1 },
-        { 41, 120, 195, 0 },
-        { 192, 126, 98, 0 },
-        { 97, 143, 74, 0 }, },
-      { { 35, 131, 80, 0 },
-        { 50, 52, 129, 0 },
-        { 5, 96, 226, 0 },
-        { 64, 150, 38, 0 }, },
-      { { 39, 100, 46, 1 },
-        { 73, 178, 150, 1 },
-        { 186, 19, 114, 0 },
-        { 180, 166, 201, 0 }, },
-      { { 39, 212, 176, 1 },
-        { 91, 176, 228, 0 },
-        { 134, 149, 242, 0 },
-        { 19, 134, 237, 0 }, },
-      { { 47, 186, 44, 1 },
-        { 170, 184, 214, 1 },
-        { 154, 46, 250, 0 },
-        { 181, 142, 170, 1 }, },
-      { { 43, 38, 186, 1 },
-        { 185, 178, 162, 1 },
-        { 174, 178, 106, 0 },
-        { 162, 166, 206, 1 }, },
-      { { 48, 11, 141, 0 },
-        { 36, 104, 49, 1 },
-        { 88, 232, 6, 0 },
-        { 198, 11, 18, 0 }, },
-      { { 52, 38, 146, 1 },
-        { 61, 34, 38, 0 },
-        { 164, 178, 22, 0 },
-        { 50, 34, 94, 0 }, },
-      { { 48, 130, 25, 0 },
-        { 54, 96, 0, 1 },
-        { 76, 32, 134, 0 },
-        { 128, 3, 54, 0 }, },
-      { { 48, 123, 44, 1 },
-        { 108, 168, 83, 1 },
-        { 154, 111, 6, 0 },
-        { 229, 10, 155, 0 }, },
-      { { 60, 184, 59, 1 },
-        { 158, 234, 70, 1 },
-        { 238, 14, 158, 0 },
-        { 177, 43, 188, 1 }, },
-      { { 60, 38, 15, 1 },
-        { 173, 98, 22, 1 },
-        { 248, 50, 30, 0 },
-        { 180, 35, 90, 1 }, },
-      { { 56, 233, 220, 0 },
-        { 214, 44, 51, 1 },
-        { 29, 203, 142, 0 },
-        { 230, 26, 53, 1 }, },
-      { { 60, 192, 247, 0 },
-        { 214, 230, 52, 0 },
-        { 119, 129, 158, 0 },
-        { 22, 51, 181, 1 }, },
-      { { 56, 247, 84, 1 },
-        { 255, 36, 83, 0 },
-        { 149, 119, 142, 0 },
-        { 101, 18, 127, 1 }, },
-      { { 49, 5, 180, 1 },
-        { 29, 176, 49, 0 },
-        { 150, 208, 70, 0 },
-        { 70, 6, 220, 0 }, },
-      { { 53, 184, 254, 1 },
-        { 30, 190, 118, 1 },
-        { 191, 142, 214, 0 },
-        { 183, 62, 188, 0 }, },
-      { { 53, 178, 211, 1 },
-        { 62, 118, 102, 0 },
-        { 229, 166, 214, 0 },
-        { 51, 55, 62, 0 }, },
-      { { 57, 155, 206, 1 },
-        { 174, 62, 113, 1 },
-        { 185, 236, 206, 0 },
-        { 199, 62, 58, 1 }, },
-      { { 57, 109, 46, 0 },
-        { 197, 186, 19, 1 },
-        { 58, 91, 78, 0 },
-        { 228, 46, 209, 1 }, },
-      { { 61, 224, 131, 1 },
-        { 206, 114, 38, 0 },
-        { 224, 131, 222, 0 },
-        { 50, 39, 57, 1 }, },
-      { { 57, 244, 208, 0 },
-        { 215, 52, 98, 0 },
-        { 5, 151, 206, 0 },
-        { 35, 22, 117, 1 }, },
-      { { 57, 255, 32, 0 },
-        { 231, 184, 67, 0 },
-        { 2, 127, 206, 0 },
-        { 97, 14, 243, 1 }, },
-      { { 57, 199, 136, 1 },
-        { 239, 48, 33, 1 },
-        { 136, 241, 206, 0 },
-        { 194, 6, 123, 1 }, },
-      { { 54, 15, 36, 0 },
-        { 37, 168, 149, 0 },
-        { 18, 120, 54, 0 },
-        { 84, 138, 210, 0 }, },
-      { { 50, 30, 213, 0 },
-        { 53, 108, 240, 0 },
-        { 85, 188, 38, 0 },
-        { 7, 155, 86, 0 }, },
-      { { 54, 191, 209, 1 },
-        { 63, 108, 231, 0 },
-        { 197, 254, 182, 0 },
-        { 115, 155, 126, 0 }, },
-      { { 54, 70, 235, 0 },
-        { 101, 230, 164, 1 },
-        { 107, 177, 54, 0 },
-        { 146, 179, 211, 0 }, },
-      { { 58, 45, 168, 0 },
-        { 133, 168, 163, 1 },
-        { 10, 218, 46, 0 },
-        { 226, 138, 208, 1 }, },
-      { { 58, 147, 187, 0 },
-        { 182, 226, 225, 1 },
-        { 110, 228, 174, 0 },
-        { 195, 163, 182, 1 }, },
-      { { 55, 149, 173, 0 },
-        { 7, 240, 245, 1 },
-        { 90, 212, 246, 0 },
-        { 215, 135, 240, 0 }, },
-      { { 55, 4, 147, 0 },
-        { 21, 114, 164, 0 },
-        { 100, 144, 118, 0 },
-        { 18, 167, 84, 0 }, },
-      { { 51, 160, 216, 1 },
-        { 30, 52, 162, 1 },
-        { 141, 130, 230, 0 },
-        { 162, 150, 60, 0 }, },
-      { { 55, 67, 167, 0 },
-        { 100, 242, 181, 0 },
-        { 114, 225, 118, 0 },
-        { 86, 167, 147, 0 }, },
-      { { 51, 250, 92, 0 },
-        { 118, 60, 210, 1 },
-        { 29, 47, 230, 0 },
-        { 165, 158, 55, 0 }, },
-      { { 63, 131, 110, 0 },
-        { 166, 182, 149, 1 },
-        { 59, 96, 254, 0 },
-        { 212, 182, 178, 1 }, },
-      { { 63, 107, 96, 0 },
-        { 228, 188, 135, 0 },
-        { 3, 107, 126, 0 },
-        { 112, 158, 147, 1 }, },
-      { { 64, 225, 205, 0 },
-        { 66, 69, 51, 1 },
-        { 89, 195, 129, 0 },
-        { 230, 81, 33, 0 }, },
-      { { 76, 144, 234, 0 },
-        { 130, 135, 100, 1 },
-        { 43, 132, 153, 0 },
-        { 147, 112, 160, 1 }, },
-      { { 72, 154, 105, 1 },
-        { 170, 205, 64, 1 },
-        { 203, 44, 137, 0 },
-        { 129, 89, 170, 1 }, },
-      { { 76, 190, 247, 0 },
-        { 179, 207, 118, 0 },
-        { 119, 190, 153, 0 },
-        { 55, 121, 230, 1 }, },
-      { { 72, 235, 138, 1 },
-        { 234, 11, 35, 1 },
-        { 168, 235, 137, 0 },
-        { 226, 104, 43, 1 }, },
-      { { 72, 211, 7, 1 },
-        { 234, 67, 81, 0 },
-        { 240, 101, 137, 0 },
-        { 69, 97, 43, 1 }, },
-      { { 76, 90, 152, 1 },
-        { 248, 9, 100, 1 },
-        { 140, 173, 25, 0 },
-        { 147, 72, 15, 1 }, },
-      { { 65, 36, 19, 1 },
-        { 25, 83, 2, 0 },
-        { 228, 18, 65, 0 },
-        { 32, 101, 76, 0 }, },
-      { { 77, 11, 248, 0 },
-        { 176, 157, 37, 1 },
-        { 15, 232, 89, 0 },
-        { 210, 92, 134, 1 }, },
-      { { 73, 91, 189, 1 },
-        { 248, 217, 113, 1 },
-        { 222, 237, 73, 0 },
-        { 199, 77, 143, 1 }, },
-      { { 70, 141, 101, 0 },
-        { 3, 205, 149, 0 },
-        { 83, 88, 177, 0 },
-        { 84, 217, 224, 0 }, },
-      { { 66, 181, 107, 1 },
-        { 11, 199, 195, 1 },
-        { 235, 86, 161, 0 },
-        { 225, 241, 232, 0 }, },
-      { { 70, 92, 131, 0 },
-        { 65, 75, 228, 0 },
-        { 96, 157, 49, 0 },
-        { 19, 233, 65, 0 }, },
-      { { 70, 244, 103, 0 },
-        { 67, 199, 214, 0 },
-        { 115, 23, 177, 0 },
-        { 53, 241, 225, 0 }, },
-      { { 70, 121, 187, 0 },
-        { 80, 203, 231, 1 },
-        { 110, 207, 49, 0 },
-        { 243, 233, 133, 0 }, },
-      { { 74, 163, 157, 1 },
-        { 186, 65, 179, 1 },
-        { 220, 226, 169, 0 },
-        { 230, 193, 46, 1 }, },
-      { { 78, 65, 78, 1 },
-        { 200, 7, 149, 1 },
-        { 185, 65, 57, 0 },
-        { 212, 240, 9, 1 }, },
-      { { 78, 75, 194, 0 },
-        { 224, 15, 165, 0 },
-        { 33, 233, 57, 0 },
-        { 82, 248, 3, 1 }, },
-      { { 67, 137, 211, 1 },
-        { 26, 95, 161, 0 },
-        { 229, 200, 225, 0 },
-        { 66, 253, 44, 0 }, },
-      { { 71, 170, 200, 1 },
-        { 42, 29, 166, 1 },
-        { 137, 170, 241, 0 },
-        { 178, 220, 42, 0 }, },
-      { { 67, 59, 19, 0 },
-        { 48, 91, 195, 0 },
-        { 100, 110, 97, 0 },
-        { 97, 237, 6, 0 }, },
-      { { 71, 74, 105, 1 },
-        { 104, 221, 132, 1 },
-        { 203, 41, 113, 0 },
-        { 144, 221, 139, 0 }, },
-      { { 79, 22, 235, 1 },
-        { 169, 215, 228, 1 },
-        { 235, 180, 121, 0 },
-        { 147, 245, 202, 1 }, },
-      { { 79, 69, 160, 0 },
-        { 193, 145, 165, 0 },
-        { 2, 209, 121, 0 },
-        { 82, 196, 193, 1 }, },
-      { { 80, 145, 108, 1 },
-        { 14, 133, 81, 1 },
-        { 155, 68, 133, 0 },
-        { 197, 80, 184, 0 }, },
-      { { 84, 16, 187, 0 },
-        { 20, 195, 100, 1 },
-        { 110, 132, 21, 0 },
-        { 147, 97, 148, 0 }, },
-      { { 80, 90, 77, 1 },
-        { 108, 77, 80, 1 },
-        { 217, 45, 5, 0 },
-        { 133, 89, 27, 0 }, },
-      { { 80, 114, 212, 0 },
-        { 116, 5, 114, 0 },
-        { 21, 167, 5, 0 },
-        { 39, 80, 23, 0 }, },
-      { { 84, 234, 241, 1 },
-        { 126, 205, 38, 0 },
-        { 199, 171, 149, 0 },
-        { 50, 89, 191, 0 }, },
-      { { 88, 9, 195, 1 },
-        { 140, 79, 33, 0 },
-        { 225, 200, 13, 0 },
-        { 66, 121, 24, 1 }, },
-      { { 92, 89, 121, 0 },
-        { 212, 205, 69, 1 },
-        { 79, 77, 29, 0 },
-        { 209, 89, 149, 1 }, },
-      { { 88, 107, 27, 0 },
-        { 244, 75, 3, 1 },
-        { 108, 107, 13, 0 },
-        { 224, 105, 23, 1 }, },
-      { { 81, 52, 246, 1 },
-        { 29, 151, 114, 0 },
-        { 183, 150, 69, 0 },
-        { 39, 116, 220, 0 }, },
-      { { 85, 169, 118, 1 },
-        { 30, 159, 23, 0 },
-        { 183, 74, 213, 0 },
-        { 116, 124, 188, 0 }, },
-      { { 85, 151, 183, 1 },
-        { 63, 211, 117, 0 },
-        { 246, 244, 213, 0 },
-        { 87, 101, 254, 0 }, },
-      { { 85, 72, 67, 1 },
-        { 76, 95, 4, 0 },
-        { 225, 9, 85, 0 },
-        { 16, 125, 25, 0 }, },
-      { { 81, 203, 28, 0 },
-        { 118, 25, 17, 1 },
-        { 28, 105, 197, 0 },
-        { 196, 76, 55, 0 }, },
-      { { 89, 103, 105, 1 },
-        { 237, 213, 3, 1 },
-        { 203, 115, 77, 0 },
-        { 224, 85, 219, 1 }, },
-      { { 89, 87, 155, 0 },
-        { 245, 83, 97, 1 },
-        { 108, 245, 77, 0 },
-        { 195, 101, 87, 1 }, },
-      { { 86, 160, 171, 1 },
-        { 14, 195, 166, 1 },
-        { 234, 130, 181, 0 },
-        { 178, 225, 184, 0 }, },
-      { { 82, 76, 88, 0 },
-        { 85, 13, 128, 1 },
-        { 13, 25, 37, 0 },
-        { 128, 216, 85, 0 }, },
-      { { 86, 87, 68, 1 },
-        { 109, 5, 213, 0 },
-        { 145, 117, 53, 0 },
-        { 85, 208, 91, 0 }, },
-      { { 94, 1, 56, 0 },
-        { 148, 129, 133, 1 },
-        { 14, 64, 61, 0 },
-        { 208, 192, 148, 1 }, },
-      { { 90, 1, 255, 0 },
-        { 148, 199, 177, 1 },
-        { 127, 192, 45, 0 },
-        { 198, 241, 148, 1 }, },
-      { { 90, 53, 19, 1 },
-        { 157, 67, 195, 0 },
-        { 228, 86, 45, 0 },
-        { 97, 225, 92, 1 }, },
-      { { 94, 29, 215, 1 },
-        { 157, 79, 245, 0 },
-        { 245, 220, 61, 0 },
-        { 87, 249, 92, 1 }, },
-      { { 94, 146, 70, 1 },
-        { 174, 7, 212, 0 },
-        { 177, 36, 189, 0 },
-        { 21, 240, 58, 1 }, },
-      { { 90, 108, 162, 0 },
-        { 197, 139, 162, 0 },
-        { 34, 155, 45, 0 },
-        { 34, 232, 209, 1 }, },
-      { { 87, 57, 5, 0 },
-        { 4, 89, 215, 0 },
-        { 80, 78, 117, 0 },
-        { 117, 205, 16, 0 }, },
-      { { 87, 185, 238, 0 },
-        { 6, 159, 247, 1 },
-        { 59, 206, 245, 0 },
-        { 247, 252, 176, 0 }, },
-      { { 83, 27, 44, 1 },
-        { 44, 153, 209, 1 },
-        { 154, 108, 101, 0 },
-        { 197, 204, 154, 0 }, },
-      { { 87, 134, 8, 0 },
-        { 39, 17, 132, 1 },
-        { 8, 48, 245, 0 },
-        { 144, 196, 114, 0 }, },
-      { { 87, 179, 31, 1 },
-        { 62, 83, 215, 1 },
-        { 252, 102, 245, 0 },
-        { 245, 229, 62, 0 }, },
-      { { 87, 175, 125, 0 },
-        { 55, 221, 151, 1 },
-        { 95, 122, 245, 0 },
-        { 244, 221, 246, 0 }, },
-      { { 83, 240, 235, 0 },
-        { 70, 215, 226, 1 },
-        { 107, 135, 229, 0 },
-        { 163, 245, 177, 0 }, },
-      { { 91, 30, 236, 0 },
-        { 165, 157, 240, 1 },
-        { 27, 188, 109, 0 },
-        { 135, 220, 210, 1 }, },
-      { { 95, 6, 166, 1 },
-        { 173, 147, 180, 0 },
-        { 178, 176, 125, 0 },
-        { 22, 228, 218, 1 }, },
-      { { 95, 46, 87, 1 },
-        { 189, 95, 150, 0 },
-        { 245, 58, 125, 0 },
-        { 52, 253, 94, 1 }, },
-      { { 91, 89, 192, 0 },
-        { 196, 29, 225, 0 },
-        { 1, 205, 109, 0 },
-        { 67, 220, 17, 1 }, },
-      { { 91, 221, 125, 1 },
-        { 223, 221, 209, 1 },
-        { 223, 93, 237, 0 },
-        { 197, 221, 253, 1 }, },
-      { { 91, 78, 47, 0 },
-        { 229, 219, 144, 1 },
-        { 122, 57, 109, 0 },
-        { 132, 237, 211, 1 }, },
-      { { 95, 111, 137, 1 },
-        { 237, 89, 167, 1 },
-        { 200, 251, 125, 0 },
-        { 242, 205, 91, 1 }, },
-      { { 91, 99, 218, 0 },
-        { 244, 23, 163, 1 },
-        { 45, 227, 109, 0 },
-        { 226, 244, 23, 1 }, },
-      { { 96, 32, 36, 1 },
-        { 8, 161, 18, 0 },
-        { 146, 2, 3, 0 },
-        { 36, 66, 136, 0 }, },
-      { { 100, 167, 30, 1 },
-        { 59, 35, 23, 1 },
-        { 188, 114, 147, 0 },
-        { 244, 98, 110, 0 }, },
-      { { 96, 84, 84, 1 },
-        { 89, 37, 80, 0 },
-        { 149, 21, 3, 0 },
-        { 5, 82, 77, 0 }, },
-      { { 104, 166, 103, 0 },
-        { 163, 231, 18, 0 },
-        { 115, 50, 139, 0 },
-        { 36, 115, 226, 1 }, },
-      { { 108, 235, 188, 1 },
-        { 250, 169, 55, 1 },
-        { 158, 235, 155, 0 },
-        { 246, 74, 175, 1 }, },
-      { { 105, 70, 205, 1 },
-        { 233, 117, 48, 1 },
-        { 217, 177, 75, 0 },
-        { 134, 87, 75, 1 }, },
-      { { 109, 243, 169, 1 },
-        { 234, 241, 103, 1 },
-        { 202, 231, 219, 0 },
-        { 243, 71, 171, 1 }, },
-      { { 109, 94, 31, 0 },
-        { 241, 123, 84, 1 },
-        { 124, 61, 91, 0 },
-        { 149, 111, 71, 1 }, },
-      { { 102, 32, 99, 0 },
-        { 0, 231, 134, 0 },
-        { 99, 2, 51, 0 },
-        { 48, 243, 128, 0 }, },
-      { { 102, 219, 83, 1 },
-        { 122, 111, 197, 0 },
-        { 229, 109, 179, 0 },
-        { 81, 251, 47, 0 }, },
-      { { 98, 215, 16, 1 },
-        { 123, 33, 193, 0 },
-        { 132, 117, 163, 0 },
-        { 65, 194, 111, 0 }, },
-      { { 106, 165, 84, 1 },
-        { 155, 37, 147, 0 },
-        { 149, 82, 171, 0 },
-        { 100, 210, 108, 1 }, },
-      { { 110, 46, 41, 1 },
-        { 169, 233, 134, 1 },
-        { 202, 58, 59, 0 },
-        { 176, 203, 202, 1 }, },
-      { { 103, 54, 146, 0 },
-        { 49, 51, 230, 0 },
-        { 36, 182, 115, 0 },
-        { 51, 230, 70, 0 }, },
-      { { 103, 196, 202, 0 },
-        { 67, 55, 164, 1 },
-        { 41, 145, 243, 0 },
-        { 146, 246, 97, 0 }, },
-      { { 99, 83, 34, 1 },
-        { 104, 179, 193, 0 },
-        { 162, 101, 99, 0 },
-        { 65, 230, 139, 0 }, },
-      { { 107, 59, 196, 1 },
-        { 168, 61, 243, 0 },
-        { 145, 238, 107, 0 },
-        { 103, 222, 10, 1 }, },
-      { { 111, 22, 80, 1 },
-        { 185, 53, 196, 0 },
-        { 133, 52, 123, 0 },
-        { 17, 214, 78, 1 }, },
-      { { 107, 88, 37, 1 },
-        { 200, 249, 208, 0 },
-        { 210, 13, 107, 0 },
-        { 5, 207, 137, 1 }, },
-      { { 111, 99, 213, 1 },
-        { 248, 117, 183, 0 },
-        { 213, 227, 123, 0 },
-        { 118, 215, 15, 1 }, },
-      { { 112, 192, 248, 1 },
-        { 94, 165, 32, 1 },
-        { 143, 129, 135, 0 },
-        { 130, 82, 189, 0 }, },
-      { { 116, 215, 208, 0 },
-        { 119, 37, 101, 0 },
-        { 5, 245, 151, 0 },
-        { 83, 82, 119, 0 }, },
-      { { 113, 43, 110, 1 },
-        { 44, 191, 19, 1 },
-        { 187, 106, 71, 0 },
-        { 228, 126, 154, 0 }, },
-      { { 113, 121, 27, 1 },
-        { 92, 123, 67, 1 },
-        { 236, 79, 71, 0 },
-        { 225, 111, 29, 0 }, },
-      { { 113, 66, 210, 0 },
-        { 116, 55, 32, 0 },
-        { 37, 161, 71, 0 },
-        { 2, 118, 23, 0 }, },
-      { { 113, 99, 253, 0 },
-        { 116, 245, 51, 1 },
-        { 95, 227, 71, 0 },
-        { 230, 87, 151, 0 }, },
-      { { 117, 254, 122, 1 },
-        { 127, 191, 70, 1 },
-        { 175, 63, 215, 0 },
-        { 177, 126, 255, 0 }, },
-      { { 125, 152, 140, 0 },
-        { 134, 57, 116, 1 },
-        { 24, 140, 223, 0 },
-        { 151, 78, 48, 1 }, },
-      { { 125, 185, 247, 0 },
-        { 150, 255, 119, 0 },
-        { 119, 206, 223, 0 },
-        { 119, 127, 180, 1 }, },
-      { { 125, 19, 147, 1 },
-        { 188, 115, 101, 0 },
-        { 228, 228, 95, 0 },
-        { 83, 103, 30, 1 }, },
-      { { 121, 71, 103, 0 },
-        { 229, 247, 17, 0 },
-        { 115, 113, 79, 0 },
-        { 68, 119, 211, 1 }, },
-      { { 125, 223, 195, 0 },
-        { 231, 127, 101, 0 },
-        { 97, 253, 223, 0 },
-        { 83, 127, 115, 1 }, },
-      { { 121, 239, 82, 1 },
-        { 255, 63, 3, 0 },
-        { 165, 123, 207, 0 },
-        { 96, 126, 127, 1 }, },
-      { { 114, 0, 182, 0 },
-        { 20, 163, 176, 0 },
-        { 54, 128, 39, 0 },
-        { 6, 226, 148, 0 }, },
-      { { 118, 68, 152, 1 },
-        { 93, 33, 164, 1 },
-        { 140, 145, 55, 0 },
-        { 146, 194, 93, 0 }, },
-      { { 118, 122, 66, 0 },
-        { 100, 47, 198, 0 },
-        { 33, 47, 55, 0 },
-        { 49, 250, 19, 0 }, },
-      { { 126, 11, 181, 1 },
-        { 188, 233, 181, 0 },
-        { 214, 232, 63, 0 },
-        { 86, 203, 158, 1 }, },
-      { { 115, 58, 225, 1 },
-        { 44, 253, 226, 0 },
-        { 195, 174, 103, 0 },
-        { 35, 223, 154, 0 }, },
-      { { 119, 139, 59, 1 },
-        { 62, 251, 133, 1 },
-        { 238, 104, 247, 0 },
-        { 208, 239, 190, 0 }, },
-      { { 119, 93, 234, 0 },
-        { 69, 191, 229, 1 },
-        { 43, 221, 119, 0 },
-        { 211, 254, 209, 0 }, },
-      { { 127, 76, 0, 1 },
-        { 205, 57, 132, 0 },
-        { 128, 25, 127, 0 },
-        { 16, 206, 89, 1 }, },
-      { { 123, 117, 224, 1 },
-        { 205, 181, 227, 0 },
-        { 131, 215, 111, 0 },
-        { 99, 214, 217, 1 }, },
-      { { 127, 226, 186, 0 },
-        { 246, 179, 166, 1 },
-        { 46, 163, 255, 0 },
-        { 178, 230, 183, 1 }, },
-      { { 128, 176, 67, 1 },
-        { 10, 70, 74, 0 },
-        { 225, 6, 128, 1 },
-        { 41, 49, 40, 0 }, },
-      { { 128, 188, 61, 0 },
-        { 19, 200, 90, 1 },
-        { 94, 30, 128, 1 },
-        { 173, 9, 228, 0 }, },
-      { { 128, 50, 88, 0 },
-        { 48, 4, 74, 1 },
-        { 13, 38, 0, 1 },
-        { 169, 16, 6, 0 }, },
-      { { 128, 92, 26, 1 },
-        { 89, 10, 72, 1 },
-        { 172, 29, 0, 1 },
-        { 137, 40, 77, 0 }, },
-      { { 132, 251, 36, 0 },
-        { 98, 136, 95, 0 },
-        { 18, 111, 144, 1 },
-        { 125, 8, 163, 0 }, },
-      { { 128, 127, 245, 1 },
-        { 121, 204, 123, 0 },
-        { 215, 255, 0, 1 },
-        { 111, 25, 207, 0 }, },
-      { { 136, 45, 197, 1 },
-        { 137, 76, 59, 0 },
-        { 209, 218, 8, 1 },
-        { 110, 25, 72, 1 }, },
-      { { 136, 153, 224, 1 },
-        { 138, 140, 105, 0 },
-        { 131, 204, 136, 1 },
-        { 75, 24, 168, 1 }, },
-      { { 136, 25, 149, 0 },
-        { 144, 72, 121, 0 },
-        { 84, 204, 8, 1 },
-        { 79, 9, 4, 1 }, },
-      { { 133, 29, 199, 1 },
-        { 9, 94, 125, 0 },
-        { 241, 220, 80, 1 },
-        { 95, 61, 72, 0 }, },
-      { { 129, 187, 135, 0 },
-        { 34, 90, 123, 0 },
-        { 112, 238, 192, 1 },
-        { 111, 45, 34, 0 }, },
-      { { 129, 225, 96, 1 },
-        { 74, 148, 11, 0 },
-        { 131, 67, 192, 1 },
-        { 104, 20, 169, 0 }, },
-      { { 133, 126, 33, 1 },
-        { 105, 216, 78, 0 },
-        { 194, 63, 80, 1 },
-        { 57, 13, 203, 0 }, },
-      { { 129, 242, 146, 0 },
-        { 114, 18, 106, 0 },
-        { 36, 167, 192, 1 },
-        { 43, 36, 39, 0 }, },
-      { { 137, 61, 108, 1 },
-        { 137, 156, 91, 1 },
-        { 155, 94, 72, 1 },
-        { 237, 28, 200, 1 }, },
-      { { 137, 100, 178, 1 },
-        { 217, 146, 42, 0 },
-        { 166, 147, 72, 1 },
-        { 42, 36, 205, 1 }, },
-      { { 141, 212, 30, 1 },
-        { 219, 18, 92, 1 },
-        { 188, 21, 216, 1 },
-        { 157, 36, 109, 1 }, },
-      { { 137, 94, 209, 1 },
-        { 249, 92, 104, 0 },
-        { 197, 189, 72, 1 },
-        { 11, 29, 79, 1 }, },
-      { { 138, 4, 172, 0 },
-        { 129, 128, 184, 1 },
-        { 26, 144, 40, 1 },
-        { 142, 128, 192, 1 }, },
-      { { 142, 200, 22, 0 },
-        { 210, 10, 156, 0 },
-        { 52, 9, 184, 1 },
-        { 28, 168, 37, 1 }, },
-      { { 142, 242, 252, 1 },
-        { 250, 132, 254, 1 },
-        { 159, 167, 184, 1 },
-        { 191, 144, 175, 1 }, },
-      { { 131, 11, 137, 0 },
-        { 32, 88, 169, 1 },
-        { 72, 232, 96, 1 },
-        { 202, 141, 2, 0 }, },
-      { { 135, 43, 109, 0 },
-        { 32, 220, 159, 1 },
-        { 91, 106, 112, 1 },
-        { 252, 157, 130, 0 }, },
-      { { 135, 69, 49, 0 },
-        { 81, 208, 141, 0 },
-        { 70, 81, 112, 1 },
-        { 88, 133, 197, 0 }, },
-      { { 131, 108, 120, 1 },
-        { 89, 156, 138, 1 },
-        { 143, 27, 96, 1 },
-        { 168, 156, 205, 0 }, },
-      { { 135, 238, 13, 0 },
-        { 99, 88, 158, 1 },
-        { 88, 59, 240, 1 },
-        { 188, 141, 99, 0 }, },
-      { { 139, 177, 43, 1 },
-        { 138, 210, 203, 1 },
-        { 234, 70, 232, 1 },
-        { 233, 165, 168, 1 }, },
-      { { 139, 145, 216, 0 },
-        { 146, 20, 233, 1 },
-        { 13, 196, 232, 1 },
-        { 203, 148, 36, 1 }, },
-      { { 139, 89, 102, 0 },
-        { 192, 158, 217, 0 },
-        { 51, 77, 104, 1 },
-        { 77, 188, 129, 1 }, },
-      { { 143, 229, 85, 0 },
-        { 211, 84, 159, 0 },
-        { 85, 83, 248, 1 },
-        { 124, 149, 101, 1 }, },
-      { { 143, 243, 101, 1 },
-        { 234, 212, 223, 0 },
-        { 211, 103, 248, 1 },
-        { 125, 149, 171, 1 }, },
-      { { 148, 26, 21, 0 },
-        { 52, 72, 92, 0 },
-        { 84, 44, 20, 1 },
-        { 29, 9, 22, 0 }, },
-      { { 144, 225, 167, 0 },
-        { 70, 194, 59, 0 },
-        { 114, 195, 132, 1 },
-        { 110, 33, 177, 0 }, },
-      { { 144, 71, 255, 0 },
-        { 117, 198, 57, 1 },
-        { 127, 241, 4, 1 },
-        { 206, 49, 215, 0 }, },
-      { { 156, 188, 213, 0 },
-        { 151, 76, 126, 0 },
-        { 85, 158, 156, 1 },
-        { 63, 25, 116, 1 }, },
-      { { 152, 146, 244, 0 },
-        { 182, 132, 120, 0 },
-        { 23, 164, 140, 1 },
-        { 15, 16, 182, 1 }, },
-      { { 156, 83, 168, 1 },
-        { 236, 128, 109, 1 },
-        { 138, 229, 28, 1 },
-        { 219, 0, 155, 1 }, },
-      { { 152, 195, 107, 0 },
-        { 230, 198, 9, 1 },
-        { 107, 97, 140, 1 },
-        { 200, 49, 179, 1 }, },
-      { { 152, 114, 63, 1 },
-        { 252, 194, 90, 1 },
-        { 254, 39, 12, 1 },
-        { 173, 33, 159, 1 }, },
-      { { 145, 19, 213, 0 },
-        { 52, 84, 121, 0 },
-        { 85, 228, 68, 1 },
-        { 79, 21, 22, 0 }, },
-      { { 149, 191, 251, 0 },
-        { 55, 222, 111, 1 },
-        { 111, 254, 212, 1 },
-        { 251, 61, 246, 0 }, },
-      { { 149, 69, 22, 1 },
-        { 93, 18, 29, 0 },
-        { 180, 81, 84, 1 },
-        { 92, 36, 93, 0 }, },
-      { { 149, 238, 216, 0 },
-        { 119, 28, 46, 1 },
-        { 13, 187, 212, 1 },
-        { 186, 28, 119, 0 }, },
-      { { 157, 214, 4, 0 },
-        { 231, 16, 92, 0 },
-        { 16, 53, 220, 1 },
-        { 29, 4, 115, 1 }, },
-      { { 157, 98, 112, 0 },
-        { 244, 148, 14, 0 },
-        { 7, 35, 92, 1 },
-        { 56, 20, 151, 1 }, },
-      { { 150, 175, 206, 0 },
-        { 39, 14, 191, 1 },
-        { 57, 250, 180, 1 },
-        { 254, 184, 114, 0 }, },
-      { { 150, 186, 24, 1 },
-        { 62, 8, 206, 1 },
-        { 140, 46, 180, 1 },
-        { 185, 136, 62, 0 }, },
-      { { 150, 217, 61, 1 },
-        { 94, 200, 221, 1 },
-        { 222, 77, 180, 1 },
-        { 221, 137, 189, 0 }, },
-      { { 158, 33, 46, 0 },
-        { 132, 130, 159, 1 },
-        { 58, 66, 60, 1 },
-        { 252, 160, 144, 1 }, },
-      { { 154, 185, 132, 0 },
-        { 134, 8, 251, 0 },
-        { 16, 206, 172, 1 },
-        { 111, 136, 48, 1 }, },
-      { { 154, 129, 79, 1 },
-        { 142, 70, 153, 1 },
-        { 249, 64, 172, 1 },
-        { 204, 177, 56, 1 }, },
-      { { 154, 59, 54, 1 },
-        { 188, 138, 219, 0 },
-        { 182, 110, 44, 1 },
-        { 109, 168, 158, 1 }, },
-      { { 158, 195, 37, 0 },
-        { 230, 192, 157, 0 },
-        { 82, 97, 188, 1 },
-        { 92, 129, 179, 1 }, },
-      { { 147, 149, 40, 0 },
-        { 7, 144, 201, 1 },
-        { 10, 84, 228, 1 },
-        { 201, 132, 240, 0 }, },
-      { { 151, 50, 46, 1 },
-        { 44, 146, 222, 1 },
-        { 186, 38, 116, 1 },
-        { 189, 164, 154, 0 }, },
-      { { 151, 211, 152, 0 },
-        { 118, 16, 237, 1 },
-        { 12, 229, 244, 1 },
-        { 219, 132, 55, 0 }, },
-      { { 155, 157, 163, 1 },
-        { 143, 218, 233, 0 },
-        { 226, 220, 236, 1 },
-        { 75, 173, 248, 1 }, },
-      { { 159, 28, 240, 0 },
-        { 149, 156, 236, 0 },
-        { 7, 156, 124, 1 },
-        { 27, 156, 212, 1 }, },
-      { { 159, 51, 82, 1 },
-        { 188, 22, 207, 0 },
-        { 165, 102, 124, 1 },
-        { 121, 180, 30, 1 }, },
-      { { 155, 250, 202, 0 },
-        { 230, 30, 234, 1 },
-        { 41, 175, 236, 1 },
-        { 171, 188, 51, 1 }, },
-      { { 159, 250, 148, 0 },
-        { 246, 24, 254, 0 },
-        { 20, 175, 252, 1 },
-        { 63, 140, 55, 1 }, },
-      { { 160, 60, 203, 1 },
-        { 9, 110, 106, 1 },
-        { 233, 158, 2, 1 },
-        { 171, 59, 72, 0 }, },
-      { { 164, 168, 105, 0 },
-        { 2, 236, 14, 1 },
-        { 75, 10, 146, 1 },
-        { 184, 27, 160, 0 }, },
-      { { 160, 179, 245, 0 },
-        { 50, 228, 123, 0 },
-        { 87, 230, 130, 1 },
-        { 111, 19, 166, 0 }, },
-      { { 164, 106, 191, 0 },
-        { 112, 234, 62, 1 },
-        { 126, 171, 18, 1 },
-        { 190, 43, 135, 0 }, },
-      { { 160, 91, 120, 1 },
-        { 120, 172, 73, 1 },
-        { 143, 109, 2, 1 },
-        { 201, 26, 143, 0 }, },
-      { { 168, 104, 152, 1 },
-        { 216, 40, 42, 1 },
-        { 140, 139, 10, 1 },
-        { 170, 10, 13, 1 }, },
-      { { 172, 205, 54, 1 },
-        { 219, 170, 29, 0 },
-        { 182, 89, 154, 1 },
-        { 92, 42, 237, 1 }, },
-      { { 172, 220, 121, 1 },
-        { 219, 236, 76, 1 },
-        { 207, 29, 154, 1 },
-        { 153, 27, 237, 1 }, },
-      { { 161, 73, 35, 0 },
-        { 64, 250, 9, 0 },
-        { 98, 73, 66, 1 },
-        { 72, 47, 129, 0 }, },
-      { { 161, 67, 217, 0 },
-        { 112, 116, 41, 1 },
-        { 77, 225, 66, 1 },
-        { 202, 23, 7, 0 }, },
-      { { 173, 176, 209, 0 },
-        { 146, 116, 110, 0 },
-        { 69, 134, 218, 1 },
-        { 59, 23, 36, 1 }, },
-      { { 169, 155, 28, 1 },
-        { 186, 56, 89, 1 },
-        { 156, 108, 202, 1 },
-        { 205, 14, 46, 1 }, },
-      { { 169, 138, 215, 1 },
-        { 186, 126, 56, 0 },
-        { 245, 168, 202, 1 },
-        { 14, 63, 46, 1 }, },
-      { { 173, 84, 106, 1 },
-        { 201, 182, 76, 1 },
-        { 171, 21, 90, 1 },
-        { 153, 54, 201, 1 }, },
-      { { 173, 235, 81, 1 },
-        { 250, 124, 15, 0 },
-        { 197, 107, 218, 1 },
-        { 120, 31, 47, 1 }, },
-      { { 166, 29, 142, 0 },
-        { 1, 42, 253, 1 },
-        { 56, 220, 50, 1 },
-        { 223, 170, 64, 0 }, },
-      { { 166, 92, 102, 1 },
-        { 73, 174, 220, 0 },
-        { 179, 29, 50, 1 },
-        { 29, 186, 201, 0 }, },
-      { { 174, 188, 36, 0 },
-        { 131, 168, 222, 0 },
-        { 18, 30, 186, 1 },
-        { 61, 138, 224, 1 }, },
-      { { 170, 171, 48, 0 },
-        { 178, 168, 139, 0 },
-        { 6, 106, 170, 1 },
-        { 104, 138, 166, 1 }, },
-      { { 174, 204, 216, 0 },
-        { 211, 44, 172, 1 },
-        { 13, 153, 186, 1 },
-        { 154, 154, 101, 1 }, },
-      { { 170, 237, 187, 0 },
-        { 211, 234, 171, 1 },
-        { 110, 219, 170, 1 },
-        { 234, 171, 229, 1 }, },
-      { { 174, 227, 205, 1 },
-        { 234, 100, 191, 1 },
-        { 217, 227, 186, 1 },
-        { 254, 147, 43, 1 }, },
-      { { 167, 54, 8, 1 },
-        { 41, 48, 206, 1 },
-        { 136, 54, 114, 1 },
-        { 185, 134, 74, 0 }, },
-      { { 163, 236, 229, 0 },
-        { 67, 252, 186, 0 },
-        { 83, 155, 226, 1 },
-        { 46, 159, 225, 0 }, },
-      { { 163, 193, 155, 1 },
-        { 90, 114, 169, 1 },
-        { 236, 193, 226, 1 },
-        { 202, 167, 45, 0 }, },
-      { { 167, 250, 58, 0 },
-        { 114, 186, 206, 1 },
-        { 46, 47, 242, 1 },
-        { 185, 174, 167, 0 }, },
-      { { 175, 165, 105, 1 },
-        { 139, 244, 143, 1 },
-        { 203, 82, 250, 1 },
-        { 248, 151, 232, 1 }, },
-      { { 175, 200, 189, 1 },
-        { 218, 248, 188, 1 },
-        { 222, 137, 250, 1 },
-        { 158, 143, 173, 1 }, },
-      { { 175, 239, 164, 0 },
-        { 227, 184, 191, 0 },
-        { 18, 251, 250, 1 },
-        { 126, 142, 227, 1 }, },
-      { { 171, 103, 246, 0 },
-        { 241, 182, 187, 0 },
-        { 55, 243, 106, 1 },
-        { 110, 182, 199, 1 }, },
-      { { 180, 28, 82, 0 },
-        { 21, 46, 76, 0 },
-        { 37, 28, 22, 1 },
-        { 25, 58, 84, 0 }, },
-      { { 180, 63, 68, 1 },
-        { 45, 44, 95, 0 },
-        { 145, 126, 22, 1 },
-        { 125, 26, 90, 0 }, },
-      { { 180, 240, 202, 0 },
-        { 70, 38, 110, 1 },
-        { 41, 135, 150, 1 },
-        { 187, 50, 49, 0 }, },
-      { { 184, 24, 45, 0 },
-        { 132, 232, 88, 1 },
-        { 90, 12, 14, 1 },
-        { 141, 11, 144, 1 }, },
-      { { 188, 191, 136, 1 },
-        { 175, 40, 111, 1 },
-        { 136, 254, 158, 1 },
-        { 251, 10, 122, 1 }, },
-      { { 184, 142, 4, 1 },
-        { 175, 40, 24, 0 },
-        { 144, 56, 142, 1 },
-        { 12, 10, 122, 1 }, },
-      { { 188, 120, 40, 1 },
-        { 204, 168, 78, 1 },
-        { 138, 15, 30, 1 },
-        { 185, 10, 153, 1 }, },
-      { { 184, 200, 67, 1 },
-        { 206, 110, 8, 0 },
-        { 225, 9, 142, 1 },
-        { 8, 59, 57, 1 }, },
-      { { 188, 243, 60, 1 },
-        { 254, 160, 95, 1 },
-        { 158, 103, 158, 1 },
-        { 253, 2, 191, 1 }, },
-      { { 181, 19, 12, 0 },
-        { 36, 48, 93, 1 },
-        { 24, 100, 86, 1 },
-        { 221, 6, 18, 0 }, },
-      { { 177, 63, 106, 0 },
-        { 37, 190, 75, 1 },
-        { 43, 126, 70, 1 },
-        { 233, 62, 210, 0 }, },
-      { { 177, 101, 123, 1 },
-        { 93, 246, 11, 1 },
-        { 239, 83, 70, 1 },
-        { 232, 55, 221, 0 }, },
-      { { 177, 203, 237, 0 },
-        { 102, 252, 57, 1 },
-        { 91, 233, 198, 1 },
-        { 206, 31, 179, 0 }, },
-      { { 177, 194, 103, 1 },
-        { 110, 246, 24, 0 },
-        { 243, 33, 198, 1 },
-        { 12, 55, 187, 0 }, },
-      { { 177, 90, 242, 1 },
-        { 124, 190, 104, 0 },
-        { 167, 173, 70, 1 },
-        { 11, 62, 159, 0 }, },
-      { { 181, 238, 31, 1 },
-        { 127, 122, 30, 1 },
-        { 252, 59, 214, 1 },
-        { 188, 47, 127, 0 }, },
-      { { 185, 144, 112, 1 },
-        { 158, 180, 72, 0 },
-        { 135, 4, 206, 1 },
-        { 9, 22, 188, 1 }, },
-      { { 185, 163, 64, 1 },
-        { 174, 52, 11, 0 },
-        { 129, 98, 206, 1 },
-        { 104, 22, 58, 1 }, },
-      { { 185, 120, 90, 0 },
-        { 212, 62, 74, 1 },
-        { 45, 15, 78, 1 },
-        { 169, 62, 21, 1 }, },
-      { { 185, 247, 203, 0 },
-        { 231, 118, 107, 1 },
-        { 105, 247, 206, 1 },
-        { 235, 55, 115, 1 }, },
-      { { 182, 5, 1, 1 },
-        { 13, 96, 141, 0 },
-        { 192, 80, 54, 1 },
-        { 88, 131, 88, 0 }, },
-      { { 178, 255, 194, 0 },
-        { 103, 46, 235, 0 },
-        { 33, 255, 166, 1 },
-        { 107, 186, 115, 0 }, },
-      { { 178, 123, 21, 0 },
-        { 116, 104, 219, 0 },
-        { 84, 111, 38, 1 },
-        { 109, 139, 23, 0 }, },
-      { { 178, 110, 90, 1 },
-        { 125, 46, 138, 1 },
-        { 173, 59, 38, 1 },
-        { 168, 186, 95, 0 }, },
-      { { 190, 181, 243, 1 },
-        { 159, 230, 239, 0 },
-        { 231, 214, 190, 1 },
-        { 123, 179, 252, 1 }, },
-      { { 186, 167, 161, 0 },
-        { 167, 224, 171, 0 },
-        { 66, 242, 174, 1 },
-        { 106, 131, 242, 1 }, },
-      { { 186, 114, 10, 1 },
-        { 236, 34, 202, 1 },
-        { 168, 39, 46, 1 },
-        { 169, 162, 27, 1 }, },
-      { { 179, 48, 64, 0 },
-        { 4, 52, 202, 0 },
-        { 1, 6, 102, 1 },
-        { 41, 150, 16, 0 }, },
-      { { 183, 181, 52, 1 },
-        { 31, 176, 223, 0 },
-        { 150, 86, 246, 1 },
-        { 125, 134, 252, 0 }, },
-      { { 183, 105, 76, 0 },
-        { 68, 60, 159, 1 },
-        { 25, 75, 118, 1 },
-        { 252, 158, 17, 0 }, },
-      { { 183, 197, 193, 0 },
-        { 71, 116, 173, 0 },
-        { 65, 209, 246, 1 },
-        { 90, 151, 113, 0 }, },
-      { { 179, 87, 222, 0 },
-        { 117, 54, 249, 1 },
-        { 61, 245, 102, 1 },
-        { 207, 182, 87, 0 }, },
-      { { 187, 84, 251, 0 },
-        { 213, 246, 232, 1 },
-        { 111, 149, 110, 1 },
-        { 139, 183, 213, 1 }, },
-      { { 187, 202, 108, 1 },
-        { 238, 188, 152, 1 },
-        { 155, 41, 238, 1 },
-        { 140, 158, 187, 1 }, },
-      { { 187, 251, 225, 1 },
-        { 238, 252, 235, 0 },
-        { 195, 239, 238, 1 },
-        { 107, 159, 187, 1 }, },
-      { { 191, 246, 134, 1 },
-        { 239, 50, 254, 0 },
-        { 176, 183, 254, 1 },
-        { 63, 166, 123, 1 }, },
-      { { 196, 45, 124, 0 },
-        { 17, 141, 31, 1 },
-        { 31, 90, 17, 1 },
-        { 252, 88, 196, 0 }, },
-      { { 200, 28, 52, 0 },
-        { 145, 137, 88, 0 },
-        { 22, 28, 9, 1 },
-        { 13, 72, 196, 1 }, },
-      { { 204, 67, 229, 1 },
-        { 232, 197, 61, 0 },
-        { 211, 225, 25, 1 },
-        { 94, 81, 139, 1 }, },
-      { { 197, 53, 174, 1 },
-        { 9, 147, 127, 1 },
-        { 186, 214, 81, 1 },
-        { 255, 100, 200, 0 }, },
-      { { 193, 146, 192, 0 },
-        { 34, 21, 104, 0 },
-        { 1, 164, 193, 1 },
-        { 11, 84, 34, 0 }, },
-      { { 197, 35, 247, 0 },
-        { 48, 215, 63, 0 },
-        { 119, 226, 81, 1 },
-        { 126, 117, 134, 0 }, },
-      { { 193, 159, 254, 0 },
-        { 51, 159, 121, 1 },
-        { 63, 252, 193, 1 },
-        { 207, 124, 230, 0 }, },
-      { { 193, 84, 97, 0 },
-        { 65, 213, 72, 0 },
-        { 67, 21, 65, 1 },
-        { 9, 85, 193, 0 }, },
-      { { 193, 87, 130, 0 },
-        { 97, 19, 105, 0 },
-        { 32, 245, 65, 1 },
-        { 75, 100, 67, 0 }, },
-      { { 193, 199, 55, 1 },
-        { 123, 211, 25, 0 },
-        { 246, 113, 193, 1 },
-        { 76, 101, 239, 0 }, },
-      { { 201, 140, 239, 1 },
-        { 139, 223, 56, 1 },
-        { 251, 152, 201, 1 },
-        { 142, 125, 232, 1 }, },
-      { { 205, 240, 111, 0 },
-        { 194, 215, 94, 1 },
-        { 123, 7, 217, 1 },
-        { 189, 117, 161, 1 }, },
-      { { 201, 95, 103, 1 },
-        { 233, 223, 89, 0 },
-        { 243, 125, 73, 1 },
-        { 77, 125, 203, 1 }, },
-      { { 201, 119, 241, 0 },
-        { 241, 213, 107, 0 },
-        { 71, 247, 73, 1 },
-        { 107, 85, 199, 1 }, },
-      { { 205, 226, 149, 1 },
-        { 250, 81, 62, 0 },
-        { 212, 163, 217, 1 },
-        { 62, 69, 47, 1 }, },
-      { { 198, 191, 7, 1 },
-        { 43, 75, 223, 0 },
-        { 240, 126, 177, 1 },
-        { 125, 233, 106, 0 }, },
-      { { 198, 191, 184, 0 },
-        { 51, 137, 239, 1 },
-        { 14, 254, 177, 1 },
-        { 251, 200, 230, 0 }, },
-      { { 198, 219, 201, 1 },
-        { 106, 77, 237, 1 },
-        { 201, 237, 177, 1 },
-        { 219, 217, 43, 0 }, },
-      { { 202, 49, 136, 0 },
-        { 128, 1, 235, 1 },
-        { 8, 198, 41, 1 },
-        { 235, 192, 0, 1 }, },
-      { { 206, 222, 45, 1 },
-        { 235, 201, 220, 1 },
-        { 218, 61, 185, 1 },
-        { 157, 201, 235, 1 }, },
-      { { 199, 120, 44, 1 },
-        { 72, 153, 222, 1 },
-        { 154, 15, 113, 1 },
-        { 189, 204, 137, 0 }, },
-      { { 203, 171, 75, 1 },
-        { 170, 95, 139, 1 },
-        { 233, 106, 233, 1 },
-        { 232, 253, 42, 1 }, },
-      { { 207, 67, 191, 0 },
-        { 240, 211, 189, 1 },
-        { 126, 225, 121, 1 },
-        { 222, 229, 135, 1 }, },
-      { { 208, 174, 86, 1 },
-        { 63, 15, 26, 0 },
-        { 181, 58, 133, 1 },
-        { 44, 120, 126, 0 }, },
-      { { 208, 115, 51, 0 },
-        { 116, 195, 75, 0 },
-        { 102, 103, 5, 1 },
-        { 105, 97, 151, 0 }, },
-      { { 216, 20, 152, 0 },
-        { 149, 1, 104, 1 },
-        { 12, 148, 13, 1 },
-        { 139, 64, 84, 1 }, },
-      { { 220, 96, 159, 1 },
-        { 220, 67, 62, 1 },
-        { 252, 131, 29, 1 },
-        { 190, 97, 29, 1 }, },
-      { { 213, 117, 88, 0 },
-        { 85, 21, 79, 1 },
-        { 13, 87, 85, 1 },
-        { 249, 84, 85, 0 }, },
-      { { 209, 224, 215, 0 },
-        { 86, 87, 58, 0 },
-        { 117, 131, 197, 1 },
-        { 46, 117, 53, 0 }, },
-      { { 213, 251, 177, 0 },
-        { 118, 217, 111, 0 },
-        { 70, 239, 213, 1 },
-        { 123, 77, 183, 0 }, },
-      { { 213, 218, 116, 1 },
-        { 126, 157, 92, 0 },
-        { 151, 45, 213, 1 },
-        { 29, 92, 191, 0 }, },
-      { { 221, 60, 116, 1 },
-        { 157, 157, 94, 0 },
-        { 151, 30, 93, 1 },
-        { 61, 92, 220, 1 }, },
-      { { 221, 151, 109, 0 },
-        { 167, 213, 93, 1 },
-        { 91, 116, 221, 1 },
-        { 221, 85, 242, 1 }, },
-      { { 217, 27, 49, 0 },
-        { 180, 217, 73, 0 },
-        { 70, 108, 77, 1 },
-        { 73, 77, 150, 1 }, },
-      { { 217, 98, 166, 0 },
-        { 228, 147, 58, 0 },
-        { 50, 163, 77, 1 },
-        { 46, 100, 147, 1 }, },
-      { { 210, 171, 124, 1 },
-        { 62, 141, 155, 1 },
-        { 159, 106, 165, 1 },
-        { 236, 216, 190, 0 }, },
-      { { 210, 197, 236, 0 },
-        { 71, 133, 185, 1 },
-        { 27, 209, 165, 1 },
-        { 206, 208, 241, 0 }, },
-      { { 210, 202, 106, 0 },
-        { 102, 143, 136, 1 },
-        { 43, 41, 165, 1 },
-        { 136, 248, 179, 0 }, },
-      { { 210, 107, 214, 0 },
-        { 116, 15, 187, 0 },
-        { 53, 235, 37, 1 },
-        { 110, 248, 23, 0 }, },
-      { { 222, 155, 52, 0 },
-        { 182, 137, 221, 0 },
-        { 22, 108, 189, 1 },
-        { 93, 200, 182, 1 }, },
-      { { 222, 146, 158, 0 },
-        { 182, 3, 252, 1 },
-        { 60, 164, 189, 1 },
-        { 159, 224, 54, 1 }, },
-      { { 218, 96, 216, 1 },
-        { 220, 5, 170, 1 },
-        { 141, 131, 45, 1 },
-        { 170, 208, 29, 1 }, },
-      { { 215, 57, 178, 1 },
-        { 28, 155, 239, 0 },
-        { 166, 206, 117, 1 },
-        { 123, 236, 156, 0 }, },
-      { { 215, 95, 38, 0 },
-        { 101, 155, 221, 0 },
-        { 50, 125, 117, 1 },
-        { 93, 236, 211, 0 }, },
-      { { 223, 1, 65, 1 },
-        { 140, 85, 141, 0 },
-        { 193, 64, 125, 1 },
-        { 88, 213, 24, 1 }, },
-      { { 223, 121, 15, 1 },
-        { 204, 91, 223, 1 },
-        { 248, 79, 125, 1 },
-        { 253, 237, 25, 1 }, },
-      { { 219, 247, 116, 0 },
-        { 247, 149, 219, 0 },
-        { 23, 119, 237, 1 },
-        { 109, 212, 247, 1 }, },
-      { { 224, 67, 79, 1 },
-        { 104, 103, 25, 1 },
-        { 249, 97, 3, 1 },
-        { 204, 115, 11, 0 }, },
-      { { 224, 198, 227, 0 },
-        { 99, 231, 40, 0 },
-        { 99, 177, 131, 1 },
-        { 10, 115, 227, 0 }, },
-      { { 236, 56, 189, 1 },
-        { 152, 233, 126, 1 },
-        { 222, 142, 27, 1 },
-        { 191, 75, 140, 1 }, },
-      { { 236, 81, 253, 0 },
-        { 208, 229, 125, 1 },
-        { 95, 197, 27, 1 },
-        { 223, 83, 133, 1 }, },
-      { { 229, 141, 36, 0 },
-        { 3, 185, 29, 0 },
-        { 18, 88, 211, 1 },
-        { 92, 78, 224, 0 }, },
-      { { 229, 5, 121, 1 },
-        { 25, 245, 13, 1 },
-        { 207, 80, 83, 1 },
-        { 216, 87, 204, 0 }, },
-      { { 225, 78, 248, 0 },
-        { 113, 189, 40, 1 },
-        { 15, 185, 67, 1 },
-        { 138, 94, 199, 0 }, },
-      { { 229, 87, 220, 1 },
-        { 121, 53, 125, 1 },
-        { 157, 245, 83, 1 },
-        { 223, 86, 79, 0 }, },
-      { { 225, 247, 242, 1 },
-        { 123, 183, 107, 0 },
-        { 167, 247, 195, 1 },
-        { 107, 118, 239, 0 }, },
-      { { 226, 133, 77, 0 },
-        { 3, 101, 153, 1 },
-        { 89, 80, 163, 1 },
-        { 204, 211, 96, 0 }, },
-      { { 226, 24, 26, 0 },
-        { 16, 43, 200, 1 },
-        { 44, 12, 35, 1 },
-        { 137, 234, 4, 0 }, },
-      { { 226, 43, 203, 0 },
-        { 32, 111, 171, 1 },
-        { 105, 234, 35, 1 },
-        { 234, 251, 2, 0 }, },
-      { { 230, 236, 2, 0 },
-        { 67, 43, 142, 0 },
-        { 32, 27, 179, 1 },
-        { 56, 234, 97, 0 }, },
-      { { 230, 98, 129, 0 },
-        { 96, 97, 174, 0 },
-        { 64, 163, 51, 1 },
-        { 58, 195, 3, 0 }, },
-      { { 234, 38, 64, 0 },
-        { 161, 37, 138, 0 },
-        { 1, 50, 43, 1 },
-        { 40, 210, 66, 1 }, },
-      { { 234, 224, 196, 0 },
-        { 194, 37, 186, 0 },
-        { 17, 131, 171, 1 },
-        { 46, 210, 33, 1 }, },
-      { { 234, 114, 148, 1 },
-        { 248, 33, 250, 0 },
-        { 148, 167, 43, 1 },
-        { 47, 194, 15, 1 }, },
-      { { 227, 17, 63, 1 },
-        { 24, 243, 217, 1 },
-        { 254, 68, 99, 1 },
-        { 205, 231, 140, 0 }, },
-      { { 231, 11, 230, 1 },
-        { 40, 191, 189, 0 },
-        { 179, 232, 115, 1 },
-        { 94, 254, 138, 0 }, },
-      { { 227, 100, 241, 1 },
-        { 89, 245, 170, 0 },
-        { 199, 147, 99, 1 },
-        { 42, 215, 205, 0 }, },
-      { { 231, 250, 226, 1 },
-        { 106, 191, 238, 0 },
-        { 163, 175, 243, 1 },
-        { 59, 254, 171, 0 }, },
-      { { 227, 219, 243, 0 },
-        { 114, 255, 233, 0 },
-        { 103, 237, 227, 1 },
-        { 75, 255, 167, 0 }, },
-      { { 239, 135, 98, 0 },
-        { 163, 183, 141, 0 },
-        { 35, 112, 251, 1 },
-        { 88, 246, 226, 1 }, },
-      { { 239, 93, 112, 0 },
-        { 209, 189, 205, 0 },
-        { 7, 93, 123, 1 },
-        { 89, 222, 197, 1 }, },
-      { { 235, 102, 14, 0 },
-        { 225, 51, 154, 1 },
-        { 56, 51, 107, 1 },
-        { 172, 230, 67, 1 }, },
-      { { 239, 74, 60, 0 },
-        { 240, 185, 156, 1 },
-        { 30, 41, 123, 1 },
-        { 156, 206, 135, 1 }, },
-      { { 240, 178, 33, 1 },
-        { 46, 225, 74, 0 },
-        { 194, 38, 135, 1 },
-        { 41, 67, 186, 0 }, },
-      { { 240, 175, 79, 0 },
-        { 39, 111, 27, 1 },
-        { 121, 122, 135, 1 },
-        { 236, 123, 114, 0 }, },
-      { { 244, 159, 60, 1 },
-        { 63, 169, 93, 1 },
-        { 158, 124, 151, 1 },
-        { 221, 74, 254, 0 }, },
-      { { 240, 245, 4, 0 },
-        { 71, 33, 91, 0 },
-        { 16, 87, 135, 1 },
-        { 109, 66, 113, 0 }, },
-      { { 240, 242, 120, 0 },
-        { 118, 165, 74, 1 },
-        { 15, 39, 135, 1 },
-        { 169, 82, 183, 0 }, },
-      { { 248, 52, 99, 0 },
-        { 133, 231, 74, 0 },
-        { 99, 22, 15, 1 },
-        { 41, 115, 208, 1 }, },
-      { { 252, 219, 143, 0 },
-        { 230, 107, 125, 1 },
-        { 120, 237, 159, 1 },
-        { 223, 107, 51, 1 }, },
-      { { 252, 254, 77, 1 },
-        { 239, 109, 94, 1 },
-        { 217, 63, 159, 1 },
-        { 189, 91, 123, 1 }, },
-      { { 253, 176, 69, 1 },
-        { 142, 117, 94, 0 },
-        { 209, 6, 223, 1 },
-        { 61, 87, 56, 1 }, },
-      { { 253, 51, 235, 0 },
-        { 164, 247, 111, 1 },
-        { 107, 230, 95, 1 },
-        { 251, 119, 146, 1 }, },
-      { { 249, 196, 217, 1 },
-        { 223, 117, 40, 1 },
-        { 205, 145, 207, 1 },
-        { 138, 87, 125, 1 }, },
-      { { 242, 35, 145, 1 },
-        { 60, 97, 171, 0 },
-        { 196, 226, 39, 1 },
-        { 106, 195, 30, 0 }, },
-      { { 246, 210, 251, 1 },
-        { 126, 231, 236, 1 },
-        { 239, 165, 183, 1 },
-        { 155, 243, 191, 0 }, },
-      { { 254, 239, 211, 1 },
-        { 255, 111, 175, 0 },
-        { 229, 251, 191, 1 },
-        { 122, 251, 127, 1 }, },
-      { { 243, 176, 58, 1 },
-        { 30, 179, 202, 1 },
-        { 174, 6, 231, 1 },
-        { 169, 230, 188, 0 }, },
-      { { 247, 138, 77, 1 },
-        { 46, 125, 156, 1 },
-        { 217, 40, 247, 1 },
-        { 156, 223, 58, 0 }, },
-      { { 243, 143, 157, 1 },
-        { 63, 121, 185, 1 },
-        { 220, 248, 231, 1 },
-        { 206, 207, 126, 0 }, },
-      { { 247, 242, 39, 0 },
-        { 102, 243, 222, 0 },
-        { 114, 39, 247, 1 },
-        { 61, 231, 179, 0 }, },
-      { { 255, 189, 133, 1 },
-        { 143, 121, 255, 0 },
-        { 208, 222, 255, 1 },
-        { 127, 207, 120, 1 }, },
-      { { 255, 38, 197, 1 },
-        { 173, 117, 190, 0 },
-        { 209, 178, 127, 1 },
-        { 62, 215, 90, 1 }, },
-      { { 251, 224, 97, 0 },
-        { 198, 245, 138, 0 },
-        { 67, 3, 239, 1 },
-        { 40, 215, 177, 1 }, },
-      { { 255, 220, 26, 0 },
-        { 215, 59, 204, 1 },
-        { 44, 29, 255, 1 },
-        { 153, 238, 117, 1 }, },
-      { { 25, 248, 99, 1 },
-        { 206, 222, 66, 0 },
-        { 227, 15, 204, 0 },
-        { 33, 61, 185, 1 }, },
-      { { 169, 93, 31, 1 },
-        { 217, 122, 89, 1 },
-        { 252, 93, 74, 1 },
-        { 205, 47, 77, 1 }, },
-      { { 0, 184, 72, 1 },
-        { 10, 12, 66, 1 },
-        { 137, 14, 128, 0 },
-        { 161, 24, 40, 0 }, },
-      { { 0, 236, 225, 0 },
-        { 67, 204, 34, 0 },
-        { 67, 155, 128, 0 },
-        { 34, 25, 225, 0 }, },
-      { { 8, 97, 102, 0 },
-        { 192, 134, 19, 0 },
-        { 51, 67, 8, 0 },
-        { 100, 48, 129, 1 }, },
-      { { 8, 244, 131, 0 },
-        { 195, 66, 98, 0 },
-        { 96, 151, 136, 0 },
-        { 35, 33, 97, 1 }, },
-      { { 12, 248, 157, 0 },
-        { 210, 72, 118, 1 },
-        { 92, 143, 152, 0 },
-        { 183, 9, 37, 1 }, },
-      { { 8, 192, 62, 1 },
-        { 218, 130, 16, 1 },
-        { 190, 1, 136, 0 },
-        { 132, 32, 173, 1 }, },
-      { { 1, 57, 192, 0 },
-        { 0, 28, 99, 0 },
-        { 1, 206, 64, 0 },
-        { 99, 28, 0, 0 }, },
-      { { 1, 40, 10, 0 },
-        { 0, 26, 2, 1 },
-        { 40, 10, 64, 0 },
-        { 160, 44, 0, 0 }, },
-      { { 1, 190, 179, 1 },
-        { 59, 218, 98, 0 },
-        { 230, 190, 192, 0 },
-        { 35, 45, 238, 0 }, },
-      { { 13, 128, 85, 0 },
-        { 146, 84, 20, 0 },
-        { 85, 0, 216, 0 },
-        { 20, 21, 36, 1 }, },
-      { { 13, 175, 99, 1 },
-        { 171, 222, 7, 0 },
-        { 227, 122, 216, 0 },
-        { 112, 61, 234, 1 }, },
-      { { 6, 181, 236, 0 },
-        { 3, 132, 247, 1 },
-        { 27, 214, 176, 0 },
-        { 247, 144, 224, 0 }, },
-      { { 2, 153, 54, 1 },
-        { 26, 138, 209, 0 },
-        { 182, 76, 160, 0 },
-        { 69, 168, 172, 0 }, },
-      { { 6, 182, 143, 0 },
-        { 35, 66, 246, 1 },
-        { 120, 182, 176, 0 },
-        { 183, 161, 98, 0 }, },
-      { { 6, 125, 64, 1 },
-        { 73, 12, 199, 0 },
-        { 129, 95, 48, 0 },
-        { 113, 152, 73, 0 }, },
-      { { 2, 114, 104, 1 },
-        { 104, 132, 194, 1 },
-        { 139, 39, 32, 0 },
-        { 161, 144, 139, 0 }, },
-      { { 6, 203, 237, 1 },
-        { 106, 204, 181, 1 },
-        { 219, 233, 176, 0 },
-        { 214, 153, 171, 0 }, },
-      { { 14, 15, 61, 0 },
-        { 177, 200, 149, 1 },
-        { 94, 120, 56, 0 },
-        { 212, 137, 198, 1 }, },
-      { { 14, 213, 203, 0 },
-        { 195, 70, 229, 1 },
-        { 105, 213, 184, 0 },
-        { 211, 177, 97, 1 }, },
-      { { 3, 125, 39, 1 },
-        { 73, 218, 211, 0 },
-        { 242, 95, 96, 0 },
-        { 101, 173, 201, 0 }, },
-      { { 3, 233, 143, 0 },
-        { 66, 90, 179, 1 },
-        { 120, 203, 224, 0 },
-        { 230, 173, 33, 0 }, },
-      { { 7, 250, 159, 1 },
-        { 122, 90, 246, 1 },
-        { 252, 175, 240, 0 },
-        { 183, 173, 47, 0 }, },
-      { { 11, 76, 16, 0 },
-        { 209, 24, 128, 0 },
-        { 4, 25, 104, 0 },
-        { 0, 140, 69, 1 }, },
-      { { 16, 185, 87, 1 },
-        { 30, 78, 83, 0 },
-        { 245, 78, 132, 0 },
-        { 101, 57, 60, 0 }, },
-      { { 16, 22, 41, 0 },
-        { 37, 192, 64, 1 },
-        { 74, 52, 4, 0 },
-        { 129, 1, 210, 0 }, },
-      { { 16, 98, 139, 1 },
-        { 108, 66, 34, 1 },
-        { 232, 163, 4, 0 },
-        { 162, 33, 27, 0 }, },
-      { { 24, 157, 182, 0 },
-        { 151, 138, 113, 0 },
-        { 54, 220, 140, 0 },
-        { 71, 40, 244, 1 }, },
-      { { 24, 109, 0, 1 },
-        { 205, 8, 3, 0 },
-        { 128, 91, 12, 0 },
-        { 96, 8, 89, 1 }, },
-      { { 28, 118, 42, 0 },
-        { 229, 130, 70, 1 },
-        { 42, 55, 28, 0 },
-        { 177, 32, 211, 1 }, },
-      { { 24, 95, 228, 1 },
-        { 237, 140, 113, 0 },
-        { 147, 253, 12, 0 },
-        { 71, 24, 219, 1 }, },
-      { { 28, 66, 22, 0 },
-        { 244, 2, 20, 0 },
-        { 52, 33, 28, 0 },
-        { 20, 32, 23, 1 }, },
-      { { 17, 60, 169, 0 },
-        { 5, 216, 98, 1 },
-        { 74, 158, 68, 0 },
-        { 163, 13, 208, 0 }, },
-      { { 17, 152, 57, 1 },
-        { 30, 216, 64, 1 },
-        { 206, 12, 196, 0 },
-        { 129, 13, 188, 0 }, },
-      { { 21, 58, 99, 0 },
-        { 36, 222, 70, 0 },
-        { 99, 46, 84, 0 },
-        { 49, 61, 146, 0 }, },
-      { { 21, 18, 117, 1 },
-        { 60, 212, 84, 0 },
-        { 215, 36, 84, 0 },
-        { 21, 21, 158, 0 }, },
-      { { 21, 222, 162, 0 },
-        { 103, 154, 100, 0 },
-        { 34, 189, 212, 0 },
-        { 19, 44, 243, 0 }, },
-      { { 21, 106, 24, 1 },
-        { 124, 24, 6, 1 },
-        { 140, 43, 84, 0 },
-        { 176, 12, 31, 0 }, },
-      { { 29, 209, 40, 0 },
-        { 198, 144, 69, 1 },
-        { 10, 69, 220, 0 },
-        { 209, 4, 177, 1 }, },
-      { { 29, 113, 148, 1 },
-        { 220, 16, 119, 0 },
-        { 148, 199, 92, 0 },
-        { 119, 4, 29, 1 }, },
-      { { 18, 57, 139, 1 },
-        { 12, 74, 227, 1 },
-        { 232, 206, 36, 0 },
-        { 227, 169, 24, 0 }, },
-      { { 18, 5, 152, 0 },
-        { 21, 0, 161, 1 },
-        { 12, 208, 36, 0 },
-        { 194, 128, 84, 0 }, },
-      { { 22, 2, 152, 1 },
-        { 60, 0, 164, 1 },
-        { 140, 160, 52, 0 },
-        { 146, 128, 30, 0 }, },
-      { { 26, 52, 127, 1 },
-        { 157, 198, 210, 1 },
-        { 255, 22, 44, 0 },
-        { 165, 177, 220, 1 }, },
-      { { 30, 220, 239, 1 },
-        { 207, 206, 244, 1 },
-        { 251, 157, 188, 0 },
-        { 151, 185, 249, 1 }, },
-      { { 30, 112, 115, 0 },
-        { 212, 198, 198, 0 },
-        { 103, 7, 60, 0 },
-        { 49, 177, 149, 1 }, },
-      { { 26, 67, 149, 0 },
-        { 244, 64, 177, 0 },
-        { 84, 225, 44, 0 },
-        { 70, 129, 23, 1 }, },
-      { { 26, 126, 27, 1 },
-        { 253, 74, 194, 1 },
-        { 236, 63, 44, 0 },
-        { 161, 169, 95, 1 }, },
-      { { 23, 173, 194, 0 },
-        { 7, 30, 167, 0 },
-        { 33, 218, 244, 0 },
-        { 114, 188, 112, 0 }, },
-      { { 19, 25, 222, 1 },
-        { 28, 30, 241, 1 },
-        { 189, 204, 100, 0 },
-        { 199, 188, 28, 0 }, },
-      { { 27, 168, 147, 1 },
-        { 158, 90, 162, 0 },
-        { 228, 138, 236, 0 },
-        { 34, 173, 60, 1 }, },
-      { { 27, 147, 73, 1 },
-        { 174, 84, 193, 1 },
-        { 201, 100, 236, 0 },
-        { 193, 149, 58, 1 }, },
-      { { 27, 208, 27, 0 },
-        { 214, 82, 192, 1 },
-        { 108, 5, 236, 0 },
-        { 129, 165, 53, 1 }, },
-      { { 31, 66, 219, 1 },
-        { 252, 86, 164, 1 },
-        { 237, 161, 124, 0 },
-        { 146, 181, 31, 1 }, },
-      { { 32, 185, 170, 0 },
-        { 2, 170, 99, 1 },
-        { 42, 206, 130, 0 },
-        { 227, 42, 160, 0 }, },
-      { { 36, 196, 186, 0 },
-        { 83, 162, 36, 1 },
-        { 46, 145, 146, 0 },
-        { 146, 34, 229, 0 }, },
-      { { 40, 173, 5, 0 },
-        { 131, 104, 19, 0 },
-        { 80, 90, 138, 0 },
-        { 100, 11, 96, 1 }, },
-      { { 44, 35, 100, 1 },
-        { 168, 164, 23, 0 },
-        { 147, 98, 26, 0 },
-        { 116, 18, 138, 1 }, },
-      { { 44, 14, 154, 1 },
-        { 185, 42, 36, 1 },
-        { 172, 184, 26, 0 },
-        { 146, 42, 78, 1 }, },
-      { { 44, 81, 3, 1 },
-        { 200, 98, 69, 0 },
-        { 224, 69, 26, 0 },
-        { 81, 35, 9, 1 }, },
-      { { 37, 197, 207, 1 },
-        { 75, 118, 53, 1 },
-        { 249, 209, 210, 0 },
-        { 214, 55, 105, 0 }, },
-      { { 37, 200, 211, 1 },
-        { 90, 126, 36, 0 },
-        { 229, 137, 210, 0 },
-        { 18, 63, 45, 0 }, },
-      { { 33, 119, 232, 1 },
-        { 105, 180, 99, 1 },
-        { 139, 247, 66, 0 },
-        { 227, 22, 203, 0 }, },
-      { { 34, 141, 218, 1 },
-        { 27, 46, 161, 1 },
-        { 173, 216, 162, 0 },
-        { 194, 186, 108, 0 }, },
-      { { 34, 10, 238, 0 },
-        { 32, 174, 176, 1 },
-        { 59, 168, 34, 0 },
-        { 134, 186, 130, 0 }, },
-      { { 46, 134, 44, 0 },
-        { 163, 160, 148, 1 },
-        { 26, 48, 186, 0 },
-        { 148, 130, 226, 1 }, },
-      { { 42, 182, 47, 1 },
-        { 171, 226, 210, 1 },
-        { 250, 54, 170, 0 },
-        { 165, 163, 234, 1 }, },
-      { { 39, 60, 45, 0 },
-        { 1, 248, 214, 1 },
-        { 90, 30, 114, 0 },
-        { 181, 143, 192, 0 }, },
-      { { 39, 157, 74, 0 },
-        { 3, 62, 197, 1 },
-        { 41, 92, 242, 0 },
-        { 209, 190, 96, 0 }, },
-      { { 39, 155, 7, 1 },
-        { 42, 122, 213, 0 },
-        { 240, 108, 242, 0 },
-        { 85, 175, 42, 0 }, },
-      { { 35, 87, 132, 0 },
-        { 97, 48, 241, 0 },
-        { 16, 245, 98, 0 },
-        { 71, 134, 67, 0 }, },
-      { { 35, 78, 67, 1 },
-        { 105, 126, 128, 0 },
-        { 225, 57, 98, 0 },
-        { 0, 191, 75, 0 }, },
-      { { 47, 171, 185, 1 },
-        { 186, 248, 167, 1 },
-        { 206, 234, 250, 0 },
-        { 242, 143, 174, 1 }, },
-      { { 48, 176, 46, 1 },
-        { 14, 162, 82, 1 },
-        { 186, 6, 134, 0 },
-        { 165, 34, 184, 0 }, },
-      { { 48, 40, 122, 0 },
-        { 20, 174, 2, 1 },
-        { 47, 10, 6, 0 },
-        { 160, 58, 148, 0 }, },
-      { { 52, 253, 160, 1 },
-        { 79, 168, 103, 0 },
-        { 130, 223, 150, 0 },
-        { 115, 10, 249, 0 }, },
-      { { 60, 214, 137, 0 },
-        { 231, 96, 100, 1 },
-        { 72, 181, 158, 0 },
-        { 147, 3, 115, 1 }, },
-      { { 56, 126, 182, 0 },
-        { 245, 170, 114, 0 },
-        { 54, 191, 14, 0 },
-        { 39, 42, 215, 1 }, },
-      { { 49, 0, 109, 0 },
-        { 4, 244, 16, 1 },
-        { 91, 0, 70, 0 },
-        { 132, 23, 144, 0 }, },
-      { { 49, 23, 219, 1 },
-        { 61, 118, 97, 1 },
-        { 237, 244, 70, 0 },
-        { 195, 55, 94, 0 }, },
-      { { 49, 167, 119, 1 },
-        { 63, 246, 19, 0 },
-        { 247, 114, 198, 0 },
-        { 100, 55, 254, 0 }, },
-      { { 61, 128, 10, 1 },
-        { 142, 50, 4, 1 },
-        { 168, 0, 222, 0 },
-        { 144, 38, 56, 1 }, },
-      { { 61, 226, 157, 0 },
-        { 246, 112, 54, 1 },
-        { 92, 163, 222, 0 },
-        { 182, 7, 55, 1 }, },
-      { { 54, 106, 119, 1 },
-        { 124, 238, 150, 0 },
-        { 247, 43, 54, 0 },
-        { 52, 187, 159, 0 }, },
-      { { 54, 199, 190, 1 },
-        { 127, 162, 181, 1 },
-        { 190, 241, 182, 0 },
-        { 214, 162, 255, 0 }, },
-      { { 62, 187, 41, 0 },
-        { 166, 232, 199, 1 },
-        { 74, 110, 190, 0 },
-        { 241, 139, 178, 1 }, },
-      { { 62, 104, 154, 0 },
-        { 212, 42, 166, 1 },
-        { 44, 139, 62, 0 },
-        { 178, 170, 21, 1 }, },
-      { { 62, 95, 2, 1 },
-        { 237, 42, 197, 0 },
-        { 160, 125, 62, 0 },
-        { 81, 170, 91, 1 }, },
-      { { 58, 86, 206, 1 },
-        { 237, 38, 240, 1 },
-        { 185, 181, 46, 0 },
-        { 135, 178, 91, 1 }, },
-      { { 62, 95, 252, 0 },
-        { 245, 172, 245, 1 },
-        { 31, 253, 62, 0 },
-        { 215, 154, 215, 1 }, },
-      { { 51, 185, 172, 0 },
-        { 6, 184, 243, 1 },
-        { 26, 206, 230, 0 },
-        { 231, 142, 176, 0 }, },
-      { { 51, 84, 174, 0 },
-        { 69, 178, 240, 1 },
-        { 58, 149, 102, 0 },
-        { 135, 166, 209, 0 }, },
-      { { 63, 25, 160, 0 },
-        { 132, 184, 229, 0 },
-        { 2, 204, 126, 0 },
-        { 83, 142, 144, 1 }, },
-      { { 59, 173, 97, 1 },
-        { 143, 252, 131, 0 },
-        { 195, 90, 238, 0 },
-        { 96, 159, 248, 1 }, },
-      { { 59, 112, 47, 1 },
-        { 204, 242, 210, 1 },
-        { 250, 7, 110, 0 },
-        { 165, 167, 153, 1 }, },
-      { { 59, 235, 58, 1 },
-        { 254, 186, 131, 1 },
-        { 174, 107, 238, 0 },
-        { 224, 174, 191, 1 }, },
-      { { 64, 83, 90, 0 },
-        { 112, 7, 65, 1 },
-        { 45, 101, 1, 0 },
-        { 193, 112, 7, 0 }, },
-      { { 65, 152, 22, 0 },
-        { 18, 27, 80, 0 },
-        { 52, 12, 193, 0 },
-        { 5, 108, 36, 0 }, },
-      { { 65, 143, 177, 0 },
-        { 51, 217, 33, 0 },
-        { 70, 248, 193, 0 },
-        { 66, 77, 230, 0 }, },
-      { { 69, 217, 33, 1 },
-        { 74, 217, 69, 0 },
-        { 194, 77, 209, 0 },
-        { 81, 77, 169, 0 }, },
-      { { 69, 235, 1, 0 },
-        { 98, 89, 7, 0 },
-        { 64, 107, 209, 0 },
-        { 112, 77, 35, 0 }, },
-      { { 73, 157, 82, 0 },
-        { 147, 31, 65, 0 },
-        { 37, 92, 201, 0 },
-        { 65, 124, 100, 1 }, },
-      { { 66, 56, 79, 1 },
-        { 8, 79, 210, 1 },
-        { 249, 14, 33, 0 },
-        { 165, 249, 8, 0 }, },
-      { { 74, 166, 163, 1 },
-        { 171, 195, 162, 0 },
-        { 226, 178, 169, 0 },
-        { 34, 225, 234, 1 }, },
-      { { 74, 197, 42, 1 },
-        { 203, 131, 129, 1 },
-        { 170, 81, 169, 0 },
-        { 192, 224, 233, 1 }, },
-      { { 74, 200, 115, 0 },
-        { 210, 207, 128, 0 },
-        { 103, 9, 169, 0 },
-        { 0, 249, 165, 1 }, },
-      { { 71, 180, 198, 1 },
-        { 11, 23, 246, 0 },
-        { 177, 150, 241, 0 },
-        { 55, 244, 104, 0 }, },
-      { { 67, 147, 93, 0 },
-        { 50, 85, 209, 1 },
-        { 93, 100, 225, 0 },
-        { 197, 213, 38, 0 }, },
-      { { 67, 120, 117, 0 },
-        { 80, 221, 210, 0 },
-        { 87, 15, 97, 0 },
-        { 37, 221, 133, 0 }, },
-      { { 79, 58, 175, 1 },
-        { 168, 219, 246, 1 },
-        { 250, 174, 121, 0 },
-        { 183, 237, 138, 1 }, },
-      { { 79, 135, 68, 1 },
-        { 171, 21, 149, 0 },
-        { 145, 112, 249, 0 },
-        { 84, 212, 106, 1 }, },
-      { { 79, 135, 223, 0 },
-        { 179, 87, 181, 1 },
-        { 125, 240, 249, 0 },
-        { 214, 245, 102, 1 }, },
-      { { 79, 196, 222, 1 },
-        { 219, 23, 180, 1 },
-        { 189, 145, 249, 0 },
-        { 150, 244, 109, 1 }, },
-      { { 84, 31, 71, 0 },
-        { 37, 79, 85, 0 },
-        { 113, 124, 21, 0 },
-        { 85, 121, 82, 0 }, },
-      { { 80, 31, 148, 0 },
-        { 53, 9, 113, 0 },
-        { 20, 252, 5, 0 },
-        { 71, 72, 86, 0 }, },
-      { { 92, 145, 67, 0 },
-        { 134, 71, 69, 0 },
-        { 97, 68, 157, 0 },
-        { 81, 113, 48, 1 }, },
-      { { 88, 189, 239, 1 },
-        { 143, 207, 115, 1 },
-        { 251, 222, 141, 0 },
-        { 231, 121, 248, 1 }, },
-      { { 92, 221, 7, 1 },
-        { 207, 75, 85, 0 },
-        { 240, 93, 157, 0 },
-        { 85, 105, 121, 1 }, },
-      { { 92, 102, 88, 1 },
-        { 253, 5, 6, 1 },
-        { 141, 51, 29, 0 },
-        { 176, 80, 95, 1 }, },
-      { { 92, 219, 50, 1 },
-        { 254, 139, 69, 0 },
-        { 166, 109, 157, 0 },
-        { 81, 104, 191, 1 }, },
-      { { 85, 69, 212, 0 },
-        { 85, 21, 53, 0 },
-        { 21, 209, 85, 0 },
-        { 86, 84, 85, 0 }, },
-      { { 81, 68, 62, 0 },
-        { 85, 147, 16, 1 },
-        { 62, 17, 69, 0 },
-        { 132, 100, 213, 0 }, },
-      { { 81, 231, 230, 0 },
-        { 103, 151, 51, 0 },
-        { 51, 243, 197, 0 },
-        { 102, 116, 243, 0 }, },
-      { { 89, 11, 167, 0 },
-        { 164, 219, 49, 0 },
-        { 114, 232, 77, 0 },
-        { 70, 109, 146, 1 }, },
-      { { 93, 186, 56, 1 },
-        { 190, 153, 70, 1 },
-        { 142, 46, 221, 0 },
-        { 177, 76, 190, 1 }, },
-      { { 93, 166, 55, 1 },
-        { 191, 211, 22, 0 },
-        { 246, 50, 221, 0 },
-        { 52, 101, 254, 1 }, },
-      { { 89, 249, 149, 0 },
-        { 214, 89, 115, 0 },
-        { 84, 207, 205, 0 },
-        { 103, 77, 53, 1 }, },
-      { { 93, 255, 236, 0 },
-        { 231, 157, 119, 1 },
-        { 27, 255, 221, 0 },
-        { 247, 92, 243, 1 }, },
-      { { 82, 157, 58, 0 },
-        { 23, 139, 193, 1 },
-        { 46, 92, 165, 0 },
-        { 193, 232, 244, 0 }, },
-      { { 86, 58, 151, 0 },
-        { 52, 75, 246, 0 },
-        { 116, 174, 53, 0 },
-        { 55, 233, 22, 0 }, },
-      { { 82, 99, 34, 0 },
-        { 100, 131, 131, 0 },
-        { 34, 99, 37, 0 },
-        { 96, 224, 147, 0 }, },
-      { { 82, 203, 49, 1 },
-        { 126, 201, 129, 0 },
-        { 198, 105, 165, 0 },
-        { 64, 201, 191, 0 }, },
-      { { 90, 139, 204, 1 },
-        { 174, 13, 177, 1 },
-        { 153, 232, 173, 0 },
-        { 198, 216, 58, 1 }, },
-      { { 83, 33, 106, 0 },
-        { 4, 151, 131, 1 },
-        { 43, 66, 101, 0 },
-        { 224, 244, 144, 0 }, },
-      { { 87, 245, 17, 0 },
-        { 87, 81, 199, 0 },
-        { 68, 87, 245, 0 },
-        { 113, 197, 117, 0 }, },
-      { { 95, 220, 33, 0 },
-        { 199, 217, 196, 0 },
-        { 66, 29, 253, 0 },
-        { 17, 205, 241, 1 }, },
-      { { 96, 140, 28, 0 },
-        { 19, 41, 16, 1 },
-        { 28, 24, 131, 0 },
-        { 132, 74, 100, 0 }, },
-      { { 96, 162, 213, 1 },
-        { 58, 101, 50, 0 },
-        { 213, 162, 131, 0 },
-        { 38, 83, 46, 0 }, },
-      { { 96, 222, 5, 1 },
-        { 107, 105, 80, 0 },
-        { 208, 61, 131, 0 },
-        { 5, 75, 107, 0 }, },
-      { { 108, 76, 110, 0 },
-        { 193, 175, 20, 1 },
-        { 59, 25, 27, 0 },
-        { 148, 122, 193, 1 }, },
-      { { 104, 82, 12, 0 },
-        { 224, 33, 80, 1 },
-        { 24, 37, 11, 0 },
-        { 133, 66, 3, 1 }, },
-      { { 101, 59, 167, 0 },
-        { 32, 251, 119, 0 },
-        { 114, 238, 83, 0 },
-        { 119, 111, 130, 0 }, },
-      { { 97, 170, 234, 0 },
-        { 34, 191, 34, 1 },
-        { 43, 170, 195, 0 },
-        { 162, 126, 162, 0 }, },
-      { { 101, 113, 110, 1 },
-        { 72, 183, 87, 1 },
-        { 187, 71, 83, 0 },
-        { 245, 118, 137, 0 }, },
-      { { 101, 124, 89, 1 },
-        { 89, 125, 70, 1 },
-        { 205, 31, 83, 0 },
-        { 177, 95, 77, 0 }, },
-      { { 105, 131, 46, 1 },
-        { 170, 179, 17, 1 },
-        { 186, 96, 203, 0 },
-        { 196, 102, 170, 1 }, },
-      { { 109, 196, 12, 0 },
-        { 195, 49, 20, 1 },
-        { 24, 17, 219, 0 },
-        { 148, 70, 97, 1 }, },
-      { { 109, 210, 20, 1 },
-        { 250, 49, 84, 0 },
-        { 148, 37, 219, 0 },
-        { 21, 70, 47, 1 }, },
-      { { 98, 150, 165, 1 },
-        { 43, 225, 240, 0 },
-        { 210, 180, 163, 0 },
-        { 7, 195, 234, 0 }, },
-      { { 98, 117, 38, 1 },
-        { 73, 163, 211, 0 },
-        { 178, 87, 35, 0 },
-        { 101, 226, 201, 0 }, },
-      { { 98, 100, 214, 1 },
-        { 89, 39, 178, 0 },
-        { 181, 147, 35, 0 },
-        { 38, 242, 77, 0 }, },
-      { { 98, 91, 220, 1 },
-        { 120, 45, 241, 1 },
-        { 157, 237, 35, 0 },
-        { 199, 218, 15, 0 }, },
-      { { 110, 51, 2, 1 },
-        { 168, 35, 199, 0 },
-        { 160, 102, 59, 0 },
-        { 113, 226, 10, 1 }, },
-      { { 110, 90, 137, 0 },
-        { 224, 105, 228, 1 },
-        { 72, 173, 59, 0 },
-        { 147, 203, 3, 1 }, },
-      { { 99, 209, 212, 0 },
-        { 82, 53, 241, 0 },
-        { 21, 197, 227, 0 },
-        { 71, 214, 37, 0 }, },
-      { { 99, 75, 129, 1 },
-        { 104, 121, 161, 0 },
-        { 192, 233, 99, 0 },
-        { 66, 207, 11, 0 }, },
-      { { 107, 56, 145, 1 },
-        { 152, 121, 226, 0 },
-        { 196, 142, 107, 0 },
-        { 35, 207, 12, 1 }, },
-      { { 107, 122, 42, 0 },
-        { 224, 187, 194, 1 },
-        { 42, 47, 107, 0 },
-        { 161, 238, 131, 1 }, },
-      { { 116, 56, 51, 0 },
-        { 20, 235, 70, 0 },
-        { 102, 14, 23, 0 },
-        { 49, 107, 148, 0 }, },
-      { { 112, 6, 44, 0 },
-        { 37, 161, 16, 1 },
-        { 26, 48, 7, 0 },
-        { 132, 66, 210, 0 }, },
-      { { 116, 170, 141, 1 },
-        { 46, 105, 54, 1 },
-        { 216, 170, 151, 0 },
-        { 182, 75, 58, 0 }, },
-      { { 116, 76, 143, 0 },
-        { 69, 107, 52, 1 },
-        { 120, 153, 23, 0 },
-        { 150, 107, 81, 0 }, },
-      { { 124, 183, 167, 0 },
-        { 167, 227, 119, 0 },
-        { 114, 246, 159, 0 },
-        { 119, 99, 242, 1 }, },
-      { { 120, 3, 22, 1 },
-        { 188, 35, 17, 0 },
-        { 180, 96, 15, 0 },
-        { 68, 98, 30, 1 }, },
-      { { 124, 199, 198, 1 },
-        { 239, 39, 53, 0 },
-        { 177, 241, 159, 0 },
-        { 86, 114, 123, 1 }, },
-      { { 117, 182, 4, 1 },
-        { 47, 49, 86, 0 },
-        { 144, 54, 215, 0 },
-        { 53, 70, 122, 0 }, },
-      { { 113, 254, 101, 0 },
-        { 103, 253, 82, 0 },
-        { 83, 63, 199, 0 },
-        { 37, 95, 243, 0 }, },
-      { { 113, 79, 154, 1 },
-        { 125, 59, 33, 1 },
-        { 172, 249, 71, 0 },
-        { 194, 110, 95, 0 }, },
-      { { 121, 32, 119, 0 },
-        { 148, 247, 18, 0 },
-        { 119, 2, 79, 0 },
-        { 36, 119, 148, 1 }, },
-      { { 125, 121, 205, 0 },
-        { 196, 125, 119, 1 },
-        { 89, 207, 95, 0 },
-        { 247, 95, 17, 1 }, },
-      { { 125, 67, 92, 0 },
-        { 244, 53, 21, 1 },
-        { 29, 97, 95, 0 },
-        { 212, 86, 23, 1 }, },
-      { { 125, 127, 59, 0 },
-        { 245, 251, 71, 1 },
-        { 110, 127, 95, 0 },
-        { 241, 111, 215, 1 }, },
-      { { 118, 85, 8, 0 },
-        { 69, 33, 197, 1 },
-        { 8, 85, 55, 0 },
-        { 209, 194, 81, 0 }, },
-      { { 122, 152, 199, 0 },
-        { 134, 111, 240, 0 },
-        { 113, 140, 175, 0 },
-        { 7, 251, 48, 1 }, },
-      { { 126, 19, 192, 0 },
-        { 164, 37, 229, 0 },
-        { 1, 228, 63, 0 },
-        { 83, 210, 18, 1 }, },
-      { { 126, 94, 89, 1 },
-        { 253, 109, 196, 1 },
-        { 205, 61, 63, 0 },
-        { 145, 219, 95, 1 }, },
-      { { 115, 36, 132, 0 },
-        { 5, 49, 178, 0 },
-        { 16, 146, 103, 0 },
-        { 38, 198, 80, 0 }, },
-      { { 115, 46, 39, 1 },
-        { 45, 251, 146, 0 },
-        { 242, 58, 103, 0 },
-        { 36, 239, 218, 0 }, },
-      { { 115, 139, 84, 1 },
-        { 62, 61, 145, 0 },
-        { 149, 104, 231, 0 },
-        { 68, 222, 62, 0 }, },
-      { { 132, 4, 34, 0 },
-        { 1, 130, 12, 0 },
-        { 34, 16, 16, 1 },
-        { 24, 32, 192, 0 }, },
-      { { 128, 232, 46, 0 },
-        { 66, 138, 26, 1 },
-        { 58, 11, 128, 1 },
-        { 172, 40, 161, 0 }, },
-      { { 128, 237, 48, 0 },
-        { 83, 136, 11, 0 },
-        { 6, 91, 128, 1 },
-        { 104, 8, 229, 0 }, },
-      { { 140, 53, 96, 0 },
-        { 129, 132, 79, 0 },
-        { 3, 86, 24, 1 },
-        { 121, 16, 192, 1 }, },
-      { { 140, 120, 240, 1 },
-        { 216, 140, 110, 0 },
-        { 135, 143, 24, 1 },
-        { 59, 24, 141, 1 }, },
-      { { 136, 194, 128, 1 },
-        { 234, 0, 40, 0 },
-        { 128, 161, 136, 1 },
-        { 10, 0, 43, 1 }, },
-      { { 129, 26, 100, 1 },
-        { 40, 156, 88, 0 },
-        { 147, 44, 64, 1 },
-        { 13, 28, 138, 0 }, },
-      { { 129, 38, 163, 0 },
-        { 33, 210, 42, 0 },
-        { 98, 178, 64, 1 },
-        { 42, 37, 194, 0 }, },
-      { { 133, 154, 140, 1 },
-        { 42, 24, 124, 1 },
-        { 152, 172, 208, 1 },
-        { 159, 12, 42, 0 }, },
-      { { 137, 19, 23, 1 },
-        { 184, 82, 89, 0 },
-        { 244, 100, 72, 1 },
-        { 77, 37, 14, 1 }, },
-      { { 130, 9, 37, 0 },
-        { 0, 200, 153, 0 },
-        { 82, 72, 32, 1 },
-        { 76, 137, 128, 0 }, },
-      { { 130, 183, 201, 1 },
-        { 43, 68, 235, 1 },
-        { 201, 246, 160, 1 },
-        { 235, 145, 106, 0 }, },
-      { { 142, 185, 191, 1 },
-        { 154, 202, 255, 1 },
-        { 254, 206, 184, 1 },
-        { 255, 169, 172, 1 }, },
-      { { 138, 159, 236, 0 },
-        { 163, 140, 249, 1 },
-        { 27, 252, 168, 1 },
-        { 207, 152, 226, 1 }, },
-      { { 142, 228, 226, 0 },
-        { 195, 134, 174, 0 },
-        { 35, 147, 184, 1 },
-        { 58, 176, 225, 1 }, },
-      { { 135, 32, 232, 0 },
-        { 0, 148, 174, 1 },
-        { 11, 130, 112, 1 },
-        { 186, 148, 128, 0 }, },
-      { { 135, 205, 96, 1 },
-        { 75, 156, 141, 0 },
-        { 131, 89, 240, 1 },
-        { 88, 156, 233, 0 }, },
-      { { 135, 71, 172, 1 },
-        { 105, 144, 189, 1 },
-        { 154, 241, 112, 1 },
-        { 222, 132, 203, 0 }, },
-      { { 139, 10, 91, 0 },
-        { 176, 94, 136, 1 },
-        { 109, 40, 104, 1 },
-        { 136, 189, 6, 1 }, },
-      { { 139, 92, 190, 1 },
-        { 217, 154, 248, 1 },
-        { 190, 157, 104, 1 },
-        { 143, 172, 205, 1 }, },
-      { { 143, 213, 180, 0 },
-        { 211, 144, 253, 0 },
-        { 22, 213, 248, 1 },
-        { 95, 132, 229, 1 }, },
-      { { 139, 118, 41, 0 },
-        { 225, 208, 202, 1 },
-        { 74, 55, 104, 1 },
-        { 169, 133, 195, 1 }, },
-      { { 148, 51, 175, 0 },
-        { 36, 194, 127, 1 },
-        { 122, 230, 20, 1 },
-        { 255, 33, 146, 0 }, },
-      { { 144, 85, 72, 1 },
-        { 77, 4, 73, 1 },
-        { 137, 85, 4, 1 },
-        { 201, 16, 89, 0 }, },
-      { { 156, 62, 39, 0 },
-        { 165, 202, 94, 0 },
-        { 114, 62, 28, 1 },
-        { 61, 41, 210, 1 }, },
-      { { 152, 151, 159, 0 },
-        { 183, 66, 121, 1 },
-        { 124, 244, 140, 1 },
-        { 207, 33, 118, 1 }, },
-      { { 152, 88, 144, 1 },
-        { 220, 8, 104, 0 },
-        { 132, 141, 12, 1 },
-        { 11, 8, 29, 1 }, },
-      { { 149, 182, 31, 0 },
-        { 55, 82, 94, 1 },
-        { 124, 54, 212, 1 },
-        { 189, 37, 118, 0 }, },
-      { { 145, 64, 55, 0 },
-        { 84, 210, 24, 0 },
-        { 118, 1, 68, 1 },
-        { 12, 37, 149, 0 }, },
-      { { 157, 179, 128, 0 },
-        { 166, 16, 111, 0 },
-        { 0, 230, 220, 1 },
-        { 123, 4, 50, 1 }, },
-      { { 153, 65, 137, 1 },
-        { 204, 80, 41, 1 },
-        { 200, 193, 76, 1 },
-        { 202, 5, 25, 1 }, },
-      { { 146, 173, 38, 0 },
-        { 7, 138, 155, 0 },
-        { 50, 90, 164, 1 },
-        { 108, 168, 240, 0 }, },
-      { { 146, 101, 228, 1 },
-        { 77, 132, 187, 0 },
-        { 147, 211, 36, 1 },
-        { 110, 144, 217, 0 }, },
-      { { 146, 111, 141, 1 },
-        { 109, 72, 187, 1 },
-        { 216, 251, 36, 1 },
-        { 238, 137, 91, 0 }, },
-      { { 150, 94, 153, 0 },
-        { 117, 72, 236, 1 },
-        { 76, 189, 52, 1 },
-        { 155, 137, 87, 0 }, },
-      { { 154, 11, 77, 0 },
-        { 164, 76, 153, 1 },
-        { 89, 104, 44, 1 },
-        { 204, 153, 18, 1 }, },
-      { { 154, 221, 17, 0 },
-        { 215, 72, 201, 0 },
-        { 68, 93, 172, 1 },
-        { 73, 137, 117, 1 }, },
-      { { 147, 246, 156, 1 },
-        { 127, 16, 250, 1 },
-        { 156, 183, 228, 1 },
-        { 175, 132, 127, 0 }, },
-      { { 159, 52, 189, 1 },
-        { 157, 208, 254, 1 },
-        { 222, 150, 124, 1 },
-        { 191, 133, 220, 1 }, },
-      { { 159, 80, 9, 0 },
-        { 196, 80, 204, 1 },
-        { 72, 5, 124, 1 },
-        { 153, 133, 17, 1 }, },
-      { { 160, 153, 27, 1 },
-        { 26, 106, 73, 1 },
-        { 236, 76, 130, 1 },
-        { 201, 43, 44, 0 }, },
-      { { 164, 15, 234, 0 },
-        { 33, 174, 45, 1 },
-        { 43, 248, 18, 1 },
-        { 218, 58, 194, 0 }, },
-      { { 160, 15, 83, 1 },
-        { 57, 110, 9, 0 },
-        { 229, 120, 2, 1 },
-        { 72, 59, 78, 0 }, },
-      { { 168, 2, 105, 1 },
-        { 168, 228, 8, 1 },
-        { 203, 32, 10, 1 },
-        { 136, 19, 138, 1 }, },
-      { { 172, 27, 205, 1 },
-        { 168, 108, 125, 1 },
-        { 217, 236, 26, 1 },
-        { 223, 27, 10, 1 }, },
-      { { 172, 135, 77, 0 },
-        { 163, 100, 29, 1 },
-        { 89, 112, 154, 1 },
-        { 220, 19, 98, 1 }, },
-      { { 172, 118, 200, 0 },
-        { 225, 36, 110, 1 },
-        { 9, 183, 26, 1 },
-        { 187, 18, 67, 1 }, },
-      { { 165, 68, 167, 0 },
-        { 65, 242, 60, 0 },
-        { 114, 145, 82, 1 },
-        { 30, 39, 193, 0 }, },
-      { { 161, 244, 92, 0 },
-        { 83, 52, 90, 1 },
-        { 29, 23, 194, 1 },
-        { 173, 22, 101, 0 }, },
-      { { 169, 157, 169, 0 },
-        { 131, 248, 105, 1 },
-        { 74, 220, 202, 1 },
-        { 203, 15, 224, 1 }, },
-      { { 169, 135, 255, 0 },
-        { 179, 246, 57, 1 },
-        { 127, 240, 202, 1 },
-        { 206, 55, 230, 1 }, },
-      { { 169, 71, 98, 1 },
-        { 233, 182, 9, 0 },
-        { 163, 113, 74, 1 },
-        { 72, 54, 203, 1 }, },
-      { { 166, 129, 114, 1 },
-        { 26, 166, 141, 0 },
-        { 167, 64, 178, 1 },
-        { 88, 178, 172, 0 }, },
-      { { 166, 249, 172, 1 },
-        { 74, 168, 255, 1 },
-        { 154, 207, 178, 1 },
-        { 255, 138, 169, 0 }, },
-      { { 162, 196, 38, 0 },
-        { 67, 162, 152, 0 },
-        { 50, 17, 162, 1 },
-        { 12, 162, 225, 0 }, },
-      { { 170, 53, 101, 1 },
-        { 137, 228, 219, 0 },
-        { 211, 86, 42, 1 },
-        { 109, 147, 200, 1 }, },
-      { { 170, 168, 102, 0 },
-        { 130, 174, 154, 0 },
-        { 51, 10, 170, 1 },
-        { 44, 186, 160, 1 }, },
-      { { 170, 200, 143, 0 },
-        { 194, 106, 184, 1 },
-        { 120, 137, 170, 1 },
-        { 142, 171, 33, 1 }, },
-      { { 167, 110, 148, 1 },
-        { 121, 56, 190, 0 },
-        { 148, 187, 114, 1 },
-        { 62, 142, 79, 0 }, },
-      { { 175, 4, 36, 1 },
-        { 137, 176, 156, 0 },
-        { 146, 16, 122, 1 },
-        { 28, 134, 200, 1 }, },
-      { { 176, 65, 44, 0 },
-        { 68, 160, 25, 1 },
-        { 26, 65, 6, 1 },
-        { 204, 2, 145, 0 }, },
-      { { 176, 208, 227, 0 },
-        { 70, 230, 104, 0 },
-        { 99, 133, 134, 1 },
-        { 11, 51, 177, 0 }, },
-      { { 176, 237, 129, 1 },
-        { 79, 104, 43, 0 },
-        { 192, 219, 134, 1 },
-        { 106, 11, 121, 0 }, },
-      { { 180, 231, 236, 0 },
-        { 103, 164, 63, 1 },
-        { 27, 243, 150, 1 },
-        { 254, 18, 243, 0 }, },
-      { { 184, 160, 236, 1 },
-        { 142, 164, 58, 1 },
-        { 155, 130, 142, 1 },
-        { 174, 18, 184, 1 }, },
-      { { 184, 188, 60, 1 },
-        { 159, 168, 90, 1 },
-        { 158, 30, 142, 1 },
-        { 173, 10, 252, 1 }, },
-      { { 177, 102, 224, 1 },
-        { 109, 180, 42, 0 },
-        { 131, 179, 70, 1 },
-        { 42, 22, 219, 0 }, },
-      { { 189, 49, 10, 1 },
-        { 140, 50, 79, 1 },
-        { 168, 70, 94, 1 },
-        { 249, 38, 24, 1 }, },
-      { { 189, 63, 186, 1 },
-        { 189, 186, 111, 1 },
-        { 174, 254, 94, 1 },
-        { 251, 46, 222, 1 }, },
-      { { 185, 190, 220, 0 },
-        { 183, 60, 122, 1 },
-        { 29, 190, 206, 1 },
-        { 175, 30, 118, 1 }, },
-      { { 178, 58, 240, 1 },
-        { 60, 172, 234, 0 },
-        { 135, 174, 38, 1 },
-        { 43, 154, 158, 0 }, },
-      { { 182, 207, 169, 0 },
-        { 103, 232, 173, 1 },
-        { 74, 249, 182, 1 },
-        { 218, 139, 243, 0 }, },
-      { { 186, 35, 226, 1 },
-        { 172, 166, 171, 0 },
-        { 163, 226, 46, 1 },
-        { 106, 178, 154, 1 }, },
-      { { 183, 36, 171, 1 },
-        { 13, 242, 174, 1 },
-        { 234, 146, 118, 1 },
-        { 186, 167, 216, 0 }, },
-      { { 183, 41, 251, 0 },
-        { 20, 254, 175, 1 },
-        { 111, 202, 118, 1 },
-        { 250, 191, 148, 0 }, },
-      { { 179, 174, 8, 0 },
-        { 39, 56, 138, 1 },
-        { 8, 58, 230, 1 },
-        { 168, 142, 114, 0 }, },
-      { { 183, 86, 202, 1 },
-        { 109, 54, 236, 1 },
-        { 169, 181, 118, 1 },
-        { 155, 182, 91, 0 }, },
-      { { 191, 168, 244, 0 },
-        { 150, 188, 190, 0 },
-        { 23, 138, 254, 1 },
-        { 62, 158, 180, 1 }, },
-      { { 191, 148, 18, 1 },
-        { 159, 50, 204, 0 },
-        { 164, 20, 254, 1 },
-        { 25, 166, 124, 1 }, },
-      { { 191, 122, 64, 1 },
-        { 236, 60, 206, 0 },
-        { 129, 47, 126, 1 },
-        { 57, 158, 27, 1 }, },
-      { { 196, 133, 200, 0 },
-        { 3, 5, 45, 1 },
-        { 9, 208, 145, 1 },
-        { 218, 80, 96, 0 }, },
-      { { 192, 14, 9, 1 },
-        { 41, 73, 8, 1 },
-        { 200, 56, 1, 1 },
-        { 136, 73, 74, 0 }, },
-      { { 192, 112, 254, 0 },
-        { 80, 135, 122, 1 },
-        { 63, 135, 1, 1 },
-        { 175, 112, 133, 0 }, },
-      { { 204, 116, 17, 0 },
-        { 209, 65, 78, 0 },
-        { 68, 23, 25, 1 },
-        { 57, 65, 69, 1 }, },
-      { { 193, 8, 90, 1 },
-        { 24, 31, 8, 1 },
-        { 173, 8, 65, 1 },
-        { 136, 124, 12, 0 }, },
-      { { 193, 47, 130, 1 },
-        { 41, 27, 43, 0 },
-        { 160, 250, 65, 1 },
-        { 106, 108, 74, 0 }, },
-      { { 193, 35, 120, 0 },
-        { 48, 149, 11, 1 },
-        { 15, 98, 65, 1 },
-        { 232, 84, 134, 0 }, },
-      { { 198, 52, 219, 1 },
-        { 25, 71, 238, 1 },
-        { 237, 150, 49, 1 },
-        { 187, 241, 76, 0 }, },
-      { { 198, 164, 244, 1 },
-        { 27, 133, 190, 0 },
-        { 151, 146, 177, 1 },
-        { 62, 208, 236, 0 }, },
-      { { 194, 228, 25, 0 },
-        { 83, 65, 138, 1 },
-        { 76, 19, 161, 1 },
-        { 168, 193, 101, 0 }, },
-      { { 195, 29, 35, 0 },
-        { 1, 219, 201, 0 },
-        { 98, 92, 97, 1 },
-        { 73, 237, 192, 0 }, },
-      { { 195, 242, 196, 1 },
-        { 106, 21, 250, 0 },
-        { 145, 167, 225, 1 },
-        { 47, 212, 43, 0 }, },
-      { { 199, 95, 223, 0 },
-        { 113, 95, 253, 1 },
-        { 125, 253, 113, 1 },
-        { 223, 253, 71, 0 }, },
-      { { 203, 101, 189, 0 },
-        { 209, 209, 187, 1 },
-        { 94, 211, 105, 1 },
-        { 238, 197, 197, 1 }, },
-      { { 203, 199, 15, 1 },
-        { 235, 83, 153, 1 },
-        { 248, 113, 233, 1 },
-        { 204, 229, 107, 1 }, },
-      { { 207, 246, 185, 0 },
-        { 243, 209, 238, 1 },
-        { 78, 183, 249, 1 },
-        { 187, 197, 231, 1 }, },
-      { { 212, 84, 239, 0 },
-        { 69, 199, 124, 1 },
-        { 123, 149, 21, 1 },
-        { 159, 113, 209, 0 }, },
-      { { 212, 251, 220, 0 },
-        { 118, 13, 127, 1 },
-        { 29, 239, 149, 1 },
-        { 255, 88, 55, 0 }, },
-      { { 220, 232, 84, 0 },
-        { 214, 13, 30, 0 },
-        { 21, 11, 157, 1 },
-        { 60, 88, 53, 1 }, },
-      { { 213, 177, 150, 0 },
-        { 22, 19, 127, 0 },
-        { 52, 198, 213, 1 },
-        { 127, 100, 52, 0 }, },
-      { { 209, 159, 7, 1 },
-        { 47, 91, 89, 0 },
-        { 240, 124, 197, 1 },
-        { 77, 109, 122, 0 }, },
-      { { 209, 93, 126, 1 },
-        { 93, 159, 89, 1 },
-        { 191, 93, 69, 1 },
-        { 205, 124, 221, 0 }, },
-      { { 217, 164, 134, 1 },
-        { 143, 19, 58, 0 },
-        { 176, 146, 205, 1 },
-        { 46, 100, 120, 1 }, },
-      { { 221, 9, 48, 1 },
-        { 156, 153, 13, 0 },
-        { 134, 72, 93, 1 },
-        { 88, 76, 156, 1 }, },
-      { { 217, 180, 57, 1 },
-        { 159, 209, 74, 1 },
-        { 206, 22, 205, 1 },
-        { 169, 69, 252, 1 }, },
-      { { 221, 171, 105, 1 },
-        { 174, 221, 15, 1 },
-        { 203, 106, 221, 1 },
-        { 248, 93, 186, 1 }, },
-      { { 217, 203, 66, 0 },
-        { 230, 31, 9, 0 },
-        { 33, 105, 205, 1 },
-        { 72, 124, 51, 1 }, },
-      { { 210, 33, 13, 0 },
-        { 4, 65, 155, 1 },
-        { 88, 66, 37, 1 },
-        { 236, 193, 16, 0 }, },
-      { { 214, 73, 4, 0 },
-        { 68, 9, 157, 0 },
-        { 16, 73, 53, 1 },
-        { 92, 200, 17, 0 }, },
-      { { 210, 216, 219, 0 },
-        { 86, 79, 232, 1 },
-        { 109, 141, 165, 1 },
-        { 139, 249, 53, 0 }, },
-      { { 218, 63, 69, 1 },
-        { 173, 77, 219, 0 },
-        { 209, 126, 45, 1 },
-        { 109, 217, 90, 1 }, },
-      { { 218, 125, 218, 0 },
-        { 213, 15, 235, 1 },
-        { 45, 223, 45, 1 },
-        { 235, 248, 85, 1 }, },
-      { { 218, 211, 230, 0 },
-        { 230, 135, 249, 0 },
-        { 51, 229, 173, 1 },
-        { 79, 240, 179, 1 }, },
-      { { 211, 51, 189, 0 },
-        { 52, 209, 251, 1 },
-        { 94, 230, 101, 1 },
-        { 239, 197, 150, 0 }, },
-      { { 215, 225, 237, 1 },
-        { 78, 213, 191, 1 },
-        { 219, 195, 245, 1 },
-        { 254, 213, 185, 0 }, },
-      { { 219, 197, 122, 0 },
-        { 215, 151, 137, 1 },
-        { 47, 81, 237, 1 },
-        { 200, 244, 245, 1 }, },
-      { { 224, 128, 59, 1 },
-        { 26, 227, 8, 1 },
-        { 238, 0, 131, 1 },
-        { 136, 99, 172, 0 }, },
-      { { 224, 207, 105, 1 },
-        { 107, 237, 9, 1 },
-        { 203, 121, 131, 1 },
-        { 200, 91, 235, 0 }, },
-      { { 228, 71, 48, 1 },
-        { 121, 161, 13, 0 },
-        { 134, 113, 19, 1 },
-        { 88, 66, 207, 0 }, },
-      { { 232, 29, 86, 1 },
-        { 153, 47, 89, 0 },
-        { 181, 92, 11, 1 },
-        { 77, 122, 76, 1 }, },
-      { { 232, 243, 72, 1 },
-        { 234, 37, 75, 1 },
-        { 137, 103, 139, 1 },
-        { 233, 82, 43, 1 }, },
-      { { 232, 254, 175, 0 },
-        { 227, 235, 122, 1 },
-        { 122, 191, 139, 1 },
-        { 175, 107, 227, 1 }, },
-      { { 236, 231, 159, 0 },
-        { 243, 99, 63, 1 },
-        { 124, 243, 155, 1 },
-        { 254, 99, 103, 1 }, },
-      { { 225, 60, 212, 1 },
-        { 25, 61, 122, 0 },
-        { 149, 158, 67, 1 },
-        { 47, 94, 76, 0 }, },
-      { { 229, 204, 106, 1 },
-        { 75, 191, 12, 1 },
-        { 171, 25, 211, 1 },
-        { 152, 126, 233, 0 }, },
-      { { 233, 175, 154, 0 },
-        { 179, 59, 43, 1 },
-        { 44, 250, 203, 1 },
-        { 234, 110, 102, 1 }, },
-      { { 227, 0, 237, 0 },
-        { 0, 245, 184, 1 },
-        { 91, 128, 99, 1 },
-        { 142, 215, 128, 0 }, },
-      { { 231, 177, 14, 0 },
-        { 2, 51, 223, 1 },
-        { 56, 70, 243, 1 },
-        { 253, 230, 32, 0 }, },
-      { { 227, 192, 126, 0 },
-        { 82, 183, 152, 1 },
-        { 63, 1, 227, 1 },
-        { 140, 246, 165, 0 }, },
-      { { 235, 140, 163, 0 },
-        { 131, 251, 168, 0 },
-        { 98, 152, 235, 1 },
-        { 10, 239, 224, 1 }, },
-      { { 235, 159, 109, 1 },
-        { 171, 253, 217, 1 },
-        { 219, 124, 235, 1 },
-        { 205, 223, 234, 1 }, },
-      { { 239, 65, 11, 0 },
-        { 192, 115, 141, 1 },
-        { 104, 65, 123, 1 },
-        { 216, 231, 1, 1 }, },
-      { { 239, 194, 195, 0 },
-        { 226, 119, 172, 0 },
-        { 97, 161, 251, 1 },
-        { 26, 247, 35, 1 }, },
-      { { 240, 168, 32, 0 },
-        { 6, 169, 10, 0 },
-        { 2, 10, 135, 1 },
-        { 40, 74, 176, 0 }, },
-      { { 244, 25, 211, 0 },
-        { 20, 111, 109, 0 },
-        { 101, 204, 23, 1 },
-        { 91, 123, 20, 0 }, },
-      { { 244, 133, 191, 1 },
-        { 31, 227, 61, 1 },
-        { 254, 208, 151, 1 },
-        { 222, 99, 252, 0 }, },
-      { { 240, 106, 204, 0 },
-        { 100, 45, 58, 1 },
-        { 25, 171, 7, 1 },
-        { 174, 90, 19, 0 }, },
-      { { 240, 123, 107, 1 },
-        { 108, 239, 75, 1 },
-        { 235, 111, 7, 1 },
-        { 233, 123, 155, 0 }, },
-      { { 244, 251, 170, 0 },
-        { 102, 171, 111, 1 },
-        { 42, 239, 151, 1 },
-        { 251, 106, 179, 0 }, },
-      { { 252, 198, 47, 0 },
-        { 231, 227, 28, 1 },
-        { 122, 49, 159, 1 },
-        { 156, 99, 243, 1 }, },
-      { { 248, 111, 16, 0 },
-        { 245, 41, 11, 0 },
-        { 4, 123, 15, 1 },
-        { 104, 74, 87, 1 }, },
-      { { 252, 127, 120, 1 },
-        { 253, 173, 79, 1 },
-        { 143, 127, 31, 1 },
-        { 249, 90, 223, 1 }, },
-      { { 241, 171, 217, 0 },
-        { 54, 125, 43, 1 },
-        { 77, 234, 199, 1 },
-        { 234, 95, 54, 0 }, },
-      { { 245, 81, 143, 1 },
-        { 76, 115, 125, 1 },
-        { 248, 197, 87, 1 },
-        { 223, 103, 25, 0 }, },
-      { { 241, 248, 166, 1 },
-        { 78, 187, 122, 0 },
-        { 178, 143, 199, 1 },
-        { 47, 110, 185, 0 }, },
-      { { 241, 86, 24, 0 },
-        { 117, 49, 72, 1 },
-        { 12, 53, 71, 1 },
-        { 137, 70, 87, 0 }, },
-      { { 253, 132, 196, 0 },
-        { 135, 53, 60, 0 },
-        { 17, 144, 223, 1 },
-        { 30, 86, 112, 1 }, },
-      { { 249, 141, 114, 1 },
-        { 159, 191, 9, 0 },
-        { 167, 88, 207, 1 },
-        { 72, 126, 252, 1 }, },
-      { { 253, 15, 85, 1 },
-        { 189, 125, 29, 0 },
-        { 213, 120, 95, 1 },
-        { 92, 95, 94, 1 }, },
-      { { 242, 156, 111, 1 },
-        { 15, 239, 216, 1 },
-        { 251, 28, 167, 1 },
-        { 141, 251, 248, 0 }, },
-      { { 246, 136, 24, 1 },
-        { 30, 41, 140, 1 },
-        { 140, 8, 183, 1 },
-        { 152, 202, 60, 0 }, },
-      { { 246, 7, 197, 0 },
-        { 37, 101, 189, 0 },
-        { 81, 240, 55, 1 },
-        { 94, 211, 82, 0 }, },
-      { { 242, 65, 215, 0 },
-        { 84, 103, 185, 0 },
-        { 117, 193, 39, 1 },
-        { 78, 243, 21, 0 }, },
-      { { 246, 241, 27, 0 },
-        { 86, 99, 207, 1 },
-        { 108, 71, 183, 1 },
-        { 249, 227, 53, 0 }, },
-      { { 242, 230, 203, 1 },
-        { 111, 103, 170, 1 },
-        { 233, 179, 167, 1 },
-        { 170, 243, 123, 0 }, },
-      { { 250, 213, 32, 1 },
-        { 207, 161, 201, 0 },
-        { 130, 85, 175, 1 },
-        { 73, 194, 249, 1 }, },
-      { { 254, 67, 233, 0 },
-        { 228, 229, 173, 1 },
-        { 75, 225, 63, 1 },
-        { 218, 211, 147, 1 }, },
-      { { 243, 251, 142, 0 },
-        { 102, 59, 251, 1 },
-        { 56, 239, 231, 1 },
-        { 239, 238, 51, 0 }, },
-      { { 255, 187, 218, 0 },
-        { 182, 63, 239, 1 },
-        { 45, 238, 255, 1 },
-        { 251, 254, 54, 1 }, },
-      { { 251, 201, 14, 1 },
-        { 206, 59, 153, 1 },
-        { 184, 73, 239, 1 },
-        { 204, 238, 57, 1 }, }, };
+static constexpr uint64 DICT_6X6_1000_CODES[][4] = {
+    { 0x1e3dd82a6ULL, 0xe3ba46319ULL, 0x6541bbc78ULL, 0x98c625dc7ULL },
+    { 0x0efba3891ULL, 0xd7e61805eULL, 0x891c5df70ULL, 0x7a01867ebULL },
+    { 0x15907eacdULL, 0xec6957506ULL, 0xb357e09a8ULL, 0x60aea9637ULL },
+    { 0xc91b3069eULL, 0x42324bdecULL, 0x7960cd893ULL, 0x37bd24c42ULL },
+    { 0xd607d6e15ULL, 0xa4cb4abf2ULL, 0xa876be06bULL, 0x4fd52d325ULL },
+    { 0xd8e8e0e68ULL, 0x2b8c138afULL, 0x16707171bULL, 0xf51c831d4ULL },
+    { 0x4268b41f5ULL, 0x0da5c095dULL, 0xaf82d1642ULL, 0xba903a5b0ULL },
+    { 0x88a50f29aULL, 0x137317260ULL, 0x594f0a511ULL, 0x064e8cec8ULL },
+    { 0x307d524fdULL, 0x6d6e613c9ULL, 0xbf24abe0cULL, 0x93c8676b6ULL },
+    { 0x3c2f34b3cULL, 0x830beb34fULL, 0x3cd2cf43cULL, 0xf2cd7d0c1ULL },
+    { 0x45dfc74e3ULL, 0xfcf718e89ULL, 0xc72e3fba2ULL, 0x91718ef3fULL },
+    { 0x48d85b257ULL, 0x7e5456948ULL, 0xea4da1b12ULL, 0x1296a2a7eULL },
+    { 0x710558fc6ULL, 0x283ae6f82ULL, 0x63f1aa08eULL, 0x41f675c14ULL },
+    { 0x86dcfad07ULL, 0xe4d4d43beULL, 0xe0b5f3b61ULL, 0x7dc2b2b27ULL },
+    { 0x8d72a93f6ULL, 0xdbb4ce465ULL, 0x6fc954eb1ULL, 0xa62732ddbULL },
+    { 0xa2b89dcdeULL, 0x59b1751faULL, 0x7b3b91d45ULL, 0x5f8ae8d9aULL },
+    { 0x09fd1e9c4ULL, 0x4b67d470aULL, 0x23978bf90ULL, 0x50e2be6d2ULL },
+    { 0x154dbd18fULL, 0x94bfc570cULL, 0xf18bdb2a8ULL, 0x30ea3fd29ULL },
+    { 0x300a310e2ULL, 0x18382810dULL, 0x4708c500cULL, 0xb08141c18ULL },
+    { 0x4807efafdULL, 0x3ee34fa47ULL, 0xbf5f7e012ULL, 0xe25f2c77cULL },
+    { 0x56df11db6ULL, 0xd03ed8bdbULL, 0x6db88fb6aULL, 0xdbd1b7c0bULL },
+    { 0x66883274cULL, 0x8840f399cULL, 0x32e4c1166ULL, 0x399cf0211ULL },
+    { 0x76e8cb781ULL, 0xb5ecb6898ULL, 0x81ed3176eULL, 0x1916d37adULL },
+    { 0x9a53d9cf3ULL, 0x7ebe0c1f3ULL, 0xcf39bca59ULL, 0xcf8307d7eULL },
+    { 0xa9cb84024ULL, 0x028778429ULL, 0x24021d395ULL, 0x9421ee140ULL },
+    { 0xc67549490ULL, 0xf12604af0ULL, 0x09292ae63ULL, 0x0f520648fULL },
+    { 0xc1d288941ULL, 0x4c849cc22ULL, 0x829114b83ULL, 0x443392132ULL },
+    { 0xe7480852bULL, 0x8414a5cb9ULL, 0xd4a1012e7ULL, 0x9d3a52821ULL },
+    { 0xea2fca848ULL, 0x2bc22da3aULL, 0x12153f457ULL, 0x5c5b443d4ULL },
+    { 0xe963b77b1ULL, 0x17e7aade5ULL, 0x8deedc697ULL, 0xa7b55e7e8ULL },
+    { 0xfa36652afULL, 0x77396ba35ULL, 0xf54a66c5fULL, 0xac5d69ceeULL },
+    { 0x065bff7bdULL, 0xf4e7cf1ddULL, 0xbdeffda60ULL, 0xbb8f3e72fULL },
+    { 0x0541d72d6ULL, 0xb8f742540ULL, 0x6b4eb82a0ULL, 0x02a42ef1dULL },
+    { 0x0cf7246a2ULL, 0xc3371a285ULL, 0x45624ef30ULL, 0xa1458ecc3ULL },
+    { 0x1338a39ebULL, 0x5df88141fULL, 0xd79c51cc8ULL, 0xf82811fbaULL },
+    { 0x15a893e74ULL, 0x99c8525cbULL, 0x2e7c915a8ULL, 0xd3a4a1399ULL },
+    { 0x3a417ee9eULL, 0x227f671d6ULL, 0x7977e825cULL, 0x6b8e6fe44ULL },
+    { 0x4f11e26c0ULL, 0xeae202c94ULL, 0x0364788f2ULL, 0x293404757ULL },
+    { 0x530db6d20ULL, 0x00cb80f9fULL, 0x04b6db0caULL, 0xf9f01d300ULL },
+    { 0x589bfae34ULL, 0x62ca5e9cfULL, 0x2c75fd91aULL, 0xf397a5346ULL },
+    { 0x6409e8a0bULL, 0xa4922780eULL, 0xd05179026ULL, 0x701e44925ULL },
+    { 0x60537a891ULL, 0x64662c946ULL, 0x8915eca06ULL, 0x629346626ULL },
+    { 0x6159069baULL, 0x4077a1c4bULL, 0x5d9609a86ULL, 0xd2385ee02ULL },
+    { 0x6bff78d7bULL, 0x6f16bdfdfULL, 0xdeb1effd6ULL, 0xfbfbd68f6ULL },
+    { 0x70ad96a4fULL, 0x0ddb73b0aULL, 0xf2569b50eULL, 0x50dcedbb0ULL },
+    { 0x75846f71aULL, 0xb059b7ec4ULL, 0x58ef621aeULL, 0x237ed9a0dULL },
+    { 0x7a95192fcULL, 0x5a2a77b51ULL, 0x3f498a95eULL, 0x8adee545aULL },
+    { 0x8609760aaULL, 0xa0730113dULL, 0x5506e9061ULL, 0xbc880ce05ULL },
+    { 0x8a2d44c3fULL, 0x2713412fbULL, 0xfc322b451ULL, 0xdf482c8e4ULL },
+    { 0x93eb78b14ULL, 0x210ede57eULL, 0x28d1ed7c9ULL, 0x7ea7b7084ULL },
+    { 0x988da84d4ULL, 0x0aaa542ecULL, 0x2b215b119ULL, 0x3742a5550ULL },
+    { 0x9ede2b3c8ULL, 0xda6c9f23cULL, 0x13cd47b79ULL, 0x3c4f9365bULL },
+    { 0xa529e07b8ULL, 0xa1a2a34edULL, 0x1de0794a5ULL, 0xb72c54585ULL },
+    { 0xb593b855fULL, 0xcc9afd5e4ULL, 0xfaa1dc9adULL, 0x27abf5933ULL },
+    { 0xb7f8e426fULL, 0xed9d7343dULL, 0xf64271fedULL, 0xbc2ceb9b7ULL },
+    { 0xbc205225eULL, 0xab5863160ULL, 0x7a44a043dULL, 0x068c61ad5ULL },
+    { 0xc04487765ULL, 0x1cc5c2aa1ULL, 0xa6ee12203ULL, 0x85543a338ULL },
+    { 0xc4c324259ULL, 0x8c071b864ULL, 0x9a424c323ULL, 0x261d8e031ULL },
+    { 0xc5a91bd8dULL, 0x9562d5daaULL, 0xb1bd895a3ULL, 0x55bab46a9ULL },
+    { 0xce73e6b2cULL, 0xe3c7cb837ULL, 0x34d67ce73ULL, 0xec1d3e3c7ULL },
+    { 0xcd0ca6272ULL, 0x8ad102e6dULL, 0x4e46530b3ULL, 0xb67408b51ULL },
+    { 0xc9435d44dULL, 0x3e074dda0ULL, 0xb22bac293ULL, 0x05bb2e07cULL },
+    { 0xcfbe80f34ULL, 0xc380daefbULL, 0x2cf017df3ULL, 0xdf75b01c3ULL },
+    { 0xe57d15877ULL, 0xdd1760f6bULL, 0xee1a8bea7ULL, 0xd6f06e8bbULL },
+    { 0xefc6858e9ULL, 0x9ea539e33ULL, 0x971a163f7ULL, 0xcc79ca579ULL },
+    { 0xf77ef3772ULL, 0xf9dcaaffdULL, 0x4eecf7eefULL, 0xbff553b9fULL },
+    { 0x2ce43f254ULL, 0x9b4576344ULL, 0x2a4fc2734ULL, 0x22c6ea2d9ULL },
+    { 0x2bdcff4b3ULL, 0x76f5347ddULL, 0xcd2ff3bd4ULL, 0xbbe2caf6eULL },
+    { 0x37c7ddbdaULL, 0xb8bfbf752ULL, 0x5bdbbe3ecULL, 0x4aefdfd1dULL },
+    { 0xa1a254e0fULL, 0x25117b5a2ULL, 0xf072a4585ULL, 0x45ade88a4ULL },
+    { 0xa982c1bb5ULL, 0x36a0fa463ULL, 0xadd834195ULL, 0xc625f056cULL },
+    { 0xd81b49b08ULL, 0x720a8f82aULL, 0x10d92d81bULL, 0x541f1504eULL },
+    { 0x035829f86ULL, 0x5034c649eULL, 0x61f941ac0ULL, 0x792632c0aULL },
+    { 0x07c4095fcULL, 0x9824d56d1ULL, 0x3fa9023e0ULL, 0x8b6ab2419ULL },
+    { 0x0fe26617bULL, 0xaf5599455ULL, 0xde86647f0ULL, 0xaa299aaf5ULL },
+    { 0x144836441ULL, 0x8c4d0018cULL, 0x8226c1228ULL, 0x31800b231ULL },
+    { 0x10ad5ffb7ULL, 0x357bd63cbULL, 0xedffab508ULL, 0xd3c6bdeacULL },
+    { 0x12829553fULL, 0x1499d91d1ULL, 0xfcaa94148ULL, 0x8b89b9928ULL },
+    { 0x16e13184cULL, 0x990e51116ULL, 0x3218c8768ULL, 0x6888a7099ULL },
+    { 0x187a496b0ULL, 0x732c0e0c9ULL, 0x0d6925e18ULL, 0x9307034ceULL },
+    { 0x1ae886112ULL, 0x03dd90058ULL, 0x488611758ULL, 0x1a009bbc0ULL },
+    { 0x1913ae0a1ULL, 0x46eb0c405ULL, 0x85075c898ULL, 0xa0230d762ULL },
+    { 0x1b67b5a17ULL, 0x179f4a756ULL, 0xe85ade6d8ULL, 0x6ae52f9e8ULL },
+    { 0x25dc95f0bULL, 0xd495b378aULL, 0xd0fa93ba4ULL, 0x51ecda92bULL },
+    { 0x288961f76ULL, 0x3a12f20cfULL, 0x6ef869114ULL, 0xf304f485cULL },
+    { 0x3354146aaULL, 0x403d23791ULL, 0x556282accULL, 0x89ec4bc02ULL },
+    { 0x31c16c1f7ULL, 0x2c3ff4445ULL, 0xef836838cULL, 0xa222ffc34ULL },
+    { 0x33cb18c66ULL, 0x081e7c59bULL, 0x66318d3ccULL, 0xd9a3e7810ULL },
+    { 0x3ecfe490fULL, 0xa69ff921eULL, 0xf0927f37cULL, 0x7849ff965ULL },
+    { 0x464518a3fULL, 0x841647b53ULL, 0xfc518a262ULL, 0xcade26821ULL },
+    { 0x44ba70b67ULL, 0xed10da90fULL, 0xe6d0e5d22ULL, 0xf095b08b7ULL },
+    { 0x419c623e8ULL, 0x686093e0dULL, 0x17c463982ULL, 0xb07c90616ULL },
+    { 0x48d1914a1ULL, 0x56a610981ULL, 0x852898b12ULL, 0x81908656aULL },
+    { 0x54f499f6dULL, 0xdd8cd7b83ULL, 0xb6f992f2aULL, 0xc1deb31bbULL },
+    { 0x575a9c813ULL, 0xc49d0cd5aULL, 0xc81395aeaULL, 0x5ab30b923ULL },
+    { 0x558355b2cULL, 0xb00bdbd03ULL, 0x34daac1aaULL, 0xc0bdbd00dULL },
+    { 0x57b77610fULL, 0xe55bd9f14ULL, 0xf086eedeaULL, 0x28f9bdaa7ULL },
+    { 0x5c3436fe4ULL, 0xcb69c2b87ULL, 0x27f6c2c3aULL, 0xe1d4396d3ULL },
+    { 0x5c48fc77eULL, 0xaa9dc79cdULL, 0x7ee3f123aULL, 0xb39e3b955ULL },
+    { 0x5e6eef402ULL, 0xb3dd0ca9cULL, 0x402f7767aULL, 0x39530bbcdULL },
+    { 0x5f233b6ffULL, 0x9f7a4fdd5ULL, 0xff6dcc4faULL, 0xabbf25ef9ULL },
+    { 0x5b742a632ULL, 0x435c06ed5ULL, 0x4c6542edaULL, 0xab7603ac2ULL },
+    { 0x650fa33aeULL, 0x90f2ebe0dULL, 0x75cc5f0a6ULL, 0xb07d74f09ULL },
+    { 0x65d3175ccULL, 0xd867f9d80ULL, 0x33ae8cba6ULL, 0x01b9fe61bULL },
+    { 0x6a9c245aeULL, 0x4231f1a9dULL, 0x75a243956ULL, 0xb958f8c42ULL },
+    { 0x69c5f3042ULL, 0x3ad630f04ULL, 0x420cfa396ULL, 0x20f0c6b5cULL },
+    { 0x69d2484eaULL, 0x6a343dc81ULL, 0x572124b96ULL, 0x813bc2c56ULL },
+    { 0x7479e2de6ULL, 0xe9fee088fULL, 0x67b479e2eULL, 0xf11077f97ULL },
+    { 0x72cf23eabULL, 0x147e3ba9fULL, 0xd57c4f34eULL, 0xf95dc7e28ULL },
+    { 0x77b1dc414ULL, 0xe18b74dd0ULL, 0x2823b8deeULL, 0x0bb2ed187ULL },
+    { 0x7e0c07217ULL, 0x965962a58ULL, 0xe84e0307eULL, 0x1a5469a69ULL },
+    { 0x7a6970647ULL, 0x2f1e6299cULL, 0xe260e965eULL, 0x3994678f4ULL },
+    { 0x78b2d8707ULL, 0x6798fe980ULL, 0xe0e1b4d1eULL, 0x0197f19e6ULL },
+    { 0x79c585794ULL, 0x12aff2ec0ULL, 0x29ea1a39eULL, 0x0374ff548ULL },
+    { 0x866f59fc6ULL, 0xb936ce3baULL, 0x63f9af661ULL, 0x5dc736c9dULL },
+    { 0x82f6727f5ULL, 0x6d64da3f5ULL, 0xafe4e6f41ULL, 0xafc5b26b6ULL },
+    { 0x854e2f414ULL, 0x90454c6ecULL, 0x282f472a1ULL, 0x37632a209ULL },
+    { 0x9a1185934ULL, 0x528bc0073ULL, 0x2c9a18859ULL, 0xce003d14aULL },
+    { 0x9c7160c97ULL, 0xe73e400e6ULL, 0xe93068e39ULL, 0x670027ce7ULL },
+    { 0x9dd194fd8ULL, 0xcaaf935e2ULL, 0x1bf298bb9ULL, 0x47ac9f553ULL },
+    { 0xa21e12e38ULL, 0x40402b3fbULL, 0x1c7487845ULL, 0xdfcd40202ULL },
+    { 0xae701c82cULL, 0xc30565133ULL, 0x341380e75ULL, 0xcc8a6a0c3ULL },
+    { 0xad01219c1ULL, 0x9e22a0426ULL, 0x8398480b5ULL, 0x642054479ULL },
+    { 0xb0351f9eeULL, 0x597be5323ULL, 0x779f8ac0dULL, 0xc4ca7de9aULL },
+    { 0xb64ad80d4ULL, 0xa8ac6c178ULL, 0x2b01b526dULL, 0x1e8363515ULL },
+    { 0xb537314b4ULL, 0xd12a687e5ULL, 0x2d28cecadULL, 0xa7e16548bULL },
+    { 0xbeaac7e3bULL, 0xb7d93b0fbULL, 0xdc7e3557dULL, 0xdf0dc9bedULL },
+    { 0xbb683dbcfULL, 0x1f3de753eULL, 0xf3dbc16ddULL, 0x7cae7bcf8ULL },
+    { 0xc672f72c1ULL, 0xfde50a934ULL, 0x834ef4e63ULL, 0x2c950a7bfULL },
+    { 0xc1e74dbabULL, 0x35379fe23ULL, 0xd5db2e783ULL, 0xc47f9ecacULL },
+    { 0xcb55ee59dULL, 0x66e7c5ef4ULL, 0xb9a77aad3ULL, 0x2f7a3e766ULL },
+    { 0xcba053724ULL, 0x3340d2db1ULL, 0x24eca05d3ULL, 0x8db4b02ccULL },
+    { 0xd0090fcf1ULL, 0x1c6b048ebULL, 0x8f3f0900bULL, 0xd7120d638ULL },
+    { 0xd06c3ad54ULL, 0x094cc4beeULL, 0x2ab5c360bULL, 0x77d233290ULL },
+    { 0xd3f120574ULL, 0x490ed0cf5ULL, 0x2ea048fcbULL, 0xaf30b7092ULL },
+    { 0xe6e33b1a7ULL, 0x9576fc935ULL, 0xe58dcc767ULL, 0xac93f6ea9ULL },
+    { 0xe3533ea4aULL, 0x48572fd36ULL, 0x5257ccac7ULL, 0x6cbf4ea12ULL },
+    { 0xe8068eb14ULL, 0x02c1eea62ULL, 0x28d716017ULL, 0x465778340ULL },
+    { 0xec07c0597ULL, 0xa6b2e8ae0ULL, 0xe9a03e037ULL, 0x075174d65ULL },
+    { 0xeaf3803daULL, 0x4bb6bb870ULL, 0x5bc01cf57ULL, 0x0e1dd6dd2ULL },
+    { 0xf63b27d88ULL, 0xd16ba98beULL, 0x11be4dc6fULL, 0x7d195d68bULL },
+    { 0xf30798379ULL, 0x0c8aaff71ULL, 0x9ec19e0cfULL, 0x8eff55130ULL },
+    { 0xfe4bba9b9ULL, 0x86eead97fULL, 0x9d95dd27fULL, 0xfe9b57761ULL },
+    { 0xaba57d86bULL, 0x3f1335737ULL, 0xd61bea5d5ULL, 0xeceacc8fcULL },
+    { 0xc0d1625abULL, 0x6476918a5ULL, 0xd5a468b03ULL, 0xa51896e26ULL },
+    { 0x13ce7bae7ULL, 0x3c7c5e71fULL, 0xe75de73c8ULL, 0xf8e7a3e3cULL },
+    { 0x4e81fd617ULL, 0xb693569d4ULL, 0xe86bf8172ULL, 0x2b96ac96dULL },
+    { 0x56e076320ULL, 0xa14d92915ULL, 0x04c6e076aULL, 0xa8949b285ULL },
+    { 0x6a708a540ULL, 0x4bc4a4890ULL, 0x02a510e56ULL, 0x0912523d2ULL },
+    { 0x72a898a18ULL, 0x01883795aULL, 0x18519154eULL, 0x5a9ec1180ULL },
+    { 0x815d42f80ULL, 0x6066826aaULL, 0x01f42ba81ULL, 0x556416606ULL },
+    { 0xcf4cc3d5fULL, 0xbed4c1efaULL, 0xfabc332f3ULL, 0x5f7832b7dULL },
+    { 0xd6bb65864ULL, 0xf90b5883fULL, 0x261a6dd6bULL, 0xfc11ad09fULL },
+    { 0xecd313a31ULL, 0xd6463a963ULL, 0x8c5c8cb37ULL, 0xc695c626bULL },
+    { 0xf521f5207ULL, 0xb59b62d24ULL, 0xe04af84afULL, 0x24b46d9adULL },
+    { 0xf91fa5df7ULL, 0x5ebbe8eefULL, 0xefba5f89fULL, 0xf7717dd7aULL },
+    { 0x0024f47a7ULL, 0x25b1c2385ULL, 0xe5e2f2400ULL, 0xa1c438da4ULL },
+    { 0x00084d882ULL, 0x30310400aULL, 0x411b21000ULL, 0x500208c0cULL },
+    { 0x043cc2f29ULL, 0xe5c08328bULL, 0x94f433c20ULL, 0xd14c103a7ULL },
+    { 0x047b50211ULL, 0xe5060a148ULL, 0x8840ade20ULL, 0x1285060a7ULL },
+    { 0x067ae4c1dULL, 0xe585490deULL, 0xb83275e60ULL, 0x7b092a1a7ULL },
+    { 0x00aa968a3ULL, 0x05f11810bULL, 0xc51695500ULL, 0xd08188fa0ULL },
+    { 0x04d138e94ULL, 0xc026561c6ULL, 0x2971c8b20ULL, 0x6386a6403ULL },
+    { 0x0510a80daULL, 0xc8b005444ULL, 0x5b01508a0ULL, 0x222a00d13ULL },
+    { 0x0140b0007ULL, 0x049440504ULL, 0xe000d0280ULL, 0x20a022920ULL },
+    { 0x019d9cee1ULL, 0x4ca31678bULL, 0x87739b980ULL, 0xd1e68c532ULL },
+    { 0x081057e3bULL, 0x7651031c3ULL, 0xdc7ea0810ULL, 0xc38c08a6eULL },
+    { 0x086b97b66ULL, 0x1bd7ca10bULL, 0x66de9d610ULL, 0xd0853ebd8ULL },
+    { 0x0ee8b860aULL, 0x83941719cULL, 0x5061d1770ULL, 0x398e829c1ULL },
+    { 0x0b6c76b9bULL, 0x27758375eULL, 0xd9d6e36d0ULL, 0x7aec1aee4ULL },
+    { 0x0fdcb98cbULL, 0xdeb41571eULL, 0xd319d3bf0ULL, 0x78ea82d7bULL },
+    { 0x0fcacf3a0ULL, 0xb2e59e419ULL, 0x05cf353f0ULL, 0x98279a74dULL },
+    { 0x14249fd98ULL, 0x91e9853c2ULL, 0x19bf92428ULL, 0x43ca19789ULL },
+    { 0x1407201fdULL, 0x8c2ac9245ULL, 0xbf804e028ULL, 0xa24935431ULL },
+    { 0x150910d57ULL, 0x8c1ac05caULL, 0xeab0890a8ULL, 0x53a035831ULL },
+    { 0x135cd7307ULL, 0x74ddc2718ULL, 0xe0ceb3ac8ULL, 0x18e43bb2eULL },
+    { 0x11479abb6ULL, 0x00fece743ULL, 0x6dd59e288ULL, 0xc2e737f00ULL },
+    { 0x1cb9a9238ULL, 0xd38a1704dULL, 0x1c4959d38ULL, 0xb20e851cbULL },
+    { 0x1cdd07766ULL, 0xda5fd2289ULL, 0x66ee0bb38ULL, 0x9144bfa5bULL },
+    { 0x1f2e7c24bULL, 0xaf190f71cULL, 0xd243e74f8ULL, 0x38ef098f5ULL },
+    { 0x196642477ULL, 0x2f5c486c1ULL, 0xee2426698ULL, 0x836123af4ULL },
+    { 0x1957d4c84ULL, 0x62af48782ULL, 0x2132bea98ULL, 0x41e12f546ULL },
+    { 0x1fa8f4f04ULL, 0xa389d259eULL, 0x20f2f15f8ULL, 0x79a4b91c5ULL },
+    { 0x1b8246ed8ULL, 0x2a691b4d2ULL, 0x1b76241d8ULL, 0x4b2d89654ULL },
+    { 0x1baee10feULL, 0x3bb85965dULL, 0x7f08775d8ULL, 0xba69a1ddcULL },
+    { 0x22a4b63caULL, 0x09f1b3314ULL, 0x53c6d2544ULL, 0x28ccd8f90ULL },
+    { 0x22bf9012fULL, 0x4592f9319ULL, 0xf4809fd44ULL, 0x98c9f49a2ULL },
+    { 0x232c15b40ULL, 0x1901a271aULL, 0x02da834c4ULL, 0x58e458098ULL },
+    { 0x255aa966cULL, 0xd8846f48dULL, 0x366955aa4ULL, 0xb12f6211bULL },
+    { 0x27a5afa97ULL, 0x95f376656ULL, 0xe95f5a5e4ULL, 0x6a66ecfa9ULL },
+    { 0x25f40e425ULL, 0xc54574681ULL, 0xa42702fa4ULL, 0x8162ea2a3ULL },
+    { 0x286655cdeULL, 0x3b35693c2ULL, 0x7b3aa6614ULL, 0x43c96acdcULL },
+    { 0x2c427e0e0ULL, 0xaa652c105ULL, 0x0707e4234ULL, 0xa0834a655ULL },
+    { 0x2ab97cbd0ULL, 0x6b23b615eULL, 0x0bd3e9d54ULL, 0x7a86dc4d6ULL },
+    { 0x2946e1d23ULL, 0x3694a8687ULL, 0xc4b876294ULL, 0xe1615296cULL },
+    { 0x2da628410ULL, 0x83003c6c4ULL, 0x0821465b4ULL, 0x2363c00c1ULL },
+    { 0x2bfb209a6ULL, 0x4336f841fULL, 0x65904dfd4ULL, 0xf821f6cc2ULL },
+    { 0x368cd66bcULL, 0xa0e9733d9ULL, 0x3d66b316cULL, 0x9bcce9705ULL },
+    { 0x3487777c7ULL, 0xbc7bfa384ULL, 0xe3eeee12cULL, 0x21c5fde3dULL },
+    { 0x34ddeb840ULL, 0xf8ce3420eULL, 0x021d7bb2cULL, 0x7042c731fULL },
+    { 0x3791f76f1ULL, 0xfceb325d5ULL, 0x8f6ef89ecULL, 0xaba4cd73fULL },
+    { 0x3a228e175ULL, 0x0fc9ec051ULL, 0xae871445cULL, 0x8a03793f0ULL },
+    { 0x3e13bd408ULL, 0xd28b2d194ULL, 0x102bdc87cULL, 0x298b4d14bULL },
+    { 0x3c9843ca2ULL, 0xf2783008bULL, 0x453c2193cULL, 0xd100c1e4fULL },
+    { 0x39589d179ULL, 0x5e8da5549ULL, 0x9e8b91a9cULL, 0x92aa5b17aULL },
+    { 0x3974daeebULL, 0x6ffc27783ULL, 0xd775b2e9cULL, 0xc1ee43ff6ULL },
+    { 0x3f6dbc731ULL, 0x878fa67ddULL, 0x8ce3db6fcULL, 0xbbe65f1e1ULL },
+    { 0x3d6bc050cULL, 0xa38ee9488ULL, 0x30a03d6bcULL, 0x1129771c5ULL },
+    { 0x39ab27497ULL, 0x177b784ccULL, 0xe92e4d59cULL, 0x3321edee8ULL },
+    { 0x46024e25eULL, 0xa8514f850ULL, 0x7a4724062ULL, 0x0a1f28a15ULL },
+    { 0x4682ba0bcULL, 0x80e05d955ULL, 0x3d05d4162ULL, 0xaa9ba0701ULL },
+    { 0x42e9cd5aeULL, 0x31b7d5899ULL, 0x75ab39742ULL, 0x991abed8cULL },
+    { 0x44c9b7b3fULL, 0x94d7d394fULL, 0xfcded9322ULL, 0xf29cbeb29ULL },
+    { 0x40c7d41e9ULL, 0x2ca799b01ULL, 0x9782be302ULL, 0x80d99e534ULL },
+    { 0x46d2b4cceULL, 0xc8b559996ULL, 0x7332d4b62ULL, 0x6999aad13ULL },
+    { 0x43195356bULL, 0x7c5281d99ULL, 0xd6aca98c2ULL, 0x99b814a3eULL },
+    { 0x4122e6dd9ULL, 0x2de189cc6ULL, 0x9bb674482ULL, 0x6339187b4ULL },
+    { 0x4753a59abULL, 0xd4b789c17ULL, 0xd59a5cae2ULL, 0xe8391ed2bULL },
+    { 0x4e1ef1e08ULL, 0xf2800bb9eULL, 0x1078f7872ULL, 0x79dd0014fULL },
+    { 0x4e4ac0960ULL, 0xaa848881bULL, 0x069035272ULL, 0xd81112155ULL },
+    { 0x4e5faa06fULL, 0xced64da1dULL, 0xf6055fa72ULL, 0xb85b26b73ULL },
+    { 0x4a8d32943ULL, 0x0e5290b1eULL, 0xc294cb152ULL, 0x78d094a70ULL },
+    { 0x491594b39ULL, 0x468383f43ULL, 0x9cd29a892ULL, 0xc2fc1c162ULL },
+    { 0x4d4ddb621ULL, 0xb6c606f89ULL, 0x846dbb2b2ULL, 0x91f60636dULL },
+    { 0x4ba761e81ULL, 0x37221ae96ULL, 0x81786e5d2ULL, 0x6975844ecULL },
+    { 0x49d483d8eULL, 0x52f4d1e82ULL, 0x71bc12b92ULL, 0x4178b2f4aULL },
+    { 0x56290ef6cULL, 0x894bc789bULL, 0x36f70946aULL, 0xd91e3d291ULL },
+    { 0x537ed5ffcULL, 0x79adcbfdbULL, 0x3ffab7ecaULL, 0xdbfd3b59eULL },
+    { 0x55f5a7afaULL, 0xd9ff13e47ULL, 0x5f5e5afaaULL, 0xe27c8ff9bULL },
+    { 0x55d5ea64fULL, 0xecde57e84ULL, 0xf2657abaaULL, 0x217ea7b37ULL },
+    { 0x581bab1daULL, 0x5afa8d84cULL, 0x5b8d5d81aULL, 0x321b15f5aULL },
+    { 0x5ebe926ddULL, 0xcfe85bbd8ULL, 0xbb6497d7aULL, 0x1bdda17f3ULL },
+    { 0x5f10f99b5ULL, 0xf6a8c4d57ULL, 0xad99f08faULL, 0xeab23156fULL },
+    { 0x5d1edfa5cULL, 0xfac94ff4aULL, 0x3a5fb78baULL, 0x52ff2935fULL },
+    { 0x5f718df02ULL, 0xd39f86c92ULL, 0x40fb18efaULL, 0x49361f9cbULL },
+    { 0x5de11e468ULL, 0x8b4f15d81ULL, 0x1627887baULL, 0x81ba8f2d1ULL },
+    { 0x6033bb247ULL, 0x5dd26e904ULL, 0xe24ddcc06ULL, 0x209764bbaULL },
+    { 0x64581afe1ULL, 0xcc64a698bULL, 0x87f581a26ULL, 0xd19652633ULL },
+    { 0x63c8dda76ULL, 0x389576d5bULL, 0x6e5bb13c6ULL, 0xdab6ea91cULL },
+    { 0x61da3d8fdULL, 0x5c257dd4fULL, 0xbf1bc5b86ULL, 0xf2bbea43aULL },
+    { 0x6e3a22afaULL, 0xcb702b85fULL, 0x5f5445c76ULL, 0xfa1d40ed3ULL },
+    { 0x6e6105b71ULL, 0x9f07a2853ULL, 0x8eda08676ULL, 0xca145e0f9ULL },
+    { 0x6a89a9e8cULL, 0x12a27789eULL, 0x317959156ULL, 0x791ee4548ULL },
+    { 0x6a97224f5ULL, 0x4e6278ad5ULL, 0xaf244e956ULL, 0xab51e4672ULL },
+    { 0x6b12c3801ULL, 0x76c028c12ULL, 0x801c348d6ULL, 0x48314036eULL },
+    { 0x6b684b22aULL, 0x335427c19ULL, 0x544d216d6ULL, 0x983e42accULL },
+    { 0x6f94c1579ULL, 0xfe80b1ed1ULL, 0x9ea8329f6ULL, 0x8b78d017fULL },
+    { 0x6da6fea0dULL, 0xa7c17ff06ULL, 0xb057f65b6ULL, 0x60ffe83e5ULL },
+    { 0x6feaca457ULL, 0xafd47ccd8ULL, 0xea25357f6ULL, 0x1b33e2bf5ULL },
+    { 0x703d38a60ULL, 0x490a26b0fULL, 0x0651cbc0eULL, 0xf0d645092ULL },
+    { 0x766c35e78ULL, 0x990d23bdfULL, 0x1e7ac366eULL, 0xfbdc4b099ULL },
+    { 0x704a0dff6ULL, 0x183dee8cbULL, 0x6ffb0520eULL, 0xd3177bc18ULL },
+    { 0x7578a9c80ULL, 0xd1ac24c8eULL, 0x013951eaeULL, 0x71324358bULL },
+    { 0x714a70138ULL, 0x200ca9d4dULL, 0x1c80e528eULL, 0xb2b953004ULL },
+    { 0x757f8cbb9ULL, 0xc5afafe4bULL, 0x9dd31feaeULL, 0xd27f5f5a3ULL },
+    { 0x7c2368331ULL, 0xa70aae845ULL, 0x8cc16c43eULL, 0xa217550e5ULL },
+    { 0x7cb5a7d31ULL, 0xd7cbb0ac7ULL, 0x8cbe5ad3eULL, 0xe350dd3ebULL },
+    { 0x7cf82cedeULL, 0xcb3d778ceULL, 0x7b7341f3eULL, 0x731eebcd3ULL },
+    { 0x7f24e234fULL, 0xafd8e3e14ULL, 0xf2c4724feULL, 0x287c71bf5ULL },
+    { 0x7f47298d8ULL, 0x9a2e2de56ULL, 0x1b194e2feULL, 0x6a7b47459ULL },
+    { 0x86d803d19ULL, 0xd444910faULL, 0x98bc01b61ULL, 0x5f089222bULL },
+    { 0x838b1ba13ULL, 0x14521e57aULL, 0xc85d8d1c1ULL, 0x5ea784a28ULL },
+    { 0x87a279c59ULL, 0xbd001d5f6ULL, 0x9a39e45e1ULL, 0x6fab800bdULL },
+    { 0x8a43648ceULL, 0x2a3749036ULL, 0x73126c251ULL, 0x6c092ec54ULL },
+    { 0x88933b4c8ULL, 0x5a621d1a4ULL, 0x132dcc911ULL, 0x258b8465aULL },
+    { 0x8f21df4e3ULL, 0xbff3045b1ULL, 0xc72fb84f1ULL, 0x8da20cffdULL },
+    { 0x8d8435729ULL, 0x9601937a5ULL, 0x94eac21b1ULL, 0xa5ec98069ULL },
+    { 0x8d88d71fdULL, 0xbee1d1569ULL, 0xbf8eb11b1ULL, 0x96a8b877dULL },
+    { 0x899f78fcdULL, 0x6e22df7aeULL, 0xb3f1ef991ULL, 0x75efb4476ULL },
+    { 0x926b1679cULL, 0x016fcb1f8ULL, 0x39e68d649ULL, 0x1f8d3f680ULL },
+    { 0x948e22f12ULL, 0x80589a2eeULL, 0x48f447129ULL, 0x774591a01ULL },
+    { 0x90e5e6317ULL, 0x25dfd2264ULL, 0xe8c67a709ULL, 0x2644bfba4ULL },
+    { 0x96d8852a1ULL, 0xd4ad12039ULL, 0x854a11b69ULL, 0x9c048b52bULL },
+    { 0x95393ba46ULL, 0xd95a4652eULL, 0x625dc9ca9ULL, 0x74a625a9bULL },
+    { 0x953cfb4ddULL, 0xfde8457ecULL, 0xbb2df3ca9ULL, 0x37ea217bfULL },
+    { 0x913eaa126ULL, 0x41d8cc62dULL, 0x648557c89ULL, 0xb46331b82ULL },
+    { 0x976f5aaf9ULL, 0xad6e0f77bULL, 0x9f55af6e9ULL, 0xdeef076b5ULL },
+    { 0x91b229fdaULL, 0x59389f4e6ULL, 0x5bf944d89ULL, 0x672f91c9aULL },
+    { 0x91d3fa761ULL, 0x6cce9e5a5ULL, 0x86e5fcb89ULL, 0xa5a797336ULL },
+    { 0x9a7086c88ULL, 0x43ed010b2ULL, 0x113610e59ULL, 0x4d080b7c2ULL },
+    { 0x988ecd031ULL, 0x36891c269ULL, 0x8c0b37119ULL, 0x96438916cULL },
+    { 0x98c71097aULL, 0x0a1e99363ULL, 0x5e908e319ULL, 0xc6c997850ULL },
+    { 0x9dcbeb466ULL, 0xbade5c4adULL, 0x662d7d3b9ULL, 0xb523a7b5dULL },
+    { 0xa428f5b6eULL, 0xb991e312fULL, 0x76daf1425ULL, 0xf48c7899dULL },
+    { 0xa337f1793ULL, 0x75b2aa7f4ULL, 0xc9e8fecc5ULL, 0x2fe554daeULL },
+    { 0xa34440f5aULL, 0x2814a36f2ULL, 0x5af0222c5ULL, 0x4f6c52814ULL },
+    { 0xa17fad858ULL, 0x59872d66eULL, 0x1a1b5fe85ULL, 0x766b4e19aULL },
+    { 0xa7d29623dULL, 0xc4c57b571ULL, 0xbc4694be5ULL, 0x8eadea323ULL },
+    { 0xa845702bbULL, 0x263623365ULL, 0xdd40ea215ULL, 0xa6cc46c64ULL },
+    { 0xae487fa09ULL, 0xb6452713eULL, 0x905fe1275ULL, 0x7c8e4a26dULL },
+    { 0xac4fb6d68ULL, 0x8ac7a93afULL, 0x16b6df235ULL, 0xf5c95e351ULL },
+    { 0xa8a8d3853ULL, 0x3fd03016aULL, 0xca1cb1515ULL, 0x5680c0bfcULL },
+    { 0xa98b0acb8ULL, 0x02623d4ebULL, 0x1d350d195ULL, 0xd72bc4640ULL },
+    { 0xadfe8cde2ULL, 0xcbb5bc6abULL, 0x47b317fb5ULL, 0xd563dadd3ULL },
+    { 0xb4ef2e2eeULL, 0x897f7f22dULL, 0x77474f72dULL, 0xb44fefe91ULL },
+    { 0xb79989c70ULL, 0xd88a344fbULL, 0x0e39199edULL, 0xdf22c511bULL },
+    { 0xbe0ca20ecULL, 0x8ae86123dULL, 0x37045307dULL, 0xbc4861751ULL },
+    { 0xbc70227a9ULL, 0xc76ca30a5ULL, 0x95e440e3dULL, 0xa50c536e3ULL },
+    { 0xbebc2f91aULL, 0xd359b527eULL, 0x589f43d7dULL, 0x7e4ad9acbULL },
+    { 0xb8e90a983ULL, 0x077eb402aULL, 0xc1950971dULL, 0x5402d7ee0ULL },
+    { 0xbd0a30ec8ULL, 0x8a282b5aeULL, 0x1370c50bdULL, 0x75ad41451ULL },
+    { 0xc202e0f31ULL, 0x24808a8f7ULL, 0x8cf074043ULL, 0xef1510124ULL },
+    { 0xc26b32e37ULL, 0x05564a9ffULL, 0xec74cd643ULL, 0xff9526aa0ULL },
+    { 0xc6ca426a8ULL, 0xa0641b8b9ULL, 0x156425363ULL, 0x9d1d82605ULL },
+    { 0xc71eee68eULL, 0xe0f14febcULL, 0x7167778e3ULL, 0x3d7f28f07ULL },
+    { 0xc77d2e913ULL, 0xc55784e7eULL, 0xc8974bee3ULL, 0x7e721eaa3ULL },
+    { 0xce3c20742ULL, 0xcb1082abcULL, 0x42e043c73ULL, 0x3d54108d3ULL },
+    { 0xcc4ab9c57ULL, 0x9e944c9eeULL, 0xea39d5233ULL, 0x779322979ULL },
+    { 0xcef763dcdULL, 0xff66d9ab6ULL, 0xb3bc6ef73ULL, 0x6d59b66ffULL },
+    { 0xcd4322ca2ULL, 0x827608ca7ULL, 0x45344c2b3ULL, 0xe53106e41ULL },
+    { 0xcfb7cc1d0ULL, 0xeba39ce70ULL, 0x0b833edf3ULL, 0x0e739c5d7ULL },
+    { 0xc9cec835aULL, 0x2a949fe68ULL, 0x5ac137393ULL, 0x167f92954ULL },
+    { 0xcff34b713ULL, 0xf7569ecf0ULL, 0xc8ed2cff3ULL, 0x0f3796aefULL },
+    { 0xd62e7b70dULL, 0xb548cfbbcULL, 0xb0ede746bULL, 0x3ddf312adULL },
+    { 0xd4174b3b4ULL, 0xf06acea61ULL, 0x2dcd2e82bULL, 0x86573560fULL },
+    { 0xd78dfa97eULL, 0xa8dad5f7fULL, 0x7e95fb1ebULL, 0xfefab5b15ULL },
+    { 0xd1d8f5551ULL, 0x7c8d90decULL, 0x8aaaf1b8bULL, 0x37b09b13eULL },
+    { 0xd5cfe1d39ULL, 0xb48e99eefULL, 0x9cb87f3abULL, 0xf7799712dULL },
+    { 0xda16a8cc9ULL, 0x4ea80dab6ULL, 0x93315685bULL, 0x6d5b01572ULL },
+    { 0xd84c44859ULL, 0x2e0d01a6aULL, 0x9a122321bULL, 0x56580b074ULL },
+    { 0xdcd9728edULL, 0xee6e5192fULL, 0xb714e9b3bULL, 0xf498a7677ULL },
+    { 0xdf67117e8ULL, 0x9b2e8bfb1ULL, 0x17e88e6fbULL, 0x8dfd174d9ULL },
+    { 0xdb997de67ULL, 0x7e1b56dbfULL, 0xe67be99dbULL, 0xfdb6ad87eULL },
+    { 0xddab8e31eULL, 0x83dbdfc68ULL, 0x78c71d5bbULL, 0x163fbdbc1ULL },
+    { 0xe019084cdULL, 0x4c22658a8ULL, 0xb32109807ULL, 0x151a64432ULL },
+    { 0xe636da521ULL, 0xe5c0acbb1ULL, 0x84a5b6c67ULL, 0x8dd3503a7ULL },
+    { 0xe2acc79b0ULL, 0x31e1b0a7bULL, 0x0d9e33547ULL, 0xde50d878cULL },
+    { 0xe48d21620ULL, 0x900232aadULL, 0x04684b127ULL, 0xb554c4009ULL },
+    { 0xe2fed0c51ULL, 0x6d8438bfaULL, 0x8a30b7f47ULL, 0x5fd1c21b6ULL },
+    { 0xe13a7d02aULL, 0x71112dd2dULL, 0x540be5c87ULL, 0xb4bb4888eULL },
+    { 0xe7d05b8e5ULL, 0xfc6474d33ULL, 0xa71da0be7ULL, 0xccb2e263fULL },
+    { 0xec309c6b5ULL, 0xc7a1669e1ULL, 0xad6390c37ULL, 0x8796685e3ULL },
+    { 0xecaa49d20ULL, 0xb300bc8abULL, 0x04b925537ULL, 0xd513d00cdULL },
+    { 0xeeb37ac46ULL, 0xeb527c9b6ULL, 0x6235ecd77ULL, 0x6d93e4ad7ULL },
+    { 0xe8e0672e2ULL, 0x3b7532825ULL, 0x474e60717ULL, 0xa414caedcULL },
+    { 0xeae5d524cULL, 0x3b8773b30ULL, 0x324aba757ULL, 0x0cdcee1dcULL },
+    { 0xed6b1c2c2ULL, 0x8b372ed28ULL, 0x43438d6b7ULL, 0x14b74ecd1ULL },
+    { 0xebc8af1d6ULL, 0x1af5f4c7cULL, 0x6b8f513d7ULL, 0x3e32faf58ULL },
+    { 0xf20562d45ULL, 0x2c4ae0ab6ULL, 0xa2b46a04fULL, 0x6d5075234ULL },
+    { 0xf619bcfb2ULL, 0xc0bba69ffULL, 0x4df3d986fULL, 0xff965dd03ULL },
+    { 0xf6a35c6dbULL, 0xad3b3f9f0ULL, 0xdb63ac56fULL, 0x0f9fcdcb5ULL },
+    { 0xf4f1bd0f0ULL, 0xd9af34965ULL, 0x0f0bd8f2fULL, 0xa692cf59bULL },
+    { 0xf16a9b435ULL, 0x15cc6cde9ULL, 0xac2d9568fULL, 0x97b3633a8ULL },
+    { 0xf1b29129eULL, 0x51b87bd60ULL, 0x794894d8fULL, 0x06bde1d8aULL },
+    { 0xfa545bf35ULL, 0x764ce6bf3ULL, 0xacfda2a5fULL, 0xcfd67326eULL },
+    { 0xfe6e867c6ULL, 0x8bfdeaab8ULL, 0x63e61767fULL, 0x1d557bfd1ULL },
+    { 0xf90db9432ULL, 0x129a24fedULL, 0x4c29db09fULL, 0xb7f245948ULL },
+    { 0xf969662bdULL, 0x276f63c6dULL, 0xbd466969fULL, 0xb63c6f6e4ULL },
+    { 0xfb41cb484ULL, 0x32ee64cb0ULL, 0x212d382dfULL, 0x0d326774cULL },
+    { 0xfd57bf985ULL, 0xd6efecf26ULL, 0xa19fdeabfULL, 0x64f37f76bULL },
+    { 0xfb98907e6ULL, 0x4ab8f2db9ULL, 0x67e0919dfULL, 0x9db4f1d52ULL },
+    { 0xffea21c63ULL, 0x9f1c38cbfULL, 0xc638457ffULL, 0xfd31c38f9ULL },
+    { 0xa3a56f450ULL, 0x3943346f4ULL, 0x0a2f6a5c5ULL, 0x2f62cc29cULL },
+    { 0xa19868302ULL, 0x6010b642cULL, 0x40c161985ULL, 0x3426d0806ULL },
+    { 0x0f37832b0ULL, 0xd3e20a651ULL, 0x0d4c1ecf0ULL, 0x8a65047cbULL },
+    { 0x26ec48272ULL, 0xa91436259ULL, 0x4e4123764ULL, 0x9a46c2895ULL },
+    { 0x4198b8a8fULL, 0x44b057d0eULL, 0xf151d1982ULL, 0x70bea0d22ULL },
+    { 0x4eb5438a4ULL, 0xf36250a13ULL, 0x251c2ad72ULL, 0xc850a46cfULL },
+    { 0x63c5e37baULL, 0x30f6b3ed5ULL, 0x5dec7a3c6ULL, 0xab7cd6f0cULL },
+    { 0x6e59dde6cULL, 0xfa876799bULL, 0x367bb9a76ULL, 0xd99e6e15fULL },
+    { 0x80d459f08ULL, 0x7004973a2ULL, 0x10f9a2b01ULL, 0x45ce9200eULL },
+    { 0x9808889fdULL, 0x0ea8c506bULL, 0xbf9111019ULL, 0xd60a31570ULL },
+    { 0xa30667a6fULL, 0x3c516b637ULL, 0xf65e660c5ULL, 0xec6d68a3cULL },
+    { 0x0219a6147ULL, 0x4cd3c001cULL, 0xe28659840ULL, 0x38003cb32ULL },
+    { 0x0215ca4e2ULL, 0x68f204291ULL, 0x47253a840ULL, 0x894204f16ULL },
+    { 0x0068cc399ULL, 0x25a587048ULL, 0x99c331600ULL, 0x120e1a5a4ULL },
+    { 0x00a113fe8ULL, 0x196293183ULL, 0x17fc88500ULL, 0xc18c94698ULL },
+    { 0x02b956755ULL, 0x6d43d21d8ULL, 0xaae6a9d40ULL, 0x1b84bc2b6ULL },
+    { 0x02c6bb532ULL, 0x10d49c3d5ULL, 0x4cadd6340ULL, 0xabc392b08ULL },
+    { 0x02f31f1d9ULL, 0x5d679d150ULL, 0x9b8f8cf40ULL, 0x0a8b9e6baULL },
+    { 0x072ac17e3ULL, 0xbdb08a499ULL, 0xc7e8354e0ULL, 0x992510dbdULL },
+    { 0x07378d972ULL, 0xd9938c653ULL, 0x4e9b1ece0ULL, 0xca631c99bULL },
+    { 0x016f1fe75ULL, 0x1d474e7cbULL, 0xae7f8f680ULL, 0xd3e72e2b8ULL },
+    { 0x017730155ULL, 0x4d06c8744ULL, 0xaa80cee80ULL, 0x22e1360b2ULL },
+    { 0x07957241aULL, 0xe052117d4ULL, 0x5824ea9e0ULL, 0x2be884a07ULL },
+    { 0x07c8a386eULL, 0x98d45141fULL, 0x761c513e0ULL, 0xf828a2b19ULL },
+    { 0x05fefbf79ULL, 0xfdc49f7cfULL, 0x9efdf7fa0ULL, 0xf3ef923bfULL },
+    { 0x0c15f3101ULL, 0xf6c280304ULL, 0x808cfa830ULL, 0x20c01436fULL },
+    { 0x0a4462e2eULL, 0x225443297ULL, 0x747462250ULL, 0xe94c22a44ULL },
+    { 0x085e37ee9ULL, 0x5e650b38fULL, 0x977ec7a10ULL, 0xf1cd0a67aULL },
+    { 0x0852de12dULL, 0x66c5cd101ULL, 0xb487b4a10ULL, 0x808b3a366ULL },
+    { 0x0c6688039ULL, 0x87840d241ULL, 0x9c0116630ULL, 0x824b021e1ULL },
+    { 0x088cba47fULL, 0x0ed0553cdULL, 0xfe25d3110ULL, 0xb3caa0b70ULL },
+    { 0x0cac271e5ULL, 0x9f61d020dULL, 0xa78e43530ULL, 0xb040b86f9ULL },
+    { 0x08b3380bfULL, 0x47325d145ULL, 0xfd01ccd10ULL, 0xa28ba4ce2ULL },
+    { 0x0ca2a5d94ULL, 0x93a1d80c6ULL, 0x29ba54530ULL, 0x6301b85c9ULL },
+    { 0x08e352c01ULL, 0x274618182ULL, 0x8034ac710ULL, 0x4181862e4ULL },
+    { 0x0eff44f5eULL, 0xeb17db2daULL, 0x7af22ff70ULL, 0x5b4dbe8d7ULL },
+    { 0x0eff5deabULL, 0xf7371f39bULL, 0xd57baff70ULL, 0xd9cf8ecefULL },
+    { 0x0b346dc9eULL, 0x7331456d6ULL, 0x793b62cd0ULL, 0x6b6a28cceULL },
+    { 0x0d09febb3ULL, 0xa6f38654fULL, 0xcdd7f90b0ULL, 0xf2a61cf65ULL },
+    { 0x0f10aa926ULL, 0xc2d0c4417ULL, 0x6495508f0ULL, 0xe82230b43ULL },
+    { 0x0d1f65a7eULL, 0xfa134b64fULL, 0x7e5a6f8b0ULL, 0xf26d2c85fULL },
+    { 0x0fb15fa00ULL, 0xf34316512ULL, 0x005fa8df0ULL, 0x48a68c2cfULL },
+    { 0x0da205233ULL, 0x97111a441ULL, 0xcc4a045b0ULL, 0x8225888e9ULL },
+    { 0x0daf23dbbULL, 0x9772996cfULL, 0xddbc4f5b0ULL, 0xf36994ee9ULL },
+    { 0x0bf0a5ee4ULL, 0x5ba552497ULL, 0x277a50fd0ULL, 0xe924aa5daULL },
+    { 0x0dc899fbeULL, 0x92b4d75cbULL, 0x7df9913b0ULL, 0xd3aeb2d49ULL },
+    { 0x0ffd30277ULL, 0xcf165275dULL, 0xee40cbff0ULL, 0xbae4a68f3ULL },
+    { 0x0bc75d562ULL, 0x3a179c791ULL, 0x46abae3d0ULL, 0x89e39e85cULL },
+    { 0x122fa301dULL, 0x15ca4925cULL, 0xb80c5f448ULL, 0x3a49253a8ULL },
+    { 0x127548725ULL, 0x650ec6291ULL, 0xa4e12ae48ULL, 0x8946370a6ULL },
+    { 0x104fae627ULL, 0x04df4e28dULL, 0xe4675f208ULL, 0xb1472fb20ULL },
+    { 0x108c8ae8bULL, 0x04f81728aULL, 0xd17513108ULL, 0x514e81f20ULL },
+    { 0x10f3f42eeULL, 0x69bf5b105ULL, 0x7742fcf08ULL, 0xa08dafd96ULL },
+    { 0x1337ee702ULL, 0x61db8e694ULL, 0x40e77ecc8ULL, 0x29671db86ULL },
+    { 0x170b23eb0ULL, 0x906a0a4dfULL, 0x0d7c4d0e8ULL, 0xfb2505609ULL },
+    { 0x15026f1bbULL, 0xb4798d445ULL, 0xdd8f640a8ULL, 0xa22b19e2dULL },
+    { 0x11a1abcb2ULL, 0x11fa144c7ULL, 0x4d3d58588ULL, 0xe32285f88ULL },
+    { 0x13a64ac8dULL, 0x25685d692ULL, 0xb135265c8ULL, 0x496ba16a4ULL },
+    { 0x178e35cd3ULL, 0x9c39187deULL, 0xcb3ac71e8ULL, 0x7be189c39ULL },
+    { 0x158be59dcULL, 0xb8abd944eULL, 0x3b9a7d1a8ULL, 0x7229bd51dULL },
+    { 0x17a6f97d4ULL, 0xb9a8de7d4ULL, 0x2be9f65e8ULL, 0x2be7b159dULL },
+    { 0x15dca4b44ULL, 0xc88dd260eULL, 0x22d253ba8ULL, 0x7064bb113ULL },
+    { 0x11df0543cULL, 0x500f596c9ULL, 0x3c2a0fb88ULL, 0x9369af00aULL },
+    { 0x15d201935ULL, 0xd40cd8443ULL, 0xac9804ba8ULL, 0xc221b302bULL },
+    { 0x181fadfaaULL, 0x52bb8f28fULL, 0x55fb5f818ULL, 0xf14f1dd4aULL },
+    { 0x1c400eabdULL, 0x866d47043ULL, 0xbd5700238ULL, 0xc20e2b661ULL },
+    { 0x1e4c5d3d2ULL, 0xba3d86358ULL, 0x4bcba3278ULL, 0x1ac61bc5dULL },
+    { 0x186ff67f9ULL, 0x2fef8b3cdULL, 0x9fe6ff618ULL, 0xb3cd1f7f4ULL },
+    { 0x185734b8fULL, 0x463fcb306ULL, 0xf1d2cea18ULL, 0x60cd3fc62ULL },
+    { 0x1e5689e34ULL, 0xd28c4e2d3ULL, 0x2c7916a78ULL, 0xcb472314bULL },
+    { 0x1a95d1845ULL, 0x7e8a50312ULL, 0xa218ba958ULL, 0x48c0a517eULL },
+    { 0x18a7ff02aULL, 0x33db1d305ULL, 0x540ffe518ULL, 0xa0cb8dbccULL },
+    { 0x189eb1c9eULL, 0x52b8593ceULL, 0x7938d7918ULL, 0x73c9a1d4aULL },
+    { 0x1cb20a60aULL, 0xc3581f080ULL, 0x506504d38ULL, 0x010f81ac3ULL },
+    { 0x1c9235881ULL, 0xd62918106ULL, 0x811ac4938ULL, 0x60818946bULL },
+    { 0x1c93b7d6dULL, 0xdecbd9187ULL, 0xb6bedc938ULL, 0xe189bd37bULL },
+    { 0x1acabc581ULL, 0x06ad9c19cULL, 0x81a3d5358ULL, 0x39839b560ULL },
+    { 0x1ce2acb58ULL, 0x8b8d9f046ULL, 0x1ad354738ULL, 0x620f9b1d1ULL },
+    { 0x1b79ed064ULL, 0x7b8f4441dULL, 0x260b79ed8ULL, 0xb8222f1deULL },
+    { 0x1f6a39132ULL, 0x931c8c55dULL, 0x4c89c56f8ULL, 0xbaa3138c9ULL },
+    { 0x1d9838750ULL, 0xca08965ccULL, 0x0ae1c19b8ULL, 0x33a691053ULL },
+    { 0x200dc103fULL, 0x349261249ULL, 0xfc083b004ULL, 0x92486492cULL },
+    { 0x2635d4e80ULL, 0xe1a322392ULL, 0x0172bac64ULL, 0x49c44c587ULL },
+    { 0x26752c2f8ULL, 0xc92727255ULL, 0x1f434ae64ULL, 0xaa4e4e493ULL },
+    { 0x2053858f6ULL, 0x58b768043ULL, 0x6f1a1ca04ULL, 0xc2016ed1aULL },
+    { 0x22881f7a3ULL, 0x1471b6199ULL, 0xc5ef81144ULL, 0x9986d8e28ULL },
+    { 0x272cfae55ULL, 0xadc0667deULL, 0xaa75f34e4ULL, 0x7be6603b5ULL },
+    { 0x216b4c43bULL, 0x25172d4c9ULL, 0xdc232d684ULL, 0x932b4e8a4ULL },
+    { 0x25bc670baULL, 0xf1713164dULL, 0x5d0e63da4ULL, 0xb268c8e8fULL },
+    { 0x21a3e9b0eULL, 0x3192ff406ULL, 0x70d97c584ULL, 0x602ff498cULL },
+    { 0x2196f291fULL, 0x64d0f9746ULL, 0xf894f6984ULL, 0x62e9f0b26ULL },
+    { 0x27a22b8caULL, 0x99703d416ULL, 0x531d445e4ULL, 0x682bc0e99ULL },
+    { 0x279f48328ULL, 0xe002bf619ULL, 0x14c12f9e4ULL, 0x986fd4007ULL },
+    { 0x23e2bcc97ULL, 0x05b57c5d6ULL, 0xe933d47c4ULL, 0x6ba3eada0ULL },
+    { 0x21c257f41ULL, 0x3c45ba582ULL, 0x82fea4384ULL, 0x41a5da23cULL },
+    { 0x27cfbaf8bULL, 0x84f6bf79eULL, 0xd1f5df3e4ULL, 0x79efd6f21ULL },
+    { 0x2a2fbde4bULL, 0x1f932f39eULL, 0xd27bdf454ULL, 0x79cf4c9f8ULL },
+    { 0x2a543a8ccULL, 0x4a6465316ULL, 0x3315c2a54ULL, 0x68ca62652ULL },
+    { 0x2ad1bb97fULL, 0x5ed6f5157ULL, 0xfe9dd8b54ULL, 0xea8af6b7aULL },
+    { 0x28ff3a631ULL, 0x47463e3cdULL, 0x8c65cff14ULL, 0xb3c7c62e2ULL },
+    { 0x2b54c5b98ULL, 0x72a5a3652ULL, 0x19da32ad4ULL, 0x4a6c5a54eULL },
+    { 0x2d61af1aaULL, 0x93f7a5405ULL, 0x558f586b4ULL, 0xa02a5efc9ULL },
+    { 0x2bbcdb3e6ULL, 0x7bf0f6719ULL, 0x67cdb3dd4ULL, 0x98e6f0fdeULL },
+    { 0x2d9f9a0d2ULL, 0xcaf23c748ULL, 0x4b059f9b4ULL, 0x12e3c4f53ULL },
+    { 0x2fbb726a3ULL, 0xe7723a59dULL, 0xc564eddf4ULL, 0xb9a5c4ee7ULL },
+    { 0x2bd9ccff7ULL, 0x6eb7f64dbULL, 0xeff339bd4ULL, 0xdb26fed76ULL },
+    { 0x29c6df8ecULL, 0x3ae57d703ULL, 0x371fb6394ULL, 0xc0ebea75cULL },
+    { 0x340c3fc35ULL, 0x9449643cfULL, 0xac3fc302cULL, 0xf3c269229ULL },
+    { 0x30031b28eULL, 0x107a6f100ULL, 0x714d8c00cULL, 0x008f65e08ULL },
+    { 0x30711dec3ULL, 0x5d3f26182ULL, 0xc37b88e0cULL, 0x41864fcbaULL },
+    { 0x344cdea2aULL, 0xa0dd2730bULL, 0x5457b322cULL, 0xd0ce4bb05ULL },
+    { 0x327a8a8bcULL, 0x41ec6d05bULL, 0x3d1515e4cULL, 0xda0b63782ULL },
+    { 0x365763d72ULL, 0xf85ea82d7ULL, 0x4ebc6ea6cULL, 0xeb4157a1fULL },
+    { 0x348d32aa6ULL, 0x807a7230fULL, 0x6554cb12cULL, 0xf0c4e5e01ULL },
+    { 0x3681fab11ULL, 0xa4cab6156ULL, 0x88d5f816cULL, 0x6a86d5325ULL },
+    { 0x36996f15dULL, 0xfc4bf505cULL, 0xba8f6996cULL, 0x3a0afd23fULL },
+    { 0x32cc6c31eULL, 0x201df725cULL, 0x78c36334cULL, 0x3a4efb804ULL },
+    { 0x36e0074d4ULL, 0x996d700d0ULL, 0x2b2e0076cULL, 0x0b00eb699ULL },
+    { 0x33408d9c5ULL, 0x1cade4412ULL, 0xa39b102ccULL, 0x48227b538ULL },
+    { 0x337daeb6aULL, 0x49dfa761fULL, 0x56d75beccULL, 0xf86e5fb92ULL },
+    { 0x315eff3d1ULL, 0x7cedae74cULL, 0x8bcff7a8cULL, 0x32e75b73eULL },
+    { 0x35a4f928bULL, 0xb5b837704ULL, 0xd149f25acULL, 0x20eec1dadULL },
+    { 0x3386a1c64ULL, 0x188878697ULL, 0x2638561ccULL, 0xe961e1118ULL },
+    { 0x35e81a9ecULL, 0x896cf550bULL, 0x3795817acULL, 0xd0aaf3691ULL },
+    { 0x37d858ba3ULL, 0xe43cb651bULL, 0xc5d1a1becULL, 0xd8a6d3c27ULL },
+    { 0x38153359cULL, 0x526ae13c4ULL, 0x39acca81cULL, 0x23c87564aULL },
+    { 0x381b626acULL, 0x626a6b08dULL, 0x35646d81cULL, 0xb10d65646ULL },
+    { 0x3a3650dbaULL, 0x6338a93d3ULL, 0x5db0a6c5cULL, 0xcbc951cc6ULL },
+    { 0x3888d1f29ULL, 0x3688b318bULL, 0x94f8b111cULL, 0xd18cd116cULL },
+    { 0x3acc8dc82ULL, 0x12bd3429aULL, 0x413b1335cULL, 0x5942cbd48ULL },
+    { 0x3cfcf907bULL, 0xff9c3534dULL, 0xde09f3f3cULL, 0xb2cac39ffULL },
+    { 0x3cf68939cULL, 0xd3acff240ULL, 0x39c916f3cULL, 0x024ff35cbULL },
+    { 0x3b0faec79ULL, 0x0ecb2d6dfULL, 0x9e375f0dcULL, 0xfb6b4d370ULL },
+    { 0x3d0b5ff56ULL, 0xba5bee5caULL, 0x6affad0bcULL, 0x53a77da5dULL },
+    { 0x394983aa6ULL, 0x12fe6240bULL, 0x655c1929cULL, 0xd02467f48ULL },
+    { 0x3d5cafe56ULL, 0xdadd666ceULL, 0x6a7f53abcULL, 0x73666bb5bULL },
+    { 0x3b6fd1fe2ULL, 0x3bbeaa79bULL, 0x47f8bf6dcULL, 0xd9e557ddcULL },
+    { 0x3d72e5ce7ULL, 0xffbd68487ULL, 0xe73a74ebcULL, 0xe1216bdffULL },
+    { 0x3ba518304ULL, 0x030af6710ULL, 0x20c18a5dcULL, 0x08e6f50c0ULL },
+    { 0x3bd7d774eULL, 0x7adffb790ULL, 0x72eebebdcULL, 0x09edffb5eULL },
+    { 0x421507861ULL, 0x5c4300a13ULL, 0x861e0a842ULL, 0xc8500c23aULL },
+    { 0x442a33cc5ULL, 0x9d604898eULL, 0xa33cc5422ULL, 0x7191206b9ULL },
+    { 0x40693e20cULL, 0x01474790cULL, 0x3047c9602ULL, 0x309e2e280ULL },
+    { 0x444c54f1cULL, 0xa005c3bcaULL, 0x38f2a3222ULL, 0x53dc3a005ULL },
+    { 0x404ecf055ULL, 0x3cc54ca48ULL, 0xaa0f37202ULL, 0x12532a33cULL },
+    { 0x40df4ac46ULL, 0x68565ca8aULL, 0x62352fb02ULL, 0x5153a6a16ULL },
+    { 0x46da671aeULL, 0xf075d981dULL, 0x758e65b62ULL, 0xb819bae0fULL },
+    { 0x4320efb2dULL, 0x35c1c7c17ULL, 0xb4df704c2ULL, 0xe83e383acULL },
+    { 0x416379f27ULL, 0x3516ced87ULL, 0xe4f9ec682ULL, 0xe1b7368acULL },
+    { 0x477fa92caULL, 0xd9b60fe1cULL, 0x53495fee2ULL, 0x387f06d9bULL },
+    { 0x43a82473aULL, 0x011193cddULL, 0x5ce2415c2ULL, 0xbb3c98880ULL },
+    { 0x45ae02a61ULL, 0x8d401ae0bULL, 0x8654075a2ULL, 0xd075802b1ULL },
+    { 0x481d7d6b6ULL, 0x723346bcdULL, 0x6d6beb812ULL, 0xb3d62cc4eULL },
+    { 0x4844290e4ULL, 0x1a2444a05ULL, 0x270942212ULL, 0xa05222458ULL },
+    { 0x4c5db0f26ULL, 0xc296c2b8fULL, 0x64f0dba32ULL, 0xf1d436943ULL },
+    { 0x484fa64c0ULL, 0x0ae708a8cULL, 0x03265f212ULL, 0x31510e750ULL },
+    { 0x4881f22dbULL, 0x2ef213944ULL, 0xdb44f8112ULL, 0x229c84f74ULL },
+    { 0x488c699abULL, 0x363095a0fULL, 0xd59963112ULL, 0xf05a90c6cULL },
+    { 0x4ce627c52ULL, 0x9b5518ac6ULL, 0x4a3e46732ULL, 0x63518aad9ULL },
+    { 0x4f3da3cd7ULL, 0xdff240edeULL, 0xeb3c5bcf2ULL, 0x7b7024ffbULL },
+    { 0x4949fdb88ULL, 0x32a787d0eULL, 0x11dbf9292ULL, 0x70be1e54cULL },
+    { 0x4d596f197ULL, 0xf677c4c4cULL, 0xe98f69ab2ULL, 0x32323ee6fULL },
+    { 0x4f4fd527bULL, 0xbe970bf59ULL, 0xde4abf2f2ULL, 0x9afd0e97dULL },
+    { 0x4b9464e4bULL, 0x6e1113e96ULL, 0xd272629d2ULL, 0x697c88876ULL },
+    { 0x4da06aa9eULL, 0xa37057c46ULL, 0x7955605b2ULL, 0x623ea0ec5ULL },
+    { 0x4b92d1fb2ULL, 0x72b09add3ULL, 0x4df8b49d2ULL, 0xcbb590d4eULL },
+    { 0x4fed80bebULL, 0x8fb693e1bULL, 0xd7d01b7f2ULL, 0xd87c96df1ULL },
+    { 0x49fa6eaf3ULL, 0x6f751ec4fULL, 0xcf5765f92ULL, 0xf2378aef6ULL },
+    { 0x5420aca77ULL, 0x8d9946847ULL, 0xee535042aULL, 0xe216299b1ULL },
+    { 0x5419a48e8ULL, 0xc8ab0180fULL, 0x17125982aULL, 0xf0180d513ULL },
+    { 0x5674da1f8ULL, 0xe9ec85b51ULL, 0x1f85b2e6aULL, 0x8ada13797ULL },
+    { 0x524645d4bULL, 0x3c1d89a92ULL, 0xd2ba2624aULL, 0x49591b83cULL },
+    { 0x509970c03ULL, 0x641a1098eULL, 0xc030e990aULL, 0x719085826ULL },
+    { 0x52a2c46a5ULL, 0x25a95a891ULL, 0xa5623454aULL, 0x8915a95a4ULL },
+    { 0x50e8aa424ULL, 0x01cc5488dULL, 0x24255170aULL, 0xb112a3380ULL },
+    { 0x52f2ad598ULL, 0x51ad9d8d4ULL, 0x19ab54f4aULL, 0x2b1b9b58aULL },
+    { 0x52daebf6aULL, 0x78dc9f89fULL, 0x56fd75b4aULL, 0xf91f93b1eULL },
+    { 0x552ef8e22ULL, 0xa1980ef8fULL, 0x4471f74aaULL, 0xf1f701985ULL },
+    { 0x514160b62ULL, 0x281e82c07ULL, 0x46d06828aULL, 0xe03417814ULL },
+    { 0x556806158ULL, 0x894d81c48ULL, 0x1a86016aaULL, 0x12381b291ULL },
+    { 0x534a7e4bdULL, 0x246d4ddddULL, 0xbd27e52caULL, 0xbbbb2b624ULL },
+    { 0x536bd3e0bULL, 0x35de0bd9aULL, 0xd07cbd6caULL, 0x59bd07bacULL },
+    { 0x577282d27ULL, 0xc5dcc8c93ULL, 0xe4b414eeaULL, 0xc93133ba3ULL },
+    { 0x5781d5582ULL, 0xb0bb90d90ULL, 0x41aab81eaULL, 0x09b09dd0dULL },
+    { 0x57a4c34a8ULL, 0xb1e811e91ULL, 0x152c325eaULL, 0x89788178dULL },
+    { 0x5197af948ULL, 0x58cb9de06ULL, 0x129f5e98aULL, 0x607b9d31aULL },
+    { 0x578f1773bULL, 0x945b9bfd9ULL, 0xdcee8f1eaULL, 0x9bfd9da29ULL },
+    { 0x55c2e0cf0ULL, 0xa8ac18cc7ULL, 0x0f30743aaULL, 0xe33183515ULL },
+    { 0x57f6a4e51ULL, 0xcd8d1aed6ULL, 0x8a7256feaULL, 0x6b758b1b3ULL },
+    { 0x5c055e025ULL, 0xa64b44b01ULL, 0xa407aa03aULL, 0x80d22d265ULL },
+    { 0x5e38cc4d0ULL, 0xeba9048d8ULL, 0x0b2331c7aULL, 0x1b12095d7ULL },
+    { 0x5e65661f5ULL, 0xaf6fc0a55ULL, 0xaf866a67aULL, 0xaa503f6f5ULL },
+    { 0x5aa5eb7b5ULL, 0x37ead6ad5ULL, 0xaded7a55aULL, 0xab56b57ecULL },
+    { 0x5ead51e0dULL, 0xb70a53b9aULL, 0xb078ab57aULL, 0x59dca50edULL },
+    { 0x58b385fc1ULL, 0x5fab9a882ULL, 0x83fa1cd1aULL, 0x41159d5faULL },
+    { 0x5ac5f86e0ULL, 0x2aae16b95ULL, 0x0761fa35aULL, 0xa9d687554ULL },
+    { 0x58f16b600ULL, 0x734e16884ULL, 0x006d68f1aULL, 0x2116872ceULL },
+    { 0x5b30b1208ULL, 0x538803d14ULL, 0x1048d0cdaULL, 0x28bc011caULL },
+    { 0x5f34efe7bULL, 0xffd907ed7ULL, 0xde7f72cfaULL, 0xeb7e09bffULL },
+    { 0x594073669ULL, 0x3e4c03d85ULL, 0x966ce029aULL, 0xa1bc0327cULL },
+    { 0x5d6913ad1ULL, 0x9f6e02d4aULL, 0x8b5c896baULL, 0x52b4076f9ULL },
+    { 0x5952b9e3bULL, 0x569c0fdc7ULL, 0xdc79d4a9aULL, 0xe3bf0396aULL },
+    { 0x5d46f4ac2ULL, 0xaabd0af06ULL, 0x4352f62baULL, 0x60f50bd55ULL },
+    { 0x5f809d2e8ULL, 0x9aa917d11ULL, 0x174b901faULL, 0x88be89559ULL },
+    { 0x5fe0fb50eULL, 0xb3dcd5d94ULL, 0x70adf07faULL, 0x29bab3bcdULL },
+    { 0x5febd3d70ULL, 0xbbce98ddbULL, 0x0ebcbd7faULL, 0xdbb1973ddULL },
+    { 0x646986735ULL, 0x85c7e28c9ULL, 0xace619626ULL, 0x93147e3a1ULL },
+    { 0x60bce8cd8ULL, 0x69a035aceULL, 0x1b3173d06ULL, 0x735ac0596ULL },
+    { 0x649ee3056ULL, 0xf8d078a4cULL, 0x6a0c77926ULL, 0x3251e0b1fULL },
+    { 0x62d4a525dULL, 0x5c8573a54ULL, 0xba4a52b46ULL, 0x2a5cea13aULL },
+    { 0x62f68f8e3ULL, 0x5df53ca13ULL, 0xc71f16f46ULL, 0xc853cafbaULL },
+    { 0x656048247ULL, 0xad1466c00ULL, 0xe241206a6ULL, 0x0036628b5ULL },
+    { 0x63b40c918ULL, 0x4101b5e52ULL, 0x189302dc6ULL, 0x4a7ad8082ULL },
+    { 0x639fe999dULL, 0x74a2fde5eULL, 0xb9997f9c6ULL, 0x7a7bf452eULL },
+    { 0x65ede59c7ULL, 0xbdb7f0e0eULL, 0xe39a7b7a6ULL, 0x7070fedbdULL },
+    { 0x67ebe7704ULL, 0xb1c7fac9cULL, 0x20ee7d7e6ULL, 0x3935fe38dULL },
+    { 0x6a01c89d4ULL, 0x2aa2e4852ULL, 0x2b9138056ULL, 0x4a1274554ULL },
+    { 0x683df20b0ULL, 0x63e220b4dULL, 0x0d04fbc16ULL, 0xb2d0447c6ULL },
+    { 0x6818667ddULL, 0x6e61e38ccULL, 0xbbe661816ULL, 0x331c78676ULL },
+    { 0x6c546150fULL, 0xf614e1a84ULL, 0xf0a862a36ULL, 0x21587286fULL },
+    { 0x684b18f5dULL, 0x0e06ef9caULL, 0xbaf18d216ULL, 0x539f76070ULL },
+    { 0x684f15810ULL, 0x120728b4aULL, 0x081a8f216ULL, 0x52d14e048ULL },
+    { 0x6e6ef4590ULL, 0xa3a5a8bdcULL, 0x09a2f7676ULL, 0x3bd15a5c5ULL },
+    { 0x6e9880265ULL, 0xce8072819ULL, 0xa64011976ULL, 0x9814e0173ULL },
+    { 0x6e9063333ULL, 0xf650b2855ULL, 0xcccc60976ULL, 0xaa14d0a6fULL },
+    { 0x6ef1e40a7ULL, 0xe7b770815ULL, 0xe50278f76ULL, 0xa810eede7ULL },
+    { 0x6cc324fc0ULL, 0x8a27ba886ULL, 0x03f24c336ULL, 0x6115de451ULL },
+    { 0x6900515bfULL, 0x3630e1dc1ULL, 0xfda8a0096ULL, 0x83b870c6cULL },
+    { 0x6b400efacULL, 0x0265e7c93ULL, 0x35f7002d6ULL, 0xc93e7a640ULL },
+    { 0x6b7cb5447ULL, 0x5f9560f9cULL, 0xe22ad3ed6ULL, 0x39f06a9faULL },
+    { 0x69acf5ca2ULL, 0x33b130f8fULL, 0x453af3596ULL, 0xf1f0c8dccULL },
+    { 0x69a766f7cULL, 0x2b43fbec7ULL, 0x3ef66e596ULL, 0xe37dfc2d4ULL },
+    { 0x6deb328cbULL, 0x8f7639d0eULL, 0xd314cd7b6ULL, 0x70b9c6ef1ULL },
+    { 0x7417fc6ecULL, 0xe8ab6fb85ULL, 0x3763fe82eULL, 0xa1df6d517ULL },
+    { 0x7061aab94ULL, 0x01eee6846ULL, 0x29d55860eULL, 0x621677780ULL },
+    { 0x744311521ULL, 0x940ea8981ULL, 0x84a88c22eULL, 0x819157029ULL },
+    { 0x70b9bb8a9ULL, 0x55ea3590fULL, 0x951dd9d0eULL, 0xf09ac57aaULL },
+    { 0x76943ee54ULL, 0xc84976bd6ULL, 0x2a77c296eULL, 0x6bd6e9213ULL },
+    { 0x76bc60129ULL, 0xe508b1a1dULL, 0x948063d6eULL, 0xb858d10a7ULL },
+    { 0x709b07a54ULL, 0x584b7a84aULL, 0x2a5e0d90eULL, 0x5215ed21aULL },
+    { 0x748bbf013ULL, 0x94db3c94cULL, 0xc80fdd12eULL, 0x3293cdb29ULL },
+    { 0x72f85d4fbULL, 0x7d3d359d9ULL, 0xdf2ba1f4eULL, 0x9b9acbcbeULL },
+    { 0x76d3daa7fULL, 0xecde7f953ULL, 0xfe55bcb6eULL, 0xca9fe7b37ULL },
+    { 0x7524d0f99ULL, 0xa5a8a3fc2ULL, 0x99f0b24aeULL, 0x43fc515a5ULL },
+    { 0x753cbc306ULL, 0xc199e6f0cULL, 0x60c3d3caeULL, 0x30f679983ULL },
+    { 0x7703c9d5fULL, 0xbc9aedcd2ULL, 0xfab93c0eeULL, 0x4b3b7593dULL },
+    { 0x71453b2a5ULL, 0x146e66f05ULL, 0xa54dca28eULL, 0xa0f667628ULL },
+    { 0x736c19df1ULL, 0x1d2ca4fdbULL, 0x8fb9836ceULL, 0xdbf2534b8ULL },
+    { 0x7148ee2caULL, 0x28fd27c0cULL, 0x53477128eULL, 0x303e4bf14ULL },
+    { 0x736f227c0ULL, 0x096eaae9cULL, 0x03e44f6ceULL, 0x397557690ULL },
+    { 0x739163aeeULL, 0x787a73c17ULL, 0x775c689ceULL, 0xe83ce5e1eULL },
+    { 0x75839e8e9ULL, 0x8ceb3dd03ULL, 0x97179c1aeULL, 0xc0bbcd731ULL },
+    { 0x77bf647b6ULL, 0xe13bfaeddULL, 0x6de26fdeeULL, 0xbb75fdc87ULL },
+    { 0x73e5bd12aULL, 0x119fb5f15ULL, 0x548bda7ceULL, 0xa8fadf988ULL },
+    { 0x73cf68803ULL, 0x241e3ce1eULL, 0xc0116f3ceULL, 0x7873c7824ULL },
+    { 0x71f74a0a0ULL, 0x616e3ce01ULL, 0x05052ef8eULL, 0x8073c7686ULL },
+    { 0x782dcf276ULL, 0x3bdb66a49ULL, 0x6e4f3b41eULL, 0x92566dbdcULL },
+    { 0x7c023a9d7ULL, 0x8e78ec946ULL, 0xeb95c403eULL, 0x629371e71ULL },
+    { 0x7a5cce3a4ULL, 0x62ede6a19ULL, 0x25c733a5eULL, 0x98567b746ULL },
+    { 0x7a7210077ULL, 0x4f1c68951ULL, 0xee0084e5eULL, 0x8a91638f2ULL },
+    { 0x7eb224d0bULL, 0xc719b9896ULL, 0xd0b244d7eULL, 0x6919d98e3ULL },
+    { 0x78fdc5d52ULL, 0x7b9fb0acaULL, 0x4aba3bf1eULL, 0x5350df9deULL },
+    { 0x7ee8759e9ULL, 0xbf2db191fULL, 0x979ae177eULL, 0xf898db4fdULL },
+    { 0x7b1c2b44eULL, 0x5a5865e9cULL, 0x722d438deULL, 0x397a61a5aULL },
+    { 0x7f04a0fa2ULL, 0x82b8a2e97ULL, 0x45f0520feULL, 0xe97451d41ULL },
+    { 0x7b274eeb3ULL, 0x277b2eed3ULL, 0xcd772e4deULL, 0xcb774dee4ULL },
+    { 0x7d267f7a1ULL, 0xb769aef85ULL, 0x85efe64beULL, 0xa1f7596edULL },
+    { 0x7f32a95eaULL, 0xdbb8adc95ULL, 0x57a954cfeULL, 0xa93b51ddbULL },
+    { 0x79b4aaaa7ULL, 0x47f876e07ULL, 0xe55552d9eULL, 0xe076e1fe2ULL },
+    { 0x7db0d7253ULL, 0xffd932d40ULL, 0xca4eb0dbeULL, 0x02b4c9bffULL },
+    { 0x7f934f0c2ULL, 0xfa7b3cc10ULL, 0x430f2c9feULL, 0x0833cde5fULL },
+    { 0x7dfc10422ULL, 0xc31c30f89ULL, 0x442083fbeULL, 0x91f0c38c3ULL },
+    { 0x7dd5d8d3fULL, 0xe69ef5fc3ULL, 0xfcb1babbeULL, 0xc3faf7967ULL },
+    { 0x80382067bULL, 0x4d10030edULL, 0xde6041c01ULL, 0xb70c008b2ULL },
+    { 0x8411b9d63ULL, 0xdc92841a7ULL, 0xc6b9d8821ULL, 0xe5821493bULL },
+    { 0x8003fc64aULL, 0x28930f1a4ULL, 0x5263fc001ULL, 0x258f0c914ULL },
+    { 0x823b0fbbaULL, 0x51738f07bULL, 0x5ddf0dc41ULL, 0xde0f1ce8aULL },
+    { 0x862aa775aULL, 0x99d18b0fcULL, 0x5aee55461ULL, 0x3f0d18b99ULL },
+    { 0x841b594b7ULL, 0xf4324c1e9ULL, 0xed29ad821ULL, 0x978324c2fULL },
+    { 0x824431c8aULL, 0x1034013b6ULL, 0x5138c2241ULL, 0x6dc802c08ULL },
+    { 0x8259d8753ULL, 0x6c96861f8ULL, 0xcae1b9a41ULL, 0x1f8616936ULL },
+    { 0x84481fdceULL, 0x9875c51aaULL, 0x73bf81221ULL, 0x558a3ae19ULL },
+    { 0x82b5e56b4ULL, 0x71a3522f5ULL, 0x2d6a7ad41ULL, 0xaf44ac58eULL },
+    { 0x80b70ab70ULL, 0x49429e263ULL, 0x0ed50ed01ULL, 0xc64794292ULL },
+    { 0x86b25019aULL, 0xe13099170ULL, 0x5980a4d61ULL, 0x0e8990c87ULL },
+    { 0x80cc2f7b8ULL, 0x1065972edULL, 0x1def43301ULL, 0xb74e9a608ULL },
+    { 0x86fdb6648ULL, 0xc9c7133bcULL, 0x1266dbf61ULL, 0x3dcc8e393ULL },
+    { 0x81793c3e9ULL, 0x4d278752dULL, 0x97c3c9e81ULL, 0xb4ae1e4b2ULL },
+    { 0x85608485bULL, 0x8d9501462ULL, 0xda12106a1ULL, 0x46280a9b1ULL },
+    { 0x836216925ULL, 0x0545c8533ULL, 0xa496846c1ULL, 0xcca13a2a0ULL },
+    { 0x8380e5ddfULL, 0x3cb1d14f6ULL, 0xfbba701c1ULL, 0x6f28b8d3cULL },
+    { 0x87a04ccb2ULL, 0xa131144f3ULL, 0x4d33205e1ULL, 0xcf2288c85ULL },
+    { 0x87b88ab4dULL, 0xcdc0d743aULL, 0xb2d511de1ULL, 0x5c2eb03b3ULL },
+    { 0x8e0206384ULL, 0x8261ca030ULL, 0x21c604071ULL, 0x0c0538641ULL },
+    { 0x8c367dac7ULL, 0xff314e326ULL, 0xe35be6c31ULL, 0x64c728cffULL },
+    { 0x8c41e92c2ULL, 0xbab606024ULL, 0x434978231ULL, 0x240606d5dULL },
+    { 0x8c983bafcULL, 0xda605716fULL, 0x3f5dc1931ULL, 0xf68ea065bULL },
+    { 0x88f46b4fbULL, 0x7f74152e5ULL, 0xdf2d62f11ULL, 0xa74a82efeULL },
+    { 0x8f2cc5cc4ULL, 0xbba1406baULL, 0x233a334f1ULL, 0x5d60285ddULL },
+    { 0x8d377e733ULL, 0xe7538e7e5ULL, 0xcce7eecb1ULL, 0xa7e71cae7ULL },
+    { 0x8b454f3f7ULL, 0x3e77c6671ULL, 0xefcf2a2d1ULL, 0x8e663ee7cULL },
+    { 0x8d5625960ULL, 0xda0588627ULL, 0x069a46ab1ULL, 0xe4611a05bULL },
+    { 0x8bbf18392ULL, 0x43329e778ULL, 0x49c18fdd1ULL, 0x1ee794cc2ULL },
+    { 0x8da643094ULL, 0xb36058660ULL, 0x290c265b1ULL, 0x0661a06cdULL },
+    { 0x8dd0caa68ULL, 0xeac417423ULL, 0x165530bb1ULL, 0xc42e82357ULL },
+    { 0x8bf6984f4ULL, 0x4ba45c7f1ULL, 0x2f2196fd1ULL, 0x8fe3a25d2ULL },
+    { 0x901299a54ULL, 0x58884e162ULL, 0x2a5994809ULL, 0x46872111aULL },
+    { 0x962e04875ULL, 0x8d094827bULL, 0xae1207469ULL, 0xde41290b1ULL },
+    { 0x925ca3d40ULL, 0x58cc802beULL, 0x02bc53a49ULL, 0x7d401331aULL },
+    { 0x92858f77aULL, 0x18db972f1ULL, 0x5eef1a149ULL, 0x8f4e9db18ULL },
+    { 0x94a93d45aULL, 0x991b151ecULL, 0x5a2bc9529ULL, 0x378a8d899ULL },
+    { 0x9120f3332ULL, 0x31d882565ULL, 0x4cccf0489ULL, 0xa6a411b8cULL },
+    { 0x91276d4f3ULL, 0x3d3b0c6e5ULL, 0xcf2b6e489ULL, 0xa7630dcbcULL },
+    { 0x9733fde9aULL, 0xf1bb0f5f6ULL, 0x597bfcce9ULL, 0x6faf0dd8fULL },
+    { 0x9748f3813ULL, 0xb4dc0057eULL, 0xc81cf12e9ULL, 0x7ea003b2dULL },
+    { 0x979fa0069ULL, 0xcc8a1963dULL, 0x96005f9e9ULL, 0xbc6985133ULL },
+    { 0x93d03fd7cULL, 0x584dd55f7ULL, 0x3ebfc0bc9ULL, 0xefaabb21aULL },
+    { 0x95fcd06e0ULL, 0xe9ac127a9ULL, 0x0760b3fa9ULL, 0x95e483597ULL },
+    { 0x93c3b20b1ULL, 0x04ee18575ULL, 0x8d04dc3c9ULL, 0xaea187720ULL },
+    { 0x91c34201eULL, 0x205e59460ULL, 0x78042c389ULL, 0x0629a7a04ULL },
+    { 0x9e0ad4d09ULL, 0xa689891baULL, 0x90b2b5079ULL, 0x5d8919165ULL },
+    { 0x9e3e18468ULL, 0xcb080d3b9ULL, 0x162187c79ULL, 0x9dcb010d3ULL },
+    { 0x9a617adc9ULL, 0x2f6e851b6ULL, 0x93b5e8659ULL, 0x6d8a176f4ULL },
+    { 0x98c88765dULL, 0x1ecd530e8ULL, 0xba6e11319ULL, 0x170cab378ULL },
+    { 0x98c1df309ULL, 0x36cf97120ULL, 0x90cfb8319ULL, 0x048e9f36cULL },
+    { 0x9ef928facULL, 0xc32ed70bfULL, 0x35f149f79ULL, 0xfd0eb74c3ULL },
+    { 0x9ef0ab161ULL, 0xdfcc94035ULL, 0x868d50f79ULL, 0xac02933fbULL },
+    { 0x98fb7509dULL, 0x772f5916cULL, 0xb90aedf19ULL, 0x3689af4eeULL },
+    { 0x9f2001354ULL, 0x9b08c2470ULL, 0x2ac8004f9ULL, 0x0e24310d9ULL },
+    { 0x99127807cULL, 0x6a084d565ULL, 0x3e01e4899ULL, 0xa6ab21056ULL },
+    { 0x9b83f57ebULL, 0x3ebb9b5b5ULL, 0xd7eafc1d9ULL, 0xadad9dd7cULL },
+    { 0x99f9c8ad5ULL, 0x6fae5646aULL, 0xab5139f99ULL, 0x5626a75f6ULL },
+    { 0x9de42eec2ULL, 0x8b7d166a6ULL, 0x4377427b9ULL, 0x65668bed1ULL },
+    { 0x9bdb90d23ULL, 0x469e985bbULL, 0xc4b09dbd9ULL, 0xdda197962ULL },
+    { 0x9ffe8499fULL, 0xc7bdd967aULL, 0xf99217ff9ULL, 0x5e69bbde3ULL },
+    { 0xa2428cd79ULL, 0x0c85ad0f3ULL, 0x9eb314245ULL, 0xcf0b5a130ULL },
+    { 0xa4cd19357ULL, 0x9c16f6368ULL, 0xeac98b325ULL, 0x16c6f6839ULL },
+    { 0xa6d5a2190ULL, 0xc0e6b0274ULL, 0x09845ab65ULL, 0x2e40d6703ULL },
+    { 0xa0dfc0b06ULL, 0x6096fa22aULL, 0x60d03fb05ULL, 0x5445f6906ULL },
+    { 0xa331b4904ULL, 0x4183e0536ULL, 0x2092d8cc5ULL, 0x6ca07c182ULL },
+    { 0xa720863afULL, 0x85f1e3431ULL, 0xf5c6104e5ULL, 0x8c2c78fa1ULL },
+    { 0xa7382d28dULL, 0xd5216743cULL, 0xb14b41ce5ULL, 0x3c2e684abULL },
+    { 0xa33fccdceULL, 0x69b3ed6baULL, 0x73b33fcc5ULL, 0x5d6b7cd96ULL },
+    { 0xa53eb384bULL, 0xddd02972eULL, 0xd21cd7ca5ULL, 0x74e940bbbULL },
+    { 0xa1701abd7ULL, 0x4d74e6562ULL, 0xebd580e85ULL, 0x46a672eb2ULL },
+    { 0xa76765379ULL, 0xbd07ab675ULL, 0x9eca6e6e5ULL, 0xae6d5e0bdULL },
+    { 0xa57b66ae4ULL, 0xe9676a42fULL, 0x27566dea5ULL, 0xf4256e697ULL },
+    { 0xa1d51d932ULL, 0x5017b4763ULL, 0x4c9b8ab85ULL, 0xc6e2de80aULL },
+    { 0xa3f8e99beULL, 0x71b4f547fULL, 0x7d9971fc5ULL, 0xfe2af2d8eULL },
+    { 0xa5d383da3ULL, 0xd4f6b84a3ULL, 0xc5bc1cba5ULL, 0xc521d6f2bULL },
+    { 0xa5d6ebbc6ULL, 0xf8f4fe626ULL, 0x63dd76ba5ULL, 0x6467f2f1fULL },
+    { 0xaa26e3979ULL, 0x3fc0a9277ULL, 0x9e9c76455ULL, 0xee49503fcULL },
+    { 0xae1ec93fcULL, 0xfaa0ef279ULL, 0x3fc937875ULL, 0x9e4f7055fULL },
+    { 0xac77b8ed2ULL, 0xcbb62e3e6ULL, 0x4b71dee35ULL, 0x67c746dd3ULL },
+    { 0xaaa9ee4dfULL, 0x2ff3750fcULL, 0xfb2779555ULL, 0x3f0aecff4ULL },
+    { 0xaa8079aa6ULL, 0x323076137ULL, 0x6559e0155ULL, 0xec86e0c4cULL },
+    { 0xaec260ca1ULL, 0xa624380b7ULL, 0x853064375ULL, 0xed01c2465ULL },
+    { 0xa93a9862bULL, 0x47902f5a9ULL, 0xd46195c95ULL, 0x95af409e2ULL },
+    { 0xab1251c8cULL, 0x7220695b2ULL, 0x3138a48d5ULL, 0x4da96044eULL },
+    { 0xad66dbd8dULL, 0xb7e4ed7a2ULL, 0xb1bdb66b5ULL, 0x45eb727edULL },
+    { 0xad52dd4a1ULL, 0xf6a52c5a1ULL, 0x852bb4ab5ULL, 0x85a34a56fULL },
+    { 0xa9b671108ULL, 0x7300b9724ULL, 0x1088e6d95ULL, 0x24e9d00ceULL },
+    { 0xadbae2350ULL, 0xebc0ba46cULL, 0x0ac475db5ULL, 0x3625d03d7ULL },
+    { 0xad9741dfcULL, 0xfa22f96e3ULL, 0x3fb82e9b5ULL, 0xc769f445fULL },
+    { 0xabf3b62c7ULL, 0x4ff77a534ULL, 0xe346dcfd5ULL, 0x2ca5eeff2ULL },
+    { 0xb6226c71cULL, 0xa109ef0f4ULL, 0x38e36446dULL, 0x2f0f79085ULL },
+    { 0xb41e257a7ULL, 0xd439ea2adULL, 0xe5ea4782dULL, 0xb54579c2bULL },
+    { 0xb637c38a3ULL, 0xf5fa28233ULL, 0xc51c3ec6dULL, 0xcc4145fafULL },
+    { 0xb04cd4370ULL, 0x288da2369ULL, 0x0ec2b320dULL, 0x96c45b114ULL },
+    { 0xb27f8b053ULL, 0x5dde2c278ULL, 0xca0d1fe4dULL, 0x1e4347bbaULL },
+    { 0xb0add8225ULL, 0x258a76329ULL, 0xa441bb50dULL, 0x94c6e51a4ULL },
+    { 0xb49b822bbULL, 0xc4fa3b069ULL, 0xdd441d92dULL, 0x960dc5f23ULL },
+    { 0xb0d34ec23ULL, 0x645f3c0a3ULL, 0xc4372cb0dULL, 0xc503cfa26ULL },
+    { 0xb13d7ec3eULL, 0x615b657efULL, 0x7c37ebc8dULL, 0xf7ea6da86ULL },
+    { 0xb106a463eULL, 0x00996b6e5ULL, 0x7c625608dULL, 0xa76d69900ULL },
+    { 0xb32b743feULL, 0x293beb57dULL, 0x7fc2ed4cdULL, 0xbead7dc94ULL },
+    { 0xb71fd646fULL, 0xecdb697b9ULL, 0xf626bf8edULL, 0x9de96db37ULL },
+    { 0xb16ef1f45ULL, 0x3d8cea7aeULL, 0xa2f8f768dULL, 0x75e5731bcULL },
+    { 0xb17e538aeULL, 0x717c6972bULL, 0x751ca7e8dULL, 0xd4e963e8eULL },
+    { 0xb762df377ULL, 0xbdddee571ULL, 0xeecfb46edULL, 0x8ea77bbbdULL },
+    { 0xb1a9f8949ULL, 0x2d8ab552eULL, 0x9291f958dULL, 0x74aad51b4ULL },
+    { 0xb3b7d9d24ULL, 0x718afc7b3ULL, 0x24b9bedcdULL, 0xcde3f518eULL },
+    { 0xb3eebb4c6ULL, 0x19fc7c7bcULL, 0x632dd77cdULL, 0x3de3e3f98ULL },
+    { 0xb82ca5524ULL, 0x1389e02adULL, 0x24aa5341dULL, 0xb540791c8ULL },
+    { 0xb8140debfULL, 0x5639672e3ULL, 0xfd7b0281dULL, 0xc74e69c6aULL },
+    { 0xbc19dcc77ULL, 0xee9b641ebULL, 0xee33b983dULL, 0xd7826d977ULL },
+    { 0xbc5426b96ULL, 0xc27de2266ULL, 0x69d642a3dULL, 0x66447be43ULL },
+    { 0xbe6737c45ULL, 0x9f4f683b6ULL, 0xa23ece67dULL, 0x6dc16f2f9ULL },
+    { 0xb8fae8d35ULL, 0x678cfc0efULL, 0xacb175f1dULL, 0xf703f31e6ULL },
+    { 0xbec21a378ULL, 0x8a4cbf171ULL, 0x1ec58437dULL, 0x8e8fd3251ULL },
+    { 0xbb18cfa4bULL, 0x7ed92743aULL, 0xd25f318ddULL, 0x5c2e49b7eULL },
+    { 0xbd017ef6dULL, 0xae4be75a7ULL, 0xb6f7e80bdULL, 0xe5ae7d275ULL },
+    { 0xbd222fd27ULL, 0x9759ec4a7ULL, 0xe4bf444bdULL, 0xe52379ae9ULL },
+    { 0xbd0255855ULL, 0xbe0968562ULL, 0xaa1aa40bdULL, 0x46a16907dULL },
+    { 0xb9724e605ULL, 0x674d6e4a0ULL, 0xa06724e9dULL, 0x05276b2e6ULL },
+    { 0xbd775c16fULL, 0xef1fed721ULL, 0xf683aeebdULL, 0x84eb7f8f7ULL },
+    { 0xb988ac2e1ULL, 0x0ea93642dULL, 0x87435119dULL, 0xb426c9570ULL },
+    { 0xbfa026675ULL, 0x8f49724f5ULL, 0xae66405fdULL, 0xaf24e92f1ULL },
+    { 0xb98296a86ULL, 0x02f97a522ULL, 0x61569419dULL, 0x44a5e9f40ULL },
+    { 0xbd871718aULL, 0x927bb9720ULL, 0x518e8e1bdULL, 0x04e9dde49ULL },
+    { 0xbfbeef2d7ULL, 0xfff97e67cULL, 0xeb4f77dfdULL, 0x3e67e9fffULL },
+    { 0xbdfa9f007ULL, 0xd7dd7c528ULL, 0xe00f95fbdULL, 0x14a3ebbebULL },
+    { 0xc27035bb8ULL, 0x512583977ULL, 0x1ddac0e43ULL, 0xee9c1a48aULL },
+    { 0xc46c05acdULL, 0x9d2543a2aULL, 0xb35a03623ULL, 0x545c2a4b9ULL },
+    { 0xc47954dc3ULL, 0xed37809aaULL, 0xc3b2a9e23ULL, 0x55901ecb7ULL },
+    { 0xc26a510d8ULL, 0x392409978ULL, 0x1b08a5643ULL, 0x1e990249cULL },
+    { 0xc6a49f684ULL, 0x91e156bb0ULL, 0x216f92563ULL, 0x0dd6a8789ULL },
+    { 0xc09e2ceb4ULL, 0x40215eaefULL, 0x2d7347903ULL, 0xf757a8402ULL },
+    { 0xc6922149dULL, 0xd420598f4ULL, 0xb92844963ULL, 0x2f19a042bULL },
+    { 0xc4ba83cf8ULL, 0xd9e0198ebULL, 0x1f3c15d23ULL, 0xd7198079bULL },
+    { 0xc6e78543bULL, 0x959719af1ULL, 0xdc2a1e763ULL, 0x8f598e9a9ULL },
+    { 0xc6d7af464ULL, 0xd8c75cab5ULL, 0x262f5eb63ULL, 0xad53ae31bULL },
+    { 0xc536554dbULL, 0xfd3109fe0ULL, 0xdb2aa6ca3ULL, 0x07f908cbfULL },
+    { 0xc393ff0d7ULL, 0x7cf35cd74ULL, 0xeb0ffc9c3ULL, 0x2eb3acf3eULL },
+    { 0xc1f570a5aULL, 0x691613f66ULL, 0x5a50eaf83ULL, 0x66fc86896ULL },
+    { 0xcc3971c50ULL, 0xfb02009eeULL, 0x0a38e9c33ULL, 0x7790040dfULL },
+    { 0xc80289492ULL, 0x12b00c8e0ULL, 0x492914013ULL, 0x071300d48ULL },
+    { 0xc87c644a5ULL, 0x672540aadULL, 0xa52263e13ULL, 0xb5502a4e6ULL },
+    { 0xca67e10d7ULL, 0x3fb648a74ULL, 0xeb087e653ULL, 0x2e5126dfcULL },
+    { 0xc899e7422ULL, 0x72d3108adULL, 0x442e79913ULL, 0xb5108cb4eULL },
+    { 0xc8aab2105ULL, 0x07c0d892cULL, 0xa084d5513ULL, 0x3491b03e0ULL },
+    { 0xcca6d59f3ULL, 0xbfb198b63ULL, 0xcf9ab6533ULL, 0xc6d198dfdULL },
+    { 0xcae586fbeULL, 0x03f7d3af3ULL, 0x7df61a753ULL, 0xcf5cbefc0ULL },
+    { 0xcad97c31fULL, 0x6617d797cULL, 0xf8c3e9b53ULL, 0x3e9ebe866ULL },
+    { 0xcee4ca0e6ULL, 0xabf454a31ULL, 0x670532773ULL, 0x8c52a2fd5ULL },
+    { 0xcb2da432cULL, 0x0383c3e3dULL, 0x34c25b4d3ULL, 0xbc7c3c1c0ULL },
+    { 0xcb57d6822ULL, 0x62d708f33ULL, 0x4416bead3ULL, 0xccf10eb46ULL },
+    { 0xc99021b10ULL, 0x520092c66ULL, 0x08d840993ULL, 0x66349004aULL },
+    { 0xc9825fb0aULL, 0x32519fd22ULL, 0x50dfa4193ULL, 0x44bf98a4cULL },
+    { 0xcb9ed4247ULL, 0x6e915af38ULL, 0xe242b79d3ULL, 0x1cf5a8976ULL },
+    { 0xcd86ab9ddULL, 0x9ee0dde66ULL, 0xbb9d561b3ULL, 0x667bb0779ULL },
+    { 0xc9c9b0775ULL, 0x0e86d2dedULL, 0xaee0d9393ULL, 0xb7b4b6170ULL },
+    { 0xc9fa1f632ULL, 0x53551ede9ULL, 0x4c6f85f93ULL, 0x97b78aacaULL },
+    { 0xcbf740069ULL, 0x6f0619e31ULL, 0x96002efd3ULL, 0x8c79860f6ULL },
+    { 0xcdda0d1cfULL, 0xde35ddc28ULL, 0xf38b05bb3ULL, 0x143bbac7bULL },
+    { 0xd00b8253fULL, 0x04dac98e9ULL, 0xfca41d00bULL, 0x971935b20ULL },
+    { 0xd43bcfd6fULL, 0xfddbcd8abULL, 0xf6bf3dc2bULL, 0xd51b3dbbfULL },
+    { 0xd662abd1bULL, 0x95dc8d8f6ULL, 0xd8bd5466bULL, 0x6f1b13ba9ULL },
+    { 0xd466c83afULL, 0xa5bccfa21ULL, 0xf5c13662bULL, 0x845f33da5ULL },
+    { 0xd1201c78aULL, 0x013987da0ULL, 0x51e38048bULL, 0x05be19c80ULL },
+    { 0xd33941c39ULL, 0x750a01cfbULL, 0x9c3829ccbULL, 0xdf38050aeULL },
+    { 0xd107a0fd4ULL, 0x08aacaee6ULL, 0x2bf05e08bULL, 0x677535510ULL },
+    { 0xd1953a0e2ULL, 0x487a14f25ULL, 0x4705ca98bULL, 0xa4f285e12ULL },
+    { 0xd7bd421ddULL, 0xed6ad1e78ULL, 0xbb842bdebULL, 0x1e78b56b7ULL },
+    { 0xd7c0a650dULL, 0x84cdd1cb4ULL, 0xb0a6503ebULL, 0x2d38bb321ULL },
+    { 0xd7e58df5cULL, 0x998fd7ef2ULL, 0x3afb1a7ebULL, 0x4f7ebf199ULL },
+    { 0xd7c553f67ULL, 0xbc5ed2fb3ULL, 0xe6fcaa3ebULL, 0xcdf4b7a3dULL },
+    { 0xd5fe70b88ULL, 0xe12c9bf2eULL, 0x11d0e7fabULL, 0x74fd93487ULL },
+    { 0xd80cb9be6ULL, 0x1ab8c6b2fULL, 0x67d9d301bULL, 0xf4d631d58ULL },
+    { 0xde34ba256ULL, 0xcbd846b74ULL, 0x6a45d2c7bULL, 0x2ed621bd3ULL },
+    { 0xdc0ec68beULL, 0xa2f949a6bULL, 0x7d163703bULL, 0xd65929f45ULL },
+    { 0xde03f7a4bULL, 0xbedb0b936ULL, 0xd25efc07bULL, 0x6c9d0db7dULL },
+    { 0xda5d0b8a2ULL, 0x527e04a3bULL, 0x451d0ba5bULL, 0xdc5207e4aULL },
+    { 0xd871f97ffULL, 0x7fbec79e5ULL, 0xffe9f8e1bULL, 0xa79e37dfeULL },
+    { 0xdcbd82e72ULL, 0xcbda12aebULL, 0x4e741bd3bULL, 0xd75485bd3ULL },
+    { 0xdcb05ae55ULL, 0xef48569e2ULL, 0xaa75a0d3bULL, 0x4796a12f7ULL },
+    { 0xda93de500ULL, 0x62cb9c9b0ULL, 0x00a7bc95bULL, 0x0d939d346ULL },
+    { 0xdab7f1bf8ULL, 0x7baa9bb77ULL, 0x1fd8fed5bULL, 0xeedd955deULL },
+    { 0xde9f0232eULL, 0xc25adba39ULL, 0x74c40f97bULL, 0x9c5db5a43ULL },
+    { 0xdac40d550ULL, 0x1a0d94af0ULL, 0x0aab0235bULL, 0x0f529b058ULL },
+    { 0xdcc5ab80eULL, 0x92de55a26ULL, 0x701d5a33bULL, 0x645aa7b49ULL },
+    { 0xdac2b23aaULL, 0x02fc9b935ULL, 0x55c4d435bULL, 0xac9d93f40ULL },
+    { 0xdada58fd0ULL, 0x6a2c9e9faULL, 0x0bf1a5b5bULL, 0x5f9793456ULL },
+    { 0xd9258ea81ULL, 0x07eb06e22ULL, 0x81571a49bULL, 0x44760d7e0ULL },
+    { 0xdd05763beULL, 0xa27bc3f65ULL, 0x7dc6ea0bbULL, 0xa6fc3de45ULL },
+    { 0xdd2e9908cULL, 0x93a84df28ULL, 0x3109974bbULL, 0x14fb215c9ULL },
+    { 0xd95568c75ULL, 0x6e0e44ee7ULL, 0xae316aa9bULL, 0xe77227076ULL },
+    { 0xdb506d4c3ULL, 0x7e3d04cb4ULL, 0xc32b60adbULL, 0x2d320bc7eULL },
+    { 0xdf68aa388ULL, 0x83ec87c3cULL, 0x11c5516fbULL, 0x3c3e137c1ULL },
+    { 0xdb4287a75ULL, 0x1ecd4ac73ULL, 0xae5e142dbULL, 0xce352b378ULL },
+    { 0xdb8128b3dULL, 0x060ad7c77ULL, 0xbcd1481dbULL, 0xee3eb5060ULL },
+    { 0xd9a3c2fadULL, 0x27eadbca3ULL, 0xb5f43c59bULL, 0xc53db57e4ULL },
+    { 0xddb338d38ULL, 0xc30a9dde7ULL, 0x1cb1ccdbbULL, 0xe7bb950c3ULL },
+    { 0xd9ca7b9b1ULL, 0x366c9cd6fULL, 0x8d9de539bULL, 0xf6b39366cULL },
+    { 0xdbf69eb07ULL, 0x47dddef32ULL, 0xe0d796fdbULL, 0x4cf7bbbe2ULL },
+    { 0xe2086caf8ULL, 0x28212787fULL, 0x1f5361047ULL, 0xfe1e48414ULL },
+    { 0xe01bab964ULL, 0x58c2ec82fULL, 0x269d5d807ULL, 0xf4137431aULL },
+    { 0xe04873f30ULL, 0x3044a29efULL, 0x0cfce1207ULL, 0xf7945220cULL },
+    { 0xe475a95beULL, 0xd1b6e5ae5ULL, 0x7da95ae27ULL, 0xa75a76d8bULL },
+    { 0xe680ec749ULL, 0xac81b78b4ULL, 0x92e370167ULL, 0x2d1ed8135ULL },
+    { 0xe2af76487ULL, 0x257378bbcULL, 0xe126ef547ULL, 0x3dd1ecea4ULL },
+    { 0xe0a2c811dULL, 0x2580fd860ULL, 0xb88134507ULL, 0x061bf01a4ULL },
+    { 0xe2cb7150cULL, 0x3006f99bcULL, 0x30a8ed347ULL, 0x3d99f600cULL },
+    { 0xe0d249c5fULL, 0x7c147d8e2ULL, 0xfa3924b07ULL, 0x471be283eULL },
+    { 0xe10cc2829ULL, 0x24c021e2bULL, 0x941433087ULL, 0xd47840324ULL },
+    { 0xe17f44343ULL, 0x6d17aae28ULL, 0xc2c22fe87ULL, 0x14755e8b6ULL },
+    { 0xe7ad45b1eULL, 0xb113f3e7aULL, 0x78da2b5e7ULL, 0x5e7cfc88dULL },
+    { 0xe1b65a9f9ULL, 0x6d60bdf63ULL, 0x9f95a6d87ULL, 0xc6fbd06b6ULL },
+    { 0xe7fc2041cULL, 0xc10471efcULL, 0x382043fe7ULL, 0x3f78e2083ULL },
+    { 0xee3341381ULL, 0xf722aa830ULL, 0x81c82cc77ULL, 0x0c15544efULL },
+    { 0xee7c36334ULL, 0xc345e2b7dULL, 0x2cc6c3e77ULL, 0xbed47a2c3ULL },
+    { 0xec707bf8aULL, 0xf374a79a6ULL, 0x51fde0e37ULL, 0x659e52ecfULL },
+    { 0xe87b3be6eULL, 0x5b566f9afULL, 0x767dcde17ULL, 0xf59f66adaULL },
+    { 0xe895e8391ULL, 0x66a2b6a64ULL, 0x89c17a917ULL, 0x2656d4566ULL },
+    { 0xeeac097d5ULL, 0x9f20f6af8ULL, 0xabe903577ULL, 0x1f56f04f9ULL },
+    { 0xeca1c9374ULL, 0xbb82f6861ULL, 0x2ec938537ULL, 0x8616f41ddULL },
+    { 0xe897bdc55ULL, 0x5e837cbe6ULL, 0xaa3bde917ULL, 0x67d3ec17aULL },
+    { 0xe8cc121d0ULL, 0x0a64b0b68ULL, 0x0b8483317ULL, 0x16d0d2650ULL },
+    { 0xeec11d698ULL, 0x9227379f0ULL, 0x196b88377ULL, 0x0f9ece449ULL },
+    { 0xed07ffdbaULL, 0xb2f3adfe7ULL, 0x5dbffe0b7ULL, 0xe7fb5cf4dULL },
+    { 0xed69f336bULL, 0xbfd6a3d2dULL, 0xd6ccf96b7ULL, 0xb4bc56bfdULL },
+    { 0xed7614b5cULL, 0xcb05ebf62ULL, 0x3ad286eb7ULL, 0x46fd7a0d3ULL },
+    { 0xef8421d17ULL, 0x9610f0ef6ULL, 0xe8b8421f7ULL, 0x6f70f0869ULL },
+    { 0xebf5da782ULL, 0x63f6b6fb0ULL, 0x41e5bafd7ULL, 0x0df6d6fc6ULL },
+    { 0xe9f9e5d6dULL, 0x7f87f1cafULL, 0xb6ba79f97ULL, 0xf538fe1feULL },
+    { 0xebd30f919ULL, 0x5647bdc72ULL, 0x989f0cbd7ULL, 0x4e3bde26aULL },
+    { 0xe9dbf1209ULL, 0x76863bd2cULL, 0x9048fdb97ULL, 0x34bdc616eULL },
+    { 0xf4298b6d8ULL, 0x99ea278e8ULL, 0x1b6d1942fULL, 0x171e45799ULL },
+    { 0xf60a34225ULL, 0x84096a93dULL, 0xa442c506fULL, 0xbc9569021ULL },
+    { 0xf458559b1ULL, 0xf42da096bULL, 0x8d9aa1a2fULL, 0xd6905b42fULL },
+    { 0xf27637613ULL, 0x555d2abf4ULL, 0xc86ec6e4fULL, 0x2fd54baaaULL },
+    { 0xf44b0ae06ULL, 0x805e6e8aaULL, 0x60750d22fULL, 0x551767a01ULL },
+    { 0xf66e814bcULL, 0x91ac69af9ULL, 0x3d281766fULL, 0x9f5963589ULL },
+    { 0xf6431d4c6ULL, 0x983f6c9b0ULL, 0x632b8c26fULL, 0x0d936fc19ULL },
+    { 0xf45722ee1ULL, 0xcc6e2aaa7ULL, 0x87744ea2fULL, 0xe55547633ULL },
+    { 0xf49953e5bULL, 0xfc5a339eaULL, 0xda7ca992fULL, 0x579cc5a3fULL },
+    { 0xf0fc2f1b5ULL, 0x556df4a6dULL, 0xad8f43f0fULL, 0xb652fb6aaULL },
+    { 0xf7091e09cULL, 0x806b65d78ULL, 0x3907890efULL, 0x1eba6d601ULL },
+    { 0xf72657c20ULL, 0xb14928fb3ULL, 0x043ea64efULL, 0xcdf14928dULL },
+    { 0xf1851bc6dULL, 0x1c4a75fa3ULL, 0xb63d8a18fULL, 0xc5fae5238ULL },
+    { 0xf38862e81ULL, 0x246832cbeULL, 0x8174611cfULL, 0x7d34c1624ULL },
+    { 0xf7a9b7ea6ULL, 0x91fb72dbfULL, 0x657ed95efULL, 0xfdb4edf89ULL },
+    { 0xf78a8a5c2ULL, 0x88f8bccb8ULL, 0x43a5151efULL, 0x1d33d1f11ULL },
+    { 0xf3edc2152ULL, 0x29deb0e78ULL, 0x4a843b7cfULL, 0x1e70d7b94ULL },
+    { 0xf5f594f24ULL, 0xc18ff2fa3ULL, 0x24f29afafULL, 0xc5f4ff183ULL },
+    { 0xf80f3e0f4ULL, 0x0a6b6cb6dULL, 0x2f07cf01fULL, 0xb6d36d650ULL },
+    { 0xfcbe637deULL, 0xfb78fbaecULL, 0x7bec67d3fULL, 0x375df1edfULL },
+    { 0xf8ed2149bULL, 0x173e31aecULL, 0xd9284b71fULL, 0x3758c7ce8ULL },
+    { 0xfad8c280eULL, 0x62dc7183aULL, 0x701431b5fULL, 0x5c18e3b46ULL },
+    { 0xfee5059c6ULL, 0x9b3ff0a32ULL, 0x639a0a77fULL, 0x4c50ffcd9ULL },
+    { 0xfec4fd1b8ULL, 0xb2adb5b75ULL, 0x1d8bf237fULL, 0xaedadb54dULL },
+    { 0xfad2e11f4ULL, 0x7aacf8875ULL, 0x2f8874b5fULL, 0xae11f355eULL },
+    { 0xfcc3e6732ULL, 0xa2dfba8e5ULL, 0x4ce67c33fULL, 0xa715dfb45ULL },
+    { 0xf93fa26ebULL, 0x4ffa2beadULL, 0xd7645fc9fULL, 0xb57d45ff2ULL },
+    { 0xfb56c25e3ULL, 0x6efca8eb1ULL, 0xc7a436adfULL, 0x8d7153f76ULL },
+    { 0xff4e8ca2fULL, 0x869d6fe3bULL, 0xf453172ffULL, 0xdc7f6b961ULL },
+    { 0xff4f70e24ULL, 0xa20e6afbfULL, 0x2470ef2ffULL, 0xfdf567045ULL },
+    { 0xf9b12a349ULL, 0x4f4ab7c24ULL, 0x92c548d9fULL, 0x243ed52f2ULL },
+    { 0xff8792781ULL, 0x86eabafb0ULL, 0x81e49e1ffULL, 0x0df5d5761ULL },
+    { 0xf9c3bc09aULL, 0x02bf3dd64ULL, 0x5903dc39fULL, 0x26bbcfd40ULL },
+    { 0xffca19d1cULL, 0x920cfddfaULL, 0x38b9853ffULL, 0x5fbbf3049ULL },
+    { 0xffef17a5aULL, 0x9b5f3bf7aULL, 0x5a5e8f7ffULL, 0x5efdcfad9ULL },
+    { 0xfdfeda8c1ULL, 0xefec3cf2aULL, 0x8315b7fbfULL, 0x54f3c37f7ULL },
+    { 0x0642e9097ULL, 0xb4b44c054ULL, 0xe90974260ULL, 0x2a0322d2dULL },
+    { 0x03242446dULL, 0x0d0141695ULL, 0xb622424c0ULL, 0xa968280b0ULL },
+    { 0x075e5c87cULL, 0xe8054d75bULL, 0x3e13a7ae0ULL, 0xdaeb2a017ULL },
+    { 0x078842fa6ULL, 0xa070d249bULL, 0x65f4211e0ULL, 0xd924b0e05ULL },
+    { 0x0a07b21bbULL, 0x06f289355ULL, 0xdd84de050ULL, 0xaac914f60ULL },
+    { 0x1094dcf1eULL, 0x6099d73c2ULL, 0x78f3b2908ULL, 0x43ceb9906ULL },
+    { 0x16a25ab0fULL, 0xa558df112ULL, 0xf0d5a4568ULL, 0x488fb1aa5ULL },
+    { 0x10fdcb6deULL, 0x79fe572c8ULL, 0x7b6d3bf08ULL, 0x134ea7f9eULL },
+    { 0x1134aca2cULL, 0x418947607ULL, 0x345352c88ULL, 0xe06e29182ULL },
+    { 0x11a63e101ULL, 0x05499c704ULL, 0x8087c6588ULL, 0x20e3992a0ULL },
+    { 0x1e582ce22ULL, 0xc21d0609fULL, 0x447341a78ULL, 0xf9060b843ULL },
+    { 0x18633a8b0ULL, 0x036e0c147ULL, 0x0d15cc618ULL, 0xe283076c0ULL },
+    { 0x1a63012fdULL, 0x1f2e4b051ULL, 0xbf480c658ULL, 0x8a0d274f8ULL },
+    { 0x1af147cefULL, 0x7f7f51093ULL, 0xf73e28f58ULL, 0xc908afefeULL },
+    { 0x196cb18b1ULL, 0x17ac0074fULL, 0x8d18d3698ULL, 0xf2e0035e8ULL },
+    { 0x1d95cf5ccULL, 0xfaebd5680ULL, 0x33af3a9b8ULL, 0x016abd75fULL },
+    { 0x199e38922ULL, 0x42189c70fULL, 0x4491c7998ULL, 0xf0e391842ULL },
+    { 0x1ffc5623aULL, 0xe35d13759ULL, 0x5c46a3ff8ULL, 0x9aec8bac7ULL },
+    { 0x241b29b33ULL, 0xd412ae04fULL, 0xccd94d824ULL, 0xf2075482bULL },
+    { 0x26e788850ULL, 0x89863c252ULL, 0x0a111e764ULL, 0x4a43c6191ULL },
+    { 0x210736bc1ULL, 0x0c63aa706ULL, 0x83d6ce084ULL, 0x60e55c630ULL },
+    { 0x284d4656aULL, 0x2a57a1289ULL, 0x56a62b214ULL, 0x91485ea54ULL },
+    { 0x2eece3458ULL, 0xbbc4312dcULL, 0x1a2c73774ULL, 0x3b48c23ddULL },
+    { 0x2d4fe14d4ULL, 0xbaa6686ccULL, 0x2b287f2b4ULL, 0x33616655dULL },
+    { 0x2d8a283c7ULL, 0x8e30fe40cULL, 0xe3c1451b4ULL, 0x3027f0c71ULL },
+    { 0x34f83e371ULL, 0xcd4db614dULL, 0x8ec7c1f2cULL, 0xb286db2b3ULL },
+    { 0x38635d7d8ULL, 0x3b2faf1c0ULL, 0x1bebac61cULL, 0x038f5f4dcULL },
+    { 0x3fa21cc4cULL, 0x8b097d592ULL, 0x3233845fcULL, 0x49abe90d1ULL },
+    { 0x42dd97aeeULL, 0x58f753b1bULL, 0x775e9bb42ULL, 0xd8dcaef1aULL },
+    { 0x44df12d6bULL, 0xcc5699b8bULL, 0xd6b48fb22ULL, 0xd1d996a33ULL },
+    { 0x413acdec8ULL, 0x79a10fc8aULL, 0x137b35c82ULL, 0x513f0859eULL },
+    { 0x41c0db494ULL, 0x30e454dc0ULL, 0x292db0382ULL, 0x03b2a270cULL },
+    { 0x4cb400c8dULL, 0xc72051a82ULL, 0xb13002d32ULL, 0x4158a04e3ULL },
+    { 0x492348952ULL, 0x2b128cc42ULL, 0x4a912c492ULL, 0x4233148d4ULL },
+    { 0x5237b95c6ULL, 0x59baccb94ULL, 0x63a9dec4aULL, 0x29d335d9aULL },
+    { 0x525138ddaULL, 0x483e859d6ULL, 0x5bb1c8a4aULL, 0x6b9a17c12ULL },
+    { 0x5e7192413ULL, 0xc7de009d0ULL, 0xc82498e7aULL, 0x0b9007be3ULL },
+    { 0x5cb271ebdULL, 0xf7285b9c7ULL, 0xbd78e4d3aULL, 0xe39da14efULL },
+    { 0x5bee37366ULL, 0x1b5ddaf1dULL, 0x66cec77daULL, 0xb8f5bbad8ULL },
+    { 0x600584152ULL, 0x0893a0a40ULL, 0x4a821a006ULL, 0x02505c910ULL },
+    { 0x640880338ULL, 0x8080a3849ULL, 0x1cc011026ULL, 0x921c50101ULL },
+    { 0x6e28878c3ULL, 0x9ff12081aULL, 0xc31e11476ULL, 0x581048ff9ULL },
+    { 0x6c5554b57ULL, 0xee17e2b42ULL, 0xead2aaa36ULL, 0x42d47e877ULL },
+    { 0x68bafe461ULL, 0x6fc13c98dULL, 0x8627f5d16ULL, 0xb193c83f6ULL },
+    { 0x68b355ca7ULL, 0x773378983ULL, 0xe53aacd16ULL, 0xc191ecceeULL },
+    { 0x759c9b669ULL, 0xdcc837f89ULL, 0x966d939aeULL, 0x91fec133bULL },
+    { 0x7c0bc80a0ULL, 0xa2aa2c809ULL, 0x05013d03eULL, 0x901345545ULL },
+    { 0x7e5968c49ULL, 0xee0e2589eULL, 0x923169a7eULL, 0x791a47077ULL },
+    { 0x786f3d345ULL, 0x1f0feeb0cULL, 0xa2cbcf61eULL, 0x30d77f0f8ULL },
+    { 0x78c1bfffaULL, 0x1affb79c7ULL, 0x5fffd831eULL, 0xe39edff58ULL },
+    { 0x7adab945aULL, 0x5a9c3d9dcULL, 0x5a29d5b5eULL, 0x3b9bc395aULL },
+    { 0x803c7b9c0ULL, 0x79608432eULL, 0x039de3c01ULL, 0x74c21069eULL },
+    { 0x871458f97ULL, 0xe430c67f2ULL, 0xe9f1a28e1ULL, 0x4fe630c27ULL },
+    { 0x831b05a5dULL, 0x5c034b47aULL, 0xba5a0d8c1ULL, 0x5e2d2c03aULL },
+    { 0x883bb4674ULL, 0x4b834a1edULL, 0x2e62ddc11ULL, 0xb7852c1d2ULL },
+    { 0x8ca9889c0ULL, 0x8ba29402aULL, 0x039119531ULL, 0x5402945d1ULL },
+    { 0x8eb1031abULL, 0xd77291031ULL, 0xd58c08d71ULL, 0x8c0894eebULL },
+    { 0x8f27bf364ULL, 0x9bc3ce735ULL, 0x26cfde4f1ULL, 0xace73c3d9ULL },
+    { 0x8f16b3ca0ULL, 0xd2e0087b7ULL, 0x053cd68f1ULL, 0xede10074bULL },
+    { 0x9418de4a0ULL, 0xe0e9041a9ULL, 0x0527b1829ULL, 0x958209707ULL },
+    { 0x934524c50ULL, 0x080f006f6ULL, 0x0a324a2c9ULL, 0x6f600f010ULL },
+    { 0x9cfd9cd85ULL, 0xc7afd43aaULL, 0xa1b39bf39ULL, 0x55c2bf5e3ULL },
+    { 0x9b223778dULL, 0x1769cb5b4ULL, 0xb1eec44d9ULL, 0x2dad396e8ULL },
+    { 0x99faa3d16ULL, 0x53dcd84eeULL, 0x68bc55f99ULL, 0x7721b3bcaULL },
+    { 0xa29f1c543ULL, 0x4c13bc3b8ULL, 0xc2a38f945ULL, 0x1dc3dc832ULL },
+    { 0xac4f5b1abULL, 0xb676ad329ULL, 0xd58daf235ULL, 0x94cb56e6dULL },
+    { 0xacbf6d366ULL, 0xfb13fe22dULL, 0x66cb6fd35ULL, 0xb447fc8dfULL },
+    { 0xa9b94c408ULL, 0x6303354a8ULL, 0x102329d95ULL, 0x152acc0c6ULL },
+    { 0xb628e902cULL, 0xb1886503dULL, 0x34097146dULL, 0xbc0a6118dULL },
+    { 0xb46ddade0ULL, 0xa9eea43abULL, 0x07b5bb62dULL, 0xd5c257795ULL },
+    { 0xb26ef60a1ULL, 0x25ed2833dULL, 0x8506f764dULL, 0xbcc14b7a4ULL },
+    { 0xb3259969eULL, 0x11ba677f0ULL, 0x79699a4cdULL, 0x0fee65d88ULL },
+    { 0xb35028115ULL, 0x440ce4474ULL, 0xa88140acdULL, 0x2e2273022ULL },
+    { 0xbe1c1b3b6ULL, 0xd278e6379ULL, 0x6dcd8387dULL, 0x9ec671e4bULL },
+    { 0xbc7f5563eULL, 0xf31f6b3e9ULL, 0x7c6aafe3dULL, 0x97cd6f8cfULL },
+    { 0xbcafe68d5ULL, 0xafeb7826eULL, 0xab167f53dULL, 0x7641ed7f5ULL },
+    { 0xbd25928c4ULL, 0x8bea60722ULL, 0x23149a4bdULL, 0x44e0657d1ULL },
+    { 0xc41bd6b71ULL, 0xecc38a96bULL, 0x8ed6bd823ULL, 0xd6951c337ULL },
+    { 0xc663befceULL, 0x89f7cf9b6ULL, 0x73f7dc663ULL, 0x6d9f3ef91ULL },
+    { 0xc6568213dULL, 0xc4c4c9a71ULL, 0xbc8416a63ULL, 0x8e5932323ULL },
+    { 0xc68b4924aULL, 0xb8121f838ULL, 0x52492d163ULL, 0x1c1f8481dULL },
+    { 0xc13dcebe2ULL, 0x69f386e2bULL, 0x47d73bc83ULL, 0xd4761cf96ULL },
+    { 0xc5196d6d1ULL, 0xfc2306cecULL, 0x8b6b698a3ULL, 0x37360c43fULL },
+    { 0xc74d3defbULL, 0x9c3707fffULL, 0xdf7bcb2e3ULL, 0xfffe0ec39ULL },
+    { 0xc15a2bdc9ULL, 0x5c648dcaeULL, 0x93bd45a83ULL, 0x753b1263aULL },
+    { 0xca237221cULL, 0x23424b974ULL, 0x3844ec453ULL, 0x2e9d242c4ULL },
+    { 0xcfc7f4d59ULL, 0xae8799ff6ULL, 0x9ab2fe3f3ULL, 0x6ff99e175ULL },
+    { 0xd03127e26ULL, 0x515b428a7ULL, 0x647e48c0bULL, 0xe5142da8aULL },
+    { 0xd477540e0ULL, 0xe92f08b21ULL, 0x0702aee2bULL, 0x84d10f497ULL },
+    { 0xd186315a2ULL, 0x103898fa5ULL, 0x45a8c618bULL, 0xa5f191c08ULL },
+    { 0xdb4c647abULL, 0x263d83ebdULL, 0xd5e2632dbULL, 0xbd7c1bc64ULL },
+    { 0xdb8487908ULL, 0x12c991e32ULL, 0x109e121dbULL, 0x4c7899348ULL },
+    { 0xdfde06700ULL, 0xc24d9aeb8ULL, 0x00e607bfbULL, 0x1d759b243ULL },
+    { 0xe229ba600ULL, 0x01c2269bcULL, 0x0065d9447ULL, 0x3d9644380ULL },
+    { 0xe140e08d6ULL, 0x28b460c66ULL, 0x6b1070287ULL, 0x663062d14ULL },
+    { 0xe19a90a52ULL, 0x48903ad6aULL, 0x4a5095987ULL, 0x56b5c0912ULL },
+    { 0xe7f2c0fa9ULL, 0xe5a4bbcb3ULL, 0x95f034fe7ULL, 0xcd3dd25a7ULL },
+    { 0xeeadbe838ULL, 0x83c335b7fULL, 0x1c17db577ULL, 0xfedacc3c1ULL },
+    { 0xf01cf27c1ULL, 0x6ce8a2bacULL, 0x83e4f380fULL, 0x35d451736ULL },
+    { 0xf765a8264ULL, 0x898e66e35ULL, 0x26415a6efULL, 0xac7667191ULL },
+    { 0xf7ecc3a4dULL, 0xbdcc73e3aULL, 0xb25c337efULL, 0x5c7ce33bdULL },
+    { 0xf82d54714ULL, 0x230be2be8ULL, 0x28e2ab41fULL, 0x17d47d0c4ULL },
+    { 0xfe858fcdbULL, 0x9efb35af2ULL, 0xdb3f1a17fULL, 0x4f5acdf79ULL },
+    { 0xf8e35b0b6ULL, 0x337e7c961ULL, 0x6d0dac71fULL, 0x8693e7eccULL },
+    { 0xfed63e1ffULL, 0xce7dfdb75ULL, 0xff87c6b7fULL, 0xaedbfbe73ULL },
+};
 
-static unsigned char DICT_6X6_1000_BYTES[][4][5] =
-    { { { 30, 61, 216, 42, 6 },
-        { 227, 186, 70, 49, 9 },
-        { 101, 65, 187, 199, 8 },
-        { 152, 198, 37, 220, 7 }, },
-      { { 14, 251, 163, 137, 1 },
-        { 215, 230, 24, 5, 14 },
-        { 137, 28, 93, 247, 0 },
-        { 122, 1, 134, 126, 11 }, },
-      { { 21, 144, 126, 172, 13 },
-        { 236, 105, 87, 80, 6 },
-        { 179, 87, 224, 154, 8 },
-        { 96, 174, 169, 99, 7 }, },
-      { { 201, 27, 48, 105, 14 },
-        { 66, 50, 75, 222, 12 },
-        { 121, 96, 205, 137, 3 },
-        { 55, 189, 36, 196, 2 }, },
-      { { 214, 7, 214, 225, 5 },
-        { 164, 203, 74, 191, 2 },
-        { 168, 118, 190, 6, 11 },
-        { 79, 213, 45, 50, 5 }, },
-      { { 216, 232, 224, 230, 8 },
-        { 43, 140, 19, 138, 15 },
-        { 22, 112, 113, 113, 11 },
-        { 245, 28, 131, 29, 4 }, },
-      { { 66, 104, 180, 31, 5 },
-        { 13, 165, 192, 149, 13 },
-        { 175, 130, 209, 100, 2 },
-        { 186, 144, 58, 91, 0 }, },
-      { { 136, 165, 15, 41, 10 },
-        { 19, 115, 23, 38, 0 },
-        { 89, 79, 10, 81, 1 },
-        { 6, 78, 140, 236, 8 }, },
-      { { 48, 125, 82, 79, 13 },
-        { 109, 110, 97, 60, 9 },
-        { 191, 36, 171, 224, 12 },
-        { 147, 200, 103, 107, 6 }, },
-      { { 60, 47, 52, 179, 12 },
-        { 131, 11, 235, 52, 15 },
-        { 60, 210, 207, 67, 12 },
-        { 242, 205, 125, 12, 1 }, },
-      { { 69, 223, 199, 78, 3 },
-        { 252, 247, 24, 232, 9 },
-        { 199, 46, 63, 186, 2 },
-        { 145, 113, 142, 243, 15 }, },
-      { { 72, 216, 91, 37, 7 },
-        { 126, 84, 86, 148, 8 },
-        { 234, 77, 161, 177, 2 },
-        { 18, 150, 162, 167, 14 }, },
-      { { 113, 5, 88, 252, 6 },
-        { 40, 58, 230, 248, 2 },
-        { 99, 241, 170, 8, 14 },
-        { 65, 246, 117, 193, 4 }, },
-      { { 134, 220, 250, 208, 7 },
-        { 228, 212, 212, 59, 14 },
-        { 224, 181, 243, 182, 1 },
-        { 125, 194, 178, 178, 7 }, },
-      { { 141, 114, 169, 63, 6 },
-        { 219, 180, 206, 70, 5 },
-        { 111, 201, 84, 235, 1 },
-        { 166, 39, 50, 221, 11 }, },
-      { { 162, 184, 157, 205, 14 },
-        { 89, 177, 117, 31, 10 },
-        { 123, 59, 145, 212, 5 },
-        { 95, 138, 232, 217, 10 }, },
-      { { 9, 253, 30, 156, 4 },
-        { 75, 103, 212, 112, 10 },
-        { 35, 151, 139, 249, 0 },
-        { 80, 226, 190, 109, 2 }, },
-      { { 21, 77, 189, 24, 15 },
-        { 148, 191, 197, 112, 12 },
-        { 241, 139, 219, 42, 8 },
-        { 48, 234, 63, 210, 9 }, },
-      { { 48, 10, 49, 14, 2 },
-        { 24, 56, 40, 16, 13 },
-        { 71, 8, 197, 0, 12 },
-        { 176, 129, 65, 193, 8 }, },
-      { { 72, 7, 239, 175, 13 },
-        { 62, 227, 79, 164, 7 },
-        { 191, 95, 126, 1, 2 },
-        { 226, 95, 44, 119, 12 }, },
-      { { 86, 223, 17, 219, 6 },
-        { 208, 62, 216, 189, 11 },
-        { 109, 184, 143, 182, 10 },
-        { 219, 209, 183, 192, 11 }, },
-      { { 102, 136, 50, 116, 12 },
-        { 136, 64, 243, 153, 12 },
-        { 50, 228, 193, 22, 6 },
-        { 57, 156, 240, 33, 1 }, },
-      { { 118, 232, 203, 120, 1 },
-        { 181, 236, 182, 137, 8 },
-        { 129, 237, 49, 118, 14 },
-        { 25, 22, 211, 122, 13 }, },
-      { { 154, 83, 217, 207, 3 },
-        { 126, 190, 12, 31, 3 },
-        { 207, 57, 188, 165, 9 },
-        { 207, 131, 7, 215, 14 }, },
-      { { 169, 203, 132, 2, 4 },
-        { 2, 135, 120, 66, 9 },
-        { 36, 2, 29, 57, 5 },
-        { 148, 33, 238, 20, 0 }, },
-      { { 198, 117, 73, 73, 0 },
-        { 241, 38, 4, 175, 0 },
-        { 9, 41, 42, 230, 3 },
-        { 15, 82, 6, 72, 15 }, },
-      { { 193, 210, 136, 148, 1 },
-        { 76, 132, 156, 194, 2 },
-        { 130, 145, 20, 184, 3 },
-        { 68, 51, 146, 19, 2 }, },
-      { { 231, 72, 8, 82, 11 },
-        { 132, 20, 165, 203, 9 },
-        { 212, 161, 1, 46, 7 },
-        { 157, 58, 82, 130, 1 }, },
-      { { 234, 47, 202, 132, 8 },
-        { 43, 194, 45, 163, 10 },
-        { 18, 21, 63, 69, 7 },
-        { 92, 91, 68, 61, 4 }, },
-      { { 233, 99, 183, 123, 1 },
-        { 23, 231, 170, 222, 5 },
-        { 141, 238, 220, 105, 7 },
-        { 167, 181, 94, 126, 8 }, },
-      { { 250, 54, 101, 42, 15 },
-        { 119, 57, 107, 163, 5 },
-        { 245, 74, 102, 197, 15 },
-        { 172, 93, 105, 206, 14 }, },
-      { { 6, 91, 255, 123, 13 },
-        { 244, 231, 207, 29, 13 },
-        { 189, 239, 253, 166, 0 },
-        { 187, 143, 62, 114, 15 }, },
-      { { 5, 65, 215, 45, 6 },
-        { 184, 247, 66, 84, 0 },
-        { 107, 78, 184, 42, 0 },
-        { 2, 164, 46, 241, 13 }, },
-      { { 12, 247, 36, 106, 2 },
-        { 195, 55, 26, 40, 5 },
-        { 69, 98, 78, 243, 0 },
-        { 161, 69, 142, 204, 3 }, },
-      { { 19, 56, 163, 158, 11 },
-        { 93, 248, 129, 65, 15 },
-        { 215, 156, 81, 204, 8 },
-        { 248, 40, 17, 251, 10 }, },
-      { { 21, 168, 147, 231, 4 },
-        { 153, 200, 82, 92, 11 },
-        { 46, 124, 145, 90, 8 },
-        { 211, 164, 161, 57, 9 }, },
-      { { 58, 65, 126, 233, 14 },
-        { 34, 127, 103, 29, 6 },
-        { 121, 119, 232, 37, 12 },
-        { 107, 142, 111, 228, 4 }, },
-      { { 79, 17, 226, 108, 0 },
-        { 234, 226, 2, 201, 4 },
-        { 3, 100, 120, 143, 2 },
-        { 41, 52, 4, 117, 7 }, },
-      { { 83, 13, 182, 210, 0 },
-        { 0, 203, 128, 249, 15 },
-        { 4, 182, 219, 12, 10 },
-        { 249, 240, 29, 48, 0 }, },
-      { { 88, 155, 250, 227, 4 },
-        { 98, 202, 94, 156, 15 },
-        { 44, 117, 253, 145, 10 },
-        { 243, 151, 165, 52, 6 }, },
-      { { 100, 9, 232, 160, 11 },
-        { 164, 146, 39, 128, 14 },
-        { 208, 81, 121, 2, 6 },
-        { 112, 30, 68, 146, 5 }, },
-      { { 96, 83, 122, 137, 1 },
-        { 100, 102, 44, 148, 6 },
-        { 137, 21, 236, 160, 6 },
-        { 98, 147, 70, 98, 6 }, },
-      { { 97, 89, 6, 155, 10 },
-        { 64, 119, 161, 196, 11 },
-        { 93, 150, 9, 168, 6 },
-        { 210, 56, 94, 224, 2 }, },
-      { { 107, 255, 120, 215, 11 },
-        { 111, 22, 189, 253, 15 },
-        { 222, 177, 239, 253, 6 },
-        { 251, 251, 214, 143, 6 }, },
-      { { 112, 173, 150, 164, 15 },
-        { 13, 219, 115, 176, 10 },
-        { 242, 86, 155, 80, 14 },
-        { 80, 220, 237, 187, 0 }, },
-      { { 117, 132, 111, 113, 10 },
-        { 176, 89, 183, 236, 4 },
-        { 88, 239, 98, 26, 14 },
-        { 35, 126, 217, 160, 13 }, },
-      { { 122, 149, 25, 47, 12 },
-        { 90, 42, 119, 181, 1 },
-        { 63, 73, 138, 149, 14 },
-        { 138, 222, 229, 69, 10 }, },
-      { { 134, 9, 118, 10, 10 },
-        { 160, 115, 1, 19, 13 },
-        { 85, 6, 233, 6, 1 },
-        { 188, 136, 12, 224, 5 }, },
-      { { 138, 45, 68, 195, 15 },
-        { 39, 19, 65, 47, 11 },
-        { 252, 50, 43, 69, 1 },
-        { 223, 72, 44, 142, 4 }, },
-      { { 147, 235, 120, 177, 4 },
-        { 33, 14, 222, 87, 14 },
-        { 40, 209, 237, 124, 9 },
-        { 126, 167, 183, 8, 4 }, },
-      { { 152, 141, 168, 77, 4 },
-        { 10, 170, 84, 46, 12 },
-        { 43, 33, 91, 17, 9 },
-        { 55, 66, 165, 85, 0 }, },
-      { { 158, 222, 43, 60, 8 },
-        { 218, 108, 159, 35, 12 },
-        { 19, 205, 71, 183, 9 },
-        { 60, 79, 147, 101, 11 }, },
-      { { 165, 41, 224, 123, 8 },
-        { 161, 162, 163, 78, 13 },
-        { 29, 224, 121, 74, 5 },
-        { 183, 44, 84, 88, 5 }, },
-      { { 181, 147, 184, 85, 15 },
-        { 204, 154, 253, 94, 4 },
-        { 250, 161, 220, 154, 13 },
-        { 39, 171, 245, 147, 3 }, },
-      { { 183, 248, 228, 38, 15 },
-        { 237, 157, 115, 67, 13 },
-        { 246, 66, 113, 254, 13 },
-        { 188, 44, 235, 155, 7 }, },
-      { { 188, 32, 82, 37, 14 },
-        { 171, 88, 99, 22, 0 },
-        { 122, 68, 160, 67, 13 },
-        { 6, 140, 97, 173, 5 }, },
-      { { 192, 68, 135, 118, 5 },
-        { 28, 197, 194, 170, 1 },
-        { 166, 238, 18, 32, 3 },
-        { 133, 84, 58, 51, 8 }, },
-      { { 196, 195, 36, 37, 9 },
-        { 140, 7, 27, 134, 4 },
-        { 154, 66, 76, 50, 3 },
-        { 38, 29, 142, 3, 1 }, },
-      { { 197, 169, 27, 216, 13 },
-        { 149, 98, 213, 218, 10 },
-        { 177, 189, 137, 90, 3 },
-        { 85, 186, 180, 106, 9 }, },
-      { { 206, 115, 230, 178, 12 },
-        { 227, 199, 203, 131, 7 },
-        { 52, 214, 124, 231, 3 },
-        { 236, 29, 62, 60, 7 }, },
-      { { 205, 12, 166, 39, 2 },
-        { 138, 209, 2, 230, 13 },
-        { 78, 70, 83, 11, 3 },
-        { 182, 116, 8, 181, 1 }, },
-      { { 201, 67, 93, 68, 13 },
-        { 62, 7, 77, 218, 0 },
-        { 178, 43, 172, 41, 3 },
-        { 5, 187, 46, 7, 12 }, },
-      { { 207, 190, 128, 243, 4 },
-        { 195, 128, 218, 239, 11 },
-        { 44, 240, 23, 223, 3 },
-        { 223, 117, 176, 28, 3 }, },
-      { { 229, 125, 21, 135, 7 },
-        { 221, 23, 96, 246, 11 },
-        { 238, 26, 139, 234, 7 },
-        { 214, 240, 110, 139, 11 }, },
-      { { 239, 198, 133, 142, 9 },
-        { 158, 165, 57, 227, 3 },
-        { 151, 26, 22, 63, 7 },
-        { 204, 121, 202, 87, 9 }, },
-      { { 247, 126, 243, 119, 2 },
-        { 249, 220, 170, 255, 13 },
-        { 78, 236, 247, 238, 15 },
-        { 191, 245, 83, 185, 15 }, },
-      { { 44, 228, 63, 37, 4 },
-        { 155, 69, 118, 52, 4 },
-        { 42, 79, 194, 115, 4 },
-        { 34, 198, 234, 45, 9 }, },
-      { { 43, 220, 255, 75, 3 },
-        { 118, 245, 52, 125, 13 },
-        { 205, 47, 243, 189, 4 },
-        { 187, 226, 202, 246, 14 }, },
-      { { 55, 199, 221, 189, 10 },
-        { 184, 191, 191, 117, 2 },
-        { 91, 219, 190, 62, 12 },
-        { 74, 239, 223, 209, 13 }, },
-      { { 161, 162, 84, 224, 15 },
-        { 37, 17, 123, 90, 2 },
-        { 240, 114, 164, 88, 5 },
-        { 69, 173, 232, 138, 4 }, },
-      { { 169, 130, 193, 187, 5 },
-        { 54, 160, 250, 70, 3 },
-        { 173, 216, 52, 25, 5 },
-        { 198, 37, 240, 86, 12 }, },
-      { { 216, 27, 73, 176, 8 },
-        { 114, 10, 143, 130, 10 },
-        { 16, 217, 45, 129, 11 },
-        { 84, 31, 21, 4, 14 }, },
-      { { 3, 88, 41, 248, 6 },
-        { 80, 52, 198, 73, 14 },
-        { 97, 249, 65, 172, 0 },
-        { 121, 38, 50, 192, 10 }, },
-      { { 7, 196, 9, 95, 12 },
-        { 152, 36, 213, 109, 1 },
-        { 63, 169, 2, 62, 0 },
-        { 139, 106, 178, 65, 9 }, },
-      { { 15, 226, 102, 23, 11 },
-        { 175, 85, 153, 69, 5 },
-        { 222, 134, 100, 127, 0 },
-        { 170, 41, 154, 175, 5 }, },
-      { { 20, 72, 54, 68, 1 },
-        { 140, 77, 0, 24, 12 },
-        { 130, 38, 193, 34, 8 },
-        { 49, 128, 11, 35, 1 }, },
-      { { 16, 173, 95, 251, 7 },
-        { 53, 123, 214, 60, 11 },
-        { 237, 255, 171, 80, 8 },
-        { 211, 198, 189, 234, 12 }, },
-      { { 18, 130, 149, 83, 15 },
-        { 20, 153, 217, 29, 1 },
-        { 252, 170, 148, 20, 8 },
-        { 139, 137, 185, 146, 8 }, },
-      { { 22, 225, 49, 132, 12 },
-        { 153, 14, 81, 17, 6 },
-        { 50, 24, 200, 118, 8 },
-        { 104, 136, 167, 9, 9 }, },
-      { { 24, 122, 73, 107, 0 },
-        { 115, 44, 14, 12, 9 },
-        { 13, 105, 37, 225, 8 },
-        { 147, 7, 3, 76, 14 }, },
-      { { 26, 232, 134, 17, 2 },
-        { 3, 221, 144, 5, 8 },
-        { 72, 134, 17, 117, 8 },
-        { 26, 0, 155, 188, 0 }, },
-      { { 25, 19, 174, 10, 1 },
-        { 70, 235, 12, 64, 5 },
-        { 133, 7, 92, 137, 8 },
-        { 160, 35, 13, 118, 2 }, },
-      { { 27, 103, 181, 161, 7 },
-        { 23, 159, 74, 117, 6 },
-        { 232, 90, 222, 109, 8 },
-        { 106, 229, 47, 158, 8 }, },
-      { { 37, 220, 149, 240, 11 },
-        { 212, 149, 179, 120, 10 },
-        { 208, 250, 147, 186, 4 },
-        { 81, 236, 218, 146, 11 }, },
-      { { 40, 137, 97, 247, 6 },
-        { 58, 18, 242, 12, 15 },
-        { 110, 248, 105, 17, 4 },
-        { 243, 4, 244, 133, 12 }, },
-      { { 51, 84, 20, 106, 10 },
-        { 64, 61, 35, 121, 1 },
-        { 85, 98, 130, 172, 12 },
-        { 137, 236, 75, 192, 2 }, },
-      { { 49, 193, 108, 31, 7 },
-        { 44, 63, 244, 68, 5 },
-        { 239, 131, 104, 56, 12 },
-        { 162, 34, 255, 195, 4 }, },
-      { { 51, 203, 24, 198, 6 },
-        { 8, 30, 124, 89, 11 },
-        { 102, 49, 141, 60, 12 },
-        { 217, 163, 231, 129, 0 }, },
-      { { 62, 207, 228, 144, 15 },
-        { 166, 159, 249, 33, 14 },
-        { 240, 146, 127, 55, 12 },
-        { 120, 73, 255, 150, 5 }, },
-      { { 70, 69, 24, 163, 15 },
-        { 132, 22, 71, 181, 3 },
-        { 252, 81, 138, 38, 2 },
-        { 202, 222, 38, 130, 1 }, },
-      { { 68, 186, 112, 182, 7 },
-        { 237, 16, 218, 144, 15 },
-        { 230, 208, 229, 210, 2 },
-        { 240, 149, 176, 139, 7 }, },
-      { { 65, 156, 98, 62, 8 },
-        { 104, 96, 147, 224, 13 },
-        { 23, 196, 99, 152, 2 },
-        { 176, 124, 144, 97, 6 }, },
-      { { 72, 209, 145, 74, 1 },
-        { 86, 166, 16, 152, 1 },
-        { 133, 40, 152, 177, 2 },
-        { 129, 144, 134, 86, 10 }, },
-      { { 84, 244, 153, 246, 13 },
-        { 221, 140, 215, 184, 3 },
-        { 182, 249, 146, 242, 10 },
-        { 193, 222, 179, 27, 11 }, },
-      { { 87, 90, 156, 129, 3 },
-        { 196, 157, 12, 213, 10 },
-        { 200, 19, 149, 174, 10 },
-        { 90, 179, 11, 146, 3 }, },
-      { { 85, 131, 85, 178, 12 },
-        { 176, 11, 219, 208, 3 },
-        { 52, 218, 172, 26, 10 },
-        { 192, 189, 189, 0, 13 }, },
-      { { 87, 183, 118, 16, 15 },
-        { 229, 91, 217, 241, 4 },
-        { 240, 134, 238, 222, 10 },
-        { 40, 249, 189, 170, 7 }, },
-      { { 92, 52, 54, 254, 4 },
-        { 203, 105, 194, 184, 7 },
-        { 39, 246, 194, 195, 10 },
-        { 225, 212, 57, 109, 3 }, },
-      { { 92, 72, 252, 119, 14 },
-        { 170, 157, 199, 156, 13 },
-        { 126, 227, 241, 35, 10 },
-        { 179, 158, 59, 149, 5 }, },
-      { { 94, 110, 239, 64, 2 },
-        { 179, 221, 12, 169, 12 },
-        { 64, 47, 119, 103, 10 },
-        { 57, 83, 11, 188, 13 }, },
-      { { 95, 35, 59, 111, 15 },
-        { 159, 122, 79, 221, 5 },
-        { 255, 109, 204, 79, 10 },
-        { 171, 191, 37, 239, 9 }, },
-      { { 91, 116, 42, 99, 2 },
-        { 67, 92, 6, 237, 5 },
-        { 76, 101, 66, 237, 10 },
-        { 171, 118, 3, 172, 2 }, },
-      { { 101, 15, 163, 58, 14 },
-        { 144, 242, 235, 224, 13 },
-        { 117, 204, 95, 10, 6 },
-        { 176, 125, 116, 240, 9 }, },
-      { { 101, 211, 23, 92, 12 },
-        { 216, 103, 249, 216, 0 },
-        { 51, 174, 140, 186, 6 },
-        { 1, 185, 254, 97, 11 }, },
-      { { 106, 156, 36, 90, 14 },
-        { 66, 49, 241, 169, 13 },
-        { 117, 162, 67, 149, 6 },
-        { 185, 88, 248, 196, 2 }, },
-      { { 105, 197, 243, 4, 2 },
-        { 58, 214, 48, 240, 4 },
-        { 66, 12, 250, 57, 6 },
-        { 32, 240, 198, 181, 12 }, },
-      { { 105, 210, 72, 78, 10 },
-        { 106, 52, 61, 200, 1 },
-        { 87, 33, 36, 185, 6 },
-        { 129, 59, 194, 197, 6 }, },
-      { { 116, 121, 226, 222, 6 },
-        { 233, 254, 224, 136, 15 },
-        { 103, 180, 121, 226, 14 },
-        { 241, 16, 119, 249, 7 }, },
-      { { 114, 207, 35, 234, 11 },
-        { 20, 126, 59, 169, 15 },
-        { 213, 124, 79, 52, 14 },
-        { 249, 93, 199, 226, 8 }, },
-      { { 119, 177, 220, 65, 4 },
-        { 225, 139, 116, 221, 0 },
-        { 40, 35, 184, 222, 14 },
-        { 11, 178, 237, 24, 7 }, },
-      { { 126, 12, 7, 33, 7 },
-        { 150, 89, 98, 165, 8 },
-        { 232, 78, 3, 7, 14 },
-        { 26, 84, 105, 166, 9 }, },
-      { { 122, 105, 112, 100, 7 },
-        { 47, 30, 98, 153, 12 },
-        { 226, 96, 233, 101, 14 },
-        { 57, 148, 103, 143, 4 }, },
-      { { 120, 178, 216, 112, 7 },
-        { 103, 152, 254, 152, 0 },
-        { 224, 225, 180, 209, 14 },
-        { 1, 151, 241, 158, 6 }, },
-      { { 121, 197, 133, 121, 4 },
-        { 18, 175, 242, 236, 0 },
-        { 41, 234, 26, 57, 14 },
-        { 3, 116, 255, 84, 8 }, },
-      { { 134, 111, 89, 252, 6 },
-        { 185, 54, 206, 59, 10 },
-        { 99, 249, 175, 102, 1 },
-        { 93, 199, 54, 201, 13 }, },
-      { { 130, 246, 114, 127, 5 },
-        { 109, 100, 218, 63, 5 },
-        { 175, 228, 230, 244, 1 },
-        { 175, 197, 178, 107, 6 }, },
-      { { 133, 78, 47, 65, 4 },
-        { 144, 69, 76, 110, 12 },
-        { 40, 47, 71, 42, 1 },
-        { 55, 99, 42, 32, 9 }, },
-      { { 154, 17, 133, 147, 4 },
-        { 82, 139, 192, 7, 3 },
-        { 44, 154, 24, 133, 9 },
-        { 206, 0, 61, 20, 10 }, },
-      { { 156, 113, 96, 201, 7 },
-        { 231, 62, 64, 14, 6 },
-        { 233, 48, 104, 227, 9 },
-        { 103, 0, 39, 206, 7 }, },
-      { { 157, 209, 148, 253, 8 },
-        { 202, 175, 147, 94, 2 },
-        { 27, 242, 152, 187, 9 },
-        { 71, 172, 159, 85, 3 }, },
-      { { 162, 30, 18, 227, 8 },
-        { 64, 64, 43, 63, 11 },
-        { 28, 116, 135, 132, 5 },
-        { 223, 205, 64, 32, 2 }, },
-      { { 174, 112, 28, 130, 12 },
-        { 195, 5, 101, 19, 3 },
-        { 52, 19, 128, 231, 5 },
-        { 204, 138, 106, 12, 3 }, },
-      { { 173, 1, 33, 156, 1 },
-        { 158, 34, 160, 66, 6 },
-        { 131, 152, 72, 11, 5 },
-        { 100, 32, 84, 71, 9 }, },
-      { { 176, 53, 31, 158, 14 },
-        { 89, 123, 229, 50, 3 },
-        { 119, 159, 138, 192, 13 },
-        { 196, 202, 125, 233, 10 }, },
-      { { 182, 74, 216, 13, 4 },
-        { 168, 172, 108, 23, 8 },
-        { 43, 1, 181, 38, 13 },
-        { 30, 131, 99, 81, 5 }, },
-      { { 181, 55, 49, 75, 4 },
-        { 209, 42, 104, 126, 5 },
-        { 45, 40, 206, 202, 13 },
-        { 167, 225, 101, 72, 11 }, },
-      { { 190, 170, 199, 227, 11 },
-        { 183, 217, 59, 15, 11 },
-        { 220, 126, 53, 87, 13 },
-        { 223, 13, 201, 190, 13 }, },
-      { { 187, 104, 61, 188, 15 },
-        { 31, 61, 231, 83, 14 },
-        { 243, 219, 193, 109, 13 },
-        { 124, 174, 123, 207, 8 }, },
-      { { 198, 114, 247, 44, 1 },
-        { 253, 229, 10, 147, 4 },
-        { 131, 78, 244, 230, 3 },
-        { 44, 149, 10, 123, 15 }, },
-      { { 193, 231, 77, 186, 11 },
-        { 53, 55, 159, 226, 3 },
-        { 213, 219, 46, 120, 3 },
-        { 196, 127, 158, 202, 12 }, },
-      { { 203, 85, 238, 89, 13 },
-        { 102, 231, 197, 239, 4 },
-        { 185, 167, 122, 173, 3 },
-        { 47, 122, 62, 118, 6 }, },
-      { { 203, 160, 83, 114, 4 },
-        { 51, 64, 210, 219, 1 },
-        { 36, 236, 160, 93, 3 },
-        { 141, 180, 176, 44, 12 }, },
-      { { 208, 9, 15, 207, 1 },
-        { 28, 107, 4, 142, 11 },
-        { 143, 63, 9, 0, 11 },
-        { 215, 18, 13, 99, 8 }, },
-      { { 208, 108, 58, 213, 4 },
-        { 9, 76, 196, 190, 14 },
-        { 42, 181, 195, 96, 11 },
-        { 119, 210, 51, 41, 0 }, },
-      { { 211, 241, 32, 87, 4 },
-        { 73, 14, 208, 207, 5 },
-        { 46, 160, 72, 252, 11 },
-        { 175, 48, 183, 9, 2 }, },
-      { { 230, 227, 59, 26, 7 },
-        { 149, 118, 252, 147, 5 },
-        { 229, 141, 204, 118, 7 },
-        { 172, 147, 246, 234, 9 }, },
-      { { 227, 83, 62, 164, 10 },
-        { 72, 87, 47, 211, 6 },
-        { 82, 87, 204, 172, 7 },
-        { 108, 191, 78, 161, 2 }, },
-      { { 232, 6, 142, 177, 4 },
-        { 2, 193, 238, 166, 2 },
-        { 40, 215, 22, 1, 7 },
-        { 70, 87, 120, 52, 0 }, },
-      { { 236, 7, 192, 89, 7 },
-        { 166, 178, 232, 174, 0 },
-        { 233, 160, 62, 3, 7 },
-        { 7, 81, 116, 214, 5 }, },
-      { { 234, 243, 128, 61, 10 },
-        { 75, 182, 187, 135, 0 },
-        { 91, 192, 28, 245, 7 },
-        { 14, 29, 214, 221, 2 }, },
-      { { 246, 59, 39, 216, 8 },
-        { 209, 107, 169, 139, 14 },
-        { 17, 190, 77, 198, 15 },
-        { 125, 25, 93, 104, 11 }, },
-      { { 243, 7, 152, 55, 9 },
-        { 12, 138, 175, 247, 1 },
-        { 158, 193, 158, 12, 15 },
-        { 142, 255, 85, 19, 0 }, },
-      { { 254, 75, 186, 155, 9 },
-        { 134, 238, 173, 151, 15 },
-        { 157, 149, 221, 39, 15 },
-        { 254, 155, 87, 118, 1 }, },
-      { { 171, 165, 125, 134, 11 },
-        { 63, 19, 53, 115, 7 },
-        { 214, 27, 234, 93, 5 },
-        { 236, 234, 204, 143, 12 }, },
-      { { 192, 209, 98, 90, 11 },
-        { 100, 118, 145, 138, 5 },
-        { 213, 164, 104, 176, 3 },
-        { 165, 24, 150, 226, 6 }, },
-      { { 19, 206, 123, 174, 7 },
-        { 60, 124, 94, 113, 15 },
-        { 231, 93, 231, 60, 8 },
-        { 248, 231, 163, 227, 12 }, },
-      { { 78, 129, 253, 97, 7 },
-        { 182, 147, 86, 157, 4 },
-        { 232, 107, 248, 23, 2 },
-        { 43, 150, 172, 150, 13 }, },
-      { { 86, 224, 118, 50, 0 },
-        { 161, 77, 146, 145, 5 },
-        { 4, 198, 224, 118, 10 },
-        { 168, 148, 155, 40, 5 }, },
-      { { 106, 112, 138, 84, 0 },
-        { 75, 196, 164, 137, 0 },
-        { 2, 165, 16, 229, 6 },
-        { 9, 18, 82, 61, 2 }, },
-      { { 114, 168, 152, 161, 8 },
-        { 1, 136, 55, 149, 10 },
-        { 24, 81, 145, 84, 14 },
-        { 90, 158, 193, 24, 0 }, },
-      { { 129, 93, 66, 248, 0 },
-        { 96, 102, 130, 106, 10 },
-        { 1, 244, 43, 168, 1 },
-        { 85, 100, 22, 96, 6 }, },
-      { { 207, 76, 195, 213, 15 },
-        { 190, 212, 193, 239, 10 },
-        { 250, 188, 51, 47, 3 },
-        { 95, 120, 50, 183, 13 }, },
-      { { 214, 187, 101, 134, 4 },
-        { 249, 11, 88, 131, 15 },
-        { 38, 26, 109, 214, 11 },
-        { 252, 17, 173, 9, 15 }, },
-      { { 236, 211, 19, 163, 1 },
-        { 214, 70, 58, 150, 3 },
-        { 140, 92, 140, 179, 7 },
-        { 198, 149, 198, 38, 11 }, },
-      { { 245, 33, 245, 32, 7 },
-        { 181, 155, 98, 210, 4 },
-        { 224, 74, 248, 74, 15 },
-        { 36, 180, 109, 154, 13 }, },
-      { { 249, 31, 165, 223, 7 },
-        { 94, 187, 232, 238, 15 },
-        { 239, 186, 95, 137, 15 },
-        { 247, 113, 125, 215, 10 }, },
-      { { 0, 36, 244, 122, 7 },
-        { 37, 177, 194, 56, 5 },
-        { 229, 226, 242, 64, 0 },
-        { 161, 196, 56, 218, 4 }, },
-      { { 0, 8, 77, 136, 2 },
-        { 48, 49, 4, 0, 10 },
-        { 65, 27, 33, 0, 0 },
-        { 80, 2, 8, 192, 12 }, },
-      { { 4, 60, 194, 242, 9 },
-        { 229, 192, 131, 40, 11 },
-        { 148, 244, 51, 194, 0 },
-        { 209, 76, 16, 58, 7 }, },
-      { { 4, 123, 80, 33, 1 },
-        { 229, 6, 10, 20, 8 },
-        { 136, 64, 173, 226, 0 },
-        { 18, 133, 6, 10, 7 }, },
-      { { 6, 122, 228, 193, 13 },
-        { 229, 133, 73, 13, 14 },
-        { 184, 50, 117, 230, 0 },
-        { 123, 9, 42, 26, 7 }, },
-      { { 0, 170, 150, 138, 3 },
-        { 5, 241, 24, 16, 11 },
-        { 197, 22, 149, 80, 0 },
-        { 208, 129, 136, 250, 0 }, },
-      { { 4, 209, 56, 233, 4 },
-        { 192, 38, 86, 28, 6 },
-        { 41, 113, 200, 178, 0 },
-        { 99, 134, 166, 64, 3 }, },
-      { { 5, 16, 168, 13, 10 },
-        { 200, 176, 5, 68, 4 },
-        { 91, 1, 80, 138, 0 },
-        { 34, 42, 0, 209, 3 }, },
-      { { 1, 64, 176, 0, 7 },
-        { 4, 148, 64, 80, 4 },
-        { 224, 0, 208, 40, 0 },
-        { 32, 160, 34, 146, 0 }, },
-      { { 1, 157, 156, 238, 1 },
-        { 76, 163, 22, 120, 11 },
-        { 135, 115, 155, 152, 0 },
-        { 209, 230, 140, 83, 2 }, },
-      { { 8, 16, 87, 227, 11 },
-        { 118, 81, 3, 28, 3 },
-        { 220, 126, 160, 129, 0 },
-        { 195, 140, 8, 166, 14 }, },
-      { { 8, 107, 151, 182, 6 },
-        { 27, 215, 202, 16, 11 },
-        { 102, 222, 157, 97, 0 },
-        { 208, 133, 62, 189, 8 }, },
-      { { 14, 232, 184, 96, 10 },
-        { 131, 148, 23, 25, 12 },
-        { 80, 97, 209, 119, 0 },
-        { 57, 142, 130, 156, 1 }, },
-      { { 11, 108, 118, 185, 11 },
-        { 39, 117, 131, 117, 14 },
-        { 217, 214, 227, 109, 0 },
-        { 122, 236, 26, 238, 4 }, },
-      { { 15, 220, 185, 140, 11 },
-        { 222, 180, 21, 113, 14 },
-        { 211, 25, 211, 191, 0 },
-        { 120, 234, 130, 215, 11 }, },
-      { { 15, 202, 207, 58, 0 },
-        { 178, 229, 158, 65, 9 },
-        { 5, 207, 53, 63, 0 },
-        { 152, 39, 154, 116, 13 }, },
-      { { 20, 36, 159, 217, 8 },
-        { 145, 233, 133, 60, 2 },
-        { 25, 191, 146, 66, 8 },
-        { 67, 202, 25, 120, 9 }, },
-      { { 20, 7, 32, 31, 13 },
-        { 140, 42, 201, 36, 5 },
-        { 191, 128, 78, 2, 8 },
-        { 162, 73, 53, 67, 1 }, },
-      { { 21, 9, 16, 213, 7 },
-        { 140, 26, 192, 92, 10 },
-        { 234, 176, 137, 10, 8 },
-        { 83, 160, 53, 131, 1 }, },
-      { { 19, 92, 215, 48, 7 },
-        { 116, 221, 194, 113, 8 },
-        { 224, 206, 179, 172, 8 },
-        { 24, 228, 59, 178, 14 }, },
-      { { 17, 71, 154, 187, 6 },
-        { 0, 254, 206, 116, 3 },
-        { 109, 213, 158, 40, 8 },
-        { 194, 231, 55, 240, 0 }, },
-      { { 28, 185, 169, 35, 8 },
-        { 211, 138, 23, 4, 13 },
-        { 28, 73, 89, 211, 8 },
-        { 178, 14, 133, 28, 11 }, },
-      { { 28, 221, 7, 118, 6 },
-        { 218, 95, 210, 40, 9 },
-        { 102, 238, 11, 179, 8 },
-        { 145, 68, 191, 165, 11 }, },
-      { { 31, 46, 124, 36, 11 },
-        { 175, 25, 15, 113, 12 },
-        { 210, 67, 231, 79, 8 },
-        { 56, 239, 9, 143, 5 }, },
-      { { 25, 102, 66, 71, 7 },
-        { 47, 92, 72, 108, 1 },
-        { 238, 36, 38, 105, 8 },
-        { 131, 97, 35, 175, 4 }, },
-      { { 25, 87, 212, 200, 4 },
-        { 98, 175, 72, 120, 2 },
-        { 33, 50, 190, 169, 8 },
-        { 65, 225, 47, 84, 6 }, },
-      { { 31, 168, 244, 240, 4 },
-        { 163, 137, 210, 89, 14 },
-        { 32, 242, 241, 95, 8 },
-        { 121, 164, 185, 28, 5 }, },
-      { { 27, 130, 70, 237, 8 },
-        { 42, 105, 27, 77, 2 },
-        { 27, 118, 36, 29, 8 },
-        { 75, 45, 137, 101, 4 }, },
-      { { 27, 174, 225, 15, 14 },
-        { 59, 184, 89, 101, 13 },
-        { 127, 8, 119, 93, 8 },
-        { 186, 105, 161, 221, 12 }, },
-      { { 34, 164, 182, 60, 10 },
-        { 9, 241, 179, 49, 4 },
-        { 83, 198, 210, 84, 4 },
-        { 40, 204, 216, 249, 0 }, },
-      { { 34, 191, 144, 18, 15 },
-        { 69, 146, 249, 49, 9 },
-        { 244, 128, 159, 212, 4 },
-        { 152, 201, 244, 154, 2 }, },
-      { { 35, 44, 21, 180, 0 },
-        { 25, 1, 162, 113, 10 },
-        { 2, 218, 131, 76, 4 },
-        { 88, 228, 88, 9, 8 }, },
-      { { 37, 90, 169, 102, 12 },
-        { 216, 132, 111, 72, 13 },
-        { 54, 105, 85, 170, 4 },
-        { 177, 47, 98, 17, 11 }, },
-      { { 39, 165, 175, 169, 7 },
-        { 149, 243, 118, 101, 6 },
-        { 233, 95, 90, 94, 4 },
-        { 106, 102, 236, 250, 9 }, },
-      { { 37, 244, 14, 66, 5 },
-        { 197, 69, 116, 104, 1 },
-        { 164, 39, 2, 250, 4 },
-        { 129, 98, 234, 42, 3 }, },
-      { { 40, 102, 85, 205, 14 },
-        { 59, 53, 105, 60, 2 },
-        { 123, 58, 166, 97, 4 },
-        { 67, 201, 106, 205, 12 }, },
-      { { 44, 66, 126, 14, 0 },
-        { 170, 101, 44, 16, 5 },
-        { 7, 7, 228, 35, 4 },
-        { 160, 131, 74, 101, 5 }, },
-      { { 42, 185, 124, 189, 0 },
-        { 107, 35, 182, 21, 14 },
-        { 11, 211, 233, 213, 4 },
-        { 122, 134, 220, 77, 6 }, },
-      { { 41, 70, 225, 210, 3 },
-        { 54, 148, 168, 104, 7 },
-        { 196, 184, 118, 41, 4 },
-        { 225, 97, 82, 150, 12 }, },
-      { { 45, 166, 40, 65, 0 },
-        { 131, 0, 60, 108, 4 },
-        { 8, 33, 70, 91, 4 },
-        { 35, 99, 192, 12, 1 }, },
-      { { 43, 251, 32, 154, 6 },
-        { 67, 54, 248, 65, 15 },
-        { 101, 144, 77, 253, 4 },
-        { 248, 33, 246, 204, 2 }, },
-      { { 54, 140, 214, 107, 12 },
-        { 160, 233, 115, 61, 9 },
-        { 61, 102, 179, 22, 12 },
-        { 155, 204, 233, 112, 5 }, },
-      { { 52, 135, 119, 124, 7 },
-        { 188, 123, 250, 56, 4 },
-        { 227, 238, 238, 18, 12 },
-        { 33, 197, 253, 227, 13 }, },
-      { { 52, 221, 235, 132, 0 },
-        { 248, 206, 52, 32, 14 },
-        { 2, 29, 123, 178, 12 },
-        { 112, 66, 199, 49, 15 }, },
-      { { 55, 145, 247, 111, 1 },
-        { 252, 235, 50, 93, 5 },
-        { 143, 110, 248, 158, 12 },
-        { 171, 164, 205, 115, 15 }, },
-      { { 58, 34, 142, 23, 5 },
-        { 15, 201, 236, 5, 1 },
-        { 174, 135, 20, 69, 12 },
-        { 138, 3, 121, 63, 0 }, },
-      { { 62, 19, 189, 64, 8 },
-        { 210, 139, 45, 25, 4 },
-        { 16, 43, 220, 135, 12 },
-        { 41, 139, 77, 20, 11 }, },
-      { { 60, 152, 67, 202, 2 },
-        { 242, 120, 48, 8, 11 },
-        { 69, 60, 33, 147, 12 },
-        { 209, 0, 193, 228, 15 }, },
-      { { 57, 88, 157, 23, 9 },
-        { 94, 141, 165, 84, 9 },
-        { 158, 139, 145, 169, 12 },
-        { 146, 170, 91, 23, 10 }, },
-      { { 57, 116, 218, 238, 11 },
-        { 111, 252, 39, 120, 3 },
-        { 215, 117, 178, 233, 12 },
-        { 193, 238, 67, 255, 6 }, },
-      { { 63, 109, 188, 115, 1 },
-        { 135, 143, 166, 125, 13 },
-        { 140, 227, 219, 111, 12 },
-        { 187, 230, 95, 30, 1 }, },
-      { { 61, 107, 192, 80, 12 },
-        { 163, 142, 233, 72, 8 },
-        { 48, 160, 61, 107, 12 },
-        { 17, 41, 119, 28, 5 }, },
-      { { 57, 171, 39, 73, 7 },
-        { 23, 123, 120, 76, 12 },
-        { 233, 46, 77, 89, 12 },
-        { 51, 33, 237, 238, 8 }, },
-      { { 70, 2, 78, 37, 14 },
-        { 168, 81, 79, 133, 0 },
-        { 122, 71, 36, 6, 2 },
-        { 10, 31, 40, 161, 5 }, },
-      { { 70, 130, 186, 11, 12 },
-        { 128, 224, 93, 149, 5 },
-        { 61, 5, 212, 22, 2 },
-        { 170, 155, 160, 112, 1 }, },
-      { { 66, 233, 205, 90, 14 },
-        { 49, 183, 213, 137, 9 },
-        { 117, 171, 57, 116, 2 },
-        { 153, 26, 190, 216, 12 }, },
-      { { 68, 201, 183, 179, 15 },
-        { 148, 215, 211, 148, 15 },
-        { 252, 222, 217, 50, 2 },
-        { 242, 156, 190, 178, 9 }, },
-      { { 64, 199, 212, 30, 9 },
-        { 44, 167, 153, 176, 1 },
-        { 151, 130, 190, 48, 2 },
-        { 128, 217, 158, 83, 4 }, },
-      { { 70, 210, 180, 204, 14 },
-        { 200, 181, 89, 153, 6 },
-        { 115, 50, 212, 182, 2 },
-        { 105, 153, 170, 209, 3 }, },
-      { { 67, 25, 83, 86, 11 },
-        { 124, 82, 129, 217, 9 },
-        { 214, 172, 169, 140, 2 },
-        { 153, 184, 20, 163, 14 }, },
-      { { 65, 34, 230, 221, 9 },
-        { 45, 225, 137, 204, 6 },
-        { 155, 182, 116, 72, 2 },
-        { 99, 57, 24, 123, 4 }, },
-      { { 71, 83, 165, 154, 11 },
-        { 212, 183, 137, 193, 7 },
-        { 213, 154, 92, 174, 2 },
-        { 232, 57, 30, 210, 11 }, },
-      { { 78, 30, 241, 224, 8 },
-        { 242, 128, 11, 185, 14 },
-        { 16, 120, 247, 135, 2 },
-        { 121, 221, 0, 20, 15 }, },
-      { { 78, 74, 192, 150, 0 },
-        { 170, 132, 136, 129, 11 },
-        { 6, 144, 53, 39, 2 },
-        { 216, 17, 18, 21, 5 }, },
-      { { 78, 95, 170, 6, 15 },
-        { 206, 214, 77, 161, 13 },
-        { 246, 5, 95, 167, 2 },
-        { 184, 91, 38, 183, 3 }, },
-      { { 74, 141, 50, 148, 3 },
-        { 14, 82, 144, 177, 14 },
-        { 194, 148, 203, 21, 2 },
-        { 120, 208, 148, 167, 0 }, },
-      { { 73, 21, 148, 179, 9 },
-        { 70, 131, 131, 244, 3 },
-        { 156, 210, 154, 137, 2 },
-        { 194, 252, 28, 22, 2 }, },
-      { { 77, 77, 219, 98, 1 },
-        { 182, 198, 6, 248, 9 },
-        { 132, 109, 187, 43, 2 },
-        { 145, 246, 6, 54, 13 }, },
-      { { 75, 167, 97, 232, 1 },
-        { 55, 34, 26, 233, 6 },
-        { 129, 120, 110, 93, 2 },
-        { 105, 117, 132, 78, 12 }, },
-      { { 73, 212, 131, 216, 14 },
-        { 82, 244, 209, 232, 2 },
-        { 113, 188, 18, 185, 2 },
-        { 65, 120, 178, 244, 10 }, },
-      { { 86, 41, 14, 246, 12 },
-        { 137, 75, 199, 137, 11 },
-        { 54, 247, 9, 70, 10 },
-        { 217, 30, 61, 41, 1 }, },
-      { { 83, 126, 213, 255, 12 },
-        { 121, 173, 203, 253, 11 },
-        { 63, 250, 183, 236, 10 },
-        { 219, 253, 59, 89, 14 }, },
-      { { 85, 245, 167, 175, 10 },
-        { 217, 255, 19, 228, 7 },
-        { 95, 94, 90, 250, 10 },
-        { 226, 124, 143, 249, 11 }, },
-      { { 85, 213, 234, 100, 15 },
-        { 236, 222, 87, 232, 4 },
-        { 242, 101, 122, 186, 10 },
-        { 33, 126, 167, 179, 7 }, },
-      { { 88, 27, 171, 29, 10 },
-        { 90, 250, 141, 132, 12 },
-        { 91, 141, 93, 129, 10 },
-        { 50, 27, 21, 245, 10 }, },
-      { { 94, 190, 146, 109, 13 },
-        { 207, 232, 91, 189, 8 },
-        { 187, 100, 151, 215, 10 },
-        { 27, 221, 161, 127, 3 }, },
-      { { 95, 16, 249, 155, 5 },
-        { 246, 168, 196, 213, 7 },
-        { 173, 153, 240, 143, 10 },
-        { 234, 178, 49, 86, 15 }, },
-      { { 93, 30, 223, 165, 12 },
-        { 250, 201, 79, 244, 10 },
-        { 58, 95, 183, 139, 10 },
-        { 82, 255, 41, 53, 15 }, },
-      { { 95, 113, 141, 240, 2 },
-        { 211, 159, 134, 201, 2 },
-        { 64, 251, 24, 239, 10 },
-        { 73, 54, 31, 156, 11 }, },
-      { { 93, 225, 30, 70, 8 },
-        { 139, 79, 21, 216, 1 },
-        { 22, 39, 136, 123, 10 },
-        { 129, 186, 143, 45, 1 }, },
-      { { 96, 51, 187, 36, 7 },
-        { 93, 210, 110, 144, 4 },
-        { 226, 77, 220, 192, 6 },
-        { 32, 151, 100, 187, 10 }, },
-      { { 100, 88, 26, 254, 1 },
-        { 204, 100, 166, 152, 11 },
-        { 135, 245, 129, 162, 6 },
-        { 209, 150, 82, 99, 3 }, },
-      { { 99, 200, 221, 167, 6 },
-        { 56, 149, 118, 213, 11 },
-        { 110, 91, 177, 60, 6 },
-        { 218, 182, 234, 145, 12 }, },
-      { { 97, 218, 61, 143, 13 },
-        { 92, 37, 125, 212, 15 },
-        { 191, 27, 197, 184, 6 },
-        { 242, 187, 234, 67, 10 }, },
-      { { 110, 58, 34, 175, 10 },
-        { 203, 112, 43, 133, 15 },
-        { 95, 84, 69, 199, 6 },
-        { 250, 29, 64, 237, 3 }, },
-      { { 110, 97, 5, 183, 1 },
-        { 159, 7, 162, 133, 3 },
-        { 142, 218, 8, 103, 6 },
-        { 202, 20, 94, 15, 9 }, },
-      { { 106, 137, 169, 232, 12 },
-        { 18, 162, 119, 137, 14 },
-        { 49, 121, 89, 21, 6 },
-        { 121, 30, 228, 84, 8 }, },
-      { { 106, 151, 34, 79, 5 },
-        { 78, 98, 120, 173, 5 },
-        { 175, 36, 78, 149, 6 },
-        { 171, 81, 228, 103, 2 }, },
-      { { 107, 18, 195, 128, 1 },
-        { 118, 192, 40, 193, 2 },
-        { 128, 28, 52, 141, 6 },
-        { 72, 49, 64, 54, 14 }, },
-      { { 107, 104, 75, 34, 10 },
-        { 51, 84, 39, 193, 9 },
-        { 84, 77, 33, 109, 6 },
-        { 152, 62, 66, 172, 12 }, },
-      { { 111, 148, 193, 87, 9 },
-        { 254, 128, 177, 237, 1 },
-        { 158, 168, 50, 159, 6 },
-        { 139, 120, 208, 23, 15 }, },
-      { { 109, 166, 254, 160, 13 },
-        { 167, 193, 127, 240, 6 },
-        { 176, 87, 246, 91, 6 },
-        { 96, 255, 232, 62, 5 }, },
-      { { 111, 234, 202, 69, 7 },
-        { 175, 212, 124, 205, 8 },
-        { 234, 37, 53, 127, 6 },
-        { 27, 51, 226, 191, 5 }, },
-      { { 112, 61, 56, 166, 0 },
-        { 73, 10, 38, 176, 15 },
-        { 6, 81, 203, 192, 14 },
-        { 240, 214, 69, 9, 2 }, },
-      { { 118, 108, 53, 231, 8 },
-        { 153, 13, 35, 189, 15 },
-        { 30, 122, 195, 102, 14 },
-        { 251, 220, 75, 9, 9 }, },
-      { { 112, 74, 13, 255, 6 },
-        { 24, 61, 238, 140, 11 },
-        { 111, 251, 5, 32, 14 },
-        { 211, 23, 123, 193, 8 }, },
-      { { 117, 120, 169, 200, 0 },
-        { 209, 172, 36, 200, 14 },
-        { 1, 57, 81, 234, 14 },
-        { 113, 50, 67, 88, 11 }, },
-      { { 113, 74, 112, 19, 8 },
-        { 32, 12, 169, 212, 13 },
-        { 28, 128, 229, 40, 14 },
-        { 178, 185, 83, 0, 4 }, },
-      { { 117, 127, 140, 187, 9 },
-        { 197, 175, 175, 228, 11 },
-        { 157, 211, 31, 234, 14 },
-        { 210, 127, 95, 90, 3 }, },
-      { { 124, 35, 104, 51, 1 },
-        { 167, 10, 174, 132, 5 },
-        { 140, 193, 108, 67, 14 },
-        { 162, 23, 85, 14, 5 }, },
-      { { 124, 181, 167, 211, 1 },
-        { 215, 203, 176, 172, 7 },
-        { 140, 190, 90, 211, 14 },
-        { 227, 80, 221, 62, 11 }, },
-      { { 124, 248, 44, 237, 14 },
-        { 203, 61, 119, 140, 14 },
-        { 123, 115, 65, 243, 14 },
-        { 115, 30, 235, 205, 3 }, },
-      { { 127, 36, 226, 52, 15 },
-        { 175, 216, 227, 225, 4 },
-        { 242, 196, 114, 79, 14 },
-        { 40, 124, 113, 191, 5 }, },
-      { { 127, 71, 41, 141, 8 },
-        { 154, 46, 45, 229, 6 },
-        { 27, 25, 78, 47, 14 },
-        { 106, 123, 71, 69, 9 }, },
-      { { 134, 216, 3, 209, 9 },
-        { 212, 68, 145, 15, 10 },
-        { 152, 188, 1, 182, 1 },
-        { 95, 8, 146, 34, 11 }, },
-      { { 131, 139, 27, 161, 3 },
-        { 20, 82, 30, 87, 10 },
-        { 200, 93, 141, 28, 1 },
-        { 94, 167, 132, 162, 8 }, },
-      { { 135, 162, 121, 197, 9 },
-        { 189, 0, 29, 95, 6 },
-        { 154, 57, 228, 94, 1 },
-        { 111, 171, 128, 11, 13 }, },
-      { { 138, 67, 100, 140, 14 },
-        { 42, 55, 73, 3, 6 },
-        { 115, 18, 108, 37, 1 },
-        { 108, 9, 46, 197, 4 }, },
-      { { 136, 147, 59, 76, 8 },
-        { 90, 98, 29, 26, 4 },
-        { 19, 45, 204, 145, 1 },
-        { 37, 139, 132, 101, 10 }, },
-      { { 143, 33, 223, 78, 3 },
-        { 191, 243, 4, 91, 1 },
-        { 199, 47, 184, 79, 1 },
-        { 141, 162, 12, 255, 13 }, },
-      { { 141, 132, 53, 114, 9 },
-        { 150, 1, 147, 122, 5 },
-        { 148, 234, 194, 27, 1 },
-        { 165, 236, 152, 6, 9 }, },
-      { { 141, 136, 215, 31, 13 },
-        { 190, 225, 209, 86, 9 },
-        { 191, 142, 177, 27, 1 },
-        { 150, 168, 184, 119, 13 }, },
-      { { 137, 159, 120, 252, 13 },
-        { 110, 34, 223, 122, 14 },
-        { 179, 241, 239, 153, 1 },
-        { 117, 239, 180, 71, 6 }, },
-      { { 146, 107, 22, 121, 12 },
-        { 1, 111, 203, 31, 8 },
-        { 57, 230, 141, 100, 9 },
-        { 31, 141, 63, 104, 0 }, },
-      { { 148, 142, 34, 241, 2 },
-        { 128, 88, 154, 46, 14 },
-        { 72, 244, 71, 18, 9 },
-        { 119, 69, 145, 160, 1 }, },
-      { { 144, 229, 230, 49, 7 },
-        { 37, 223, 210, 38, 4 },
-        { 232, 198, 122, 112, 9 },
-        { 38, 68, 191, 186, 4 }, },
-      { { 150, 216, 133, 42, 1 },
-        { 212, 173, 18, 3, 9 },
-        { 133, 74, 17, 182, 9 },
-        { 156, 4, 139, 82, 11 }, },
-      { { 149, 57, 59, 164, 6 },
-        { 217, 90, 70, 82, 14 },
-        { 98, 93, 201, 202, 9 },
-        { 116, 166, 37, 169, 11 }, },
-      { { 149, 60, 251, 77, 13 },
-        { 253, 232, 69, 126, 12 },
-        { 187, 45, 243, 202, 9 },
-        { 55, 234, 33, 123, 15 }, },
-      { { 145, 62, 170, 18, 6 },
-        { 65, 216, 204, 98, 13 },
-        { 100, 133, 87, 200, 9 },
-        { 180, 99, 49, 184, 2 }, },
-      { { 151, 111, 90, 175, 9 },
-        { 173, 110, 15, 119, 11 },
-        { 159, 85, 175, 110, 9 },
-        { 222, 239, 7, 107, 5 }, },
-      { { 145, 178, 41, 253, 10 },
-        { 89, 56, 159, 78, 6 },
-        { 91, 249, 68, 216, 9 },
-        { 103, 47, 145, 201, 10 }, },
-      { { 145, 211, 250, 118, 1 },
-        { 108, 206, 158, 90, 5 },
-        { 134, 229, 252, 184, 9 },
-        { 165, 167, 151, 51, 6 }, },
-      { { 154, 112, 134, 200, 8 },
-        { 67, 237, 1, 11, 2 },
-        { 17, 54, 16, 229, 9 },
-        { 77, 8, 11, 124, 2 }, },
-      { { 152, 142, 205, 3, 1 },
-        { 54, 137, 28, 38, 9 },
-        { 140, 11, 55, 17, 9 },
-        { 150, 67, 137, 22, 12 }, },
-      { { 152, 199, 16, 151, 10 },
-        { 10, 30, 153, 54, 3 },
-        { 94, 144, 142, 49, 9 },
-        { 198, 201, 151, 133, 0 }, },
-      { { 157, 203, 235, 70, 6 },
-        { 186, 222, 92, 74, 13 },
-        { 102, 45, 125, 59, 9 },
-        { 181, 35, 167, 181, 13 }, },
-      { { 164, 40, 245, 182, 14 },
-        { 185, 145, 227, 18, 15 },
-        { 118, 218, 241, 66, 5 },
-        { 244, 140, 120, 153, 13 }, },
-      { { 163, 55, 241, 121, 3 },
-        { 117, 178, 170, 127, 4 },
-        { 201, 232, 254, 204, 5 },
-        { 47, 229, 84, 218, 14 }, },
-      { { 163, 68, 64, 245, 10 },
-        { 40, 20, 163, 111, 2 },
-        { 90, 240, 34, 44, 5 },
-        { 79, 108, 82, 129, 4 }, },
-      { { 161, 127, 173, 133, 8 },
-        { 89, 135, 45, 102, 14 },
-        { 26, 27, 95, 232, 5 },
-        { 118, 107, 78, 25, 10 }, },
-      { { 167, 210, 150, 35, 13 },
-        { 196, 197, 123, 87, 1 },
-        { 188, 70, 148, 190, 5 },
-        { 142, 173, 234, 50, 3 }, },
-      { { 168, 69, 112, 43, 11 },
-        { 38, 54, 35, 54, 5 },
-        { 221, 64, 234, 33, 5 },
-        { 166, 204, 70, 198, 4 }, },
-      { { 174, 72, 127, 160, 9 },
-        { 182, 69, 39, 19, 14 },
-        { 144, 95, 225, 39, 5 },
-        { 124, 142, 74, 38, 13 }, },
-      { { 172, 79, 182, 214, 8 },
-        { 138, 199, 169, 58, 15 },
-        { 22, 182, 223, 35, 5 },
-        { 245, 201, 94, 53, 1 }, },
-      { { 168, 168, 211, 133, 3 },
-        { 63, 208, 48, 22, 10 },
-        { 202, 28, 177, 81, 5 },
-        { 86, 128, 192, 191, 12 }, },
-      { { 169, 139, 10, 203, 8 },
-        { 2, 98, 61, 78, 11 },
-        { 29, 53, 13, 25, 5 },
-        { 215, 43, 196, 100, 0 }, },
-      { { 173, 254, 140, 222, 2 },
-        { 203, 181, 188, 106, 11 },
-        { 71, 179, 23, 251, 5 },
-        { 213, 99, 218, 221, 3 }, },
-      { { 180, 239, 46, 46, 14 },
-        { 137, 127, 127, 34, 13 },
-        { 119, 71, 79, 114, 13 },
-        { 180, 79, 239, 233, 1 }, },
-      { { 183, 153, 137, 199, 0 },
-        { 216, 138, 52, 79, 11 },
-        { 14, 57, 25, 158, 13 },
-        { 223, 34, 197, 17, 11 }, },
-      { { 190, 12, 162, 14, 12 },
-        { 138, 232, 97, 35, 13 },
-        { 55, 4, 83, 7, 13 },
-        { 188, 72, 97, 117, 1 }, },
-      { { 188, 112, 34, 122, 9 },
-        { 199, 108, 163, 10, 5 },
-        { 149, 228, 64, 227, 13 },
-        { 165, 12, 83, 110, 3 }, },
-      { { 190, 188, 47, 145, 10 },
-        { 211, 89, 181, 39, 14 },
-        { 88, 159, 67, 215, 13 },
-        { 126, 74, 217, 172, 11 }, },
-      { { 184, 233, 10, 152, 3 },
-        { 7, 126, 180, 2, 10 },
-        { 193, 149, 9, 113, 13 },
-        { 84, 2, 215, 238, 0 }, },
-      { { 189, 10, 48, 236, 8 },
-        { 138, 40, 43, 90, 14 },
-        { 19, 112, 197, 11, 13 },
-        { 117, 173, 65, 69, 1 }, },
-      { { 194, 2, 224, 243, 1 },
-        { 36, 128, 138, 143, 7 },
-        { 140, 240, 116, 4, 3 },
-        { 239, 21, 16, 18, 4 }, },
-      { { 194, 107, 50, 227, 7 },
-        { 5, 86, 74, 159, 15 },
-        { 236, 116, 205, 100, 3 },
-        { 255, 149, 38, 170, 0 }, },
-      { { 198, 202, 66, 106, 8 },
-        { 160, 100, 27, 139, 9 },
-        { 21, 100, 37, 54, 3 },
-        { 157, 29, 130, 96, 5 }, },
-      { { 199, 30, 238, 104, 14 },
-        { 224, 241, 79, 235, 12 },
-        { 113, 103, 119, 142, 3 },
-        { 61, 127, 40, 240, 7 }, },
-      { { 199, 125, 46, 145, 3 },
-        { 197, 87, 132, 231, 14 },
-        { 200, 151, 75, 238, 3 },
-        { 126, 114, 30, 170, 3 }, },
-      { { 206, 60, 32, 116, 2 },
-        { 203, 16, 130, 171, 12 },
-        { 66, 224, 67, 199, 3 },
-        { 61, 84, 16, 141, 3 }, },
-      { { 204, 74, 185, 197, 7 },
-        { 158, 148, 76, 158, 14 },
-        { 234, 57, 213, 35, 3 },
-        { 119, 147, 34, 151, 9 }, },
-      { { 206, 247, 99, 220, 13 },
-        { 255, 102, 217, 171, 6 },
-        { 179, 188, 110, 247, 3 },
-        { 109, 89, 182, 111, 15 }, },
-      { { 205, 67, 34, 202, 2 },
-        { 130, 118, 8, 202, 7 },
-        { 69, 52, 76, 43, 3 },
-        { 229, 49, 6, 228, 1 }, },
-      { { 207, 183, 204, 29, 0 },
-        { 235, 163, 156, 231, 0 },
-        { 11, 131, 62, 223, 3 },
-        { 14, 115, 156, 93, 7 }, },
-      { { 201, 206, 200, 53, 10 },
-        { 42, 148, 159, 230, 8 },
-        { 90, 193, 55, 57, 3 },
-        { 22, 127, 146, 149, 4 }, },
-      { { 207, 243, 75, 113, 3 },
-        { 247, 86, 158, 207, 0 },
-        { 200, 237, 44, 255, 3 },
-        { 15, 55, 150, 174, 15 }, },
-      { { 214, 46, 123, 112, 13 },
-        { 181, 72, 207, 187, 12 },
-        { 176, 237, 231, 70, 11 },
-        { 61, 223, 49, 42, 13 }, },
-      { { 212, 23, 75, 59, 4 },
-        { 240, 106, 206, 166, 1 },
-        { 45, 205, 46, 130, 11 },
-        { 134, 87, 53, 96, 15 }, },
-      { { 215, 141, 250, 151, 14 },
-        { 168, 218, 213, 247, 15 },
-        { 126, 149, 251, 30, 11 },
-        { 254, 250, 181, 177, 5 }, },
-      { { 209, 216, 245, 85, 1 },
-        { 124, 141, 144, 222, 12 },
-        { 138, 170, 241, 184, 11 },
-        { 55, 176, 155, 19, 14 }, },
-      { { 213, 207, 225, 211, 9 },
-        { 180, 142, 153, 238, 15 },
-        { 156, 184, 127, 58, 11 },
-        { 247, 121, 151, 18, 13 }, },
-      { { 218, 22, 168, 204, 9 },
-        { 78, 168, 13, 171, 6 },
-        { 147, 49, 86, 133, 11 },
-        { 109, 91, 1, 87, 2 }, },
-      { { 216, 76, 68, 133, 9 },
-        { 46, 13, 1, 166, 10 },
-        { 154, 18, 35, 33, 11 },
-        { 86, 88, 11, 7, 4 }, },
-      { { 220, 217, 114, 142, 13 },
-        { 238, 110, 81, 146, 15 },
-        { 183, 20, 233, 179, 11 },
-        { 244, 152, 167, 103, 7 }, },
-      { { 223, 103, 17, 126, 8 },
-        { 155, 46, 139, 251, 1 },
-        { 23, 232, 142, 111, 11 },
-        { 141, 253, 23, 77, 9 }, },
-      { { 219, 153, 125, 230, 7 },
-        { 126, 27, 86, 219, 15 },
-        { 230, 123, 233, 157, 11 },
-        { 253, 182, 173, 135, 14 }, },
-      { { 221, 171, 142, 49, 14 },
-        { 131, 219, 223, 198, 8 },
-        { 120, 199, 29, 91, 11 },
-        { 22, 63, 189, 188, 1 }, },
-      { { 224, 25, 8, 76, 13 },
-        { 76, 34, 101, 138, 8 },
-        { 179, 33, 9, 128, 7 },
-        { 21, 26, 100, 67, 2 }, },
-      { { 230, 54, 218, 82, 1 },
-        { 229, 192, 172, 187, 1 },
-        { 132, 165, 182, 198, 7 },
-        { 141, 211, 80, 58, 7 }, },
-      { { 226, 172, 199, 155, 0 },
-        { 49, 225, 176, 167, 11 },
-        { 13, 158, 51, 84, 7 },
-        { 222, 80, 216, 120, 12 }, },
-      { { 228, 141, 33, 98, 0 },
-        { 144, 2, 50, 170, 13 },
-        { 4, 104, 75, 18, 7 },
-        { 181, 84, 196, 0, 9 }, },
-      { { 226, 254, 208, 197, 1 },
-        { 109, 132, 56, 191, 10 },
-        { 138, 48, 183, 244, 7 },
-        { 95, 209, 194, 27, 6 }, },
-      { { 225, 58, 125, 2, 10 },
-        { 113, 17, 45, 210, 13 },
-        { 84, 11, 229, 200, 7 },
-        { 180, 187, 72, 136, 14 }, },
-      { { 231, 208, 91, 142, 5 },
-        { 252, 100, 116, 211, 3 },
-        { 167, 29, 160, 190, 7 },
-        { 204, 178, 226, 99, 15 }, },
-      { { 236, 48, 156, 107, 5 },
-        { 199, 161, 102, 158, 1 },
-        { 173, 99, 144, 195, 7 },
-        { 135, 150, 104, 94, 3 }, },
-      { { 236, 170, 73, 210, 0 },
-        { 179, 0, 188, 138, 11 },
-        { 4, 185, 37, 83, 7 },
-        { 213, 19, 208, 12, 13 }, },
-      { { 238, 179, 122, 196, 6 },
-        { 235, 82, 124, 155, 6 },
-        { 98, 53, 236, 215, 7 },
-        { 109, 147, 228, 173, 7 }, },
-      { { 232, 224, 103, 46, 2 },
-        { 59, 117, 50, 130, 5 },
-        { 71, 78, 96, 113, 7 },
-        { 164, 20, 202, 237, 12 }, },
-      { { 234, 229, 213, 36, 12 },
-        { 59, 135, 115, 179, 0 },
-        { 50, 74, 186, 117, 7 },
-        { 12, 220, 238, 29, 12 }, },
-      { { 237, 107, 28, 44, 2 },
-        { 139, 55, 46, 210, 8 },
-        { 67, 67, 141, 107, 7 },
-        { 20, 183, 78, 205, 1 }, },
-      { { 235, 200, 175, 29, 6 },
-        { 26, 245, 244, 199, 12 },
-        { 107, 143, 81, 61, 7 },
-        { 62, 50, 250, 245, 8 }, },
-      { { 242, 5, 98, 212, 5 },
-        { 44, 74, 224, 171, 6 },
-        { 162, 180, 106, 4, 15 },
-        { 109, 80, 117, 35, 4 }, },
-      { { 246, 25, 188, 251, 2 },
-        { 192, 187, 166, 159, 15 },
-        { 77, 243, 217, 134, 15 },
-        { 255, 150, 93, 208, 3 }, },
-      { { 246, 163, 92, 109, 11 },
-        { 173, 59, 63, 159, 0 },
-        { 219, 99, 172, 86, 15 },
-        { 15, 159, 205, 203, 5 }, },
-      { { 244, 241, 189, 15, 0 },
-        { 217, 175, 52, 150, 5 },
-        { 15, 11, 216, 242, 15 },
-        { 166, 146, 207, 89, 11 }, },
-      { { 241, 106, 155, 67, 5 },
-        { 21, 204, 108, 222, 9 },
-        { 172, 45, 149, 104, 15 },
-        { 151, 179, 99, 58, 8 }, },
-      { { 241, 178, 145, 41, 14 },
-        { 81, 184, 123, 214, 0 },
-        { 121, 72, 148, 216, 15 },
-        { 6, 189, 225, 216, 10 }, },
-      { { 250, 84, 91, 243, 5 },
-        { 118, 76, 230, 191, 3 },
-        { 172, 253, 162, 165, 15 },
-        { 207, 214, 115, 38, 14 }, },
-      { { 254, 110, 134, 124, 6 },
-        { 139, 253, 234, 171, 8 },
-        { 99, 230, 23, 103, 15 },
-        { 29, 85, 123, 253, 1 }, },
-      { { 249, 13, 185, 67, 2 },
-        { 18, 154, 36, 254, 13 },
-        { 76, 41, 219, 9, 15 },
-        { 183, 242, 69, 148, 8 }, },
-      { { 249, 105, 102, 43, 13 },
-        { 39, 111, 99, 198, 13 },
-        { 189, 70, 105, 105, 15 },
-        { 182, 60, 111, 110, 4 }, },
-      { { 251, 65, 203, 72, 4 },
-        { 50, 238, 100, 203, 0 },
-        { 33, 45, 56, 45, 15 },
-        { 13, 50, 103, 116, 12 }, },
-      { { 253, 87, 191, 152, 5 },
-        { 214, 239, 236, 242, 6 },
-        { 161, 159, 222, 171, 15 },
-        { 100, 243, 127, 118, 11 }, },
-      { { 251, 152, 144, 126, 6 },
-        { 74, 184, 242, 219, 9 },
-        { 103, 224, 145, 157, 15 },
-        { 157, 180, 241, 213, 2 }, },
-      { { 255, 234, 33, 198, 3 },
-        { 159, 28, 56, 203, 15 },
-        { 198, 56, 69, 127, 15 },
-        { 253, 49, 195, 143, 9 }, },
-      { { 163, 165, 111, 69, 0 },
-        { 57, 67, 52, 111, 4 },
-        { 10, 47, 106, 92, 5 },
-        { 47, 98, 204, 41, 12 }, },
-      { { 161, 152, 104, 48, 2 },
-        { 96, 16, 182, 66, 12 },
-        { 64, 193, 97, 152, 5 },
-        { 52, 38, 208, 128, 6 }, },
-      { { 15, 55, 131, 43, 0 },
-        { 211, 226, 10, 101, 1 },
-        { 13, 76, 30, 207, 0 },
-        { 138, 101, 4, 124, 11 }, },
-      { { 38, 236, 72, 39, 2 },
-        { 169, 20, 54, 37, 9 },
-        { 78, 65, 35, 118, 4 },
-        { 154, 70, 194, 137, 5 }, },
-      { { 65, 152, 184, 168, 15 },
-        { 68, 176, 87, 208, 14 },
-        { 241, 81, 209, 152, 2 },
-        { 112, 190, 160, 210, 2 }, },
-      { { 78, 181, 67, 138, 4 },
-        { 243, 98, 80, 161, 3 },
-        { 37, 28, 42, 215, 2 },
-        { 200, 80, 164, 108, 15 }, },
-      { { 99, 197, 227, 123, 10 },
-        { 48, 246, 179, 237, 5 },
-        { 93, 236, 122, 60, 6 },
-        { 171, 124, 214, 240, 12 }, },
-      { { 110, 89, 221, 230, 12 },
-        { 250, 135, 103, 153, 11 },
-        { 54, 123, 185, 167, 6 },
-        { 217, 158, 110, 21, 15 }, },
-      { { 128, 212, 89, 240, 8 },
-        { 112, 4, 151, 58, 2 },
-        { 16, 249, 162, 176, 1 },
-        { 69, 206, 146, 0, 14 }, },
-      { { 152, 8, 136, 159, 13 },
-        { 14, 168, 197, 6, 11 },
-        { 191, 145, 17, 1, 9 },
-        { 214, 10, 49, 87, 0 }, },
-      { { 163, 6, 103, 166, 15 },
-        { 60, 81, 107, 99, 7 },
-        { 246, 94, 102, 12, 5 },
-        { 236, 109, 104, 163, 12 }, },
-      { { 2, 25, 166, 20, 7 },
-        { 76, 211, 192, 1, 12 },
-        { 226, 134, 89, 132, 0 },
-        { 56, 0, 60, 179, 2 }, },
-      { { 2, 21, 202, 78, 2 },
-        { 104, 242, 4, 41, 1 },
-        { 71, 37, 58, 132, 0 },
-        { 137, 66, 4, 241, 6 }, },
-      { { 0, 104, 204, 57, 9 },
-        { 37, 165, 135, 4, 8 },
-        { 153, 195, 49, 96, 0 },
-        { 18, 14, 26, 90, 4 }, },
-      { { 0, 161, 19, 254, 8 },
-        { 25, 98, 147, 24, 3 },
-        { 23, 252, 136, 80, 0 },
-        { 193, 140, 148, 105, 8 }, },
-      { { 2, 185, 86, 117, 5 },
-        { 109, 67, 210, 29, 8 },
-        { 170, 230, 169, 212, 0 },
-        { 27, 132, 188, 43, 6 }, },
-      { { 2, 198, 187, 83, 2 },
-        { 16, 212, 156, 61, 5 },
-        { 76, 173, 214, 52, 0 },
-        { 171, 195, 146, 176, 8 }, },
-      { { 2, 243, 31, 29, 9 },
-        { 93, 103, 157, 21, 0 },
-        { 155, 143, 140, 244, 0 },
-        { 10, 139, 158, 107, 10 }, },
-      { { 7, 42, 193, 126, 3 },
-        { 189, 176, 138, 73, 9 },
-        { 199, 232, 53, 78, 0 },
-        { 153, 37, 16, 219, 13 }, },
-      { { 7, 55, 141, 151, 2 },
-        { 217, 147, 140, 101, 3 },
-        { 78, 155, 30, 206, 0 },
-        { 202, 99, 28, 153, 11 }, },
-      { { 1, 111, 31, 231, 5 },
-        { 29, 71, 78, 124, 11 },
-        { 174, 127, 143, 104, 0 },
-        { 211, 231, 46, 43, 8 }, },
-      { { 1, 119, 48, 21, 5 },
-        { 77, 6, 200, 116, 4 },
-        { 170, 128, 206, 232, 0 },
-        { 34, 225, 54, 11, 2 }, },
-      { { 7, 149, 114, 65, 10 },
-        { 224, 82, 17, 125, 4 },
-        { 88, 36, 234, 158, 0 },
-        { 43, 232, 132, 160, 7 }, },
-      { { 7, 200, 163, 134, 14 },
-        { 152, 212, 81, 65, 15 },
-        { 118, 28, 81, 62, 0 },
-        { 248, 40, 162, 177, 9 }, },
-      { { 5, 254, 251, 247, 9 },
-        { 253, 196, 159, 124, 15 },
-        { 158, 253, 247, 250, 0 },
-        { 243, 239, 146, 59, 15 }, },
-      { { 12, 21, 243, 16, 1 },
-        { 246, 194, 128, 48, 4 },
-        { 128, 140, 250, 131, 0 },
-        { 32, 192, 20, 54, 15 }, },
-      { { 10, 68, 98, 226, 14 },
-        { 34, 84, 67, 41, 7 },
-        { 116, 116, 98, 37, 0 },
-        { 233, 76, 34, 164, 4 }, },
-      { { 8, 94, 55, 238, 9 },
-        { 94, 101, 11, 56, 15 },
-        { 151, 126, 199, 161, 0 },
-        { 241, 205, 10, 103, 10 }, },
-      { { 8, 82, 222, 18, 13 },
-        { 102, 197, 205, 16, 1 },
-        { 180, 135, 180, 161, 0 },
-        { 128, 139, 58, 54, 6 }, },
-      { { 12, 102, 136, 3, 9 },
-        { 135, 132, 13, 36, 1 },
-        { 156, 1, 22, 99, 0 },
-        { 130, 75, 2, 30, 1 }, },
-      { { 8, 140, 186, 71, 15 },
-        { 14, 208, 85, 60, 13 },
-        { 254, 37, 211, 17, 0 },
-        { 179, 202, 160, 183, 0 }, },
-      { { 12, 172, 39, 30, 5 },
-        { 159, 97, 208, 32, 13 },
-        { 167, 142, 67, 83, 0 },
-        { 176, 64, 184, 111, 9 }, },
-      { { 8, 179, 56, 11, 15 },
-        { 71, 50, 93, 20, 5 },
-        { 253, 1, 204, 209, 0 },
-        { 162, 139, 164, 206, 2 }, },
-      { { 12, 162, 165, 217, 4 },
-        { 147, 161, 216, 12, 6 },
-        { 41, 186, 84, 83, 0 },
-        { 99, 1, 184, 92, 9 }, },
-      { { 8, 227, 82, 192, 1 },
-        { 39, 70, 24, 24, 2 },
-        { 128, 52, 172, 113, 0 },
-        { 65, 129, 134, 46, 4 }, },
-      { { 14, 255, 68, 245, 14 },
-        { 235, 23, 219, 45, 10 },
-        { 122, 242, 47, 247, 0 },
-        { 91, 77, 190, 141, 7 }, },
-      { { 14, 255, 93, 234, 11 },
-        { 247, 55, 31, 57, 11 },
-        { 213, 123, 175, 247, 0 },
-        { 217, 207, 142, 206, 15 }, },
-      { { 11, 52, 109, 201, 14 },
-        { 115, 49, 69, 109, 6 },
-        { 121, 59, 98, 205, 0 },
-        { 107, 106, 40, 204, 14 }, },
-      { { 13, 9, 254, 187, 3 },
-        { 166, 243, 134, 84, 15 },
-        { 205, 215, 249, 11, 0 },
-        { 242, 166, 28, 246, 5 }, },
-      { { 15, 16, 170, 146, 6 },
-        { 194, 208, 196, 65, 7 },
-        { 100, 149, 80, 143, 0 },
-        { 232, 34, 48, 180, 3 }, },
-      { { 13, 31, 101, 167, 14 },
-        { 250, 19, 75, 100, 15 },
-        { 126, 90, 111, 139, 0 },
-        { 242, 109, 44, 133, 15 }, },
-      { { 15, 177, 95, 160, 0 },
-        { 243, 67, 22, 81, 2 },
-        { 0, 95, 168, 223, 0 },
-        { 72, 166, 140, 44, 15 }, },
-      { { 13, 162, 5, 35, 3 },
-        { 151, 17, 26, 68, 1 },
-        { 204, 74, 4, 91, 0 },
-        { 130, 37, 136, 142, 9 }, },
-      { { 13, 175, 35, 219, 11 },
-        { 151, 114, 153, 108, 15 },
-        { 221, 188, 79, 91, 0 },
-        { 243, 105, 148, 238, 9 }, },
-      { { 11, 240, 165, 238, 4 },
-        { 91, 165, 82, 73, 7 },
-        { 39, 122, 80, 253, 0 },
-        { 233, 36, 170, 93, 10 }, },
-      { { 13, 200, 153, 251, 14 },
-        { 146, 180, 215, 92, 11 },
-        { 125, 249, 145, 59, 0 },
-        { 211, 174, 178, 212, 9 }, },
-      { { 15, 253, 48, 39, 7 },
-        { 207, 22, 82, 117, 13 },
-        { 238, 64, 203, 255, 0 },
-        { 186, 228, 166, 143, 3 }, },
-      { { 11, 199, 93, 86, 2 },
-        { 58, 23, 156, 121, 1 },
-        { 70, 171, 174, 61, 0 },
-        { 137, 227, 158, 133, 12 }, },
-      { { 18, 47, 163, 1, 13 },
-        { 21, 202, 73, 37, 12 },
-        { 184, 12, 95, 68, 8 },
-        { 58, 73, 37, 58, 8 }, },
-      { { 18, 117, 72, 114, 5 },
-        { 101, 14, 198, 41, 1 },
-        { 164, 225, 42, 228, 8 },
-        { 137, 70, 55, 10, 6 }, },
-      { { 16, 79, 174, 98, 7 },
-        { 4, 223, 78, 40, 13 },
-        { 228, 103, 95, 32, 8 },
-        { 177, 71, 47, 178, 0 }, },
-      { { 16, 140, 138, 232, 11 },
-        { 4, 248, 23, 40, 10 },
-        { 209, 117, 19, 16, 8 },
-        { 81, 78, 129, 242, 0 }, },
-      { { 16, 243, 244, 46, 14 },
-        { 105, 191, 91, 16, 5 },
-        { 119, 66, 252, 240, 8 },
-        { 160, 141, 175, 217, 6 }, },
-      { { 19, 55, 238, 112, 2 },
-        { 97, 219, 142, 105, 4 },
-        { 64, 231, 126, 204, 8 },
-        { 41, 103, 29, 184, 6 }, },
-      { { 23, 11, 35, 235, 0 },
-        { 144, 106, 10, 77, 15 },
-        { 13, 124, 77, 14, 8 },
-        { 251, 37, 5, 96, 9 }, },
-      { { 21, 2, 111, 27, 11 },
-        { 180, 121, 141, 68, 5 },
-        { 221, 143, 100, 10, 8 },
-        { 162, 43, 25, 226, 13 }, },
-      { { 17, 161, 171, 203, 2 },
-        { 17, 250, 20, 76, 7 },
-        { 77, 61, 88, 88, 8 },
-        { 227, 34, 133, 248, 8 }, },
-      { { 19, 166, 74, 200, 13 },
-        { 37, 104, 93, 105, 2 },
-        { 177, 53, 38, 92, 8 },
-        { 73, 107, 161, 106, 4 }, },
-      { { 23, 142, 53, 205, 3 },
-        { 156, 57, 24, 125, 14 },
-        { 203, 58, 199, 30, 8 },
-        { 123, 225, 137, 195, 9 }, },
-      { { 21, 139, 229, 157, 12 },
-        { 184, 171, 217, 68, 14 },
-        { 59, 154, 125, 26, 8 },
-        { 114, 41, 189, 81, 13 }, },
-      { { 23, 166, 249, 125, 4 },
-        { 185, 168, 222, 125, 4 },
-        { 43, 233, 246, 94, 8 },
-        { 43, 231, 177, 89, 13 }, },
-      { { 21, 220, 164, 180, 4 },
-        { 200, 141, 210, 96, 14 },
-        { 34, 210, 83, 186, 8 },
-        { 112, 100, 187, 17, 3 }, },
-      { { 17, 223, 5, 67, 12 },
-        { 80, 15, 89, 108, 9 },
-        { 60, 42, 15, 184, 8 },
-        { 147, 105, 175, 0, 10 }, },
-      { { 21, 210, 1, 147, 5 },
-        { 212, 12, 216, 68, 3 },
-        { 172, 152, 4, 186, 8 },
-        { 194, 33, 179, 2, 11 }, },
-      { { 24, 31, 173, 250, 10 },
-        { 82, 187, 143, 40, 15 },
-        { 85, 251, 95, 129, 8 },
-        { 241, 79, 29, 212, 10 }, },
-      { { 28, 64, 14, 171, 13 },
-        { 134, 109, 71, 4, 3 },
-        { 189, 87, 0, 35, 8 },
-        { 194, 14, 43, 102, 1 }, },
-      { { 30, 76, 93, 61, 2 },
-        { 186, 61, 134, 53, 8 },
-        { 75, 203, 163, 39, 8 },
-        { 26, 198, 27, 197, 13 }, },
-      { { 24, 111, 246, 127, 9 },
-        { 47, 239, 139, 60, 13 },
-        { 159, 230, 255, 97, 8 },
-        { 179, 205, 31, 127, 4 }, },
-      { { 24, 87, 52, 184, 15 },
-        { 70, 63, 203, 48, 6 },
-        { 241, 210, 206, 161, 8 },
-        { 96, 205, 63, 198, 2 }, },
-      { { 30, 86, 137, 227, 4 },
-        { 210, 140, 78, 45, 3 },
-        { 44, 121, 22, 167, 8 },
-        { 203, 71, 35, 20, 11 }, },
-      { { 26, 149, 209, 132, 5 },
-        { 126, 138, 80, 49, 2 },
-        { 162, 24, 186, 149, 8 },
-        { 72, 192, 165, 23, 14 }, },
-      { { 24, 167, 255, 2, 10 },
-        { 51, 219, 29, 48, 5 },
-        { 84, 15, 254, 81, 8 },
-        { 160, 203, 141, 188, 12 }, },
-      { { 24, 158, 177, 201, 14 },
-        { 82, 184, 89, 60, 14 },
-        { 121, 56, 215, 145, 8 },
-        { 115, 201, 161, 212, 10 }, },
-      { { 28, 178, 10, 96, 10 },
-        { 195, 88, 31, 8, 0 },
-        { 80, 101, 4, 211, 8 },
-        { 1, 15, 129, 172, 3 }, },
-      { { 28, 146, 53, 136, 1 },
-        { 214, 41, 24, 16, 6 },
-        { 129, 26, 196, 147, 8 },
-        { 96, 129, 137, 70, 11 }, },
-      { { 28, 147, 183, 214, 13 },
-        { 222, 203, 217, 24, 7 },
-        { 182, 190, 220, 147, 8 },
-        { 225, 137, 189, 55, 11 }, },
-      { { 26, 202, 188, 88, 1 },
-        { 6, 173, 156, 25, 12 },
-        { 129, 163, 213, 53, 8 },
-        { 57, 131, 155, 86, 0 }, },
-      { { 28, 226, 172, 181, 8 },
-        { 139, 141, 159, 4, 6 },
-        { 26, 211, 84, 115, 8 },
-        { 98, 15, 155, 29, 1 }, },
-      { { 27, 121, 237, 6, 4 },
-        { 123, 143, 68, 65, 13 },
-        { 38, 11, 121, 237, 8 },
-        { 184, 34, 47, 29, 14 }, },
-      { { 31, 106, 57, 19, 2 },
-        { 147, 28, 140, 85, 13 },
-        { 76, 137, 197, 111, 8 },
-        { 186, 163, 19, 140, 9 }, },
-      { { 29, 152, 56, 117, 0 },
-        { 202, 8, 150, 92, 12 },
-        { 10, 225, 193, 155, 8 },
-        { 51, 166, 145, 5, 3 }, },
-      { { 32, 13, 193, 3, 15 },
-        { 52, 146, 97, 36, 9 },
-        { 252, 8, 59, 0, 4 },
-        { 146, 72, 100, 146, 12 }, },
-      { { 38, 53, 212, 232, 0 },
-        { 225, 163, 34, 57, 2 },
-        { 1, 114, 186, 198, 4 },
-        { 73, 196, 76, 88, 7 }, },
-      { { 38, 117, 44, 47, 8 },
-        { 201, 39, 39, 37, 5 },
-        { 31, 67, 74, 230, 4 },
-        { 170, 78, 78, 73, 3 }, },
-      { { 32, 83, 133, 143, 6 },
-        { 88, 183, 104, 4, 3 },
-        { 111, 26, 28, 160, 4 },
-        { 194, 1, 110, 209, 10 }, },
-      { { 34, 136, 31, 122, 3 },
-        { 20, 113, 182, 25, 9 },
-        { 197, 239, 129, 20, 4 },
-        { 153, 134, 216, 226, 8 }, },
-      { { 39, 44, 250, 229, 5 },
-        { 173, 192, 102, 125, 14 },
-        { 170, 117, 243, 78, 4 },
-        { 123, 230, 96, 59, 5 }, },
-      { { 33, 107, 76, 67, 11 },
-        { 37, 23, 45, 76, 9 },
-        { 220, 35, 45, 104, 4 },
-        { 147, 43, 78, 138, 4 }, },
-      { { 37, 188, 103, 11, 10 },
-        { 241, 113, 49, 100, 13 },
-        { 93, 14, 99, 218, 4 },
-        { 178, 104, 200, 232, 15 }, },
-      { { 33, 163, 233, 176, 14 },
-        { 49, 146, 255, 64, 6 },
-        { 112, 217, 124, 88, 4 },
-        { 96, 47, 244, 152, 12 }, },
-      { { 33, 150, 242, 145, 15 },
-        { 100, 208, 249, 116, 6 },
-        { 248, 148, 246, 152, 4 },
-        { 98, 233, 240, 178, 6 }, },
-      { { 39, 162, 43, 140, 10 },
-        { 153, 112, 61, 65, 6 },
-        { 83, 29, 68, 94, 4 },
-        { 104, 43, 192, 233, 9 }, },
-      { { 39, 159, 72, 50, 8 },
-        { 224, 2, 191, 97, 9 },
-        { 20, 193, 47, 158, 4 },
-        { 152, 111, 212, 0, 7 }, },
-      { { 35, 226, 188, 201, 7 },
-        { 5, 181, 124, 93, 6 },
-        { 233, 51, 212, 124, 4 },
-        { 107, 163, 234, 218, 0 }, },
-      { { 33, 194, 87, 244, 1 },
-        { 60, 69, 186, 88, 2 },
-        { 130, 254, 164, 56, 4 },
-        { 65, 165, 218, 35, 12 }, },
-      { { 39, 207, 186, 248, 11 },
-        { 132, 246, 191, 121, 14 },
-        { 209, 245, 223, 62, 4 },
-        { 121, 239, 214, 242, 1 }, },
-      { { 42, 47, 189, 228, 11 },
-        { 31, 147, 47, 57, 14 },
-        { 210, 123, 223, 69, 4 },
-        { 121, 207, 76, 159, 8 }, },
-      { { 42, 84, 58, 140, 12 },
-        { 74, 100, 101, 49, 6 },
-        { 51, 21, 194, 165, 4 },
-        { 104, 202, 98, 101, 2 }, },
-      { { 42, 209, 187, 151, 15 },
-        { 94, 214, 245, 21, 7 },
-        { 254, 157, 216, 181, 4 },
-        { 234, 138, 246, 183, 10 }, },
-      { { 40, 255, 58, 99, 1 },
-        { 71, 70, 62, 60, 13 },
-        { 140, 101, 207, 241, 4 },
-        { 179, 199, 198, 46, 2 }, },
-      { { 43, 84, 197, 185, 8 },
-        { 114, 165, 163, 101, 2 },
-        { 25, 218, 50, 173, 4 },
-        { 74, 108, 90, 84, 14 }, },
-      { { 45, 97, 175, 26, 10 },
-        { 147, 247, 165, 64, 5 },
-        { 85, 143, 88, 107, 4 },
-        { 160, 42, 94, 252, 9 }, },
-      { { 43, 188, 219, 62, 6 },
-        { 123, 240, 246, 113, 9 },
-        { 103, 205, 179, 221, 4 },
-        { 152, 230, 240, 253, 14 }, },
-      { { 45, 159, 154, 13, 2 },
-        { 202, 242, 60, 116, 8 },
-        { 75, 5, 159, 155, 4 },
-        { 18, 227, 196, 245, 3 }, },
-      { { 47, 187, 114, 106, 3 },
-        { 231, 114, 58, 89, 13 },
-        { 197, 100, 237, 223, 4 },
-        { 185, 165, 196, 238, 7 }, },
-      { { 43, 217, 204, 255, 7 },
-        { 110, 183, 246, 77, 11 },
-        { 239, 243, 57, 189, 4 },
-        { 219, 38, 254, 215, 6 }, },
-      { { 41, 198, 223, 142, 12 },
-        { 58, 229, 125, 112, 3 },
-        { 55, 31, 182, 57, 4 },
-        { 192, 235, 234, 117, 12 }, },
-      { { 52, 12, 63, 195, 5 },
-        { 148, 73, 100, 60, 15 },
-        { 172, 63, 195, 2, 12 },
-        { 243, 194, 105, 34, 9 }, },
-      { { 48, 3, 27, 40, 14 },
-        { 16, 122, 111, 16, 0 },
-        { 113, 77, 140, 0, 12 },
-        { 0, 143, 101, 224, 8 }, },
-      { { 48, 113, 29, 236, 3 },
-        { 93, 63, 38, 24, 2 },
-        { 195, 123, 136, 224, 12 },
-        { 65, 134, 79, 203, 10 }, },
-      { { 52, 76, 222, 162, 10 },
-        { 160, 221, 39, 48, 11 },
-        { 84, 87, 179, 34, 12 },
-        { 208, 206, 75, 176, 5 }, },
-      { { 50, 122, 138, 139, 12 },
-        { 65, 236, 109, 5, 11 },
-        { 61, 21, 21, 228, 12 },
-        { 218, 11, 99, 120, 2 }, },
-      { { 54, 87, 99, 215, 2 },
-        { 248, 94, 168, 45, 7 },
-        { 78, 188, 110, 166, 12 },
-        { 235, 65, 87, 161, 15 }, },
-      { { 52, 141, 50, 170, 6 },
-        { 128, 122, 114, 48, 15 },
-        { 101, 84, 203, 18, 12 },
-        { 240, 196, 229, 224, 1 }, },
-      { { 54, 129, 250, 177, 1 },
-        { 164, 202, 182, 21, 6 },
-        { 136, 213, 248, 22, 12 },
-        { 106, 134, 213, 50, 5 }, },
-      { { 54, 153, 111, 21, 13 },
-        { 252, 75, 245, 5, 12 },
-        { 186, 143, 105, 150, 12 },
-        { 58, 10, 253, 35, 15 }, },
-      { { 50, 204, 108, 49, 14 },
-        { 32, 29, 247, 37, 12 },
-        { 120, 195, 99, 52, 12 },
-        { 58, 78, 251, 128, 4 }, },
-      { { 54, 224, 7, 77, 4 },
-        { 153, 109, 112, 13, 0 },
-        { 43, 46, 0, 118, 12 },
-        { 11, 0, 235, 105, 9 }, },
-      { { 51, 64, 141, 156, 5 },
-        { 28, 173, 228, 65, 2 },
-        { 163, 155, 16, 44, 12 },
-        { 72, 34, 123, 83, 8 }, },
-      { { 51, 125, 174, 182, 10 },
-        { 73, 223, 167, 97, 15 },
-        { 86, 215, 91, 236, 12 },
-        { 248, 110, 95, 185, 2 }, },
-      { { 49, 94, 255, 61, 1 },
-        { 124, 237, 174, 116, 12 },
-        { 139, 207, 247, 168, 12 },
-        { 50, 231, 91, 115, 14 }, },
-      { { 53, 164, 249, 40, 11 },
-        { 181, 184, 55, 112, 4 },
-        { 209, 73, 242, 90, 12 },
-        { 32, 238, 193, 218, 13 }, },
-      { { 51, 134, 161, 198, 4 },
-        { 24, 136, 120, 105, 7 },
-        { 38, 56, 86, 28, 12 },
-        { 233, 97, 225, 17, 8 }, },
-      { { 53, 232, 26, 158, 12 },
-        { 137, 108, 245, 80, 11 },
-        { 55, 149, 129, 122, 12 },
-        { 208, 170, 243, 105, 1 }, },
-      { { 55, 216, 88, 186, 3 },
-        { 228, 60, 182, 81, 11 },
-        { 197, 209, 161, 190, 12 },
-        { 216, 166, 211, 194, 7 }, },
-      { { 56, 21, 51, 89, 12 },
-        { 82, 106, 225, 60, 4 },
-        { 57, 172, 202, 129, 12 },
-        { 35, 200, 117, 100, 10 }, },
-      { { 56, 27, 98, 106, 12 },
-        { 98, 106, 107, 8, 13 },
-        { 53, 100, 109, 129, 12 },
-        { 177, 13, 101, 100, 6 }, },
-      { { 58, 54, 80, 219, 10 },
-        { 99, 56, 169, 61, 3 },
-        { 93, 176, 166, 197, 12 },
-        { 203, 201, 81, 204, 6 }, },
-      { { 56, 136, 209, 242, 9 },
-        { 54, 136, 179, 24, 11 },
-        { 148, 248, 177, 17, 12 },
-        { 209, 140, 209, 22, 12 }, },
-      { { 58, 204, 141, 200, 2 },
-        { 18, 189, 52, 41, 10 },
-        { 65, 59, 19, 53, 12 },
-        { 89, 66, 203, 212, 8 }, },
-      { { 60, 252, 249, 7, 11 },
-        { 255, 156, 53, 52, 13 },
-        { 222, 9, 243, 243, 12 },
-        { 178, 202, 195, 159, 15 }, },
-      { { 60, 246, 137, 57, 12 },
-        { 211, 172, 255, 36, 0 },
-        { 57, 201, 22, 243, 12 },
-        { 2, 79, 243, 92, 11 }, },
-      { { 59, 15, 174, 199, 9 },
-        { 14, 203, 45, 109, 15 },
-        { 158, 55, 95, 13, 12 },
-        { 251, 107, 77, 55, 0 }, },
-      { { 61, 11, 95, 245, 6 },
-        { 186, 91, 238, 92, 10 },
-        { 106, 255, 173, 11, 12 },
-        { 83, 167, 125, 165, 13 }, },
-      { { 57, 73, 131, 170, 6 },
-        { 18, 254, 98, 64, 11 },
-        { 101, 92, 25, 41, 12 },
-        { 208, 36, 103, 244, 8 }, },
-      { { 61, 92, 175, 229, 6 },
-        { 218, 221, 102, 108, 14 },
-        { 106, 127, 83, 171, 12 },
-        { 115, 102, 107, 181, 11 }, },
-      { { 59, 111, 209, 254, 2 },
-        { 59, 190, 170, 121, 11 },
-        { 71, 248, 191, 109, 12 },
-        { 217, 229, 87, 221, 12 }, },
-      { { 61, 114, 229, 206, 7 },
-        { 255, 189, 104, 72, 7 },
-        { 231, 58, 116, 235, 12 },
-        { 225, 33, 107, 223, 15 }, },
-      { { 59, 165, 24, 48, 4 },
-        { 3, 10, 246, 113, 0 },
-        { 32, 193, 138, 93, 12 },
-        { 8, 230, 245, 12, 0 }, },
-      { { 59, 215, 215, 116, 14 },
-        { 122, 223, 251, 121, 0 },
-        { 114, 238, 190, 189, 12 },
-        { 9, 237, 255, 181, 14 }, },
-      { { 66, 21, 7, 134, 1 },
-        { 92, 67, 0, 161, 3 },
-        { 134, 30, 10, 132, 2 },
-        { 200, 80, 12, 35, 10 }, },
-      { { 68, 42, 51, 204, 5 },
-        { 157, 96, 72, 152, 14 },
-        { 163, 60, 197, 66, 2 },
-        { 113, 145, 32, 107, 9 }, },
-      { { 64, 105, 62, 32, 12 },
-        { 1, 71, 71, 144, 12 },
-        { 48, 71, 201, 96, 2 },
-        { 48, 158, 46, 40, 0 }, },
-      { { 68, 76, 84, 241, 12 },
-        { 160, 5, 195, 188, 10 },
-        { 56, 242, 163, 34, 2 },
-        { 83, 220, 58, 0, 5 }, },
-      { { 64, 78, 207, 5, 5 },
-        { 60, 197, 76, 164, 8 },
-        { 170, 15, 55, 32, 2 },
-        { 18, 83, 42, 51, 12 }, },
-      { { 64, 223, 74, 196, 6 },
-        { 104, 86, 92, 168, 10 },
-        { 98, 53, 47, 176, 2 },
-        { 81, 83, 166, 161, 6 }, },
-      { { 70, 218, 103, 26, 14 },
-        { 240, 117, 217, 129, 13 },
-        { 117, 142, 101, 182, 2 },
-        { 184, 25, 186, 224, 15 }, },
-      { { 67, 32, 239, 178, 13 },
-        { 53, 193, 199, 193, 7 },
-        { 180, 223, 112, 76, 2 },
-        { 232, 62, 56, 58, 12 }, },
-      { { 65, 99, 121, 242, 7 },
-        { 53, 22, 206, 216, 7 },
-        { 228, 249, 236, 104, 2 },
-        { 225, 183, 54, 138, 12 }, },
-      { { 71, 127, 169, 44, 10 },
-        { 217, 182, 15, 225, 12 },
-        { 83, 73, 95, 238, 2 },
-        { 56, 127, 6, 217, 11 }, },
-      { { 67, 168, 36, 115, 10 },
-        { 1, 17, 147, 205, 13 },
-        { 92, 226, 65, 92, 2 },
-        { 187, 60, 152, 136, 0 }, },
-      { { 69, 174, 2, 166, 1 },
-        { 141, 64, 26, 224, 11 },
-        { 134, 84, 7, 90, 2 },
-        { 208, 117, 128, 43, 1 }, },
-      { { 72, 29, 125, 107, 6 },
-        { 114, 51, 70, 188, 13 },
-        { 109, 107, 235, 129, 2 },
-        { 179, 214, 44, 196, 14 }, },
-      { { 72, 68, 41, 14, 4 },
-        { 26, 36, 68, 160, 5 },
-        { 39, 9, 66, 33, 2 },
-        { 160, 82, 34, 69, 8 }, },
-      { { 76, 93, 176, 242, 6 },
-        { 194, 150, 194, 184, 15 },
-        { 100, 240, 219, 163, 2 },
-        { 241, 212, 54, 148, 3 }, },
-      { { 72, 79, 166, 76, 0 },
-        { 10, 231, 8, 168, 12 },
-        { 3, 38, 95, 33, 2 },
-        { 49, 81, 14, 117, 0 }, },
-      { { 72, 129, 242, 45, 11 },
-        { 46, 242, 19, 148, 4 },
-        { 219, 68, 248, 17, 2 },
-        { 34, 156, 132, 247, 4 }, },
-      { { 72, 140, 105, 154, 11 },
-        { 54, 48, 149, 160, 15 },
-        { 213, 153, 99, 17, 2 },
-        { 240, 90, 144, 198, 12 }, },
-      { { 76, 230, 39, 197, 2 },
-        { 155, 85, 24, 172, 6 },
-        { 74, 62, 70, 115, 2 },
-        { 99, 81, 138, 173, 9 }, },
-      { { 79, 61, 163, 205, 7 },
-        { 223, 242, 64, 237, 14 },
-        { 235, 60, 91, 207, 2 },
-        { 123, 112, 36, 255, 11 }, },
-      { { 73, 73, 253, 184, 8 },
-        { 50, 167, 135, 208, 14 },
-        { 17, 219, 249, 41, 2 },
-        { 112, 190, 30, 84, 12 }, },
-      { { 77, 89, 111, 25, 7 },
-        { 246, 119, 196, 196, 12 },
-        { 233, 143, 105, 171, 2 },
-        { 50, 50, 62, 230, 15 }, },
-      { { 79, 79, 213, 39, 11 },
-        { 190, 151, 11, 245, 9 },
-        { 222, 74, 191, 47, 2 },
-        { 154, 253, 14, 151, 13 }, },
-      { { 75, 148, 100, 228, 11 },
-        { 110, 17, 19, 233, 6 },
-        { 210, 114, 98, 157, 2 },
-        { 105, 124, 136, 135, 6 }, },
-      { { 77, 160, 106, 169, 14 },
-        { 163, 112, 87, 196, 6 },
-        { 121, 85, 96, 91, 2 },
-        { 98, 62, 160, 236, 5 }, },
-      { { 75, 146, 209, 251, 2 },
-        { 114, 176, 154, 221, 3 },
-        { 77, 248, 180, 157, 2 },
-        { 203, 181, 144, 212, 14 }, },
-      { { 79, 237, 128, 190, 11 },
-        { 143, 182, 147, 225, 11 },
-        { 215, 208, 27, 127, 2 },
-        { 216, 124, 150, 223, 1 }, },
-      { { 73, 250, 110, 175, 3 },
-        { 111, 117, 30, 196, 15 },
-        { 207, 87, 101, 249, 2 },
-        { 242, 55, 138, 239, 6 }, },
-      { { 84, 32, 172, 167, 7 },
-        { 141, 153, 70, 132, 7 },
-        { 238, 83, 80, 66, 10 },
-        { 226, 22, 41, 155, 1 }, },
-      { { 84, 25, 164, 142, 8 },
-        { 200, 171, 1, 128, 15 },
-        { 23, 18, 89, 130, 10 },
-        { 240, 24, 13, 81, 3 }, },
-      { { 86, 116, 218, 31, 8 },
-        { 233, 236, 133, 181, 1 },
-        { 31, 133, 178, 230, 10 },
-        { 138, 218, 19, 121, 7 }, },
-      { { 82, 70, 69, 212, 11 },
-        { 60, 29, 137, 169, 2 },
-        { 210, 186, 38, 36, 10 },
-        { 73, 89, 27, 131, 12 }, },
-      { { 80, 153, 112, 192, 3 },
-        { 100, 26, 16, 152, 14 },
-        { 192, 48, 233, 144, 10 },
-        { 113, 144, 133, 130, 6 }, },
-      { { 82, 162, 196, 106, 5 },
-        { 37, 169, 90, 137, 1 },
-        { 165, 98, 52, 84, 10 },
-        { 137, 21, 169, 90, 4 }, },
-      { { 80, 232, 170, 66, 4 },
-        { 1, 204, 84, 136, 13 },
-        { 36, 37, 81, 112, 10 },
-        { 177, 18, 163, 56, 0 }, },
-      { { 82, 242, 173, 89, 8 },
-        { 81, 173, 157, 141, 4 },
-        { 25, 171, 84, 244, 10 },
-        { 43, 27, 155, 88, 10 }, },
-      { { 82, 218, 235, 246, 10 },
-        { 120, 220, 159, 137, 15 },
-        { 86, 253, 117, 180, 10 },
-        { 249, 31, 147, 177, 14 }, },
-      { { 85, 46, 248, 226, 2 },
-        { 161, 152, 14, 248, 15 },
-        { 68, 113, 247, 74, 10 },
-        { 241, 247, 1, 152, 5 }, },
-      { { 81, 65, 96, 182, 2 },
-        { 40, 30, 130, 192, 7 },
-        { 70, 208, 104, 40, 10 },
-        { 224, 52, 23, 129, 4 }, },
-      { { 85, 104, 6, 21, 8 },
-        { 137, 77, 129, 196, 8 },
-        { 26, 134, 1, 106, 10 },
-        { 18, 56, 27, 41, 1 }, },
-      { { 83, 74, 126, 75, 13 },
-        { 36, 109, 77, 221, 13 },
-        { 189, 39, 229, 44, 10 },
-        { 187, 187, 43, 98, 4 }, },
-      { { 83, 107, 211, 224, 11 },
-        { 53, 222, 11, 217, 10 },
-        { 208, 124, 189, 108, 10 },
-        { 89, 189, 7, 186, 12 }, },
-      { { 87, 114, 130, 210, 7 },
-        { 197, 220, 200, 201, 3 },
-        { 228, 180, 20, 238, 10 },
-        { 201, 49, 51, 186, 3 }, },
-      { { 87, 129, 213, 88, 2 },
-        { 176, 187, 144, 217, 0 },
-        { 65, 170, 184, 30, 10 },
-        { 9, 176, 157, 208, 13 }, },
-      { { 87, 164, 195, 74, 8 },
-        { 177, 232, 17, 233, 1 },
-        { 21, 44, 50, 94, 10 },
-        { 137, 120, 129, 120, 13 }, },
-      { { 81, 151, 175, 148, 8 },
-        { 88, 203, 157, 224, 6 },
-        { 18, 159, 94, 152, 10 },
-        { 96, 123, 157, 49, 10 }, },
-      { { 87, 143, 23, 115, 11 },
-        { 148, 91, 155, 253, 9 },
-        { 220, 238, 143, 30, 10 },
-        { 155, 253, 157, 162, 9 }, },
-      { { 85, 194, 224, 207, 0 },
-        { 168, 172, 24, 204, 7 },
-        { 15, 48, 116, 58, 10 },
-        { 227, 49, 131, 81, 5 }, },
-      { { 87, 246, 164, 229, 1 },
-        { 205, 141, 26, 237, 6 },
-        { 138, 114, 86, 254, 10 },
-        { 107, 117, 139, 27, 3 }, },
-      { { 92, 5, 94, 2, 5 },
-        { 166, 75, 68, 176, 1 },
-        { 164, 7, 170, 3, 10 },
-        { 128, 210, 45, 38, 5 }, },
-      { { 94, 56, 204, 77, 0 },
-        { 235, 169, 4, 141, 8 },
-        { 11, 35, 49, 199, 10 },
-        { 27, 18, 9, 93, 7 }, },
-      { { 94, 101, 102, 31, 5 },
-        { 175, 111, 192, 165, 5 },
-        { 175, 134, 106, 103, 10 },
-        { 170, 80, 63, 111, 5 }, },
-      { { 90, 165, 235, 123, 5 },
-        { 55, 234, 214, 173, 5 },
-        { 173, 237, 122, 85, 10 },
-        { 171, 86, 181, 126, 12 }, },
-      { { 94, 173, 81, 224, 13 },
-        { 183, 10, 83, 185, 10 },
-        { 176, 120, 171, 87, 10 },
-        { 89, 220, 165, 14, 13 }, },
-      { { 88, 179, 133, 252, 1 },
-        { 95, 171, 154, 136, 2 },
-        { 131, 250, 28, 209, 10 },
-        { 65, 21, 157, 95, 10 }, },
-      { { 90, 197, 248, 110, 0 },
-        { 42, 174, 22, 185, 5 },
-        { 7, 97, 250, 53, 10 },
-        { 169, 214, 135, 85, 4 }, },
-      { { 88, 241, 107, 96, 0 },
-        { 115, 78, 22, 136, 4 },
-        { 0, 109, 104, 241, 10 },
-        { 33, 22, 135, 44, 14 }, },
-      { { 91, 48, 177, 32, 8 },
-        { 83, 136, 3, 209, 4 },
-        { 16, 72, 208, 205, 10 },
-        { 40, 188, 1, 28, 10 }, },
-      { { 95, 52, 239, 231, 11 },
-        { 255, 217, 7, 237, 7 },
-        { 222, 127, 114, 207, 10 },
-        { 235, 126, 9, 191, 15 }, },
-      { { 89, 64, 115, 102, 9 },
-        { 62, 76, 3, 216, 5 },
-        { 150, 108, 224, 41, 10 },
-        { 161, 188, 3, 39, 12 }, },
-      { { 93, 105, 19, 173, 1 },
-        { 159, 110, 2, 212, 10 },
-        { 139, 92, 137, 107, 10 },
-        { 82, 180, 7, 111, 9 }, },
-      { { 89, 82, 185, 227, 11 },
-        { 86, 156, 15, 220, 7 },
-        { 220, 121, 212, 169, 10 },
-        { 227, 191, 3, 150, 10 }, },
-      { { 93, 70, 244, 172, 2 },
-        { 170, 189, 10, 240, 6 },
-        { 67, 82, 246, 43, 10 },
-        { 96, 245, 11, 213, 5 }, },
-      { { 95, 128, 157, 46, 8 },
-        { 154, 169, 23, 209, 1 },
-        { 23, 75, 144, 31, 10 },
-        { 136, 190, 137, 85, 9 }, },
-      { { 95, 224, 251, 80, 14 },
-        { 179, 220, 213, 217, 4 },
-        { 112, 173, 240, 127, 10 },
-        { 41, 186, 179, 188, 13 }, },
-      { { 95, 235, 211, 215, 0 },
-        { 187, 206, 152, 221, 11 },
-        { 14, 188, 189, 127, 10 },
-        { 219, 177, 151, 61, 13 }, },
-      { { 100, 105, 134, 115, 5 },
-        { 133, 199, 226, 140, 9 },
-        { 172, 230, 25, 98, 6 },
-        { 147, 20, 126, 58, 1 }, },
-      { { 96, 188, 232, 205, 8 },
-        { 105, 160, 53, 172, 14 },
-        { 27, 49, 115, 208, 6 },
-        { 115, 90, 192, 89, 6 }, },
-      { { 100, 158, 227, 5, 6 },
-        { 248, 208, 120, 164, 12 },
-        { 106, 12, 119, 146, 6 },
-        { 50, 81, 224, 177, 15 }, },
-      { { 98, 212, 165, 37, 13 },
-        { 92, 133, 115, 165, 4 },
-        { 186, 74, 82, 180, 6 },
-        { 42, 92, 234, 19, 10 }, },
-      { { 98, 246, 143, 142, 3 },
-        { 93, 245, 60, 161, 3 },
-        { 199, 31, 22, 244, 6 },
-        { 200, 83, 202, 251, 10 }, },
-      { { 101, 96, 72, 36, 7 },
-        { 173, 20, 102, 192, 0 },
-        { 226, 65, 32, 106, 6 },
-        { 0, 54, 98, 139, 5 }, },
-      { { 99, 180, 12, 145, 8 },
-        { 65, 1, 181, 229, 2 },
-        { 24, 147, 2, 220, 6 },
-        { 74, 122, 216, 8, 2 }, },
-      { { 99, 159, 233, 153, 13 },
-        { 116, 162, 253, 229, 14 },
-        { 185, 153, 127, 156, 6 },
-        { 122, 123, 244, 82, 14 }, },
-      { { 101, 237, 229, 156, 7 },
-        { 189, 183, 240, 224, 14 },
-        { 227, 154, 123, 122, 6 },
-        { 112, 112, 254, 219, 13 }, },
-      { { 103, 235, 231, 112, 4 },
-        { 177, 199, 250, 201, 12 },
-        { 32, 238, 125, 126, 6 },
-        { 57, 53, 254, 56, 13 }, },
-      { { 106, 1, 200, 157, 4 },
-        { 42, 162, 228, 133, 2 },
-        { 43, 145, 56, 5, 6 },
-        { 74, 18, 116, 85, 4 }, },
-      { { 104, 61, 242, 11, 0 },
-        { 99, 226, 32, 180, 13 },
-        { 13, 4, 251, 193, 6 },
-        { 178, 208, 68, 124, 6 }, },
-      { { 104, 24, 102, 125, 13 },
-        { 110, 97, 227, 140, 12 },
-        { 187, 230, 97, 129, 6 },
-        { 51, 28, 120, 103, 6 }, },
-      { { 108, 84, 97, 80, 15 },
-        { 246, 20, 225, 168, 4 },
-        { 240, 168, 98, 163, 6 },
-        { 33, 88, 114, 134, 15 }, },
-      { { 104, 75, 24, 245, 13 },
-        { 14, 6, 239, 156, 10 },
-        { 186, 241, 141, 33, 6 },
-        { 83, 159, 118, 7, 0 }, },
-      { { 104, 79, 21, 129, 0 },
-        { 18, 7, 40, 180, 10 },
-        { 8, 26, 143, 33, 6 },
-        { 82, 209, 78, 4, 8 }, },
-      { { 110, 110, 244, 89, 0 },
-        { 163, 165, 168, 189, 12 },
-        { 9, 162, 247, 103, 6 },
-        { 59, 209, 90, 92, 5 }, },
-      { { 110, 152, 128, 38, 5 },
-        { 206, 128, 114, 129, 9 },
-        { 166, 64, 17, 151, 6 },
-        { 152, 20, 224, 23, 3 }, },
-      { { 110, 144, 99, 51, 3 },
-        { 246, 80, 178, 133, 5 },
-        { 204, 204, 96, 151, 6 },
-        { 170, 20, 208, 166, 15 }, },
-      { { 110, 241, 228, 10, 7 },
-        { 231, 183, 112, 129, 5 },
-        { 229, 2, 120, 247, 6 },
-        { 168, 16, 238, 222, 7 }, },
-      { { 108, 195, 36, 252, 0 },
-        { 138, 39, 186, 136, 6 },
-        { 3, 242, 76, 51, 6 },
-        { 97, 21, 222, 69, 1 }, },
-      { { 105, 0, 81, 91, 15 },
-        { 54, 48, 225, 220, 1 },
-        { 253, 168, 160, 9, 6 },
-        { 131, 184, 112, 198, 12 }, },
-      { { 107, 64, 14, 250, 12 },
-        { 2, 101, 231, 201, 3 },
-        { 53, 247, 0, 45, 6 },
-        { 201, 62, 122, 100, 0 }, },
-      { { 107, 124, 181, 68, 7 },
-        { 95, 149, 96, 249, 12 },
-        { 226, 42, 211, 237, 6 },
-        { 57, 240, 106, 159, 10 }, },
-      { { 105, 172, 245, 202, 2 },
-        { 51, 177, 48, 248, 15 },
-        { 69, 58, 243, 89, 6 },
-        { 241, 240, 200, 220, 12 }, },
-      { { 105, 167, 102, 247, 12 },
-        { 43, 67, 251, 236, 7 },
-        { 62, 246, 110, 89, 6 },
-        { 227, 125, 252, 45, 4 }, },
-      { { 109, 235, 50, 140, 11 },
-        { 143, 118, 57, 208, 14 },
-        { 211, 20, 205, 123, 6 },
-        { 112, 185, 198, 239, 1 }, },
-      { { 116, 23, 252, 110, 12 },
-        { 232, 171, 111, 184, 5 },
-        { 55, 99, 254, 130, 14 },
-        { 161, 223, 109, 81, 7 }, },
-      { { 112, 97, 170, 185, 4 },
-        { 1, 238, 230, 132, 6 },
-        { 41, 213, 88, 96, 14 },
-        { 98, 22, 119, 120, 0 }, },
-      { { 116, 67, 17, 82, 1 },
-        { 148, 14, 168, 152, 1 },
-        { 132, 168, 140, 34, 14 },
-        { 129, 145, 87, 2, 9 }, },
-      { { 112, 185, 187, 138, 9 },
-        { 85, 234, 53, 144, 15 },
-        { 149, 29, 217, 208, 14 },
-        { 240, 154, 197, 122, 10 }, },
-      { { 118, 148, 62, 229, 4 },
-        { 200, 73, 118, 189, 6 },
-        { 42, 119, 194, 150, 14 },
-        { 107, 214, 233, 33, 3 }, },
-      { { 118, 188, 96, 18, 9 },
-        { 229, 8, 177, 161, 13 },
-        { 148, 128, 99, 214, 14 },
-        { 184, 88, 209, 10, 7 }, },
-      { { 112, 155, 7, 165, 4 },
-        { 88, 75, 122, 132, 10 },
-        { 42, 94, 13, 144, 14 },
-        { 82, 21, 237, 33, 10 }, },
-      { { 116, 139, 191, 1, 3 },
-        { 148, 219, 60, 148, 12 },
-        { 200, 15, 221, 18, 14 },
-        { 50, 147, 205, 178, 9 }, },
-      { { 114, 248, 93, 79, 11 },
-        { 125, 61, 53, 157, 9 },
-        { 223, 43, 161, 244, 14 },
-        { 155, 154, 203, 203, 14 }, },
-      { { 118, 211, 218, 167, 15 },
-        { 236, 222, 127, 149, 3 },
-        { 254, 85, 188, 182, 14 },
-        { 202, 159, 231, 179, 7 }, },
-      { { 117, 36, 208, 249, 9 },
-        { 165, 168, 163, 252, 2 },
-        { 153, 240, 178, 74, 14 },
-        { 67, 252, 81, 90, 5 }, },
-      { { 117, 60, 188, 48, 6 },
-        { 193, 153, 230, 240, 12 },
-        { 96, 195, 211, 202, 14 },
-        { 48, 246, 121, 152, 3 }, },
-      { { 119, 3, 201, 213, 15 },
-        { 188, 154, 237, 205, 2 },
-        { 250, 185, 60, 14, 14 },
-        { 75, 59, 117, 147, 13 }, },
-      { { 113, 69, 59, 42, 5 },
-        { 20, 110, 102, 240, 5 },
-        { 165, 77, 202, 40, 14 },
-        { 160, 246, 103, 98, 8 }, },
-      { { 115, 108, 25, 223, 1 },
-        { 29, 44, 164, 253, 11 },
-        { 143, 185, 131, 108, 14 },
-        { 219, 242, 83, 75, 8 }, },
-      { { 113, 72, 238, 44, 10 },
-        { 40, 253, 39, 192, 12 },
-        { 83, 71, 113, 40, 14 },
-        { 48, 62, 75, 241, 4 }, },
-      { { 115, 111, 34, 124, 0 },
-        { 9, 110, 170, 233, 12 },
-        { 3, 228, 79, 108, 14 },
-        { 57, 117, 87, 105, 0 }, },
-      { { 115, 145, 99, 174, 14 },
-        { 120, 122, 115, 193, 7 },
-        { 119, 92, 104, 156, 14 },
-        { 232, 60, 229, 225, 14 }, },
-      { { 117, 131, 158, 142, 9 },
-        { 140, 235, 61, 208, 3 },
-        { 151, 23, 156, 26, 14 },
-        { 192, 187, 205, 115, 1 }, },
-      { { 119, 191, 100, 123, 6 },
-        { 225, 59, 250, 237, 13 },
-        { 109, 226, 111, 222, 14 },
-        { 187, 117, 253, 200, 7 }, },
-      { { 115, 229, 189, 18, 10 },
-        { 17, 159, 181, 241, 5 },
-        { 84, 139, 218, 124, 14 },
-        { 168, 250, 223, 152, 8 }, },
-      { { 115, 207, 104, 128, 3 },
-        { 36, 30, 60, 225, 14 },
-        { 192, 17, 111, 60, 14 },
-        { 120, 115, 199, 130, 4 }, },
-      { { 113, 247, 74, 10, 0 },
-        { 97, 110, 60, 224, 1 },
-        { 5, 5, 46, 248, 14 },
-        { 128, 115, 199, 104, 6 }, },
-      { { 120, 45, 207, 39, 6 },
-        { 59, 219, 102, 164, 9 },
-        { 110, 79, 59, 65, 14 },
-        { 146, 86, 109, 189, 12 }, },
-      { { 124, 2, 58, 157, 7 },
-        { 142, 120, 236, 148, 6 },
-        { 235, 149, 196, 3, 14 },
-        { 98, 147, 113, 231, 1 }, },
-      { { 122, 92, 206, 58, 4 },
-        { 98, 237, 230, 161, 9 },
-        { 37, 199, 51, 165, 14 },
-        { 152, 86, 123, 116, 6 }, },
-      { { 122, 114, 16, 7, 7 },
-        { 79, 28, 104, 149, 1 },
-        { 238, 0, 132, 229, 14 },
-        { 138, 145, 99, 143, 2 }, },
-      { { 126, 178, 36, 208, 11 },
-        { 199, 25, 185, 137, 6 },
-        { 208, 178, 68, 215, 14 },
-        { 105, 25, 217, 142, 3 }, },
-      { { 120, 253, 197, 213, 2 },
-        { 123, 159, 176, 172, 10 },
-        { 74, 186, 59, 241, 14 },
-        { 83, 80, 223, 157, 14 }, },
-      { { 126, 232, 117, 158, 9 },
-        { 191, 45, 177, 145, 15 },
-        { 151, 154, 225, 119, 14 },
-        { 248, 152, 219, 79, 13 }, },
-      { { 123, 28, 43, 68, 14 },
-        { 90, 88, 101, 233, 12 },
-        { 114, 45, 67, 141, 14 },
-        { 57, 122, 97, 165, 10 }, },
-      { { 127, 4, 160, 250, 2 },
-        { 130, 184, 162, 233, 7 },
-        { 69, 240, 82, 15, 14 },
-        { 233, 116, 81, 212, 1 }, },
-      { { 123, 39, 78, 235, 3 },
-        { 39, 123, 46, 237, 3 },
-        { 205, 119, 46, 77, 14 },
-        { 203, 119, 77, 238, 4 }, },
-      { { 125, 38, 127, 122, 1 },
-        { 183, 105, 174, 248, 5 },
-        { 133, 239, 230, 75, 14 },
-        { 161, 247, 89, 110, 13 }, },
-      { { 127, 50, 169, 94, 10 },
-        { 219, 184, 173, 201, 5 },
-        { 87, 169, 84, 207, 14 },
-        { 169, 59, 81, 221, 11 }, },
-      { { 121, 180, 170, 170, 7 },
-        { 71, 248, 118, 224, 7 },
-        { 229, 85, 82, 217, 14 },
-        { 224, 118, 225, 254, 2 }, },
-      { { 125, 176, 215, 37, 3 },
-        { 255, 217, 50, 212, 0 },
-        { 202, 78, 176, 219, 14 },
-        { 2, 180, 201, 191, 15 }, },
-      { { 127, 147, 79, 12, 2 },
-        { 250, 123, 60, 193, 0 },
-        { 67, 15, 44, 159, 14 },
-        { 8, 51, 205, 229, 15 }, },
-      { { 125, 252, 16, 66, 2 },
-        { 195, 28, 48, 248, 9 },
-        { 68, 32, 131, 251, 14 },
-        { 145, 240, 195, 140, 3 }, },
-      { { 125, 213, 216, 211, 15 },
-        { 230, 158, 245, 252, 3 },
-        { 252, 177, 186, 187, 14 },
-        { 195, 250, 247, 150, 7 }, },
-      { { 128, 56, 32, 103, 11 },
-        { 77, 16, 3, 14, 13 },
-        { 222, 96, 65, 192, 1 },
-        { 183, 12, 0, 139, 2 }, },
-      { { 132, 17, 185, 214, 3 },
-        { 220, 146, 132, 26, 7 },
-        { 198, 185, 216, 130, 1 },
-        { 229, 130, 20, 147, 11 }, },
-      { { 128, 3, 252, 100, 10 },
-        { 40, 147, 15, 26, 4 },
-        { 82, 99, 252, 0, 1 },
-        { 37, 143, 12, 145, 4 }, },
-      { { 130, 59, 15, 187, 10 },
-        { 81, 115, 143, 7, 11 },
-        { 93, 223, 13, 196, 1 },
-        { 222, 15, 28, 232, 10 }, },
-      { { 134, 42, 167, 117, 10 },
-        { 153, 209, 139, 15, 12 },
-        { 90, 238, 85, 70, 1 },
-        { 63, 13, 24, 185, 9 }, },
-      { { 132, 27, 89, 75, 7 },
-        { 244, 50, 76, 30, 9 },
-        { 237, 41, 173, 130, 1 },
-        { 151, 131, 36, 194, 15 }, },
-      { { 130, 68, 49, 200, 10 },
-        { 16, 52, 1, 59, 6 },
-        { 81, 56, 194, 36, 1 },
-        { 109, 200, 2, 192, 8 }, },
-      { { 130, 89, 216, 117, 3 },
-        { 108, 150, 134, 31, 8 },
-        { 202, 225, 185, 164, 1 },
-        { 31, 134, 22, 147, 6 }, },
-      { { 132, 72, 31, 220, 14 },
-        { 152, 117, 197, 26, 10 },
-        { 115, 191, 129, 34, 1 },
-        { 85, 138, 58, 225, 9 }, },
-      { { 130, 181, 229, 107, 4 },
-        { 113, 163, 82, 47, 5 },
-        { 45, 106, 122, 212, 1 },
-        { 175, 68, 172, 88, 14 }, },
-      { { 128, 183, 10, 183, 0 },
-        { 73, 66, 158, 38, 3 },
-        { 14, 213, 14, 208, 1 },
-        { 198, 71, 148, 41, 2 }, },
-      { { 134, 178, 80, 25, 10 },
-        { 225, 48, 153, 23, 0 },
-        { 89, 128, 164, 214, 1 },
-        { 14, 137, 144, 200, 7 }, },
-      { { 128, 204, 47, 123, 8 },
-        { 16, 101, 151, 46, 13 },
-        { 29, 239, 67, 48, 1 },
-        { 183, 78, 154, 96, 8 }, },
-      { { 134, 253, 182, 100, 8 },
-        { 201, 199, 19, 59, 12 },
-        { 18, 102, 219, 246, 1 },
-        { 61, 204, 142, 57, 3 }, },
-      { { 129, 121, 60, 62, 9 },
-        { 77, 39, 135, 82, 13 },
-        { 151, 195, 201, 232, 1 },
-        { 180, 174, 30, 75, 2 }, },
-      { { 133, 96, 132, 133, 11 },
-        { 141, 149, 1, 70, 2 },
-        { 218, 18, 16, 106, 1 },
-        { 70, 40, 10, 155, 1 }, },
-      { { 131, 98, 22, 146, 5 },
-        { 5, 69, 200, 83, 3 },
-        { 164, 150, 132, 108, 1 },
-        { 204, 161, 58, 42, 0 }, },
-      { { 131, 128, 229, 221, 15 },
-        { 60, 177, 209, 79, 6 },
-        { 251, 186, 112, 28, 1 },
-        { 111, 40, 184, 211, 12 }, },
-      { { 135, 160, 76, 203, 2 },
-        { 161, 49, 20, 79, 3 },
-        { 77, 51, 32, 94, 1 },
-        { 207, 34, 136, 200, 5 }, },
-      { { 135, 184, 138, 180, 13 },
-        { 205, 192, 215, 67, 10 },
-        { 178, 213, 17, 222, 1 },
-        { 92, 46, 176, 59, 3 }, },
-      { { 142, 2, 6, 56, 4 },
-        { 130, 97, 202, 3, 0 },
-        { 33, 198, 4, 7, 1 },
-        { 12, 5, 56, 100, 1 }, },
-      { { 140, 54, 125, 172, 7 },
-        { 255, 49, 78, 50, 6 },
-        { 227, 91, 230, 195, 1 },
-        { 100, 199, 40, 207, 15 }, },
-      { { 140, 65, 233, 44, 2 },
-        { 186, 182, 6, 2, 4 },
-        { 67, 73, 120, 35, 1 },
-        { 36, 6, 6, 213, 13 }, },
-      { { 140, 152, 59, 175, 12 },
-        { 218, 96, 87, 22, 15 },
-        { 63, 93, 193, 147, 1 },
-        { 246, 142, 160, 101, 11 }, },
-      { { 136, 244, 107, 79, 11 },
-        { 127, 116, 21, 46, 5 },
-        { 223, 45, 98, 241, 1 },
-        { 167, 74, 130, 239, 14 }, },
-      { { 143, 44, 197, 204, 4 },
-        { 187, 161, 64, 107, 10 },
-        { 35, 58, 51, 79, 1 },
-        { 93, 96, 40, 93, 13 }, },
-      { { 141, 55, 126, 115, 3 },
-        { 231, 83, 142, 126, 5 },
-        { 204, 231, 238, 203, 1 },
-        { 167, 231, 28, 174, 7 }, },
-      { { 139, 69, 79, 63, 7 },
-        { 62, 119, 198, 103, 1 },
-        { 239, 207, 42, 45, 1 },
-        { 142, 102, 62, 231, 12 }, },
-      { { 141, 86, 37, 150, 0 },
-        { 218, 5, 136, 98, 7 },
-        { 6, 154, 70, 171, 1 },
-        { 228, 97, 26, 5, 11 }, },
-      { { 139, 191, 24, 57, 2 },
-        { 67, 50, 158, 119, 8 },
-        { 73, 193, 143, 221, 1 },
-        { 30, 231, 148, 204, 2 }, },
-      { { 141, 166, 67, 9, 4 },
-        { 179, 96, 88, 102, 0 },
-        { 41, 12, 38, 91, 1 },
-        { 6, 97, 160, 108, 13 }, },
-      { { 141, 208, 202, 166, 8 },
-        { 234, 196, 23, 66, 3 },
-        { 22, 85, 48, 187, 1 },
-        { 196, 46, 130, 53, 7 }, },
-      { { 139, 246, 152, 79, 4 },
-        { 75, 164, 92, 127, 1 },
-        { 47, 33, 150, 253, 1 },
-        { 143, 227, 162, 93, 2 }, },
-      { { 144, 18, 153, 165, 4 },
-        { 88, 136, 78, 22, 2 },
-        { 42, 89, 148, 128, 9 },
-        { 70, 135, 33, 17, 10 }, },
-      { { 150, 46, 4, 135, 5 },
-        { 141, 9, 72, 39, 11 },
-        { 174, 18, 7, 70, 9 },
-        { 222, 65, 41, 11, 1 }, },
-      { { 146, 92, 163, 212, 0 },
-        { 88, 204, 128, 43, 14 },
-        { 2, 188, 83, 164, 9 },
-        { 125, 64, 19, 49, 10 }, },
-      { { 146, 133, 143, 119, 10 },
-        { 24, 219, 151, 47, 1 },
-        { 94, 239, 26, 20, 9 },
-        { 143, 78, 157, 177, 8 }, },
-      { { 148, 169, 61, 69, 10 },
-        { 153, 27, 21, 30, 12 },
-        { 90, 43, 201, 82, 9 },
-        { 55, 138, 141, 137, 9 }, },
-      { { 145, 32, 243, 51, 2 },
-        { 49, 216, 130, 86, 5 },
-        { 76, 204, 240, 72, 9 },
-        { 166, 164, 17, 184, 12 }, },
-      { { 145, 39, 109, 79, 3 },
-        { 61, 59, 12, 110, 5 },
-        { 207, 43, 110, 72, 9 },
-        { 167, 99, 13, 203, 12 }, },
-      { { 151, 51, 253, 233, 10 },
-        { 241, 187, 15, 95, 6 },
-        { 89, 123, 252, 206, 9 },
-        { 111, 175, 13, 216, 15 }, },
-      { { 151, 72, 243, 129, 3 },
-        { 180, 220, 0, 87, 14 },
-        { 200, 28, 241, 46, 9 },
-        { 126, 160, 3, 178, 13 }, },
-      { { 151, 159, 160, 6, 9 },
-        { 204, 138, 25, 99, 13 },
-        { 150, 0, 95, 158, 9 },
-        { 188, 105, 133, 19, 3 }, },
-      { { 147, 208, 63, 215, 12 },
-        { 88, 77, 213, 95, 7 },
-        { 62, 191, 192, 188, 9 },
-        { 239, 170, 187, 33, 10 }, },
-      { { 149, 252, 208, 110, 0 },
-        { 233, 172, 18, 122, 9 },
-        { 7, 96, 179, 250, 9 },
-        { 149, 228, 131, 89, 7 }, },
-      { { 147, 195, 178, 11, 1 },
-        { 4, 238, 24, 87, 5 },
-        { 141, 4, 220, 60, 9 },
-        { 174, 161, 135, 114, 0 }, },
-      { { 145, 195, 66, 1, 14 },
-        { 32, 94, 89, 70, 0 },
-        { 120, 4, 44, 56, 9 },
-        { 6, 41, 167, 160, 4 }, },
-      { { 158, 10, 212, 208, 9 },
-        { 166, 137, 137, 27, 10 },
-        { 144, 178, 181, 7, 9 },
-        { 93, 137, 25, 22, 5 }, },
-      { { 158, 62, 24, 70, 8 },
-        { 203, 8, 13, 59, 9 },
-        { 22, 33, 135, 199, 9 },
-        { 157, 203, 1, 13, 3 }, },
-      { { 154, 97, 122, 220, 9 },
-        { 47, 110, 133, 27, 6 },
-        { 147, 181, 232, 101, 9 },
-        { 109, 138, 23, 111, 4 }, },
-      { { 152, 200, 135, 101, 13 },
-        { 30, 205, 83, 14, 8 },
-        { 186, 110, 17, 49, 9 },
-        { 23, 12, 171, 55, 8 }, },
-      { { 152, 193, 223, 48, 9 },
-        { 54, 207, 151, 18, 0 },
-        { 144, 207, 184, 49, 9 },
-        { 4, 142, 159, 54, 12 }, },
-      { { 158, 249, 40, 250, 12 },
-        { 195, 46, 215, 11, 15 },
-        { 53, 241, 73, 247, 9 },
-        { 253, 14, 183, 76, 3 }, },
-      { { 158, 240, 171, 22, 1 },
-        { 223, 204, 148, 3, 5 },
-        { 134, 141, 80, 247, 9 },
-        { 172, 2, 147, 63, 11 }, },
-      { { 152, 251, 117, 9, 13 },
-        { 119, 47, 89, 22, 12 },
-        { 185, 10, 237, 241, 9 },
-        { 54, 137, 175, 78, 14 }, },
-      { { 159, 32, 1, 53, 4 },
-        { 155, 8, 194, 71, 0 },
-        { 42, 200, 0, 79, 9 },
-        { 14, 36, 49, 13, 9 }, },
-      { { 153, 18, 120, 7, 12 },
-        { 106, 8, 77, 86, 5 },
-        { 62, 1, 228, 137, 9 },
-        { 166, 171, 33, 5, 6 }, },
-      { { 155, 131, 245, 126, 11 },
-        { 62, 187, 155, 91, 5 },
-        { 215, 234, 252, 29, 9 },
-        { 173, 173, 157, 215, 12 }, },
-      { { 153, 249, 200, 173, 5 },
-        { 111, 174, 86, 70, 10 },
-        { 171, 81, 57, 249, 9 },
-        { 86, 38, 167, 95, 6 }, },
-      { { 157, 228, 46, 236, 2 },
-        { 139, 125, 22, 106, 6 },
-        { 67, 119, 66, 123, 9 },
-        { 101, 102, 139, 237, 1 }, },
-      { { 155, 219, 144, 210, 3 },
-        { 70, 158, 152, 91, 11 },
-        { 196, 176, 157, 189, 9 },
-        { 221, 161, 151, 150, 2 }, },
-      { { 159, 254, 132, 153, 15 },
-        { 199, 189, 217, 103, 10 },
-        { 249, 146, 23, 255, 9 },
-        { 94, 105, 187, 222, 3 }, },
-      { { 162, 66, 140, 215, 9 },
-        { 12, 133, 173, 15, 3 },
-        { 158, 179, 20, 36, 5 },
-        { 207, 11, 90, 19, 0 }, },
-      { { 164, 205, 25, 53, 7 },
-        { 156, 22, 246, 54, 8 },
-        { 234, 201, 139, 50, 5 },
-        { 22, 198, 246, 131, 9 }, },
-      { { 166, 213, 162, 25, 0 },
-        { 192, 230, 176, 39, 4 },
-        { 9, 132, 90, 182, 5 },
-        { 46, 64, 214, 112, 3 }, },
-      { { 160, 223, 192, 176, 6 },
-        { 96, 150, 250, 34, 10 },
-        { 96, 208, 63, 176, 5 },
-        { 84, 69, 246, 144, 6 }, },
-      { { 163, 49, 180, 144, 4 },
-        { 65, 131, 224, 83, 6 },
-        { 32, 146, 216, 204, 5 },
-        { 108, 160, 124, 24, 2 }, },
-      { { 167, 32, 134, 58, 15 },
-        { 133, 241, 227, 67, 1 },
-        { 245, 198, 16, 78, 5 },
-        { 140, 44, 120, 250, 1 }, },
-      { { 167, 56, 45, 40, 13 },
-        { 213, 33, 103, 67, 12 },
-        { 177, 75, 65, 206, 5 },
-        { 60, 46, 104, 74, 11 }, },
-      { { 163, 63, 204, 220, 14 },
-        { 105, 179, 237, 107, 10 },
-        { 115, 179, 63, 204, 5 },
-        { 93, 107, 124, 217, 6 }, },
-      { { 165, 62, 179, 132, 11 },
-        { 221, 208, 41, 114, 14 },
-        { 210, 28, 215, 202, 5 },
-        { 116, 233, 64, 187, 11 }, },
-      { { 161, 112, 26, 189, 7 },
-        { 77, 116, 230, 86, 2 },
-        { 235, 213, 128, 232, 5 },
-        { 70, 166, 114, 235, 2 }, },
-      { { 167, 103, 101, 55, 9 },
-        { 189, 7, 171, 103, 5 },
-        { 158, 202, 110, 110, 5 },
-        { 174, 109, 94, 11, 13 }, },
-      { { 165, 123, 102, 174, 4 },
-        { 233, 103, 106, 66, 15 },
-        { 39, 86, 109, 234, 5 },
-        { 244, 37, 110, 105, 7 }, },
-      { { 161, 213, 29, 147, 2 },
-        { 80, 23, 180, 118, 3 },
-        { 76, 155, 138, 184, 5 },
-        { 198, 226, 222, 128, 10 }, },
-      { { 163, 248, 233, 155, 14 },
-        { 113, 180, 245, 71, 15 },
-        { 125, 153, 113, 252, 5 },
-        { 254, 42, 242, 216, 14 }, },
-      { { 165, 211, 131, 218, 3 },
-        { 212, 246, 184, 74, 3 },
-        { 197, 188, 28, 186, 5 },
-        { 197, 33, 214, 242, 11 }, },
-      { { 165, 214, 235, 188, 6 },
-        { 248, 244, 254, 98, 6 },
-        { 99, 221, 118, 186, 5 },
-        { 100, 103, 242, 241, 15 }, },
-      { { 170, 38, 227, 151, 9 },
-        { 63, 192, 169, 39, 7 },
-        { 158, 156, 118, 69, 5 },
-        { 238, 73, 80, 63, 12 }, },
-      { { 174, 30, 201, 63, 12 },
-        { 250, 160, 239, 39, 9 },
-        { 63, 201, 55, 135, 5 },
-        { 158, 79, 112, 85, 15 }, },
-      { { 172, 119, 184, 237, 2 },
-        { 203, 182, 46, 62, 6 },
-        { 75, 113, 222, 227, 5 },
-        { 103, 199, 70, 221, 3 }, },
-      { { 170, 169, 238, 77, 15 },
-        { 47, 243, 117, 15, 12 },
-        { 251, 39, 121, 85, 5 },
-        { 63, 10, 236, 255, 4 }, },
-      { { 170, 128, 121, 170, 6 },
-        { 50, 48, 118, 19, 7 },
-        { 101, 89, 224, 21, 5 },
-        { 236, 134, 224, 196, 12 }, },
-      { { 174, 194, 96, 202, 1 },
-        { 166, 36, 56, 11, 7 },
-        { 133, 48, 100, 55, 5 },
-        { 237, 1, 194, 70, 5 }, },
-      { { 169, 58, 152, 98, 11 },
-        { 71, 144, 47, 90, 9 },
-        { 212, 97, 149, 201, 5 },
-        { 149, 175, 64, 158, 2 }, },
-      { { 171, 18, 81, 200, 12 },
-        { 114, 32, 105, 91, 2 },
-        { 49, 56, 164, 141, 5 },
-        { 77, 169, 96, 68, 14 }, },
-      { { 173, 102, 219, 216, 13 },
-        { 183, 228, 237, 122, 2 },
-        { 177, 189, 182, 107, 5 },
-        { 69, 235, 114, 126, 13 }, },
-      { { 173, 82, 221, 74, 1 },
-        { 246, 165, 44, 90, 1 },
-        { 133, 43, 180, 171, 5 },
-        { 133, 163, 74, 86, 15 }, },
-      { { 169, 182, 113, 16, 8 },
-        { 115, 0, 185, 114, 4 },
-        { 16, 136, 230, 217, 5 },
-        { 36, 233, 208, 12, 14 }, },
-      { { 173, 186, 226, 53, 0 },
-        { 235, 192, 186, 70, 12 },
-        { 10, 196, 117, 219, 5 },
-        { 54, 37, 208, 61, 7 }, },
-      { { 173, 151, 65, 223, 12 },
-        { 250, 34, 249, 110, 3 },
-        { 63, 184, 46, 155, 5 },
-        { 199, 105, 244, 69, 15 }, },
-      { { 171, 243, 182, 44, 7 },
-        { 79, 247, 122, 83, 4 },
-        { 227, 70, 220, 253, 5 },
-        { 44, 165, 238, 255, 2 }, },
-      { { 182, 34, 108, 113, 12 },
-        { 161, 9, 239, 15, 4 },
-        { 56, 227, 100, 70, 13 },
-        { 47, 15, 121, 8, 5 }, },
-      { { 180, 30, 37, 122, 7 },
-        { 212, 57, 234, 42, 13 },
-        { 229, 234, 71, 130, 13 },
-        { 181, 69, 121, 194, 11 }, },
-      { { 182, 55, 195, 138, 3 },
-        { 245, 250, 40, 35, 3 },
-        { 197, 28, 62, 198, 13 },
-        { 204, 65, 69, 250, 15 }, },
-      { { 176, 76, 212, 55, 0 },
-        { 40, 141, 162, 54, 9 },
-        { 14, 194, 179, 32, 13 },
-        { 150, 196, 91, 17, 4 }, },
-      { { 178, 127, 139, 5, 3 },
-        { 93, 222, 44, 39, 8 },
-        { 202, 13, 31, 228, 13 },
-        { 30, 67, 71, 187, 10 }, },
-      { { 176, 173, 216, 34, 5 },
-        { 37, 138, 118, 50, 9 },
-        { 164, 65, 187, 80, 13 },
-        { 148, 198, 229, 26, 4 }, },
-      { { 180, 155, 130, 43, 11 },
-        { 196, 250, 59, 6, 9 },
-        { 221, 68, 29, 146, 13 },
-        { 150, 13, 197, 242, 3 }, },
-      { { 176, 211, 78, 194, 3 },
-        { 100, 95, 60, 10, 3 },
-        { 196, 55, 44, 176, 13 },
-        { 197, 3, 207, 162, 6 }, },
-      { { 177, 61, 126, 195, 14 },
-        { 97, 91, 101, 126, 15 },
-        { 124, 55, 235, 200, 13 },
-        { 247, 234, 109, 168, 6 }, },
-      { { 177, 6, 164, 99, 14 },
-        { 0, 153, 107, 110, 5 },
-        { 124, 98, 86, 8, 13 },
-        { 167, 109, 105, 144, 0 }, },
-      { { 179, 43, 116, 63, 14 },
-        { 41, 59, 235, 87, 13 },
-        { 127, 194, 237, 76, 13 },
-        { 190, 173, 125, 201, 4 }, },
-      { { 183, 31, 214, 70, 15 },
-        { 236, 219, 105, 123, 9 },
-        { 246, 38, 191, 142, 13 },
-        { 157, 233, 109, 179, 7 }, },
-      { { 177, 110, 241, 244, 5 },
-        { 61, 140, 234, 122, 14 },
-        { 162, 248, 247, 104, 13 },
-        { 117, 229, 115, 27, 12 }, },
-      { { 177, 126, 83, 138, 14 },
-        { 113, 124, 105, 114, 11 },
-        { 117, 28, 167, 232, 13 },
-        { 212, 233, 99, 232, 14 }, },
-      { { 183, 98, 223, 55, 7 },
-        { 189, 221, 238, 87, 1 },
-        { 238, 207, 180, 110, 13 },
-        { 142, 167, 123, 187, 13 }, },
-      { { 177, 169, 248, 148, 9 },
-        { 45, 138, 181, 82, 14 },
-        { 146, 145, 249, 88, 13 },
-        { 116, 170, 213, 27, 4 }, },
-      { { 179, 183, 217, 210, 4 },
-        { 113, 138, 252, 123, 3 },
-        { 36, 185, 190, 220, 13 },
-        { 205, 227, 245, 24, 14 }, },
-      { { 179, 238, 187, 76, 6 },
-        { 25, 252, 124, 123, 12 },
-        { 99, 45, 215, 124, 13 },
-        { 61, 227, 227, 249, 8 }, },
-      { { 184, 44, 165, 82, 4 },
-        { 19, 137, 224, 42, 13 },
-        { 36, 170, 83, 65, 13 },
-        { 181, 64, 121, 28, 8 }, },
-      { { 184, 20, 13, 235, 15 },
-        { 86, 57, 103, 46, 3 },
-        { 253, 123, 2, 129, 13 },
-        { 199, 78, 105, 198, 10 }, },
-      { { 188, 25, 220, 199, 7 },
-        { 238, 155, 100, 30, 11 },
-        { 238, 51, 185, 131, 13 },
-        { 215, 130, 109, 151, 7 }, },
-      { { 188, 84, 38, 185, 6 },
-        { 194, 125, 226, 38, 6 },
-        { 105, 214, 66, 163, 13 },
-        { 102, 68, 123, 228, 3 }, },
-      { { 190, 103, 55, 196, 5 },
-        { 159, 79, 104, 59, 6 },
-        { 162, 62, 206, 103, 13 },
-        { 109, 193, 111, 47, 9 }, },
-      { { 184, 250, 232, 211, 5 },
-        { 103, 140, 252, 14, 15 },
-        { 172, 177, 117, 241, 13 },
-        { 247, 3, 243, 30, 6 }, },
-      { { 190, 194, 26, 55, 8 },
-        { 138, 76, 191, 23, 1 },
-        { 30, 197, 132, 55, 13 },
-        { 142, 143, 211, 37, 1 }, },
-      { { 187, 24, 207, 164, 11 },
-        { 126, 217, 39, 67, 10 },
-        { 210, 95, 49, 141, 13 },
-        { 92, 46, 73, 183, 14 }, },
-      { { 189, 1, 126, 246, 13 },
-        { 174, 75, 231, 90, 7 },
-        { 182, 247, 232, 11, 13 },
-        { 229, 174, 125, 39, 5 }, },
-      { { 189, 34, 47, 210, 7 },
-        { 151, 89, 236, 74, 7 },
-        { 228, 191, 68, 75, 13 },
-        { 229, 35, 121, 174, 9 }, },
-      { { 189, 2, 85, 133, 5 },
-        { 190, 9, 104, 86, 2 },
-        { 170, 26, 164, 11, 13 },
-        { 70, 161, 105, 7, 13 }, },
-      { { 185, 114, 78, 96, 5 },
-        { 103, 77, 110, 74, 0 },
-        { 160, 103, 36, 233, 13 },
-        { 5, 39, 107, 46, 6 }, },
-      { { 189, 119, 92, 22, 15 },
-        { 239, 31, 237, 114, 1 },
-        { 246, 131, 174, 235, 13 },
-        { 132, 235, 127, 143, 7 }, },
-      { { 185, 136, 172, 46, 1 },
-        { 14, 169, 54, 66, 13 },
-        { 135, 67, 81, 25, 13 },
-        { 180, 38, 201, 87, 0 }, },
-      { { 191, 160, 38, 103, 5 },
-        { 143, 73, 114, 79, 5 },
-        { 174, 102, 64, 95, 13 },
-        { 175, 36, 233, 47, 1 }, },
-      { { 185, 130, 150, 168, 6 },
-        { 2, 249, 122, 82, 2 },
-        { 97, 86, 148, 25, 13 },
-        { 68, 165, 233, 244, 0 }, },
-      { { 189, 135, 23, 24, 10 },
-        { 146, 123, 185, 114, 0 },
-        { 81, 142, 142, 27, 13 },
-        { 4, 233, 221, 228, 9 }, },
-      { { 191, 190, 239, 45, 7 },
-        { 255, 249, 126, 103, 12 },
-        { 235, 79, 119, 223, 13 },
-        { 62, 103, 233, 255, 15 }, },
-      { { 189, 250, 159, 0, 7 },
-        { 215, 221, 124, 82, 8 },
-        { 224, 15, 149, 251, 13 },
-        { 20, 163, 235, 190, 11 }, },
-      { { 194, 112, 53, 187, 8 },
-        { 81, 37, 131, 151, 7 },
-        { 29, 218, 192, 228, 3 },
-        { 238, 156, 26, 72, 10 }, },
-      { { 196, 108, 5, 172, 13 },
-        { 157, 37, 67, 162, 10 },
-        { 179, 90, 3, 98, 3 },
-        { 84, 92, 42, 75, 9 }, },
-      { { 196, 121, 84, 220, 3 },
-        { 237, 55, 128, 154, 10 },
-        { 195, 178, 169, 226, 3 },
-        { 85, 144, 30, 203, 7 }, },
-      { { 194, 106, 81, 13, 8 },
-        { 57, 36, 9, 151, 8 },
-        { 27, 8, 165, 100, 3 },
-        { 30, 153, 2, 73, 12 }, },
-      { { 198, 164, 159, 104, 4 },
-        { 145, 225, 86, 187, 0 },
-        { 33, 111, 146, 86, 3 },
-        { 13, 214, 168, 120, 9 }, },
-      { { 192, 158, 44, 235, 4 },
-        { 64, 33, 94, 174, 15 },
-        { 45, 115, 71, 144, 3 },
-        { 247, 87, 168, 64, 2 }, },
-      { { 198, 146, 33, 73, 13 },
-        { 212, 32, 89, 143, 4 },
-        { 185, 40, 68, 150, 3 },
-        { 47, 25, 160, 66, 11 }, },
-      { { 196, 186, 131, 207, 8 },
-        { 217, 224, 25, 142, 11 },
-        { 31, 60, 21, 210, 3 },
-        { 215, 25, 128, 121, 11 }, },
-      { { 198, 231, 133, 67, 11 },
-        { 149, 151, 25, 175, 1 },
-        { 220, 42, 30, 118, 3 },
-        { 143, 89, 142, 154, 9 }, },
-      { { 198, 215, 175, 70, 4 },
-        { 216, 199, 92, 171, 5 },
-        { 38, 47, 94, 182, 3 },
-        { 173, 83, 174, 49, 11 }, },
-      { { 197, 54, 85, 77, 11 },
-        { 253, 49, 9, 254, 0 },
-        { 219, 42, 166, 202, 3 },
-        { 7, 249, 8, 203, 15 }, },
-      { { 195, 147, 255, 13, 7 },
-        { 124, 243, 92, 215, 4 },
-        { 235, 15, 252, 156, 3 },
-        { 46, 179, 172, 243, 14 }, },
-      { { 193, 245, 112, 165, 10 },
-        { 105, 22, 19, 246, 6 },
-        { 90, 80, 234, 248, 3 },
-        { 102, 252, 134, 137, 6 }, },
-      { { 204, 57, 113, 197, 0 },
-        { 251, 2, 0, 158, 14 },
-        { 10, 56, 233, 195, 3 },
-        { 119, 144, 4, 13, 15 }, },
-      { { 200, 2, 137, 73, 2 },
-        { 18, 176, 12, 142, 0 },
-        { 73, 41, 20, 1, 3 },
-        { 7, 19, 0, 212, 8 }, },
-      { { 200, 124, 100, 74, 5 },
-        { 103, 37, 64, 170, 13 },
-        { 165, 34, 99, 225, 3 },
-        { 181, 80, 42, 78, 6 }, },
-      { { 202, 103, 225, 13, 7 },
-        { 63, 182, 72, 167, 4 },
-        { 235, 8, 126, 101, 3 },
-        { 46, 81, 38, 223, 12 }, },
-      { { 200, 153, 231, 66, 2 },
-        { 114, 211, 16, 138, 13 },
-        { 68, 46, 121, 145, 3 },
-        { 181, 16, 140, 180, 14 }, },
-      { { 200, 170, 178, 16, 5 },
-        { 7, 192, 216, 146, 12 },
-        { 160, 132, 213, 81, 3 },
-        { 52, 145, 176, 62, 0 }, },
-      { { 204, 166, 213, 159, 3 },
-        { 191, 177, 152, 182, 3 },
-        { 207, 154, 182, 83, 3 },
-        { 198, 209, 152, 223, 13 }, },
-      { { 202, 229, 134, 251, 14 },
-        { 3, 247, 211, 175, 3 },
-        { 125, 246, 26, 117, 3 },
-        { 207, 92, 190, 252, 0 }, },
-      { { 202, 217, 124, 49, 15 },
-        { 102, 23, 215, 151, 12 },
-        { 248, 195, 233, 181, 3 },
-        { 62, 158, 190, 134, 6 }, },
-      { { 206, 228, 202, 14, 6 },
-        { 171, 244, 84, 163, 1 },
-        { 103, 5, 50, 119, 3 },
-        { 140, 82, 162, 253, 5 }, },
-      { { 203, 45, 164, 50, 12 },
-        { 3, 131, 195, 227, 13 },
-        { 52, 194, 91, 77, 3 },
-        { 188, 124, 60, 28, 0 }, },
-      { { 203, 87, 214, 130, 2 },
-        { 98, 215, 8, 243, 3 },
-        { 68, 22, 190, 173, 3 },
-        { 204, 241, 14, 180, 6 }, },
-      { { 201, 144, 33, 177, 0 },
-        { 82, 0, 146, 198, 6 },
-        { 8, 216, 64, 153, 3 },
-        { 102, 52, 144, 4, 10 }, },
-      { { 201, 130, 95, 176, 10 },
-        { 50, 81, 159, 210, 2 },
-        { 80, 223, 164, 25, 3 },
-        { 68, 191, 152, 164, 12 }, },
-      { { 203, 158, 212, 36, 7 },
-        { 110, 145, 90, 243, 8 },
-        { 226, 66, 183, 157, 3 },
-        { 28, 245, 168, 151, 6 }, },
-      { { 205, 134, 171, 157, 13 },
-        { 158, 224, 221, 230, 6 },
-        { 187, 157, 86, 27, 3 },
-        { 102, 123, 176, 119, 9 }, },
-      { { 201, 201, 176, 119, 5 },
-        { 14, 134, 210, 222, 13 },
-        { 174, 224, 217, 57, 3 },
-        { 183, 180, 182, 23, 0 }, },
-      { { 201, 250, 31, 99, 2 },
-        { 83, 85, 30, 222, 9 },
-        { 76, 111, 133, 249, 3 },
-        { 151, 183, 138, 172, 10 }, },
-      { { 203, 247, 64, 6, 9 },
-        { 111, 6, 25, 227, 1 },
-        { 150, 0, 46, 253, 3 },
-        { 140, 121, 134, 15, 6 }, },
-      { { 205, 218, 13, 28, 15 },
-        { 222, 53, 221, 194, 8 },
-        { 243, 139, 5, 187, 3 },
-        { 20, 59, 186, 199, 11 }, },
-      { { 208, 11, 130, 83, 15 },
-        { 4, 218, 201, 142, 9 },
-        { 252, 164, 29, 0, 11 },
-        { 151, 25, 53, 178, 0 }, },
-      { { 212, 59, 207, 214, 15 },
-        { 253, 219, 205, 138, 11 },
-        { 246, 191, 61, 194, 11 },
-        { 213, 27, 61, 187, 15 }, },
-      { { 214, 98, 171, 209, 11 },
-        { 149, 220, 141, 143, 6 },
-        { 216, 189, 84, 102, 11 },
-        { 111, 27, 19, 186, 9 }, },
-      { { 212, 102, 200, 58, 15 },
-        { 165, 188, 207, 162, 1 },
-        { 245, 193, 54, 98, 11 },
-        { 132, 95, 51, 218, 5 }, },
-      { { 209, 32, 28, 120, 10 },
-        { 1, 57, 135, 218, 0 },
-        { 81, 227, 128, 72, 11 },
-        { 5, 190, 25, 200, 0 }, },
-      { { 211, 57, 65, 195, 9 },
-        { 117, 10, 1, 207, 11 },
-        { 156, 56, 41, 204, 11 },
-        { 223, 56, 5, 10, 14 }, },
-      { { 209, 7, 160, 253, 4 },
-        { 8, 170, 202, 238, 6 },
-        { 43, 240, 94, 8, 11 },
-        { 103, 117, 53, 81, 0 }, },
-      { { 209, 149, 58, 14, 2 },
-        { 72, 122, 20, 242, 5 },
-        { 71, 5, 202, 152, 11 },
-        { 164, 242, 133, 225, 2 }, },
-      { { 215, 189, 66, 29, 13 },
-        { 237, 106, 209, 231, 8 },
-        { 187, 132, 43, 222, 11 },
-        { 30, 120, 181, 107, 7 }, },
-      { { 215, 192, 166, 80, 13 },
-        { 132, 205, 209, 203, 4 },
-        { 176, 166, 80, 62, 11 },
-        { 45, 56, 187, 50, 1 }, },
-      { { 215, 229, 141, 245, 12 },
-        { 153, 143, 215, 239, 2 },
-        { 58, 251, 26, 126, 11 },
-        { 79, 126, 191, 25, 9 }, },
-      { { 215, 197, 83, 246, 7 },
-        { 188, 94, 210, 251, 3 },
-        { 230, 252, 170, 62, 11 },
-        { 205, 244, 183, 163, 13 }, },
-      { { 213, 254, 112, 184, 8 },
-        { 225, 44, 155, 242, 14 },
-        { 17, 208, 231, 250, 11 },
-        { 116, 253, 147, 72, 7 }, },
-      { { 216, 12, 185, 190, 6 },
-        { 26, 184, 198, 178, 15 },
-        { 103, 217, 211, 1, 11 },
-        { 244, 214, 49, 213, 8 }, },
-      { { 222, 52, 186, 37, 6 },
-        { 203, 216, 70, 183, 4 },
-        { 106, 69, 210, 199, 11 },
-        { 46, 214, 33, 189, 3 }, },
-      { { 220, 14, 198, 139, 14 },
-        { 162, 249, 73, 166, 11 },
-        { 125, 22, 55, 3, 11 },
-        { 214, 89, 41, 244, 5 }, },
-      { { 222, 3, 247, 164, 11 },
-        { 190, 219, 11, 147, 6 },
-        { 210, 94, 252, 7, 11 },
-        { 108, 157, 13, 183, 13 }, },
-      { { 218, 93, 11, 138, 2 },
-        { 82, 126, 4, 163, 11 },
-        { 69, 29, 11, 165, 11 },
-        { 220, 82, 7, 228, 10 }, },
-      { { 216, 113, 249, 127, 15 },
-        { 127, 190, 199, 158, 5 },
-        { 255, 233, 248, 225, 11 },
-        { 167, 158, 55, 223, 14 }, },
-      { { 220, 189, 130, 231, 2 },
-        { 203, 218, 18, 174, 11 },
-        { 78, 116, 27, 211, 11 },
-        { 215, 84, 133, 189, 3 }, },
-      { { 220, 176, 90, 229, 5 },
-        { 239, 72, 86, 158, 2 },
-        { 170, 117, 160, 211, 11 },
-        { 71, 150, 161, 47, 7 }, },
-      { { 218, 147, 222, 80, 0 },
-        { 98, 203, 156, 155, 0 },
-        { 0, 167, 188, 149, 11 },
-        { 13, 147, 157, 52, 6 }, },
-      { { 218, 183, 241, 191, 8 },
-        { 123, 170, 155, 183, 7 },
-        { 31, 216, 254, 213, 11 },
-        { 238, 221, 149, 93, 14 }, },
-      { { 222, 159, 2, 50, 14 },
-        { 194, 90, 219, 163, 9 },
-        { 116, 196, 15, 151, 11 },
-        { 156, 93, 181, 164, 3 }, },
-      { { 218, 196, 13, 85, 0 },
-        { 26, 13, 148, 175, 0 },
-        { 10, 171, 2, 53, 11 },
-        { 15, 82, 155, 5, 8 }, },
-      { { 220, 197, 171, 128, 14 },
-        { 146, 222, 85, 162, 6 },
-        { 112, 29, 90, 51, 11 },
-        { 100, 90, 167, 180, 9 }, },
-      { { 218, 194, 178, 58, 10 },
-        { 2, 252, 155, 147, 5 },
-        { 85, 196, 212, 53, 11 },
-        { 172, 157, 147, 244, 0 }, },
-      { { 218, 218, 88, 253, 0 },
-        { 106, 44, 158, 159, 10 },
-        { 11, 241, 165, 181, 11 },
-        { 95, 151, 147, 69, 6 }, },
-      { { 217, 37, 142, 168, 1 },
-        { 7, 235, 6, 226, 2 },
-        { 129, 87, 26, 73, 11 },
-        { 68, 118, 13, 126, 0 }, },
-      { { 221, 5, 118, 59, 14 },
-        { 162, 123, 195, 246, 5 },
-        { 125, 198, 234, 11, 11 },
-        { 166, 252, 61, 228, 5 }, },
-      { { 221, 46, 153, 8, 12 },
-        { 147, 168, 77, 242, 8 },
-        { 49, 9, 151, 75, 11 },
-        { 20, 251, 33, 92, 9 }, },
-      { { 217, 85, 104, 199, 5 },
-        { 110, 14, 68, 238, 7 },
-        { 174, 49, 106, 169, 11 },
-        { 231, 114, 39, 7, 6 }, },
-      { { 219, 80, 109, 76, 3 },
-        { 126, 61, 4, 203, 4 },
-        { 195, 43, 96, 173, 11 },
-        { 45, 50, 11, 199, 14 }, },
-      { { 223, 104, 170, 56, 8 },
-        { 131, 236, 135, 195, 12 },
-        { 17, 197, 81, 111, 11 },
-        { 60, 62, 19, 124, 1 }, },
-      { { 219, 66, 135, 167, 5 },
-        { 30, 205, 74, 199, 3 },
-        { 174, 94, 20, 45, 11 },
-        { 206, 53, 43, 55, 8 }, },
-      { { 219, 129, 40, 179, 13 },
-        { 6, 10, 215, 199, 7 },
-        { 188, 209, 72, 29, 11 },
-        { 238, 62, 181, 6, 0 }, },
-      { { 217, 163, 194, 250, 13 },
-        { 39, 234, 219, 202, 3 },
-        { 181, 244, 60, 89, 11 },
-        { 197, 61, 181, 126, 4 }, },
-      { { 221, 179, 56, 211, 8 },
-        { 195, 10, 157, 222, 7 },
-        { 28, 177, 204, 219, 11 },
-        { 231, 187, 149, 12, 3 }, },
-      { { 217, 202, 123, 155, 1 },
-        { 54, 108, 156, 214, 15 },
-        { 141, 157, 229, 57, 11 },
-        { 246, 179, 147, 102, 12 }, },
-      { { 219, 246, 158, 176, 7 },
-        { 71, 221, 222, 243, 2 },
-        { 224, 215, 150, 253, 11 },
-        { 76, 247, 187, 190, 2 }, },
-      { { 226, 8, 108, 175, 8 },
-        { 40, 33, 39, 135, 15 },
-        { 31, 83, 97, 4, 7 },
-        { 254, 30, 72, 65, 4 }, },
-      { { 224, 27, 171, 150, 4 },
-        { 88, 194, 236, 130, 15 },
-        { 38, 157, 93, 128, 7 },
-        { 244, 19, 116, 49, 10 }, },
-      { { 224, 72, 115, 243, 0 },
-        { 48, 68, 162, 158, 15 },
-        { 12, 252, 225, 32, 7 },
-        { 247, 148, 82, 32, 12 }, },
-      { { 228, 117, 169, 91, 14 },
-        { 209, 182, 229, 174, 5 },
-        { 125, 169, 90, 226, 7 },
-        { 167, 90, 118, 216, 11 }, },
-      { { 230, 128, 236, 116, 9 },
-        { 172, 129, 183, 139, 4 },
-        { 146, 227, 112, 22, 7 },
-        { 45, 30, 216, 19, 5 }, },
-      { { 226, 175, 118, 72, 7 },
-        { 37, 115, 120, 187, 12 },
-        { 225, 38, 239, 84, 7 },
-        { 61, 209, 236, 234, 4 }, },
-      { { 224, 162, 200, 17, 13 },
-        { 37, 128, 253, 134, 0 },
-        { 184, 129, 52, 80, 7 },
-        { 6, 27, 240, 26, 4 }, },
-      { { 226, 203, 113, 80, 12 },
-        { 48, 6, 249, 155, 12 },
-        { 48, 168, 237, 52, 7 },
-        { 61, 153, 246, 0, 12 }, },
-      { { 224, 210, 73, 197, 15 },
-        { 124, 20, 125, 142, 2 },
-        { 250, 57, 36, 176, 7 },
-        { 71, 27, 226, 131, 14 }, },
-      { { 225, 12, 194, 130, 9 },
-        { 36, 192, 33, 226, 11 },
-        { 148, 20, 51, 8, 7 },
-        { 212, 120, 64, 50, 4 }, },
-      { { 225, 127, 68, 52, 3 },
-        { 109, 23, 170, 226, 8 },
-        { 194, 194, 47, 232, 7 },
-        { 20, 117, 94, 139, 6 }, },
-      { { 231, 173, 69, 177, 14 },
-        { 177, 19, 243, 231, 10 },
-        { 120, 218, 43, 94, 7 },
-        { 94, 124, 252, 136, 13 }, },
-      { { 225, 182, 90, 159, 9 },
-        { 109, 96, 189, 246, 3 },
-        { 159, 149, 166, 216, 7 },
-        { 198, 251, 208, 107, 6 }, },
-      { { 231, 252, 32, 65, 12 },
-        { 193, 4, 113, 239, 12 },
-        { 56, 32, 67, 254, 7 },
-        { 63, 120, 226, 8, 3 }, },
-      { { 238, 51, 65, 56, 1 },
-        { 247, 34, 170, 131, 0 },
-        { 129, 200, 44, 199, 7 },
-        { 12, 21, 84, 78, 15 }, },
-      { { 238, 124, 54, 51, 4 },
-        { 195, 69, 226, 183, 13 },
-        { 44, 198, 195, 231, 7 },
-        { 190, 212, 122, 44, 3 }, },
-      { { 236, 112, 123, 248, 10 },
-        { 243, 116, 167, 154, 6 },
-        { 81, 253, 224, 227, 7 },
-        { 101, 158, 82, 236, 15 }, },
-      { { 232, 123, 59, 230, 14 },
-        { 91, 86, 111, 154, 15 },
-        { 118, 125, 205, 225, 7 },
-        { 245, 159, 102, 173, 10 }, },
-      { { 232, 149, 232, 57, 1 },
-        { 102, 162, 182, 166, 4 },
-        { 137, 193, 122, 145, 7 },
-        { 38, 86, 212, 86, 6 }, },
-      { { 238, 172, 9, 125, 5 },
-        { 159, 32, 246, 175, 8 },
-        { 171, 233, 3, 87, 7 },
-        { 31, 86, 240, 79, 9 }, },
-      { { 236, 161, 201, 55, 4 },
-        { 187, 130, 246, 134, 1 },
-        { 46, 201, 56, 83, 7 },
-        { 134, 22, 244, 29, 13 }, },
-      { { 232, 151, 189, 197, 5 },
-        { 94, 131, 124, 190, 6 },
-        { 170, 59, 222, 145, 7 },
-        { 103, 211, 236, 23, 10 }, },
-      { { 232, 204, 18, 29, 0 },
-        { 10, 100, 176, 182, 8 },
-        { 11, 132, 131, 49, 7 },
-        { 22, 208, 210, 101, 0 }, },
-      { { 238, 193, 29, 105, 8 },
-        { 146, 39, 55, 159, 0 },
-        { 25, 107, 136, 55, 7 },
-        { 15, 158, 206, 68, 9 }, },
-      { { 237, 7, 255, 219, 10 },
-        { 178, 243, 173, 254, 7 },
-        { 93, 191, 254, 11, 7 },
-        { 231, 251, 92, 244, 13 }, },
-      { { 237, 105, 243, 54, 11 },
-        { 191, 214, 163, 210, 13 },
-        { 214, 204, 249, 107, 7 },
-        { 180, 188, 86, 191, 13 }, },
-      { { 237, 118, 20, 181, 12 },
-        { 203, 5, 235, 246, 2 },
-        { 58, 210, 134, 235, 7 },
-        { 70, 253, 122, 13, 3 }, },
-      { { 239, 132, 33, 209, 7 },
-        { 150, 16, 240, 239, 6 },
-        { 232, 184, 66, 31, 7 },
-        { 111, 112, 240, 134, 9 }, },
-      { { 235, 245, 218, 120, 2 },
-        { 99, 246, 182, 251, 0 },
-        { 65, 229, 186, 253, 7 },
-        { 13, 246, 214, 252, 6 }, },
-      { { 233, 249, 229, 214, 13 },
-        { 127, 135, 241, 202, 15 },
-        { 182, 186, 121, 249, 7 },
-        { 245, 56, 254, 31, 14 }, },
-      { { 235, 211, 15, 145, 9 },
-        { 86, 71, 189, 199, 2 },
-        { 152, 159, 12, 189, 7 },
-        { 78, 59, 222, 38, 10 }, },
-      { { 233, 219, 241, 32, 9 },
-        { 118, 134, 59, 210, 12 },
-        { 144, 72, 253, 185, 7 },
-        { 52, 189, 198, 22, 14 }, },
-      { { 244, 41, 139, 109, 8 },
-        { 153, 234, 39, 142, 8 },
-        { 27, 109, 25, 66, 15 },
-        { 23, 30, 69, 121, 9 }, },
-      { { 246, 10, 52, 34, 5 },
-        { 132, 9, 106, 147, 13 },
-        { 164, 66, 197, 6, 15 },
-        { 188, 149, 105, 2, 1 }, },
-      { { 244, 88, 85, 155, 1 },
-        { 244, 45, 160, 150, 11 },
-        { 141, 154, 161, 162, 15 },
-        { 214, 144, 91, 66, 15 }, },
-      { { 242, 118, 55, 97, 3 },
-        { 85, 93, 42, 191, 4 },
-        { 200, 110, 198, 228, 15 },
-        { 47, 213, 75, 170, 10 }, },
-      { { 244, 75, 10, 224, 6 },
-        { 128, 94, 110, 138, 10 },
-        { 96, 117, 13, 34, 15 },
-        { 85, 23, 103, 160, 1 }, },
-      { { 246, 110, 129, 75, 12 },
-        { 145, 172, 105, 175, 9 },
-        { 61, 40, 23, 102, 15 },
-        { 159, 89, 99, 88, 9 }, },
-      { { 246, 67, 29, 76, 6 },
-        { 152, 63, 108, 155, 0 },
-        { 99, 43, 140, 38, 15 },
-        { 13, 147, 111, 193, 9 }, },
-      { { 244, 87, 34, 238, 1 },
-        { 204, 110, 42, 170, 7 },
-        { 135, 116, 78, 162, 15 },
-        { 229, 85, 71, 99, 3 }, },
-      { { 244, 153, 83, 229, 11 },
-        { 252, 90, 51, 158, 10 },
-        { 218, 124, 169, 146, 15 },
-        { 87, 156, 197, 163, 15 }, },
-      { { 240, 252, 47, 27, 5 },
-        { 85, 109, 244, 166, 13 },
-        { 173, 143, 67, 240, 15 },
-        { 182, 82, 251, 106, 10 }, },
-      { { 247, 9, 30, 9, 12 },
-        { 128, 107, 101, 215, 8 },
-        { 57, 7, 137, 14, 15 },
-        { 30, 186, 109, 96, 1 }, },
-      { { 247, 38, 87, 194, 0 },
-        { 177, 73, 40, 251, 3 },
-        { 4, 62, 166, 78, 15 },
-        { 205, 241, 73, 40, 13 }, },
-      { { 241, 133, 27, 198, 13 },
-        { 28, 74, 117, 250, 3 },
-        { 182, 61, 138, 24, 15 },
-        { 197, 250, 229, 35, 8 }, },
-      { { 243, 136, 98, 232, 1 },
-        { 36, 104, 50, 203, 14 },
-        { 129, 116, 97, 28, 15 },
-        { 125, 52, 193, 98, 4 }, },
-      { { 247, 169, 183, 234, 6 },
-        { 145, 251, 114, 219, 15 },
-        { 101, 126, 217, 94, 15 },
-        { 253, 180, 237, 248, 9 }, },
-      { { 247, 138, 138, 92, 2 },
-        { 136, 248, 188, 203, 8 },
-        { 67, 165, 21, 30, 15 },
-        { 29, 51, 209, 241, 1 }, },
-      { { 243, 237, 194, 21, 2 },
-        { 41, 222, 176, 231, 8 },
-        { 74, 132, 59, 124, 15 },
-        { 30, 112, 215, 185, 4 }, },
-      { { 245, 245, 148, 242, 4 },
-        { 193, 143, 242, 250, 3 },
-        { 36, 242, 154, 250, 15 },
-        { 197, 244, 255, 24, 3 }, },
-      { { 248, 15, 62, 15, 4 },
-        { 10, 107, 108, 182, 13 },
-        { 47, 7, 207, 1, 15 },
-        { 182, 211, 109, 101, 0 }, },
-      { { 252, 190, 99, 125, 14 },
-        { 251, 120, 251, 174, 12 },
-        { 123, 236, 103, 211, 15 },
-        { 55, 93, 241, 237, 15 }, },
-      { { 248, 237, 33, 73, 11 },
-        { 23, 62, 49, 174, 12 },
-        { 217, 40, 75, 113, 15 },
-        { 55, 88, 199, 206, 8 }, },
-      { { 250, 216, 194, 128, 14 },
-        { 98, 220, 113, 131, 10 },
-        { 112, 20, 49, 181, 15 },
-        { 92, 24, 227, 180, 6 }, },
-      { { 254, 229, 5, 156, 6 },
-        { 155, 63, 240, 163, 2 },
-        { 99, 154, 10, 119, 15 },
-        { 76, 80, 255, 205, 9 }, },
-      { { 254, 196, 253, 27, 8 },
-        { 178, 173, 181, 183, 5 },
-        { 29, 139, 242, 55, 15 },
-        { 174, 218, 219, 84, 13 }, },
-      { { 250, 210, 225, 31, 4 },
-        { 122, 172, 248, 135, 5 },
-        { 47, 136, 116, 181, 15 },
-        { 174, 17, 243, 85, 14 }, },
-      { { 252, 195, 230, 115, 2 },
-        { 162, 223, 186, 142, 5 },
-        { 76, 230, 124, 51, 15 },
-        { 167, 21, 223, 180, 5 }, },
-      { { 249, 63, 162, 110, 11 },
-        { 79, 250, 43, 234, 13 },
-        { 215, 100, 95, 201, 15 },
-        { 181, 125, 69, 255, 2 }, },
-      { { 251, 86, 194, 94, 3 },
-        { 110, 252, 168, 235, 1 },
-        { 199, 164, 54, 173, 15 },
-        { 141, 113, 83, 247, 6 }, },
-      { { 255, 78, 140, 162, 15 },
-        { 134, 157, 111, 227, 11 },
-        { 244, 83, 23, 47, 15 },
-        { 220, 127, 107, 150, 1 }, },
-      { { 255, 79, 112, 226, 4 },
-        { 162, 14, 106, 251, 15 },
-        { 36, 112, 239, 47, 15 },
-        { 253, 245, 103, 4, 5 }, },
-      { { 249, 177, 42, 52, 9 },
-        { 79, 74, 183, 194, 4 },
-        { 146, 197, 72, 217, 15 },
-        { 36, 62, 213, 47, 2 }, },
-      { { 255, 135, 146, 120, 1 },
-        { 134, 234, 186, 251, 0 },
-        { 129, 228, 158, 31, 15 },
-        { 13, 245, 213, 118, 1 }, },
-      { { 249, 195, 188, 9, 10 },
-        { 2, 191, 61, 214, 4 },
-        { 89, 3, 220, 57, 15 },
-        { 38, 187, 207, 212, 0 }, },
-      { { 255, 202, 25, 209, 12 },
-        { 146, 12, 253, 223, 10 },
-        { 56, 185, 133, 63, 15 },
-        { 95, 187, 243, 4, 9 }, },
-      { { 255, 239, 23, 165, 10 },
-        { 155, 95, 59, 247, 10 },
-        { 90, 94, 143, 127, 15 },
-        { 94, 253, 207, 173, 9 }, },
-      { { 253, 254, 218, 140, 1 },
-        { 239, 236, 60, 242, 10 },
-        { 131, 21, 183, 251, 15 },
-        { 84, 243, 195, 127, 7 }, },
-      { { 6, 66, 233, 9, 7 },
-        { 180, 180, 76, 5, 4 },
-        { 233, 9, 116, 38, 0 },
-        { 42, 3, 34, 210, 13 }, },
-      { { 3, 36, 36, 70, 13 },
-        { 13, 1, 65, 105, 5 },
-        { 182, 34, 66, 76, 0 },
-        { 169, 104, 40, 11, 0 }, },
-      { { 7, 94, 92, 135, 12 },
-        { 232, 5, 77, 117, 11 },
-        { 62, 19, 167, 174, 0 },
-        { 218, 235, 42, 1, 7 }, },
-      { { 7, 136, 66, 250, 6 },
-        { 160, 112, 210, 73, 11 },
-        { 101, 244, 33, 30, 0 },
-        { 217, 36, 176, 224, 5 }, },
-      { { 10, 7, 178, 27, 11 },
-        { 6, 242, 137, 53, 5 },
-        { 221, 132, 222, 5, 0 },
-        { 170, 201, 20, 246, 0 }, },
-      { { 16, 148, 220, 241, 14 },
-        { 96, 153, 215, 60, 2 },
-        { 120, 243, 178, 144, 8 },
-        { 67, 206, 185, 144, 6 }, },
-      { { 22, 162, 90, 176, 15 },
-        { 165, 88, 223, 17, 2 },
-        { 240, 213, 164, 86, 8 },
-        { 72, 143, 177, 170, 5 }, },
-      { { 16, 253, 203, 109, 14 },
-        { 121, 254, 87, 44, 8 },
-        { 123, 109, 59, 240, 8 },
-        { 19, 78, 167, 249, 14 }, },
-      { { 17, 52, 172, 162, 12 },
-        { 65, 137, 71, 96, 7 },
-        { 52, 83, 82, 200, 8 },
-        { 224, 110, 41, 24, 2 }, },
-      { { 17, 166, 62, 16, 1 },
-        { 5, 73, 156, 112, 4 },
-        { 128, 135, 198, 88, 8 },
-        { 32, 227, 153, 42, 0 }, },
-      { { 30, 88, 44, 226, 2 },
-        { 194, 29, 6, 9, 15 },
-        { 68, 115, 65, 167, 8 },
-        { 249, 6, 11, 132, 3 }, },
-      { { 24, 99, 58, 139, 0 },
-        { 3, 110, 12, 20, 7 },
-        { 13, 21, 204, 97, 8 },
-        { 226, 131, 7, 108, 0 }, },
-      { { 26, 99, 1, 47, 13 },
-        { 31, 46, 75, 5, 1 },
-        { 191, 72, 12, 101, 8 },
-        { 138, 13, 39, 79, 8 }, },
-      { { 26, 241, 71, 206, 15 },
-        { 127, 127, 81, 9, 3 },
-        { 247, 62, 40, 245, 8 },
-        { 201, 8, 175, 239, 14 }, },
-      { { 25, 108, 177, 139, 1 },
-        { 23, 172, 0, 116, 15 },
-        { 141, 24, 211, 105, 8 },
-        { 242, 224, 3, 94, 8 }, },
-      { { 29, 149, 207, 92, 12 },
-        { 250, 235, 213, 104, 0 },
-        { 51, 175, 58, 155, 8 },
-        { 1, 106, 189, 117, 15 }, },
-      { { 25, 158, 56, 146, 2 },
-        { 66, 24, 156, 112, 15 },
-        { 68, 145, 199, 153, 8 },
-        { 240, 227, 145, 132, 2 }, },
-      { { 31, 252, 86, 35, 10 },
-        { 227, 93, 19, 117, 9 },
-        { 92, 70, 163, 255, 8 },
-        { 154, 236, 139, 172, 7 }, },
-      { { 36, 27, 41, 179, 3 },
-        { 212, 18, 174, 4, 15 },
-        { 204, 217, 77, 130, 4 },
-        { 242, 7, 84, 130, 11 }, },
-      { { 38, 231, 136, 133, 0 },
-        { 137, 134, 60, 37, 2 },
-        { 10, 17, 30, 118, 4 },
-        { 74, 67, 198, 25, 1 }, },
-      { { 33, 7, 54, 188, 1 },
-        { 12, 99, 170, 112, 6 },
-        { 131, 214, 206, 8, 4 },
-        { 96, 229, 92, 99, 0 }, },
-      { { 40, 77, 70, 86, 10 },
-        { 42, 87, 161, 40, 9 },
-        { 86, 166, 43, 33, 4 },
-        { 145, 72, 94, 165, 4 }, },
-      { { 46, 236, 227, 69, 8 },
-        { 187, 196, 49, 45, 12 },
-        { 26, 44, 115, 119, 4 },
-        { 59, 72, 194, 61, 13 }, },
-      { { 45, 79, 225, 77, 4 },
-        { 186, 166, 104, 108, 12 },
-        { 43, 40, 127, 43, 4 },
-        { 51, 97, 102, 85, 13 }, },
-      { { 45, 138, 40, 60, 7 },
-        { 142, 48, 254, 64, 12 },
-        { 227, 193, 69, 27, 4 },
-        { 48, 39, 240, 199, 1 }, },
-      { { 52, 248, 62, 55, 1 },
-        { 205, 77, 182, 20, 13 },
-        { 142, 199, 193, 242, 12 },
-        { 178, 134, 219, 43, 3 }, },
-      { { 56, 99, 93, 125, 8 },
-        { 59, 47, 175, 28, 0 },
-        { 27, 235, 172, 97, 12 },
-        { 3, 143, 95, 77, 12 }, },
-      { { 63, 162, 28, 196, 12 },
-        { 139, 9, 125, 89, 2 },
-        { 50, 51, 132, 95, 12 },
-        { 73, 171, 233, 13, 1 }, },
-      { { 66, 221, 151, 174, 14 },
-        { 88, 247, 83, 177, 11 },
-        { 119, 94, 155, 180, 2 },
-        { 216, 220, 174, 241, 10 }, },
-      { { 68, 223, 18, 214, 11 },
-        { 204, 86, 153, 184, 11 },
-        { 214, 180, 143, 178, 2 },
-        { 209, 217, 150, 163, 3 }, },
-      { { 65, 58, 205, 236, 8 },
-        { 121, 161, 15, 200, 10 },
-        { 19, 123, 53, 200, 2 },
-        { 81, 63, 8, 89, 14 }, },
-      { { 65, 192, 219, 73, 4 },
-        { 48, 228, 84, 220, 0 },
-        { 41, 45, 176, 56, 2 },
-        { 3, 178, 162, 112, 12 }, },
-      { { 76, 180, 0, 200, 13 },
-        { 199, 32, 81, 168, 2 },
-        { 177, 48, 2, 211, 2 },
-        { 65, 88, 160, 78, 3 }, },
-      { { 73, 35, 72, 149, 2 },
-        { 43, 18, 140, 196, 2 },
-        { 74, 145, 44, 73, 2 },
-        { 66, 51, 20, 141, 4 }, },
-      { { 82, 55, 185, 92, 6 },
-        { 89, 186, 204, 185, 4 },
-        { 99, 169, 222, 196, 10 },
-        { 41, 211, 53, 217, 10 }, },
-      { { 82, 81, 56, 221, 10 },
-        { 72, 62, 133, 157, 6 },
-        { 91, 177, 200, 164, 10 },
-        { 107, 154, 23, 193, 2 }, },
-      { { 94, 113, 146, 65, 3 },
-        { 199, 222, 0, 157, 0 },
-        { 200, 36, 152, 231, 10 },
-        { 11, 144, 7, 190, 3 }, },
-      { { 92, 178, 113, 235, 13 },
-        { 247, 40, 91, 156, 7 },
-        { 189, 120, 228, 211, 10 },
-        { 227, 157, 161, 78, 15 }, },
-      { { 91, 238, 55, 54, 6 },
-        { 27, 93, 218, 241, 13 },
-        { 102, 206, 199, 125, 10 },
-        { 184, 245, 187, 173, 8 }, },
-      { { 96, 5, 132, 21, 2 },
-        { 8, 147, 160, 164, 0 },
-        { 74, 130, 26, 0, 6 },
-        { 2, 80, 92, 145, 0 }, },
-      { { 100, 8, 128, 51, 8 },
-        { 128, 128, 163, 132, 9 },
-        { 28, 192, 17, 2, 6 },
-        { 146, 28, 80, 16, 1 }, },
-      { { 110, 40, 135, 140, 3 },
-        { 159, 241, 32, 129, 10 },
-        { 195, 30, 17, 71, 6 },
-        { 88, 16, 72, 255, 9 }, },
-      { { 108, 85, 84, 181, 7 },
-        { 238, 23, 226, 180, 2 },
-        { 234, 210, 170, 163, 6 },
-        { 66, 212, 126, 135, 7 }, },
-      { { 104, 186, 254, 70, 1 },
-        { 111, 193, 60, 152, 13 },
-        { 134, 39, 245, 209, 6 },
-        { 177, 147, 200, 63, 6 }, },
-      { { 104, 179, 85, 202, 7 },
-        { 119, 51, 120, 152, 3 },
-        { 229, 58, 172, 209, 6 },
-        { 193, 145, 236, 206, 14 }, },
-      { { 117, 156, 155, 102, 9 },
-        { 220, 200, 55, 248, 9 },
-        { 150, 109, 147, 154, 14 },
-        { 145, 254, 193, 51, 11 }, },
-      { { 124, 11, 200, 10, 0 },
-        { 162, 170, 44, 128, 9 },
-        { 5, 1, 61, 3, 14 },
-        { 144, 19, 69, 84, 5 }, },
-      { { 126, 89, 104, 196, 9 },
-        { 238, 14, 37, 137, 14 },
-        { 146, 49, 105, 167, 14 },
-        { 121, 26, 71, 7, 7 }, },
-      { { 120, 111, 61, 52, 5 },
-        { 31, 15, 238, 176, 12 },
-        { 162, 203, 207, 97, 14 },
-        { 48, 215, 127, 15, 8 }, },
-      { { 120, 193, 191, 255, 10 },
-        { 26, 255, 183, 156, 7 },
-        { 95, 255, 216, 49, 14 },
-        { 227, 158, 223, 245, 8 }, },
-      { { 122, 218, 185, 69, 10 },
-        { 90, 156, 61, 157, 12 },
-        { 90, 41, 213, 181, 14 },
-        { 59, 155, 195, 149, 10 }, },
-      { { 128, 60, 123, 156, 0 },
-        { 121, 96, 132, 50, 14 },
-        { 3, 157, 227, 192, 1 },
-        { 116, 194, 16, 105, 14 }, },
-      { { 135, 20, 88, 249, 7 },
-        { 228, 48, 198, 127, 2 },
-        { 233, 241, 162, 142, 1 },
-        { 79, 230, 48, 194, 7 }, },
-      { { 131, 27, 5, 165, 13 },
-        { 92, 3, 75, 71, 10 },
-        { 186, 90, 13, 140, 1 },
-        { 94, 45, 44, 3, 10 }, },
-      { { 136, 59, 180, 103, 4 },
-        { 75, 131, 74, 30, 13 },
-        { 46, 98, 221, 193, 1 },
-        { 183, 133, 44, 29, 2 }, },
-      { { 140, 169, 136, 156, 0 },
-        { 139, 162, 148, 2, 10 },
-        { 3, 145, 25, 83, 1 },
-        { 84, 2, 148, 93, 1 }, },
-      { { 142, 177, 3, 26, 11 },
-        { 215, 114, 145, 3, 1 },
-        { 213, 140, 8, 215, 1 },
-        { 140, 8, 148, 238, 11 }, },
-      { { 143, 39, 191, 54, 4 },
-        { 155, 195, 206, 115, 5 },
-        { 38, 207, 222, 79, 1 },
-        { 172, 231, 60, 61, 9 }, },
-      { { 143, 22, 179, 202, 0 },
-        { 210, 224, 8, 123, 7 },
-        { 5, 60, 214, 143, 1 },
-        { 237, 225, 0, 116, 11 }, },
-      { { 148, 24, 222, 74, 0 },
-        { 224, 233, 4, 26, 9 },
-        { 5, 39, 177, 130, 9 },
-        { 149, 130, 9, 112, 7 }, },
-      { { 147, 69, 36, 197, 0 },
-        { 8, 15, 0, 111, 6 },
-        { 10, 50, 74, 44, 9 },
-        { 111, 96, 15, 1, 0 }, },
-      { { 156, 253, 156, 216, 5 },
-        { 199, 175, 212, 58, 10 },
-        { 161, 179, 155, 243, 9 },
-        { 85, 194, 191, 94, 3 }, },
-      { { 155, 34, 55, 120, 13 },
-        { 23, 105, 203, 91, 4 },
-        { 177, 238, 196, 77, 9 },
-        { 45, 173, 57, 110, 8 }, },
-      { { 153, 250, 163, 209, 6 },
-        { 83, 220, 216, 78, 14 },
-        { 104, 188, 85, 249, 9 },
-        { 119, 33, 179, 188, 10 }, },
-      { { 162, 159, 28, 84, 3 },
-        { 76, 19, 188, 59, 8 },
-        { 194, 163, 143, 148, 5 },
-        { 29, 195, 220, 131, 2 }, },
-      { { 172, 79, 91, 26, 11 },
-        { 182, 118, 173, 50, 9 },
-        { 213, 141, 175, 35, 5 },
-        { 148, 203, 86, 230, 13 }, },
-      { { 172, 191, 109, 54, 6 },
-        { 251, 19, 254, 34, 13 },
-        { 102, 203, 111, 211, 5 },
-        { 180, 71, 252, 141, 15 }, },
-      { { 169, 185, 76, 64, 8 },
-        { 99, 3, 53, 74, 8 },
-        { 16, 35, 41, 217, 5 },
-        { 21, 42, 204, 12, 6 }, },
-      { { 182, 40, 233, 2, 12 },
-        { 177, 136, 101, 3, 13 },
-        { 52, 9, 113, 70, 13 },
-        { 188, 10, 97, 24, 13 }, },
-      { { 180, 109, 218, 222, 0 },
-        { 169, 238, 164, 58, 11 },
-        { 7, 181, 187, 98, 13 },
-        { 213, 194, 87, 121, 5 }, },
-      { { 178, 110, 246, 10, 1 },
-        { 37, 237, 40, 51, 13 },
-        { 133, 6, 247, 100, 13 },
-        { 188, 193, 75, 122, 4 }, },
-      { { 179, 37, 153, 105, 14 },
-        { 17, 186, 103, 127, 0 },
-        { 121, 105, 154, 76, 13 },
-        { 15, 238, 101, 216, 8 }, },
-      { { 179, 80, 40, 17, 5 },
-        { 68, 12, 228, 71, 4 },
-        { 168, 129, 64, 172, 13 },
-        { 46, 34, 115, 2, 2 }, },
-      { { 190, 28, 27, 59, 6 },
-        { 210, 120, 230, 55, 9 },
-        { 109, 205, 131, 135, 13 },
-        { 158, 198, 113, 228, 11 }, },
-      { { 188, 127, 85, 99, 14 },
-        { 243, 31, 107, 62, 9 },
-        { 124, 106, 175, 227, 13 },
-        { 151, 205, 111, 140, 15 }, },
-      { { 188, 175, 230, 141, 5 },
-        { 175, 235, 120, 38, 14 },
-        { 171, 22, 127, 83, 13 },
-        { 118, 65, 237, 127, 5 }, },
-      { { 189, 37, 146, 140, 4 },
-        { 139, 234, 96, 114, 2 },
-        { 35, 20, 154, 75, 13 },
-        { 68, 224, 101, 125, 1 }, },
-      { { 196, 27, 214, 183, 1 },
-        { 236, 195, 138, 150, 11 },
-        { 142, 214, 189, 130, 3 },
-        { 214, 149, 28, 51, 7 }, },
-      { { 198, 99, 190, 252, 14 },
-        { 137, 247, 207, 155, 6 },
-        { 115, 247, 220, 102, 3 },
-        { 109, 159, 62, 249, 1 }, },
-      { { 198, 86, 130, 19, 13 },
-        { 196, 196, 201, 167, 1 },
-        { 188, 132, 22, 166, 3 },
-        { 142, 89, 50, 50, 3 }, },
-      { { 198, 139, 73, 36, 10 },
-        { 184, 18, 31, 131, 8 },
-        { 82, 73, 45, 22, 3 },
-        { 28, 31, 132, 129, 13 }, },
-      { { 193, 61, 206, 190, 2 },
-        { 105, 243, 134, 226, 11 },
-        { 71, 215, 59, 200, 3 },
-        { 212, 118, 28, 249, 6 }, },
-      { { 197, 25, 109, 109, 1 },
-        { 252, 35, 6, 206, 12 },
-        { 139, 107, 105, 138, 3 },
-        { 55, 54, 12, 67, 15 }, },
-      { { 199, 77, 61, 239, 11 },
-        { 156, 55, 7, 255, 15 },
-        { 223, 123, 203, 46, 3 },
-        { 255, 254, 14, 195, 9 }, },
-      { { 193, 90, 43, 220, 9 },
-        { 92, 100, 141, 202, 14 },
-        { 147, 189, 69, 168, 3 },
-        { 117, 59, 18, 99, 10 }, },
-      { { 202, 35, 114, 33, 12 },
-        { 35, 66, 75, 151, 4 },
-        { 56, 68, 236, 69, 3 },
-        { 46, 157, 36, 44, 4 }, },
-      { { 207, 199, 244, 213, 9 },
-        { 174, 135, 153, 255, 6 },
-        { 154, 178, 254, 63, 3 },
-        { 111, 249, 158, 23, 5 }, },
-      { { 208, 49, 39, 226, 6 },
-        { 81, 91, 66, 138, 7 },
-        { 100, 126, 72, 192, 11 },
-        { 229, 20, 45, 168, 10 }, },
-      { { 212, 119, 84, 14, 0 },
-        { 233, 47, 8, 178, 1 },
-        { 7, 2, 174, 226, 11 },
-        { 132, 209, 15, 73, 7 }, },
-      { { 209, 134, 49, 90, 2 },
-        { 16, 56, 152, 250, 5 },
-        { 69, 168, 198, 24, 11 },
-        { 165, 241, 145, 192, 8 }, },
-      { { 219, 76, 100, 122, 11 },
-        { 38, 61, 131, 235, 13 },
-        { 213, 226, 99, 45, 11 },
-        { 189, 124, 27, 198, 4 }, },
-      { { 219, 132, 135, 144, 8 },
-        { 18, 201, 145, 227, 2 },
-        { 16, 158, 18, 29, 11 },
-        { 76, 120, 153, 52, 8 }, },
-      { { 223, 222, 6, 112, 0 },
-        { 194, 77, 154, 235, 8 },
-        { 0, 230, 7, 191, 11 },
-        { 29, 117, 155, 36, 3 }, },
-      { { 226, 41, 186, 96, 0 },
-        { 1, 194, 38, 155, 12 },
-        { 0, 101, 217, 68, 7 },
-        { 61, 150, 68, 56, 0 }, },
-      { { 225, 64, 224, 141, 6 },
-        { 40, 180, 96, 198, 6 },
-        { 107, 16, 112, 40, 7 },
-        { 102, 48, 98, 209, 4 }, },
-      { { 225, 154, 144, 165, 2 },
-        { 72, 144, 58, 214, 10 },
-        { 74, 80, 149, 152, 7 },
-        { 86, 181, 192, 145, 2 }, },
-      { { 231, 242, 192, 250, 9 },
-        { 229, 164, 187, 203, 3 },
-        { 149, 240, 52, 254, 7 },
-        { 205, 61, 210, 90, 7 }, },
-      { { 238, 173, 190, 131, 8 },
-        { 131, 195, 53, 183, 15 },
-        { 28, 23, 219, 87, 7 },
-        { 254, 218, 204, 60, 1 }, },
-      { { 240, 28, 242, 124, 1 },
-        { 108, 232, 162, 186, 12 },
-        { 131, 228, 243, 128, 15 },
-        { 53, 212, 81, 115, 6 }, },
-      { { 247, 101, 168, 38, 4 },
-        { 137, 142, 102, 227, 5 },
-        { 38, 65, 90, 110, 15 },
-        { 172, 118, 103, 25, 1 }, },
-      { { 247, 236, 195, 164, 13 },
-        { 189, 204, 115, 227, 10 },
-        { 178, 92, 51, 126, 15 },
-        { 92, 124, 227, 59, 13 }, },
-      { { 248, 45, 84, 113, 4 },
-        { 35, 11, 226, 190, 8 },
-        { 40, 226, 171, 65, 15 },
-        { 23, 212, 125, 12, 4 }, },
-      { { 254, 133, 143, 205, 11 },
-        { 158, 251, 53, 175, 2 },
-        { 219, 63, 26, 23, 15 },
-        { 79, 90, 205, 247, 9 }, },
-      { { 248, 227, 91, 11, 6 },
-        { 51, 126, 124, 150, 1 },
-        { 109, 13, 172, 113, 15 },
-        { 134, 147, 231, 236, 12 }, },
-      { { 254, 214, 62, 31, 15 },
-        { 206, 125, 253, 183, 5 },
-        { 255, 135, 198, 183, 15 },
-        { 174, 219, 251, 231, 3 }, }, };
+static constexpr uint64 DICT_7X7_1000_CODES[][4] = {
+    { 0x1bab8d94b9415ULL, 0x0c7675bc86368ULL, 0x15053a5363abbULL, 0x02d8c27b5cdc6ULL },
+    { 0x1c837e27c8156ULL, 0x023fb12176a55ULL, 0x0d5027c8fd827ULL, 0x154add091bf88ULL },
+    { 0x13d545758ba4fULL, 0x1476d3d229757ULL, 0x1e4ba35d45579ULL, 0x1d5d289796dc5ULL },
+    { 0x14cce0b6fd298ULL, 0x1ba6065bb4b58ULL, 0x03297eda0e665ULL, 0x035a5bb4c0cbbULL },
+    { 0x18d78f62664acULL, 0x1fb8316e334c2ULL, 0x06a4cc8de3d63ULL, 0x086598ed183bfULL },
+    { 0x0b1002846b3dcULL, 0x008f438a1710bULL, 0x0779ac428011aULL, 0x1a11d0a385e20ULL },
+    { 0x1a6d77cdea890ULL, 0x149e18c8dee7eULL, 0x0122af67dd6cbULL, 0x0fcef62630f25ULL },
+    { 0x07942db1117b6ULL, 0x04a1d7f52598cULL, 0x0dbd111b6853cULL, 0x0633495fd70a4ULL },
+    { 0x1120e3ead2d3cULL, 0x0e094d063cefaULL, 0x079696af8e091ULL, 0x0bee78c16520eULL },
+    { 0x176cb631adc7eULL, 0x190ad1dfecbe5ULL, 0x0fc76b18da6ddULL, 0x14fa6ff716a13ULL },
+    { 0x1ea01a305e921ULL, 0x016b04b17a0e2ULL, 0x1092f418b00afULL, 0x08e0bd1a41ad0ULL },
+    { 0x0044ce170a834ULL, 0x1a0e11700c096ULL, 0x0582a1d0e6440ULL, 0x0d20601d10e0bULL },
+    { 0x0a9e6d72e91e1ULL, 0x06e330f8b3f91ULL, 0x10f12e9d6cf2aULL, 0x113f9a3e198ecULL },
+    { 0x13c49108c4733ULL, 0x1d61cac4542c0ULL, 0x199c462112479ULL, 0x00685446a70d7ULL },
+    { 0x17bfe64d79397ULL, 0x08ffffc995d74ULL, 0x1d393d64cffbdULL, 0x05d75327fffe2ULL },
+    { 0x19c220b60b52fULL, 0x1267e116229caULL, 0x1e95a0da08873ULL, 0x0a7288d10fcc9ULL },
+    { 0x1a7e0c2e43f16ULL, 0x1205bbe4bf162ULL, 0x0d1f84e860fcbULL, 0x08d1fa4fbb409ULL },
+    { 0x003c33d9d91dbULL, 0x04cb8c52d5f2dULL, 0x1b71373798780ULL, 0x169f569463a64ULL },
+    { 0x04d979854e0f1ULL, 0x15f60021d589fULL, 0x11e0e5433d364ULL, 0x1f23570800df5ULL },
+    { 0x070fa9aec8226ULL, 0x0e16ebe1b0a88ULL, 0x0c8826eb2be1cULL, 0x022a1b0faed0eULL },
+    { 0x0752095d3c3d3ULL, 0x15c7eeb905405ULL, 0x197879752095cULL, 0x1405413aefc75ULL },
+    { 0x08da908f679baULL, 0x1ba5a80adf18eULL, 0x0bb3cde212b62ULL, 0x0e31f6a02b4bbULL },
+    { 0x091254fbd3c57ULL, 0x0240fd147f71fULL, 0x1d4797be54912ULL, 0x1f1dfc517e048ULL },
+    { 0x0bced87c93150ULL, 0x18256cf0e6713ULL, 0x0151927c36e7aULL, 0x191cce1e6d483ULL },
+    { 0x0e945bdf45f11ULL, 0x076d0af55f51cULL, 0x111f45f7b452eULL, 0x0715f55ea16dcULL },
+    { 0x128bbc45026b2ULL, 0x08b4b2a4c4cc6ULL, 0x09ac81447ba29ULL, 0x0c66464a9a5a2ULL },
+    { 0x136252ac9db47ULL, 0x114fef8068379ULL, 0x1c5b726a948d9ULL, 0x13d82c03efe51ULL },
+    { 0x143a9285b05f0ULL, 0x088d240dc52edULL, 0x01f41b4292b85ULL, 0x16e9476049622ULL },
+    { 0x176f1cc62d9a1ULL, 0x13d770e9c85e8ULL, 0x10b368c671eddULL, 0x02f4272e1dd79ULL },
+    { 0x1976bbb97b630ULL, 0x1c0a6e7c779eeULL, 0x018dbd3bbadd3ULL, 0x0ef3dc7ceca07ULL },
+    { 0x1a7cbdd6f0666ULL, 0x1e0497fcd3ee9ULL, 0x0ccc1ed77a7cbULL, 0x12ef967fd240fULL },
+    { 0x1e528467fa339ULL, 0x1a47368b376c6ULL, 0x1398bfcc4294fULL, 0x0c6dd9a2d9c4bULL },
+    { 0x1fbada33e77cdULL, 0x0be963bff3377ULL, 0x167dcf98b6bbfULL, 0x1dd99ffb8d2faULL },
+    { 0x0748c49dd09ddULL, 0x18c55d939c21dULL, 0x177217724625cULL, 0x1708739375463ULL },
+    { 0x0c430fc48761eULL, 0x151cb3270670aULL, 0x0f0dc247e1846ULL, 0x0a1cc1c99a715ULL },
+    { 0x0159a86df3b86ULL, 0x1895cf28b9f06ULL, 0x0c3b9f6c2b350ULL, 0x0c1f3a29e7523ULL },
+    { 0x01c81a9871c04ULL, 0x10284d3cd8108ULL, 0x04071c32b0270ULL, 0x0210367964281ULL },
+    { 0x0293fb340c448ULL, 0x0d3e20b661811ULL, 0x02446059bf928ULL, 0x11030cda08f96ULL },
+    { 0x03345c234cbdaULL, 0x0383d2e27d035ULL, 0x0b7a658874598ULL, 0x15817c8e97838ULL },
+    { 0x056a104fc3668ULL, 0x12046a07d07a7ULL, 0x02cd87e410ad4ULL, 0x1cbc17c0ac409ULL },
+    { 0x052d271253f46ULL, 0x0619d75598923ULL, 0x0c5f9491c9694ULL, 0x18923355d730cULL },
+    { 0x059eea9b7e8adULL, 0x0bea6d7b9989eULL, 0x16a2fdb2aef34ULL, 0x0f2333bd6cafaULL },
+    { 0x06bd27f3c6cf8ULL, 0x07b810d7bdeafULL, 0x03e6c79fc97acULL, 0x1eaf7bd6103bcULL },
+    { 0x07ee957b07be7ULL, 0x1fe1fbd1e85a7ULL, 0x1cfbc1bd52efcULL, 0x1cb42f17bf0ffULL },
+    { 0x089a053e9fe80ULL, 0x07a63e14ab302ULL, 0x002ff2f940b22ULL, 0x0819aa50f8cbcULL },
+    { 0x09081c90855eaULL, 0x0181d036c2389ULL, 0x0af5421270212ULL, 0x123886d817030ULL },
+    { 0x0be3226d06804ULL, 0x113c69802ac26ULL, 0x0402c16c898faULL, 0x0c86a8032c791ULL },
+    { 0x0bd64e4807abbULL, 0x11e8fae20f592ULL, 0x1babc024e4d7aULL, 0x0935e08ebe2f1ULL },
+    { 0x0df36483e2b84ULL, 0x12b173091ba3eULL, 0x043a8f824d9f6ULL, 0x0f8bb1219d1a9ULL },
+    { 0x0e555f24151c7ULL, 0x15dd95e163111ULL, 0x1c715049f554eULL, 0x11118d0f53775ULL },
+    { 0x0f310ea770c6dULL, 0x025c55af3b0adULL, 0x16c61dcae119eULL, 0x16a1b9eb54748ULL },
+    { 0x0f7ce275cf2a3ULL, 0x19cec2d1b3fb6ULL, 0x18a9e75c8e7deULL, 0x0dbf9b1686e73ULL },
+    { 0x10ad48d92b3c0ULL, 0x00b30a788057fULL, 0x0079a936256a1ULL, 0x1fd4023ca19a0ULL },
+    { 0x11c7fdde5b2a3ULL, 0x1ef6fe7050ddaULL, 0x18a9b4f77fc71ULL, 0x0b76141cfedefULL },
+    { 0x15a719a42e6cfULL, 0x05f6e36f6006bULL, 0x1e6ce84b31cb5ULL, 0x1ac00ded8edf4ULL },
+    { 0x1626e4a61727fULL, 0x0b44b7c3249fbULL, 0x1fc9d0ca4ec8dULL, 0x1bf24987da45aULL },
+    { 0x1758701a4a3b6ULL, 0x1283cb91d58d2ULL, 0x0db8a4b01c35dULL, 0x09635713a7829ULL },
+    { 0x182eadaba314dULL, 0x0e41396aa2b6fULL, 0x16518bab6ae83ULL, 0x1eda8aad3904eULL },
+    { 0x19cc3a6fdca22ULL, 0x132ece60faec4ULL, 0x088a77ecb8673ULL, 0x046ebe0ce6e99ULL },
+    { 0x1a4b9306dbab7ULL, 0x1edea780de3c2ULL, 0x1dabb6c193a4bULL, 0x0878f603caf6fULL },
+    { 0x1a0d523d3df9dULL, 0x01df0fdeee154ULL, 0x173f79789560bULL, 0x0550eef7e1f70ULL },
+    { 0x093c9c71b52b5ULL, 0x09c05778e77a4ULL, 0x15a95b1c72792ULL, 0x04bdce3dd4072ULL },
+    { 0x0a5a33e503f66ULL, 0x140da384ebd8fULL, 0x0cdf814f98b4aULL, 0x1e37ae438b605ULL },
+    { 0x004315e30e741ULL, 0x175332046040fULL, 0x105ce18f51840ULL, 0x1e040c409995dULL },
+    { 0x00b809670a2eeULL, 0x06a68322a14a7ULL, 0x0ee8a1cd203a0ULL, 0x1ca50a8982cacULL },
+    { 0x01eb15243133eULL, 0x1435f70ae41a0ULL, 0x0f99184951af0ULL, 0x00b04ea1df585ULL },
+    { 0x01f9d4a888834ULL, 0x18325900ed2b8ULL, 0x0582222a573f0ULL, 0x03a96e0134983ULL },
+    { 0x02bdda6e629b1ULL, 0x0afd08e8fd4b2ULL, 0x11b28cecb77a8ULL, 0x09a57e2e217eaULL },
+    { 0x02de3c5f88b3dULL, 0x12673bf2cde84ULL, 0x179a23f478f68ULL, 0x042f669fb9cc9ULL },
+    { 0x03cbc988276e6ULL, 0x1db0ebac8019bULL, 0x0cedc82327a78ULL, 0x1b30026bae1b7ULL },
+    { 0x03f84a4cd90edULL, 0x10ee4da2917b1ULL, 0x16e13664a43f8ULL, 0x11bd128b64ee1ULL },
+    { 0x04e422dec633fULL, 0x136d8b5314eaaULL, 0x1f98c6f6884e4ULL, 0x0aae5195a36d9ULL },
+    { 0x04f36f51237b8ULL, 0x14b9323f05db6ULL, 0x03bd8915ed9e4ULL, 0x0db741f8993a5ULL },
+    { 0x05c186096d4d8ULL, 0x19ba580f14105ULL, 0x03656d20c3074ULL, 0x141051e034bb3ULL },
+    { 0x05f53c4f3cc56ULL, 0x1336dd6d4dc25ULL, 0x0d4679e4795f4ULL, 0x1487656d76d99ULL },
+    { 0x0599fa6052627ULL, 0x0878c725f1c92ULL, 0x1c8c940cbf334ULL, 0x09271f49c63c2ULL },
+    { 0x062a6060425cdULL, 0x00c12187b0c33ULL, 0x1674840c0ca8cULL, 0x19861bc309060ULL },
+    { 0x060f0e6b5fa53ULL, 0x035abee1bc507ULL, 0x194bf5ace1e0cULL, 0x1c147b0efab58ULL },
+    { 0x06fc486594f41ULL, 0x116506e5a9635ULL, 0x105e534c247ecULL, 0x158d2b4ec14d1ULL },
+    { 0x098169f15fea8ULL, 0x05b246363ad9eULL, 0x02aff51f2d032ULL, 0x0f36b8d8c49b4ULL },
+    { 0x09db571949243ULL, 0x147afa10d3115ULL, 0x18492531d5b72ULL, 0x15119610bebc5ULL },
+    { 0x099b5ba2b30dcULL, 0x06b8652ae731bULL, 0x07619a8bb5b32ULL, 0x1b19cea94c3acULL },
+    { 0x0acf6ab764ac1ULL, 0x13fc22f8ba81dULL, 0x106a4ddaade6aULL, 0x1702ba3e887f9ULL },
+    { 0x0a92eebe25396ULL, 0x0badbbb827918ULL, 0x0d3948faee92aULL, 0x0313c83bbb6baULL },
+    { 0x0a931199a0944ULL, 0x043129984b20dULL, 0x04520b331192aULL, 0x1609a43329184ULL },
+    { 0x0bcdd4950ef52ULL, 0x1937d2d4ce01fULL, 0x095ee1525767aULL, 0x1f00e65697d93ULL },
+    { 0x0c608a2eec764ULL, 0x1b0f0b2d322a1ULL, 0x04dc6ee8a20c6ULL, 0x10a89969a1e1bULL },
+    { 0x0d3c474f0e9c9ULL, 0x07cf58438b437ULL, 0x1272e1e5c4796ULL, 0x1d85a38435e7cULL },
+    { 0x0da2fc494a039ULL, 0x0862782356cb6ULL, 0x1380a5247e8b6ULL, 0x0da6d5883c8c2ULL },
+    { 0x0e07d01c59762ULL, 0x0817aed552191ULL, 0x08dd347017c0eULL, 0x11309556ebd02ULL },
+    { 0x0eea0b5162857ULL, 0x1468a1b99e427ULL, 0x1d428d15a0aeeULL, 0x1c84f33b0a2c5ULL },
+    { 0x104c9c256492fULL, 0x1945916af80c4ULL, 0x1e924d4872641ULL, 0x04603ead13453ULL },
+    { 0x107fb4fa3e38aULL, 0x1b93be5ae1c6aULL, 0x0a38f8be5bfc1ULL, 0x0ac70eb4fb93bULL },
+    { 0x1277ad69ac0fbULL, 0x1dd2b8ea25ee5ULL, 0x1be06b2d6bdc9ULL, 0x14ef48ae3a977ULL },
+    { 0x129b14b84f5dbULL, 0x01f3b896f514bULL, 0x1b75e43a51b29ULL, 0x1a515ed23b9f0ULL },
+    { 0x129ef7a341e9fULL, 0x0ee8b3c6fd95cULL, 0x1f2f058bdef29ULL, 0x07537ec79a2eeULL },
+    { 0x131e3547d29f0ULL, 0x068574c0ddec7ULL, 0x01f297c558f19ULL, 0x1c6f76065d42cULL },
+    { 0x15315bf18ae50ULL, 0x041a42356d67fULL, 0x014ea31fb5195ULL, 0x1fcd6d5884b04ULL },
+    { 0x1621c6dbe827eULL, 0x0a1a9b9b146fdULL, 0x0fc82fb6c708dULL, 0x17ec51b3b2b0aULL },
+    { 0x173d438c9c4d6ULL, 0x059ecdc585279ULL, 0x0d6472638579dULL, 0x13c9434766f34ULL },
+    { 0x1784c95e1e56fULL, 0x0f67cdf7004d3ULL, 0x1ed4f0f52643dULL, 0x196401df67cdeULL },
+    { 0x17a7f25b4fd54ULL, 0x0b3b69d55cd77ULL, 0x0557e5b49fcbdULL, 0x1dd675572db9aULL },
+    { 0x1806a5c9594aeULL, 0x0c82bd4612dccULL, 0x0ea535274ac03ULL, 0x067690c57a826ULL },
+    { 0x1846db8482d01ULL, 0x1c4d20644a25aULL, 0x10168243b6c43ULL, 0x0b48a44c09647ULL },
+    { 0x1a69feb5910edULL, 0x18dc15b2e2bfdULL, 0x16e1135aff2cbULL, 0x17fa8e9b50763ULL },
+    { 0x1ae0da5e03f2cULL, 0x1a2d0bb64a5f2ULL, 0x069f80f4b60ebULL, 0x09f4a4dba168bULL },
+    { 0x1b065eb92ac0aULL, 0x000af8fe6a05eULL, 0x0a06a93af4c1bULL, 0x0f40acfe3ea00ULL },
+    { 0x1b1b282090754ULL, 0x001167a4a7a41ULL, 0x055c120829b1bULL, 0x104bca4bcd100ULL },
+    { 0x1c1a6c8d89ba3ULL, 0x00c7ba218bbdcULL, 0x18bb23626cb07ULL, 0x077ba308bbc60ULL },
+    { 0x1c3d04a79319aULL, 0x02959443a736eULL, 0x0b3193ca41787ULL, 0x0ed9cb8453528ULL },
+    { 0x1caec9f17d13bULL, 0x0d63a47bb65fcULL, 0x1b917d1f26ea7ULL, 0x07f4dbbc4b8d6ULL },
+    { 0x1d0a1f53ff494ULL, 0x078a753dd6746ULL, 0x0525ff95f0a17ULL, 0x0c5cd7795ca3cULL },
+    { 0x1d701d5e104b9ULL, 0x16c45c37474e0ULL, 0x13a410f5701d7ULL, 0x00e5c5d87446dULL },
+    { 0x1ded8e35c8b91ULL, 0x18ff5271be264ULL, 0x113a2758e36f7ULL, 0x04c8fb1c95fe3ULL },
+    { 0x1efb281db6218ULL, 0x11342ebb87a66ULL, 0x0308db7029befULL, 0x0ccbc3bae8591ULL },
+    { 0x1fdac51e2b879ULL, 0x1e66789b8f1d3ULL, 0x13c3a8f146b7fULL, 0x1971e3b23cccfULL },
+    { 0x0298fc3b8f807ULL, 0x0b6299b0e9b16ULL, 0x1c03e3b87e328ULL, 0x0d1b2e1b328daULL },
+    { 0x045d89f41ffc2ULL, 0x1d978675a950bULL, 0x087ff05f23744ULL, 0x1a152b5cc3d37ULL },
+    { 0x1490c9045cfd4ULL, 0x0da707251d051ULL, 0x057e744126125ULL, 0x11417149c1cb6ULL },
+    { 0x1675939010c19ULL, 0x1c5804d74d068ULL, 0x13061013935cdULL, 0x02c165d640347ULL },
+    { 0x1d78beed41888ULL, 0x188c5823fbd6cULL, 0x0223056efa3d7ULL, 0x06d7bf8834623ULL },
+    { 0x0004839a38fe8ULL, 0x0e8b0e5e08089ULL, 0x02fe38b382400ULL, 0x122020f4e1a2eULL },
+    { 0x00082aa79c9d8ULL, 0x038f0422aca0dULL, 0x037273caa8200ULL, 0x160a6a8841e38ULL },
+    { 0x004ef0b0eb661ULL, 0x1842225cf0b9bULL, 0x10cdae1a1ee40ULL, 0x1b3a1e7488843ULL },
+    { 0x003b5d13605c6ULL, 0x0691b13cd1035ULL, 0x0c740d9175b80ULL, 0x158116791b12cULL },
+    { 0x008500a34df3eULL, 0x033383463c18cULL, 0x0f9f658a01420ULL, 0x063078c583998ULL },
+    { 0x00f220096a756ULL, 0x1023ab0c15827ULL, 0x0d5cad20089e0ULL, 0x1c835061ab881ULL },
+    { 0x014b333a5c7afULL, 0x17dbef16f0880ULL, 0x1ebc74b999a50ULL, 0x00221ed1efb7dULL },
+    { 0x01365e7f3f163ULL, 0x034ffc78615b7ULL, 0x18d1f9fcf4d90ULL, 0x1db50c3c7fe58ULL },
+    { 0x01a639afeb9b5ULL, 0x06e769687cbaeULL, 0x15b3afeb38cb0ULL, 0x0eba7c2d2dcecULL },
+    { 0x01cdd3e9ee84bULL, 0x1d7ac84af861fULL, 0x1a42ef2f97670ULL, 0x1f0c3ea426bd7ULL },
+    { 0x02ee501e5eadcULL, 0x13a62fd2dc033ULL, 0x076af4f014ee8ULL, 0x19807697e8cb9ULL },
+    { 0x02dfec27f75dcULL, 0x1bb535eeb5b17ULL, 0x0775dfc86ff68ULL, 0x1d1b5aef595bbULL },
+    { 0x03265baa7275bULL, 0x0649eeee7403bULL, 0x1b5c9cabb4c98ULL, 0x1b805ceeef24cULL },
+    { 0x03c6eb5431439ULL, 0x1c6c64fe04d90ULL, 0x13851855aec78ULL, 0x013640fe4c6c7ULL },
+    { 0x03de736865c50ULL, 0x152868ccfdd11ULL, 0x01474c2d9cf78ULL, 0x11177e662c295ULL },
+    { 0x04731b484cc9aULL, 0x159aa8275d420ULL, 0x0b266425b19c4ULL, 0x008575c82ab35ULL },
+    { 0x0476ec44e934dULL, 0x1847336b11f31ULL, 0x16592e446edc4ULL, 0x119f11ad99c43ULL },
+    { 0x04fd0b3ee3c0eULL, 0x163c897fb9322ULL, 0x0e078ef9a17e4ULL, 0x08993bfd2278dULL },
+    { 0x0539e49d271eaULL, 0x0995d81b819bfULL, 0x0af1c9724f394ULL, 0x1fb303b037532ULL },
+    { 0x05795c3d1e28fULL, 0x11d6df33e1036ULL, 0x1e28f178753d4ULL, 0x0d810f99f6d71ULL },
+    { 0x05c694e791122ULL, 0x1a25f4416078cULL, 0x089113ce52c74ULL, 0x063c0d045f48bULL },
+    { 0x059046d0429e3ULL, 0x00e9d0111949bULL, 0x18f28416c4134ULL, 0x1b253110172e0ULL },
+    { 0x068ee4e44f900ULL, 0x092730c1b8d1aULL, 0x0013e44e4ee2cULL, 0x0b163b0619c92ULL },
+    { 0x07cd49ddf9e48ULL, 0x14364eff9871dULL, 0x024f3f772567cULL, 0x171c33fee4d85ULL },
+    { 0x07b7a01750fd8ULL, 0x0ab566d71d825ULL, 0x037e15d00bdbcULL, 0x148371d6cd5aaULL },
+    { 0x082b28c23f134ULL, 0x0313252886daaULL, 0x0591f88629a82ULL, 0x0ab6c22949918ULL },
+    { 0x0854180a1f627ULL, 0x13428f6443182ULL, 0x1c8df0a030542ULL, 0x0831844de2859ULL },
+    { 0x085ae76a023b5ULL, 0x1ec93b00a7c92ULL, 0x15b880adceb42ULL, 0x0927ca01b926fULL },
+    { 0x08e2b3fd850b3ULL, 0x1deca81066facULL, 0x19a1437f9a8e2ULL, 0x06becc102a6f7ULL },
+    { 0x090909538f31bULL, 0x0753c23286706ULL, 0x1b19e39521212ULL, 0x0c1cc2988795cULL },
+    { 0x0971bde70f026ULL, 0x1f16d12063daeULL, 0x0c81e1cf7b1d2ULL, 0x0eb78c0916d1fULL },
+    { 0x0918a9eee55ffULL, 0x0fc5c92eb7f89ULL, 0x1ff54eef2a312ULL, 0x123fdae92747eULL },
+    { 0x0939b2bbdf44cULL, 0x0b1a4d16f3b2fULL, 0x0645f7ba9b392ULL, 0x1e9b9ed164b1aULL },
+    { 0x095f0273451f4ULL, 0x13996150b7585ULL, 0x05f1459c81f52ULL, 0x1435da150d339ULL },
+    { 0x0984e5a5e834aULL, 0x0c27d24a32a1dULL, 0x0a582f4b4e432ULL, 0x170a98a497c86ULL },
+    { 0x0987f954678d5ULL, 0x0df461785ed13ULL, 0x1563cc553fc32ULL, 0x1916f43d0c5f6ULL },
+    { 0x098d32dd3e0b6ULL, 0x01becd58c6c8eULL, 0x0da0f97699632ULL, 0x0e26c63566fb0ULL },
+    { 0x0a676c9a58d44ULL, 0x12133df41a839ULL, 0x045634b26dccaULL, 0x1382b05f79909ULL },
+    { 0x0a28c9ad1686bULL, 0x0d448ca2aa0bfULL, 0x1ac2d16b2628aULL, 0x1fa0aa8a62456ULL },
+    { 0x0a2acacc4e393ULL, 0x09cfaaa09643aULL, 0x1938e466a6a8aULL, 0x0b84d20aabe72ULL },
+    { 0x0a0e66b18e3bfULL, 0x01cbb3d2a6a9eULL, 0x1fb8e31acce0aULL, 0x0f2aca979ba70ULL },
+    { 0x0a895ce5c053dULL, 0x007511a6f669cULL, 0x1794074e7522aULL, 0x072cdecb115c0ULL },
+    { 0x0a9b62ddcbc8eULL, 0x00bea9969bf1eULL, 0x0e27a7768db2aULL, 0x0f1fb2d32afa0ULL },
+    { 0x0ade1e03d18c9ULL, 0x12e834e2db305ULL, 0x12631780f0f6aULL, 0x1419b68e582e9ULL },
+    { 0x0b6d407882ef7ULL, 0x10d0cbd4ae6b3ULL, 0x1dee823c056daULL, 0x19acea57a6161ULL },
+    { 0x0b7f3dea432d9ULL, 0x16d07ae2f7d2bULL, 0x136984af79fdaULL, 0x1a97de8ebc16dULL },
+    { 0x0b8e9f205f77cULL, 0x0d2b77e6f6183ULL, 0x07ddf409f2e3aULL, 0x1830decfdda96ULL },
+    { 0x0bd3a165e9ef5ULL, 0x1cf6638c3ff85ULL, 0x15ef2f4d0b97aULL, 0x143ff8638cde7ULL },
+    { 0x0c687ab739304ULL, 0x120f0739e293cULL, 0x041939dabc2c6ULL, 0x07928f39c1e09ULL },
+    { 0x0c0bb49ea2d37ULL, 0x0a55b91dcea8aULL, 0x1d968af25ba06ULL, 0x0a2ae7713b54aULL },
+    { 0x0c9105f0e905eULL, 0x0432911b37709ULL, 0x0f412e1f41126ULL, 0x121dd9b112984ULL },
+    { 0x0d0d52328cc80ULL, 0x039a4055ea210ULL, 0x0026629895616ULL, 0x0108af5404b38ULL },
+    { 0x0d86fa3dd98cbULL, 0x08eeec737ab15ULL, 0x1a633778bec36ULL, 0x151abd9c6eee2ULL },
+    { 0x0dab3eb0e5654ULL, 0x0138733df6b29ULL, 0x054d4e1af9ab6ULL, 0x129adf799c390ULL },
+    { 0x0e63e0f3c5018ULL, 0x1b10209336f3cULL, 0x0301479e0f8ceULL, 0x079ed9920811bULL },
+    { 0x0e44c2d25918fULL, 0x1acb85d312518ULL, 0x1e3134968644eULL, 0x0314919743a6bULL },
+    { 0x0e707df9f8ebbULL, 0x14c29ebf7febcULL, 0x1bae3f3f7c1ceULL, 0x07affdfaf2865ULL },
+    { 0x0e3ede96b541aULL, 0x0b0cb4ffc7338ULL, 0x0b055ad2f6f8eULL, 0x0399c7fe5a61aULL },
+    { 0x0ec2005e35476ULL, 0x1324ad9d06581ULL, 0x0dc558f40086eULL, 0x1034c1736a499ULL },
+    { 0x0eca9fea84c42ULL, 0x1f28b8a5ea609ULL, 0x084642aff2a6eULL, 0x120caf4a3a29fULL },
+    { 0x0f5c7903c4c6cULL, 0x170041e7dba95ULL, 0x06c647813c75eULL, 0x152bb7cf0401dULL },
+    { 0x0fc40b636daccULL, 0x17aa43eb3a505ULL, 0x066b6d8da047eULL, 0x1414b9af84abdULL },
+    { 0x0f8e2ccff6697ULL, 0x03e4ffed96e0eULL, 0x1d2cdfe668e3eULL, 0x0e0ed36ffe4f8ULL },
+    { 0x0fd11f3028e34ULL, 0x143a53bd6f080ULL, 0x058e2819f117eULL, 0x0021ed7b94b85ULL },
+    { 0x0ff7b6de7308cULL, 0x1abc7ddb53d2aULL, 0x06219cf6dbdfeULL, 0x0a9795b77c7abULL },
+    { 0x107747e8538ceULL, 0x1498bd423957bULL, 0x0e63942fc5dc1ULL, 0x1bd538857a325ULL },
+    { 0x1076747793eabULL, 0x12c4b65669ff6ULL, 0x1aaf93dc5cdc1ULL, 0x0dff2cd4da469ULL },
+    { 0x10d7071dd86b7ULL, 0x14febf54152c4ULL, 0x1dac3771c1d61ULL, 0x04695055fafe5ULL },
+    { 0x115f6e85c2e56ULL, 0x101cf3649da5fULL, 0x0d4e8742edf51ULL, 0x1f4b724d9e701ULL },
+    { 0x11c0b0df90654ULL, 0x1a244f1444e4dULL, 0x054c13f61a071ULL, 0x164e4451e448bULL },
+    { 0x11e90783c41ceULL, 0x17b9d1029026dULL, 0x0e704783c12f1ULL, 0x16c81281173bdULL },
+    { 0x11ca76bf839c0ULL, 0x12ad7810e8b5fULL, 0x007383fadca71ULL, 0x1f5a2e103d6a9ULL },
+    { 0x11b3a470492c0ULL, 0x08b2721031d61ULL, 0x0069241c4b9b1ULL, 0x10d718109c9a2ULL },
+    { 0x11b7320eb2539ULL, 0x027d6c4e45ae2ULL, 0x13949ae099db1ULL, 0x08eb44e46d7c8ULL },
+    { 0x12027cdc34560ULL, 0x01053cbc40cd9ULL, 0x00d458767c809ULL, 0x1366047a79410ULL },
+    { 0x127366ef63521ULL, 0x125d388c31dfeULL, 0x10958deecd9c9ULL, 0x0ff7186239749ULL },
+    { 0x12e1c63dbe551ULL, 0x197f1c9c24277ULL, 0x1154fb78c70e9ULL, 0x1dc8487271fd3ULL },
+    { 0x12e68bc773354ULL, 0x1e2d27e81456fULL, 0x05599dc7a2ce9ULL, 0x1ed4502fc968fULL },
+    { 0x12af5fa58faaaULL, 0x05beb2e2e83feULL, 0x0aabe34bf5ea9ULL, 0x0ff82e8e9afb4ULL },
+    { 0x12fba1c0c28a1ULL, 0x1cf0208099eeaULL, 0x10a286070bbe9ULL, 0x0aef3202081e7ULL },
+    { 0x1353409c77a89ULL, 0x11d46e9a1915aULL, 0x122bdc7205959ULL, 0x0b5130b2ec571ULL },
+    { 0x1377d5b5a1bf1ULL, 0x1cd572d86d3fdULL, 0x11fb0b5b57dd9ULL, 0x17f96c369d567ULL },
+    { 0x13acf204c30baULL, 0x08acc0c2d4bf2ULL, 0x0ba186409e6b9ULL, 0x09fa5686066a2ULL },
+    { 0x13f0393ed5efeULL, 0x17a4cfb67dbe1ULL, 0x0fef56f9381f9ULL, 0x10fb7cdbe64bdULL },
+    { 0x13fef88db2ac3ULL, 0x18e4eee8c9a7fULL, 0x186a9b623eff9ULL, 0x1fcb262eee4e3ULL },
+    { 0x14e067c4d74f4ULL, 0x15ac150514ffbULL, 0x05e5d647cc0e5ULL, 0x1bfe5141506b5ULL },
+    { 0x14c9edb203cdeULL, 0x1eb09137ac95bULL, 0x0f67809b6f265ULL, 0x1b526bd9121afULL },
+    { 0x14ca91136ce06ULL, 0x1f22a31dd8044ULL, 0x0c0e6d9112a65ULL, 0x044037718a89fULL },
+    { 0x149f556682f14ULL, 0x06353345ed652ULL, 0x051e82cd55f25ULL, 0x094d6f459958cULL },
+    { 0x152474a9fb7ffULL, 0x00c3df4f74bffULL, 0x1ffdbf2a5c495ULL, 0x1ffa5de5f7860ULL },
+    { 0x15e2cb26ee81dULL, 0x1f6e612b3c272ULL, 0x1702eec9a68f5ULL, 0x09c879a90cedfULL },
+    { 0x15c7804c023c5ULL, 0x18f56b4100443ULL, 0x1478806403c75ULL, 0x18440105ad5e3ULL },
+    { 0x15d4c8c3a8d0cULL, 0x1a23416f0965cULL, 0x06162b8626575ULL, 0x074d21ed0588bULL },
+    { 0x15d53799dfc80ULL, 0x15ba5c5559b4eULL, 0x0027f733d9575ULL, 0x0e5b355474bb5ULL },
+    { 0x16355d253a57cULL, 0x041715ef650f7ULL, 0x07d4b9497558dULL, 0x1de14def51d04ULL },
+    { 0x167d98fee7a50ULL, 0x1b140af9fd76bULL, 0x014bcefe337cdULL, 0x1add7f3ea051bULL },
+    { 0x167e5f3a20ac1ULL, 0x16c83af9e9071ULL, 0x106a08b9f4fcdULL, 0x11c12f3eb826dULL },
+    { 0x16ea764bf0926ULL, 0x1229bd89d8ef4ULL, 0x0c921fa4dcaedULL, 0x05ee37237b289ULL },
+    { 0x168c6e6a8d5bcULL, 0x03ab19e7a4fd0ULL, 0x07b562acec62dULL, 0x017e4bcf31ab8ULL },
+    { 0x16cc2b2438110ULL, 0x142f04e9a4840ULL, 0x01103849a866dULL, 0x00424b2e41e85ULL },
+    { 0x17571a0be8975ULL, 0x125b69e95d2c5ULL, 0x15d22fa0b1d5dULL, 0x1469752f2db49ULL },
+    { 0x1758050f82007ULL, 0x1644d98181246ULL, 0x1c0083e14035dULL, 0x0c4903033644dULL },
+    { 0x17812269b0eceULL, 0x00b8cf8f28e45ULL, 0x0e6e1b2c8903dULL, 0x144e29e3e63a0ULL },
+    { 0x17c781e89f218ULL, 0x1d326ec32474aULL, 0x0309f22f03c7dULL, 0x0a5c4986ec997ULL },
+    { 0x1824ff2315808ULL, 0x0f0814626a974ULL, 0x02035189fe483ULL, 0x05d2ac8c5021eULL },
+    { 0x1846ccf5ff0c7ULL, 0x19c6b5783275fULL, 0x1c61ff5e66c43ULL, 0x1f5c983d5ac73ULL },
+    { 0x18595d1c8b464ULL, 0x14161934c33d3ULL, 0x04c5a27175343ULL, 0x1979865930d05ULL },
+    { 0x18c242c41c838ULL, 0x112e24020e4d8ULL, 0x0382704684863ULL, 0x0364e08048e91ULL },
+    { 0x18fcabba0832cULL, 0x1e2b0b72a38e8ULL, 0x069820bbaa7e3ULL, 0x02e38a9da1a8fULL },
+    { 0x194b398cdf1d8ULL, 0x15976c22d6b4bULL, 0x0371f66339a53ULL, 0x1a5ad6886dd35ULL },
+    { 0x191f61a74f8efULL, 0x07d6e142bb9dfULL, 0x1ee3e5cb0df13ULL, 0x1f73ba850ed7cULL },
+    { 0x198477e09e9ccULL, 0x05ab55426ae5bULL, 0x0672f20fdc433ULL, 0x1b4eac8555ab4ULL },
+    { 0x199723bbc229aULL, 0x06b8ea5237a4eULL, 0x0b2887bb89d33ULL, 0x0e4bd894ae3acULL },
+    { 0x1ac8e6b97baa3ULL, 0x18ea9e98ba9deULL, 0x18abbd3ace26bULL, 0x0f72ba32f2ae3ULL },
+    { 0x1a8a01aa519e7ULL, 0x06e1ad80ba1c9ULL, 0x1cf314ab00a2bULL, 0x1270ba036b0ecULL },
+    { 0x1acfc640310eaULL, 0x18b8b4ca825d1ULL, 0x0ae11804c7e6bULL, 0x117482a65a3a3ULL },
+    { 0x1addece618e8bULL, 0x1af696e6abc58ULL, 0x1a2e30ce6f76bULL, 0x0347aaced2debULL },
+    { 0x1b21583fe1090ULL, 0x029448b876374ULL, 0x01210ff83509bULL, 0x05d8dc3a24528ULL },
+    { 0x1b489216b812aULL, 0x1a0fc49ac22c0ULL, 0x0a903ad09225bULL, 0x006886b247e0bULL },
+    { 0x1b51de1143e9dULL, 0x18d853b65f156ULL, 0x172f8510f715bULL, 0x0d51f4db94363ULL },
+    { 0x1c57491348fe9ULL, 0x16d322771b0d5ULL, 0x12fe259125d47ULL, 0x1561b1dc8996dULL },
+    { 0x1c5f71d8b3032ULL, 0x1410ac59c7fdaULL, 0x09819a371df47ULL, 0x0b7fc7346a105ULL },
+    { 0x1ca7c0d7f0621ULL, 0x0a74265d126fcULL, 0x108c1fd607ca7ULL, 0x07ec9174c85caULL },
+    { 0x1cd0f60d368e0ULL, 0x19ac1c094b8d7ULL, 0x00e2d960de167ULL, 0x1d63a520706b3ULL },
+    { 0x1cb4247bfcfa4ULL, 0x03a31f5d3bee4ULL, 0x04be7fbc485a7ULL, 0x04efb975f18b8ULL },
+    { 0x1c9ce946d6006ULL, 0x0f24856193e52ULL, 0x0c00d6c52e727ULL, 0x094f930d4249eULL },
+    { 0x1d632956bb7c6ULL, 0x1697e73d02f63ULL, 0x0c7dbad5298d7ULL, 0x18de8179cfd2dULL },
+    { 0x1d6d1adad0f78ULL, 0x12194e77de6e9ULL, 0x03de16b6b16d7ULL, 0x12ecf7dce5309ULL },
+    { 0x1de993a32b9e4ULL, 0x1ebb4109ea1efULL, 0x04f3a98b932f7ULL, 0x1ef0af2105bafULL },
+    { 0x1e1188365429fULL, 0x0bd487b337040ULL, 0x1f2854d82310fULL, 0x0041d99bc257aULL },
+    { 0x1ea55c6cd22b6ULL, 0x00b49fe1766f2ULL, 0x0da8966c754afULL, 0x09ecdd0ff25a0ULL },
+    { 0x1eeff9fdcb34eULL, 0x1c37abf3f2f7fULL, 0x0e59a77f3feefULL, 0x1fde9f9fabd87ULL },
+    { 0x1f1b45e12ffd6ULL, 0x0593f38daf55fULL, 0x0d7fe90f45b1fULL, 0x1f55eb639f934ULL },
+    { 0x1f833d95613c9ULL, 0x04f572bb5294dULL, 0x12790d537983fULL, 0x165295ba9d5e4ULL },
+    { 0x12696c310602aULL, 0x111090b2a08f6ULL, 0x0a80c1186d2c9ULL, 0x0de20a9a12111ULL },
+    { 0x1915acc4b002bULL, 0x0854d46a03ec8ULL, 0x1a801a466b513ULL, 0x026f80ac56542ULL },
+    { 0x039b42adf4141ULL, 0x017d6c88b121dULL, 0x10505f6a85b38ULL, 0x17091a226d7d0ULL },
+    { 0x04727e9274a3cULL, 0x1308373b5d8b8ULL, 0x078a5c92fc9c4ULL, 0x03a375b9d8219ULL },
+    { 0x05eb1257bc919ULL, 0x137f641bcc624ULL, 0x13127bd491af4ULL, 0x048c67b04dfd9ULL },
+    { 0x08743ef2cd1beULL, 0x138b917277fa8ULL, 0x0fb1669ef85c2ULL, 0x02bfdc9d13a39ULL },
+    { 0x092a0df66e99dULL, 0x07c7713abe42aULL, 0x1732ecdf60a92ULL, 0x0a84fab91dc7cULL },
+    { 0x0a4c0bc1d30feULL, 0x148885e29678fULL, 0x0fe19707a064aULL, 0x1e3cd28f42225ULL },
+    { 0x0a52231c7f942ULL, 0x150fac981b903ULL, 0x0853fc718894aULL, 0x1813b0326be15ULL },
+    { 0x0cbbf0aa4547fULL, 0x0b70a907f79b9ULL, 0x1fc544aa1fba6ULL, 0x13b3dfc12a1daULL },
+    { 0x0e29019ae5740ULL, 0x07110a9d92329ULL, 0x005d4eb30128eULL, 0x12989372a111cULL },
+    { 0x11c0cc0fb404aULL, 0x1b24dc2a00255ULL, 0x0a405be066071ULL, 0x154800a87649bULL },
+    { 0x12d544206a8e1ULL, 0x10f210c8390d3ULL, 0x10e2ac0845569ULL, 0x19613826109e1ULL },
+    { 0x1424b5d12bac9ULL, 0x0cc2125b48d6fULL, 0x126ba9175a485ULL, 0x1ed625b490866ULL },
+    { 0x179d4ac145dcfULL, 0x01f9c1e79955dULL, 0x1e774506a573dULL, 0x175533cf073f0ULL },
+    { 0x185a48d491688ULL, 0x1084263683758ULL, 0x022d125624b43ULL, 0x035d82d8c8421ULL },
+    { 0x1b5c52b168b60ULL, 0x100b42d8fb0ddULL, 0x00da2d1a9475bULL, 0x1761be3685a01ULL },
+    { 0x1d87ec7aa3bb0ULL, 0x0ab17a792efd2ULL, 0x01bb8abc6fc37ULL, 0x097ee93cbd1aaULL },
+    { 0x1fed25a78d61eULL, 0x1736d3c7a6b6cULL, 0x0f0d63cb496ffULL, 0x06dacbc796d9dULL },
+    { 0x000389f4e8d25ULL, 0x0c57213c38688ULL, 0x14962e5f23800ULL, 0x022c387909d46ULL },
+    { 0x00431e8bb952cULL, 0x121b3d2e4038cULL, 0x06953ba2f1840ULL, 0x063804e979b09ULL },
+    { 0x007a34691d6b0ULL, 0x11823e04e5da4ULL, 0x01ad712c58bc0ULL, 0x04b74e40f8831ULL },
+    { 0x0083707fa5335ULL, 0x03752b1864f94ULL, 0x15994bfc1d820ULL, 0x053e4c31a95d8ULL },
+    { 0x0131b1d1729afULL, 0x0cd1c51a59caeULL, 0x1eb29d171b190ULL, 0x0ea734b147166ULL },
+    { 0x01147bc34b316ULL, 0x060bc36055d1eULL, 0x0d19a587bc510ULL, 0x0f17540d87a0cULL },
+    { 0x0177818104030ULL, 0x1d106040050acULL, 0x0180410303dd0ULL, 0x06a140040c117ULL },
+    { 0x01168ec58f98eULL, 0x098ff1620970eULL, 0x0e33e346e2d10ULL, 0x0e1d208d1fe32ULL },
+    { 0x011f96b90aa5fULL, 0x085afb52ed00fULL, 0x1f4aa13ad3f10ULL, 0x1e016e95beb42ULL },
+    { 0x01c2c6ca9fc44ULL, 0x1b2a7d040871bULL, 0x0447f2a6c6870ULL, 0x1b1c20417ca9bULL },
+    { 0x02459633e0e45ULL, 0x1a5813dc78205ULL, 0x144e0f98d3448ULL, 0x14083c779034bULL },
+    { 0x0248b39562dd0ULL, 0x1c8d009cdc80fULL, 0x01768d539a248ULL, 0x1e02767201627ULL },
+    { 0x02726fdeb5c87ULL, 0x17ccbdbc09f38ULL, 0x1c275af7ec9c8ULL, 0x039f207b7a67dULL },
+    { 0x02c53e8246118ULL, 0x133910e25480aULL, 0x0310c482f9468ULL, 0x0a02548e11399ULL },
+    { 0x02af8ceb0f484ULL, 0x0bb239e4a052eULL, 0x0425e1ae63ea8ULL, 0x0e940a4f389baULL },
+    { 0x02b9962b307adULL, 0x0af91f8ee10a4ULL, 0x16bc19a8d33a8ULL, 0x04a10ee3f13eaULL },
+    { 0x02fc65f43bb72ULL, 0x142796d8addbbULL, 0x09dbb85f4c7e8ULL, 0x1bb76a36d3c85ULL },
+    { 0x0368cb51dde15ULL, 0x1d4a47b49c734ULL, 0x150f7715a62d8ULL, 0x059c725bc4a57ULL },
+    { 0x036d29c936779ULL, 0x15514eee84cafULL, 0x13dcd927296d8ULL, 0x1ea642eee5155ULL },
+    { 0x0378997b72115ULL, 0x1e414db8f5426ULL, 0x15109dbd323d8ULL, 0x0c855e3b6504fULL },
+    { 0x03e58db1aee23ULL, 0x1d72d2fc282aeULL, 0x188eeb1b634f8ULL, 0x0ea8287e969d7ULL },
+    { 0x03eae7e1e11d5ULL, 0x1ce97188b4f3dULL, 0x15710f0fceaf8ULL, 0x179e5a231d2e7ULL },
+    { 0x038dac961b0fdULL, 0x0af655f28498bULL, 0x17e1b0d26b638ULL, 0x1a32429f54deaULL },
+    { 0x03fac67d24e9dULL, 0x19ec7b9ead434ULL, 0x172e497cc6bf8ULL, 0x05856af3bc6f3ULL },
+    { 0x03fdabc00d357ULL, 0x1d7bc3e085d29ULL, 0x1d596007ab7f8ULL, 0x1297420f87bd7ULL },
+    { 0x040330a577f4cULL, 0x0115270f7890fULL, 0x065fdd4a19804ULL, 0x1e123de1c9510ULL },
+    { 0x0447a66f00f9eULL, 0x1a9dbb472cc04ULL, 0x0f3e01eccbc44ULL, 0x040669c5bb72bULL },
+    { 0x040c64238d662ULL, 0x03029245a0b95ULL, 0x08cd63884c604ULL, 0x153a0b4492818ULL },
+    { 0x044dcae90edb1ULL, 0x19db0865ac49eULL, 0x11b6e12ea7644ULL, 0x0f246b4c21b73ULL },
+    { 0x040e9e365f185ULL, 0x0bcf3571f0102ULL, 0x1431f4d8f2e04ULL, 0x08101f1d59e7aULL },
+    { 0x043587abbdadcULL, 0x0f9a1f4b2d32dULL, 0x076b7babc3584ULL, 0x169969a5f0b3eULL },
+    { 0x043862e3b207dULL, 0x0248050ba5ebfULL, 0x17c09b8e8c384ULL, 0x1faf4ba140248ULL },
+    { 0x04e5fc58886a8ULL, 0x18b21a7740eb0ULL, 0x02ac22347f4e4ULL, 0x01ae05dcb09a3ULL },
+    { 0x04f3e65c1d10aULL, 0x193fbc1301d30ULL, 0x0a117074cf9e4ULL, 0x019701907bf93ULL },
+    { 0x04d7c42e53413ULL, 0x1a74bc4535112ULL, 0x190594e847d64ULL, 0x091159447a5cbULL },
+    { 0x0540673ef3cfbULL, 0x16ccdc1f3cb93ULL, 0x1be79ef9cc054ULL, 0x193a79f07666dULL },
+    { 0x0563127de91d6ULL, 0x109fe91974725ULL, 0x0d712f7c918d4ULL, 0x149c5d312ff21ULL },
+    { 0x05229d0c85410ULL, 0x0d04782544320ULL, 0x0105426172894ULL, 0x009845483c416ULL },
+    { 0x052d14ca8f172ULL, 0x0313d841c47abULL, 0x09d1e2a651694ULL, 0x1abc470437918ULL },
+    { 0x05583024bf06eULL, 0x1106c50be1b83ULL, 0x0ec1fa4818354ULL, 0x183b0fa146c11ULL },
+    { 0x051a8417ccdbbULL, 0x0bc7f0179d284ULL, 0x1bb667d042b14ULL, 0x042973d01fc7aULL },
+    { 0x053f60e512680ULL, 0x00946645a1c3eULL, 0x002c914e0df94ULL, 0x0f870b44cc520ULL },
+    { 0x05a9e37a28956ULL, 0x0e3bc919acc31ULL, 0x0d5228bd8f2b4ULL, 0x11866b3127b8eULL },
+    { 0x0589a74bafba2ULL, 0x0fbbda0988f86ULL, 0x08bbeba5cb234ULL, 0x0c3e2320b7bbeULL },
+    { 0x05d9346e6a09dULL, 0x12f6590bf5c02ULL, 0x1720acec59374ULL, 0x08075fa134de9ULL },
+    { 0x05fe53a714c4eULL, 0x172ce547e903dULL, 0x0e4651cb94ff4ULL, 0x17812fc54e69dULL },
+    { 0x0661de43aec9cULL, 0x1b9a11af4c636ULL, 0x0726eb84f70ccULL, 0x0d8c65eb10b3bULL },
+    { 0x0665d43573208ULL, 0x181416db70136ULL, 0x02099d58574ccULL, 0x0d901db6d0503ULL },
+    { 0x0625391e7c1b9ULL, 0x07d70cfb548a0ULL, 0x13b07cf13948cULL, 0x00a255be61d7cULL },
+    { 0x06a01fdeb8810ULL, 0x062e1cb94c628ULL, 0x01023af7f00acULL, 0x028c653a70e8cULL },
+    { 0x06e48dc7c487eULL, 0x1f2491e31c6adULL, 0x0fc247c7624ecULL, 0x16ac718f1249fULL },
+    { 0x06aa2f38b24b9ULL, 0x04e83cbfa4aa2ULL, 0x13a49a39e8aacULL, 0x08aa4bfa782e4ULL },
+    { 0x06d717ab6a278ULL, 0x163a3acb7508fULL, 0x03c8adabd1d6cULL, 0x1e215da6b8b8dULL },
+    { 0x06dbb799458eeULL, 0x1db8b993d998dULL, 0x0ee34533dbb6cULL, 0x163337933a3b7ULL },
+    { 0x06fbbf3f4e918ULL, 0x1f3f38b3fd826ULL, 0x0312e5f9fbbecULL, 0x0c837f9a39f9fULL },
+    { 0x07210813c88c3ULL, 0x02d2c0b118225ULL, 0x186227902109cULL, 0x1488311a06968ULL },
+    { 0x07602ba1d6393ULL, 0x15c9c6a134a2eULL, 0x1938d70ba80dcULL, 0x0e8a590ac7275ULL },
+    { 0x0741db1c2b001ULL, 0x1c5e48b940112ULL, 0x1001a871b705cULL, 0x0910053a24f47ULL },
+    { 0x070dc5015e3e7ULL, 0x0dd3d7c190097ULL, 0x1cf8f5014761cULL, 0x1d201307d7976ULL },
+    { 0x072c3e7518eb1ULL, 0x00ce56f5ecca4ULL, 0x11ae315cf869cULL, 0x04a66f5ed4e60ULL },
+    { 0x0735e0bbb1557ULL, 0x0a51cddd25b3dULL, 0x1d551bba0f59cULL, 0x179b49776714aULL },
+    { 0x07359fb18414dULL, 0x0d5951f36122dULL, 0x1650431bf359cULL, 0x16890d9f15356ULL },
+    { 0x071afc6337b9dULL, 0x0bc177abedd16ULL, 0x173bd98c7eb1cULL, 0x0d176fabdd07aULL },
+    { 0x07c3b635d37bfULL, 0x18fdf79774b86ULL, 0x1fbd9758db87cULL, 0x0c3a5dd3df7e3ULL },
+    { 0x07e726c210675ULL, 0x127877c504ca9ULL, 0x15cc1086c9cfcULL, 0x12a64147dc3c9ULL },
+    { 0x07a8958ce92f3ULL, 0x0ce6da89d43a9ULL, 0x19e92e63522bcULL, 0x12b85722b6ce6ULL },
+    { 0x07db0f141a9efULL, 0x14fff5b389083ULL, 0x1ef2b051e1b7cULL, 0x1821239b5ffe5ULL },
+    { 0x0865ab8de1518ULL, 0x1c1d086e16b2cULL, 0x03150f63ab4c2ULL, 0x069ad0ec21707ULL },
+    { 0x08468072338a5ULL, 0x1ac025582a582ULL, 0x14a3989c02c42ULL, 0x0834a8354806bULL },
+    { 0x08076d70513deULL, 0x0491b77236d11ULL, 0x0f79141d6dc02ULL, 0x1116d89ddb124ULL },
+    { 0x086db22928ce8ULL, 0x189a084eea8a5ULL, 0x02e629289b6c2ULL, 0x14a2aee420b23ULL },
+    { 0x0872f0ad7d259ULL, 0x19462e0a7793dULL, 0x13497d6a1e9c2ULL, 0x1793dca0e8c53ULL },
+    { 0x08e3b3f63a201ULL, 0x1e7e261862c2aULL, 0x1008b8df9b8e2ULL, 0x0a868c30c8fcfULL },
+    { 0x08c57f74caef2ULL, 0x14be92747ee93ULL, 0x09eea65dfd462ULL, 0x192efc5c92fa5ULL },
+    { 0x08cb893f00075ULL, 0x1e742930a6085ULL, 0x15c001f923a62ULL, 0x1420ca19285cfULL },
+    { 0x08aedee40604dULL, 0x096c3162e243bULL, 0x1640c04ef6ea2ULL, 0x1b848e8d186d2ULL },
+    { 0x08d50508b35f8ULL, 0x14b11c4e07383ULL, 0x03f59a2141562ULL, 0x1839c0e4711a5ULL },
+    { 0x08940d6bc0214ULL, 0x06201b6037604ULL, 0x050807ad60522ULL, 0x040dd80db008cULL },
+    { 0x08b729ce26a4aULL, 0x0734aa6a0bc2bULL, 0x0a4ac8e729da2ULL, 0x1a87a0acaa59cULL },
+    { 0x096e3af41fb8bULL, 0x11cfe672ead2aULL, 0x1a3bf05eb8ed2ULL, 0x0a96ae9ccfe71ULL },
+    { 0x09e78f2a4d9a3ULL, 0x1ffbf8603a1a0ULL, 0x18b364a9e3cf2ULL, 0x00b0b80c3fbffULL },
+    { 0x09f64a0428cc4ULL, 0x10ae616c0b031ULL, 0x04662840a4df2ULL, 0x1181a06d0cea1ULL },
+    { 0x09fdf63eed9ddULL, 0x1bff595affb31ULL, 0x17736ef8df7f2ULL, 0x119bfeb535ffbULL },
+    { 0x0a496a5f57b98ULL, 0x139d0eb29ed16ULL, 0x033bd5f4ad24aULL, 0x0d16f29ae1739ULL },
+    { 0x0a791e9baf791ULL, 0x13db1abcc732eULL, 0x113debb2f13caULL, 0x0e99c67ab1b79ULL },
+    { 0x0ae0ac71b0c60ULL, 0x182014bc2aea5ULL, 0x00c61b1c6a0eaULL, 0x14aea87a50083ULL },
+    { 0x0aa97c2abc600ULL, 0x03321eace2a30ULL, 0x000c7aa87d2aaULL, 0x018a8e6af0998ULL },
+    { 0x0ab145f5f6ec4ULL, 0x05b4179c3b63fULL, 0x046edf5f451aaULL, 0x1f8db873d05b4ULL },
+    { 0x0a932623f40a6ULL, 0x03b8b58833a84ULL, 0x0ca05f88c992aULL, 0x042b98235a3b8ULL },
+    { 0x0b01bfef48b61ULL, 0x0e5f5aa07ac8dULL, 0x10da25effb01aULL, 0x1626bc0ab5f4eULL },
+    { 0x0b42423a1ee69ULL, 0x134a6e962a093ULL, 0x12cef0b88485aULL, 0x1920a8d2eca59ULL },
+    { 0x0be22302c3148ULL, 0x1629608212b23ULL, 0x02518681888faULL, 0x189a90820d28dULL },
+    { 0x0ba7aaf67c65eULL, 0x0b3ee7fe36c29ULL, 0x0f4c7cdeabcbaULL, 0x1286d8ffcef9aULL },
+    { 0x0ba9537e9454cULL, 0x073d4d96e2631ULL, 0x065452fd952baULL, 0x118c8ed36579cULL },
+    { 0x0bd129d6620b2ULL, 0x16b4c0b817c8aULL, 0x09a08cd72917aULL, 0x0a27d03a065adULL },
+    { 0x0bf6c08e91c3dULL, 0x1a646dc60f3b8ULL, 0x178712e206dfaULL, 0x03b9e0c76c4cbULL },
+    { 0x0bff9440e145fULL, 0x1870f1ced7721ULL, 0x1f450e0453ffaULL, 0x109dd6e71e1c3ULL },
+    { 0x0c42869478c57ULL, 0x184eb51d1e009ULL, 0x1d463c52c2846ULL, 0x1200f1715ae43ULL },
+    { 0x0c08bf33e97aaULL, 0x0e8b923ff2b84ULL, 0x0abd2f99fa206ULL, 0x043a9ff893a2eULL },
+    { 0x0c0bdd7942e97ULL, 0x0cd0bb35fe416ULL, 0x1d2e853d77a06ULL, 0x0d04ff59ba166ULL },
+    { 0x0c2deca57e89eULL, 0x0996956bbe83eULL, 0x0f22fd4a6f686ULL, 0x0f82fbad52d32ULL },
+    { 0x0c0dfcfdb5e6aULL, 0x09149e7feaf9dULL, 0x0acf5b7e7f606ULL, 0x173eaffcf2512ULL },
+    { 0x0c5c66c4f4faaULL, 0x118d964f9be98ULL, 0x0abe5e46cc746ULL, 0x032fb3e4d3631ULL },
+    { 0x0ca641b25e40cULL, 0x072225573203aULL, 0x0604f49b04ca6ULL, 0x0b8099d54889cULL },
+    { 0x0cb5ce964a3ecULL, 0x0abf1373130bbULL, 0x06f8a4d2e75a6ULL, 0x1ba1919d91faaULL },
+    { 0x0d44bd2923e05ULL, 0x1c405b6d6a906ULL, 0x140f89297a456ULL, 0x0c12ad6db4047ULL },
+    { 0x0d3342d17569cULL, 0x0198671f1753cULL, 0x072d5d1685996ULL, 0x0795d1f1cc330ULL },
+    { 0x0d13f737434a0ULL, 0x0e9c701573996ULL, 0x00a585d9df916ULL, 0x0d339d501c72eULL },
+    { 0x0d15837f1c437ULL, 0x0f5ecd5527484ULL, 0x1d8471fd83516ULL, 0x0425c95566f5eULL },
+    { 0x0d799b837c0aaULL, 0x1f9ac42bd30acULL, 0x0aa07d83b33d6ULL, 0x06a197a846b3fULL },
+    { 0x0dc8c895c5437ULL, 0x1964c1359639cULL, 0x1d85475226276ULL, 0x0738d359064d3ULL },
+    { 0x0dcb7bb38ab23ULL, 0x167be231eaa9eULL, 0x189aa39bbda76ULL, 0x0f2aaf188fbcdULL },
+    { 0x0dce4ce1c7cdaULL, 0x11a0f067be71fULL, 0x0b67c70e64e76ULL, 0x1f1cfbcc1e0b1ULL },
+    { 0x0df0d26465b56ULL, 0x192dc3097f531ULL, 0x0d5b4c4c961f6ULL, 0x1195fd2187693ULL },
+    { 0x0d913e881b4e5ULL, 0x00fa5d254398bULL, 0x14e5b022f9136ULL, 0x1a33854974be0ULL },
+    { 0x0df38a57765a7ULL, 0x1bfde53d134a6ULL, 0x1cb4ddd4a39f6ULL, 0x0ca591794f7fbULL },
+    { 0x0df28feb4b55fULL, 0x1e6bf9273752fULL, 0x1f55a5afe29f6ULL, 0x1e95d9c93facfULL },
+    { 0x0dd502c6f78d9ULL, 0x13fc444b1f70bULL, 0x1363dec681576ULL, 0x1a1df1a4447f9ULL },
+    { 0x0dd6314d82ea2ULL, 0x14a4ea454be86ULL, 0x08ae836518d76ULL, 0x0c2fa544ae4a5ULL },
+    { 0x0df911d91ef44ULL, 0x15334f15cb42fULL, 0x045ef137113f6ULL, 0x1e85a751e5995ULL },
+    { 0x0e6a2a17c47deULL, 0x138da3b796a25ULL, 0x0f7c47d0a8aceULL, 0x148ad3db8b639ULL },
+    { 0x0e1168fe0377aULL, 0x02158ab727d9bULL, 0x0bdd80fe2d10eULL, 0x1b37c9daa3508ULL },
+    { 0x0e12a4bf634ddULL, 0x0ac4399f3790fULL, 0x17658dfa4a90eULL, 0x1e13d9f33846aULL },
+    { 0x0e53dfee4c6b4ULL, 0x1f9e3ba577498ULL, 0x05ac64eff794eULL, 0x0325dd4bb8f3fULL },
+    { 0x0e157c6f92da1ULL, 0x02d51ce56be96ULL, 0x10b693ec7d50eULL, 0x0d2fad4e71568ULL },
+    { 0x0e5eb2ea5671cULL, 0x1b092fc7f7c0aULL, 0x071cd4ae9af4eULL, 0x0a07dfc7e921bULL },
+    { 0x0ec0b49cdc5baULL, 0x19a79c9756a88ULL, 0x0bb476725a06eULL, 0x022ad5d273cb3ULL },
+    { 0x0e8220c98d34aULL, 0x0123aa8302f0dULL, 0x0a5963260882eULL, 0x161e8182ab890ULL },
+    { 0x0ec482279e9edULL, 0x1bef05c32a287ULL, 0x16f2f3c88246eULL, 0x1c28a98741efbULL },
+    { 0x0e8cb82b176cbULL, 0x0be08ee7e2907ULL, 0x1a6dd1a83a62eULL, 0x1c128fcee20faULL },
+    { 0x0eefab67579c2ULL, 0x1fbda4e1bad27ULL, 0x0873d5cdabeeeULL, 0x1c96bb0e4b7bfULL },
+    { 0x0ef6c1f78f676ULL, 0x1f26a3d5277bfULL, 0x0dcde3df06deeULL, 0x1fbdc9578ac9fULL },
+    { 0x0ed690a007b51ULL, 0x196122c16f10bULL, 0x115bc00a12d6eULL, 0x1a11ed06890d3ULL },
+    { 0x0ebdd76961cc5ULL, 0x0cf819cdfb535ULL, 0x14670d2dd77aeULL, 0x1595bf67303e6ULL },
+    { 0x0edf5a1b16570ULL, 0x13392cf5c7097ULL, 0x01d4d1b0b5f6eULL, 0x1d21c75e69399ULL },
+    { 0x0f096c305b411ULL, 0x005254b5b6912ULL, 0x1105b4186d21eULL, 0x0912db5a54940ULL },
+    { 0x0f577f65e683fULL, 0x155cf1eb7fe96ULL, 0x1f82cf4dfdd5eULL, 0x0d2ffdaf1e755ULL },
+    { 0x0fe4e0baea8c8ULL, 0x1aa248db3aa3bULL, 0x0262aeba0e4feULL, 0x1b8ab9b6248abULL },
+    { 0x0fbc7683ff130ULL, 0x032b54c9d7bbeULL, 0x0191ff82dc7beULL, 0x0fbbd72655a98ULL },
+    { 0x0ffdb1b0ff79fULL, 0x1df3c7dff7b2aULL, 0x1f3dfe1b1b7feULL, 0x0a9bdff7c79f7ULL },
+    { 0x0fdeca46e238aULL, 0x1aade2eb93612ULL, 0x0a388ec4a6f7eULL, 0x090d93ae8f6abULL },
+    { 0x1023fe19772d1ULL, 0x09d83e3854977ULL, 0x1169dd30ff881ULL, 0x1dd25438f8372ULL },
+    { 0x1005dd40d2a68ULL, 0x0c101662586d3ULL, 0x02ca960577401ULL, 0x196c348cd0106ULL },
+    { 0x10493fe771597ULL, 0x16dd952cf4d4cULL, 0x1d351dcff9241ULL, 0x06565e695376dULL },
+    { 0x10391a863b64aULL, 0x021e862ec116bULL, 0x0a4db8c2b1381ULL, 0x1ad106e8c2f08ULL },
+    { 0x108561eb140f4ULL, 0x07b00d4024cddULL, 0x05e051af0d421ULL, 0x17664805601bcULL },
+    { 0x10a56ff67b01cULL, 0x063e157a34d7aULL, 0x0701bcdfed4a1ULL, 0x0bd658bd50f8cULL },
+    { 0x10c414fd9d781ULL, 0x11e71e546074cULL, 0x103d737e50461ULL, 0x065c0c54f1cf1ULL },
+    { 0x10cb38696bcefULL, 0x10f2a92ef8dc7ULL, 0x1ee7ad2c39a61ULL, 0x1c763ee92a9e1ULL },
+    { 0x10ec00ceaae12ULL, 0x12268a4c8c66aULL, 0x090eaae6006e1ULL, 0x0acc6264a2c89ULL },
+    { 0x109b72835ef90ULL, 0x03bb2604dd85eULL, 0x013ef5829db21ULL, 0x0f437640c9bb8ULL },
+    { 0x1142d6a1472faULL, 0x1988f202741dfULL, 0x0be9c50ad6851ULL, 0x1f705c809e233ULL },
+    { 0x1147e9c236e10ULL, 0x1f10666c0cc5aULL, 0x010ed8872fc51ULL, 0x0b46606ccc11fULL },
+    { 0x1128d0d14c57cULL, 0x09034116d44fdULL, 0x07d4651616291ULL, 0x17e456d105812ULL },
+    { 0x116f50346ffb6ULL, 0x1197e35cfc1f2ULL, 0x0dbfec5815ed1ULL, 0x09f07e758fd31ULL },
+    { 0x1130db8935dacULL, 0x0d894d2e491fcULL, 0x06b75923b6191ULL, 0x07f124e965236ULL },
+    { 0x11332688ce165ULL, 0x015b790011aebULL, 0x14d0e622c9991ULL, 0x1aeb10013db50ULL },
+    { 0x1179b95c0aa13ULL, 0x1c56ca30cdc62ULL, 0x190aa0753b3d1ULL, 0x08c76618a6d47ULL },
+    { 0x117bde2eca4d1ULL, 0x1ade7824f5273ULL, 0x1164a6e8f7bd1ULL, 0x19c95e483cf6bULL },
+    { 0x11c24c4358ca3ULL, 0x12e2f424184d4ULL, 0x18a6358464871ULL, 0x056430485e8e9ULL },
+    { 0x11a5d296b9950ULL, 0x0a3f44584c379ULL, 0x01533ad2974b1ULL, 0x13d8643445f8aULL },
+    { 0x118977216a444ULL, 0x043a510cf0857ULL, 0x0444ad09dd231ULL, 0x1d421e6114b84ULL },
+    { 0x11b3393a1b157ULL, 0x0673ed3065963ULL, 0x1d51b0b9399b1ULL, 0x18d34c196f9ccULL },
+    { 0x1202302927973ULL, 0x0141a8886c9c7ULL, 0x19d3c92818809ULL, 0x1c726c222b050ULL },
+    { 0x1245b50a8bca9ULL, 0x1ed218c648bc2ULL, 0x12a7a2a15b449ULL, 0x087a24c63096fULL },
+    { 0x1209cf14271f5ULL, 0x0ddd11b8841d3ULL, 0x15f1c851e7209ULL, 0x1970423b11776ULL },
+    { 0x1212eb420ffe2ULL, 0x0f8ba2a409dd3ULL, 0x08ffe085ae909ULL, 0x1977204a8ba3eULL },
+    { 0x121667b76c854ULL, 0x070e31d83d85dULL, 0x05426ddbccd09ULL, 0x1743783718e1cULL },
+    { 0x12781c69e27e2ULL, 0x10819aacf16e7ULL, 0x08fc8f2c703c9ULL, 0x1ced1e6ab3021ULL },
+    { 0x12e9244a2184cULL, 0x1230198a88d61ULL, 0x064308a4492e9ULL, 0x10d622a330189ULL },
+    { 0x12e94af480d86ULL, 0x10bd81b4a8678ULL, 0x0c36025ea52e9ULL, 0x03cc2a5b037a1ULL },
+    { 0x12ce6d04ded2dULL, 0x156735e698ad2ULL, 0x1696f6416ce69ULL, 0x096a32cf59cd5ULL },
+    { 0x12b15bfb4c007ULL, 0x077a89b07147cULL, 0x1c0065bfb51a9ULL, 0x07c51c1b22bdcULL },
+    { 0x12d5e5c46745aULL, 0x1d3490ce15d5bULL, 0x0b45cc474f569ULL, 0x1b5750e612597ULL },
+    { 0x1360e89cbbc5eULL, 0x1806cdbe0cb7bULL, 0x0f47ba722e0d9ULL, 0x1bda60fb66c03ULL },
+    { 0x13096b1299d68ULL, 0x061b44b688bd1ULL, 0x02d73291ad219ULL, 0x117a22da45b0cULL },
+    { 0x132f5946e16efULL, 0x06d4e3eed07f1ULL, 0x1eed0ec535e99ULL, 0x11fc16ef8e56cULL },
+    { 0x1380121a10a83ULL, 0x02e8ce9048040ULL, 0x182a10b090039ULL, 0x00402412e62e8ULL },
+    { 0x13aea088bc7e5ULL, 0x09e36fcc80ae9ULL, 0x14fc7a220aeb9ULL, 0x12ea0267ed8f2ULL },
+    { 0x14085e83e2913ULL, 0x02499029dc25eULL, 0x19128f82f4205ULL, 0x0f48772813248ULL },
+    { 0x14134405312c2ULL, 0x0094b60901155ULL, 0x0869194045905ULL, 0x15510120da520ULL },
+    { 0x1432e836a0c28ULL, 0x0a04203f29af0ULL, 0x02860ad82e985ULL, 0x01eb29f80840aULL },
+    { 0x1458f67dbb5b6ULL, 0x188f9d1de5fd6ULL, 0x0db5bb7cde345ULL, 0x0d7f4f7173e23ULL },
+    { 0x147dae6075738ULL, 0x1919166fb5de0ULL, 0x039d5c0ceb7c5ULL, 0x00f75becd1313ULL },
+    { 0x1481d32f78a30ULL, 0x0e3e0e097c0d4ULL, 0x018a3de997025ULL, 0x05607d20e0f8eULL },
+    { 0x14c5da76b55deULL, 0x1bbd857f64751ULL, 0x0f755adcb7465ULL, 0x115c4dfd437bbULL },
+    { 0x14c90a6a2c2b7ULL, 0x13fa8b29a44c0ULL, 0x1da868aca1265ULL, 0x00644b29a2bf9ULL },
+    { 0x14cb05de36ef1ULL, 0x17f43e1d8c4cbULL, 0x11eed8f741a65ULL, 0x1a646370f85fdULL },
+    { 0x14efa7d9606d2ULL, 0x1cb8ba5d94c6dULL, 0x096c0d37cbee5ULL, 0x16c65374ba3a7ULL },
+    { 0x14b6e5018c93aULL, 0x0d23b0430daf4ULL, 0x0b9263014eda5ULL, 0x05eb61841b896ULL },
+    { 0x1499eb69da9e8ULL, 0x0cbb0c23b9ed7ULL, 0x02f2b72daf325ULL, 0x1d6f3b8861ba6ULL },
+    { 0x1562ba79a610aULL, 0x1909e83b60e66ULL, 0x0a10cb3cba8d5ULL, 0x0cce0db82f213ULL },
+    { 0x1565ece3da011ULL, 0x1a52546134e7eULL, 0x1100b78e6f4d5ULL, 0x0fce590c5494bULL },
+    { 0x1505762c8a023ULL, 0x005ed84160ad2ULL, 0x1880a268dd415ULL, 0x096a0d0436f40ULL },
+    { 0x1508674f38ff5ULL, 0x06cf5f0d8ccd5ULL, 0x15fe39e5cc215ULL, 0x15666361f5e6cULL },
+    { 0x150bf23eb52a2ULL, 0x0b9cee19e0bd0ULL, 0x08a95af89fa15ULL, 0x017a0f30ee73aULL },
+    { 0x150fcf70900bdULL, 0x0cd87573a46d0ULL, 0x17a0121de7e15ULL, 0x016c4b9d5c366ULL },
+    { 0x15108f386c071ULL, 0x0d4a5839350c1ULL, 0x11c06c39e2115ULL, 0x1061593834a56ULL },
+    { 0x15746899f04e0ULL, 0x10804c7d11afdULL, 0x00e41f322c5d5ULL, 0x17eb117c64021ULL },
+    { 0x157cc63ef66ecULL, 0x1b8c5f5fb12f3ULL, 0x06ecdef8c67d5ULL, 0x19e91bf5f463bULL },
+    { 0x1582c202c932eULL, 0x0a2be303103d0ULL, 0x0e99268086835ULL, 0x017811818fa8aULL },
+    { 0x15c4fb025d649ULL, 0x1f6a466750951ULL, 0x124d7481be475ULL, 0x115215ccc4adfULL },
+    { 0x15e77cc05753fULL, 0x1171f56754dfaULL, 0x1f95d4067dcf5ULL, 0x0bf655cd5f1d1ULL },
+    { 0x15c8c35d5128fULL, 0x1ceccf1390554ULL, 0x1e29157586275ULL, 0x05541391e66e7ULL },
+    { 0x15a84e3b4ef3fULL, 0x036bdb37bc0f6ULL, 0x1f9ee5b8e42b5ULL, 0x0de07bd9b7ad8ULL },
+    { 0x15ab02f9c5783ULL, 0x01f9ea15b076cULL, 0x183d473e81ab5ULL, 0x06dc1b50af3f0ULL },
+    { 0x1592fa5a1669aULL, 0x0ba8ee3745c52ULL, 0x0b2cd0b4be935ULL, 0x094745d8ee2baULL },
+    { 0x15b7d8a841794ULL, 0x08b16b6575178ULL, 0x053d042a37db5ULL, 0x03d15d4dad1a2ULL },
+    { 0x15ff4a0aaf0caULL, 0x13bae86b81373ULL, 0x0a61eaa0a5ff5ULL, 0x19d903ac2ebb9ULL },
+    { 0x1603f9c341925ULL, 0x0e5121a158ddcULL, 0x149305873f80dULL, 0x0776350b0914eULL },
+    { 0x162e10d7d1f12ULL, 0x0205a6d5dc76cULL, 0x091f17d610e8dULL, 0x06dc7756cb408ULL },
+    { 0x16fbc6c7a5204ULL, 0x1b3c33898177cULL, 0x04094bc6c7bedULL, 0x07dd03239879bULL },
+    { 0x169ca1dd4b2fcULL, 0x0ca60bd395dcfULL, 0x07e9a5770a72dULL, 0x1e775397a0ca6ULL },
+    { 0x1747659d6b714ULL, 0x14177bdd1495eULL, 0x051dad734dc5dULL, 0x0f525177bdd05ULL },
+    { 0x176f6a5e7a228ULL, 0x121e6efb90cf2ULL, 0x0288bcf4adeddULL, 0x09e613beecf09ULL },
+    { 0x174e96c8eb2adULL, 0x18ca7bcbd07caULL, 0x16a9ae26d2e5dULL, 0x0a7c17a7bca63ULL },
+    { 0x1751692c232dfULL, 0x14d4cbab25953ULL, 0x1f6988692d15dULL, 0x195349aba6565ULL },
+    { 0x17731d39038b2ULL, 0x1490f8b16d1e6ULL, 0x09a38139719ddULL, 0x0cf16d1a3e125ULL },
+    { 0x1783d62a33947ULL, 0x0a79fd8968153ULL, 0x1c5398a8d783dULL, 0x19502d237f3caULL },
+    { 0x1785468223689ULL, 0x02f852cf0015aULL, 0x122d8882c543dULL, 0x0b5001e6943e8ULL },
+    { 0x17aa2ca363daaULL, 0x02a1f0afb89eeULL, 0x0ab78d8a68abdULL, 0x0ef23bea1f0a8ULL },
+    { 0x17ce0eb5a6769ULL, 0x116d72ffa02cfULL, 0x12dccb5ae0e7dULL, 0x1e680bfe9d6d1ULL },
+    { 0x17bff49428d8dULL, 0x08f771dfc9878ULL, 0x163628525ffbdULL, 0x03c327f71dde2ULL },
+    { 0x182092f3f3780ULL, 0x0a89061c7276eULL, 0x003d9f9e92083ULL, 0x0edc9c70c122aULL },
+    { 0x1823c4249fc4dULL, 0x095635062a373ULL, 0x1647f24847883ULL, 0x19d8a8c158d52ULL },
+    { 0x181da9080d54aULL, 0x0d13886683941ULL, 0x0a5560212b703ULL, 0x105382cc23916ULL },
+    { 0x181d5714c09caULL, 0x049d9052db251ULL, 0x0a720651d5703ULL, 0x1149b69413724ULL },
+    { 0x18caff4529aa5ULL, 0x1cee3328cadd4ULL, 0x14ab2945fea63ULL, 0x0576a62998ee7ULL },
+    { 0x190de7f839cd0ULL, 0x0c9a5c5caed59ULL, 0x0167383fcf613ULL, 0x1356ea7474b26ULL },
+    { 0x190c6ad981809ULL, 0x004848728af5cULL, 0x12030336ac613ULL, 0x075ea29c24240ULL },
+    { 0x193ae2ac32f57ULL, 0x084def0caf87bULL, 0x1d5e986a8eb93ULL, 0x1bc3ea61ef642ULL },
+    { 0x197c6ec2435e5ULL, 0x12c9516493dfbULL, 0x14f58486ec7d3ULL, 0x1bf7924d15269ULL },
+    { 0x1982f79946f49ULL, 0x0d697a165a85fULL, 0x125ec533de833ULL, 0x1f42b4d0bd2d6ULL },
+    { 0x199bf4c4f237cULL, 0x0835770ad7edbULL, 0x07d89e465fb33ULL, 0x1b6fd6a1dd582ULL },
+    { 0x199d7d68648baULL, 0x05b0d86affcd0ULL, 0x0ba24c2d7d733ULL, 0x0167feac361b4ULL },
+    { 0x1a26b36a40aeeULL, 0x0e88abc27ace1ULL, 0x0eea04ad9ac8bULL, 0x10e6bc87aa22eULL },
+    { 0x1a2b7a8e078d4ULL, 0x039c29a0ce97bULL, 0x0563c0e2bda8bULL, 0x1bd2e60b28738ULL },
+    { 0x1ae34ea85469fULL, 0x11f8bfa636078ULL, 0x1f2c542ae58ebULL, 0x03c0d8cbfa3f1ULL },
+    { 0x1afccf67fd5afULL, 0x1fef95eeb37f4ULL, 0x1eb57fcde67ebULL, 0x05fd9aef53effULL },
+    { 0x1b60575dca37bULL, 0x144fda92566f7ULL, 0x1bd8a775d40dbULL, 0x1decd492b7e45ULL },
+    { 0x1b0fdbe8d4b77ULL, 0x0d59efe0fe6d9ULL, 0x1dda562fb7e1bULL, 0x136cfe0fef356ULL },
+    { 0x1b1070a8f084dULL, 0x00404d8a7ba59ULL, 0x16421e2a1c11bULL, 0x134bbca364040ULL },
+    { 0x1b57a2d819fceULL, 0x189befd60bd49ULL, 0x0e7f30368bd5bULL, 0x1257a0d7efb23ULL },
+    { 0x1b7c49b01d8f9ULL, 0x15c244f2af1f9ULL, 0x13e3701b247dbULL, 0x13f1ea9e44875ULL },
+    { 0x1b3e935da588aULL, 0x0d8ce8dacb764ULL, 0x0a234b7592f9bULL, 0x04dda6b62e636ULL },
+    { 0x1bc3177649d9dULL, 0x16ff71967e540ULL, 0x173724ddd187bULL, 0x0054fcd31dfedULL },
+    { 0x1ba33c43f6545ULL, 0x037175ac52e67ULL, 0x1454df84798bbULL, 0x1cce946b5d1d8ULL },
+    { 0x1bc58836b2a56ULL, 0x1a34c7f82e243ULL, 0x0d4a9ad82347bULL, 0x1848e83fc658bULL },
+    { 0x1b8971f2c1ac2ULL, 0x06b0c290faf59ULL, 0x086b069f1d23bULL, 0x135ebe12861acULL },
+    { 0x1bb295b1c24e7ULL, 0x0ce0f194732efULL, 0x1ce4871b529bbULL, 0x1ee99c531e0e6ULL },
+    { 0x1bba33164d3f1ULL, 0x07ef6290d79e1ULL, 0x11f964d198bbbULL, 0x10f3d6128defcULL },
+    { 0x1c22103a4fb8eULL, 0x0383ab137a162ULL, 0x0e3be4b810887ULL, 0x08d0bd91ab838ULL },
+    { 0x1c43be879cc8bULL, 0x1bdeb4274aa4cULL, 0x1a2673c2fb847ULL, 0x064aa5c85af7bULL },
+    { 0x1c6551c34ea22ULL, 0x171282415a4feULL, 0x088ae587154c7ULL, 0x0fe4b5048291dULL },
+    { 0x1ccfe457bc87fULL, 0x1b76b55b8eed5ULL, 0x1fc27bd44fe67ULL, 0x156ee3b55addbULL },
+    { 0x1cd93e8645f5fULL, 0x137d9327df949ULL, 0x1f5f44c2f9367ULL, 0x1253f7c9937d9ULL },
+    { 0x1d282be0cc0e6ULL, 0x058ac121b2ee9ULL, 0x0ce0660fa8297ULL, 0x12ee9b0906a34ULL },
+    { 0x1d145baa926e2ULL, 0x0688ce65632dbULL, 0x08ec92abb4517ULL, 0x1b698d4ce622cULL },
+    { 0x1d1b125e77357ULL, 0x035def19d7543ULL, 0x1d59dcf491b17ULL, 0x1855d731ef758ULL },
+    { 0x1d5c1e41a325cULL, 0x1008536bc7747ULL, 0x07498b04f0757ULL, 0x1c5dc7ad94201ULL },
+    { 0x1db6f0ef1bbe8ULL, 0x0aa76e436bdffULL, 0x02fbb1ee1edb7ULL, 0x1ff7ad84edcaaULL },
+    { 0x1dbe65207944fULL, 0x0462f54fb3971ULL, 0x1e453c094cfb7ULL, 0x11d39be55e8c4ULL },
+    { 0x1e4122f5564a2ULL, 0x119c849532cceULL, 0x08a4d55e8904fULL, 0x0e66995242731ULL },
+    { 0x1e4af7e62c5cdULL, 0x1fcf318fe2c59ULL, 0x167468cfdea4fULL, 0x13468fe319e7fULL },
+    { 0x1e14276e5b184ULL, 0x068f1dc133d42ULL, 0x0431b4edc850fULL, 0x0857990771e2cULL },
+    { 0x1e598152207f6ULL, 0x1e91839d874c1ULL, 0x0dfc08950334fULL, 0x1065c3738312fULL },
+    { 0x1e18aa0ff5341ULL, 0x0b4d0ea993b45ULL, 0x10595fe0aa30fULL, 0x145b932ae165aULL },
+    { 0x1e38b3e8ebb33ULL, 0x0c4b8a89fffeaULL, 0x199bae2f9a38fULL, 0x0affff22a3a46ULL },
+    { 0x1e1e8cb276d61ULL, 0x0b4134fdbb0cbULL, 0x10d6dc9a62f0fULL, 0x1a61bb7e5905aULL },
+    { 0x1e8004a264a90ULL, 0x03a012893e048ULL, 0x012a4c8a4002fULL, 0x0240f922900b8ULL },
+    { 0x1e8ded97dbfb1ULL, 0x0ef716f59ebdeULL, 0x11bfb7d36f62fULL, 0x0f7af35ed1deeULL },
+    { 0x1eed0e5be9dc2ULL, 0x12bb98fd9a765ULL, 0x08772fb4e16efULL, 0x14dcb37e33ba9ULL },
+    { 0x1f719a65d9e2eULL, 0x181ec7a77b7e4ULL, 0x0e8f374cb31dfULL, 0x04fdbdcbc6f03ULL },
+    { 0x1f32293d05f60ULL, 0x05056ab52b9e5ULL, 0x00df41792899fULL, 0x14f3a95aad414ULL },
+    { 0x1f799218421c8ULL, 0x18994893d3063ULL, 0x02708430933dfULL, 0x18c1979225323ULL },
+    { 0x1f1f8d4b954e3ULL, 0x0fd0fce5837c5ULL, 0x18e553a563f1fULL, 0x147d834e7e17eULL },
+    { 0x1fc1f562c517fULL, 0x1f71d18376fd1ULL, 0x1fd1468d5f07fULL, 0x117edd83171dfULL },
+    { 0x1f8841d0da1b8ULL, 0x04a34493966daULL, 0x03b0b6170423fULL, 0x0b6cd392458a4ULL },
+    { 0x1f8f8e2f0583eULL, 0x0b3cf9e3ae1c4ULL, 0x0f8341e8e3e3fULL, 0x0470eb8f3e79aULL },
+    { 0x1ff3f6f2dc70dULL, 0x1b7b779773e78ULL, 0x161c769edf9ffULL, 0x03cf9dd3ddbdbULL },
+    { 0x0e0fe008ededcULL, 0x09922bcf9eb11ULL, 0x076f6e200fe0eULL, 0x111af3e7a8932ULL },
+    { 0x107dd88886fc8ULL, 0x19910a66c927bULL, 0x027ec222377c1ULL, 0x1bc926cca1133ULL },
+    { 0x00241680b68bfULL, 0x01c8954a4c2aaULL, 0x1fa2da02d0480ULL, 0x0aa864a552270ULL },
+    { 0x00076f8288b4eULL, 0x061bb36208a19ULL, 0x0e5a2283edc00ULL, 0x130a208d9bb0cULL },
+    { 0x0069f757d4618ULL, 0x1f1c1616d4e34ULL, 0x030c57d5df2c0ULL, 0x058e56d0d071fULL },
+    { 0x002ac4a022b1cULL, 0x0801330aac03aULL, 0x071a880a46a80ULL, 0x0b806aa199002ULL },
+    { 0x0031fcd504254ULL, 0x0914133045c3dULL, 0x054841567f180ULL, 0x1787441990512ULL },
+    { 0x0015ece03a50cULL, 0x0813156e21c1aULL, 0x0614b80e6f500ULL, 0x0b0708ed51902ULL },
+    { 0x001b221ee6ff2ULL, 0x039daa1c9da83ULL, 0x09fecef089b00ULL, 0x182b7270ab738ULL },
+    { 0x007e013ff7470ULL, 0x17042c5cb53a7ULL, 0x01c5dff900fc0ULL, 0x1cb95a746841dULL },
+    { 0x00ab99ad67363ULL, 0x0d75aa28f01afULL, 0x18d9cd6b33aa0ULL, 0x1eb01e28ab5d6ULL },
+    { 0x00cdb2449013dULL, 0x187d0542c4e80ULL, 0x179012449b660ULL, 0x002e4685417c3ULL },
+    { 0x0094c4def7285ULL, 0x0be41f581171aULL, 0x1429def646520ULL, 0x0b1d1035f04faULL },
+    { 0x0098941760b60ULL, 0x0a251218d9085ULL, 0x00da0dd052320ULL, 0x142136309148aULL },
+    { 0x01209e0cd3b4cULL, 0x080d5f2258323ULL, 0x065b9660f2090ULL, 0x18983489f5602ULL },
+    { 0x0107f442ff799ULL, 0x0bd3764e54f12ULL, 0x133dfe845fc10ULL, 0x091e54e4dd97aULL },
+    { 0x014d748767e8fULL, 0x13d4d34ed891eULL, 0x1e2fcdc25d650ULL, 0x0f1236e596579ULL },
+    { 0x013268941a1f8ULL, 0x00876432058bbULL, 0x03f0b0522c990ULL, 0x1ba340984dc20ULL },
+    { 0x011a4bc08e4c5ULL, 0x05ca61248161bULL, 0x1464e207a4b10ULL, 0x1b0d02490ca74ULL },
+    { 0x01c4e570f9297ULL, 0x1ce2d75834f10ULL, 0x1d293e1d4e470ULL, 0x011e5835d68e7ULL },
+    { 0x01e55fd2db5c6ULL, 0x16bbd5745073bULL, 0x0c75b697f54f0ULL, 0x1b9c145d57badULL },
+    { 0x01abce4713006ULL, 0x0a3cf52080536ULL, 0x0c0191c4e7ab0ULL, 0x0d9402095e78aULL },
+    { 0x01caee14ec6c7ULL, 0x19eef33c90a11ULL, 0x1c6c6e50eea70ULL, 0x110a12799eef3ULL },
+    { 0x01ad553b8367eULL, 0x0630db56e43b7ULL, 0x0fcd83b9556b0ULL, 0x1db84ed5b618cULL },
+    { 0x01aed3500e3a1ULL, 0x0deb6250c04b2ULL, 0x10b8e01596eb0ULL, 0x09a406148daf6ULL },
+    { 0x01cf98a47c599ULL, 0x19f7646ef4008ULL, 0x13347c4a33e70ULL, 0x02005eec4ddf3ULL },
+    { 0x01f16d429ec2aULL, 0x1732d42609eb2ULL, 0x0a86f2856d1f0ULL, 0x09af20c85699dULL },
+    { 0x01b570daf9c23ULL, 0x0272cc5c59fb8ULL, 0x18873eb61d5b0ULL, 0x03bf3474669c8ULL },
+    { 0x01f978ec2792dULL, 0x1175492ae9dbaULL, 0x1693c86e3d3f0ULL, 0x0bb72ea9255d1ULL },
+    { 0x01dd87e675c23ULL, 0x1f7cd44cb9588ULL, 0x18875ccfc3770ULL, 0x02353a64567dfULL },
+    { 0x0221f314a8ea4ULL, 0x0c9e039c48ab0ULL, 0x04ae2a519f088ULL, 0x01aa247380f26ULL },
+    { 0x022efa507c532ULL, 0x090ba4fcd4cb0ULL, 0x09947c14bee88ULL, 0x01a6567e4ba12ULL },
+    { 0x0232f6b7ca342ULL, 0x0a0fb29071a3fULL, 0x0858a7dade988ULL, 0x1f8b1c129be0aULL },
+    { 0x025373074d2dfULL, 0x17dea38255915ULL, 0x1f6965c19d948ULL, 0x151354838af7dULL },
+    { 0x027d2837bebb4ULL, 0x139707f8adaa6ULL, 0x05bafbd8297c8ULL, 0x0cab6a3fc1d39ULL },
+    { 0x02c1aa7a952aeULL, 0x1bb88fb220f80ULL, 0x0ea952bcab068ULL, 0x003e089be23bbULL },
+    { 0x02c7a2adfce92ULL, 0x19beaecc3ca0cULL, 0x092e7f6a8bc68ULL, 0x060a7866eafb3ULL },
+    { 0x02904c800bf2fULL, 0x006393a60919aULL, 0x1e9fa00264128ULL, 0x0b3120cb938c0ULL },
+    { 0x02b05431e5471ULL, 0x0160109c753b5ULL, 0x11c54f18541a8ULL, 0x15b95c72100d0ULL },
+    { 0x02b32446a95f4ULL, 0x02b7318c05fa1ULL, 0x05f52ac4499a8ULL, 0x10bf406319da8ULL },
+    { 0x02f38b233ac5cULL, 0x1e3a25ae2d027ULL, 0x0746b989a39e8ULL, 0x1c8168eb48b8fULL },
+    { 0x02b4aaf5e33e9ULL, 0x08ed02fa31fafULL, 0x12f98f5eaa5a8ULL, 0x1ebf18be816e2ULL },
+    { 0x02d7303272fe6ULL, 0x12b1a7dc79883ULL, 0x0cfe9c9819d68ULL, 0x18233c77cb1a9ULL },
+    { 0x029a95c3ea78cULL, 0x0ea3338ed160eULL, 0x063caf8752b28ULL, 0x0e0d16e3998aeULL },
+    { 0x02dbd794d625dULL, 0x1d7c3792d521bULL, 0x1748d653d7b68ULL, 0x1b095693d87d7ULL },
+    { 0x02bafce6510eaULL, 0x0aa4b4a2f1db9ULL, 0x0ae114ce7eba8ULL, 0x13b71e8a5a4aaULL },
+    { 0x0360b13701d8fULL, 0x1ec5c19668924ULL, 0x1e3701d91a0d8ULL, 0x04922cd30746fULL },
+    { 0x030981a2221b1ULL, 0x0ed14088a408aULL, 0x11b0888b03218ULL, 0x0a204a220516eULL },
+    { 0x036a02607bd27ULL, 0x104be58cb85a2ULL, 0x1c97bc0c80ad8ULL, 0x08b43a634fa41ULL },
+    { 0x034ea86ebcc74ULL, 0x1b066decace81ULL, 0x05c67aec2ae58ULL, 0x102e6a6f6cc1bULL },
+    { 0x0331658dacb9cULL, 0x05975b8a0da3cULL, 0x073a6b634d198ULL, 0x078b60a3b5d34ULL },
+    { 0x0313bdb357e06ULL, 0x0f10f7b47990eULL, 0x0c0fd59b7b918ULL, 0x0e133c5bde11eULL },
+    { 0x035477a2a2c95ULL, 0x16c851cc6da1aULL, 0x15268a8bdc558ULL, 0x0b0b6c671426dULL },
+    { 0x0317fbbb310a1ULL, 0x0ed86cf86199cULL, 0x10a119bbbfd18ULL, 0x07330c3e6c36eULL },
+    { 0x035778b01f14dULL, 0x115365f26191bULL, 0x1651f01a3dd58ULL, 0x1b130c9f4d951ULL },
+    { 0x0319590e75c19ULL, 0x07544caedd110ULL, 0x13075ce135318ULL, 0x011176ea6455cULL },
+    { 0x035f6abc18733ULL, 0x105feef4a5898ULL, 0x199c307aadf58ULL, 0x03234a5eeff41ULL },
+    { 0x033f959f4f7d6ULL, 0x0f97fbd4d512fULL, 0x0d7de5f353f98ULL, 0x1e915657bfd3eULL },
+    { 0x03e429a665702ULL, 0x1725c2ec30928ULL, 0x081d4ccb284f8ULL, 0x0292186e8749dULL },
+    { 0x03ad0c2c2a05bULL, 0x0076d8eaa4023ULL, 0x1b40a868616b8ULL, 0x18804aae36dc0ULL },
+    { 0x03ae222d33f9bULL, 0x00edeeceac926ULL, 0x1b3f996888eb8ULL, 0x0c926ae6ef6e0ULL },
+    { 0x038e668ba747bULL, 0x0368f8ce84b9fULL, 0x1bc5cba2cce38ULL, 0x1f3a42e63e2d8ULL },
+    { 0x03d4e0e2c7a2dULL, 0x1b6043c239f9aULL, 0x168bc68e0e578ULL, 0x0b3f3887840dbULL },
+    { 0x0402de28bde21ULL, 0x094a3e2d68390ULL, 0x108f7a28f6804ULL, 0x01382d68f8a52ULL },
+    { 0x0424a9f20629aULL, 0x0f80827324c2aULL, 0x0b28c09f2a484ULL, 0x0a86499c8203eULL },
+    { 0x0465ae7d7b87dULL, 0x185e1d7b3cda7ULL, 0x17c3bd7ceb4c4ULL, 0x1cb679bd70f43ULL },
+    { 0x046907c56c971ULL, 0x155f10099c4adULL, 0x11d26d47c12c4ULL, 0x16a4732011f55ULL },
+    { 0x046ac7493f0bdULL, 0x1dca3d0b845b6ULL, 0x17a1f925c6ac4ULL, 0x0db443a178a77ULL },
+    { 0x045157022d784ULL, 0x179b130d41110ULL, 0x043d6881d5144ULL, 0x0111056191b3dULL },
+    { 0x0414e912c84a5ULL, 0x0ec2017511a90ULL, 0x14a426912e504ULL, 0x012b115d0086eULL },
+    { 0x04549f1ebce4fULL, 0x1f4e9f7f49201ULL, 0x1e4e7af1f2544ULL, 0x100925fdf2e5fULL },
+    { 0x043dfc66bb837ULL, 0x0a569569edfb2ULL, 0x1d83bacc7f784ULL, 0x09bf6f2d52d4aULL },
+    { 0x043ff5529e1fcULL, 0x0f933553c5eb3ULL, 0x07f0f2955ff84ULL, 0x19af47955993eULL },
+    { 0x04a60896e92d4ULL, 0x02a6237914329ULL, 0x05692ed220ca4ULL, 0x1298513d88ca8ULL },
+    { 0x04c6f1d947390ULL, 0x1da12a5154d1eULL, 0x0139c5371ec64ULL, 0x0f165514a90b7ULL },
+    { 0x04e868237c54aULL, 0x1323842fb0835ULL, 0x0a547d882c2e4ULL, 0x15821be843899ULL },
+    { 0x04eef684a19caULL, 0x18adb04bc8b39ULL, 0x0a730a42deee4ULL, 0x139a27a41b6a3ULL },
+    { 0x04918c259a60aULL, 0x0836962721206ULL, 0x0a0cb34863124ULL, 0x0c0909c8d2d82ULL },
+    { 0x04f6b0c75e4ddULL, 0x1be6254755c2fULL, 0x1764f5c61ade4ULL, 0x1e8755c548cfbULL },
+    { 0x04b805f5355d3ULL, 0x05e5941da552dULL, 0x1975595f403a4ULL, 0x16954b70534f4ULL },
+    { 0x04b83e9e63159ULL, 0x026d183bd592bULL, 0x13518cf2f83a4ULL, 0x1a9357b8316c8ULL },
+    { 0x04dbf68b351b1ULL, 0x1bf93c09c599cULL, 0x11b159a2dfb64ULL, 0x07334720793fbULL },
+    { 0x049cb6bfd0d18ULL, 0x0a2d1c57fda0cULL, 0x031617fada724ULL, 0x060b7fd47168aULL },
+    { 0x049f526d462a9ULL, 0x01fc2a43f1496ULL, 0x12a8c56c95f24ULL, 0x0d251f84a87f0ULL },
+    { 0x05242f080c5bfULL, 0x05cbd967048a0ULL, 0x1fb46021e8494ULL, 0x00a241cd37a74ULL },
+    { 0x0545fb4648d93ULL, 0x1edfc0655cc10ULL, 0x193624c5bf454ULL, 0x0106754c07f6fULL },
+    { 0x0507c7e54ce08ULL, 0x0d1e72473841cULL, 0x020e654fc7c14ULL, 0x070439c49cf16ULL },
+    { 0x0579b72ec0374ULL, 0x1e1d5b01f5aa1ULL, 0x05d806e9db3d4ULL, 0x10ab5f01b570fULL },
+    { 0x051d5b59bbcfdULL, 0x04da4d7fcd797ULL, 0x17e7bb35b5714ULL, 0x1d3d67fd64b64ULL },
+    { 0x0589b19e5ce75ULL, 0x0f764f15dc889ULL, 0x15ce74f31b234ULL, 0x12227751e4ddeULL },
+    { 0x05cb001c87d9cULL, 0x11b569178c302ULL, 0x0737c27001a74ULL, 0x081863d12d5b1ULL },
+    { 0x05b0376e89fc7ULL, 0x06efdb0569f21ULL, 0x1c7f22edd81b4ULL, 0x109f2d41b7eecULL },
+    { 0x059228703da3aULL, 0x0122e63b2dd80ULL, 0x0b8b781c28934ULL, 0x003769b8ce890ULL },
+    { 0x05b6811aee963ULL, 0x0f63e859192a3ULL, 0x18d2eeb102db4ULL, 0x18a931342f8deULL },
+    { 0x059c02e7ab207ULL, 0x026ec349a170eULL, 0x1c09abce80734ULL, 0x0e1d0b2586ec8ULL },
+    { 0x060122eadd9a1ULL, 0x03db0c8138f88ULL, 0x10b376ae8900cULL, 0x023e390261b78ULL },
+    { 0x0668c1a1efd2cULL, 0x1d03018fb83beULL, 0x0697ef0b062ccULL, 0x0fb83be301817ULL },
+    { 0x064e278e948b2ULL, 0x178cbcc18ca88ULL, 0x09a252e3c8e4cULL, 0x022a63067a63dULL },
+    { 0x0614fdf6669cfULL, 0x0fc591fb79c1bULL, 0x1e72ccdf7e50cULL, 0x1b073dbf1347eULL },
+    { 0x0616fe892bf94ULL, 0x088b3bed4d91eULL, 0x053fa922fed0cULL, 0x0f13656fb9a22ULL },
+    { 0x067d8207134a4ULL, 0x1a9c05c5811a6ULL, 0x04a591c0837ccULL, 0x0cb103474072bULL },
+    { 0x06ad50b3282b6ULL, 0x02b283d9e40bcULL, 0x0da8299a156acULL, 0x07a04f37829a8ULL },
+    { 0x06cfb8ff22113ULL, 0x1a75a8f9e4c0eULL, 0x191089fe3be6cULL, 0x0e064f3e2b5cbULL },
+    { 0x06b23d81e680bULL, 0x0560b0ab59a2eULL, 0x1a02cf03789acULL, 0x0e8b35aa1a0d4ULL },
+    { 0x0743ef48f731aULL, 0x1d19feab14f12ULL, 0x0b19de25ef85cULL, 0x091e51aaff317ULL },
+    { 0x074ac9ba34d97ULL, 0x1fc1edbdac018ULL, 0x1d3658bb26a5cULL, 0x03006b7b6f07fULL },
+    { 0x072d2c73e7361ULL, 0x035152f9b0fa7ULL, 0x10d9cf9c6969cULL, 0x1cbe1b3e95158ULL },
+    { 0x076c0ce23c7e6ULL, 0x1383d7eda04a9ULL, 0x0cfc788e606dcULL, 0x12a40b6fd7839ULL },
+    { 0x07399ac83ad9bULL, 0x08dbccafcd42aULL, 0x1b36b826b339cULL, 0x0a8567ea67b62ULL },
+    { 0x078662be101ceULL, 0x02adedd320819ULL, 0x0e7010fa8cc3cULL, 0x130209976f6a8ULL },
+    { 0x078678a9606e7ULL, 0x00e0ebed7089dULL, 0x1cec0d2a3cc3cULL, 0x17221d6fae0e0ULL },
+    { 0x07ac57496c790ULL, 0x05ab5acdd4434ULL, 0x013c6d25d46bcULL, 0x05845766b5ab4ULL },
+    { 0x07aea1344dabfULL, 0x0de6e3d3bc9a0ULL, 0x1fab64590aebcULL, 0x00b27b978ecf6ULL },
+    { 0x07f3166187c67ULL, 0x1178f185697a7ULL, 0x1cc7c30cd19fcULL, 0x1cbd2d431e3d1ULL },
+    { 0x07d9b5f7ba856ULL, 0x1e36d599ede0fULL, 0x0d42bbdf5b37cULL, 0x1e0f6f3356d8fULL },
+    { 0x07fab68a6efcfULL, 0x1bebfb8fd982bULL, 0x1e7eeca2dabfcULL, 0x1a8337e3bfafbULL },
+    { 0x079d36a60d368ULL, 0x033f52c3e1989ULL, 0x02d960cad973cULL, 0x12330f8695f98ULL },
+    { 0x08006bbfc8451ULL, 0x064e083436a1dULL, 0x114427fbac002ULL, 0x170ad85820e4cULL },
+    { 0x086d556119addULL, 0x14d21742ee535ULL, 0x176b310d556c2ULL, 0x1594ee85d0965ULL },
+    { 0x086e3cb539c3dULL, 0x1046357eee9acULL, 0x1787395a78ec2ULL, 0x06b2eefd58c41ULL },
+    { 0x08351d37e6922ULL, 0x071590787b2a6ULL, 0x0892cfd971582ULL, 0x0ca9bc3c1351cULL },
+    { 0x083958b4dc626ULL, 0x01168734f32b8ULL, 0x0c8c765a35382ULL, 0x03a99e59c2d10ULL },
+    { 0x085ee797a0468ULL, 0x1e0c305e83a9dULL, 0x02c40bd3cef42ULL, 0x172b82f41860fULL },
+    { 0x0884e3b676db7ULL, 0x0fed855c3e89aULL, 0x1db6dcdb8e422ULL, 0x0b22f875436feULL },
+    { 0x08898368030c3ULL, 0x0cf88800a2503ULL, 0x1861802d83222ULL, 0x18148a00223e6ULL },
+    { 0x08c95315f93b8ULL, 0x14bf061ad6394ULL, 0x03b93f5195262ULL, 0x0538d6b0c1fa5ULL },
+    { 0x08d060df38fc1ULL, 0x12e70e1c0bc1dULL, 0x107e39f60c162ULL, 0x1707a070e1ce9ULL },
+    { 0x0891995bae5f5ULL, 0x0ff3093c47687ULL, 0x15f4ebb533122ULL, 0x1c2dc479219feULL },
+    { 0x08d3c7476e883ULL, 0x1ffeb0081b416ULL, 0x1822edc5c7962ULL, 0x0d05b0201afffULL },
+    { 0x0923f1f8b7dc6ULL, 0x0d91ed1c6af3bULL, 0x0c77da3f1f892ULL, 0x1b9eac716f136ULL },
+    { 0x092964597fa47ULL, 0x0152df189ad37ULL, 0x1c4bfd344d292ULL, 0x1d96b231f6950ULL },
+    { 0x092b610de2795ULL, 0x04d56b0c96a36ULL, 0x153c8f610da92ULL, 0x0d8ad261ad564ULL },
+    { 0x09562888c1443ULL, 0x1040e86413b09ULL, 0x1845062228d52ULL, 0x121b904c2e041ULL },
+    { 0x0978631aa3992ULL, 0x1689c8188fb32ULL, 0x09338ab18c3d2ULL, 0x099be2302722dULL },
+    { 0x098e9e89a4e2fULL, 0x0968fb6eca28cULL, 0x1e8e4b22f2e32ULL, 0x0628a6edbe2d2ULL },
+    { 0x09d3af005f511ULL, 0x1d7b742417902ULL, 0x1115f401eb972ULL, 0x0813d0485dbd7ULL },
+    { 0x09f510648b090ULL, 0x10b6404067722ULL, 0x0121a24c115f2ULL, 0x089dcc0404da1ULL },
+    { 0x09b987c845e58ULL, 0x0d385a069f529ULL, 0x034f4427c33b2ULL, 0x1295f2c0b4396ULL },
+    { 0x09b9b6c5ed381ULL, 0x09ff5208d3f2cULL, 0x10396f46db3b2ULL, 0x069f962095ff2ULL },
+    { 0x099f8a3ec4604ULL, 0x0b3c6b74b3200ULL, 0x040c46f8a3f32ULL, 0x00099a5dac79aULL },
+    { 0x09bf17b6a9d66ULL, 0x063ff15ceb3a9ULL, 0x0cd72adbd1fb2ULL, 0x12b9ae751ff8cULL },
+    { 0x09dfd9d8aa205ULL, 0x1c726b78c361aULL, 0x1408aa3737f72ULL, 0x0b0d863dac9c7ULL },
+    { 0x0a65be9297c17ULL, 0x1b5895f44eb2aULL, 0x1d07d292fb4caULL, 0x0a9ae45f5235bULL },
+    { 0x0a66e6163da99ULL, 0x1bce36da0e930ULL, 0x132b78d0ceccaULL, 0x0192e0b6d8e7bULL },
+    { 0x0a314e6989c34ULL, 0x001a19a42f7b4ULL, 0x0587232ce518aULL, 0x05bde84b30b00ULL },
+    { 0x0a35a52a7f466ULL, 0x0f129dcc339a3ULL, 0x0cc5fca94b58aULL, 0x18b398677291eULL },
+    { 0x0a1e9176aae2fULL, 0x0e46a3deeb682ULL, 0x1e8eaadd12f0aULL, 0x082daef78ac4eULL },
+    { 0x0a7e5b152fa7eULL, 0x150ea3facf1b7ULL, 0x0fcbe951b4fcaULL, 0x1db1e6bf8ae15ULL },
+    { 0x0ae5c66b883cbULL, 0x1afb9ac222635ULL, 0x1a7823acc74eaULL, 0x158c8886b3bebULL },
+    { 0x0aac31533e657ULL, 0x076287dcc6c27ULL, 0x1d4cf995186aaULL, 0x1c86c677c28dcULL },
+    { 0x0a8e561ba8521ULL, 0x026b38dcc2294ULL, 0x10942bb0d4e2aULL, 0x0528867639ac8ULL },
+    { 0x0aef1795965a5ULL, 0x15fd35d4c22aeULL, 0x14b4d353d1eeaULL, 0x0ea88657597f5ULL },
+    { 0x0ab64deabffddULL, 0x07e33fee2f73bULL, 0x177ffaaf64daaULL, 0x1b9de8eff98fcULL },
+    { 0x0afaf83001e19ULL, 0x186022b6ef930ULL, 0x130f00183ebeaULL, 0x0193eeda880c3ULL },
+    { 0x0abe64b3fee6aULL, 0x0322b6debbabfULL, 0x0aceff9a4cfaaULL, 0x1fabbaf6da898ULL },
+    { 0x0b40153dba53cULL, 0x14075d9e66286ULL, 0x0794bb795005aULL, 0x0c28ccf375c05ULL },
+    { 0x0b24e7ad0b29dULL, 0x0cce5bc22693eULL, 0x1729a16bce49aULL, 0x0f92c887b4e66ULL },
+    { 0x0b29367a63c9eULL, 0x0298d99efed22ULL, 0x0f278cbcd929aULL, 0x0896fef336328ULL },
+    { 0x0b6b83c4b73e3ULL, 0x1ddde688827abULL, 0x18f9da4783adaULL, 0x1abc8222cf777ULL },
+    { 0x0b2a30b2317f2ULL, 0x0281e69ce69a9ULL, 0x09fd189a18a9aULL, 0x12b2ce72cf028ULL },
+    { 0x0b738b8e795f1ULL, 0x1edf6cac171a9ULL, 0x11f53ce3a39daULL, 0x12b1d06a6df6fULL },
+    { 0x0b529a3d24531ULL, 0x194d68bc67084ULL, 0x11944978b295aULL, 0x0421cc7a2d653ULL },
+    { 0x0b15536d63668ULL, 0x041c4ace73597ULL, 0x02cd8d6d9551aULL, 0x1d359ce6a4704ULL },
+    { 0x0b595462df4afULL, 0x13d2d586f3792ULL, 0x1ea5f68c5535aULL, 0x093d9ec356979ULL },
+    { 0x0b1b17c07e272ULL, 0x051af688d748bULL, 0x09c8fc07d1b1aULL, 0x1a25d622deb14ULL },
+    { 0x0b5fa36c1b1f8ULL, 0x1c9f6cc2a7d83ULL, 0x03f1b06d8bf5aULL, 0x1837ca866df27ULL },
+    { 0x0ba5019e8a755ULL, 0x06774bd40622bULL, 0x155ca2f3014baULL, 0x1a88c057a5dccULL },
+    { 0x0bc69ae3122b6ULL, 0x1aa8e7e06648eULL, 0x0da8918eb2c7aULL, 0x0e24cc0fce2abULL },
+    { 0x0bd19cf0266ceULL, 0x19b0d3be6340bULL, 0x0e6cc81e7317aULL, 0x1a058cfb961b3ULL },
+    { 0x0b9e06954400aULL, 0x012cf0d29300cULL, 0x0a004552c0f3aULL, 0x060192961e690ULL },
+    { 0x0c65e118c03c6ULL, 0x1c918b5112a31ULL, 0x0c7806310f4c6ULL, 0x118a9115a3127ULL },
+    { 0x0c245e10735bcULL, 0x0089157f561b2ULL, 0x07b59c10f4486ULL, 0x09b0d5fd51220ULL },
+    { 0x0c2800c3884b7ULL, 0x02c28105866acULL, 0x1da4238600286ULL, 0x06acc34102868ULL },
+    { 0x0c6d1f9f03e20ULL, 0x161c1a75ca1aeULL, 0x008f81f3f16c6ULL, 0x0eb0a75cb070dULL },
+    { 0x0c546a1400b9dULL, 0x10cd03730f810ULL, 0x173a0050ac546ULL, 0x0103e19d81661ULL },
+    { 0x0c19e11139f0dULL, 0x0c53071f8b914ULL, 0x161f39110f306ULL, 0x0513a3f1c1946ULL },
+    { 0x0c83ecd264df4ULL, 0x0bb1313d1ec99ULL, 0x05f64c966f826ULL, 0x1326f179191baULL },
+    { 0x0cea848853785ULL, 0x18e13f059212aULL, 0x143d942242ae6ULL, 0x0a909341f90e3ULL },
+    { 0x0cebcdbeb434eULL, 0x1f35bf3ba2239ULL, 0x0e585afb67ae6ULL, 0x13888bb9fb59fULL },
+    { 0x0c8e1007ee042ULL, 0x0326a049d2207ULL, 0x0840efc010e26ULL, 0x1c0897240ac98ULL },
+    { 0x0cae31e7d236dULL, 0x06652743f2eafULL, 0x16d897cf18ea6ULL, 0x1eae9f85c94ccULL },
+    { 0x0cf3381d985d1ULL, 0x10f72c3547a25ULL, 0x11743370399e6ULL, 0x148bc55869de1ULL },
+    { 0x0cd6b7e029facULL, 0x1cab334f6bd88ULL, 0x06bf280fdad66ULL, 0x0237ade599aa7ULL },
+    { 0x0cfa272b70f70ULL, 0x16293e0dbf8a5ULL, 0x01de1da9c8be6ULL, 0x14a3fb60f928dULL },
+    { 0x0cbad72a6e824ULL, 0x0f2a3909fb0b2ULL, 0x0482eca9d6ba6ULL, 0x09a1bf2138a9eULL },
+    { 0x0d66a8b5d7d6eULL, 0x1905e5773abafULL, 0x0ed7d75a2acd6ULL, 0x1ebab9dd4f413ULL },
+    { 0x0d4aa3ee9381fULL, 0x1e4ced03aef0aULL, 0x1f0392ef8aa56ULL, 0x0a1eeb816e64fULL },
+    { 0x0d3ade0460268ULL, 0x080c722bd30b1ULL, 0x02c80c40f6b96ULL, 0x11a197a89c602ULL },
+    { 0x0d7ad9d4ca9d1ULL, 0x1cc76031df63bULL, 0x1172a65736bd6ULL, 0x1b8df7180dc67ULL },
+    { 0x0d8a6fd5083d6ULL, 0x04aff33186c1dULL, 0x0d782157eca36ULL, 0x1706c3199fea4ULL },
+    { 0x0dcc748288049ULL, 0x12625043c2a19ULL, 0x124022825c676ULL, 0x130a8784148c9ULL },
+    { 0x0d8f1982d08b1ULL, 0x06f06461de288ULL, 0x11a2168331e36ULL, 0x0228f70c4c1ecULL },
+    { 0x0d99dc4f4665eULL, 0x0b34db27d7417ULL, 0x0f4cc5e477336ULL, 0x1d05d7c9b659aULL },
+    { 0x0dfc4c4108f36ULL, 0x1023d3658f4b4ULL, 0x0d9e2104647f6ULL, 0x05a5e34d97881ULL },
+    { 0x0e2041fc38de6ULL, 0x04878d9d2a4b9ULL, 0x0cf6387f0408eULL, 0x13a4a97363c24ULL },
+    { 0x0e20285bfb658ULL, 0x02020ebf16f27ULL, 0x034dbfb42808eULL, 0x1c9ed1fae0808ULL },
+    { 0x0e415759d04c0ULL, 0x14981c9552615ULL, 0x00641735d504eULL, 0x150c955270325ULL },
+    { 0x0e499fe1baf32ULL, 0x1c1b96adee68eULL, 0x099ebb0ff324eULL, 0x0e2cef6ad3b07ULL },
+    { 0x0e129914f5fc8ULL, 0x0d8526bf5b301ULL, 0x027f5e513290eULL, 0x1019b5fac9436ULL },
+    { 0x0e7b6b8b03e4bULL, 0x1658aaa78b93fULL, 0x1a4f81a3adbceULL, 0x1f93a3caaa34dULL },
+    { 0x0e3b9e1c47fabULL, 0x09ddbab7db1a2ULL, 0x1abfc470f3b8eULL, 0x08b1b7dabb772ULL },
+    { 0x0e7e1b3bce247ULL, 0x174aabf1f3227ULL, 0x1c48e7b9b0fceULL, 0x1c899f1faaa5dULL },
+    { 0x0ea2164d478daULL, 0x01acb8835e527ULL, 0x0b63c564d08aeULL, 0x1c94f5823a6b0ULL },
+    { 0x0eafbd1240c7eULL, 0x0e30b1f7de8a1ULL, 0x0fc604917beaeULL, 0x10a2f7df1a18eULL },
+    { 0x0e93f330a23faULL, 0x0cb9a29b67a93ULL, 0x0bf88a199f92eULL, 0x192bcdb28b3a6ULL },
+    { 0x0f41db63135daULL, 0x1e99c4a766517ULL, 0x0b75918db705eULL, 0x1d14cdca4732fULL },
+    { 0x0f22d1e74914bULL, 0x0e47e0837253dULL, 0x1a5125cf1689eULL, 0x17949d820fc4eULL },
+    { 0x0f379020ce06aULL, 0x0912e0c3732a3ULL, 0x0ac0e60813d9eULL, 0x18a99d860e912ULL },
+    { 0x0fa9b85471f03ULL, 0x0875c6bddad20ULL, 0x181f1c543b2beULL, 0x0096b77ac75c2ULL },
+    { 0x0f90e34c76a9cULL, 0x0dac4f8b1fc12ULL, 0x072adc658e13eULL, 0x0907f1a3e46b6ULL },
+    { 0x0ff44f7ac0525ULL, 0x166959f5336b0ULL, 0x149406bde45feULL, 0x01ad995f352cdULL },
+    { 0x0fb57be77bb8bULL, 0x06ffc6eb7bd3eULL, 0x1a3bbdcfbd5beULL, 0x0f97bdaec7fecULL },
+    { 0x0fb76835aaaf9ULL, 0x00f662fb2fab7ULL, 0x13eaab582ddbeULL, 0x1dabe9be8cde0ULL },
+    { 0x106088515d38eULL, 0x1983873210564ULL, 0x0e397514220c1ULL, 0x04d41099c3833ULL },
+    { 0x1065655b1b4d7ULL, 0x16d29d5404d77ULL, 0x1d65b1b54d4c1ULL, 0x1dd640557296dULL },
+    { 0x10254a525c8feULL, 0x039a85721c4f1ULL, 0x0fe27494a5481ULL, 0x11e4709d42b38ULL },
+    { 0x102702d492be4ULL, 0x009d2750086ebULL, 0x04fa925681c81ULL, 0x1aec2015c9720ULL },
+    { 0x102c9bb7f38ddULL, 0x0ecc057afc36fULL, 0x17639fdbb2681ULL, 0x1ed87ebd4066eULL },
+    { 0x102f6bbf977fbULL, 0x07ddae76a4bffULL, 0x1bfdd3fbade81ULL, 0x1ffa4adceb77cULL },
+    { 0x10565c288a09cULL, 0x1082396265252ULL, 0x0720a22874d41ULL, 0x09494c8d38821ULL },
+    { 0x101ef78c2322aULL, 0x0c0cba4ac19daULL, 0x0a898863def01ULL, 0x0b7306a4ba606ULL },
+    { 0x10e68d54afb90ULL, 0x1da732780c762ULL, 0x013bea5562ce1ULL, 0x08dc603c99cb7ULL },
+    { 0x109182fa52bdfULL, 0x0af98f123d44bULL, 0x1f7a94be83121ULL, 0x1a457891e33eaULL },
+    { 0x1092d6d755458ULL, 0x0b2c34165555dULL, 0x034555d6d6921ULL, 0x175554d05869aULL },
+    { 0x10f3973e5b768ULL, 0x1e3f3e16711e3ULL, 0x02ddb4f9d39e1ULL, 0x18f11cd0f9f8fULL },
+    { 0x10988ec9fe02bULL, 0x096a9c2a916ceULL, 0x1a80ff26e2321ULL, 0x0e6d12a872ad2ULL },
+    { 0x10f891d03dc25ULL, 0x1d62051cc95e8ULL, 0x14877817123e1ULL, 0x02f52671408d7ULL },
+    { 0x10bc3ea5a80b3ULL, 0x00ee9068e5aecULL, 0x19a02b4af87a1ULL, 0x06eb4e2c12ee0ULL },
+    { 0x1121c4685a583ULL, 0x08d3dc0430472ULL, 0x1834b42c47091ULL, 0x09c4184077962ULL },
+    { 0x11471b58bdb0dULL, 0x155b6f7a48740ULL, 0x161b7a35b1c51ULL, 0x005c24bdedb55ULL },
+    { 0x1152b3150dc2aULL, 0x1d0ee016499c4ULL, 0x0a8761519a951ULL, 0x047324d00ee17ULL },
+    { 0x11a3a5e285cf7ULL, 0x0ff0f1042cfe9ULL, 0x1de7428f4b8b1ULL, 0x12fe68411e1feULL },
+    { 0x11adec6521d55ULL, 0x0875516cacd75ULL, 0x1557094c6f6b1ULL, 0x15d66a6d155c2ULL },
+    { 0x11d6518a760f9ULL, 0x17e06c4a550dbULL, 0x13e0dca314d71ULL, 0x1b6154a46c0fdULL },
+    { 0x11dbdd657b63dULL, 0x1c76772ef55d6ULL, 0x178dbd4d77b71ULL, 0x0d755ee9dcdc7ULL },
+    { 0x11bea0de73df4ULL, 0x0aa56d5c9ddebULL, 0x05f79cf60afb1ULL, 0x1af772756d4aaULL },
+    { 0x1202f2a5f311eULL, 0x080da58a74b5eULL, 0x0f119f4a9e809ULL, 0x0f5a5ca34b602ULL },
+    { 0x122460e37fdd0ULL, 0x038304cc3cd7fULL, 0x0177fd8e0c489ULL, 0x1fd6786641838ULL },
+    { 0x1204aab639c05ULL, 0x0a4e05fc28948ULL, 0x140738daaa409ULL, 0x0252287f40e4aULL },
+    { 0x1205178849bd0ULL, 0x049b1ac05c149ULL, 0x017b2423d1409ULL, 0x12507406b1b24ULL },
+    { 0x12073a114406dULL, 0x015821f2508c5ULL, 0x16c04510b9c09ULL, 0x1462149f08350ULL },
+    { 0x1269f2ba704b4ULL, 0x1a980d9cf48f8ULL, 0x05a41cba9f2c9ULL, 0x03e25e736032bULL },
+    { 0x12549a5d5c494ULL, 0x198e0df455444ULL, 0x05247574b2549ULL, 0x0445545f60e33ULL },
+    { 0x12368e01314b9ULL, 0x08c834ee051e4ULL, 0x13a51900e2d89ULL, 0x04f140ee58262ULL },
+    { 0x127bc33b653b7ULL, 0x1fd9ab98b51f4ULL, 0x1db94db987bc9ULL, 0x05f15a33ab37fULL },
+    { 0x123cb2caeecb8ULL, 0x0b8a08ceddeeaULL, 0x03a6eea69a789ULL, 0x0aef76e620a3aULL },
+    { 0x125d921b47f0eULL, 0x1b198bd6d9146ULL, 0x0e1fc5b093749ULL, 0x0c5136d7a331bULL },
+    { 0x125f8e1519360ULL, 0x181f36f0811c5ULL, 0x00d93150e3f49ULL, 0x1471021ed9f03ULL },
+    { 0x12a335510d53dULL, 0x0573319644de4ULL, 0x17956115598a9ULL, 0x04f644d3199d4ULL },
+    { 0x128a4536e82feULL, 0x06a6b39ab42d1ULL, 0x0fe82ed944a29ULL, 0x11685ab39acacULL },
+    { 0x128ae76b8884dULL, 0x0e6a3982a8e55ULL, 0x164223adcea29ULL, 0x154e2a8338aceULL },
+    { 0x12ea40bf35028ULL, 0x13242c9aa01fcULL, 0x028159fa04ae9ULL, 0x07f00ab268499ULL },
+    { 0x12d39f67b1f41ULL, 0x1e7d36ac69745ULL, 0x105f1bcdf3969ULL, 0x145d2c6ad97cfULL },
+    { 0x12f46de348b21ULL, 0x166312e039cfcULL, 0x109a258f6c5e9ULL, 0x07e7380e918cdULL },
+    { 0x12f55cbcbd8c4ULL, 0x11b61df869379ULL, 0x04637a7a755e9ULL, 0x13d92c3f70db1ULL },
+    { 0x12fcb5476e2b1ULL, 0x1fe612c8d5ce6ULL, 0x11a8edc55a7e9ULL, 0x0ce7562690cffULL },
+    { 0x134406304d325ULL, 0x114b53d0301c0ULL, 0x14996418c0459ULL, 0x0070181795a51ULL },
+    { 0x1328a70967a6bULL, 0x0d48da8a989e7ULL, 0x1acbcd21ca299ULL, 0x1cf232a2b6256ULL },
+    { 0x13563d91fa0dfULL, 0x14c2f5fa55a4fULL, 0x1f60bf1378d59ULL, 0x1e4b54bf5e865ULL },
+    { 0x135ab2f647ed9ULL, 0x1bcc6296fdd4bULL, 0x136fc4de9ab59ULL, 0x1a577ed28c67bULL },
+    { 0x133f2269ef3ccULL, 0x019b6bcab1f67ULL, 0x0679ef2c89f99ULL, 0x1cdf1aa7adb30ULL },
+    { 0x13c31d0017ed5ULL, 0x15f077a44c143ULL, 0x156fd00171879ULL, 0x1850644bdc1f5ULL },
+    { 0x13e90bb463a51ULL, 0x147c42b8bc16bULL, 0x114b8c5ba12f9ULL, 0x1ad07a3a847c5ULL },
+    { 0x13ea82b1d1318ULL, 0x18296692b436cULL, 0x0319171a82af9ULL, 0x06d85a92cd283ULL },
+    { 0x13ad536a4729dULL, 0x07f84bc2f4572ULL, 0x1729c4ad956b9ULL, 0x09d45e87a43fcULL },
+    { 0x13cdf38153eecULL, 0x1cb847c6d89dfULL, 0x06ef95039f679ULL, 0x1f7236c7c43a7ULL },
+    { 0x14012c80ab6b6ULL, 0x0092932d04bcaULL, 0x0dadaa0269005ULL, 0x0a7a416992920ULL },
+    { 0x14479b7f86d64ULL, 0x1f1d2975686c7ULL, 0x04d6c3fdb3c45ULL, 0x1c6c2d5d2971fULL },
+    { 0x146b7eeedef1eULL, 0x131fbf27fce7aULL, 0x0f1ef6eefdac5ULL, 0x0bce7fc9fbf19ULL },
+    { 0x1453ae6250876ULL, 0x1a18b5213dcc1ULL, 0x0dc2148ceb945ULL, 0x106779095a30bULL },
+    { 0x1419c1552e8aeULL, 0x0d96811b894d6ULL, 0x0ea2e95507305ULL, 0x0d6523b102d36ULL },
+    { 0x141b9584c5767ULL, 0x0d55b305d13c9ULL, 0x1cdd464353b05ULL, 0x127917419b556ULL },
+    { 0x145eaece8d457ULL, 0x1b4eb96585f49ULL, 0x1d4562e6eaf45ULL, 0x125f434d3ae5bULL },
+    { 0x14c5faddd3f1dULL, 0x187d0f775cf5eULL, 0x171f9776bf465ULL, 0x0f5e75dde17c3ULL },
+    { 0x14a70e9f0c0e7ULL, 0x03feb971000edULL, 0x1ce061f2e1ca5ULL, 0x16e0011d3aff8ULL },
+    { 0x148bc8f1bce94ULL, 0x09b2273dac65cULL, 0x052e7b1e27a25ULL, 0x074c6b79c89b2ULL },
+    { 0x14ebaaef860e9ULL, 0x1bfc2823a0eefULL, 0x12e0c3eeabae5ULL, 0x1eee0b88287fbULL },
+    { 0x14ce52a448b0cULL, 0x102f2343f8058ULL, 0x061a244a94e65ULL, 0x03403f8589e81ULL },
+    { 0x14b06d0a428b4ULL, 0x06a019211d8f2ULL, 0x05a284a16c1a5ULL, 0x09e37109300acULL },
+    { 0x14936a9278406ULL, 0x023aa53d11858ULL, 0x0c043c92ad925ULL, 0x034311794ab88ULL },
+    { 0x14d7a5507aa1cULL, 0x1c32375b1dc42ULL, 0x070abc154bd65ULL, 0x084771b5d8987ULL },
+    { 0x1520eb20bf6faULL, 0x0d8ac62f24bf3ULL, 0x0bedfa09ae095ULL, 0x19fa49e8c6a36ULL },
+    { 0x1522bb3344bd7ULL, 0x0fc9e3317c865ULL, 0x1d7a4599ba895ULL, 0x14c27d198f27eULL },
+    { 0x1564524e06404ULL, 0x130c494540472ULL, 0x0404c0e4944d5ULL, 0x09c4054524619ULL },
+    { 0x1526fc94c43ebULL, 0x09c5f27350af9ULL, 0x1af846527ec95ULL, 0x13ea159c9f472ULL },
+    { 0x154e57aa294f6ULL, 0x168af94de41d9ULL, 0x0de528abd4e55ULL, 0x13704f653ea2dULL },
+    { 0x151138ed7e012ULL, 0x0116cc2975c4eULL, 0x0900fd6e39115ULL, 0x0e475d2866d10ULL },
+    { 0x155ab56dd07a9ULL, 0x1cc57e07f1ec4ULL, 0x12bc176d5ab55ULL, 0x046f1fc0fd467ULL },
+    { 0x151a7916b7d5eULL, 0x0705e53fcdb53ULL, 0x0f57dad13cb15ULL, 0x195b67f94f41cULL },
+    { 0x15c28266d4f48ULL, 0x1b2d660738641ULL, 0x025e56cc82875ULL, 0x104c39c0cd69bULL },
+    { 0x15ac90ff2e1b9ULL, 0x0be7485be44eeULL, 0x13b0e9fe126b5ULL, 0x0ee44fb425cfaULL },
+    { 0x15ef299b3d5a3ULL, 0x17f3ec7d809ecULL, 0x18b579b329ef5ULL, 0x06f2037c6f9fdULL },
+    { 0x15b353b7001fdULL, 0x06fd6113650fdULL, 0x17f001db959b5ULL, 0x17e14d910d7ecULL },
+    { 0x15f3911ebaaa4ULL, 0x1eb66f19492e2ULL, 0x04aabaf1139f5ULL, 0x08e92531ecdafULL },
+    { 0x15b9fdc9ed846ULL, 0x0d32d929d9f7dULL, 0x0c436f277f3b5ULL, 0x17df372936996ULL },
+    { 0x15bef47ce747bULL, 0x0964f85ff5ff3ULL, 0x1bc5ce7c5efb5ULL, 0x19ff5ff43e4d2ULL },
+    { 0x16483f9ae3f76ULL, 0x16099bbddcbcbULL, 0x0ddf8eb3f824dULL, 0x1a7a777bb320dULL },
+    { 0x16685b0f1b3e3ULL, 0x16cf8ea1c01f7ULL, 0x18f9b1e1b42cdULL, 0x1df0070ae3e6dULL },
+    { 0x164c2a3c51ac6ULL, 0x108c8ff1b8941ULL, 0x0c6b1478a864dULL, 0x10523b1fe2621ULL },
+    { 0x166c75b847815ULL, 0x154019d1fc97aULL, 0x1503c43b5c6cdULL, 0x0bd27f1730055ULL },
+    { 0x166f51e9cdf7bULL, 0x1553aac7fc7fdULL, 0x1bdf672f15ecdULL, 0x17fc7fc6ab955ULL },
+    { 0x161621bb59613ULL, 0x0642aed53594cULL, 0x190d35bb08d0dULL, 0x06535956ea84cULL },
+    { 0x16177d70a9f6eULL, 0x0413b3ff69fd1ULL, 0x0edf2a1d7dd0dULL, 0x117f2dff9b904ULL },
+    { 0x163865d609e04ULL, 0x0606139589d78ULL, 0x040f20d74c38dULL, 0x03d7235390c0cULL },
+    { 0x1639544f58d9cULL, 0x02971d87dd474ULL, 0x073635e45538dULL, 0x05c577c371d28ULL },
+    { 0x168ee5e9257eaULL, 0x0da1bacfa0dddULL, 0x0afd492f4ee2dULL, 0x17760be6bb0b6ULL },
+    { 0x16b5c9a4eb307ULL, 0x0c7783e93137aULL, 0x1c19ae4b275adULL, 0x0bd9192f83dc6ULL },
+    { 0x16fa59b1d9db6ULL, 0x14a3a5b5fd3fcULL, 0x0db7371b34bedULL, 0x07f97f5b4b8a5ULL },
+    { 0x16dd738bad12eULL, 0x173b89cbc1bdcULL, 0x0e916ba39d76dULL, 0x077b07a723b9dULL },
+    { 0x169e8cfe69caeULL, 0x0aa6b9ffb95c8ULL, 0x0ea72cfe62f2dULL, 0x02753bff3acaaULL },
+    { 0x1701fa9bc620fULL, 0x0b58cbb350a5eULL, 0x1e08c7b2bf01dULL, 0x0f4a159ba635aULL },
+    { 0x17072fc830004ULL, 0x04187de900c48ULL, 0x04001827e9c1dULL, 0x0246012f7c304ULL },
+    { 0x17071076dd37cULL, 0x031767d3747c1ULL, 0x07d976dc11c1dULL, 0x107c5d97cdd18ULL },
+    { 0x170d80d5851d0ULL, 0x099540d18474dULL, 0x017143560361dULL, 0x165c431605532ULL },
+    { 0x173116f34fd81ULL, 0x03db50957956eULL, 0x1037e59ed119dULL, 0x0ed53d5215b78ULL },
+    { 0x171394b6e799cULL, 0x0b95719b7d34aULL, 0x0733ceda5391dULL, 0x0a597db31d53aULL },
+    { 0x1759f074fca39ULL, 0x1956469bfded0ULL, 0x138a7e5c1f35dULL, 0x016f7fb2c4d53ULL },
+    { 0x171ce2326b159ULL, 0x0a4b40dbb5953ULL, 0x1351ac988e71dULL, 0x19535bb605a4aULL },
+    { 0x17ae4e8c81b9dULL, 0x00ed7be38c378ULL, 0x173b0262e4ebdULL, 0x03d8638fbd6e0ULL },
+    { 0x178fb0c729775ULL, 0x0a7763cdc4dcdULL, 0x15dd29c61be3dULL, 0x167647678ddcaULL },
+    { 0x1863c935e0353ULL, 0x1c55a23836275ULL, 0x19580f59278c3ULL, 0x15c8d8388b547ULL },
+    { 0x1805cb7de52beULL, 0x0d9c8b7a367d4ULL, 0x0fa94f7da7403ULL, 0x057cd8bda2736ULL },
+    { 0x1829de41e44f3ULL, 0x09d8902cd66f5ULL, 0x19e44f04f7283ULL, 0x15ecd66812372ULL },
+    { 0x1830290d9348dULL, 0x04c40d2603b66ULL, 0x1625936128183ULL, 0x0cdb80c960464ULL },
+    { 0x1833363db9b7fULL, 0x005fbf1a6fbe5ULL, 0x1fdb3b78d9983ULL, 0x14fbecb1fbf40ULL },
+    { 0x18325624c27bfULL, 0x00cdb306772f2ULL, 0x1fbc8648d4983ULL, 0x09e9dcc19b660ULL },
+    { 0x1876faa71a467ULL, 0x1a4ea564638ffULL, 0x1cc4b1cabedc3ULL, 0x1fe38c4d4ae4bULL },
+    { 0x183ae3379d703ULL, 0x0f4fa614a3b74ULL, 0x181d73d98eb83ULL, 0x05db8a50cbe5eULL },
+    { 0x183ec869d75d1ULL, 0x09c12c64b7777ULL, 0x1175d72c26f83ULL, 0x1dddda4c69072ULL },
+    { 0x18871220e46d9ULL, 0x01f8224e76241ULL, 0x136c4e0891c23ULL, 0x1048dce4883f0ULL },
+    { 0x18c9a95c79b6eULL, 0x1c378f3a9adc1ULL, 0x0edb3c752b263ULL, 0x1076b2b9e3d87ULL },
+    { 0x18ea759ecbe97ULL, 0x16e6bb14deb7aULL, 0x1d2fa6f35cae3ULL, 0x0bdaf651bacedULL },
+    { 0x18afc94e20496ULL, 0x0eb4a96c86470ULL, 0x0d2408e527ea3ULL, 0x01c4c26d2a5aeULL },
+    { 0x18ce9b301158fULL, 0x1ce9a576e2140ULL, 0x1e351019b2e63ULL, 0x00508edd4b2e7ULL },
+    { 0x18b11305fcd95ULL, 0x05ff050c5f264ULL, 0x15367f41911a3ULL, 0x04c9f46141ff4ULL },
+    { 0x18b5c4e106abdULL, 0x09f013422f4feULL, 0x17aac10e475a3ULL, 0x0fe5e885901f2ULL },
+    { 0x18f78cff17643ULL, 0x1b74be742356fULL, 0x184dd1fe63de3ULL, 0x1ed5885cfa5dbULL },
+    { 0x1897d1949e6c6ULL, 0x0db6a7544325bULL, 0x0c6cf25317d23ULL, 0x1b498455cadb6ULL },
+    { 0x1961e48e4a46aULL, 0x1a16d806128fbULL, 0x0ac4a4e24f0d3ULL, 0x1be290c036d0bULL },
+    { 0x19290b2dede4fULL, 0x055ecb2eba365ULL, 0x1e4f6f69a1293ULL, 0x14d8bae9a6f54ULL },
+    { 0x190aa1e814302ULL, 0x0d01ee00a2c48ULL, 0x0818502f0aa13ULL, 0x02468a00ef016ULL },
+    { 0x196b517bead52ULL, 0x1613e81cfe677ULL, 0x0956afbd15ad3ULL, 0x1dccfe702f90dULL },
+    { 0x190e6315fac20ULL, 0x040e645c9aad6ULL, 0x0086bf518ce13ULL, 0x0d6ab2744ce04ULL },
+    { 0x1933f3cbe7070ULL, 0x0f18680857fffULL, 0x01c1cfa79f993ULL, 0x1fffd4202c31eULL },
+    { 0x1957e665863e0ULL, 0x199d724023ed7ULL, 0x00f8c34ccfd53ULL, 0x1d6f88049d733ULL },
+    { 0x193d36a0fbaa8ULL, 0x009a564afbbeaULL, 0x02abbe0ad9793ULL, 0x0afbbea4d4b20ULL },
+    { 0x197e03c772502ULL, 0x160de44c9346eULL, 0x08149dc780fd3ULL, 0x0ec592644f60dULL },
+    { 0x198049103b214ULL, 0x0422473806152ULL, 0x0509b81124033ULL, 0x0950c039c4884ULL },
+    { 0x19c589cf85a07ULL, 0x1f74cb600a74cULL, 0x1c0b43e723473ULL, 0x065ca00da65dfULL },
+    { 0x19b0766833399ULL, 0x00e95e0a67d72ULL, 0x1339982cdc1b3ULL, 0x09d7cca0f52e0ULL },
+    { 0x19d01573bb623ULL, 0x1662d61c637c6ULL, 0x188dbb9d50173ULL, 0x0c7d8c70d68cdULL },
+    { 0x1996e8dd4961dULL, 0x08666b7617d5cULL, 0x170d25762ed33ULL, 0x0757d0ddaccc2ULL },
+    { 0x19fc846e380f7ULL, 0x1ae6dd48a74e1ULL, 0x1de038ec427f3ULL, 0x10e5ca2576cebULL },
+    { 0x19bec77297957ULL, 0x0f69f550af773ULL, 0x1d53d29dc6fb3ULL, 0x19ddea155f2deULL },
+    { 0x1a62f2b748bbdULL, 0x1acf23927e8fcULL, 0x17ba25da9e8cbULL, 0x07e2fc9389e6bULL },
+    { 0x1a07444d2a166ULL, 0x0017b9c8024d7ULL, 0x0cd0a96445c0bULL, 0x1d6480273bd00ULL },
+    { 0x1a66d2db60449ULL, 0x1a4828de5247dULL, 0x12440db696ccbULL, 0x17c494f62824bULL },
+    { 0x1a4adc1bb2236ULL, 0x1a00bfb8c62d6ULL, 0x0d889bb076a4bULL, 0x0d68c63bfa00bULL },
+    { 0x1a57955c80702ULL, 0x1c15bad443640ULL, 0x081c027553d4bULL, 0x004d8456bb507ULL },
+    { 0x1a789dca1f34cULL, 0x1f031fa2c356bULL, 0x0659f0a7723cbULL, 0x1ad5868bf181fULL },
+    { 0x1a7c80ff80bc5ULL, 0x1ac50bd0ab66dULL, 0x147a03fe027cbULL, 0x16cdaa17a146bULL },
+    { 0x1a7f8394f7e04ULL, 0x1d1c27dc9b36aULL, 0x040fde5383fcbULL, 0x0ad9b277c8717ULL },
+    { 0x1ae894f5159beULL, 0x19a59592ee5ecULL, 0x0fb3515e522ebULL, 0x06f4ee93534b3ULL },
+    { 0x1ad3fe888b2a6ULL, 0x18babba043bdaULL, 0x0ca9a222ff96bULL, 0x0b7b840bbaba3ULL },
+    { 0x1a95f27cd8288ULL, 0x08be0ed273e50ULL, 0x0228367c9f52bULL, 0x014f9c96e0fa2ULL },
+    { 0x1b224cd161fa5ULL, 0x00c173bc1a5fcULL, 0x14bf0d166489bULL, 0x07f4b07b9d060ULL },
+    { 0x1b0a2b05bc17dULL, 0x054f65aa86ac5ULL, 0x17d07b41a8a1bULL, 0x146ac2ab4de54ULL },
+    { 0x1b0c6cce703caULL, 0x0285deea92c59ULL, 0x0a781ce66c61bULL, 0x134692aef7428ULL },
+    { 0x1b6d8b0e1099dULL, 0x1edd4de28e060ULL, 0x173210e1a36dbULL, 0x00c0e28f6576fULL },
+    { 0x1b2c73679ffa6ULL, 0x078fc7c4eaff6ULL, 0x0cbff3cd9c69bULL, 0x0dfeae47c7e3cULL },
+    { 0x1b114c5ca8fe8ULL, 0x00975abe0b6d1ULL, 0x02fe2a746511bULL, 0x116da0fab5d20ULL },
+    { 0x1b333a4c7aafdULL, 0x00de6faa5fce3ULL, 0x17eabc64b999bULL, 0x18e7f4abecf60ULL },
+    { 0x1b3445123c1a2ULL, 0x0783d4d8030f0ULL, 0x08b078914459bULL, 0x01e180365783cULL },
+    { 0x1b7e86534839aULL, 0x1a8bf2d297464ULL, 0x0b382594c2fdbULL, 0x04c5d2969fa2bULL },
+    { 0x1b83ad6c17bdaULL, 0x0db5fea22ed43ULL, 0x0b7bd06d6b83bULL, 0x1856e88aff5b6ULL },
+    { 0x1bc35b2cf8adaULL, 0x14beeeaa7e251ULL, 0x0b6a3e69b587bULL, 0x1148fcaaeefa5ULL },
+    { 0x1bae543adad99ULL, 0x02e37cd6fe272ULL, 0x1336b6b854ebbULL, 0x09c8fed67d8e8ULL },
+    { 0x1bae9aab7db91ULL, 0x0beb6ee8fe16cULL, 0x113b7daab2ebbULL, 0x06d0fe2eedafaULL },
+    { 0x1bb0c35420827ULL, 0x0c6cc1980b4f0ULL, 0x1c820855861bbULL, 0x01e5a033066c6ULL },
+    { 0x1bf5e360b6b7bULL, 0x1d79c6ca2fef3ULL, 0x1bdada0d8f5fbULL, 0x19efe8a6c73d7ULL },
+    { 0x1bd61dbad982dULL, 0x16627df27b3c8ULL, 0x168336bb70d7bULL, 0x0279bc9f7c8cdULL },
+    { 0x1bfcc1484bbe2ULL, 0x1ca3cac09b5f3ULL, 0x08fba425067fbULL, 0x19f5b206a78a7ULL },
+    { 0x1bbf6b0a3e71eULL, 0x073befee87872ULL, 0x0f1cf8a1adfbbULL, 0x09c3c2efefb9cULL },
+    { 0x1c62c888b1940ULL, 0x18012c290a379ULL, 0x00531a22268c7ULL, 0x13d8a12869003ULL },
+    { 0x1c43556c7f02bULL, 0x1556bc0b725d2ULL, 0x1a81fc6d55847ULL, 0x09749da07ad55ULL },
+    { 0x1c4b5512021bbULL, 0x16d1b013c60d2ULL, 0x1bb0809155a47ULL, 0x0960c7901b16dULL },
+    { 0x1c0fd8dc0d4edULL, 0x09d62977c25d9ULL, 0x16e5607637e07ULL, 0x137487dd28d72ULL },
+    { 0x1c2eb98d7cd24ULL, 0x0d072d6dda8ecULL, 0x04967d633ae87ULL, 0x06e2b76d69c16ULL },
+    { 0x1c1bbce7d72d4ULL, 0x0b943721f7f4fULL, 0x0569d7ce7bb07ULL, 0x1e5fdf09d853aULL },
+    { 0x1ce34b27a5688ULL, 0x17bc222f22374ULL, 0x022d4bc9a58e7ULL, 0x05d889e8887bdULL },
+    { 0x1cc7b749c422eULL, 0x1d38bb4352ec4ULL, 0x0e884725dbc67ULL, 0x046e9585ba397ULL },
+    { 0x1cea0dcd7e2deULL, 0x15a6bf2b9646fULL, 0x0f68fd6760ae7ULL, 0x1ec4d3a9facb5ULL },
+    { 0x1caa7a8907766ULL, 0x0129ab25c29ffULL, 0x0cddc122bcaa7ULL, 0x1ff28749ab290ULL },
+    { 0x1c8f013621f4dULL, 0x0675235faa141ULL, 0x165f08d901e27ULL, 0x1050abf5895ccULL },
+    { 0x1caf543737495ULL, 0x03f4355de6176ULL, 0x1525d9d855ea7ULL, 0x0dd0cf75585f8ULL },
+    { 0x1cef96924b15dULL, 0x1a7b3153d616bULL, 0x1751a492d3ee7ULL, 0x1ad0d79519bcbULL },
+    { 0x1cd49ebe10885ULL, 0x1aec1d716b048ULL, 0x142210faf2567ULL, 0x0241ad1d706ebULL },
+    { 0x1cbaa54ed1c33ULL, 0x0e64bc059ffe0ULL, 0x198716e54aba7ULL, 0x00fff3407a4ceULL },
+    { 0x1cfaf95a5c8f7ULL, 0x1fe2ad31dfcf1ULL, 0x1de274b53ebe7ULL, 0x11e7f7196a8ffULL },
+    { 0x1c9deb3a7de7bULL, 0x0f7a8e7fbf9d1ULL, 0x1bcf7cb9af727ULL, 0x1173fbfce2bdeULL },
+    { 0x1d637c9df1d9aULL, 0x1095fc3f5eb7cULL, 0x0b371f727d8d7ULL, 0x07daf5f87f521ULL },
+    { 0x1d2641208ab03ULL, 0x0443e2412a272ULL, 0x181aa20904c97ULL, 0x09c8a9048f844ULL },
+    { 0x1d669fdb35875ULL, 0x1f487d794e5edULL, 0x15c359b7f2cd7ULL, 0x16f4e53d7c25fULL },
+    { 0x1d49c27ea9c3cULL, 0x1a1e491fae7d0ULL, 0x07872afc87257ULL, 0x017cebf124f0bULL },
+    { 0x1d360ce400dfcULL, 0x008571672f4e9ULL, 0x07f6004e60d97ULL, 0x12e5e9cd1d420ULL },
+    { 0x1d5ab62a0db7eULL, 0x1b0bfb03ef9c1ULL, 0x0fdb60a8dab57ULL, 0x1073ef81bfa1bULL },
+    { 0x1de15430c6d5cULL, 0x113151177e273ULL, 0x0756c618550f7ULL, 0x19c8fdd115191ULL },
+    { 0x1da6dde1e4fddULL, 0x0de1736f7e67dULL, 0x177e4f0f76cb7ULL, 0x17ccfded9d0f6ULL },
+    { 0x1da95043a43aaULL, 0x03b1c20bc26f4ULL, 0x0ab84b84152b7ULL, 0x05ec87a0871b8ULL },
+    { 0x1d8c17adb180cULL, 0x042c5d4bea34cULL, 0x06031b6bd0637ULL, 0x0658afa574684ULL },
+    { 0x1df0594c9f88eULL, 0x15a6cd234b772ULL, 0x0e23f265341f7ULL, 0x09dda58966cb5ULL },
+    { 0x1dd42ff7b2eb8ULL, 0x16ac567f2feceULL, 0x03ae9bdfe8577ULL, 0x0e6fe9fcd46adULL },
+    { 0x1dda33112a5cbULL, 0x14ebe01fc3847ULL, 0x1a74a91198b77ULL, 0x1c4387f00fae5ULL },
+    { 0x1e212abd20915ULL, 0x005d09b92e86cULL, 0x1512097aa908fULL, 0x06c2e93b21740ULL },
+    { 0x1e655156418d1ULL, 0x16d400d15e571ULL, 0x116304d5154cfULL, 0x11d4f5160056dULL },
+    { 0x1e68f2902c803ULL, 0x194a8099ca878ULL, 0x180268129e2cfULL, 0x03c2a73202a53ULL },
+    { 0x1e7109e4b0853ULL, 0x145484a92f669ULL, 0x19421a4f211cfULL, 0x12cde92a42545ULL },
+    { 0x1e1443e0cfc9bULL, 0x05ca80c73f75aULL, 0x1b27e60f8450fULL, 0x0b5df9c602a74ULL },
+    { 0x1e75417ff4b9aULL, 0x17958edb3f674ULL, 0x0b3a5ffd055cfULL, 0x05cdf9b6e353dULL },
+    { 0x1e15ef8f31dc8ULL, 0x0e9d1cef0b95dULL, 0x027719e3ef50fULL, 0x1753a1ee7172eULL },
+    { 0x1e1b221a9943fULL, 0x025aad9787bc0ULL, 0x1f8532b089b0fULL, 0x007bc3d36ab48ULL },
+    { 0x1ea976764abebULL, 0x02ff9293facf3ULL, 0x1afaa4dcdd2afULL, 0x19e6bf9293fe8ULL },
+    { 0x1eca2c05235d5ULL, 0x10e531ad86947ULL, 0x1575894068a6fULL, 0x1c52c36b194e1ULL },
+    { 0x1eceaa523b373ULL, 0x1a6ba6f986dc3ULL, 0x19d9b894aae6fULL, 0x1876c33ecbacbULL },
+    { 0x1eae58d5b8082ULL, 0x00a6a4f9c267cULL, 0x08203b5634eafULL, 0x07cc873e4aca0ULL },
+    { 0x1eef9a4abc68cULL, 0x1bba2fefc2660ULL, 0x062c7aa4b3eefULL, 0x00cc87efe8bbbULL },
+    { 0x1ed089c3f5638ULL, 0x1f2006af177ccULL, 0x038d5f872216fULL, 0x067dd1eac009fULL },
+    { 0x1f07b10734a03ULL, 0x0f54e6c94a844ULL, 0x180a59c11bc1fULL, 0x0442a526ce55eULL },
+    { 0x1f66d87bfb9afULL, 0x1ac3edfb7a7f6ULL, 0x1eb3bfbc36cdfULL, 0x0dfcbdbf6f86bULL },
+    { 0x1f09958069829ULL, 0x0c52508bda1c8ULL, 0x12832c035321fULL, 0x0270b7a214946ULL },
+    { 0x1f741a173a697ULL, 0x12cec7fd47066ULL, 0x1d2cb9d0b05dfULL, 0x0cc1c57fc6e69ULL },
+    { 0x1f5870998fa6dULL, 0x11424b93cbbdfULL, 0x16cbe3321c35fULL, 0x1f7ba793a4851ULL },
+    { 0x1f3ce7a783cc3ULL, 0x0eccd0c5abb7fULL, 0x186783cbce79fULL, 0x1fdbab461666eULL },
+    { 0x1f1feb0ca0cefULL, 0x0cdce9ef8bad1ULL, 0x1ee60a61aff1fULL, 0x116ba3ef2e766ULL },
+    { 0x1fa17b6aac871ULL, 0x077a48a96eef1ULL, 0x11c26aadbd0bfULL, 0x11eeed2a24bdcULL },
+    { 0x1fa2d5dc9ca7dULL, 0x0d667f934e6f9ULL, 0x17ca7277568bfULL, 0x13ece593fccd6ULL },
+    { 0x1fc9346f18468ULL, 0x12365c87e2cc5ULL, 0x02c431ec5927fULL, 0x14668fc274d89ULL },
+    { 0x1fb09c58cd751ULL, 0x09635ab557761ULL, 0x115d6634721bfULL, 0x10ddd55ab58d2ULL },
+    { 0x1f92a9f29cd9eULL, 0x0fa3e5b72fe48ULL, 0x0f36729f2a93fULL, 0x024fe9db4f8beULL },
+    { 0x1fd4a46b06149ULL, 0x1b6158c323c47ULL, 0x1250c1ac4a57fULL, 0x1c478986350dbULL },
+    { 0x1fd51b3ff60ecULL, 0x17bc4dfb732c7ULL, 0x06e0dff9b157fULL, 0x1c699dbf647bdULL },
+    { 0x1ff870fff45f9ULL, 0x13e54c9ff7efdULL, 0x13f45ffe1c3ffULL, 0x17efdff2654f9ULL },
+    { 0x0bee4f9e223f0ULL, 0x16ad7af8860bbULL, 0x01f888f3e4efaULL, 0x1ba0c23ebd6adULL },
+    { 0x10ea27f487b7dULL, 0x156d3312acfebULL, 0x17dbc25fc8ae1ULL, 0x1afe6a91996d5ULL },
+    { 0x18d269a6a3f7aULL, 0x1625a22e2fbdbULL, 0x0bdf8acb2c963ULL, 0x1b7be8e88b48dULL },
+    { 0x1cfcd2dc40d3fULL, 0x186d8957df4f8ULL, 0x1f960476967e7ULL, 0x03e5f7d5236c3ULL },
+};
 
-static unsigned char DICT_7X7_1000_BYTES[][4][7] =
-    { { { 221, 92, 108, 165, 202, 10, 1 },
-        { 99, 179, 173, 228, 49, 180, 0 },
-        { 168, 41, 210, 155, 29, 93, 1 },
-        { 22, 198, 19, 218, 230, 227, 0 }, },
-      { { 228, 27, 241, 62, 64, 171, 0 },
-        { 17, 253, 137, 11, 181, 42, 1 },
-        { 106, 129, 62, 71, 236, 19, 1 },
-        { 170, 86, 232, 72, 223, 196, 0 }, },
-      { { 158, 170, 43, 172, 93, 39, 1 },
-        { 163, 182, 158, 145, 75, 171, 1 },
-        { 242, 93, 26, 234, 42, 188, 1 },
-        { 234, 233, 68, 188, 182, 226, 1 }, },
-      { { 166, 103, 5, 183, 233, 76, 0 },
-        { 221, 48, 50, 221, 165, 172, 0 },
-        { 25, 75, 246, 208, 115, 50, 1 },
-        { 26, 210, 221, 166, 6, 93, 1 }, },
-      { { 198, 188, 123, 19, 50, 86, 0 },
-        { 253, 193, 139, 113, 154, 97, 0 },
-        { 53, 38, 100, 111, 30, 177, 1 },
-        { 67, 44, 199, 104, 193, 223, 1 }, },
-      { { 88, 128, 20, 35, 89, 238, 0 },
-        { 4, 122, 28, 80, 184, 133, 1 },
-        { 59, 205, 98, 20, 0, 141, 0 },
-        { 208, 142, 133, 28, 47, 16, 0 }, },
-      { { 211, 107, 190, 111, 84, 72, 0 },
-        { 164, 240, 198, 70, 247, 63, 0 },
-        { 9, 21, 123, 62, 235, 101, 1 },
-        { 126, 119, 177, 49, 135, 146, 1 }, },
-      { { 60, 161, 109, 136, 139, 219, 0 },
-        { 37, 14, 191, 169, 44, 198, 0 },
-        { 109, 232, 136, 219, 66, 158, 0 },
-        { 49, 154, 74, 254, 184, 82, 0 }, },
-      { { 137, 7, 31, 86, 150, 158, 0 },
-        { 112, 74, 104, 49, 231, 125, 0 },
-        { 60, 180, 181, 124, 112, 72, 1 },
-        { 95, 115, 198, 11, 41, 7, 0 }, },
-      { { 187, 101, 177, 141, 110, 63, 0 },
-        { 200, 86, 142, 255, 101, 242, 1 },
-        { 126, 59, 88, 198, 211, 110, 1 },
-        { 167, 211, 127, 184, 181, 9, 1 }, },
-      { { 245, 0, 209, 130, 244, 144, 1 },
-        { 11, 88, 37, 139, 208, 113, 0 },
-        { 132, 151, 160, 197, 128, 87, 1 },
-        { 71, 5, 232, 210, 13, 104, 0 }, },
-      { { 2, 38, 112, 184, 84, 26, 0 },
-        { 208, 112, 139, 128, 96, 75, 0 },
-        { 44, 21, 14, 135, 50, 32, 0 },
-        { 105, 3, 0, 232, 135, 5, 1 }, },
-      { { 84, 243, 107, 151, 72, 240, 1 },
-        { 55, 25, 135, 197, 159, 200, 1 },
-        { 135, 137, 116, 235, 103, 149, 0 },
-        { 137, 252, 209, 240, 204, 118, 0 }, },
-      { { 158, 36, 136, 70, 35, 153, 1 },
-        { 235, 14, 86, 34, 161, 96, 0 },
-        { 204, 226, 49, 8, 146, 60, 1 },
-        { 3, 66, 162, 53, 56, 107, 1 }, },
-      { { 189, 255, 50, 107, 201, 203, 1 },
-        { 71, 255, 254, 76, 174, 186, 0 },
-        { 233, 201, 235, 38, 127, 222, 1 },
-        { 46, 186, 153, 63, 255, 241, 0 }, },
-      { { 206, 17, 5, 176, 90, 151, 1 },
-        { 147, 63, 8, 177, 20, 229, 0 },
-        { 244, 173, 6, 208, 68, 57, 1 },
-        { 83, 148, 70, 136, 126, 100, 1 }, },
-      { { 211, 240, 97, 114, 31, 139, 0 },
-        { 144, 45, 223, 37, 248, 177, 0 },
-        { 104, 252, 39, 67, 7, 229, 1 },
-        { 70, 143, 210, 125, 218, 4, 1 }, },
-      { { 1, 225, 158, 206, 200, 237, 1 },
-        { 38, 92, 98, 150, 175, 150, 1 },
-        { 219, 137, 185, 188, 195, 192, 0 },
-        { 180, 250, 180, 163, 29, 50, 0 }, },
-      { { 38, 203, 204, 42, 112, 120, 1 },
-        { 175, 176, 1, 14, 172, 79, 1 },
-        { 143, 7, 42, 25, 233, 178, 0 },
-        { 249, 26, 184, 64, 6, 250, 1 }, },
-      { { 56, 125, 77, 118, 65, 19, 0 },
-        { 112, 183, 95, 13, 133, 68, 0 },
-        { 100, 65, 55, 89, 95, 14, 0 },
-        { 17, 80, 216, 125, 118, 135, 0 }, },
-      { { 58, 144, 74, 233, 225, 233, 1 },
-        { 174, 63, 117, 200, 42, 2, 1 },
-        { 203, 195, 203, 169, 4, 174, 0 },
-        { 160, 42, 9, 215, 126, 58, 1 }, },
-      { { 70, 212, 132, 123, 60, 221, 0 },
-        { 221, 45, 64, 86, 248, 199, 0 },
-        { 93, 158, 111, 16, 149, 177, 0 },
-        { 113, 143, 181, 1, 90, 93, 1 }, },
-      { { 72, 146, 167, 222, 158, 43, 1 },
-        { 18, 7, 232, 163, 251, 143, 1 },
-        { 234, 60, 189, 242, 164, 137, 0 },
-        { 248, 239, 226, 139, 240, 36, 0 }, },
-      { { 94, 118, 195, 228, 152, 168, 0 },
-        { 193, 43, 103, 135, 51, 137, 1 },
-        { 10, 140, 147, 225, 183, 61, 0 },
-        { 200, 230, 112, 243, 106, 65, 1 }, },
-      { { 116, 162, 222, 250, 47, 136, 1 },
-        { 59, 104, 87, 170, 250, 142, 0 },
-        { 136, 250, 47, 189, 162, 151, 0 },
-        { 56, 175, 170, 245, 11, 110, 0 }, },
-      { { 148, 93, 226, 40, 19, 89, 0 },
-        { 69, 165, 149, 38, 38, 99, 0 },
-        { 77, 100, 10, 35, 221, 20, 1 },
-        { 99, 50, 50, 84, 210, 209, 0 }, },
-      { { 155, 18, 149, 100, 237, 163, 1 },
-        { 138, 127, 124, 3, 65, 188, 1 },
-        { 226, 219, 147, 84, 164, 108, 1 },
-        { 158, 193, 96, 31, 127, 40, 1 }, },
-      { { 161, 212, 148, 45, 130, 248, 0 },
-        { 68, 105, 32, 110, 41, 118, 1 },
-        { 15, 160, 218, 20, 149, 194, 1 },
-        { 183, 74, 59, 2, 75, 17, 0 }, },
-      { { 187, 120, 230, 49, 108, 208, 1 },
-        { 158, 187, 135, 78, 66, 244, 0 },
-        { 133, 155, 70, 51, 143, 110, 1 },
-        { 23, 161, 57, 112, 238, 188, 1 }, },
-      { { 203, 181, 221, 203, 219, 24, 0 },
-        { 224, 83, 115, 227, 188, 247, 0 },
-        { 12, 109, 233, 221, 214, 233, 1 },
-        { 119, 158, 227, 231, 101, 3, 1 }, },
-      { { 211, 229, 238, 183, 131, 51, 0 },
-        { 240, 36, 191, 230, 159, 116, 1 },
-        { 102, 96, 246, 187, 211, 229, 1 },
-        { 151, 124, 179, 254, 146, 7, 1 }, },
-      { { 242, 148, 35, 63, 209, 156, 1 },
-        { 210, 57, 180, 89, 187, 99, 0 },
-        { 156, 197, 254, 98, 20, 167, 1 },
-        { 99, 110, 205, 22, 206, 37, 1 }, },
-      { { 253, 214, 209, 159, 59, 230, 1 },
-        { 95, 75, 29, 255, 153, 187, 1 },
-        { 179, 238, 124, 197, 181, 223, 1 },
-        { 238, 204, 255, 220, 105, 125, 0 }, },
-      { { 58, 70, 36, 238, 132, 238, 1 },
-        { 198, 42, 236, 156, 225, 14, 1 },
-        { 187, 144, 187, 146, 49, 46, 0 },
-        { 184, 67, 156, 155, 170, 49, 1 }, },
-      { { 98, 24, 126, 36, 59, 15, 0 },
-        { 168, 229, 153, 56, 51, 133, 0 },
-        { 120, 110, 18, 63, 12, 35, 0 },
-        { 80, 230, 14, 76, 211, 138, 1 }, },
-      { { 10, 205, 67, 111, 157, 195, 0 },
-        { 196, 174, 121, 69, 207, 131, 0 },
-        { 97, 220, 251, 97, 89, 168, 0 },
-        { 96, 249, 209, 79, 58, 145, 1 }, },
-      { { 14, 64, 212, 195, 142, 2, 0 },
-        { 129, 66, 105, 230, 192, 132, 0 },
-        { 32, 56, 225, 149, 129, 56, 0 },
-        { 16, 129, 179, 203, 33, 64, 1 }, },
-      { { 20, 159, 217, 160, 98, 36, 0 },
-        { 105, 241, 5, 179, 12, 8, 1 },
-        { 18, 35, 2, 205, 252, 148, 0 },
-        { 136, 24, 102, 208, 71, 203, 0 }, },
-      { { 25, 162, 225, 26, 101, 237, 0 },
-        { 28, 30, 151, 19, 232, 26, 1 },
-        { 91, 211, 44, 67, 162, 204, 0 },
-        { 172, 11, 228, 116, 188, 28, 0 }, },
-      { { 43, 80, 130, 126, 27, 52, 0 },
-        { 144, 35, 80, 62, 131, 211, 1 },
-        { 22, 108, 63, 32, 133, 106, 0 },
-        { 229, 224, 190, 5, 98, 4, 1 }, },
-      { { 41, 105, 56, 146, 159, 163, 0 },
-        { 48, 206, 186, 172, 196, 145, 1 },
-        { 98, 252, 164, 142, 75, 74, 0 },
-        { 196, 145, 154, 174, 185, 134, 0 }, },
-      { { 44, 247, 84, 219, 244, 86, 1 },
-        { 95, 83, 107, 220, 204, 79, 0 },
-        { 181, 23, 237, 149, 119, 154, 0 },
-        { 121, 25, 157, 235, 101, 125, 0 }, },
-      { { 53, 233, 63, 158, 54, 124, 0 },
-        { 61, 192, 134, 189, 239, 87, 1 },
-        { 31, 54, 60, 254, 75, 214, 0 },
-        { 245, 123, 222, 176, 129, 222, 0 }, },
-      { { 63, 116, 171, 216, 61, 243, 1 },
-        { 255, 15, 222, 143, 66, 211, 1 },
-        { 231, 222, 13, 234, 151, 126, 0 },
-        { 229, 161, 120, 189, 248, 127, 1 }, },
-      { { 68, 208, 41, 244, 255, 64, 0 },
-        { 61, 49, 240, 165, 89, 129, 0 },
-        { 1, 127, 151, 202, 5, 145, 0 },
-        { 64, 205, 82, 135, 198, 94, 0 }, },
-      { { 72, 64, 228, 132, 42, 245, 0 },
-        { 12, 14, 129, 182, 17, 196, 1 },
-        { 87, 170, 16, 147, 129, 9, 0 },
-        { 145, 196, 54, 192, 184, 24, 0 }, },
-      { { 95, 25, 19, 104, 52, 2, 0 },
-        { 137, 227, 76, 1, 86, 19, 0 },
-        { 32, 22, 11, 100, 76, 125, 0 },
-        { 100, 53, 64, 25, 99, 200, 1 }, },
-      { { 94, 178, 114, 64, 61, 93, 1 },
-        { 143, 71, 215, 16, 122, 201, 0 },
-        { 221, 94, 1, 39, 38, 189, 0 },
-        { 73, 175, 4, 117, 241, 120, 1 }, },
-      { { 111, 155, 36, 31, 21, 194, 0 },
-        { 149, 139, 152, 72, 221, 31, 0 },
-        { 33, 212, 124, 18, 108, 251, 0 },
-        { 124, 93, 137, 12, 232, 212, 1 }, },
-      { { 114, 170, 249, 32, 168, 227, 1 },
-        { 174, 236, 175, 11, 24, 136, 1 },
-        { 227, 138, 130, 79, 170, 167, 0 },
-        { 136, 140, 104, 122, 155, 186, 1 }, },
-      { { 121, 136, 117, 59, 134, 54, 1 },
-        { 18, 226, 173, 121, 216, 86, 1 },
-        { 182, 48, 238, 87, 8, 207, 0 },
-        { 181, 13, 207, 90, 163, 164, 0 }, },
-      { { 123, 231, 19, 174, 121, 81, 1 },
-        { 206, 118, 22, 141, 159, 219, 0 },
-        { 197, 79, 58, 228, 115, 239, 0 },
-        { 109, 252, 216, 180, 55, 57, 1 }, },
-      { { 133, 106, 70, 201, 89, 224, 0 },
-        { 5, 152, 83, 196, 2, 191, 1 },
-        { 3, 205, 73, 177, 43, 80, 1 },
-        { 254, 160, 17, 229, 12, 208, 0 }, },
-      { { 142, 63, 238, 242, 217, 81, 1 },
-        { 247, 183, 243, 130, 134, 237, 0 },
-        { 197, 77, 167, 187, 254, 56, 1 },
-        { 91, 176, 160, 231, 246, 247, 1 }, },
-      { { 173, 56, 205, 33, 115, 103, 1 },
-        { 47, 183, 27, 123, 0, 53, 1 },
-        { 243, 103, 66, 89, 142, 90, 1 },
-        { 214, 0, 111, 108, 118, 250, 0 }, },
-      { { 177, 55, 37, 48, 185, 63, 1 },
-        { 90, 37, 190, 25, 36, 253, 1 },
-        { 254, 78, 134, 82, 118, 70, 1 },
-        { 223, 146, 76, 62, 210, 45, 0 }, },
-      { { 186, 195, 128, 210, 81, 219, 0 },
-        { 148, 30, 92, 142, 172, 105, 0 },
-        { 109, 197, 37, 128, 225, 174, 1 },
-        { 75, 26, 184, 157, 60, 20, 1 }, },
-      { { 193, 117, 109, 93, 24, 166, 1 },
-        { 114, 9, 203, 85, 21, 183, 1 },
-        { 178, 140, 93, 91, 87, 65, 1 },
-        { 246, 212, 85, 105, 200, 39, 0 }, },
-      { { 206, 97, 211, 126, 229, 17, 0 },
-        { 153, 118, 115, 7, 215, 98, 0 },
-        { 68, 83, 191, 101, 195, 57, 1 },
-        { 35, 117, 240, 103, 55, 76, 1 }, },
-      { { 210, 92, 152, 54, 221, 91, 1 },
-        { 246, 245, 60, 6, 241, 225, 0 },
-        { 237, 93, 182, 12, 157, 37, 1 },
-        { 67, 199, 176, 30, 87, 183, 1 }, },
-      { { 208, 106, 145, 233, 239, 206, 1 },
-        { 14, 248, 126, 247, 112, 170, 0 },
-        { 185, 251, 203, 196, 171, 5, 1 },
-        { 42, 135, 119, 191, 15, 184, 0 }, },
-      { { 73, 228, 227, 141, 169, 90, 1 },
-        { 78, 2, 187, 199, 59, 210, 0 },
-        { 173, 74, 216, 227, 147, 201, 0 },
-        { 37, 238, 113, 238, 160, 57, 0 }, },
-      { { 82, 209, 159, 40, 31, 179, 0 },
-        { 160, 109, 28, 39, 94, 199, 1 },
-        { 102, 252, 10, 124, 197, 165, 0 },
-        { 241, 189, 114, 28, 91, 2, 1 }, },
-      { { 2, 24, 175, 24, 115, 160, 1 },
-        { 186, 153, 144, 35, 2, 7, 1 },
-        { 130, 231, 12, 122, 140, 32, 0 },
-        { 240, 32, 98, 4, 204, 174, 1 }, },
-      { { 5, 192, 75, 56, 81, 119, 0 },
-        { 53, 52, 25, 21, 10, 83, 1 },
-        { 119, 69, 14, 105, 1, 208, 0 },
-        { 229, 40, 84, 76, 22, 86, 0 }, },
-      { { 15, 88, 169, 33, 137, 159, 0 },
-        { 161, 175, 184, 87, 32, 208, 0 },
-        { 124, 200, 194, 74, 141, 120, 0 },
-        { 5, 130, 117, 14, 250, 194, 1 }, },
-      { { 15, 206, 165, 68, 68, 26, 0 },
-        { 193, 146, 200, 7, 105, 92, 0 },
-        { 44, 17, 17, 82, 185, 248, 0 },
-        { 29, 75, 112, 9, 164, 193, 1 }, },
-      { { 21, 238, 211, 115, 20, 216, 1 },
-        { 87, 232, 71, 71, 234, 89, 0 },
-        { 141, 148, 103, 101, 187, 212, 0 },
-        { 77, 43, 241, 113, 11, 245, 0 }, },
-      { { 22, 241, 226, 252, 69, 158, 1 },
-        { 147, 57, 223, 150, 111, 66, 0 },
-        { 188, 209, 31, 163, 199, 180, 0 },
-        { 33, 123, 52, 253, 206, 100, 1 }, },
-      { { 30, 94, 76, 65, 59, 115, 0 },
-        { 237, 135, 93, 100, 0, 205, 1 },
-        { 103, 110, 65, 25, 61, 60, 0 },
-        { 217, 128, 19, 93, 112, 219, 1 }, },
-      { { 31, 194, 82, 102, 200, 118, 1 },
-        { 135, 114, 109, 20, 139, 216, 1 },
-        { 183, 9, 179, 37, 33, 252, 0 },
-        { 141, 232, 148, 91, 39, 112, 1 }, },
-      { { 39, 33, 22, 246, 49, 159, 1 },
-        { 155, 108, 90, 152, 167, 85, 0 },
-        { 252, 198, 55, 180, 66, 114, 0 },
-        { 85, 114, 140, 173, 27, 108, 1 }, },
-      { { 39, 155, 122, 137, 27, 220, 0 },
-        { 165, 201, 145, 248, 46, 219, 0 },
-        { 29, 236, 72, 175, 108, 242, 0 },
-        { 109, 186, 15, 196, 201, 210, 1 }, },
-      { { 46, 12, 48, 75, 106, 108, 0 },
-        { 205, 210, 192, 120, 160, 130, 1 },
-        { 27, 43, 105, 6, 24, 58, 0 },
-        { 160, 130, 143, 1, 165, 217, 1 }, },
-      { { 47, 169, 226, 121, 230, 43, 0 },
-        { 153, 182, 235, 106, 110, 18, 1 },
-        { 106, 51, 207, 35, 202, 250, 0 },
-        { 164, 59, 43, 107, 182, 204, 1 }, },
-      { { 44, 207, 211, 2, 147, 19, 1 },
-        { 67, 198, 57, 47, 142, 73, 0 },
-        { 228, 100, 160, 101, 249, 154, 0 },
-        { 73, 56, 250, 78, 49, 225, 0 }, },
-      { { 49, 83, 3, 2, 18, 230, 1 },
-        { 6, 9, 12, 61, 134, 25, 1 },
-        { 179, 164, 32, 96, 101, 70, 0 },
-        { 204, 48, 222, 24, 72, 48, 0 }, },
-      { { 48, 120, 115, 90, 253, 41, 1 },
-        { 26, 213, 247, 13, 226, 131, 1 },
-        { 202, 95, 173, 103, 15, 6, 0 },
-        { 224, 163, 216, 119, 213, 172, 0 }, },
-      { { 55, 226, 67, 44, 167, 160, 1 },
-        { 139, 40, 55, 45, 75, 26, 1 },
-        { 130, 242, 154, 97, 35, 246, 0 },
-        { 172, 105, 90, 118, 10, 104, 1 }, },
-      { { 76, 11, 79, 138, 255, 84, 0 },
-        { 45, 146, 49, 177, 214, 207, 0 },
-        { 21, 127, 168, 249, 104, 25, 0 },
-        { 121, 181, 198, 198, 36, 218, 0 }, },
-      { { 78, 218, 184, 202, 73, 33, 1 },
-        { 163, 215, 208, 134, 152, 138, 1 },
-        { 194, 73, 41, 142, 173, 185, 0 },
-        { 168, 140, 176, 133, 245, 226, 1 }, },
-      { { 76, 218, 221, 21, 152, 110, 0 },
-        { 53, 195, 41, 87, 57, 141, 1 },
-        { 59, 12, 212, 93, 173, 153, 0 },
-        { 216, 206, 117, 74, 97, 214, 0 }, },
-      { { 86, 123, 85, 187, 37, 96, 1 },
-        { 159, 225, 23, 197, 212, 14, 1 },
-        { 131, 82, 110, 213, 111, 53, 0 },
-        { 184, 21, 209, 244, 67, 252, 1 }, },
-      { { 84, 151, 117, 241, 41, 203, 0 },
-        { 93, 109, 221, 193, 60, 140, 0 },
-        { 105, 202, 71, 215, 116, 149, 0 },
-        { 24, 158, 65, 221, 219, 93, 0 }, },
-      { { 84, 152, 140, 205, 4, 162, 0 },
-        { 33, 137, 76, 194, 89, 6, 1 },
-        { 34, 144, 89, 152, 140, 149, 0 },
-        { 176, 77, 33, 153, 72, 194, 0 }, },
-      { { 94, 110, 164, 168, 119, 169, 0 },
-        { 201, 190, 150, 166, 112, 15, 1 },
-        { 74, 247, 10, 146, 187, 61, 0 },
-        { 248, 7, 50, 180, 190, 201, 1 }, },
-      { { 99, 4, 81, 119, 99, 178, 0 },
-        { 216, 120, 89, 105, 145, 80, 1 },
-        { 38, 227, 119, 69, 16, 99, 0 },
-        { 133, 68, 203, 77, 15, 13, 1 }, },
-      { { 105, 226, 58, 120, 116, 228, 1 },
-        { 62, 122, 194, 28, 90, 27, 1 },
-        { 147, 151, 15, 46, 35, 203, 0 },
-        { 236, 45, 28, 33, 175, 62, 0 }, },
-      { { 109, 23, 226, 74, 80, 28, 1 },
-        { 67, 19, 193, 26, 182, 91, 0 },
-        { 156, 5, 41, 35, 244, 91, 0 },
-        { 109, 54, 172, 65, 228, 97, 0 }, },
-      { { 112, 62, 128, 226, 203, 177, 0 },
-        { 64, 189, 118, 170, 144, 200, 1 },
-        { 70, 233, 163, 128, 190, 7, 0 },
-        { 137, 132, 170, 183, 94, 129, 0 }, },
-      { { 119, 80, 90, 139, 20, 43, 1 },
-        { 163, 69, 13, 204, 242, 19, 1 },
-        { 234, 20, 104, 173, 5, 119, 0 },
-        { 228, 39, 153, 216, 81, 98, 1 }, },
-      { { 130, 100, 225, 43, 36, 151, 1 },
-        { 202, 44, 139, 87, 192, 98, 0 },
-        { 244, 146, 106, 67, 147, 32, 1 },
-        { 35, 1, 245, 104, 154, 41, 1 }, },
-      { { 131, 253, 167, 209, 241, 197, 0 },
-        { 220, 157, 242, 215, 14, 53, 0 },
-        { 81, 199, 197, 242, 223, 224, 1 },
-        { 86, 56, 117, 167, 220, 157, 1 }, },
-      { { 147, 189, 107, 77, 96, 125, 1 },
-        { 238, 149, 199, 81, 47, 114, 1 },
-        { 223, 3, 89, 107, 94, 228, 1 },
-        { 167, 122, 69, 113, 212, 187, 1 }, },
-      { { 148, 216, 165, 194, 122, 237, 1 },
-        { 15, 157, 196, 183, 168, 165, 1 },
-        { 219, 175, 33, 210, 141, 148, 1 },
-        { 210, 138, 246, 145, 220, 248, 0 }, },
-      { { 148, 247, 189, 26, 15, 79, 1 },
-        { 119, 69, 158, 55, 236, 174, 0 },
-        { 249, 120, 44, 94, 247, 148, 1 },
-        { 58, 155, 246, 60, 209, 119, 0 }, },
-      { { 152, 241, 170, 62, 148, 248, 0 },
-        { 52, 43, 166, 6, 239, 99, 1 },
-        { 15, 148, 190, 42, 199, 140, 1 },
-        { 227, 123, 176, 50, 234, 22, 0 }, },
-      { { 169, 138, 223, 140, 87, 40, 0 },
-        { 32, 210, 17, 171, 107, 63, 1 },
-        { 10, 117, 24, 253, 168, 202, 1 },
-        { 254, 107, 106, 196, 37, 130, 0 }, },
-      { { 177, 14, 54, 223, 65, 63, 0 },
-        { 80, 212, 220, 216, 163, 126, 1 },
-        { 126, 65, 125, 182, 56, 70, 1 },
-        { 191, 98, 141, 157, 149, 133, 0 }, },
-      { { 185, 234, 28, 100, 226, 107, 0 },
-        { 44, 246, 110, 44, 41, 60, 1 },
-        { 107, 35, 147, 28, 43, 206, 1 },
-        { 158, 74, 26, 59, 55, 154, 0 }, },
-      { { 188, 38, 74, 240, 242, 183, 1 },
-        { 123, 62, 111, 184, 2, 105, 1 },
-        { 246, 167, 135, 169, 50, 30, 1 },
-        { 203, 32, 14, 251, 62, 111, 0 }, },
-      { { 189, 63, 146, 218, 126, 170, 0 },
-        { 89, 219, 78, 170, 230, 187, 1 },
-        { 42, 191, 45, 164, 254, 94, 1 },
-        { 238, 179, 170, 185, 109, 205, 0 }, },
-      { { 192, 53, 46, 74, 202, 87, 0 },
-        { 100, 21, 234, 48, 150, 230, 0 },
-        { 117, 41, 169, 58, 86, 1, 1 },
-        { 51, 180, 134, 43, 212, 19, 0 }, },
-      { { 194, 54, 220, 36, 22, 128, 1 },
-        { 226, 105, 3, 34, 81, 45, 0 },
-        { 128, 180, 18, 29, 182, 33, 1 },
-        { 90, 69, 34, 96, 75, 35, 1 }, },
-      { { 211, 79, 245, 172, 136, 118, 1 },
-        { 198, 224, 173, 151, 21, 254, 1 },
-        { 183, 8, 154, 215, 249, 101, 1 },
-        { 191, 212, 116, 218, 131, 177, 1 }, },
-      { { 215, 6, 210, 240, 31, 150, 0 },
-        { 209, 104, 93, 178, 82, 249, 0 },
-        { 52, 252, 7, 165, 176, 117, 1 },
-        { 79, 165, 38, 221, 11, 69, 1 }, },
-      { { 216, 50, 245, 201, 86, 5, 0 },
-        { 0, 87, 199, 243, 80, 47, 0 },
-        { 80, 53, 73, 215, 166, 13, 1 },
-        { 122, 5, 103, 241, 245, 0, 0 }, },
-      { { 216, 217, 65, 4, 131, 170, 0 },
-        { 0, 139, 61, 37, 61, 32, 1 },
-        { 42, 224, 144, 65, 77, 141, 1 },
-        { 130, 94, 82, 94, 104, 128, 0 }, },
-      { { 224, 211, 100, 108, 77, 209, 1 },
-        { 6, 61, 209, 12, 93, 238, 0 },
-        { 197, 217, 27, 19, 101, 131, 1 },
-        { 59, 221, 24, 69, 222, 48, 0 }, },
-      { { 225, 232, 37, 60, 152, 205, 0 },
-        { 20, 172, 162, 29, 57, 183, 0 },
-        { 89, 140, 158, 82, 11, 195, 1 },
-        { 118, 206, 92, 34, 154, 148, 0 }, },
-      { { 229, 118, 79, 139, 232, 157, 1 },
-        { 107, 29, 35, 221, 178, 254, 0 },
-        { 220, 139, 232, 249, 55, 83, 1 },
-        { 63, 166, 221, 226, 92, 107, 0 }, },
-      { { 232, 80, 250, 159, 250, 74, 0 },
-        { 60, 83, 169, 238, 179, 163, 0 },
-        { 41, 47, 252, 175, 133, 11, 1 },
-        { 98, 230, 187, 202, 229, 30, 0 }, },
-      { { 235, 128, 234, 240, 130, 92, 1 },
-        { 182, 34, 225, 186, 58, 112, 0 },
-        { 157, 32, 135, 171, 128, 235, 1 },
-        { 7, 46, 46, 195, 162, 54, 1 }, },
-      { { 239, 108, 113, 174, 69, 200, 1 },
-        { 199, 250, 147, 141, 241, 50, 0 },
-        { 137, 209, 58, 199, 27, 123, 1 },
-        { 38, 71, 216, 228, 175, 241, 1 }, },
-      { { 247, 217, 64, 237, 177, 12, 0 },
-        { 137, 161, 117, 220, 61, 51, 0 },
-        { 24, 70, 219, 129, 77, 247, 1 },
-        { 102, 94, 29, 215, 66, 200, 1 }, },
-      { { 254, 214, 40, 241, 92, 60, 1 },
-        { 243, 51, 196, 220, 120, 233, 1 },
-        { 158, 29, 71, 138, 53, 191, 1 },
-        { 203, 143, 29, 145, 230, 103, 1 }, },
-      { { 20, 199, 225, 220, 124, 3, 1 },
-        { 91, 20, 205, 135, 77, 139, 0 },
-        { 224, 31, 29, 195, 241, 148, 0 },
-        { 104, 217, 112, 217, 148, 109, 0 }, },
-      { { 34, 236, 79, 160, 255, 225, 0 },
-        { 236, 188, 51, 173, 74, 133, 1 },
-        { 67, 255, 130, 249, 27, 162, 0 },
-        { 208, 169, 90, 230, 30, 155, 1 }, },
-      { { 164, 134, 72, 34, 231, 234, 0 },
-        { 109, 56, 57, 40, 232, 40, 1 },
-        { 43, 243, 162, 9, 48, 146, 1 },
-        { 138, 11, 138, 78, 14, 91, 0 }, },
-      { { 179, 172, 156, 128, 134, 12, 1 },
-        { 226, 192, 38, 186, 104, 52, 0 },
-        { 152, 48, 128, 156, 154, 230, 1 },
-        { 22, 11, 46, 178, 1, 163, 1 }, },
-      { { 235, 197, 247, 106, 12, 68, 0 },
-        { 196, 98, 193, 31, 222, 182, 0 },
-        { 17, 24, 43, 119, 209, 235, 1 },
-        { 54, 189, 252, 65, 163, 17, 1 }, },
-      { { 0, 36, 28, 209, 199, 244, 0 },
-        { 116, 88, 114, 240, 64, 68, 1 },
-        { 23, 241, 197, 156, 18, 0, 0 },
-        { 145, 1, 7, 167, 13, 23, 0 }, },
-      { { 0, 65, 85, 60, 228, 236, 0 },
-        { 28, 120, 33, 21, 101, 6, 1 },
-        { 27, 147, 158, 85, 65, 0, 0 },
-        { 176, 83, 84, 66, 15, 28, 0 }, },
-      { { 2, 119, 133, 135, 91, 48, 1 },
-        { 194, 17, 18, 231, 133, 205, 1 },
-        { 134, 109, 112, 208, 247, 32, 0 },
-        { 217, 208, 243, 164, 68, 33, 1 }, },
-      { { 1, 218, 232, 155, 2, 227, 0 },
-        { 52, 141, 137, 230, 136, 26, 1 },
-        { 99, 160, 108, 139, 173, 192, 0 },
-        { 172, 8, 179, 200, 216, 150, 0 }, },
-      { { 4, 40, 5, 26, 111, 159, 0 },
-        { 25, 156, 26, 49, 224, 198, 0 },
-        { 124, 251, 44, 80, 10, 16, 0 },
-        { 49, 131, 198, 44, 28, 204, 0 }, },
-      { { 7, 145, 0, 75, 83, 171, 0 },
-        { 129, 29, 88, 96, 172, 19, 1 },
-        { 106, 229, 105, 0, 68, 240, 0 },
-        { 228, 26, 131, 13, 92, 64, 1 }, },
-      { { 10, 89, 153, 210, 227, 215, 1 },
-        { 190, 223, 120, 183, 132, 64, 0 },
-        { 245, 227, 165, 204, 205, 40, 0 },
-        { 1, 16, 246, 143, 125, 190, 1 }, },
-      { { 9, 178, 243, 249, 248, 177, 1 },
-        { 26, 127, 227, 195, 10, 219, 1 },
-        { 198, 143, 207, 231, 166, 200, 0 },
-        { 237, 168, 97, 227, 255, 44, 0 }, },
-      { { 13, 49, 205, 127, 92, 218, 1 },
-        { 55, 59, 75, 67, 229, 215, 0 },
-        { 173, 157, 127, 89, 198, 88, 0 },
-        { 117, 211, 225, 105, 110, 118, 0 }, },
-      { { 14, 110, 159, 79, 116, 37, 1 },
-        { 235, 214, 66, 87, 195, 15, 1 },
-        { 210, 23, 121, 124, 187, 56, 0 },
-        { 248, 97, 245, 33, 53, 235, 1 }, },
-      { { 23, 114, 128, 242, 245, 110, 0 },
-        { 157, 49, 126, 150, 224, 25, 1 },
-        { 59, 87, 167, 128, 167, 116, 0 },
-        { 204, 3, 180, 191, 70, 92, 1 }, },
-      { { 22, 255, 97, 63, 186, 238, 0 },
-        { 221, 169, 175, 117, 173, 139, 1 },
-        { 59, 174, 254, 67, 127, 180, 0 },
-        { 232, 218, 215, 122, 202, 221, 1 }, },
-      { { 25, 50, 221, 83, 147, 173, 1 },
-        { 50, 79, 119, 115, 160, 29, 1 },
-        { 218, 228, 229, 93, 166, 76, 0 },
-        { 220, 2, 231, 119, 121, 38, 0 }, },
-      { { 30, 55, 90, 161, 138, 28, 1 },
-        { 227, 99, 39, 240, 38, 200, 0 },
-        { 156, 40, 194, 173, 118, 60, 0 },
-        { 9, 178, 7, 242, 99, 99, 1 }, },
-      { { 30, 243, 155, 67, 46, 40, 0 },
-        { 169, 67, 70, 103, 238, 136, 1 },
-        { 10, 58, 97, 108, 231, 188, 0 },
-        { 136, 187, 243, 49, 97, 74, 1 }, },
-      { { 35, 152, 218, 66, 102, 77, 0 },
-        { 172, 213, 65, 58, 234, 16, 0 },
-        { 89, 51, 33, 45, 140, 226, 0 },
-        { 4, 43, 174, 65, 85, 154, 1 }, },
-      { { 35, 183, 98, 39, 73, 166, 1 },
-        { 194, 57, 155, 88, 143, 152, 1 },
-        { 178, 201, 114, 35, 118, 226, 0 },
-        { 140, 248, 141, 108, 206, 33, 1 }, },
-      { { 39, 232, 89, 247, 30, 7, 0 },
-        { 177, 228, 75, 253, 201, 145, 0 },
-        { 112, 60, 119, 205, 11, 242, 0 },
-        { 68, 201, 223, 233, 19, 198, 1 }, },
-      { { 41, 207, 36, 233, 56, 245, 0 },
-        { 76, 174, 192, 220, 12, 223, 1 },
-        { 87, 142, 75, 146, 121, 202, 0 },
-        { 253, 152, 29, 129, 186, 153, 0 }, },
-      { { 43, 202, 225, 232, 241, 71, 1 },
-        { 142, 182, 249, 159, 8, 27, 0 },
-        { 241, 71, 139, 195, 169, 234, 0 },
-        { 108, 8, 124, 207, 182, 184, 1 }, },
-      { { 46, 52, 167, 60, 136, 145, 0 },
-        { 209, 47, 162, 11, 3, 198, 0 },
-        { 68, 136, 158, 114, 150, 58, 0 },
-        { 49, 224, 104, 34, 250, 69, 1 }, },
-      { { 44, 130, 54, 130, 20, 241, 1 },
-        { 7, 78, 128, 136, 202, 77, 1 },
-        { 199, 148, 32, 182, 32, 154, 0 },
-        { 217, 41, 136, 128, 185, 112, 0 }, },
-      { { 52, 119, 39, 34, 124, 128, 0 },
-        { 73, 57, 134, 13, 198, 141, 0 },
-        { 0, 159, 34, 114, 119, 22, 0 },
-        { 88, 177, 216, 48, 206, 73, 0 }, },
-      { { 62, 106, 78, 239, 207, 36, 0 },
-        { 161, 178, 119, 252, 195, 142, 1 },
-        { 18, 121, 251, 185, 43, 62, 0 },
-        { 184, 225, 159, 247, 38, 194, 1 }, },
-      { { 61, 189, 0, 186, 135, 236, 0 },
-        { 85, 171, 54, 184, 236, 18, 1 },
-        { 27, 240, 174, 128, 94, 222, 0 },
-        { 164, 27, 142, 182, 106, 213, 0 }, },
-      { { 65, 89, 70, 17, 248, 154, 0 },
-        { 24, 153, 41, 68, 54, 213, 0 },
-        { 44, 143, 196, 49, 77, 65, 0 },
-        { 85, 182, 17, 74, 76, 140, 0 }, },
-      { { 66, 160, 192, 80, 251, 19, 1 },
-        { 154, 20, 123, 34, 24, 193, 0 },
-        { 228, 111, 133, 1, 130, 161, 0 },
-        { 65, 140, 34, 111, 20, 44, 1 }, },
-      { { 66, 215, 59, 80, 17, 218, 1 },
-        { 246, 73, 216, 5, 62, 73, 0 },
-        { 173, 196, 5, 110, 117, 161, 0 },
-        { 73, 62, 80, 13, 201, 55, 1 }, },
-      { { 71, 21, 159, 236, 40, 89, 1 },
-        { 239, 101, 64, 131, 55, 214, 0 },
-        { 205, 10, 27, 252, 212, 113, 0 },
-        { 53, 246, 96, 129, 83, 123, 1 }, },
-      { { 72, 72, 74, 156, 121, 141, 1 },
-        { 58, 158, 17, 148, 51, 131, 0 },
-        { 216, 207, 28, 169, 9, 9, 0 },
-        { 96, 230, 20, 196, 60, 174, 0 }, },
-      { { 75, 141, 239, 56, 120, 19, 0 },
-        { 248, 182, 137, 3, 30, 215, 0 },
-        { 100, 15, 14, 123, 216, 233, 0 },
-        { 117, 188, 96, 72, 182, 143, 1 }, },
-      { { 72, 197, 79, 119, 42, 255, 1 },
-        { 126, 46, 73, 117, 191, 196, 1 },
-        { 255, 170, 119, 121, 81, 137, 0 },
-        { 145, 254, 215, 73, 58, 63, 0 }, },
-      { { 73, 205, 149, 222, 250, 38, 0 },
-        { 88, 210, 104, 183, 157, 151, 1 },
-        { 50, 47, 189, 212, 217, 201, 0 },
-        { 244, 220, 246, 139, 37, 141, 0 }, },
-      { { 74, 248, 19, 154, 40, 250, 0 },
-        { 156, 203, 10, 133, 186, 194, 1 },
-        { 47, 138, 44, 228, 15, 169, 0 },
-        { 161, 174, 208, 168, 105, 156, 1 }, },
-      { { 76, 39, 45, 47, 65, 165, 0 },
-        { 97, 62, 146, 81, 149, 14, 1 },
-        { 82, 193, 122, 90, 114, 25, 0 },
-        { 184, 84, 197, 36, 190, 67, 0 }, },
-      { { 76, 63, 202, 163, 60, 106, 1 },
-        { 111, 163, 11, 194, 246, 137, 1 },
-        { 171, 30, 98, 169, 254, 25, 0 },
-        { 200, 183, 161, 232, 98, 251, 0 }, },
-      { { 76, 105, 150, 233, 240, 91, 0 },
-        { 13, 246, 106, 198, 54, 71, 0 },
-        { 109, 7, 203, 180, 203, 25, 0 },
-        { 113, 54, 49, 171, 55, 216, 0 }, },
-      { { 83, 59, 100, 210, 198, 162, 0 },
-        { 144, 153, 239, 160, 212, 28, 1 },
-        { 34, 177, 165, 147, 110, 101, 0 },
-        { 156, 21, 130, 251, 204, 132, 1 }, },
-      { { 81, 70, 77, 104, 180, 53, 1 },
-        { 106, 36, 101, 21, 80, 95, 1 },
-        { 214, 22, 139, 89, 49, 69, 0 },
-        { 253, 5, 84, 83, 18, 43, 0 }, },
-      { { 81, 86, 86, 98, 113, 201, 1 },
-        { 78, 125, 85, 4, 178, 29, 0 },
-        { 201, 199, 35, 53, 53, 69, 0 },
-        { 92, 38, 144, 85, 95, 57, 0 }, },
-      { { 80, 115, 53, 140, 113, 223, 1 },
-        { 14, 93, 158, 149, 53, 79, 0 },
-        { 253, 199, 24, 214, 103, 5, 0 },
-        { 121, 86, 84, 188, 221, 56, 0 }, },
-      { { 84, 74, 231, 46, 2, 158, 1 },
-        { 3, 168, 141, 55, 179, 78, 0 },
-        { 188, 160, 58, 115, 169, 21, 0 },
-        { 57, 102, 246, 88, 138, 224, 0 }, },
-      { { 84, 219, 22, 238, 94, 71, 0 },
-        { 5, 245, 76, 180, 223, 143, 0 },
-        { 113, 61, 59, 180, 109, 149, 0 },
-        { 120, 253, 150, 153, 87, 208, 0 }, },
-      { { 86, 240, 240, 30, 140, 100, 1 },
-        { 151, 65, 167, 22, 217, 130, 1 },
-        { 147, 24, 188, 7, 135, 181, 0 },
-        { 160, 205, 180, 114, 193, 116, 1 }, },
-      { { 91, 106, 3, 196, 23, 123, 1 },
-        { 134, 134, 94, 165, 115, 89, 1 },
-        { 239, 116, 17, 224, 43, 109, 0 },
-        { 205, 103, 82, 189, 48, 176, 1 }, },
-      { { 91, 249, 239, 82, 25, 108, 1 },
-        { 182, 131, 215, 23, 190, 149, 1 },
-        { 155, 76, 37, 123, 207, 237, 0 },
-        { 212, 190, 244, 117, 224, 182, 1 }, },
-      { { 92, 116, 249, 2, 251, 190, 0 },
-        { 105, 91, 191, 55, 176, 193, 1 },
-        { 62, 239, 160, 79, 151, 29, 0 },
-        { 193, 134, 246, 126, 237, 75, 0 }, },
-      { { 94, 157, 11, 47, 79, 122, 1 },
-        { 231, 179, 28, 97, 255, 194, 1 },
-        { 175, 121, 122, 104, 92, 189, 0 },
-        { 161, 255, 195, 28, 102, 243, 1 }, },
-      { { 99, 67, 213, 185, 201, 130, 0 },
-        { 144, 120, 57, 207, 20, 158, 0 },
-        { 32, 201, 206, 213, 225, 99, 0 },
-        { 60, 148, 121, 206, 15, 4, 1 }, },
-      { { 96, 93, 164, 245, 22, 155, 1 },
-        { 82, 173, 200, 238, 117, 69, 0 },
-        { 236, 180, 87, 146, 221, 3, 0 },
-        { 81, 87, 59, 137, 218, 165, 0 }, },
-      { { 100, 136, 47, 135, 72, 47, 0 },
-        { 33, 148, 136, 217, 187, 132, 1 },
-        { 122, 9, 112, 250, 8, 147, 0 },
-        { 144, 238, 205, 136, 148, 194, 0 }, },
-      { { 104, 106, 145, 148, 102, 64, 0 },
-        { 28, 210, 2, 175, 81, 8, 0 },
-        { 1, 51, 20, 196, 171, 11, 0 },
-        { 8, 69, 122, 160, 37, 156, 0 }, },
-      { { 108, 55, 209, 238, 204, 101, 1 },
-        { 71, 119, 99, 155, 213, 138, 1 },
-        { 211, 25, 187, 197, 246, 27, 0 },
-        { 168, 213, 236, 227, 119, 113, 0 }, },
-      { { 109, 89, 245, 135, 43, 42, 0 },
-        { 9, 195, 153, 239, 181, 148, 1 },
-        { 42, 106, 112, 215, 205, 91, 0 },
-        { 148, 214, 251, 204, 225, 200, 0 }, },
-      { { 115, 31, 7, 158, 40, 12, 0 },
-        { 216, 129, 4, 153, 183, 158, 0 },
-        { 24, 10, 60, 240, 124, 103, 0 },
-        { 60, 246, 204, 144, 64, 141, 1 }, },
-      { { 114, 38, 22, 146, 200, 199, 1 },
-        { 214, 92, 46, 152, 146, 140, 0 },
-        { 241, 137, 164, 180, 50, 39, 0 },
-        { 24, 164, 140, 186, 29, 53, 1 }, },
-      { { 115, 131, 239, 207, 199, 93, 1 },
-        { 166, 20, 245, 251, 255, 94, 0 },
-        { 221, 113, 249, 251, 224, 231, 0 },
-        { 61, 127, 239, 215, 148, 50, 1 }, },
-      { { 113, 246, 244, 181, 170, 13, 0 },
-        { 88, 101, 167, 254, 57, 156, 0 },
-        { 88, 42, 214, 151, 183, 199, 0 },
-        { 28, 206, 63, 242, 211, 13, 0 }, },
-      { { 118, 16, 2, 241, 170, 59, 0 },
-        { 153, 37, 108, 232, 50, 192, 1 },
-        { 110, 42, 199, 160, 4, 55, 0 },
-        { 129, 166, 11, 155, 82, 76, 1 }, },
-      { { 118, 84, 255, 84, 38, 33, 0 },
-        { 249, 69, 197, 47, 83, 4, 1 },
-        { 66, 50, 21, 127, 149, 55, 0 },
-        { 144, 101, 122, 81, 209, 79, 1 }, },
-      { { 122, 227, 200, 30, 38, 54, 0 },
-        { 184, 2, 15, 62, 221, 74, 1 },
-        { 54, 50, 60, 9, 227, 175, 0 },
-        { 169, 93, 190, 120, 32, 14, 1 }, },
-      { { 126, 32, 91, 27, 109, 102, 0 },
-        { 189, 82, 31, 89, 210, 130, 1 },
-        { 51, 91, 108, 109, 2, 63, 0 },
-        { 160, 165, 205, 124, 37, 94, 1 }, },
-      { { 124, 113, 102, 127, 179, 75, 1 },
-        { 31, 39, 255, 108, 183, 7, 0 },
-        { 233, 102, 255, 51, 71, 31, 0 },
-        { 112, 118, 155, 127, 242, 124, 0 }, },
-      { { 126, 136, 249, 129, 71, 26, 0 },
-        { 161, 210, 157, 235, 120, 64, 0 },
-        { 44, 113, 64, 207, 136, 191, 0 },
-        { 1, 15, 107, 220, 165, 194, 1 }, },
-      { { 127, 189, 182, 243, 152, 70, 0 },
-        { 213, 227, 238, 218, 158, 149, 0 },
-        { 49, 12, 231, 182, 222, 255, 0 },
-        { 84, 188, 173, 187, 227, 213, 1 }, },
-      { { 131, 186, 63, 66, 156, 103, 0 },
-        { 164, 197, 234, 17, 202, 189, 1 },
-        { 115, 28, 161, 126, 46, 224, 1 },
-        { 222, 169, 196, 43, 209, 146, 1 }, },
-      { { 131, 179, 163, 188, 159, 85, 1 },
-        { 150, 37, 178, 179, 79, 251, 0 },
-        { 213, 124, 158, 226, 230, 224, 1 },
-        { 111, 249, 102, 166, 210, 52, 1 }, },
-      { { 134, 184, 56, 238, 195, 91, 1 },
-        { 167, 245, 250, 160, 169, 98, 0 },
-        { 237, 97, 187, 142, 14, 176, 1 },
-        { 35, 74, 130, 175, 215, 242, 1 }, },
-      { { 138, 251, 116, 46, 23, 43, 0 },
-        { 128, 231, 155, 36, 237, 47, 1 },
-        { 106, 116, 58, 23, 111, 168, 1 },
-        { 250, 91, 146, 108, 243, 128, 1 }, },
-      { { 142, 5, 134, 252, 131, 42, 0 },
-        { 209, 34, 120, 162, 39, 38, 1 },
-        { 42, 96, 159, 176, 208, 56, 1 },
-        { 178, 114, 34, 143, 34, 69, 1 }, },
-      { { 143, 72, 60, 30, 32, 231, 0 },
-        { 189, 206, 136, 20, 129, 54, 1 },
-        { 115, 130, 60, 30, 9, 120, 1 },
-        { 182, 64, 148, 8, 185, 222, 1 }, },
-      { { 142, 83, 181, 252, 28, 224, 0 },
-        { 149, 107, 192, 135, 69, 175, 1 },
-        { 3, 156, 31, 214, 229, 56, 1 },
-        { 250, 209, 112, 129, 235, 84, 1 }, },
-      { { 141, 157, 35, 130, 73, 96, 0 },
-        { 69, 147, 144, 129, 142, 176, 1 },
-        { 3, 73, 32, 226, 92, 216, 1 },
-        { 134, 184, 192, 132, 228, 209, 0 }, },
-      { { 141, 185, 144, 117, 146, 156, 1 },
-        { 19, 235, 98, 114, 45, 113, 0 },
-        { 156, 164, 215, 4, 206, 216, 1 },
-        { 71, 90, 39, 35, 107, 228, 0 }, },
-      { { 144, 19, 230, 225, 162, 176, 0 },
-        { 8, 41, 229, 226, 6, 108, 1 },
-        { 6, 162, 195, 179, 228, 4, 1 },
-        { 155, 48, 35, 211, 202, 8, 0 }, },
-      { { 147, 155, 55, 123, 26, 144, 1 },
-        { 146, 233, 196, 97, 142, 255, 0 },
-        { 132, 172, 111, 118, 108, 228, 1 },
-        { 127, 184, 195, 17, 203, 164, 1 }, },
-      { { 151, 14, 49, 237, 242, 168, 1 },
-        { 203, 248, 228, 225, 33, 59, 1 },
-        { 138, 167, 219, 198, 56, 116, 1 },
-        { 238, 66, 67, 147, 143, 233, 1 }, },
-      { { 151, 52, 94, 59, 153, 170, 0 },
-        { 241, 105, 63, 64, 162, 183, 1 },
-        { 42, 204, 238, 61, 22, 116, 1 },
-        { 246, 162, 129, 126, 75, 71, 1 }, },
-      { { 149, 122, 253, 44, 125, 85, 0 },
-        { 45, 245, 151, 23, 65, 255, 0 },
-        { 85, 95, 26, 95, 175, 84, 1 },
-        { 127, 193, 116, 116, 215, 218, 0 }, },
-      { { 151, 221, 14, 6, 20, 80, 1 },
-        { 231, 129, 4, 4, 207, 117, 0 },
-        { 133, 20, 48, 56, 93, 244, 1 },
-        { 87, 121, 144, 16, 64, 243, 1 }, },
-      { { 154, 154, 4, 227, 189, 68, 1 },
-        { 142, 163, 116, 208, 200, 173, 0 },
-        { 145, 94, 227, 144, 44, 172, 1 },
-        { 90, 137, 133, 151, 98, 184, 1 }, },
-      { { 155, 190, 173, 173, 13, 248, 1 },
-        { 230, 171, 150, 195, 105, 254, 1 },
-        { 143, 216, 90, 218, 190, 236, 1 },
-        { 191, 203, 97, 180, 234, 179, 1 }, },
-      { { 157, 103, 144, 38, 24, 93, 0 },
-        { 69, 102, 6, 22, 165, 249, 0 },
-        { 93, 12, 50, 4, 243, 92, 1 },
-        { 79, 210, 180, 48, 51, 81, 0 }, },
-      { { 159, 129, 201, 246, 175, 127, 0 },
-        { 189, 38, 125, 179, 237, 240, 1 },
-        { 127, 122, 183, 201, 192, 252, 1 },
-        { 135, 219, 230, 223, 50, 94, 1 }, },
-      { { 159, 247, 196, 109, 149, 97, 1 },
-        { 199, 39, 119, 70, 77, 63, 1 },
-        { 195, 84, 219, 17, 247, 252, 1 },
-        { 254, 89, 49, 119, 114, 113, 1 }, },
-      { { 167, 3, 62, 38, 186, 122, 0 },
-        { 173, 96, 168, 40, 167, 253, 1 },
-        { 47, 46, 178, 62, 96, 114, 1 },
-        { 223, 242, 138, 10, 131, 90, 1 }, },
-      { { 166, 79, 109, 144, 30, 111, 0 },
-        { 245, 132, 137, 189, 100, 173, 1 },
-        { 123, 60, 4, 219, 121, 50, 1 },
-        { 218, 147, 94, 200, 144, 215, 1 }, },
-      { { 166, 84, 136, 155, 103, 3, 0 },
-        { 249, 21, 24, 238, 192, 34, 0 },
-        { 96, 115, 108, 136, 149, 50, 1 },
-        { 34, 1, 187, 140, 84, 79, 1 }, },
-      { { 164, 250, 171, 52, 23, 138, 0 },
-        { 49, 169, 154, 47, 107, 41, 0 },
-        { 40, 244, 22, 106, 175, 146, 1 },
-        { 74, 107, 122, 44, 202, 198, 0 }, },
-      { { 169, 35, 165, 79, 219, 255, 1 },
-        { 6, 30, 250, 123, 165, 255, 1 },
-        { 255, 237, 249, 82, 226, 74, 1 },
-        { 255, 210, 239, 47, 188, 48, 0 }, },
-      { { 175, 22, 89, 55, 116, 14, 1 },
-        { 251, 115, 9, 89, 225, 57, 0 },
-        { 184, 23, 118, 77, 52, 122, 1 },
-        { 78, 67, 205, 72, 103, 111, 1 }, },
-      { { 174, 60, 2, 96, 17, 226, 1 },
-        { 199, 171, 90, 8, 2, 33, 1 },
-        { 163, 196, 3, 32, 30, 58, 1 },
-        { 194, 32, 8, 45, 106, 241, 1 }, },
-      { { 174, 166, 70, 29, 70, 134, 0 },
-        { 209, 26, 11, 120, 75, 46, 0 },
-        { 48, 177, 92, 49, 50, 186, 1 },
-        { 58, 105, 15, 104, 44, 69, 1 }, },
-      { { 174, 169, 188, 206, 254, 64, 0 },
-        { 173, 210, 226, 170, 205, 167, 0 },
-        { 1, 63, 185, 158, 202, 186, 1 },
-        { 114, 217, 170, 163, 165, 218, 1 }, },
-      { { 177, 170, 233, 41, 210, 190, 0 },
-        { 32, 184, 175, 123, 40, 123, 1 },
-        { 62, 165, 202, 75, 170, 198, 1 },
-        { 239, 10, 111, 122, 142, 130, 0 }, },
-      { { 179, 236, 199, 247, 61, 40, 0 },
-        { 216, 160, 87, 207, 235, 181, 1 },
-        { 10, 94, 119, 241, 155, 230, 1 },
-        { 214, 235, 249, 245, 2, 141, 1 }, },
-      { { 179, 242, 249, 209, 5, 96, 1 },
-        { 182, 65, 215, 207, 72, 56, 1 },
-        { 131, 80, 69, 207, 167, 230, 1 },
-        { 142, 9, 121, 245, 193, 54, 1 }, },
-      { { 183, 83, 178, 95, 132, 147, 0 },
-        { 145, 77, 236, 78, 199, 122, 0 },
-        { 100, 144, 253, 38, 229, 118, 1 },
-        { 47, 113, 185, 27, 217, 68, 1 }, },
-      { { 180, 99, 115, 84, 106, 222, 0 },
-        { 29, 88, 207, 61, 39, 232, 0 },
-        { 61, 171, 21, 103, 99, 22, 1 },
-        { 11, 242, 94, 121, 141, 92, 0 }, },
-      { { 182, 97, 89, 33, 192, 136, 0 },
-        { 161, 120, 39, 77, 36, 32, 0 },
-        { 8, 129, 194, 77, 67, 54, 1 },
-        { 2, 18, 89, 114, 15, 66, 1 }, },
-      { { 186, 184, 208, 95, 68, 186, 1 },
-        { 146, 219, 79, 74, 233, 98, 1 },
-        { 174, 145, 125, 5, 142, 174, 1 },
-        { 163, 75, 169, 121, 109, 164, 1 }, },
-      { { 186, 192, 40, 124, 16, 3, 1 },
-        { 178, 38, 204, 12, 9, 35, 0 },
-        { 224, 4, 31, 10, 1, 174, 1 },
-        { 98, 72, 24, 25, 178, 38, 1 }, },
-      { { 188, 9, 19, 77, 135, 103, 0 },
-        { 5, 198, 124, 121, 71, 34, 1 },
-        { 115, 112, 217, 100, 72, 30, 1 },
-        { 162, 113, 79, 31, 49, 208, 0 }, },
-      { { 190, 60, 15, 68, 249, 12, 0 },
-        { 233, 147, 118, 25, 35, 165, 0 },
-        { 24, 79, 145, 120, 30, 62, 1 },
-        { 82, 226, 76, 55, 100, 203, 1 }, },
-      { { 193, 39, 249, 24, 172, 4, 0 },
-        { 120, 64, 163, 19, 84, 186, 0 },
-        { 16, 26, 140, 79, 242, 65, 1 },
-        { 46, 149, 100, 98, 129, 15, 0 }, },
-      { { 194, 54, 103, 175, 248, 99, 1 },
-        { 206, 53, 171, 193, 147, 175, 1 },
-        { 227, 15, 250, 243, 54, 33, 1 },
-        { 250, 228, 193, 234, 214, 57, 1 }, },
-      { { 194, 202, 232, 228, 90, 50, 0 },
-        { 160, 176, 201, 166, 25, 233, 1 },
-        { 38, 45, 19, 139, 169, 161, 1 },
-        { 203, 204, 50, 201, 134, 130, 1 }, },
-      { { 198, 18, 22, 32, 228, 28, 0 },
-        { 137, 113, 32, 16, 114, 108, 0 },
-        { 28, 19, 130, 52, 36, 49, 1 },
-        { 27, 39, 4, 2, 71, 72, 1 }, },
-      { { 199, 229, 93, 208, 65, 150, 0 },
-        { 241, 88, 91, 149, 28, 116, 0 },
-        { 52, 193, 5, 221, 83, 241, 1 },
-        { 23, 28, 84, 237, 13, 71, 1 }, },
-      { { 202, 89, 204, 102, 248, 236, 0 },
-        { 172, 187, 97, 22, 181, 165, 1 },
-        { 27, 143, 179, 25, 205, 41, 1 },
-        { 210, 214, 180, 67, 110, 154, 1 }, },
-      { { 200, 251, 13, 58, 124, 119, 1 },
-        { 62, 183, 10, 21, 220, 239, 1 },
-        { 247, 31, 46, 88, 111, 137, 1 },
-        { 251, 157, 212, 40, 118, 190, 0 }, },
-      { { 204, 35, 191, 4, 244, 230, 0 },
-        { 45, 90, 170, 19, 87, 45, 1 },
-        { 51, 151, 144, 126, 226, 25, 1 },
-        { 218, 117, 100, 42, 173, 90, 0 }, },
-      { { 204, 185, 29, 222, 17, 77, 0 },
-        { 53, 199, 82, 145, 189, 39, 0 },
-        { 89, 68, 61, 220, 78, 153, 1 },
-        { 114, 94, 196, 165, 113, 214, 0 }, },
-      { { 214, 71, 53, 203, 221, 81, 1 },
-        { 199, 84, 244, 197, 212, 239, 0 },
-        { 197, 93, 233, 214, 113, 53, 1 },
-        { 123, 149, 209, 151, 149, 113, 1 }, },
-      { { 212, 80, 13, 82, 140, 243, 1 },
-        { 55, 13, 108, 5, 208, 228, 1 },
-        { 231, 152, 165, 88, 5, 21, 1 },
-        { 147, 133, 208, 27, 88, 118, 0 }, },
-      { { 214, 126, 50, 1, 136, 117, 0 },
-        { 197, 197, 166, 84, 18, 232, 1 },
-        { 87, 8, 192, 38, 63, 53, 1 },
-        { 139, 164, 21, 50, 209, 209, 1 }, },
-      { { 214, 239, 103, 48, 199, 69, 1 },
-        { 215, 180, 183, 53, 94, 44, 0 },
-        { 209, 113, 134, 115, 123, 181, 1 },
-        { 26, 61, 86, 118, 150, 245, 1 }, },
-      { { 217, 10, 193, 255, 8, 72, 0 },
-        { 20, 162, 69, 195, 177, 186, 0 },
-        { 9, 8, 127, 193, 168, 77, 1 },
-        { 46, 198, 225, 209, 34, 148, 0 }, },
-      { { 218, 68, 144, 181, 192, 149, 0 },
-        { 208, 126, 36, 214, 17, 96, 0 },
-        { 84, 129, 214, 132, 145, 45, 1 },
-        { 3, 68, 53, 146, 63, 5, 1 }, },
-      { { 218, 142, 240, 138, 31, 78, 1 },
-        { 198, 194, 157, 178, 248, 171, 0 },
-        { 185, 124, 40, 135, 184, 173, 1 },
-        { 106, 143, 166, 220, 161, 177, 1 }, },
-      { { 226, 186, 72, 154, 71, 244, 1 },
-        { 182, 153, 19, 184, 216, 106, 1 },
-        { 151, 241, 44, 137, 46, 163, 1 },
-        { 171, 13, 142, 228, 76, 182, 1 }, },
-      { { 226, 251, 142, 197, 152, 25, 0 },
-        { 160, 133, 98, 206, 63, 237, 0 },
-        { 76, 12, 209, 184, 239, 163, 1 },
-        { 91, 254, 57, 163, 80, 130, 1 }, },
-      { { 229, 62, 6, 191, 131, 16, 1 },
-        { 83, 161, 50, 232, 147, 126, 0 },
-        { 132, 96, 254, 176, 62, 83, 1 },
-        { 63, 100, 139, 166, 66, 229, 0 }, },
-      { { 230, 135, 176, 105, 180, 112, 0 },
-        { 205, 96, 224, 74, 92, 107, 1 },
-        { 7, 22, 203, 6, 240, 179, 1 },
-        { 235, 29, 41, 3, 131, 89, 1 }, },
-      { { 229, 161, 35, 223, 231, 210, 0 },
-        { 29, 24, 250, 233, 223, 114, 0 },
-        { 37, 243, 253, 226, 66, 211, 1 },
-        { 39, 125, 203, 175, 140, 92, 0 }, },
-      { { 228, 231, 74, 54, 176, 3, 0 },
-        { 121, 36, 43, 12, 159, 41, 0 },
-        { 96, 6, 182, 41, 115, 147, 1 },
-        { 74, 124, 152, 106, 18, 79, 0 }, },
-      { { 235, 25, 74, 181, 219, 227, 0 },
-        { 180, 191, 57, 232, 23, 177, 1 },
-        { 99, 237, 214, 169, 76, 107, 1 },
-        { 198, 244, 11, 206, 126, 150, 1 }, },
-      { { 235, 104, 214, 214, 135, 188, 0 },
-        { 144, 202, 115, 190, 243, 116, 1 },
-        { 30, 240, 181, 181, 139, 107, 1 },
-        { 151, 103, 190, 231, 41, 132, 1 }, },
-      { { 239, 76, 157, 25, 92, 242, 0 },
-        { 245, 218, 8, 79, 80, 247, 1 },
-        { 39, 157, 76, 92, 153, 123, 1 },
-        { 247, 133, 121, 8, 45, 215, 1 }, },
-      { { 240, 140, 65, 178, 161, 79, 1 },
-        { 94, 164, 61, 153, 184, 32, 0 },
-        { 249, 66, 166, 193, 24, 135, 1 },
-        { 2, 14, 204, 222, 18, 189, 0 }, },
-      { { 245, 42, 227, 102, 145, 91, 0 },
-        { 5, 164, 255, 11, 179, 121, 0 },
-        { 109, 68, 179, 99, 170, 87, 1 },
-        { 79, 102, 232, 127, 146, 208, 0 }, },
-      { { 247, 127, 207, 238, 89, 167, 0 },
-        { 225, 189, 95, 159, 151, 191, 1 },
-        { 114, 205, 59, 249, 255, 119, 1 },
-        { 254, 244, 252, 253, 94, 195, 1 }, },
-      { { 248, 218, 47, 9, 127, 235, 0 },
-        { 44, 159, 156, 109, 122, 175, 1 },
-        { 107, 255, 72, 122, 45, 143, 1 },
-        { 250, 175, 91, 28, 252, 154, 0 }, },
-      { { 252, 25, 236, 171, 9, 228, 1 },
-        { 39, 171, 149, 218, 148, 166, 1 },
-        { 147, 200, 106, 155, 204, 31, 1 },
-        { 178, 148, 173, 212, 234, 242, 0 }, },
-      { { 147, 75, 97, 136, 48, 21, 0 },
-        { 136, 132, 133, 149, 4, 123, 0 },
-        { 84, 6, 8, 195, 105, 100, 1 },
-        { 111, 16, 84, 208, 144, 136, 1 }, },
-      { { 200, 173, 102, 37, 128, 21, 1 },
-        { 66, 166, 163, 80, 31, 100, 0 },
-        { 212, 0, 210, 51, 90, 137, 1 },
-        { 19, 124, 5, 98, 178, 161, 0 }, },
-      { { 28, 218, 21, 111, 160, 160, 1 },
-        { 11, 235, 100, 69, 137, 14, 1 },
-        { 130, 130, 251, 84, 45, 156, 0 },
-        { 184, 72, 209, 19, 107, 232, 0 }, },
-      { { 35, 147, 244, 147, 165, 30, 0 },
-        { 152, 65, 185, 218, 236, 92, 0 },
-        { 60, 82, 228, 151, 228, 226, 0 },
-        { 29, 27, 173, 206, 193, 12, 1 }, },
-      { { 47, 88, 146, 189, 228, 140, 1 },
-        { 155, 251, 32, 222, 99, 18, 0 },
-        { 152, 147, 222, 164, 141, 122, 0 },
-        { 36, 99, 61, 130, 111, 236, 1 }, },
-      { { 67, 161, 247, 150, 104, 223, 0 },
-        { 156, 92, 139, 147, 191, 212, 0 },
-        { 125, 139, 52, 247, 194, 225, 0 },
-        { 21, 254, 228, 232, 157, 28, 1 }, },
-      { { 73, 80, 111, 179, 116, 206, 1 },
-        { 62, 59, 137, 213, 242, 21, 0 },
-        { 185, 151, 102, 251, 5, 73, 0 },
-        { 84, 39, 213, 200, 238, 62, 0 }, },
-      { { 82, 96, 94, 14, 152, 127, 0 },
-        { 164, 68, 47, 20, 179, 199, 1 },
-        { 127, 12, 184, 61, 3, 37, 0 },
-        { 241, 230, 148, 122, 17, 18, 1 }, },
-      { { 82, 145, 24, 227, 252, 161, 0 },
-        { 168, 125, 100, 192, 220, 129, 1 },
-        { 66, 159, 227, 140, 68, 165, 0 },
-        { 192, 157, 129, 147, 95, 10, 1 }, },
-      { { 101, 223, 133, 82, 42, 63, 1 },
-        { 91, 133, 72, 63, 188, 220, 1 },
-        { 254, 42, 37, 80, 253, 211, 0 },
-        { 157, 158, 254, 9, 80, 237, 0 }, },
-      { { 113, 72, 12, 215, 43, 160, 0 },
-        { 56, 136, 84, 236, 145, 148, 1 },
-        { 2, 234, 117, 152, 9, 71, 0 },
-        { 148, 196, 155, 149, 8, 142, 0 }, },
-      { { 142, 6, 96, 125, 160, 37, 0 },
-        { 217, 38, 225, 80, 1, 42, 1 },
-        { 82, 2, 223, 3, 48, 56, 1 },
-        { 170, 64, 5, 67, 178, 77, 1 }, },
-      { { 150, 170, 33, 3, 84, 112, 1 },
-        { 135, 144, 134, 65, 200, 105, 1 },
-        { 135, 21, 96, 66, 42, 180, 1 },
-        { 203, 9, 193, 48, 132, 240, 1 }, },
-      { { 161, 37, 174, 137, 93, 100, 1 },
-        { 102, 16, 146, 218, 70, 183, 1 },
-        { 147, 93, 72, 186, 210, 66, 1 },
-        { 246, 177, 45, 164, 132, 51, 0 }, },
-      { { 188, 234, 86, 10, 46, 231, 1 },
-        { 15, 206, 15, 60, 202, 174, 1 },
-        { 243, 186, 40, 53, 43, 158, 1 },
-        { 186, 169, 158, 120, 57, 248, 0 }, },
-      { { 194, 210, 70, 164, 139, 68, 0 },
-        { 132, 33, 49, 180, 27, 172, 0 },
-        { 17, 104, 146, 177, 37, 161, 1 },
-        { 26, 236, 22, 198, 66, 16, 1 }, },
-      { { 218, 226, 149, 139, 69, 176, 0 },
-        { 128, 90, 22, 199, 216, 110, 1 },
-        { 6, 209, 104, 212, 163, 173, 1 },
-        { 187, 13, 241, 180, 45, 0, 1 }, },
-      { { 236, 63, 99, 213, 29, 216, 0 },
-        { 85, 139, 211, 201, 119, 233, 0 },
-        { 13, 220, 85, 227, 126, 27, 1 },
-        { 75, 247, 73, 229, 232, 213, 0 }, },
-      { { 255, 105, 45, 60, 107, 15, 0 },
-        { 185, 182, 158, 61, 53, 182, 0 },
-        { 120, 107, 30, 90, 75, 127, 1 },
-        { 54, 214, 94, 60, 182, 206, 1 }, },
-      { { 0, 28, 79, 167, 70, 146, 1 },
-        { 98, 185, 9, 225, 195, 68, 0 },
-        { 164, 177, 114, 249, 28, 0, 0 },
-        { 17, 97, 195, 200, 78, 163, 0 }, },
-      { { 2, 24, 244, 93, 202, 150, 0 },
-        { 144, 217, 233, 114, 1, 198, 0 },
-        { 52, 169, 221, 23, 140, 32, 0 },
-        { 49, 192, 39, 75, 205, 132, 1 }, },
-      { { 3, 209, 163, 72, 235, 88, 0 },
-        { 140, 17, 240, 39, 46, 210, 0 },
-        { 13, 107, 137, 98, 197, 224, 0 },
-        { 37, 186, 114, 7, 196, 24, 1 }, },
-      { { 4, 27, 131, 253, 41, 154, 1 },
-        { 27, 169, 88, 195, 39, 202, 0 },
-        { 172, 202, 95, 224, 236, 16, 0 },
-        { 41, 242, 97, 141, 74, 236, 0 }, },
-      { { 9, 141, 142, 139, 148, 215, 1 },
-        { 102, 142, 40, 210, 206, 87, 0 },
-        { 245, 148, 232, 184, 216, 200, 0 },
-        { 117, 57, 165, 138, 56, 179, 0 }, },
-      { { 8, 163, 222, 26, 89, 139, 0 },
-        { 48, 94, 27, 2, 174, 143, 0 },
-        { 104, 205, 44, 61, 226, 136, 0 },
-        { 120, 186, 160, 108, 61, 6, 0 }, },
-      { { 11, 188, 12, 8, 32, 24, 0 },
-        { 232, 131, 2, 0, 40, 86, 0 },
-        { 12, 2, 8, 24, 30, 232, 0 },
-        { 53, 10, 0, 32, 96, 139, 1 }, },
-      { { 8, 180, 118, 44, 124, 199, 0 },
-        { 76, 127, 139, 16, 75, 135, 0 },
-        { 113, 159, 26, 55, 22, 136, 0 },
-        { 112, 233, 4, 104, 255, 25, 0 }, },
-      { { 8, 252, 181, 200, 85, 47, 1 },
-        { 66, 215, 218, 151, 104, 7, 1 },
-        { 250, 85, 9, 214, 159, 136, 0 },
-        { 240, 11, 116, 173, 245, 161, 0 }, },
-      { { 14, 22, 54, 84, 254, 34, 0 },
-        { 217, 83, 232, 32, 67, 141, 1 },
-        { 34, 63, 149, 54, 52, 56, 0 },
-        { 216, 225, 2, 11, 229, 77, 1 }, },
-      { { 18, 44, 177, 159, 7, 34, 1 },
-        { 210, 192, 158, 227, 193, 2, 1 },
-        { 162, 112, 124, 198, 154, 36, 0 },
-        { 160, 65, 227, 188, 129, 165, 1 }, },
-      { { 18, 69, 156, 171, 22, 232, 0 },
-        { 228, 104, 4, 230, 228, 7, 1 },
-        { 11, 180, 106, 156, 209, 36, 0 },
-        { 240, 19, 179, 144, 11, 19, 1 }, },
-      { { 19, 147, 126, 245, 174, 67, 1 },
-        { 190, 101, 237, 224, 79, 156, 0 },
-        { 225, 58, 215, 191, 100, 228, 0 },
-        { 28, 249, 3, 219, 211, 62, 1 }, },
-      { { 22, 41, 244, 18, 48, 140, 0 },
-        { 153, 200, 135, 18, 164, 5, 0 },
-        { 24, 134, 36, 23, 202, 52, 0 },
-        { 80, 18, 164, 112, 137, 204, 1 }, },
-      { { 21, 124, 103, 88, 122, 66, 0 },
-        { 93, 145, 207, 37, 2, 151, 0 },
-        { 33, 47, 13, 115, 31, 84, 0 },
-        { 116, 160, 82, 121, 196, 221, 0 }, },
-      { { 21, 204, 177, 89, 131, 214, 1 },
-        { 87, 200, 252, 119, 8, 82, 0 },
-        { 181, 224, 205, 70, 153, 212, 0 },
-        { 37, 8, 119, 31, 137, 245, 0 }, },
-      { { 23, 227, 47, 161, 221, 185, 0 },
-        { 161, 60, 182, 197, 110, 221, 1 },
-        { 78, 221, 194, 250, 99, 244, 0 },
-        { 221, 187, 81, 182, 158, 66, 1 }, },
-      { { 27, 70, 90, 142, 239, 10, 1 },
-        { 234, 82, 61, 164, 227, 154, 0 },
-        { 168, 123, 184, 173, 49, 108, 0 },
-        { 44, 227, 146, 222, 37, 43, 1 }, },
-      { { 27, 105, 78, 73, 179, 188, 1 },
-        { 170, 138, 119, 116, 38, 87, 1 },
-        { 158, 230, 201, 57, 75, 108, 0 },
-        { 245, 50, 23, 119, 40, 170, 1 }, },
-      { { 27, 196, 203, 219, 144, 138, 1 },
-        { 242, 10, 109, 199, 170, 19, 0 },
-        { 168, 132, 237, 233, 145, 236, 0 },
-        { 100, 42, 241, 219, 40, 39, 1 }, },
-      { { 31, 44, 109, 141, 119, 17, 1 },
-        { 235, 150, 151, 225, 65, 87, 0 },
-        { 196, 119, 88, 219, 26, 124, 0 },
-        { 117, 65, 67, 244, 180, 235, 1 }, },
-      { { 31, 87, 63, 15, 8, 234, 1 },
-        { 231, 75, 140, 69, 167, 158, 1 },
-        { 171, 136, 120, 126, 117, 124, 0 },
-        { 188, 242, 209, 24, 233, 115, 1 }, },
-      { { 28, 109, 100, 176, 216, 126, 1 },
-        { 87, 178, 175, 148, 36, 197, 1 },
-        { 191, 13, 134, 147, 91, 28, 0 },
-        { 209, 146, 20, 250, 166, 245, 0 }, },
-      { { 31, 214, 51, 233, 39, 78, 1 },
-        { 207, 99, 220, 245, 106, 26, 0 },
-        { 185, 114, 75, 230, 53, 252, 0 },
-        { 44, 43, 87, 157, 227, 121, 1 }, },
-      { { 31, 237, 94, 0, 105, 171, 1 },
-        { 235, 222, 31, 4, 46, 148, 1 },
-        { 234, 203, 0, 61, 91, 252, 0 },
-        { 148, 186, 16, 124, 61, 235, 1 }, },
-      { { 32, 25, 133, 43, 191, 166, 0 },
-        { 8, 169, 56, 123, 196, 135, 1 },
-        { 50, 254, 234, 80, 204, 2, 0 },
-        { 240, 145, 239, 14, 74, 136, 0 }, },
-      { { 34, 61, 51, 120, 7, 207, 0 },
-        { 212, 237, 218, 57, 102, 2, 0 },
-        { 121, 240, 15, 102, 94, 34, 0 },
-        { 32, 51, 78, 45, 219, 149, 1 }, },
-      { { 32, 99, 33, 28, 107, 49, 0 },
-        { 24, 20, 146, 45, 5, 202, 1 },
-        { 70, 107, 28, 66, 99, 2, 0 },
-        { 169, 208, 90, 36, 148, 12, 0 }, },
-      { { 34, 110, 87, 72, 118, 216, 1 },
-        { 206, 216, 67, 45, 98, 79, 0 },
-        { 141, 183, 9, 117, 59, 34, 0 },
-        { 121, 35, 90, 97, 13, 185, 1 }, },
-      { { 32, 116, 241, 178, 248, 194, 1 },
-        { 94, 121, 171, 143, 128, 129, 0 },
-        { 161, 143, 166, 199, 151, 2, 0 },
-        { 64, 128, 248, 234, 207, 61, 0 }, },
-      { { 33, 172, 61, 93, 237, 110, 0 },
-        { 124, 208, 250, 89, 105, 150, 1 },
-        { 59, 91, 221, 94, 26, 194, 0 },
-        { 180, 203, 77, 47, 133, 159, 0 }, },
-      { { 33, 195, 23, 29, 144, 62, 1 },
-        { 18, 64, 40, 93, 47, 95, 1 },
-        { 190, 4, 220, 116, 97, 194, 0 },
-        { 253, 122, 93, 10, 1, 36, 0 }, },
-      { { 39, 47, 226, 196, 67, 84, 0 },
-        { 197, 144, 211, 186, 7, 88, 0 },
-        { 21, 97, 17, 163, 250, 114, 0 },
-        { 13, 112, 46, 229, 132, 209, 1 }, },
-      { { 39, 159, 50, 224, 232, 133, 0 },
-        { 201, 253, 224, 152, 14, 152, 0 },
-        { 80, 139, 131, 166, 124, 242, 0 },
-        { 12, 184, 12, 131, 223, 201, 1 }, },
-      { { 38, 190, 33, 114, 154, 9, 1 },
-        { 211, 165, 226, 41, 168, 137, 0 },
-        { 200, 44, 167, 66, 62, 178, 0 },
-        { 72, 138, 202, 35, 210, 229, 1 }, },
-      { { 42, 3, 57, 247, 158, 125, 1 },
-        { 182, 102, 224, 249, 229, 201, 1 },
-        { 223, 60, 247, 206, 96, 42, 0 },
-        { 201, 211, 207, 131, 179, 54, 1 }, },
-      { { 43, 24, 147, 239, 72, 235, 0 },
-        { 132, 255, 72, 203, 163, 146, 1 },
-        { 107, 137, 123, 228, 140, 106, 0 },
-        { 164, 226, 233, 137, 127, 144, 1 }, },
-      { { 41, 20, 232, 100, 42, 8, 0 },
-        { 104, 35, 193, 42, 33, 144, 0 },
-        { 8, 42, 19, 11, 148, 74, 0 },
-        { 4, 194, 42, 65, 226, 11, 0 }, },
-      { { 41, 104, 166, 84, 120, 185, 0 },
-        { 24, 158, 194, 14, 35, 213, 1 },
-        { 78, 143, 21, 50, 139, 74, 0 },
-        { 213, 226, 56, 33, 188, 140, 0 }, },
-      { { 42, 193, 129, 37, 248, 55, 0 },
-        { 136, 54, 40, 95, 13, 193, 1 },
-        { 118, 15, 210, 64, 193, 170, 0 },
-        { 193, 216, 125, 10, 54, 8, 1 }, },
-      { { 40, 212, 32, 190, 102, 221, 1 },
-        { 94, 63, 128, 188, 233, 66, 0 },
-        { 221, 179, 62, 130, 21, 138, 0 },
-        { 33, 75, 158, 128, 254, 61, 0 }, },
-      { { 41, 251, 7, 40, 147, 64, 0 },
-        { 4, 163, 50, 45, 14, 31, 0 },
-        { 1, 100, 138, 112, 111, 202, 0 },
-        { 124, 56, 90, 38, 98, 144, 0 }, },
-      { { 45, 79, 27, 209, 68, 171, 0 },
-        { 113, 222, 72, 205, 102, 24, 1 },
-        { 106, 145, 69, 236, 121, 90, 0 },
-        { 140, 51, 89, 137, 61, 199, 0 }, },
-      { { 44, 77, 58, 93, 125, 209, 0 },
-        { 125, 222, 208, 76, 71, 195, 0 },
-        { 69, 223, 93, 46, 89, 26, 0 },
-        { 97, 241, 25, 5, 189, 223, 0 }, },
-      { { 46, 201, 163, 115, 80, 78, 1 },
-        { 151, 178, 200, 95, 174, 1, 0 },
-        { 185, 5, 103, 98, 201, 186, 0 },
-        { 64, 58, 253, 9, 166, 244, 1 }, },
-      { { 47, 242, 157, 56, 166, 39, 0 },
-        { 185, 103, 42, 63, 72, 30, 1 },
-        { 114, 50, 142, 92, 167, 250, 0 },
-        { 188, 9, 126, 42, 115, 78, 1 }, },
-      { { 51, 14, 242, 29, 118, 78, 0 },
-        { 220, 208, 141, 122, 99, 27, 0 },
-        { 57, 55, 92, 39, 184, 102, 0 },
-        { 108, 99, 47, 88, 133, 157, 1 }, },
-      { { 51, 46, 161, 171, 153, 4, 0 },
-        { 192, 160, 182, 219, 128, 155, 0 },
-        { 16, 76, 234, 194, 186, 102, 0 },
-        { 108, 128, 237, 182, 130, 129, 1 }, },
-      { { 49, 41, 200, 243, 224, 220, 1 },
-        { 62, 184, 103, 218, 164, 80, 0 },
-        { 157, 131, 231, 137, 202, 70, 0 },
-        { 5, 18, 173, 243, 14, 190, 0 }, },
-      { { 53, 0, 254, 245, 196, 8, 0 },
-        { 49, 112, 229, 202, 99, 20, 0 },
-        { 8, 17, 215, 191, 128, 86, 0 },
-        { 20, 99, 41, 211, 135, 70, 0 }, },
-      { { 55, 36, 110, 62, 36, 63, 0 },
-        { 249, 36, 143, 24, 227, 86, 1 },
-        { 126, 18, 62, 59, 18, 118, 0 },
-        { 181, 99, 140, 120, 146, 79, 1 }, },
-      { { 53, 81, 121, 197, 146, 92, 1 },
-        { 39, 65, 229, 253, 37, 81, 0 },
-        { 157, 36, 209, 207, 69, 86, 0 },
-        { 69, 82, 95, 211, 193, 114, 0 }, },
-      { { 54, 184, 189, 91, 81, 60, 0 },
-        { 177, 209, 214, 91, 168, 71, 1 },
-        { 30, 69, 109, 94, 142, 182, 0 },
-        { 241, 10, 237, 53, 197, 198, 1 }, },
-      { { 54, 221, 188, 202, 44, 119, 0 },
-        { 237, 197, 204, 158, 204, 198, 1 },
-        { 119, 26, 41, 158, 221, 182, 0 },
-        { 177, 153, 188, 153, 209, 219, 1 }, },
-      { { 55, 221, 249, 250, 116, 140, 0 },
-        { 249, 249, 197, 159, 236, 19, 0 },
-        { 24, 151, 47, 207, 221, 246, 0 },
-        { 100, 27, 252, 209, 207, 207, 1 }, },
-      { { 57, 8, 64, 158, 68, 97, 1 },
-        { 22, 150, 5, 136, 193, 18, 1 },
-        { 195, 17, 60, 129, 8, 78, 0 },
-        { 164, 65, 136, 208, 52, 180, 0 }, },
-      { { 59, 1, 93, 14, 177, 201, 1 },
-        { 174, 78, 53, 9, 165, 23, 0 },
-        { 201, 198, 184, 93, 64, 110, 0 },
-        { 116, 82, 200, 86, 57, 58, 1 }, },
-      { { 58, 14, 216, 225, 88, 0, 1 },
-        { 226, 242, 69, 202, 0, 137, 0 },
-        { 128, 13, 67, 141, 184, 46, 0 },
-        { 72, 128, 41, 209, 39, 163, 1 }, },
-      { { 56, 110, 40, 10, 241, 243, 1 },
-        { 110, 158, 190, 12, 128, 75, 1 },
-        { 231, 199, 168, 10, 59, 14, 0 },
-        { 233, 0, 152, 62, 188, 187, 0 }, },
-      { { 57, 97, 243, 168, 199, 88, 1 },
-        { 6, 114, 183, 175, 102, 82, 0 },
-        { 141, 113, 138, 231, 195, 78, 0 },
-        { 37, 51, 122, 246, 167, 48, 0 }, },
-      { { 57, 175, 5, 221, 138, 171, 1 },
-        { 82, 142, 110, 233, 45, 158, 1 },
-        { 234, 168, 221, 208, 122, 206, 0 },
-        { 188, 218, 75, 187, 56, 165, 0 }, },
-      { { 57, 172, 253, 140, 32, 166, 1 },
-        { 106, 202, 143, 155, 9, 22, 1 },
-        { 178, 130, 24, 223, 154, 206, 0 },
-        { 180, 72, 108, 248, 169, 171, 0 }, },
-      { { 56, 215, 227, 25, 189, 206, 1 },
-        { 94, 11, 189, 95, 110, 139, 0 },
-        { 185, 222, 204, 99, 245, 142, 0 },
-        { 104, 187, 125, 94, 232, 61, 0 }, },
-      { { 62, 29, 177, 174, 155, 223, 1 },
-        { 199, 239, 188, 187, 165, 195, 0 },
-        { 253, 236, 186, 198, 220, 62, 0 },
-        { 97, 210, 238, 158, 251, 241, 1 }, },
-      { { 63, 57, 54, 16, 131, 58, 1 },
-        { 147, 195, 190, 40, 38, 84, 1 },
-        { 174, 96, 132, 54, 78, 126, 0 },
-        { 149, 50, 10, 62, 225, 228, 1 }, },
-      { { 61, 68, 172, 103, 73, 121, 1 },
-        { 103, 54, 212, 78, 161, 212, 1 },
-        { 207, 73, 115, 26, 145, 94, 0 },
-        { 149, 194, 185, 21, 182, 115, 0 }, },
-      { { 62, 216, 120, 160, 212, 247, 1 },
-        { 167, 255, 173, 156, 72, 65, 1 },
-        { 247, 149, 130, 143, 13, 190, 0 },
-        { 193, 9, 28, 218, 255, 242, 1 }, },
-      { { 67, 45, 92, 111, 10, 140, 0 },
-        { 224, 232, 67, 112, 181, 150, 0 },
-        { 24, 168, 123, 29, 90, 97, 0 },
-        { 52, 214, 135, 97, 11, 131, 1 }, },
-      { { 66, 52, 3, 145, 156, 82, 1 },
-        { 214, 1, 42, 193, 82, 193, 0 },
-        { 165, 28, 196, 224, 22, 33, 0 },
-        { 65, 165, 65, 170, 64, 53, 1 }, },
-      { { 64, 59, 107, 130, 137, 239, 0 },
-        { 36, 141, 187, 145, 182, 136, 1 },
-        { 123, 200, 160, 235, 110, 1, 0 },
-        { 136, 182, 196, 238, 216, 146, 0 }, },
-      { { 67, 109, 145, 73, 70, 116, 0 },
-        { 196, 208, 66, 119, 84, 82, 1 },
-        { 23, 49, 73, 68, 219, 97, 0 },
-        { 165, 21, 119, 33, 5, 145, 1 }, },
-      { { 67, 151, 133, 107, 233, 44, 1 },
-        { 202, 49, 112, 83, 188, 158, 1 },
-        { 154, 75, 235, 80, 244, 225, 0 },
-        { 188, 158, 229, 7, 70, 41, 1 }, },
-      { { 71, 29, 159, 177, 209, 0, 1 },
-        { 243, 241, 48, 195, 22, 21, 0 },
-        { 128, 69, 198, 252, 220, 113, 0 },
-        { 84, 52, 97, 134, 71, 231, 1 }, },
-      { { 70, 43, 251, 166, 87, 121, 0 },
-        { 165, 244, 147, 163, 247, 73, 1 },
-        { 79, 117, 50, 239, 234, 49, 0 },
-        { 201, 119, 226, 228, 151, 210, 1 }, },
-      { { 70, 92, 73, 248, 0, 58, 1 },
-        { 243, 161, 73, 133, 48, 66, 1 },
-        { 174, 0, 15, 201, 29, 49, 0 },
-        { 161, 6, 80, 201, 66, 231, 1 }, },
-      { { 69, 118, 247, 32, 48, 38, 1 },
-        { 75, 97, 139, 23, 18, 29, 1 },
-        { 178, 6, 2, 119, 183, 81, 0 },
-        { 220, 36, 116, 104, 195, 105, 0 }, },
-      { { 70, 168, 40, 69, 154, 252, 0 },
-        { 165, 136, 226, 112, 57, 193, 1 },
-        { 31, 172, 209, 10, 10, 177, 0 },
-        { 193, 206, 7, 35, 136, 210, 1 }, },
-      { { 68, 160, 107, 94, 1, 10, 0 },
-        { 49, 0, 219, 1, 187, 2, 0 },
-        { 40, 64, 61, 107, 2, 145, 0 },
-        { 32, 110, 192, 109, 128, 70, 0 }, },
-      { { 69, 185, 78, 113, 53, 37, 0 },
-        { 57, 165, 83, 80, 94, 21, 1 },
-        { 82, 86, 71, 57, 78, 209, 0 },
-        { 212, 61, 5, 101, 82, 206, 0 }, },
-      { { 75, 113, 215, 160, 253, 197, 1 },
-        { 142, 127, 51, 151, 86, 149, 0 },
-        { 209, 223, 130, 245, 199, 105, 0 },
-        { 84, 181, 116, 230, 127, 56, 1 }, },
-      { { 79, 60, 121, 82, 108, 209, 1 },
-        { 255, 223, 195, 1, 208, 208, 0 },
-        { 197, 155, 37, 79, 30, 121, 0 },
-        { 5, 133, 192, 97, 253, 255, 1 }, },
-      { { 79, 178, 80, 33, 70, 98, 0 },
-        { 133, 115, 11, 96, 88, 24, 1 },
-        { 35, 49, 66, 5, 38, 249, 0 },
-        { 140, 13, 3, 104, 103, 80, 1 }, },
-      { { 79, 239, 177, 247, 108, 238, 1 },
-        { 223, 250, 202, 215, 253, 152, 1 },
-        { 187, 155, 119, 198, 251, 249, 0 },
-        { 140, 223, 245, 169, 175, 253, 1 }, },
-      { { 82, 75, 82, 250, 189, 204, 0 },
-        { 156, 232, 117, 148, 246, 139, 0 },
-        { 25, 222, 175, 165, 105, 37, 0 },
-        { 104, 183, 148, 215, 11, 156, 1 }, },
-      { { 83, 200, 244, 221, 123, 200, 1 },
-        { 158, 216, 213, 230, 57, 151, 0 },
-        { 137, 239, 93, 151, 137, 229, 0 },
-        { 116, 206, 51, 213, 141, 188, 1 }, },
-      { { 87, 5, 99, 141, 134, 48, 0 },
-        { 193, 0, 165, 225, 87, 82, 1 },
-        { 6, 48, 216, 227, 80, 117, 0 },
-        { 165, 117, 67, 210, 128, 65, 1 }, },
-      { { 85, 75, 225, 85, 227, 0, 0 },
-        { 25, 144, 245, 103, 21, 24, 0 },
-        { 0, 99, 213, 67, 233, 85, 0 },
-        { 12, 84, 115, 87, 132, 204, 0 }, },
-      { { 85, 138, 47, 175, 183, 98, 0 },
-        { 45, 160, 188, 225, 219, 31, 1 },
-        { 35, 118, 250, 250, 40, 213, 0 },
-        { 252, 109, 195, 158, 130, 218, 0 }, },
-      { { 84, 153, 49, 31, 160, 83, 0 },
-        { 29, 197, 172, 65, 157, 66, 0 },
-        { 101, 2, 252, 70, 76, 149, 0 },
-        { 33, 92, 193, 26, 209, 220, 0 }, },
-      { { 88, 13, 255, 122, 69, 176, 1 },
-        { 114, 250, 213, 3, 214, 70, 1 },
-        { 134, 209, 47, 127, 216, 13, 0 },
-        { 177, 53, 224, 85, 175, 167, 0 }, },
-      { { 90, 18, 17, 208, 247, 52, 1 },
-        { 154, 83, 116, 177, 80, 73, 1 },
-        { 150, 119, 133, 196, 36, 45, 0 },
-        { 201, 5, 70, 151, 101, 44, 1 }, },
-      { { 95, 17, 24, 22, 24, 164, 0 },
-        { 177, 75, 4, 16, 149, 145, 1 },
-        { 18, 140, 52, 12, 68, 125, 0 },
-        { 196, 212, 132, 16, 105, 70, 1 }, },
-      { { 93, 61, 87, 179, 227, 47, 0 },
-        { 89, 247, 63, 241, 182, 20, 1 },
-        { 122, 99, 230, 245, 94, 93, 0 },
-        { 148, 54, 199, 254, 119, 205, 0 }, },
-      { { 93, 74, 155, 244, 162, 166, 0 },
-        { 57, 234, 108, 183, 19, 24, 1 },
-        { 50, 162, 151, 236, 169, 93, 0 },
-        { 140, 100, 118, 155, 43, 206, 0 }, },
-      { { 94, 137, 78, 179, 16, 89, 0 },
-        { 181, 166, 5, 192, 190, 69, 0 },
-        { 77, 4, 102, 185, 72, 189, 0 },
-        { 81, 62, 129, 208, 50, 214, 1 }, },
-      { { 95, 182, 4, 116, 142, 30, 1 },
-        { 211, 35, 110, 48, 121, 220, 0 },
-        { 188, 56, 151, 16, 54, 253, 0 },
-        { 29, 207, 6, 59, 98, 101, 1 }, },
-      { { 95, 252, 162, 7, 10, 47, 1 },
-        { 195, 135, 142, 118, 187, 144, 1 },
-        { 250, 40, 112, 34, 159, 253, 0 },
-        { 132, 238, 183, 56, 240, 225, 1 }, },
-      { { 98, 20, 52, 163, 198, 43, 1 },
-        { 194, 117, 168, 232, 240, 4, 1 },
-        { 234, 49, 226, 150, 20, 35, 0 },
-        { 144, 7, 139, 138, 215, 33, 1 }, },
-      { { 96, 69, 249, 159, 75, 213, 0 },
-        { 116, 92, 145, 255, 149, 194, 0 },
-        { 85, 233, 124, 207, 209, 3, 0 },
-        { 33, 212, 255, 196, 157, 23, 0 }, },
-      { { 96, 94, 235, 202, 23, 75, 1 },
-        { 102, 133, 217, 175, 242, 11, 0 },
-        { 233, 116, 41, 235, 189, 3, 0 },
-        { 104, 39, 250, 205, 208, 179, 0 }, },
-      { { 97, 111, 101, 43, 244, 79, 0 },
-        { 76, 180, 171, 93, 244, 31, 0 },
-        { 121, 23, 234, 83, 123, 67, 0 },
-        { 124, 23, 221, 106, 150, 153, 0 }, },
-      { { 96, 111, 231, 237, 175, 53, 0 },
-        { 72, 164, 243, 255, 87, 206, 1 },
-        { 86, 122, 219, 243, 251, 3, 0 },
-        { 185, 245, 127, 231, 146, 137, 0 }, },
-      { { 98, 227, 54, 39, 167, 213, 0 },
-        { 140, 108, 178, 124, 223, 76, 0 },
-        { 85, 242, 242, 54, 99, 163, 0 },
-        { 25, 125, 159, 38, 155, 24, 1 }, },
-      { { 101, 50, 13, 146, 242, 6, 0 },
-        { 57, 17, 42, 185, 144, 29, 0 },
-        { 48, 39, 164, 216, 38, 83, 0 },
-        { 92, 4, 206, 170, 68, 78, 0 }, },
-      { { 101, 174, 116, 178, 81, 246, 0 },
-        { 85, 248, 155, 152, 152, 93, 1 },
-        { 55, 197, 38, 151, 58, 211, 0 },
-        { 221, 12, 140, 236, 143, 213, 0 }, },
-      { { 106, 37, 233, 73, 31, 2, 1 },
-        { 226, 2, 219, 107, 84, 131, 0 },
-        { 160, 124, 73, 75, 210, 43, 0 },
-        { 96, 149, 107, 109, 160, 35, 1 }, },
-      { { 105, 154, 22, 139, 171, 78, 0 },
-        { 12, 195, 56, 248, 186, 158, 0 },
-        { 57, 106, 232, 180, 44, 203, 0 },
-        { 60, 174, 143, 142, 97, 152, 0 }, },
-      { { 104, 159, 185, 186, 26, 80, 0 },
-        { 116, 227, 128, 171, 156, 203, 0 },
-        { 5, 44, 46, 206, 252, 139, 0 },
-        { 105, 156, 234, 128, 227, 151, 0 }, },
-      { { 104, 172, 27, 248, 226, 27, 1 },
-        { 122, 246, 106, 169, 58, 66, 0 },
-        { 236, 35, 143, 236, 26, 139, 0 },
-        { 33, 46, 74, 171, 55, 175, 0 }, },
-      { { 107, 204, 220, 27, 224, 85, 0 },
-        { 252, 214, 33, 94, 152, 86, 0 },
-        { 85, 3, 236, 29, 153, 235, 0 },
-        { 53, 12, 189, 66, 53, 159, 1 }, },
-      { { 110, 70, 68, 174, 42, 27, 1 },
-        { 203, 38, 9, 172, 177, 206, 0 },
-        { 236, 42, 58, 145, 49, 59, 0 },
-        { 57, 198, 154, 200, 50, 105, 1 }, },
-      { { 110, 91, 221, 156, 85, 145, 1 },
-        { 179, 223, 17, 143, 85, 79, 0 },
-        { 196, 213, 28, 221, 237, 59, 0 },
-        { 121, 85, 120, 196, 125, 230, 1 }, },
-      { { 110, 114, 103, 14, 62, 109, 0 },
-        { 141, 7, 131, 61, 243, 143, 1 },
-        { 91, 62, 56, 115, 39, 59, 0 },
-        { 248, 231, 222, 96, 240, 88, 1 }, },
-      { { 111, 134, 147, 35, 45, 171, 0 },
-        { 201, 110, 24, 75, 250, 152, 1 },
-        { 106, 218, 98, 100, 176, 251, 0 },
-        { 140, 175, 233, 12, 59, 73, 1 }, },
-      { { 108, 137, 244, 64, 218, 114, 1 },
-        { 7, 210, 233, 42, 28, 197, 1 },
-        { 167, 45, 129, 23, 200, 155, 0 },
-        { 209, 156, 42, 75, 165, 240, 0 }, },
-      { { 111, 156, 82, 187, 178, 211, 1 },
-        { 223, 239, 41, 232, 154, 83, 0 },
-        { 229, 166, 238, 165, 28, 251, 0 },
-        { 101, 44, 139, 202, 123, 253, 1 }, },
-      { { 111, 148, 127, 90, 90, 175, 1 },
-        { 243, 95, 201, 57, 186, 151, 1 },
-        { 250, 173, 45, 127, 20, 251, 0 },
-        { 244, 174, 206, 73, 253, 103, 1 }, },
-      { { 110, 168, 22, 55, 188, 108, 1 },
-        { 159, 226, 34, 88, 251, 133, 1 },
-        { 155, 30, 246, 52, 10, 187, 0 },
-        { 208, 239, 141, 34, 35, 252, 1 }, },
-      { { 110, 177, 138, 108, 23, 81, 0 },
-        { 165, 39, 82, 42, 95, 67, 0 },
-        { 69, 116, 27, 40, 198, 187, 0 },
-        { 97, 125, 42, 37, 114, 82, 1 }, },
-      { { 111, 200, 142, 200, 247, 162, 0 },
-        { 169, 154, 120, 174, 90, 23, 1 },
-        { 34, 247, 137, 184, 137, 251, 0 },
-        { 244, 45, 58, 143, 44, 202, 1 }, },
-      { { 115, 81, 80, 190, 35, 239, 0 },
-        { 156, 109, 29, 188, 181, 18, 1 },
-        { 123, 226, 62, 133, 69, 103, 0 },
-        { 164, 86, 158, 220, 91, 28, 1 }, },
-      { { 112, 139, 71, 240, 27, 189, 0 },
-        { 16, 172, 85, 185, 62, 205, 1 },
-        { 94, 236, 7, 241, 104, 135, 0 },
-        { 217, 190, 78, 213, 26, 132, 0 }, },
-      { { 112, 149, 37, 251, 26, 110, 1 },
-        { 86, 33, 204, 249, 188, 135, 1 },
-        { 187, 44, 111, 210, 84, 135, 0 },
-        { 240, 158, 207, 153, 194, 53, 0 }, },
-      { { 114, 158, 255, 114, 99, 90, 0 },
-        { 252, 241, 221, 43, 186, 76, 0 },
-        { 45, 99, 39, 127, 188, 167, 0 },
-        { 25, 46, 234, 93, 199, 159, 1 }, },
-      { { 112, 171, 227, 124, 150, 208, 1 },
-        { 22, 168, 231, 43, 95, 75, 0 },
-        { 133, 180, 159, 99, 234, 135, 0 },
-        { 105, 125, 106, 115, 138, 180, 0 }, },
-      { { 114, 245, 151, 82, 179, 142, 0 },
-        { 216, 73, 126, 63, 190, 5, 0 },
-        { 56, 230, 165, 116, 215, 167, 0 },
-        { 80, 62, 254, 63, 73, 13, 1 }, },
-      { { 118, 5, 164, 230, 226, 221, 0 },
-        { 205, 60, 228, 186, 181, 68, 0 },
-        { 93, 163, 179, 146, 208, 55, 0 },
-        { 17, 86, 174, 147, 158, 89, 1 }, },
-      { { 116, 17, 6, 76, 105, 165, 0 },
-        { 9, 29, 84, 24, 23, 134, 1 },
-        { 82, 203, 25, 48, 68, 23, 0 },
-        { 176, 244, 12, 21, 92, 72, 0 }, },
-      { { 118, 36, 17, 60, 244, 246, 1 },
-        { 223, 120, 46, 25, 81, 67, 1 },
-        { 183, 151, 158, 68, 18, 55, 0 },
-        { 225, 69, 76, 58, 15, 125, 1 }, },
-      { { 116, 101, 193, 88, 187, 101, 1 },
-        { 95, 4, 119, 63, 20, 131, 1 },
-        { 211, 110, 141, 65, 211, 23, 0 },
-        { 224, 148, 126, 119, 16, 125, 0 }, },
-      { { 119, 125, 91, 58, 188, 225, 0 },
-        { 253, 237, 39, 13, 214, 147, 1 },
-        { 67, 158, 174, 109, 95, 119, 0 },
-        { 228, 181, 216, 114, 91, 223, 1 }, },
-      { { 119, 182, 15, 188, 123, 59, 0 },
-        { 249, 53, 30, 169, 59, 223, 1 },
-        { 110, 111, 30, 248, 54, 247, 0 },
-        { 253, 238, 74, 188, 86, 79, 1 }, },
-      { { 118, 180, 133, 0, 61, 168, 1 },
-        { 203, 9, 22, 11, 120, 133, 1 },
-        { 138, 222, 0, 80, 150, 183, 0 },
-        { 208, 143, 104, 52, 72, 105, 1 }, },
-      { { 117, 238, 187, 75, 14, 98, 1 },
-        { 103, 192, 206, 111, 218, 154, 1 },
-        { 163, 56, 105, 110, 187, 215, 0 },
-        { 172, 173, 251, 57, 129, 243, 0 }, },
-      { { 118, 250, 208, 216, 178, 184, 0 },
-        { 153, 201, 103, 174, 56, 75, 1 },
-        { 14, 166, 141, 133, 175, 183, 0 },
-        { 233, 14, 58, 243, 73, 204, 1 }, },
-      { { 120, 75, 97, 130, 218, 8, 1 },
-        { 2, 146, 165, 173, 180, 137, 0 },
-        { 136, 45, 160, 195, 105, 15, 0 },
-        { 72, 150, 218, 210, 164, 160, 0 }, },
-      { { 122, 187, 251, 47, 52, 31, 1 },
-        { 170, 231, 143, 91, 255, 75, 0 },
-        { 252, 22, 122, 111, 238, 175, 0 },
-        { 105, 127, 237, 120, 243, 170, 1 }, },
-      { { 127, 39, 5, 215, 84, 100, 0 },
-        { 213, 18, 70, 217, 213, 29, 1 },
-        { 19, 21, 117, 208, 114, 127, 0 },
-        { 220, 85, 205, 177, 36, 85, 1 }, },
-      { { 125, 227, 180, 31, 248, 152, 0 },
-        { 25, 90, 166, 78, 189, 223, 0 },
-        { 12, 143, 252, 22, 227, 223, 0 },
-        { 125, 222, 185, 50, 173, 76, 0 }, },
-      { { 127, 237, 141, 135, 251, 207, 1 },
-        { 239, 158, 62, 255, 189, 149, 0 },
-        { 249, 239, 240, 216, 219, 255, 0 },
-        { 84, 222, 255, 190, 60, 251, 1 }, },
-      { { 126, 246, 82, 55, 17, 197, 0 },
-        { 213, 111, 23, 92, 155, 9, 0 },
-        { 81, 196, 118, 37, 55, 191, 0 },
-        { 72, 108, 157, 116, 123, 85, 1 }, },
-      { { 129, 31, 240, 203, 185, 104, 1 },
-        { 78, 193, 241, 194, 164, 187, 1 },
-        { 139, 78, 233, 135, 252, 64, 1 },
-        { 238, 146, 161, 199, 193, 185, 0 }, },
-      { { 128, 46, 234, 6, 149, 52, 0 },
-        { 96, 128, 179, 18, 195, 105, 1 },
-        { 22, 84, 176, 43, 186, 0, 1 },
-        { 203, 97, 164, 102, 128, 131, 0 }, },
-      { { 130, 73, 255, 59, 138, 203, 1 },
-        { 182, 236, 169, 103, 166, 166, 0 },
-        { 233, 168, 238, 127, 201, 32, 1 },
-        { 50, 178, 243, 74, 155, 182, 1 }, },
-      { { 129, 200, 212, 49, 219, 37, 0 },
-        { 16, 244, 49, 118, 8, 181, 1 },
-        { 82, 109, 198, 21, 137, 192, 1 },
-        { 214, 136, 55, 70, 23, 132, 0 }, },
-      { { 132, 43, 15, 88, 160, 122, 0 },
-        { 61, 128, 106, 1, 38, 110, 1 },
-        { 47, 2, 141, 120, 106, 16, 1 },
-        { 187, 50, 64, 43, 0, 222, 0 }, },
-      { { 133, 43, 127, 179, 216, 14, 0 },
-        { 49, 240, 171, 209, 166, 189, 0 },
-        { 56, 13, 230, 255, 106, 80, 1 },
-        { 94, 178, 197, 234, 135, 198, 0 }, },
-      { { 134, 32, 167, 236, 235, 192, 1 },
-        { 143, 56, 242, 163, 3, 166, 0 },
-        { 129, 235, 155, 242, 130, 48, 1 },
-        { 50, 224, 98, 167, 142, 120, 1 }, },
-      { { 134, 89, 195, 75, 94, 119, 1 },
-        { 135, 149, 73, 119, 198, 227, 1 },
-        { 247, 61, 105, 97, 205, 48, 1 },
-        { 227, 177, 247, 73, 84, 240, 1 }, },
-      { { 135, 96, 6, 117, 87, 9, 0 },
-        { 145, 52, 82, 100, 99, 53, 0 },
-        { 72, 117, 87, 48, 3, 112, 1 },
-        { 86, 99, 19, 37, 22, 68, 1 }, },
-      { { 132, 219, 148, 26, 247, 200, 0 },
-        { 29, 217, 48, 38, 236, 47, 0 },
-        { 9, 247, 172, 20, 237, 144, 1 },
-        { 122, 27, 178, 6, 77, 220, 0 }, },
-      { { 138, 22, 181, 10, 57, 125, 0 },
-        { 204, 71, 144, 19, 160, 239, 1 },
-        { 95, 78, 40, 86, 180, 40, 1 },
-        { 251, 130, 228, 4, 241, 25, 1 }, },
-      { { 138, 63, 78, 17, 183, 8, 0 },
-        { 248, 131, 51, 96, 102, 45, 0 },
-        { 8, 118, 196, 57, 126, 40, 1 },
-        { 90, 51, 3, 102, 96, 143, 1 }, },
-      { { 137, 70, 134, 138, 98, 190, 0 },
-        { 72, 26, 8, 182, 162, 126, 1 },
-        { 62, 163, 40, 176, 177, 72, 1 },
-        { 191, 34, 182, 136, 44, 9, 0 }, },
-      { { 139, 122, 129, 163, 127, 219, 0 },
-        { 140, 191, 26, 231, 224, 249, 0 },
-        { 109, 255, 98, 192, 175, 104, 1 },
-        { 79, 131, 243, 172, 126, 152, 1 }, },
-      { { 137, 134, 220, 73, 174, 214, 0 },
-        { 108, 74, 105, 114, 72, 254, 0 },
-        { 53, 186, 201, 29, 176, 200, 1 },
-        { 63, 137, 39, 75, 41, 27, 0 }, },
-      { { 137, 153, 52, 70, 112, 178, 1 },
-        { 10, 219, 200, 0, 141, 117, 1 },
-        { 166, 135, 49, 22, 76, 200, 1 },
-        { 215, 88, 128, 9, 237, 168, 0 }, },
-      { { 139, 205, 202, 224, 85, 9, 1 },
-        { 226, 182, 81, 134, 110, 49, 0 },
-        { 200, 85, 3, 169, 217, 232, 1 },
-        { 70, 59, 48, 197, 54, 163, 1 }, },
-      { { 139, 222, 241, 118, 82, 104, 1 },
-        { 214, 243, 193, 39, 169, 57, 1 },
-        { 139, 37, 55, 71, 189, 232, 1 },
-        { 206, 74, 242, 65, 231, 181, 1 }, },
-      { { 142, 18, 98, 26, 198, 81, 1 },
-        { 151, 23, 161, 32, 194, 106, 0 },
-        { 197, 49, 172, 35, 36, 56, 1 },
-        { 43, 33, 130, 66, 244, 116, 1 }, },
-      { { 141, 46, 148, 181, 204, 168, 0 },
-        { 81, 250, 34, 194, 97, 188, 1 },
-        { 10, 153, 214, 148, 186, 88, 1 },
-        { 158, 195, 33, 162, 47, 197, 0 }, },
-      { { 140, 75, 185, 11, 82, 34, 0 },
-        { 33, 210, 136, 103, 132, 43, 1 },
-        { 34, 37, 104, 78, 233, 24, 1 },
-        { 234, 16, 243, 8, 165, 194, 0 }, },
-      { { 141, 153, 201, 208, 216, 171, 1 },
-        { 51, 159, 105, 131, 44, 177, 1 },
-        { 234, 141, 133, 201, 204, 216, 1 },
-        { 198, 154, 96, 203, 124, 230, 0 }, },
-      { { 144, 17, 129, 73, 60, 185, 1 },
-        { 10, 13, 68, 67, 100, 227, 1 },
-        { 206, 158, 73, 64, 196, 4, 1 },
-        { 227, 147, 97, 17, 88, 40, 0 }, },
-      { { 146, 45, 168, 84, 94, 84, 1 },
-        { 246, 144, 198, 50, 69, 225, 0 },
-        { 149, 61, 21, 10, 218, 36, 1 },
-        { 67, 209, 38, 49, 132, 183, 1 }, },
-      { { 144, 78, 120, 161, 56, 250, 1 },
-        { 110, 232, 141, 196, 32, 233, 1 },
-        { 175, 142, 66, 143, 57, 4, 1 },
-        { 203, 130, 17, 216, 139, 187, 0 }, },
-      { { 144, 151, 90, 16, 127, 241, 0 },
-        { 124, 93, 21, 32, 78, 233, 1 },
-        { 71, 255, 4, 45, 116, 132, 1 },
-        { 203, 185, 2, 84, 93, 31, 0 }, },
-      { { 144, 179, 61, 187, 100, 42, 0 },
-        { 56, 113, 142, 193, 236, 46, 1 },
-        { 42, 19, 110, 222, 102, 132, 1 },
-        { 186, 27, 193, 184, 199, 14, 0 }, },
-      { { 147, 192, 227, 79, 19, 241, 0 },
-        { 132, 12, 213, 103, 139, 115, 1 },
-        { 71, 228, 121, 99, 129, 228, 1 },
-        { 231, 104, 243, 85, 152, 16, 1 }, },
-      { { 151, 73, 34, 81, 12, 38, 0 },
-        { 145, 128, 204, 84, 70, 176, 1 },
-        { 50, 24, 69, 34, 73, 116, 1 },
-        { 134, 177, 21, 25, 128, 196, 1 }, },
-      { { 151, 74, 87, 164, 6, 195, 0 },
-        { 133, 236, 13, 165, 67, 60, 0 },
-        { 97, 176, 18, 245, 41, 116, 1 },
-        { 30, 97, 82, 216, 27, 208, 1 }, },
-      { { 150, 115, 104, 38, 246, 150, 1 },
-        { 171, 57, 175, 52, 197, 105, 0 },
-        { 180, 183, 178, 11, 103, 52, 1 },
-        { 75, 81, 150, 122, 206, 106, 1 }, },
-      { { 149, 138, 223, 218, 96, 3, 1 },
-        { 59, 212, 77, 131, 138, 62, 0 },
-        { 224, 3, 45, 253, 168, 212, 1 },
-        { 62, 40, 224, 217, 21, 238, 0 }, },
-      { { 150, 175, 46, 35, 58, 45, 0 },
-        { 233, 164, 134, 112, 174, 173, 1 },
-        { 90, 46, 98, 58, 122, 180, 1 },
-        { 218, 186, 135, 48, 146, 203, 1 }, },
-      { { 155, 7, 68, 229, 222, 47, 0 },
-        { 192, 54, 109, 240, 101, 189, 1 },
-        { 122, 61, 211, 145, 112, 108, 1 },
-        { 222, 211, 7, 219, 54, 1, 1 }, },
-      { { 152, 75, 88, 148, 206, 180, 0 },
-        { 48, 218, 37, 180, 69, 232, 1 },
-        { 22, 185, 148, 141, 105, 12, 1 },
-        { 139, 209, 22, 210, 45, 134, 0 }, },
-      { { 153, 122, 202, 55, 11, 119, 1 },
-        { 54, 167, 31, 118, 131, 248, 1 },
-        { 247, 104, 118, 41, 175, 76, 1 },
-        { 143, 224, 183, 124, 114, 182, 0 }, },
-      { { 156, 0, 144, 208, 133, 65, 1 },
-        { 23, 70, 116, 130, 64, 32, 0 },
-        { 193, 80, 133, 132, 128, 28, 1 },
-        { 2, 1, 32, 151, 49, 116, 0 }, },
-      { { 157, 117, 4, 69, 227, 242, 1 },
-        { 79, 27, 126, 100, 5, 116, 1 },
-        { 167, 227, 209, 16, 87, 92, 1 },
-        { 151, 80, 19, 63, 108, 121, 0 }, },
-      { { 160, 66, 244, 31, 20, 137, 1 },
-        { 18, 76, 129, 78, 225, 47, 0 },
-        { 200, 148, 124, 23, 161, 2, 1 },
-        { 122, 67, 185, 64, 153, 36, 0 }, },
-      { { 160, 154, 32, 41, 137, 97, 0 },
-        { 4, 165, 176, 72, 8, 170, 1 },
-        { 67, 72, 202, 2, 44, 130, 1 },
-        { 170, 136, 9, 6, 210, 144, 0 }, },
-      { { 161, 151, 65, 181, 6, 20, 0 },
-        { 80, 33, 1, 249, 77, 120, 0 },
-        { 20, 48, 86, 193, 116, 194, 1 },
-        { 15, 89, 79, 192, 66, 5, 0 }, },
-      { { 162, 199, 179, 237, 218, 219, 0 },
-        { 196, 124, 232, 239, 47, 235, 0 },
-        { 109, 173, 219, 230, 241, 162, 1 },
-        { 107, 250, 123, 139, 159, 17, 1 }, },
-      { { 163, 237, 115, 3, 171, 156, 0 },
-        { 200, 200, 179, 125, 174, 240, 0 },
-        { 28, 234, 224, 103, 91, 226, 1 },
-        { 7, 186, 223, 102, 137, 137, 1 }, },
-      { { 164, 14, 153, 123, 197, 24, 0 },
-        { 113, 240, 112, 75, 224, 106, 0 },
-        { 12, 81, 239, 76, 184, 18, 1 },
-        { 43, 3, 233, 7, 7, 199, 0 }, },
-      { { 166, 46, 211, 181, 170, 239, 0 },
-        { 221, 236, 43, 251, 35, 168, 1 },
-        { 123, 170, 214, 229, 186, 50, 1 },
-        { 138, 226, 111, 234, 27, 221, 1 }, },
-      { { 166, 72, 83, 81, 97, 91, 1 },
-        { 159, 212, 89, 77, 34, 96, 0 },
-        { 237, 67, 69, 101, 9, 50, 1 },
-        { 3, 34, 89, 77, 21, 252, 1 }, },
-      { { 166, 88, 46, 241, 183, 120, 1 },
-        { 191, 161, 240, 236, 98, 101, 1 },
-        { 143, 118, 199, 186, 13, 50, 1 },
-        { 211, 35, 27, 135, 194, 254, 1 }, },
-      { { 167, 125, 62, 203, 3, 105, 0 },
-        { 229, 197, 210, 236, 166, 54, 1 },
-        { 75, 96, 105, 190, 95, 114, 1 },
-        { 182, 50, 155, 165, 209, 211, 1 }, },
-      { { 165, 183, 40, 12, 100, 157, 0 },
-        { 105, 29, 130, 24, 109, 122, 0 },
-        { 92, 147, 24, 10, 118, 210, 1 },
-        { 47, 91, 12, 32, 220, 75, 0 }, },
-      { { 164, 207, 91, 78, 212, 244, 0 },
-        { 101, 216, 97, 29, 207, 107, 1 },
-        { 23, 149, 185, 109, 121, 146, 1 },
-        { 235, 121, 220, 67, 13, 211, 0 }, },
-      { { 171, 21, 211, 205, 48, 133, 0 },
-        { 200, 79, 65, 219, 7, 51, 0 },
-        { 80, 134, 89, 229, 212, 106, 1 },
-        { 102, 112, 109, 193, 121, 9, 1 }, },
-      { { 171, 47, 103, 30, 208, 8, 1 },
-        { 210, 146, 163, 9, 167, 63, 0 },
-        { 136, 5, 188, 115, 122, 106, 1 },
-        { 126, 114, 200, 98, 164, 165, 1 }, },
-      { { 168, 43, 177, 100, 80, 17, 1 },
-        { 2, 246, 194, 11, 5, 105, 0 },
-        { 196, 5, 19, 70, 234, 10, 1 },
-        { 75, 80, 104, 33, 183, 160, 0 }, },
-      { { 168, 67, 58, 121, 199, 250, 1 },
-        { 54, 122, 248, 108, 102, 106, 1 },
-        { 175, 241, 207, 46, 97, 10, 1 },
-        { 171, 51, 27, 15, 175, 54, 0 }, },
-      { { 168, 95, 145, 245, 169, 81, 0 },
-        { 92, 231, 112, 207, 5, 232, 0 },
-        { 69, 74, 215, 196, 253, 10, 1 },
-        { 11, 208, 121, 135, 115, 157, 0 }, },
-      { { 168, 126, 123, 132, 128, 94, 1 },
-        { 102, 195, 171, 157, 35, 104, 0 },
-        { 189, 0, 144, 239, 63, 10, 1 },
-        { 11, 98, 92, 234, 225, 179, 0 }, },
-      { { 168, 132, 121, 195, 96, 56, 1 },
-        { 106, 82, 193, 201, 168, 96, 1 },
-        { 142, 3, 97, 207, 16, 138, 1 },
-        { 131, 10, 201, 193, 165, 43, 0 }, },
-      { { 171, 163, 68, 207, 130, 112, 0 },
-        { 132, 2, 99, 232, 141, 126, 1 },
-        { 7, 32, 249, 145, 98, 234, 1 },
-        { 191, 88, 139, 227, 32, 16, 1 }, },
-      { { 171, 230, 49, 247, 179, 118, 0 },
-        { 220, 98, 250, 253, 137, 121, 1 },
-        { 55, 102, 247, 198, 51, 234, 1 },
-        { 207, 72, 223, 175, 163, 29, 1 }, },
-      { { 172, 22, 16, 22, 73, 151, 0 },
-        { 81, 95, 24, 24, 129, 232, 0 },
-        { 116, 201, 52, 4, 52, 26, 1 },
-        { 11, 192, 140, 12, 125, 69, 0 }, },
-      { { 174, 39, 216, 18, 235, 36, 1 },
-        { 251, 82, 51, 58, 132, 168, 1 },
-        { 146, 107, 164, 13, 242, 58, 1 },
-        { 138, 144, 174, 102, 37, 111, 1 }, },
-      { { 175, 59, 230, 2, 186, 159, 1 },
-        { 139, 143, 171, 58, 166, 253, 0 },
-        { 252, 174, 160, 51, 238, 122, 1 },
-        { 95, 178, 174, 106, 248, 232, 1 }, },
-      { { 174, 70, 26, 234, 137, 71, 1 },
-        { 231, 102, 120, 156, 130, 170, 0 },
-        { 241, 72, 171, 172, 49, 58, 1 },
-        { 42, 160, 156, 143, 51, 115, 1 }, },
-      { { 173, 66, 113, 218, 119, 159, 1 },
-        { 27, 94, 217, 189, 224, 123, 0 },
-        { 252, 247, 45, 199, 33, 90, 1 },
-        { 111, 3, 222, 205, 189, 108, 0 }, },
-      { { 173, 88, 23, 206, 43, 193, 1 },
-        { 15, 207, 80, 173, 131, 182, 0 },
-        { 193, 234, 57, 244, 13, 90, 1 },
-        { 54, 224, 218, 133, 121, 248, 0 }, },
-      { { 172, 151, 210, 208, 179, 77, 0 },
-        { 93, 71, 113, 186, 46, 41, 0 },
-        { 89, 102, 133, 165, 244, 154, 1 },
-        { 74, 58, 46, 199, 113, 93, 0 }, },
-      { { 173, 190, 197, 66, 11, 202, 0 },
-        { 69, 139, 91, 43, 168, 188, 0 },
-        { 41, 232, 33, 81, 190, 218, 1 },
-        { 30, 138, 234, 109, 104, 209, 0 }, },
-      { { 175, 250, 80, 85, 120, 101, 0 },
-        { 157, 215, 67, 92, 9, 185, 1 },
-        { 83, 15, 85, 5, 47, 250, 1 },
-        { 206, 200, 29, 97, 117, 220, 1 }, },
-      { { 176, 31, 206, 26, 12, 146, 1 },
-        { 114, 137, 13, 10, 198, 238, 0 },
-        { 164, 152, 44, 57, 252, 6, 1 },
-        { 59, 177, 168, 88, 72, 167, 0 }, },
-      { { 177, 112, 134, 190, 143, 137, 0 },
-        { 16, 45, 54, 174, 227, 182, 0 },
-        { 72, 248, 190, 176, 135, 70, 1 },
-        { 54, 227, 186, 182, 90, 4, 0 }, },
-      { { 183, 222, 54, 61, 41, 2, 0 },
-        { 217, 225, 156, 76, 11, 190, 0 },
-        { 32, 74, 94, 54, 61, 246, 1 },
-        { 62, 232, 25, 28, 195, 205, 1 }, },
-      { { 180, 229, 14, 234, 89, 126, 0 },
-        { 101, 48, 94, 156, 174, 231, 1 },
-        { 63, 77, 43, 184, 83, 150, 1 },
-        { 243, 186, 156, 189, 6, 83, 0 }, },
-      { { 186, 59, 44, 235, 91, 138, 0 },
-        { 160, 187, 222, 232, 164, 175, 0 },
-        { 40, 237, 107, 154, 110, 46, 1 },
-        { 122, 146, 139, 189, 238, 130, 1 }, },
-      { { 187, 123, 82, 243, 209, 20, 0 },
-        { 144, 243, 119, 220, 134, 121, 0 },
-        { 20, 69, 231, 165, 111, 110, 1 },
-        { 79, 48, 157, 247, 103, 132, 1 }, },
-      { { 186, 116, 182, 71, 89, 86, 1 },
-        { 198, 83, 222, 94, 131, 229, 0 },
-        { 181, 77, 113, 54, 151, 46, 1 },
-        { 83, 224, 189, 61, 229, 49, 1 }, },
-      { { 186, 139, 73, 97, 25, 111, 1 },
-        { 166, 166, 93, 89, 44, 169, 1 },
-        { 251, 76, 67, 73, 104, 174, 1 },
-        { 202, 154, 77, 93, 50, 178, 1 }, },
-      { { 187, 152, 233, 200, 28, 89, 0 },
-        { 164, 135, 197, 139, 104, 243, 0 },
-        { 77, 28, 9, 203, 140, 238, 1 },
-        { 103, 139, 104, 209, 240, 146, 1 }, },
-      { { 188, 30, 177, 81, 156, 163, 1 },
-        { 83, 207, 236, 75, 64, 169, 1 },
-        { 226, 156, 197, 70, 188, 30, 1 },
-        { 202, 129, 105, 27, 249, 229, 0 }, },
-      { { 188, 42, 52, 17, 27, 68, 1 },
-        { 23, 194, 150, 120, 0, 173, 0 },
-        { 145, 108, 68, 22, 42, 30, 1 },
-        { 90, 128, 15, 52, 161, 244, 0 }, },
-      { { 189, 81, 101, 27, 30, 213, 0 },
-        { 21, 15, 133, 125, 196, 247, 0 },
-        { 85, 188, 108, 83, 69, 94, 1 },
-        { 119, 145, 223, 80, 248, 84, 0 }, },
-      { { 190, 112, 117, 173, 51, 180, 1 },
-        { 139, 107, 151, 253, 1, 103, 1 },
-        { 150, 230, 90, 215, 7, 62, 1 },
-        { 243, 64, 95, 244, 235, 104, 1 }, },
-      { { 189, 255, 164, 161, 70, 198, 1 },
-        { 71, 187, 142, 254, 76, 60, 0 },
-        { 177, 177, 66, 146, 255, 222, 1 },
-        { 30, 25, 63, 184, 238, 241, 0 }, },
-      { { 193, 4, 151, 159, 155, 192, 0 },
-        { 84, 72, 48, 227, 147, 183, 0 },
-        { 1, 236, 252, 244, 144, 65, 1 },
-        { 118, 228, 227, 134, 9, 21, 0 }, },
-      { { 193, 30, 33, 36, 254, 38, 1 },
-        { 74, 177, 168, 49, 81, 185, 1 },
-        { 178, 63, 146, 66, 60, 65, 1 },
-        { 206, 197, 70, 10, 198, 169, 0 }, },
-      { { 192, 237, 72, 64, 106, 165, 0 },
-        { 104, 156, 67, 52, 28, 160, 1 },
-        { 82, 171, 1, 9, 91, 129, 1 },
-        { 130, 156, 22, 97, 28, 139, 0 }, },
-      { { 192, 234, 184, 166, 4, 229, 0 },
-        { 36, 236, 130, 150, 217, 40, 1 },
-        { 83, 144, 50, 142, 171, 129, 1 },
-        { 138, 77, 180, 160, 155, 146, 0 }, },
-      { { 198, 87, 250, 41, 77, 82, 1 },
-        { 231, 113, 153, 70, 86, 234, 0 },
-        { 165, 89, 74, 47, 245, 49, 1 },
-        { 43, 181, 49, 76, 199, 115, 1 }, },
-      { { 200, 111, 63, 193, 206, 104, 0 },
-        { 100, 210, 226, 229, 118, 172, 1 },
-        { 11, 57, 193, 254, 123, 9, 1 },
-        { 154, 183, 83, 163, 165, 147, 0 }, },
-      { { 200, 99, 86, 204, 12, 4, 1 },
-        { 2, 66, 67, 148, 87, 174, 0 },
-        { 144, 24, 25, 181, 99, 9, 1 },
-        { 58, 245, 20, 225, 33, 32, 0 }, },
-      { { 201, 215, 21, 97, 151, 171, 1 },
-        { 66, 111, 120, 101, 124, 61, 1 },
-        { 234, 244, 195, 84, 117, 201, 1 },
-        { 222, 31, 83, 15, 123, 33, 0 }, },
-      { { 203, 227, 118, 18, 26, 242, 1 },
-        { 150, 74, 139, 36, 158, 253, 1 },
-        { 167, 172, 36, 55, 99, 233, 1 },
-        { 223, 188, 146, 104, 169, 52, 1 }, },
-      { { 204, 23, 188, 202, 55, 164, 1 },
-        { 107, 75, 208, 178, 212, 47, 1 },
-        { 146, 246, 41, 158, 244, 25, 1 },
-        { 250, 21, 166, 133, 233, 107, 0 }, },
-      { { 204, 223, 166, 39, 145, 190, 0 },
-        { 65, 171, 184, 86, 191, 109, 1 },
-        { 62, 196, 242, 50, 253, 153, 1 },
-        { 219, 126, 181, 14, 234, 193, 0 }, },
-      { { 204, 235, 235, 67, 36, 93, 0 },
-        { 45, 134, 195, 87, 254, 104, 0 },
-        { 93, 18, 97, 107, 235, 153, 1 },
-        { 11, 63, 245, 97, 176, 218, 0 }, },
-      { { 209, 53, 155, 82, 5, 119, 0 },
-        { 116, 69, 94, 19, 214, 112, 1 },
-        { 119, 80, 37, 108, 214, 69, 1 },
-        { 135, 53, 228, 61, 81, 23, 0 }, },
-      { { 209, 91, 212, 112, 60, 106, 0 },
-        { 28, 225, 77, 6, 116, 189, 1 },
-        { 43, 30, 7, 21, 237, 69, 1 },
-        { 222, 151, 48, 89, 67, 156, 0 }, },
-      { { 215, 26, 117, 66, 163, 79, 1 },
-        { 143, 197, 253, 49, 176, 60, 0 },
-        { 249, 98, 161, 87, 44, 117, 1 },
-        { 30, 6, 198, 95, 209, 248, 1 }, },
-      { { 215, 230, 123, 63, 234, 215, 1 },
-        { 255, 124, 175, 117, 155, 250, 0 },
-        { 245, 171, 254, 111, 51, 245, 1 },
-        { 47, 236, 215, 122, 159, 127, 1 }, },
-      { { 219, 2, 186, 238, 81, 189, 1 },
-        { 162, 126, 212, 146, 179, 123, 1 },
-        { 222, 197, 59, 174, 160, 109, 1 },
-        { 239, 102, 164, 149, 191, 34, 1 }, },
-      { { 216, 126, 223, 70, 165, 187, 1 },
-        { 106, 207, 127, 7, 243, 108, 1 },
-        { 238, 210, 177, 125, 191, 13, 1 },
-        { 155, 103, 240, 127, 121, 171, 0 }, },
-      { { 216, 131, 133, 71, 132, 38, 1 },
-        { 2, 2, 108, 83, 221, 44, 1 },
-        { 178, 16, 241, 80, 224, 141, 1 },
-        { 154, 93, 229, 27, 32, 32, 0 }, },
-      { { 218, 189, 22, 192, 207, 231, 0 },
-        { 196, 223, 126, 176, 94, 164, 1 },
-        { 115, 249, 129, 180, 94, 173, 1 },
-        { 146, 189, 6, 191, 125, 145, 1 }, },
-      { { 219, 226, 77, 128, 236, 124, 1 },
-        { 174, 18, 39, 149, 120, 252, 1 },
-        { 159, 27, 128, 217, 35, 237, 1 },
-        { 159, 143, 84, 242, 36, 58, 1 }, },
-      { { 217, 244, 154, 237, 44, 69, 0 },
-        { 108, 103, 70, 214, 91, 178, 0 },
-        { 81, 26, 91, 172, 151, 205, 1 },
-        { 38, 237, 53, 177, 115, 27, 0 }, },
-      { { 222, 24, 187, 178, 78, 206, 1 },
-        { 183, 251, 140, 179, 242, 160, 0 },
-        { 185, 185, 38, 238, 140, 61, 1 },
-        { 2, 167, 230, 152, 239, 246, 1 }, },
-      { { 221, 25, 226, 31, 178, 162, 1 },
-        { 27, 139, 173, 98, 151, 51, 1 },
-        { 162, 166, 252, 35, 204, 93, 1 },
-        { 230, 116, 163, 90, 232, 236, 0 }, },
-      { { 222, 44, 65, 181, 149, 43, 0 },
-        { 209, 166, 63, 193, 113, 33, 1 },
-        { 106, 84, 214, 193, 26, 61, 1 },
-        { 194, 71, 65, 254, 50, 197, 1 }, },
-      { { 220, 75, 143, 150, 13, 97, 0 },
-        { 53, 134, 20, 135, 215, 172, 1 },
-        { 67, 88, 52, 248, 233, 29, 1 },
-        { 154, 245, 240, 148, 48, 214, 0 }, },
-      { { 221, 148, 173, 142, 18, 115, 1 },
-        { 103, 7, 140, 163, 153, 119, 1 },
-        { 231, 36, 56, 218, 148, 221, 1 },
-        { 247, 76, 226, 152, 240, 115, 0 }, },
-      { { 221, 209, 152, 178, 105, 248, 1 },
-        { 63, 123, 20, 134, 188, 240, 1 },
-        { 143, 203, 38, 140, 197, 221, 1 },
-        { 135, 158, 176, 148, 111, 126, 0 }, },
-      { { 225, 16, 129, 210, 125, 199, 0 },
-        { 28, 29, 88, 155, 208, 177, 0 },
-        { 113, 223, 37, 192, 132, 67, 1 },
-        { 70, 133, 236, 141, 92, 28, 0 }, },
-      { { 226, 29, 244, 60, 230, 69, 1 },
-        { 222, 245, 161, 58, 85, 38, 0 },
-        { 209, 51, 158, 23, 220, 35, 1 },
-        { 50, 85, 46, 66, 215, 189, 1 }, },
-      { { 227, 42, 142, 26, 117, 17, 0 },
-        { 184, 148, 18, 10, 210, 127, 0 },
-        { 68, 87, 44, 56, 170, 99, 1 },
-        { 127, 37, 168, 36, 20, 142, 1 }, },
-      { { 230, 127, 34, 189, 228, 63, 1 },
-        { 219, 181, 170, 220, 119, 106, 1 },
-        { 254, 19, 222, 162, 127, 51, 1 },
-        { 171, 119, 29, 170, 214, 237, 1 }, },
-      { { 230, 201, 244, 50, 47, 175, 1 },
-        { 155, 236, 153, 62, 252, 164, 1 },
-        { 250, 250, 38, 23, 201, 179, 1 },
-        { 146, 159, 190, 76, 155, 236, 1 }, },
-      { { 233, 65, 95, 6, 96, 115, 0 },
-        { 44, 86, 9, 13, 151, 116, 1 },
-        { 103, 3, 48, 125, 65, 75, 1 },
-        { 151, 116, 216, 72, 53, 26, 0 }, },
-      { { 232, 162, 221, 84, 147, 113, 0 },
-        { 52, 70, 115, 43, 25, 109, 1 },
-        { 71, 100, 149, 93, 162, 139, 1 },
-        { 219, 76, 106, 103, 49, 22, 0 }, },
-      { { 232, 216, 146, 243, 185, 171, 1 },
-        { 26, 239, 120, 206, 186, 161, 1 },
-        { 234, 206, 231, 164, 141, 139, 1 },
-        { 194, 174, 185, 143, 123, 172, 0 }, },
-      { { 234, 224, 242, 13, 25, 46, 0 },
-        { 128, 66, 155, 94, 59, 163, 1 },
-        { 58, 76, 88, 39, 131, 171, 1 },
-        { 226, 238, 61, 108, 161, 0, 1 }, },
-      { { 237, 183, 135, 120, 221, 244, 0 },
-        { 85, 59, 114, 27, 94, 255, 1 },
-        { 23, 221, 143, 112, 246, 219, 1 },
-        { 255, 189, 108, 39, 110, 85, 0 }, },
-      { { 237, 243, 41, 3, 202, 39, 1 },
-        { 35, 23, 170, 125, 156, 184, 1 },
-        { 242, 41, 224, 74, 103, 219, 1 },
-        { 142, 156, 223, 42, 244, 98, 0 }, },
-      { { 242, 9, 23, 170, 178, 81, 0 },
-        { 140, 228, 36, 169, 150, 103, 0 },
-        { 69, 38, 170, 244, 72, 39, 1 },
-        { 115, 52, 202, 146, 19, 152, 1 }, },
-      { { 242, 87, 191, 49, 98, 230, 1 },
-        { 254, 121, 140, 127, 22, 44, 1 },
-        { 179, 163, 70, 126, 245, 39, 1 },
-        { 154, 52, 127, 24, 207, 63, 1 }, },
-      { { 240, 161, 59, 114, 216, 194, 0 },
-        { 52, 120, 238, 9, 158, 161, 0 },
-        { 33, 141, 167, 110, 66, 135, 1 },
-        { 66, 188, 200, 59, 143, 22, 0 }, },
-      { { 242, 204, 10, 145, 3, 251, 0 },
-        { 244, 140, 28, 236, 58, 96, 1 },
-        { 111, 224, 68, 168, 25, 167, 1 },
-        { 131, 46, 27, 156, 24, 151, 1 }, },
-      { { 240, 197, 80, 127, 169, 160, 1 },
-        { 90, 104, 117, 76, 157, 162, 1 },
-        { 130, 202, 255, 5, 81, 135, 1 },
-        { 162, 220, 153, 87, 11, 45, 0 }, },
-      { { 241, 197, 159, 71, 93, 153, 1 },
-        { 98, 92, 84, 79, 255, 245, 0 },
-        { 204, 221, 113, 124, 209, 199, 1 },
-        { 87, 255, 249, 21, 29, 35, 0 }, },
-      { { 240, 244, 101, 147, 182, 176, 1 },
-        { 90, 9, 167, 237, 216, 101, 1 },
-        { 134, 182, 228, 211, 23, 135, 1 },
-        { 211, 13, 219, 242, 200, 45, 0 }, },
-      { { 244, 0, 37, 19, 37, 72, 0 },
-        { 29, 0, 148, 73, 240, 36, 0 },
-        { 9, 82, 100, 82, 0, 23, 1 },
-        { 18, 7, 201, 20, 128, 92, 0 }, },
-      { { 244, 111, 108, 190, 223, 216, 1 },
-        { 119, 184, 183, 172, 245, 239, 0 },
-        { 141, 253, 190, 155, 123, 23, 1 },
-        { 123, 215, 154, 246, 142, 247, 0 }, },
-      { { 247, 104, 114, 223, 78, 225, 0 },
-        { 149, 220, 199, 236, 211, 178, 1 },
-        { 67, 185, 125, 167, 11, 119, 1 },
-        { 166, 229, 155, 241, 157, 212, 1 }, },
-      { { 251, 140, 211, 46, 207, 23, 0 },
-        { 192, 246, 61, 59, 219, 242, 0 },
-        { 116, 121, 186, 101, 152, 239, 1 },
-        { 39, 237, 238, 94, 55, 129, 1 }, },
-      { { 249, 145, 73, 232, 47, 176, 0 },
-        { 40, 43, 85, 169, 92, 242, 1 },
-        { 6, 250, 11, 201, 68, 207, 1 },
-        { 167, 157, 74, 213, 106, 10, 0 }, },
-      { { 251, 204, 144, 194, 16, 228, 0 },
-        { 196, 202, 68, 158, 152, 49, 1 },
-        { 19, 132, 33, 132, 153, 239, 1 },
-        { 198, 12, 188, 145, 41, 145, 1 }, },
-      { { 248, 252, 106, 92, 170, 113, 1 },
-        { 126, 135, 231, 44, 27, 226, 1 },
-        { 199, 42, 157, 43, 31, 143, 1 },
-        { 163, 236, 26, 115, 240, 191, 0 }, },
-      { { 254, 15, 171, 22, 40, 191, 1 },
-        { 251, 142, 140, 27, 183, 232, 1 },
-        { 254, 138, 52, 106, 248, 63, 1 },
-        { 139, 246, 236, 24, 184, 239, 1 }, },
-      { { 252, 66, 14, 134, 208, 220, 0 },
-        { 37, 26, 36, 156, 179, 109, 0 },
-        { 29, 133, 176, 184, 33, 31, 1 },
-        { 91, 102, 156, 146, 44, 82, 0 }, },
-      { { 252, 124, 113, 120, 44, 31, 0 },
-        { 89, 231, 207, 29, 112, 226, 0 },
-        { 124, 26, 15, 71, 31, 31, 1 },
-        { 35, 135, 92, 121, 243, 205, 0 }, },
-      { { 255, 159, 183, 150, 227, 134, 1 },
-        { 219, 219, 188, 187, 159, 60, 0 },
-        { 176, 227, 180, 246, 252, 255, 1 },
-        { 30, 124, 238, 158, 237, 237, 1 }, },
-      { { 112, 127, 0, 71, 111, 110, 0 },
-        { 76, 145, 94, 124, 245, 136, 1 },
-        { 59, 123, 113, 0, 127, 7, 0 },
-        { 136, 215, 159, 61, 68, 153, 0 }, },
-      { { 131, 238, 196, 68, 55, 228, 0 },
-        { 204, 136, 83, 54, 73, 61, 1 },
-        { 19, 246, 17, 17, 187, 224, 1 },
-        { 222, 73, 54, 101, 8, 153, 1 }, },
-      { { 1, 32, 180, 5, 180, 95, 1 },
-        { 14, 68, 170, 82, 97, 85, 0 },
-        { 253, 22, 208, 22, 130, 64, 0 },
-        { 85, 67, 37, 42, 145, 56, 0 }, },
-      { { 0, 59, 124, 20, 69, 167, 0 },
-        { 48, 221, 155, 16, 69, 12, 1 },
-        { 114, 209, 20, 31, 110, 0, 0 },
-        { 152, 81, 4, 108, 221, 134, 0 }, },
-      { { 3, 79, 186, 190, 163, 12, 0 },
-        { 248, 224, 176, 182, 167, 26, 0 },
-        { 24, 98, 190, 174, 249, 96, 0 },
-        { 44, 114, 182, 134, 131, 143, 1 }, },
-      { { 1, 86, 37, 1, 21, 142, 0 },
-        { 64, 9, 152, 85, 96, 29, 0 },
-        { 56, 212, 64, 82, 53, 64, 0 },
-        { 92, 3, 85, 12, 200, 1, 0 }, },
-      { { 1, 143, 230, 168, 33, 42, 0 },
-        { 72, 160, 153, 130, 46, 30, 1 },
-        { 42, 66, 10, 179, 248, 192, 0 },
-        { 188, 58, 32, 204, 130, 137, 0 }, },
-      { { 0, 175, 103, 1, 210, 134, 0 },
-        { 64, 152, 171, 113, 14, 13, 0 },
-        { 48, 165, 192, 115, 122, 128, 0 },
-        { 88, 56, 71, 106, 140, 129, 0 }, },
-      { { 0, 217, 16, 247, 55, 249, 0 },
-        { 28, 237, 80, 228, 237, 65, 1 },
-        { 79, 246, 119, 132, 77, 128, 0 },
-        { 193, 91, 147, 133, 91, 156, 0 }, },
-      { { 3, 240, 9, 255, 186, 56, 0 },
-        { 184, 33, 98, 229, 169, 211, 1 },
-        { 14, 46, 255, 200, 7, 224, 0 },
-        { 229, 202, 211, 163, 66, 14, 1 }, },
-      { { 5, 92, 205, 107, 57, 177, 1 },
-        { 107, 173, 81, 71, 128, 215, 1 },
-        { 198, 206, 107, 89, 157, 80, 0 },
-        { 245, 128, 241, 69, 90, 235, 0 }, },
-      { { 6, 109, 146, 36, 128, 158, 1 },
-        { 195, 232, 42, 22, 39, 64, 0 },
-        { 188, 128, 146, 36, 219, 48, 0 },
-        { 1, 114, 52, 42, 11, 225, 1 }, },
-      { { 4, 166, 38, 247, 185, 66, 1 },
-        { 95, 32, 250, 192, 139, 141, 0 },
-        { 161, 78, 247, 178, 50, 144, 0 },
-        { 88, 232, 129, 175, 130, 125, 0 }, },
-      { { 4, 196, 160, 187, 5, 176, 0 },
-        { 81, 40, 144, 198, 200, 66, 1 },
-        { 6, 208, 110, 130, 145, 144, 0 },
-        { 161, 9, 177, 132, 138, 69, 0 }, },
-      { { 9, 4, 240, 102, 157, 166, 0 },
-        { 64, 106, 249, 18, 193, 145, 1 },
-        { 50, 220, 179, 7, 144, 72, 0 },
-        { 196, 193, 164, 79, 171, 1, 0 }, },
-      { { 8, 63, 162, 23, 251, 204, 1 },
-        { 94, 155, 178, 114, 167, 137, 0 },
-        { 153, 239, 244, 34, 254, 8, 0 },
-        { 72, 242, 167, 38, 236, 189, 0 }, },
-      { { 10, 107, 164, 59, 63, 71, 1 },
-        { 158, 166, 154, 118, 196, 143, 0 },
-        { 241, 126, 110, 18, 235, 40, 0 },
-        { 120, 145, 183, 44, 178, 188, 1 }, },
-      { { 9, 147, 68, 160, 208, 252, 0 },
-        { 4, 59, 33, 144, 44, 93, 1 },
-        { 31, 133, 130, 145, 100, 200, 0 },
-        { 221, 26, 4, 194, 110, 16, 0 }, },
-      { { 8, 210, 94, 4, 114, 98, 1 },
-        { 46, 83, 9, 36, 11, 13, 1 },
-        { 163, 39, 16, 61, 37, 136, 0 },
-        { 216, 104, 18, 72, 101, 58, 0 }, },
-      { { 14, 39, 43, 135, 201, 75, 1 },
-        { 231, 22, 186, 193, 167, 136, 0 },
-        { 233, 73, 240, 234, 114, 56, 0 },
-        { 8, 242, 193, 174, 180, 115, 1 }, },
-      { { 15, 42, 254, 150, 218, 227, 0 },
-        { 181, 222, 171, 162, 131, 157, 1 },
-        { 99, 173, 180, 191, 170, 120, 0 },
-        { 220, 224, 162, 234, 189, 214, 1 }, },
-      { { 13, 94, 114, 56, 152, 3, 0 },
-        { 81, 231, 169, 4, 2, 155, 0 },
-        { 96, 12, 142, 39, 61, 88, 0 },
-        { 108, 160, 16, 74, 243, 197, 0 }, },
-      { { 14, 87, 112, 167, 99, 99, 1 },
-        { 207, 119, 153, 228, 133, 8, 1 },
-        { 227, 99, 114, 135, 117, 56, 0 },
-        { 136, 80, 147, 204, 247, 121, 1 }, },
-      { { 13, 106, 169, 220, 27, 63, 0 },
-        { 49, 134, 218, 183, 33, 219, 1 },
-        { 126, 108, 29, 202, 171, 88, 0 },
-        { 237, 194, 118, 173, 176, 198, 0 }, },
-      { { 13, 118, 154, 128, 113, 208, 1 },
-        { 111, 91, 18, 134, 2, 89, 0 },
-        { 133, 199, 0, 172, 183, 88, 0 },
-        { 77, 32, 48, 164, 109, 123, 0 }, },
-      { { 14, 124, 197, 35, 226, 204, 1 },
-        { 207, 187, 35, 119, 160, 4, 0 },
-        { 153, 163, 226, 81, 159, 56, 0 },
-        { 16, 2, 247, 98, 110, 249, 1 }, },
-      { { 15, 139, 106, 20, 246, 21, 0 },
-        { 185, 150, 161, 48, 79, 89, 0 },
-        { 84, 55, 148, 43, 104, 248, 0 },
-        { 77, 121, 6, 66, 180, 206, 1 }, },
-      { { 13, 171, 134, 215, 206, 17, 1 },
-        { 19, 150, 98, 226, 207, 220, 0 },
-        { 196, 57, 245, 176, 234, 216, 0 },
-        { 29, 249, 163, 163, 52, 228, 0 }, },
-      { { 15, 203, 199, 97, 60, 150, 1 },
-        { 139, 170, 73, 87, 78, 221, 0 },
-        { 180, 158, 67, 113, 233, 248, 0 },
-        { 93, 185, 117, 73, 42, 232, 1 }, },
-      { { 14, 236, 63, 51, 174, 17, 1 },
-        { 251, 230, 162, 101, 202, 196, 0 },
-        { 196, 58, 230, 126, 27, 184, 0 },
-        { 17, 169, 211, 34, 179, 239, 1 }, },
-      { { 17, 15, 152, 165, 71, 82, 0 },
-        { 100, 240, 28, 226, 69, 88, 0 },
-        { 37, 113, 82, 140, 248, 68, 0 },
-        { 13, 81, 35, 156, 7, 147, 0 }, },
-      { { 17, 119, 210, 131, 226, 153, 0 },
-        { 72, 93, 39, 230, 166, 88, 0 },
-        { 76, 163, 224, 165, 247, 68, 0 },
-        { 13, 50, 179, 242, 93, 9, 0 }, },
-      { { 17, 151, 181, 190, 81, 161, 0 },
-        { 80, 125, 148, 131, 141, 31, 1 },
-        { 66, 197, 62, 214, 244, 196, 0 },
-        { 252, 88, 224, 148, 223, 5, 0 }, },
-      { { 18, 155, 152, 58, 105, 111, 1 },
-        { 190, 245, 28, 18, 172, 138, 1 },
-        { 251, 75, 46, 12, 236, 164, 0 },
-        { 168, 154, 164, 28, 87, 190, 1 }, },
-      { { 19, 233, 65, 189, 245, 218, 0 },
-        { 156, 184, 63, 197, 109, 83, 0 },
-        { 45, 215, 222, 193, 75, 228, 0 },
-        { 101, 91, 81, 254, 14, 156, 1 }, },
-      { { 22, 13, 83, 212, 169, 87, 0 },
-        { 221, 196, 125, 145, 7, 192, 0 },
-        { 117, 74, 149, 229, 88, 52, 0 },
-        { 1, 240, 68, 223, 17, 221, 1 }, },
-      { { 22, 61, 21, 111, 231, 73, 0 },
-        { 205, 245, 118, 97, 229, 6, 0 },
-        { 73, 115, 251, 84, 94, 52, 0 },
-        { 48, 83, 195, 55, 87, 217, 1 }, },
-      { { 20, 130, 100, 0, 95, 151, 1 },
-        { 3, 28, 157, 48, 72, 205, 0 },
-        { 244, 253, 0, 19, 32, 148, 0 },
-        { 89, 137, 6, 92, 156, 96, 0 }, },
-      { { 21, 130, 161, 143, 42, 56, 1 },
-        { 11, 0, 132, 227, 169, 218, 1 },
-        { 142, 42, 120, 194, 160, 212, 0 },
-        { 173, 202, 227, 144, 128, 104, 0 }, },
-      { { 21, 153, 34, 53, 74, 250, 0 },
-        { 21, 185, 140, 96, 47, 208, 1 },
-        { 47, 169, 86, 34, 76, 212, 0 },
-        { 133, 250, 3, 24, 206, 212, 0 }, },
-      { { 23, 156, 89, 25, 214, 46, 0 },
-        { 241, 209, 45, 113, 104, 19, 1 },
-        { 58, 53, 204, 77, 28, 244, 0 },
-        { 228, 11, 71, 90, 69, 199, 1 }, },
-      { { 21, 165, 87, 175, 25, 244, 1 },
-        { 71, 104, 23, 209, 143, 215, 1 },
-        { 151, 204, 122, 245, 82, 212, 0 },
-        { 245, 248, 197, 244, 11, 113, 0 }, },
-      { { 22, 185, 129, 147, 151, 243, 0 },
-        { 149, 141, 62, 227, 204, 65, 1 },
-        { 103, 244, 228, 192, 206, 180, 0 },
-        { 193, 25, 227, 190, 88, 212, 1 }, },
-      { { 20, 212, 174, 31, 83, 198, 0 },
-        { 117, 25, 156, 118, 139, 7, 0 },
-        { 49, 229, 124, 58, 149, 148, 0 },
-        { 112, 104, 183, 28, 204, 87, 0 }, },
-      { { 22, 222, 188, 166, 177, 46, 1 },
-        { 235, 225, 188, 150, 169, 13, 1 },
-        { 186, 70, 178, 158, 189, 180, 0 },
-        { 216, 74, 180, 158, 195, 235, 1 }, },
-      { { 21, 215, 231, 50, 136, 117, 0 },
-        { 85, 37, 165, 23, 142, 220, 1 },
-        { 87, 8, 166, 115, 245, 212, 0 },
-        { 157, 184, 244, 82, 210, 85, 0 }, },
-      { { 27, 5, 137, 184, 14, 199, 1 },
-        { 246, 46, 12, 179, 68, 146, 0 },
-        { 241, 184, 14, 200, 208, 108, 0 },
-        { 36, 145, 102, 152, 58, 55, 1 }, },
-      { { 24, 76, 13, 17, 16, 216, 1 },
-        { 118, 138, 4, 69, 32, 69, 0 },
-        { 141, 132, 68, 88, 25, 12, 0 },
-        { 81, 2, 81, 16, 40, 183, 0 }, },
-      { { 27, 80, 19, 3, 222, 147, 1 },
-        { 130, 95, 44, 101, 194, 209, 0 },
-        { 228, 189, 224, 100, 5, 108, 0 },
-        { 69, 161, 211, 26, 125, 32, 1 }, },
-      { { 26, 117, 67, 117, 230, 58, 0 },
-        { 216, 51, 111, 101, 103, 64, 1 },
-        { 46, 51, 215, 97, 87, 44, 0 },
-        { 129, 115, 83, 123, 102, 13, 1 }, },
-      { { 25, 139, 44, 109, 101, 206, 0 },
-        { 44, 186, 220, 80, 109, 30, 0 },
-        { 57, 211, 91, 26, 104, 204, 0 },
-        { 60, 91, 5, 29, 174, 154, 0 }, },
-      { { 24, 157, 237, 154, 191, 3, 0 },
-        { 120, 135, 189, 163, 204, 135, 0 },
-        { 96, 126, 172, 219, 220, 140, 0 },
-        { 112, 153, 226, 222, 240, 143, 0 }, },
-      { { 26, 163, 189, 21, 22, 74, 1 },
-        { 182, 66, 142, 99, 109, 13, 0 },
-        { 169, 52, 84, 94, 226, 172, 0 },
-        { 88, 91, 99, 56, 161, 54, 1 }, },
-      { { 24, 191, 221, 217, 136, 80, 1 },
-        { 118, 195, 103, 195, 12, 206, 0 },
-        { 133, 8, 205, 221, 254, 140, 0 },
-        { 57, 152, 97, 243, 97, 183, 0 }, },
-      { { 26, 187, 197, 128, 248, 166, 1 },
-        { 138, 155, 47, 147, 12, 141, 1 },
-        { 178, 143, 128, 209, 238, 172, 0 },
-        { 216, 152, 100, 250, 108, 168, 1 }, },
-      { { 24, 202, 200, 115, 174, 12, 1 },
-        { 58, 162, 101, 118, 232, 136, 0 },
-        { 152, 58, 231, 9, 169, 140, 0 },
-        { 8, 139, 183, 83, 34, 174, 0 }, },
-      { { 26, 251, 85, 224, 195, 153, 1 },
-        { 130, 255, 119, 165, 44, 76, 0 },
-        { 204, 225, 131, 213, 111, 172, 0 },
-        { 25, 26, 82, 247, 127, 160, 1 }, },
-      { { 25, 252, 172, 250, 123, 235, 0 },
-        { 124, 191, 222, 166, 168, 151, 1 },
-        { 107, 239, 47, 154, 159, 204, 0 },
-        { 244, 138, 178, 189, 254, 159, 0 }, },
-      { { 31, 33, 77, 51, 43, 129, 0 },
-        { 185, 46, 23, 97, 132, 148, 0 },
-        { 64, 234, 102, 89, 66, 124, 0 },
-        { 20, 144, 195, 116, 58, 78, 1 }, },
-      { { 29, 104, 97, 97, 80, 45, 1 },
-        { 3, 182, 199, 85, 32, 17, 1 },
-        { 218, 5, 67, 67, 11, 92, 0 },
-        { 196, 2, 85, 113, 182, 224, 0 }, },
-      { { 29, 113, 17, 105, 159, 205, 1 },
-        { 7, 111, 118, 117, 100, 147, 0 },
-        { 217, 252, 203, 68, 71, 92, 0 },
-        { 100, 147, 87, 55, 123, 112, 0 }, },
-      { { 28, 115, 52, 93, 58, 61, 1 },
-        { 27, 71, 198, 116, 37, 207, 1 },
-        { 222, 46, 93, 22, 103, 28, 0 },
-        { 249, 210, 23, 49, 241, 108, 0 }, },
-      { { 30, 167, 7, 22, 61, 22, 1 },
-        { 219, 2, 30, 17, 207, 205, 0 },
-        { 180, 94, 52, 112, 114, 188, 0 },
-        { 89, 249, 196, 60, 32, 109, 1 }, },
-      { { 32, 22, 241, 69, 239, 16, 1 },
-        { 74, 81, 241, 107, 65, 200, 0 },
-        { 132, 123, 209, 71, 180, 2, 0 },
-        { 9, 193, 107, 71, 197, 41, 0 }, },
-      { { 33, 37, 79, 144, 49, 77, 0 },
-        { 124, 4, 19, 153, 38, 21, 0 },
-        { 89, 70, 4, 249, 82, 66, 0 },
-        { 84, 50, 76, 228, 16, 31, 0 }, },
-      { { 35, 45, 115, 235, 220, 62, 1 },
-        { 194, 240, 235, 217, 230, 211, 1 },
-        { 190, 29, 235, 231, 90, 98, 0 },
-        { 229, 179, 205, 235, 135, 161, 1 }, },
-      { { 35, 72, 62, 43, 100, 184, 1 },
-        { 170, 248, 128, 76, 226, 86, 1 },
-        { 142, 147, 106, 62, 9, 98, 0 },
-        { 181, 35, 153, 0, 143, 170, 1 }, },
-      { { 35, 86, 58, 73, 248, 94, 1 },
-        { 238, 81, 232, 92, 34, 219, 0 },
-        { 189, 15, 201, 46, 53, 98, 0 },
-        { 109, 162, 29, 11, 197, 59, 1 }, },
-      { { 34, 138, 184, 17, 107, 194, 0 },
-        { 188, 216, 152, 106, 8, 136, 0 },
-        { 33, 235, 68, 14, 168, 162, 0 },
-        { 8, 136, 43, 12, 141, 158, 1 }, },
-      { { 32, 167, 72, 150, 66, 82, 1 },
-        { 118, 16, 11, 168, 141, 72, 0 },
-        { 165, 33, 52, 137, 114, 130, 0 },
-        { 9, 88, 138, 232, 4, 55, 0 }, },
-      { { 34, 164, 248, 245, 231, 39, 1 },
-        { 250, 116, 251, 250, 73, 0, 1 },
-        { 242, 115, 215, 143, 146, 162, 0 },
-        { 128, 73, 47, 239, 151, 47, 1 }, },
-      { { 33, 239, 227, 53, 220, 27, 1 },
-        { 82, 180, 171, 79, 111, 217, 0 },
-        { 236, 29, 214, 99, 251, 194, 0 },
-        { 77, 251, 121, 106, 150, 165, 0 }, },
-      { { 33, 255, 170, 148, 240, 254, 0 },
-        { 124, 153, 170, 158, 47, 89, 1 },
-        { 63, 135, 148, 170, 255, 194, 0 },
-        { 205, 122, 60, 170, 204, 159, 0 }, },
-      { { 37, 48, 68, 183, 73, 106, 0 },
-        { 21, 49, 27, 200, 161, 148, 1 },
-        { 43, 73, 118, 145, 6, 82, 0 },
-        { 148, 194, 137, 236, 70, 84, 0 }, },
-      { { 38, 55, 142, 202, 57, 200, 0 },
-        { 237, 9, 82, 138, 166, 143, 0 },
-        { 9, 206, 41, 184, 246, 50, 0 },
-        { 120, 178, 168, 165, 72, 91, 1 }, },
-      { { 39, 67, 65, 27, 226, 165, 0 },
-        { 153, 28, 33, 125, 132, 26, 1 },
-        { 82, 163, 236, 65, 97, 114, 0 },
-        { 172, 16, 223, 66, 28, 76, 1 }, },
-      { { 39, 119, 180, 37, 12, 229, 0 },
-        { 197, 109, 130, 94, 69, 156, 1 },
-        { 83, 152, 82, 22, 247, 114, 0 },
-        { 156, 209, 61, 32, 219, 81, 1 }, },
-      { { 36, 140, 97, 44, 211, 5, 0 },
-        { 65, 180, 177, 57, 9, 3, 0 },
-        { 80, 101, 154, 67, 24, 146, 0 },
-        { 96, 72, 78, 70, 150, 193, 0 }, },
-      { { 39, 181, 134, 58, 242, 110, 1 },
-        { 223, 49, 42, 58, 174, 23, 1 },
-        { 187, 39, 174, 48, 214, 242, 0 },
-        { 244, 58, 174, 42, 70, 125, 1 }, },
-      { { 37, 192, 47, 169, 170, 233, 1 },
-        { 47, 44, 160, 237, 42, 150, 1 },
-        { 203, 170, 202, 250, 1, 210, 0 },
-        { 180, 170, 91, 130, 154, 122, 0 }, },
-      { { 37, 193, 244, 243, 24, 172, 1 },
-        { 19, 104, 193, 222, 172, 149, 1 },
-        { 154, 140, 103, 151, 193, 210, 0 },
-        { 212, 154, 189, 193, 139, 100, 0 }, },
-      { { 38, 223, 180, 89, 168, 216, 1 },
-        { 223, 201, 224, 78, 44, 206, 0 },
-        { 141, 138, 205, 22, 253, 178, 0 },
-        { 57, 154, 57, 3, 201, 253, 1 }, },
-      { { 36, 229, 181, 254, 134, 140, 0 },
-        { 81, 104, 226, 191, 237, 6, 0 },
-        { 24, 176, 191, 214, 211, 146, 0 },
-        { 48, 91, 254, 163, 139, 69, 0 }, },
-      { { 36, 250, 147, 106, 49, 84, 1 },
-        { 15, 225, 82, 31, 138, 75, 0 },
-        { 149, 70, 43, 100, 175, 146, 0 },
-        { 105, 40, 252, 37, 67, 248, 0 }, },
-      { { 41, 33, 120, 64, 98, 223, 1 },
-        { 46, 94, 203, 56, 36, 80, 0 },
-        { 253, 163, 1, 15, 66, 74, 0 },
-        { 5, 18, 14, 105, 189, 58, 0 }, },
-      { { 42, 47, 218, 50, 70, 201, 1 },
-        { 246, 254, 3, 42, 230, 8, 0 },
-        { 201, 177, 38, 45, 250, 42, 0 },
-        { 8, 51, 170, 96, 63, 183, 1 }, },
-      { { 40, 62, 63, 42, 103, 4, 0 },
-        { 104, 243, 146, 57, 194, 14, 0 },
-        { 16, 115, 42, 126, 62, 10, 0 },
-        { 56, 33, 206, 36, 231, 139, 0 }, },
-      { { 43, 205, 185, 118, 1, 186, 0 },
-        { 240, 234, 216, 15, 173, 80, 1 },
-        { 46, 192, 55, 78, 217, 234, 0 },
-        { 133, 90, 248, 13, 171, 135, 1 }, },
-      { { 40, 234, 218, 205, 222, 126, 1 },
-        { 38, 210, 107, 254, 107, 203, 1 },
-        { 191, 61, 217, 173, 171, 138, 0 },
-        { 233, 235, 63, 235, 37, 178, 0 }, },
-      { { 44, 77, 140, 242, 231, 58, 1 },
-        { 123, 178, 120, 174, 228, 68, 1 },
-        { 174, 115, 167, 152, 217, 26, 0 },
-        { 145, 19, 186, 143, 38, 239, 0 }, },
-      { { 46, 88, 0, 228, 62, 206, 0 },
-        { 141, 171, 72, 188, 97, 129, 0 },
-        { 57, 190, 19, 128, 13, 58, 0 },
-        { 64, 195, 30, 137, 106, 216, 1 }, },
-      { { 45, 129, 187, 116, 79, 227, 1 },
-        { 55, 126, 216, 43, 79, 144, 1 },
-        { 227, 249, 23, 110, 192, 218, 0 },
-        { 132, 249, 106, 13, 191, 118, 0 }, },
-      { { 44, 145, 67, 129, 237, 29, 0 },
-        { 9, 23, 49, 217, 110, 192, 0 },
-        { 92, 91, 192, 225, 68, 154, 0 },
-        { 1, 187, 77, 198, 116, 72, 0 }, },
-      { { 45, 180, 8, 215, 116, 177, 1 },
-        { 123, 31, 66, 200, 201, 81, 1 },
-        { 198, 151, 117, 136, 22, 218, 0 },
-        { 197, 73, 137, 161, 124, 111, 0 }, },
-      { { 44, 224, 23, 61, 89, 3, 1 },
-        { 19, 118, 26, 77, 11, 135, 0 },
-        { 224, 77, 94, 116, 3, 154, 0 },
-        { 112, 232, 89, 44, 55, 100, 0 }, },
-      { { 48, 9, 23, 86, 236, 208, 1 },
-        { 30, 216, 100, 9, 199, 196, 0 },
-        { 133, 155, 181, 116, 72, 6, 0 },
-        { 17, 241, 200, 19, 13, 188, 0 }, },
-      { { 51, 70, 13, 15, 126, 150, 0 },
-        { 232, 24, 12, 125, 193, 223, 0 },
-        { 52, 191, 120, 88, 49, 102, 0 },
-        { 125, 193, 223, 24, 12, 11, 1 }, },
-      { { 50, 113, 60, 116, 164, 89, 0 },
-        { 188, 101, 230, 12, 101, 68, 0 },
-        { 77, 18, 151, 30, 71, 38, 0 },
-        { 17, 83, 24, 51, 211, 30, 1 }, },
-      { { 48, 167, 239, 179, 52, 231, 1 },
-        { 126, 44, 143, 219, 206, 13, 1 },
-        { 243, 150, 102, 251, 242, 134, 0 },
-        { 216, 57, 237, 248, 154, 63, 0 }, },
-      { { 48, 183, 244, 73, 95, 202, 0 },
-        { 68, 89, 223, 106, 108, 143, 0 },
-        { 41, 253, 73, 23, 246, 134, 0 },
-        { 120, 155, 43, 125, 205, 17, 0 }, },
-      { { 51, 236, 16, 56, 154, 82, 0 },
-        { 212, 224, 46, 44, 8, 211, 0 },
-        { 37, 44, 142, 4, 27, 230, 0 },
-        { 101, 136, 26, 58, 3, 149, 1 }, },
-      { { 53, 106, 133, 153, 65, 91, 0 },
-        { 21, 148, 30, 207, 32, 94, 0 },
-        { 109, 65, 76, 208, 171, 86, 0 },
-        { 61, 2, 121, 188, 20, 212, 0 }, },
-      { { 54, 125, 199, 249, 16, 137, 1 },
-        { 211, 173, 71, 207, 38, 7, 0 },
-        { 200, 132, 79, 241, 223, 54, 0 },
-        { 112, 50, 121, 241, 90, 229, 1 }, },
-      { { 53, 145, 236, 15, 52, 5, 1 },
-        { 43, 5, 133, 90, 205, 23, 0 },
-        { 208, 22, 120, 27, 196, 214, 0 },
-        { 116, 89, 173, 80, 208, 106, 0 }, },
-      { { 58, 31, 122, 71, 185, 141, 0 },
-        { 232, 207, 245, 88, 167, 137, 0 },
-        { 88, 206, 241, 47, 124, 46, 0 },
-        { 72, 242, 141, 87, 249, 139, 1 }, },
-      { { 58, 86, 77, 209, 166, 203, 1 },
-        { 254, 15, 109, 237, 96, 12, 0 },
-        { 233, 178, 197, 217, 53, 46, 0 },
-        { 24, 3, 91, 219, 120, 63, 1 }, },
-      { { 57, 105, 99, 159, 57, 176, 1 },
-        { 26, 138, 151, 205, 135, 211, 1 },
-        { 134, 206, 124, 227, 75, 78, 0 },
-        { 229, 240, 217, 244, 168, 172, 0 }, },
-      { { 59, 96, 103, 17, 227, 243, 0 },
-        { 156, 30, 191, 109, 2, 84, 1 },
-        { 103, 227, 196, 115, 3, 110, 0 },
-        { 149, 32, 91, 126, 188, 28, 1 }, },
-      { { 57, 204, 214, 65, 214, 205, 1 },
-        { 70, 222, 101, 126, 106, 21, 0 },
-        { 217, 181, 193, 53, 153, 206, 0 },
-        { 84, 43, 63, 83, 61, 177, 0 }, },
-      { { 60, 51, 21, 240, 128, 231, 0 },
-        { 21, 111, 110, 153, 4, 12, 1 },
-        { 115, 128, 135, 212, 102, 30, 0 },
-        { 152, 16, 76, 187, 123, 84, 0 }, },
-      { { 60, 51, 197, 75, 3, 115, 1 },
-        { 7, 7, 95, 107, 132, 78, 1 },
-        { 231, 96, 105, 81, 230, 30, 0 },
-        { 185, 16, 235, 125, 112, 112, 0 }, },
-      { { 61, 98, 186, 75, 99, 200, 0 },
-        { 45, 90, 214, 110, 162, 26, 0 },
-        { 9, 227, 105, 46, 163, 94, 0 },
-        { 44, 34, 187, 53, 173, 90, 0 }, },
-      { { 61, 117, 9, 162, 109, 95, 1 },
-        { 111, 55, 30, 157, 228, 208, 0 },
-        { 253, 91, 34, 200, 87, 94, 0 },
-        { 5, 147, 220, 188, 118, 123, 0 }, },
-      { { 63, 152, 179, 12, 62, 51, 1 },
-        { 139, 199, 140, 43, 75, 211, 1 },
-        { 230, 62, 24, 102, 140, 254, 0 },
-        { 229, 233, 106, 24, 241, 232, 1 }, },
-      { { 62, 205, 175, 189, 212, 43, 0 },
-        { 241, 182, 172, 207, 111, 7, 1 },
-        { 106, 21, 222, 250, 217, 190, 0 },
-        { 240, 123, 121, 154, 182, 199, 1 }, },
-      { { 63, 213, 180, 83, 119, 231, 1 },
-        { 223, 95, 220, 126, 204, 21, 1 },
-        { 243, 247, 101, 22, 213, 254, 0 },
-        { 212, 25, 191, 29, 253, 125, 1 }, },
-      { { 60, 233, 181, 48, 105, 180, 0 },
-        { 25, 250, 150, 31, 12, 196, 1 },
-        { 22, 203, 6, 86, 203, 158, 0 },
-        { 145, 152, 124, 52, 175, 204, 0 }, },
-      { { 64, 3, 93, 254, 66, 40, 1 },
-        { 50, 112, 65, 161, 181, 14, 1 },
-        { 138, 33, 63, 221, 96, 1, 0 },
-        { 184, 86, 194, 193, 7, 38, 0 }, },
-      { { 67, 106, 171, 8, 205, 110, 1 },
-        { 166, 144, 186, 23, 114, 154, 1 },
-        { 187, 89, 136, 106, 171, 97, 0 },
-        { 172, 167, 116, 46, 132, 178, 1 }, },
-      { { 67, 113, 229, 169, 206, 30, 1 },
-        { 130, 49, 171, 247, 116, 214, 0 },
-        { 188, 57, 202, 211, 199, 97, 0 },
-        { 53, 151, 119, 234, 198, 32, 1 }, },
-      { { 65, 168, 233, 191, 52, 145, 0 },
-        { 56, 172, 131, 195, 217, 83, 0 },
-        { 68, 150, 126, 203, 138, 193, 0 },
-        { 101, 77, 225, 224, 154, 142, 0 }, },
-      { { 65, 202, 197, 166, 227, 19, 0 },
-        { 8, 180, 57, 167, 153, 92, 0 },
-        { 100, 99, 178, 209, 169, 193, 0 },
-        { 29, 76, 242, 206, 22, 136, 0 }, },
-      { { 66, 247, 60, 189, 2, 52, 0 },
-        { 240, 97, 130, 244, 29, 78, 1 },
-        { 22, 32, 94, 158, 119, 161, 0 },
-        { 185, 92, 23, 160, 195, 7, 1 }, },
-      { { 68, 39, 29, 179, 182, 219, 1 },
-        { 127, 108, 42, 225, 244, 77, 0 },
-        { 237, 182, 230, 220, 114, 17, 0 },
-        { 89, 23, 195, 170, 27, 127, 0 }, },
-      { { 68, 76, 27, 64, 24, 97, 1 },
-        { 103, 196, 64, 5, 18, 129, 1 },
-        { 195, 12, 1, 108, 25, 17, 0 },
-        { 192, 164, 80, 1, 17, 243, 0 }, },
-      { { 70, 74, 152, 175, 201, 220, 0 },
-        { 165, 248, 48, 214, 177, 202, 0 },
-        { 29, 201, 250, 140, 169, 49, 0 },
-        { 41, 198, 181, 134, 15, 210, 1 }, },
-      { { 70, 131, 6, 249, 199, 224, 1 },
-        { 151, 56, 112, 224, 94, 14, 1 },
-        { 131, 241, 207, 176, 96, 177, 0 },
-        { 184, 61, 3, 135, 14, 116, 1 }, },
-      { { 68, 140, 202, 221, 114, 250, 1 },
-        { 127, 152, 73, 226, 59, 67, 1 },
-        { 175, 167, 93, 169, 152, 145, 0 },
-        { 225, 110, 35, 201, 12, 255, 0 }, },
-      { { 70, 158, 58, 59, 116, 65, 1 },
-        { 255, 245, 128, 64, 218, 11, 0 },
-        { 193, 23, 110, 46, 60, 177, 0 },
-        { 104, 45, 129, 0, 215, 255, 1 }, },
-      { { 73, 31, 143, 197, 190, 227, 0 },
-        { 108, 143, 104, 227, 87, 157, 1 },
-        { 99, 190, 209, 248, 252, 73, 0 },
-        { 220, 245, 99, 139, 120, 155, 0 }, },
-      { { 73, 75, 34, 203, 253, 35, 1 },
-        { 10, 150, 248, 196, 214, 155, 1 },
-        { 226, 95, 233, 162, 105, 73, 0 },
-        { 236, 181, 145, 143, 180, 168, 0 }, },
-      { { 73, 91, 8, 111, 19, 202, 1 },
-        { 38, 171, 88, 100, 181, 27, 0 },
-        { 169, 228, 123, 8, 109, 73, 0 },
-        { 108, 86, 147, 13, 106, 178, 0 }, },
-      { { 74, 177, 68, 70, 10, 33, 1 },
-        { 130, 7, 67, 32, 157, 132, 1 },
-        { 194, 40, 49, 17, 70, 169, 0 },
-        { 144, 220, 130, 97, 112, 32, 1 }, },
-      { { 75, 195, 24, 213, 28, 201, 0 },
-        { 180, 78, 64, 196, 125, 153, 0 },
-        { 73, 156, 85, 140, 97, 233, 0 },
-        { 76, 223, 17, 129, 57, 22, 1 }, },
-      { { 76, 116, 244, 77, 39, 23, 1 },
-        { 75, 71, 219, 118, 81, 70, 0 },
-        { 244, 114, 89, 23, 151, 25, 0 },
-        { 49, 69, 55, 109, 241, 105, 0 }, },
-      { { 78, 157, 120, 2, 250, 136, 1 },
-        { 235, 219, 161, 32, 188, 129, 0 },
-        { 136, 175, 160, 15, 92, 185, 0 },
-        { 64, 158, 130, 66, 237, 235, 1 }, },
-      { { 79, 168, 131, 36, 88, 72, 0 },
-        { 133, 178, 2, 3, 59, 145, 0 },
-        { 9, 13, 18, 96, 138, 249, 0 },
-        { 68, 238, 96, 32, 38, 208, 1 }, },
-      { { 77, 204, 62, 66, 47, 44, 0 },
-        { 105, 194, 208, 52, 250, 148, 1 },
-        { 26, 122, 33, 62, 25, 217, 0 },
-        { 148, 175, 150, 5, 161, 203, 0 }, },
-      { { 77, 205, 182, 47, 105, 192, 1 },
-        { 79, 250, 144, 70, 159, 150, 0 },
-        { 129, 203, 122, 54, 217, 217, 0 },
-        { 52, 252, 177, 4, 175, 249, 0 }, },
-      { { 76, 252, 81, 246, 35, 2, 0 },
-        { 89, 227, 91, 165, 153, 0, 0 },
-        { 32, 98, 55, 197, 31, 153, 0 },
-        { 0, 76, 210, 237, 99, 205, 0 }, },
-      { { 77, 248, 189, 181, 78, 179, 0 },
-        { 49, 255, 138, 231, 89, 212, 1 },
-        { 102, 185, 86, 222, 143, 217, 0 },
-        { 149, 205, 115, 168, 255, 198, 0 }, },
-      { { 78, 254, 206, 197, 81, 2, 1 },
-        { 227, 147, 91, 198, 27, 13, 0 },
-        { 160, 69, 81, 185, 191, 185, 0 },
-        { 88, 108, 49, 237, 100, 227, 1 }, },
-      { { 83, 45, 244, 148, 190, 11, 1 },
-        { 218, 196, 175, 162, 117, 149, 0 },
-        { 232, 62, 148, 151, 218, 101, 0 },
-        { 84, 215, 34, 250, 145, 173, 1 }, },
-      { { 83, 55, 48, 177, 237, 76, 1 },
-        { 222, 113, 182, 208, 116, 152, 0 },
-        { 153, 91, 198, 134, 118, 101, 0 },
-        { 12, 151, 5, 182, 199, 61, 1 }, },
-      { { 81, 138, 115, 76, 78, 26, 0 },
-        { 0, 208, 205, 33, 123, 218, 0 },
-        { 44, 57, 25, 103, 40, 197, 0 },
-        { 45, 239, 66, 89, 133, 128, 0 }, },
-      { { 81, 173, 41, 83, 250, 51, 0 },
-        { 120, 148, 238, 97, 156, 209, 1 },
-        { 102, 47, 229, 74, 90, 197, 0 },
-        { 197, 156, 195, 59, 148, 143, 0 }, },
-      { { 80, 244, 139, 181, 87, 23, 1 },
-        { 114, 53, 30, 247, 91, 65, 0 },
-        { 244, 117, 86, 232, 151, 133, 0 },
-        { 65, 109, 119, 188, 86, 39, 0 }, },
-      { { 83, 242, 216, 169, 125, 63, 0 },
-        { 168, 117, 31, 214, 120, 219, 1 },
-        { 126, 95, 74, 141, 167, 229, 0 },
-        { 237, 143, 53, 252, 87, 10, 1 }, },
-      { { 87, 46, 51, 92, 65, 229, 1 },
-        { 215, 220, 214, 17, 19, 26, 1 },
-        { 211, 193, 29, 102, 58, 117, 0 },
-        { 172, 100, 68, 53, 157, 245, 1 }, },
-      { { 85, 97, 138, 153, 243, 43, 1 },
-        { 59, 20, 62, 230, 54, 19, 1 },
-        { 234, 103, 204, 168, 195, 85, 0 },
-        { 228, 54, 51, 190, 20, 110, 0 }, },
-      { { 84, 114, 176, 221, 66, 144, 1 },
-        { 19, 89, 198, 230, 17, 74, 0 },
-        { 132, 161, 93, 134, 167, 21, 0 },
-        { 41, 68, 51, 177, 205, 100, 0 }, },
-      { { 87, 120, 188, 172, 178, 210, 1 },
-        { 175, 233, 174, 166, 17, 87, 0 },
-        { 165, 166, 154, 158, 143, 117, 0 },
-        { 117, 68, 50, 186, 203, 250, 1 }, },
-      { { 85, 178, 111, 85, 255, 238, 1 },
-        { 63, 25, 255, 113, 123, 157, 1 },
-        { 187, 255, 213, 123, 38, 213, 0 },
-        { 220, 239, 71, 127, 204, 126, 0 }, },
-      { { 87, 215, 193, 128, 15, 12, 1 },
-        { 195, 1, 21, 183, 124, 152, 0 },
-        { 152, 120, 0, 193, 245, 245, 0 },
-        { 12, 159, 118, 212, 64, 97, 1 }, },
-      { { 85, 243, 37, 159, 247, 53, 0 },
-        { 25, 21, 182, 245, 221, 95, 1 },
-        { 86, 119, 252, 210, 103, 213, 0 },
-        { 253, 93, 215, 182, 212, 76, 0 }, },
-      { { 90, 0, 169, 237, 210, 158, 0 },
-        { 160, 58, 236, 243, 49, 67, 0 },
-        { 60, 165, 219, 202, 128, 45, 0 },
-        { 97, 70, 103, 155, 174, 2, 1 }, },
-      { { 89, 39, 61, 104, 89, 78, 1 },
-        { 102, 114, 222, 17, 52, 159, 0 },
-        { 185, 77, 11, 94, 114, 77, 0 },
-        { 124, 150, 68, 61, 167, 51, 0 }, },
-      { { 89, 73, 179, 211, 30, 79, 0 },
-        { 20, 198, 204, 247, 246, 145, 0 },
-        { 121, 60, 101, 230, 201, 77, 0 },
-        { 68, 183, 247, 153, 177, 148, 0 }, },
-      { { 91, 92, 30, 37, 185, 241, 1 },
-        { 238, 239, 52, 68, 19, 213, 1 },
-        { 199, 206, 210, 60, 29, 109, 0 },
-        { 213, 228, 17, 22, 123, 187, 1 }, },
-      { { 89, 81, 133, 145, 139, 249, 0 },
-        { 20, 15, 52, 231, 52, 212, 1 },
-        { 79, 232, 196, 208, 197, 77, 0 },
-        { 149, 150, 115, 150, 120, 20, 0 }, },
-      { { 91, 156, 92, 115, 202, 248, 1 },
-        { 246, 251, 101, 96, 184, 212, 1 },
-        { 143, 169, 231, 29, 28, 237, 0 },
-        { 149, 142, 131, 83, 111, 183, 1 }, },
-      { { 90, 148, 209, 233, 34, 152, 1 },
-        { 202, 107, 69, 227, 56, 66, 0 },
-        { 140, 162, 75, 197, 148, 173, 0 },
-        { 33, 14, 99, 209, 107, 41, 1 }, },
-      { { 88, 170, 155, 107, 27, 52, 0 },
-        { 32, 226, 86, 115, 154, 203, 1 },
-        { 22, 108, 107, 108, 170, 141, 0 },
-        { 233, 172, 231, 53, 35, 130, 0 }, },
-      { { 90, 202, 163, 22, 250, 87, 1 },
-        { 158, 150, 172, 55, 155, 201, 0 },
-        { 245, 47, 180, 98, 169, 173, 0 },
-        { 73, 236, 246, 26, 180, 188, 1 }, },
-      { { 88, 216, 190, 3, 241, 57, 0 },
-        { 40, 215, 180, 70, 186, 69, 1 },
-        { 78, 71, 224, 62, 141, 141, 0 },
-        { 209, 46, 177, 22, 245, 138, 0 }, },
-      { { 90, 253, 27, 96, 216, 252, 0 },
-        { 228, 251, 102, 21, 62, 193, 1 },
-        { 31, 141, 131, 108, 95, 173, 0 },
-        { 193, 190, 84, 51, 111, 147, 1 }, },
-      { { 93, 40, 12, 244, 83, 170, 1 },
-        { 51, 186, 94, 160, 49, 21, 1 },
-        { 170, 229, 23, 152, 10, 93, 0 },
-        { 212, 70, 2, 189, 46, 230, 0 }, },
-      { { 94, 52, 215, 24, 145, 91, 0 },
-        { 213, 71, 63, 3, 50, 71, 0 },
-        { 109, 68, 140, 117, 150, 61, 0 },
-        { 113, 38, 96, 126, 113, 85, 1 }, },
-      { { 94, 140, 231, 129, 51, 103, 0 },
-        { 205, 134, 157, 243, 26, 5, 1 },
-        { 115, 102, 64, 243, 152, 189, 0 },
-        { 208, 44, 103, 220, 176, 217, 1 }, },
-      { { 92, 240, 52, 170, 32, 5, 0 },
-        { 9, 103, 134, 148, 152, 6, 0 },
-        { 80, 2, 42, 150, 7, 157, 0 },
-        { 48, 12, 148, 176, 243, 72, 0 }, },
-      { { 99, 47, 8, 198, 1, 227, 0 },
-        { 228, 140, 90, 136, 149, 24, 1 },
-        { 99, 192, 49, 136, 122, 99, 0 },
-        { 140, 84, 136, 173, 24, 147, 1 }, },
-      { { 97, 34, 240, 131, 154, 222, 0 },
-        { 4, 72, 171, 250, 176, 217, 0 },
-        { 61, 172, 224, 135, 162, 67, 0 },
-        { 77, 134, 175, 234, 137, 16, 0 }, },
-      { { 97, 64, 6, 28, 66, 91, 1 },
-        { 22, 20, 8, 44, 51, 86, 0 },
-        { 237, 33, 28, 48, 1, 67, 0 },
-        { 53, 102, 26, 8, 20, 52, 0 }, },
-      { { 99, 104, 252, 248, 31, 16, 0 },
-        { 176, 224, 211, 174, 80, 215, 0 },
-        { 4, 124, 15, 159, 139, 99, 0 },
-        { 117, 133, 58, 229, 131, 134, 1 }, },
-      { { 98, 163, 80, 160, 5, 206, 1 },
-        { 134, 104, 27, 152, 124, 8, 0 },
-        { 185, 208, 2, 133, 98, 163, 0 },
-        { 8, 31, 12, 236, 11, 48, 1 }, },
-      { { 96, 207, 8, 137, 207, 134, 1 },
-        { 98, 152, 56, 252, 92, 138, 0 },
-        { 176, 249, 200, 136, 121, 131, 0 },
-        { 40, 157, 31, 142, 12, 163, 0 }, },
-      { { 100, 31, 102, 147, 38, 250, 0 },
-        { 93, 137, 137, 232, 246, 76, 1 },
-        { 47, 178, 100, 179, 124, 19, 0 },
-        { 153, 55, 139, 200, 200, 221, 0 }, },
-      { { 103, 84, 36, 66, 155, 194, 1 },
-        { 199, 9, 248, 44, 144, 149, 0 },
-        { 161, 236, 161, 18, 21, 115, 0 },
-        { 84, 132, 154, 15, 200, 113, 1 }, },
-      { { 103, 94, 109, 245, 161, 167, 0 },
-        { 249, 173, 249, 221, 17, 28, 1 },
-        { 114, 194, 215, 219, 61, 115, 0 },
-        { 156, 68, 93, 207, 218, 207, 1 }, },
-      { { 100, 112, 128, 63, 112, 33, 0 },
-        { 25, 53, 2, 78, 145, 3, 1 },
-        { 66, 7, 126, 0, 135, 19, 0 },
-        { 224, 68, 185, 32, 86, 76, 0 }, },
-      { { 101, 113, 143, 62, 145, 182, 1 },
-        { 51, 41, 58, 31, 151, 87, 1 },
-        { 182, 196, 190, 120, 199, 83, 0 },
-        { 245, 116, 252, 46, 74, 102, 0 }, },
-      { { 103, 153, 192, 236, 194, 232, 1 },
-        { 135, 185, 97, 170, 61, 18, 1 },
-        { 139, 161, 155, 129, 204, 243, 0 },
-        { 164, 94, 42, 195, 78, 240, 1 }, },
-      { { 102, 181, 191, 1, 79, 214, 0 },
-        { 229, 89, 154, 123, 94, 196, 0 },
-        { 53, 249, 64, 126, 214, 179, 0 },
-        { 17, 189, 111, 44, 205, 83, 1 }, },
-      { { 103, 209, 57, 91, 135, 184, 0 },
-        { 177, 73, 240, 109, 252, 82, 1 },
-        { 14, 240, 237, 78, 69, 243, 0 },
-        { 165, 31, 219, 7, 201, 70, 1 }, },
-      { { 101, 214, 185, 83, 116, 18, 0 },
-        { 121, 81, 200, 79, 216, 89, 0 },
-        { 36, 23, 101, 78, 181, 211, 0 },
-        { 77, 13, 249, 9, 197, 79, 0 }, },
-      { { 107, 53, 69, 174, 190, 183, 0 },
-        { 200, 47, 43, 185, 213, 215, 1 },
-        { 118, 190, 186, 209, 86, 107, 0 },
-        { 245, 213, 206, 234, 122, 9, 1 }, },
-      { { 106, 85, 31, 116, 156, 15, 1 },
-        { 242, 103, 104, 29, 119, 133, 0 },
-        { 248, 28, 151, 124, 85, 43, 0 },
-        { 80, 247, 92, 11, 115, 39, 1 }, },
-      { { 105, 214, 240, 35, 1, 52, 0 },
-        { 64, 99, 145, 94, 152, 88, 1 },
-        { 22, 64, 98, 7, 181, 203, 0 },
-        { 141, 12, 189, 68, 227, 1, 0 }, },
-      { { 107, 214, 206, 166, 84, 232, 1 },
-        { 230, 59, 1, 142, 251, 29, 1 },
-        { 139, 149, 50, 185, 181, 235, 0 },
-        { 220, 111, 184, 192, 110, 51, 1 }, },
-      { { 108, 83, 126, 168, 65, 235, 0 },
-        { 37, 127, 153, 140, 54, 14, 1 },
-        { 107, 193, 10, 191, 101, 27, 0 },
-        { 184, 54, 24, 204, 255, 82, 0 }, },
-      { { 110, 99, 164, 20, 64, 36, 1 },
-        { 147, 18, 130, 30, 21, 12, 1 },
-        { 146, 1, 20, 18, 227, 59, 0 },
-        { 152, 84, 60, 32, 164, 100, 1 }, },
-      { { 108, 120, 204, 22, 132, 88, 1 },
-        { 55, 131, 35, 14, 241, 68, 0 },
-        { 141, 16, 180, 25, 143, 27, 0 },
-        { 17, 71, 184, 98, 96, 246, 0 }, },
-      { { 108, 206, 226, 122, 51, 47, 0 },
-        { 89, 166, 217, 62, 186, 11, 1 },
-        { 122, 102, 47, 35, 185, 155, 0 },
-        { 232, 46, 190, 77, 178, 205, 0 }, },
-      { { 111, 226, 98, 8, 71, 155, 0 },
-        { 129, 30, 155, 44, 122, 90, 0 },
-        { 108, 241, 8, 35, 35, 251, 0 },
-        { 45, 47, 26, 108, 188, 64, 1 }, },
-      { { 113, 2, 15, 225, 198, 243, 0 },
-        { 36, 60, 108, 233, 82, 92, 1 },
-        { 103, 177, 195, 248, 32, 71, 0 },
-        { 157, 37, 75, 155, 30, 18, 0 }, },
-      { { 113, 1, 66, 223, 219, 44, 0 },
-        { 16, 16, 117, 248, 183, 147, 1 },
-        { 26, 109, 253, 161, 64, 71, 0 },
-        { 228, 246, 143, 215, 4, 4, 0 }, },
-      { { 114, 10, 186, 206, 130, 96, 0 },
-        { 164, 192, 228, 170, 147, 10, 1 },
-        { 3, 32, 185, 174, 168, 39, 0 },
-        { 168, 100, 170, 147, 129, 146, 1 }, },
-      { { 114, 76, 255, 13, 215, 153, 0 },
-        { 224, 220, 181, 111, 115, 71, 0 },
-        { 76, 245, 216, 127, 153, 39, 0 },
-        { 113, 103, 123, 86, 157, 131, 1 }, },
-      { { 112, 148, 200, 167, 175, 228, 0 },
-        { 108, 41, 53, 250, 217, 128, 1 },
-        { 19, 250, 242, 137, 148, 135, 0 },
-        { 128, 205, 175, 214, 74, 27, 0 }, },
-      { { 115, 219, 92, 88, 31, 37, 1 },
-        { 178, 197, 85, 60, 92, 159, 1 },
-        { 210, 124, 13, 29, 109, 231, 0 },
-        { 252, 157, 30, 85, 81, 166, 1 }, },
-      { { 113, 220, 240, 226, 63, 213, 1 },
-        { 78, 237, 213, 190, 216, 209, 0 },
-        { 213, 254, 35, 135, 157, 199, 0 },
-        { 69, 141, 190, 213, 219, 185, 0 }, },
-      { { 115, 240, 217, 222, 113, 35, 1 },
-        { 186, 85, 95, 143, 153, 19, 1 },
-        { 226, 71, 61, 205, 135, 231, 0 },
-        { 228, 76, 248, 253, 85, 46, 1 }, },
-      { { 117, 16, 178, 106, 60, 109, 0 },
-        { 13, 101, 196, 26, 242, 147, 1 },
-        { 91, 30, 43, 38, 132, 87, 0 },
-        { 228, 167, 172, 17, 211, 88, 0 }, },
-      { { 117, 125, 232, 146, 6, 63, 0 },
-        { 113, 133, 143, 190, 244, 80, 1 },
-        { 126, 48, 36, 139, 223, 87, 0 },
-        { 133, 23, 190, 248, 208, 199, 0 }, },
-      { { 116, 159, 153, 133, 17, 253, 0 },
-        { 101, 205, 20, 219, 61, 73, 1 },
-        { 95, 196, 80, 204, 252, 151, 0 },
-        { 201, 94, 109, 148, 89, 211, 0 }, },
-      { { 122, 14, 219, 24, 154, 237, 0 },
-        { 244, 206, 37, 59, 50, 139, 1 },
-        { 91, 172, 140, 109, 184, 47, 0 },
-        { 232, 166, 110, 82, 57, 151, 1 }, },
-      { { 121, 22, 143, 58, 72, 165, 1 },
-        { 114, 63, 4, 27, 146, 158, 1 },
-        { 210, 137, 46, 120, 180, 79, 0 },
-        { 188, 164, 236, 16, 126, 39, 0 }, },
-      { { 121, 188, 129, 6, 112, 53, 0 },
-        { 72, 151, 6, 27, 153, 81, 1 },
-        { 86, 7, 48, 64, 158, 207, 0 },
-        { 197, 76, 236, 48, 116, 137, 0 }, },
-      { { 125, 77, 194, 163, 143, 129, 1 },
-        { 67, 174, 53, 238, 214, 144, 0 },
-        { 192, 248, 226, 161, 217, 95, 0 },
-        { 4, 181, 187, 214, 58, 225, 0 }, },
-      { { 124, 135, 26, 99, 181, 78, 0 },
-        { 109, 98, 124, 88, 254, 9, 0 },
-        { 57, 86, 227, 44, 112, 159, 0 },
-        { 72, 63, 141, 31, 35, 91, 0 }, },
-      { { 127, 162, 123, 214, 2, 146, 1 },
-        { 179, 74, 207, 169, 155, 88, 0 },
-        { 164, 160, 53, 239, 34, 255, 0 },
-        { 13, 108, 202, 249, 169, 102, 1 }, },
-      { { 125, 171, 223, 59, 221, 197, 1 },
-        { 55, 254, 55, 91, 222, 159, 0 },
-        { 209, 221, 238, 125, 234, 223, 0 },
-        { 124, 189, 237, 118, 63, 246, 0 }, },
-      { { 125, 187, 65, 173, 85, 124, 1 },
-        { 7, 179, 23, 217, 125, 91, 1 },
-        { 159, 85, 90, 193, 110, 223, 0 },
-        { 237, 95, 77, 244, 102, 240, 0 }, },
-      { { 131, 4, 66, 138, 233, 199, 0 },
-        { 204, 28, 57, 144, 130, 178, 0 },
-        { 113, 203, 168, 161, 16, 96, 1 },
-        { 38, 160, 132, 206, 28, 25, 1 }, },
-      { { 131, 43, 42, 216, 218, 107, 1 },
-        { 182, 148, 234, 160, 38, 187, 1 },
-        { 235, 45, 141, 170, 106, 96, 1 },
-        { 238, 178, 2, 171, 148, 182, 1 }, },
-      { { 129, 42, 82, 146, 228, 127, 0 },
-        { 28, 212, 43, 144, 226, 120, 1 },
-        { 127, 19, 164, 165, 42, 64, 1 },
-        { 143, 35, 132, 234, 21, 156, 0 }, },
-      { { 129, 56, 22, 164, 149, 242, 0 },
-        { 4, 233, 58, 128, 67, 117, 1 },
-        { 39, 212, 146, 180, 14, 64, 1 },
-        { 215, 97, 0, 174, 75, 144, 0 }, },
-      { { 129, 100, 221, 191, 156, 110, 1 },
-        { 118, 96, 43, 215, 225, 183, 1 },
-        { 187, 28, 254, 221, 147, 64, 1 },
-        { 246, 195, 245, 234, 3, 55, 0 }, },
-      { { 129, 123, 93, 252, 187, 253, 1 },
-        { 62, 237, 115, 181, 37, 255, 1 },
-        { 223, 238, 159, 221, 111, 64, 1 },
-        { 255, 210, 86, 231, 91, 190, 0 }, },
-      { { 130, 178, 225, 68, 80, 78, 0 },
-        { 132, 17, 203, 19, 41, 41, 0 },
-        { 57, 5, 17, 67, 166, 160, 1 },
-        { 74, 74, 100, 105, 196, 16, 1 }, },
-      { { 128, 247, 188, 97, 25, 21, 0 },
-        { 96, 101, 210, 86, 12, 237, 0 },
-        { 84, 76, 67, 30, 247, 128, 1 },
-        { 91, 152, 53, 37, 211, 3, 0 }, },
-      { { 135, 52, 106, 165, 125, 200, 0 },
-        { 237, 57, 147, 192, 99, 177, 0 },
-        { 9, 223, 82, 171, 22, 112, 1 },
-        { 70, 227, 1, 228, 206, 91, 1 }, },
-      { { 132, 140, 23, 210, 149, 239, 1 },
-        { 87, 204, 120, 145, 234, 37, 1 },
-        { 251, 212, 165, 244, 24, 144, 1 },
-        { 210, 43, 196, 143, 25, 245, 0 }, },
-      { { 132, 150, 182, 186, 170, 44, 0 },
-        { 89, 97, 160, 178, 170, 174, 1 },
-        { 26, 42, 174, 182, 180, 144, 1 },
-        { 186, 170, 166, 130, 195, 77, 0 }, },
-      { { 135, 156, 185, 242, 219, 180, 0 },
-        { 241, 249, 240, 179, 136, 241, 1 },
-        { 22, 237, 167, 206, 156, 240, 1 },
-        { 199, 136, 230, 135, 207, 199, 1 }, },
-      { { 132, 196, 118, 79, 240, 21, 1 },
-        { 75, 84, 225, 84, 139, 103, 0 },
-        { 212, 7, 249, 55, 17, 144, 1 },
-        { 115, 104, 149, 67, 149, 105, 0 }, },
-      { { 135, 196, 142, 129, 238, 18, 1 },
-        { 235, 16, 40, 230, 74, 244, 0 },
-        { 164, 59, 192, 184, 145, 240, 1 },
-        { 23, 169, 51, 138, 4, 107, 1 }, },
-      { { 133, 225, 245, 45, 64, 89, 1 },
-        { 7, 116, 131, 71, 45, 118, 0 },
-        { 205, 1, 90, 87, 195, 208, 1 },
-        { 55, 90, 113, 96, 151, 112, 0 }, },
-      { { 137, 14, 35, 66, 210, 193, 1 },
-        { 70, 158, 224, 33, 130, 57, 0 },
-        { 193, 165, 161, 98, 56, 72, 1 },
-        { 78, 32, 194, 3, 188, 177, 0 }, },
-      { { 138, 56, 218, 197, 237, 134, 1 },
-        { 170, 219, 123, 210, 67, 160, 0 },
-        { 176, 219, 209, 173, 142, 40, 1 },
-        { 2, 225, 37, 239, 109, 170, 1 }, },
-      { { 138, 149, 152, 168, 110, 21, 0 },
-        { 232, 119, 0, 178, 76, 226, 0 },
-        { 84, 59, 10, 140, 212, 168, 1 },
-        { 35, 153, 38, 128, 119, 11, 1 }, },
-      { { 141, 29, 47, 20, 46, 123, 1 },
-        { 127, 135, 136, 33, 103, 244, 1 },
-        { 239, 58, 20, 122, 92, 88, 1 },
-        { 151, 243, 66, 8, 240, 255, 0 }, },
-      { { 141, 111, 99, 41, 14, 170, 1 },
-        { 67, 170, 139, 101, 102, 186, 1 },
-        { 170, 184, 74, 99, 123, 88, 1 },
-        { 174, 179, 83, 104, 170, 225, 0 }, },
-      { { 142, 178, 140, 83, 176, 124, 1 },
-        { 191, 3, 98, 82, 168, 109, 1 },
-        { 159, 6, 229, 24, 166, 184, 1 },
-        { 219, 10, 165, 35, 96, 126, 1 }, },
-      { { 142, 222, 235, 43, 219, 30, 1 },
-        { 227, 179, 185, 119, 170, 235, 0 },
-        { 188, 109, 234, 107, 189, 184, 1 },
-        { 107, 170, 247, 78, 230, 227, 1 }, },
-      { { 141, 245, 6, 243, 158, 250, 0 },
-        { 85, 43, 106, 228, 238, 245, 1 },
-        { 47, 188, 231, 176, 87, 216, 1 },
-        { 215, 187, 147, 171, 106, 85, 0 }, },
-      { { 144, 23, 149, 47, 152, 143, 0 },
-        { 64, 109, 44, 83, 165, 175, 0 },
-        { 120, 140, 250, 84, 244, 4, 1 },
-        { 122, 210, 229, 26, 91, 1, 0 }, },
-      { { 145, 35, 7, 27, 254, 232, 0 },
-        { 28, 24, 38, 97, 230, 191, 1 },
-        { 11, 191, 236, 112, 98, 68, 1 },
-        { 254, 179, 195, 50, 12, 28, 0 }, },
-      { { 144, 37, 85, 177, 206, 2, 1 },
-        { 82, 112, 47, 225, 68, 164, 0 },
-        { 160, 57, 198, 213, 82, 4, 1 },
-        { 18, 145, 67, 250, 7, 37, 0 }, },
-      { { 144, 40, 188, 66, 77, 232, 0 },
-        { 36, 216, 214, 2, 224, 164, 1 },
-        { 11, 217, 33, 30, 138, 4, 1 },
-        { 146, 131, 160, 53, 141, 146, 0 }, },
-      { { 144, 57, 208, 138, 32, 54, 1 },
-        { 10, 193, 15, 146, 132, 98, 1 },
-        { 182, 2, 40, 133, 206, 4, 1 },
-        { 163, 16, 164, 248, 65, 168, 0 }, },
-      { { 147, 79, 149, 211, 130, 90, 0 },
-        { 212, 192, 108, 231, 164, 124, 0 },
-        { 45, 32, 229, 212, 249, 100, 1 },
-        { 31, 18, 243, 155, 1, 149, 1 }, },
-      { { 146, 164, 210, 234, 226, 74, 0 },
-        { 204, 112, 111, 162, 170, 34, 0 },
-        { 41, 35, 171, 165, 146, 164, 1 },
-        { 34, 42, 162, 251, 7, 25, 1 }, },
-      { { 145, 180, 112, 9, 138, 92, 1 },
-        { 70, 65, 167, 112, 40, 242, 0 },
-        { 157, 40, 200, 7, 22, 196, 1 },
-        { 39, 138, 7, 114, 193, 49, 0 }, },
-      { { 147, 222, 25, 219, 41, 219, 1 },
-        { 254, 205, 92, 197, 168, 250, 0 },
-        { 237, 202, 109, 204, 61, 228, 1 },
-        { 47, 138, 209, 157, 89, 191, 1 }, },
-      { { 145, 229, 150, 87, 118, 92, 0 },
-        { 92, 80, 70, 118, 239, 117, 0 },
-        { 29, 55, 117, 52, 211, 196, 1 },
-        { 87, 123, 183, 49, 5, 29, 0 }, },
-      { { 146, 236, 144, 218, 63, 135, 0 },
-        { 216, 204, 94, 182, 200, 163, 0 },
-        { 112, 254, 45, 132, 155, 164, 1 },
-        { 98, 137, 182, 189, 25, 141, 1 }, },
-      { { 146, 252, 112, 168, 201, 176, 0 },
-        { 192, 249, 183, 132, 8, 226, 1 },
-        { 6, 201, 138, 135, 31, 164, 1 },
-        { 163, 136, 16, 246, 207, 129, 1 }, },
-      { { 149, 25, 170, 136, 106, 158, 1 },
-        { 43, 153, 140, 178, 38, 242, 0 },
-        { 188, 171, 8, 170, 204, 84, 1 },
-        { 39, 178, 38, 152, 204, 234, 0 }, },
-      { { 148, 82, 41, 183, 65, 127, 0 },
-        { 53, 53, 156, 213, 161, 104, 1 },
-        { 127, 65, 118, 202, 37, 20, 1 },
-        { 139, 66, 213, 156, 214, 86, 0 }, },
-      { { 148, 87, 59, 92, 68, 38, 1 },
-        { 115, 81, 204, 21, 71, 42, 1 },
-        { 178, 17, 29, 110, 117, 20, 1 },
-        { 170, 113, 84, 25, 197, 103, 0 }, },
-      { { 151, 82, 5, 249, 168, 20, 0 },
-        { 153, 33, 100, 213, 0, 254, 0 },
-        { 20, 10, 207, 208, 37, 116, 1 },
-        { 63, 128, 85, 147, 66, 76, 1 }, },
-      { { 150, 156, 251, 61, 143, 160, 1 },
-        { 243, 233, 181, 99, 75, 162, 1 },
-        { 130, 248, 222, 111, 156, 180, 1 },
-        { 162, 233, 99, 86, 203, 231, 1 }, },
-      { { 151, 163, 111, 26, 69, 144, 1 },
-        { 179, 24, 151, 1, 206, 126, 0 },
-        { 132, 209, 44, 123, 98, 244, 1 },
-        { 63, 57, 192, 116, 140, 102, 1 }, },
-      { { 151, 170, 229, 229, 236, 98, 0 },
-        { 141, 176, 239, 195, 73, 188, 1 },
-        { 35, 27, 211, 211, 170, 244, 1 },
-        { 158, 201, 97, 251, 134, 216, 1 }, },
-      { { 151, 229, 170, 59, 113, 88, 1 },
-        { 255, 48, 150, 70, 174, 115, 0 },
-        { 141, 71, 110, 42, 211, 244, 1 },
-        { 103, 58, 177, 52, 134, 127, 1 }, },
-      { { 154, 32, 49, 130, 105, 146, 1 },
-        { 138, 90, 158, 129, 128, 224, 0 },
-        { 164, 203, 32, 198, 2, 44, 1 },
-        { 3, 128, 192, 188, 173, 40, 1 }, },
-      { { 153, 69, 56, 75, 61, 53, 1 },
-        { 106, 70, 212, 84, 196, 243, 1 },
-        { 214, 94, 105, 14, 81, 76, 1 },
-        { 231, 145, 149, 21, 177, 43, 0 }, },
-      { { 154, 177, 236, 143, 208, 111, 1 },
-        { 166, 23, 175, 210, 173, 39, 1 },
-        { 251, 5, 248, 155, 198, 172, 1 },
-        { 242, 90, 165, 250, 244, 50, 1 }, },
-      { { 154, 213, 151, 178, 63, 108, 1 },
-        { 222, 99, 20, 183, 238, 165, 1 },
-        { 155, 126, 38, 244, 213, 172, 1 },
-        { 210, 187, 246, 148, 99, 61, 1 }, },
-      { { 153, 249, 19, 79, 121, 230, 0 },
-        { 12, 219, 94, 85, 143, 179, 1 },
-        { 51, 207, 121, 100, 79, 204, 1 },
-        { 230, 248, 213, 61, 109, 152, 0 }, },
-      { { 158, 24, 232, 0, 191, 106, 1 },
-        { 175, 131, 189, 34, 96, 161, 1 },
-        { 171, 126, 128, 11, 140, 60, 1 },
-        { 194, 131, 34, 94, 224, 250, 1 }, },
-      { { 159, 72, 93, 163, 29, 40, 1 },
-        { 163, 226, 21, 197, 224, 181, 1 },
-        { 138, 92, 98, 221, 9, 124, 1 },
-        { 214, 131, 209, 212, 35, 226, 1 }, },
-      { { 159, 84, 21, 142, 137, 140, 0 },
-        { 193, 75, 52, 149, 161, 182, 0 },
-        { 24, 200, 184, 212, 21, 124, 1 },
-        { 54, 194, 212, 150, 105, 65, 1 }, },
-      { { 157, 106, 155, 82, 57, 78, 1 },
-        { 63, 194, 94, 23, 162, 185, 0 },
-        { 185, 78, 37, 108, 171, 92, 1 },
-        { 78, 162, 244, 61, 33, 254, 0 }, },
-      { { 158, 111, 156, 10, 159, 118, 0 },
-        { 229, 194, 62, 54, 196, 239, 1 },
-        { 55, 124, 168, 28, 251, 60, 1 },
-        { 251, 145, 182, 62, 33, 211, 1 }, },
-      { { 160, 9, 100, 5, 91, 91, 0 },
-        { 4, 148, 153, 104, 37, 229, 0 },
-        { 109, 109, 80, 19, 72, 2, 1 },
-        { 83, 210, 11, 76, 148, 144, 0 }, },
-      { { 162, 60, 219, 252, 54, 178, 0 },
-        { 248, 233, 75, 171, 67, 99, 1 },
-        { 38, 182, 31, 237, 158, 34, 1 },
-        { 227, 97, 106, 233, 75, 143, 1 }, },
-      { { 163, 91, 247, 118, 247, 143, 0 },
-        { 152, 253, 249, 63, 231, 61, 0 },
-        { 120, 247, 183, 119, 237, 98, 1 },
-        { 94, 115, 254, 79, 223, 140, 1 }, },
-      { { 162, 157, 115, 18, 132, 59, 0 },
-        { 208, 197, 169, 9, 238, 96, 1 },
-        { 110, 16, 164, 103, 92, 162, 1 },
-        { 131, 59, 200, 74, 209, 133, 1 }, },
-      { { 160, 206, 10, 169, 116, 87, 0 },
-        { 108, 180, 8, 220, 74, 107, 0 },
-        { 117, 23, 74, 168, 57, 130, 1 },
-        { 107, 41, 29, 136, 22, 155, 0 }, },
-      { { 160, 220, 172, 38, 43, 179, 1 },
-        { 106, 173, 152, 46, 137, 228, 1 },
-        { 230, 234, 50, 26, 157, 130, 1 },
-        { 147, 200, 186, 12, 218, 171, 0 }, },
-      { { 162, 245, 118, 116, 106, 43, 1 },
-        { 218, 117, 203, 44, 47, 164, 1 },
-        { 234, 43, 23, 55, 87, 162, 1 },
-        { 146, 250, 26, 105, 215, 45, 1 }, },
-      { { 166, 47, 214, 238, 159, 142, 1 },
-        { 195, 232, 123, 186, 231, 175, 0 },
-        { 184, 252, 187, 181, 250, 50, 1 },
-        { 122, 243, 174, 239, 11, 225, 1 }, },
-      { { 165, 56, 116, 248, 96, 115, 1 },
-        { 31, 245, 203, 136, 0, 118, 1 },
-        { 231, 3, 15, 151, 14, 82, 1 },
-        { 183, 0, 8, 233, 215, 252, 0 }, },
-      { { 164, 94, 71, 141, 231, 74, 0 },
-        { 77, 145, 57, 237, 99, 46, 0 },
-        { 41, 115, 216, 241, 61, 18, 1 },
-        { 58, 99, 91, 206, 68, 217, 0 }, },
-      { { 167, 93, 87, 124, 48, 116, 1 },
-        { 223, 225, 65, 29, 7, 119, 1 },
-        { 151, 6, 31, 117, 93, 114, 1 },
-        { 247, 112, 92, 65, 67, 253, 1 }, },
-      { { 166, 114, 149, 34, 69, 134, 0 },
-        { 129, 121, 26, 31, 192, 44, 0 },
-        { 48, 209, 34, 84, 167, 50, 1 },
-        { 26, 1, 252, 44, 79, 64, 1 }, },
-      { { 165, 131, 104, 82, 20, 90, 0 },
-        { 53, 0, 201, 8, 236, 121, 0 },
-        { 45, 20, 37, 11, 96, 210, 1 },
-        { 79, 27, 136, 73, 128, 86, 0 }, },
-      { { 164, 155, 84, 147, 194, 3, 0 },
-        { 17, 213, 41, 232, 140, 44, 0 },
-        { 96, 33, 228, 149, 108, 146, 1 },
-        { 26, 24, 139, 202, 85, 196, 0 }, },
-      { { 166, 189, 42, 131, 213, 14, 0 },
-        { 225, 145, 186, 216, 238, 33, 0 },
-        { 56, 85, 224, 170, 94, 178, 1 },
-        { 66, 59, 141, 174, 196, 195, 1 }, },
-      { { 169, 7, 89, 5, 251, 125, 0 },
-        { 108, 86, 49, 121, 37, 249, 1 },
-        { 95, 111, 208, 77, 112, 74, 1 },
-        { 207, 210, 79, 70, 53, 27, 0 }, },
-      { { 169, 21, 217, 154, 37, 235, 1 },
-        { 126, 79, 25, 139, 228, 50, 1 },
-        { 235, 210, 44, 205, 212, 74, 1 },
-        { 166, 19, 232, 204, 121, 63, 0 }, },
-      { { 171, 34, 146, 112, 50, 2, 0 },
-        { 152, 98, 74, 42, 2, 57, 0 },
-        { 32, 38, 7, 36, 162, 106, 1 },
-        { 78, 32, 42, 41, 35, 12, 1 }, },
-      { { 169, 55, 228, 166, 33, 245, 1 },
-        { 78, 47, 147, 154, 133, 124, 1 },
-        { 215, 194, 50, 147, 246, 74, 1 },
-        { 159, 80, 172, 228, 250, 57, 0 }, },
-      { { 170, 114, 189, 81, 74, 123, 0 },
-        { 180, 87, 202, 111, 32, 236, 1 },
-        { 111, 41, 69, 94, 167, 42, 1 },
-        { 155, 130, 123, 41, 245, 22, 1 }, },
-      { { 168, 137, 199, 107, 240, 9, 0 },
-        { 8, 182, 97, 75, 174, 39, 0 },
-        { 72, 7, 235, 113, 200, 138, 1 },
-        { 114, 58, 233, 67, 54, 136, 0 }, },
-      { { 170, 213, 171, 110, 131, 212, 1 },
-        { 230, 43, 240, 63, 143, 98, 0 },
-        { 149, 224, 187, 106, 213, 170, 1 },
-        { 35, 120, 254, 7, 234, 51, 1 }, },
-      { { 168, 211, 200, 181, 190, 175, 0 },
-        { 56, 47, 41, 254, 109, 169, 1 },
-        { 122, 190, 214, 137, 229, 138, 1 },
-        { 202, 219, 63, 202, 122, 14, 0 }, },
-      { { 174, 20, 19, 54, 167, 164, 0 },
-        { 217, 107, 48, 57, 195, 32, 1 },
-        { 18, 242, 182, 100, 20, 58, 1 },
-        { 130, 97, 206, 6, 107, 77, 1 }, },
-      { { 173, 100, 135, 249, 112, 220, 1 },
-        { 95, 58, 66, 223, 34, 119, 0 },
-        { 157, 135, 79, 240, 147, 90, 1 },
-        { 119, 34, 125, 161, 46, 125, 0 }, },
-      { { 175, 121, 76, 217, 234, 209, 1 },
-        { 191, 159, 99, 236, 4, 246, 0 },
-        { 197, 171, 205, 153, 79, 122, 1 },
-        { 55, 144, 27, 227, 124, 254, 1 }, },
-      { { 173, 154, 157, 184, 0, 254, 1 },
-        { 55, 235, 8, 155, 40, 126, 1 },
-        { 191, 128, 14, 220, 172, 218, 1 },
-        { 191, 10, 108, 136, 107, 246, 0 }, },
-      { { 175, 156, 136, 245, 213, 82, 0 },
-        { 245, 179, 120, 202, 73, 113, 0 },
-        { 37, 85, 215, 136, 156, 250, 1 },
-        { 71, 73, 41, 143, 102, 215, 1 }, },
-      { { 173, 207, 238, 79, 108, 35, 0 },
-        { 105, 150, 201, 78, 207, 190, 1 },
-        { 98, 27, 121, 59, 249, 218, 1 },
-        { 190, 249, 185, 73, 180, 203, 0 }, },
-      { { 173, 247, 163, 231, 58, 61, 1 },
-        { 75, 39, 194, 255, 175, 249, 1 },
-        { 222, 46, 115, 226, 247, 218, 1 },
-        { 207, 250, 255, 161, 242, 105, 0 }, },
-      { { 178, 65, 252, 215, 31, 187, 0 },
-        { 176, 76, 221, 238, 229, 229, 1 },
-        { 110, 252, 117, 159, 193, 38, 1 },
-        { 211, 211, 187, 221, 153, 6, 1 }, },
-      { { 179, 66, 216, 120, 217, 241, 1 },
-        { 182, 124, 117, 14, 0, 251, 1 },
-        { 199, 205, 143, 13, 161, 102, 1 },
-        { 239, 128, 56, 87, 31, 54, 1 }, },
-      { { 178, 97, 81, 226, 141, 99, 0 },
-        { 132, 100, 127, 141, 196, 160, 1 },
-        { 99, 88, 163, 197, 67, 38, 1 },
-        { 130, 145, 216, 255, 19, 16, 1 }, },
-      { { 179, 99, 173, 194, 60, 10, 1 },
-        { 170, 0, 206, 143, 228, 189, 0 },
-        { 168, 30, 33, 218, 227, 102, 1 },
-        { 94, 147, 248, 185, 128, 42, 1 }, },
-      { { 179, 122, 143, 78, 111, 189, 1 },
-        { 170, 157, 86, 63, 227, 254, 1 },
-        { 222, 251, 57, 120, 175, 102, 1 },
-        { 191, 227, 254, 53, 92, 170, 1 }, },
-      { { 176, 177, 13, 218, 203, 9, 1 },
-        { 50, 21, 118, 169, 172, 166, 0 },
-        { 200, 105, 173, 216, 70, 134, 1 },
-        { 50, 154, 202, 183, 84, 38, 0 }, },
-      { { 176, 187, 235, 133, 79, 183, 0 },
-        { 32, 157, 159, 251, 79, 232, 1 },
-        { 118, 249, 80, 235, 238, 134, 1 },
-        { 139, 249, 111, 252, 220, 130, 0 }, },
-      { { 177, 195, 46, 176, 79, 2, 0 },
-        { 48, 48, 156, 172, 78, 188, 0 },
-        { 32, 121, 6, 186, 97, 198, 1 },
-        { 30, 185, 26, 156, 134, 6, 0 }, },
-      { { 177, 202, 162, 122, 198, 206, 0 },
-        { 20, 184, 236, 62, 234, 58, 0 },
-        { 57, 177, 175, 34, 169, 198, 1 },
-        { 46, 43, 190, 27, 142, 148, 0 }, },
-      { { 180, 119, 47, 73, 43, 245, 0 },
-        { 109, 13, 214, 125, 6, 238, 1 },
-        { 87, 234, 73, 122, 119, 22, 1 },
-        { 187, 176, 95, 53, 216, 91, 0 }, },
-      { { 181, 174, 77, 39, 89, 131, 1 },
-        { 99, 188, 31, 73, 137, 189, 0 },
-        { 224, 205, 114, 89, 58, 214, 1 },
-        { 94, 200, 201, 124, 30, 227, 0 }, },
-      { { 183, 210, 205, 142, 206, 219, 0 },
-        { 165, 29, 45, 175, 233, 254, 0 },
-        { 109, 185, 184, 217, 165, 246, 1 },
-        { 63, 203, 250, 218, 92, 82, 1 }, },
-      { { 182, 235, 156, 93, 104, 151, 0 },
-        { 185, 220, 78, 94, 13, 238, 0 },
-        { 116, 139, 93, 28, 235, 182, 1 },
-        { 59, 216, 61, 57, 29, 206, 1 }, },
-      { { 180, 244, 103, 243, 78, 87, 0 },
-        { 85, 53, 207, 253, 202, 228, 0 },
-        { 117, 57, 103, 243, 23, 150, 1 },
-        { 19, 169, 223, 249, 214, 85, 0 }, },
-      { { 184, 15, 212, 222, 49, 7, 1 },
-        { 90, 198, 93, 154, 133, 47, 0 },
-        { 240, 70, 61, 149, 248, 14, 1 },
-        { 122, 80, 172, 221, 49, 173, 0 }, },
-      { { 184, 57, 126, 65, 128, 2, 0 },
-        { 32, 195, 239, 72, 6, 36, 0 },
-        { 32, 0, 193, 63, 78, 14, 1 },
-        { 18, 48, 9, 123, 225, 130, 0 }, },
-      { { 184, 56, 131, 182, 233, 190, 0 },
-        { 24, 187, 62, 155, 163, 224, 1 },
-        { 62, 203, 182, 224, 142, 14, 1 },
-        { 131, 226, 236, 190, 110, 140, 0 }, },
-      { { 184, 108, 6, 172, 40, 232, 0 },
-        { 76, 170, 6, 140, 35, 166, 1 },
-        { 11, 138, 26, 176, 27, 14, 1 },
-        { 178, 226, 24, 176, 42, 153, 0 }, },
-      { { 185, 136, 183, 154, 126, 192, 1 },
-        { 30, 218, 132, 171, 202, 183, 0 },
-        { 129, 191, 44, 246, 136, 206, 1 },
-        { 118, 169, 234, 144, 173, 188, 0 }, },
-      { { 184, 156, 165, 183, 60, 206, 0 },
-        { 92, 171, 140, 219, 233, 165, 0 },
-        { 57, 158, 118, 210, 156, 142, 1 },
-        { 82, 203, 237, 152, 234, 157, 0 }, },
-      { { 186, 207, 131, 167, 229, 28, 1 },
-        { 202, 178, 52, 223, 239, 104, 0 },
-        { 156, 83, 242, 224, 249, 174, 1 },
-        { 11, 123, 253, 150, 38, 169, 1 }, },
-      { { 184, 231, 17, 147, 88, 172, 1 },
-        { 82, 90, 6, 221, 172, 169, 1 },
-        { 154, 141, 100, 196, 115, 142, 1 },
-        { 202, 154, 221, 176, 45, 37, 0 }, },
-      { { 189, 114, 116, 100, 13, 206, 1 },
-        { 7, 107, 223, 28, 97, 188, 0 },
-        { 185, 216, 19, 23, 39, 94, 1 },
-        { 30, 195, 28, 125, 235, 112, 0 }, },
-      { { 188, 125, 134, 57, 75, 186, 1 },
-        { 83, 187, 30, 110, 38, 230, 1 },
-        { 174, 233, 78, 48, 223, 30, 1 },
-        { 179, 178, 59, 60, 110, 229, 0 }, },
-      { { 195, 30, 73, 175, 1, 169, 1 },
-        { 226, 173, 17, 193, 177, 58, 1 },
-        { 202, 192, 122, 201, 60, 97, 1 },
-        { 174, 70, 193, 196, 90, 163, 1 }, },
-      { { 192, 46, 91, 239, 41, 95, 0 },
-        { 108, 228, 91, 209, 179, 234, 0 },
-        { 125, 74, 123, 237, 58, 1, 1 },
-        { 43, 230, 197, 237, 19, 155, 0 }, },
-      { { 193, 78, 242, 15, 34, 121, 1 },
-        { 78, 196, 129, 102, 179, 122, 1 },
-        { 207, 34, 120, 39, 185, 65, 1 },
-        { 175, 102, 179, 64, 145, 185, 0 }, },
-      { { 193, 129, 72, 108, 154, 70, 1 },
-        { 38, 32, 105, 48, 29, 179, 0 },
-        { 177, 44, 155, 9, 64, 193, 1 },
-        { 102, 220, 6, 75, 2, 50, 0 }, },
-      { { 193, 153, 177, 237, 205, 191, 1 },
-        { 2, 253, 248, 211, 125, 242, 1 },
-        { 254, 217, 219, 198, 204, 193, 1 },
-        { 167, 223, 101, 143, 223, 160, 0 }, },
-      { { 193, 146, 177, 38, 19, 223, 1 },
-        { 6, 109, 152, 51, 185, 121, 0 },
-        { 253, 228, 50, 70, 164, 193, 1 },
-        { 79, 78, 230, 12, 219, 48, 0 }, },
-      { { 195, 183, 213, 56, 210, 51, 1 },
-        { 210, 117, 43, 35, 28, 127, 1 },
-        { 230, 37, 142, 85, 246, 225, 1 },
-        { 255, 28, 98, 106, 87, 37, 1 }, },
-      { { 193, 215, 25, 188, 235, 129, 1 },
-        { 122, 125, 48, 165, 29, 186, 0 },
-        { 192, 235, 158, 204, 117, 193, 1 },
-        { 46, 220, 82, 134, 95, 47, 0 }, },
-      { { 193, 246, 67, 78, 186, 232, 1 },
-        { 78, 9, 99, 37, 187, 187, 1 },
-        { 139, 174, 185, 97, 55, 193, 1 },
-        { 238, 238, 210, 99, 72, 57, 0 }, },
-      { { 196, 56, 145, 7, 35, 108, 1 },
-        { 15, 193, 18, 115, 177, 32, 1 },
-        { 155, 98, 112, 68, 142, 17, 1 },
-        { 130, 70, 231, 36, 65, 248, 0 }, },
-      { { 198, 77, 74, 227, 205, 183, 0 },
-        { 225, 188, 121, 212, 214, 224, 1 },
-        { 118, 217, 227, 169, 89, 49, 1 },
-        { 131, 181, 149, 207, 30, 195, 1 }, },
-      { { 199, 83, 172, 246, 95, 75, 1 },
-        { 183, 53, 216, 166, 245, 189, 0 },
-        { 233, 125, 55, 154, 229, 113, 1 },
-        { 94, 215, 178, 141, 214, 118, 1 }, },
-      { { 197, 126, 74, 113, 2, 75, 0 },
-        { 117, 165, 75, 100, 50, 56, 0 },
-        { 105, 32, 71, 41, 63, 81, 1 },
-        { 14, 38, 19, 105, 82, 215, 0 }, },
-      { { 198, 116, 217, 128, 138, 199, 1 },
-        { 231, 77, 43, 183, 16, 160, 0 },
-        { 241, 168, 128, 205, 151, 49, 1 },
-        { 2, 132, 118, 234, 89, 115, 1 }, },
-      { { 197, 136, 152, 47, 230, 202, 1 },
-        { 47, 248, 40, 98, 249, 50, 0 },
-        { 169, 179, 250, 12, 136, 209, 1 },
-        { 38, 79, 163, 10, 15, 250, 0 }, },
-      { { 197, 174, 39, 8, 53, 94, 1 },
-        { 79, 128, 154, 17, 122, 127, 0 },
-        { 189, 86, 8, 114, 58, 209, 1 },
-        { 127, 47, 68, 44, 128, 249, 0 }, },
-      { { 199, 188, 103, 248, 187, 33, 1 },
-        { 219, 165, 243, 161, 26, 183, 1 },
-        { 194, 110, 143, 243, 30, 241, 1 },
-        { 246, 172, 66, 231, 210, 237, 1 }, },
-      { { 196, 190, 140, 164, 243, 99, 0 },
-        { 109, 181, 58, 162, 25, 45, 1 },
-        { 99, 103, 146, 152, 190, 145, 1 },
-        { 218, 76, 34, 174, 86, 219, 0 }, },
-      { { 203, 15, 36, 114, 82, 53, 0 },
-        { 208, 182, 192, 48, 148, 125, 1 },
-        { 86, 37, 39, 18, 120, 105, 1 },
-        { 223, 20, 134, 1, 182, 133, 1 }, },
-      { { 201, 72, 89, 111, 111, 39, 1 },
-        { 42, 246, 89, 117, 209, 178, 1 },
-        { 242, 123, 123, 77, 9, 73, 1 },
-        { 166, 197, 215, 77, 55, 170, 0 }, },
-      { { 200, 85, 15, 64, 161, 129, 0 },
-        { 104, 15, 112, 5, 22, 36, 0 },
-        { 64, 194, 129, 120, 85, 9, 1 },
-        { 18, 52, 80, 7, 120, 11, 0 }, },
-      { { 203, 90, 139, 223, 86, 169, 0 },
-        { 176, 159, 64, 231, 243, 59, 1 },
-        { 74, 181, 125, 232, 173, 105, 1 },
-        { 238, 103, 243, 129, 124, 134, 1 }, },
-      { { 200, 115, 24, 175, 214, 16, 0 },
-        { 32, 115, 34, 228, 213, 107, 0 },
-        { 4, 53, 250, 140, 103, 9, 1 },
-        { 107, 85, 147, 162, 103, 2, 0 }, },
-      { { 201, 159, 158, 95, 56, 56, 0 },
-        { 120, 195, 64, 66, 191, 255, 1 },
-        { 14, 14, 125, 60, 252, 201, 1 },
-        { 255, 254, 161, 1, 97, 143, 0 }, },
-      { { 202, 191, 51, 44, 49, 240, 0 },
-        { 204, 235, 146, 1, 31, 107, 1 },
-        { 7, 198, 26, 102, 126, 169, 1 },
-        { 235, 124, 64, 36, 235, 153, 1 }, },
-      { { 201, 233, 181, 7, 221, 84, 0 },
-        { 4, 210, 178, 87, 221, 245, 0 },
-        { 21, 93, 240, 86, 203, 201, 1 },
-        { 87, 221, 245, 38, 165, 144, 0 }, },
-      { { 203, 240, 30, 59, 146, 129, 0 },
-        { 176, 111, 34, 100, 154, 55, 0 },
-        { 64, 164, 238, 60, 7, 233, 1 },
-        { 118, 44, 147, 34, 123, 6, 1 }, },
-      { { 204, 2, 72, 129, 217, 10, 0 },
-        { 33, 18, 57, 192, 48, 169, 0 },
-        { 40, 77, 192, 137, 32, 25, 1 },
-        { 74, 134, 1, 206, 36, 66, 0 }, },
-      { { 206, 44, 78, 124, 45, 3, 1 },
-        { 251, 166, 91, 0, 83, 166, 0 },
-        { 224, 90, 31, 57, 26, 57, 1 },
-        { 50, 229, 0, 109, 50, 239, 1 }, },
-      { { 205, 131, 179, 65, 153, 204, 1 },
-        { 7, 74, 240, 83, 62, 185, 0 },
-        { 153, 204, 193, 102, 224, 217, 1 },
-        { 78, 190, 101, 7, 169, 112, 0 }, },
-      { { 206, 128, 171, 157, 219, 17, 1 },
-        { 179, 22, 176, 227, 27, 227, 0 },
-        { 196, 109, 220, 234, 128, 185, 1 },
-        { 99, 236, 99, 134, 180, 102, 1 }, },
-      { { 204, 183, 70, 234, 75, 14, 1 },
-        { 67, 51, 91, 176, 190, 174, 0 },
-        { 184, 105, 43, 177, 118, 153, 1 },
-        { 58, 190, 134, 237, 102, 97, 0 }, },
-      { { 207, 228, 35, 113, 192, 123, 1 },
-        { 215, 54, 234, 69, 58, 112, 1 },
-        { 239, 1, 199, 98, 19, 249, 1 },
-        { 135, 46, 81, 43, 182, 117, 1 }, },
-      { { 205, 246, 59, 148, 188, 171, 1 },
-        { 123, 79, 170, 133, 123, 185, 1 },
-        { 234, 158, 148, 238, 55, 217, 1 },
-        { 206, 239, 80, 170, 249, 111, 0 }, },
-      { { 211, 23, 149, 186, 69, 222, 1 },
-        { 214, 121, 28, 147, 244, 126, 0 },
-        { 189, 209, 46, 212, 244, 101, 1 },
-        { 63, 23, 228, 156, 79, 53, 1 }, },
-      { { 208, 58, 34, 105, 80, 179, 0 },
-        { 0, 189, 206, 64, 18, 107, 1 },
-        { 102, 133, 75, 34, 46, 5, 1 },
-        { 235, 36, 1, 57, 222, 128, 0 }, },
-      { { 211, 54, 150, 219, 2, 36, 1 },
-        { 210, 65, 70, 242, 146, 62, 1 },
-        { 146, 32, 109, 180, 182, 101, 1 },
-        { 190, 36, 167, 177, 65, 37, 1 }, },
-      { { 210, 86, 224, 221, 145, 27, 0 },
-        { 208, 5, 253, 198, 49, 107, 0 },
-        { 108, 68, 221, 131, 181, 37, 1 },
-        { 107, 70, 49, 223, 208, 5, 1 }, },
-      { { 210, 188, 170, 228, 3, 129, 0 },
-        { 224, 173, 214, 162, 27, 32, 0 },
-        { 64, 224, 19, 170, 158, 165, 1 },
-        { 2, 108, 34, 181, 218, 131, 1 }, },
-      { { 211, 196, 238, 80, 249, 166, 0 },
-        { 248, 24, 253, 22, 26, 181, 1 },
-        { 50, 207, 133, 59, 145, 229, 1 },
-        { 214, 172, 52, 95, 140, 15, 1 }, },
-      { { 211, 228, 7, 252, 5, 226, 1 },
-        { 214, 40, 94, 133, 91, 54, 1 },
-        { 163, 208, 31, 240, 19, 229, 1 },
-        { 182, 109, 80, 189, 10, 53, 1 }, },
-      { { 211, 252, 28, 167, 191, 2, 0 },
-        { 232, 225, 62, 228, 217, 181, 0 },
-        { 32, 126, 242, 156, 31, 229, 1 },
-        { 86, 205, 147, 190, 67, 139, 1 }, },
-      { { 215, 68, 167, 168, 172, 223, 0 },
-        { 205, 44, 172, 151, 114, 246, 0 },
-        { 125, 154, 138, 242, 145, 117, 1 },
-        { 55, 167, 116, 154, 154, 89, 1 }, },
-      { { 214, 159, 244, 68, 89, 83, 0 },
-        { 197, 213, 221, 2, 29, 237, 0 },
-        { 101, 77, 17, 23, 252, 181, 1 },
-        { 91, 220, 32, 93, 213, 209, 1 }, },
-      { { 212, 175, 147, 230, 193, 68, 0 },
-        { 69, 240, 118, 147, 159, 40, 0 },
-        { 17, 65, 179, 228, 250, 149, 1 },
-        { 10, 124, 228, 183, 7, 209, 0 }, },
-      { { 217, 18, 102, 139, 15, 210, 1 },
-        { 6, 11, 157, 224, 210, 254, 0 },
-        { 165, 248, 104, 179, 36, 77, 1 },
-        { 63, 165, 131, 220, 232, 48, 0 }, },
-      { { 216, 81, 88, 45, 224, 190, 1 },
-        { 42, 123, 45, 84, 53, 98, 1 },
-        { 190, 131, 218, 13, 69, 13, 1 },
-        { 163, 86, 21, 90, 111, 42, 0 }, },
-      { { 216, 99, 102, 115, 129, 229, 0 },
-        { 20, 46, 247, 84, 150, 44, 1 },
-        { 83, 192, 231, 51, 99, 13, 1 },
-        { 154, 52, 149, 119, 186, 20, 0 }, },
-      { { 219, 108, 88, 112, 132, 206, 1 },
-        { 246, 234, 111, 20, 112, 48, 0 },
-        { 185, 144, 135, 13, 27, 109, 1 },
-        { 6, 7, 20, 123, 43, 183, 1 }, },
-      { { 217, 99, 155, 60, 255, 211, 0 },
-        { 60, 126, 62, 39, 87, 251, 0 },
-        { 101, 255, 158, 108, 227, 77, 1 },
-        { 111, 245, 114, 62, 63, 30, 0 }, },
-      { { 216, 138, 98, 229, 71, 244, 0 },
-        { 4, 186, 213, 240, 91, 104, 1 },
-        { 23, 241, 83, 163, 40, 141, 1 },
-        { 139, 109, 7, 213, 174, 144, 0 }, },
-      { { 217, 153, 210, 99, 213, 126, 1 },
-        { 6, 243, 125, 82, 254, 113, 1 },
-        { 191, 85, 227, 37, 204, 205, 1 },
-        { 199, 63, 165, 95, 103, 176, 0 }, },
-      { { 217, 162, 40, 145, 224, 209, 0 },
-        { 60, 30, 166, 192, 24, 120, 0 },
-        { 69, 131, 196, 138, 34, 205, 1 },
-        { 15, 12, 1, 178, 188, 30, 0 }, },
-      { { 219, 244, 50, 154, 65, 205, 0 },
-        { 212, 95, 150, 148, 186, 50, 0 },
-        { 89, 193, 44, 166, 23, 237, 1 },
-        { 38, 46, 148, 180, 253, 21, 1 }, },
-      { { 220, 29, 107, 96, 189, 237, 0 },
-        { 109, 175, 245, 17, 118, 161, 1 },
-        { 91, 222, 131, 107, 92, 29, 1 },
-        { 194, 183, 68, 87, 250, 219, 0 }, },
-      { { 222, 26, 217, 103, 197, 109, 0 },
-        { 165, 247, 117, 83, 241, 40, 1 },
-        { 91, 81, 243, 77, 172, 61, 1 },
-        { 138, 71, 229, 87, 119, 210, 1 }, },
-      { { 221, 114, 161, 214, 214, 204, 1 },
-        { 23, 27, 230, 183, 241, 57, 0 },
-        { 153, 181, 181, 194, 167, 93, 1 },
-        { 78, 71, 246, 179, 236, 116, 0 }, },
-      { { 221, 116, 213, 91, 237, 200, 1 },
-        { 95, 91, 119, 71, 240, 182, 0 },
-        { 137, 219, 237, 85, 151, 93, 1 },
-        { 54, 135, 241, 119, 109, 125, 0 }, },
-      { { 221, 134, 26, 161, 4, 19, 1 },
-        { 99, 102, 12, 192, 90, 120, 0 },
-        { 228, 16, 66, 172, 48, 221, 1 },
-        { 15, 45, 1, 152, 51, 99, 0 }, },
-      { { 223, 175, 27, 5, 181, 189, 1 },
-        { 235, 206, 54, 81, 127, 121, 1 },
-        { 222, 214, 208, 108, 122, 253, 1 },
-        { 207, 127, 69, 54, 57, 235, 1 }, },
-      { { 222, 176, 237, 214, 204, 22, 1 },
-        { 179, 19, 239, 147, 217, 228, 0 },
-        { 180, 25, 181, 219, 134, 189, 1 },
-        { 19, 205, 228, 251, 228, 102, 1 }, },
-      { { 223, 230, 10, 66, 93, 241, 0 },
-        { 229, 30, 86, 4, 218, 249, 1 },
-        { 71, 221, 33, 40, 51, 253, 1 },
-        { 207, 173, 144, 53, 60, 83, 1 }, },
-      { { 221, 251, 88, 81, 243, 143, 0 },
-        { 57, 223, 127, 116, 60, 57, 0 },
-        { 120, 231, 197, 13, 111, 221, 1 },
-        { 78, 30, 23, 127, 125, 206, 0 }, },
-      { { 227, 22, 68, 69, 140, 160, 0 },
-        { 192, 9, 97, 72, 81, 188, 1 },
-        { 2, 152, 209, 17, 52, 99, 1 },
-        { 158, 197, 9, 67, 72, 1, 1 }, },
-      { { 226, 26, 171, 99, 248, 21, 1 },
-        { 170, 181, 224, 91, 146, 233, 0 },
-        { 212, 15, 227, 106, 172, 35, 1 },
-        { 75, 164, 237, 3, 214, 170, 1 }, },
-      { { 226, 90, 168, 144, 16, 221, 1 },
-        { 182, 141, 128, 158, 48, 105, 0 },
-        { 221, 132, 4, 138, 173, 35, 1 },
-        { 75, 6, 60, 128, 216, 182, 1 }, },
-      { { 224, 126, 198, 224, 106, 118, 1 },
-        { 78, 177, 75, 190, 18, 236, 1 },
-        { 183, 43, 3, 177, 191, 3, 1 },
-        { 155, 164, 62, 233, 70, 185, 0 }, },
-      { { 225, 117, 204, 107, 230, 146, 0 },
-        { 104, 57, 107, 110, 212, 118, 0 },
-        { 36, 179, 235, 25, 215, 67, 1 },
-        { 55, 21, 187, 107, 78, 11, 0 }, },
-      { { 224, 221, 231, 62, 185, 106, 0 },
-        { 92, 161, 185, 15, 191, 167, 1 },
-        { 43, 78, 190, 115, 221, 131, 1 },
-        { 242, 254, 248, 78, 194, 157, 0 }, },
-      { { 231, 26, 89, 61, 43, 68, 0 },
-        { 189, 225, 17, 121, 17, 186, 0 },
-        { 17, 106, 94, 77, 44, 115, 1 },
-        { 46, 196, 79, 68, 67, 222, 1 }, },
-      { { 230, 61, 186, 78, 33, 23, 0 },
-        { 233, 197, 218, 26, 151, 98, 0 },
-        { 116, 66, 57, 46, 222, 51, 1 },
-        { 35, 116, 172, 45, 209, 203, 1 }, },
-      { { 231, 80, 110, 107, 241, 111, 0 },
-        { 173, 53, 249, 92, 178, 55, 1 },
-        { 123, 71, 235, 59, 5, 115, 1 },
-        { 246, 38, 157, 79, 214, 90, 1 }, },
-      { { 229, 83, 212, 72, 59, 179, 0 },
-        { 9, 77, 89, 46, 20, 255, 1 },
-        { 102, 238, 9, 21, 229, 83, 1 },
-        { 255, 148, 58, 77, 89, 72, 0 }, },
-      { { 228, 120, 9, 177, 15, 166, 1 },
-        { 51, 169, 26, 253, 80, 160, 1 },
-        { 178, 248, 70, 200, 15, 19, 1 },
-        { 130, 133, 95, 172, 74, 230, 0 }, },
-      { { 229, 122, 161, 185, 186, 74, 1 },
-        { 31, 161, 170, 239, 48, 187, 0 },
-        { 169, 46, 206, 194, 175, 83, 1 },
-        { 110, 134, 123, 170, 194, 252, 0 }, },
-      { { 231, 124, 180, 146, 88, 174, 1 },
-        { 211, 217, 138, 158, 176, 181, 1 },
-        { 186, 141, 36, 150, 159, 115, 1 },
-        { 214, 134, 188, 168, 205, 229, 1 }, },
-      { { 230, 164, 245, 240, 132, 66, 1 },
-        { 215, 96, 235, 139, 88, 36, 0 },
-        { 161, 16, 135, 215, 146, 179, 1 },
-        { 18, 13, 104, 235, 131, 117, 1 }, },
-      { { 229, 213, 42, 118, 142, 25, 1 },
-        { 115, 37, 224, 44, 255, 240, 0 },
-        { 204, 56, 183, 42, 85, 211, 1 },
-        { 7, 255, 154, 3, 210, 103, 0 }, },
-      { { 231, 215, 202, 210, 228, 123, 1 },
-        { 255, 21, 105, 142, 254, 120, 1 },
-        { 239, 19, 165, 169, 245, 243, 1 },
-        { 143, 63, 184, 203, 84, 127, 1 }, },
-      { { 228, 239, 89, 211, 239, 61, 1 },
-        { 123, 212, 115, 253, 252, 232, 1 },
-        { 222, 123, 229, 205, 123, 147, 1 },
-        { 139, 159, 223, 231, 21, 239, 0 }, },
-      { { 235, 27, 228, 239, 142, 205, 0 },
-        { 132, 175, 225, 250, 245, 190, 0 },
-        { 89, 184, 251, 147, 236, 107, 1 },
-        { 62, 215, 175, 195, 250, 144, 1 }, },
-      { { 233, 50, 9, 4, 85, 129, 1 },
-        { 34, 31, 18, 9, 81, 57, 0 },
-        { 192, 213, 16, 72, 38, 75, 1 },
-        { 78, 69, 72, 36, 124, 34, 0 }, },
-      { { 235, 52, 254, 217, 172, 58, 1 },
-        { 250, 67, 235, 202, 114, 246, 1 },
-        { 174, 26, 205, 191, 150, 107, 1 },
-        { 183, 167, 41, 235, 225, 47, 1 }, },
-      { { 234, 78, 19, 245, 78, 30, 0 },
-        { 208, 242, 72, 253, 115, 232, 0 },
-        { 60, 57, 87, 228, 57, 43, 1 },
-        { 11, 231, 95, 137, 39, 133, 1 }, },
-      { { 233, 176, 103, 32, 6, 254, 0 },
-        { 4, 43, 139, 57, 122, 116, 1 },
-        { 63, 176, 2, 115, 6, 203, 1 },
-        { 151, 47, 78, 104, 234, 16, 0 }, },
-      { { 234, 213, 177, 80, 109, 191, 0 },
-        { 216, 95, 216, 31, 124, 224, 1 },
-        { 126, 219, 5, 70, 213, 171, 1 },
-        { 131, 159, 124, 13, 253, 13, 1 }, },
-      { { 239, 10, 161, 134, 54, 174, 0 },
-        { 137, 138, 136, 187, 241, 57, 1 },
-        { 58, 182, 48, 194, 168, 123, 1 },
-        { 206, 71, 238, 136, 168, 200, 1 }, },
-      { { 237, 54, 239, 15, 39, 238, 1 },
-        { 111, 11, 155, 123, 243, 62, 1 },
-        { 187, 242, 120, 123, 182, 91, 1 },
-        { 190, 103, 239, 108, 232, 123, 0 }, },
-      { { 237, 74, 130, 29, 33, 213, 0 },
-        { 29, 142, 16, 94, 19, 122, 0 },
-        { 85, 194, 92, 32, 169, 91, 1 },
-        { 47, 100, 61, 4, 56, 220, 0 }, },
-      { { 236, 96, 189, 109, 140, 6, 0 },
-        { 33, 98, 234, 95, 81, 166, 0 },
-        { 48, 24, 219, 94, 131, 27, 1 },
-        { 50, 197, 125, 43, 163, 66, 0 }, },
-      { { 239, 130, 202, 100, 252, 71, 0 },
-        { 173, 54, 105, 26, 91, 185, 0 },
-        { 113, 31, 147, 41, 160, 251, 1 },
-        { 78, 237, 44, 75, 54, 90, 1 }, },
-      { { 238, 161, 127, 189, 151, 92, 0 },
-        { 181, 98, 179, 249, 127, 103, 0 },
-        { 29, 116, 222, 255, 66, 187, 1 },
-        { 115, 127, 79, 230, 163, 86, 1 }, },
-      { { 238, 209, 152, 137, 82, 229, 1 },
-        { 167, 95, 0, 254, 28, 35, 1 },
-        { 211, 165, 72, 140, 197, 187, 1 },
-        { 226, 28, 63, 128, 125, 114, 1 }, },
-      { { 241, 9, 85, 233, 4, 138, 1 },
-        { 2, 232, 77, 201, 116, 54, 0 },
-        { 168, 144, 75, 213, 72, 71, 1 },
-        { 54, 23, 73, 217, 11, 160, 0 }, },
-      { { 243, 42, 138, 178, 12, 104, 1 },
-        { 182, 160, 6, 138, 242, 184, 1 },
-        { 139, 24, 38, 168, 170, 103, 1 },
-        { 142, 167, 168, 176, 2, 182, 1 }, },
-      { { 243, 71, 148, 129, 100, 1, 1 },
-        { 202, 84, 4, 206, 84, 60, 0 },
-        { 192, 19, 64, 148, 241, 103, 1 },
-        { 30, 21, 57, 144, 21, 41, 1 }, },
-      { { 243, 136, 79, 37, 132, 41, 1 },
-        { 162, 164, 37, 73, 123, 52, 1 },
-        { 202, 16, 210, 121, 8, 231, 1 },
-        { 150, 111, 73, 82, 18, 162, 1 }, },
-      { { 240, 162, 31, 6, 126, 77, 1 },
-        { 46, 84, 6, 57, 251, 173, 0 },
-        { 217, 63, 48, 124, 34, 135, 1 },
-        { 90, 239, 206, 48, 21, 58, 0 }, },
-      { { 243, 170, 11, 255, 165, 205, 0 },
-        { 188, 172, 118, 217, 251, 58, 0 },
-        { 89, 210, 255, 232, 42, 231, 1 },
-        { 46, 111, 205, 183, 26, 158, 1 }, },
-      { { 240, 175, 124, 121, 142, 228, 0 },
-        { 116, 232, 231, 120, 92, 174, 1 },
-        { 19, 184, 207, 31, 122, 135, 1 },
-        { 186, 157, 15, 115, 139, 151, 0 }, },
-      { { 240, 217, 16, 212, 202, 31, 1 },
-        { 18, 213, 108, 188, 61, 224, 0 },
-        { 252, 41, 149, 132, 77, 135, 1 },
-        { 3, 222, 30, 155, 85, 164, 0 }, },
-      { { 245, 75, 179, 178, 85, 245, 1 },
-        { 23, 252, 148, 159, 214, 121, 1 },
-        { 215, 213, 38, 230, 233, 87, 1 },
-        { 207, 53, 252, 148, 159, 244, 0 }, },
-      { { 246, 81, 96, 41, 26, 234, 1 },
-        { 135, 41, 141, 108, 52, 163, 1 },
-        { 171, 172, 74, 3, 69, 55, 1 },
-        { 226, 150, 27, 88, 202, 112, 1 }, },
-      { { 246, 117, 82, 145, 217, 185, 1 },
-        { 211, 93, 55, 204, 54, 225, 1 },
-        { 206, 205, 196, 165, 87, 55, 1 },
-        { 195, 182, 25, 246, 93, 101, 1 }, },
-      { { 245, 114, 198, 173, 192, 65, 0 },
-        { 5, 53, 39, 206, 19, 62, 0 },
-        { 65, 1, 218, 177, 167, 87, 1 },
-        { 62, 100, 57, 242, 86, 80, 0 }, },
-      { { 247, 124, 210, 85, 227, 70, 0 },
-        { 221, 209, 127, 126, 19, 48, 0 },
-        { 49, 99, 213, 37, 159, 119, 1 },
-        { 6, 100, 63, 127, 69, 221, 1 }, },
-      { { 246, 132, 78, 31, 171, 28, 0 },
-        { 249, 0, 53, 120, 187, 230, 0 },
-        { 28, 106, 252, 57, 16, 183, 1 },
-        { 51, 238, 143, 86, 0, 79, 1 }, },
-      { { 248, 61, 136, 57, 165, 1, 1 },
-        { 122, 167, 54, 74, 84, 34, 0 },
-        { 192, 82, 206, 8, 222, 15, 1 },
-        { 34, 21, 41, 54, 114, 175, 0 }, },
-      { { 251, 54, 195, 223, 220, 215, 1 },
-        { 214, 31, 111, 219, 211, 251, 0 },
-        { 245, 157, 253, 225, 182, 111, 1 },
-        { 111, 229, 237, 251, 124, 53, 1 }, },
-      { { 248, 76, 172, 3, 76, 20, 1 },
-        { 98, 146, 132, 94, 208, 228, 0 },
-        { 148, 25, 96, 26, 153, 15, 1 },
-        { 19, 133, 189, 16, 164, 163, 0 }, },
-      { { 251, 160, 208, 185, 211, 75, 1 },
-        { 150, 118, 63, 234, 56, 51, 0 },
-        { 233, 101, 206, 133, 130, 239, 1 },
-        { 102, 14, 43, 254, 55, 52, 1 }, },
-      { { 250, 195, 132, 204, 125, 54, 1 },
-        { 138, 18, 92, 158, 93, 239, 1 },
-        { 182, 95, 25, 144, 225, 175, 1 },
-        { 251, 221, 60, 157, 36, 40, 1 }, },
-      { { 249, 231, 61, 60, 30, 97, 1 },
-        { 118, 102, 134, 45, 93, 191, 1 },
-        { 195, 60, 30, 94, 115, 207, 1 },
-        { 254, 221, 90, 48, 179, 55, 0 }, },
-      { { 248, 255, 88, 101, 6, 119, 1 },
-        { 102, 231, 79, 124, 93, 104, 1 },
-        { 247, 48, 83, 13, 127, 143, 1 },
-        { 139, 93, 31, 121, 115, 179, 0 }, },
-      { { 253, 11, 219, 85, 100, 56, 1 },
-        { 59, 210, 69, 75, 119, 120, 1 },
-        { 142, 19, 85, 109, 232, 95, 1 },
-        { 143, 119, 105, 81, 37, 238, 0 }, },
-      { { 253, 22, 174, 228, 229, 62, 1 },
-        { 107, 51, 252, 154, 115, 124, 1 },
-        { 190, 83, 147, 186, 180, 95, 1 },
-        { 159, 103, 44, 159, 230, 107, 0 }, },
-      { { 254, 73, 163, 120, 194, 52, 0 },
-        { 145, 178, 228, 63, 22, 98, 1 },
-        { 22, 33, 143, 98, 201, 63, 1 },
-        { 163, 52, 126, 19, 166, 196, 1 }, },
-      { { 253, 132, 226, 198, 107, 168, 1 },
-        { 75, 26, 213, 170, 187, 176, 1 },
-        { 138, 235, 49, 163, 144, 223, 1 },
-        { 134, 238, 170, 213, 172, 105, 0 }, },
-      { { 252, 149, 79, 148, 230, 207, 0 },
-        { 125, 31, 45, 185, 127, 36, 0 },
-        { 121, 179, 148, 249, 84, 159, 1 },
-        { 18, 127, 78, 218, 124, 95, 0 }, },
-      { { 254, 165, 35, 88, 48, 164, 1 },
-        { 219, 10, 198, 25, 30, 35, 1 },
-        { 146, 134, 13, 98, 82, 191, 1 },
-        { 226, 60, 76, 49, 168, 109, 1 }, },
-      { { 254, 168, 217, 255, 176, 118, 0 },
-        { 189, 226, 111, 219, 153, 99, 1 },
-        { 55, 6, 255, 205, 138, 191, 1 },
-        { 227, 76, 237, 251, 35, 222, 1 }, },
-      { { 255, 195, 135, 255, 162, 252, 1 },
-        { 159, 42, 100, 255, 191, 126, 1 },
-        { 159, 162, 255, 240, 225, 255, 1 },
-        { 191, 126, 255, 147, 42, 124, 1 }, },
-      { { 95, 114, 124, 241, 17, 248, 0 },
-        { 181, 107, 215, 196, 48, 93, 1 },
-        { 15, 196, 71, 159, 39, 125, 0 },
-        { 221, 6, 17, 245, 235, 86, 1 }, },
-      { { 135, 81, 63, 164, 61, 190, 1 },
-        { 171, 105, 152, 149, 103, 245, 1 },
-        { 190, 222, 18, 254, 69, 112, 1 },
-        { 215, 243, 84, 140, 203, 106, 1 }, },
-      { { 198, 147, 77, 53, 31, 189, 0 },
-        { 177, 45, 17, 113, 125, 237, 1 },
-        { 94, 252, 86, 89, 100, 177, 1 },
-        { 219, 223, 71, 68, 90, 70, 1 }, },
-      { { 231, 230, 150, 226, 6, 159, 1 },
-        { 195, 108, 74, 190, 250, 124, 0 },
-        { 252, 176, 35, 180, 179, 243, 1 },
-        { 31, 47, 190, 169, 27, 97, 1 }, }, };
-}
+}//namespace
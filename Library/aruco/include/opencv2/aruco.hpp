@@ -85,6 +85,12 @@ enum CornerRefineMethod{
     CORNER_REFINE_APRILTAG, ///< Tag and corners detection based on the AprilTag 2 approach @cite wang2016iros
 };
 
+enum BitThresholdMethod{
+    BIT_THRESHOLD_OTSU,       ///< Otsu thresholding of the candidate image without perspective
+    BIT_THRESHOLD_LOCAL_MEAN, ///< Mean of the cells minus adaptiveThreshConstant, as the adaptive thresholding
+    BIT_THRESHOLD_CLUSTERS,   ///< Middle of the two clusters of the cell means
+};
+
 /**
  * @brief Parameters for the detectMarker process:
  * - adaptiveThreshWinSizeMin: minimum window size for adaptive thresholding before finding
@@ -129,6 +135,15 @@ enum CornerRefineMethod{
  *   than 128 or not) (default 5.0)
  * - errorCorrectionRate error correction rate respect to the maximun error correction capability
  *   for each dictionary. (default 0.6).
+ * - bitThresholdMethod: how the cells of a candidate are thresholded once its perspective is removed.
+ *   BIT_THRESHOLD_OTSU binarizes the image of the candidate with Otsu. BIT_THRESHOLD_LOCAL_MEAN and
+ *   BIT_THRESHOLD_CLUSTERS compare the mean value of each cell with the local mean of the candidate
+ *   minus adaptiveThreshConstant, i.e. the adaptive thresholding rule with a window of the size of the
+ *   candidate, or with the middle of the two clusters of the cell means. They avoid the meanStdDev and
+ *   Otsu passes over the image of each candidate. (default BIT_THRESHOLD_OTSU)
+ * - minCellContrast: with BIT_THRESHOLD_LOCAL_MEAN and BIT_THRESHOLD_CLUSTERS, minimum difference
+ *   between the brightest and the darkest cell means, in pixel values. Below it all the cells are
+ *   set to 0 or 1 depending on their mean, as with minOtsuStdDev (default 10.0)
  * - aprilTagMinClusterPixels: reject quads containing too few pixels. (default 5)
  * - aprilTagMaxNmaxima: how many corner candidates to consider when segmenting a group of pixels into a quad. (default 10)
  * - aprilTagCriticalRad: Reject quads where pairs of edges have angles that are close to straight or close to
@@ -146,6 +161,22 @@ enum CornerRefineMethod{
  *   Parameter is the standard deviation in pixels.  Very noisy images benefit from non-zero values (e.g. 0.8). (default 0.0)
  * - detectInvertedMarker: to check if there is a white marker. In order to generate a "white" marker just
  *   invert a normal marker by using a tilde, ~markerImage. (default false)
+ * - adaptiveThreshScaleScheduling: for video streams. Remember which adaptive thresholding scales
+ *   (window sizes) produced the markers accepted in the previous calls to detectMarkers and only
+ *   run those scales in the next frames, plus a periodic full sweep over all the scales to catch
+ *   markers of new sizes. A full sweep is also done after a frame in which less markers than in the
+ *   previous one were found. The history is kept in threshScaleHistory, so use one DetectorParameters
+ *   object per video stream. The scales are recorded in 64 bits masks: with more than 64 scales the
+ *   scheduling is disabled and every scale is applied in every frame (default false).
+ * - adaptiveThreshFullSweepPeriod: number of frames between two full sweeps over all the
+ *   thresholding scales when adaptiveThreshScaleScheduling is enabled (default 30).
+ * - adaptiveThreshScaleMemory: number of frames a thresholding scale is kept active after the last
+ *   frame in which it produced an accepted marker (default 5).
+ * - useBorderProbe: before removing the perspective of a candidate, sample one pixel per cell of the
+ *   innermost border ring, and of the central cell as reference, directly through its homography and
+ *   reject it if the ring alone exceeds maxErroneousBitsInBorderRate. Candidates with a low contrast
+ *   go through the full bits extraction. Faster in textured scenes where most candidates are not
+ *   markers, but a single pixel per cell is less robust to blur and noise (default false).
  */
 struct CV_EXPORTS_W DetectorParameters {
 
@@ -173,6 +204,8 @@ struct CV_EXPORTS_W DetectorParameters {
     CV_PROP_RW double maxErroneousBitsInBorderRate;
     CV_PROP_RW double minOtsuStdDev;
     CV_PROP_RW double errorCorrectionRate;
+    CV_PROP_RW int bitThresholdMethod;
+    CV_PROP_RW double minCellContrast;
 
     //// April :: User-configurable parameters.
     //CV_PROP_RW float aprilTagQuadDecimate;
@@ -188,6 +221,30 @@ struct CV_EXPORTS_W DetectorParameters {
 
     // to detect white (inverted) markers
     CV_PROP_RW bool detectInvertedMarker;
+
+    // to schedule the adaptive thresholding scales in video streams
+    CV_PROP_RW bool adaptiveThreshScaleScheduling;
+    CV_PROP_RW int adaptiveThreshFullSweepPeriod;
+    CV_PROP_RW int adaptiveThreshScaleMemory;
+
+    // to reject candidates before the bits extraction
+    CV_PROP_RW bool useBorderProbe;
+
+    /** @brief Forget the thresholding scales recorded by previous detectMarkers calls, e.g. when the
+     * parameters are reused for a new video stream. The next call does a full sweep.
+     */
+    CV_WRAP void resetThreshScaleHistory();
+
+    /** @brief Number of thresholding scales applied by the last detectMarkers call and number of
+     * full sweeps since the last resetThreshScaleHistory(). Only counted while
+     * adaptiveThreshScaleScheduling is enabled.
+     */
+    CV_WRAP int getLastThreshScaleCount() const;
+    CV_WRAP int getThreshFullSweepCount() const;
+
+    struct ThreshScaleHistory;
+    /// scales that produced accepted markers in the previous frames (adaptiveThreshScaleScheduling)
+    Ptr<ThreshScaleHistory> threshScaleHistory;
 };
 
 
@@ -211,6 +268,10 @@ struct CV_EXPORTS_W DetectorParameters {
  * @param distCoeff optional vector of distortion coefficients
  * \f$(k_1, k_2, p_1, p_2[, k_3[, k_4, k_5, k_6],[s_1, s_2, s_3, s_4]])\f$ of 4, 5, 8 or 12 elements
  *
+ * The camera is used by CORNER_REFINE_CONTOUR to fit the marker sides without distortion. A lookup
+ * grid of the undistortion is built for each camera matrix, coefficients and image size, and kept
+ * for the last few cameras: passing parameters that change in every frame rebuilds it every time.
+ *
  * Performs marker detection in the input image. Only markers included in the specific dictionary
  * are searched. For each detected marker, it returns the 2D position of its corner in the image
  * and its corresponding identifier.
@@ -223,6 +284,39 @@ CV_EXPORTS_W void detectMarkers(InputArray image, const Ptr<Dictionary> &diction
                                 OutputArrayOfArrays rejectedImgPoints = noArray(), InputArray cameraMatrix= noArray(), InputArray distCoeff= noArray());
 
 
+/**
+ * @brief Basic marker detection bounded by a time budget
+ *
+ * @param image input image
+ * @param dictionary indicates the type of markers that will be searched
+ * @param corners vector of detected marker corners, as in detectMarkers.
+ * @param ids vector of identifiers of the detected markers.
+ * @param timeBudgetMs time budget for the whole call, in milliseconds.
+ * @param parameters marker detection parameters
+ * @param predictedCorners optional vector of marker corners where markers are expected, e.g. the
+ * markers detected in the previous frame. Candidates close to them are analyzed first.
+ * @param rejectedImgPoints contains the imgPoints of those squares whose inner code has not a
+ * correct codification, plus the candidates that could not be analyzed before the deadline.
+ * @param cameraMatrix optional input 3x3 floating-point camera matrix
+ * @param distCoeff optional vector of distortion coefficients
+ * @return true if the budget ran out before all the candidates were analyzed.
+ *
+ * Same as detectMarkers, but the candidates are identified in order of a cheap priority (candidate
+ * size, contrast with its surroundings and closeness to the predicted positions) until the time
+ * budget runs out, so the markers that are found first are the most likely ones. If the budget runs
+ * out, the markers found so far are returned and the corner refinement is skipped. Note that the
+ * candidate search (thresholding and contour extraction) is always completed, so the budget can be
+ * exceeded when it is smaller than that stage.
+ * @sa detectMarkers
+ */
+CV_EXPORTS_W bool detectMarkersWithBudget(InputArray image, const Ptr<Dictionary> &dictionary,
+                                          OutputArrayOfArrays corners, OutputArray ids, double timeBudgetMs,
+                                          const Ptr<DetectorParameters> &parameters = DetectorParameters::create(),
+                                          InputArrayOfArrays predictedCorners = noArray(),
+                                          OutputArrayOfArrays rejectedImgPoints = noArray(),
+                                          InputArray cameraMatrix = noArray(), InputArray distCoeff = noArray());
+
+
 
 /**
  * @brief Pose estimation for single markers
@@ -291,6 +385,34 @@ class CV_EXPORTS_W Board {
     /// vector of the identifiers of the markers in the board (same size than objPoints)
     /// The identifiers refers to the board dictionary
     CV_PROP std::vector< int > ids;
+
+    /**
+     * @brief Index in ids and objPoints of the marker with the given identifier, -1 if the marker
+     * is not in the board
+     *
+     * The lookup uses a table built by the create functions. If ids is modified afterwards,
+     * updateIdIndex() must be called: the identifiers added since the table was built are not
+     * found, the ones moved or removed are found by a linear search.
+     */
+    CV_WRAP int getMarkerIndex(int id) const;
+
+    /**
+     * @brief Rebuild the identifier lookup table after modifying ids
+     */
+    CV_WRAP void updateIdIndex();
+
+    /**
+     * @brief For each marker of the board, index of its first occurrence in detectedIds, -1 if it
+     * has not been detected
+     *
+     * @param detectedIds identifiers of the detected markers
+     * @param detectionIdx output vector, same size than ids
+     */
+    void getDetectedMarkerIndices(InputArray detectedIds, std::vector< int > &detectionIdx) const;
+
+    struct IdIndex;
+    /// identifier lookup table of getMarkerIndex(), shared by the copies of the board
+    Ptr<IdIndex> idIndex;
 };
 
 
@@ -397,6 +519,88 @@ CV_EXPORTS_W int estimatePoseBoard(InputArrayOfArrays corners, InputArray ids, c
 
 
 
+/**
+ * @brief State and parameters of the temporal pose estimation of a board, see trackPoseBoard()
+ *
+ * The tracker keeps the pose of the previous frame. On each frame, the correspondences whose
+ * reprojection error with that pose is too large are discarded and the pose is refined from the
+ * previous one with the rest. If that fails (or there is no previous pose), the pose is solved
+ * from scratch and, if its error is too large, with RANSAC. If everything fails the tracker is
+ * reset.
+ * - maxGatingError: correspondences whose reprojection error with the previous pose is larger are
+ *   not used. For marker boards the error of a marker is the mean error of its corners (default 10
+ *   pixels).
+ * - maxRmsError: maximum RMS reprojection error of the used correspondences to accept a pose
+ *   (default 3 pixels).
+ * - ransacReprojectionError: inlier threshold of the RANSAC fallback (default 5 pixels).
+ * - ransacIterations: number of iterations of the RANSAC fallback (default 100).
+ */
+class CV_EXPORTS_W BoardPoseTracker {
+
+    public:
+    BoardPoseTracker();
+
+    CV_WRAP static Ptr<BoardPoseTracker> create();
+
+    /** @brief Forget the previous pose, e.g. when the tracker is reused for a new video stream */
+    CV_WRAP void reset();
+
+    /** @brief True if the last update succeeded */
+    CV_WRAP bool hasPose() const { return _hasPose; }
+
+    /**
+     * @brief Update the pose with the correspondences of a new frame
+     *
+     * @param objPoints object points (e.g. std::vector<cv::Point3f>)
+     * @param imgPoints image points, same size than objPoints
+     * @param pointsPerGroup correspondences are gated in groups of consecutive points, e.g. the 4
+     * corners of a marker
+     * @param cameraMatrix input 3x3 floating-point camera matrix
+     * @param distCoeffs vector of distortion coefficients
+     * @param rvec output rotation vector of the new pose
+     * @param tvec output translation vector of the new pose
+     *
+     * Returns the number of groups used for the pose, 0 if the pose could not be estimated.
+     */
+    int update(InputArray objPoints, InputArray imgPoints, int pointsPerGroup, InputArray cameraMatrix,
+               InputArray distCoeffs, OutputArray rvec, OutputArray tvec);
+
+    CV_PROP_RW double maxGatingError;
+    CV_PROP_RW double maxRmsError;
+    CV_PROP_RW double ransacReprojectionError;
+    CV_PROP_RW int ransacIterations;
+
+    private:
+    bool _hasPose;
+    // pose of the last successful update
+    Vec3d _lastRvec, _lastTvec;
+};
+
+
+
+/**
+ * @brief Pose estimation of a board of markers in a video stream
+ *
+ * @param corners vector of already detected markers corners.
+ * @param ids list of identifiers for each marker in corners
+ * @param board layout of markers in the board.
+ * @param cameraMatrix input 3x3 floating-point camera matrix
+ * @param distCoeffs vector of distortion coefficients
+ * @param tracker pose of the board in the previous frame, updated by the call
+ * @param rvec output rotation vector of the board
+ * @param tvec output translation vector of the board
+ *
+ * Same as estimatePoseBoard(), but the pose of the previous frame is used as initial guess and
+ * the markers that do not agree with it are discarded, see BoardPoseTracker.
+ * The function returns the number of markers employed for the board pose estimation, 0 means the
+ * pose has not been estimated.
+ */
+CV_EXPORTS_W int trackPoseBoard(InputArrayOfArrays corners, InputArray ids, const Ptr<Board> &board,
+                                InputArray cameraMatrix, InputArray distCoeffs,
+                                const Ptr<BoardPoseTracker> &tracker, OutputArray rvec, OutputArray tvec);
+
+
+
 
 /**
  * @brief Refind not detected markers based on the already detected and the board layout
@@ -115,6 +115,24 @@ class CV_EXPORTS_W CharucoBoard : public Board {
       */
     CV_WRAP float getMarkerLength() const { return _markerLength; }
 
+    /**
+     * @brief Save the board to a binary file
+     *
+     * @param filename output file
+     *
+     * The file includes the dictionary and the nearest marker topology, so that loading the board
+     * does not need to recompute anything. Returns false if the file cannot be written.
+     */
+    CV_WRAP bool save(const String &filename) const;
+
+    /**
+     * @brief Load a board saved with save()
+     *
+     * @param filename input file
+     * @return the board, or an empty pointer if the file cannot be read or is not a valid board file
+     */
+    CV_WRAP static Ptr<CharucoBoard> load(const String &filename);
+
     private:
     void _getNearestMarkerCorners();
 
@@ -189,6 +207,28 @@ CV_EXPORTS_W bool estimatePoseCharucoBoard(InputArray charucoCorners, InputArray
 
 
 
+/**
+ * @brief Pose estimation of a ChArUco board in a video stream
+ * @param charucoCorners vector of detected charuco corners
+ * @param charucoIds list of identifiers for each corner in charucoCorners
+ * @param board layout of ChArUco board.
+ * @param cameraMatrix input 3x3 floating-point camera matrix
+ * @param distCoeffs vector of distortion coefficients
+ * @param tracker pose of the board in the previous frame, updated by the call
+ * @param rvec output rotation vector of the board
+ * @param tvec output translation vector of the board
+ *
+ * Same as estimatePoseCharucoBoard(), but the pose of the previous frame is used as initial guess
+ * and the corners that do not agree with it are discarded, see BoardPoseTracker.
+ * If pose estimation is valid, returns true, else returns false.
+ */
+CV_EXPORTS_W bool trackPoseCharucoBoard(InputArray charucoCorners, InputArray charucoIds,
+                                        const Ptr<CharucoBoard> &board, InputArray cameraMatrix,
+                                        InputArray distCoeffs, const Ptr<BoardPoseTracker> &tracker,
+                                        OutputArray rvec, OutputArray tvec);
+
+
+
 
 /**
  * @brief Draws a set of Charuco corners
@@ -259,6 +299,208 @@ CV_EXPORTS_W double calibrateCameraCharuco(
 
 
 
+/**
+ * @brief Online selection of a bounded set of calibration views
+ *
+ * Views are offered as they are captured and at most maxViews of them are kept, so the cost of the
+ * final calibration does not depend on the length of the capture. When the set is full, a new view
+ * replaces the kept view whose replacement improves the set the most, or it is discarded if no
+ * replacement does. A set is better if its image points cover more cells of a gridSize x gridSize
+ * grid over the image or, with the same coverage, if its board poses are more diverse: each view
+ * scores the pose distance to its most similar view, that is the angle between the board normals
+ * (radians) plus the absolute difference of the logarithms of the board distances.
+ *
+ * The board poses are estimated with the camera given in setCamera(). Without it, a rough guess
+ * (focal length equal to the largest image side, principal point in the center) is used, which is
+ * enough to compare the views.
+ */
+class CV_EXPORTS_W CalibrationViewSelector {
+
+    public:
+    CalibrationViewSelector(Size imageSize, int maxViews = 40, int gridSize = 8);
+
+    CV_WRAP static Ptr<CalibrationViewSelector> create(Size imageSize, int maxViews = 40,
+                                                       int gridSize = 8);
+
+    /** @brief Camera used to estimate the board poses of the views offered from now on */
+    CV_WRAP void setCamera(InputArray cameraMatrix, InputArray distCoeffs);
+
+    /**
+     * @brief Offer a new view
+     *
+     * @param objPoints object points of the view (e.g. std::vector<cv::Point3f>), at least 4
+     * @param imgPoints image points, same size than objPoints
+     * @param viewId identifier of the view returned by getViewIds(), e.g. the frame number
+     *
+     * Returns true if the view is kept.
+     */
+    CV_WRAP bool addView(InputArray objPoints, InputArray imgPoints, int viewId);
+
+    /**
+     * @brief Offer the charuco corners of a new view
+     *
+     * @param charucoCorners interpolated charuco corners
+     * @param charucoIds list of identifiers for each corner in charucoCorners
+     * @param board layout of ChArUco board.
+     * @param viewId identifier of the view returned by getViewIds(), e.g. the frame number
+     *
+     * Returns true if the view is kept.
+     */
+    CV_WRAP bool addCharucoView(InputArray charucoCorners, InputArray charucoIds,
+                                const Ptr<CharucoBoard> &board, int viewId);
+
+    /** @brief Number of kept views */
+    CV_WRAP int getViewCount() const { return (int)_views.size(); }
+
+    /** @brief Identifiers of the kept views */
+    CV_WRAP std::vector< int > getViewIds() const;
+
+    /** @brief Object and image points of the kept views, e.g. for calibrateCamera() */
+    CV_WRAP void getViews(OutputArrayOfArrays objPoints, OutputArrayOfArrays imgPoints) const;
+
+    /**
+     * @brief Charuco corners and ids of the kept views, e.g. for calibrateCameraCharuco(). All the
+     * views must have been added with addCharucoView().
+     */
+    CV_WRAP void getCharucoViews(OutputArrayOfArrays charucoCorners,
+                                 OutputArrayOfArrays charucoIds) const;
+
+    /** @brief Rate of the grid cells with image points of the kept views */
+    CV_WRAP double getCoverage() const;
+
+    /** @brief Mean pose distance of the kept views to their most similar one */
+    CV_WRAP double getPoseDiversity() const;
+
+    private:
+    struct View {
+        int id;
+        Mat objPoints, imgPoints, charucoIds;
+        std::vector< int > cells; // grid cells with image points, without repetitions
+        Vec3d normal;             // board normal in camera coordinates
+        double logDistance;       // logarithm of the board distance
+    };
+
+    bool _addView(View &view);
+    double _getPoseDistance(const View &a, const View &b) const;
+    void _updateNeighbours(int changedView);
+
+    Size _imageSize;
+    int _maxViews, _gridSize;
+    Mat _cameraMatrix, _distCoeffs;
+    std::vector< View > _views;
+    std::vector< int > _cellCount;  // number of kept views with points in each grid cell
+    std::vector< double > _poseDistance; // between each pair of kept views
+    // two most similar views of each kept view and their distances
+    std::vector< int > _nearest, _secondNearest;
+    std::vector< double > _nearestDistance, _secondNearestDistance;
+};
+
+
+
+/**
+ * @brief Camera calibration that is refined as new views arrive
+ *
+ * The views are kept in a persistent problem. Each refine() starts Levenberg-Marquardt from the
+ * current intrinsics and per-view extrinsics, so after a few new views it converges in a few
+ * iterations. The extrinsics of a new view are initialized with solvePnP() and the current
+ * intrinsics. If no initial camera is given with setCamera(), the first refine() initializes the
+ * intrinsics with initCameraMatrix2D(), so the object points must be planar (z = 0) in that case.
+ *
+ * The Jacobian of the reprojection errors is block sparse: the errors of a view depend on the
+ * intrinsics and on the 6 extrinsic parameters of that view only. The normal equations are solved
+ * with the Schur complement of the block diagonal extrinsic part, so an iteration costs O(views)
+ * instead of O(views^3).
+ *
+ * The distortion model has 5 coefficients (k1, k2, p1, p2, k3). The supported flags are
+ * CALIB_FIX_ASPECT_RATIO (the ratio of the initial camera, 1 if there is none),
+ * CALIB_FIX_FOCAL_LENGTH, CALIB_FIX_PRINCIPAL_POINT, CALIB_ZERO_TANGENT_DIST and
+ * CALIB_FIX_K1 to CALIB_FIX_K3.
+ */
+class CV_EXPORTS_W IncrementalCalibrator {
+
+    public:
+    IncrementalCalibrator(Size imageSize, int flags = 0);
+
+    CV_WRAP static Ptr<IncrementalCalibrator> create(Size imageSize, int flags = 0);
+
+    /** @brief Set the current intrinsics, e.g. a previous calibration to start from */
+    CV_WRAP void setCamera(InputArray cameraMatrix, InputArray distCoeffs);
+
+    /**
+     * @brief Add a view to the problem
+     *
+     * @param objPoints object points of the view (e.g. std::vector<cv::Point3f>), at least 4
+     * @param imgPoints image points, same size than objPoints
+     *
+     * Returns the index of the view.
+     */
+    CV_WRAP int addView(InputArray objPoints, InputArray imgPoints);
+
+    /**
+     * @brief Add the charuco corners of a view to the problem
+     *
+     * @param charucoCorners interpolated charuco corners, at least 4
+     * @param charucoIds list of identifiers for each corner in charucoCorners
+     * @param board layout of ChArUco board.
+     *
+     * Returns the index of the view.
+     */
+    CV_WRAP int addCharucoView(InputArray charucoCorners, InputArray charucoIds,
+                               const Ptr<CharucoBoard> &board);
+
+    /**
+     * @brief Refine the calibration with the views added since the last call
+     *
+     * @param criteria termination criteria of Levenberg-Marquardt. The epsilon is relative to the
+     * norm of the parameters, so a warm started refinement stops after a few iterations.
+     *
+     * Does nothing if no view was added or camera set since the last call. Returns the RMS
+     * reprojection error, as calibrateCamera().
+     */
+    CV_WRAP double refine(TermCriteria criteria = TermCriteria(TermCriteria::COUNT + TermCriteria::EPS,
+                                                               30, 1e-8));
+
+    /** @brief Current intrinsics */
+    CV_WRAP void getCamera(OutputArray cameraMatrix, OutputArray distCoeffs) const;
+
+    /** @brief Current extrinsics of each view */
+    CV_WRAP void getExtrinsics(OutputArrayOfArrays rvecs, OutputArrayOfArrays tvecs) const;
+
+    /** @brief Number of views in the problem */
+    CV_WRAP int getViewCount() const { return (int)_views.size(); }
+
+    /** @brief RMS reprojection error after the last refine() */
+    CV_WRAP double getRmsError() const { return _rmsError; }
+
+    /** @brief Number of Levenberg-Marquardt iterations of the last refine() */
+    CV_WRAP int getIterations() const { return _iterations; }
+
+    private:
+    enum { NINTRINSICS = 9 }; // fx, fy, cx, cy, k1, k2, p1, p2, k3
+
+    struct View {
+        Mat objPoints, imgPoints;
+        Vec3d rvec, tvec;
+        bool hasPose;
+    };
+
+    void _initialize();
+    double _getCost(const Vec< double, NINTRINSICS > &intrinsics, const std::vector< Vec3d > &rvecs,
+                    const std::vector< Vec3d > &tvecs) const;
+
+    Size _imageSize;
+    int _flags;
+    Vec< double, NINTRINSICS > _intrinsics;
+    bool _hasIntrinsics;
+    double _aspectRatio; // fx / fy with CALIB_FIX_ASPECT_RATIO
+    std::vector< View > _views;
+    bool _dirty;
+    double _rmsError;
+    int _iterations;
+};
+
+
+
 /**
  * @brief Detect ChArUco Diamond markers
  *
@@ -65,6 +65,25 @@ class CV_EXPORTS_W Dictionary {
     CV_PROP_RW int markerSize;        // number of bits per dimension
     CV_PROP_RW int maxCorrectionBits; // maximum number of bits that can be corrected
 
+    /**
+     * Optional Hamming search index of bytesList used by identify(), see buildSearchIndex().
+     * It may be shared by several dictionaries and must not be modified.
+     */
+    Mat searchIndex;
+
+    /**
+     * Fingerprint of the contents of bytesList and of maxCorrectionBits when the search index was
+     * built. The index is only used while they match it, so that modifying the codes, in place or
+     * not, never makes the search rely on a stale index: identify() then searches linearly and
+     * detectMarkers() rebuilds the index.
+     */
+    uint64 searchIndexKey;
+
+    /**
+     * Memory mapping holding bytesList and searchIndex of a dictionary returned by load()
+     */
+    Ptr<void> mappedFile;
+
 
     /**
       */
@@ -98,6 +117,42 @@ class CV_EXPORTS_W Dictionary {
      */
     CV_WRAP static Ptr<Dictionary> get(int dict);
 
+    /**
+     * @brief Save the dictionary to a binary file
+     *
+     * @param filename output file
+     * @param buildIndex store a Hamming search index along with the codes (see buildSearchIndex)
+     * @return false if the file cannot be written
+     *
+     * The codes are stored in their 4 rotations with the layout of bytesList, in little endian,
+     * so that load() can use them in place.
+     */
+    CV_WRAP bool save(const String &filename, bool buildIndex = true) const;
+
+    /**
+     * @brief Load a dictionary saved with save()
+     *
+     * @param filename dictionary file
+     * @return the dictionary, or an empty pointer if the file cannot be read or is not a valid
+     * dictionary file
+     *
+     * The file is memory mapped and bytesList and searchIndex point into the mapping without
+     * copy, so the processes loading the same file share its pages. The mapping is copy-on-write:
+     * modifying bytesList only changes the pages of this process, never the file. It is released
+     * with the last dictionary referring to it.
+     */
+    CV_WRAP static Ptr<Dictionary> load(const String &filename);
+
+    /**
+     * @brief Build the Hamming search index of bytesList
+     *
+     * The codes are split into blocks of bits and the index lists the markers having each value of
+     * each block in any rotation. When the number of corrected bits is lower than the number of
+     * blocks, identify() then only checks the markers sharing a block with the candidate instead of
+     * the whole dictionary. No index is built if maxCorrectionBits is too high for it to help.
+     */
+    CV_WRAP void buildSearchIndex();
+
     /**
      * @brief Given a matrix of bits. Returns whether if marker is identified or not.
      * It returns by reference the correct id (if any) and the correct rotation
@@ -165,12 +220,16 @@ enum PREDEFINED_DICTIONARY_NAME {
 
 /**
   * @brief Returns one of the predefined dictionaries defined in PREDEFINED_DICTIONARY_NAME
+  *
+  * Each call returns a new dictionary with its own copy of the codes, which the caller may modify.
+  * The tables they are copied from and the search index are built once and shared read-only.
   */
 CV_EXPORTS Ptr<Dictionary> getPredefinedDictionary(PREDEFINED_DICTIONARY_NAME name);
 
 
 /**
-  * @brief Returns one of the predefined dictionaries referenced by DICT_*.
+  * @brief Returns one of the predefined dictionaries referenced by DICT_*, see
+  * getPredefinedDictionary(PREDEFINED_DICTIONARY_NAME).
   */
 CV_EXPORTS_W Ptr<Dictionary> getPredefinedDictionary(int dict);
 
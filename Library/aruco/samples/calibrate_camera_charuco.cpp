@@ -41,6 +41,13 @@ the use of this software, even if advised of the possibility of such damage.
 #include <opencv2/calib3d.hpp>
 #include <opencv2/aruco/charuco.hpp>
 #include <opencv2/imgproc.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <sstream>
+#include <thread>
 #include <vector>
 #include <iostream>
 #include <ctime>
@@ -71,7 +78,10 @@ const char* keys  =
         "{zt       | false | Assume zero tangential distortion }"
         "{a        |       | Fix aspect ratio (fx/fy) to this value }"
         "{pc       | false | Fix the principal point at the center }"
-        "{sc       | false | Show detected chessboard corners after calibration }";
+        "{mv       | 0     | Maximum number of views used for calibration, selected by image coverage "
+        "and pose diversity. 0 uses all the captured frames }"
+        "{sc       | false | Show detected chessboard corners after calibration. The captured frames "
+        "are written next to the output file until then }";
 }
 
 /**
@@ -147,6 +157,97 @@ static bool saveCameraParams(const string &filename, Size imageSize, float aspec
 }
 
 
+/**
+ * Charuco corners and ids of a captured frame. Only these are kept in memory, the image is
+ * written to disk when it has to be shown after the calibration
+ */
+struct CalibrationFrame {
+    Mat charucoCorners;
+    Mat charucoIds;
+    string imageFile; // empty if the image is not kept
+};
+
+
+
+/**
+ * Writes the captured images on a pool of threads, so the capture loop does not wait for the
+ * encoder. The number of pending images is bounded to keep the memory use constant
+ */
+class ImageSpiller {
+  public:
+    ImageSpiller(int nWorkers, size_t maxPending) : maxPending(maxPending), stopped(false), failed(false) {
+        for(int i = 0; i < nWorkers; i++)
+            workers.push_back(thread(&ImageSpiller::run, this));
+    }
+
+    ~ImageSpiller() { finish(); }
+
+    void push(const string &filename, const Mat &image) {
+        unique_lock< mutex > lock(jobsMutex);
+        jobsChanged.wait(lock, [this]() { return jobs.size() < maxPending; });
+        jobs.push_back(make_pair(filename, image));
+        jobsChanged.notify_all();
+    }
+
+    /** @brief Wait until all the images are written. Returns false if any of them failed */
+    bool finish() {
+        {
+            lock_guard< mutex > lock(jobsMutex);
+            stopped = true;
+        }
+        jobsChanged.notify_all();
+        for(size_t i = 0; i < workers.size(); i++)
+            workers[i].join();
+        workers.clear();
+        return !failed;
+    }
+
+  private:
+    void run() {
+        while(true) {
+            pair< string, Mat > job;
+            {
+                unique_lock< mutex > lock(jobsMutex);
+                jobsChanged.wait(lock, [this]() { return stopped || !jobs.empty(); });
+                if(jobs.empty()) return;
+                job = jobs.front();
+                jobs.pop_front();
+            }
+            jobsChanged.notify_all();
+            if(!imwrite(job.first, job.second)) failed = true;
+        }
+    }
+
+    size_t maxPending;
+    bool stopped;
+    atomic< bool > failed; // set by the workers
+    mutex jobsMutex;
+    condition_variable jobsChanged;
+    deque< pair< string, Mat > > jobs;
+    vector< thread > workers;
+};
+
+
+
+/**
+ * Removes the files added to it when it goes out of scope, so the spilled images are deleted on
+ * every exit path
+ */
+class TemporaryFiles {
+  public:
+    ~TemporaryFiles() {
+        for(size_t i = 0; i < files.size(); i++)
+            remove(files[i].c_str());
+    }
+
+    void add(const string &filename) { files.push_back(filename); }
+
+  private:
+    vector< string > files;
+};
+
+
+
 /**
  */
 int main(int argc, char *argv[]) {
@@ -185,6 +286,7 @@ int main(int argc, char *argv[]) {
         }
     }
 
+    int maxViews = parser.get<int>("mv");
     bool refindStrategy = parser.get<bool>("rs");
     int camId = parser.get<int>("ci");
     String video;
@@ -216,12 +318,20 @@ int main(int argc, char *argv[]) {
             aruco::CharucoBoard::create(squaresX, squaresY, squareLength, markerLength, dictionary);
     Ptr<aruco::Board> board = charucoboard.staticCast<aruco::Board>();
 
-    // collect data from each frame
-    vector< vector< vector< Point2f > > > allCorners;
-    vector< vector< int > > allIds;
-    vector< Mat > allImgs;
+    // collect data from each frame. The charuco corners are interpolated when the frame is
+    // captured, so the images are not kept
+    vector< CalibrationFrame > allFrames;
     Size imgSize;
 
+    // optional online selection of the views, the selector needs the image size of the first frame
+    Ptr<aruco::CalibrationViewSelector> viewSelector;
+
+    // the captured images are needed only to show them after the calibration. The files outlive
+    // the spiller, which may still be writing them
+    TemporaryFiles spilledFiles;
+    int nSpillWorkers = max(1, min(4, (int)thread::hardware_concurrency()));
+    ImageSpiller spiller(nSpillWorkers, 2 * nSpillWorkers);
+
     while(inputVideo.grab()) {
         Mat image, imageCopy;
         inputVideo.retrieve(image);
@@ -256,14 +366,35 @@ int main(int argc, char *argv[]) {
         if(key == 27) break;
         if(key == 'c' && ids.size() > 0) {
             cout << "Frame captured" << endl;
-            allCorners.push_back(corners);
-            allIds.push_back(ids);
-            allImgs.push_back(image);
+
+            CalibrationFrame frame;
+            frame.charucoCorners = currentCharucoCorners;
+            frame.charucoIds = currentCharucoIds;
+            if(showChessboardCorners) {
+                ostringstream filename;
+                filename << outputFile << ".frame" << allFrames.size() << ".png";
+                frame.imageFile = filename.str();
+                spilledFiles.add(frame.imageFile);
+                spiller.push(frame.imageFile, image);
+            }
+            allFrames.push_back(frame);
             imgSize = image.size();
+
+            if(maxViews > 0 && currentCharucoCorners.total() >= 4) {
+                if(viewSelector.empty())
+                    viewSelector = aruco::CalibrationViewSelector::create(imgSize, max(maxViews, 2));
+                viewSelector->addCharucoView(currentCharucoCorners, currentCharucoIds, charucoboard,
+                                             (int)allFrames.size() - 1);
+            }
         }
     }
 
-    if(allIds.size() < 1) {
+    if(!spiller.finish()) {
+        cerr << "Cannot save the captured frames, they will not be shown" << endl;
+        showChessboardCorners = false;
+    }
+
+    if(allFrames.size() < 1) {
         cerr << "Not enough captures for calibration" << endl;
         return 0;
     }
@@ -277,43 +408,31 @@ int main(int argc, char *argv[]) {
         cameraMatrix.at< double >(0, 0) = aspectRatio;
     }
 
-    // prepare data for calibration
-    vector< vector< Point2f > > allCornersConcatenated;
-    vector< int > allIdsConcatenated;
-    vector< int > markerCounterPerFrame;
-    markerCounterPerFrame.reserve(allCorners.size());
-    for(unsigned int i = 0; i < allCorners.size(); i++) {
-        markerCounterPerFrame.push_back((int)allCorners[i].size());
-        for(unsigned int j = 0; j < allCorners[i].size(); j++) {
-            allCornersConcatenated.push_back(allCorners[i][j]);
-            allIdsConcatenated.push_back(allIds[i][j]);
-        }
+    // frames used for calibration
+    vector< int > calibrationFrames;
+    if(!viewSelector.empty()) {
+        calibrationFrames = viewSelector->getViewIds();
+        cout << "Selected " << calibrationFrames.size() << " of " << allFrames.size()
+             << " frames, image coverage " << viewSelector->getCoverage() << ", pose diversity "
+             << viewSelector->getPoseDiversity() << endl;
+    } else {
+        for(unsigned int i = 0; i < allFrames.size(); i++)
+            calibrationFrames.push_back(i);
     }
 
-    // calibrate camera using aruco markers
-    double arucoRepErr;
-    arucoRepErr = aruco::calibrateCameraAruco(allCornersConcatenated, allIdsConcatenated,
-                                              markerCounterPerFrame, board, imgSize, cameraMatrix,
-                                              distCoeffs, noArray(), noArray(), calibrationFlags);
-
     // prepare data for charuco calibration
-    int nFrames = (int)allCorners.size();
+    int nFrames = (int)calibrationFrames.size();
     vector< Mat > allCharucoCorners;
     vector< Mat > allCharucoIds;
-    vector< Mat > filteredImages;
     allCharucoCorners.reserve(nFrames);
     allCharucoIds.reserve(nFrames);
 
-    for(int i = 0; i < nFrames; i++) {
-        // interpolate using camera parameters
-        Mat currentCharucoCorners, currentCharucoIds;
-        aruco::interpolateCornersCharuco(allCorners[i], allIds[i], allImgs[i], charucoboard,
-                                         currentCharucoCorners, currentCharucoIds, cameraMatrix,
-                                         distCoeffs);
-
-        allCharucoCorners.push_back(currentCharucoCorners);
-        allCharucoIds.push_back(currentCharucoIds);
-        filteredImages.push_back(allImgs[i]);
+    for(int f = 0; f < nFrames; f++) {
+        int i = calibrationFrames[f];
+        // a view needs at least 4 corners
+        if(allFrames[i].charucoCorners.total() < 4) continue;
+        allCharucoCorners.push_back(allFrames[i].charucoCorners);
+        allCharucoIds.push_back(allFrames[i].charucoIds);
     }
 
     if(allCharucoCorners.size() < 4) {
@@ -334,19 +453,16 @@ int main(int argc, char *argv[]) {
     }
 
     cout << "Rep Error: " << repError << endl;
-    cout << "Rep Error Aruco: " << arucoRepErr << endl;
     cout << "Calibration saved to " << outputFile << endl;
 
     // show interpolated charuco corners for debugging
     if(showChessboardCorners) {
-        for(unsigned int frame = 0; frame < filteredImages.size(); frame++) {
-            Mat imageCopy = filteredImages[frame].clone();
-            if(allIds[frame].size() > 0) {
-
-                if(allCharucoCorners[frame].total() > 0) {
-                    aruco::drawDetectedCornersCharuco( imageCopy, allCharucoCorners[frame],
-                                                       allCharucoIds[frame]);
-                }
+        for(unsigned int frame = 0; frame < allFrames.size(); frame++) {
+            Mat imageCopy = imread(allFrames[frame].imageFile);
+            if(imageCopy.empty()) continue;
+            if(allFrames[frame].charucoCorners.total() > 0) {
+                aruco::drawDetectedCornersCharuco( imageCopy, allFrames[frame].charucoCorners,
+                                                   allFrames[frame].charucoIds);
             }
 
             imshow("out", imageCopy);
@@ -0,0 +1,165 @@
+/*
+By downloading, copying, installing or using the software you agree to this
+license. If you do not agree to this license, do not download, install,
+copy or use the software.
+
+                          License Agreement
+               For Open Source Computer Vision Library
+                       (3-clause BSD License)
+
+Copyright (C) 2013, OpenCV Foundation, all rights reserved.
+Third party copyrights are property of their respective owners.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice,
+    this list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the names of the copyright holders nor the names of the contributors
+    may be used to endorse or promote products derived from this software
+    without specific prior written permission.
+
+This software is provided by the copyright holders and contributors "as is" and
+any express or implied warranties, including, but not limited to, the implied
+warranties of merchantability and fitness for a particular purpose are
+disclaimed. In no event shall copyright holders or contributors be liable for
+any direct, indirect, incidental, special, exemplary, or consequential damages
+(including, but not limited to, procurement of substitute goods or services;
+loss of use, data, or profits; or business interruption) however caused
+and on any theory of liability, whether in contract, strict liability,
+or tort (including negligence or otherwise) arising in any way out of
+the use of this software, even if advised of the possibility of such damage.
+*/
+
+
+#include <opencv2/opencv.hpp>
+#include <opencv2/aruco.hpp>
+#include <cstring>
+#include <iostream>
+using namespace std;
+using namespace cv;
+
+namespace {
+const char* about = "Convert an ArUco dictionary between the YAML and the binary formats";
+const char* keys  =
+        "{@outfile |<none> | Output dictionary. Files ending with .yml, .yaml, .xml or .json are written "
+        "with FileStorage, other files in the binary format of Dictionary::save }"
+        "{in       |       | Input dictionary, in either format }"
+        "{d        |       | dictionary: DICT_4X4_50=0, DICT_4X4_100=1, DICT_4X4_250=2,"
+        "DICT_4X4_1000=3, DICT_5X5_50=4, DICT_5X5_100=5, DICT_5X5_250=6, DICT_5X5_1000=7, "
+        "DICT_6X6_50=8, DICT_6X6_100=9, DICT_6X6_250=10, DICT_6X6_1000=11, DICT_7X7_50=12,"
+        "DICT_7X7_100=13, DICT_7X7_250=14, DICT_7X7_1000=15, DICT_ARUCO_ORIGINAL = 16}"
+        "{nm       |       | Number of markers of a custom dictionary to generate }"
+        "{ms       |       | Marker size of the custom dictionary, in bits }"
+        "{seed     | 0     | Random seed of the custom dictionary }"
+        "{ni       | false | Do not store the search index in a binary file }";
+}
+
+/**
+ */
+static bool isFileStorage(const string &filename) {
+    const char* extensions[] = { ".yml", ".yaml", ".xml", ".json", ".yml.gz", ".yaml.gz", ".xml.gz", ".json.gz" };
+    for(const char* extension : extensions) {
+        size_t length = strlen(extension);
+        if(filename.size() >= length && filename.compare(filename.size() - length, length, extension) == 0)
+            return true;
+    }
+    return false;
+}
+
+/**
+ * The markers are stored as strings of markersize x markersize bits in row order
+ */
+static Ptr<aruco::Dictionary> readDictionary(const string &filename) {
+    FileStorage fs(filename, FileStorage::READ);
+    if(!fs.isOpened())
+        return Ptr<aruco::Dictionary>();
+    int nMarkers = 0, markerSize = 0, maxCorrectionBits = 0;
+    fs["nmarkers"] >> nMarkers;
+    fs["markersize"] >> markerSize;
+    fs["maxCorrectionBits"] >> maxCorrectionBits;
+    if(nMarkers <= 0 || markerSize <= 0)
+        return Ptr<aruco::Dictionary>();
+
+    Mat bytesList;
+    for(int i = 0; i < nMarkers; i++) {
+        string code;
+        fs["marker_" + to_string(i)] >> code;
+        if((int)code.size() != markerSize * markerSize)
+            return Ptr<aruco::Dictionary>();
+        Mat bits(markerSize, markerSize, CV_8UC1);
+        for(int j = 0; j < markerSize * markerSize; j++)
+            bits.data[j] = code[j] == '1' ? 1 : 0;
+        bytesList.push_back(aruco::Dictionary::getByteListFromBits(bits));
+    }
+    return makePtr<aruco::Dictionary>(bytesList, markerSize, maxCorrectionBits);
+}
+
+/**
+ */
+static bool writeDictionary(const string &filename, const Ptr<aruco::Dictionary> &dictionary) {
+    FileStorage fs(filename, FileStorage::WRITE);
+    if(!fs.isOpened())
+        return false;
+    fs << "nmarkers" << dictionary->bytesList.rows;
+    fs << "markersize" << dictionary->markerSize;
+    fs << "maxCorrectionBits" << dictionary->maxCorrectionBits;
+    for(int i = 0; i < dictionary->bytesList.rows; i++) {
+        Mat bits = aruco::Dictionary::getBitsFromByteList(dictionary->bytesList.rowRange(i, i + 1),
+                                                          dictionary->markerSize);
+        string code(bits.total(), '0');
+        for(size_t j = 0; j < bits.total(); j++)
+            code[j] += bits.data[j];
+        fs << "marker_" + to_string(i) << code;
+    }
+    return true;
+}
+
+
+int main(int argc, char *argv[]) {
+    CommandLineParser parser(argc, argv, keys);
+    parser.about(about);
+
+    if(argc < 3) {
+        parser.printMessage();
+        return 0;
+    }
+
+    String out = parser.get<String>(0);
+    String in = parser.get<String>("in");
+    bool buildIndex = !parser.get<bool>("ni");
+
+    if(!parser.check()) {
+        parser.printErrors();
+        return 0;
+    }
+
+    Ptr<aruco::Dictionary> dictionary;
+    if(!in.empty()) {
+        dictionary = isFileStorage(in) ? readDictionary(in) : aruco::Dictionary::load(in);
+    } else if(parser.has("d")) {
+        int dictionaryId = parser.get<int>("d");
+        dictionary = aruco::getPredefinedDictionary(aruco::PREDEFINED_DICTIONARY_NAME(dictionaryId));
+    } else if(parser.has("nm") && parser.has("ms")) {
+        dictionary = aruco::generateCustomDictionary(parser.get<int>("nm"), parser.get<int>("ms"),
+                                                     parser.get<int>("seed"));
+    }
+    if(!dictionary) {
+        cerr << "Invalid input dictionary" << endl;
+        return 0;
+    }
+
+    bool saved = isFileStorage(out) ? writeDictionary(out, dictionary) : dictionary->save(out, buildIndex);
+    if(!saved) {
+        cerr << "Cannot write " << out << endl;
+        return 0;
+    }
+    cout << "Saved " << dictionary->bytesList.rows << " markers of " << dictionary->markerSize << "x"
+         << dictionary->markerSize << " bits to " << out << endl;
+    return 0;
+}
@@ -38,8 +38,14 @@ the use of this software, even if advised of the possibility of such damage.
 
 #include "precomp.hpp"
 #include "opencv2/aruco.hpp"
+#include "candidate_grid.hpp"
+#include "marker_kernels.hpp"
+#include "subpix.hpp"
+#include "undistortion.hpp"
 #include <opencv2/core.hpp>
 #include <opencv2/imgproc.hpp>
+#include <atomic>
+#include <unordered_map>
 //#include "zarray.hpp"
 
 //#define APRIL_DEBUG
@@ -77,6 +83,8 @@ DetectorParameters::DetectorParameters()
       maxErroneousBitsInBorderRate(0.35),
       minOtsuStdDev(5.0),
       errorCorrectionRate(0.6),
+      bitThresholdMethod(BIT_THRESHOLD_OTSU),
+      minCellContrast(10.0),
       //aprilTagQuadDecimate(0.0),
       //aprilTagQuadSigma(0.0),
       //aprilTagMinClusterPixels(5),
@@ -85,7 +93,12 @@ DetectorParameters::DetectorParameters()
       //aprilTagMaxLineFitMse(10.0),
       //aprilTagMinWhiteBlackDiff(5),
       //aprilTagDeglitch(0),
-      detectInvertedMarker(false){}
+      detectInvertedMarker(false),
+      adaptiveThreshScaleScheduling(false),
+      adaptiveThreshFullSweepPeriod(30),
+      adaptiveThreshScaleMemory(5),
+      useBorderProbe(false),
+      threshScaleHistory(makePtr<ThreshScaleHistory>()){}
 
 
 /**
@@ -97,6 +110,50 @@ Ptr<DetectorParameters> DetectorParameters::create() {
 }
 
 
+/**
+  * @brief Record of the adaptive thresholding scales that produced accepted markers in the
+  * previous frames of a video stream
+  */
+struct DetectorParameters::ThreshScaleHistory {
+    ThreshScaleHistory() : frame(0), lastFullSweep(0), lastNumMarkers(0), forceFullSweep(true), lastNumScales(0),
+                           nFullSweeps(0) {}
+
+    Mutex mutex;
+    int frame; // number of detectMarkers calls seen so far
+    int lastFullSweep; // frame of the last full sweep
+    int lastNumMarkers; // number of markers accepted in the previous frame
+    bool forceFullSweep;
+    vector< int > lastProductive; // for each scale, last frame where it produced an accepted marker
+    int lastNumScales; // number of scales applied in the last frame
+    int nFullSweeps; // number of full sweeps so far
+};
+
+
+/**
+  */
+void DetectorParameters::resetThreshScaleHistory() {
+    threshScaleHistory = makePtr<ThreshScaleHistory>();
+}
+
+
+/**
+  */
+int DetectorParameters::getLastThreshScaleCount() const {
+    if(threshScaleHistory.empty()) return 0;
+    AutoLock lock(threshScaleHistory->mutex);
+    return threshScaleHistory->lastNumScales;
+}
+
+
+/**
+  */
+int DetectorParameters::getThreshFullSweepCount() const {
+    if(threshScaleHistory.empty()) return 0;
+    AutoLock lock(threshScaleHistory->mutex);
+    return threshScaleHistory->nFullSweeps;
+}
+
+
 /**
   * @brief Convert input image to gray if it is a 3-channels image
   */
@@ -124,10 +181,12 @@ static void _threshold(InputArray _in, OutputArray _out, int winSize, double con
 
 /**
   * @brief Given a tresholded image, find the contours, calculate their polygonal approximation
-  * and take those that accomplish some conditions
+  * and take those that accomplish some conditions. The contour points of the candidates are
+  * only returned if keepContours is set, their perimeters always
   */
 static void _findMarkerContours(InputArray _in, vector< vector< Point2f > > &candidates,
-                                vector< vector< Point > > &contoursOut, double minPerimeterRate,
+                                vector< vector< Point > > &contoursOut, vector< int > &perimetersOut,
+                                bool keepContours, double minPerimeterRate,
                                 double maxPerimeterRate, double accuracyRate,
                                 double minCornerDistanceRate, int minDistanceToBorder) {
 
@@ -185,7 +244,9 @@ static void _findMarkerContours(InputArray _in, vector< vector< Point2f > > &can
             currentCandidate[j] = Point2f((float)approxCurve[j].x, (float)approxCurve[j].y);
         }
         candidates.push_back(currentCandidate);
-        contoursOut.push_back(contours[i]);
+        perimetersOut.push_back((int)contours[i].size());
+        if(keepContours)
+            contoursOut.push_back(std::move(contours[i]));
     }
 }
 
@@ -225,14 +286,46 @@ static vector< Point2f > alignContourOrder( Point2f corner, vector< Point2f > ca
     return candidate;
 }
 
+/**
+  * @brief Thresholding scales that produced the candidate chosen in a group: the scale of the
+  * candidate itself and the closest scale that produced another candidate of the group, since a
+  * marker needs at least two grouped contours to survive the filtering
+  */
+static uint64 _getScaleProvenance(const vector< unsigned int > &group, unsigned int chosenIdx,
+                                  const vector< int > &scales) {
+
+    int chosenScale = scales[chosenIdx];
+    int closestScale = -1;
+    for(unsigned int k = 0; k < group.size(); k++) {
+        int currScale = scales[group[k]];
+        if(currScale == chosenScale) continue;
+        if(closestScale < 0 || abs(currScale - chosenScale) < abs(closestScale - chosenScale))
+            closestScale = currScale;
+    }
+
+    uint64 mask = 0;
+    if(chosenScale < 64) mask |= (uint64)1 << chosenScale;
+    if(closestScale >= 0 && closestScale < 64) mask |= (uint64)1 << closestScale;
+    return mask;
+}
+
+
 /**
   * @brief Check candidates that are too close to each other, save the potential candidates
-  *        (i.e. biggest/smallest contour) and remove the rest
+  *        (i.e. biggest/smallest contour) and remove the rest. The biggest contour of each group
+  *        is a default candidate; with detectInvertedMarker the smallest one, used for white markers,
+  *        is appended after them and whiteIdxOut gives its index for every default candidate. The
+  *        thresholding scales that produced each saved candidate are returned in scaleMasksOut.
+  *        contoursIn and scalesIn may be empty, then the saved candidates have no contour and no
+  *        scale mask. The contours are moved to contoursOut
   */
 static void _filterTooCloseCandidates(const vector< vector< Point2f > > &candidatesIn,
-                                      vector< vector< vector< Point2f > > > &candidatesSetOut,
-                                      const vector< vector< Point > > &contoursIn,
-                                      vector< vector< vector< Point > > > &contoursSetOut,
+                                      vector< vector< Point2f > > &candidatesOut,
+                                      const vector< int > &perimetersIn,
+                                      vector< vector< Point > > &contoursIn,
+                                      vector< vector< Point > > &contoursOut,
+                                      const vector< int > &scalesIn,
+                                      vector< uint64 > &scaleMasksOut, vector< int > &whiteIdxOut,
                                       double minMarkerDistanceRate, bool detectInvertedMarker) {
 
     CV_Assert(minMarkerDistanceRate >= 0);
@@ -243,7 +336,7 @@ static void _filterTooCloseCandidates(const vector< vector< Point2f > > &candida
     for(unsigned int i = 0; i < candidatesIn.size(); i++) {
         for(unsigned int j = i + 1; j < candidatesIn.size(); j++) {
 
-            int minimumPerimeter = min((int)contoursIn[i].size(), (int)contoursIn[j].size() );
+            int minimumPerimeter = min(perimetersIn[i], perimetersIn[j]);
 
             // fc is the first corner considered on one of the markers, 4 combinations are possible
             for(int fc = 0; fc < 4; fc++) {
@@ -295,15 +388,12 @@ static void _filterTooCloseCandidates(const vector< vector< Point2f > > &candida
     }
 
     // save possible candidates
-    candidatesSetOut.clear();
-    contoursSetOut.clear();
-
-    vector< vector< Point2f > > biggerCandidates;
-    vector< vector< Point > > biggerContours;
-    vector< vector< Point2f > > smallerCandidates;
-    vector< vector< Point > > smallerContours;
+    candidatesOut.clear();
+    contoursOut.clear();
+    scaleMasksOut.clear();
+    whiteIdxOut.clear();
 
-    // save possible candidates
+    vector< unsigned int > biggerIdxs, smallerIdxs;
     for(unsigned int i = 0; i < groupedCandidates.size(); i++) {
         unsigned int smallerIdx = groupedCandidates[i][0];
         unsigned int biggerIdx = smallerIdx;
@@ -329,28 +419,118 @@ static void _filterTooCloseCandidates(const vector< vector< Point2f > > &candida
         }
 
         // add contours and candidates
-        biggerCandidates.push_back(candidatesIn[biggerIdx]);
-        biggerContours.push_back(contoursIn[biggerIdx]);
+        candidatesOut.push_back(candidatesIn[biggerIdx]);
+        if(!contoursIn.empty())
+            contoursOut.push_back(std::move(contoursIn[biggerIdx]));
+        if(!scalesIn.empty())
+            scaleMasksOut.push_back(_getScaleProvenance(groupedCandidates[i], biggerIdx, scalesIn));
         if(detectInvertedMarker) {
-            smallerCandidates.push_back(alignContourOrder(candidatesIn[biggerIdx][0], candidatesIn[smallerIdx]));
-            smallerContours.push_back(contoursIn[smallerIdx]);
+            biggerIdxs.push_back(biggerIdx);
+            smallerIdxs.push_back(smallerIdx);
+        }
+    }
+
+    // the white candidates follow the default ones, a group whose smallest contour is the biggest
+    // one points to its default candidate
+    for(unsigned int i = 0; i < smallerIdxs.size(); i++) {
+        unsigned int smallerIdx = smallerIdxs[i];
+        if(smallerIdx == biggerIdxs[i]) {
+            whiteIdxOut.push_back((int)i);
+            continue;
         }
+        whiteIdxOut.push_back((int)candidatesOut.size());
+        candidatesOut.push_back(alignContourOrder(candidatesIn[biggerIdxs[i]][0], candidatesIn[smallerIdx]));
+        if(!contoursIn.empty())
+            contoursOut.push_back(std::move(contoursIn[smallerIdx]));
+        if(!scalesIn.empty())
+            scaleMasksOut.push_back(_getScaleProvenance(groupedCandidates[i], smallerIdx, scalesIn));
     }
-    // to preserve the structure :: candidateSet< defaultCandidates, whiteCandidates >
-    // default candidates
-    candidatesSetOut.push_back(biggerCandidates);
-    contoursSetOut.push_back(biggerContours);
-    // white candidates
-    candidatesSetOut.push_back(smallerCandidates);
-    contoursSetOut.push_back(smallerContours);
 }
 
+
 /**
- * @brief Initial steps on finding square candidates
+ * @brief Select the thresholding scales to apply in the current frame. All of them unless the
+ * scale scheduling is enabled, in which case only the scales that recently produced accepted
+ * markers are applied, with a full sweep from time to time
+ */
+static void _selectThresholdScales(int nScales, const Ptr<DetectorParameters> &params,
+                                   vector< int > &scales) {
+
+    scales.clear();
+
+    // scale masks are 64 bits wide
+    if(params->adaptiveThreshScaleScheduling && !params->threshScaleHistory.empty() && nScales <= 64) {
+        CV_Assert(params->adaptiveThreshFullSweepPeriod > 0 && params->adaptiveThreshScaleMemory >= 0);
+
+        DetectorParameters::ThreshScaleHistory &history = *params->threshScaleHistory;
+        AutoLock lock(history.mutex);
+
+        // thresholding parameters changed since the last frame
+        if((int)history.lastProductive.size() != nScales) {
+            history.lastProductive.assign(nScales, -1);
+            history.forceFullSweep = true;
+        }
+
+        bool fullSweep = history.forceFullSweep ||
+                         history.frame - history.lastFullSweep >= params->adaptiveThreshFullSweepPeriod;
+        if(!fullSweep) {
+            for(int i = 0; i < nScales; i++) {
+                if(history.lastProductive[i] >= 0 &&
+                   history.frame - history.lastProductive[i] <= params->adaptiveThreshScaleMemory)
+                    scales.push_back(i);
+            }
+        }
+        if(!scales.empty()) {
+            history.lastNumScales = (int)scales.size();
+            return;
+        }
+
+        history.lastFullSweep = history.frame;
+        history.forceFullSweep = false;
+        history.lastNumScales = nScales;
+        history.nFullSweeps++;
+    }
+
+    for(int i = 0; i < nScales; i++)
+        scales.push_back(i);
+}
+
+
+/**
+ * @brief Record the thresholding scales that produced the markers accepted in the current frame. If
+ * the time budget was exceeded, the markers that were not analyzed are not counted as lost
+ */
+static void _updateThresholdScaleHistory(const vector< uint64 > &acceptedScaleMasks, bool budgetExceeded,
+                                         const Ptr<DetectorParameters> &params) {
+
+    if(!params->adaptiveThreshScaleScheduling || params->threshScaleHistory.empty()) return;
+
+    DetectorParameters::ThreshScaleHistory &history = *params->threshScaleHistory;
+    AutoLock lock(history.mutex);
+
+    for(unsigned int i = 0; i < acceptedScaleMasks.size(); i++) {
+        for(int j = 0; j < (int)history.lastProductive.size(); j++) {
+            if(acceptedScaleMasks[i] & ((uint64)1 << j))
+                history.lastProductive[j] = history.frame;
+        }
+    }
+
+    // some marker was lost, maybe it is now visible only at other scales
+    if(!budgetExceeded) {
+        if((int)acceptedScaleMasks.size() < history.lastNumMarkers)
+            history.forceFullSweep = true;
+        history.lastNumMarkers = (int)acceptedScaleMasks.size();
+    }
+    history.frame++;
+}
+
+/**
+ * @brief Initial steps on finding square candidates. The contours are only kept for the contour
+ * corner refinement and the scales of the candidates for the scale scheduling
  */
 static void _detectInitialCandidates(const Mat &grey, vector< vector< Point2f > > &candidates,
-                                     vector< vector< Point > > &contours,
-                                     const Ptr<DetectorParameters> &params) {
+                                     vector< int > &perimeters, vector< vector< Point > > &contours,
+                                     vector< int > &candidateScales, const Ptr<DetectorParameters> &params) {
 
     CV_Assert(params->adaptiveThreshWinSizeMin >= 3 && params->adaptiveThreshWinSizeMax >= 3);
     CV_Assert(params->adaptiveThreshWinSizeMax >= params->adaptiveThreshWinSizeMin);
@@ -360,23 +540,31 @@ static void _detectInitialCandidates(const Mat &grey, vector< vector< Point2f >
     int nScales =  (params->adaptiveThreshWinSizeMax - params->adaptiveThreshWinSizeMin) /
                       params->adaptiveThreshWinSizeStep + 1;
 
+    // scales to apply in this frame
+    vector< int > scales;
+    _selectThresholdScales(nScales, params, scales);
+
     vector< vector< vector< Point2f > > > candidatesArrays((size_t) nScales);
     vector< vector< vector< Point > > > contoursArrays((size_t) nScales);
+    vector< vector< int > > perimetersArrays((size_t) nScales);
+    bool keepContours = params->cornerRefinementMethod == CORNER_REFINE_CONTOUR;
+    bool keepScales = params->adaptiveThreshScaleScheduling && !params->threshScaleHistory.empty();
 
     ////for each value in the interval of thresholding window sizes
-    parallel_for_(Range(0, nScales), [&](const Range& range) {
+    parallel_for_(Range(0, (int)scales.size()), [&](const Range& range) {
         const int begin = range.start;
         const int end = range.end;
 
-        for (int i = begin; i < end; i++) {
+        for (int k = begin; k < end; k++) {
+            int i = scales[k];
             int currScale = params->adaptiveThreshWinSizeMin + i * params->adaptiveThreshWinSizeStep;
             // threshold
             Mat thresh;
             _threshold(grey, thresh, currScale, params->adaptiveThreshConstant);
 
             // detect rectangles
-            _findMarkerContours(thresh, candidatesArrays[i], contoursArrays[i],
-                                params->minMarkerPerimeterRate, params->maxMarkerPerimeterRate,
+            _findMarkerContours(thresh, candidatesArrays[i], contoursArrays[i], perimetersArrays[i],
+                                keepContours, params->minMarkerPerimeterRate, params->maxMarkerPerimeterRate,
                                 params->polygonalApproxAccuracyRate, params->minCornerDistanceRate,
                                 params->minDistanceToBorder);
         }
@@ -386,7 +574,11 @@ static void _detectInitialCandidates(const Mat &grey, vector< vector< Point2f >
     for(int i = 0; i < nScales; i++) {
         for(unsigned int j = 0; j < candidatesArrays[i].size(); j++) {
             candidates.push_back(candidatesArrays[i][j]);
-            contours.push_back(contoursArrays[i][j]);
+            perimeters.push_back(perimetersArrays[i][j]);
+            if(keepContours)
+                contours.push_back(std::move(contoursArrays[i][j]));
+            if(keepScales)
+                candidateScales.push_back(i);
         }
     }
 }
@@ -395,8 +587,9 @@ static void _detectInitialCandidates(const Mat &grey, vector< vector< Point2f >
 /**
  * @brief Detect square candidates in the input image
  */
-static void _detectCandidates(InputArray _image, vector< vector< vector< Point2f > > >& candidatesSetOut,
-                              vector< vector< vector< Point > > >& contoursSetOut, const Ptr<DetectorParameters> &_params) {
+static void _detectCandidates(InputArray _image, vector< vector< Point2f > >& candidatesOut,
+                              vector< vector< Point > >& contoursOut, vector< uint64 >& scaleMasksOut,
+                              vector< int >& whiteIdxOut, const Ptr<DetectorParameters> &_params) {
 
     Mat image = _image.getMat();
     CV_Assert(image.total() != 0);
@@ -406,38 +599,28 @@ static void _detectCandidates(InputArray _image, vector< vector< vector< Point2f
     _convertToGrey(image, grey);
 
     vector< vector< Point2f > > candidates;
+    vector< int > perimeters;
     vector< vector< Point > > contours;
+    vector< int > scales;
     /// 2. DETECT FIRST SET OF CANDIDATES
-    _detectInitialCandidates(grey, candidates, contours, _params);
+    _detectInitialCandidates(grey, candidates, perimeters, contours, scales, _params);
 
     /// 3. SORT CORNERS
     _reorderCandidatesCorners(candidates);
 
     /// 4. FILTER OUT NEAR CANDIDATE PAIRS
     // save the outter/inner border (i.e. potential candidates)
-    _filterTooCloseCandidates(candidates, candidatesSetOut, contours, contoursSetOut,
-                              _params->minMarkerDistanceRate, _params->detectInvertedMarker);
+    _filterTooCloseCandidates(candidates, candidatesOut, perimeters, contours, contoursOut, scales, scaleMasksOut,
+                              whiteIdxOut, _params->minMarkerDistanceRate, _params->detectInvertedMarker);
 }
 
 
 /**
-  * @brief Given an input image and candidate corners, extract the bits of the candidate, including
-  * the border bits
+  * @brief Remove the perspective of a candidate, cellSize x cellSize pixels per cell
   */
-static Mat _extractBits(InputArray _image, InputArray _corners, int markerSize,
-                        int markerBorderBits, int cellSize, double cellMarginRate,
-                        double minStdDevOtsu) {
-
-    CV_Assert(_image.getMat().channels() == 1);
-    CV_Assert(_corners.total() == 4);
-    CV_Assert(markerBorderBits > 0 && cellSize > 0 && cellMarginRate >= 0 && cellMarginRate <= 1);
-    CV_Assert(minStdDevOtsu >= 0);
-
-    // number of bits in the marker
-    int markerSizeWithBorders = markerSize + 2 * markerBorderBits;
-    int cellMarginPixels = int(cellMarginRate * cellSize);
+static void _removePerspective(InputArray _image, InputArray _corners, int markerSizeWithBorders, int cellSize,
+                               Mat &resultImg) {
 
-    Mat resultImg; // marker image after removing perspective
     int resultImgSize = markerSizeWithBorders * cellSize;
     Mat resultImgCorners(4, 1, CV_32FC2);
     resultImgCorners.ptr< Point2f >(0)[0] = Point2f(0, 0);
@@ -450,9 +633,17 @@ static Mat _extractBits(InputArray _image, InputArray _corners, int markerSize,
     Mat transformation = getPerspectiveTransform(_corners, resultImgCorners);
     warpPerspective(_image, resultImg, transformation, Size(resultImgSize, resultImgSize),
                     INTER_NEAREST);
+}
 
-    // output image containing the bits
-    Mat bits(markerSizeWithBorders, markerSizeWithBorders, CV_8UC1, Scalar::all(0));
+
+/**
+  * @brief Remove the perspective of a candidate and binarize it with Otsu. Returns false, and the
+  * value (0 or 1) of all the cells in uniformValue, if the candidate is too uniform for Otsu
+  */
+static bool _getBinaryCandidateImage(InputArray _image, InputArray _corners, int markerSizeWithBorders,
+                                     int cellSize, double minStdDevOtsu, Mat &resultImg, uchar &uniformValue) {
+
+    _removePerspective(_image, _corners, markerSizeWithBorders, cellSize, resultImg);
 
     // check if standard deviation is enough to apply Otsu
     // if not enough, it probably means all bits are the same color (black or white)
@@ -463,15 +654,126 @@ static Mat _extractBits(InputArray _image, InputArray _corners, int markerSize,
     meanStdDev(innerRegion, mean, stddev);
     if(stddev.ptr< double >(0)[0] < minStdDevOtsu) {
         // all black or all white, depending on mean value
-        if(mean.ptr< double >(0)[0] > 127)
-            bits.setTo(1);
-        else
-            bits.setTo(0);
-        return bits;
+        uniformValue = mean.ptr< double >(0)[0] > 127 ? 1 : 0;
+        return false;
     }
 
     // now extract code, first threshold using Otsu
     threshold(resultImg, resultImg, 125, 255, THRESH_BINARY | THRESH_OTSU);
+    return true;
+}
+
+
+/**
+  * @brief Set the cells of a candidate without perspective from their mean value, in a single pass
+  * over its image. The threshold is the mean of the cells minus adaptiveThreshConstant
+  * (BIT_THRESHOLD_LOCAL_MEAN) or the middle of the two clusters of the cell means
+  * (BIT_THRESHOLD_CLUSTERS). If the cell means are closer than minCellContrast, all the cells are
+  * set to 0 or 1 depending on their mean value
+  */
+static void _getCellsFromMeans(const Mat &resultImg, int cellSize, int cellMarginPixels,
+                               const DetectorParameters &params, Mat &bits) {
+
+    CV_Assert(cellSize - 2 * cellMarginPixels > 0 && params.minCellContrast >= 0);
+    CV_Assert(params.bitThresholdMethod == BIT_THRESHOLD_LOCAL_MEAN ||
+              params.bitThresholdMethod == BIT_THRESHOLD_CLUSTERS);
+
+    int side = cellSize - 2 * cellMarginPixels;
+    double area = side * side;
+    int nCells = (int)bits.total();
+
+    // sum of the pixels of each cell, without its margin
+    AutoBuffer< int, 256 > sums(nCells);
+    int minSum = INT_MAX, maxSum = 0;
+    double total = 0;
+    for(int y = 0; y < bits.rows; y++) {
+        for(int x = 0; x < bits.cols; x++) {
+            int sum = 0;
+            for(int r = 0; r < side; r++) {
+                const uchar *pixels = resultImg.ptr(y * cellSize + cellMarginPixels + r) + x * cellSize +
+                                      cellMarginPixels;
+                for(int c = 0; c < side; c++)
+                    sum += pixels[c];
+            }
+            sums[y * bits.cols + x] = sum;
+            minSum = min(minSum, sum);
+            maxSum = max(maxSum, sum);
+            total += sum;
+        }
+    }
+    double mean = total / (area * nCells);
+
+    // all black or all white, depending on mean value
+    if((maxSum - minSum) / area < params.minCellContrast) {
+        bits.setTo(mean > 127 ? 1 : 0);
+        return;
+    }
+
+    double thresholdValue;
+    if(params.bitThresholdMethod == BIT_THRESHOLD_LOCAL_MEAN)
+        thresholdValue = mean - params.adaptiveThreshConstant;
+    else {
+        // two means clustering in one dimension, both clusters are never empty
+        thresholdValue = (minSum + maxSum) / (2. * area);
+        for(int iter = 0; iter < 10; iter++) {
+            double darkSum = 0, brightSum = 0;
+            int dark = 0;
+            for(int k = 0; k < nCells; k++) {
+                if(sums[k] > thresholdValue * area)
+                    brightSum += sums[k];
+                else {
+                    darkSum += sums[k];
+                    dark++;
+                }
+            }
+            double next = (darkSum / dark + brightSum / (nCells - dark)) / (2. * area);
+            bool converged = std::abs(next - thresholdValue) < 0.5;
+            thresholdValue = next;
+            if(converged) break;
+        }
+    }
+
+    for(int k = 0; k < nCells; k++)
+        bits.ptr()[k] = sums[k] > thresholdValue * area ? 1 : 0;
+}
+
+
+/**
+  * @brief Given an input image and candidate corners, extract the bits of the candidate, including
+  * the border bits
+  */
+static Mat _extractBits(InputArray _image, InputArray _corners, int markerSize, const DetectorParameters &params) {
+
+    int markerBorderBits = params.markerBorderBits;
+    int cellSize = params.perspectiveRemovePixelPerCell;
+    double cellMarginRate = params.perspectiveRemoveIgnoredMarginPerCell;
+    double minStdDevOtsu = params.minOtsuStdDev;
+
+    CV_Assert(_image.getMat().channels() == 1);
+    CV_Assert(_corners.total() == 4);
+    CV_Assert(markerBorderBits > 0 && cellSize > 0 && cellMarginRate >= 0 && cellMarginRate <= 1);
+    CV_Assert(minStdDevOtsu >= 0);
+
+    // number of bits in the marker
+    int markerSizeWithBorders = markerSize + 2 * markerBorderBits;
+    int cellMarginPixels = int(cellMarginRate * cellSize);
+
+    // output image containing the bits
+    Mat bits(markerSizeWithBorders, markerSizeWithBorders, CV_8UC1, Scalar::all(0));
+
+    Mat resultImg; // marker image after removing perspective
+    if(params.bitThresholdMethod != BIT_THRESHOLD_OTSU) {
+        _removePerspective(_image, _corners, markerSizeWithBorders, cellSize, resultImg);
+        _getCellsFromMeans(resultImg, cellSize, cellMarginPixels, params, bits);
+        return bits;
+    }
+
+    uchar uniformValue;
+    if(!_getBinaryCandidateImage(_image, _corners, markerSizeWithBorders, cellSize, minStdDevOtsu, resultImg,
+                                 uniformValue)) {
+        bits.setTo(uniformValue);
+        return bits;
+    }
 
     // for each cell
     for(int y = 0; y < markerSizeWithBorders; y++) {
@@ -518,54 +820,162 @@ static int _getBorderErrors(const Mat &bits, int markerSize, int borderSize) {
 
 
 /**
- * @brief Tries to identify one candidate given the dictionary
+  * @brief Cheap rejection of a candidate before the bits extraction. The centres of the cells of the
+  * innermost border ring and of the central cell are sampled directly through the homography of the
+  * candidate and thresholded at the middle of their range. Returns false if the ring alone already
+  * has more than maxErrors erroneous cells for every allowed polarity. A range too small for Otsu is
+  * inconclusive and left to the bits extraction
+  */
+static bool _probeBorder(const Mat &grey, const vector< Point2f > &corners, int markerSize, int borderBits,
+                         int maxErrors, double minStdDevOtsu, bool detectInvertedMarker) {
+
+    int sizeWithBorders = markerSize + 2 * borderBits;
+    float side = (float)sizeWithBorders;
+    const Point2f cellCorners[4] = { Point2f(0, 0), Point2f(side, 0), Point2f(side, side), Point2f(0, side) };
+    Matx33d H = getPerspectiveTransform(cellCorners, &corners[0]);
+
+    // value of the pixel at the centre of cell (x, y)
+    auto sample = [&](int x, int y) {
+        double cx = x + 0.5, cy = y + 0.5;
+        double w = H(2, 0) * cx + H(2, 1) * cy + H(2, 2);
+        int u = cvRound((H(0, 0) * cx + H(0, 1) * cy + H(0, 2)) / w);
+        int v = cvRound((H(1, 0) * cx + H(1, 1) * cy + H(1, 2)) / w);
+        u = min(max(u, 0), grey.cols - 1);
+        v = min(max(v, 0), grey.rows - 1);
+        return (int)grey.ptr< uchar >(v)[u];
+    };
+
+    // innermost border ring, clockwise from its top left cell
+    int first = borderBits - 1, last = sizeWithBorders - borderBits;
+    int n = last - first;
+    AutoBuffer< int, 64 > ring(4 * n);
+    for(int t = 0; t < n; t++) {
+        ring[t] = sample(first + t, first);
+        ring[n + t] = sample(last, first + t);
+        ring[2 * n + t] = sample(last - t, last);
+        ring[3 * n + t] = sample(first, last - t);
+    }
+
+    int reference = sample(sizeWithBorders / 2, sizeWithBorders / 2);
+    int minValue = reference, maxValue = reference;
+    for(int k = 0; k < 4 * n; k++) {
+        minValue = min(minValue, ring[k]);
+        maxValue = max(maxValue, ring[k]);
+    }
+    // a two level signal of this range has a standard deviation below minStdDevOtsu
+    if(maxValue - minValue < 2 * minStdDevOtsu) return true;
+
+    int threshold = (minValue + maxValue) / 2;
+    int whiteCells = 0;
+    for(int k = 0; k < 4 * n; k++)
+        if(ring[k] > threshold) whiteCells++;
+    int errors = detectInvertedMarker ? min(whiteCells, 4 * n - whiteCells) : whiteCells;
+    return errors <= maxErrors;
+}
+
+
+/**
+  * @brief Complement the code of a candidate in the layout of Dictionary::getByteListFromBits(), the
+  * last byte only holds the remaining bits in its low bits
+  */
+static void _invertCode(uchar *code, int markerSize) {
+    int nbits = markerSize * markerSize;
+    int nbytes = (nbits + 7) / 8;
+    for(int j = 0; j < nbytes - 1; j++)
+        code[j] = (uchar)~code[j];
+    code[nbytes - 1] ^= (uchar)((1 << (nbits - 8 * (nbytes - 1))) - 1);
+}
+
+
+/**
+ * @brief Tries to identify one candidate given the dictionary. Both polarities are decoded in a
+ * single pass: the border errors of the white marker are the black cells of the border and its code
+ * is the complement of the code of the black one
  * @return candidate typ. zero if the candidate is not valid,
  *                           1 if the candidate is a black candidate (default candidate)
  *                           2 if the candidate is a white candidate
  */
-static uint8_t _identifyOneCandidate(const Ptr<Dictionary>& dictionary, InputArray _image,
-                                  vector<Point2f>& _corners, int& idx,
-                                  const Ptr<DetectorParameters>& params, int& rotation)
+static uint8_t _identifyOneCandidate(const Ptr<Dictionary>& dictionary, const Mat &searchIndex,
+                                  InputArray _image, vector<Point2f>& _corners, int& idx,
+                                  const Ptr<DetectorParameters>& params, int& rotation,
+                                  const _MarkerDecoder *decoder = NULL)
 {
     CV_Assert(_corners.size() == 4);
     CV_Assert(_image.getMat().total() != 0);
     CV_Assert(params->markerBorderBits > 0);
 
     uint8_t typ=1;
-    // get bits
-    Mat candidateBits =
-        _extractBits(_image, _corners, dictionary->markerSize, params->markerBorderBits,
-                     params->perspectiveRemovePixelPerCell,
-                     params->perspectiveRemoveIgnoredMarginPerCell, params->minOtsuStdDev);
-
-    // analyze border bits
-    int maximumErrorsInBorder =
-        int(dictionary->markerSize * dictionary->markerSize * params->maxErroneousBitsInBorderRate);
-    int borderErrors =
-        _getBorderErrors(candidateBits, dictionary->markerSize, params->markerBorderBits);
-
-    // check if it is a white marker
-    if(params->detectInvertedMarker){
-        // to get from 255 to 1
-        Mat invertedImg = ~candidateBits-254;
-        int invBError = _getBorderErrors(invertedImg, dictionary->markerSize, params->markerBorderBits);
-        // white marker
-        if(invBError<borderErrors){
+    int markerSize = dictionary->markerSize;
+    int sizeWithBorders = markerSize + 2 * params->markerBorderBits;
+    int maximumErrorsInBorder = int(markerSize * markerSize * params->maxErroneousBitsInBorderRate);
+
+    // reject most of the non-marker candidates without removing their perspective
+    if(params->useBorderProbe &&
+       !_probeBorder(_image.getMat(), _corners, markerSize, params->markerBorderBits, maximumErrorsInBorder,
+                     params->minOtsuStdDev, params->detectInvertedMarker))
+        return 0;
+
+    // get bits, packed in words by the decoder if there is one for these sizes
+    ushort rows[16];
+    Mat candidateBits;
+    int borderErrors;
+    if(decoder != NULL) {
+        CV_Assert(params->perspectiveRemovePixelPerCell > 0 && params->perspectiveRemoveIgnoredMarginPerCell >= 0 &&
+                  params->perspectiveRemoveIgnoredMarginPerCell <= 1 && params->minOtsuStdDev >= 0);
+        int cellSize = params->perspectiveRemovePixelPerCell;
+        Mat resultImg;
+        uchar uniformValue;
+        if(params->bitThresholdMethod != BIT_THRESHOLD_OTSU) {
+            // cells from their means, packed in words
+            Mat cells = _extractBits(_image, _corners, markerSize, *params);
+            for(int y = 0; y < sizeWithBorders; y++) {
+                int row = 0;
+                for(int x = 0; x < sizeWithBorders; x++)
+                    row = (row << 1) | cells.ptr(y)[x];
+                rows[y] = (ushort)row;
+            }
+        }
+        else if(_getBinaryCandidateImage(_image, _corners, sizeWithBorders, cellSize, params->minOtsuStdDev, resultImg,
+                                    uniformValue))
+            decoder->getCells(resultImg, cellSize, int(params->perspectiveRemoveIgnoredMarginPerCell * cellSize),
+                              rows);
+        else
+            std::fill(rows, rows + sizeWithBorders, (ushort)(uniformValue ? (1 << sizeWithBorders) - 1 : 0));
+        borderErrors = decoder->getBorderErrors(rows);
+    }
+    else {
+        candidateBits = _extractBits(_image, _corners, markerSize, *params);
+        borderErrors = _getBorderErrors(candidateBits, markerSize, params->markerBorderBits);
+    }
+
+    // analyze border bits, checking if it is a white marker
+    if(params->detectInvertedMarker) {
+        int invBError = sizeWithBorders * sizeWithBorders - markerSize * markerSize - borderErrors;
+        if(invBError < borderErrors) {
             borderErrors = invBError;
-            invertedImg.copyTo(candidateBits);
-            typ=2;
+            typ = 2;
         }
     }
     if(borderErrors > maximumErrorsInBorder) return 0; // border is wrong
 
-    // take only inner bits
-    Mat onlyBits =
-        candidateBits.rowRange(params->markerBorderBits,
-                               candidateBits.rows - params->markerBorderBits)
-            .colRange(params->markerBorderBits, candidateBits.cols - params->markerBorderBits);
+    // code of the inner bits
+    uchar codeBuffer[8];
+    Mat candidateBytes;
+    uchar *code = codeBuffer;
+    if(decoder != NULL)
+        decoder->getCode(rows, code);
+    else {
+        candidateBytes = Dictionary::getByteListFromBits(
+            candidateBits.rowRange(params->markerBorderBits, candidateBits.rows - params->markerBorderBits)
+                .colRange(params->markerBorderBits, candidateBits.cols - params->markerBorderBits));
+        code = candidateBytes.ptr();
+    }
+    if(typ == 2)
+        _invertCode(code, markerSize);
 
     // try to indentify the marker
-    if(!dictionary->identify(onlyBits, idx, rotation, params->errorCorrectionRate))
+    int maxCorrection = int(double(dictionary->maxCorrectionBits) * params->errorCorrectionRate);
+    if(!_identifyCode(*dictionary, searchIndex, code, maxCorrection, idx, rotation))
         return 0;
 
     return typ;
@@ -612,15 +1022,68 @@ static void correctCornerPosition( vector< Point2f >& _candidate, int rotate){
 }
 
 /**
- * @brief Identify square candidates according to a marker dictionary
+ * @brief Cheap priority of a candidate for the deadline-bounded identification. Big candidates,
+ * candidates with a strong contrast between the border and the surrounding area and candidates
+ * close to a predicted marker position are analyzed first
  */
-static void _identifyCandidates(InputArray _image, vector< vector< vector< Point2f > > >& _candidatesSet,
-                                vector< vector< vector<Point> > >& _contoursSet, const Ptr<Dictionary> &_dictionary,
-                                vector< vector< Point2f > >& _accepted, vector< vector<Point> >& _contours, vector< int >& ids,
-                                const Ptr<DetectorParameters> &params,
+static float _getCandidatePriority(const Mat &grey, const vector< Point2f > &candidate, float maxPerimeter,
+                                   const vector< Point2f > &predictedCenters) {
+
+    Point2f center = 0.25f * (candidate[0] + candidate[1] + candidate[2] + candidate[3]);
+    float perimeter = 0.f;
+    for(int c = 0; c < 4; c++)
+        perimeter += (float)norm(candidate[c] - candidate[(c + 1) % 4]);
+
+    // compare the border, just inside each corner, with the area just outside it
+    float contrast = 0.f;
+    for(int c = 0; c < 4; c++) {
+        Point2f toCenter = 0.1f * (center - candidate[c]);
+        Point inside(cvRound(candidate[c].x + toCenter.x), cvRound(candidate[c].y + toCenter.y));
+        Point outside(cvRound(candidate[c].x - toCenter.x), cvRound(candidate[c].y - toCenter.y));
+        inside.x = min(max(inside.x, 0), grey.cols - 1);
+        inside.y = min(max(inside.y, 0), grey.rows - 1);
+        outside.x = min(max(outside.x, 0), grey.cols - 1);
+        outside.y = min(max(outside.y, 0), grey.rows - 1);
+        contrast += (float)abs((int)grey.at< uchar >(inside) - (int)grey.at< uchar >(outside));
+    }
+    contrast /= 4.f * 255.f;
+
+    // closeness to the nearest predicted position, relative to the marker side
+    float prediction = 0.f;
+    if(!predictedCenters.empty()) {
+        float minDistSq = std::numeric_limits< float >::max();
+        for(unsigned int i = 0; i < predictedCenters.size(); i++) {
+            Point2f diff = predictedCenters[i] - center;
+            minDistSq = min(minDistSq, diff.dot(diff));
+        }
+        float side = max(perimeter / 4.f, 1.f);
+        prediction = 1.f / (1.f + minDistSq / (side * side));
+    }
+
+    return perimeter / maxPerimeter + contrast + 2.f * prediction;
+}
+
+
+/**
+ * @brief Identify square candidates according to a marker dictionary. The candidates are taken from
+ * a work queue shared by the workers. If a deadline is given (in ticks, 0 for none), the queue is
+ * sorted by priority and the workers stop taking candidates once it is reached; the candidates that
+ * were not analyzed are returned as rejected and budgetExceeded is set. The contours and the scale
+ * masks of the accepted candidates are only returned if the candidates have them, and the
+ * rejected candidates only if _rejected is needed
+ */
+static void _identifyCandidates(InputArray _image, vector< vector< Point2f > >& _candidates,
+                                vector< vector<Point> >& _candidateContours, const vector< uint64 >& _scaleMasks,
+                                const vector< int >& _whiteIdx, const Ptr<Dictionary> &_dictionary,
+                                vector< vector< Point2f > >& _accepted, vector< vector<Point> >& _contours,
+                                vector< uint64 >& _acceptedScaleMasks, vector< int >& ids,
+                                const Ptr<DetectorParameters> &params, int64 deadline,
+                                const vector< Point2f > &predictedCenters, bool &budgetExceeded,
                                 OutputArrayOfArrays _rejected = noArray()) {
 
-    int ncandidates = (int)_candidatesSet[0].size();
+    // with detectInvertedMarker, the white candidates follow the default ones
+    int ncandidates = (int)(params->detectInvertedMarker ? _whiteIdx.size() : _candidates.size());
+    bool keepRejected = _rejected.needed();
     vector< vector< Point2f > > accepted;
     vector< vector< Point2f > > rejected;
 
@@ -635,50 +1098,82 @@ static void _identifyCandidates(InputArray _image, vector< vector< vector< Point
     vector< int > rotated(ncandidates, 0);
     vector< uint8_t > validCandidates(ncandidates, 0);
 
-    //// Analyze each of the candidates
-    parallel_for_(Range(0, ncandidates), [&](const Range &range) {
-        const int begin = range.start;
-        const int end = range.end;
+    // order in which the candidates are analyzed
+    vector< int > queue(ncandidates);
+    for(int i = 0; i < ncandidates; i++)
+        queue[i] = i;
+    if(deadline > 0 && ncandidates > 1) {
+        float maxPerimeter = 4.f * (float)max(grey.cols, grey.rows);
+        vector< float > priorities(ncandidates);
+        for(int i = 0; i < ncandidates; i++)
+            priorities[i] = _getCandidatePriority(grey, _candidates[i], maxPerimeter, predictedCenters);
+        std::stable_sort(queue.begin(), queue.end(),
+                         [&](int a, int b) { return priorities[a] > priorities[b]; });
+    }
+
+    // decoding kernels specialized for the marker and border sizes, if any
+    const _MarkerDecoder *decoder = _getMarkerDecoder(_dictionary->markerSize, params->markerBorderBits);
+    // checked once per frame, bytesList may have been modified since the last one
+    Mat searchIndex = _updateSearchIndex(*_dictionary);
+
+    std::atomic< int > next(0);
+    std::atomic< bool > timeout(false);
 
-        vector< vector< Point2f > >& candidates = params->detectInvertedMarker ? _candidatesSet[1] : _candidatesSet[0];
+    //// Analyze each of the candidates
+    int nWorkers = max(1, min(getNumThreads(), ncandidates));
+    parallel_for_(Range(0, nWorkers), [&](const Range &range) {
+        for(int w = range.start; w < range.end; w++) {
+            while(!timeout) {
+                int k = next++;
+                if(k >= ncandidates) break;
+                if(deadline > 0 && getTickCount() > deadline) {
+                    timeout = true;
+                    break;
+                }
 
-        for(int i = begin; i < end; i++) {
-            int currId;
-            validCandidates[i] = _identifyOneCandidate(_dictionary, grey, candidates[i], currId, params, rotated[i]);
+                int i = queue[k];
+                int currId;
+                // the smallest contour of the group decodes both polarities
+                int decoded = params->detectInvertedMarker ? _whiteIdx[i] : i;
+                validCandidates[i] = _identifyOneCandidate(_dictionary, searchIndex, grey, _candidates[decoded],
+                                                           currId, params, rotated[i], decoder);
 
-            if(validCandidates[i] > 0)
-                idsTmp[i] = currId;
+                if(validCandidates[i] > 0)
+                    idsTmp[i] = currId;
+            }
         }
-    });
+    }, nWorkers);
+    budgetExceeded = timeout;
 
     for(int i = 0; i < ncandidates; i++) {
         if(validCandidates[i] > 0) {
-            // to choose the right set of candidates :: 0 for default, 1 for white markers
-            uint8_t set = validCandidates[i]-1;
+            // to choose the right candidate :: the default one or the white one
+            int c = validCandidates[i] == 2 ? _whiteIdx[i] : i;
 
             // shift corner positions to the correct rotation
-            correctCornerPosition(_candidatesSet[set][i], rotated[i]);
-
-            if( !params->detectInvertedMarker && validCandidates[i] == 2 )
-                continue;
+            correctCornerPosition(_candidates[c], rotated[i]);
 
             // add valid candidate
-            accepted.push_back(_candidatesSet[set][i]);
+            accepted.push_back(_candidates[c]);
             ids.push_back(idsTmp[i]);
 
-            contours.push_back(_contoursSet[set][i]);
+            // each candidate is accepted at most once
+            if(!_candidateContours.empty())
+                contours.push_back(std::move(_candidateContours[c]));
+            if(!_scaleMasks.empty())
+                _acceptedScaleMasks.push_back(_scaleMasks[c]);
 
-        } else {
-            rejected.push_back(_candidatesSet[0][i]);
+        } else if(keepRejected) {
+            rejected.push_back(_candidates[i]);
         }
     }
 
     // parse output
-    _accepted = accepted;
+    _accepted.swap(accepted);
 
-    _contours= contours;
+    _contours.swap(contours);
 
-    if(_rejected.needed()) {
+    if(keepRejected) {
         _copyVector2Output(rejected, _rejected);
     }
 }
@@ -701,46 +1196,46 @@ static void _getSingleMarkerObjectPoints(float markerLength, OutputArray _objPoi
 }
 
 /**
- * Line fitting  A * B = C :: Called from function refineCandidateLines
- * @param nContours, contour-container
+ * Running sums of the points of an edge, relative to the origin of their contour
  */
-static Point3f _interpolate2Dline(const std::vector<cv::Point2f>& nContours){
-	float minX, minY, maxX, maxY;
-	minX = maxX = nContours[0].x;
-	minY = maxY = nContours[0].y;
-
-	for(unsigned int i = 0; i< nContours.size(); i++){
-		minX = nContours[i].x < minX ? nContours[i].x : minX;
-		minY = nContours[i].y < minY ? nContours[i].y : minY;
-		maxX = nContours[i].x > maxX ? nContours[i].x : maxX;
-		maxY = nContours[i].y > maxY ? nContours[i].y : maxY;
-	}
-
-	Mat A = Mat::ones((int)nContours.size(), 2, CV_32F); // Coefficient Matrix (N x 2)
-	Mat B((int)nContours.size(), 1, CV_32F);				// Variables   Matrix (N x 1)
-	Mat C;											// Constant
-
-	if(maxX - minX > maxY - minY){
-		for(unsigned int i =0; i < nContours.size(); i++){
-            A.at<float>(i,0)= nContours[i].x;
-            B.at<float>(i,0)= nContours[i].y;
-		}
-
-		solve(A, B, C, DECOMP_NORMAL);
-
-		return Point3f(C.at<float>(0, 0), -1., C.at<float>(1, 0));
+struct _LineMoments {
+	double n, sx, sy, sxx, sxy, syy;
+
+	_LineMoments() : n(0), sx(0), sy(0), sxx(0), sxy(0), syy(0) {}
+
+	void add(double x, double y){
+		n += 1;
+		sx += x;
+		sy += y;
+		sxx += x * x;
+		sxy += x * y;
+		syy += y * y;
 	}
-	else{
-		for(unsigned int i =0; i < nContours.size(); i++){
-			A.at<float>(i,0)= nContours[i].y;
-			B.at<float>(i,0)= nContours[i].x;
-		}
-
-		solve(A, B, C, DECOMP_NORMAL);
 
-		return Point3f(-1., C.at<float>(0, 0), C.at<float>(1, 0));
+	void add(const _LineMoments& m){
+		n += m.n;
+		sx += m.sx;
+		sy += m.sy;
+		sxx += m.sxx;
+		sxy += m.sxy;
+		syy += m.syy;
 	}
+};
 
+/**
+ * Total least squares line fitting a * x + b * y + c = 0 :: Called from function refineCandidateLines
+ * @param m, moments of the points of the edge
+ */
+static Point3d _interpolate2Dline(const _LineMoments& m){
+	double mx = m.sx / m.n, my = m.sy / m.n;
+	double cxx = m.sxx / m.n - mx * mx;
+	double cxy = m.sxy / m.n - mx * my;
+	double cyy = m.syy / m.n - my * my;
+
+	// the line passes through the centroid along the main axis of the covariance
+	double theta = 0.5 * atan2(2 * cxy, cxx - cyy);
+	double a = -sin(theta), b = cos(theta);
+	return Point3d(a, b, -(a * mx + b * my));
 }
 
 /**
@@ -749,65 +1244,58 @@ static Point3f _interpolate2Dline(const std::vector<cv::Point2f>& nContours){
  * @param nLine2
  * @return Crossed Point
  */
-static Point2f _getCrossPoint(Point3f nLine1, Point3f nLine2){
-	Matx22f A(nLine1.x, nLine1.y, nLine2.x, nLine2.y);
-	Vec2f B(-nLine1.z, -nLine2.z);
-	return Vec2f(A.solve(B).val);
-}
-
-static void _distortPoints(vector<cv::Point2f>& in, const Mat& camMatrix, const Mat& distCoeff) {
-    // trivial extrinsics
-    Matx31f Rvec(0,0,0);
-    Matx31f Tvec(0,0,0);
-
-    // calculate 3d points and then reproject, so opencv makes the distortion internally
-    vector<cv::Point3f> cornersPoints3d;
-    for (unsigned int i = 0; i < in.size(); i++){
-        float x= (in[i].x - float(camMatrix.at<double>(0, 2))) / float(camMatrix.at<double>(0, 0));
-        float y= (in[i].y - float(camMatrix.at<double>(1, 2))) / float(camMatrix.at<double>(1, 1));
-        cornersPoints3d.push_back(Point3f(x,y,1));
-    }
-    cv::projectPoints(cornersPoints3d, Rvec, Tvec, camMatrix, distCoeff, in);
+static Point2d _getCrossPoint(Point3d nLine1, Point3d nLine2){
+	double det = nLine1.x * nLine2.y - nLine2.x * nLine1.y;
+	return Point2d((nLine1.y * nLine2.z - nLine2.y * nLine1.z) / det,
+	               (nLine2.x * nLine1.z - nLine1.x * nLine2.z) / det);
 }
 
 /**
  * Refine Corners using the contour vector :: Called from function detectMarkers
+ * The corners are left in undistorted pixels, the caller distorts the corners of all the markers at once
  * @param nContours, contour-container
  * @param nCorners, candidate Corners
- * @param camMatrix, cameraMatrix input 3x3 floating-point camera matrix
- * @param distCoeff, distCoeffs vector of distortion coefficient
+ * @param undistortion, undistortion map of the camera, NULL to fit the lines in the image
+ * @return false if the corners could not be refined, they are then left unchanged in the image
  */
-static void _refineCandidateLines(std::vector<Point>& nContours, std::vector<Point2f>& nCorners, const Mat& camMatrix, const Mat& distCoeff){
-	vector<Point2f> contour2f(nContours.begin(), nContours.end());
-
-	if(!camMatrix.empty() && !distCoeff.empty()){
-		undistortPoints(contour2f, contour2f, camMatrix, distCoeff);
-	}
+static bool _refineCandidateLines(const std::vector<Point>& nContours, std::vector<Point2f>& nCorners,
+                                  const _UndistortionMap* undistortion){
+	// the lines are fitted in undistorted pixels, relative to the first point to keep the sums small
+	Point2f origin = nContours[0];
+	if(undistortion != NULL)
+		origin = undistortion->undistort(origin);
 
 	/* 5 groups :: to group the edges
 	 * 4 - classified by its corner
 	 * extra group - (temporary) if contours do not begin with a corner
 	 */
-	vector<Point2f> cntPts[5];
+	_LineMoments moments[5];
 	int cornerIndex[4]={-1};
 	int group=4;
 
 	for ( unsigned int i =0; i < nContours.size(); i++ ) {
+		Point2f pt = nContours[i];
 		for(unsigned int j=0; j<4; j++){
-			if ( nCorners[j] == contour2f[i] ){
+			if ( nCorners[j] == pt ){
 				cornerIndex[j] = i;
 				group=j;
 			}
 		}
-		cntPts[group].push_back(contour2f[i]);
+		if(undistortion != NULL)
+			pt = undistortion->undistort(pt);
+		moments[group].add(pt.x - origin.x, pt.y - origin.y);
 	}
 
 	// saves extra group into corresponding
-	if( !cntPts[4].empty() ){
+	if( moments[4].n > 0 ){
             CV_CheckLT(group, 4, "FIXIT: avoiding infinite loop: implementation should be revised: https://github.com/opencv/opencv_contrib/issues/2738");
-		for( unsigned int i=0; i < cntPts[4].size() ; i++ )
-			cntPts[group].push_back(cntPts[4].at(i));
-		cntPts[4].clear();
+		moments[group].add(moments[4]);
+	}
+
+	// a corner that is not a point of the contour leaves an edge without points
+	for(int i=0; i<4; i++){
+		if(moments[i].n == 0)
+			return false;
 	}
 
 	//Evaluate contour direction :: using the position of the detected corners
@@ -817,9 +1305,9 @@ static void _refineCandidateLines(std::vector<Point>& nContours, std::vector<Poi
 	inc = ( (cornerIndex[2] > cornerIndex[3]) &&  (cornerIndex[1] > cornerIndex[2]) ) ? -1:inc;
 
 	// calculate the line :: who passes through the grouped points
-	Point3f lines[4];
+	Point3d lines[4];
 	for(int i=0; i<4; i++){
-		lines[i]=_interpolate2Dline(cntPts[i]);
+		lines[i]=_interpolate2Dline(moments[i]);
 	}
 
 	/*
@@ -832,15 +1320,14 @@ static void _refineCandidateLines(std::vector<Point>& nContours, std::vector<Poi
 	 *          2                           3
 	 */
 	for(int i=0; i < 4; i++){
+		Point2d cross;
 		if(inc<0)
-			nCorners[i] = _getCrossPoint(lines[ i ], lines[ (i+1)%4 ]);	// 01 12 23 30
+			cross = _getCrossPoint(lines[ i ], lines[ (i+1)%4 ]);	// 01 12 23 30
 		else
-			nCorners[i] = _getCrossPoint(lines[ i ], lines[ (i+3)%4 ]);	// 30 01 12 23
-	}
-
-	if(!camMatrix.empty() && !distCoeff.empty()){
-		_distortPoints(nCorners, camMatrix, distCoeff);
+			cross = _getCrossPoint(lines[ i ], lines[ (i+3)%4 ]);	// 30 01 12 23
+		nCorners[i] = Point2f(float(cross.x + origin.x), float(cross.y + origin.y));
 	}
+	return true;
 }
 
 #ifdef APRIL_DEBUG
@@ -980,12 +1467,30 @@ static void _darken(const Mat &im){
 
 /**
   */
-void detectMarkers(InputArray _image, const Ptr<Dictionary> &_dictionary, OutputArrayOfArrays _corners,
-                   OutputArray _ids, const Ptr<DetectorParameters> &_params,
-                   OutputArrayOfArrays _rejectedImgPoints, InputArrayOfArrays camMatrix, InputArrayOfArrays distCoeff) {
+/**
+ * @brief detectMarkers implementation, optionally bounded by a time budget (timeBudgetMs <= 0 for
+ * none). Return true if the budget ran out before analyzing all the candidates
+ */
+static bool _detectMarkers(InputArray _image, const Ptr<Dictionary> &_dictionary, OutputArrayOfArrays _corners,
+                           OutputArray _ids, const Ptr<DetectorParameters> &_params,
+                           OutputArrayOfArrays _rejectedImgPoints, InputArrayOfArrays camMatrix,
+                           InputArrayOfArrays distCoeff, double timeBudgetMs, InputArrayOfArrays _predictedCorners) {
 
     CV_Assert(!_image.empty());
 
+    int64 deadline = 0;
+    if(timeBudgetMs > 0)
+        deadline = getTickCount() + (int64)(timeBudgetMs * 1e-3 * getTickFrequency());
+
+    // centers of the predicted markers, to prioritize the candidates near them
+    vector< Point2f > predictedCenters;
+    for(int i = 0; i < (int)_predictedCorners.total(); i++) {
+        Mat predicted = _predictedCorners.getMat(i);
+        CV_Assert(predicted.total() == 4 && predicted.type() == CV_32FC2);
+        Scalar mean = cv::mean(predicted);
+        predictedCenters.push_back(Point2f((float)mean[0], (float)mean[1]));
+    }
+
     Mat grey;
     _convertToGrey(_image.getMat(), grey);
 
@@ -994,47 +1499,66 @@ void detectMarkers(InputArray _image, const Ptr<Dictionary> &_dictionary, Output
     vector< vector< Point > > contours;
     vector< int > ids;
 
-    vector< vector< vector< Point2f > > > candidatesSet;
-    vector< vector< vector< Point > > > contoursSet;
+    vector< vector< Point2f > > detectedCandidates;
+    vector< vector< Point > > detectedContours;
+    vector< uint64 > detectedScaleMasks;
+    vector< int > whiteIdx;
     ///// STEP 1.a Detect marker candidates :: using AprilTag
     //if(_params->cornerRefinementMethod == CORNER_REFINE_APRILTAG){
     //    _apriltag(grey, _params, candidates, contours);
 
-    //    candidatesSet.push_back(candidates);
-    //    contoursSet.push_back(contours);
+    //    detectedCandidates = candidates;
+    //    detectedContours = contours;
     //}
 
     /// STEP 1.b Detect marker candidates :: traditional way
     //else
-    _detectCandidates(grey, candidatesSet, contoursSet, _params);
+    _detectCandidates(grey, detectedCandidates, detectedContours, detectedScaleMasks, whiteIdx, _params);
 
     /// STEP 2: Check candidate codification (identify markers)
-    _identifyCandidates(grey, candidatesSet, contoursSet, _dictionary, candidates, contours, ids, _params,
+    vector< uint64 > scaleMasks;
+    bool budgetExceeded = false;
+    _identifyCandidates(grey, detectedCandidates, detectedContours, detectedScaleMasks, whiteIdx, _dictionary,
+                        candidates, contours, scaleMasks, ids, _params, deadline, predictedCenters, budgetExceeded,
                         _rejectedImgPoints);
 
+    // the contours of the rejected candidates are not needed anymore
+    vector< vector< Point > >().swap(detectedContours);
+
+    // remember which thresholding scales were productive
+    _updateThresholdScaleHistory(scaleMasks, budgetExceeded, _params);
+
     // copy to output arrays
     _copyVector2Output(candidates, _corners);
     Mat(ids).copyTo(_ids);
 
+    // no time left for the corner refinement
+    if(budgetExceeded || (deadline > 0 && getTickCount() > deadline))
+        return true;
+
     /// STEP 3: Corner refinement :: use corner subpix
     if( _params->cornerRefinementMethod == CORNER_REFINE_SUBPIX ) {
         CV_Assert(_params->cornerRefinementWinSize > 0 && _params->cornerRefinementMaxIterations > 0 &&
                   _params->cornerRefinementMinAccuracy > 0);
 
-        //// do corner refinement for each of the detected markers
-        parallel_for_(Range(0, _corners.cols()), [&](const Range& range) {
-            const int begin = range.start;
-            const int end = range.end;
-
-            for (int i = begin; i < end; i++) {
-                cornerSubPix(grey, _corners.getMat(i),
-                             Size(_params->cornerRefinementWinSize, _params->cornerRefinementWinSize),
-                             Size(-1, -1),
-                             TermCriteria(TermCriteria::MAX_ITER | TermCriteria::EPS,
-                                          _params->cornerRefinementMaxIterations,
-                                          _params->cornerRefinementMinAccuracy));
-            }
-        });
+        //// do corner refinement for all the corners of the detected markers at once
+        int nMarkers = _corners.cols();
+        vector< Point2f > allCorners(4 * nMarkers);
+        for(int i = 0; i < nMarkers; i++) {
+            Mat markerCorners = _corners.getMat(i);
+            for(int c = 0; c < 4; c++)
+                allCorners[4 * i + c] = markerCorners.ptr< Point2f >()[c];
+        }
+        refineCornersSubPix(grey, allCorners,
+                            vector< Size >(1, Size(_params->cornerRefinementWinSize, _params->cornerRefinementWinSize)),
+                            TermCriteria(TermCriteria::MAX_ITER | TermCriteria::EPS,
+                                         _params->cornerRefinementMaxIterations,
+                                         _params->cornerRefinementMinAccuracy));
+        for(int i = 0; i < nMarkers; i++) {
+            Mat markerCorners = _corners.getMat(i);
+            for(int c = 0; c < 4; c++)
+                markerCorners.ptr< Point2f >()[c] = allCorners[4 * i + c];
+        }
     }
 
     /// STEP 3, Optional : Corner refinement :: use contour container
@@ -1042,18 +1566,65 @@ void detectMarkers(InputArray _image, const Ptr<Dictionary> &_dictionary, Output
 
         if(! _ids.empty()){
 
+            // shared by the frames with the same camera
+            Ptr<_UndistortionMap> undistortion;
+            if(!camMatrix.empty() && !distCoeff.empty())
+                undistortion = _UndistortionMap::get(camMatrix.getMat(), distCoeff.getMat(), grey.size());
+
             // do corner refinement using the contours for each detected markers
+            vector< uchar > refined(candidates.size(), 0);
             parallel_for_(Range(0, _corners.cols()), [&](const Range& range) {
                 for (int i = range.start; i < range.end; i++) {
-                    _refineCandidateLines(contours[i], candidates[i], camMatrix.getMat(),
-                                          distCoeff.getMat());
+                    refined[i] = _refineCandidateLines(contours[i], candidates[i], undistortion.get());
                 }
             });
 
+            // back to the distorted image, the refined corners of all the markers at once
+            if(!undistortion.empty()) {
+                vector< Point2f > allCorners;
+                allCorners.reserve(4 * candidates.size());
+                for(unsigned int i = 0; i < candidates.size(); i++)
+                    if(refined[i])
+                        allCorners.insert(allCorners.end(), candidates[i].begin(), candidates[i].end());
+                if(!allCorners.empty())
+                    undistortion->distort(allCorners);
+                vector< Point2f >::const_iterator corner = allCorners.begin();
+                for(unsigned int i = 0; i < candidates.size(); i++) {
+                    if(!refined[i]) continue;
+                    std::copy(corner, corner + 4, candidates[i].begin());
+                    corner += 4;
+                }
+            }
+
             // copy the corners to the output array
             _copyVector2Output(candidates, _corners);
         }
     }
+    return false;
+}
+
+
+/**
+  */
+void detectMarkers(InputArray _image, const Ptr<Dictionary> &_dictionary, OutputArrayOfArrays _corners,
+                   OutputArray _ids, const Ptr<DetectorParameters> &_params,
+                   OutputArrayOfArrays _rejectedImgPoints, InputArrayOfArrays camMatrix, InputArrayOfArrays distCoeff) {
+
+    _detectMarkers(_image, _dictionary, _corners, _ids, _params, _rejectedImgPoints, camMatrix, distCoeff, 0,
+                   noArray());
+}
+
+
+/**
+  */
+bool detectMarkersWithBudget(InputArray _image, const Ptr<Dictionary> &_dictionary, OutputArrayOfArrays _corners,
+                             OutputArray _ids, double timeBudgetMs, const Ptr<DetectorParameters> &_params,
+                             InputArrayOfArrays _predictedCorners, OutputArrayOfArrays _rejectedImgPoints,
+                             InputArrayOfArrays camMatrix, InputArrayOfArrays distCoeff) {
+
+    CV_Assert(timeBudgetMs > 0);
+    return _detectMarkers(_image, _dictionary, _corners, _ids, _params, _rejectedImgPoints, camMatrix, distCoeff,
+                          timeBudgetMs, _predictedCorners);
 }
 
 /**
@@ -1105,15 +1676,14 @@ void getBoardObjectAndImagePoints(const Ptr<Board> &board, InputArrayOfArrays de
     imgPnts.reserve(nDetectedMarkers);
 
     // look for detected markers that belong to the board and get their information
+    const int *ids = detectedIds.getMat().ptr< int >(0);
     for(unsigned int i = 0; i < nDetectedMarkers; i++) {
-        int currentId = detectedIds.getMat().ptr< int >(0)[i];
-        for(unsigned int j = 0; j < board->ids.size(); j++) {
-            if(currentId == board->ids[j]) {
-                for(int p = 0; p < 4; p++) {
-                    objPnts.push_back(board->objPoints[j][p]);
-                    imgPnts.push_back(detectedCorners.getMat(i).ptr< Point2f >(0)[p]);
-                }
-            }
+        int j = board->getMarkerIndex(ids[i]);
+        if(j < 0) continue;
+        const Point2f *corners = detectedCorners.getMat(i).ptr< Point2f >(0);
+        for(int p = 0; p < 4; p++) {
+            objPnts.push_back(board->objPoints[j][p]);
+            imgPnts.push_back(corners[p]);
         }
     }
 
@@ -1145,17 +1715,11 @@ static void _projectUndetectedMarkers(const Ptr<Board> &_board, InputOutputArray
     // search undetected markers and project them using the previous pose
     vector< vector< Point2f > > undetectedCorners;
     vector< int > undetectedIds;
+    vector< int > detectionIdx;
+    _board->getDetectedMarkerIndices(_detectedIds, detectionIdx);
     for(unsigned int i = 0; i < _board->ids.size(); i++) {
-        int foundIdx = -1;
-        for(unsigned int j = 0; j < _detectedIds.total(); j++) {
-            if(_board->ids[i] == _detectedIds.getMat().ptr< int >()[j]) {
-                foundIdx = j;
-                break;
-            }
-        }
-
         // not detected
-        if(foundIdx == -1) {
+        if(detectionIdx[i] == -1) {
             undetectedCorners.push_back(vector< Point2f >());
             undetectedIds.push_back(_board->ids[i]);
             projectPoints(_board->objPoints[i], rvec, tvec, _cameraMatrix, _distCoeffs,
@@ -1198,20 +1762,19 @@ static void _projectUndetectedMarkers(const Ptr<Board> &_board, InputOutputArray
                                                         // missing markers in different vectors
     vector< int > undetectedMarkersIds; // ids of missing markers
     // find markers included in board, and missing markers from board. Fill the previous vectors
+    vector< int > detectionIdx;
+    _board->getDetectedMarkerIndices(_detectedIds, detectionIdx);
     for(unsigned int j = 0; j < _board->ids.size(); j++) {
-        bool found = false;
-        for(unsigned int i = 0; i < _detectedIds.total(); i++) {
-            if(_detectedIds.getMat().ptr< int >()[i] == _board->ids[j]) {
-                for(int c = 0; c < 4; c++) {
-                    imageCornersAll.push_back(_detectedCorners.getMat(i).ptr< Point2f >()[c]);
-                    detectedMarkersObj2DAll.push_back(
-                        Point2f(_board->objPoints[j][c].x, _board->objPoints[j][c].y));
-                }
-                found = true;
-                break;
+        int i = detectionIdx[j];
+        if(i != -1) {
+            const Point2f *corners = _detectedCorners.getMat(i).ptr< Point2f >();
+            for(int c = 0; c < 4; c++) {
+                imageCornersAll.push_back(corners[c]);
+                detectedMarkersObj2DAll.push_back(
+                    Point2f(_board->objPoints[j][c].x, _board->objPoints[j][c].y));
             }
         }
-        if(!found) {
+        else {
             undetectedMarkersObj2D.push_back(vector< Point2f >());
             for(int c = 0; c < 4; c++) {
                 undetectedMarkersObj2D.back().push_back(
@@ -1237,6 +1800,25 @@ static void _projectUndetectedMarkers(const Ptr<Board> &_board, InputOutputArray
 
 
 
+/**
+  * Pair of an undetected board marker and a rejected candidate close enough to be a match
+  */
+struct _RefineMatch {
+    int marker;      // index in the undetected markers
+    int candidate;   // index in the rejected candidates
+    int rotation;    // candidate corner matching the first marker corner
+    double distance; // maximum squared distance between corresponding corners
+    bool codeValid;
+};
+
+static bool _refineMatchLess(const _RefineMatch &a, const _RefineMatch &b) {
+    if(a.marker != b.marker) return a.marker < b.marker;
+    if(a.distance != b.distance) return a.distance < b.distance;
+    return a.candidate < b.candidate;
+}
+
+
+
 /**
   */
 void refineDetectedMarkers(InputArray _image, const Ptr<Board> &_board,
@@ -1266,8 +1848,22 @@ void refineDetectedMarkers(InputArray _image, const Ptr<Board> &_board,
                                   undetectedMarkersIds);
     }
 
+    // corners of the rejected candidates, extracted once
+    size_t nRejected = _rejectedCorners.total();
+    vector< Point2f > rejectedCorners(4 * nRejected);
+    vector< Point2f > rejectedCenters(nRejected);
+    for(unsigned int j = 0; j < nRejected; j++) {
+        const Point2f *corners = _rejectedCorners.getMat(j).ptr< Point2f >();
+        Point2f center(0, 0);
+        for(int c = 0; c < 4; c++) {
+            rejectedCorners[4 * j + c] = corners[c];
+            center += corners[c];
+        }
+        rejectedCenters[j] = center * 0.25f;
+    }
+
     // list of missing markers indicating if they have been assigned to a candidate
-    vector< bool > alreadyIdentified(_rejectedCorners.total(), false);
+    vector< bool > alreadyIdentified(nRejected, false);
 
     // maximum bits that can be corrected
     Dictionary &dictionary = *(_board->dictionary);
@@ -1289,104 +1885,127 @@ void refineDetectedMarkers(InputArray _image, const Ptr<Board> &_board,
     }
     vector< int > recoveredIdxs; // original indexes of accepted markers in _rejectedCorners
 
-    // for each missing marker, try to find a correspondence
-    for(unsigned int i = 0; i < undetectedMarkersIds.size(); i++) {
+    // if all the corners of a candidate are within the distance of the projected marker corners,
+    // so is its center, so only the candidates in the grid cells around the projected center are
+    // compared
+    double maxDistance = minRepDistance * minRepDistance + 1;
+    _CandidateGrid grid(rejectedCenters, sqrt(maxDistance));
 
-        // best match at the moment
-        int closestCandidateIdx = -1;
-        double closestCandidateDistance = minRepDistance * minRepDistance + 1;
-        Mat closestRotatedMarker;
+    vector< _RefineMatch > matches;
+    vector< int > neighbours;
+    for(unsigned int i = 0; i < undetectedMarkersIds.size(); i++) {
+        const vector< Point2f > &projected = undetectedMarkersCorners[i];
+        neighbours.clear();
+        grid.query((projected[0] + projected[1] + projected[2] + projected[3]) * 0.25f, neighbours);
 
-        for(unsigned int j = 0; j < _rejectedCorners.total(); j++) {
-            if(alreadyIdentified[j]) continue;
+        for(size_t n = 0; n < neighbours.size(); n++) {
+            int j = neighbours[n];
 
-            // check distance
-            double minDistance = closestCandidateDistance + 1;
-            bool valid = false;
-            int validRot = 0;
-            for(int c = 0; c < 4; c++) { // first corner in rejected candidate
+            // check distance for each possible first corner of the candidate
+            _RefineMatch match;
+            match.distance = maxDistance;
+            match.rotation = -1;
+            for(int c = 0; c < 4; c++) {
                 double currentMaxDistance = 0;
                 for(int k = 0; k < 4; k++) {
-                    Point2f rejCorner = _rejectedCorners.getMat(j).ptr< Point2f >()[(c + k) % 4];
-                    Point2f distVector = undetectedMarkersCorners[i][k] - rejCorner;
+                    Point2f distVector = projected[k] - rejectedCorners[4 * j + (c + k) % 4];
                     double cornerDist = distVector.x * distVector.x + distVector.y * distVector.y;
                     currentMaxDistance = max(currentMaxDistance, cornerDist);
                 }
-                // if distance is better than current best distance
-                if(currentMaxDistance < closestCandidateDistance) {
-                    valid = true;
-                    validRot = c;
-                    minDistance = currentMaxDistance;
+                if(currentMaxDistance < match.distance) {
+                    match.distance = currentMaxDistance;
+                    match.rotation = c;
                 }
                 if(!checkAllOrders) break;
             }
+            if(match.rotation < 0) continue;
 
-            if(!valid) continue;
+            match.marker = i;
+            match.candidate = j;
+            match.codeValid = true;
+            matches.push_back(match);
+        }
+    }
 
-            // apply rotation
-            Mat rotatedMarker;
-            if(checkAllOrders) {
-                rotatedMarker = Mat(4, 1, CV_32FC2);
+    // last filter, check if inner code is close enough to the assigned marker code.
+    // if errorCorrectionRate < 0, dont check code
+    if(errorCorrectionRate >= 0) {
+        parallel_for_(Range(0, (int)matches.size()), [&](const Range &range) {
+            for(int m = range.start; m < range.end; m++) {
+                _RefineMatch &match = matches[m];
+                Mat rotatedMarker(4, 1, CV_32FC2);
                 for(int c = 0; c < 4; c++)
                     rotatedMarker.ptr< Point2f >()[c] =
-                        _rejectedCorners.getMat(j).ptr< Point2f >()[(c + 4 + validRot) % 4];
-            }
-            else rotatedMarker = _rejectedCorners.getMat(j);
-
-            // last filter, check if inner code is close enough to the assigned marker code
-            int codeDistance = 0;
-            // if errorCorrectionRate, dont check code
-            if(errorCorrectionRate >= 0) {
+                        rejectedCorners[4 * match.candidate + (c + match.rotation) % 4];
 
                 // extract bits
-                Mat bits = _extractBits(
-                    grey, rotatedMarker, dictionary.markerSize, params.markerBorderBits,
-                    params.perspectiveRemovePixelPerCell,
-                    params.perspectiveRemoveIgnoredMarginPerCell, params.minOtsuStdDev);
+                Mat bits = _extractBits(grey, rotatedMarker, dictionary.markerSize, params);
 
                 Mat onlyBits =
                     bits.rowRange(params.markerBorderBits, bits.rows - params.markerBorderBits)
                         .colRange(params.markerBorderBits, bits.rows - params.markerBorderBits);
 
-                codeDistance =
-                    dictionary.getDistanceToId(onlyBits, undetectedMarkersIds[i], false);
+                int codeDistance =
+                    dictionary.getDistanceToId(onlyBits, undetectedMarkersIds[match.marker], false);
+                match.codeValid = codeDistance < maxCorrectionRecalculated;
             }
+        });
+    }
 
-            // if everythin is ok, assign values to current best match
-            if(errorCorrectionRate < 0 || codeDistance < maxCorrectionRecalculated) {
-                closestCandidateIdx = j;
-                closestCandidateDistance = minDistance;
-                closestRotatedMarker = rotatedMarker;
+    // for each missing marker, in order, take the closest valid candidate not taken yet
+    std::sort(matches.begin(), matches.end(), _refineMatchLess);
+    for(size_t m = 0; m < matches.size();) {
+        int marker = matches[m].marker;
+        int closestCandidateIdx = -1;
+        int closestRotation = 0;
+        for(; m < matches.size() && matches[m].marker == marker; m++) {
+            if(closestCandidateIdx < 0 && matches[m].codeValid &&
+               !alreadyIdentified[matches[m].candidate]) {
+                closestCandidateIdx = matches[m].candidate;
+                closestRotation = matches[m].rotation;
             }
         }
 
         // if at least one good match, we have rescue the missing marker
         if(closestCandidateIdx >= 0) {
-
-            // subpixel refinement
-            if(_params->cornerRefinementMethod == CORNER_REFINE_SUBPIX) {
-                CV_Assert(params.cornerRefinementWinSize > 0 &&
-                          params.cornerRefinementMaxIterations > 0 &&
-                          params.cornerRefinementMinAccuracy > 0);
-                cornerSubPix(grey, closestRotatedMarker,
-                             Size(params.cornerRefinementWinSize, params.cornerRefinementWinSize),
-                             Size(-1, -1), TermCriteria(TermCriteria::MAX_ITER | TermCriteria::EPS,
-                                                        params.cornerRefinementMaxIterations,
-                                                        params.cornerRefinementMinAccuracy));
-            }
+            Mat closestRotatedMarker(4, 1, CV_32FC2);
+            for(int c = 0; c < 4; c++)
+                closestRotatedMarker.ptr< Point2f >()[c] =
+                    rejectedCorners[4 * closestCandidateIdx + (c + closestRotation) % 4];
 
             // remove from rejected
             alreadyIdentified[closestCandidateIdx] = true;
 
             // add to detected
             finalAcceptedCorners.push_back(closestRotatedMarker);
-            finalAcceptedIds.push_back(undetectedMarkersIds[i]);
+            finalAcceptedIds.push_back(undetectedMarkersIds[marker]);
 
             // add the original index of the candidate
             recoveredIdxs.push_back(closestCandidateIdx);
         }
     }
 
+    // subpixel refinement of all the recovered markers
+    size_t nRecovered = recoveredIdxs.size();
+    if(_params->cornerRefinementMethod == CORNER_REFINE_SUBPIX && nRecovered > 0) {
+        CV_Assert(params.cornerRefinementWinSize > 0 &&
+                  params.cornerRefinementMaxIterations > 0 &&
+                  params.cornerRefinementMinAccuracy > 0);
+        size_t firstRecovered = finalAcceptedCorners.size() - nRecovered;
+        vector< Point2f > recoveredCorners(4 * nRecovered);
+        for(size_t i = 0; i < nRecovered; i++)
+            for(int c = 0; c < 4; c++)
+                recoveredCorners[4 * i + c] = finalAcceptedCorners[firstRecovered + i].ptr< Point2f >()[c];
+        refineCornersSubPix(grey, recoveredCorners,
+                            vector< Size >(1, Size(params.cornerRefinementWinSize, params.cornerRefinementWinSize)),
+                            TermCriteria(TermCriteria::MAX_ITER | TermCriteria::EPS,
+                                         params.cornerRefinementMaxIterations,
+                                         params.cornerRefinementMinAccuracy));
+        for(size_t i = 0; i < nRecovered; i++)
+            for(int c = 0; c < 4; c++)
+                finalAcceptedCorners[firstRecovered + i].ptr< Point2f >()[c] = recoveredCorners[4 * i + c];
+    }
+
     // parse output
     if(finalAcceptedIds.size() != _detectedIds.total()) {
         _detectedCorners.clear();
@@ -1405,10 +2024,10 @@ void refineDetectedMarkers(InputArray _image, const Ptr<Board> &_board,
         }
 
         // recalculate _rejectedCorners based on alreadyIdentified
-        vector< Mat > finalRejected;
+        vector< int > finalRejected;
         for(unsigned int i = 0; i < alreadyIdentified.size(); i++) {
             if(!alreadyIdentified[i]) {
-                finalRejected.push_back(_rejectedCorners.getMat(i).clone());
+                finalRejected.push_back(i);
             }
         }
 
@@ -1418,7 +2037,7 @@ void refineDetectedMarkers(InputArray _image, const Ptr<Board> &_board,
             _rejectedCorners.create(4, 1, CV_32FC2, i, true);
             for(int j = 0; j < 4; j++) {
                 _rejectedCorners.getMat(i).ptr< Point2f >()[j] =
-                    finalRejected[i].ptr< Point2f >()[j];
+                    rejectedCorners[4 * finalRejected[i] + j];
             }
         }
 
@@ -1456,6 +2075,162 @@ int estimatePoseBoard(InputArrayOfArrays _corners, InputArray _ids, const Ptr<Bo
 
 
 
+/**
+  */
+BoardPoseTracker::BoardPoseTracker()
+    : maxGatingError(10.),
+      maxRmsError(3.),
+      ransacReprojectionError(5.),
+      ransacIterations(100),
+      _hasPose(false) {}
+
+
+/**
+  */
+Ptr<BoardPoseTracker> BoardPoseTracker::create() {
+    Ptr<BoardPoseTracker> tracker = makePtr<BoardPoseTracker>();
+    return tracker;
+}
+
+
+/**
+  */
+void BoardPoseTracker::reset() {
+    _hasPose = false;
+}
+
+
+/**
+  * RMS reprojection error of the selected correspondences
+  */
+static double _getRmsReprojectionError(const vector< Point3f > &objPoints, const vector< Point2f > &imgPoints,
+                                       const vector< int > &selected, InputArray cameraMatrix,
+                                       InputArray distCoeffs, const Vec3d &rvec, const Vec3d &tvec) {
+    if(selected.empty()) return DBL_MAX;
+    vector< Point3f > obj(selected.size());
+    for(size_t i = 0; i < selected.size(); i++)
+        obj[i] = objPoints[selected[i]];
+    vector< Point2f > projected;
+    projectPoints(obj, rvec, tvec, cameraMatrix, distCoeffs, projected);
+    double sqSum = 0;
+    for(size_t i = 0; i < selected.size(); i++) {
+        Point2f d = projected[i] - imgPoints[selected[i]];
+        sqSum += d.x * d.x + d.y * d.y;
+    }
+    return sqrt(sqSum / selected.size());
+}
+
+
+/**
+  */
+int BoardPoseTracker::update(InputArray _objPoints, InputArray _imgPoints, int pointsPerGroup,
+                             InputArray _cameraMatrix, InputArray _distCoeffs, OutputArray _rvec,
+                             OutputArray _tvec) {
+
+    CV_Assert(pointsPerGroup > 0);
+    vector< Point3f > objPoints;
+    vector< Point2f > imgPoints;
+    _objPoints.getMat().reshape(3, 1).convertTo(objPoints, CV_32F);
+    _imgPoints.getMat().reshape(2, 1).convertTo(imgPoints, CV_32F);
+    CV_Assert(objPoints.size() == imgPoints.size() && objPoints.size() % pointsPerGroup == 0);
+
+    int nGroups = (int)objPoints.size() / pointsPerGroup;
+    vector< int > used; // indexes of the correspondences of the accepted pose
+    Vec3d rvec, tvec;
+    bool accepted = false;
+
+    if(_hasPose) {
+        // gate the correspondences with the previous pose
+        vector< Point2f > projected;
+        projectPoints(objPoints, _lastRvec, _lastTvec, _cameraMatrix, _distCoeffs, projected);
+        for(int g = 0; g < nGroups; g++) {
+            double error = 0;
+            for(int p = g * pointsPerGroup; p < (g + 1) * pointsPerGroup; p++)
+                error += norm(projected[p] - imgPoints[p]);
+            if(error / pointsPerGroup > maxGatingError) continue;
+            for(int p = g * pointsPerGroup; p < (g + 1) * pointsPerGroup; p++)
+                used.push_back(p);
+        }
+
+        // refine the previous pose with the remaining correspondences
+        if(used.size() >= 4) {
+            vector< Point3f > obj(used.size());
+            vector< Point2f > img(used.size());
+            for(size_t i = 0; i < used.size(); i++) {
+                obj[i] = objPoints[used[i]];
+                img[i] = imgPoints[used[i]];
+            }
+            rvec = _lastRvec;
+            tvec = _lastTvec;
+            solvePnP(obj, img, _cameraMatrix, _distCoeffs, rvec, tvec, true);
+            accepted = _getRmsReprojectionError(objPoints, imgPoints, used, _cameraMatrix, _distCoeffs,
+                                                rvec, tvec) < maxRmsError;
+        }
+    }
+    else if(objPoints.size() >= 4) {
+        // no previous pose, solve with all the correspondences
+        used.resize(objPoints.size());
+        for(size_t i = 0; i < used.size(); i++)
+            used[i] = (int)i;
+        solvePnP(objPoints, imgPoints, _cameraMatrix, _distCoeffs, rvec, tvec, false);
+        accepted = _getRmsReprojectionError(objPoints, imgPoints, used, _cameraMatrix, _distCoeffs,
+                                            rvec, tvec) < maxRmsError;
+    }
+
+    // fallback, robust solve from scratch
+    if(!accepted && objPoints.size() >= 4) {
+        vector< int > inliers;
+        accepted = solvePnPRansac(objPoints, imgPoints, _cameraMatrix, _distCoeffs, rvec, tvec, false,
+                                  ransacIterations, (float)ransacReprojectionError, 0.99, inliers);
+        used = inliers;
+        std::sort(used.begin(), used.end());
+        accepted = accepted && used.size() >= 4 &&
+                   _getRmsReprojectionError(objPoints, imgPoints, used, _cameraMatrix, _distCoeffs,
+                                            rvec, tvec) < maxRmsError;
+    }
+
+    if(!accepted) {
+        reset();
+        return 0;
+    }
+
+    _hasPose = true;
+    _lastRvec = rvec;
+    _lastTvec = tvec;
+    Mat(rvec).copyTo(_rvec);
+    Mat(tvec).copyTo(_tvec);
+
+    // number of groups with at least one used correspondence, used is sorted
+    int usedGroups = 0;
+    for(size_t i = 0; i < used.size(); i++) {
+        if(i == 0 || used[i] / pointsPerGroup != used[i - 1] / pointsPerGroup) usedGroups++;
+    }
+    return usedGroups;
+}
+
+
+/**
+  */
+int trackPoseBoard(InputArrayOfArrays _corners, InputArray _ids, const Ptr<Board> &board,
+                   InputArray _cameraMatrix, InputArray _distCoeffs,
+                   const Ptr<BoardPoseTracker> &tracker, OutputArray _rvec, OutputArray _tvec) {
+
+    CV_Assert(_corners.total() == _ids.total());
+
+    Mat objPoints, imgPoints;
+    getBoardObjectAndImagePoints(board, _corners, _ids, objPoints, imgPoints);
+
+    if(objPoints.total() == 0) { // 0 of the detected markers in board
+        tracker->reset();
+        return 0;
+    }
+
+    // the four corners of each marker are gated together
+    return tracker->update(objPoints, imgPoints, 4, _cameraMatrix, _distCoeffs, _rvec, _tvec);
+}
+
+
+
 
 /**
  */
@@ -1490,9 +2265,82 @@ Ptr<Board> Board::create(InputArrayOfArrays objPoints, const Ptr<Dictionary> &di
     ids.copyTo(res->ids);
     res->objPoints = obj_points_vector;
     res->dictionary = cv::makePtr<Dictionary>(dictionary);
+    res->updateIdIndex();
     return res;
 }
 
+/**
+  * Table from marker id to its first index in the ids of a board. Dense when the ids are compact,
+  * as in the boards of the create functions, hashed otherwise
+  */
+struct Board::IdIndex {
+    int minId;
+    vector< int > table; // table[id - minId], -1 if id is not in the board
+    std::unordered_map< int, int > map; // used when table is empty
+
+    explicit IdIndex(const vector< int > &ids) : minId(0) {
+        if(ids.empty()) return;
+        int maxId = ids[0];
+        minId = ids[0];
+        for(size_t i = 1; i < ids.size(); i++) {
+            minId = min(minId, ids[i]);
+            maxId = max(maxId, ids[i]);
+        }
+        if((int64)maxId - minId < 2 * (int64)ids.size() + 64) {
+            table.assign(maxId - minId + 1, -1);
+            for(size_t i = 0; i < ids.size(); i++) {
+                if(table[ids[i] - minId] == -1) table[ids[i] - minId] = (int)i;
+            }
+        } else {
+            map.reserve(ids.size());
+            for(size_t i = 0; i < ids.size(); i++)
+                map.insert(std::make_pair(ids[i], (int)i));
+        }
+    }
+
+    int find(int id) const {
+        if(!table.empty()) {
+            if(id < minId || (int64)id - minId >= (int64)table.size()) return -1;
+            return table[id - minId];
+        }
+        std::unordered_map< int, int >::const_iterator it = map.find(id);
+        return it == map.end() ? -1 : it->second;
+    }
+};
+
+/**
+ */
+void Board::updateIdIndex() {
+    // a new table, the old one may be shared with copies of the board
+    idIndex = makePtr<IdIndex>(ids);
+}
+
+/**
+ */
+int Board::getMarkerIndex(int id) const {
+    int idx = idIndex.empty() ? -1 : idIndex->find(id);
+    if(idx >= 0 && idx < (int)ids.size() && ids[idx] == id) return idx;
+    // ids was modified after the table was built and the marker moved or was removed
+    if(idx >= 0 || idIndex.empty()) {
+        for(size_t i = 0; i < ids.size(); i++)
+            if(ids[i] == id) return (int)i;
+    }
+    return -1;
+}
+
+/**
+ */
+void Board::getDetectedMarkerIndices(InputArray detectedIds, vector< int > &detectionIdx) const {
+    detectionIdx.assign(ids.size(), -1);
+    Mat detected = detectedIds.getMat();
+    CV_Assert(detected.total() == 0 || detected.isContinuous());
+    const int *detectedPtr = detected.ptr< int >();
+    for(int i = 0; i < (int)detected.total(); i++) {
+        int boardIdx = getMarkerIndex(detectedPtr[i]);
+        if(boardIdx >= 0 && detectionIdx[boardIdx] == -1) detectionIdx[boardIdx] = i;
+    }
+}
+
 /**
  */
 Ptr<GridBoard> GridBoard::create(int markersX, int markersY, float markerLength, float markerSeparation,
@@ -1532,6 +2380,7 @@ Ptr<GridBoard> GridBoard::create(int markersX, int markersY, float markerLength,
         }
     }
 
+    res->updateIdIndex();
     return res;
 }
 
@@ -0,0 +1,709 @@
+/*
+By downloading, copying, installing or using the software you agree to this
+license. If you do not agree to this license, do not download, install,
+copy or use the software.
+
+                          License Agreement
+               For Open Source Computer Vision Library
+                       (3-clause BSD License)
+
+Copyright (C) 2013, OpenCV Foundation, all rights reserved.
+Third party copyrights are property of their respective owners.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice,
+    this list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the names of the copyright holders nor the names of the contributors
+    may be used to endorse or promote products derived from this software
+    without specific prior written permission.
+
+This software is provided by the copyright holders and contributors "as is" and
+any express or implied warranties, including, but not limited to, the implied
+warranties of merchantability and fitness for a particular purpose are
+disclaimed. In no event shall copyright holders or contributors be liable for
+any direct, indirect, incidental, special, exemplary, or consequential damages
+(including, but not limited to, procurement of substitute goods or services;
+loss of use, data, or profits; or business interruption) however caused
+and on any theory of liability, whether in contract, strict liability,
+or tort (including negligence or otherwise) arising in any way out of
+the use of this software, even if advised of the possibility of such damage.
+*/
+
+
+#include "precomp.hpp"
+#include "opencv2/aruco/charuco.hpp"
+#include <opencv2/core.hpp>
+#include <opencv2/calib3d.hpp>
+#include <cfloat>
+
+
+namespace cv {
+namespace aruco {
+
+using namespace std;
+
+
+
+/**
+  * Copy a list of matrices to an output array of arrays
+  */
+static void _copyToArrays(const vector< Mat > &mats, int type, OutputArrayOfArrays _out) {
+    _out.create((int)mats.size(), 1, type);
+    for(unsigned int i = 0; i < mats.size(); i++) {
+        _out.create(mats[i].size(), type, i, true);
+        Mat dst = _out.getMat(i);
+        mats[i].copyTo(dst);
+    }
+}
+
+
+
+/**
+  * Object points of the charuco corners with the given ids
+  */
+static void _getCharucoObjectPoints(const Mat &ids, const Ptr<CharucoBoard> &board,
+                                    vector< Point3f > &objPoints) {
+    objPoints.resize(ids.total());
+    for(unsigned int i = 0; i < ids.total(); i++) {
+        int id = ids.ptr< int >()[i];
+        CV_Assert(id >= 0 && id < (int)board->chessboardCorners.size());
+        objPoints[i] = board->chessboardCorners[id];
+    }
+}
+
+
+
+/**
+ */
+CalibrationViewSelector::CalibrationViewSelector(Size imageSize, int maxViews, int gridSize)
+    : _imageSize(imageSize), _maxViews(maxViews), _gridSize(gridSize) {
+
+    CV_Assert(imageSize.width > 0 && imageSize.height > 0);
+    CV_Assert(maxViews >= 2 && gridSize > 0);
+
+    _cellCount.assign(gridSize * gridSize, 0);
+    _poseDistance.assign(maxViews * maxViews, 0);
+
+    // rough camera until setCamera() is called
+    double f = max(imageSize.width, imageSize.height);
+    _cameraMatrix = (Mat_< double >(3, 3) << f, 0, 0.5 * imageSize.width,
+                                             0, f, 0.5 * imageSize.height,
+                                             0, 0, 1);
+}
+
+
+/**
+ */
+Ptr<CalibrationViewSelector> CalibrationViewSelector::create(Size imageSize, int maxViews,
+                                                             int gridSize) {
+    Ptr<CalibrationViewSelector> selector = makePtr<CalibrationViewSelector>(imageSize, maxViews,
+                                                                             gridSize);
+    return selector;
+}
+
+
+/**
+ */
+void CalibrationViewSelector::setCamera(InputArray cameraMatrix, InputArray distCoeffs) {
+    CV_Assert(cameraMatrix.total() == 9);
+    _cameraMatrix = cameraMatrix.getMat().clone();
+    _distCoeffs = distCoeffs.getMat().clone();
+}
+
+
+/**
+ */
+bool CalibrationViewSelector::addView(InputArray objPoints, InputArray imgPoints, int viewId) {
+    CV_Assert(objPoints.type() == CV_32FC3 && imgPoints.type() == CV_32FC2);
+    CV_Assert(objPoints.total() == imgPoints.total());
+
+    View view;
+    view.id = viewId;
+    objPoints.getMat().copyTo(view.objPoints);
+    imgPoints.getMat().copyTo(view.imgPoints);
+    return _addView(view);
+}
+
+
+/**
+ */
+bool CalibrationViewSelector::addCharucoView(InputArray charucoCorners, InputArray charucoIds,
+                                             const Ptr<CharucoBoard> &board, int viewId) {
+    CV_Assert(charucoCorners.type() == CV_32FC2 && charucoIds.type() == CV_32SC1);
+    CV_Assert(charucoCorners.total() == charucoIds.total());
+
+    Mat ids = charucoIds.getMat();
+    vector< Point3f > objPoints;
+    _getCharucoObjectPoints(ids, board, objPoints);
+
+    View view;
+    view.id = viewId;
+    Mat(objPoints).copyTo(view.objPoints);
+    charucoCorners.getMat().copyTo(view.imgPoints);
+    ids.copyTo(view.charucoIds);
+    return _addView(view);
+}
+
+
+/**
+  * Pose distance between two views: angle between the board normals plus difference of the
+  * logarithms of the board distances
+  */
+double CalibrationViewSelector::_getPoseDistance(const View &a, const View &b) const {
+    double cosAngle = max(-1., min(1., a.normal.dot(b.normal)));
+    return acos(cosAngle) + std::abs(a.logDistance - b.logDistance);
+}
+
+
+/**
+  * Update the distances from a new or replaced view and the two most similar views of each view
+  */
+void CalibrationViewSelector::_updateNeighbours(int changedView) {
+    int nViews = (int)_views.size();
+    for(int k = 0; k < nViews; k++) {
+        double distance = k == changedView ? 0 : _getPoseDistance(_views[changedView], _views[k]);
+        _poseDistance[changedView * _maxViews + k] = distance;
+        _poseDistance[k * _maxViews + changedView] = distance;
+    }
+
+    _nearest.assign(nViews, -1);
+    _secondNearest.assign(nViews, -1);
+    _nearestDistance.assign(nViews, DBL_MAX);
+    _secondNearestDistance.assign(nViews, DBL_MAX);
+    for(int k = 0; k < nViews; k++) {
+        for(int j = 0; j < nViews; j++) {
+            if(j == k) continue;
+            double distance = _poseDistance[k * _maxViews + j];
+            if(distance < _nearestDistance[k]) {
+                _secondNearest[k] = _nearest[k];
+                _secondNearestDistance[k] = _nearestDistance[k];
+                _nearest[k] = j;
+                _nearestDistance[k] = distance;
+            } else if(distance < _secondNearestDistance[k]) {
+                _secondNearest[k] = j;
+                _secondNearestDistance[k] = distance;
+            }
+        }
+    }
+}
+
+
+/**
+ */
+bool CalibrationViewSelector::_addView(View &view) {
+    if(view.objPoints.total() < 4) return false;
+
+    // approximated board pose
+    Vec3d rvec, tvec;
+    if(!solvePnP(view.objPoints, view.imgPoints, _cameraMatrix, _distCoeffs, rvec, tvec))
+        return false;
+    double distance = norm(tvec);
+    if(!(distance > 0)) return false; // also rejects NaN poses
+    Matx33d R;
+    Rodrigues(rvec, R);
+    view.normal = Vec3d(R(0, 2), R(1, 2), R(2, 2));
+    view.logDistance = log(distance);
+
+    // grid cells covered by the view
+    vector< uchar > inView(_cellCount.size(), 0);
+    const Point2f *points = view.imgPoints.ptr< Point2f >();
+    for(unsigned int i = 0; i < view.imgPoints.total(); i++) {
+        int cx = cvFloor(points[i].x * _gridSize / _imageSize.width);
+        int cy = cvFloor(points[i].y * _gridSize / _imageSize.height);
+        int cell = min(max(cy, 0), _gridSize - 1) * _gridSize + min(max(cx, 0), _gridSize - 1);
+        if(inView[cell]) continue;
+        inView[cell] = 1;
+        view.cells.push_back(cell);
+    }
+
+    int nViews = (int)_views.size();
+    int slot = nViews;
+    if(nViews == _maxViews) {
+        // the set is full, find the view whose replacement improves it the most
+        int covered = 0, gained = 0;
+        for(size_t c = 0; c < _cellCount.size(); c++)
+            if(_cellCount[c] > 0) covered++;
+        for(size_t c = 0; c < view.cells.size(); c++)
+            if(_cellCount[view.cells[c]] == 0) gained++;
+        double diversity = 0;
+        vector< double > newDistance(nViews);
+        for(int k = 0; k < nViews; k++) {
+            diversity += _nearestDistance[k];
+            newDistance[k] = _getPoseDistance(view, _views[k]);
+        }
+
+        int bestCovered = covered;
+        double bestDiversity = diversity;
+        slot = -1;
+        for(int r = 0; r < nViews; r++) {
+            int lost = 0;
+            for(size_t c = 0; c < _views[r].cells.size(); c++) {
+                int cell = _views[r].cells[c];
+                if(_cellCount[cell] == 1 && !inView[cell]) lost++;
+            }
+            int newCovered = covered - lost + gained;
+            if(newCovered < bestCovered) continue;
+
+            // the most similar view of each remaining view is the new one, or its nearest or
+            // second nearest if the nearest is the replaced one
+            double newDiversity = 0, newNearest = DBL_MAX;
+            for(int k = 0; k < nViews; k++) {
+                if(k == r) continue;
+                double nearest = _nearest[k] != r ? _nearestDistance[k] : _secondNearestDistance[k];
+                newDiversity += min(nearest, newDistance[k]);
+                newNearest = min(newNearest, newDistance[k]);
+            }
+            newDiversity += newNearest;
+
+            if(newCovered > bestCovered || newDiversity > bestDiversity) {
+                bestCovered = newCovered;
+                bestDiversity = newDiversity;
+                slot = r;
+            }
+        }
+        if(slot < 0) return false;
+
+        for(size_t c = 0; c < _views[slot].cells.size(); c++)
+            _cellCount[_views[slot].cells[c]]--;
+        _views[slot] = view;
+    } else {
+        _views.push_back(view);
+    }
+
+    for(size_t c = 0; c < view.cells.size(); c++)
+        _cellCount[view.cells[c]]++;
+    _updateNeighbours(slot);
+    return true;
+}
+
+
+/**
+ */
+vector< int > CalibrationViewSelector::getViewIds() const {
+    vector< int > ids(_views.size());
+    for(unsigned int i = 0; i < _views.size(); i++)
+        ids[i] = _views[i].id;
+    return ids;
+}
+
+
+/**
+ */
+void CalibrationViewSelector::getViews(OutputArrayOfArrays objPoints,
+                                       OutputArrayOfArrays imgPoints) const {
+    vector< Mat > allObjPoints(_views.size()), allImgPoints(_views.size());
+    for(unsigned int i = 0; i < _views.size(); i++) {
+        allObjPoints[i] = _views[i].objPoints;
+        allImgPoints[i] = _views[i].imgPoints;
+    }
+    _copyToArrays(allObjPoints, CV_32FC3, objPoints);
+    _copyToArrays(allImgPoints, CV_32FC2, imgPoints);
+}
+
+
+/**
+ */
+void CalibrationViewSelector::getCharucoViews(OutputArrayOfArrays charucoCorners,
+                                              OutputArrayOfArrays charucoIds) const {
+    vector< Mat > allCorners(_views.size()), allIds(_views.size());
+    for(unsigned int i = 0; i < _views.size(); i++) {
+        CV_Assert(!_views[i].charucoIds.empty());
+        allCorners[i] = _views[i].imgPoints;
+        allIds[i] = _views[i].charucoIds;
+    }
+    _copyToArrays(allCorners, CV_32FC2, charucoCorners);
+    _copyToArrays(allIds, CV_32SC1, charucoIds);
+}
+
+
+/**
+ */
+double CalibrationViewSelector::getCoverage() const {
+    int covered = 0;
+    for(size_t c = 0; c < _cellCount.size(); c++)
+        if(_cellCount[c] > 0) covered++;
+    return double(covered) / double(_cellCount.size());
+}
+
+
+/**
+ */
+double CalibrationViewSelector::getPoseDiversity() const {
+    if(_views.size() < 2) return 0;
+    double diversity = 0;
+    for(size_t k = 0; k < _views.size(); k++)
+        diversity += _nearestDistance[k];
+    return diversity / double(_views.size());
+}
+
+
+
+/**
+  * Camera matrix and distortion coefficients from the intrinsic parameters
+  */
+static void _getCameraMatrices(const Vec< double, 9 > &intrinsics, Matx33d &cameraMatrix,
+                               Matx< double, 5, 1 > &distCoeffs) {
+    cameraMatrix = Matx33d(intrinsics[0], 0, intrinsics[2],
+                           0, intrinsics[1], intrinsics[3],
+                           0, 0, 1);
+    for(int i = 0; i < 5; i++)
+        distCoeffs(i) = intrinsics[4 + i];
+}
+
+
+/**
+ */
+IncrementalCalibrator::IncrementalCalibrator(Size imageSize, int flags)
+    : _imageSize(imageSize), _flags(flags), _hasIntrinsics(false), _aspectRatio(1), _dirty(false),
+      _rmsError(0), _iterations(0) {
+
+    CV_Assert(imageSize.width > 0 && imageSize.height > 0);
+    const int supportedFlags = CALIB_FIX_ASPECT_RATIO | CALIB_FIX_FOCAL_LENGTH |
+                               CALIB_FIX_PRINCIPAL_POINT | CALIB_ZERO_TANGENT_DIST | CALIB_FIX_K1 |
+                               CALIB_FIX_K2 | CALIB_FIX_K3;
+    CV_Assert((flags & ~supportedFlags) == 0);
+}
+
+
+/**
+ */
+Ptr<IncrementalCalibrator> IncrementalCalibrator::create(Size imageSize, int flags) {
+    Ptr<IncrementalCalibrator> calibrator = makePtr<IncrementalCalibrator>(imageSize, flags);
+    return calibrator;
+}
+
+
+/**
+ */
+void IncrementalCalibrator::setCamera(InputArray cameraMatrix, InputArray distCoeffs) {
+    CV_Assert(cameraMatrix.total() == 9);
+    CV_Assert(distCoeffs.empty() || distCoeffs.total() >= 4);
+
+    Mat_< double > K, D;
+    cameraMatrix.getMat().convertTo(K, CV_64F);
+    K = K.reshape(1, 3);
+    _intrinsics = Vec< double, NINTRINSICS >::all(0);
+    _intrinsics[0] = K(0, 0);
+    _intrinsics[1] = K(1, 1);
+    _intrinsics[2] = K(0, 2);
+    _intrinsics[3] = K(1, 2);
+    if(!distCoeffs.empty()) {
+        distCoeffs.getMat().convertTo(D, CV_64F);
+        D = D.reshape(1, (int)D.total());
+        for(int i = 0; i < min(5, D.rows); i++)
+            _intrinsics[4 + i] = D(i);
+    }
+    if(_flags & CALIB_ZERO_TANGENT_DIST) _intrinsics[6] = _intrinsics[7] = 0;
+
+    CV_Assert(_intrinsics[0] > 0 && _intrinsics[1] > 0);
+    _aspectRatio = _intrinsics[0] / _intrinsics[1];
+    _hasIntrinsics = true;
+    _dirty = true;
+}
+
+
+/**
+ */
+int IncrementalCalibrator::addView(InputArray objPoints, InputArray imgPoints) {
+    CV_Assert(objPoints.type() == CV_32FC3 || objPoints.type() == CV_64FC3);
+    CV_Assert(imgPoints.type() == CV_32FC2 || imgPoints.type() == CV_64FC2);
+    CV_Assert(objPoints.total() == imgPoints.total() && objPoints.total() >= 4);
+
+    View view;
+    objPoints.getMat().reshape(3, (int)objPoints.total()).convertTo(view.objPoints, CV_64FC3);
+    imgPoints.getMat().reshape(2, (int)imgPoints.total()).convertTo(view.imgPoints, CV_64FC2);
+    view.hasPose = false;
+    _views.push_back(view);
+    _dirty = true;
+    return (int)_views.size() - 1;
+}
+
+
+/**
+ */
+int IncrementalCalibrator::addCharucoView(InputArray charucoCorners, InputArray charucoIds,
+                                          const Ptr<CharucoBoard> &board) {
+    CV_Assert(charucoIds.type() == CV_32SC1 && charucoCorners.total() == charucoIds.total());
+
+    vector< Point3f > objPoints;
+    _getCharucoObjectPoints(charucoIds.getMat(), board, objPoints);
+    return addView(objPoints, charucoCorners);
+}
+
+
+/**
+  * Initial intrinsics, if there are not any, and initial extrinsics of the new views
+  */
+void IncrementalCalibrator::_initialize() {
+    if(!_hasIntrinsics) {
+        // initCameraMatrix2D only takes single precision points
+        vector< Mat > allObjPoints(_views.size()), allImgPoints(_views.size());
+        for(size_t i = 0; i < _views.size(); i++) {
+            _views[i].objPoints.convertTo(allObjPoints[i], CV_32FC3);
+            _views[i].imgPoints.convertTo(allImgPoints[i], CV_32FC2);
+        }
+        double aspectRatio = (_flags & CALIB_FIX_ASPECT_RATIO) ? 1. : 0.;
+        Mat K = initCameraMatrix2D(allObjPoints, allImgPoints, _imageSize, aspectRatio);
+        setCamera(K, noArray());
+    }
+
+    Matx33d cameraMatrix;
+    Matx< double, 5, 1 > distCoeffs;
+    _getCameraMatrices(_intrinsics, cameraMatrix, distCoeffs);
+    for(size_t i = 0; i < _views.size(); i++) {
+        View &view = _views[i];
+        if(view.hasPose) continue;
+        solvePnP(view.objPoints, view.imgPoints, cameraMatrix, distCoeffs, view.rvec, view.tvec);
+        view.hasPose = true;
+    }
+}
+
+
+/**
+  * Sum of the squared reprojection errors of all the views
+  */
+double IncrementalCalibrator::_getCost(const Vec< double, NINTRINSICS > &intrinsics,
+                                       const vector< Vec3d > &rvecs,
+                                       const vector< Vec3d > &tvecs) const {
+    Matx33d cameraMatrix;
+    Matx< double, 5, 1 > distCoeffs;
+    _getCameraMatrices(intrinsics, cameraMatrix, distCoeffs);
+
+    vector< double > viewCosts(_views.size(), 0);
+    parallel_for_(Range(0, (int)_views.size()), [&](const Range &range) {
+        Mat projected;
+        for(int i = range.start; i < range.end; i++) {
+            projectPoints(_views[i].objPoints, rvecs[i], tvecs[i], cameraMatrix, distCoeffs,
+                          projected);
+            Mat diff = projected - _views[i].imgPoints;
+            viewCosts[i] = diff.dot(diff);
+        }
+    });
+
+    double cost = 0;
+    for(size_t i = 0; i < viewCosts.size(); i++)
+        cost += viewCosts[i];
+    return cost;
+}
+
+
+/**
+ */
+double IncrementalCalibrator::refine(TermCriteria criteria) {
+    if(!_dirty) return _rmsError;
+    CV_Assert(!_views.empty());
+    _initialize();
+
+    typedef Vec< double, NINTRINSICS > VecI;
+    typedef Matx< double, NINTRINSICS, NINTRINSICS > MatII;
+    typedef Matx< double, NINTRINSICS, 6 > MatIE;
+    typedef Matx< double, 6, 6 > MatEE;
+    typedef Vec< double, 6 > VecE;
+
+    int maxIterations = (criteria.type & TermCriteria::COUNT) ? criteria.maxCount : 30;
+    double epsilon = (criteria.type & TermCriteria::EPS) ? criteria.epsilon : 0;
+
+    // intrinsic parameters that are not optimized. With a fixed aspect ratio fy follows fx
+    bool fixed[NINTRINSICS] = { false };
+    if(_flags & CALIB_FIX_FOCAL_LENGTH) fixed[0] = fixed[1] = true;
+    if(_flags & CALIB_FIX_ASPECT_RATIO) fixed[1] = true;
+    if(_flags & CALIB_FIX_PRINCIPAL_POINT) fixed[2] = fixed[3] = true;
+    if(_flags & CALIB_FIX_K1) fixed[4] = true;
+    if(_flags & CALIB_FIX_K2) fixed[5] = true;
+    if(_flags & CALIB_ZERO_TANGENT_DIST) fixed[6] = fixed[7] = true;
+    if(_flags & CALIB_FIX_K3) fixed[8] = true;
+    bool followAspectRatio = (_flags & CALIB_FIX_ASPECT_RATIO) && !(_flags & CALIB_FIX_FOCAL_LENGTH);
+
+    int nViews = (int)_views.size();
+    size_t nPoints = 0;
+    vector< Vec3d > rvecs(nViews), tvecs(nViews);
+    for(int i = 0; i < nViews; i++) {
+        rvecs[i] = _views[i].rvec;
+        tvecs[i] = _views[i].tvec;
+        nPoints += _views[i].objPoints.total();
+    }
+
+    // blocks of the normal equations. U is the intrinsic block, V[i] the extrinsic block of view i
+    // and W[i] the cross term between both. The Jacobian has no terms between different views
+    vector< MatII > viewU(nViews);
+    vector< VecI > viewGradI(nViews);
+    vector< MatIE > W(nViews);
+    vector< MatEE > V(nViews);
+    vector< VecE > gradE(nViews);
+
+    double cost = _getCost(_intrinsics, rvecs, tvecs);
+    double lambda = 1e-3;
+    _iterations = 0;
+    for(int iteration = 0; iteration < maxIterations; iteration++) {
+
+        // linearize each view
+        Matx33d cameraMatrix;
+        Matx< double, 5, 1 > distCoeffs;
+        _getCameraMatrices(_intrinsics, cameraMatrix, distCoeffs);
+        parallel_for_(Range(0, nViews), [&](const Range &range) {
+            Mat projected, jacobian;
+            for(int i = range.start; i < range.end; i++) {
+                // jacobian columns: rvec, tvec, fx, fy, cx, cy, k1, k2, p1, p2, k3
+                projectPoints(_views[i].objPoints, rvecs[i], tvecs[i], cameraMatrix, distCoeffs,
+                              projected, jacobian);
+                const double *residuals = projected.ptr< double >();
+                const double *observed = _views[i].imgPoints.ptr< double >();
+
+                MatII U = MatII::zeros();
+                VecI gradI = VecI::all(0);
+                MatIE Wi = MatIE::zeros();
+                MatEE Vi = MatEE::zeros();
+                VecE gradEi = VecE::all(0);
+                for(int r = 0; r < jacobian.rows; r++) {
+                    const double *row = jacobian.ptr< double >(r);
+                    double residual = residuals[r] - observed[r];
+                    double a[NINTRINSICS];
+                    for(int k = 0; k < NINTRINSICS; k++)
+                        a[k] = row[6 + k];
+                    if(followAspectRatio) a[0] += a[1] / _aspectRatio;
+                    for(int k = 0; k < NINTRINSICS; k++)
+                        if(fixed[k]) a[k] = 0;
+
+                    for(int k = 0; k < NINTRINSICS; k++) {
+                        gradI[k] += a[k] * residual;
+                        for(int l = k; l < NINTRINSICS; l++)
+                            U(k, l) += a[k] * a[l];
+                        for(int l = 0; l < 6; l++)
+                            Wi(k, l) += a[k] * row[l];
+                    }
+                    for(int k = 0; k < 6; k++) {
+                        gradEi[k] += row[k] * residual;
+                        for(int l = k; l < 6; l++)
+                            Vi(k, l) += row[k] * row[l];
+                    }
+                }
+                for(int k = 0; k < NINTRINSICS; k++)
+                    for(int l = 0; l < k; l++)
+                        U(k, l) = U(l, k);
+                for(int k = 0; k < 6; k++)
+                    for(int l = 0; l < k; l++)
+                        Vi(k, l) = Vi(l, k);
+                viewU[i] = U;
+                viewGradI[i] = gradI;
+                W[i] = Wi;
+                V[i] = Vi;
+                gradE[i] = gradEi;
+            }
+        });
+
+        MatII U = MatII::zeros();
+        VecI gradI = VecI::all(0);
+        for(int i = 0; i < nViews; i++) {
+            U += viewU[i];
+            gradI += viewGradI[i];
+        }
+
+        // damped steps until the cost decreases
+        bool improved = false, converged = false;
+        while(!improved && lambda < 1e10) {
+            // Schur complement of the extrinsic blocks
+            MatII S = U;
+            VecI rhs = -gradI;
+            for(int k = 0; k < NINTRINSICS; k++)
+                S(k, k) *= 1 + lambda;
+            vector< MatEE > Vinv(nViews);
+            for(int i = 0; i < nViews; i++) {
+                MatEE Vd = V[i];
+                for(int k = 0; k < 6; k++)
+                    Vd(k, k) = Vd(k, k) * (1 + lambda) + DBL_EPSILON;
+                Vinv[i] = Vd.inv(DECOMP_CHOLESKY);
+                MatIE WVinv = W[i] * Vinv[i];
+                S -= WVinv * W[i].t();
+                rhs += WVinv * gradE[i];
+            }
+            for(int k = 0; k < NINTRINSICS; k++) {
+                if(!fixed[k]) continue;
+                S(k, k) = 1;
+                rhs[k] = 0;
+            }
+
+            Mat deltaMat;
+            if(!solve(Mat(S), Mat(rhs), deltaMat, DECOMP_CHOLESKY)) {
+                lambda *= 10;
+                continue;
+            }
+            VecI deltaI = deltaMat;
+
+            // back substitution of the extrinsic steps
+            VecI newIntrinsics = _intrinsics + deltaI;
+            if(followAspectRatio) newIntrinsics[1] = newIntrinsics[0] / _aspectRatio;
+            vector< Vec3d > newRvecs(nViews), newTvecs(nViews);
+            double stepNorm = norm(deltaI, NORM_L2SQR), paramNorm = norm(_intrinsics, NORM_L2SQR);
+            for(int i = 0; i < nViews; i++) {
+                VecE deltaE = Vinv[i] * (-gradE[i] - W[i].t() * deltaI);
+                for(int k = 0; k < 3; k++) {
+                    newRvecs[i][k] = rvecs[i][k] + deltaE[k];
+                    newTvecs[i][k] = tvecs[i][k] + deltaE[3 + k];
+                }
+                stepNorm += norm(deltaE, NORM_L2SQR);
+                paramNorm += norm(rvecs[i], NORM_L2SQR) + norm(tvecs[i], NORM_L2SQR);
+            }
+            converged = stepNorm <= epsilon * epsilon * paramNorm;
+
+            double newCost = _getCost(newIntrinsics, newRvecs, newTvecs);
+            if(newCost < cost) {
+                improved = true;
+                cost = newCost;
+                _intrinsics = newIntrinsics;
+                rvecs = newRvecs;
+                tvecs = newTvecs;
+                lambda = max(lambda * 0.1, 1e-12);
+            } else {
+                lambda *= 10;
+            }
+            if(converged) break;
+        }
+        if(improved) _iterations++;
+        if(!improved || converged) break;
+    }
+
+    for(int i = 0; i < nViews; i++) {
+        _views[i].rvec = rvecs[i];
+        _views[i].tvec = tvecs[i];
+    }
+    _rmsError = sqrt(cost / double(nPoints));
+    _dirty = false;
+    return _rmsError;
+}
+
+
+/**
+ */
+void IncrementalCalibrator::getCamera(OutputArray cameraMatrix, OutputArray distCoeffs) const {
+    Matx33d K;
+    Matx< double, 5, 1 > D;
+    _getCameraMatrices(_intrinsics, K, D);
+    Mat(K).copyTo(cameraMatrix);
+    Mat(D).copyTo(distCoeffs);
+}
+
+
+/**
+ */
+void IncrementalCalibrator::getExtrinsics(OutputArrayOfArrays rvecs, OutputArrayOfArrays tvecs) const {
+    int nViews = (int)_views.size();
+    rvecs.create(nViews, 1, CV_64FC3);
+    tvecs.create(nViews, 1, CV_64FC3);
+    for(int i = 0; i < nViews; i++) {
+        rvecs.create(3, 1, CV_64F, i, true);
+        tvecs.create(3, 1, CV_64F, i, true);
+        Mat rvec = rvecs.getMat(i), tvec = tvecs.getMat(i);
+        Mat(_views[i].rvec).copyTo(rvec);
+        Mat(_views[i].tvec).copyTo(tvec);
+    }
+}
+
+}
+}
@@ -0,0 +1,113 @@
+/*
+By downloading, copying, installing or using the software you agree to this
+license. If you do not agree to this license, do not download, install,
+copy or use the software.
+
+                          License Agreement
+               For Open Source Computer Vision Library
+                       (3-clause BSD License)
+
+Copyright (C) 2013, OpenCV Foundation, all rights reserved.
+Third party copyrights are property of their respective owners.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice,
+    this list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the names of the copyright holders nor the names of the contributors
+    may be used to endorse or promote products derived from this software
+    without specific prior written permission.
+
+This software is provided by the copyright holders and contributors "as is" and
+any express or implied warranties, including, but not limited to, the implied
+warranties of merchantability and fitness for a particular purpose are
+disclaimed. In no event shall copyright holders or contributors be liable for
+any direct, indirect, incidental, special, exemplary, or consequential damages
+(including, but not limited to, procurement of substitute goods or services;
+loss of use, data, or profits; or business interruption) however caused
+and on any theory of liability, whether in contract, strict liability,
+or tort (including negligence or otherwise) arising in any way out of
+the use of this software, even if advised of the possibility of such damage.
+*/
+
+
+#ifndef __OPENCV_ARUCO_CANDIDATE_GRID_HPP__
+#define __OPENCV_ARUCO_CANDIDATE_GRID_HPP__
+
+#include <opencv2/core.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace cv {
+namespace aruco {
+
+/**
+  * Uniform grid over a set of points, e.g. marker or candidate centers. Cells are not smaller than
+  * the search radius, so all the points closer than the radius to p are in the 3x3 cells around it.
+  */
+struct _CandidateGrid {
+    Point2f origin;
+    double cellSize;
+    int cols, rows;
+    std::vector< int > cellStart; // items of cell c are items[cellStart[c]] ... items[cellStart[c + 1] - 1]
+    std::vector< int > items;
+
+    _CandidateGrid(const std::vector< Point2f > &centers, double radius) : cellSize(radius), cols(0), rows(0) {
+        if(centers.empty()) return;
+        Point2f maxPt = centers[0];
+        origin = centers[0];
+        for(size_t i = 1; i < centers.size(); i++) {
+            origin.x = std::min(origin.x, centers[i].x);
+            origin.y = std::min(origin.y, centers[i].y);
+            maxPt.x = std::max(maxPt.x, centers[i].x);
+            maxPt.y = std::max(maxPt.y, centers[i].y);
+        }
+        // bound the number of cells when the radius is small compared to the image
+        const int maxCellsPerSide = 256;
+        cellSize = std::max(cellSize, std::max(maxPt.x - origin.x, maxPt.y - origin.y) / double(maxCellsPerSide));
+        cols = int((maxPt.x - origin.x) / cellSize) + 1;
+        rows = int((maxPt.y - origin.y) / cellSize) + 1;
+
+        // counting sort of the points by cell
+        std::vector< int > cellOf(centers.size());
+        cellStart.assign(cols * rows + 1, 0);
+        for(size_t i = 0; i < centers.size(); i++) {
+            int cx = std::min(cols - 1, int((centers[i].x - origin.x) / cellSize));
+            int cy = std::min(rows - 1, int((centers[i].y - origin.y) / cellSize));
+            cellOf[i] = cy * cols + cx;
+            cellStart[cellOf[i] + 1]++;
+        }
+        for(int c = 0; c < cols * rows; c++)
+            cellStart[c + 1] += cellStart[c];
+        items.resize(centers.size());
+        std::vector< int > fill(cellStart.begin(), cellStart.end() - 1);
+        for(size_t i = 0; i < centers.size(); i++)
+            items[fill[cellOf[i]]++] = (int)i;
+    }
+
+    /** @brief Append the items that can be closer than the radius to p */
+    void query(Point2f p, std::vector< int > &out) const {
+        if(cols == 0) return;
+        double fx = (p.x - origin.x) / cellSize, fy = (p.y - origin.y) / cellSize;
+        // also rejects NaN coordinates from degenerate projections
+        if(!(fx >= -1 && fx < cols + 1 && fy >= -1 && fy < rows + 1)) return;
+        int cx = cvFloor(fx), cy = cvFloor(fy);
+        for(int y = std::max(0, cy - 1); y <= std::min(rows - 1, cy + 1); y++) {
+            for(int x = std::max(0, cx - 1); x <= std::min(cols - 1, cx + 1); x++) {
+                int c = y * cols + x;
+                out.insert(out.end(), items.begin() + cellStart[c], items.begin() + cellStart[c + 1]);
+            }
+        }
+    }
+};
+
+}
+}
+
+#endif
@@ -38,8 +38,13 @@ the use of this software, even if advised of the possibility of such damage.
 
 #include "precomp.hpp"
 #include "opencv2/aruco/charuco.hpp"
+#include "candidate_grid.hpp"
+#include "subpix.hpp"
 #include <opencv2/core.hpp>
 #include <opencv2/imgproc.hpp>
+#include <cstring>
+#include <fstream>
+#include <map>
 
 
 namespace cv {
@@ -166,6 +171,7 @@ Ptr<CharucoBoard> CharucoBoard::create(int squaresX, int squaresY, float squareL
     }
 
     res->_getNearestMarkerCorners();
+    res->updateIdIndex();
 
     return res;
 }
@@ -173,57 +179,185 @@ Ptr<CharucoBoard> CharucoBoard::create(int squaresX, int squaresY, float squareL
 
 
 /**
-  * Fill nearestMarkerIdx and nearestMarkerCorners arrays
+  * Fill nearestMarkerIdx and nearestMarkerCorners arrays. Each chessboard corner touches four
+  * squares and two of them have markers, whose centers are the closest ones to the corner
   */
 void CharucoBoard::_getNearestMarkerCorners() {
 
-    nearestMarkerIdx.resize(chessboardCorners.size());
-    nearestMarkerCorners.resize(chessboardCorners.size());
-
-    unsigned int nMarkers = (unsigned int)ids.size();
-    unsigned int nCharucoCorners = (unsigned int)chessboardCorners.size();
-    for(unsigned int i = 0; i < nCharucoCorners; i++) {
-        double minDist = -1; // distance of closest markers
-        Point3f charucoCorner = chessboardCorners[i];
-        for(unsigned int j = 0; j < nMarkers; j++) {
-            // calculate distance from marker center to charuco corner
-            Point3f center = Point3f(0, 0, 0);
-            for(unsigned int k = 0; k < 4; k++)
-                center += objPoints[j][k];
-            center /= 4.;
-            double sqDistance;
-            Point3f distVector = charucoCorner - center;
-            sqDistance = distVector.x * distVector.x + distVector.y * distVector.y;
-            if(j == 0 || fabs(sqDistance - minDist) < cv::pow(0.01 * _squareLength, 2)) {
-                // if same minimum distance (or first iteration), add to nearestMarkerIdx vector
-                nearestMarkerIdx[i].push_back(j);
-                minDist = sqDistance;
-            } else if(sqDistance < minDist) {
-                // if finding a closest marker to the charuco corner
-                nearestMarkerIdx[i].clear(); // remove any previous added marker
-                nearestMarkerIdx[i].push_back(j); // add the new closest marker index
-                minDist = sqDistance;
+    // index of the marker of each square, -1 for black squares. Same order than in create()
+    vector< int > squareMarker(_squaresX * _squaresY, -1);
+    int nMarkers = 0;
+    for(int y = _squaresY - 1; y >= 0; y--) {
+        for(int x = 0; x < _squaresX; x++) {
+            if(y % 2 != x % 2) squareMarker[y * _squaresX + x] = nMarkers++;
+        }
+    }
+    CV_Assert(nMarkers == (int)objPoints.size());
+
+    nearestMarkerIdx.assign(chessboardCorners.size(), vector< int >());
+    nearestMarkerCorners.assign(chessboardCorners.size(), vector< int >());
+
+    // squares around the chessboard corner between squares (x, y) and (x + 1, y + 1), and the
+    // corner of their markers on it
+    const int squareOffsetX[4] = { 0, 1, 0, 1 };
+    const int squareOffsetY[4] = { 0, 0, 1, 1 };
+    const int markerCorner[4] = { 1, 0, 2, 3 };
+
+    for(int y = 0; y < _squaresY - 1; y++) {
+        for(int x = 0; x < _squaresX - 1; x++) {
+            int i = y * (_squaresX - 1) + x;
+            for(int k = 0; k < 4; k++) {
+                int m = squareMarker[(y + squareOffsetY[k]) * _squaresX + x + squareOffsetX[k]];
+                if(m < 0) continue;
+                nearestMarkerIdx[i].push_back(m);
+                nearestMarkerCorners[i].push_back(markerCorner[k]);
+            }
+            // in increasing marker order
+            if(nearestMarkerIdx[i][0] > nearestMarkerIdx[i][1]) {
+                std::swap(nearestMarkerIdx[i][0], nearestMarkerIdx[i][1]);
+                std::swap(nearestMarkerCorners[i][0], nearestMarkerCorners[i][1]);
             }
         }
+    }
+}
 
-        // for each of the closest markers, search the marker corner index closer
-        // to the charuco corner
-        for(unsigned int j = 0; j < nearestMarkerIdx[i].size(); j++) {
-            nearestMarkerCorners[i].resize(nearestMarkerIdx[i].size());
-            double minDistCorner = -1;
-            for(unsigned int k = 0; k < 4; k++) {
-                double sqDistance;
-                Point3f distVector = charucoCorner - objPoints[nearestMarkerIdx[i][j]][k];
-                sqDistance = distVector.x * distVector.x + distVector.y * distVector.y;
-                if(k == 0 || sqDistance < minDistCorner) {
-                    // if this corner is closer to the charuco corner, assing its index
-                    // to nearestMarkerCorners
-                    minDistCorner = sqDistance;
-                    nearestMarkerCorners[i][j] = k;
-                }
-            }
+
+/**
+  * Binary board files start with this magic and version, followed by the fields in the order of
+  * CharucoBoard::save(), in little endian
+  */
+static const char CHARUCO_BOARD_MAGIC[4] = { 'A', 'R', 'C', 'B' };
+static const int CHARUCO_BOARD_VERSION = 1;
+
+// upper bound of the element counts of a board file, to reject corrupted files before allocating
+static const int CHARUCO_BOARD_MAX_ELEMENTS = 1 << 24;
+
+template< typename T >
+static void _writeBinary(ostream &out, const T &value) {
+    out.write((const char *)&value, sizeof(T));
+}
+
+template< typename T >
+static void _writeBinary(ostream &out, const vector< T > &values) {
+    _writeBinary(out, (int)values.size());
+    if(!values.empty()) out.write((const char *)&values[0], values.size() * sizeof(T));
+}
+
+template< typename T >
+static bool _readBinary(istream &in, T &value) {
+    return (bool)in.read((char *)&value, sizeof(T));
+}
+
+template< typename T >
+static bool _readBinary(istream &in, vector< T > &values) {
+    int n;
+    if(!_readBinary(in, n) || n < 0 || n > CHARUCO_BOARD_MAX_ELEMENTS) return false;
+    values.resize(n);
+    return n == 0 || (bool)in.read((char *)&values[0], n * sizeof(T));
+}
+
+
+/**
+ */
+bool CharucoBoard::save(const String &filename) const {
+
+    CV_Assert(dictionary);
+    ofstream out(filename.c_str(), ios::binary | ios::trunc);
+    if(!out.is_open()) return false;
+
+    out.write(CHARUCO_BOARD_MAGIC, 4);
+    _writeBinary(out, CHARUCO_BOARD_VERSION);
+    _writeBinary(out, _squaresX);
+    _writeBinary(out, _squaresY);
+    _writeBinary(out, _squareLength);
+    _writeBinary(out, _markerLength);
+
+    // dictionary
+    Mat bytesList = dictionary->bytesList.isContinuous() ? dictionary->bytesList : dictionary->bytesList.clone();
+    CV_Assert(bytesList.empty() || bytesList.type() == CV_8UC4);
+    _writeBinary(out, dictionary->markerSize);
+    _writeBinary(out, dictionary->maxCorrectionBits);
+    _writeBinary(out, bytesList.rows);
+    _writeBinary(out, bytesList.cols);
+    if(!bytesList.empty()) out.write((const char *)bytesList.data, bytesList.total() * bytesList.elemSize());
+
+    // markers
+    _writeBinary(out, ids);
+    _writeBinary(out, (int)objPoints.size());
+    for(size_t i = 0; i < objPoints.size(); i++) {
+        CV_Assert(objPoints[i].size() == 4);
+        out.write((const char *)&objPoints[i][0], 4 * sizeof(Point3f));
+    }
+
+    // chessboard corners and topology
+    _writeBinary(out, chessboardCorners);
+    CV_Assert(nearestMarkerIdx.size() == chessboardCorners.size() &&
+              nearestMarkerCorners.size() == chessboardCorners.size());
+    for(size_t i = 0; i < chessboardCorners.size(); i++) {
+        _writeBinary(out, nearestMarkerIdx[i]);
+        _writeBinary(out, nearestMarkerCorners[i]);
+    }
+
+    out.close();
+    return !out.fail();
+}
+
+
+/**
+ */
+Ptr<CharucoBoard> CharucoBoard::load(const String &filename) {
+
+    ifstream in(filename.c_str(), ios::binary);
+    if(!in.is_open()) return Ptr<CharucoBoard>();
+
+    char magic[4];
+    int version;
+    if(!in.read(magic, 4) || memcmp(magic, CHARUCO_BOARD_MAGIC, 4) != 0 || !_readBinary(in, version) ||
+       version != CHARUCO_BOARD_VERSION)
+        return Ptr<CharucoBoard>();
+
+    Ptr<CharucoBoard> res = makePtr<CharucoBoard>();
+    if(!_readBinary(in, res->_squaresX) || !_readBinary(in, res->_squaresY) ||
+       !_readBinary(in, res->_squareLength) || !_readBinary(in, res->_markerLength))
+        return Ptr<CharucoBoard>();
+
+    // dictionary
+    int markerSize, maxCorrectionBits, rows, cols;
+    if(!_readBinary(in, markerSize) || !_readBinary(in, maxCorrectionBits) || !_readBinary(in, rows) ||
+       !_readBinary(in, cols) || rows < 0 || cols < 0 || (size_t)rows * cols > CHARUCO_BOARD_MAX_ELEMENTS)
+        return Ptr<CharucoBoard>();
+    Mat bytesList(rows, cols, CV_8UC4);
+    if(!bytesList.empty() && !in.read((char *)bytesList.data, bytesList.total() * bytesList.elemSize()))
+        return Ptr<CharucoBoard>();
+    res->dictionary = makePtr<Dictionary>(bytesList, markerSize, maxCorrectionBits);
+
+    // markers
+    int nMarkers;
+    if(!_readBinary(in, res->ids) || !_readBinary(in, nMarkers) || nMarkers != (int)res->ids.size())
+        return Ptr<CharucoBoard>();
+    res->objPoints.resize(nMarkers, vector< Point3f >(4));
+    for(int i = 0; i < nMarkers; i++) {
+        if(!in.read((char *)&res->objPoints[i][0], 4 * sizeof(Point3f))) return Ptr<CharucoBoard>();
+    }
+
+    // chessboard corners and topology
+    if(!_readBinary(in, res->chessboardCorners)) return Ptr<CharucoBoard>();
+    size_t nCorners = res->chessboardCorners.size();
+    res->nearestMarkerIdx.resize(nCorners);
+    res->nearestMarkerCorners.resize(nCorners);
+    for(size_t i = 0; i < nCorners; i++) {
+        if(!_readBinary(in, res->nearestMarkerIdx[i]) || !_readBinary(in, res->nearestMarkerCorners[i]) ||
+           res->nearestMarkerIdx[i].size() != res->nearestMarkerCorners[i].size())
+            return Ptr<CharucoBoard>();
+        for(size_t j = 0; j < res->nearestMarkerIdx[i].size(); j++) {
+            if(res->nearestMarkerIdx[i][j] < 0 || res->nearestMarkerIdx[i][j] >= nMarkers ||
+               res->nearestMarkerCorners[i][j] < 0 || res->nearestMarkerCorners[i][j] > 3)
+                return Ptr<CharucoBoard>();
         }
     }
+
+    res->updateIdIndex();
+    return res;
 }
 
 
@@ -241,21 +375,15 @@ static int _filterCornersWithoutMinMarkers(const Ptr<CharucoBoard> &_board,
 
     vector< Point2f > filteredCharucoCorners;
     vector< int > filteredCharucoIds;
+    vector< int > detectionIdx;
+    _board->getDetectedMarkerIndices(_allArucoIds, detectionIdx);
     // for each charuco corner
     for(unsigned int i = 0; i < _allCharucoIds.getMat().total(); i++) {
         int currentCharucoId = _allCharucoIds.getMat().at< int >(i);
         int totalMarkers = 0; // nomber of closest marker detected
         // look for closest markers
         for(unsigned int m = 0; m < _board->nearestMarkerIdx[currentCharucoId].size(); m++) {
-            int markerId = _board->ids[_board->nearestMarkerIdx[currentCharucoId][m]];
-            bool found = false;
-            for(unsigned int k = 0; k < _allArucoIds.getMat().total(); k++) {
-                if(_allArucoIds.getMat().at< int >(k) == markerId) {
-                    found = true;
-                    break;
-                }
-            }
-            if(found) totalMarkers++;
+            if(detectionIdx[_board->nearestMarkerIdx[currentCharucoId][m]] != -1) totalMarkers++;
         }
         // if enough markers detected, add the charuco corner to the final list
         if(totalMarkers >= minMarkers) {
@@ -270,6 +398,30 @@ static int _filterCornersWithoutMinMarkers(const Ptr<CharucoBoard> &_board,
     return (int)_filteredCharucoIds.total();
 }
 
+/**
+  * @brief Subpixel refinement of the charuco corners at once, each one with its corresponding
+  * window size. Window sizes of -1 are replaced by the default one. The center pixel of the
+  * windows is not used, as cornerSubPix with a zero zone of Size()
+  */
+static void _refineChessboardCorners(const Mat &grey, vector< Point2f > &corners,
+                                     vector< Size > &winSizes) {
+
+    // default params for corner refinement
+    static const DetectorParameters params;
+
+    for(size_t i = 0; i < winSizes.size(); i++) {
+        if(winSizes[i].height == -1 || winSizes[i].width == -1)
+            winSizes[i] = Size(params.cornerRefinementWinSize, params.cornerRefinementWinSize);
+    }
+    refineCornersSubPix(grey, corners, winSizes,
+                        TermCriteria(TermCriteria::MAX_ITER | TermCriteria::EPS,
+                                     params.cornerRefinementMaxIterations,
+                                     params.cornerRefinementMinAccuracy),
+                        Size());
+}
+
+
+
 /**
   * @brief From all projected chessboard corners, select those inside the image and apply subpixel
   * refinement. Returns number of valid corners.
@@ -306,28 +458,7 @@ static int _selectAndRefineChessboardCorners(InputArray _allCorners, InputArray
     else
         grey = _image.getMat();
 
-    const Ptr<DetectorParameters> params = DetectorParameters::create(); // use default params for corner refinement
-
-    //// For each of the charuco corners, apply subpixel refinement using its correspondind winSize
-    parallel_for_(Range(0, (int)filteredChessboardImgPoints.size()), [&](const Range& range) {
-        const int begin = range.start;
-        const int end = range.end;
-
-        for (int i = begin; i < end; i++) {
-            vector<Point2f> in;
-            in.push_back(filteredChessboardImgPoints[i]);
-            Size winSize = filteredWinSizes[i];
-            if (winSize.height == -1 || winSize.width == -1)
-                winSize = Size(params->cornerRefinementWinSize, params->cornerRefinementWinSize);
-
-            cornerSubPix(grey, in, winSize, Size(),
-                         TermCriteria(TermCriteria::MAX_ITER | TermCriteria::EPS,
-                                      params->cornerRefinementMaxIterations,
-                                      params->cornerRefinementMinAccuracy));
-
-            filteredChessboardImgPoints[i] = in[0];
-        }
-    });
+    _refineChessboardCorners(grey, filteredChessboardImgPoints, filteredWinSizes);
 
     // parse output
     Mat(filteredChessboardImgPoints).copyTo(_selectedCorners);
@@ -347,6 +478,9 @@ static void _getMaximumSubPixWindowSizes(InputArrayOfArrays markerCorners, Input
     unsigned int nCharucoCorners = (unsigned int)charucoCorners.getMat().total();
     sizes.resize(nCharucoCorners, Size(-1, -1));
 
+    vector< int > detectionIdx;
+    board->getDetectedMarkerIndices(markerIds, detectionIdx);
+
     for(unsigned int i = 0; i < nCharucoCorners; i++) {
         if(charucoCorners.getMat().at< Point2f >(i) == Point2f(-1, -1)) continue;
         if(board->nearestMarkerIdx[i].size() == 0) continue;
@@ -357,14 +491,7 @@ static void _getMaximumSubPixWindowSizes(InputArrayOfArrays markerCorners, Input
         // calculate the distance to each of the closest corner of each closest marker
         for(unsigned int j = 0; j < board->nearestMarkerIdx[i].size(); j++) {
             // find marker
-            int markerId = board->ids[board->nearestMarkerIdx[i][j]];
-            int markerIdx = -1;
-            for(unsigned int k = 0; k < markerIds.getMat().total(); k++) {
-                if(markerIds.getMat().at< int >(k) == markerId) {
-                    markerIdx = k;
-                    break;
-                }
-            }
+            int markerIdx = detectionIdx[board->nearestMarkerIdx[i][j]];
             if(markerIdx == -1) continue;
             Point2f markerCorner =
                 markerCorners.getMat(markerIdx).at< Point2f >(board->nearestMarkerCorners[i][j]);
@@ -391,18 +518,14 @@ static void _getMaximumSubPixWindowSizes(InputArrayOfArrays markerCorners, Input
 
 
 /**
-  * Interpolate charuco corners using approximated pose estimation
+  * Project the chessboard corners with the approximated board pose. Returns false if no board
+  * marker is detected.
   */
-static int _interpolateCornersCharucoApproxCalib(InputArrayOfArrays _markerCorners,
-                                                 InputArray _markerIds, InputArray _image,
-                                                 const Ptr<CharucoBoard> &_board,
-                                                 InputArray _cameraMatrix, InputArray _distCoeffs,
-                                                 OutputArray _charucoCorners,
-                                                 OutputArray _charucoIds) {
-
-    CV_Assert(_image.getMat().channels() == 1 || _image.getMat().channels() == 3);
-    CV_Assert(_markerCorners.total() == _markerIds.getMat().total() &&
-              _markerIds.getMat().total() > 0);
+static bool _getApproxCalibChessboardCorners(InputArrayOfArrays _markerCorners,
+                                             InputArray _markerIds,
+                                             const Ptr<CharucoBoard> &_board,
+                                             InputArray _cameraMatrix, InputArray _distCoeffs,
+                                             vector< Point2f > &allChessboardImgPoints) {
 
     // approximated pose estimation using marker corners
     Mat approximatedRvec, approximatedTvec;
@@ -412,14 +535,34 @@ static int _interpolateCornersCharucoApproxCalib(InputArrayOfArrays _markerCorne
         aruco::estimatePoseBoard(_markerCorners, _markerIds, _b,
                                  _cameraMatrix, _distCoeffs, approximatedRvec, approximatedTvec);
 
-    if(detectedBoardMarkers == 0) return 0;
+    if(detectedBoardMarkers == 0) return false;
 
     // project chessboard corners
-    vector< Point2f > allChessboardImgPoints;
-
     projectPoints(_board->chessboardCorners, approximatedRvec, approximatedTvec, _cameraMatrix,
                   _distCoeffs, allChessboardImgPoints);
+    return true;
+}
+
+
+
+/**
+  * Interpolate charuco corners using approximated pose estimation
+  */
+static int _interpolateCornersCharucoApproxCalib(InputArrayOfArrays _markerCorners,
+                                                 InputArray _markerIds, InputArray _image,
+                                                 const Ptr<CharucoBoard> &_board,
+                                                 InputArray _cameraMatrix, InputArray _distCoeffs,
+                                                 OutputArray _charucoCorners,
+                                                 OutputArray _charucoIds) {
+
+    CV_Assert(_image.getMat().channels() == 1 || _image.getMat().channels() == 3);
+    CV_Assert(_markerCorners.total() == _markerIds.getMat().total() &&
+              _markerIds.getMat().total() > 0);
 
+    vector< Point2f > allChessboardImgPoints;
+    if(!_getApproxCalibChessboardCorners(_markerCorners, _markerIds, _board, _cameraMatrix,
+                                         _distCoeffs, allChessboardImgPoints))
+        return 0;
 
     // calculate maximum window sizes for subpixel refinement. The size is limited by the distance
     // to the closes marker corner to avoid erroneous displacements to marker corners
@@ -435,38 +578,32 @@ static int _interpolateCornersCharucoApproxCalib(InputArrayOfArrays _markerCorne
 
 
 /**
-  * Interpolate charuco corners using local homography
+  * Interpolate the chessboard corners with the local homographies of their closest detected
+  * markers. Corners without any closest marker detected are set to (-1, -1).
   */
-static int _interpolateCornersCharucoLocalHom(InputArrayOfArrays _markerCorners,
-                                              InputArray _markerIds, InputArray _image,
-                                              const Ptr<CharucoBoard> &_board,
-                                              OutputArray _charucoCorners,
-                                              OutputArray _charucoIds) {
+static void _getLocalHomChessboardCorners(InputArrayOfArrays _markerCorners, InputArray _markerIds,
+                                          const Ptr<CharucoBoard> &_board,
+                                          vector< Point2f > &allChessboardImgPoints) {
 
-    CV_Assert(_image.getMat().channels() == 1 || _image.getMat().channels() == 3);
-    CV_Assert(_markerCorners.total() == _markerIds.getMat().total() &&
-              _markerIds.getMat().total() > 0);
-
-    unsigned int nMarkers = (unsigned int)_markerIds.getMat().total();
+    Mat markerIds = _markerIds.getMat();
+    unsigned int nMarkers = (unsigned int)markerIds.total();
 
     // calculate local homographies for each marker
-    vector< Mat > transformations;
-    transformations.resize(nMarkers);
-
+    vector< Matx33d > transformations(nMarkers);
     vector< bool > validTransform(nMarkers, false);
 
     for(unsigned int i = 0; i < nMarkers; i++) {
-        vector< Point2f > markerObjPoints2D;
-        int markerId = _markerIds.getMat().at< int >(i);
-        vector< int >::const_iterator it = find(_board->ids.begin(), _board->ids.end(), markerId);
-        if(it == _board->ids.end()) continue;
-        int boardIdx = (int)std::distance<std::vector<int>::const_iterator>(_board->ids.begin(), it);
-        markerObjPoints2D.resize(4);
-        for(unsigned int j = 0; j < 4; j++)
+        int boardIdx = _board->getMarkerIndex(markerIds.at< int >(i));
+        if(boardIdx < 0) continue;
+        Point2f markerObjPoints2D[4], markerImgPoints[4];
+        Mat corners = _markerCorners.getMat(i);
+        for(unsigned int j = 0; j < 4; j++) {
             markerObjPoints2D[j] =
                 Point2f(_board->objPoints[boardIdx][j].x, _board->objPoints[boardIdx][j].y);
+            markerImgPoints[j] = corners.at< Point2f >(j);
+        }
 
-        transformations[i] = getPerspectiveTransform(markerObjPoints2D, _markerCorners.getMat(i));
+        transformations[i] = getPerspectiveTransform(markerObjPoints2D, markerImgPoints);
 
         // set transform as valid if transformation is non-singular
         double det = determinant(transformations[i]);
@@ -474,43 +611,67 @@ static int _interpolateCornersCharucoLocalHom(InputArrayOfArrays _markerCorners,
     }
 
     unsigned int nCharucoCorners = (unsigned int)_board->chessboardCorners.size();
-    vector< Point2f > allChessboardImgPoints(nCharucoCorners, Point2f(-1, -1));
+    allChessboardImgPoints.assign(nCharucoCorners, Point2f(-1, -1));
 
-    // for each charuco corner, calculate its interpolation position based on the closest markers
-    // homographies
+    vector< int > detectionIdx;
+    _board->getDetectedMarkerIndices(markerIds, detectionIdx);
+
+    // gather the (charuco corner, marker homography) pairs. Only the first two closest markers
+    // detected are used for each corner
+    vector< int > pairCorner, pairMarker;
+    pairCorner.reserve(2 * nCharucoCorners);
+    pairMarker.reserve(2 * nCharucoCorners);
     for(unsigned int i = 0; i < nCharucoCorners; i++) {
-        Point2f objPoint2D = Point2f(_board->chessboardCorners[i].x, _board->chessboardCorners[i].y);
-
-        vector< Point2f > interpolatedPositions;
-        for(unsigned int j = 0; j < _board->nearestMarkerIdx[i].size(); j++) {
-            int markerId = _board->ids[_board->nearestMarkerIdx[i][j]];
-            int markerIdx = -1;
-            for(unsigned int k = 0; k < _markerIds.getMat().total(); k++) {
-                if(_markerIds.getMat().at< int >(k) == markerId) {
-                    markerIdx = k;
-                    break;
-                }
-            }
-            if (markerIdx != -1 &&
-                validTransform[markerIdx])
-            {
-                vector< Point2f > in, out;
-                in.push_back(objPoint2D);
-                perspectiveTransform(in, out, transformations[markerIdx]);
-                interpolatedPositions.push_back(out[0]);
+        int nPairs = 0;
+        for(unsigned int j = 0; j < _board->nearestMarkerIdx[i].size() && nPairs < 2; j++) {
+            int markerIdx = detectionIdx[_board->nearestMarkerIdx[i][j]];
+            if(markerIdx != -1 && validTransform[markerIdx]) {
+                pairCorner.push_back(i);
+                pairMarker.push_back(markerIdx);
+                nPairs++;
             }
         }
+    }
 
+    // transform all the pairs and accumulate the positions of each corner. If more than one closest
+    // marker is detected, the corner is in the middle point
+    vector< double > sumX(nCharucoCorners, 0), sumY(nCharucoCorners, 0);
+    vector< int > count(nCharucoCorners, 0);
+    for(size_t p = 0; p < pairCorner.size(); p++) {
+        int i = pairCorner[p];
+        const Matx33d &H = transformations[pairMarker[p]];
+        double x = _board->chessboardCorners[i].x, y = _board->chessboardCorners[i].y;
+        double w = H(2, 0) * x + H(2, 1) * y + H(2, 2);
+        // same convention than perspectiveTransform for points at infinity
+        w = std::abs(w) > DBL_EPSILON ? 1. / w : 0;
+        sumX[i] += (H(0, 0) * x + H(0, 1) * y + H(0, 2)) * w;
+        sumY[i] += (H(1, 0) * x + H(1, 1) * y + H(1, 2)) * w;
+        count[i]++;
+    }
+    for(unsigned int i = 0; i < nCharucoCorners; i++) {
         // none of the closest markers detected
-        if(interpolatedPositions.size() == 0) continue;
-
-        // more than one closest marker detected, take middle point
-        if(interpolatedPositions.size() > 1) {
-            allChessboardImgPoints[i] = (interpolatedPositions[0] + interpolatedPositions[1]) / 2.;
-        }
-        // a single closest marker detected
-        else allChessboardImgPoints[i] = interpolatedPositions[0];
+        if(count[i] == 0) continue;
+        allChessboardImgPoints[i] = Point2f((float)(sumX[i] / count[i]), (float)(sumY[i] / count[i]));
     }
+}
+
+
+
+/**
+  * Interpolate charuco corners using local homography
+  */
+static int _interpolateCornersCharucoLocalHom(InputArrayOfArrays _markerCorners,
+                                              InputArray _markerIds, InputArray _image,
+                                              const Ptr<CharucoBoard> &_board,
+                                              OutputArray _charucoCorners,
+                                              OutputArray _charucoIds) {
+
+    CV_Assert(_image.getMat().channels() == 1 || _image.getMat().channels() == 3);
+    CV_Assert(_markerCorners.total() == _markerIds.getMat().total() &&
+              _markerIds.getMat().total() > 0);
+
+    vector< Point2f > allChessboardImgPoints;
+    _getLocalHomChessboardCorners(_markerCorners, _markerIds, _board, allChessboardImgPoints);
 
     // calculate maximum window sizes for subpixel refinement. The size is limited by the distance
     // to the closes marker corner to avoid erroneous displacements to marker corners
@@ -648,6 +809,34 @@ bool estimatePoseCharucoBoard(InputArray _charucoCorners, InputArray _charucoIds
 
 
 
+/**
+  */
+bool trackPoseCharucoBoard(InputArray _charucoCorners, InputArray _charucoIds,
+                           const Ptr<CharucoBoard> &_board, InputArray _cameraMatrix, InputArray _distCoeffs,
+                           const Ptr<BoardPoseTracker> &tracker, OutputArray _rvec, OutputArray _tvec) {
+
+    CV_Assert((_charucoCorners.getMat().total() == _charucoIds.getMat().total()));
+
+    vector< Point3f > objPoints;
+    objPoints.reserve(_charucoIds.getMat().total());
+    for(unsigned int i = 0; i < _charucoIds.getMat().total(); i++) {
+        int currId = _charucoIds.getMat().at< int >(i);
+        CV_Assert(currId >= 0 && currId < (int)_board->chessboardCorners.size());
+        objPoints.push_back(_board->chessboardCorners[currId]);
+    }
+
+    // points need to be in different lines, check if detected points are enough
+    if(!_arePointsEnoughForPoseEstimation(objPoints)) {
+        tracker->reset();
+        return false;
+    }
+
+    // each corner is gated on its own
+    return tracker->update(objPoints, _charucoCorners, 1, _cameraMatrix, _distCoeffs, _rvec, _tvec) > 0;
+}
+
+
+
 
 /**
   */
@@ -696,6 +885,45 @@ double calibrateCameraCharuco(InputArrayOfArrays _charucoCorners, InputArrayOfAr
 }
 
 
+/**
+  * Charuco board layout of the diamonds with the given square to marker length rate. The layouts
+  * are cached, since the same rate is used on every frame
+  */
+static Ptr<CharucoBoard> _getCharucoDiamondLayout(float squareMarkerLengthRate) {
+    static Mutex cacheMutex;
+    static map< float, Ptr<CharucoBoard> > cache;
+    const size_t maxCachedLayouts = 16;
+
+    AutoLock lock(cacheMutex);
+    map< float, Ptr<CharucoBoard> >::iterator it = cache.find(squareMarkerLengthRate);
+    if(it != cache.end()) return it->second;
+
+    if(cache.size() >= maxCachedLayouts) cache.clear();
+    Ptr<Dictionary> dict = getPredefinedDictionary(PREDEFINED_DICTIONARY_NAME(0));
+    Ptr<CharucoBoard> layout = CharucoBoard::create(3, 3, squareMarkerLengthRate, 1., dict);
+    cache[squareMarkerLengthRate] = layout;
+    return layout;
+}
+
+
+
+/**
+  * Marker close enough to the predicted position of a diamond slot
+  */
+struct _DiamondCandidate {
+    int slot;        // layout marker (1, 2 or 3) predicted from the top marker
+    int marker;      // index in the detected markers
+    double distance; // maximum squared distance between predicted and detected corners
+};
+
+static bool _diamondCandidateLess(const _DiamondCandidate &a, const _DiamondCandidate &b) {
+    if(a.slot != b.slot) return a.slot < b.slot;
+    if(a.distance != b.distance) return a.distance < b.distance;
+    return a.marker < b.marker;
+}
+
+
+
 /**
  */
 void detectCharucoDiamond(InputArray _image, InputArrayOfArrays _markerCorners,
@@ -707,17 +935,15 @@ void detectCharucoDiamond(InputArray _image, InputArrayOfArrays _markerCorners,
 
     const float minRepDistanceRate = 1.302455f;
 
-    // create Charuco board layout for diamond (3x3 layout)
-    Ptr<Dictionary> dict = getPredefinedDictionary(PREDEFINED_DICTIONARY_NAME(0));
-    Ptr<CharucoBoard> _charucoDiamondLayout = CharucoBoard::create(3, 3, squareMarkerLengthRate, 1., dict);
+    // Charuco board layout for diamond (3x3 layout), with marker ids 0 to 3
+    Ptr<CharucoBoard> _charucoDiamondLayout = _getCharucoDiamondLayout(squareMarkerLengthRate);
 
 
     vector< vector< Point2f > > diamondCorners;
     vector< Vec4i > diamondIds;
 
-    // stores if the detected markers have been assigned or not to a diamond
-    vector< bool > assigned(_markerIds.total(), false);
-    if(_markerIds.total() < 4) return; // a diamond need at least 4 markers
+    int nMarkers = (int)_markerIds.total();
+    if(nMarkers < 4) return; // a diamond need at least 4 markers
 
     // convert input image to grey
     Mat grey;
@@ -726,90 +952,164 @@ void detectCharucoDiamond(InputArray _image, InputArrayOfArrays _markerCorners,
     else
         grey = _image.getMat();
 
-    // for each of the detected markers, try to find a diamond
-    for(unsigned int i = 0; i < _markerIds.total(); i++) {
-        if(assigned[i]) continue;
+    // corners and centers of the detected markers, extracted once
+    Mat markerIds = _markerIds.getMat();
+    vector< vector< Point2f > > markers(nMarkers);
+    vector< Point2f > centers(nMarkers);
+    vector< double > maxDistance(nMarkers);
+    double maxRadius = 0;
+    for(int i = 0; i < nMarkers; i++) {
+        const Point2f *corners = _markerCorners.getMat(i).ptr< Point2f >();
+        markers[i].assign(corners, corners + 4);
+        centers[i] = (corners[0] + corners[1] + corners[2] + corners[3]) * 0.25f;
 
         // calculate marker perimeter
         float perimeterSq = 0;
-        Mat corners = _markerCorners.getMat(i);
         for(int c = 0; c < 4; c++) {
-          Point2f edge = corners.at< Point2f >(c) - corners.at< Point2f >((c + 1) % 4);
+          Point2f edge = corners[c] - corners[(c + 1) % 4];
           perimeterSq += edge.x*edge.x + edge.y*edge.y;
         }
         // maximum reprojection error relative to perimeter
         float minRepDistance = sqrt(perimeterSq) * minRepDistanceRate;
+        maxDistance[i] = minRepDistance * minRepDistance + 1;
+        maxRadius = max(maxRadius, sqrt(maxDistance[i]));
+    }
+    _CandidateGrid grid(centers, maxRadius);
+
+    // layout marker corners in the board plane
+    Point2f layoutCorners[4][4];
+    for(int k = 0; k < 4; k++)
+        for(int c = 0; c < 4; c++)
+            layoutCorners[k][c] = Point2f(_charucoDiamondLayout->objPoints[k][c].x,
+                                          _charucoDiamondLayout->objPoints[k][c].y);
+
+    // neighbourhood graph: for each marker taken as the top marker of a diamond, the markers close
+    // enough to the position of the other three layout markers, predicted with its homography.
+    // The edges do not depend on the assignments, so they are computed in parallel
+    vector< vector< _DiamondCandidate > > candidates(nMarkers);
+    parallel_for_(Range(0, nMarkers), [&](const Range &range) {
+        vector< int > neighbours;
+        for(int i = range.start; i < range.end; i++) {
+            Matx33d H = getPerspectiveTransform(layoutCorners[0], &markers[i][0]);
+            for(int slot = 1; slot < 4; slot++) {
+                Point2f predicted[4];
+                Point2f predictedCenter(0, 0);
+                for(int c = 0; c < 4; c++) {
+                    double x = layoutCorners[slot][c].x, y = layoutCorners[slot][c].y;
+                    double w = H(2, 0) * x + H(2, 1) * y + H(2, 2);
+                    w = std::abs(w) > DBL_EPSILON ? 1. / w : 0;
+                    predicted[c] = Point2f((float)((H(0, 0) * x + H(0, 1) * y + H(0, 2)) * w),
+                                           (float)((H(1, 0) * x + H(1, 1) * y + H(1, 2)) * w));
+                    predictedCenter += predicted[c] * 0.25f;
+                }
 
-        int currentId = _markerIds.getMat().at< int >(i);
-
-        // prepare data to call refineDetectedMarkers()
-        // detected markers (only the current one)
-        vector< Mat > currentMarker;
-        vector< int > currentMarkerId;
-        currentMarker.push_back(_markerCorners.getMat(i));
-        currentMarkerId.push_back(currentId);
-
-        // marker candidates (the rest of markers if they have not been assigned)
-        vector< Mat > candidates;
-        vector< int > candidatesIdxs;
-        for(unsigned int k = 0; k < assigned.size(); k++) {
-            if(k == i) continue;
-            if(!assigned[k]) {
-                candidates.push_back(_markerCorners.getMat(k));
-                candidatesIdxs.push_back(k);
+                // if all the corners are within the distance, so is the center
+                neighbours.clear();
+                grid.query(predictedCenter, neighbours);
+                for(size_t n = 0; n < neighbours.size(); n++) {
+                    int j = neighbours[n];
+                    if(j == i) continue;
+                    double distance = 0;
+                    for(int c = 0; c < 4; c++) {
+                        Point2f distVector = predicted[c] - markers[j][c];
+                        distance = max(distance, (double)distVector.dot(distVector));
+                    }
+                    if(distance < maxDistance[i]) {
+                        _DiamondCandidate candidate = { slot, j, distance };
+                        candidates[i].push_back(candidate);
+                    }
+                }
             }
+            std::sort(candidates[i].begin(), candidates[i].end(), _diamondCandidateLess);
         }
-        if(candidates.size() < 3) break; // we need at least 3 free markers
-
-        // modify charuco layout id to make sure all the ids are different than current id
-        for(int k = 1; k < 4; k++)
-            _charucoDiamondLayout->ids[k] = currentId + 1 + k;
-        // current id is assigned to [0], so it is the marker on the top
-        _charucoDiamondLayout->ids[0] = currentId;
-
-        // try to find the rest of markers in the diamond
-        vector< int > acceptedIdxs;
-        Ptr<Board> _b = _charucoDiamondLayout.staticCast<Board>();
-        aruco::refineDetectedMarkers(grey, _b,
-                                     currentMarker, currentMarkerId,
-                                     candidates, noArray(), noArray(), minRepDistance, -1, false,
-                                     acceptedIdxs);
-
-        // if found, we have a diamond
-        if(currentMarker.size() == 4) {
-
-            assigned[i] = true;
-
-            // calculate diamond id, acceptedIdxs array indicates the markers taken from candidates
-            // array
-            Vec4i markerId;
-            markerId[0] = currentId;
-            for(int k = 1; k < 4; k++) {
-                int currentMarkerIdx = candidatesIdxs[acceptedIdxs[k - 1]];
-                markerId[k] = _markerIds.getMat().at< int >(currentMarkerIdx);
-                assigned[currentMarkerIdx] = true;
-            }
+    });
+
+    // take the diamonds in the order of the top marker, each slot with its closest free candidate
+    vector< bool > assigned(nMarkers, false);
+    int nFree = nMarkers;
+    vector< Vec4i > diamondMarkers; // indexes of the markers of each diamond, in layout order
+    for(int i = 0; i < nMarkers; i++) {
+        if(assigned[i]) continue;
+        if(nFree - 1 < 3) break; // we need at least 3 free markers
+
+        Vec4i slotMarker(i, -1, -1, -1);
+        for(size_t n = 0; n < candidates[i].size(); n++) {
+            const _DiamondCandidate &candidate = candidates[i][n];
+            if(slotMarker[candidate.slot] != -1 || assigned[candidate.marker]) continue;
+            // a marker cannot fill two slots
+            if(candidate.marker == slotMarker[1] || candidate.marker == slotMarker[2]) continue;
+            slotMarker[candidate.slot] = candidate.marker;
+        }
+        if(slotMarker[1] == -1 || slotMarker[2] == -1 || slotMarker[3] == -1) continue;
 
-            // interpolate the charuco corners of the diamond
-            vector< Point2f > currentMarkerCorners;
-            Mat aux;
-            interpolateCornersCharuco(currentMarker, currentMarkerId, grey, _charucoDiamondLayout,
-                                      currentMarkerCorners, aux, _cameraMatrix, _distCoeffs);
-
-            // if everything is ok, save the diamond
-            if(currentMarkerCorners.size() > 0) {
-                // reorder corners
-                vector< Point2f > currentMarkerCornersReorder;
-                currentMarkerCornersReorder.resize(4);
-                currentMarkerCornersReorder[0] = currentMarkerCorners[2];
-                currentMarkerCornersReorder[1] = currentMarkerCorners[3];
-                currentMarkerCornersReorder[2] = currentMarkerCorners[1];
-                currentMarkerCornersReorder[3] = currentMarkerCorners[0];
-
-                diamondCorners.push_back(currentMarkerCornersReorder);
-                diamondIds.push_back(markerId);
+        for(int k = 0; k < 4; k++)
+            assigned[slotMarker[k]] = true;
+        nFree -= 4;
+        diamondMarkers.push_back(slotMarker);
+    }
+
+    // interpolate the charuco corners of all the diamonds. A diamond is kept only if its four
+    // corners are inside the image
+    const int minDistToBorder = 2; // minimum distance of the corner to the image border
+    Rect innerRect(minDistToBorder, minDistToBorder, grey.cols - 2 * minDistToBorder,
+                   grey.rows - 2 * minDistToBorder);
+    int nDiamonds = (int)diamondMarkers.size();
+    vector< vector< Point2f > > interpolatedCorners(nDiamonds);
+    vector< vector< Size > > subPixWinSizes(nDiamonds);
+    parallel_for_(Range(0, nDiamonds), [&](const Range &range) {
+        for(int d = range.start; d < range.end; d++) {
+            vector< vector< Point2f > > currentMarkers(4);
+            for(int k = 0; k < 4; k++)
+                currentMarkers[k] = markers[diamondMarkers[d][k]];
+
+            vector< Point2f > &currentCorners = interpolatedCorners[d];
+            if(_cameraMatrix.total() != 0) {
+                if(!_getApproxCalibChessboardCorners(currentMarkers, _charucoDiamondLayout->ids,
+                                                     _charucoDiamondLayout, _cameraMatrix,
+                                                     _distCoeffs, currentCorners))
+                    currentCorners.clear();
+            } else {
+                _getLocalHomChessboardCorners(currentMarkers, _charucoDiamondLayout->ids,
+                                              _charucoDiamondLayout, currentCorners);
             }
+            for(size_t c = 0; c < currentCorners.size(); c++) {
+                if(!innerRect.contains(currentCorners[c])) {
+                    currentCorners.clear();
+                    break;
+                }
+            }
+            if(currentCorners.size() != 4) continue;
+            _getMaximumSubPixWindowSizes(currentMarkers, _charucoDiamondLayout->ids,
+                                         currentCorners, _charucoDiamondLayout, subPixWinSizes[d]);
         }
+    });
+
+    // refine the corners of all the diamonds at once
+    vector< Point2f > allCorners;
+    vector< Size > allWinSizes;
+    for(int d = 0; d < nDiamonds; d++) {
+        if(interpolatedCorners[d].size() != 4) continue;
+        allCorners.insert(allCorners.end(), interpolatedCorners[d].begin(), interpolatedCorners[d].end());
+        allWinSizes.insert(allWinSizes.end(), subPixWinSizes[d].begin(), subPixWinSizes[d].end());
+    }
+    _refineChessboardCorners(grey, allCorners, allWinSizes);
+
+    for(int d = 0, k = 0; d < nDiamonds; d++) {
+        if(interpolatedCorners[d].size() != 4) continue;
+        const Point2f *currentMarkerCorners = &allCorners[4 * k++];
+
+        // reorder corners
+        vector< Point2f > currentMarkerCornersReorder(4);
+        currentMarkerCornersReorder[0] = currentMarkerCorners[2];
+        currentMarkerCornersReorder[1] = currentMarkerCorners[3];
+        currentMarkerCornersReorder[2] = currentMarkerCorners[1];
+        currentMarkerCornersReorder[3] = currentMarkerCorners[0];
+        diamondCorners.push_back(currentMarkerCornersReorder);
+
+        Vec4i markerId;
+        for(int j = 0; j < 4; j++)
+            markerId[j] = markerIds.at< int >(diamondMarkers[d][j]);
+        diamondIds.push_back(markerId);
     }
 
 
@@ -845,6 +1145,7 @@ void drawCharucoDiamond(const Ptr<Dictionary> &dictionary, Vec4i ids, int square
     // assign the charuco marker ids
     for(int i = 0; i < 4; i++)
         board->ids[i] = ids[i];
+    board->updateIdIndex();
 
     Size outSize(3 * squareLength + 2 * marginSize, 3 * squareLength + 2 * marginSize);
     board->draw(outSize, _img, marginSize, borderBits);
@@ -42,7 +42,27 @@ the use of this software, even if advised of the possibility of such damage.
 #include <opencv2/imgproc.hpp>
 #include "predefined_dictionaries.hpp"
 #include "predefined_dictionaries_apriltag.hpp"
+#include "marker_kernels.hpp"
 #include "opencv2/core/hal/hal.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <fstream>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 namespace cv {
 namespace aruco {
@@ -50,12 +70,20 @@ namespace aruco {
 using namespace std;
 
 
+static Mutex &_getSearchIndexMutex();
+
+
 /**
   */
 Dictionary::Dictionary(const Ptr<Dictionary> &_dictionary) {
     markerSize = _dictionary->markerSize;
     maxCorrectionBits = _dictionary->maxCorrectionBits;
     bytesList = _dictionary->bytesList.clone();
+    // the index is read-only, and only used while it matches the codes
+    AutoLock lock(_getSearchIndexMutex());
+    searchIndex = _dictionary->searchIndex;
+    searchIndexKey = _dictionary->searchIndexKey;
+    mappedFile = _dictionary->mappedFile;
 }
 
 
@@ -65,6 +93,7 @@ Dictionary::Dictionary(const Mat &_bytesList, int _markerSize, int _maxcorr) {
     markerSize = _markerSize;
     maxCorrectionBits = _maxcorr;
     bytesList = _bytesList;
+    searchIndexKey = 0;
 }
 
 
@@ -92,38 +121,249 @@ Ptr<Dictionary> Dictionary::get(int dict) {
 }
 
 
+/**
+  * Hamming search index. The nbytes*8 bits of a code are split into blocks of at most
+  * DICTIONARY_INDEX_MAX_BITS bits and every block maps each of its values to the markers having
+  * it in any rotation. A candidate within d bits of a marker has the same value in at least one
+  * block if there are more than d blocks, so it only has to be compared to the markers of its
+  * buckets.
+  *
+  * Layout, in int: the number of blocks B, B times (first bit, number of bits, position of the
+  * bucket offsets), the 2^bits + 1 bucket offsets of each block, then the buckets. The markers
+  * of a bucket are in increasing order, once each.
+  */
+static const int DICTIONARY_INDEX_MAX_BITS = 16;
+
+// blocks shorter than this do not discard enough markers to be worth the lookups
+static const int DICTIONARY_INDEX_MIN_BITS = 4;
+
+
+/**
+  * Value of nBits (<= 16) bits of a code, starting from its most significant bit
+  */
+static inline int _getCodeBits(const uchar *code, int firstBit, int nBits) {
+    int lastByte = (firstBit + nBits + 7) / 8;
+    unsigned int value = 0;
+    for(int b = firstBit / 8; b < lastByte; b++)
+        value = (value << 8) | code[b];
+    return int((value >> (8 * lastByte - firstBit - nBits)) & ((1u << nBits) - 1));
+}
+
+
+/**
+  * Distinct values of a block of bits in the 4 rotations of a marker
+  */
+static int _getBlockValues(const uchar *marker, int nbytes, int firstBit, int nBits, int values[4]) {
+    int nValues = 0;
+    for(int r = 0; r < 4; r++) {
+        int value = _getCodeBits(marker + r * nbytes, firstBit, nBits);
+        if(std::find(values, values + nValues, value) == values + nValues) values[nValues++] = value;
+    }
+    return nValues;
+}
+
+
+/**
+  */
+static Mat _buildSearchIndex(const Mat &bytesList, int maxCorrectionBits) {
+
+    int nbytes = bytesList.cols;
+    int codeBits = 8 * nbytes;
+    int nBlocks = max(maxCorrectionBits + 1, (codeBits + DICTIONARY_INDEX_MAX_BITS - 1) / DICTIONARY_INDEX_MAX_BITS);
+    if(bytesList.empty() || codeBits / nBlocks < DICTIONARY_INDEX_MIN_BITS) return Mat();
+
+    vector< int > index(1 + 3 * nBlocks);
+    index[0] = nBlocks;
+    for(int k = 0; k < nBlocks; k++) {
+        int firstBit = k * codeBits / nBlocks;
+        index[1 + 3 * k] = firstBit;
+        index[2 + 3 * k] = (k + 1) * codeBits / nBlocks - firstBit;
+        index[3 + 3 * k] = (int)index.size();
+        index.resize(index.size() + (1 << index[2 + 3 * k]) + 1, 0);
+    }
+
+    // bucket sizes, then offsets. The buckets follow the offsets
+    int values[4];
+    int position = (int)index.size();
+    for(int k = 0; k < nBlocks; k++) {
+        int firstBit = index[1 + 3 * k], nBits = index[2 + 3 * k], offsetsPos = index[3 + 3 * k];
+        for(int m = 0; m < bytesList.rows; m++) {
+            int nValues = _getBlockValues(bytesList.ptr(m), nbytes, firstBit, nBits, values);
+            for(int v = 0; v < nValues; v++)
+                index[offsetsPos + 1 + values[v]]++;
+        }
+        for(int v = 0; v <= (1 << nBits); v++) {
+            position += index[offsetsPos + v];
+            index[offsetsPos + v] = position;
+        }
+    }
+    index.resize(position);
+
+    // fill the buckets in marker order
+    for(int k = 0; k < nBlocks; k++) {
+        int firstBit = index[1 + 3 * k], nBits = index[2 + 3 * k], offsetsPos = index[3 + 3 * k];
+        vector< int > next(index.begin() + offsetsPos, index.begin() + offsetsPos + (1 << nBits));
+        for(int m = 0; m < bytesList.rows; m++) {
+            int nValues = _getBlockValues(bytesList.ptr(m), nbytes, firstBit, nBits, values);
+            for(int v = 0; v < nValues; v++)
+                index[next[values[v]]++] = m;
+        }
+    }
+
+    return Mat(1, (int)index.size(), CV_32SC1, &index[0]).clone();
+}
+
+
+/**
+  * Check that an index read from a file cannot make identify() read out of bounds
+  */
+static bool _checkSearchIndex(const int *index, size_t size, int nMarkers, int codeBits) {
+
+    if(size < 1) return false;
+    int nBlocks = index[0];
+    if(nBlocks < 1 || nBlocks > codeBits || size < 1 + 3 * (size_t)nBlocks) return false;
+    for(int k = 0; k < nBlocks; k++) {
+        int firstBit = index[1 + 3 * k], nBits = index[2 + 3 * k], offsetsPos = index[3 + 3 * k];
+        if(firstBit < 0 || nBits < 1 || nBits > DICTIONARY_INDEX_MAX_BITS || firstBit + nBits > codeBits ||
+           offsetsPos < 1 + 3 * nBlocks || (size_t)offsetsPos + (1 << nBits) + 1 > size)
+            return false;
+        const int *offsets = index + offsetsPos;
+        for(int v = 0; v < (1 << nBits); v++) {
+            if(offsets[v] < 0 || offsets[v] > offsets[v + 1] || (size_t)offsets[v + 1] > size) return false;
+            for(int e = offsets[v]; e < offsets[v + 1]; e++) {
+                if(index[e] < 0 || index[e] >= nMarkers || (e > offsets[v] && index[e] <= index[e - 1]))
+                    return false;
+            }
+        }
+    }
+    return true;
+}
+
+
+/**
+  * Distance of a candidate to the closest rotation of a marker
+  */
+static inline int _getMarkerDistance(const uchar *marker, const uchar *candidate, int nbytes, int markerSize,
+                                     int &rotation) {
+    int minDistance = markerSize * markerSize + 1;
+    rotation = -1;
+    for(int r = 0; r < 4; r++) {
+        int currentHamming = cv::hal::normHamming(marker + r * nbytes, candidate, nbytes);
+        if(currentHamming < minDistance) {
+            minDistance = currentHamming;
+            rotation = r;
+        }
+    }
+    return minDistance;
+}
+
+
+/**
+  * Fingerprint of the codes of a dictionary and of its maxCorrectionBits, which the search index
+  * depends on. FNV-1a on 64 bits words: every step is a bijection, so changing a single word always
+  * changes the fingerprint
+  */
+static uint64 _getCodesKey(const Mat &bytesList, int maxCorrectionBits) {
+
+    const uint64 prime = 0x100000001b3ULL;
+    uint64 key = 0xcbf29ce484222325ULL;
+    key = (key ^ (uint64)bytesList.rows) * prime;
+    key = (key ^ (uint64)bytesList.cols) * prime;
+    key = (key ^ (uint64)bytesList.type()) * prime;
+    key = (key ^ (uint64)maxCorrectionBits) * prime;
+
+    size_t rowBytes = bytesList.cols * bytesList.elemSize();
+    for(int m = 0; m < bytesList.rows; m++) {
+        const uchar *row = bytesList.ptr(m);
+        size_t b = 0;
+        for(; b + 8 <= rowBytes; b += 8) {
+            uint64 word;
+            memcpy(&word, row + b, 8);
+            key = (key ^ word) * prime;
+        }
+        for(; b < rowBytes; b++)
+            key = (key ^ row[b]) * prime;
+    }
+    return key;
+}
+
+
+/**
+  * Guards the search index of the dictionaries, which detectMarkers may rebuild
+  */
+static Mutex &_getSearchIndexMutex() {
+    static Mutex mutex;
+    return mutex;
+}
+
+
+/**
+  * Search index of a dictionary if it still describes its codes, empty otherwise
+  */
+static Mat _getSearchIndex(const Dictionary &dictionary) {
+    uint64 key = _getCodesKey(dictionary.bytesList, dictionary.maxCorrectionBits);
+    AutoLock lock(_getSearchIndexMutex());
+    return key == dictionary.searchIndexKey ? dictionary.searchIndex : Mat();
+}
+
+
 /**
  */
-bool Dictionary::identify(const Mat &onlyBits, int &idx, int &rotation,
-                          double maxCorrectionRate) const {
+Mat _updateSearchIndex(Dictionary &dictionary) {
+    uint64 key = _getCodesKey(dictionary.bytesList, dictionary.maxCorrectionBits);
+    AutoLock lock(_getSearchIndexMutex());
+    if(!dictionary.searchIndex.empty() && key != dictionary.searchIndexKey) {
+        dictionary.searchIndex = _buildSearchIndex(dictionary.bytesList, dictionary.maxCorrectionBits);
+        dictionary.searchIndexKey = key;
+    }
+    return dictionary.searchIndex;
+}
 
-    CV_Assert(onlyBits.rows == markerSize && onlyBits.cols == markerSize);
 
-    int maxCorrectionRecalculed = int(double(maxCorrectionBits) * maxCorrectionRate);
+/**
+ */
+bool _identifyCode(const Dictionary &dictionary, const Mat &searchIndex, const uchar *candidate,
+                   int maxCorrection, int &idx, int &rotation) {
 
-    // get as a byte list
-    Mat candidateBytes = getByteListFromBits(onlyBits);
+    const Mat &bytesList = dictionary.bytesList;
+    int markerSize = dictionary.markerSize;
+    int nbytes = (markerSize * markerSize + 7) / 8;
 
     idx = -1; // by default, not found
 
-    // search closest marker in dict
-    for(int m = 0; m < bytesList.rows; m++) {
-        int currentMinDistance = markerSize * markerSize + 1;
-        int currentRotation = -1;
-        for(unsigned int r = 0; r < 4; r++) {
-            int currentHamming = cv::hal::normHamming(
-                    bytesList.ptr(m)+r*candidateBytes.cols,
-                    candidateBytes.ptr(),
-                    candidateBytes.cols);
-
-            if(currentHamming < currentMinDistance) {
-                currentMinDistance = currentHamming;
-                currentRotation = r;
+    const int *index = searchIndex.empty() ? 0 : searchIndex.ptr< int >();
+    if(index != 0 && maxCorrection < index[0]) {
+        // only the markers sharing a block with the candidate can be close enough. Keep the lowest
+        // id as the linear search, the buckets are sorted
+        for(int k = 0; k < index[0]; k++) {
+            const int *block = index + 1 + 3 * k;
+            const int *offsets = index + block[2] + _getCodeBits(candidate, block[0], block[1]);
+            for(int e = offsets[0]; e < offsets[1]; e++) {
+                int m = index[e];
+                if(m >= bytesList.rows || (idx != -1 && m >= idx)) break;
+                int currentRotation;
+                if(_getMarkerDistance(bytesList.ptr(m), candidate, nbytes, markerSize, currentRotation) <=
+                   maxCorrection) {
+                    idx = m;
+                    rotation = currentRotation;
+                    break;
+                }
             }
         }
+        return idx != -1;
+    }
+
+    const _CodeKernel *kernel = _getCodeKernel(markerSize);
+    if(kernel != NULL && (bytesList.empty() || bytesList.cols == nbytes))
+        return kernel->identify(bytesList, candidate, maxCorrection, idx, rotation);
+
+    // search closest marker in dict
+    for(int m = 0; m < bytesList.rows; m++) {
+        int currentRotation;
+        int currentMinDistance = _getMarkerDistance(bytesList.ptr(m), candidate, nbytes, markerSize, currentRotation);
 
         // if maxCorrection is fulfilled, return this one
-        if(currentMinDistance <= maxCorrectionRecalculed) {
+        if(currentMinDistance <= maxCorrection) {
             idx = m;
             rotation = currentRotation;
             break;
@@ -134,6 +374,183 @@ bool Dictionary::identify(const Mat &onlyBits, int &idx, int &rotation,
 }
 
 
+/**
+ */
+bool Dictionary::identify(const Mat &onlyBits, int &idx, int &rotation,
+                          double maxCorrectionRate) const {
+
+    CV_Assert(onlyBits.rows == markerSize && onlyBits.cols == markerSize);
+
+    int maxCorrectionRecalculed = int(double(maxCorrectionBits) * maxCorrectionRate);
+
+    // get as a byte list
+    Mat candidateBytes = getByteListFromBits(onlyBits);
+
+    return _identifyCode(*this, _getSearchIndex(*this), candidateBytes.ptr(), maxCorrectionRecalculed, idx,
+                         rotation);
+}
+
+
+/**
+ */
+void Dictionary::buildSearchIndex() {
+    CV_Assert(bytesList.empty() || bytesList.type() == CV_8UC4);
+    Mat index = _buildSearchIndex(bytesList, maxCorrectionBits);
+    uint64 key = _getCodesKey(bytesList, maxCorrectionBits);
+    AutoLock lock(_getSearchIndexMutex());
+    searchIndex = index;
+    searchIndexKey = key;
+}
+
+
+/**
+  * Binary dictionary files start with this header, in little endian. It is followed by the codes
+  * with the layout of bytesList, padded to a multiple of 4 bytes, then by the search index
+  */
+struct _DictionaryFileHeader {
+    char magic[4];         // "ARDC"
+    int version;
+    int markerSize;
+    int maxCorrectionBits;
+    int nMarkers;
+    int nbytes;            // bytes of a code in one rotation
+    int indexSize;         // number of int of the search index, 0 without index
+    int reserved;
+};
+
+static const char DICTIONARY_FILE_MAGIC[4] = { 'A', 'R', 'D', 'C' };
+static const int DICTIONARY_FILE_VERSION = 1;
+
+// upper bound of the marker size of a dictionary file, to reject corrupted files
+static const int DICTIONARY_FILE_MAX_MARKER_SIZE = 64;
+
+
+/**
+  * Copy-on-write memory mapping of a whole file, kept alive by the dictionaries loaded from it. The
+  * pages are shared until they are written, the writes are private to the process
+  */
+struct _MappedFile {
+    char *data;
+    size_t size;
+
+    _MappedFile() : data(0), size(0) {}
+
+    ~_MappedFile() {
+        if(data == 0) return;
+#ifdef _WIN32
+        UnmapViewOfFile(data);
+#else
+        munmap((void *)data, size);
+#endif
+    }
+
+    bool open(const String &filename) {
+        CV_Assert(data == 0);
+        // the handles can be closed once the view is mapped
+#ifdef _WIN32
+        HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL, NULL);
+        if(file == INVALID_HANDLE_VALUE) return false;
+        LARGE_INTEGER fileSize;
+        HANDLE mapping = NULL;
+        if(GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0) {
+            mapping = CreateFileMappingA(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+            if(mapping != NULL) {
+                data = (char *)MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+                size = data == 0 ? 0 : (size_t)fileSize.QuadPart;
+                CloseHandle(mapping);
+            }
+        }
+        CloseHandle(file);
+#else
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if(fd < 0) return false;
+        struct stat info;
+        if(fstat(fd, &info) == 0 && info.st_size > 0) {
+            void *address = mmap(NULL, (size_t)info.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            if(address != MAP_FAILED) {
+                data = (char *)address;
+                size = (size_t)info.st_size;
+            }
+        }
+        ::close(fd);
+#endif
+        return data != 0;
+    }
+};
+
+
+/**
+ */
+bool Dictionary::save(const String &filename, bool buildIndex) const {
+
+    Mat codes = bytesList.isContinuous() ? bytesList : bytesList.clone();
+    int nbytes = (markerSize * markerSize + 7) / 8;
+    CV_Assert(codes.empty() || (codes.type() == CV_8UC4 && codes.cols == nbytes));
+    Mat index;
+    if(buildIndex) index = _buildSearchIndex(codes, maxCorrectionBits);
+
+    ofstream out(filename.c_str(), ios::binary | ios::trunc);
+    if(!out.is_open()) return false;
+
+    _DictionaryFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, DICTIONARY_FILE_MAGIC, 4);
+    header.version = DICTIONARY_FILE_VERSION;
+    header.markerSize = markerSize;
+    header.maxCorrectionBits = maxCorrectionBits;
+    header.nMarkers = codes.rows;
+    header.nbytes = nbytes;
+    header.indexSize = (int)index.total();
+    out.write((const char *)&header, sizeof(header));
+
+    size_t codesSize = codes.total() * codes.elemSize();
+    const char padding[4] = { 0, 0, 0, 0 };
+    if(codesSize > 0) out.write((const char *)codes.data, codesSize);
+    out.write(padding, alignSize(codesSize, 4) - codesSize);
+    if(!index.empty()) out.write((const char *)index.data, index.total() * sizeof(int));
+
+    out.close();
+    return !out.fail();
+}
+
+
+/**
+ */
+Ptr<Dictionary> Dictionary::load(const String &filename) {
+
+    Ptr<_MappedFile> file = makePtr<_MappedFile>();
+    if(!file->open(filename) || file->size < sizeof(_DictionaryFileHeader)) return Ptr<Dictionary>();
+
+    const _DictionaryFileHeader *header = (const _DictionaryFileHeader *)file->data;
+    if(memcmp(header->magic, DICTIONARY_FILE_MAGIC, 4) != 0 || header->version != DICTIONARY_FILE_VERSION ||
+       header->markerSize <= 0 || header->markerSize > DICTIONARY_FILE_MAX_MARKER_SIZE ||
+       header->nbytes != (header->markerSize * header->markerSize + 7) / 8 || header->maxCorrectionBits < 0 ||
+       header->nMarkers < 0 || header->indexSize < 0)
+        return Ptr<Dictionary>();
+
+    size_t codesSize = (size_t)header->nMarkers * 4 * header->nbytes;
+    size_t indexPos = sizeof(_DictionaryFileHeader) + alignSize(codesSize, 4);
+    if(file->size != indexPos + (size_t)header->indexSize * sizeof(int)) return Ptr<Dictionary>();
+    const int *index = (const int *)(file->data + indexPos);
+    if(header->indexSize > 0 && !_checkSearchIndex(index, header->indexSize, header->nMarkers, 8 * header->nbytes))
+        return Ptr<Dictionary>();
+
+    // the mats point into the mapping
+    Ptr<Dictionary> res = makePtr<Dictionary>();
+    res->markerSize = header->markerSize;
+    res->maxCorrectionBits = header->maxCorrectionBits;
+    if(header->nMarkers > 0)
+        res->bytesList = Mat(header->nMarkers, header->nbytes, CV_8UC4,
+                             (void *)(file->data + sizeof(_DictionaryFileHeader)));
+    if(header->indexSize > 0)
+        res->searchIndex = Mat(1, header->indexSize, CV_32SC1, (void *)index);
+    res->searchIndexKey = _getCodesKey(res->bytesList, res->maxCorrectionBits);
+    res->mappedFile = file;
+    return res;
+}
+
+
 /**
   */
 int Dictionary::getDistanceToId(InputArray bits, int id, bool allRotations) const {
@@ -196,6 +613,13 @@ Mat Dictionary::getByteListFromBits(const Mat &bits) {
     int nbytes = (bits.cols * bits.rows + 8 - 1) / 8;
 
     Mat candidateByteList(1, nbytes, CV_8UC4, Scalar::all(0));
+
+    const _CodeKernel *kernel = bits.rows == bits.cols && bits.type() == CV_8UC1 ? _getCodeKernel(bits.rows) : NULL;
+    if(kernel != NULL) {
+        kernel->getByteListFromBits(bits, candidateByteList.ptr());
+        return candidateByteList;
+    }
+
     unsigned char currentBit = 0;
     int currentByte = 0;
 
@@ -268,89 +692,82 @@ Mat Dictionary::getBitsFromByteList(const Mat &byteList, int markerSize) {
 
 
 
+/**
+  * Codes of a predefined family of markers in the bytesList layout
+  */
+static Mat _unpackPredefinedCodes(const uint64 (*codes)[4], int nMarkers, int markerSize) {
+    int nbits = markerSize * markerSize;
+    int nbytes = (nbits + 7) / 8;
+    Mat bytesList(nMarkers, nbytes, CV_8UC4);
+    for(int i = 0; i < nMarkers; i++) {
+        for(int r = 0; r < 4; r++) {
+            // whole bytes first, the remaining bits in the low bits of the last byte
+            uchar *bytes = bytesList.ptr(i) + r * nbytes;
+            for(int j = 0; j < nbytes - 1; j++)
+                bytes[j] = (uchar)(codes[i][r] >> (nbits - 8 * (j + 1)));
+            bytes[nbytes - 1] = (uchar)(codes[i][r] & ((uint64(1) << (nbits - 8 * (nbytes - 1))) - 1));
+        }
+    }
+    return bytesList;
+}
+
+
 Ptr<Dictionary> getPredefinedDictionary(PREDEFINED_DICTIONARY_NAME name)
 {
-    // DictionaryData constructors calls
-    //    moved out of globals so construted on first use, which allows lazy-loading of opencv dll
-    static const Dictionary DICT_ARUCO_DATA = Dictionary(Mat(1024, (5 * 5 + 7) / 8, CV_8UC4, (uchar*)DICT_ARUCO_BYTES), 5, 0);
-
-    static const Dictionary DICT_4X4_50_DATA = Dictionary(Mat(50, (4 * 4 + 7) / 8, CV_8UC4, (uchar*)DICT_4X4_1000_BYTES), 4, 1);
-    static const Dictionary DICT_4X4_100_DATA = Dictionary(Mat(100, (4 * 4 + 7) / 8, CV_8UC4, (uchar*)DICT_4X4_1000_BYTES), 4, 1);
-    static const Dictionary DICT_4X4_250_DATA = Dictionary(Mat(250, (4 * 4 + 7) / 8, CV_8UC4, (uchar*)DICT_4X4_1000_BYTES), 4, 1);
-    static const Dictionary DICT_4X4_1000_DATA = Dictionary(Mat(1000, (4 * 4 + 7) / 8, CV_8UC4, (uchar*)DICT_4X4_1000_BYTES), 4, 0);
-
-    static const Dictionary DICT_5X5_50_DATA = Dictionary(Mat(50, (5 * 5 + 7) / 8, CV_8UC4, (uchar*)DICT_5X5_1000_BYTES), 5, 3);
-    static const Dictionary DICT_5X5_100_DATA = Dictionary(Mat(100, (5 * 5 + 7) / 8, CV_8UC4, (uchar*)DICT_5X5_1000_BYTES), 5, 3);
-    static const Dictionary DICT_5X5_250_DATA = Dictionary(Mat(250, (5 * 5 + 7) / 8, CV_8UC4, (uchar*)DICT_5X5_1000_BYTES), 5, 2);
-    static const Dictionary DICT_5X5_1000_DATA = Dictionary(Mat(1000, (5 * 5 + 7) / 8, CV_8UC4, (uchar*)DICT_5X5_1000_BYTES), 5, 2);
-
-    static const Dictionary DICT_6X6_50_DATA = Dictionary(Mat(50, (6 * 6 + 7) / 8, CV_8UC4, (uchar*)DICT_6X6_1000_BYTES), 6, 6);
-    static const Dictionary DICT_6X6_100_DATA = Dictionary(Mat(100, (6 * 6 + 7) / 8, CV_8UC4, (uchar*)DICT_6X6_1000_BYTES), 6, 5);
-    static const Dictionary DICT_6X6_250_DATA = Dictionary(Mat(250, (6 * 6 + 7) / 8, CV_8UC4, (uchar*)DICT_6X6_1000_BYTES), 6, 5);
-    static const Dictionary DICT_6X6_1000_DATA = Dictionary(Mat(1000, (6 * 6 + 7) / 8, CV_8UC4, (uchar*)DICT_6X6_1000_BYTES), 6, 4);
-
-    static const Dictionary DICT_7X7_50_DATA = Dictionary(Mat(50, (7 * 7 + 7) / 8, CV_8UC4, (uchar*)DICT_7X7_1000_BYTES), 7, 9);
-    static const Dictionary DICT_7X7_100_DATA = Dictionary(Mat(100, (7 * 7 + 7) / 8, CV_8UC4, (uchar*)DICT_7X7_1000_BYTES), 7, 8);
-    static const Dictionary DICT_7X7_250_DATA = Dictionary(Mat(250, (7 * 7 + 7) / 8, CV_8UC4, (uchar*)DICT_7X7_1000_BYTES), 7, 8);
-    static const Dictionary DICT_7X7_1000_DATA = Dictionary(Mat(1000, (7 * 7 + 7) / 8, CV_8UC4, (uchar*)DICT_7X7_1000_BYTES), 7, 6);
-
-    static const Dictionary DICT_APRILTAG_16h5_DATA = Dictionary(Mat(30, (4 * 4 + 7) / 8, CV_8UC4, (uchar*)DICT_APRILTAG_16h5_BYTES), 4, 0);
-    static const Dictionary DICT_APRILTAG_25h9_DATA = Dictionary(Mat(35, (5 * 5 + 7) / 8, CV_8UC4, (uchar*)DICT_APRILTAG_25h9_BYTES), 5, 0);
-    static const Dictionary DICT_APRILTAG_36h10_DATA = Dictionary(Mat(2320, (6 * 6 + 7) / 8, CV_8UC4, (uchar*)DICT_APRILTAG_36h10_BYTES), 6, 0);
-    static const Dictionary DICT_APRILTAG_36h11_DATA = Dictionary(Mat(587, (6 * 6 + 7) / 8, CV_8UC4, (uchar*)DICT_APRILTAG_36h11_BYTES), 6, 0);
-
-    switch(name) {
-
-    case DICT_ARUCO_ORIGINAL:
-        return makePtr<Dictionary>(DICT_ARUCO_DATA);
-
-    case DICT_4X4_50:
-        return makePtr<Dictionary>(DICT_4X4_50_DATA);
-    case DICT_4X4_100:
-        return makePtr<Dictionary>(DICT_4X4_100_DATA);
-    case DICT_4X4_250:
-        return makePtr<Dictionary>(DICT_4X4_250_DATA);
-    case DICT_4X4_1000:
-        return makePtr<Dictionary>(DICT_4X4_1000_DATA);
-
-    case DICT_5X5_50:
-        return makePtr<Dictionary>(DICT_5X5_50_DATA);
-    case DICT_5X5_100:
-        return makePtr<Dictionary>(DICT_5X5_100_DATA);
-    case DICT_5X5_250:
-        return makePtr<Dictionary>(DICT_5X5_250_DATA);
-    case DICT_5X5_1000:
-        return makePtr<Dictionary>(DICT_5X5_1000_DATA);
-
-    case DICT_6X6_50:
-        return makePtr<Dictionary>(DICT_6X6_50_DATA);
-    case DICT_6X6_100:
-        return makePtr<Dictionary>(DICT_6X6_100_DATA);
-    case DICT_6X6_250:
-        return makePtr<Dictionary>(DICT_6X6_250_DATA);
-    case DICT_6X6_1000:
-        return makePtr<Dictionary>(DICT_6X6_1000_DATA);
-
-    case DICT_7X7_50:
-        return makePtr<Dictionary>(DICT_7X7_50_DATA);
-    case DICT_7X7_100:
-        return makePtr<Dictionary>(DICT_7X7_100_DATA);
-    case DICT_7X7_250:
-        return makePtr<Dictionary>(DICT_7X7_250_DATA);
-    case DICT_7X7_1000:
-        return makePtr<Dictionary>(DICT_7X7_1000_DATA);
-
-    case DICT_APRILTAG_16h5:
-        return makePtr<Dictionary>(DICT_APRILTAG_16h5_DATA);
-    case DICT_APRILTAG_25h9:
-        return makePtr<Dictionary>(DICT_APRILTAG_25h9_DATA);
-    case DICT_APRILTAG_36h10:
-        return makePtr<Dictionary>(DICT_APRILTAG_36h10_DATA);
-    case DICT_APRILTAG_36h11:
-        return makePtr<Dictionary>(DICT_APRILTAG_36h11_DATA);
-
+    struct Family {
+        const uint64 (*codes)[4];
+        int nMarkers;
+        int markerSize;
+    };
+    static const Family families[] = {
+        { DICT_4X4_1000_CODES, int(sizeof(DICT_4X4_1000_CODES) / sizeof(DICT_4X4_1000_CODES[0])), 4 },
+        { DICT_5X5_1000_CODES, int(sizeof(DICT_5X5_1000_CODES) / sizeof(DICT_5X5_1000_CODES[0])), 5 },
+        { DICT_6X6_1000_CODES, int(sizeof(DICT_6X6_1000_CODES) / sizeof(DICT_6X6_1000_CODES[0])), 6 },
+        { DICT_7X7_1000_CODES, int(sizeof(DICT_7X7_1000_CODES) / sizeof(DICT_7X7_1000_CODES[0])), 7 },
+        { DICT_ARUCO_CODES, int(sizeof(DICT_ARUCO_CODES) / sizeof(DICT_ARUCO_CODES[0])), 5 },
+        { DICT_APRILTAG_16h5_CODES, int(sizeof(DICT_APRILTAG_16h5_CODES) / sizeof(DICT_APRILTAG_16h5_CODES[0])), 4 },
+        { DICT_APRILTAG_25h9_CODES, int(sizeof(DICT_APRILTAG_25h9_CODES) / sizeof(DICT_APRILTAG_25h9_CODES[0])), 5 },
+        { DICT_APRILTAG_36h10_CODES, int(sizeof(DICT_APRILTAG_36h10_CODES) / sizeof(DICT_APRILTAG_36h10_CODES[0])), 6 },
+        { DICT_APRILTAG_36h11_CODES, int(sizeof(DICT_APRILTAG_36h11_CODES) / sizeof(DICT_APRILTAG_36h11_CODES[0])), 6 }
+    };
+
+    // the first nMarkers markers of a family, in the order of PREDEFINED_DICTIONARY_NAME
+    struct Predefined {
+        int family;
+        int nMarkers;
+        int maxCorrectionBits;
+    };
+    static const Predefined predefined[] = {
+        { 0, 50, 1 }, { 0, 100, 1 }, { 0, 250, 1 }, { 0, 1000, 0 },
+        { 1, 50, 3 }, { 1, 100, 3 }, { 1, 250, 2 }, { 1, 1000, 2 },
+        { 2, 50, 6 }, { 2, 100, 5 }, { 2, 250, 5 }, { 2, 1000, 4 },
+        { 3, 50, 9 }, { 3, 100, 8 }, { 3, 250, 8 }, { 3, 1000, 6 },
+        { 4, 1024, 0 },
+        { 5, 30, 0 }, { 6, 35, 0 }, { 7, 2320, 0 }, { 8, 587, 0 }
+    };
+    static const int nFamilies = int(sizeof(families) / sizeof(families[0]));
+    static const int nPredefined = int(sizeof(predefined) / sizeof(predefined[0]));
+
+    int dict = name >= 0 && name < nPredefined ? int(name) : int(DICT_4X4_50);
+
+    // constructed on first use, which allows lazy-loading of opencv dll. They are never handed out:
+    // the dictionaries of a family share its codes and the index is only built once. Every call
+    // returns a copy of the codes, with the read-only index
+    static Mutex mutex;
+    static Mat familyBytes[nFamilies];
+    static Ptr<Dictionary> dictionaries[nPredefined];
+    AutoLock lock(mutex);
+    if(!dictionaries[dict]) {
+        const Predefined &p = predefined[dict];
+        const Family &family = families[p.family];
+        if(familyBytes[p.family].empty())
+            familyBytes[p.family] = _unpackPredefinedCodes(family.codes, family.nMarkers, family.markerSize);
+        Ptr<Dictionary> res = makePtr<Dictionary>(familyBytes[p.family].rowRange(0, p.nMarkers), family.markerSize,
+                                                  p.maxCorrectionBits);
+        res->buildSearchIndex();
+        dictionaries[dict] = res;
     }
-    return makePtr<Dictionary>(DICT_4X4_50_DATA);
+    return makePtr<Dictionary>(dictionaries[dict]);
 }
 
 
@@ -374,21 +791,79 @@ static Mat _generateRandomMarker(int markerSize, RNG &rng) {
 }
 
 /**
- * @brief Calculate selfDistance of the codification of a marker Mat. Self distance is the Hamming
- * distance of the marker to itself in the other rotations.
- * See S. Garrido-Jurado, R. Muñoz-Salinas, F. J. Madrid-Cuevas, and M. J. Marín-Jiménez. 2014.
- * "Automatic generation and detection of highly reliable fiducial markers under occlusion".
- * Pattern Recogn. 47, 6 (June 2014), 2280-2292. DOI=10.1016/j.patcog.2014.01.005
+ * @brief Marker codes packed in 64 bits words, with the four rotations of each marker
  */
-static int _getSelfDistance(const Mat &marker) {
-    Mat bytes = Dictionary::getByteListFromBits(marker);
-    int minHamming = (int)marker.total() + 1;
-    for(int r = 1; r < 4; r++) {
-        int currentHamming = cv::hal::normHamming(bytes.ptr(), bytes.ptr() + bytes.cols*r, bytes.cols);
-        if(currentHamming < minHamming) minHamming = currentHamming;
+struct _PackedCodes {
+    int nWords; // words per rotation
+    vector< uint64 > words; // marker i, rotation r starts at words[(4 * i + r) * nWords]
+
+    explicit _PackedCodes(int markerSize) : nWords((markerSize * markerSize + 63) / 64) {}
+
+    int size() const { return (int)(words.size() / (4 * nWords)); }
+
+    const uint64 *get(int marker, int rotation) const {
+        return &words[(4 * marker + rotation) * nWords];
+    }
+
+    /** @brief Add a marker from its bits, in the order of the rotations of getByteListFromBits */
+    void push_back(const Mat &bits) {
+        int n = bits.rows;
+        size_t first = words.size();
+        words.resize(first + 4 * nWords, 0);
+        for(int r = 0; r < 4; r++) {
+            uint64 *code = &words[first + r * nWords];
+            for(int i = 0; i < n; i++) {
+                for(int j = 0; j < n; j++) {
+                    // bit (i, j) of rotation r, as getByteListFromBits: rotation 1 is
+                    // bits(j, n - 1 - i), i.e. the marker rotated 90 degrees counterclockwise
+                    int y = i, x = j;
+                    for(int k = 0; k < r; k++) {
+                        int t = x;
+                        x = n - 1 - y;
+                        y = t;
+                    }
+                    if(bits.at< unsigned char >(y, x)) {
+                        int b = i * n + j;
+                        code[b / 64] |= uint64(1) << (b % 64);
+                    }
+                }
+            }
+        }
     }
-    return minHamming;
-}
+
+    /** @brief Hamming distance between two codes */
+    int distance(const uint64 *a, const uint64 *b) const {
+        int d = 0;
+        for(int w = 0; w < nWords; w++)
+            d += _popCount64(a[w] ^ b[w]);
+        return d;
+    }
+
+    /**
+     * @brief Self distance of a marker, the Hamming distance of the marker to itself in the other
+     * rotations.
+     * See S. Garrido-Jurado, R. Muñoz-Salinas, F. J. Madrid-Cuevas, and M. J. Marín-Jiménez. 2014.
+     * "Automatic generation and detection of highly reliable fiducial markers under occlusion".
+     * Pattern Recogn. 47, 6 (June 2014), 2280-2292. DOI=10.1016/j.patcog.2014.01.005
+     */
+    int selfDistance(int marker) const {
+        int minHamming = INT_MAX;
+        for(int r = 1; r < 4; r++)
+            minHamming = min(minHamming, distance(get(marker, 0), get(marker, r)));
+        return minHamming;
+    }
+
+    /**
+     * @brief Minimum of minDistance and the distances from a code to the markers [first, last) in
+     * any rotation, same as getDistanceToId(). Stops as soon as it is not larger than threshold.
+     */
+    int minDistance(const uint64 *code, int first, int last, int minDistance, int threshold) const {
+        for(int i = first; i < last && minDistance > threshold; i++)
+            for(int r = 0; r < 4; r++)
+                minDistance = min(minDistance, distance(code, get(i, r)));
+        return minDistance;
+    }
+};
 
 /**
  */
@@ -399,6 +874,9 @@ Ptr<Dictionary> generateCustomDictionary(int nMarkers, int markerSize,
     Ptr<Dictionary> out = makePtr<Dictionary>();
     out->markerSize = markerSize;
 
+    // accepted markers, packed
+    _PackedCodes accepted(markerSize);
+
     // theoretical maximum intermarker distance
     // See S. Garrido-Jurado, R. Muñoz-Salinas, F. J. Madrid-Cuevas, and M. J. Marín-Jiménez. 2014.
     // "Automatic generation and detection of highly reliable fiducial markers under occlusion".
@@ -411,15 +889,19 @@ Ptr<Dictionary> generateCustomDictionary(int nMarkers, int markerSize,
         CV_Assert(baseDictionary->markerSize == markerSize);
         out->bytesList = baseDictionary->bytesList.clone();
 
+        int nBase = out->bytesList.rows;
+        for(int i = 0; i < nBase; i++)
+            accepted.push_back(Dictionary::getBitsFromByteList(out->bytesList.rowRange(i, i + 1),
+                                                               markerSize));
+        vector< int > markerMinDistance(nBase);
+        parallel_for_(Range(0, nBase), [&](const Range &range) {
+            for(int i = range.start; i < range.end; i++)
+                markerMinDistance[i] = accepted.minDistance(accepted.get(i, 0), i + 1, nBase,
+                                                            accepted.selfDistance(i), -1);
+        });
         int minDistance = markerSize * markerSize + 1;
-        for(int i = 0; i < out->bytesList.rows; i++) {
-            Mat markerBytes = out->bytesList.rowRange(i, i + 1);
-            Mat markerBits = Dictionary::getBitsFromByteList(markerBytes, markerSize);
-            minDistance = min(minDistance, _getSelfDistance(markerBits));
-            for(int j = i + 1; j < out->bytesList.rows; j++) {
-                minDistance = min(minDistance, out->getDistanceToId(markerBits, j));
-            }
-        }
+        for(int i = 0; i < nBase; i++)
+            minDistance = min(minDistance, markerMinDistance[i]);
         tau = minDistance;
     }
 
@@ -431,46 +913,82 @@ Ptr<Dictionary> generateCustomDictionary(int nMarkers, int markerSize,
     const int maxUnproductiveIterations = 5000;
     int unproductiveIterations = 0;
 
+    // The candidates are drawn in batches and their distances to the markers accepted before the
+    // batch are computed in parallel, stopping early at the best distance before the batch. Then
+    // the batch is processed in order as if each candidate had been checked alone, completing the
+    // distances with the markers accepted within the batch. The random sequence and the result are
+    // the same than checking the candidates one by one.
+    const int batchSize = 64 * max(1, getNumThreads());
+    vector< Mat > candidates(batchSize);
+    _PackedCodes candidateCodes(markerSize);
+    vector< int > selfDistances(batchSize), batchDistances(batchSize);
+
     while(out->bytesList.rows < nMarkers) {
-        Mat currentMarker = _generateRandomMarker(markerSize, rng);
-
-        int selfDistance = _getSelfDistance(currentMarker);
-        int minDistance = selfDistance;
-
-        // if self distance is better or equal than current best option, calculate distance
-        // to previous accepted markers
-        if(selfDistance >= bestTau) {
-            for(int i = 0; i < out->bytesList.rows; i++) {
-                int currentDistance = out->getDistanceToId(currentMarker, i);
-                minDistance = min(currentDistance, minDistance);
-                if(minDistance <= bestTau) {
-                    break;
-                }
-            }
+        candidateCodes.words.clear();
+        for(int k = 0; k < batchSize; k++) {
+            candidates[k] = _generateRandomMarker(markerSize, rng);
+            candidateCodes.push_back(candidates[k]);
         }
 
-        // if distance is high enough, accept the marker
-        if(minDistance >= tau) {
-            unproductiveIterations = 0;
-            bestTau = 0;
-            Mat bytes = Dictionary::getByteListFromBits(currentMarker);
-            out->bytesList.push_back(bytes);
-        } else {
-            unproductiveIterations++;
-
-            // if distance is not enough, but is better than the current best option
-            if(minDistance > bestTau) {
-                bestTau = minDistance;
-                bestMarker = currentMarker;
+        int batchAccepted = accepted.size();
+        int batchBestTau = bestTau;
+        parallel_for_(Range(0, batchSize), [&](const Range &range) {
+            for(int k = range.start; k < range.end; k++) {
+                selfDistances[k] = candidateCodes.selfDistance(k);
+                batchDistances[k] = accepted.minDistance(candidateCodes.get(k, 0), 0, batchAccepted,
+                                                         selfDistances[k], batchBestTau);
+            }
+        });
+
+        for(int k = 0; k < batchSize && out->bytesList.rows < nMarkers; k++) {
+            const Mat &currentMarker = candidates[k];
+            const uint64 *currentCode = candidateCodes.get(k, 0);
+
+            int selfDistance = selfDistances[k];
+            int minDistance = selfDistance;
+
+            // if self distance is better or equal than current best option, calculate distance
+            // to previous accepted markers
+            if(selfDistance >= bestTau) {
+                if(batchDistances[k] > batchBestTau) {
+                    // exact for the markers accepted before the batch
+                    minDistance = accepted.minDistance(currentCode, batchAccepted, accepted.size(),
+                                                       batchDistances[k], bestTau);
+                } else if(bestTau >= batchBestTau) {
+                    // already not better than the current best option
+                    minDistance = batchDistances[k];
+                } else {
+                    // the best option has been reset within the batch
+                    minDistance = accepted.minDistance(currentCode, 0, accepted.size(),
+                                                       selfDistance, bestTau);
+                }
             }
 
-            // if number of unproductive iterarions has been reached, accept the current best option
-            if(unproductiveIterations == maxUnproductiveIterations) {
+            // if distance is high enough, accept the marker
+            if(minDistance >= tau) {
                 unproductiveIterations = 0;
-                tau = bestTau;
                 bestTau = 0;
-                Mat bytes = Dictionary::getByteListFromBits(bestMarker);
+                Mat bytes = Dictionary::getByteListFromBits(currentMarker);
                 out->bytesList.push_back(bytes);
+                accepted.push_back(currentMarker);
+            } else {
+                unproductiveIterations++;
+
+                // if distance is not enough, but is better than the current best option
+                if(minDistance > bestTau) {
+                    bestTau = minDistance;
+                    bestMarker = currentMarker;
+                }
+
+                // if number of unproductive iterarions has been reached, accept the current best option
+                if(unproductiveIterations == maxUnproductiveIterations) {
+                    unproductiveIterations = 0;
+                    tau = bestTau;
+                    bestTau = 0;
+                    Mat bytes = Dictionary::getByteListFromBits(bestMarker);
+                    out->bytesList.push_back(bytes);
+                    accepted.push_back(bestMarker);
+                }
             }
         }
     }
@@ -0,0 +1,295 @@
+/*
+By downloading, copying, installing or using the software you agree to this
+license. If you do not agree to this license, do not download, install,
+copy or use the software.
+
+                          License Agreement
+               For Open Source Computer Vision Library
+                       (3-clause BSD License)
+
+Copyright (C) 2013, OpenCV Foundation, all rights reserved.
+Third party copyrights are property of their respective owners.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice,
+    this list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the names of the copyright holders nor the names of the contributors
+    may be used to endorse or promote products derived from this software
+    without specific prior written permission.
+
+This software is provided by the copyright holders and contributors "as is" and
+any express or implied warranties, including, but not limited to, the implied
+warranties of merchantability and fitness for a particular purpose are
+disclaimed. In no event shall copyright holders or contributors be liable for
+any direct, indirect, incidental, special, exemplary, or consequential damages
+(including, but not limited to, procurement of substitute goods or services;
+loss of use, data, or profits; or business interruption) however caused
+and on any theory of liability, whether in contract, strict liability,
+or tort (including negligence or otherwise) arising in any way out of
+the use of this software, even if advised of the possibility of such damage.
+*/
+
+
+#ifndef __OPENCV_ARUCO_MARKER_KERNELS_HPP__
+#define __OPENCV_ARUCO_MARKER_KERNELS_HPP__
+
+#include <opencv2/core.hpp>
+#include "opencv2/aruco/dictionary.hpp"
+#include <cstring>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace cv {
+namespace aruco {
+
+/**
+ * @brief Number of bits set in a 64 bits word
+ */
+static inline int _popCount64(uint64 x) {
+#if defined(__GNUC__)
+    return __builtin_popcountll(x);
+#elif defined(_MSC_VER) && defined(_M_X64) && defined(CV_POPCNT)
+    return (int)__popcnt64(x);
+#else
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (int)((x * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+
+/**
+  * Calls f(I), f(I + 1), ..., f(END - 1), unrolled at compile time
+  */
+template< int I, int END >
+struct _Unroll {
+    template< typename F >
+    static inline void run(const F &f) {
+        f(I);
+        _Unroll< I + 1, END >::run(f);
+    }
+};
+
+template< int END >
+struct _Unroll< END, END > {
+    template< typename F >
+    static inline void run(const F &) {}
+};
+
+
+/**
+  * Codes of markerSize x markerSize bits. _getCodeKernel() returns a kernel specialized for the
+  * marker size, with the bit packing and the rotations unrolled, or NULL if the size has none.
+  */
+class _CodeKernel {
+    public:
+    virtual ~_CodeKernel() {}
+
+    /** @brief Same as Dictionary::getByteListFromBits(), bits is markerSize x markerSize */
+    virtual void getByteListFromBits(const Mat &bits, uchar *byteList) const = 0;
+
+    /**
+     * @brief Linear search of Dictionary::identify(), candidate is in the layout of a rotation of
+     * bytesList. idx is only set if a marker is found
+     */
+    virtual bool identify(const Mat &bytesList, const uchar *candidate, int maxCorrection, int &idx,
+                          int &rotation) const = 0;
+};
+
+template< int N >
+class _CodeKernelImpl : public _CodeKernel {
+    public:
+    static const int NBITS = N * N;
+    static const int NBYTES = (N * N + 7) / 8;
+
+    _CodeKernelImpl() {}
+
+    /**
+     * A code is held in an integer where bit (row, col) of the marker is bit NBITS - 1 - (row * N + col).
+     * Rotated 90 degrees as in getByteListFromBits, bit (row, col) is bit (col, N - 1 - row)
+     */
+    static inline uint64 rotate(uint64 code) {
+        uint64 res = 0;
+        _Unroll< 0, NBITS >::run([&](int i) {
+            int src = NBITS - 1 - ((i % N) * N + N - 1 - i / N);
+            res |= ((code >> src) & 1) << (NBITS - 1 - i);
+        });
+        return res;
+    }
+
+    /** @brief bytesList layout: whole bytes first, the remaining bits in the low bits of the last byte */
+    static inline void toBytes(uint64 code, uchar *bytes) {
+        _Unroll< 0, NBYTES - 1 >::run([&](int j) { bytes[j] = (uchar)(code >> (NBITS - 8 * (j + 1))); });
+        bytes[NBYTES - 1] = (uchar)(code & ((uint64(1) << (NBITS - 8 * (NBYTES - 1))) - 1));
+    }
+
+    /** @brief Code in the bytesList layout as a word, the byte order does not matter for the distances */
+    static inline uint64 load(const uchar *bytes) {
+        uint64 word = 0;
+        memcpy(&word, bytes, NBYTES);
+        return word;
+    }
+
+    void getByteListFromBits(const Mat &bits, uchar *byteList) const CV_OVERRIDE {
+        uint64 code = 0;
+        _Unroll< 0, N >::run([&](int row) {
+            const uchar *p = bits.ptr< uchar >(row);
+            _Unroll< 0, N >::run([&](int col) { code = (code << 1) | uint64(p[col] != 0); });
+        });
+        _Unroll< 0, 4 >::run([&](int r) {
+            toBytes(code, byteList + r * NBYTES);
+            code = rotate(code);
+        });
+    }
+
+    bool identify(const Mat &bytesList, const uchar *candidate, int maxCorrection, int &idx,
+                  int &rotation) const CV_OVERRIDE {
+        uint64 code = load(candidate);
+        for(int m = 0; m < bytesList.rows; m++) {
+            const uchar *marker = bytesList.ptr(m);
+            int minDistance = NBITS + 1, minRotation = -1;
+            _Unroll< 0, 4 >::run([&](int r) {
+                int distance = _popCount64(code ^ load(marker + r * NBYTES));
+                if(distance < minDistance) {
+                    minDistance = distance;
+                    minRotation = r;
+                }
+            });
+            if(minDistance <= maxCorrection) {
+                idx = m;
+                rotation = minRotation;
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+inline const _CodeKernel *_getCodeKernel(int markerSize) {
+    static const _CodeKernelImpl< 4 > kernel4;
+    static const _CodeKernelImpl< 5 > kernel5;
+    static const _CodeKernelImpl< 6 > kernel6;
+    static const _CodeKernelImpl< 7 > kernel7;
+    static const _CodeKernelImpl< 8 > kernel8;
+    switch(markerSize) {
+    case 4: return &kernel4;
+    case 5: return &kernel5;
+    case 6: return &kernel6;
+    case 7: return &kernel7;
+    case 8: return &kernel8;
+    default: return NULL;
+    }
+}
+
+
+/**
+  * Decoding of the cells of a candidate, markerSize + 2 * borderBits per side, held as one word per
+  * row where the cell of column x is bit markerSize + 2 * borderBits - 1 - x, 1 for white.
+  * _getMarkerDecoder() returns a decoder specialized for the marker and border sizes, or NULL.
+  */
+class _MarkerDecoder {
+    public:
+    virtual ~_MarkerDecoder() {}
+
+    /** @brief Cells of a binarized candidate image, as the cell loop of _extractBits */
+    virtual void getCells(const Mat &binary, int cellSize, int cellMarginPixels, ushort *rows) const = 0;
+
+    /** @brief Number of white cells in the border, as _getBorderErrors */
+    virtual int getBorderErrors(const ushort *rows) const = 0;
+
+    /** @brief Inner cells in the layout of the first rotation of bytesList */
+    virtual void getCode(const ushort *rows, uchar *code) const = 0;
+};
+
+template< int N, int B >
+class _MarkerDecoderImpl : public _MarkerDecoder {
+    public:
+    static const int SIZE = N + 2 * B;
+    static const int ROW_MASK = (1 << SIZE) - 1;
+
+    _MarkerDecoderImpl() {}
+
+    /** @brief Border cells of row y */
+    static constexpr int borderMask(int y) {
+        return y < B || y >= SIZE - B ? ROW_MASK : ((1 << B) - 1) | (((1 << B) - 1) << (SIZE - B));
+    }
+
+    void getCells(const Mat &binary, int cellSize, int cellMarginPixels, ushort *rows) const CV_OVERRIDE {
+        int side = cellSize - 2 * cellMarginPixels;
+        int half = side * side / 2;
+        for(int y = 0; y < SIZE; y++) {
+            int row = 0;
+            for(int x = 0; x < SIZE; x++) {
+                // count white pixels on each cell to assign its value
+                int nZ = 0;
+                for(int i = 0; i < side; i++) {
+                    const uchar *p = binary.ptr(y * cellSize + cellMarginPixels + i) + x * cellSize + cellMarginPixels;
+                    for(int j = 0; j < side; j++)
+                        nZ += p[j] != 0;
+                }
+                row = (row << 1) | int(nZ > half);
+            }
+            rows[y] = (ushort)row;
+        }
+    }
+
+    int getBorderErrors(const ushort *rows) const CV_OVERRIDE {
+        int errors = 0;
+        _Unroll< 0, SIZE >::run([&](int y) { errors += _popCount64(uint64(rows[y] & borderMask(y))); });
+        return errors;
+    }
+
+    void getCode(const ushort *rows, uchar *code) const CV_OVERRIDE {
+        uint64 bits = 0;
+        _Unroll< B, B + N >::run([&](int y) { bits = (bits << N) | uint64((rows[y] >> B) & ((1 << N) - 1)); });
+        _CodeKernelImpl< N >::toBytes(bits, code);
+    }
+};
+
+inline const _MarkerDecoder *_getMarkerDecoder(int markerSize, int borderBits) {
+    static const _MarkerDecoderImpl< 4, 1 > decoder41;
+    static const _MarkerDecoderImpl< 5, 1 > decoder51;
+    static const _MarkerDecoderImpl< 6, 1 > decoder61;
+    static const _MarkerDecoderImpl< 7, 1 > decoder71;
+    static const _MarkerDecoderImpl< 8, 1 > decoder81;
+    static const _MarkerDecoderImpl< 4, 2 > decoder42;
+    static const _MarkerDecoderImpl< 5, 2 > decoder52;
+    static const _MarkerDecoderImpl< 6, 2 > decoder62;
+    static const _MarkerDecoderImpl< 7, 2 > decoder72;
+    static const _MarkerDecoderImpl< 8, 2 > decoder82;
+    const _MarkerDecoder *decoders[2][5] = {
+        { &decoder41, &decoder51, &decoder61, &decoder71, &decoder81 },
+        { &decoder42, &decoder52, &decoder62, &decoder72, &decoder82 }
+    };
+    if(markerSize < 4 || markerSize > 8 || borderBits < 1 || borderBits > 2) return NULL;
+    return decoders[borderBits - 1][markerSize - 4];
+}
+
+
+/**
+  * @brief Search index of the dictionary, rebuilt if its codes changed since it was built. Empty if
+  * the dictionary has no index
+  */
+Mat _updateSearchIndex(Dictionary &dictionary);
+
+/**
+  * @brief Same as Dictionary::identify() for a candidate in the layout of a rotation of bytesList,
+  * with the number of correctable bits. searchIndex is the result of _updateSearchIndex(), the
+  * search is linear if it is empty
+  */
+bool _identifyCode(const Dictionary &dictionary, const Mat &searchIndex, const uchar *candidate,
+                   int maxCorrection, int &idx, int &rotation);
+
+}
+}
+
+#endif
@@ -5,14896 +5,2995 @@
 namespace {
 
 /**
-  * Dictionaries are stored as a list of bytes in its four rotations.
-  * On each rotation, the marker is divided in bytes assuming a row-major order.
-  * This format allows a faster marker identification.
-  * For a dictionary composed by M markers of NxN bits, the structure dimensions should be:
-  * const char name[nMarkers][4rotations][nBytes], or more specifically:
-  * const char name[M][4][ceil(NxN/8)]
-  * The element [i][j][k] represents the k-th byte of the i-th marker in the dictionary
-  * in its j-th rotation.
+  * Dictionaries are stored as the codes of their markers in their four rotations, one marker per line.
+  * A marker of NxN bits is packed in a 64 bits integer in row-major order, starting from the most
+  * significant of its N*N bits: bit (row, col) of the marker is bit N*N - 1 - (row*N + col).
+  * For a dictionary composed by M markers, the structure dimensions are uint64 name[M][4].
+  * The element [i][j] is the code of the i-th marker in the dictionary in its j-th rotation.
   * Each rotation implies a 90 degree rotation of the marker in anticlockwise direction.
   */
-static unsigned char DICT_APRILTAG_16h5_BYTES[][4][2] =
-{
-    { {216, 196},
-      {128, 190},
-      {35, 27},
-      {125, 1}
-    },
-    { {165, 116},
-      {106, 120},
-      {46, 165},
-      {30, 86}
-    },
-    { {86, 44},
-      {134, 209},
-      {52, 106},
-      {139, 97}
-    },
-    { {157, 162},
-      {195, 78},
-      {69, 185},
-      {114, 195}
-    },
-    { {101, 158},
-      {105, 211},
-      {121, 166},
-      {203, 150}
-    },
-    { {214, 254},
-      {167, 251},
-      {127, 107},
-      {223, 229}
-    },
-    { {26, 205},
-      {148, 55},
-      {179, 88},
-      {236, 41}
-    },
-    { {162, 231},
-      {31, 58},
-      {231, 69},
-      {92, 248}
-    },
-    { {154, 127},
-      {183, 61},
-      {254, 89},
-      {188, 237}
-    },
-    { {182, 168},
-      {142, 75},
-      {21, 109},
-      {210, 113}
-    },
-    { {208, 28},
-      {160, 153},
-      {56, 11},
-      {153, 5}
-    },
-    { {213, 15},
-      {209, 217},
-      {240, 171},
-      {155, 139}
-    },
-    { {33, 176},
-      {106, 2},
-      {13, 132},
-      {64, 86}
-    },
-    { {108, 226},
-      {11, 230},
-      {71, 54},
-      {103, 208}
-    },
-    { {78, 49},
-      {54, 196},
-      {140, 114},
-      {35, 108}
-    },
-    { {8, 245},
-      {50, 54},
-      {175, 16},
-      {108, 76}
-    },
-    { {60, 144},
-      {168, 70},
-      {9, 60},
-      {98, 21}
-    },
-    { {45, 201},
-      {88, 103},
-      {147, 180},
-      {230, 26}
-    },
-    { {192, 165},
-      {18, 154},
-      {165, 3},
-      {89, 72}
-    },
-    { {241, 98},
-      {203, 168},
-      {70, 143},
-      {21, 211}
-    },
-    { {236, 135},
-      {25, 222},
-      {225, 55},
-      {123, 152}
-    },
-    { {169, 234},
-      {75, 47},
-      {87, 149},
-      {244, 210}
-    },
-    { {66, 251},
-      {55, 163},
-      {223, 66},
-      {197, 236}
-    },
-    { {184, 56},
-      {170, 13},
-      {28, 29},
-      {176, 85}
-    },
-    { {59, 151},
-      {253, 22},
-      {233, 220},
-      {104, 191}
-    },
-    { {181, 206},
-      {201, 123},
-      {115, 173},
-      {222, 147}
-    },
-    { {250, 181},
-      {190, 158},
-      {173, 95},
-      {121, 125}
-    },
-    { {12, 171},
-      {19, 71},
-      {213, 48},
-      {226, 200}
-    },
-    { {83, 224},
-      {198, 162},
-      {7, 202},
-      {69, 99}
-    },
-    { {116, 245},
-      {186, 242},
-      {175, 46},
-      {79, 93}
-    }
+static constexpr uint64 DICT_APRILTAG_16h5_CODES[][4] = {
+    { 0xd8c4ULL, 0x80beULL, 0x231bULL, 0x7d01ULL },
+    { 0xa574ULL, 0x6a78ULL, 0x2ea5ULL, 0x1e56ULL },
+    { 0x562cULL, 0x86d1ULL, 0x346aULL, 0x8b61ULL },
+    { 0x9da2ULL, 0xc34eULL, 0x45b9ULL, 0x72c3ULL },
+    { 0x659eULL, 0x69d3ULL, 0x79a6ULL, 0xcb96ULL },
+    { 0xd6feULL, 0xa7fbULL, 0x7f6bULL, 0xdfe5ULL },
+    { 0x1acdULL, 0x9437ULL, 0xb358ULL, 0xec29ULL },
+    { 0xa2e7ULL, 0x1f3aULL, 0xe745ULL, 0x5cf8ULL },
+    { 0x9a7fULL, 0xb73dULL, 0xfe59ULL, 0xbcedULL },
+    { 0xb6a8ULL, 0x8e4bULL, 0x156dULL, 0xd271ULL },
+    { 0xd01cULL, 0xa099ULL, 0x380bULL, 0x9905ULL },
+    { 0xd50fULL, 0xd1d9ULL, 0xf0abULL, 0x9b8bULL },
+    { 0x21b0ULL, 0x6a02ULL, 0x0d84ULL, 0x4056ULL },
+    { 0x6ce2ULL, 0x0be6ULL, 0x4736ULL, 0x67d0ULL },
+    { 0x4e31ULL, 0x36c4ULL, 0x8c72ULL, 0x236cULL },
+    { 0x08f5ULL, 0x3236ULL, 0xaf10ULL, 0x6c4cULL },
+    { 0x3c90ULL, 0xa846ULL, 0x093cULL, 0x6215ULL },
+    { 0x2dc9ULL, 0x5867ULL, 0x93b4ULL, 0xe61aULL },
+    { 0xc0a5ULL, 0x129aULL, 0xa503ULL, 0x5948ULL },
+    { 0xf162ULL, 0xcba8ULL, 0x468fULL, 0x15d3ULL },
+    { 0xec87ULL, 0x19deULL, 0xe137ULL, 0x7b98ULL },
+    { 0xa9eaULL, 0x4b2fULL, 0x5795ULL, 0xf4d2ULL },
+    { 0x42fbULL, 0x37a3ULL, 0xdf42ULL, 0xc5ecULL },
+    { 0xb838ULL, 0xaa0dULL, 0x1c1dULL, 0xb055ULL },
+    { 0x3b97ULL, 0xfd16ULL, 0xe9dcULL, 0x68bfULL },
+    { 0xb5ceULL, 0xc97bULL, 0x73adULL, 0xde93ULL },
+    { 0xfab5ULL, 0xbe9eULL, 0xad5fULL, 0x797dULL },
+    { 0x0cabULL, 0x1347ULL, 0xd530ULL, 0xe2c8ULL },
+    { 0x53e0ULL, 0xc6a2ULL, 0x07caULL, 0x4563ULL },
+    { 0x74f5ULL, 0xbaf2ULL, 0xaf2eULL, 0x4f5dULL },
 };
 
-
-
-static unsigned char DICT_APRILTAG_25h9_BYTES[][4][4] =
-{
-    { {143, 211, 170, 1},
-      {234, 146, 237, 1},
-      {170, 229, 248, 1},
-      {219, 164, 171, 1}
-    },
-    { {109, 139, 39, 1},
-      {170, 251, 21, 0},
-      {242, 104, 219, 0},
-      {84, 111, 170, 1}
-    },
-    { {22, 208, 222, 1},
-      {94, 6, 244, 1},
-      {189, 133, 180, 0},
-      {151, 176, 61, 0}
-    },
-    { {179, 147, 87, 1},
-      {62, 118, 217, 0},
-      {245, 100, 230, 1},
-      {77, 183, 62, 0}
-    },
-    { {115, 40, 116, 1},
-      {28, 189, 146, 0},
-      {151, 10, 103, 0},
-      {36, 222, 156, 0}
-    },
-    { {221, 18, 172, 0},
-      {164, 145, 124, 1},
-      {26, 164, 93, 1},
-      {159, 68, 146, 1}
-    },
-    { {103, 234, 238, 0},
-      {98, 191, 182, 1},
-      {59, 171, 243, 0},
-      {182, 254, 163, 0}
-    },
-    { {213, 186, 96, 1},
-      {46, 157, 78, 0},
-      {131, 46, 213, 1},
-      {57, 92, 186, 0}
-    },
-    { {231, 69, 93, 1},
-      {89, 117, 157, 1},
-      {221, 81, 115, 1},
-      {220, 215, 77, 0}
-    },
-    { {17, 101, 123, 0},
-      {85, 214, 3, 1},
-      {111, 83, 68, 0},
-      {224, 53, 213, 0}
-    },
-    { {228, 155, 129, 0},
-      {34, 105, 109, 0},
-      {64, 236, 147, 1},
-      {91, 75, 34, 0}
-    },
-    { {130, 77, 138, 0},
-      {65, 10, 169, 1},
-      {40, 217, 32, 1},
-      {202, 168, 65, 0}
-    },
-    { {117, 19, 219, 0},
-      {52, 119, 101, 1},
-      {109, 228, 87, 0},
-      {211, 119, 22, 0}
-    },
-    { {152, 112, 167, 1},
-      {204, 194, 122, 0},
-      {242, 135, 12, 1},
-      {47, 33, 153, 1}
-    },
-    { {75, 152, 26, 1},
-      {154, 27, 192, 1},
-      {172, 12, 233, 0},
-      {129, 236, 44, 1}
-    },
-    { {65, 65, 182, 1},
-      {88, 147, 49, 0},
-      {182, 193, 65, 0},
-      {70, 100, 141, 0}
-    },
-    { {172, 7, 198, 1},
-      {169, 38, 61, 0},
-      {177, 240, 26, 1},
-      {94, 50, 74, 1}
-    },
-    { {129, 217, 185, 0},
-      {82, 216, 105, 1},
-      {78, 205, 192, 1},
-      {203, 13, 165, 0}
-    },
-    { {35, 119, 206, 1},
-      {105, 54, 243, 1},
-      {185, 247, 98, 0},
-      {231, 182, 75, 0}
-    },
-    { {144, 92, 117, 0},
-      {85, 204, 88, 0},
-      {87, 29, 4, 1},
-      {13, 25, 213, 0}
-    },
-    { {138, 62, 250, 0},
-      {177, 142, 234, 1},
-      {47, 190, 40, 1},
-      {171, 184, 198, 1}
-    },
-    { {63, 236, 133, 1},
-      {207, 120, 182, 0},
-      {208, 155, 254, 0},
-      {54, 143, 121, 1}
-    },
-    { {70, 169, 59, 0},
-      {18, 203, 135, 1},
-      {110, 74, 177, 0},
-      {240, 233, 164, 0}
-    },
-    { {162, 116, 1, 1},
-      {73, 96, 202, 0},
-      {192, 23, 34, 1},
-      {41, 131, 73, 0}
-    },
-    { {52, 42, 195, 1},
-      {44, 110, 38, 0},
-      {225, 170, 22, 0},
-      {50, 59, 26, 0}
-    },
-    { {37, 240, 225, 0},
-      {66, 244, 102, 0},
-      {67, 135, 210, 0},
-      {51, 23, 161, 0}
-    },
-    { {144, 226, 137, 0},
-      {102, 64, 42, 1},
-      {72, 163, 132, 1},
-      {170, 1, 51, 0}
-    },
-    { {15, 33, 102, 1},
-      {136, 150, 151, 0},
-      {179, 66, 120, 0},
-      {116, 180, 136, 1}
-    },
-    { {165, 79, 19, 0},
-      {113, 122, 13, 0},
-      {100, 121, 82, 1},
-      {88, 47, 71, 0}
-    },
-    { {221, 124, 193, 0},
-      {197, 93, 110, 0},
-      {65, 159, 93, 1},
-      {59, 93, 81, 1}
-    },
-    { {254, 142, 154, 0},
-      {183, 43, 172, 1},
-      {44, 184, 191, 1},
-      {154, 234, 118, 1}
-    },
-    { {10, 11, 60, 1},
-      {184, 136, 145, 1},
-      {158, 104, 40, 0},
-      {196, 136, 142, 1}
-    },
-    { {139, 80, 95, 0},
-      {208, 86, 216, 1},
-      {125, 5, 104, 1},
-      {141, 181, 5, 1}
-    },
-    { {13, 198, 237, 1},
-      {235, 212, 52, 1},
-      {219, 177, 216, 0},
-      {150, 21, 235, 1}
-    },
-    { {115, 137, 157, 0},
-      {22, 121, 177, 1},
-      {92, 200, 231, 0},
-      {198, 207, 52, 0}
-    }
+static constexpr uint64 DICT_APRILTAG_25h9_CODES[][4] = {
+    { 0x11fa755ULL, 0x1d525dbULL, 0x155cbf1ULL, 0x1b74957ULL },
+    { 0x0db164fULL, 0x155f62aULL, 0x1e4d1b6ULL, 0x0a8df55ULL },
+    { 0x02da1bdULL, 0x0bc0de9ULL, 0x17b0b68ULL, 0x12f607aULL },
+    { 0x16726afULL, 0x07cedb2ULL, 0x1eac9cdULL, 0x09b6e7cULL },
+    { 0x0e650e9ULL, 0x0397b24ULL, 0x12e14ceULL, 0x049bd38ULL },
+    { 0x1ba2558ULL, 0x14922f9ULL, 0x03548bbULL, 0x13e8925ULL },
+    { 0x0cfd5dcULL, 0x0c57f6dULL, 0x07757e6ULL, 0x16dfd46ULL },
+    { 0x1ab74c1ULL, 0x05d3a9cULL, 0x1065dabULL, 0x072b974ULL },
+    { 0x1ce8abbULL, 0x0b2eb3bULL, 0x1baa2e7ULL, 0x1b9ae9aULL },
+    { 0x022caf6ULL, 0x0abac07ULL, 0x0dea688ULL, 0x1c06baaULL },
+    { 0x1c93702ULL, 0x044d2daULL, 0x081d927ULL, 0x0b69644ULL },
+    { 0x1049b14ULL, 0x0821553ULL, 0x051b241ULL, 0x1955082ULL },
+    { 0x0ea27b6ULL, 0x068eecbULL, 0x0dbc8aeULL, 0x1a6ee2cULL },
+    { 0x130e14fULL, 0x19984f4ULL, 0x1e50e19ULL, 0x05e4333ULL },
+    { 0x0973035ULL, 0x1343781ULL, 0x15819d2ULL, 0x103d859ULL },
+    { 0x082836dULL, 0x0b12662ULL, 0x16d8282ULL, 0x08cc91aULL },
+    { 0x1580f8dULL, 0x1524c7aULL, 0x163e035ULL, 0x0bc6495ULL },
+    { 0x103b372ULL, 0x0a5b0d3ULL, 0x09d9b81ULL, 0x1961b4aULL },
+    { 0x046ef9dULL, 0x0d26de7ULL, 0x173eec4ULL, 0x1cf6c96ULL },
+    { 0x120b8eaULL, 0x0ab98b0ULL, 0x0ae3a09ULL, 0x01a33aaULL },
+    { 0x1147df4ULL, 0x1631dd5ULL, 0x05f7c51ULL, 0x157718dULL },
+    { 0x07fd90bULL, 0x19ef16cULL, 0x1a137fcULL, 0x06d1ef3ULL },
+    { 0x08d5276ULL, 0x025970fULL, 0x0dc9562ULL, 0x1e1d348ULL },
+    { 0x144e803ULL, 0x092c194ULL, 0x1802e45ULL, 0x0530692ULL },
+    { 0x0685587ULL, 0x058dc4cULL, 0x1c3542cULL, 0x0647634ULL },
+    { 0x04be1c2ULL, 0x085e8ccULL, 0x0870fa4ULL, 0x0662f42ULL },
+    { 0x121c512ULL, 0x0cc8055ULL, 0x0914709ULL, 0x1540266ULL },
+    { 0x01e42cdULL, 0x1112d2eULL, 0x16684f0ULL, 0x0e96911ULL },
+    { 0x14a9e26ULL, 0x0e2f41aULL, 0x0c8f2a5ULL, 0x0b05e8eULL },
+    { 0x1baf982ULL, 0x18abadcULL, 0x0833ebbULL, 0x076baa3ULL },
+    { 0x1fd1d34ULL, 0x16e5759ULL, 0x059717fULL, 0x135d4edULL },
+    { 0x0141679ULL, 0x1711123ULL, 0x13cd050ULL, 0x189111dULL },
+    { 0x116a0beULL, 0x1a0adb1ULL, 0x0fa0ad1ULL, 0x11b6a0bULL },
+    { 0x01b8ddbULL, 0x1d7a869ULL, 0x1b763b0ULL, 0x12c2bd7ULL },
+    { 0x0e7133aULL, 0x02cf363ULL, 0x0b991ceULL, 0x18d9e68ULL },
 };
 
-
-
-static unsigned char DICT_APRILTAG_36h10_BYTES[][4][5] =
-{
-    { {225, 101, 73, 83, 8},
-      {49, 6, 165, 238, 1},
-      {28, 169, 42, 104, 7},
-      {135, 122, 86, 8, 12}
-    },
-    { {50, 53, 132, 160, 4},
-      {65, 139, 98, 33, 2},
-      {32, 82, 26, 196, 12},
-      {72, 68, 109, 24, 2}
-    },
-    { {107, 237, 252, 94, 4},
-      {43, 167, 244, 249, 13},
-      {39, 163, 251, 125, 6},
-      {185, 242, 254, 93, 4}
-    },
-    { {217, 189, 115, 45, 4},
-      {123, 106, 82, 246, 12},
-      {43, 76, 235, 217, 11},
-      {54, 244, 165, 109, 14}
-    },
-    { {87, 115, 222, 38, 12},
-      {233, 207, 79, 209, 1},
-      {54, 71, 188, 238, 10},
-      {136, 191, 47, 57, 7}
-    },
-    { {245, 43, 80, 249, 12},
-      {161, 42, 235, 222, 10},
-      {57, 240, 173, 74, 15},
-      {87, 189, 117, 72, 5}
-    },
-    { {46, 91, 153, 155, 12},
-      {210, 166, 237, 21, 11},
-      {61, 153, 157, 167, 4},
-      {218, 139, 118, 84, 11}
-    },
-    { {127, 167, 237, 114, 2},
-      {179, 155, 190, 233, 5},
-      {68, 235, 126, 95, 14},
-      {169, 119, 221, 156, 13}
-    },
-    { {72, 191, 207, 28, 10},
-      {123, 243, 157, 160, 8},
-      {83, 143, 63, 209, 2},
-      {16, 91, 156, 253, 14}
-    },
-    { {235, 64, 193, 206, 10},
-      {58, 180, 33, 203, 3},
-      {87, 56, 48, 45, 7},
-      {205, 56, 66, 213, 12}
-    },
-    { {215, 152, 253, 186, 6},
-      {240, 185, 214, 211, 15},
-      {101, 219, 241, 158, 11},
-      {252, 182, 185, 208, 15}
-    },
-    { {92, 212, 54, 176, 14},
-      {194, 93, 211, 176, 6},
-      {112, 214, 194, 179, 10},
-      {96, 220, 187, 164, 3}
-    },
-    { {114, 66, 21, 239, 14},
-      {24, 61, 107, 157, 3},
-      {127, 122, 132, 36, 14},
-      {203, 157, 107, 193, 8}
-    },
-    { {200, 18, 236, 76, 1},
-      {110, 161, 12, 138, 4},
-      {131, 35, 116, 129, 3},
-      {37, 19, 8, 87, 6}
-    },
-    { {27, 178, 99, 54, 1},
-      {127, 72, 154, 65, 5},
-      {134, 204, 100, 221, 8},
-      {168, 37, 145, 47, 14}
-    },
-    { {185, 202, 170, 229, 1},
-      {14, 204, 62, 78, 14},
-      {138, 117, 85, 57, 13},
-      {119, 39, 195, 55, 0}
-    },
-    { {55, 38, 64, 234, 9},
-      {165, 40, 43, 105, 3},
-      {149, 112, 38, 78, 12},
-      {201, 109, 65, 74, 5}
-    },
-    { {141, 86, 137, 137, 9},
-      {214, 164, 13, 102, 2},
-      {153, 25, 22, 171, 1},
-      {70, 107, 2, 86, 11}
-    },
-    { {220, 110, 245, 96, 5},
-      {183, 141, 74, 186, 12},
-      {160, 106, 247, 99, 11},
-      {53, 213, 43, 30, 13}
-    },
-    { {81, 225, 58, 109, 5},
-      {13, 110, 86, 220, 4},
-      {171, 101, 200, 120, 10},
-      {35, 182, 167, 107, 0}
-    },
-    { {40, 201, 94, 212, 13},
-      {46, 71, 245, 24, 10},
-      {178, 183, 169, 49, 4},
-      {81, 138, 254, 39, 4}
-    },
-    { {155, 25, 144, 102, 13},
-      {78, 138, 67, 91, 9},
-      {182, 96, 153, 141, 9},
-      {157, 172, 37, 23, 2}
-    },
-    { {198, 37, 228, 219, 13},
-      {165, 163, 193, 175, 7},
-      {189, 178, 122, 70, 3},
-      {239, 88, 60, 90, 5}
-    },
-    { {238, 221, 198, 163, 3},
-      {230, 215, 50, 167, 11},
-      {204, 86, 59, 183, 7},
-      {222, 84, 206, 182, 7}
-    },
-    { {168, 123, 189, 36, 7},
-      {95, 151, 110, 18, 12},
-      {226, 75, 221, 225, 5},
-      {52, 135, 110, 159, 10}
-    },
-    { {38, 247, 86, 43, 7},
-      {229, 119, 122, 53, 1},
-      {237, 70, 174, 246, 4},
-      {138, 197, 238, 234, 7}
-    },
-    { {119, 95, 17, 146, 15},
-      {212, 30, 233, 241, 11},
-      {244, 152, 143, 174, 14},
-      {216, 249, 119, 130, 11}
-    },
-    { {227, 232, 42, 118, 0},
-      {9, 68, 182, 203, 13},
-      {6, 229, 65, 124, 7},
-      {189, 54, 210, 41, 0}
-    },
-    { {219, 116, 9, 26, 8},
-      {83, 44, 133, 227, 1},
-      {21, 137, 2, 237, 11},
-      {140, 122, 19, 76, 10}
-    },
-    { {166, 92, 117, 179, 8},
-      {240, 5, 163, 55, 15},
-      {28, 218, 227, 166, 5},
-      {254, 204, 90, 0, 15}
-    },
-    { {247, 162, 51, 66, 4},
-      {145, 72, 120, 219, 5},
-      {36, 44, 196, 94, 15},
-      {173, 177, 225, 40, 9}
-    },
-    { {45, 210, 218, 190, 4},
-      {234, 228, 254, 80, 3},
-      {39, 213, 180, 187, 4},
-      {192, 167, 242, 117, 7}
-    },
-    { {158, 138, 87, 237, 4},
-      {186, 105, 90, 31, 10},
-      {43, 126, 165, 23, 9},
-      {95, 133, 169, 101, 13}
-    },
-    { {192, 186, 16, 180, 12},
-      {73, 0, 219, 146, 10},
-      {50, 208, 133, 208, 3},
-      {84, 157, 176, 9, 2}
-    },
-    { {19, 70, 233, 230, 12},
-      {56, 140, 79, 105, 7},
-      {54, 121, 118, 44, 8},
-      {233, 111, 35, 17, 12}
-    },
-    { {177, 22, 100, 69, 12},
-      {104, 9, 105, 110, 4},
-      {58, 34, 102, 136, 13},
-      {39, 105, 105, 1, 6}
-    },
-    { {74, 118, 173, 59, 12},
-      {83, 165, 207, 165, 5},
-      {61, 203, 86, 229, 2},
-      {170, 95, 58, 92, 10}
-    },
-    { {133, 254, 70, 49, 2},
-      {225, 85, 154, 102, 8},
-      {72, 198, 39, 250, 1},
-      {22, 101, 154, 168, 7}
-    },
-    { {173, 105, 121, 110, 10},
-      {187, 54, 39, 90, 13},
-      {87, 105, 233, 107, 5},
-      {181, 174, 70, 205, 13}
-    },
-    { {32, 21, 210, 100, 6},
-      {104, 210, 98, 56, 0},
-      {98, 100, 186, 128, 4},
-      {1, 196, 100, 177, 6}
-    },
-    { {147, 181, 91, 6, 6},
-      {121, 90, 84, 115, 1},
-      {102, 13, 170, 220, 9},
-      {140, 226, 165, 169, 14}
-    },
-    { {202, 157, 31, 171, 6},
-      {82, 115, 86, 183, 11},
-      {109, 95, 139, 149, 3},
-      {222, 214, 172, 228, 10}
-    },
-    { {187, 35, 104, 210, 14},
-      {35, 26, 237, 75, 7},
-      {116, 177, 108, 77, 13},
-      {237, 43, 117, 140, 4}
-    },
-    { {52, 107, 195, 95, 14},
-      {185, 254, 233, 12, 9},
-      {127, 172, 61, 98, 12},
-      {147, 9, 119, 249, 13}
-    },
-    { {160, 207, 113, 248, 9},
-      {52, 38, 187, 58, 14},
-      {145, 248, 239, 48, 5},
-      {117, 205, 214, 66, 12}
-    },
-    { {83, 31, 184, 90, 9},
-      {68, 170, 141, 249, 13},
-      {149, 161, 223, 140, 10},
-      {185, 251, 21, 82, 2}
-    },
-    { {241, 127, 53, 41, 9},
-      {85, 47, 43, 246, 12},
-      {153, 74, 207, 232, 15},
-      {54, 253, 79, 74, 10}
-    },
-    { {152, 80, 211, 144, 5},
-      {118, 204, 192, 18, 2},
-      {160, 156, 176, 161, 9},
-      {68, 128, 51, 54, 14}
-    },
-    { {123, 240, 90, 34, 5},
-      {103, 76, 118, 209, 1},
-      {164, 69, 160, 253, 14},
-      {136, 182, 227, 46, 6}
-    },
-    { {197, 168, 151, 126, 5},
-      {157, 225, 210, 218, 9},
-      {167, 238, 145, 90, 3},
-      {149, 180, 184, 123, 9}
-    },
-    { {22, 216, 30, 157, 5},
-      {204, 109, 212, 21, 10},
-      {171, 151, 129, 182, 8},
-      {90, 130, 187, 99, 3}
-    },
-    { {180, 132, 224, 47, 5},
-      {172, 168, 114, 38, 5},
-      {175, 64, 114, 18, 13},
-      {166, 68, 225, 83, 5}
-    },
-    { {237, 52, 164, 150, 13},
-      {207, 129, 225, 226, 7},
-      {182, 146, 82, 203, 7},
-      {228, 120, 120, 31, 3}
-    },
-    { {9, 146, 15, 177, 3},
-      {86, 81, 158, 68, 2},
-      {200, 223, 4, 153, 0},
-      {66, 39, 152, 166, 10}
-    },
-    { {251, 90, 185, 188, 11},
-      {94, 188, 175, 211, 14},
-      {211, 217, 213, 173, 15},
-      {124, 191, 83, 215, 10}
-    },
-    { {37, 6, 52, 30, 11},
-      {140, 49, 169, 112, 5},
-      {215, 130, 198, 10, 4},
-      {160, 233, 88, 195, 1}
-    },
-    { {224, 145, 168, 72, 15},
-      {68, 178, 117, 138, 4},
-      {241, 33, 88, 144, 7},
-      {37, 26, 228, 210, 2}
-    },
-    { {194, 115, 147, 11, 8},
-      {81, 230, 9, 151, 1},
-      {29, 12, 156, 228, 3},
-      {142, 153, 6, 120, 10}
-    },
-    { {16, 43, 26, 208, 4},
-      {1, 74, 204, 24, 10},
-      {32, 181, 141, 64, 8},
-      {81, 131, 53, 40, 0}
-    },
-    { {56, 215, 41, 175, 4},
-      {90, 46, 126, 36, 7},
-      {47, 89, 78, 177, 12},
-      {226, 71, 231, 69, 10}
-    },
-    { {214, 63, 130, 165, 12},
-      {201, 202, 75, 167, 10},
-      {58, 84, 31, 198, 11},
-      {94, 93, 37, 57, 3}
-    },
-    { {93, 176, 247, 42, 2},
-      {243, 249, 18, 208, 5},
-      {69, 78, 240, 219, 10},
-      {160, 180, 137, 252, 15}
-    },
-    { {115, 36, 212, 252, 10},
-      {41, 185, 163, 249, 2},
-      {83, 242, 178, 76, 14},
-      {73, 252, 89, 217, 4}
-    },
-    { {71, 220, 230, 148, 6},
-      {232, 213, 208, 225, 14},
-      {98, 150, 115, 190, 2},
-      {120, 112, 186, 177, 7}
-    },
-    { {221, 26, 76, 114, 14},
-      {226, 25, 207, 202, 9},
-      {116, 227, 37, 139, 11},
-      {149, 63, 57, 132, 7}
-    },
-    { {154, 222, 49, 181, 1},
-      {94, 12, 154, 55, 14},
-      {138, 216, 199, 181, 9},
-      {126, 197, 147, 7, 10}
-    },
-    { {76, 25, 234, 75, 9},
-      {230, 226, 5, 140, 13},
-      {157, 37, 121, 131, 2},
-      {179, 26, 4, 118, 7}
-    },
-    { {129, 149, 32, 65, 5},
-      {68, 2, 80, 110, 4},
-      {168, 32, 74, 152, 1},
-      {39, 96, 164, 2, 2}
-    },
-    { {208, 173, 68, 239, 5},
-      {45, 43, 82, 174, 11},
-      {175, 114, 43, 80, 11},
-      {215, 84, 173, 75, 4}
-    },
-    { {169, 3, 2, 54, 13},
-      {14, 66, 235, 66, 1},
-      {182, 196, 12, 9, 5},
-      {132, 45, 116, 39, 0}
-    },
-    { {90, 99, 243, 101, 13},
-      {63, 206, 75, 157, 4},
-      {186, 108, 252, 101, 10},
-      {43, 157, 39, 63, 12}
-    },
-    { {167, 56, 140, 168, 15},
-      {197, 177, 103, 67, 10},
-      {241, 83, 17, 206, 5},
-      {92, 46, 104, 218, 3}
-    },
-    { {193, 252, 209, 46, 0},
-      {121, 164, 18, 242, 9},
-      {7, 72, 179, 248, 3},
-      {148, 244, 130, 89, 14}
-    },
-    { {18, 162, 88, 245, 0},
-      {41, 8, 158, 29, 2},
-      {10, 241, 164, 84, 8},
-      {75, 135, 145, 9, 4}
-    },
-    { {176, 210, 149, 151, 0},
-      {88, 141, 184, 22, 3},
-      {14, 154, 148, 176, 13},
-      {198, 129, 219, 17, 10}
-    },
-    { {172, 158, 132, 125, 4},
-      {202, 161, 250, 46, 8},
-      {43, 226, 23, 147, 5},
-      {23, 69, 248, 85, 3}
-    },
-    { {112, 105, 55, 71, 12},
-      {25, 79, 97, 156, 13},
-      {62, 46, 201, 96, 14},
-      {179, 152, 111, 41, 8}
-    },
-    { {68, 181, 20, 179, 2},
-      {193, 19, 146, 180, 3},
-      {76, 210, 138, 210, 2},
-      {194, 212, 156, 136, 3}
-    },
-    { {231, 77, 237, 224, 10},
-      {176, 151, 39, 235, 14},
-      {80, 123, 123, 46, 7},
-      {125, 126, 78, 144, 13}
-    },
-    { {53, 29, 98, 66, 10},
-      {224, 90, 33, 104, 13},
-      {84, 36, 107, 138, 12},
-      {177, 104, 69, 160, 7}
-    },
-    { {142, 125, 171, 62, 10},
-      {219, 246, 135, 35, 13},
-      {87, 205, 91, 231, 1},
-      {188, 78, 22, 253, 11}
-    },
-    { {82, 219, 5, 133, 6},
-      {88, 31, 88, 133, 10},
-      {106, 26, 13, 180, 10},
-      {90, 17, 175, 129, 10}
-    },
-    { {240, 135, 244, 59, 6},
-      {32, 187, 250, 182, 5},
-      {109, 194, 254, 16, 15},
-      {166, 213, 253, 208, 4}
-    },
-    { {78, 144, 152, 110, 1},
-      {206, 160, 22, 153, 1},
-      {135, 97, 144, 151, 2},
-      {137, 150, 128, 87, 3}
-    },
-    { {210, 100, 39, 89, 9},
-      {21, 109, 129, 175, 4},
-      {153, 174, 66, 100, 11},
-      {47, 88, 27, 106, 8}
-    },
-    { {36, 194, 245, 253, 5},
-      {188, 165, 250, 28, 6},
-      {171, 250, 244, 50, 4},
-      {99, 133, 250, 83, 13}
-    },
-    { {50, 142, 228, 41, 3},
-      {36, 185, 58, 37, 12},
-      {201, 66, 119, 20, 12},
-      {58, 69, 201, 210, 4}
-    },
-    { {107, 62, 162, 144, 11},
-      {71, 208, 169, 225, 14},
-      {208, 148, 87, 205, 6},
-      {120, 121, 80, 190, 2}
-    },
-    { {217, 65, 43, 194, 11},
-      {22, 94, 5, 202, 7},
-      {212, 61, 72, 41, 11},
-      {229, 58, 7, 166, 8}
-    },
-    { {156, 165, 116, 197, 7},
-      {175, 27, 80, 62, 6},
-      {234, 50, 234, 83, 9},
-      {103, 192, 173, 143, 5}
-    },
-    { {17, 109, 219, 74, 15},
-      {53, 254, 69, 120, 9},
-      {245, 45, 187, 104, 8},
-      {145, 234, 39, 250, 12}
-    },
-    { {174, 87, 71, 134, 8},
-      {250, 71, 41, 35, 3},
-      {22, 30, 46, 167, 5},
-      {204, 73, 78, 37, 15}
-    },
-    { {114, 224, 117, 97, 4},
-      {49, 13, 114, 157, 4},
-      {40, 106, 224, 116, 14},
-      {43, 148, 235, 8, 12}
-    },
-    { {198, 150, 180, 86, 6},
-      {200, 145, 216, 187, 5},
-      {102, 162, 214, 150, 3},
-      {173, 209, 184, 145, 3}
-    },
-    { {168, 197, 195, 205, 1},
-      {62, 230, 48, 46, 2},
-      {139, 60, 58, 49, 5},
-      {71, 64, 198, 119, 12}
-    },
-    { {91, 21, 74, 119, 1},
-      {110, 74, 134, 237, 1},
-      {142, 229, 42, 141, 10},
-      {139, 118, 21, 39, 6}
-    },
-    { {205, 163, 184, 200, 5},
-      {135, 162, 92, 218, 6},
-      {161, 49, 220, 91, 3},
-      {101, 179, 164, 94, 1}
-    },
-    { {74, 204, 221, 214, 7},
-      {62, 149, 212, 185, 11},
-      {230, 187, 179, 53, 2},
-      {217, 210, 186, 151, 12}
-    },
-    { {102, 82, 239, 170, 15},
-      {244, 245, 111, 129, 7},
-      {245, 95, 116, 166, 6},
-      {232, 31, 106, 242, 15}
-    },
-    { {173, 218, 37, 160, 0},
-      {210, 5, 58, 66, 14},
-      {0, 90, 69, 187, 5},
-      {116, 37, 202, 4, 11}
-    },
-    { {252, 230, 67, 94, 0},
-      {187, 108, 184, 170, 1},
-      {7, 172, 38, 115, 15},
-      {133, 81, 211, 109, 13}
-    },
-    { {187, 145, 56, 91, 8},
-      {66, 42, 181, 95, 5},
-      {29, 161, 200, 157, 13},
-      {175, 170, 213, 68, 2}
-    },
-    { {52, 217, 147, 145, 4},
-      {208, 206, 240, 20, 10},
-      {40, 156, 153, 178, 12},
-      {82, 128, 247, 48, 11}
-    },
-    { {160, 29, 41, 117, 12},
-      {88, 2, 231, 46, 12},
-      {58, 233, 75, 128, 5},
-      {55, 78, 116, 1, 10}
-    },
-    { {197, 91, 119, 176, 10},
-      {240, 87, 139, 210, 14},
-      {80, 222, 237, 170, 3},
-      {116, 189, 30, 160, 15}
-    },
-    { {180, 103, 48, 193, 10},
-      {129, 30, 41, 62, 6},
-      {88, 48, 206, 98, 13},
-      {103, 201, 71, 136, 1}
-    },
-    { {79, 215, 217, 189, 10},
-      {250, 182, 159, 245, 2},
-      {91, 217, 190, 191, 2},
-      {74, 255, 150, 213, 15}
-    },
-    { {62, 239, 157, 76, 6},
-      {155, 191, 124, 57, 8},
-      {99, 43, 159, 119, 12},
-      {25, 195, 239, 221, 9}
-    },
-    { {211, 16, 230, 71, 6},
-      {104, 217, 64, 207, 5},
-      {110, 38, 112, 140, 11},
-      {175, 48, 41, 177, 6}
-    },
-    { {150, 212, 131, 130, 1},
-      {212, 204, 16, 35, 3},
-      {132, 28, 18, 182, 9},
-      {204, 64, 131, 50, 11}
-    },
-    { {190, 66, 191, 212, 9},
-      {158, 205, 173, 27, 6},
-      {146, 191, 212, 39, 13},
-      {109, 139, 91, 55, 9}
-    },
-    { {66, 18, 49, 102, 9},
-      {92, 0, 11, 153, 5},
-      {150, 104, 196, 132, 2},
-      {169, 157, 0, 3, 10}
-    },
-    { {51, 202, 85, 219, 9},
-      {52, 45, 185, 93, 11},
-      {157, 186, 165, 60, 12},
-      {219, 169, 219, 66, 12}
-    },
-    { {165, 14, 174, 0, 13},
-      {132, 193, 109, 98, 12},
-      {176, 7, 87, 10, 5},
-      {52, 107, 104, 50, 1}
-    },
-    { {86, 110, 32, 220, 13},
-      {141, 44, 201, 169, 14},
-      {179, 176, 71, 102, 10},
-      {121, 89, 51, 75, 1}
-    },
-    { {126, 177, 2, 164, 3},
-      {207, 90, 50, 129, 2},
-      {194, 84, 8, 215, 14},
-      {72, 20, 197, 175, 3}
-    },
-    { {175, 51, 166, 149, 7},
-      {207, 211, 232, 71, 6},
-      {234, 150, 92, 207, 5},
-      {110, 33, 124, 191, 3}
-    },
-    { {144, 39, 133, 201, 15},
-      {21, 187, 73, 46, 2},
-      {249, 58, 30, 64, 9},
-      {71, 73, 45, 218, 8}
-    },
-    { {26, 175, 114, 194, 0},
-      {35, 74, 24, 57, 15},
-      {4, 52, 239, 85, 8},
-      {249, 193, 133, 44, 4}
-    },
-    { {140, 72, 88, 22, 8},
-      {170, 4, 133, 18, 9},
-      {22, 129, 161, 35, 1},
-      {148, 138, 18, 5, 5}
-    },
-    { {221, 184, 28, 187, 8},
-      {195, 41, 151, 214, 11},
-      {29, 211, 129, 219, 11},
-      {214, 190, 153, 76, 3}
-    },
-    { {41, 92, 192, 64, 12},
-      {98, 132, 97, 104, 8},
-      {48, 32, 51, 169, 4},
-      {17, 104, 98, 20, 6}
-    },
-    { {204, 21, 5, 90, 14},
-      {210, 51, 193, 170, 1},
-      {117, 170, 10, 131, 3},
-      {133, 88, 60, 196, 11}
-    },
-    { {218, 107, 24, 244, 9},
-      {15, 14, 143, 155, 10},
-      {146, 241, 141, 101, 11},
-      {93, 159, 23, 15, 0}
-    },
-    { {167, 135, 108, 37, 9},
-      {172, 3, 63, 103, 4},
-      {154, 67, 110, 30, 5},
-      {46, 111, 204, 3, 5}
-    },
-    { {246, 183, 42, 152, 5},
-      {197, 106, 252, 163, 6},
-      {161, 149, 78, 214, 15},
-      {108, 83, 245, 106, 3}
-    },
-    { {176, 8, 245, 30, 13},
-      {60, 169, 225, 18, 13},
-      {183, 138, 241, 0, 13},
-      {180, 136, 121, 83, 12}
-    },
-    { {75, 168, 124, 205, 13},
-      {47, 33, 85, 221, 14},
-      {187, 51, 225, 93, 2},
-      {123, 186, 168, 79, 4}
-    },
-    { {132, 228, 215, 70, 3},
-      {189, 213, 16, 58, 1},
-      {198, 46, 178, 114, 1},
-      {133, 192, 138, 187, 13}
-    },
-    { {108, 145, 86, 98, 0},
-      {226, 67, 50, 152, 1},
-      {4, 102, 168, 147, 6},
-      {129, 148, 204, 36, 7}
-    },
-    { {161, 89, 232, 111, 0},
-      {104, 166, 38, 78, 13},
-      {15, 97, 121, 168, 5},
-      {183, 38, 70, 81, 6}
-    },
-    { {240, 101, 172, 214, 8},
-      {9, 143, 165, 170, 7},
-      {22, 179, 90, 96, 15},
-      {229, 90, 95, 25, 0}
-    },
-    { {151, 176, 34, 145, 10},
-      {193, 88, 145, 71, 6},
-      {88, 148, 64, 222, 9},
-      {110, 40, 145, 168, 3}
-    },
-    { {191, 36, 1, 206, 6},
-      {155, 56, 96, 107, 3},
-      {103, 56, 2, 79, 13},
-      {205, 96, 97, 205, 9}
-    },
-    { {164, 202, 31, 226, 1},
-      {148, 69, 62, 26, 11},
-      {132, 127, 133, 50, 5},
-      {213, 135, 202, 34, 9}
-    },
-    { {17, 222, 135, 135, 9},
-      {92, 205, 25, 100, 11},
-      {158, 30, 23, 184, 8},
-      {210, 105, 139, 51, 10}
-    },
-    { {57, 73, 184, 51, 5},
-      {6, 142, 230, 84, 13},
-      {172, 193, 217, 41, 12},
-      {178, 166, 119, 22, 0}
-    },
-    { {134, 25, 53, 96, 13},
-      {212, 3, 67, 27, 12},
-      {176, 106, 201, 134, 1},
-      {61, 140, 44, 2, 11}
-    },
-    { {200, 75, 66, 10, 11},
-      {38, 118, 9, 130, 9},
-      {213, 4, 45, 33, 3},
-      {148, 25, 6, 230, 4}
-    },
-    { {81, 136, 22, 43, 15},
-      {4, 121, 83, 212, 9},
-      {253, 70, 129, 24, 10},
-      {146, 188, 169, 226, 0}
-    },
-    { {198, 116, 204, 159, 0},
-      {233, 165, 132, 167, 3},
-      {15, 147, 50, 230, 3},
-      {206, 82, 26, 89, 7}
-    },
-    { {168, 22, 147, 66, 12},
-      {82, 192, 105, 58, 1},
-      {52, 44, 150, 129, 5},
-      {133, 201, 96, 52, 10}
-    },
-    { {91, 182, 26, 190, 12},
-      {75, 104, 223, 241, 3},
-      {55, 213, 134, 221, 10},
-      {200, 255, 177, 109, 2}
-    },
-    { {64, 57, 11, 138, 10},
-      {81, 114, 5, 128, 11},
-      {85, 29, 9, 192, 2},
-      {208, 26, 4, 232, 10}
-    },
-    { {49, 229, 119, 99, 10},
-      {49, 95, 51, 124, 5},
-      {92, 110, 234, 120, 12},
-      {163, 236, 207, 168, 12}
-    },
-    { {138, 181, 190, 128, 6},
-      {67, 211, 84, 51, 6},
-      {96, 23, 218, 213, 1},
-      {108, 194, 172, 188, 2}
-    },
-    { {232, 127, 242, 172, 9},
-      {111, 230, 43, 178, 14},
-      {147, 84, 255, 225, 7},
-      {116, 221, 70, 127, 6}
-    },
-    { {133, 144, 118, 85, 9},
-      {236, 65, 145, 94, 4},
-      {154, 166, 224, 154, 1},
-      {39, 168, 152, 35, 7}
-    },
-    { {173, 4, 85, 41, 5},
-      {182, 33, 98, 118, 0},
-      {169, 74, 162, 11, 5},
-      {6, 228, 104, 70, 13}
-    },
-    { {94, 100, 156, 243, 5},
-      {135, 141, 198, 189, 3},
-      {172, 243, 146, 103, 10},
-      {203, 214, 59, 30, 1}
-    },
-    { {113, 188, 174, 157, 13},
-      {77, 233, 245, 228, 14},
-      {187, 151, 83, 216, 14},
-      {114, 122, 249, 123, 2}
-    },
-    { {202, 194, 32, 47, 13},
-      {14, 36, 91, 135, 5},
-      {191, 64, 68, 53, 3},
-      {174, 29, 162, 71, 0}
-    },
-    { {237, 109, 12, 225, 0},
-      {131, 7, 38, 238, 10},
-      {8, 115, 11, 107, 7},
-      {87, 118, 78, 12, 1}
-    },
-    { {211, 179, 54, 142, 8},
-      {73, 107, 25, 211, 7},
-      {23, 22, 204, 220, 11},
-      {236, 185, 141, 105, 2}
-    },
-    { {88, 251, 152, 132, 4},
-      {75, 142, 92, 144, 10},
-      {34, 17, 157, 241, 10},
-      {80, 147, 167, 29, 2}
-    },
-    { {66, 176, 73, 175, 12},
-      {121, 32, 87, 133, 3},
-      {63, 89, 32, 212, 2},
-      {202, 30, 160, 73, 14}
-    },
-    { {165, 172, 222, 241, 10},
-      {161, 209, 183, 126, 10},
-      {88, 247, 179, 90, 5},
-      {87, 238, 216, 184, 5}
-    },
-    { {126, 74, 98, 45, 6},
-      {170, 124, 106, 133, 12},
-      {107, 68, 101, 39, 14},
-      {58, 21, 99, 229, 5}
-    },
-    { {93, 233, 95, 78, 9},
-      {191, 111, 21, 216, 9},
-      {151, 47, 169, 123, 10},
-      {145, 186, 143, 111, 13}
-    },
-    { {34, 197, 24, 23, 9},
-      {12, 6, 181, 53, 1},
-      {158, 129, 138, 52, 4},
-      {138, 202, 214, 3, 0}
-    },
-    { {115, 117, 108, 186, 5},
-      {101, 47, 230, 225, 7},
-      {165, 211, 106, 236, 14},
-      {232, 118, 127, 74, 6}
-    },
-    { {80, 47, 87, 216, 11},
-      {53, 123, 137, 184, 10},
-      {209, 190, 175, 64, 10},
-      {81, 217, 29, 234, 12}
-    },
-    { {154, 160, 25, 211, 11},
-      {23, 24, 149, 31, 3},
-      {220, 185, 128, 85, 9},
-      {207, 138, 145, 142, 8}
-    },
-    { {61, 180, 129, 166, 15},
-      {223, 152, 115, 96, 3},
-      {246, 88, 18, 219, 12},
-      {192, 108, 225, 159, 11}
-    },
-    { {39, 218, 159, 156, 8},
-      {216, 229, 189, 81, 10},
-      {19, 159, 149, 190, 4},
-      {88, 171, 218, 113, 11}
-    },
-    { {58, 103, 134, 237, 6},
-      {11, 255, 106, 45, 2},
-      {107, 118, 30, 101, 12},
-      {75, 69, 111, 253, 0}
-    },
-    { {132, 55, 15, 143, 6},
-      {217, 115, 76, 38, 3},
-      {111, 31, 14, 194, 1},
-      {198, 67, 44, 233, 11}
-    },
-    { {53, 66, 74, 6, 5},
-      {172, 76, 108, 64, 1},
-      {166, 5, 36, 42, 12},
-      {128, 35, 99, 35, 5}
-    },
-    { {131, 37, 139, 194, 7},
-      {21, 210, 68, 107, 3},
-      {228, 61, 26, 76, 1},
-      {205, 98, 36, 186, 8}
-    },
-    { {6, 72, 246, 57, 4},
-      {160, 229, 194, 21, 12},
-      {41, 198, 241, 38, 0},
-      {58, 132, 58, 112, 5}
-    },
-    { {46, 148, 213, 97, 12},
-      {242, 129, 115, 61, 0},
-      {56, 106, 178, 151, 4},
-      {11, 204, 232, 20, 15}
-    },
-    { {72, 50, 160, 103, 2},
-      {75, 144, 10, 140, 5},
-      {78, 96, 84, 193, 2},
-      {163, 21, 0, 157, 2}
-    },
-    { {228, 117, 33, 147, 1},
-      {213, 6, 160, 166, 7},
-      {140, 152, 74, 226, 7},
-      {230, 80, 86, 10, 11}
-    },
-    { {110, 253, 140, 158, 9},
-      {207, 167, 181, 161, 11},
-      {151, 147, 27, 247, 6},
-      {216, 90, 222, 95, 3}
-    },
-    { {0, 211, 242, 119, 9},
-      {108, 198, 155, 28, 5},
-      {158, 228, 252, 176, 0},
-      {163, 141, 150, 51, 6}
-    },
-    { {99, 216, 68, 68, 11},
-      {108, 21, 49, 201, 8},
-      {210, 34, 33, 188, 6},
-      {25, 56, 202, 131, 6}
-    },
-    { {249, 28, 183, 98, 7},
-      {86, 217, 98, 250, 13},
-      {228, 110, 211, 137, 15},
-      {181, 244, 105, 182, 10}
-    },
-    { {148, 34, 208, 61, 7},
-      {173, 184, 202, 22, 0},
-      {235, 192, 180, 66, 9},
-      {6, 133, 49, 219, 5}
-    },
-    { {187, 200, 20, 31, 6},
-      {10, 61, 240, 87, 9},
-      {111, 130, 129, 61, 13},
-      {158, 160, 251, 197, 0}
-    },
-    { {69, 152, 237, 76, 14},
-      {248, 177, 85, 200, 12},
-      {115, 43, 113, 154, 2},
-      {49, 58, 168, 209, 15}
-    },
-    { {83, 226, 244, 224, 9},
-      {37, 141, 27, 217, 6},
-      {144, 114, 244, 124, 10},
-      {105, 189, 139, 26, 4}
-    },
-    { {241, 178, 125, 130, 9},
-      {117, 9, 61, 210, 7},
-      {148, 27, 228, 216, 15},
-      {228, 187, 201, 10, 14}
-    },
-    { {42, 202, 178, 62, 9},
-      {14, 228, 187, 17, 13},
-      {151, 196, 213, 53, 4},
-      {184, 141, 210, 119, 0}
-    },
-    { {123, 122, 214, 143, 9},
-      {111, 237, 41, 213, 11},
-      {159, 22, 181, 237, 14},
-      {218, 185, 75, 127, 6}
-    },
-    { {130, 225, 42, 209, 13},
-      {5, 70, 213, 15, 6},
-      {184, 181, 72, 116, 1},
-      {111, 10, 182, 42, 0}
-    },
-    { {37, 245, 188, 164, 11},
-      {205, 151, 55, 112, 6},
-      {210, 83, 218, 250, 4},
-      {96, 238, 206, 155, 3}
-    },
-    { {150, 173, 51, 250, 11},
-      {149, 122, 147, 59, 15},
-      {213, 252, 203, 86, 9},
-      {253, 204, 149, 234, 9}
-    },
-    { {116, 221, 218, 89, 11},
-      {228, 254, 181, 188, 8},
-      {217, 165, 187, 178, 14},
-      {19, 218, 215, 242, 7}
-    },
-    { {190, 51, 16, 82, 7},
-      {199, 26, 232, 27, 1},
-      {228, 160, 140, 199, 13},
-      {141, 129, 117, 142, 3}
-    },
-    { {175, 106, 142, 227, 12},
-      {131, 197, 111, 79, 11},
-      {60, 119, 21, 111, 5},
-      {223, 47, 106, 60, 1}
-    },
-    { {80, 157, 15, 85, 14},
-      {88, 91, 213, 172, 8},
-      {122, 175, 11, 144, 10},
-      {19, 90, 189, 161, 10}
-    },
-    { {90, 168, 135, 202, 13},
-      {23, 233, 81, 137, 11},
-      {181, 62, 17, 85, 10},
-      {217, 24, 169, 126, 8}
-    },
-    { {248, 216, 14, 113, 13},
-      {70, 77, 247, 142, 8},
-      {184, 231, 1, 177, 15},
-      {23, 30, 251, 38, 2}
-    },
-    { {18, 41, 212, 58, 0},
-      {33, 171, 130, 17, 9},
-      {5, 194, 185, 68, 8},
-      {152, 132, 29, 88, 4}
-    },
-    { {58, 213, 230, 98, 8},
-      {98, 207, 51, 41, 5},
-      {20, 102, 122, 181, 12},
-      {169, 76, 207, 52, 6}
-    },
-    { {68, 63, 156, 94, 2},
-      {201, 179, 140, 184, 9},
-      {71, 163, 159, 194, 2},
-      {145, 211, 28, 217, 3}
-    },
-    { {53, 224, 26, 247, 2},
-      {137, 92, 182, 92, 3},
-      {78, 245, 128, 122, 12},
-      {195, 166, 211, 169, 1}
-    },
-    { {82, 84, 77, 114, 6},
-      {112, 29, 198, 169, 1},
-      {100, 235, 34, 164, 10},
-      {137, 86, 59, 128, 14}
-    },
-    { {8, 222, 33, 65, 9},
-      {86, 4, 25, 44, 12},
-      {152, 40, 71, 177, 0},
-      {51, 73, 130, 6, 10}
-    },
-    { {151, 233, 242, 229, 5},
-      {173, 206, 82, 95, 14},
-      {170, 116, 249, 126, 9},
-      {127, 164, 167, 59, 5}
-    },
-    { {117, 185, 123, 135, 5},
-      {253, 74, 116, 212, 15},
-      {174, 29, 233, 218, 14},
-      {242, 178, 229, 43, 15}
-    },
-    { {28, 149, 63, 106, 13},
-      {214, 107, 87, 56, 5},
-      {181, 111, 202, 147, 8},
-      {161, 206, 173, 102, 11}
-    },
-    { {72, 136, 208, 174, 15},
-      {46, 176, 83, 144, 11},
-      {247, 80, 177, 17, 2},
-      {208, 156, 160, 215, 4}
-    },
-    { {35, 82, 133, 125, 8},
-      {88, 165, 171, 77, 0},
-      {27, 234, 20, 172, 4},
-      {11, 45, 90, 81, 10}
-    },
-    { {145, 10, 12, 159, 8},
-      {8, 41, 141, 70, 11},
-      {31, 147, 5, 8, 9},
-      {214, 43, 25, 65, 0}
-    },
-    { {114, 106, 253, 204, 4},
-      {57, 173, 108, 153, 14},
-      {35, 59, 245, 100, 14},
-      {121, 147, 107, 89, 12}
-    },
-    { {70, 182, 223, 184, 12},
-      {241, 225, 223, 177, 2},
-      {49, 223, 182, 214, 2},
-      {72, 223, 184, 120, 15}
-    },
-    { {55, 30, 152, 201, 12},
-      {192, 168, 109, 125, 10},
-      {57, 49, 151, 142, 12},
-      {91, 235, 97, 80, 3}
-    },
-    { {242, 133, 64, 180, 10},
-      {40, 26, 179, 163, 2},
-      {82, 208, 42, 20, 15},
-      {76, 92, 213, 129, 4}
-    },
-    { {155, 53, 4, 69, 10},
-      {75, 27, 1, 111, 0},
-      {90, 34, 10, 205, 9},
-      {15, 104, 13, 141, 2}
-    },
-    { {138, 236, 145, 248, 13},
-      {23, 164, 211, 59, 10},
-      {177, 248, 147, 117, 1},
-      {93, 204, 178, 94, 8}
-    },
-    { {173, 85, 173, 77, 15},
-      {222, 183, 101, 110, 4},
-      {251, 43, 90, 171, 5},
-      {39, 106, 110, 215, 11}
-    },
-    { {42, 24, 202, 208, 2},
-      {98, 208, 164, 9, 10},
-      {64, 181, 49, 133, 4},
-      {89, 2, 80, 180, 6}
-    },
-    { {237, 2, 60, 165, 10},
-      {138, 17, 47, 214, 6},
-      {90, 83, 196, 11, 7},
-      {102, 191, 72, 133, 1}
-    },
-    { {190, 137, 112, 155, 1},
-      {166, 42, 176, 23, 15},
-      {141, 144, 233, 23, 13},
-      {254, 128, 213, 70, 5}
-    },
-    { {66, 233, 185, 200, 9},
-      {21, 166, 21, 153, 14},
-      {145, 57, 217, 116, 2},
-      {121, 154, 134, 90, 8}
-    },
-    { {224, 185, 52, 114, 9},
-      {69, 3, 179, 154, 13},
-      {148, 226, 201, 208, 7},
-      {181, 156, 220, 10, 2}
-    },
-    { {135, 32, 220, 54, 11},
-      {173, 145, 135, 83, 1},
-      {214, 195, 176, 78, 1},
-      {140, 174, 24, 155, 5}
-    },
-    { {93, 132, 96, 137, 7},
-      {166, 56, 80, 228, 6},
-      {233, 16, 98, 27, 10},
-      {98, 112, 161, 198, 5}
-    },
-    { {144, 204, 205, 2, 15},
-      {52, 157, 85, 34, 9},
-      {244, 11, 51, 48, 9},
-      {148, 74, 171, 146, 12}
-    },
-    { {140, 134, 212, 168, 8},
-      {162, 161, 27, 50, 2},
-      {17, 82, 182, 19, 1},
-      {68, 205, 136, 84, 5}
-    },
-    { {120, 169, 76, 36, 12},
-      {43, 11, 119, 128, 8},
-      {50, 67, 41, 81, 14},
-      {16, 30, 237, 13, 4}
-    },
-    { {182, 101, 251, 203, 12},
-      {177, 238, 101, 63, 7},
-      {61, 61, 250, 102, 13},
-      {239, 202, 103, 120, 13}
-    },
-    { {39, 167, 32, 26, 6},
-      {129, 50, 248, 97, 5},
-      {101, 128, 78, 94, 4},
-      {168, 97, 244, 200, 1}
-    },
-    { {193, 202, 69, 13, 5},
-      {60, 37, 88, 198, 8},
-      {171, 10, 37, 56, 3},
-      {22, 49, 170, 67, 12}
-    },
-    { {75, 38, 242, 6, 13},
-      {47, 192, 73, 241, 5},
-      {182, 4, 246, 77, 2},
-      {168, 249, 32, 63, 4}
-    },
-    { {146, 37, 46, 39, 11},
-      {13, 91, 7, 39, 5},
-      {222, 71, 74, 68, 9},
-      {174, 78, 13, 171, 0}
-    },
-    { {240, 175, 98, 24, 8},
-      {33, 106, 185, 162, 12},
-      {17, 132, 111, 80, 15},
-      {52, 89, 213, 104, 4}
-    },
-    { {50, 161, 124, 11, 6},
-      {33, 59, 116, 21, 5},
-      {109, 3, 232, 84, 12},
-      {170, 130, 237, 200, 4}
-    },
-    { {107, 9, 58, 162, 14},
-      {2, 82, 103, 209, 15},
-      {116, 85, 201, 13, 6},
-      {248, 190, 100, 164, 0}
-    },
-    { {134, 231, 189, 205, 5},
-      {157, 167, 92, 63, 6},
-      {171, 59, 222, 118, 1},
-      {111, 195, 174, 91, 9}
-    },
-    { {70, 76, 128, 181, 11},
-      {140, 148, 131, 165, 10},
-      {218, 208, 19, 38, 2},
-      {90, 92, 18, 147, 1}
-    },
-    { {110, 146, 188, 233, 7},
-      {198, 177, 126, 157, 6},
-      {233, 115, 212, 151, 6},
-      {107, 151, 232, 214, 3}
-    },
-    { {10, 141, 210, 173, 4},
-      {42, 226, 82, 53, 10},
-      {43, 84, 187, 21, 0},
-      {90, 196, 164, 117, 4}
-    },
-    { {133, 26, 254, 234, 9},
-      {228, 225, 15, 90, 15},
-      {149, 119, 245, 138, 1},
-      {245, 175, 8, 114, 7}
-    },
-    { {102, 122, 112, 73, 9},
-      {229, 36, 41, 157, 12},
-      {153, 32, 229, 230, 6},
-      {59, 153, 66, 74, 7}
-    },
-    { {113, 49, 97, 102, 13},
-      {125, 10, 99, 200, 5},
-      {182, 104, 104, 200, 14},
-      {161, 60, 101, 11, 14}
-    },
-    { {197, 119, 160, 82, 15},
-      {197, 150, 201, 234, 5},
-      {244, 160, 94, 234, 3},
-      {165, 121, 54, 154, 3}
-    },
-    { {224, 70, 76, 187, 12},
-      {32, 37, 239, 166, 3},
-      {61, 211, 38, 32, 7},
-      {198, 95, 122, 64, 4}
-    },
-    { {244, 9, 85, 141, 10},
-      {184, 59, 33, 150, 10},
-      {91, 26, 169, 2, 15},
-      {86, 152, 77, 193, 13}
-    },
-    { {34, 79, 148, 169, 9},
-      {4, 167, 43, 53, 10},
-      {153, 82, 159, 36, 4},
-      {90, 205, 78, 82, 0}
-    },
-    { {229, 88, 200, 244, 13},
-      {236, 132, 231, 202, 10},
-      {178, 241, 49, 170, 7},
-      {85, 62, 114, 19, 7}
-    },
-    { {243, 18, 209, 192, 11},
-      {116, 152, 41, 219, 2},
-      {208, 56, 180, 140, 15},
-      {77, 185, 65, 146, 14}
-    },
-    { {41, 114, 88, 124, 11},
-      {111, 52, 175, 88, 0},
-      {211, 225, 164, 233, 4},
-      {1, 175, 82, 207, 6}
-    },
-    { {65, 179, 38, 98, 4},
-      {65, 67, 90, 200, 5},
-      {36, 102, 76, 216, 2},
-      {161, 53, 172, 40, 2}
-    },
-    { {218, 87, 244, 214, 12},
-      {106, 143, 201, 187, 7},
-      {54, 178, 254, 165, 11},
-      {237, 217, 63, 21, 6}
-    },
-    { {186, 1, 109, 186, 9},
-      {54, 43, 167, 3, 7},
-      {149, 219, 104, 5, 13},
-      {236, 14, 93, 70, 12}
-    },
-    { {53, 137, 198, 176, 5},
-      {164, 203, 242, 64, 10},
-      {160, 214, 57, 26, 12},
-      {80, 36, 253, 50, 5}
-    },
-    { {223, 69, 8, 189, 5},
-      {142, 46, 198, 231, 2},
-      {171, 209, 10, 47, 11},
-      {78, 118, 55, 71, 1}
-    },
-    { {50, 82, 34, 250, 8},
-      {64, 108, 171, 9, 7},
-      {21, 244, 68, 164, 12},
-      {233, 13, 83, 96, 2}
-    },
-    { {87, 54, 121, 125, 4},
-      {249, 40, 206, 253, 4},
-      {43, 233, 230, 206, 10},
-      {43, 247, 49, 73, 15}
-    },
-    { {100, 77, 74, 190, 10},
-      {168, 118, 167, 160, 11},
-      {87, 213, 43, 34, 6},
-      {208, 94, 86, 225, 5}
-    },
-    { {13, 189, 14, 79, 10},
-      {203, 115, 21, 108, 9},
-      {95, 39, 11, 219, 0},
-      {147, 106, 140, 237, 3}
-    },
-    { {20, 18, 155, 246, 13},
-      {220, 200, 207, 24, 3},
-      {182, 253, 148, 130, 8},
-      {193, 143, 49, 51, 11}
-    },
-    { {160, 137, 141, 158, 1},
-      {28, 163, 180, 2, 11},
-      {135, 155, 25, 16, 5},
-      {212, 2, 220, 83, 8}
-    },
-    { {116, 80, 182, 226, 11},
-      {196, 221, 35, 152, 7},
-      {212, 118, 208, 162, 14},
-      {225, 156, 75, 178, 3}
-    },
-    { {224, 228, 28, 54, 7},
-      {13, 21, 246, 178, 1},
-      {230, 195, 130, 112, 7},
-      {132, 214, 250, 139, 0}
-    },
-    { {105, 149, 101, 253, 11},
-      {126, 51, 179, 236, 6},
-      {219, 250, 106, 153, 6},
-      {99, 124, 220, 199, 14}
-    },
-    { {103, 160, 233, 22, 8},
-      {185, 128, 181, 193, 5},
-      {22, 137, 112, 94, 6},
-      {168, 58, 208, 25, 13}
-    },
-    { {25, 252, 180, 77, 12},
-      {75, 173, 81, 124, 12},
-      {59, 34, 211, 249, 8},
-      {51, 232, 171, 93, 2}
-    },
-    { {240, 254, 74, 108, 6},
-      {105, 124, 126, 170, 8},
-      {99, 101, 39, 240, 15},
-      {21, 87, 227, 233, 6}
-    },
-    { {78, 229, 220, 11, 14},
-      {163, 183, 85, 181, 1},
-      {125, 3, 186, 119, 2},
-      {138, 218, 174, 220, 5}
-    },
-    { {178, 90, 177, 231, 7},
-      {92, 156, 106, 31, 15},
-      {238, 120, 213, 164, 13},
-      {255, 133, 99, 147, 10}
-    },
-    { {84, 197, 166, 143, 13},
-      {140, 239, 81, 164, 7},
-      {191, 22, 90, 50, 10},
-      {226, 88, 175, 115, 1}
-    },
-    { {247, 21, 47, 212, 3},
-      {220, 91, 164, 235, 6},
-      {194, 191, 74, 142, 15},
-      {109, 114, 93, 163, 11}
-    },
-    { {79, 145, 125, 232, 10},
-      {242, 51, 23, 217, 6},
-      {81, 123, 232, 159, 2},
-      {105, 190, 140, 196, 15}
-    },
-    { {9, 53, 24, 238, 6},
-      {75, 50, 70, 120, 3},
-      {103, 113, 138, 201, 0},
-      {193, 230, 36, 205, 2}
-    },
-    { {170, 77, 229, 141, 6},
-      {58, 183, 96, 39, 14},
-      {107, 26, 123, 37, 5},
-      {126, 64, 110, 213, 12}
-    },
-    { {251, 189, 163, 100, 14},
-      {91, 218, 115, 235, 12},
-      {114, 108, 91, 221, 15},
-      {61, 124, 229, 189, 10}
-    },
-    { {194, 140, 79, 157, 13},
-      {60, 97, 213, 167, 10},
-      {187, 159, 35, 20, 3},
-      {94, 90, 184, 99, 12}
-    },
-    { {221, 221, 90, 236, 8},
-      {234, 110, 23, 250, 10},
-      {19, 117, 171, 187, 11},
-      {85, 254, 135, 101, 7}
-    },
-    { {154, 123, 45, 105, 4},
-      {83, 47, 78, 15, 12},
-      {41, 107, 77, 229, 9},
-      {63, 7, 47, 76, 10}
-    },
-    { {218, 46, 220, 145, 1},
-      {39, 137, 140, 183, 10},
-      {136, 147, 183, 69, 11},
-      {94, 211, 25, 30, 4}
-    },
-    { {18, 21, 66, 25, 5},
-      {100, 106, 192, 37, 0},
-      {169, 132, 42, 132, 8},
-      {10, 64, 53, 98, 6}
-    },
-    { {58, 253, 126, 65, 13},
-      {103, 79, 117, 61, 12},
-      {184, 39, 235, 245, 12},
-      {59, 202, 239, 46, 6}
-    },
-    { {210, 145, 48, 33, 12},
-      {64, 10, 83, 151, 4},
-      {56, 64, 200, 148, 11},
-      {46, 156, 165, 0, 2}
-    },
-    { {136, 91, 123, 237, 6},
-      {122, 118, 78, 30, 14},
-      {107, 125, 237, 161, 1},
-      {119, 135, 38, 229, 14}
-    },
-    { {255, 26, 148, 3, 13},
-      {198, 137, 105, 215, 9},
-      {188, 2, 149, 143, 15},
-      {158, 185, 105, 22, 3}
-    },
-    { {138, 210, 5, 218, 10},
-      {82, 53, 153, 11, 3},
-      {85, 186, 4, 181, 1},
-      {205, 9, 154, 196, 10}
-    },
-    { {124, 254, 229, 86, 14},
-      {251, 157, 249, 168, 13},
-      {118, 170, 119, 243, 14},
-      {177, 89, 251, 157, 15}
-    },
-    { {15, 29, 188, 45, 9},
-      {206, 163, 7, 117, 12},
-      {155, 67, 219, 143, 0},
-      {58, 238, 12, 87, 3}
-    },
-    { {173, 125, 51, 119, 9},
-      {223, 70, 163, 126, 13},
-      {158, 236, 203, 235, 5},
-      {183, 236, 86, 47, 11}
-    },
-    { {94, 35, 218, 148, 5},
-      {175, 202, 204, 145, 2},
-      {162, 149, 188, 71, 10},
-      {72, 147, 53, 63, 5}
-    },
-    { {202, 135, 100, 114, 13},
-      {38, 3, 219, 171, 5},
-      {180, 226, 110, 21, 3},
-      {173, 93, 188, 6, 4}
-    },
-    { {42, 52, 86, 226, 7},
-      {103, 81, 98, 57, 3},
-      {228, 118, 162, 197, 4},
-      {201, 196, 104, 174, 6}
-    },
-    { {179, 128, 104, 125, 6},
-      {40, 56, 246, 79, 4},
-      {107, 225, 96, 28, 13},
-      {47, 38, 241, 193, 4}
-    },
-    { {73, 224, 165, 31, 6},
-      {27, 181, 208, 196, 5},
-      {111, 138, 80, 121, 2},
-      {162, 48, 186, 221, 8}
-    },
-    { {144, 226, 83, 62, 9},
-      {61, 108, 155, 18, 1},
-      {151, 204, 164, 112, 9},
-      {132, 141, 147, 107, 12}
-    },
-    { {221, 1, 6, 99, 13},
-      {134, 75, 67, 206, 1},
-      {188, 102, 8, 11, 11},
-      {135, 60, 45, 38, 1}
-    },
-    { {118, 160, 92, 144, 8},
-      {161, 9, 181, 145, 2},
-      {16, 147, 160, 86, 14},
-      {72, 154, 217, 8, 5}
-    },
-    { {14, 217, 3, 223, 6},
-      {218, 118, 208, 13, 11},
-      {111, 188, 9, 183, 0},
-      {219, 0, 182, 229, 11}
-    },
-    { {43, 112, 183, 113, 13},
-      {87, 197, 227, 93, 4},
-      {184, 238, 208, 237, 4},
-      {43, 172, 122, 62, 10}
-    },
-    { {78, 140, 226, 119, 3},
-      {174, 208, 146, 173, 13},
-      {206, 228, 115, 23, 2},
-      {187, 84, 144, 183, 5}
-    },
-    { {164, 109, 4, 140, 4},
-      {137, 39, 96, 34, 10},
-      {35, 18, 11, 98, 5},
-      {84, 64, 110, 73, 1}
-    },
-    { {174, 72, 136, 91, 10},
-      {130, 180, 165, 15, 9},
-      {93, 161, 17, 39, 5},
-      {159, 10, 82, 212, 1}
-    },
-    { {10, 163, 70, 143, 3},
-      {47, 115, 24, 5, 3},
-      {207, 22, 44, 85, 0},
-      {202, 1, 140, 239, 4}
-    },
-    { {106, 225, 111, 19, 7},
-      {55, 87, 244, 133, 5},
-      {236, 143, 104, 117, 6},
-      {170, 18, 254, 174, 12}
-    },
-    { {149, 35, 13, 186, 13},
-      {149, 43, 207, 66, 3},
-      {181, 219, 12, 74, 9},
-      {196, 47, 61, 74, 9}
-    },
-    { {228, 136, 181, 77, 4},
-      {152, 161, 112, 158, 12},
-      {43, 42, 209, 18, 7},
-      {55, 144, 232, 81, 9}
-    },
-    { {121, 10, 75, 108, 10},
-      {58, 120, 47, 200, 8},
-      {83, 109, 37, 9, 14},
-      {17, 63, 65, 229, 12}
-    },
-    { {64, 35, 127, 147, 9},
-      {53, 67, 141, 148, 7},
-      {156, 159, 236, 64, 2},
-      {226, 155, 28, 42, 12}
-    },
-    { {45, 191, 41, 200, 3},
-      {215, 50, 60, 104, 14},
-      {193, 57, 79, 219, 4},
-      {113, 99, 196, 206, 11}
-    },
-    { {202, 214, 76, 54, 0},
-      {106, 5, 158, 163, 1},
-      {6, 195, 38, 181, 3},
-      {140, 87, 154, 5, 6}
-    },
-    { {211, 175, 89, 151, 10},
-      {57, 26, 157, 247, 11},
-      {94, 153, 175, 92, 11},
-      {222, 251, 149, 137, 12}
-    },
-    { {157, 46, 167, 143, 5},
-      {159, 233, 72, 102, 15},
-      {175, 30, 87, 75, 9},
-      {246, 97, 41, 127, 9}
-    },
-    { {34, 211, 98, 6, 7},
-      {108, 86, 120, 1, 5},
-      {230, 4, 108, 180, 4},
-      {168, 1, 230, 163, 6}
-    },
-    { {204, 169, 43, 134, 6},
-      {155, 82, 84, 130, 15},
-      {102, 29, 73, 83, 3},
-      {244, 18, 164, 173, 9}
-    },
-    { {85, 43, 159, 167, 1},
-      {157, 203, 14, 212, 11},
-      {142, 95, 157, 74, 10},
-      {210, 183, 13, 59, 9}
-    },
-    { {203, 178, 173, 205, 11},
-      {95, 177, 29, 207, 6},
-      {219, 59, 84, 221, 3},
-      {111, 59, 136, 223, 10}
-    },
-    { {68, 250, 70, 198, 7},
-      {237, 85, 88, 136, 11},
-      {230, 54, 37, 242, 2},
-      {209, 17, 170, 171, 7}
-    },
-    { {231, 38, 143, 185, 7},
-      {149, 241, 238, 231, 2},
-      {233, 223, 22, 78, 7},
-      {78, 119, 120, 250, 9}
-    },
-    { {36, 175, 23, 170, 2},
-      {145, 115, 58, 48, 11},
-      {69, 94, 143, 82, 4},
-      {208, 197, 204, 232, 9}
-    },
-    { {67, 232, 194, 173, 10},
-      {41, 244, 19, 197, 10},
-      {91, 84, 49, 124, 2},
-      {90, 60, 130, 249, 4}
-    },
-    { {145, 205, 26, 71, 13},
-      {12, 78, 85, 126, 9},
-      {190, 37, 139, 56, 9},
-      {151, 234, 167, 35, 0}
-    },
-    { {104, 5, 2, 194, 10},
-      {2, 82, 33, 168, 3},
-      {84, 52, 10, 1, 6},
-      {193, 88, 68, 164, 0}
-    },
-    { {5, 213, 122, 29, 10},
-      {232, 118, 149, 116, 4},
-      {91, 133, 234, 186, 0},
-      {34, 234, 150, 225, 7}
-    },
-    { {88, 51, 178, 20, 8},
-      {75, 202, 137, 144, 4},
-      {18, 132, 220, 193, 10},
-      {32, 153, 21, 61, 2}
-    },
-    { {207, 23, 24, 178, 4},
-      {194, 2, 206, 243, 3},
-      {36, 209, 142, 143, 3},
-      {204, 247, 52, 4, 3}
-    },
-    { {86, 20, 124, 139, 2},
-      {224, 57, 4, 181, 7},
-      {77, 19, 226, 134, 10},
-      {234, 210, 9, 192, 7}
-    },
-    { {254, 81, 189, 45, 1},
-      {222, 175, 38, 151, 4},
-      {139, 75, 216, 167, 15},
-      {46, 150, 79, 87, 11}
-    },
-    { {48, 238, 165, 168, 4},
-      {17, 173, 122, 32, 14},
-      {33, 90, 87, 112, 12},
-      {112, 69, 235, 88, 8}
-    },
-    { {94, 27, 78, 166, 2},
-      {234, 91, 14, 129, 11},
-      {70, 87, 45, 135, 10},
-      {216, 23, 13, 165, 7}
-    },
-    { {37, 57, 142, 52, 3},
-      {205, 211, 166, 64, 8},
-      {194, 199, 25, 202, 4},
-      {16, 38, 92, 187, 3}
-    },
-    { {71, 238, 53, 187, 2},
-      {145, 53, 154, 245, 15},
-      {77, 218, 199, 126, 2},
-      {250, 245, 154, 200, 9}
-    },
-    { {105, 226, 147, 152, 11},
-      {23, 244, 185, 208, 2},
-      {209, 156, 148, 121, 6},
-      {64, 185, 210, 254, 8}
-    },
-    { {203, 235, 3, 139, 4},
-      {19, 102, 88, 199, 11},
-      {45, 28, 13, 125, 3},
-      {222, 49, 166, 108, 8}
-    },
-    { {151, 33, 193, 117, 9},
-      {189, 138, 131, 79, 0},
-      {154, 232, 56, 78, 9},
-      {15, 44, 21, 27, 13}
-    },
-    { {117, 81, 72, 151, 9},
-      {236, 14, 165, 196, 3},
-      {158, 145, 40, 170, 14},
-      {194, 58, 87, 3, 7}
-    },
-    { {87, 243, 99, 229, 3},
-      {253, 94, 26, 205, 6},
-      {202, 124, 108, 254, 10},
-      {107, 53, 135, 171, 15}
-    },
-    { {174, 100, 20, 104, 0},
-      {131, 37, 34, 59, 0},
-      {1, 98, 130, 103, 5},
-      {13, 196, 74, 76, 1}
-    },
-    { {126, 147, 161, 155, 5},
-      {214, 170, 248, 133, 7},
-      {173, 152, 92, 151, 14},
-      {234, 17, 245, 86, 11}
-    },
-    { {169, 131, 209, 245, 2},
-      {58, 146, 186, 94, 2},
-      {74, 248, 188, 25, 5},
-      {71, 165, 212, 149, 12}
-    },
-    { {100, 91, 1, 175, 9},
-      {220, 38, 43, 132, 11},
-      {159, 88, 13, 162, 6},
-      {210, 29, 70, 67, 11}
-    },
-    { {13, 167, 121, 86, 5},
-      {191, 2, 220, 120, 5},
-      {166, 169, 238, 91, 0},
-      {161, 227, 180, 15, 13}
-    },
-    { {114, 16, 159, 147, 13},
-      {84, 201, 229, 149, 3},
-      {188, 159, 144, 132, 14},
-      {202, 154, 121, 50, 10}
-    },
-    { {141, 12, 71, 198, 11},
-      {190, 81, 1, 106, 11},
-      {214, 62, 35, 11, 1},
-      {213, 104, 8, 167, 13}
-    },
-    { {109, 229, 76, 66, 3},
-      {167, 23, 52, 232, 1},
-      {196, 35, 42, 123, 6},
-      {129, 114, 206, 142, 5}
-    },
-    { {241, 35, 191, 102, 11},
-      {29, 219, 47, 218, 5},
-      {214, 111, 220, 72, 15},
-      {165, 191, 77, 187, 8}
-    },
-    { {180, 231, 234, 99, 7},
-      {165, 222, 126, 46, 5},
-      {236, 101, 126, 114, 13},
-      {167, 71, 231, 186, 5}
-    },
-    { {229, 224, 226, 108, 5},
-      {173, 228, 114, 202, 4},
-      {163, 100, 112, 122, 7},
-      {37, 52, 226, 123, 5}
-    },
-    { {90, 49, 4, 158, 15},
-      {79, 59, 193, 129, 3},
-      {247, 146, 8, 197, 10},
-      {200, 24, 61, 207, 2}
-    },
-    { {137, 248, 81, 23, 11},
-      {127, 20, 145, 86, 9},
-      {222, 136, 161, 249, 1},
-      {150, 168, 146, 143, 14}
-    },
-    { {111, 187, 159, 46, 10},
-      {219, 243, 63, 209, 9},
-      {87, 79, 157, 223, 6},
-      {152, 191, 204, 253, 11}
-    },
-    { {80, 175, 172, 250, 6},
-      {1, 187, 222, 168, 15},
-      {101, 243, 95, 80, 10},
-      {241, 87, 189, 216, 0}
-    },
-    { {181, 113, 7, 57, 6},
-      {209, 127, 226, 70, 0},
-      {105, 206, 8, 234, 13},
-      {6, 36, 127, 232, 11}
-    },
-    { {121, 119, 47, 9, 2},
-      {83, 127, 44, 228, 4},
-      {73, 15, 78, 233, 14},
-      {34, 115, 79, 236, 10}
-    },
-    { {177, 29, 65, 73, 3},
-      {116, 58, 32, 110, 8},
-      {201, 40, 43, 136, 13},
-      {23, 96, 69, 194, 14}
-    },
-    { {29, 227, 35, 74, 14},
-      {147, 126, 89, 72, 5},
-      {117, 44, 76, 123, 8},
-      {161, 41, 167, 236, 9}
-    },
-    { {179, 148, 34, 108, 13},
-      {76, 104, 115, 107, 4},
-      {179, 100, 66, 156, 13},
-      {45, 108, 225, 99, 2}
-    },
-    { {44, 126, 92, 173, 1},
-      {239, 37, 46, 52, 10},
-      {139, 83, 167, 227, 4},
-      {82, 199, 74, 79, 7}
-    },
-    { {95, 115, 48, 151, 13},
-      {207, 14, 201, 213, 7},
-      {190, 144, 204, 239, 10},
-      {234, 185, 55, 15, 3}
-    },
-    { {69, 251, 224, 160, 13},
-      {229, 134, 91, 192, 14},
-      {176, 80, 125, 250, 2},
-      {112, 61, 166, 26, 7}
-    },
-    { {9, 122, 74, 176, 0},
-      {99, 68, 142, 64, 10},
-      {0, 213, 37, 233, 0},
-      {80, 39, 18, 44, 6}
-    },
-    { {179, 119, 146, 163, 10},
-      {65, 222, 43, 119, 3},
-      {92, 84, 158, 236, 13},
-      {206, 237, 71, 184, 2}
-    },
-    { {98, 35, 175, 220, 7},
-      {29, 243, 236, 137, 6},
-      {227, 191, 92, 68, 6},
-      {105, 19, 124, 251, 8}
-    },
-    { {108, 155, 99, 108, 9},
-      {254, 98, 59, 136, 12},
-      {147, 108, 109, 147, 6},
-      {49, 29, 196, 103, 15}
-    },
-    { {155, 78, 142, 46, 9},
-      {14, 237, 15, 99, 9},
-      {151, 71, 23, 45, 9},
-      {156, 111, 11, 119, 0}
-    },
-    { {249, 195, 194, 21, 3},
-      {46, 222, 184, 198, 0},
-      {202, 132, 60, 57, 15},
-      {6, 49, 215, 183, 4}
-    },
-    { {119, 43, 15, 234, 11},
-      {149, 123, 47, 201, 11},
-      {213, 127, 13, 78, 14},
-      {217, 63, 77, 234, 9}
-    },
-    { {102, 250, 154, 171, 4},
-      {193, 228, 126, 149, 11},
-      {45, 85, 149, 246, 6},
-      {218, 151, 226, 120, 3}
-    },
-    { {116, 98, 77, 223, 13},
-      {189, 45, 237, 140, 3},
-      {191, 187, 36, 98, 14},
-      {195, 27, 123, 75, 13}
-    },
-    { {25, 222, 78, 102, 4},
-      {106, 77, 94, 104, 9},
-      {38, 103, 39, 185, 8},
-      {145, 103, 171, 37, 6}
-    },
-    { {148, 41, 230, 53, 14},
-      {169, 219, 195, 6, 12},
-      {122, 198, 121, 66, 9},
-      {54, 12, 61, 185, 5}
-    },
-    { {76, 236, 163, 246, 4},
-      {155, 196, 210, 168, 15},
-      {38, 252, 83, 115, 2},
-      {241, 84, 178, 61, 9}
-    },
-    { {164, 180, 6, 106, 6},
-      {193, 113, 114, 42, 1},
-      {101, 102, 2, 210, 5},
-      {133, 68, 232, 232, 3}
-    },
-    { {30, 86, 88, 215, 4},
-      {234, 12, 204, 61, 3},
-      {46, 177, 166, 167, 8},
-      {203, 195, 51, 5, 7}
-    },
-    { {219, 73, 192, 161, 2},
-      {34, 158, 2, 199, 10},
-      {72, 80, 57, 45, 11},
-      {94, 52, 7, 148, 4}
-    },
-    { {79, 81, 144, 218, 7},
-      {198, 182, 192, 217, 3},
-      {229, 176, 152, 175, 2},
-      {201, 176, 54, 214, 3}
-    },
-    { {1, 67, 44, 173, 5},
-      {12, 39, 78, 68, 6},
-      {171, 83, 76, 40, 0},
-      {98, 39, 46, 67, 0}
-    },
-    { {82, 252, 40, 115, 9},
-      {69, 12, 151, 173, 13},
-      {156, 225, 67, 244, 10},
-      {187, 94, 147, 10, 2}
-    },
-    { {67, 147, 62, 210, 15},
-      {68, 83, 221, 217, 7},
-      {244, 183, 204, 156, 2},
-      {233, 187, 188, 162, 2}
-    },
-    { {107, 7, 29, 172, 0},
-      {26, 35, 46, 241, 2},
-      {3, 91, 142, 13, 6},
-      {72, 247, 76, 69, 8}
-    },
-    { {81, 13, 171, 142, 1},
-      {28, 234, 4, 224, 15},
-      {135, 29, 91, 8, 10},
-      {240, 114, 5, 115, 8}
-    },
-    { {80, 201, 26, 157, 10},
-      {8, 126, 149, 148, 10},
-      {91, 149, 137, 48, 10},
-      {82, 154, 151, 225, 0}
-    },
-    { {95, 229, 148, 45, 0},
-      {139, 175, 18, 245, 0},
-      {11, 66, 154, 127, 10},
-      {10, 244, 143, 93, 1}
-    },
-    { {88, 194, 177, 178, 10},
-      {18, 156, 155, 144, 7},
-      {84, 216, 212, 49, 10},
-      {224, 157, 147, 148, 8}
-    },
-    { {137, 65, 77, 139, 14},
-      {50, 55, 69, 70, 3},
-      {125, 27, 40, 41, 1},
-      {198, 42, 46, 196, 12}
-    },
-    { {132, 10, 38, 120, 5},
-      {132, 97, 202, 10, 12},
-      {161, 230, 69, 2, 1},
-      {53, 5, 56, 98, 1}
-    },
-    { {185, 96, 91, 1, 13},
-      {55, 76, 101, 86, 0},
-      {184, 13, 160, 105, 13},
-      {6, 170, 99, 46, 12}
-    },
-    { {20, 186, 220, 247, 7},
-      {237, 153, 222, 28, 11},
-      {238, 243, 181, 210, 8},
-      {211, 135, 185, 155, 7}
-    },
-    { {246, 219, 203, 198, 4},
-      {248, 206, 124, 139, 11},
-      {38, 61, 61, 182, 15},
-      {221, 19, 231, 49, 15}
-    },
-    { {192, 171, 73, 169, 0},
-      {49, 34, 30, 134, 10},
-      {9, 89, 45, 80, 3},
-      {86, 23, 132, 72, 12}
-    },
-    { {153, 38, 27, 157, 2},
-      {27, 120, 140, 118, 2},
-      {75, 157, 134, 73, 9},
-      {70, 227, 17, 237, 8}
-    },
-    { {97, 25, 251, 19, 6},
-      {112, 210, 228, 212, 13},
-      {108, 141, 249, 136, 6},
-      {178, 178, 116, 176, 14}
-    },
-    { {136, 247, 2, 236, 5},
-      {79, 102, 90, 42, 2},
-      {163, 116, 14, 241, 1},
-      {69, 69, 166, 111, 2}
-    },
-    { {59, 109, 198, 146, 3},
-      {39, 223, 160, 97, 11},
-      {196, 150, 59, 109, 12},
-      {216, 96, 95, 190, 4}
-    },
-    { {78, 98, 149, 182, 0},
-      {155, 133, 138, 145, 3},
-      {6, 218, 148, 103, 2},
-      {200, 149, 26, 29, 9}
-    },
-    { {217, 253, 38, 220, 10},
-      {75, 127, 145, 234, 14},
-      {83, 182, 75, 249, 11},
-      {117, 120, 159, 237, 2}
-    },
-    { {185, 170, 215, 180, 13},
-      {63, 201, 251, 82, 10},
-      {178, 222, 181, 89, 13},
-      {84, 173, 249, 63, 12}
-    },
-    { {77, 237, 86, 136, 15},
-      {167, 119, 81, 240, 10},
-      {241, 22, 171, 123, 2},
-      {80, 248, 174, 238, 5}
-    },
-    { {32, 85, 135, 53, 1},
-      {92, 199, 162, 36, 0},
-      {138, 206, 26, 160, 4},
-      {2, 68, 94, 51, 10}
-    },
-    { {229, 194, 49, 87, 1},
-      {156, 4, 184, 222, 5},
-      {142, 168, 196, 58, 7},
-      {167, 177, 210, 3, 9}
-    },
-    { {203, 185, 136, 37, 6},
-      {75, 146, 86, 199, 8},
-      {106, 65, 25, 221, 3},
-      {30, 54, 164, 157, 2}
-    },
-    { {43, 23, 42, 185, 9},
-      {70, 98, 175, 101, 6},
-      {153, 213, 78, 141, 4},
-      {106, 111, 84, 102, 2}
-    },
-    { {171, 204, 25, 105, 3},
-      {22, 52, 54, 127, 8},
-      {201, 105, 131, 61, 5},
-      {31, 230, 194, 198, 8}
-    },
-    { {136, 158, 50, 170, 15},
-      {70, 112, 91, 50, 15},
-      {245, 84, 199, 145, 1},
-      {244, 205, 160, 230, 2}
-    },
-    { {13, 103, 151, 181, 12},
-      {155, 199, 203, 116, 2},
-      {58, 222, 158, 107, 0},
-      {66, 237, 62, 61, 9}
-    },
-    { {110, 236, 61, 135, 6},
-      {155, 21, 116, 181, 15},
-      {110, 27, 195, 119, 6},
-      {250, 210, 234, 141, 9}
-    },
-    { {163, 18, 150, 137, 14},
-      {64, 241, 105, 87, 2},
-      {121, 22, 148, 140, 5},
-      {78, 169, 104, 240, 2}
-    },
-    { {49, 39, 126, 125, 11},
-      {45, 123, 175, 124, 4},
-      {219, 231, 238, 72, 12},
-      {35, 239, 93, 235, 4}
-    },
-    { {197, 59, 33, 41, 14},
-      {209, 50, 75, 198, 12},
-      {121, 72, 77, 202, 3},
-      {54, 61, 36, 200, 11}
-    },
-    { {14, 92, 116, 153, 15},
-      {230, 53, 193, 53, 14},
-      {249, 146, 227, 167, 0},
-      {122, 200, 58, 198, 7}
-    },
-    { {206, 216, 31, 33, 1},
-      {214, 69, 22, 151, 8},
-      {136, 79, 129, 183, 3},
-      {30, 150, 138, 38, 11}
-    },
-    { {17, 190, 238, 22, 3},
-      {109, 217, 156, 96, 13},
-      {198, 135, 119, 216, 8},
-      {176, 99, 153, 187, 6}
-    },
-    { {91, 246, 119, 192, 6},
-      {115, 93, 88, 249, 6},
-      {96, 62, 230, 253, 10},
-      {105, 241, 171, 172, 14}
-    },
-    { {205, 49, 157, 20, 14},
-      {219, 147, 197, 210, 0},
-      {114, 139, 152, 203, 3},
-      {4, 186, 60, 157, 11}
-    },
-    { {33, 104, 14, 72, 13},
-      {5, 101, 101, 72, 8},
-      {177, 39, 1, 104, 4},
-      {17, 42, 106, 106, 0}
-    },
-    { {40, 39, 132, 250, 11},
-      {7, 179, 171, 40, 3},
-      {213, 242, 30, 65, 4},
-      {193, 77, 92, 222, 0}
-    },
-    { {168, 244, 166, 26, 0},
-      {67, 229, 176, 34, 5},
-      {5, 134, 82, 241, 5},
-      {164, 64, 218, 124, 2}
-    },
-    { {49, 118, 81, 59, 4},
-      {113, 44, 234, 116, 1},
-      {45, 200, 166, 232, 12},
-      {130, 229, 115, 72, 14}
-    },
-    { {247, 105, 206, 110, 2},
-      {169, 255, 38, 203, 9},
-      {71, 103, 57, 110, 15},
-      {157, 54, 79, 249, 5}
-    },
-    { {83, 146, 163, 177, 13},
-      {84, 200, 219, 197, 6},
-      {184, 220, 84, 156, 10},
-      {106, 61, 177, 50, 10}
-    },
-    { {88, 101, 173, 108, 15},
-      {31, 191, 71, 168, 4},
-      {243, 107, 90, 97, 10},
-      {33, 94, 47, 223, 8}
-    },
-    { {190, 115, 121, 11, 0},
-      {243, 46, 44, 23, 5},
-      {13, 9, 236, 231, 13},
-      {174, 131, 71, 76, 15}
-    },
-    { {90, 232, 238, 91, 11},
-      {39, 253, 149, 141, 13},
-      {221, 167, 113, 117, 10},
-      {187, 26, 155, 254, 4}
-    },
-    { {139, 106, 57, 122, 0},
-      {19, 36, 142, 91, 13},
-      {5, 233, 197, 109, 1},
-      {189, 167, 18, 76, 8}
-    },
-    { {163, 233, 94, 124, 14},
-      {41, 119, 247, 91, 8},
-      {115, 231, 169, 124, 5},
-      {29, 174, 254, 233, 4}
-    },
-    { {91, 159, 159, 132, 13},
-      {94, 203, 93, 241, 10},
-      {178, 31, 159, 157, 10},
-      {88, 251, 173, 55, 10}
-    },
-    { {47, 75, 147, 199, 11},
-      {158, 214, 41, 93, 11},
-      {222, 60, 157, 47, 4},
-      {219, 169, 70, 183, 9}
-    },
-    { {76, 117, 32, 169, 6},
-      {195, 54, 66, 164, 6},
-      {105, 80, 74, 227, 2},
-      {98, 84, 38, 204, 3}
-    },
-    { {98, 163, 2, 254, 14},
-      {9, 114, 251, 137, 3},
-      {119, 244, 12, 84, 6},
-      {201, 29, 244, 233, 0}
-    },
-    { {103, 190, 132, 139, 7},
-      {197, 177, 120, 229, 11},
-      {237, 18, 23, 222, 6},
-      {218, 113, 232, 218, 3}
-    },
-    { {183, 81, 31, 133, 12},
-      {216, 79, 101, 87, 2},
-      {58, 31, 136, 174, 13},
-      {78, 170, 111, 33, 11}
-    },
-    { {24, 89, 92, 70, 7},
-      {110, 31, 68, 24, 9},
-      {230, 35, 169, 161, 8},
-      {145, 130, 47, 135, 6}
-    },
-    { {21, 230, 55, 117, 0},
-      {153, 77, 154, 124, 4},
-      {10, 238, 198, 122, 8},
-      {35, 229, 155, 41, 9}
-    },
-    { {152, 85, 193, 87, 13},
-      {126, 142, 193, 46, 1},
-      {190, 168, 58, 161, 9},
-      {135, 72, 55, 23, 14}
-    },
-    { {221, 31, 87, 116, 9},
-      {254, 75, 139, 250, 8},
-      {146, 238, 175, 139, 11},
-      {21, 253, 29, 39, 15}
-    },
-    { {116, 139, 16, 186, 5},
-      {132, 42, 250, 144, 11},
-      {165, 208, 141, 18, 14},
-      {208, 149, 245, 66, 1}
-    },
-    { {28, 253, 149, 152, 1},
-      {215, 175, 144, 48, 10},
-      {129, 154, 155, 243, 8},
-      {80, 192, 159, 94, 11}
-    },
-    { {99, 111, 43, 206, 2},
-      {25, 118, 44, 233, 15},
-      {71, 61, 79, 108, 6},
-      {249, 115, 70, 233, 8}
-    },
-    { {175, 140, 36, 152, 13},
-      {134, 33, 241, 99, 14},
-      {177, 146, 67, 31, 5},
-      {124, 104, 248, 70, 1}
-    },
-    { {33, 45, 73, 54, 5},
-      {61, 2, 230, 96, 9},
-      {166, 201, 43, 72, 4},
-      {144, 102, 116, 11, 12}
-    },
-    { {173, 161, 22, 32, 14},
-      {131, 83, 115, 82, 0},
-      {112, 70, 136, 91, 5},
-      {4, 172, 236, 172, 1}
-    },
-    { {239, 49, 13, 89, 13},
-      {215, 35, 229, 207, 0},
-      {185, 171, 8, 207, 7},
-      {15, 58, 124, 78, 11}
-    },
-    { {155, 50, 155, 65, 14},
-      {83, 216, 77, 95, 0},
-      {120, 45, 148, 205, 9},
-      {15, 171, 33, 188, 10}
-    },
-    { {95, 76, 1, 168, 15},
-      {150, 60, 67, 225, 10},
-      {241, 88, 3, 47, 10},
-      {88, 124, 35, 198, 9}
-    },
-    { {110, 151, 175, 238, 0},
-      {218, 227, 62, 169, 7},
-      {7, 127, 94, 151, 6},
-      {233, 87, 204, 117, 11}
-    },
-    { {129, 68, 91, 180, 8},
-      {56, 68, 135, 114, 2},
-      {18, 221, 162, 40, 1},
-      {68, 238, 18, 33, 12}
-    },
-    { {196, 142, 130, 78, 7},
-      {140, 240, 88, 170, 9},
-      {231, 36, 23, 18, 3},
-      {149, 81, 160, 243, 1}
-    },
-    { {225, 39, 182, 160, 12},
-      {1, 195, 107, 242, 6},
-      {48, 86, 222, 72, 7},
-      {100, 253, 108, 56, 0}
-    },
-    { {88, 201, 151, 188, 7},
-      {30, 255, 210, 144, 10},
-      {227, 222, 153, 49, 10},
-      {80, 148, 191, 247, 8}
-    },
-    { {37, 121, 224, 205, 7},
-      {237, 182, 96, 76, 14},
-      {235, 48, 121, 234, 4},
-      {115, 32, 102, 219, 7}
-    },
-    { {107, 93, 4, 34, 7},
-      {70, 23, 98, 225, 9},
-      {228, 66, 11, 173, 6},
-      {152, 116, 110, 134, 2}
-    },
-    { {109, 39, 67, 156, 2},
-      {187, 114, 168, 224, 2},
-      {67, 156, 46, 75, 6},
-      {64, 113, 84, 237, 13}
-    },
-    { {168, 101, 37, 190, 2},
-      {27, 55, 162, 34, 7},
-      {71, 218, 74, 97, 5},
-      {228, 68, 94, 205, 8}
-    },
-    { {197, 187, 243, 235, 0},
-      {241, 226, 26, 222, 15},
-      {13, 124, 253, 218, 3},
-      {247, 181, 132, 120, 15}
-    },
-    { {224, 138, 63, 86, 10},
-      {24, 81, 189, 154, 13},
-      {86, 175, 197, 16, 7},
-      {181, 155, 216, 161, 8}
-    },
-    { {209, 250, 49, 233, 7},
-      {85, 60, 90, 222, 14},
-      {233, 120, 197, 248, 11},
-      {119, 181, 163, 202, 10}
-    },
-    { {102, 72, 123, 117, 10},
-      {184, 84, 167, 157, 12},
-      {90, 237, 225, 38, 6},
-      {59, 158, 82, 161, 13}
-    },
-    { {152, 233, 237, 143, 5},
-      {63, 175, 84, 6, 15},
-      {175, 27, 121, 113, 9},
-      {246, 2, 175, 95, 12}
-    },
-    { {156, 76, 216, 209, 15},
-      {166, 156, 197, 62, 10},
-      {248, 177, 179, 35, 9},
-      {87, 202, 51, 150, 5}
-    },
-    { {219, 162, 17, 122, 14},
-      {19, 56, 219, 219, 1},
-      {117, 232, 132, 93, 11},
-      {141, 189, 177, 204, 8}
-    },
-    { {252, 157, 45, 143, 13},
-      {222, 43, 117, 166, 15},
-      {191, 27, 75, 147, 15},
-      {246, 90, 237, 71, 11}
-    },
-    { {42, 216, 44, 171, 15},
-      {70, 53, 119, 5, 15},
-      {253, 83, 65, 181, 4},
-      {250, 14, 234, 198, 2}
-    },
-    { {203, 77, 206, 196, 5},
-      {46, 199, 68, 235, 10},
-      {162, 55, 59, 45, 3},
-      {93, 114, 46, 55, 4}
-    },
-    { {212, 230, 126, 105, 10},
-      {161, 125, 31, 190, 4},
-      {89, 103, 230, 114, 11},
-      {39, 223, 139, 232, 5}
-    },
-    { {182, 118, 99, 52, 5},
-      {253, 76, 234, 35, 4},
-      {162, 204, 102, 230, 13},
-      {44, 69, 115, 43, 15}
-    },
-    { {129, 161, 64, 232, 13},
-      {37, 34, 83, 74, 2},
-      {177, 112, 40, 88, 1},
-      {69, 44, 164, 74, 4}
-    },
-    { {36, 248, 181, 42, 13},
-      {213, 165, 115, 16, 13},
-      {181, 74, 209, 242, 4},
-      {176, 140, 234, 90, 11}
-    },
-    { {33, 212, 75, 137, 7},
-      {116, 116, 116, 100, 2},
-      {233, 29, 34, 184, 4},
-      {66, 98, 226, 226, 14}
-    },
-    { {143, 130, 58, 23, 11},
-      {142, 80, 157, 87, 5},
-      {222, 133, 196, 31, 1},
-      {174, 171, 144, 167, 1}
-    },
-    { {246, 113, 26, 188, 10},
-      {201, 126, 167, 147, 2},
-      {83, 213, 136, 230, 15},
-      {76, 158, 87, 233, 3}
-    },
-    { {63, 94, 2, 121, 7},
-      {198, 124, 234, 109, 8},
-      {233, 228, 7, 175, 12},
-      {27, 101, 115, 230, 3}
-    },
-    { {205, 212, 228, 99, 15},
-      {230, 149, 83, 238, 5},
-      {252, 98, 114, 187, 3},
-      {167, 124, 170, 150, 7}
-    },
-    { {89, 70, 5, 49, 5},
-      {22, 13, 202, 228, 0},
-      {168, 202, 6, 41, 10},
-      {2, 117, 59, 6, 8}
-    },
-    { {32, 186, 102, 97, 13},
-      {101, 65, 123, 12, 12},
-      {184, 102, 101, 208, 4},
-      {51, 13, 232, 42, 6}
-    },
-    { {151, 191, 26, 90, 0},
-      {193, 106, 156, 123, 9},
-      {5, 165, 143, 222, 9},
-      {157, 227, 149, 104, 3}
-    },
-    { {126, 66, 218, 161, 8},
-      {162, 204, 47, 149, 2},
-      {24, 85, 180, 39, 14},
-      {74, 159, 67, 52, 5}
-    },
-    { {98, 148, 45, 213, 5},
-      {92, 1, 244, 173, 6},
-      {170, 187, 66, 148, 6},
-      {107, 82, 248, 3, 10}
-    },
-    { {177, 229, 50, 4, 7},
-      {13, 94, 112, 114, 4},
-      {226, 4, 202, 120, 13},
-      {36, 224, 231, 171, 0}
-    },
-    { {222, 100, 233, 20, 12},
-      {187, 140, 197, 163, 4},
-      {50, 137, 114, 103, 11},
-      {44, 90, 51, 29, 13}
-    },
-    { {71, 94, 177, 229, 0},
-      {216, 132, 10, 253, 14},
-      {10, 120, 215, 174, 2},
-      {123, 245, 2, 17, 11}
-    },
-    { {25, 165, 108, 166, 9},
-      {47, 11, 23, 96, 7},
-      {150, 83, 106, 89, 8},
-      {224, 110, 141, 15, 4}
-    },
-    { {149, 5, 117, 79, 13},
-      {188, 43, 65, 126, 5},
-      {191, 42, 234, 10, 9},
-      {167, 232, 45, 67, 13}
-    },
-    { {54, 171, 61, 147, 0},
-      {145, 11, 188, 21, 15},
-      {12, 155, 205, 86, 12},
-      {250, 131, 221, 8, 9}
-    },
-    { {87, 132, 157, 120, 1},
-      {148, 169, 150, 249, 0},
-      {129, 235, 146, 30, 10},
-      {9, 246, 153, 82, 9}
-    },
-    { {164, 135, 244, 206, 4},
-      {168, 163, 120, 58, 7},
-      {39, 50, 254, 18, 5},
-      {229, 193, 236, 81, 5}
-    },
-    { {177, 1, 150, 215, 4},
-      {8, 203, 224, 94, 3},
-      {46, 182, 152, 8, 13},
-      {199, 160, 125, 49, 0}
-    },
-    { {202, 139, 220, 248, 6},
-      {34, 179, 222, 155, 10},
-      {97, 243, 189, 21, 3},
-      {93, 151, 188, 212, 4}
-    },
-    { {241, 104, 15, 187, 1},
-      {21, 109, 166, 198, 11},
-      {141, 223, 1, 104, 15},
-      {214, 54, 91, 106, 8}
-    },
-    { {119, 235, 139, 132, 9},
-      {157, 206, 61, 193, 10},
-      {146, 29, 29, 126, 14},
-      {88, 59, 199, 59, 9}
-    },
-    { {2, 83, 18, 189, 4},
-      {72, 102, 202, 21, 2},
-      {43, 212, 140, 164, 0},
-      {74, 133, 54, 97, 2}
-    },
-    { {29, 42, 141, 92, 1},
-      {159, 169, 140, 72, 8},
-      {131, 171, 21, 75, 8},
-      {17, 35, 25, 95, 9}
-    },
-    { {39, 117, 108, 47, 10},
-      {233, 55, 39, 101, 5},
-      {95, 67, 106, 238, 4},
-      {170, 110, 78, 201, 7}
-    },
-    { {61, 80, 83, 188, 9},
-      {254, 108, 163, 80, 2},
-      {147, 220, 160, 171, 12},
-      {64, 172, 83, 103, 15}
-    },
-    { {120, 181, 174, 182, 4},
-      {75, 203, 246, 160, 7},
-      {38, 215, 90, 209, 14},
-      {224, 86, 253, 61, 2}
-    },
-    { {42, 93, 133, 78, 1},
-      {94, 167, 32, 41, 9},
-      {135, 42, 27, 165, 4},
-      {153, 64, 78, 87, 10}
-    },
-    { {0, 239, 149, 206, 12},
-      {25, 167, 89, 56, 11},
-      {55, 58, 159, 112, 0},
-      {209, 201, 174, 89, 8}
-    },
-    { {198, 248, 201, 176, 10},
-      {241, 148, 151, 131, 10},
-      {80, 217, 49, 246, 3},
-      {92, 30, 146, 152, 15}
-    },
-    { {52, 138, 244, 180, 8},
-      {168, 137, 187, 16, 14},
-      {18, 210, 245, 18, 12},
-      {112, 141, 217, 17, 5}
-    },
-    { {154, 221, 191, 118, 3},
-      {94, 223, 150, 59, 13},
-      {198, 239, 219, 181, 9},
-      {189, 198, 159, 183, 10}
-    },
-    { {68, 183, 153, 113, 1},
-      {213, 130, 158, 188, 0},
-      {136, 233, 158, 210, 2},
-      {3, 215, 148, 26, 11}
-    },
-    { {53, 31, 237, 192, 9},
-      {244, 139, 45, 104, 14},
-      {144, 59, 127, 138, 12},
-      {113, 107, 77, 18, 15}
-    },
-    { {240, 132, 133, 185, 5},
-      {20, 169, 242, 166, 2},
-      {169, 218, 18, 16, 15},
-      {70, 84, 249, 82, 8}
-    },
-    { {130, 188, 93, 116, 5},
-      {125, 1, 214, 59, 8},
-      {162, 235, 163, 212, 1},
-      {29, 198, 184, 11, 14}
-    },
-    { {58, 134, 179, 151, 15},
-      {30, 216, 249, 53, 7},
-      {254, 156, 214, 21, 12},
-      {234, 201, 241, 183, 8}
-    },
-    { {140, 232, 137, 29, 15},
-      {159, 180, 213, 6, 8},
-      {251, 137, 17, 115, 1},
-      {22, 10, 178, 223, 9}
-    },
-    { {63, 123, 205, 83, 8},
-      {243, 143, 173, 77, 9},
-      {28, 171, 61, 239, 12},
-      {155, 43, 95, 28, 15}
-    },
-    { {180, 13, 145, 70, 7},
-      {156, 154, 96, 58, 9},
-      {230, 40, 155, 2, 13},
-      {149, 192, 101, 147, 9}
-    },
-    { {109, 172, 86, 182, 6},
-      {171, 81, 242, 240, 11},
-      {102, 214, 163, 91, 6},
-      {208, 244, 248, 173, 5}
-    },
-    { {88, 149, 105, 0, 13},
-      {118, 10, 85, 160, 4},
-      {176, 9, 106, 145, 10},
-      {32, 90, 165, 6, 14}
-    },
-    { {76, 163, 63, 89, 3},
-      {151, 115, 156, 156, 4},
-      {201, 175, 204, 83, 2},
-      {35, 147, 156, 238, 9}
-    },
-    { {53, 167, 215, 80, 1},
-      {181, 203, 184, 120, 0},
-      {128, 174, 190, 90, 12},
-      {1, 225, 221, 58, 13}
-    },
-    { {22, 233, 116, 244, 11},
-      {173, 31, 147, 25, 14},
-      {210, 242, 233, 118, 8},
-      {121, 140, 159, 139, 5}
-    },
-    { {106, 219, 126, 99, 3},
-      {102, 87, 62, 157, 13},
-      {204, 103, 237, 181, 6},
-      {187, 151, 206, 166, 6}
-    },
-    { {172, 254, 199, 138, 5},
-      {247, 229, 120, 34, 11},
-      {165, 30, 55, 243, 5},
-      {212, 65, 234, 126, 15}
-    },
-    { {195, 109, 112, 53, 6},
-      {41, 22, 194, 247, 12},
-      {106, 192, 235, 108, 3},
-      {62, 244, 54, 137, 4}
-    },
-    { {133, 82, 84, 245, 6},
-      {232, 21, 202, 94, 2},
-      {106, 242, 164, 170, 1},
-      {71, 165, 58, 129, 7}
-    },
-    { {211, 112, 148, 110, 7},
-      {77, 189, 66, 219, 1},
-      {231, 98, 144, 236, 11},
-      {141, 180, 43, 219, 2}
-    },
-    { {157, 177, 206, 126, 12},
-      {235, 235, 215, 74, 1},
-      {55, 231, 56, 219, 9},
-      {133, 46, 189, 125, 7}
-    },
-    { {163, 136, 217, 180, 14},
-      {56, 144, 247, 83, 10},
-      {114, 217, 177, 28, 5},
-      {92, 174, 240, 145, 12}
-    },
-    { {98, 252, 134, 118, 14},
-      {73, 213, 243, 169, 9},
-      {118, 230, 19, 244, 6},
-      {153, 92, 250, 185, 2}
-    },
-    { {209, 228, 206, 15, 2},
-      {41, 253, 20, 230, 1},
-      {79, 7, 50, 120, 11},
-      {134, 114, 139, 249, 4}
-    },
-    { {224, 197, 119, 135, 0},
-      {56, 71, 48, 182, 7},
-      {14, 30, 234, 48, 7},
-      {230, 208, 206, 33, 12}
-    },
-    { {136, 137, 241, 121, 7},
-      {54, 178, 210, 30, 12},
-      {233, 232, 249, 17, 1},
-      {55, 132, 180, 214, 12}
-    },
-    { {175, 103, 124, 158, 0},
-      {171, 39, 172, 115, 7},
-      {7, 147, 238, 111, 5},
-      {236, 227, 94, 77, 5}
-    },
-    { {250, 135, 32, 206, 8},
-      {10, 42, 57, 171, 7},
-      {23, 48, 78, 21, 15},
-      {237, 89, 197, 69, 0}
-    },
-    { {32, 136, 108, 197, 14},
-      {40, 17, 117, 12, 14},
-      {122, 51, 97, 16, 4},
-      {115, 10, 232, 129, 4}
-    },
-    { {26, 153, 204, 140, 14},
-      {106, 187, 85, 1, 10},
-      {115, 19, 57, 149, 8},
-      {88, 10, 173, 213, 6}
-    },
-    { {136, 165, 101, 91, 1},
-      {55, 35, 144, 46, 5},
-      {141, 170, 106, 81, 1},
-      {167, 64, 156, 78, 12}
-    },
-    { {214, 247, 236, 2, 5},
-      {229, 143, 92, 163, 5},
-      {164, 3, 126, 246, 11},
-      {172, 83, 175, 26, 7}
-    },
-    { {244, 246, 145, 8, 4},
-      {209, 172, 120, 178, 0},
-      {33, 8, 150, 242, 15},
-      {4, 209, 227, 88, 11}
-    },
-    { {76, 10, 202, 63, 5},
-      {174, 224, 206, 132, 9},
-      {175, 197, 53, 3, 2},
-      {146, 23, 48, 119, 5}
-    },
-    { {31, 5, 164, 12, 7},
-      {142, 187, 64, 97, 4},
-      {227, 2, 90, 15, 8},
-      {40, 96, 45, 215, 1}
-    },
-    { {250, 93, 132, 124, 6},
-      {74, 191, 226, 171, 8},
-      {99, 226, 27, 165, 15},
-      {29, 84, 127, 213, 2}
-    },
-    { {19, 29, 173, 215, 12},
-      {88, 139, 197, 109, 15},
-      {62, 187, 91, 140, 8},
-      {251, 106, 61, 17, 10}
-    },
-    { {195, 96, 214, 57, 15},
-      {37, 245, 195, 215, 0},
-      {249, 198, 176, 108, 3},
-      {14, 188, 58, 250, 4}
-    },
-    { {126, 199, 122, 149, 3},
-      {174, 94, 188, 181, 6},
-      {202, 149, 238, 55, 14},
-      {106, 211, 215, 167, 5}
-    },
-    { {45, 212, 161, 248, 1},
-      {214, 164, 178, 104, 6},
-      {129, 248, 82, 187, 4},
-      {97, 100, 210, 86, 11}
-    },
-    { {196, 27, 169, 22, 11},
-      {220, 146, 141, 130, 13},
-      {214, 137, 93, 130, 3},
-      {180, 27, 20, 147, 11}
-    },
-    { {174, 83, 48, 32, 14},
-      {194, 22, 107, 19, 4},
-      {112, 64, 204, 167, 5},
-      {44, 141, 102, 132, 3}
-    },
-    { {137, 195, 118, 107, 2},
-      {34, 119, 26, 94, 5},
-      {77, 102, 236, 57, 1},
-      {167, 165, 142, 228, 4}
-    },
-    { {17, 167, 104, 69, 2},
-      {41, 26, 28, 108, 4},
-      {74, 33, 110, 88, 8},
-      {35, 99, 133, 137, 4}
-    },
-    { {115, 24, 54, 184, 10},
-      {64, 121, 163, 209, 14},
-      {81, 214, 193, 140, 14},
-      {120, 188, 89, 224, 2}
-    },
-    { {152, 195, 136, 238, 2},
-      {10, 190, 30, 10, 3},
-      {71, 113, 28, 49, 9},
-      {197, 7, 135, 213, 0}
-    },
-    { {50, 158, 254, 117, 6},
-      {104, 217, 254, 61, 12},
-      {106, 231, 247, 148, 12},
-      {59, 199, 249, 177, 6}
-    },
-    { {235, 41, 103, 213, 2},
-      {59, 83, 160, 207, 14},
-      {74, 190, 105, 77, 7},
-      {127, 48, 92, 173, 12}
-    },
-    { {118, 246, 246, 147, 13},
-      {229, 205, 249, 181, 7},
-      {188, 150, 246, 246, 14},
-      {234, 217, 251, 58, 7}
-    },
-    { {75, 54, 229, 94, 10},
-      {123, 177, 137, 233, 5},
-      {87, 170, 118, 205, 2},
-      {169, 121, 24, 221, 14}
-    },
-    { {18, 100, 241, 41, 15},
-      {53, 188, 67, 53, 4},
-      {249, 72, 242, 100, 8},
-      {42, 204, 35, 218, 12}
-    },
-    { {195, 216, 179, 216, 12},
-      {80, 228, 209, 219, 14},
-      {49, 188, 209, 188, 3},
-      {125, 184, 178, 112, 10}
-    },
-    { {184, 252, 222, 50, 9},
-      {103, 205, 183, 50, 9},
-      {148, 199, 179, 241, 13},
-      {148, 206, 219, 62, 6}
-    },
-    { {53, 97, 247, 116, 12},
-      {185, 207, 227, 88, 4},
-      {50, 238, 248, 106, 12},
-      {33, 172, 127, 57, 13}
-    },
-    { {116, 255, 31, 22, 6},
-      {217, 95, 252, 176, 9},
-      {102, 143, 143, 242, 14},
-      {144, 211, 255, 169, 11}
-    },
-    { {29, 80, 232, 123, 6},
-      {226, 188, 198, 76, 5},
-      {109, 225, 112, 171, 8},
-      {163, 38, 51, 212, 7}
-    },
-    { {71, 201, 216, 44, 9},
-      {172, 166, 23, 209, 8},
-      {147, 65, 185, 62, 2},
-      {24, 190, 134, 83, 5}
-    },
-    { {198, 131, 135, 46, 9},
-      {156, 227, 27, 131, 1},
-      {151, 78, 28, 22, 3},
-      {140, 29, 140, 115, 9}
-    },
-    { {182, 245, 65, 140, 14},
-      {249, 62, 113, 35, 2},
-      {115, 24, 42, 246, 13},
-      {76, 72, 231, 201, 15}
-    },
-    { {209, 45, 250, 27, 10},
-      {33, 250, 133, 246, 13},
-      {93, 133, 251, 72, 11},
-      {182, 250, 21, 248, 4}
-    },
-    { {123, 222, 164, 209, 14},
-      {66, 157, 249, 237, 14},
-      {120, 178, 87, 189, 14},
-      {123, 121, 251, 148, 2}
-    },
-    { {148, 215, 11, 206, 8},
-      {216, 110, 29, 42, 3},
-      {23, 61, 14, 178, 9},
-      {197, 75, 135, 97, 11}
-    },
-    { {139, 161, 235, 181, 10},
-      {59, 210, 151, 71, 6},
-      {90, 221, 120, 93, 1},
-      {110, 46, 148, 189, 12}
-    },
-    { {2, 76, 23, 111, 5},
-      {28, 101, 66, 61, 9},
-      {175, 110, 131, 36, 0},
-      {155, 196, 42, 99, 8}
-    },
-    { {54, 104, 158, 115, 11},
-      {133, 221, 167, 29, 9},
-      {220, 231, 145, 102, 12},
-      {155, 142, 91, 186, 1}
-    },
-    { {208, 33, 104, 228, 4},
-      {41, 10, 70, 138, 6},
-      {34, 113, 104, 64, 11},
-      {101, 22, 37, 9, 4}
-    },
-    { {155, 143, 16, 45, 14},
-      {10, 58, 91, 119, 8},
-      {123, 64, 143, 29, 9},
-      {30, 237, 165, 197, 0}
-    },
-    { {126, 132, 92, 39, 11},
-      {174, 25, 55, 181, 1},
-      {222, 67, 162, 23, 14},
-      {138, 222, 201, 135, 5}
-    },
-    { {118, 223, 8, 118, 12},
-      {200, 14, 255, 169, 9},
-      {54, 225, 15, 182, 14},
-      {153, 95, 247, 1, 3}
-    },
-    { {251, 188, 21, 149, 7},
-      {95, 25, 240, 247, 10},
-      {234, 154, 131, 221, 15},
-      {94, 240, 249, 143, 10}
-    },
-    { {70, 128, 175, 59, 2},
-      {144, 241, 150, 133, 5},
-      {77, 207, 80, 22, 2},
-      {170, 22, 152, 240, 9}
-    },
-    { {209, 94, 13, 85, 9},
-      {92, 13, 141, 238, 8},
-      {154, 171, 7, 168, 11},
-      {23, 123, 27, 3, 10}
-    },
-    { {140, 34, 108, 129, 4},
-      {163, 1, 76, 6, 6},
-      {40, 19, 100, 67, 1},
-      {102, 3, 40, 12, 5}
-    },
-    { {118, 43, 180, 156, 1},
-      {141, 171, 168, 145, 14},
-      {131, 146, 221, 70, 14},
-      {120, 145, 93, 91, 1}
-    },
-    { {115, 86, 122, 41, 0},
-      {96, 108, 46, 245, 4},
-      {9, 69, 230, 172, 14},
-      {42, 247, 67, 96, 6}
-    },
-    { {65, 92, 222, 11, 1},
-      {100, 229, 4, 244, 9},
-      {141, 7, 179, 168, 2},
-      {146, 242, 10, 114, 6}
-    },
-    { {9, 152, 244, 128, 11},
-      {102, 145, 17, 80, 14},
-      {208, 18, 241, 153, 0},
-      {112, 168, 136, 150, 6}
-    },
-    { {227, 53, 25, 14, 13},
-      {93, 34, 101, 243, 1},
-      {183, 9, 138, 204, 7},
-      {140, 250, 100, 75, 10}
-    },
-    { {54, 133, 243, 244, 3},
-      {188, 218, 178, 57, 6},
-      {194, 252, 250, 22, 12},
-      {105, 196, 213, 179, 13}
-    },
-    { {149, 140, 227, 231, 8},
-      {184, 200, 19, 110, 15},
-      {30, 124, 115, 26, 9},
-      {247, 108, 129, 49, 13}
-    },
-    { {119, 22, 87, 104, 15},
-      {244, 121, 107, 249, 0},
-      {241, 110, 166, 142, 14},
-      {9, 253, 105, 226, 15}
-    },
-    { {192, 211, 150, 95, 4},
-      {72, 231, 216, 158, 1},
-      {47, 166, 156, 176, 3},
-      {135, 145, 190, 113, 2}
-    },
-    { {212, 159, 135, 115, 2},
-      {208, 219, 154, 174, 9},
-      {76, 238, 31, 146, 11},
-      {151, 85, 157, 176, 11}
-    },
-    { {69, 191, 48, 71, 8},
-      {201, 2, 25, 252, 13},
-      {30, 32, 207, 218, 2},
-      {179, 249, 132, 9, 3}
-    },
-    { {178, 247, 139, 151, 9},
-      {93, 206, 189, 39, 3},
-      {158, 157, 30, 244, 13},
-      {206, 75, 215, 59, 10}
-    },
-    { {182, 81, 172, 193, 7},
-      {196, 159, 100, 15, 6},
-      {232, 51, 88, 166, 13},
-      {111, 2, 111, 146, 3}
-    },
-    { {18, 188, 225, 89, 10},
-      {113, 184, 145, 45, 12},
-      {89, 168, 115, 212, 8},
-      {59, 72, 145, 216, 14}
-    },
-    { {142, 109, 66, 22, 5},
-      {175, 70, 192, 35, 9},
-      {166, 132, 43, 103, 1},
-      {156, 64, 54, 47, 5}
-    },
-    { {247, 219, 218, 17, 6},
-      {224, 222, 252, 215, 8},
-      {104, 133, 189, 190, 15},
-      {30, 179, 247, 176, 7}
-    },
-    { {95, 40, 2, 124, 14},
-      {139, 120, 195, 201, 8},
-      {115, 228, 1, 79, 10},
-      {25, 60, 49, 237, 1}
-    },
-    { {2, 18, 169, 157, 14},
-      {88, 176, 205, 5, 6},
-      {123, 153, 84, 132, 0},
-      {106, 11, 48, 209, 10}
-    },
-    { {191, 254, 168, 18, 10},
-      {195, 156, 189, 99, 13},
-      {84, 129, 87, 255, 13},
-      {188, 107, 211, 156, 3}
-    },
-    { {186, 49, 92, 161, 1},
-      {103, 11, 38, 23, 2},
-      {136, 83, 168, 197, 13},
-      {78, 134, 77, 14, 6}
-    },
-    { {7, 242, 225, 29, 7},
-      {253, 180, 216, 69, 4},
-      {235, 136, 116, 254, 0},
-      {42, 33, 178, 219, 15}
-    },
-    { {234, 79, 43, 164, 13},
-      {30, 70, 111, 163, 14},
-      {178, 93, 79, 37, 7},
-      {124, 95, 102, 39, 8}
-    },
-    { {165, 190, 34, 214, 12},
-      {201, 64, 249, 106, 15},
-      {54, 180, 71, 218, 5},
-      {245, 105, 240, 41, 3}
-    },
-    { {241, 169, 225, 184, 14},
-      {49, 186, 243, 194, 14},
-      {113, 216, 121, 88, 15},
-      {116, 60, 245, 216, 12}
-    },
-    { {202, 168, 155, 183, 7},
-      {31, 208, 214, 151, 11},
-      {238, 221, 145, 85, 3},
-      {222, 150, 176, 191, 8}
-    },
-    { {84, 134, 196, 245, 2},
-      {168, 153, 154, 172, 2},
-      {74, 242, 54, 18, 10},
-      {67, 85, 153, 145, 5}
-    },
-    { {53, 121, 76, 30, 4},
-      {233, 47, 228, 64, 9},
-      {39, 131, 41, 234, 12},
-      {144, 34, 127, 73, 7}
-    },
-    { {110, 216, 72, 137, 8},
-      {226, 36, 53, 133, 10},
-      {25, 17, 33, 183, 6},
-      {90, 26, 194, 68, 7}
-    },
-    { {186, 232, 137, 103, 6},
-      {27, 156, 118, 15, 9},
-      {110, 105, 17, 117, 13},
-      {159, 6, 227, 157, 8}
-    },
-    { {148, 192, 40, 189, 0},
-      {136, 44, 150, 6, 6},
-      {11, 209, 64, 50, 9},
-      {102, 6, 147, 65, 1}
-    },
-    { {115, 76, 162, 183, 6},
-      {8, 220, 226, 229, 15},
-      {110, 212, 83, 44, 14},
-      {250, 116, 115, 177, 0}
-    },
-    { {47, 241, 60, 122, 11},
-      {199, 55, 183, 89, 5},
-      {213, 227, 200, 255, 4},
-      {169, 174, 222, 206, 3}
-    },
-    { {204, 2, 99, 100, 7},
-      {190, 80, 74, 138, 4},
-      {226, 108, 100, 3, 3},
-      {37, 21, 32, 167, 13}
-    },
-    { {222, 144, 69, 41, 2},
-      {242, 57, 18, 135, 0},
-      {73, 74, 32, 151, 11},
-      {14, 20, 137, 196, 15}
-    },
-    { {2, 43, 108, 122, 15},
-      {37, 51, 207, 9, 13},
-      {245, 227, 109, 68, 0},
-      {185, 15, 60, 202, 4}
-    },
-    { {64, 75, 24, 30, 13},
-      {12, 38, 205, 144, 9},
-      {183, 129, 141, 32, 2},
-      {144, 155, 54, 67, 0}
-    },
-    { {44, 49, 42, 198, 5},
-      {207, 66, 100, 8, 7},
-      {166, 53, 72, 195, 4},
-      {225, 2, 100, 47, 3}
-    },
-    { {191, 189, 15, 65, 6},
-      {211, 91, 116, 111, 8},
-      {104, 47, 11, 223, 13},
-      {31, 98, 237, 172, 11}
-    },
-    { {232, 58, 99, 203, 12},
-      {115, 96, 105, 142, 15},
-      {61, 60, 101, 193, 7},
-      {247, 25, 96, 108, 14}
-    },
-    { {231, 89, 156, 35, 2},
-      {192, 151, 38, 215, 9},
-      {76, 67, 153, 174, 7},
-      {158, 182, 78, 144, 3}
-    },
-    { {255, 230, 113, 141, 6},
-      {187, 60, 120, 247, 6},
-      {107, 24, 230, 127, 15},
-      {110, 241, 227, 205, 13}
-    },
-    { {197, 136, 65, 238, 2},
-      {184, 48, 18, 202, 11},
-      {71, 120, 33, 26, 3},
-      {213, 52, 128, 193, 13}
-    },
-    { {171, 180, 217, 16, 2},
-      {115, 144, 180, 115, 0},
-      {64, 137, 178, 221, 5},
-      {12, 226, 208, 156, 14}
-    },
-    { {10, 23, 123, 120, 4},
-      {114, 98, 206, 57, 4},
-      {33, 237, 238, 133, 0},
-      {41, 199, 52, 100, 14}
-    },
-    { {78, 123, 115, 156, 14},
-      {251, 118, 201, 145, 14},
-      {115, 156, 237, 231, 2},
-      {120, 153, 54, 237, 15}
-    },
-    { {34, 227, 251, 26, 1},
-      {53, 230, 188, 17, 5},
-      {133, 141, 252, 116, 4},
-      {168, 131, 214, 122, 12}
-    },
-    { {54, 93, 186, 61, 2},
-      {200, 254, 166, 53, 12},
-      {75, 197, 219, 166, 12},
-      {58, 198, 87, 241, 3}
-    },
-    { {59, 220, 189, 56, 4},
-      {82, 173, 246, 113, 12},
-      {33, 203, 211, 189, 12},
-      {56, 230, 251, 84, 10}
-    },
-    { {200, 199, 188, 19, 5},
-      {6, 135, 220, 182, 5},
-      {172, 131, 222, 49, 3},
-      {166, 211, 190, 22, 0}
-    },
-    { {91, 16, 250, 200, 6},
-      {98, 248, 68, 217, 6},
-      {97, 53, 240, 141, 10},
-      {105, 178, 33, 244, 6}
-    },
-    { {208, 249, 92, 92, 11},
-      {109, 63, 149, 154, 8},
-      {211, 163, 169, 240, 11},
-      {21, 154, 159, 203, 6}
-    },
-    { {153, 6, 142, 77, 7},
-      {14, 249, 76, 110, 0},
-      {235, 39, 22, 9, 9},
-      {7, 99, 41, 247, 0}
-    },
-    { {200, 39, 17, 208, 2},
-      {19, 18, 136, 186, 2},
-      {64, 184, 142, 65, 3},
-      {69, 209, 20, 140, 8}
-    },
-    { {164, 84, 34, 73, 9},
-      {196, 100, 33, 46, 4},
-      {153, 36, 66, 162, 5},
-      {39, 72, 66, 98, 3}
-    },
-    { {169, 103, 185, 198, 3},
-      {31, 150, 44, 122, 7},
-      {198, 57, 222, 105, 5},
-      {229, 227, 70, 159, 8}
-    },
-    { {227, 227, 61, 193, 6},
-      {17, 23, 124, 223, 6},
-      {104, 59, 204, 124, 7},
-      {111, 179, 238, 136, 8}
-    },
-    { {242, 227, 250, 36, 6},
-      {41, 222, 126, 147, 4},
-      {98, 69, 252, 116, 15},
-      {44, 151, 231, 185, 4}
-    },
-    { {171, 214, 110, 194, 10},
-      {98, 85, 61, 107, 7},
-      {84, 55, 102, 189, 5},
-      {237, 107, 202, 164, 6}
-    },
-    { {150, 166, 172, 174, 12},
-      {137, 169, 95, 35, 7},
-      {55, 83, 86, 86, 9},
-      {236, 79, 169, 89, 1}
-    },
-    { {17, 94, 218, 37, 15},
-      {108, 220, 79, 116, 8},
-      {250, 69, 183, 168, 8},
-      {18, 239, 35, 179, 6}
-    },
-    { {224, 72, 217, 79, 9},
-      {60, 164, 37, 158, 9},
-      {159, 41, 177, 32, 7},
-      {151, 154, 66, 83, 12}
-    },
-    { {62, 162, 162, 69, 13},
-      {143, 200, 121, 13, 4},
-      {186, 36, 84, 87, 12},
-      {43, 9, 225, 63, 1}
-    },
-    { {147, 122, 113, 157, 10},
-      {121, 60, 137, 87, 14},
-      {91, 152, 229, 236, 9},
-      {126, 169, 19, 201, 14}
-    },
-    { {109, 101, 53, 32, 4},
-      {147, 7, 98, 240, 4},
-      {32, 74, 202, 107, 6},
-      {32, 244, 110, 12, 9}
-    },
-    { {218, 6, 151, 74, 11},
-      {22, 249, 9, 187, 1},
-      {213, 46, 150, 5, 11},
-      {141, 217, 9, 246, 8}
-    },
-    { {20, 176, 37, 32, 10},
-      {209, 25, 19, 0, 4},
-      {80, 74, 64, 210, 8},
-      {32, 12, 137, 136, 11}
-    },
-    { {122, 150, 135, 109, 5},
-      {94, 233, 122, 173, 0},
-      {171, 110, 22, 149, 14},
-      {11, 85, 233, 119, 10}
-    },
-    { {221, 120, 18, 100, 5},
-      {207, 76, 66, 218, 8},
-      {162, 100, 129, 235, 11},
-      {21, 180, 35, 47, 3}
-    },
-    { {130, 195, 122, 162, 9},
-      {36, 70, 31, 19, 7},
-      {148, 85, 236, 52, 1},
-      {236, 143, 134, 34, 4}
-    },
-    { {151, 25, 250, 15, 4},
-      {232, 234, 68, 87, 13},
-      {47, 5, 249, 142, 9},
-      {190, 162, 37, 113, 7}
-    },
-    { {58, 108, 193, 181, 7},
-      {63, 156, 226, 37, 10},
-      {234, 216, 51, 101, 12},
-      {90, 68, 115, 159, 12}
-    },
-    { {97, 33, 177, 73, 13},
-      {21, 162, 97, 220, 4},
-      {185, 40, 216, 72, 6},
-      {35, 184, 100, 90, 8}
-    },
-    { {208, 123, 6, 29, 14},
-      {73, 127, 201, 134, 8},
-      {123, 134, 13, 224, 11},
-      {22, 25, 63, 233, 2}
-    },
-    { {69, 190, 247, 38, 9},
-      {253, 193, 27, 240, 13},
-      {150, 78, 247, 218, 2},
-      {176, 253, 136, 59, 15}
-    },
-    { {157, 70, 148, 66, 4},
-      {130, 141, 72, 122, 1},
-      {36, 34, 150, 43, 9},
-      {133, 225, 43, 20, 1}
-    },
-    { {77, 251, 186, 241, 4},
-      {195, 198, 222, 220, 14},
-      {40, 245, 221, 251, 2},
-      {115, 183, 182, 60, 3}
-    },
-    { {200, 236, 99, 163, 1},
-      {55, 68, 18, 166, 15},
-      {140, 92, 99, 113, 3},
-      {246, 84, 130, 46, 12}
-    },
-    { {41, 38, 49, 96, 9},
-      {23, 0, 43, 120, 4},
-      {144, 104, 198, 73, 4},
-      {33, 237, 64, 14, 8}
-    },
-    { {34, 234, 181, 80, 10},
-      {17, 149, 185, 25, 12},
-      {80, 170, 213, 116, 4},
-      {57, 137, 218, 152, 8}
-    },
-    { {12, 83, 62, 124, 9},
-      {206, 103, 143, 24, 4},
-      {147, 231, 204, 163, 0},
-      {33, 143, 30, 103, 3}
-    },
-    { {241, 209, 122, 65, 9},
-      {100, 78, 53, 222, 4},
-      {152, 37, 232, 184, 15},
-      {39, 186, 199, 34, 6}
-    },
-    { {190, 41, 45, 21, 12},
-      {155, 11, 229, 7, 12},
-      {58, 139, 73, 71, 13},
-      {62, 10, 125, 13, 9}
-    },
-    { {173, 236, 230, 5, 15},
-      {175, 213, 113, 102, 12},
-      {250, 6, 115, 123, 5},
-      {54, 104, 234, 191, 5}
-    },
-    { {23, 198, 147, 157, 3},
-      {156, 252, 152, 117, 2},
-      {203, 156, 150, 62, 8},
-      {74, 225, 147, 243, 9}
-    },
-    { {76, 195, 212, 88, 9},
-      {166, 167, 153, 152, 0},
-      {145, 162, 188, 51, 2},
-      {1, 153, 158, 86, 5}
-    },
-    { {154, 214, 102, 33, 4},
-      {98, 77, 90, 39, 4},
-      {40, 70, 102, 181, 9},
-      {46, 69, 171, 36, 6}
-    },
-    { {19, 133, 65, 215, 3},
-      {60, 26, 144, 109, 3},
-      {206, 184, 42, 28, 8},
-      {203, 96, 149, 131, 12}
-    },
-    { {86, 15, 151, 244, 5},
-      {156, 203, 202, 185, 10},
-      {162, 254, 159, 6, 10},
-      {89, 213, 61, 51, 9}
-    },
-    { {166, 192, 165, 246, 0},
-      {152, 133, 178, 11, 7},
-      {6, 250, 80, 54, 5},
-      {237, 4, 218, 17, 9}
-    },
-    { {95, 226, 229, 89, 8},
-      {179, 173, 153, 205, 4},
-      {25, 170, 116, 127, 10},
-      {43, 57, 155, 92, 13}
-    },
-    { {67, 190, 136, 118, 5},
-      {77, 128, 222, 233, 9},
-      {166, 225, 23, 220, 2},
-      {153, 119, 176, 27, 2}
-    },
-    { {8, 144, 129, 205, 4},
-      {90, 160, 80, 12, 2},
-      {43, 56, 16, 145, 0},
-      {67, 0, 160, 85, 10}
-    },
-    { {77, 234, 23, 239, 15},
-      {159, 117, 91, 220, 11},
-      {255, 126, 133, 123, 2},
-      {211, 189, 170, 239, 9}
-    },
-    { {124, 58, 173, 18, 0},
-      {211, 137, 172, 128, 13},
-      {4, 139, 85, 195, 14},
-      {176, 19, 89, 28, 11}
-    },
-    { {67, 86, 162, 174, 9},
-      {76, 228, 11, 225, 7},
-      {151, 84, 86, 172, 2},
-      {232, 125, 2, 115, 2}
-    },
-    { {236, 183, 0, 75, 5},
-      {199, 34, 120, 174, 1},
-      {173, 32, 14, 211, 7},
-      {135, 81, 228, 78, 3}
-    },
-    { {247, 97, 178, 178, 7},
-      {133, 222, 226, 211, 7},
-      {228, 212, 216, 110, 15},
-      {236, 180, 119, 186, 1}
-    },
-    { {137, 36, 99, 124, 13},
-      {63, 96, 195, 106, 4},
-      {179, 236, 98, 73, 1},
-      {37, 108, 48, 111, 12}
-    },
-    { {114, 58, 98, 179, 1},
-      {101, 72, 170, 133, 15},
-      {140, 212, 101, 196, 14},
-      {250, 21, 81, 42, 6}
-    },
-    { {41, 180, 125, 69, 1},
-      {127, 1, 52, 124, 4},
-      {138, 43, 226, 217, 4},
-      {35, 226, 200, 15, 14}
-    },
-    { {18, 107, 239, 149, 10},
-      {57, 223, 141, 5, 14},
-      {90, 159, 125, 100, 8},
-      {122, 11, 31, 185, 12}
-    },
-    { {161, 94, 96, 121, 10},
-      {96, 52, 171, 110, 12},
-      {89, 224, 103, 168, 5},
-      {55, 109, 82, 192, 6}
-    },
-    { {126, 76, 172, 58, 13},
-      {134, 173, 231, 161, 13},
-      {181, 195, 83, 39, 14},
-      {184, 94, 123, 86, 1}
-    },
-    { {114, 142, 21, 50, 3},
-      {20, 25, 186, 177, 9},
-      {196, 202, 135, 20, 14},
-      {152, 213, 217, 130, 8}
-    },
-    { {50, 5, 228, 151, 0},
-      {40, 139, 160, 37, 7},
-      {14, 146, 122, 4, 12},
-      {234, 64, 93, 17, 4}
-    },
-    { {20, 99, 87, 142, 15},
-      {189, 127, 73, 16, 3},
-      {247, 30, 172, 98, 8},
-      {192, 137, 47, 235, 13}
-    },
-    { {70, 114, 172, 144, 8},
-      {193, 133, 141, 129, 6},
-      {16, 147, 84, 230, 2},
-      {104, 27, 26, 24, 3}
-    },
-    { {218, 88, 222, 192, 8},
-      {98, 205, 5, 155, 10},
-      {16, 55, 177, 165, 11},
-      {93, 154, 11, 52, 6}
-    },
-    { {201, 31, 228, 54, 4},
-      {106, 131, 202, 226, 13},
-      {38, 194, 127, 137, 3},
-      {180, 117, 60, 21, 6}
-    },
-    { {161, 197, 254, 154, 12},
-      {32, 231, 245, 114, 7},
-      {53, 151, 250, 56, 5},
-      {228, 234, 254, 112, 4}
-    },
-    { {247, 70, 210, 71, 7},
-      {172, 220, 104, 255, 1},
-      {238, 36, 182, 46, 15},
-      {143, 241, 99, 179, 5}
-    },
-    { {56, 73, 248, 205, 2},
-      {42, 190, 36, 28, 14},
-      {75, 49, 249, 33, 12},
-      {115, 130, 71, 213, 4}
-    },
-    { {186, 114, 36, 10, 6},
-      {67, 61, 104, 3, 5},
-      {101, 2, 68, 229, 13},
-      {172, 1, 107, 204, 2}
-    },
-    { {100, 162, 99, 127, 3},
-      {189, 112, 186, 140, 5},
-      {207, 236, 100, 82, 6},
-      {163, 21, 208, 235, 13}
-    },
-    { {132, 80, 221, 43, 3},
-      {244, 181, 6, 22, 1},
-      {205, 75, 176, 162, 1},
-      {134, 134, 10, 210, 15}
-    },
-    { {233, 134, 163, 18, 6},
-      {18, 208, 248, 226, 5},
-      {100, 140, 86, 25, 7},
-      {164, 113, 240, 180, 8}
-    },
-    { {31, 106, 10, 155, 13},
-      {135, 108, 205, 69, 11},
-      {189, 149, 5, 111, 8},
-      {218, 43, 51, 110, 1}
-    },
-    { {193, 131, 19, 193, 9},
-      {20, 66, 25, 222, 2},
-      {152, 60, 140, 24, 3},
-      {71, 185, 132, 34, 8}
-    },
-    { {68, 244, 102, 59, 11},
-      {229, 117, 147, 164, 5},
-      {221, 198, 98, 242, 2},
-      {162, 92, 154, 234, 7}
-    },
-    { {1, 157, 216, 198, 10},
-      {104, 146, 21, 120, 11},
-      {86, 49, 187, 152, 0},
-      {209, 234, 132, 145, 6}
-    },
-    { {207, 106, 252, 4, 8},
-      {171, 133, 13, 211, 12},
-      {18, 3, 245, 111, 3},
-      {60, 187, 10, 29, 5}
-    },
-    { {146, 174, 195, 5, 6},
-      {57, 216, 88, 39, 8},
-      {106, 12, 55, 84, 9},
-      {30, 65, 161, 185, 12}
-    },
-    { {37, 21, 93, 154, 5},
-      {244, 35, 228, 112, 3},
-      {165, 155, 170, 138, 4},
-      {192, 226, 124, 66, 15}
-    },
-    { {22, 10, 92, 69, 6},
-      {168, 25, 76, 29, 8},
-      {106, 35, 165, 6, 8},
-      {27, 131, 41, 129, 5}
-    },
-    { {42, 195, 144, 107, 5},
-      {6, 166, 122, 29, 1},
-      {173, 96, 156, 53, 4},
-      {139, 133, 230, 86, 0}
-    },
-    { {46, 122, 182, 246, 15},
-      {207, 213, 235, 25, 15},
-      {246, 246, 213, 231, 4},
-      {249, 141, 122, 191, 3}
-    },
-    { {158, 250, 147, 214, 12},
-      {219, 204, 217, 27, 11},
-      {54, 188, 149, 247, 9},
-      {221, 137, 179, 61, 11}
-    },
-    { {70, 52, 147, 36, 2},
-      {217, 208, 2, 177, 0},
-      {66, 76, 146, 198, 2},
-      {8, 212, 0, 185, 11}
-    },
-    { {10, 253, 84, 150, 12},
-      {107, 7, 209, 49, 11},
-      {54, 146, 171, 245, 0},
-      {216, 200, 190, 13, 6}
-    },
-    { {176, 98, 61, 37, 0},
-      {25, 13, 46, 22, 4},
-      {10, 75, 196, 96, 13},
-      {38, 135, 75, 9, 8}
-    },
-    { {145, 210, 194, 45, 8},
-      {104, 236, 27, 70, 0},
-      {27, 68, 52, 184, 9},
-      {6, 45, 131, 113, 6}
-    },
-    { {180, 12, 140, 215, 2},
-      {136, 153, 164, 46, 11},
-      {78, 179, 19, 2, 13},
-      {215, 66, 89, 145, 1}
-    },
-    { {159, 137, 21, 197, 9},
-      {158, 11, 17, 95, 10},
-      {154, 58, 137, 31, 9},
-      {95, 168, 141, 7, 9}
-    },
-    { {231, 171, 31, 92, 9},
-      {157, 99, 189, 219, 8},
-      {147, 175, 141, 94, 7},
-      {29, 187, 220, 107, 9}
-    },
-    { {64, 95, 208, 111, 7},
-      {108, 182, 74, 188, 9},
-      {239, 96, 191, 160, 2},
-      {147, 213, 38, 211, 6}
-    },
-    { {107, 30, 197, 224, 6},
-      {114, 145, 106, 233, 10},
-      {96, 122, 55, 141, 6},
-      {89, 117, 104, 148, 14}
-    },
-    { {172, 27, 229, 165, 10},
-      {250, 147, 43, 6, 14},
-      {90, 90, 125, 131, 5},
-      {118, 13, 76, 149, 15}
-    },
-    { {230, 47, 3, 108, 10},
-      {153, 114, 43, 171, 8},
-      {83, 108, 15, 70, 7},
-      {29, 93, 68, 233, 9}
-    },
-    { {127, 229, 102, 248, 8},
-      {163, 111, 179, 233, 6},
-      {17, 246, 106, 127, 14},
-      {105, 124, 223, 108, 5}
-    },
-    { {163, 194, 62, 50, 14},
-      {0, 85, 255, 83, 5},
-      {116, 199, 196, 60, 5},
-      {172, 175, 250, 160, 0}
-    },
-    { {148, 62, 117, 118, 6},
-      {249, 25, 202, 58, 13},
-      {102, 234, 231, 194, 9},
-      {181, 197, 57, 137, 15}
-    },
-    { {52, 186, 30, 90, 15},
-      {197, 121, 253, 24, 9},
-      {245, 167, 133, 210, 12},
-      {145, 139, 249, 234, 3}
-    },
-    { {3, 165, 18, 156, 11},
-      {13, 114, 145, 113, 2},
-      {211, 148, 138, 92, 0},
-      {72, 232, 148, 235, 0}
-    },
-    { {37, 82, 144, 131, 7},
-      {196, 148, 104, 84, 3},
-      {236, 16, 148, 170, 4},
-      {194, 161, 98, 146, 3}
-    },
-    { {152, 56, 107, 83, 15},
-      {119, 88, 197, 14, 13},
-      {252, 173, 97, 193, 9},
-      {183, 10, 49, 174, 14}
-    },
-    { {81, 8, 229, 57, 2},
-      {48, 185, 130, 196, 12},
-      {73, 202, 113, 8, 10},
-      {50, 52, 25, 208, 12}
-    },
-    { {109, 47, 236, 46, 14},
-      {171, 179, 111, 224, 13},
-      {119, 67, 127, 75, 6},
-      {176, 127, 108, 221, 5}
-    },
-    { {82, 188, 16, 202, 10},
-      {65, 56, 17, 185, 11},
-      {85, 48, 131, 212, 10},
-      {217, 216, 129, 200, 2}
-    },
-    { {179, 40, 54, 67, 10},
-      {1, 89, 33, 95, 13},
-      {92, 38, 193, 76, 13},
-      {191, 168, 73, 168, 0}
-    },
-    { {119, 53, 50, 215, 6},
-      {201, 90, 224, 253, 7},
-      {110, 180, 202, 206, 14},
-      {235, 240, 117, 169, 3}
-    },
-    { {60, 107, 123, 81, 7},
-      {183, 94, 236, 28, 12},
-      {232, 173, 237, 99, 12},
-      {51, 131, 119, 174, 13}
-    },
-    { {58, 210, 85, 76, 8},
-      {122, 45, 57, 25, 0},
-      {19, 42, 164, 181, 12},
-      {9, 137, 203, 69, 14}
-    },
-    { {121, 133, 192, 110, 10},
-      {42, 186, 51, 232, 1},
-      {87, 96, 58, 25, 14},
-      {129, 124, 197, 213, 4}
-    },
-    { {197, 187, 154, 199, 7},
-      {205, 210, 92, 222, 11},
-      {238, 53, 157, 218, 3},
-      {215, 179, 164, 187, 3}
-    },
-    { {12, 197, 122, 240, 11},
-      {166, 86, 151, 56, 6},
-      {208, 245, 234, 51, 0},
-      {97, 206, 150, 166, 5}
-    },
-    { {248, 208, 240, 214, 2},
-      {106, 156, 176, 154, 7},
-      {70, 176, 240, 177, 15},
-      {229, 144, 211, 149, 6}
-    },
-    { {129, 63, 211, 226, 11},
-      {117, 210, 11, 122, 11},
-      {212, 124, 191, 200, 1},
-      {213, 237, 4, 186, 14}
-    },
-    { {13, 236, 216, 183, 12},
-      {171, 132, 215, 116, 11},
-      {62, 209, 179, 123, 0},
-      {210, 238, 178, 29, 5}
-    },
-    { {27, 74, 227, 19, 2},
-      {50, 220, 136, 69, 13},
-      {76, 140, 117, 45, 8},
-      {186, 33, 19, 180, 12}
-    },
-    { {210, 32, 64, 67, 5},
-      {37, 8, 64, 143, 1},
-      {172, 32, 32, 68, 11},
-      {143, 16, 33, 10, 4}
-    },
-    { {20, 134, 143, 224, 4},
-      {144, 201, 94, 40, 2},
-      {32, 127, 22, 18, 8},
-      {65, 71, 169, 48, 9}
-    },
-    { {129, 156, 58, 252, 10},
-      {72, 112, 151, 122, 14},
-      {83, 245, 195, 152, 1},
-      {117, 238, 144, 225, 2}
-    },
-    { {69, 204, 88, 112, 14},
-      {160, 20, 215, 248, 8},
-      {112, 225, 163, 58, 2},
-      {17, 254, 178, 128, 5}
-    },
-    { {85, 209, 44, 27, 7},
-      {196, 63, 212, 196, 5},
-      {237, 131, 72, 186, 10},
-      {162, 50, 191, 194, 3}
-    },
-    { {124, 82, 159, 25, 14},
-      {210, 253, 237, 148, 0},
-      {121, 143, 148, 163, 14},
-      {2, 155, 123, 244, 11}
-    },
-    { {112, 145, 54, 145, 1},
-      {68, 75, 176, 148, 6},
-      {136, 150, 200, 144, 14},
-      {98, 144, 221, 34, 2}
-    },
-    { {252, 90, 66, 132, 10},
-      {234, 92, 41, 130, 10},
-      {82, 20, 37, 163, 15},
-      {84, 25, 67, 165, 7}
-    },
-    { {87, 151, 148, 193, 3},
-      {196, 155, 24, 253, 2},
-      {200, 50, 158, 158, 10},
-      {75, 241, 141, 146, 3}
-    },
-    { {165, 209, 196, 248, 2},
-      {224, 183, 178, 74, 2},
-      {65, 242, 56, 186, 5},
-      {69, 36, 222, 208, 7}
-    },
-    { {129, 60, 188, 144, 8},
-      {65, 129, 133, 114, 14},
-      {16, 147, 211, 200, 1},
-      {116, 234, 24, 24, 2}
-    },
-    { {9, 113, 70, 213, 3},
-      {111, 87, 128, 76, 2},
-      {202, 182, 40, 233, 0},
-      {67, 32, 30, 175, 6}
-    },
-    { {106, 207, 210, 216, 5},
-      {38, 230, 248, 185, 10},
-      {161, 180, 191, 53, 6},
-      {89, 209, 246, 118, 4}
-    },
-    { {115, 244, 119, 116, 9},
-      {125, 77, 179, 249, 4},
-      {146, 238, 226, 252, 14},
-      {41, 252, 219, 43, 14}
-    },
-    { {245, 157, 172, 185, 10},
-      {192, 187, 183, 230, 14},
-      {89, 211, 91, 154, 15},
-      {118, 126, 221, 208, 3}
-    },
-    { {202, 249, 118, 232, 4},
-      {99, 103, 82, 155, 14},
-      {33, 118, 233, 245, 3},
-      {125, 148, 174, 108, 6}
-    },
-    { {145, 223, 213, 147, 14},
-      {112, 159, 217, 118, 11},
-      {124, 154, 191, 184, 9},
-      {214, 233, 191, 144, 14}
-    },
-    { {151, 224, 139, 96, 13},
-      {149, 204, 87, 75, 0},
-      {176, 109, 16, 126, 9},
-      {13, 46, 163, 58, 9}
-    },
-    { {171, 24, 195, 41, 7},
-      {118, 240, 98, 71, 8},
-      {233, 76, 49, 141, 5},
-      {30, 36, 96, 246, 14}
-    },
-    { {12, 117, 233, 207, 4},
-      {251, 166, 68, 44, 7},
-      {47, 57, 122, 227, 0},
-      {227, 66, 38, 93, 15}
-    },
-    { {18, 88, 90, 126, 11},
-      {108, 124, 135, 25, 9},
-      {215, 229, 161, 164, 8},
-      {153, 142, 19, 227, 6}
-    },
-    { {226, 61, 82, 49, 9},
-      {101, 66, 163, 183, 8},
-      {152, 196, 171, 196, 7},
-      {30, 220, 84, 42, 6}
-    },
-    { {148, 62, 206, 46, 10},
-      {233, 249, 15, 34, 9},
-      {87, 71, 55, 194, 9},
-      {148, 79, 9, 249, 7}
-    },
-    { {77, 128, 42, 254, 11},
-      {142, 112, 151, 200, 7},
-      {215, 245, 64, 27, 2},
-      {225, 62, 144, 231, 1}
-    },
-    { {99, 222, 29, 74, 1},
-      {84, 37, 60, 249, 9},
-      {133, 43, 135, 188, 6},
-      {153, 243, 202, 66, 10}
-    },
-    { {234, 149, 240, 24, 8},
-      {98, 162, 177, 179, 4},
-      {17, 128, 250, 149, 7},
-      {44, 216, 212, 84, 6}
-    },
-    { {20, 204, 99, 128, 10},
-      {176, 92, 17, 32, 14},
-      {80, 28, 99, 50, 8},
-      {112, 72, 131, 160, 13}
-    },
-    { {200, 176, 49, 75, 15},
-      {87, 48, 81, 158, 5},
-      {253, 40, 192, 209, 3},
-      {167, 152, 160, 206, 10}
-    },
-    { {158, 5, 82, 110, 15},
-      {174, 122, 67, 59, 1},
-      {247, 100, 170, 7, 9},
-      {141, 204, 37, 231, 5}
-    },
-    { {90, 49, 246, 81, 3},
-      {103, 219, 128, 157, 4},
-      {200, 166, 248, 197, 10},
-      {43, 144, 29, 190, 6}
-    },
-    { {2, 64, 141, 174, 9},
-      {28, 165, 7, 1, 3},
-      {151, 91, 16, 36, 0},
-      {200, 14, 10, 83, 8}
-    },
-    { {3, 39, 204, 189, 6},
-      {41, 179, 206, 101, 2},
-      {107, 211, 62, 76, 0},
-      {74, 103, 60, 217, 4}
-    },
-    { {57, 199, 200, 136, 5},
-      {38, 174, 124, 96, 2},
-      {161, 17, 62, 57, 12},
-      {64, 99, 231, 86, 4}
-    },
-    { {29, 241, 95, 61, 5},
-      {255, 111, 214, 84, 0},
-      {171, 207, 168, 251, 8},
-      {2, 166, 191, 111, 15}
-    },
-    { {53, 248, 87, 146, 8},
-      {241, 77, 177, 80, 11},
-      {20, 158, 161, 250, 12},
-      {208, 168, 219, 40, 15}
-    },
-    { {246, 170, 194, 38, 15},
-      {173, 216, 123, 131, 9},
-      {246, 68, 53, 86, 15},
-      {156, 29, 225, 187, 5}
-    },
-    { {231, 224, 91, 154, 9},
-      {181, 100, 181, 211, 3},
-      {149, 157, 160, 126, 7},
-      {204, 186, 210, 106, 13}
-    },
-    { {35, 84, 88, 78, 2},
-      {104, 52, 36, 121, 1},
-      {71, 33, 162, 172, 4},
-      {137, 226, 66, 193, 6}
-    },
-    { {168, 240, 123, 208, 12},
-      {115, 68, 245, 26, 6},
-      {48, 189, 224, 241, 5},
-      {101, 138, 242, 44, 14}
-    },
-    { {31, 123, 242, 62, 3},
-      {239, 254, 138, 81, 13},
-      {199, 196, 253, 239, 8},
-      {184, 165, 23, 255, 7}
-    },
-    { {166, 34, 215, 254, 13},
-      {189, 225, 235, 27, 3},
-      {183, 254, 180, 70, 5},
-      {205, 141, 120, 123, 13}
-    },
-    { {60, 224, 174, 102, 10},
-      {139, 221, 55, 8, 5},
-      {86, 103, 80, 115, 12},
-      {161, 14, 203, 189, 1}
-    },
-    { {157, 234, 252, 246, 9},
-      {175, 141, 159, 90, 15},
-      {150, 243, 245, 123, 9},
-      {245, 175, 155, 31, 5}
-    },
-    { {118, 28, 15, 110, 1},
-      {220, 105, 38, 169, 9},
-      {135, 111, 3, 134, 14},
-      {153, 86, 73, 99, 11}
-    },
-    { {23, 229, 15, 201, 12},
-      {145, 111, 85, 109, 2},
-      {57, 63, 10, 126, 8},
-      {75, 106, 175, 104, 9}
-    },
-    { {107, 215, 2, 212, 12},
-      {74, 70, 249, 233, 2},
-      {50, 180, 14, 189, 6},
-      {73, 121, 246, 37, 2}
-    },
-    { {86, 44, 136, 80, 8},
-      {129, 136, 133, 169, 8},
-      {16, 161, 19, 70, 10},
-      {25, 90, 17, 24, 1}
-    },
-    { {117, 18, 248, 29, 15},
-      {236, 184, 237, 212, 4},
-      {251, 129, 244, 138, 14},
-      {34, 187, 113, 211, 7}
-    },
-    { {126, 225, 73, 21, 0},
-      {187, 14, 180, 133, 0},
-      {10, 137, 40, 119, 14},
-      {10, 18, 215, 13, 13}
-    },
-    { {16, 118, 198, 246, 1},
-      {109, 205, 138, 40, 3},
-      {134, 246, 54, 224, 8},
-      {193, 69, 27, 59, 6}
-    },
-    { {212, 235, 35, 223, 2},
-      {153, 126, 152, 142, 15},
-      {79, 188, 77, 114, 11},
-      {247, 17, 151, 233, 9}
-    },
-    { {40, 207, 171, 134, 10},
-      {26, 214, 61, 32, 15},
-      {86, 29, 95, 49, 4},
-      {240, 75, 198, 181, 8}
-    },
-    { {172, 20, 113, 133, 3},
-      {254, 16, 32, 54, 6},
-      {202, 24, 226, 131, 5},
-      {102, 192, 64, 135, 15}
-    },
-    { {175, 152, 175, 103, 14},
-      {218, 209, 119, 79, 13},
-      {126, 111, 81, 159, 5},
-      {191, 46, 232, 181, 11}
-    },
-    { {193, 158, 114, 157, 1},
-      {108, 96, 152, 246, 14},
-      {139, 148, 231, 152, 3},
-      {118, 241, 144, 99, 6}
-    },
-    { {207, 95, 181, 152, 6},
-      {210, 183, 200, 243, 14},
-      {97, 154, 223, 175, 3},
-      {124, 241, 62, 212, 11}
-    },
-    { {213, 221, 187, 147, 2},
-      {208, 222, 148, 246, 15},
-      {76, 157, 219, 186, 11},
-      {246, 242, 151, 176, 11}
-    },
-    { {79, 134, 37, 109, 3},
-      {158, 49, 26, 237, 4},
-      {203, 106, 70, 31, 2},
-      {43, 117, 136, 199, 9}
-    },
-    { {106, 36, 71, 111, 0},
-      {59, 97, 34, 173, 1},
-      {15, 110, 34, 69, 6},
-      {139, 84, 72, 109, 12}
-    },
-    { {128, 45, 147, 26, 1},
-      {21, 226, 128, 50, 9},
-      {133, 140, 155, 64, 1},
-      {148, 192, 20, 122, 8}
-    },
-    { {29, 205, 131, 180, 9},
-      {158, 206, 147, 96, 10},
-      {146, 220, 27, 59, 8},
-      {80, 108, 151, 55, 9}
-    },
-    { {218, 134, 193, 229, 12},
-      {58, 136, 91, 175, 2},
-      {58, 120, 54, 21, 11},
-      {79, 93, 161, 21, 12}
-    },
-    { {230, 246, 109, 46, 3},
-      {253, 53, 62, 163, 5},
-      {199, 75, 102, 246, 7},
-      {172, 87, 202, 203, 15}
-    },
-    { {61, 137, 16, 149, 7},
-      {142, 26, 240, 84, 10},
-      {234, 144, 137, 27, 12},
-      {82, 160, 245, 135, 1}
-    },
-    { {210, 121, 65, 88, 12},
-      {113, 46, 193, 139, 8},
-      {49, 168, 41, 228, 11},
-      {29, 24, 55, 72, 14}
-    },
-    { {160, 175, 28, 189, 14},
-      {9, 51, 255, 54, 10},
-      {123, 211, 143, 80, 5},
-      {86, 207, 252, 201, 0}
-    },
-    { {1, 87, 110, 34, 13},
-      {100, 71, 79, 96, 5},
-      {180, 71, 110, 168, 0},
-      {160, 111, 46, 34, 6}
-    },
-    { {87, 248, 236, 245, 8},
-      {233, 141, 151, 205, 14},
-      {26, 243, 113, 254, 10},
-      {123, 62, 155, 25, 7}
-    },
-    { {106, 255, 41, 18, 1},
-      {87, 6, 188, 161, 13},
-      {132, 137, 79, 245, 6},
-      {184, 83, 214, 14, 10}
-    },
-    { {251, 33, 174, 202, 0},
-      {3, 235, 36, 203, 7},
-      {5, 55, 88, 77, 15},
-      {237, 50, 77, 124, 0}
-    },
-    { {11, 139, 189, 114, 11},
-      {22, 147, 159, 89, 13},
-      {212, 235, 221, 29, 0},
-      {185, 175, 156, 150, 8}
-    },
-    { {212, 152, 51, 194, 13},
-      {212, 72, 81, 154, 15},
-      {180, 60, 193, 146, 11},
-      {245, 152, 161, 34, 11}
-    },
-    { {225, 75, 0, 230, 14},
-      {8, 22, 107, 202, 11},
-      {118, 112, 13, 40, 7},
-      {213, 61, 102, 129, 0}
-    },
-    { {26, 95, 155, 85, 5},
-      {94, 206, 204, 61, 8},
-      {170, 173, 159, 165, 8},
-      {27, 195, 55, 55, 10}
-    },
-    { {240, 142, 136, 165, 15},
-      {12, 152, 127, 166, 10},
-      {250, 81, 23, 16, 15},
-      {86, 95, 225, 147, 0}
-    },
-    { {167, 153, 98, 167, 6},
-      {232, 82, 114, 71, 15},
-      {110, 84, 105, 158, 5},
-      {254, 36, 228, 161, 7}
-    },
-    { {117, 137, 204, 235, 6},
-      {160, 187, 118, 204, 11},
-      {109, 115, 57, 26, 14},
-      {211, 54, 237, 208, 5}
-    },
-    { {146, 223, 143, 67, 12},
-      {80, 207, 93, 47, 9},
-      {60, 47, 31, 180, 9},
-      {159, 75, 175, 48, 10}
-    },
-    { {174, 86, 155, 223, 2},
-      {218, 244, 172, 63, 3},
-      {79, 189, 150, 167, 5},
-      {207, 195, 82, 245, 11}
-    },
-    { {210, 12, 103, 74, 4},
-      {48, 105, 64, 171, 13},
-      {37, 46, 99, 4, 11},
-      {189, 80, 41, 96, 12}
-    },
-    { {40, 70, 65, 78, 7},
-      {62, 52, 104, 40, 1},
-      {231, 40, 38, 33, 4},
-      {129, 65, 98, 199, 12}
-    },
-    { {108, 201, 54, 127, 1},
-      {142, 103, 178, 156, 13},
-      {143, 230, 201, 51, 6},
-      {179, 148, 222, 103, 1}
-    },
-    { {194, 238, 156, 100, 12},
-      {9, 133, 95, 187, 8},
-      {50, 99, 151, 116, 3},
-      {29, 223, 170, 25, 0}
-    },
-    { {36, 163, 220, 7, 0},
-      {169, 131, 60, 20, 1},
-      {14, 3, 188, 82, 4},
-      {130, 131, 204, 25, 5}
-    },
-    { {41, 169, 53, 183, 11},
-      {31, 19, 179, 84, 15},
-      {222, 218, 201, 89, 4},
-      {242, 172, 220, 143, 8}
-    },
-    { {105, 9, 143, 242, 0},
-      {18, 195, 166, 200, 11},
-      {4, 255, 25, 9, 6},
-      {209, 54, 92, 52, 8}
-    },
-    { {221, 179, 45, 144, 2},
-      {211, 27, 156, 194, 6},
-      {64, 155, 76, 219, 11},
-      {100, 51, 157, 140, 11}
-    },
-    { {17, 24, 73, 168, 13},
-      {116, 40, 71, 64, 10},
-      {177, 89, 33, 136, 8},
-      {80, 46, 33, 66, 14}
-    },
-    { {182, 179, 217, 164, 5},
-      {253, 138, 126, 19, 2},
-      {162, 89, 188, 214, 13},
-      {76, 135, 229, 27, 15}
-    },
-    { {160, 207, 230, 60, 2},
-      {40, 247, 186, 34, 12},
-      {67, 198, 127, 48, 5},
-      {52, 69, 222, 241, 4}
-    },
-    { {55, 59, 166, 59, 8},
-      {193, 235, 171, 69, 13},
-      {29, 198, 93, 206, 12},
-      {186, 45, 93, 120, 3}
-    },
-    { {161, 242, 208, 206, 8},
-      {105, 164, 57, 90, 3},
-      {23, 48, 180, 248, 5},
-      {197, 169, 194, 89, 6}
-    },
-    { {86, 143, 18, 81, 15},
-      {132, 90, 217, 189, 8},
-      {248, 164, 143, 22, 10},
-      {27, 217, 181, 162, 1}
-    },
-    { {194, 231, 12, 94, 10},
-      {9, 55, 157, 171, 1},
-      {87, 163, 14, 116, 3},
-      {141, 91, 158, 201, 0}
-    },
-    { {156, 25, 191, 90, 0},
-      {210, 235, 132, 26, 13},
-      {5, 175, 217, 131, 9},
-      {181, 130, 29, 116, 11}
-    },
-    { {117, 207, 171, 65, 6},
-      {144, 222, 124, 236, 12},
-      {104, 45, 95, 58, 14},
-      {51, 115, 231, 176, 9}
-    },
-    { {126, 204, 41, 109, 0},
-      {154, 44, 54, 173, 12},
-      {11, 105, 67, 55, 14},
-      {59, 86, 195, 69, 9}
-    },
-    { {243, 91, 227, 26, 14},
-      {112, 254, 233, 195, 13},
-      {117, 140, 125, 172, 15},
-      {188, 57, 119, 240, 14}
-    },
-    { {190, 117, 133, 241, 8},
-      {211, 143, 163, 47, 2},
-      {24, 250, 26, 231, 13},
-      {79, 76, 95, 28, 11}
-    },
-    { {33, 154, 217, 93, 10},
-      {120, 176, 189, 92, 8},
-      {91, 169, 181, 152, 4},
-      {19, 171, 208, 209, 14}
-    },
-    { {187, 162, 184, 116, 12},
-      {11, 136, 255, 91, 4},
-      {50, 225, 212, 93, 13},
-      {45, 175, 241, 29, 0}
-    },
-    { {24, 170, 15, 78, 6},
-      {27, 121, 92, 8, 9},
-      {103, 47, 5, 81, 8},
-      {145, 3, 169, 237, 8}
-    },
-    { {141, 163, 255, 65, 12},
-      {179, 195, 93, 94, 4},
-      {56, 47, 252, 91, 1},
-      {39, 171, 172, 60, 13}
-    },
-    { {204, 241, 13, 15, 1},
-      {223, 39, 20, 134, 1},
-      {143, 11, 8, 243, 3},
-      {134, 18, 142, 79, 11}
-    },
-    { {15, 249, 178, 82, 13},
-      {199, 198, 209, 89, 13},
-      {180, 164, 217, 255, 0},
-      {185, 168, 182, 62, 3}
-    },
-    { {1, 159, 5, 220, 10},
-      {88, 51, 153, 104, 10},
-      {83, 186, 15, 152, 0},
-      {81, 105, 156, 193, 10}
-    },
-    { {223, 138, 224, 53, 4},
-      {170, 136, 218, 199, 12},
-      {42, 192, 117, 31, 11},
-      {62, 53, 177, 21, 5}
-    },
-    { {206, 123, 160, 13, 5},
-      {207, 166, 72, 135, 12},
-      {171, 0, 93, 231, 3},
-      {62, 17, 38, 95, 3}
-    },
-    { {217, 125, 237, 88, 6},
-      {115, 191, 196, 234, 12},
-      {97, 171, 123, 233, 11},
-      {53, 114, 63, 220, 14}
-    },
-    { {181, 147, 30, 12, 6},
-      {200, 123, 124, 82, 0},
-      {99, 7, 140, 154, 13},
-      {4, 163, 237, 225, 3}
-    },
-    { {18, 139, 154, 110, 4},
-      {8, 234, 94, 25, 9},
-      {39, 101, 157, 20, 8},
-      {153, 135, 165, 113, 0}
-    },
-    { {242, 22, 60, 166, 3},
-      {76, 25, 46, 179, 7},
-      {198, 83, 198, 132, 15},
-      {236, 215, 73, 131, 2}
-    },
-    { {232, 10, 7, 115, 7},
-      {22, 81, 234, 142, 9},
-      {236, 238, 5, 1, 7},
-      {151, 21, 120, 166, 8}
-    },
-    { {122, 115, 30, 194, 4},
-      {67, 79, 108, 153, 3},
-      {36, 55, 140, 229, 14},
-      {201, 147, 111, 44, 2}
-    },
-    { {53, 218, 126, 240, 11},
-      {228, 93, 191, 88, 14},
-      {208, 247, 229, 186, 12},
-      {113, 175, 219, 162, 7}
-    },
-    { {153, 130, 253, 45, 1},
-      {62, 169, 30, 86, 4},
-      {139, 75, 244, 25, 9},
-      {38, 167, 137, 87, 12}
-    },
-    { {223, 169, 37, 94, 13},
-      {159, 43, 209, 203, 13},
-      {183, 170, 73, 95, 11},
-      {189, 56, 189, 79, 9}
-    },
-    { {165, 30, 214, 188, 15},
-      {236, 241, 235, 114, 10},
-      {243, 214, 183, 138, 5},
-      {84, 237, 120, 243, 7}
-    },
-    { {36, 8, 213, 209, 9},
-      {180, 129, 161, 28, 10},
-      {152, 186, 177, 2, 4},
-      {83, 136, 88, 18, 13}
-    },
-    { {181, 248, 233, 45, 6},
-      {249, 188, 118, 70, 12},
-      {107, 73, 113, 250, 13},
-      {54, 38, 227, 217, 15}
-    },
-    { {145, 54, 188, 78, 0},
-      {73, 169, 12, 122, 5},
-      {7, 35, 214, 200, 9},
-      {165, 227, 9, 89, 2}
-    },
-    { {174, 88, 224, 232, 5},
-      {230, 164, 98, 11, 14},
-      {161, 112, 113, 167, 5},
-      {125, 4, 98, 86, 7}
-    },
-    { {47, 128, 197, 170, 11},
-      {182, 177, 51, 65, 3},
-      {213, 90, 48, 31, 4},
-      {200, 44, 200, 214, 13}
-    },
-    { {218, 73, 123, 17, 9},
-      {54, 78, 133, 151, 12},
-      {152, 141, 233, 37, 11},
-      {62, 154, 23, 38, 12}
-    },
-    { {162, 246, 228, 83, 14},
-      {97, 149, 249, 47, 5},
-      {124, 162, 118, 244, 5},
-      {175, 73, 250, 152, 6}
-    },
-    { {33, 39, 109, 132, 12},
-      {57, 3, 109, 96, 6},
-      {50, 27, 110, 72, 4},
-      {96, 107, 108, 9, 12}
-    },
-    { {107, 121, 40, 104, 12},
-      {67, 38, 103, 201, 12},
-      {49, 97, 73, 237, 6},
-      {57, 62, 102, 76, 2}
-    },
-    { {157, 218, 93, 177, 13},
-      {246, 13, 223, 86, 10},
-      {184, 219, 165, 187, 9},
-      {86, 175, 187, 6, 15}
-    },
-    { {47, 207, 178, 181, 5},
-      {142, 198, 250, 117, 14},
-      {170, 212, 223, 63, 4},
-      {122, 229, 246, 55, 1}
-    },
-    { {175, 32, 71, 30, 8},
-      {187, 97, 161, 67, 1},
-      {23, 142, 32, 79, 5},
-      {140, 40, 88, 109, 13}
-    },
-    { {234, 199, 75, 58, 9},
-      {54, 102, 191, 163, 1},
-      {149, 205, 46, 53, 7},
-      {140, 95, 214, 102, 12}
-    },
-    { {204, 229, 29, 252, 14},
-      {155, 55, 215, 186, 2},
-      {115, 251, 138, 115, 3},
-      {69, 222, 190, 205, 9}
-    },
-    { {97, 48, 133, 50, 1},
-      {85, 129, 162, 192, 1},
-      {132, 202, 16, 200, 6},
-      {128, 52, 88, 26, 10}
-    },
-    { {180, 146, 25, 41, 1},
-      {212, 40, 62, 22, 0},
-      {137, 73, 132, 146, 13},
-      {6, 135, 193, 66, 11}
-    },
-    { {193, 207, 189, 157, 10},
-      {24, 183, 157, 246, 14},
-      {91, 155, 223, 56, 3},
-      {118, 251, 158, 209, 8}
-    },
-    { {8, 221, 26, 54, 6},
-      {74, 86, 214, 48, 9},
-      {102, 197, 139, 177, 0},
-      {144, 198, 182, 165, 2}
-    },
-    { {120, 67, 92, 168, 15},
-      {38, 63, 111, 144, 2},
-      {241, 83, 172, 33, 14},
-      {64, 159, 111, 198, 4}
-    },
-    { {32, 220, 186, 83, 14},
-      {64, 212, 245, 60, 13},
-      {124, 165, 211, 176, 4},
-      {179, 202, 242, 176, 2}
-    },
-    { {227, 132, 165, 236, 6},
-      {24, 177, 114, 235, 6},
-      {99, 122, 82, 28, 7},
-      {109, 116, 232, 209, 8}
-    },
-    { {131, 145, 171, 122, 13},
-      {84, 226, 215, 75, 5},
-      {181, 237, 88, 156, 1},
-      {173, 46, 180, 114, 10}
-    },
-    { {114, 38, 60, 80, 11},
-      {5, 25, 173, 185, 4},
-      {208, 163, 198, 68, 14},
-      {41, 219, 89, 138, 0}
-    },
-    { {242, 174, 11, 171, 12},
-      {17, 104, 127, 167, 11},
-      {61, 93, 7, 84, 15},
-      {222, 95, 225, 104, 8}
-    },
-    { {46, 136, 9, 214, 3},
-      {158, 16, 180, 9, 11},
-      {198, 185, 1, 23, 4},
-      {217, 2, 208, 135, 9}
-    },
-    { {183, 203, 246, 151, 12},
-      {168, 207, 249, 87, 15},
-      {62, 150, 253, 62, 13},
-      {254, 169, 255, 49, 5}
-    },
-    { {49, 251, 244, 57, 14},
-      {97, 191, 251, 84, 12},
-      {121, 194, 253, 248, 12},
-      {50, 173, 255, 216, 6}
-    },
-    { {142, 199, 82, 154, 6},
-      {162, 118, 216, 51, 3},
-      {101, 148, 174, 55, 1},
-      {204, 193, 182, 228, 5}
-    },
-    { {94, 235, 242, 10, 12},
-      {163, 238, 89, 145, 13},
-      {53, 4, 253, 119, 10},
-      {184, 153, 167, 124, 5}
-    },
-    { {227, 59, 129, 212, 12},
-      {89, 130, 233, 203, 10},
-      {50, 184, 29, 204, 7},
-      {93, 57, 116, 25, 10}
-    },
-    { {172, 124, 242, 222, 10},
-      {235, 244, 161, 58, 15},
-      {87, 180, 243, 227, 5},
-      {245, 200, 82, 253, 7}
-    },
-    { {78, 1, 1, 147, 2},
-      {146, 18, 128, 133, 3},
-      {76, 152, 8, 7, 2},
-      {202, 16, 20, 132, 9}
-    },
-    { {201, 144, 131, 96, 5},
-      {86, 192, 82, 202, 0},
-      {160, 108, 16, 153, 3},
-      {5, 52, 160, 54, 10}
-    },
-    { {245, 102, 105, 160, 13},
-      {181, 12, 111, 226, 6},
-      {176, 89, 102, 106, 15},
-      {100, 127, 99, 10, 13}
-    },
-    { {44, 3, 150, 212, 14},
-      {138, 211, 233, 24, 2},
-      {114, 182, 156, 3, 4},
-      {65, 137, 124, 181, 1}
-    },
-    { {118, 193, 117, 204, 7},
-      {188, 63, 112, 153, 6},
-      {227, 58, 232, 54, 14},
-      {105, 144, 239, 195, 13}
-    },
-    { {176, 251, 83, 107, 5},
-      {117, 110, 122, 30, 9},
-      {173, 108, 173, 240, 13},
-      {151, 133, 231, 106, 14}
-    },
-    { {135, 53, 206, 169, 8},
-      {225, 227, 7, 103, 2},
-      {25, 87, 58, 206, 1},
-      {78, 110, 12, 120, 7}
-    },
-    { {231, 139, 244, 106, 11},
-      {164, 179, 59, 219, 13},
-      {213, 98, 253, 30, 7},
-      {189, 189, 204, 210, 5}
-    },
-    { {185, 178, 1, 226, 1},
-      {87, 8, 58, 74, 3},
-      {132, 120, 4, 217, 13},
-      {197, 37, 193, 14, 10}
-    },
-    { {44, 230, 244, 199, 9},
-      {175, 133, 57, 60, 7},
-      {158, 50, 246, 115, 4},
-      {227, 201, 202, 31, 5}
-    },
-    { {240, 26, 58, 172, 4},
-      {72, 104, 110, 146, 14},
-      {35, 85, 197, 128, 15},
-      {116, 151, 97, 97, 2}
-    },
-    { {107, 29, 238, 143, 4},
-      {106, 227, 100, 229, 15},
-      {47, 23, 123, 141, 6},
-      {250, 114, 108, 117, 6}
-    },
-    { {10, 99, 89, 22, 11},
-      {63, 22, 141, 17, 1},
-      {214, 137, 172, 101, 0},
-      {136, 139, 22, 143, 12}
-    },
-    { {61, 80, 237, 142, 0},
-      {250, 173, 36, 64, 7},
-      {7, 27, 112, 171, 12},
-      {224, 34, 75, 85, 15}
-    },
-    { {12, 234, 137, 42, 4},
-      {147, 164, 94, 0, 9},
-      {37, 73, 21, 115, 0},
-      {144, 7, 162, 92, 9}
-    },
-    { {146, 159, 44, 154, 3},
-      {68, 59, 156, 35, 15},
-      {197, 147, 79, 148, 9},
-      {252, 67, 157, 194, 2}
-    },
-    { {144, 185, 171, 44, 8},
-      {89, 234, 23, 2, 12},
-      {19, 77, 89, 208, 9},
-      {52, 14, 133, 121, 10}
-    },
-    { {96, 223, 140, 227, 4},
-      {64, 135, 126, 172, 11},
-      {44, 115, 31, 176, 6},
-      {211, 87, 238, 16, 2}
-    },
-    { {211, 163, 99, 9, 11},
-      {53, 122, 25, 199, 4},
-      {217, 12, 108, 92, 11},
-      {46, 57, 133, 234, 12}
-    },
-    { {37, 61, 159, 195, 3},
-      {213, 211, 36, 124, 11},
-      {204, 63, 155, 202, 4},
-      {211, 226, 76, 186, 11}
-    },
-    { {48, 25, 30, 15, 13},
-      {76, 107, 101, 20, 9},
-      {191, 7, 137, 128, 12},
-      {146, 138, 109, 99, 2}
-    },
-    { {90, 151, 28, 16, 1},
-      {70, 11, 156, 177, 0},
-      {128, 131, 142, 149, 10},
-      {8, 211, 157, 6, 2}
-    },
-    { {42, 15, 107, 51, 10},
-      {50, 82, 175, 37, 13},
-      {92, 205, 111, 5, 4},
-      {186, 79, 84, 164, 12}
-    },
-    { {106, 117, 209, 236, 0},
-      {123, 166, 34, 185, 2},
-      {3, 120, 186, 229, 6},
-      {73, 212, 70, 93, 14}
-    },
-    { {30, 157, 187, 139, 1},
-      {214, 234, 20, 53, 15},
-      {141, 29, 219, 151, 8},
-      {250, 194, 133, 118, 11}
-    },
-    { {47, 58, 225, 220, 9},
-      {255, 160, 169, 73, 14},
-      {147, 184, 117, 207, 4},
-      {121, 41, 80, 95, 15}
-    },
-    { {99, 208, 151, 52, 7},
-      {92, 213, 242, 209, 0},
-      {226, 206, 144, 188, 6},
-      {8, 180, 250, 179, 10}
-    },
-    { {216, 157, 137, 67, 7},
-      {86, 154, 84, 174, 9},
-      {236, 41, 27, 145, 11},
-      {151, 82, 165, 150, 10}
-    },
-    { {131, 189, 136, 80, 11},
-      {69, 146, 149, 107, 8},
-      {208, 161, 27, 220, 1},
-      {29, 106, 148, 154, 2}
-    },
-    { {34, 78, 125, 138, 14},
-      {48, 53, 109, 49, 15},
-      {117, 27, 231, 36, 4},
-      {248, 203, 106, 192, 12}
-    },
-    { {121, 75, 63, 158, 10},
-      {26, 127, 173, 208, 15},
-      {87, 159, 205, 41, 14},
-      {240, 187, 95, 229, 8}
-    },
-    { {141, 51, 167, 110, 15},
-      {223, 243, 75, 74, 5},
-      {247, 110, 92, 203, 1},
-      {165, 45, 44, 255, 11}
-    },
-    { {33, 133, 188, 205, 7},
-      {12, 179, 116, 124, 6},
-      {235, 51, 218, 24, 4},
-      {99, 226, 236, 211, 0}
-    },
-    { {240, 218, 227, 80, 3},
-      {116, 220, 184, 138, 12},
-      {192, 172, 117, 176, 15},
-      {53, 17, 211, 178, 14}
-    },
-    { {204, 223, 42, 42, 8},
-      {194, 102, 31, 162, 13},
-      {21, 69, 79, 179, 3},
-      {180, 95, 134, 100, 3}
-    },
-    { {56, 130, 84, 157, 1},
-      {46, 41, 184, 20, 2},
-      {139, 146, 164, 17, 12},
-      {66, 129, 217, 71, 4}
-    },
-    { {110, 45, 44, 91, 14},
-      {131, 51, 229, 173, 13},
-      {125, 163, 75, 71, 6},
-      {187, 90, 124, 204, 1}
-    },
-    { {122, 43, 200, 47, 2},
-      {43, 186, 46, 133, 9},
-      {79, 65, 61, 69, 14},
-      {154, 23, 69, 221, 4}
-    },
-    { {87, 219, 131, 112, 8},
-      {208, 206, 155, 201, 8},
-      {16, 236, 29, 190, 10},
-      {25, 61, 151, 48, 11}
-    },
-    { {201, 217, 206, 10, 6},
-      {98, 247, 84, 194, 9},
-      {101, 7, 57, 185, 3},
-      {148, 50, 174, 244, 6}
-    },
-    { {140, 81, 7, 168, 12},
-      {210, 103, 67, 2, 2},
-      {49, 94, 8, 163, 1},
-      {68, 12, 46, 100, 11}
-    },
-    { {189, 143, 171, 242, 11},
-      {150, 218, 191, 106, 15},
-      {212, 253, 95, 27, 13},
-      {245, 111, 213, 182, 9}
-    },
-    { {100, 133, 26, 10, 13},
-      {132, 98, 117, 176, 1},
-      {181, 5, 138, 18, 6},
-      {128, 218, 228, 98, 1}
-    },
-    { {220, 109, 58, 176, 4},
-      {131, 78, 198, 178, 14},
-      {32, 213, 203, 99, 11},
-      {116, 214, 55, 44, 1}
-    },
-    { {231, 251, 25, 168, 3},
-      {213, 54, 62, 211, 10},
-      {193, 89, 141, 254, 7},
-      {92, 183, 198, 202, 11}
-    },
-    { {177, 204, 84, 80, 5},
-      {36, 13, 240, 122, 8},
-      {160, 162, 163, 56, 13},
-      {21, 224, 251, 2, 4}
-    },
-    { {97, 110, 245, 148, 7},
-      {61, 149, 232, 240, 14},
-      {226, 154, 247, 104, 6},
-      {112, 241, 122, 155, 12}
-    },
-    { {147, 83, 11, 252, 1},
-      {92, 110, 142, 75, 2},
-      {131, 253, 12, 172, 9},
-      {77, 39, 23, 99, 10}
-    },
-    { {27, 41, 1, 82, 8},
-      {19, 10, 129, 73, 9},
-      {20, 168, 9, 77, 8},
-      {153, 40, 21, 12, 8}
-    },
-    { {197, 245, 7, 104, 1},
-      {213, 103, 18, 234, 0},
-      {129, 110, 10, 250, 3},
-      {5, 116, 142, 106, 11}
-    },
-    { {52, 186, 247, 153, 2},
-      {241, 249, 184, 20, 14},
-      {73, 158, 245, 210, 12},
-      {114, 129, 217, 248, 15}
-    },
-    { {169, 176, 189, 187, 13},
-      {87, 161, 247, 86, 7},
-      {189, 219, 208, 217, 5},
-      {230, 174, 248, 94, 10}
-    },
-    { {149, 57, 193, 12, 5},
-      {253, 170, 64, 66, 8},
-      {163, 8, 57, 202, 9},
-      {20, 32, 37, 91, 15}
-    },
-    { {50, 223, 204, 191, 2},
-      {104, 191, 190, 37, 11},
-      {79, 211, 63, 180, 12},
-      {218, 71, 223, 209, 6}
-    },
-    { {237, 234, 172, 111, 7},
-      {143, 181, 126, 206, 13},
-      {239, 99, 85, 123, 7},
-      {183, 55, 234, 223, 1}
-    },
-    { {77, 86, 15, 172, 10},
-      {218, 117, 15, 224, 2},
-      {83, 95, 6, 171, 2},
-      {64, 127, 10, 229, 11}
-    },
-    { {116, 172, 190, 43, 0},
-      {129, 233, 54, 180, 13},
-      {13, 71, 211, 82, 14},
-      {178, 214, 201, 120, 1}
-    },
-    { {35, 182, 120, 236, 5},
-      {109, 32, 126, 121, 6},
-      {163, 113, 230, 220, 4},
-      {105, 231, 224, 75, 6}
-    },
-    { {232, 210, 137, 53, 1},
-      {94, 132, 190, 134, 0},
-      {138, 201, 20, 177, 7},
-      {6, 23, 210, 23, 10}
-    },
-    { {235, 150, 185, 93, 6},
-      {90, 176, 252, 255, 4},
-      {107, 169, 214, 157, 7},
-      {47, 243, 240, 213, 10}
-    },
-    { {85, 145, 91, 105, 0},
-      {240, 106, 22, 220, 0},
-      {9, 109, 168, 154, 10},
-      {3, 182, 133, 96, 15}
-    },
-    { {40, 186, 189, 218, 6},
-      {83, 177, 252, 24, 15},
-      {101, 187, 213, 209, 4},
-      {241, 131, 248, 220, 10}
-    },
-    { {35, 163, 75, 130, 11},
-      {53, 82, 61, 65, 3},
-      {212, 29, 44, 92, 4},
-      {200, 43, 196, 170, 12}
-    },
-    { {193, 172, 20, 84, 10},
-      {9, 17, 145, 250, 8},
-      {82, 162, 131, 88, 3},
-      {21, 248, 152, 137, 0}
-    },
-    { {100, 182, 175, 131, 2},
-      {209, 209, 60, 164, 7},
-      {76, 31, 86, 210, 6},
-      {226, 83, 200, 184, 11}
-    },
-    { {82, 25, 155, 54, 1},
-      {92, 202, 134, 145, 9},
-      {134, 205, 153, 132, 10},
-      {152, 150, 21, 51, 10}
-    },
-    { {99, 183, 61, 54, 4},
-      {89, 3, 254, 241, 5},
-      {38, 203, 206, 220, 6},
-      {168, 247, 252, 9, 10}
-    },
-    { {192, 85, 112, 85, 8},
-      {104, 6, 129, 190, 4},
-      {26, 160, 234, 160, 3},
-      {39, 216, 22, 1, 6}
-    },
-    { {52, 181, 171, 169, 13},
-      {213, 234, 119, 36, 6},
-      {185, 93, 90, 210, 12},
-      {98, 78, 229, 122, 11}
-    },
-    { {4, 214, 173, 116, 7},
-      {220, 149, 222, 40, 4},
-      {226, 235, 86, 178, 0},
-      {33, 71, 186, 147, 11}
-    },
-    { {58, 185, 185, 47, 15},
-      {95, 186, 119, 21, 13},
-      {255, 73, 217, 213, 12},
-      {186, 142, 229, 223, 10}
-    },
-    { {30, 193, 204, 115, 3},
-      {166, 159, 150, 13, 1},
-      {204, 227, 56, 55, 8},
-      {139, 6, 159, 150, 5}
-    },
-    { {227, 95, 151, 12, 12},
-      {88, 231, 105, 243, 8},
-      {51, 14, 159, 172, 7},
-      {28, 249, 110, 113, 10}
-    },
-    { {82, 233, 202, 244, 7},
-      {45, 222, 214, 137, 10},
-      {226, 245, 57, 116, 10},
-      {89, 22, 183, 187, 4}
-    },
-    { {171, 99, 139, 22, 6},
-      {27, 214, 236, 67, 1},
-      {102, 141, 28, 109, 5},
-      {140, 35, 118, 189, 8}
-    },
-    { {138, 229, 208, 83, 7},
-      {39, 150, 208, 63, 1},
-      {236, 160, 186, 117, 1},
-      {143, 192, 182, 158, 4}
-    },
-    { {103, 173, 81, 43, 1},
-      {181, 34, 50, 245, 9},
-      {141, 72, 171, 94, 6},
-      {154, 244, 196, 74, 13}
-    },
-    { {179, 24, 122, 4, 11},
-      {108, 88, 37, 83, 12},
-      {210, 5, 225, 140, 13},
-      {60, 170, 65, 163, 6}
-    },
-    { {60, 198, 137, 195, 8},
-      {146, 140, 61, 44, 3},
-      {28, 57, 22, 51, 12},
-      {195, 75, 195, 20, 9}
-    },
-    { {250, 116, 11, 175, 7},
-      {95, 124, 102, 167, 3},
-      {239, 93, 2, 229, 15},
-      {206, 86, 99, 239, 10}
-    },
-    { {4, 250, 221, 72, 11},
-      {245, 181, 29, 24, 8},
-      {209, 43, 181, 242, 0},
-      {17, 139, 138, 218, 15}
-    },
-    { {153, 138, 132, 196, 12},
-      {10, 137, 89, 74, 10},
-      {50, 50, 21, 25, 9},
-      {85, 41, 169, 21, 0}
-    },
-    { {63, 252, 218, 241, 1},
-      {231, 204, 182, 125, 10},
-      {136, 245, 179, 255, 12},
-      {91, 230, 211, 62, 7}
-    },
-    { {148, 250, 34, 140, 9},
-      {205, 108, 25, 2, 14},
-      {147, 20, 69, 242, 9},
-      {116, 9, 131, 107, 3}
-    },
-    { {228, 237, 60, 145, 13},
-      {133, 7, 245, 182, 14},
-      {184, 147, 203, 114, 7},
-      {118, 218, 254, 10, 1}
-    },
-    { {3, 55, 138, 20, 12},
-      {73, 194, 205, 97, 0},
-      {50, 133, 30, 204, 0},
-      {8, 107, 52, 57, 2}
-    },
-    { {216, 27, 34, 208, 1},
-      {70, 74, 136, 138, 14},
-      {128, 180, 77, 129, 11},
-      {117, 17, 21, 38, 2}
-    },
-    { {25, 91, 18, 85, 10},
-      {74, 94, 137, 92, 8},
-      {90, 164, 141, 169, 8},
-      {19, 169, 23, 165, 2}
-    },
-    { {33, 72, 120, 182, 2},
-      {40, 20, 166, 80, 15},
-      {70, 209, 225, 40, 4},
-      {240, 166, 82, 129, 4}
-    },
-    { {40, 93, 236, 19, 2},
-      {98, 151, 164, 36, 13},
-      {76, 131, 123, 161, 4},
-      {178, 66, 94, 148, 6}
-    },
-    { {123, 100, 52, 77, 7},
-      {15, 61, 96, 253, 4},
-      {235, 34, 194, 109, 14},
-      {43, 240, 107, 207, 0}
-    },
-    { {98, 75, 151, 138, 7},
-      {20, 247, 104, 145, 11},
-      {229, 30, 157, 36, 6},
-      {216, 145, 110, 242, 8}
-    },
-    { {103, 119, 188, 11, 1},
-      {197, 167, 44, 245, 5},
-      {141, 3, 222, 238, 6},
-      {170, 243, 78, 90, 3}
-    },
-    { {144, 144, 113, 245, 10},
-      {120, 24, 147, 30, 6},
-      {90, 248, 224, 144, 9},
-      {103, 140, 145, 129, 14}
-    },
-    { {37, 206, 233, 123, 13},
-      {180, 164, 255, 108, 13},
-      {189, 233, 119, 58, 4},
-      {179, 111, 242, 82, 13}
-    },
-    { {253, 83, 136, 111, 13},
-      {206, 174, 111, 206, 1},
-      {191, 97, 28, 171, 15},
-      {135, 63, 103, 87, 3}
-    },
-    { {231, 105, 53, 36, 11},
-      {157, 23, 35, 211, 12},
-      {210, 74, 201, 110, 7},
-      {60, 188, 78, 139, 9}
-    },
-    { {24, 201, 137, 127, 9},
-      {30, 174, 151, 12, 9},
-      {159, 233, 25, 49, 8},
-      {147, 14, 151, 87, 8}
-    },
-    { {101, 96, 64, 176, 10},
-      {161, 20, 163, 192, 2},
-      {80, 208, 32, 106, 6},
-      {64, 60, 82, 136, 5}
-    },
-    { {56, 46, 157, 194, 13},
-      {23, 137, 109, 56, 11},
-      {180, 59, 151, 65, 12},
-      {209, 203, 105, 30, 8}
-    },
-    { {205, 242, 177, 37, 13},
-      {223, 132, 91, 214, 4},
-      {186, 72, 212, 251, 3},
-      {38, 189, 162, 31, 11}
-    },
-    { {9, 78, 179, 61, 6},
-      {26, 244, 202, 116, 12},
-      {107, 204, 215, 41, 0},
-      {50, 229, 50, 245, 8}
-    },
-    { {57, 223, 214, 61, 1},
-      {110, 239, 186, 116, 8},
-      {139, 198, 191, 185, 12},
-      {18, 229, 223, 119, 6}
-    },
-    { {249, 54, 192, 90, 7},
-      {103, 184, 232, 234, 1},
-      {229, 160, 54, 201, 15},
-      {133, 113, 113, 222, 6}
-    },
-    { {119, 243, 69, 1, 5},
-      {245, 15, 120, 197, 0},
-      {168, 10, 44, 254, 14},
-      {10, 49, 239, 10, 15}
-    },
-    { {229, 170, 108, 152, 3},
-      {165, 49, 188, 194, 14},
-      {193, 147, 101, 90, 7},
-      {116, 51, 216, 202, 5}
-    },
-    { {176, 232, 167, 19, 14},
-      {17, 221, 241, 6, 13},
-      {124, 142, 81, 112, 13},
-      {182, 8, 251, 184, 8}
-    },
-    { {221, 219, 120, 40, 6},
-      {226, 62, 94, 210, 12},
-      {97, 65, 237, 187, 11},
-      {52, 183, 167, 196, 7}
-    },
-    { {59, 9, 157, 107, 2},
-      {18, 187, 38, 93, 9},
-      {77, 107, 153, 13, 12},
-      {155, 166, 77, 212, 8}
-    },
-    { {64, 234, 217, 35, 3},
-      {53, 148, 30, 148, 9},
-      {204, 73, 181, 112, 2},
-      {146, 151, 130, 154, 12}
-    },
-    { {26, 247, 252, 44, 4},
-      {107, 175, 94, 49, 4},
-      {35, 67, 254, 245, 8},
-      {40, 199, 175, 93, 6}
-    },
-    { {60, 154, 211, 10, 11},
-      {246, 248, 57, 16, 9},
-      {213, 12, 181, 147, 12},
-      {144, 137, 193, 246, 15}
-    },
-    { {179, 6, 81, 36, 2},
-      {56, 24, 42, 115, 0},
-      {66, 72, 166, 12, 13},
-      {12, 229, 65, 129, 12}
-    },
-    { {50, 189, 243, 128, 9},
-      {117, 202, 49, 49, 14},
-      {144, 28, 251, 212, 12},
-      {120, 200, 197, 58, 14}
-    },
-    { {108, 225, 50, 82, 6},
-      {131, 86, 240, 152, 5},
-      {100, 164, 200, 115, 6},
-      {161, 144, 246, 172, 1}
-    },
-    { {87, 93, 59, 77, 8},
-      {216, 110, 5, 253, 12},
-      {27, 45, 203, 174, 10},
-      {59, 250, 7, 97, 11}
-    },
-    { {50, 250, 120, 150, 11},
-      {109, 28, 189, 17, 15},
-      {214, 145, 229, 244, 12},
-      {248, 139, 211, 139, 6}
-    },
-    { {201, 37, 74, 207, 11},
-      {47, 114, 5, 238, 3},
-      {223, 53, 42, 73, 3},
-      {199, 122, 4, 239, 4}
-    },
-    { {91, 227, 88, 153, 8},
-      {35, 46, 157, 213, 2},
-      {25, 145, 172, 125, 10},
-      {74, 187, 151, 76, 4}
-    },
-    { {162, 249, 225, 35, 2},
-      {113, 150, 50, 7, 13},
-      {76, 72, 121, 244, 5},
-      {190, 4, 198, 152, 14}
-    },
-    { {119, 181, 82, 205, 9},
-      {237, 106, 49, 253, 2},
-      {155, 52, 170, 222, 14},
-      {75, 248, 197, 107, 7}
-    },
-    { {176, 219, 205, 212, 10},
-      {120, 159, 189, 10, 10},
-      {82, 187, 61, 176, 13},
-      {85, 11, 223, 145, 14}
-    },
-    { {203, 147, 21, 157, 14},
-      {90, 51, 217, 215, 2},
-      {123, 154, 140, 157, 3},
-      {78, 185, 188, 197, 10}
-    },
-    { {126, 39, 103, 62, 11},
-      {191, 123, 171, 161, 5},
-      {215, 206, 110, 71, 14},
-      {168, 93, 93, 239, 13}
-    },
-    { {27, 68, 157, 3, 7},
-      {22, 157, 68, 117, 1},
-      {236, 11, 146, 45, 8},
-      {138, 226, 43, 150, 8}
-    },
-    { {214, 213, 57, 224, 1},
-      {212, 14, 22, 187, 6},
-      {128, 121, 202, 182, 11},
-      {109, 214, 135, 2, 11}
-    },
-    { {153, 17, 59, 93, 5},
-      {94, 106, 196, 94, 4},
-      {171, 173, 200, 137, 9},
-      {39, 162, 53, 103, 10}
-    },
-    { {237, 201, 222, 175, 0},
-      {170, 231, 54, 214, 11},
-      {15, 87, 185, 59, 7},
-      {214, 182, 206, 117, 5}
-    },
-    { {152, 79, 114, 58, 0},
-      {34, 110, 138, 50, 13},
-      {5, 196, 239, 33, 9},
-      {180, 197, 23, 100, 4}
-    },
-    { {146, 177, 194, 94, 11},
-      {109, 250, 145, 11, 1},
-      {215, 164, 56, 212, 9},
-      {141, 8, 149, 251, 6}
-    },
-    { {233, 83, 55, 170, 15},
-      {86, 119, 107, 210, 7},
-      {245, 94, 204, 169, 7},
-      {228, 189, 110, 230, 10}
-    },
-    { {184, 249, 145, 224, 11},
-      {87, 158, 51, 26, 10},
-      {208, 120, 153, 241, 13},
-      {85, 140, 199, 158, 10}
-    },
-    { {54, 190, 41, 6, 4},
-      {217, 8, 124, 33, 13},
-      {38, 9, 71, 214, 12},
-      {184, 67, 225, 9, 11}
-    },
-    { {109, 88, 75, 223, 15},
-      {254, 116, 229, 204, 11},
-      {255, 189, 33, 171, 6},
-      {211, 58, 114, 231, 15}
-    },
-    { {124, 73, 255, 32, 11},
-      {182, 223, 39, 144, 12},
-      {208, 79, 249, 35, 14},
-      {48, 158, 79, 182, 13}
-    },
-    { {204, 4, 237, 38, 9},
-      {190, 129, 7, 162, 5},
-      {150, 75, 114, 3, 3},
-      {164, 94, 8, 23, 13}
-    },
-    { {126, 191, 195, 88, 12},
-      {243, 234, 249, 169, 8},
-      {49, 172, 63, 215, 14},
-      {25, 89, 245, 124, 15}
-    },
-    { {35, 71, 74, 52, 11},
-      {44, 86, 175, 97, 0},
-      {210, 197, 46, 44, 4},
-      {8, 111, 86, 163, 4}
-    },
-    { {247, 2, 101, 153, 14},
-      {176, 57, 233, 199, 6},
-      {121, 154, 100, 14, 15},
-      {110, 57, 121, 192, 13}
-    },
-    { {183, 134, 11, 177, 9},
-      {148, 72, 191, 103, 2},
-      {152, 221, 6, 30, 13},
-      {78, 111, 209, 34, 9}
-    },
-    { {29, 237, 84, 211, 10},
-      {163, 31, 145, 124, 11},
-      {92, 178, 171, 123, 8},
-      {211, 232, 159, 140, 5}
-    },
-    { {19, 129, 28, 244, 14},
-      {8, 27, 215, 89, 2},
-      {114, 243, 136, 28, 8},
-      {73, 174, 189, 129, 0}
-    },
-    { {38, 136, 183, 166, 7},
-      {156, 209, 114, 17, 15},
-      {230, 94, 209, 22, 4},
-      {248, 132, 232, 179, 9}
-    },
-    { {218, 189, 5, 242, 12},
-      {83, 11, 211, 171, 11},
-      {52, 250, 11, 213, 11},
-      {221, 92, 189, 12, 10}
-    },
-    { {179, 196, 25, 242, 6},
-      {16, 28, 246, 123, 3},
-      {100, 249, 130, 60, 13},
-      {205, 230, 243, 128, 8}
-    },
-    { {3, 88, 126, 158, 12},
-      {104, 101, 197, 81, 15},
-      {55, 151, 225, 172, 0},
-      {248, 170, 58, 97, 6}
-    },
-    { {138, 226, 81, 223, 4},
-      {59, 36, 216, 31, 3},
-      {47, 184, 164, 117, 1},
-      {207, 129, 178, 77, 12}
-    },
-    { {116, 44, 226, 207, 6},
-      {169, 248, 96, 172, 15},
-      {111, 52, 115, 66, 14},
-      {243, 80, 97, 249, 5}
-    },
-    { {80, 87, 235, 180, 4},
-      {120, 206, 206, 160, 6},
-      {34, 221, 126, 160, 10},
-      {96, 87, 55, 49, 14}
-    },
-    { {234, 122, 109, 152, 13},
-      {119, 37, 237, 131, 14},
-      {177, 155, 101, 229, 7},
-      {124, 27, 122, 78, 14}
-    },
-    { {81, 124, 23, 242, 2},
-      {81, 93, 130, 248, 11},
-      {68, 254, 131, 232, 10},
-      {209, 244, 27, 168, 10}
-    },
-    { {116, 206, 76, 238, 0},
-      {168, 45, 62, 168, 11},
-      {7, 115, 39, 50, 14},
-      {209, 87, 203, 65, 5}
-    },
-    { {235, 112, 71, 178, 6},
-      {115, 85, 226, 195, 3},
-      {100, 222, 32, 237, 7},
-      {204, 52, 122, 172, 14}
-    },
-    { {44, 21, 121, 54, 0},
-      {250, 2, 166, 48, 5},
-      {6, 201, 234, 131, 4},
-      {160, 198, 84, 5, 15}
-    },
-    { {10, 102, 96, 115, 1},
-      {39, 4, 138, 45, 5},
-      {140, 224, 102, 101, 0},
-      {171, 69, 18, 14, 4}
-    },
-    { {15, 250, 22, 84, 3},
-      {207, 85, 152, 89, 8},
-      {194, 166, 133, 255, 0},
-      {25, 161, 154, 175, 3}
-    },
-    { {248, 13, 152, 242, 6},
-      {2, 154, 230, 186, 11},
-      {100, 241, 155, 1, 15},
-      {213, 214, 117, 148, 0}
-    },
-    { {17, 81, 213, 137, 2},
-      {112, 191, 0, 84, 2},
-      {73, 26, 184, 168, 8},
-      {66, 160, 15, 208, 14}
-    },
-    { {90, 127, 72, 72, 2},
-      {99, 62, 12, 169, 8},
-      {65, 33, 47, 229, 10},
-      {25, 83, 7, 204, 6}
-    },
-    { {220, 246, 137, 159, 6},
-      {219, 188, 220, 166, 3},
-      {111, 153, 22, 243, 11},
-      {198, 83, 179, 221, 11}
-    },
-    { {142, 116, 239, 41, 6},
-      {243, 245, 70, 39, 4},
-      {105, 79, 114, 231, 1},
-      {46, 70, 42, 252, 15}
-    },
-    { {122, 205, 165, 235, 5},
-      {22, 175, 114, 173, 15},
-      {173, 122, 91, 53, 14},
-      {251, 84, 239, 86, 8}
-    },
-    { {73, 74, 158, 70, 15},
-      {14, 213, 77, 216, 9},
-      {246, 39, 149, 41, 2},
-      {145, 187, 42, 183, 0}
-    },
-    { {92, 188, 59, 49, 3},
-      {215, 88, 150, 180, 12},
-      {200, 205, 195, 211, 10},
-      {50, 214, 145, 174, 11}
-    },
-    { {24, 172, 214, 61, 15},
-      {47, 249, 211, 52, 8},
-      {251, 198, 179, 81, 8},
-      {18, 204, 185, 255, 4}
-    },
-    { {128, 152, 198, 222, 6},
-      {104, 241, 208, 10, 11},
-      {103, 182, 49, 144, 1},
-      {213, 0, 184, 241, 6}
-    },
-    { {171, 158, 93, 173, 10},
-      {122, 49, 63, 119, 10},
-      {91, 91, 167, 157, 5},
-      {94, 239, 200, 197, 14}
-    },
-    { {187, 215, 181, 242, 15},
-      {86, 159, 251, 123, 7},
-      {244, 250, 222, 189, 13},
-      {237, 237, 255, 150, 10}
-    },
-    { {231, 64, 19, 227, 5},
-      {148, 68, 98, 223, 3},
-      {172, 124, 128, 46, 7},
-      {207, 180, 98, 34, 9}
-    },
-    { {185, 180, 142, 161, 12},
-      {67, 201, 119, 102, 2},
-      {56, 87, 18, 217, 13},
-      {70, 110, 233, 60, 2}
-    },
-    { {45, 174, 203, 210, 6},
-      {179, 208, 252, 104, 11},
-      {100, 189, 55, 91, 4},
-      {209, 99, 240, 188, 13}
-    },
-    { {14, 251, 136, 89, 3},
-      {199, 182, 156, 13, 8},
-      {201, 161, 29, 247, 0},
-      {27, 3, 150, 222, 3}
-    },
-    { {140, 253, 170, 193, 1},
-      {199, 198, 20, 46, 14},
-      {136, 53, 91, 243, 1},
-      {119, 66, 134, 62, 3}
-    },
-    { {80, 221, 255, 96, 6},
-      {112, 223, 86, 184, 12},
-      {96, 111, 251, 176, 10},
-      {49, 214, 175, 176, 14}
-    },
-    { {171, 67, 201, 91, 13},
-      {54, 166, 237, 79, 1},
-      {189, 169, 60, 45, 5},
-      {143, 43, 118, 86, 12}
-    },
-    { {80, 242, 159, 163, 14},
-      {81, 221, 95, 148, 3},
-      {124, 95, 148, 240, 10},
-      {194, 159, 171, 184, 10}
-    },
-    { {128, 166, 71, 246, 14},
-      {57, 81, 219, 42, 3},
-      {118, 254, 38, 80, 1},
-      {197, 77, 184, 169, 12}
-    },
-    { {60, 168, 157, 27, 10},
-      {147, 185, 181, 20, 9},
-      {93, 139, 145, 83, 12},
-      {146, 138, 217, 220, 9}
-    },
-    { {24, 77, 221, 97, 1},
-      {54, 143, 6, 60, 8},
-      {136, 107, 187, 33, 8},
-      {19, 198, 15, 22, 12}
-    },
-    { {83, 127, 71, 115, 5},
-      {117, 79, 202, 237, 9},
-      {172, 238, 47, 236, 10},
-      {155, 117, 63, 42, 14}
-    },
-    { {164, 149, 152, 181, 4},
-      {200, 130, 246, 54, 2},
-      {42, 209, 154, 146, 5},
-      {70, 198, 244, 17, 3}
-    },
-    { {58, 161, 233, 220, 1},
-      {63, 170, 180, 9, 6},
-      {131, 185, 120, 85, 12},
-      {105, 2, 213, 95, 12}
-    },
-    { {72, 193, 6, 108, 11},
-      {14, 119, 19, 136, 0},
-      {211, 102, 8, 49, 2},
-      {1, 28, 142, 231, 0}
-    },
-    { {227, 219, 6, 53, 1},
-      {76, 71, 186, 199, 8},
-      {138, 198, 13, 188, 7},
-      {30, 53, 222, 35, 2}
-    },
-    { {26, 241, 58, 17, 0},
-      {67, 78, 148, 21, 4},
-      {8, 133, 200, 245, 8},
-      {42, 130, 151, 44, 2}
-    },
-    { {137, 31, 189, 213, 1},
-      {94, 131, 140, 126, 14},
-      {138, 187, 223, 137, 1},
-      {119, 227, 28, 23, 10}
-    },
-    { {142, 68, 6, 133, 7},
-      {142, 85, 64, 39, 2},
-      {234, 22, 2, 39, 1},
-      {78, 64, 42, 167, 1}
-    },
-    { {135, 127, 42, 107, 5},
-      {197, 102, 78, 111, 13},
-      {173, 101, 79, 238, 1},
-      {191, 103, 38, 106, 3}
-    },
-    { {122, 152, 134, 35, 6},
-      {66, 217, 114, 133, 9},
-      {108, 70, 17, 149, 14},
-      {154, 20, 233, 180, 2}
-    },
-    { {228, 197, 141, 119, 10},
-      {152, 151, 183, 174, 1},
-      {94, 235, 26, 50, 7},
-      {135, 94, 222, 145, 9}
-    },
-    { {70, 156, 46, 177, 8},
-      {192, 65, 151, 165, 14},
-      {24, 215, 67, 150, 2},
-      {122, 94, 152, 32, 3}
-    },
-    { {165, 170, 62, 63, 8},
-      {137, 97, 191, 86, 13},
-      {31, 199, 197, 90, 5},
-      {182, 175, 216, 105, 1}
-    },
-    { {14, 105, 46, 93, 5},
-      {143, 103, 196, 13, 12},
-      {171, 167, 73, 103, 0},
-      {59, 2, 62, 111, 1}
-    },
-    { {6, 57, 165, 147, 9},
-      {213, 131, 129, 5, 15},
-      {156, 154, 89, 198, 0},
-      {250, 8, 28, 26, 11}
-    },
-    { {96, 63, 93, 167, 6},
-      {121, 19, 110, 180, 11},
-      {110, 91, 175, 192, 6},
-      {210, 215, 108, 137, 14}
-    },
-    { {72, 219, 238, 150, 9},
-      {110, 199, 157, 128, 15},
-      {150, 151, 125, 177, 2},
-      {240, 27, 158, 55, 6}
-    },
-    { {95, 215, 109, 233, 5},
-      {246, 47, 94, 237, 6},
-      {169, 123, 110, 191, 10},
-      {107, 119, 175, 70, 15}
-    },
-    { {101, 185, 180, 188, 6},
-      {201, 179, 242, 208, 14},
-      {99, 210, 217, 218, 6},
-      {112, 180, 252, 217, 3}
-    },
-    { {6, 179, 0, 213, 15},
-      {205, 18, 217, 13, 2},
-      {250, 176, 12, 214, 0},
-      {75, 9, 180, 139, 3}
-    },
-    { {76, 98, 251, 222, 11},
-      {191, 244, 141, 152, 7},
-      {215, 189, 244, 99, 2},
-      {225, 155, 18, 255, 13}
-    },
-    { {154, 177, 225, 193, 15},
-      {119, 154, 81, 15, 6},
-      {248, 56, 120, 213, 9},
-      {111, 8, 165, 158, 14}
-    },
-    { {116, 98, 52, 56, 13},
-      {133, 45, 235, 144, 4},
-      {177, 194, 196, 98, 14},
-      {32, 157, 123, 74, 1}
-    },
-    { {229, 34, 138, 114, 8},
-      {129, 192, 175, 202, 1},
-      {20, 229, 20, 74, 7},
-      {133, 63, 80, 56, 1}
-    },
-    { {20, 217, 9, 82, 15},
-      {212, 30, 213, 8, 9},
-      {244, 169, 9, 178, 8},
-      {145, 10, 183, 130, 11}
-    },
-    { {218, 24, 89, 233, 7},
-      {118, 56, 70, 159, 10},
-      {233, 121, 161, 133, 11},
-      {95, 150, 33, 198, 14}
-    },
-    { {38, 80, 144, 16, 9},
-      {196, 132, 161, 17, 0},
-      {144, 128, 144, 166, 4},
-      {8, 136, 82, 18, 3}
-    },
-    { {25, 235, 51, 121, 9},
-      {23, 110, 155, 92, 12},
-      {153, 236, 205, 121, 8},
-      {51, 173, 151, 110, 8}
-    },
-    { {105, 80, 30, 18, 12},
-      {66, 69, 229, 208, 1},
-      {52, 135, 128, 169, 6},
-      {128, 186, 122, 36, 2}
-    },
-    { {150, 139, 94, 59, 15},
-      {164, 123, 223, 23, 9},
-      {253, 199, 173, 22, 9},
-      {158, 143, 189, 226, 5}
-    },
-    { {218, 116, 48, 6, 5},
-      {79, 12, 64, 179, 5},
-      {166, 0, 194, 229, 11},
-      {172, 208, 35, 15, 2}
-    },
-    { {25, 179, 22, 144, 13},
-      {71, 75, 217, 80, 2},
-      {176, 150, 140, 217, 8},
-      {64, 169, 189, 46, 2}
-    },
-    { {25, 3, 122, 37, 8},
-      {42, 74, 15, 84, 4},
-      {26, 69, 236, 9, 8},
-      {34, 175, 5, 37, 4}
-    },
-    { {45, 131, 24, 137, 9},
-      {134, 34, 61, 84, 2},
-      {153, 17, 140, 27, 4},
-      {66, 171, 196, 70, 1}
-    },
-    { {90, 179, 165, 245, 1},
-      {95, 139, 154, 141, 6},
-      {138, 250, 92, 213, 10},
-      {107, 21, 157, 31, 10}
-    },
-    { {122, 166, 126, 219, 8},
-      {35, 105, 189, 189, 7},
-      {29, 183, 230, 85, 14},
-      {235, 219, 217, 108, 4}
-    },
-    { {74, 39, 236, 111, 9},
-      {47, 163, 15, 173, 5},
-      {159, 99, 126, 69, 2},
-      {171, 95, 12, 95, 4}
-    },
-    { {199, 32, 161, 106, 9},
-      {149, 160, 3, 203, 5},
-      {149, 104, 80, 78, 3},
-      {173, 60, 0, 90, 9}
-    },
-    { {70, 101, 77, 162, 0},
-      {177, 7, 6, 161, 3},
-      {4, 91, 42, 102, 2},
-      {200, 86, 14, 8, 13}
-    },
-    { {69, 170, 40, 84, 15},
-      {141, 16, 221, 200, 12},
-      {242, 161, 69, 90, 2},
-      {49, 59, 176, 139, 1}
-    },
-    { {174, 121, 83, 131, 6},
-      {243, 86, 96, 23, 11},
-      {108, 28, 169, 231, 5},
-      {222, 128, 102, 172, 15}
-    },
-    { {156, 98, 82, 80, 12},
-      {163, 76, 201, 26, 0},
-      {48, 164, 164, 99, 9},
-      {5, 137, 51, 44, 5}
-    },
-    { {12, 88, 52, 54, 3},
-      {206, 21, 130, 16, 13},
-      {198, 194, 193, 163, 0},
-      {176, 132, 26, 135, 3}
-    },
-    { {74, 45, 0, 174, 1},
-      {15, 34, 2, 161, 11},
-      {135, 80, 11, 69, 2},
-      {216, 84, 4, 79, 0}
-    },
-    { {116, 221, 28, 199, 10},
-      {200, 31, 53, 188, 11},
-      {94, 51, 139, 178, 14},
-      {211, 218, 207, 129, 3}
-    },
-    { {255, 184, 139, 185, 11},
-      {215, 248, 183, 199, 10},
-      {217, 221, 17, 223, 15},
-      {94, 62, 209, 254, 11}
-    },
-    { {72, 11, 173, 35, 1},
-      {22, 131, 14, 132, 13},
-      {140, 75, 93, 1, 2},
-      {178, 23, 12, 22, 8}
-    },
-    { {7, 41, 136, 152, 1},
-      {133, 162, 132, 65, 10},
-      {129, 145, 25, 78, 0},
-      {88, 34, 20, 90, 1}
-    },
-    { {230, 29, 184, 139, 11},
-      {196, 178, 37, 183, 15},
-      {221, 17, 219, 134, 7},
-      {254, 218, 68, 210, 3}
-    },
-    { {115, 138, 131, 230, 3},
-      {28, 216, 58, 201, 11},
-      {198, 124, 21, 28, 14},
-      {217, 53, 193, 179, 8}
-    },
-    { {39, 0, 88, 211, 10},
-      {160, 16, 165, 93, 3},
-      {92, 177, 160, 14, 4},
-      {203, 170, 80, 128, 5}
-    },
-    { {99, 133, 237, 25, 0},
-      {48, 163, 180, 229, 4},
-      {9, 139, 122, 28, 6},
-      {42, 114, 220, 80, 12}
-    },
-    { {43, 58, 207, 150, 12},
-      {123, 193, 237, 65, 11},
-      {54, 159, 53, 205, 4},
-      {216, 43, 120, 61, 14}
-    },
-    { {219, 208, 152, 69, 3},
-      {78, 156, 20, 223, 0},
-      {202, 33, 144, 189, 11},
-      {15, 178, 131, 151, 2}
-    },
-    { {157, 205, 210, 135, 6},
-      {170, 222, 80, 118, 11},
-      {110, 20, 187, 59, 9},
-      {214, 224, 167, 181, 5}
-    },
-    { {49, 244, 150, 171, 1},
-      {69, 237, 50, 116, 3},
-      {141, 86, 146, 248, 12},
-      {194, 228, 203, 122, 2}
-    },
-    { {31, 47, 77, 37, 3},
-      {191, 27, 14, 101, 8},
-      {202, 75, 47, 79, 8},
-      {26, 103, 13, 143, 13}
-    },
-    { {238, 22, 15, 225, 14},
-      {210, 81, 111, 175, 2},
-      {120, 127, 6, 135, 7},
-      {79, 95, 104, 164, 11}
-    },
-    { {10, 161, 221, 53, 1},
-      {63, 131, 150, 21, 0},
-      {138, 203, 184, 85, 0},
-      {10, 134, 156, 31, 12}
-    },
-    { {86, 173, 47, 172, 10},
-      {153, 123, 23, 161, 14},
-      {83, 95, 75, 86, 10},
-      {120, 94, 141, 233, 9}
-    },
-    { {211, 126, 245, 50, 15},
-      {117, 157, 203, 243, 13},
-      {244, 202, 247, 236, 11},
-      {188, 253, 59, 154, 14}
-    },
-    { {26, 77, 168, 98, 11},
-      {6, 158, 7, 41, 13},
-      {212, 97, 91, 37, 8},
-      {185, 78, 7, 150, 0}
-    },
-    { {14, 14, 83, 226, 12},
-      {178, 64, 75, 57, 11},
-      {52, 124, 167, 7, 0},
-      {217, 205, 32, 36, 13}
-    },
-    { {186, 19, 25, 227, 12},
-      {82, 10, 111, 31, 3},
-      {60, 121, 140, 133, 13},
-      {207, 143, 101, 4, 10}
-    },
-    { {166, 38, 10, 6, 2},
-      {137, 80, 44, 35, 1},
-      {70, 5, 6, 70, 5},
-      {140, 67, 64, 169, 1}
-    },
-    { {59, 165, 11, 14, 1},
-      {31, 106, 52, 97, 1},
-      {135, 13, 10, 93, 12},
-      {136, 98, 197, 111, 8}
-    },
-    { {38, 36, 208, 138, 6},
-      {161, 176, 96, 49, 3},
-      {101, 16, 178, 70, 4},
-      {200, 192, 96, 216, 5}
-    },
-    { {34, 170, 93, 184, 11},
-      {53, 49, 191, 17, 10},
-      {209, 219, 165, 84, 4},
-      {88, 143, 216, 202, 12}
-    },
-    { {204, 89, 30, 234, 11},
-      {198, 119, 7, 154, 11},
-      {213, 119, 137, 163, 3},
-      {213, 158, 14, 230, 3}
-    },
-    { {93, 163, 232, 36, 7},
-      {175, 154, 94, 192, 4},
-      {226, 65, 124, 91, 10},
-      {32, 55, 165, 159, 5}
-    },
-    { {49, 70, 31, 250, 13},
-      {20, 109, 239, 120, 3},
-      {181, 255, 134, 40, 12},
-      {193, 239, 123, 98, 8}
-    },
-    { {225, 228, 77, 220, 5},
-      {61, 37, 244, 234, 2},
-      {163, 187, 34, 120, 7},
-      {69, 114, 250, 75, 12}
-    },
-    { {44, 242, 109, 104, 5},
-      {247, 37, 126, 8, 4},
-      {161, 107, 100, 243, 4},
-      {33, 7, 234, 78, 15}
-    },
-    { {188, 184, 23, 132, 2},
-      {219, 89, 48, 18, 10},
-      {66, 30, 129, 211, 13},
-      {84, 128, 201, 173, 11}
-    },
-    { {229, 105, 162, 218, 12},
-      {129, 230, 225, 202, 15},
-      {53, 180, 89, 106, 7},
-      {245, 56, 118, 120, 1}
-    },
-    { {126, 187, 69, 235, 1},
-      {247, 43, 58, 141, 11},
-      {141, 122, 45, 215, 14},
-      {219, 21, 205, 78, 15}
-    },
-    { {95, 193, 180, 208, 10},
-      {130, 159, 145, 217, 6},
-      {80, 178, 216, 63, 10},
-      {105, 184, 159, 148, 1}
-    },
-    { {67, 231, 225, 87, 9},
-      {61, 134, 153, 237, 5},
-      {158, 168, 126, 124, 2},
-      {171, 121, 150, 27, 12}
-    },
-    { {74, 231, 170, 10, 11},
-      {7, 246, 29, 161, 5},
-      {213, 5, 94, 117, 2},
-      {168, 91, 134, 254, 0}
-    },
-    { {165, 185, 85, 105, 15},
-      {245, 51, 115, 94, 8},
-      {249, 106, 169, 218, 5},
-      {23, 172, 236, 202, 15}
-    },
-    { {224, 84, 118, 144, 13},
-      {100, 69, 225, 178, 6},
-      {176, 150, 226, 160, 7},
-      {100, 216, 122, 34, 6}
-    },
-    { {210, 45, 14, 153, 2},
-      {1, 123, 132, 167, 10},
-      {73, 151, 11, 68, 11},
-      {94, 82, 29, 232, 0}
-    },
-    { {24, 168, 223, 230, 1},
-      {63, 201, 22, 24, 11},
-      {134, 127, 177, 81, 8},
-      {209, 134, 137, 63, 12}
-    },
-    { {69, 219, 175, 11, 10},
-      {208, 247, 29, 196, 13},
-      {93, 15, 93, 186, 2},
-      {178, 59, 142, 240, 11}
-    },
-    { {120, 139, 137, 141, 8},
-      {26, 170, 61, 132, 10},
-      {27, 25, 29, 17, 14},
-      {82, 27, 197, 85, 8}
-    },
-    { {241, 221, 156, 23, 1},
-      {76, 143, 180, 246, 9},
-      {142, 131, 155, 184, 15},
-      {150, 242, 223, 19, 2}
-    },
-    { {168, 83, 82, 179, 8},
-      {98, 70, 171, 22, 3},
-      {28, 212, 172, 161, 5},
-      {198, 141, 86, 36, 6}
-    },
-    { {168, 106, 55, 142, 9},
-      {31, 101, 41, 18, 15},
-      {151, 30, 197, 97, 5},
-      {244, 137, 74, 111, 8}
-    },
-    { {189, 126, 84, 235, 14},
-      {227, 61, 107, 126, 11},
-      {125, 114, 167, 235, 13},
-      {215, 237, 107, 204, 7}
-    },
-    { {223, 220, 164, 141, 1},
-      {206, 173, 16, 231, 14},
-      {139, 18, 83, 191, 11},
-      {126, 112, 139, 87, 3}
-    },
-    { {164, 184, 123, 136, 7},
-      {245, 112, 116, 18, 14},
-      {225, 29, 225, 210, 5},
-      {116, 130, 224, 234, 15}
-    },
-    { {156, 22, 106, 229, 0},
-      {234, 72, 14, 46, 6},
-      {10, 117, 102, 131, 9},
-      {103, 71, 1, 37, 7}
-    },
-    { {7, 66, 172, 242, 15},
-      {132, 149, 207, 73, 7},
-      {244, 243, 84, 46, 0},
-      {233, 47, 58, 146, 1}
-    },
-    { {76, 120, 158, 87, 8},
-      {203, 197, 133, 156, 9},
-      {30, 167, 145, 227, 2},
-      {147, 154, 26, 61, 3}
-    },
-    { {154, 239, 33, 84, 12},
-      {27, 14, 217, 43, 12},
-      {50, 168, 79, 117, 9},
-      {61, 73, 183, 13, 8}
-    },
-    { {114, 33, 143, 98, 6},
-      {17, 219, 102, 137, 1},
-      {100, 111, 24, 68, 14},
-      {137, 22, 109, 184, 8}
-    },
-    { {144, 22, 79, 84, 2},
-      {120, 89, 140, 42, 0},
-      {66, 175, 38, 128, 9},
-      {5, 67, 25, 161, 14}
-    },
-    { {255, 38, 45, 47, 8},
-      {155, 41, 47, 231, 5},
-      {31, 75, 70, 79, 15},
-      {174, 127, 73, 77, 9}
-    },
-    { {155, 75, 33, 101, 11},
-      {30, 30, 11, 79, 12},
-      {218, 104, 77, 45, 9},
-      {63, 45, 7, 135, 8}
-    },
-    { {157, 250, 242, 161, 11},
-      {231, 220, 27, 86, 14},
-      {216, 84, 245, 251, 9},
-      {118, 173, 131, 190, 7}
-    },
-    { {88, 151, 203, 43, 2},
-      {114, 250, 30, 164, 1},
-      {77, 77, 62, 145, 10},
-      {130, 87, 133, 244, 14}
-    },
-    { {71, 47, 124, 245, 10},
-      {169, 19, 143, 253, 14},
-      {90, 243, 239, 78, 2},
-      {123, 255, 28, 137, 5}
-    },
-    { {231, 58, 247, 133, 1},
-      {253, 193, 40, 215, 14},
-      {138, 30, 245, 206, 7},
-      {126, 177, 72, 59, 15}
-    },
-    { {207, 215, 242, 172, 4},
-      {234, 230, 90, 243, 6},
-      {35, 84, 254, 191, 3},
-      {108, 245, 166, 117, 7}
-    },
-    { {34, 145, 90, 60, 13},
-      {108, 98, 247, 17, 0},
-      {179, 197, 168, 148, 4},
-      {8, 142, 244, 99, 6}
-    },
-    { {34, 133, 70, 209, 9},
-      {36, 67, 177, 45, 2},
-      {152, 182, 42, 20, 4},
-      {75, 72, 220, 34, 4}
-    },
-    { {114, 208, 93, 189, 9},
-      {124, 45, 183, 149, 2},
-      {155, 219, 160, 180, 14},
-      {74, 158, 219, 67, 14}
-    },
-    { {66, 217, 149, 82, 0},
-      {80, 135, 144, 153, 9},
-      {4, 170, 153, 180, 2},
-      {153, 144, 158, 16, 10}
-    },
-    { {138, 133, 121, 144, 1},
-      {54, 2, 148, 51, 6},
-      {128, 153, 234, 21, 1},
-      {108, 194, 148, 6, 12}
-    },
-    { {197, 198, 42, 24, 4},
-      {128, 100, 220, 226, 4},
-      {33, 133, 70, 58, 3},
-      {36, 115, 178, 96, 1}
-    },
-    { {233, 151, 88, 80, 13},
-      {102, 2, 253, 250, 0},
-      {176, 161, 174, 153, 7},
-      {5, 251, 244, 6, 6}
-    },
-    { {14, 234, 177, 70, 7},
-      {159, 148, 88, 25, 13},
-      {230, 40, 213, 119, 0},
-      {185, 129, 162, 159, 9}
-    },
-    { {145, 53, 173, 2, 13},
-      {85, 139, 69, 98, 5},
-      {180, 11, 90, 200, 9},
-      {164, 106, 45, 26, 10}
-    },
-    { {190, 141, 200, 78, 4},
-      {170, 170, 116, 43, 9},
-      {39, 33, 59, 23, 13},
-      {157, 66, 229, 85, 5}
-    },
-    { {173, 173, 184, 75, 2},
-      {131, 178, 52, 126, 13},
-      {77, 33, 219, 91, 5},
-      {183, 226, 196, 220, 1}
-    },
-    { {239, 18, 224, 176, 8},
-      {226, 128, 171, 195, 6},
-      {16, 208, 116, 143, 7},
-      {108, 61, 80, 20, 7}
-    },
-    { {110, 30, 54, 228, 4},
-      {202, 65, 106, 185, 14},
-      {34, 118, 199, 135, 6},
-      {121, 213, 104, 37, 3}
-    },
-    { {182, 167, 125, 25, 13},
-      {181, 43, 253, 55, 4},
-      {185, 139, 238, 86, 13},
-      {46, 203, 253, 74, 13}
-    },
-    { {23, 86, 83, 139, 13},
-      {244, 108, 73, 117, 3},
-      {189, 28, 166, 174, 8},
-      {202, 233, 35, 98, 15}
-    },
-    { {95, 18, 213, 36, 1},
-      {254, 137, 10, 209, 0},
-      {130, 74, 180, 143, 10},
-      {8, 181, 9, 23, 15}
-    },
-    { {70, 117, 172, 246, 3},
-      {205, 151, 134, 169, 7},
-      {198, 243, 90, 230, 2},
-      {233, 86, 30, 155, 3}
-    },
-    { {60, 106, 94, 42, 12},
-      {163, 109, 111, 16, 9},
-      {53, 71, 165, 99, 12},
-      {144, 143, 107, 108, 5}
-    },
-    { {36, 27, 3, 248, 15},
-      {212, 114, 235, 8, 10},
-      {241, 252, 13, 130, 4},
-      {81, 13, 116, 226, 11}
-    },
-    { {174, 183, 170, 241, 10},
-      {195, 210, 191, 47, 6},
-      {88, 245, 94, 215, 5},
-      {111, 79, 212, 188, 3}
-    },
-    { {128, 123, 11, 149, 5},
-      {93, 70, 204, 6, 10},
-      {170, 157, 13, 224, 1},
-      {86, 3, 54, 43, 10}
-    },
-    { {6, 123, 185, 142, 2},
-      {217, 182, 12, 17, 15},
-      {71, 25, 221, 230, 0},
-      {248, 131, 6, 217, 11}
-    },
-    { {187, 205, 97, 202, 11},
-      {54, 62, 49, 107, 15},
-      {213, 56, 107, 61, 13},
-      {253, 104, 199, 198, 12}
-    },
-    { {102, 111, 155, 27, 2},
-      {145, 246, 172, 181, 9},
-      {77, 141, 159, 102, 6},
-      {154, 211, 86, 248, 9}
-    },
-    { {220, 128, 108, 119, 5},
-      {174, 9, 214, 142, 5},
-      {174, 227, 96, 19, 11},
-      {167, 22, 185, 7, 5}
-    },
-    { {244, 76, 119, 37, 13},
-      {188, 77, 99, 182, 12},
-      {186, 78, 227, 34, 15},
-      {54, 220, 107, 35, 13}
-    },
-    { {114, 219, 75, 25, 1},
-      {116, 110, 188, 133, 8},
-      {137, 141, 45, 180, 14},
-      {26, 19, 215, 98, 14}
-    },
-    { {16, 18, 108, 127, 9},
-      {108, 41, 143, 12, 5},
-      {159, 227, 100, 128, 8},
-      {163, 15, 25, 67, 6}
-    },
-    { {162, 1, 124, 141, 13},
-      {44, 35, 101, 23, 6},
-      {187, 19, 232, 4, 5},
-      {110, 138, 108, 67, 4}
-    },
-    { {92, 43, 98, 199, 13},
-      {175, 74, 73, 140, 15},
-      {190, 52, 109, 67, 10},
-      {243, 25, 37, 47, 5}
-    },
-    { {246, 17, 249, 50, 13},
-      {244, 138, 231, 147, 5},
-      {180, 201, 248, 134, 15},
-      {172, 158, 117, 18, 15}
-    },
-    { {29, 202, 246, 89, 3},
-      {166, 253, 152, 92, 12},
-      {201, 166, 245, 59, 8},
-      {51, 161, 155, 246, 5}
-    },
-    { {246, 222, 90, 183, 0},
-      {232, 76, 190, 183, 11},
-      {14, 213, 167, 182, 15},
-      {222, 215, 211, 33, 7}
-    },
-    { {2, 227, 95, 133, 4},
-      {57, 71, 92, 21, 2},
-      {42, 31, 172, 116, 0},
-      {74, 131, 174, 41, 12}
-    },
-    { {154, 82, 200, 49, 13},
-      {102, 140, 207, 7, 0},
-      {184, 193, 52, 165, 9},
-      {14, 15, 51, 22, 6}
-    },
-    { {201, 156, 238, 248, 13},
-      {102, 225, 215, 234, 14},
-      {177, 247, 115, 153, 3},
-      {117, 126, 184, 118, 6}
-    },
-    { {164, 0, 185, 178, 3},
-      {148, 144, 166, 18, 7},
-      {196, 217, 208, 2, 5},
-      {228, 134, 80, 146, 9}
-    },
-    { {83, 189, 160, 149, 3},
-      {77, 154, 144, 229, 14},
-      {202, 144, 91, 220, 10},
-      {122, 112, 149, 155, 2}
-    },
-    { {229, 156, 80, 168, 12},
-      {224, 32, 115, 242, 10},
-      {49, 80, 163, 154, 7},
-      {84, 252, 224, 64, 7}
-    },
-    { {171, 95, 148, 193, 7},
-      {70, 151, 104, 127, 10},
-      {232, 50, 159, 173, 5},
-      {95, 225, 110, 150, 2}
-    },
-    { {154, 1, 159, 43, 13},
-      {22, 235, 71, 23, 1},
-      {189, 79, 152, 5, 9},
-      {142, 142, 45, 118, 8}
-    },
-    { {179, 111, 58, 61, 12},
-      {9, 110, 239, 119, 12},
-      {59, 197, 207, 108, 13},
-      {62, 239, 119, 105, 0}
-    },
-    { {192, 187, 244, 25, 3},
-      {101, 179, 152, 150, 12},
-      {201, 130, 253, 208, 3},
-      {54, 145, 156, 218, 6}
-    },
-    { {20, 123, 78, 197, 0},
-      {233, 79, 12, 12, 10},
-      {10, 55, 45, 226, 8},
-      {83, 3, 15, 41, 7}
-    },
-    { {90, 199, 71, 252, 14},
-      {58, 127, 219, 169, 2},
-      {115, 254, 46, 53, 10},
-      {73, 93, 191, 229, 12}
-    },
-    { {55, 33, 111, 157, 0},
-      {185, 107, 164, 69, 6},
-      {11, 159, 104, 78, 12},
-      {106, 34, 93, 105, 13}
-    },
-    { {1, 111, 252, 42, 3},
-      {37, 183, 14, 112, 13},
-      {197, 67, 255, 104, 0},
-      {176, 231, 14, 218, 4}
-    },
-    { {89, 15, 175, 61, 8},
-      {26, 235, 143, 228, 12},
-      {27, 207, 95, 9, 10},
-      {50, 127, 29, 117, 8}
-    },
-    { {153, 1, 84, 216, 10},
-      {34, 59, 129, 90, 2},
-      {81, 178, 168, 9, 9},
-      {69, 168, 29, 196, 4}
-    },
-    { {67, 238, 76, 167, 7},
-      {45, 21, 94, 229, 11},
-      {238, 83, 39, 124, 2},
-      {218, 119, 170, 139, 4}
-    },
-    { {54, 90, 193, 205, 0},
-      {248, 172, 40, 13, 10},
-      {11, 56, 53, 166, 12},
-      {91, 1, 67, 81, 15}
-    },
-    { {131, 166, 230, 183, 5},
-      {45, 193, 218, 103, 7},
-      {174, 214, 118, 92, 1},
-      {238, 101, 184, 59, 4}
-    },
-    { {19, 38, 191, 52, 9},
-      {29, 201, 143, 113, 4},
-      {146, 207, 214, 76, 8},
-      {40, 239, 25, 59, 8}
-    },
-    { {75, 112, 99, 4, 11},
-      {127, 84, 1, 193, 4},
-      {210, 12, 96, 237, 2},
-      {40, 56, 2, 175, 14}
-    },
-    { {138, 249, 189, 185, 10},
-      {83, 183, 151, 23, 14},
-      {89, 219, 217, 245, 1},
-      {126, 142, 158, 220, 10}
-    },
-    { {210, 150, 211, 86, 13},
-      {124, 200, 217, 187, 1},
-      {182, 172, 182, 148, 11},
-      {141, 217, 177, 51, 14}
-    },
-    { {191, 171, 59, 228, 2},
-      {155, 90, 62, 91, 14},
-      {66, 125, 205, 95, 13},
-      {125, 167, 197, 173, 9}
-    },
-    { {174, 86, 204, 98, 6},
-      {226, 149, 110, 43, 1},
-      {100, 99, 54, 167, 5},
-      {141, 71, 106, 148, 7}
-    },
-    { {178, 87, 177, 0, 1},
-      {84, 142, 40, 51, 4},
-      {128, 8, 222, 164, 13},
-      {44, 193, 71, 18, 10}
-    },
-    { {62, 59, 212, 245, 0},
-      {235, 139, 170, 29, 10},
-      {10, 242, 189, 199, 12},
-      {91, 133, 93, 29, 7}
-    },
-    { {81, 226, 98, 81, 13},
-      {37, 76, 217, 204, 4},
-      {184, 164, 100, 120, 10},
-      {35, 57, 179, 42, 4}
-    },
-    { {109, 172, 163, 64, 13},
-      {151, 192, 113, 232, 12},
-      {176, 44, 83, 91, 6},
-      {49, 120, 224, 62, 9}
-    },
-    { {140, 97, 186, 38, 3},
-      {143, 214, 6, 18, 5},
-      {198, 69, 216, 99, 1},
-      {164, 134, 6, 191, 1}
-    },
-    { {188, 245, 45, 34, 0},
-      {211, 15, 54, 34, 5},
-      {4, 75, 74, 243, 13},
-      {164, 70, 207, 12, 11}
-    },
-    { {211, 103, 251, 121, 3},
-      {53, 254, 142, 255, 4},
-      {201, 237, 254, 108, 11},
-      {47, 247, 23, 250, 12}
-    },
-    { {84, 87, 19, 84, 12},
-      {216, 78, 201, 184, 0},
-      {50, 172, 142, 162, 10},
-      {1, 217, 55, 33, 11}
-    },
-    { {252, 69, 102, 73, 14},
-      {162, 127, 97, 174, 4},
-      {121, 38, 106, 35, 15},
-      {39, 88, 111, 228, 5}
-    },
-    { {201, 116, 9, 180, 3},
-      {95, 20, 134, 226, 2},
-      {194, 217, 2, 233, 3},
-      {68, 118, 18, 143, 10}
-    },
-    { {219, 223, 58, 117, 6},
-      {74, 94, 222, 255, 12},
-      {106, 229, 207, 189, 11},
-      {63, 247, 183, 165, 2}
-    },
-    { {124, 198, 54, 99, 4},
-      {130, 77, 122, 188, 5},
-      {44, 102, 198, 51, 14},
-      {163, 213, 235, 36, 1}
-    },
-    { {199, 37, 21, 237, 7},
-      {157, 51, 66, 255, 2},
-      {235, 122, 138, 78, 3},
-      {79, 244, 44, 203, 9}
-    },
-    { {243, 129, 78, 141, 3},
-      {44, 123, 52, 199, 2},
-      {203, 23, 40, 28, 15},
-      {78, 50, 205, 227, 4}
-    },
-    { {1, 97, 236, 83, 14},
-      {33, 151, 197, 76, 5},
-      {124, 163, 120, 104, 0},
-      {163, 42, 62, 152, 4}
-    },
-    { {185, 10, 129, 53, 14},
-      {26, 152, 235, 70, 8},
-      {122, 200, 21, 9, 13},
-      {22, 45, 113, 149, 8}
-    },
-    { {206, 10, 5, 154, 5},
-      {150, 33, 200, 131, 11},
-      {165, 154, 5, 7, 3},
-      {220, 17, 56, 70, 9}
-    },
-    { {177, 143, 157, 57, 3},
-      {20, 187, 190, 118, 8},
-      {201, 203, 159, 24, 13},
-      {22, 231, 221, 210, 8}
-    },
-    { {148, 176, 8, 30, 13},
-      {205, 40, 213, 2, 1},
-      {183, 129, 0, 210, 9},
-      {132, 10, 177, 75, 3}
-    },
-    { {80, 66, 146, 213, 15},
-      {12, 220, 201, 156, 2},
-      {250, 180, 148, 32, 10},
-      {67, 153, 51, 179, 0}
-    },
-    { {35, 150, 114, 80, 11},
-      {100, 80, 185, 121, 4},
-      {208, 164, 230, 156, 4},
-      {41, 233, 208, 162, 6}
-    },
-    { {68, 239, 204, 54, 11},
-      {173, 151, 159, 160, 9},
-      {214, 195, 63, 114, 2},
-      {144, 95, 158, 155, 5}
-    },
-    { {31, 253, 132, 177, 6},
-      {195, 159, 210, 101, 10},
-      {104, 210, 27, 255, 8},
-      {90, 100, 191, 156, 3}
-    },
-    { {197, 49, 181, 191, 8},
-      {217, 163, 131, 214, 7},
-      {31, 218, 216, 202, 3},
-      {230, 188, 28, 89, 11}
-    },
-    { {22, 150, 178, 17, 4},
-      {192, 200, 216, 53, 4},
-      {40, 132, 214, 150, 8},
-      {42, 193, 177, 48, 3}
-    },
-    { {38, 79, 248, 144, 13},
-      {164, 134, 237, 49, 14},
-      {176, 145, 255, 38, 4},
-      {120, 203, 118, 18, 5}
-    },
-    { {246, 196, 223, 173, 7},
-      {188, 253, 118, 183, 2},
-      {235, 95, 178, 54, 15},
-      {78, 214, 235, 243, 13}
-    },
-    { {156, 24, 84, 188, 5},
-      {238, 41, 194, 18, 10},
-      {163, 210, 161, 131, 9},
-      {84, 132, 57, 71, 7}
-    },
-    { {19, 208, 219, 228, 10},
-      {120, 220, 23, 89, 2},
-      {82, 125, 176, 188, 8},
-      {73, 174, 131, 177, 14}
-    },
-    { {249, 179, 22, 59, 4},
-      {67, 107, 250, 214, 1},
-      {45, 198, 140, 217, 15},
-      {134, 181, 253, 108, 2}
-    },
-    { {81, 149, 114, 252, 7},
-      {108, 122, 210, 248, 6},
-      {227, 244, 234, 152, 10},
-      {97, 244, 181, 227, 6}
-    },
-    { {242, 39, 249, 70, 5},
-      {61, 138, 108, 187, 5},
-      {166, 41, 254, 68, 15},
-      {173, 211, 101, 27, 12}
-    },
-    { {102, 190, 189, 206, 13},
-      {221, 161, 125, 185, 15},
-      {183, 59, 215, 214, 6},
-      {249, 219, 232, 91, 11}
-    },
-    { {214, 222, 191, 213, 4},
-      {216, 205, 220, 191, 14},
-      {42, 191, 215, 182, 11},
-      {127, 211, 187, 49, 11}
-    },
-    { {42, 6, 160, 45, 8},
-      {10, 160, 43, 37, 4},
-      {27, 64, 86, 5, 4},
-      {42, 77, 64, 85, 0}
-    },
-    { {20, 53, 95, 118, 11},
-      {253, 91, 135, 56, 1},
-      {214, 239, 170, 194, 8},
-      {129, 206, 29, 171, 15}
-    },
-    { {10, 147, 60, 139, 0},
-      {66, 35, 28, 21, 7},
-      {13, 19, 204, 149, 0},
-      {234, 131, 140, 68, 2}
-    },
-    { {41, 181, 114, 31, 7},
-      {111, 114, 240, 116, 5},
-      {239, 132, 234, 217, 4},
-      {162, 224, 244, 239, 6}
-    },
-    { {10, 176, 119, 109, 10},
-      {123, 113, 19, 29, 4},
-      {91, 110, 224, 213, 0},
-      {43, 140, 136, 237, 14}
-    },
-    { {73, 99, 125, 47, 0},
-      {59, 39, 14, 212, 5},
-      {15, 75, 236, 105, 2},
-      {162, 183, 14, 77, 12}
-    },
-    { {129, 17, 157, 135, 11},
-      {92, 147, 5, 86, 3},
-      {222, 27, 152, 136, 1},
-      {198, 170, 12, 147, 10}
-    },
-    { {140, 179, 51, 58, 10},
-      {211, 114, 155, 18, 5},
-      {85, 204, 204, 211, 1},
-      {164, 141, 148, 236, 11}
-    },
-    { {178, 29, 155, 97, 0},
-      {80, 202, 38, 63, 8},
-      {8, 109, 155, 132, 13},
-      {31, 198, 69, 48, 10}
-    },
-    { {188, 118, 206, 213, 10},
-      {235, 221, 173, 46, 2},
-      {90, 183, 54, 227, 13},
-      {71, 75, 91, 189, 7}
-    },
-    { {160, 15, 75, 230, 8},
-      {56, 66, 47, 42, 11},
-      {22, 125, 47, 0, 5},
-      {213, 79, 68, 33, 12}
-    },
-    { {68, 168, 183, 24, 8},
-      {145, 225, 145, 144, 12},
-      {17, 142, 209, 82, 2},
-      {48, 152, 152, 120, 9}
-    },
-    { {192, 147, 189, 209, 12},
-      {80, 131, 221, 158, 6},
-      {56, 187, 220, 144, 3},
-      {103, 155, 188, 16, 10}
-    },
-    { {67, 88, 203, 57, 12},
-      {112, 228, 199, 197, 8},
-      {57, 205, 49, 172, 2},
-      {26, 62, 50, 112, 14}
-    },
-    { {138, 61, 137, 8, 12},
-      {83, 162, 69, 35, 8},
-      {49, 9, 27, 197, 1},
-      {28, 74, 36, 92, 10}
-    },
-    { {252, 190, 21, 102, 11},
-      {223, 25, 59, 186, 9},
-      {214, 106, 135, 211, 15},
-      {149, 221, 201, 143, 11}
-    },
-    { {203, 103, 181, 191, 5},
-      {31, 167, 202, 247, 7},
-      {175, 218, 222, 109, 3},
-      {238, 245, 62, 95, 8}
-    },
-    { {233, 7, 248, 189, 4},
-      {42, 162, 238, 246, 6},
-      {43, 209, 254, 9, 7},
-      {102, 247, 116, 85, 4}
-    },
-    { {75, 186, 42, 243, 10},
-      {67, 80, 159, 205, 15},
-      {92, 245, 69, 221, 2},
-      {251, 63, 144, 172, 2}
-    },
-    { {113, 234, 245, 7, 10},
-      {57, 157, 57, 212, 13},
-      {94, 10, 245, 120, 14},
-      {178, 185, 203, 153, 12}
-    },
-    { {147, 43, 182, 127, 6},
-      {9, 251, 202, 95, 13},
-      {111, 230, 221, 76, 9},
-      {191, 165, 61, 249, 0}
-    },
-    { {83, 241, 61, 70, 1},
-      {93, 15, 20, 217, 5},
-      {134, 43, 200, 252, 10},
-      {169, 178, 143, 11, 10}
-    },
-    { {99, 45, 7, 61, 3},
-      {29, 115, 162, 229, 8},
-      {203, 206, 11, 76, 6},
-      {26, 116, 92, 235, 8}
-    },
-    { {187, 21, 254, 209, 0},
-      {98, 203, 164, 127, 6},
-      {8, 183, 250, 141, 13},
-      {111, 226, 93, 52, 6}
-    },
-    { {249, 117, 16, 139, 12},
-      {67, 46, 97, 246, 3},
-      {61, 16, 138, 233, 15},
-      {198, 248, 103, 76, 2}
-    },
-    { {82, 137, 180, 183, 15},
-      {12, 155, 211, 149, 15},
-      {254, 210, 217, 20, 10},
-      {250, 156, 189, 147, 0}
-    },
-    { {27, 210, 12, 213, 13},
-      {78, 13, 221, 77, 2},
-      {186, 179, 4, 189, 8},
-      {75, 43, 187, 7, 2}
-    },
-    { {177, 242, 231, 215, 11},
-      {125, 221, 185, 78, 7},
-      {222, 190, 116, 248, 13},
-      {231, 41, 219, 187, 14}
-    },
-    { {59, 199, 234, 23, 8},
-      {42, 206, 189, 101, 5},
-      {30, 133, 126, 61, 12},
-      {170, 107, 215, 53, 4}
-    },
-    { {129, 160, 44, 14, 10},
-      {9, 49, 21, 66, 5},
-      {87, 3, 64, 88, 1},
-      {164, 42, 136, 201, 0}
-    },
-    { {175, 47, 221, 40, 8},
-      {179, 163, 47, 115, 8},
-      {17, 75, 191, 79, 5},
-      {28, 239, 76, 92, 13}
-    },
-    { {102, 160, 63, 60, 5},
-      {157, 97, 246, 145, 4},
-      {163, 207, 192, 86, 6},
-      {40, 150, 248, 107, 9}
-    },
-    { {97, 107, 54, 64, 2},
-      {1, 87, 40, 216, 12},
-      {64, 38, 205, 104, 6},
-      {49, 177, 78, 168, 0}
-    },
-    { {179, 110, 223, 102, 4},
-      {57, 205, 110, 123, 9},
-      {38, 111, 183, 108, 13},
-      {157, 231, 107, 57, 12}
-    },
-    { {221, 206, 234, 142, 13},
-      {174, 236, 93, 226, 15},
-      {183, 21, 119, 59, 11},
-      {244, 123, 163, 119, 5}
-    },
-    { {191, 161, 228, 191, 4},
-      {171, 171, 242, 71, 7},
-      {47, 210, 120, 95, 13},
-      {238, 36, 253, 93, 5}
-    },
-    { {181, 50, 205, 129, 2},
-      {241, 153, 44, 70, 2},
-      {72, 27, 52, 202, 13},
-      {70, 35, 73, 152, 15}
-    },
-    { {93, 75, 26, 56, 8},
-      {130, 110, 143, 208, 8},
-      {17, 197, 141, 43, 10},
-      {16, 191, 23, 100, 1}
-    },
-    { {178, 246, 24, 165, 12},
-      {73, 12, 127, 55, 2},
-      {58, 81, 134, 244, 13},
-      {78, 207, 227, 9, 2}
-    },
-    { {56, 237, 90, 165, 11},
-      {47, 94, 55, 52, 10},
-      {218, 85, 171, 113, 12},
-      {82, 206, 199, 175, 4}
-    },
-    { {73, 219, 225, 19, 5},
-      {118, 134, 216, 196, 13},
-      {172, 136, 125, 185, 2},
-      {178, 49, 182, 22, 14}
-    },
-    { {73, 170, 182, 189, 9},
-      {15, 225, 155, 212, 14},
-      {155, 214, 213, 89, 2},
-      {114, 189, 152, 127, 0}
-    },
-    { {84, 139, 234, 26, 2},
-      {160, 250, 156, 128, 13},
-      {69, 133, 125, 18, 10},
-      {176, 19, 149, 240, 5}
-    },
-    { {157, 15, 70, 19, 1},
-      {166, 75, 136, 102, 9},
-      {140, 134, 47, 11, 9},
-      {150, 97, 29, 38, 5}
-    },
-    { {102, 97, 19, 14, 1},
-      {157, 102, 32, 145, 1},
-      {135, 12, 136, 102, 6},
-      {136, 144, 70, 107, 9}
-    },
-    { {248, 9, 47, 37, 2},
-      {26, 91, 38, 134, 12},
-      {74, 79, 73, 1, 15},
-      {54, 22, 77, 165, 8}
-    },
-    { {11, 201, 149, 46, 14},
-      {26, 183, 83, 81, 9},
-      {119, 74, 153, 61, 0},
-      {152, 172, 174, 213, 8}
-    },
-    { {184, 19, 104, 249, 3},
-      {102, 58, 174, 14, 6},
-      {201, 241, 108, 129, 13},
-      {103, 7, 85, 198, 6}
-    },
-    { {247, 151, 168, 45, 7},
-      {204, 186, 126, 231, 4},
-      {235, 65, 94, 158, 15},
-      {46, 119, 229, 211, 3}
-    },
-    { {64, 198, 85, 224, 12},
-      {48, 5, 91, 184, 2},
-      {48, 122, 166, 48, 2},
-      {65, 221, 170, 0, 12}
-    },
-    { {119, 132, 246, 36, 5},
-      {172, 201, 114, 241, 4},
-      {162, 70, 242, 30, 14},
-      {40, 244, 233, 51, 5}
-    },
-    { {67, 149, 31, 37, 8},
-      {88, 67, 23, 245, 0},
-      {26, 79, 138, 156, 2},
-      {10, 254, 140, 33, 10}
-    },
-    { {45, 159, 144, 243, 0},
-      {194, 130, 186, 124, 11},
-      {12, 240, 159, 155, 4},
-      {211, 229, 212, 20, 3}
-    },
-    { {146, 221, 176, 205, 11},
-      {76, 190, 17, 63, 14},
-      {219, 48, 219, 180, 9},
-      {127, 200, 135, 211, 2}
-    },
-    { {246, 199, 216, 26, 12},
-      {160, 174, 253, 179, 1},
-      {53, 129, 190, 54, 15},
-      {140, 219, 247, 80, 5}
-    },
-    { {24, 194, 89, 137, 6},
-      {50, 60, 92, 20, 2},
-      {105, 25, 164, 49, 8},
-      {66, 131, 163, 196, 12}
-    },
-    { {191, 94, 230, 119, 1},
-      {238, 205, 170, 111, 13},
-      {142, 230, 119, 175, 13},
-      {191, 101, 91, 55, 7}
-    },
-    { {154, 185, 210, 41, 10},
-      {99, 250, 19, 23, 8},
-      {89, 68, 185, 213, 9},
-      {30, 140, 133, 252, 6}
-    },
-    { {85, 134, 127, 171, 1},
-      {180, 105, 30, 244, 7},
-      {141, 95, 230, 26, 10},
-      {226, 247, 137, 98, 13}
-    },
-    { {184, 210, 232, 62, 14},
-      {106, 188, 255, 2, 5},
-      {119, 193, 116, 177, 13},
-      {164, 15, 243, 213, 6}
-    },
-    { {8, 95, 31, 243, 10},
-      {82, 87, 143, 60, 11},
-      {92, 255, 143, 161, 0},
-      {211, 207, 30, 164, 10}
-    },
-    { {18, 244, 23, 56, 3},
-      {85, 125, 146, 49, 0},
-      {193, 206, 130, 244, 8},
-      {8, 196, 155, 234, 10}
-    },
-    { {166, 113, 141, 223, 14},
-      {217, 183, 229, 15, 3},
-      {127, 187, 24, 230, 5},
-      {207, 10, 126, 217, 11}
-    },
-    { {192, 142, 206, 109, 0},
-      {40, 225, 30, 174, 8},
-      {11, 103, 55, 16, 3},
-      {23, 87, 136, 113, 4}
-    },
-    { {109, 149, 12, 180, 7},
-      {206, 19, 246, 224, 2},
-      {226, 211, 10, 155, 6},
-      {64, 118, 252, 135, 3}
-    },
-    { {150, 47, 248, 18, 6},
-      {161, 154, 204, 51, 13},
-      {100, 129, 255, 70, 9},
-      {188, 195, 53, 152, 5}
-    },
-    { {100, 178, 210, 193, 10},
-      {225, 208, 57, 156, 2},
-      {88, 52, 180, 210, 6},
-      {67, 153, 192, 184, 7}
-    },
-    { {171, 232, 165, 221, 12},
-      {27, 165, 241, 79, 14},
-      {59, 186, 81, 125, 5},
-      {127, 40, 250, 93, 8}
-    },
-    { {1, 1, 118, 119, 7},
-      {44, 83, 194, 92, 5},
-      {238, 230, 232, 8, 0},
-      {163, 164, 60, 163, 4}
-    },
-    { {122, 87, 242, 127, 10},
-      {106, 254, 171, 189, 5},
-      {95, 228, 254, 165, 14},
-      {171, 221, 87, 245, 6}
-    },
-    { {49, 50, 151, 33, 7},
-      {85, 217, 106, 84, 0},
-      {232, 78, 148, 200, 12},
-      {2, 165, 105, 186, 10}
-    },
-    { {84, 80, 181, 69, 13},
-      {220, 141, 65, 156, 4},
-      {186, 42, 208, 162, 10},
-      {35, 152, 43, 19, 11}
-    },
-    { {11, 87, 84, 254, 5},
-      {110, 39, 202, 121, 3},
-      {167, 242, 174, 173, 0},
-      {201, 229, 62, 71, 6}
-    },
-    { {182, 45, 55, 60, 6},
-      {153, 123, 226, 51, 12},
-      {99, 206, 203, 70, 13},
-      {60, 196, 125, 233, 9}
-    },
-    { {148, 78, 188, 41, 1},
-      {132, 173, 14, 54, 12},
-      {137, 67, 215, 34, 9},
-      {54, 199, 11, 82, 1}
-    },
-    { {212, 209, 225, 203, 8},
-      {240, 174, 17, 142, 7},
-      {29, 56, 120, 178, 11},
-      {231, 24, 135, 80, 15}
-    },
-    { {41, 127, 114, 212, 15},
-      {111, 86, 233, 120, 14},
-      {242, 180, 239, 233, 4},
-      {113, 233, 118, 175, 6}
-    },
-    { {185, 41, 143, 89, 11},
-      {23, 251, 165, 78, 8},
-      {217, 175, 25, 73, 13},
-      {23, 42, 93, 254, 8}
-    },
-    { {156, 178, 65, 173, 13},
-      {255, 40, 91, 6, 2},
-      {187, 88, 36, 211, 9},
-      {70, 13, 161, 79, 15}
-    },
-    { {9, 10, 241, 177, 13},
-      {54, 128, 203, 84, 14},
-      {184, 216, 245, 9, 0},
-      {114, 173, 48, 22, 12}
-    },
-    { {16, 185, 135, 171, 7},
-      {85, 251, 82, 4, 11},
-      {237, 94, 25, 208, 8},
-      {210, 4, 173, 250, 10}
-    },
-    { {126, 194, 225, 64, 6},
-      {178, 156, 120, 137, 4},
-      {96, 40, 116, 55, 14},
-      {41, 17, 227, 148, 13}
-    },
-    { {67, 167, 86, 127, 1},
-      {45, 99, 154, 253, 1},
-      {143, 230, 174, 92, 2},
-      {139, 245, 156, 107, 4}
-    },
-    { {26, 3, 90, 19, 6},
-      {34, 90, 204, 21, 1},
-      {108, 133, 172, 5, 8},
-      {138, 131, 53, 164, 4}
-    },
-    { {29, 135, 214, 9, 13},
-      {166, 235, 89, 116, 0},
-      {185, 6, 190, 27, 8},
-      {2, 233, 173, 118, 5}
-    },
-    { {166, 252, 66, 185, 15},
-      {229, 116, 243, 39, 10},
-      {249, 212, 35, 246, 5},
-      {94, 76, 242, 234, 7}
-    },
-    { {107, 129, 183, 247, 6},
-      {26, 211, 242, 221, 7},
-      {110, 254, 216, 29, 6},
-      {235, 180, 252, 181, 8}
-    },
-    { {69, 254, 109, 129, 14},
-      {241, 21, 93, 228, 14},
-      {120, 27, 103, 250, 2},
-      {114, 123, 170, 136, 15}
-    },
-    { {53, 236, 43, 184, 7},
-      {149, 124, 246, 96, 14},
-      {225, 221, 67, 122, 12},
-      {112, 102, 243, 234, 9}
-    },
-    { {49, 88, 4, 149, 14},
-      {72, 29, 225, 68, 10},
-      {122, 146, 1, 168, 12},
-      {82, 40, 123, 129, 2}
-    },
-    { {152, 19, 34, 45, 15},
-      {78, 122, 75, 6, 4},
-      {251, 68, 76, 129, 9},
-      {38, 13, 37, 231, 2}
-    },
-    { {154, 159, 90, 231, 3},
-      {110, 90, 30, 63, 11},
-      {206, 117, 175, 149, 9},
-      {223, 199, 133, 167, 6}
-    },
-    { {212, 231, 111, 182, 1},
-      {189, 79, 158, 162, 7},
-      {134, 223, 110, 114, 11},
-      {228, 87, 159, 43, 13}
-    },
-    { {229, 90, 150, 106, 14},
-      {192, 245, 107, 218, 9},
-      {117, 102, 149, 170, 7},
-      {149, 189, 106, 240, 3}
-    },
-    { {79, 187, 212, 222, 13},
-      {239, 163, 217, 217, 11},
-      {183, 178, 189, 223, 2},
-      {217, 185, 188, 95, 7}
-    },
-    { {121, 157, 133, 152, 15},
-      {86, 187, 241, 224, 10},
-      {241, 154, 27, 153, 14},
-      {80, 120, 253, 214, 10}
-    },
-    { {9, 112, 158, 165, 9},
-      {79, 197, 7, 84, 2},
-      {154, 87, 144, 233, 0},
-      {66, 174, 10, 63, 2}
-    },
-    { {3, 87, 205, 203, 8},
-      {112, 167, 13, 109, 3},
-      {29, 59, 62, 172, 0},
-      {203, 107, 14, 80, 14}
-    },
-    { {212, 185, 186, 58, 5},
-      {197, 234, 214, 146, 13},
-      {165, 197, 217, 210, 11},
-      {180, 150, 181, 122, 3}
-    },
-    { {24, 64, 161, 74, 8},
-      {18, 172, 1, 8, 5},
-      {21, 40, 80, 33, 8},
-      {161, 8, 3, 84, 8}
-    },
-    { {118, 93, 35, 164, 0},
-      {216, 78, 34, 161, 14},
-      {2, 92, 75, 166, 14},
-      {120, 84, 71, 33, 11}
-    },
-    { {215, 210, 250, 82, 11},
-      {228, 220, 157, 219, 5},
-      {212, 165, 244, 190, 11},
-      {173, 187, 147, 178, 7}
-    },
-    { {112, 131, 115, 144, 14},
-      {48, 90, 249, 144, 6},
-      {112, 156, 236, 16, 14},
-      {96, 153, 245, 160, 12}
-    },
-    { {54, 219, 219, 178, 9},
-      {244, 206, 191, 17, 11},
-      {148, 221, 189, 182, 12},
-      {216, 143, 215, 50, 15}
-    },
-    { {238, 65, 132, 139, 9},
-      {134, 167, 33, 135, 3},
-      {157, 18, 24, 39, 7},
-      {206, 24, 78, 86, 1}
-    },
-    { {82, 197, 48, 152, 6},
-      {0, 62, 208, 177, 6},
-      {97, 144, 202, 52, 10},
-      {104, 208, 183, 192, 0}
-    },
-    { {252, 86, 183, 22, 2},
-      {218, 221, 168, 178, 5},
-      {70, 142, 214, 163, 15},
-      {164, 209, 91, 181, 11}
-    },
-    { {116, 165, 189, 128, 1},
-      {149, 139, 52, 176, 6},
-      {128, 27, 218, 82, 14},
-      {96, 210, 205, 26, 9}
-    },
-    { {149, 143, 205, 134, 4},
-      {184, 139, 92, 98, 11},
-      {38, 27, 63, 26, 9},
-      {212, 99, 173, 17, 13}
-    },
-    { {217, 178, 146, 205, 0},
-      {75, 232, 24, 222, 2},
-      {11, 52, 148, 217, 11},
-      {71, 177, 129, 125, 2}
-    },
-    { {167, 235, 71, 193, 10},
-      {177, 87, 57, 79, 10},
-      {88, 62, 45, 126, 5},
-      {95, 41, 206, 168, 13}
-    },
-    { {79, 1, 94, 2, 9},
-      {166, 67, 5, 209, 1},
-      {148, 7, 168, 15, 2},
-      {136, 186, 12, 38, 5}
-    },
-    { {106, 36, 9, 113, 10},
-      {19, 16, 167, 173, 0},
-      {88, 233, 2, 69, 6},
-      {11, 94, 80, 140, 8}
-    },
-    { {206, 68, 49, 8, 9},
-      {150, 36, 1, 179, 4},
-      {145, 8, 194, 39, 3},
-      {44, 216, 2, 70, 9}
-    },
-    { {49, 255, 30, 233, 10},
-      {65, 127, 63, 124, 10},
-      {89, 119, 143, 248, 12},
-      {83, 239, 207, 232, 2}
-    },
-    { {20, 10, 7, 54, 11},
-      {156, 89, 139, 0, 9},
-      {214, 206, 5, 2, 8},
-      {144, 13, 25, 163, 9}
-    },
-    { {70, 59, 86, 20, 0},
-      {233, 67, 136, 145, 8},
-      {2, 134, 173, 198, 2},
-      {24, 145, 28, 41, 7}
-    },
-    { {59, 6, 12, 183, 14},
-      {10, 25, 239, 101, 3},
-      {126, 211, 6, 13, 12},
-      {202, 111, 121, 133, 0}
-    },
-    { {183, 192, 126, 222, 10},
-      {168, 125, 181, 91, 7},
-      {87, 183, 224, 62, 13},
-      {237, 170, 219, 225, 5}
-    },
-    { {131, 167, 59, 199, 12},
-      {25, 66, 93, 127, 7},
-      {62, 61, 206, 92, 1},
-      {239, 235, 164, 41, 8}
-    },
-    { {169, 68, 61, 125, 8},
-      {26, 37, 167, 126, 4},
-      {27, 235, 194, 41, 5},
-      {39, 238, 90, 69, 8}
-    },
-    { {89, 62, 133, 40, 0},
-      {83, 169, 10, 224, 8},
-      {1, 74, 23, 201, 10},
-      {16, 117, 9, 92, 10}
-    },
-    { {91, 223, 9, 190, 3},
-      {94, 62, 158, 225, 11},
-      {199, 217, 15, 189, 10},
-      {216, 119, 151, 199, 10}
-    },
-    { {90, 199, 81, 168, 1},
-      {54, 46, 26, 177, 2},
-      {129, 88, 174, 53, 10},
-      {72, 213, 135, 70, 12}
-    },
-    { {172, 197, 14, 185, 6},
-      {130, 119, 246, 38, 2},
-      {105, 215, 10, 51, 5},
-      {70, 70, 254, 228, 1}
-    },
-    { {140, 158, 159, 124, 11},
-      {222, 241, 159, 58, 8},
-      {211, 239, 151, 147, 1},
-      {21, 207, 152, 247, 11}
-    },
-    { {94, 223, 124, 158, 10},
-      {234, 63, 157, 177, 15},
-      {87, 147, 239, 183, 10},
-      {248, 219, 159, 197, 7}
-    },
-    { {194, 247, 145, 150, 7},
-      {93, 150, 216, 179, 3},
-      {230, 152, 158, 244, 3},
-      {204, 209, 182, 155, 10}
-    },
-    { {104, 128, 250, 139, 3},
-      {38, 240, 52, 148, 7},
-      {205, 21, 240, 17, 6},
-      {226, 146, 192, 246, 4}
-    },
-    { {164, 118, 61, 185, 15},
-      {213, 53, 239, 54, 6},
-      {249, 219, 198, 226, 5},
-      {102, 207, 122, 202, 11}
-    },
-    { {232, 136, 149, 37, 11},
-      {30, 145, 51, 150, 8},
-      {218, 74, 145, 17, 7},
-      {22, 156, 200, 151, 8}
-    },
-    { {94, 137, 11, 42, 0},
-      {146, 106, 22, 129, 9},
-      {5, 77, 9, 23, 10},
-      {152, 22, 133, 100, 9}
-    },
-    { {168, 252, 52, 240, 6},
-      {67, 21, 242, 58, 14},
-      {96, 242, 195, 241, 5},
-      {117, 196, 250, 140, 2}
-    },
-    { {102, 80, 220, 156, 14},
-      {232, 181, 229, 145, 2},
-      {115, 147, 176, 166, 6},
-      {72, 154, 122, 209, 7}
-    },
-    { {217, 235, 112, 198, 6},
-      {43, 30, 88, 218, 15},
-      {102, 48, 237, 121, 11},
-      {245, 177, 167, 141, 4}
-    },
-    { {6, 57, 26, 27, 7},
-      {197, 114, 196, 21, 9},
-      {237, 133, 137, 198, 0},
-      {154, 130, 52, 234, 3}
-    },
-    { {100, 213, 236, 219, 14},
-      {224, 183, 245, 172, 7},
-      {125, 179, 122, 178, 6},
-      {227, 90, 254, 208, 7}
-    },
-    { {80, 23, 140, 98, 3},
-      {68, 155, 14, 168, 1},
-      {196, 99, 30, 128, 10},
-      {129, 87, 13, 146, 2}
-    },
-    { {128, 175, 91, 93, 8},
-      {57, 98, 157, 62, 8},
-      {27, 173, 175, 80, 1},
-      {23, 203, 148, 105, 12}
-    },
-    { {178, 110, 247, 189, 9},
-      {61, 237, 171, 55, 14},
-      {155, 222, 247, 100, 13},
-      {126, 205, 91, 123, 12}
-    },
-    { {210, 217, 41, 11, 11},
-      {84, 62, 21, 135, 13},
-      {221, 9, 73, 180, 11},
-      {190, 26, 135, 194, 10}
-    },
-    { {142, 230, 136, 246, 1},
-      {143, 132, 158, 43, 3},
-      {134, 241, 22, 119, 1},
-      {205, 71, 146, 31, 1}
-    },
-    { {144, 133, 126, 179, 5},
-      {36, 75, 214, 54, 7},
-      {172, 215, 234, 16, 9},
-      {230, 198, 189, 34, 4}
-    },
-    { {214, 244, 185, 51, 14},
-      {209, 156, 215, 183, 5},
-      {124, 201, 210, 246, 11},
-      {174, 222, 179, 152, 11}
-    },
-    { {68, 17, 154, 175, 12},
-      {200, 226, 71, 148, 3},
-      {63, 85, 152, 130, 2},
-      {194, 158, 36, 113, 3}
-    },
-    { {48, 177, 90, 93, 2},
-      {105, 122, 180, 28, 0},
-      {75, 165, 168, 208, 12},
-      {3, 130, 213, 233, 6}
-    },
-    { {66, 57, 254, 118, 6},
-      {105, 211, 198, 153, 13},
-      {102, 231, 249, 196, 2},
-      {185, 150, 60, 185, 6}
-    },
-    { {108, 223, 228, 140, 12},
-      {234, 167, 121, 160, 14},
-      {51, 18, 127, 179, 6},
-      {112, 89, 238, 85, 7}
-    },
-    { {110, 159, 250, 19, 0},
-      {226, 194, 188, 181, 13},
-      {12, 133, 255, 151, 6},
-      {186, 211, 212, 52, 7}
-    },
-    { {251, 180, 205, 219, 9},
-      {119, 169, 181, 239, 3},
-      {157, 187, 50, 221, 15},
-      {207, 122, 217, 94, 14}
-    },
-    { {106, 94, 54, 11, 12},
-      {66, 101, 105, 181, 13},
-      {61, 6, 199, 165, 6},
-      {186, 217, 106, 100, 2}
-    },
-    { {187, 128, 110, 3, 5},
-      {38, 73, 116, 71, 5},
-      {172, 7, 96, 29, 13},
-      {174, 34, 233, 38, 4}
-    },
-    { {151, 235, 197, 191, 10},
-      {185, 191, 155, 71, 11},
-      {95, 218, 61, 126, 9},
-      {222, 45, 159, 217, 13}
-    },
-    { {15, 117, 226, 80, 2},
-      {227, 214, 128, 105, 4},
-      {64, 164, 122, 239, 0},
-      {41, 96, 22, 188, 7}
-    },
-    { {11, 49, 73, 156, 8},
-      {123, 34, 133, 65, 2},
-      {19, 153, 40, 205, 0},
-      {72, 42, 20, 77, 14}
-    },
-    { {215, 174, 213, 193, 8},
-      {177, 137, 25, 255, 10},
-      {24, 58, 183, 94, 11},
-      {95, 249, 137, 24, 13}
-    },
-    { {210, 248, 182, 187, 9},
-      {69, 237, 147, 151, 15},
-      {157, 214, 209, 244, 11},
-      {254, 156, 155, 122, 2}
-    },
-    { {34, 55, 245, 42, 9},
-      {117, 163, 43, 49, 5},
-      {149, 74, 254, 196, 4},
-      {168, 205, 76, 90, 14}
-    },
-    { {68, 127, 202, 153, 4},
-      {225, 230, 204, 164, 10},
-      {41, 149, 63, 226, 2},
-      {82, 83, 54, 120, 7}
-    },
-    { {141, 146, 126, 41, 15},
-      {230, 113, 95, 86, 4},
-      {249, 71, 228, 155, 1},
-      {38, 175, 168, 230, 7}
-    },
-    { {13, 54, 100, 46, 5},
-      {239, 33, 74, 96, 5},
-      {167, 66, 102, 203, 0},
-      {160, 101, 40, 79, 7}
-    },
-    { {213, 191, 237, 221, 12},
-      {249, 171, 221, 238, 14},
-      {59, 187, 127, 218, 11},
-      {119, 123, 189, 89, 15}
-    },
-    { {139, 198, 212, 229, 1},
-      {46, 133, 26, 127, 2},
-      {138, 114, 182, 61, 1},
-      {79, 229, 138, 23, 4}
-    },
-    { {221, 244, 124, 110, 1},
-      {239, 45, 22, 250, 5},
-      {135, 99, 226, 251, 11},
-      {165, 246, 139, 79, 7}
-    },
-    { {69, 159, 45, 147, 1},
-      {212, 3, 156, 228, 15},
-      {140, 155, 79, 154, 2},
-      {242, 115, 156, 2, 11}
-    },
-    { {134, 21, 175, 172, 5},
-      {220, 227, 70, 35, 6},
-      {163, 95, 90, 134, 1},
-      {108, 70, 44, 115, 11}
-    },
-    { {52, 174, 42, 121, 9},
-      {133, 104, 191, 44, 12},
-      {153, 229, 71, 82, 12},
-      {51, 79, 209, 106, 1}
-    },
-    { {246, 135, 29, 191, 4},
-      {152, 43, 254, 183, 3},
-      {47, 219, 142, 22, 15},
-      {206, 215, 253, 65, 9}
-    },
-    { {22, 183, 193, 11, 4},
-      {241, 170, 88, 37, 1},
-      {45, 8, 62, 214, 8},
-      {138, 65, 165, 88, 15}
-    },
-    { {122, 54, 203, 160, 5},
-      {119, 200, 110, 161, 2},
-      {160, 93, 54, 197, 14},
-      {72, 87, 97, 62, 14}
-    },
-    { {127, 66, 16, 98, 10},
-      {130, 28, 43, 217, 1},
-      {84, 96, 132, 47, 14},
-      {137, 189, 67, 132, 1}
-    },
-    { {103, 112, 117, 206, 8},
-      {249, 37, 33, 217, 7},
-      {23, 58, 224, 238, 6},
-      {233, 184, 74, 73, 15}
-    },
-    { {167, 70, 60, 209, 12},
-      {128, 5, 237, 127, 6},
-      {56, 179, 198, 46, 5},
-      {111, 235, 122, 0, 1}
-    },
-    { {153, 117, 131, 110, 2},
-      {91, 254, 2, 106, 1},
-      {71, 108, 26, 233, 9},
-      {133, 100, 7, 253, 10}
-    },
-    { {81, 145, 211, 21, 9},
-      {124, 202, 145, 212, 0},
-      {154, 140, 184, 152, 10},
-      {2, 184, 149, 51, 14}
-    },
-    { {53, 76, 2, 185, 8},
-      {128, 108, 163, 100, 10},
-      {25, 212, 3, 42, 12},
-      {82, 108, 83, 96, 1}
-    },
-    { {208, 27, 128, 57, 5},
-      {68, 170, 202, 134, 8},
-      {169, 192, 29, 128, 11},
-      {22, 21, 53, 82, 2}
-    },
-    { {123, 39, 171, 229, 3},
-      {31, 218, 46, 237, 6},
-      {202, 125, 94, 77, 14},
-      {107, 119, 69, 191, 8}
-    },
-    { {168, 140, 171, 169, 4},
-      {18, 224, 118, 38, 14},
-      {41, 93, 83, 17, 5},
-      {118, 70, 224, 116, 8}
-    },
-    { {138, 112, 46, 100, 13},
-      {79, 69, 71, 11, 4},
-      {178, 103, 64, 229, 1},
-      {45, 14, 42, 47, 2}
-    },
-    { {17, 144, 216, 79, 13},
-      {108, 168, 85, 92, 1},
-      {191, 33, 176, 152, 8},
-      {131, 170, 161, 83, 6}
-    },
-    { {168, 56, 156, 230, 8},
-      {75, 129, 39, 26, 11},
-      {22, 115, 145, 193, 5},
-      {213, 142, 72, 29, 2}
-    },
-    { {99, 172, 245, 8, 11},
-      {53, 177, 49, 241, 12},
-      {209, 10, 243, 92, 6},
-      {56, 248, 200, 218, 12}
-    },
-    { {153, 224, 174, 41, 11},
-      {7, 253, 23, 70, 4},
-      {217, 71, 80, 121, 9},
-      {38, 46, 139, 254, 0}
-    },
-    { {232, 139, 97, 157, 3},
-      {62, 50, 184, 134, 14},
-      {203, 152, 109, 17, 7},
-      {118, 17, 212, 199, 12}
-    },
-    { {17, 175, 187, 184, 0},
-      {17, 234, 158, 112, 14},
-      {1, 221, 223, 88, 8},
-      {112, 231, 149, 120, 8}
-    },
-    { {98, 250, 27, 120, 14},
-      {81, 116, 255, 153, 8},
-      {113, 237, 133, 244, 6},
-      {25, 159, 242, 232, 10}
-    },
-    { {241, 171, 236, 42, 5},
-      {37, 171, 126, 194, 13},
-      {165, 67, 125, 88, 15},
-      {180, 55, 237, 90, 4}
-    },
-    { {164, 120, 185, 64, 2},
-      {209, 148, 36, 26, 12},
-      {64, 41, 209, 226, 5},
-      {53, 130, 66, 152, 11}
-    },
-    { {78, 147, 112, 26, 3},
-      {230, 50, 152, 145, 5},
-      {197, 128, 236, 151, 2},
-      {168, 145, 148, 198, 7}
-    },
-    { {93, 31, 190, 33, 6},
-      {194, 219, 78, 244, 12},
-      {104, 71, 223, 139, 10},
-      {50, 247, 45, 180, 3}
-    },
-    { {222, 153, 178, 148, 7},
-      {206, 218, 208, 147, 14},
-      {226, 148, 217, 151, 11},
-      {124, 144, 181, 183, 3}
-    },
-    { {119, 8, 209, 116, 7},
-      {188, 152, 226, 217, 8},
-      {226, 232, 177, 14, 14},
-      {25, 180, 113, 147, 13}
-    },
-    { {187, 192, 140, 154, 8},
-      {2, 173, 181, 67, 3},
-      {21, 147, 16, 61, 13},
-      {204, 42, 219, 84, 0}
-    },
-    { {234, 28, 8, 68, 4},
-      {74, 0, 100, 171, 8},
-      {34, 33, 3, 133, 7},
-      {29, 82, 96, 5, 2}
-    },
-    { {184, 154, 172, 7, 8},
-      {74, 137, 61, 6, 13},
-      {30, 3, 85, 145, 13},
-      {182, 11, 201, 21, 2}
-    },
-    { {151, 79, 121, 58, 13},
-      {180, 46, 207, 115, 13},
-      {181, 201, 239, 46, 9},
-      {188, 239, 55, 66, 13}
-    },
-    { {124, 55, 168, 31, 9},
-      {207, 170, 173, 164, 5},
-      {159, 129, 94, 195, 14},
-      {162, 91, 85, 95, 3}
-    },
-    { {132, 5, 69, 184, 11},
-      {180, 51, 131, 34, 2},
-      {209, 218, 42, 2, 1},
-      {68, 76, 28, 194, 13}
-    },
-    { {137, 136, 232, 242, 10},
-      {34, 144, 151, 74, 15},
-      {84, 241, 113, 25, 1},
-      {245, 46, 144, 148, 4}
-    },
-    { {122, 5, 47, 138, 7},
-      {22, 123, 100, 161, 7},
-      {229, 31, 74, 5, 14},
-      {232, 82, 109, 230, 8}
-    },
-    { {192, 107, 231, 168, 3},
-      {53, 247, 10, 130, 14},
-      {193, 94, 125, 96, 3},
-      {116, 21, 14, 250, 12}
-    },
-    { {225, 214, 143, 229, 13},
-      {92, 197, 127, 238, 2},
-      {186, 127, 22, 184, 7},
-      {71, 127, 234, 51, 10}
-    },
-    { {135, 193, 94, 208, 1},
-      {164, 71, 148, 91, 2},
-      {128, 183, 168, 62, 1},
-      {77, 162, 158, 34, 5}
-    },
-    { {177, 141, 71, 4, 14},
-      {56, 91, 113, 98, 8},
-      {114, 14, 43, 24, 13},
-      {20, 104, 237, 161, 12}
-    },
-    { {185, 96, 48, 55, 10},
-      {11, 28, 163, 86, 5},
-      {94, 192, 192, 105, 13},
-      {166, 172, 83, 141, 0}
-    },
-    { {57, 22, 249, 242, 5},
-      {118, 136, 238, 120, 7},
-      {164, 249, 246, 137, 12},
-      {225, 231, 113, 22, 14}
-    },
-    { {91, 245, 56, 225, 10},
-      {67, 30, 23, 253, 6},
-      {88, 113, 202, 253, 10},
-      {107, 254, 135, 140, 2}
-    },
-    { {69, 2, 140, 137, 3},
-      {132, 177, 12, 196, 2},
-      {201, 19, 20, 10, 2},
-      {66, 51, 8, 210, 1}
-    },
-    { {139, 247, 79, 21, 14},
-      {123, 87, 221, 103, 0},
-      {122, 143, 46, 253, 1},
-      {14, 107, 190, 173, 14}
-    },
-    { {52, 169, 38, 14, 14},
-      {137, 123, 113, 0, 13},
-      {119, 6, 73, 82, 12},
-      {176, 8, 237, 233, 1}
-    },
-    { {254, 161, 180, 87, 2},
-      {139, 155, 176, 159, 5},
-      {78, 162, 216, 87, 15},
-      {175, 144, 221, 157, 1}
-    },
-    { {170, 172, 74, 33, 2},
-      {35, 80, 54, 39, 8},
-      {72, 69, 35, 85, 5},
-      {30, 70, 192, 172, 4}
-    },
-    { {199, 149, 142, 146, 10},
-      {192, 211, 149, 227, 3},
-      {84, 151, 26, 158, 3},
-      {204, 122, 156, 176, 3}
-    },
-    { {77, 114, 150, 13, 7},
-      {207, 245, 72, 212, 0},
-      {235, 6, 148, 235, 2},
-      {2, 177, 42, 255, 3}
-    },
-    { {198, 113, 60, 138, 13},
-      {197, 39, 69, 147, 7},
-      {181, 19, 200, 230, 3},
-      {236, 154, 46, 74, 3}
-    },
-    { {26, 219, 8, 147, 10},
-      {66, 30, 157, 5, 11},
-      {92, 145, 13, 181, 8},
-      {218, 11, 151, 132, 2}
-    },
-    { {235, 178, 94, 21, 3},
-      {111, 81, 188, 215, 0},
-      {202, 135, 164, 221, 7},
-      {14, 179, 216, 175, 6}
-    },
-    { {26, 140, 101, 49, 13},
-      {54, 9, 211, 37, 12},
-      {184, 202, 99, 21, 8},
-      {58, 76, 185, 6, 12}
-    },
-    { {184, 194, 144, 210, 13},
-      {6, 140, 249, 26, 3},
-      {180, 176, 148, 49, 13},
-      {197, 137, 243, 22, 0}
-    },
-    { {237, 10, 185, 59, 12},
-      {146, 160, 239, 214, 13},
-      {61, 201, 213, 11, 7},
-      {182, 191, 112, 84, 9}
-    },
-    { {53, 64, 254, 171, 14},
-      {160, 253, 103, 84, 7},
-      {125, 87, 240, 42, 12},
-      {226, 174, 107, 240, 5}
-    },
-    { {77, 141, 169, 163, 10},
-      {146, 146, 23, 228, 15},
-      {92, 89, 91, 27, 2},
-      {242, 126, 132, 148, 9}
-    },
-    { {25, 111, 83, 7, 9},
-      {63, 78, 9, 116, 9},
-      {158, 12, 175, 105, 8},
-      {146, 233, 7, 47, 12}
-    },
-    { {170, 161, 45, 108, 8},
-      {27, 35, 55, 11, 4},
-      {19, 107, 72, 85, 5},
-      {45, 14, 204, 77, 8}
-    },
-    { {212, 51, 219, 225, 6},
-      {241, 218, 78, 158, 2},
-      {104, 125, 188, 194, 11},
-      {71, 151, 37, 184, 15}
-    },
-    { {41, 68, 117, 210, 10},
-      {50, 21, 161, 120, 7},
-      {84, 186, 226, 41, 4},
-      {225, 232, 90, 132, 12}
-    },
-    { {222, 189, 217, 145, 6},
-      {243, 154, 212, 183, 10},
-      {104, 153, 187, 215, 11},
-      {94, 210, 181, 156, 15}
-    },
-    { {123, 98, 241, 8, 1},
-      {55, 172, 40, 209, 4},
-      {129, 8, 244, 109, 14},
-      {40, 177, 67, 94, 12}
-    },
-    { {16, 243, 23, 219, 8},
-      {81, 111, 153, 28, 3},
-      {29, 190, 140, 240, 8},
-      {195, 137, 159, 104, 10}
-    },
-    { {184, 117, 135, 64, 5},
-      {87, 207, 96, 42, 0},
-      {160, 46, 26, 225, 13},
-      {5, 64, 111, 62, 10}
-    },
-    { {154, 182, 79, 175, 0},
-      {123, 105, 30, 39, 3},
-      {15, 95, 38, 213, 9},
-      {206, 71, 137, 109, 14}
-    },
-    { {212, 4, 243, 160, 1},
-      {180, 200, 2, 178, 6},
-      {128, 92, 242, 2, 11},
-      {100, 212, 1, 50, 13}
-    },
-    { {225, 106, 123, 127, 5},
-      {61, 100, 238, 222, 13},
-      {175, 237, 229, 104, 7},
-      {183, 183, 114, 107, 12}
-    },
-    { {12, 218, 188, 26, 8},
-      {194, 165, 157, 16, 13},
-      {21, 131, 213, 179, 0},
-      {176, 139, 154, 84, 3}
-    },
-    { {4, 96, 183, 149, 11},
-      {157, 213, 129, 20, 6},
-      {218, 158, 208, 98, 0},
-      {98, 136, 26, 187, 9}
-    },
-    { {28, 206, 196, 143, 3},
-      {174, 189, 24, 36, 11},
-      {207, 18, 55, 51, 8},
-      {210, 65, 139, 215, 5}
-    },
-    { {35, 222, 229, 165, 12},
-      {120, 133, 123, 101, 14},
-      {58, 90, 119, 188, 4},
-      {122, 109, 234, 17, 14}
-    },
-    { {99, 5, 255, 232, 5},
-      {52, 227, 102, 249, 6},
-      {161, 127, 250, 12, 6},
-      {105, 246, 108, 114, 12}
-    },
-    { {225, 195, 39, 185, 4},
-      {16, 103, 250, 198, 6},
-      {41, 222, 76, 56, 7},
-      {102, 53, 254, 96, 8}
-    },
-    { {140, 43, 164, 30, 0},
-      {139, 163, 136, 2, 13},
-      {7, 130, 93, 67, 1},
-      {180, 1, 28, 93, 1}
-    },
-    { {28, 217, 222, 180, 0},
-      {234, 207, 150, 16, 10},
-      {2, 215, 185, 179, 8},
-      {80, 134, 159, 53, 7}
-    },
-    { {85, 100, 240, 183, 1},
-      {173, 140, 130, 244, 7},
-      {142, 208, 242, 106, 10},
-      {226, 244, 19, 27, 5}
-    },
-    { {176, 199, 42, 118, 10},
-      {8, 94, 191, 42, 5},
-      {86, 229, 78, 48, 13},
-      {165, 79, 215, 161, 0}
-    },
-    { {231, 13, 80, 70, 9},
-      {172, 2, 33, 251, 9},
-      {150, 32, 171, 14, 7},
-      {157, 248, 68, 3, 5}
-    },
-    { {50, 149, 124, 126, 3},
-      {108, 59, 182, 57, 5},
-      {199, 227, 234, 148, 12},
-      {169, 198, 221, 195, 6}
-    },
-    { {71, 130, 81, 20, 11},
-      {188, 16, 153, 209, 0},
-      {210, 136, 164, 30, 2},
-      {8, 185, 144, 131, 13}
-    },
-    { {120, 242, 17, 22, 15},
-      {95, 28, 249, 144, 1},
-      {246, 136, 132, 241, 14},
-      {128, 153, 243, 143, 10}
-    },
-    { {144, 251, 64, 119, 10},
-      {105, 30, 155, 14, 9},
-      {94, 224, 45, 240, 9},
-      {151, 13, 151, 137, 6}
-    },
-    { {162, 111, 219, 64, 3},
-      {53, 214, 44, 59, 8},
-      {192, 45, 191, 100, 5},
-      {29, 195, 70, 186, 12}
-    },
-    { {36, 36, 50, 53, 7},
-      {141, 80, 226, 52, 4},
-      {234, 196, 194, 66, 4},
-      {34, 196, 112, 171, 1}
-    },
-    { {135, 138, 180, 213, 3},
-      {140, 145, 152, 95, 14},
-      {202, 178, 213, 30, 1},
-      {127, 161, 152, 147, 1}
-    },
-    { {238, 169, 194, 236, 0},
-      {171, 226, 50, 139, 10},
-      {3, 116, 57, 87, 7},
-      {93, 20, 196, 125, 5}
-    },
-    { {194, 91, 81, 134, 10},
-      {120, 22, 9, 147, 11},
-      {86, 24, 173, 164, 3},
-      {220, 153, 6, 129, 14}
-    },
-    { {154, 26, 220, 22, 4},
-      {106, 137, 204, 19, 9},
-      {38, 131, 181, 133, 9},
-      {156, 131, 57, 21, 6}
-    },
-    { {115, 131, 224, 101, 1},
-      {44, 138, 58, 205, 4},
-      {138, 96, 124, 28, 14},
-      {43, 53, 197, 19, 4}
-    },
-    { {25, 137, 191, 169, 14},
-      {18, 251, 87, 84, 14},
-      {121, 95, 217, 25, 8},
-      {114, 174, 173, 244, 8}
-    },
-    { {29, 136, 219, 124, 13},
-      {190, 232, 215, 88, 8},
-      {179, 237, 177, 27, 8},
-      {17, 174, 177, 119, 13}
-    },
-    { {58, 57, 201, 98, 1},
-      {119, 138, 38, 9, 9},
-      {132, 105, 57, 197, 12},
-      {153, 6, 69, 30, 14}
-    },
-    { {196, 95, 111, 141, 1},
-      {252, 103, 12, 166, 14},
-      {139, 31, 111, 162, 3},
-      {118, 83, 14, 99, 15}
-    },
-    { {127, 212, 244, 88, 13},
-      {230, 173, 241, 249, 4},
-      {177, 162, 242, 191, 14},
-      {41, 248, 251, 86, 7}
-    },
-    { {235, 94, 5, 198, 13},
-      {94, 5, 105, 235, 11},
-      {182, 58, 7, 173, 7},
-      {221, 121, 106, 7, 10}
-    },
-    { {0, 222, 87, 31, 10},
-      {120, 117, 153, 52, 9},
-      {95, 142, 167, 176, 0},
-      {146, 201, 154, 225, 14}
-    },
-    { {48, 182, 57, 119, 2},
-      {89, 24, 190, 60, 5},
-      {78, 233, 198, 208, 12},
-      {163, 199, 209, 137, 10}
-    },
-    { {217, 17, 79, 9, 9},
-      {118, 107, 5, 198, 0},
-      {153, 15, 40, 137, 11},
-      {6, 58, 13, 102, 14}
-    },
-    { {11, 138, 78, 254, 13},
-      {46, 97, 223, 73, 11},
-      {183, 247, 37, 29, 0},
-      {217, 47, 184, 103, 4}
-    },
-    { {150, 200, 148, 195, 5},
-      {132, 141, 80, 31, 11},
-      {172, 50, 145, 54, 9},
-      {223, 128, 171, 18, 1}
-    },
-    { {222, 86, 207, 27, 9},
-      {246, 237, 141, 167, 1},
-      {157, 143, 54, 167, 11},
-      {142, 91, 27, 118, 15}
-    },
-    { {233, 20, 44, 234, 11},
-      {70, 49, 39, 234, 7},
-      {213, 115, 66, 137, 7},
-      {229, 126, 72, 198, 2}
-    },
-    { {166, 193, 149, 63, 7},
-      {156, 183, 242, 23, 1},
-      {239, 202, 152, 54, 5},
-      {142, 132, 254, 211, 9}
-    },
-    { {112, 249, 99, 53, 11},
-      {125, 94, 179, 132, 12},
-      {218, 204, 105, 240, 14},
-      {50, 28, 215, 171, 14}
-    },
-    { {60, 210, 112, 229, 12},
-      {234, 12, 123, 28, 6},
-      {58, 112, 228, 179, 12},
-      {99, 141, 227, 5, 7}
-    },
-    { {67, 44, 58, 151, 8},
-      {9, 64, 133, 245, 15},
-      {30, 149, 195, 76, 2},
-      {250, 250, 16, 41, 0}
-    },
-    { {96, 54, 213, 83, 2},
-      {113, 145, 168, 188, 1},
-      {76, 170, 182, 192, 6},
-      {131, 209, 88, 152, 14}
-    },
-    { {135, 118, 248, 196, 14},
-      {233, 148, 77, 123, 6},
-      {114, 49, 246, 238, 1},
-      {109, 235, 34, 153, 7}
-    },
-    { {32, 85, 144, 158, 12},
-      {72, 166, 225, 48, 3},
-      {55, 144, 154, 160, 4},
-      {192, 200, 118, 81, 2}
-    },
-    { {51, 149, 147, 18, 0},
-      {80, 202, 176, 113, 1},
-      {4, 140, 154, 156, 12},
-      {136, 224, 213, 48, 10}
-    },
-    { {61, 129, 11, 57, 10},
-      {146, 122, 183, 68, 0},
-      {89, 205, 8, 27, 12},
-      {2, 46, 213, 228, 9}
-    },
-    { {39, 67, 30, 187, 2},
-      {128, 119, 174, 85, 3},
-      {77, 215, 140, 46, 4},
-      {202, 167, 94, 224, 1}
-    },
-    { {240, 133, 185, 233, 2},
-      {16, 186, 54, 190, 6},
-      {73, 121, 218, 16, 15},
-      {103, 214, 197, 208, 8}
-    },
-    { {163, 11, 146, 226, 0},
-      {0, 194, 42, 91, 11},
-      {4, 116, 157, 12, 5},
-      {221, 165, 68, 48, 0}
-    },
-    { {220, 20, 37, 232, 5},
-      {214, 41, 66, 170, 6},
-      {161, 122, 66, 131, 11},
-      {101, 84, 41, 70, 11}
-    },
-    { {180, 171, 135, 231, 11},
-      {157, 219, 59, 14, 11},
-      {222, 126, 29, 82, 13},
-      {215, 13, 205, 187, 9}
-    },
-    { {143, 183, 62, 39, 0},
-      {203, 67, 30, 119, 5},
-      {14, 71, 206, 223, 1},
-      {174, 231, 140, 45, 3}
-    },
-    { {255, 211, 18, 95, 2},
-      {202, 126, 184, 223, 1},
-      {79, 164, 140, 191, 15},
-      {143, 177, 215, 229, 3}
-    },
-    { {5, 76, 149, 162, 10},
-      {144, 149, 3, 112, 11},
-      {84, 90, 147, 42, 0},
-      {208, 236, 10, 144, 9}
-    },
-    { {29, 121, 189, 67, 6},
-      {211, 159, 68, 92, 13},
-      {108, 43, 217, 235, 8},
-      {179, 162, 47, 156, 11}
-    },
-    { {49, 220, 189, 155, 11},
-      {84, 189, 181, 116, 15},
-      {221, 155, 211, 184, 12},
-      {242, 234, 219, 210, 10}
-    },
-    { {93, 131, 76, 204, 2},
-      {170, 59, 28, 200, 2},
-      {67, 51, 44, 27, 10},
-      {65, 51, 141, 197, 5}
-    },
-    { {184, 110, 95, 128, 10},
-      {51, 93, 45, 50, 10},
-      {80, 31, 167, 97, 13},
-      {84, 203, 75, 172, 12}
-    },
-    { {221, 181, 2, 55, 14},
-      {203, 90, 211, 230, 1},
-      {126, 196, 10, 219, 11},
-      {134, 124, 181, 173, 3}
-    },
-    { {204, 212, 249, 32, 2},
-      {242, 148, 22, 178, 4},
-      {64, 73, 242, 179, 3},
-      {36, 214, 130, 148, 15}
-    },
-    { {222, 175, 20, 123, 3},
-      {135, 59, 154, 191, 9},
-      {205, 226, 143, 87, 11},
-      {159, 213, 157, 206, 1}
-    },
-    { {157, 32, 19, 22, 15},
-      {159, 88, 193, 82, 1},
-      {246, 140, 128, 75, 9},
-      {132, 168, 49, 175, 9}
-    },
-    { {124, 189, 240, 175, 1},
-      {239, 170, 50, 180, 15},
-      {143, 80, 251, 211, 14},
-      {242, 212, 197, 95, 7}
-    },
-    { {34, 195, 216, 114, 10},
-      {32, 150, 191, 25, 1},
-      {84, 225, 188, 52, 4},
-      {137, 143, 214, 144, 4}
-    },
-    { {69, 199, 100, 214, 12},
-      {168, 7, 217, 232, 7},
-      {54, 178, 110, 58, 2},
-      {225, 121, 190, 1, 5}
-    },
-    { {141, 147, 90, 116, 0},
-      {234, 66, 158, 90, 0},
-      {2, 229, 172, 155, 1},
-      {5, 167, 148, 37, 7}
-    },
-    { {177, 161, 236, 16, 8},
-      {33, 139, 181, 66, 4},
-      {16, 131, 120, 88, 13},
-      {36, 42, 221, 24, 4}
-    },
-    { {208, 121, 53, 51, 6},
-      {81, 31, 194, 150, 13},
-      {108, 202, 201, 224, 11},
-      {182, 148, 63, 136, 10}
-    },
-    { {74, 81, 93, 164, 6},
-      {122, 23, 70, 145, 2},
-      {98, 91, 168, 165, 2},
-      {72, 150, 46, 133, 14}
-    },
-    { {58, 45, 19, 35, 5},
-      {23, 74, 98, 53, 9},
-      {172, 76, 139, 69, 12},
-      {154, 196, 101, 46, 8}
-    },
-    { {236, 65, 230, 22, 1},
-      {174, 199, 160, 130, 5},
-      {134, 134, 120, 35, 7},
-      {164, 16, 94, 55, 5}
-    },
-    { {127, 172, 78, 24, 2},
-      {163, 121, 180, 225, 8},
-      {65, 135, 35, 95, 14},
-      {24, 114, 217, 236, 5}
-    },
-    { {115, 198, 100, 107, 13},
-      {36, 45, 123, 237, 5},
-      {189, 98, 102, 60, 14},
-      {171, 125, 235, 66, 4}
-    },
-    { {77, 251, 76, 21, 7},
-      {239, 23, 220, 196, 8},
-      {234, 131, 45, 251, 2},
-      {18, 51, 190, 143, 7}
-    },
-    { {229, 15, 78, 90, 11},
-      {164, 115, 173, 234, 9},
-      {213, 167, 47, 10, 7},
-      {149, 123, 92, 226, 5}
-    },
-    { {122, 161, 57, 166, 0},
-      {27, 10, 54, 145, 7},
-      {6, 89, 200, 85, 14},
-      {232, 150, 197, 13, 8}
-    },
-    { {18, 122, 254, 87, 13},
-      {109, 205, 205, 29, 13},
-      {190, 167, 245, 228, 8},
-      {187, 139, 59, 59, 6}
-    },
-    { {168, 230, 106, 159, 15},
-      {47, 116, 253, 38, 7},
-      {255, 149, 102, 113, 5},
-      {230, 75, 242, 239, 4}
-    },
-    { {89, 155, 96, 189, 8},
-      {106, 42, 155, 196, 14},
-      {27, 208, 109, 153, 10},
-      {114, 61, 149, 69, 6}
-    },
-    { {49, 234, 54, 102, 9},
-      {13, 77, 59, 88, 13},
-      {150, 102, 197, 120, 12},
-      {177, 173, 203, 43, 0}
-    },
-    { {55, 203, 228, 166, 3},
-      {172, 159, 58, 65, 15},
-      {198, 82, 125, 62, 12},
-      {248, 37, 207, 147, 5}
-    },
-    { {134, 60, 248, 42, 13},
-      {229, 160, 71, 51, 13},
-      {181, 65, 243, 198, 1},
-      {188, 206, 32, 90, 7}
-    },
-    { {14, 181, 149, 30, 6},
-      {219, 179, 208, 49, 1},
-      {103, 138, 154, 215, 0},
-      {136, 192, 188, 221, 11}
-    },
-    { {197, 251, 85, 118, 12},
-      {249, 7, 219, 218, 9},
-      {54, 234, 173, 250, 3},
-      {149, 189, 190, 9, 15}
-    },
-    { {123, 128, 210, 239, 5},
-      {46, 232, 114, 221, 3},
-      {175, 116, 176, 29, 14},
-      {203, 180, 225, 119, 4}
-    },
-    { {195, 179, 195, 50, 10},
-      {113, 210, 155, 195, 1},
-      {84, 204, 60, 220, 3},
-      {140, 61, 148, 184, 14}
-    },
-    { {103, 62, 26, 116, 11},
-      {205, 80, 175, 249, 8},
-      {210, 229, 135, 206, 6},
-      {25, 255, 80, 171, 3}
-    },
-    { {146, 201, 210, 150, 1},
-      {44, 206, 144, 19, 11},
-      {134, 148, 185, 52, 9},
-      {220, 128, 151, 51, 4}
-    },
-    { {127, 25, 25, 12, 11},
-      {222, 58, 37, 209, 8},
-      {211, 9, 137, 143, 14},
-      {24, 186, 69, 199, 11}
-    },
-    { {144, 112, 164, 195, 10},
-      {65, 157, 1, 14, 7},
-      {92, 50, 80, 224, 9},
-      {231, 8, 11, 152, 2}
-    },
-    { {113, 67, 83, 178, 1},
-      {52, 78, 170, 208, 3},
-      {132, 220, 172, 40, 14},
-      {192, 181, 87, 34, 12}
-    },
-    { {251, 75, 181, 78, 15},
-      {30, 191, 105, 219, 13},
-      {247, 42, 221, 45, 15},
-      {189, 185, 111, 215, 8}
-    },
-    { {197, 129, 104, 9, 8},
-      {160, 34, 21, 198, 4},
-      {25, 1, 104, 26, 3},
-      {38, 58, 132, 64, 5}
-    },
-    { {43, 241, 86, 121, 0},
-      {99, 103, 178, 93, 0},
-      {9, 230, 168, 253, 4},
-      {11, 164, 222, 108, 6}
-    },
-    { {139, 50, 134, 244, 8},
-      {75, 193, 139, 75, 2},
-      {18, 246, 20, 205, 1},
-      {77, 45, 24, 61, 2}
-    },
-    { {35, 88, 1, 235, 6},
-      {80, 52, 98, 77, 11},
-      {109, 120, 1, 172, 4},
-      {219, 36, 98, 192, 10}
-    },
-    { {42, 83, 143, 50, 8},
-      {82, 199, 175, 1, 1},
-      {20, 207, 28, 165, 4},
-      {136, 15, 94, 52, 10}
-    },
-    { {16, 109, 126, 84, 8},
-      {41, 79, 133, 56, 12},
-      {18, 167, 235, 96, 8},
-      {49, 202, 31, 41, 4}
-    },
-    { {70, 253, 197, 231, 10},
-      {249, 151, 19, 173, 11},
-      {94, 122, 59, 246, 2},
-      {219, 92, 142, 153, 15}
-    },
-    { {69, 106, 10, 93, 0},
-      {137, 100, 140, 204, 8},
-      {11, 165, 5, 106, 2},
-      {19, 51, 18, 105, 1}
-    },
-    { {217, 50, 39, 125, 10},
-      {91, 121, 139, 206, 4},
-      {91, 238, 68, 201, 11},
-      {39, 61, 25, 237, 10}
-    },
-    { {97, 59, 235, 152, 1},
-      {117, 226, 172, 192, 14},
-      {129, 157, 125, 200, 6},
-      {112, 51, 84, 122, 14}
-    },
-    { {191, 19, 181, 70, 0},
-      {218, 139, 40, 91, 5},
-      {6, 42, 220, 143, 13},
-      {173, 161, 77, 21, 11}
-    },
-    { {130, 186, 168, 203, 13},
-      {69, 160, 93, 15, 15},
-      {189, 49, 85, 212, 1},
-      {255, 11, 160, 90, 2}
-    },
-    { {81, 205, 99, 27, 3},
-      {52, 126, 144, 228, 13},
-      {205, 140, 107, 56, 10},
-      {178, 112, 151, 226, 12}
-    },
-    { {112, 171, 240, 76, 7},
-      {45, 186, 120, 152, 12},
-      {227, 32, 253, 80, 14},
-      {49, 145, 229, 219, 4}
-    },
-    { {170, 102, 185, 24, 7},
-      {23, 180, 236, 51, 4},
-      {225, 137, 214, 101, 5},
-      {44, 195, 114, 222, 8}
-    },
-    { {140, 20, 60, 97, 6},
-      {194, 17, 70, 62, 4},
-      {104, 99, 194, 131, 1},
-      {39, 198, 40, 132, 3}
-    },
-    { {241, 160, 157, 75, 0},
-      {17, 169, 52, 222, 1},
-      {13, 43, 144, 88, 15},
-      {135, 178, 201, 88, 8}
-    },
-    { {95, 27, 95, 220, 4},
-      {250, 107, 204, 217, 10},
-      {35, 191, 173, 143, 10},
-      {89, 179, 61, 101, 15}
-    },
-    { {104, 72, 189, 153, 8},
-      {18, 165, 165, 148, 14},
-      {25, 155, 209, 33, 6},
-      {114, 154, 90, 84, 8}
-    },
-    { {235, 245, 28, 134, 10},
-      {75, 23, 53, 243, 3},
-      {86, 19, 138, 253, 7},
-      {204, 250, 206, 141, 2}
-    },
-    { {201, 92, 23, 53, 15},
-      {94, 85, 195, 246, 8},
-      {250, 206, 131, 169, 3},
-      {22, 252, 58, 167, 10}
-    },
-    { {164, 229, 178, 170, 9},
-      {133, 230, 51, 50, 7},
-      {149, 84, 218, 114, 5},
-      {228, 204, 198, 122, 1}
-    },
-    { {137, 187, 40, 109, 9},
-      {79, 34, 31, 78, 12},
-      {155, 97, 77, 217, 1},
-      {55, 47, 132, 79, 2}
-    },
-    { {252, 83, 211, 81, 9},
-      {246, 206, 169, 158, 0},
-      {152, 172, 188, 163, 15},
-      {7, 153, 87, 54, 15}
-    },
-    { {132, 250, 176, 250, 11},
-      {197, 180, 155, 26, 15},
-      {213, 240, 213, 242, 1},
-      {245, 141, 146, 218, 3}
-    },
-    { {135, 156, 9, 173, 7},
-      {220, 48, 86, 103, 10},
-      {235, 89, 3, 158, 1},
-      {94, 102, 160, 195, 11}
-    },
-    { {84, 19, 120, 184, 10},
-      {224, 58, 143, 144, 6},
-      {81, 209, 236, 130, 10},
-      {96, 159, 21, 192, 7}
-    },
-    { {93, 207, 118, 108, 5},
-      {174, 111, 90, 248, 12},
-      {163, 102, 239, 59, 10},
-      {49, 245, 175, 103, 5}
-    },
-    { {15, 128, 112, 181, 8},
-      {170, 0, 147, 85, 6},
-      {26, 208, 224, 31, 0},
-      {106, 172, 144, 5, 5}
-    },
-    { {208, 181, 28, 15, 14},
-      {73, 59, 85, 182, 1},
-      {127, 3, 138, 208, 11},
-      {134, 218, 173, 201, 2}
-    },
-    { {132, 202, 160, 119, 12},
-      {136, 132, 219, 14, 13},
-      {62, 224, 85, 50, 1},
-      {183, 13, 178, 17, 1}
-    },
-    { {237, 211, 180, 253, 12},
-      {202, 167, 251, 222, 6},
-      {59, 242, 220, 187, 7},
-      {103, 189, 254, 85, 3}
-    },
-    { {54, 161, 151, 8, 4},
-      {145, 235, 112, 17, 0},
-      {33, 14, 152, 86, 12},
-      {8, 128, 237, 120, 9}
-    },
-    { {140, 65, 87, 242, 7},
-      {182, 87, 194, 26, 3},
-      {228, 254, 168, 35, 1},
-      {197, 132, 62, 166, 13}
-    },
-    { {236, 146, 34, 145, 13},
-      {198, 64, 249, 134, 6},
-      {184, 148, 68, 147, 7},
-      {102, 25, 240, 38, 3}
-    },
-    { {44, 51, 74, 17, 10},
-      {227, 82, 173, 4, 0},
-      {88, 133, 44, 195, 4},
-      {2, 11, 84, 172, 7}
-    },
-    { {149, 119, 148, 119, 8},
-      {201, 143, 139, 126, 1},
-      {30, 226, 158, 234, 9},
-      {135, 237, 31, 25, 3}
-    },
-    { {79, 158, 57, 137, 13},
-      {214, 32, 93, 245, 14},
-      {185, 25, 199, 159, 2},
-      {122, 251, 160, 70, 11}
-    },
-    { {181, 203, 34, 59, 11},
-      {132, 126, 187, 70, 13},
-      {221, 196, 77, 58, 13},
-      {182, 45, 215, 226, 1}
-    },
-    { {238, 226, 189, 59, 11},
-      {151, 181, 191, 151, 5},
-      {221, 203, 212, 119, 7},
-      {174, 159, 218, 222, 9}
-    },
-    { {133, 212, 25, 195, 12},
-      {208, 4, 85, 126, 3},
-      {60, 57, 130, 186, 1},
-      {199, 234, 162, 0, 11}
-    },
-    { {186, 35, 215, 19, 11},
-      {55, 219, 169, 23, 1},
-      {220, 142, 188, 69, 13},
-      {142, 137, 93, 190, 12}
-    },
-    { {141, 72, 238, 157, 1},
-      {174, 229, 132, 70, 14},
-      {139, 151, 113, 43, 1},
-      {118, 34, 26, 119, 5}
-    },
-    { {120, 69, 116, 14, 9},
-      {46, 47, 33, 176, 5},
-      {151, 2, 234, 33, 14},
-      {160, 216, 79, 71, 4}
-    },
-    { {100, 231, 234, 47, 8},
-      {169, 230, 63, 164, 5},
-      {31, 69, 126, 114, 6},
-      {162, 95, 198, 121, 5}
-    },
-    { {100, 118, 246, 62, 4},
-      {233, 229, 234, 176, 5},
-      {39, 198, 246, 226, 6},
-      {160, 213, 122, 121, 7}
-    },
-    { {14, 238, 158, 149, 0},
-      {139, 197, 156, 53, 10},
-      {10, 151, 151, 119, 0},
-      {90, 195, 154, 61, 1}
-    },
-    { {220, 175, 168, 110, 11},
-      {143, 186, 31, 170, 13},
-      {215, 97, 95, 83, 11},
-      {181, 95, 133, 223, 1}
-    },
-    { {135, 109, 56, 242, 14},
-      {129, 22, 199, 123, 15},
-      {116, 241, 203, 110, 1},
-      {253, 238, 54, 136, 1}
-    },
-    { {59, 235, 39, 76, 5},
-      {31, 111, 120, 73, 12},
-      {163, 46, 77, 125, 12},
-      {57, 33, 239, 111, 8}
-    },
-    { {184, 191, 89, 23, 4},
-      {123, 10, 252, 54, 9},
-      {46, 137, 175, 209, 13},
-      {150, 195, 245, 13, 14}
-    },
-    { {171, 32, 236, 13, 0},
-      {43, 161, 36, 71, 4},
-      {11, 3, 112, 77, 5},
-      {46, 34, 72, 93, 4}
-    },
-    { {13, 85, 26, 83, 3},
-      {198, 86, 132, 124, 1},
-      {204, 165, 138, 171, 0},
-      {131, 226, 22, 166, 3}
-    },
-    { {164, 73, 46, 167, 8},
-      {136, 71, 39, 6, 15},
-      {30, 87, 73, 34, 5},
-      {246, 14, 78, 33, 1}
-    },
-    { {93, 108, 92, 103, 6},
-      {171, 29, 70, 252, 9},
-      {110, 99, 163, 107, 10},
-      {147, 246, 43, 141, 5}
-    },
-    { {153, 4, 153, 70, 10},
-      {26, 152, 5, 122, 1},
-      {86, 41, 146, 9, 9},
-      {133, 234, 1, 149, 8}
-    },
-    { {10, 157, 128, 226, 6},
-      {66, 146, 82, 41, 11},
-      {100, 112, 27, 149, 0},
-      {217, 68, 164, 148, 2}
-    },
-    { {105, 134, 183, 41, 15},
-      {22, 241, 123, 244, 4},
-      {249, 78, 214, 25, 6},
-      {34, 253, 232, 246, 8}
-    },
-    { {143, 173, 130, 44, 13},
-      {143, 226, 83, 99, 8},
-      {179, 68, 27, 95, 1},
-      {28, 108, 164, 127, 1}
-    },
-    { {226, 67, 95, 38, 3},
-      {60, 87, 46, 147, 1},
-      {198, 79, 172, 36, 7},
-      {140, 151, 78, 163, 12}
-    },
-    { {209, 155, 215, 78, 11},
-      {124, 251, 25, 218, 9},
-      {215, 46, 189, 152, 11},
-      {149, 185, 141, 243, 14}
-    },
-    { {196, 218, 25, 133, 15},
-      {220, 20, 93, 150, 10},
-      {250, 25, 133, 178, 3},
-      {86, 155, 162, 131, 11}
-    },
-    { {26, 193, 30, 251, 4},
-      {2, 111, 214, 29, 3},
-      {45, 247, 136, 53, 8},
-      {203, 134, 191, 100, 0}
-    },
-    { {17, 45, 28, 17, 1},
-      {5, 11, 132, 116, 8},
-      {136, 131, 139, 72, 8},
-      {18, 226, 29, 10, 0}
-    },
-    { {45, 76, 8, 144, 6},
-      {130, 20, 228, 96, 10},
-      {96, 145, 3, 43, 4},
-      {80, 98, 114, 132, 1}
-    },
-    { {108, 235, 79, 250, 4},
-      {179, 103, 254, 136, 11},
-      {37, 255, 45, 115, 6},
-      {209, 23, 254, 108, 13}
-    },
-    { {171, 203, 198, 115, 11},
-      {38, 215, 187, 79, 9},
-      {220, 230, 61, 61, 5},
-      {159, 45, 222, 182, 4}
-    },
-    { {40, 32, 233, 173, 13},
-      {63, 160, 103, 4, 6},
-      {187, 89, 112, 65, 4},
-      {98, 14, 96, 95, 12}
-    },
-    { {127, 250, 209, 178, 2},
-      {243, 156, 186, 209, 11},
-      {68, 216, 181, 255, 14},
-      {216, 181, 211, 156, 15}
-    },
-    { {27, 102, 106, 88, 7},
-      {39, 124, 204, 105, 4},
-      {225, 165, 102, 109, 8},
-      {41, 99, 51, 238, 4}
-    },
-    { {164, 137, 72, 44, 7},
-      {172, 50, 118, 2, 8},
-      {227, 65, 41, 18, 5},
-      {20, 6, 228, 195, 5}
-    },
-    { {141, 42, 28, 71, 0},
-      {139, 1, 12, 94, 9},
-      {14, 35, 133, 75, 1},
-      {151, 163, 8, 13, 1}
-    },
-    { {125, 182, 84, 216, 0},
-      {227, 41, 184, 248, 2},
-      {1, 178, 166, 219, 14},
-      {65, 241, 217, 76, 7}
-    },
-    { {179, 222, 10, 136, 11},
-      {68, 124, 61, 99, 10},
-      {209, 21, 7, 188, 13},
-      {92, 107, 195, 226, 2}
-    },
-    { {214, 120, 202, 34, 1},
-      {229, 204, 6, 131, 9},
-      {132, 69, 49, 230, 11},
-      {156, 22, 3, 58, 7}
-    },
-    { {136, 97, 82, 97, 11},
-      {39, 86, 3, 30, 0},
-      {216, 100, 168, 97, 1},
-      {7, 140, 6, 174, 4}
-    },
-    { {0, 238, 90, 84, 7},
-      {45, 84, 220, 56, 8},
-      {226, 165, 167, 112, 0},
-      {17, 195, 178, 171, 4}
-    },
-    { {84, 105, 30, 139, 4},
-      {129, 111, 68, 148, 11},
-      {45, 23, 137, 98, 10},
-      {210, 146, 47, 104, 1}
-    },
-    { {128, 254, 13, 106, 8},
-      {81, 37, 31, 42, 9},
-      {21, 107, 7, 240, 1},
-      {149, 79, 138, 72, 10}
-    },
-    { {195, 127, 154, 209, 2},
-      {65, 214, 140, 255, 10},
-      {72, 181, 159, 236, 3},
-      {95, 243, 22, 184, 2}
-    },
-    { {57, 235, 155, 203, 12},
-      {19, 238, 125, 92, 11},
-      {61, 61, 157, 121, 12},
-      {211, 171, 231, 124, 8}
-    },
-    { {156, 205, 246, 33, 8},
-      {162, 207, 19, 54, 12},
-      {24, 70, 251, 51, 9},
-      {54, 204, 143, 52, 5}
-    },
-    { {83, 192, 184, 251, 11},
-      {4, 188, 151, 221, 7},
-      {221, 241, 208, 60, 10},
-      {235, 190, 147, 210, 0}
-    },
-    { {159, 93, 81, 153, 0},
-      {242, 46, 128, 119, 10},
-      {9, 152, 171, 175, 9},
-      {94, 224, 23, 68, 15}
-    },
-    { {208, 152, 110, 185, 3},
-      {100, 121, 150, 134, 14},
-      {201, 215, 97, 144, 11},
-      {118, 22, 153, 226, 6}
-    },
-    { {21, 133, 42, 206, 6},
-      {136, 122, 84, 104, 7},
-      {103, 53, 74, 26, 8},
-      {225, 98, 165, 225, 1}
-    },
-    { {144, 212, 121, 19, 3},
-      {116, 28, 148, 54, 5},
-      {204, 137, 226, 176, 9},
-      {166, 194, 147, 130, 14}
-    },
-    { {44, 22, 172, 202, 12},
-      {194, 161, 109, 40, 7},
-      {53, 51, 86, 131, 4},
-      {225, 75, 104, 84, 3}
-    },
-    { {112, 226, 233, 181, 14},
-      {57, 156, 255, 132, 6},
-      {122, 217, 116, 112, 14},
-      {98, 31, 243, 153, 12}
-    },
-    { {36, 160, 106, 178, 15},
-      {165, 80, 247, 0, 7},
-      {244, 213, 96, 82, 4},
-      {224, 14, 240, 170, 5}
-    },
-    { {114, 1, 237, 44, 10},
-      {56, 187, 39, 129, 4},
-      {83, 75, 120, 4, 14},
-      {40, 30, 77, 209, 12}
-    },
-    { {76, 99, 9, 66, 8},
-      {147, 6, 13, 136, 1},
-      {20, 41, 12, 99, 2},
-      {129, 27, 6, 12, 9}
-    },
-    { {6, 185, 203, 230, 13},
-      {253, 194, 87, 9, 11},
-      {182, 125, 57, 214, 0},
-      {217, 14, 164, 59, 15}
-    },
-    { {215, 246, 104, 218, 12},
-      {225, 44, 221, 235, 7},
-      {53, 177, 102, 254, 11},
-      {237, 123, 179, 72, 7}
-    },
-    { {129, 109, 246, 113, 1},
-      {37, 199, 130, 126, 12},
-      {136, 230, 251, 104, 1},
-      {55, 228, 30, 58, 4}
-    },
-    { {88, 117, 65, 240, 5},
-      {119, 14, 194, 168, 2},
-      {160, 248, 42, 225, 10},
-      {65, 84, 55, 14, 14}
-    },
-    { {74, 115, 6, 33, 0},
-      {67, 71, 10, 133, 0},
-      {8, 70, 12, 229, 2},
-      {10, 21, 14, 44, 2}
-    },
-    { {72, 9, 86, 13, 1},
-      {46, 99, 0, 148, 8},
-      {139, 6, 169, 1, 2},
-      {18, 144, 12, 103, 4}
-    },
-    { {59, 153, 72, 245, 11},
-      {110, 26, 183, 77, 10},
-      {218, 241, 41, 157, 12},
-      {91, 46, 213, 135, 6}
-    },
-    { {54, 150, 213, 148, 6},
-      {248, 153, 248, 49, 2},
-      {98, 154, 182, 150, 12},
-      {72, 193, 249, 145, 15}
-    },
-    { {81, 34, 220, 136, 12},
-      {33, 169, 77, 208, 2},
-      {49, 19, 180, 72, 10},
-      {64, 187, 41, 88, 4}
-    },
-    { {168, 69, 58, 219, 0},
-      {2, 102, 164, 62, 7},
-      {13, 181, 202, 33, 5},
-      {231, 194, 86, 100, 0}
-    },
-    { {180, 120, 208, 7, 12},
-      {233, 140, 97, 22, 9},
-      {62, 0, 177, 226, 13},
-      {150, 136, 99, 25, 7}
-    },
-    { {213, 175, 225, 90, 1},
-      {181, 170, 152, 234, 13},
-      {133, 168, 127, 90, 11},
-      {181, 113, 149, 90, 13}
-    },
-    { {4, 255, 169, 156, 13},
-      {221, 166, 221, 32, 14},
-      {179, 153, 95, 242, 0},
-      {112, 75, 182, 91, 11}
-    },
-    { {178, 170, 134, 106, 1},
-      {5, 233, 58, 11, 9},
-      {133, 102, 21, 84, 13},
-      {157, 5, 201, 122, 0}
-    },
-    { {33, 202, 57, 14, 7},
-      {28, 52, 124, 80, 13},
-      {231, 9, 197, 56, 4},
-      {176, 163, 226, 195, 8}
-    },
-    { {217, 149, 56, 136, 0},
-      {66, 42, 20, 242, 6},
-      {1, 17, 202, 153, 11},
-      {100, 242, 133, 68, 2}
-    },
-    { {158, 66, 134, 121, 2},
-      {130, 253, 138, 15, 0},
-      {73, 230, 20, 39, 9},
-      {15, 5, 27, 244, 1}
-    },
-    { {35, 126, 230, 40, 15},
-      {101, 245, 107, 97, 12},
-      {241, 70, 119, 236, 4},
-      {56, 109, 106, 250, 6}
-    },
-    { {223, 217, 194, 111, 1},
-      {238, 238, 18, 207, 9},
-      {143, 100, 57, 191, 11},
-      {159, 52, 135, 119, 7}
-    },
-    { {134, 37, 95, 146, 14},
-      {177, 83, 197, 51, 3},
-      {116, 159, 170, 70, 1},
-      {204, 202, 60, 168, 13}
-    },
-    { {89, 24, 159, 35, 8},
-      {82, 201, 7, 212, 9},
-      {28, 79, 145, 137, 10},
-      {146, 190, 9, 52, 10}
-    },
-    { {83, 168, 9, 113, 7},
-      {21, 24, 214, 205, 8},
-      {232, 233, 1, 92, 10},
-      {27, 54, 177, 138, 8}
-    },
-    { {8, 171, 22, 118, 15},
-      {15, 83, 219, 24, 9},
-      {246, 230, 141, 81, 0},
-      {145, 141, 188, 175, 0}
-    },
-    { {249, 140, 152, 28, 13},
-      {14, 168, 245, 242, 8},
-      {179, 129, 147, 25, 15},
-      {20, 250, 241, 87, 0}
-    },
-    { {249, 136, 239, 149, 11},
-      {62, 217, 181, 198, 14},
-      {218, 159, 113, 25, 15},
-      {118, 58, 217, 183, 12}
-    },
-    { {31, 2, 254, 30, 14},
-      {170, 249, 205, 81, 5},
-      {119, 135, 244, 15, 8},
-      {168, 171, 57, 245, 5}
-    },
-    { {104, 234, 254, 163, 13},
-      {39, 197, 127, 148, 15},
-      {188, 87, 245, 113, 6},
-      {242, 159, 234, 62, 4}
-    },
-    { {126, 145, 79, 240, 6},
-      {242, 91, 246, 137, 2},
-      {96, 255, 40, 151, 14},
-      {73, 22, 253, 164, 15}
-    },
-    { {44, 149, 20, 92, 13},
-      {206, 35, 241, 56, 0},
-      {179, 162, 138, 147, 4},
-      {1, 200, 252, 71, 3}
-    },
-    { {62, 147, 44, 208, 8},
-      {194, 11, 189, 9, 6},
-      {16, 179, 76, 151, 12},
-      {105, 11, 221, 4, 3}
-    },
-    { {183, 92, 175, 40, 3},
-      {212, 253, 38, 99, 12},
-      {193, 79, 83, 174, 13},
-      {60, 102, 75, 242, 11}
-    },
-    { {186, 245, 114, 60, 11},
-      {111, 126, 179, 51, 4},
-      {211, 196, 234, 245, 13},
-      {44, 204, 215, 239, 6}
-    },
-    { {121, 203, 18, 140, 13},
-      {14, 110, 121, 208, 10},
-      {179, 20, 141, 57, 14},
-      {80, 185, 231, 103, 0}
-    },
-    { {64, 87, 46, 30, 0},
-      {72, 103, 140, 160, 5},
-      {7, 135, 78, 160, 2},
-      {160, 83, 30, 97, 2}
-    },
-    { {82, 212, 150, 97, 15},
-      {68, 221, 83, 189, 0},
-      {248, 102, 146, 180, 10},
-      {11, 220, 171, 178, 2}
-    },
-    { {177, 112, 92, 13, 10},
-      {105, 61, 37, 86, 0},
-      {91, 3, 160, 232, 13},
-      {6, 170, 75, 201, 6}
-    },
-    { {99, 49, 219, 103, 3},
-      {125, 210, 38, 221, 1},
-      {206, 109, 184, 204, 6},
-      {139, 182, 68, 187, 14}
-    },
-    { {16, 154, 188, 196, 1},
-      {76, 137, 28, 24, 14},
-      {130, 51, 213, 144, 8},
-      {113, 131, 137, 19, 2}
-    },
-    { {96, 60, 124, 104, 15},
-      {101, 49, 103, 184, 12},
-      {241, 99, 227, 192, 6},
-      {49, 222, 104, 202, 6}
-    },
-    { {115, 50, 161, 255, 11},
-      {93, 184, 171, 205, 7},
-      {223, 248, 84, 204, 14},
-      {235, 61, 81, 219, 10}
-    },
-    { {61, 143, 96, 230, 4},
-      {170, 10, 122, 104, 15},
-      {38, 112, 111, 27, 12},
-      {241, 101, 229, 5, 5}
-    },
-    { {202, 97, 172, 50, 9},
-      {7, 135, 135, 131, 5},
-      {148, 195, 88, 101, 3},
-      {172, 30, 30, 30, 0}
-    },
-    { {132, 25, 50, 28, 14},
-      {200, 114, 193, 18, 12},
-      {115, 132, 201, 130, 1},
-      {52, 136, 52, 225, 3}
-    },
-    { {171, 167, 29, 138, 7},
-      {23, 51, 124, 115, 3},
-      {229, 27, 142, 93, 5},
-      {204, 227, 236, 206, 8}
-    },
-    { {220, 105, 76, 91, 7},
-      {167, 63, 196, 142, 9},
-      {237, 163, 41, 99, 11},
-      {151, 18, 63, 206, 5}
-    },
-    { {244, 156, 252, 224, 5},
-      {228, 137, 118, 186, 14},
-      {160, 115, 243, 146, 15},
-      {117, 214, 233, 18, 7}
-    },
-    { {200, 69, 243, 60, 3},
-      {62, 246, 130, 178, 4},
-      {195, 204, 250, 33, 3},
-      {36, 212, 22, 247, 12}
-    },
-    { {104, 74, 251, 82, 12},
-      {50, 196, 237, 152, 13},
-      {52, 173, 245, 33, 6},
-      {177, 155, 114, 52, 12}
-    },
-    { {214, 20, 91, 29, 3},
-      {252, 120, 132, 183, 0},
-      {203, 141, 162, 134, 11},
-      {14, 210, 17, 227, 15}
-    },
-    { {16, 253, 223, 173, 12},
-      {121, 239, 87, 52, 10},
-      {59, 95, 187, 240, 8},
-      {82, 206, 175, 121, 14}
-    },
-    { {31, 139, 72, 20, 8},
-      {170, 10, 157, 65, 8},
-      {18, 129, 45, 31, 8},
-      {24, 43, 149, 5, 5}
-    },
-    { {156, 50, 163, 233, 3},
-      {215, 248, 10, 14, 6},
-      {201, 124, 84, 195, 9},
-      {103, 5, 1, 254, 11}
-    },
-    { {157, 108, 124, 56, 7},
-      {167, 61, 198, 114, 12},
-      {225, 195, 227, 107, 9},
-      {52, 230, 59, 206, 5}
-    },
-    { {183, 3, 177, 221, 5},
-      {156, 170, 232, 95, 6},
-      {171, 184, 220, 14, 13},
-      {111, 161, 117, 83, 9}
-    },
-    { {111, 221, 59, 152, 0},
-      {210, 102, 180, 241, 14},
-      {1, 157, 203, 191, 6},
-      {120, 242, 214, 100, 11}
-    },
-    { {178, 62, 176, 218, 4},
-      {65, 168, 232, 59, 15},
-      {37, 176, 215, 196, 13},
-      {253, 193, 113, 88, 2}
-    },
-    { {115, 173, 103, 162, 0},
-      {49, 75, 50, 225, 15},
-      {4, 94, 107, 92, 14},
-      {248, 116, 205, 40, 12}
-    },
-    { {83, 97, 3, 190, 8},
-      {25, 110, 131, 193, 3},
-      {23, 220, 8, 108, 10},
-      {200, 60, 23, 105, 8}
-    },
-    { {214, 122, 66, 252, 3},
-      {237, 124, 138, 139, 10},
-      {195, 244, 37, 230, 11},
-      {93, 21, 19, 235, 7}
-    },
-    { {31, 40, 119, 191, 6},
-      {187, 121, 194, 85, 15},
-      {111, 222, 225, 79, 8},
-      {250, 164, 57, 237, 13}
-    },
-    { {45, 103, 170, 137, 12},
-      {131, 230, 109, 100, 6},
-      {57, 21, 94, 107, 4},
-      {98, 107, 102, 124, 1}
-    },
-    { {168, 55, 137, 133, 0},
-      {91, 130, 44, 38, 2},
-      {10, 25, 30, 193, 5},
-      {70, 67, 68, 29, 10}
-    },
-    { {47, 235, 63, 25, 12},
-      {147, 103, 253, 85, 12},
-      {57, 143, 205, 127, 4},
-      {58, 171, 254, 108, 9}
-    },
-    { {41, 160, 212, 118, 5},
-      {47, 129, 242, 88, 1},
-      {166, 226, 176, 89, 4},
-      {129, 164, 248, 31, 4}
-    },
-    { {65, 177, 230, 167, 15},
-      {109, 211, 83, 196, 7},
-      {254, 86, 120, 216, 2},
-      {226, 60, 172, 187, 6}
-    },
-    { {248, 93, 126, 140, 7},
-      {110, 127, 100, 178, 14},
-      {227, 23, 235, 161, 15},
-      {116, 210, 111, 231, 6}
-    },
-    { {133, 48, 143, 35, 4},
-      {209, 193, 70, 70, 1},
-      {44, 79, 16, 202, 1},
-      {134, 38, 40, 56, 11}
-    },
-    { {121, 131, 156, 71, 5},
-      {14, 139, 124, 220, 1},
-      {174, 35, 156, 25, 14},
-      {131, 179, 237, 23, 0}
-    },
-    { {75, 124, 102, 113, 8},
-      {99, 69, 131, 237, 12},
-      {24, 230, 99, 237, 2},
-      {59, 124, 26, 44, 6}
-    },
-    { {231, 237, 2, 5, 2},
-      {137, 86, 48, 231, 8},
-      {74, 4, 11, 126, 7},
-      {30, 112, 198, 169, 1}
-    },
-    { {57, 33, 5, 61, 13},
-      {31, 43, 227, 68, 0},
-      {187, 202, 8, 73, 12},
-      {2, 44, 125, 79, 8}
-    },
-    { {46, 92, 218, 7, 3},
-      {238, 212, 36, 53, 9},
-      {206, 5, 179, 167, 4},
-      {154, 194, 66, 183, 7}
-    },
-    { {191, 65, 151, 115, 14},
-      {146, 223, 227, 95, 1},
-      {124, 238, 152, 47, 13},
-      {143, 172, 127, 180, 9}
-    },
-    { {229, 242, 167, 113, 14},
-      {209, 213, 251, 206, 4},
-      {120, 238, 84, 250, 7},
-      {39, 61, 250, 184, 11}
-    },
-    { {189, 13, 222, 45, 14},
-      {170, 251, 103, 118, 8},
-      {123, 71, 187, 11, 13},
-      {22, 238, 109, 245, 5}
-    },
-    { {104, 73, 143, 23, 14},
-      {26, 215, 229, 132, 9},
-      {126, 143, 25, 33, 6},
-      {146, 26, 126, 181, 8}
-    },
-    { {183, 56, 155, 230, 11},
-      {221, 216, 39, 91, 11},
-      {214, 125, 145, 206, 13},
-      {221, 174, 65, 187, 11}
-    },
-    { {41, 127, 247, 175, 7},
-      {127, 247, 106, 116, 15},
-      {239, 94, 255, 233, 4},
-      {242, 229, 110, 255, 14}
-    },
-    { {177, 201, 139, 131, 7},
-      {20, 222, 116, 70, 11},
-      {236, 29, 25, 56, 13},
-      {214, 34, 231, 178, 8}
-    },
-    { {112, 239, 122, 3, 2},
-      {33, 94, 60, 180, 13},
-      {76, 5, 239, 112, 14},
-      {178, 211, 199, 168, 4}
-    },
-    { {155, 66, 34, 76, 0},
-      {10, 108, 8, 75, 4},
-      {3, 36, 68, 45, 9},
-      {45, 33, 3, 101, 0}
-    },
-    { {45, 220, 24, 13, 15},
-      {206, 52, 117, 116, 8},
-      {251, 1, 131, 187, 4},
-      {18, 234, 226, 199, 3}
-    },
-    { {10, 189, 5, 237, 15},
-      {95, 51, 83, 45, 10},
-      {251, 122, 11, 213, 0},
-      {91, 76, 172, 207, 10}
-    },
-    { {225, 190, 133, 89, 1},
-      {85, 161, 184, 238, 8},
-      {137, 170, 23, 216, 7},
-      {23, 113, 216, 90, 10}
-    },
-    { {145, 183, 86, 114, 7},
-      {101, 91, 218, 122, 1},
-      {228, 230, 174, 216, 9},
-      {133, 229, 189, 170, 6}
-    },
-    { {45, 22, 243, 125, 11},
-      {254, 240, 171, 124, 4},
-      {219, 236, 246, 139, 4},
-      {35, 237, 80, 247, 15}
-    },
-    { {39, 176, 238, 193, 6},
-      {225, 209, 116, 77, 6},
-      {104, 55, 112, 222, 4},
-      {107, 34, 232, 184, 7}
-    },
-    { {108, 133, 130, 249, 13},
-      {134, 226, 243, 172, 2},
-      {185, 244, 26, 19, 6},
-      {67, 92, 244, 118, 1}
-    },
-    { {115, 83, 40, 110, 3},
-      {76, 62, 46, 201, 5},
-      {199, 97, 76, 172, 14},
-      {169, 55, 71, 195, 2}
-    },
-    { {97, 193, 148, 57, 1},
-      {4, 167, 178, 212, 0},
-      {137, 194, 152, 56, 6},
-      {2, 180, 222, 82, 0}
-    },
-    { {123, 144, 243, 154, 9},
-      {118, 232, 177, 209, 7},
-      {149, 156, 240, 157, 14},
-      {232, 184, 209, 118, 14}
-    },
-    { {199, 152, 208, 205, 5},
-      {236, 160, 80, 223, 10},
-      {171, 48, 177, 158, 3},
-      {95, 176, 160, 83, 7}
-    },
-    { {40, 109, 39, 77, 11},
-      {31, 119, 33, 44, 12},
-      {219, 46, 75, 97, 4},
-      {51, 72, 78, 239, 8}
-    },
-    { {217, 203, 12, 182, 4},
-      {10, 15, 222, 194, 11},
-      {38, 211, 13, 57, 11},
-      {212, 55, 191, 5, 0}
-    },
-    { {74, 39, 247, 51, 6},
-      {51, 211, 202, 181, 5},
-      {108, 206, 254, 69, 2},
-      {170, 213, 60, 188, 12}
-    },
-    { {58, 192, 163, 225, 10},
-      {18, 220, 51, 13, 6},
-      {88, 124, 80, 53, 12},
-      {107, 12, 195, 180, 8}
-    },
-    { {7, 221, 220, 229, 7},
-      {236, 151, 86, 125, 10},
-      {234, 115, 187, 190, 0},
-      {91, 230, 174, 147, 7}
-    },
-    { {136, 88, 155, 155, 11},
-      {86, 244, 133, 22, 11},
-      {221, 157, 145, 161, 1},
-      {214, 138, 18, 246, 10}
-    },
-    { {138, 23, 163, 27, 11},
-      {86, 242, 137, 39, 5},
-      {221, 140, 94, 133, 1},
-      {174, 73, 20, 246, 10}
-    },
-    { {238, 5, 82, 209, 7},
-      {166, 82, 224, 191, 2},
-      {232, 180, 170, 7, 7},
-      {79, 208, 116, 166, 5}
-    },
-    { {187, 95, 31, 51, 1},
-      {86, 79, 174, 119, 9},
-      {140, 207, 143, 173, 13},
-      {158, 231, 95, 38, 10}
-    },
-    { {208, 60, 187, 190, 2},
-      {89, 248, 134, 178, 15},
-      {71, 221, 211, 192, 11},
-      {244, 214, 17, 249, 10}
-    },
-    { {152, 244, 149, 172, 6},
-      {91, 189, 82, 50, 2},
-      {99, 90, 146, 241, 9},
-      {68, 196, 171, 221, 10}
-    },
-    { {197, 139, 251, 112, 15},
-      {180, 210, 223, 218, 12},
-      {240, 237, 253, 26, 3},
-      {53, 191, 180, 178, 13}
-    },
-    { {122, 253, 6, 239, 8},
-      {75, 111, 51, 173, 11},
-      {31, 118, 11, 245, 14},
-      {219, 92, 207, 109, 2}
-    },
-    { {81, 109, 127, 193, 5},
-      {53, 79, 68, 252, 14},
-      {168, 63, 235, 104, 10},
-      {115, 242, 47, 42, 12}
-    },
-    { {187, 149, 178, 239, 2},
-      {74, 250, 50, 127, 7},
-      {79, 116, 218, 157, 13},
-      {239, 228, 197, 245, 2}
-    },
-    { {74, 73, 174, 244, 10},
-      {10, 215, 135, 137, 14},
-      {82, 247, 89, 37, 2},
-      {121, 30, 30, 181, 0}
-    },
-    { {121, 22, 119, 209, 9},
-      {118, 73, 169, 252, 6},
-      {152, 190, 230, 137, 14},
-      {99, 249, 89, 38, 14}
-    },
-    { {171, 195, 19, 250, 3},
-      {22, 118, 186, 91, 3},
-      {197, 252, 140, 61, 5},
-      {205, 165, 214, 230, 8}
-    },
-    { {97, 72, 188, 236, 1},
-      {12, 165, 38, 216, 14},
-      {131, 115, 209, 40, 6},
-      {113, 182, 74, 83, 0}
-    },
-    { {189, 91, 56, 250, 15},
-      {198, 62, 239, 90, 15},
-      {245, 241, 205, 171, 13},
-      {245, 175, 119, 198, 3}
-    },
-    { {167, 203, 22, 91, 5},
-      {132, 103, 248, 95, 9},
-      {173, 166, 141, 62, 5},
-      {159, 161, 254, 98, 1}
-    },
-    { {122, 215, 157, 221, 12},
-      {90, 175, 253, 189, 2},
-      {59, 187, 158, 181, 14},
-      {75, 219, 255, 85, 10}
-    },
-    { {30, 33, 123, 48, 10},
-      {179, 90, 135, 17, 4},
-      {80, 205, 232, 71, 8},
-      {40, 142, 21, 172, 13}
-    },
-    { {7, 106, 159, 128, 15},
-      {149, 213, 77, 81, 10},
-      {240, 31, 149, 110, 0},
-      {88, 171, 42, 186, 9}
-    },
-    { {66, 20, 244, 73, 5},
-      {100, 161, 64, 189, 4},
-      {169, 34, 242, 132, 2},
-      {43, 208, 40, 82, 6}
-    },
-    { {90, 77, 21, 204, 4},
-      {26, 47, 64, 185, 10},
-      {35, 58, 139, 37, 10},
-      {89, 208, 47, 69, 8}
-    },
-    { {42, 237, 24, 136, 14},
-      {3, 54, 117, 49, 10},
-      {113, 17, 139, 117, 4},
-      {88, 202, 230, 204, 0}
-    },
-    { {74, 162, 225, 254, 13},
-      {63, 160, 219, 137, 7},
-      {183, 248, 116, 85, 2},
-      {233, 29, 176, 95, 12}
-    },
-    { {132, 142, 174, 178, 2},
-      {128, 209, 158, 34, 15},
-      {68, 215, 87, 18, 1},
-      {244, 71, 152, 176, 1}
-    },
-    { {51, 40, 220, 225, 13},
-      {37, 137, 103, 93, 10},
-      {184, 115, 177, 76, 12},
-      {91, 174, 105, 26, 4}
-    },
-    { {58, 219, 131, 61, 10},
-      {90, 254, 187, 5, 8},
-      {91, 204, 29, 181, 12},
-      {26, 13, 215, 245, 10}
-    },
-    { {115, 169, 29, 159, 13},
-      {29, 43, 245, 213, 11},
-      {191, 155, 137, 92, 14},
-      {218, 186, 253, 75, 8}
-    },
-    { {4, 109, 218, 103, 10},
-      {169, 214, 7, 60, 9},
-      {94, 101, 187, 98, 0},
-      {147, 206, 6, 185, 5}
-    },
-    { {58, 203, 120, 189, 13},
-      {46, 46, 255, 21, 14},
-      {187, 209, 237, 53, 12},
-      {122, 143, 247, 71, 4}
-    },
-    { {206, 153, 231, 26, 12},
-      {242, 227, 209, 131, 13},
-      {53, 142, 121, 151, 3},
-      {188, 24, 188, 116, 15}
-    },
-    { {165, 37, 165, 84, 6},
-      {153, 147, 224, 106, 4},
-      {98, 170, 90, 74, 5},
-      {37, 96, 124, 153, 9}
-    },
-    { {240, 63, 168, 232, 1},
-      {69, 170, 46, 170, 14},
-      {129, 113, 95, 192, 15},
-      {117, 87, 69, 90, 2}
-    },
-    { {118, 229, 192, 251, 1},
-      {165, 174, 178, 173, 3},
-      {141, 240, 58, 118, 14},
-      {203, 84, 215, 90, 5}
-    },
-    { {227, 99, 237, 110, 12},
-      {57, 167, 111, 203, 5},
-      {55, 107, 124, 108, 7},
-      {173, 63, 110, 89, 12}
-    },
-    { {116, 249, 37, 224, 5},
-      {213, 15, 114, 136, 14},
-      {160, 122, 73, 242, 14},
-      {113, 20, 239, 10, 11}
-    },
-    { {198, 217, 168, 122, 2},
-      {192, 182, 150, 139, 13},
-      {69, 225, 89, 182, 3},
-      {189, 22, 150, 208, 3}
-    },
-    { {13, 96, 234, 117, 11},
-      {175, 212, 135, 76, 4},
-      {218, 229, 112, 107, 0},
-      {35, 46, 18, 191, 5}
-    },
-    { {51, 227, 74, 122, 13},
-      {37, 110, 255, 73, 1},
-      {181, 229, 44, 124, 12},
-      {137, 47, 247, 106, 4}
-    },
-    { {113, 122, 201, 96, 4},
-      {113, 140, 110, 200, 8},
-      {32, 105, 53, 232, 14},
-      {17, 55, 99, 24, 14}
-    },
-    { {152, 138, 48, 249, 12},
-      {2, 40, 219, 30, 14},
-      {57, 240, 197, 17, 9},
-      {119, 141, 177, 68, 0}
-    },
-    { {46, 163, 26, 179, 12},
-      {131, 66, 255, 21, 3},
-      {60, 213, 140, 87, 4},
-      {202, 143, 244, 44, 1}
-    },
-    { {172, 182, 25, 142, 10},
-      {219, 48, 61, 50, 3},
-      {87, 25, 134, 211, 5},
-      {196, 203, 192, 205, 11}
-    },
-    { {240, 101, 182, 107, 5},
-      {5, 239, 98, 190, 5},
-      {173, 102, 218, 96, 15},
-      {167, 212, 111, 122, 0}
-    },
-    { {168, 198, 88, 212, 0},
-      {42, 4, 188, 58, 2},
-      {2, 177, 166, 49, 5},
-      {69, 195, 210, 5, 4}
-    },
-    { {204, 173, 140, 128, 11},
-      {135, 147, 21, 162, 10},
-      {208, 19, 27, 83, 3},
-      {84, 90, 140, 158, 1}
-    },
-    { {163, 169, 133, 130, 14},
-      {17, 147, 113, 67, 11},
-      {116, 26, 25, 92, 5},
-      {220, 40, 236, 152, 8}
-    },
-    { {236, 44, 102, 29, 0},
-      {171, 97, 160, 166, 12},
-      {11, 134, 99, 67, 7},
-      {54, 80, 88, 109, 5}
-    },
-    { {25, 228, 167, 179, 8},
-      {19, 205, 147, 100, 7},
-      {28, 222, 82, 121, 8},
-      {226, 108, 155, 60, 8}
-    },
-    { {141, 26, 103, 29, 6},
-      {250, 113, 200, 70, 12},
-      {107, 142, 101, 139, 1},
-      {54, 33, 56, 229, 15}
-    },
-    { {178, 43, 3, 194, 13},
-      {21, 74, 105, 11, 11},
-      {180, 60, 13, 68, 13},
-      {221, 9, 101, 42, 8}
-    },
-    { {233, 107, 129, 42, 2},
-      {19, 182, 42, 194, 9},
-      {69, 72, 29, 105, 7},
-      {148, 53, 70, 220, 8}
-    },
-    { {175, 188, 151, 185, 4},
-      {211, 225, 242, 119, 10},
-      {41, 222, 147, 223, 5},
-      {94, 228, 248, 124, 11}
-    },
-    { {46, 29, 146, 160, 8},
-      {194, 194, 35, 49, 10},
-      {16, 84, 155, 135, 4},
-      {88, 204, 68, 52, 3}
-    },
-    { {20, 26, 214, 160, 3},
-      {228, 217, 10, 16, 10},
-      {192, 86, 181, 130, 8},
-      {80, 133, 9, 178, 7}
-    },
-    { {181, 12, 21, 252, 0},
-      {152, 41, 162, 122, 10},
-      {3, 250, 131, 10, 13},
-      {85, 228, 89, 65, 9}
-    },
-    { {95, 40, 182, 146, 9},
-      {135, 201, 129, 209, 15},
-      {148, 150, 209, 79, 10},
-      {248, 184, 25, 62, 1}
-    },
-    { {5, 73, 160, 42, 15},
-      {132, 182, 67, 64, 13},
-      {245, 64, 89, 42, 0},
-      {176, 44, 38, 210, 1}
-    },
-    { {170, 29, 19, 140, 15},
-      {94, 114, 97, 51, 10},
-      {243, 28, 139, 133, 5},
-      {92, 200, 100, 231, 10}
-    },
-    { {214, 197, 212, 242, 6},
-      {160, 159, 210, 187, 3},
-      {100, 242, 186, 54, 11},
-      {205, 212, 191, 144, 5}
-    },
-    { {175, 39, 99, 231, 15},
-      {191, 82, 107, 111, 7},
-      {254, 124, 110, 79, 5},
-      {239, 109, 100, 175, 13}
-    },
-    { {13, 30, 84, 39, 10},
-      {234, 17, 11, 116, 9},
-      {94, 66, 167, 139, 0},
-      {146, 237, 8, 133, 7}
-    },
-    { {105, 13, 29, 67, 9},
-      {22, 3, 37, 252, 9},
-      {156, 43, 139, 9, 6},
-      {147, 250, 76, 6, 8}
-    },
-    { {142, 118, 82, 211, 11},
-      {231, 84, 137, 63, 3},
-      {220, 180, 166, 231, 1},
-      {207, 201, 18, 174, 7}
-    },
-    { {183, 231, 13, 198, 11},
-      {157, 31, 61, 107, 3},
-      {214, 59, 14, 126, 13},
-      {205, 107, 207, 139, 9}
-    },
-    { {91, 61, 61, 135, 11},
-      {95, 27, 5, 245, 15},
-      {222, 27, 203, 205, 10},
-      {250, 250, 13, 143, 10}
-    },
-    { {79, 134, 142, 113, 6},
-      {130, 209, 222, 237, 0},
-      {104, 231, 22, 31, 2},
-      {11, 119, 184, 180, 1}
-    },
-    { {177, 31, 187, 167, 12},
-      {88, 202, 111, 118, 15},
-      {62, 93, 223, 136, 13},
-      {246, 239, 101, 49, 10}
-    },
-    { {128, 174, 197, 152, 2},
-      {49, 177, 152, 34, 10},
-      {65, 154, 55, 80, 1},
-      {84, 65, 152, 216, 12}
-    },
-    { {213, 231, 198, 181, 15},
-      {173, 223, 219, 230, 2},
-      {250, 214, 62, 122, 11},
-      {70, 125, 191, 187, 5}
-    },
-    { {93, 45, 129, 118, 3},
-      {159, 154, 130, 232, 9},
-      {198, 232, 27, 75, 10},
-      {145, 116, 21, 159, 9}
-    },
-    { {203, 168, 201, 76, 1},
-      {63, 160, 20, 203, 8},
-      {131, 41, 49, 93, 3},
-      {29, 50, 128, 95, 12}
-    },
-    { {103, 230, 75, 17, 3},
-      {181, 84, 188, 229, 0},
-      {200, 141, 38, 126, 6},
-      {10, 115, 210, 170, 13}
-    },
-    { {250, 67, 80, 92, 14},
-      {42, 62, 233, 155, 0},
-      {115, 160, 172, 37, 15},
-      {13, 153, 119, 197, 4}
-    },
-    { {240, 150, 174, 222, 7},
-      {76, 249, 252, 170, 7},
-      {231, 183, 86, 144, 15},
-      {229, 83, 249, 243, 2}
-    },
-    { {71, 218, 157, 211, 11},
-      {212, 149, 157, 221, 11},
-      {220, 187, 149, 190, 2},
-      {219, 187, 154, 146, 11}
-    },
-    { {154, 5, 75, 133, 14},
-      {58, 90, 69, 39, 2},
-      {122, 29, 42, 5, 9},
-      {78, 74, 37, 165, 12}
-    },
-    { {120, 108, 53, 241, 11},
-      {23, 29, 163, 188, 14},
-      {216, 250, 195, 97, 14},
-      {115, 220, 91, 142, 8}
-    },
-    { {147, 175, 244, 140, 6},
-      {41, 187, 88, 115, 14},
-      {99, 18, 255, 92, 9},
-      {124, 225, 173, 217, 4}
-    },
-    { {42, 176, 175, 52, 11},
-      {95, 209, 183, 1, 4},
-      {210, 207, 80, 213, 4},
-      {40, 14, 216, 191, 10}
-    },
-    { {240, 11, 250, 99, 1},
-      {36, 202, 46, 158, 13},
-      {140, 101, 253, 0, 15},
-      {183, 151, 69, 50, 4}
-    },
-    { {76, 166, 198, 133, 5},
-      {175, 193, 88, 164, 2},
-      {170, 22, 54, 83, 2},
-      {66, 81, 168, 63, 5}
-    },
-    { {186, 20, 227, 14, 1},
-      {126, 232, 32, 35, 5},
-      {135, 12, 114, 133, 13},
-      {172, 64, 65, 119, 14}
-    },
-    { {33, 208, 242, 145, 8},
-      {96, 196, 177, 84, 6},
-      {24, 148, 240, 184, 4},
-      {98, 168, 210, 48, 6}
-    },
-    { {195, 163, 48, 100, 2},
-      {9, 18, 26, 219, 4},
-      {66, 96, 204, 92, 3},
-      {45, 181, 132, 137, 0}
-    },
-    { {55, 157, 233, 153, 7},
-      {244, 186, 244, 101, 14},
-      {233, 153, 123, 158, 12},
-      {122, 98, 245, 210, 15}
-    },
-    { {34, 132, 160, 94, 1},
-      {12, 160, 176, 41, 5},
-      {135, 160, 82, 20, 4},
-      {169, 64, 208, 83, 0}
-    },
-    { {111, 213, 214, 14, 1},
-      {238, 231, 48, 241, 1},
-      {135, 6, 186, 191, 6},
-      {136, 240, 206, 119, 7}
-    },
-    { {203, 84, 111, 171, 13},
-      {118, 101, 71, 231, 7},
-      {189, 95, 98, 173, 3},
-      {238, 126, 42, 102, 14}
-    },
-    { {156, 42, 145, 229, 8},
-      {155, 136, 11, 30, 10},
-      {26, 120, 149, 67, 9},
-      {87, 141, 1, 29, 9}
-    },
-    { {61, 210, 148, 126, 15},
-      {206, 189, 251, 88, 1},
-      {247, 226, 148, 187, 12},
-      {129, 173, 251, 215, 3}
-    },
-    { {100, 83, 228, 51, 13},
-      {228, 135, 235, 132, 5},
-      {188, 194, 124, 162, 6},
-      {162, 29, 126, 18, 7}
-    },
-    { {43, 198, 86, 24, 12},
-      {34, 101, 249, 113, 0},
-      {49, 134, 166, 61, 4},
-      {8, 233, 250, 100, 4}
-    },
-    { {37, 39, 183, 207, 14},
-      {153, 243, 105, 124, 7},
-      {127, 62, 222, 74, 4},
-      {227, 233, 108, 249, 9}
-    },
-    { {22, 36, 199, 38, 13},
-      {189, 201, 67, 33, 1},
-      {182, 78, 50, 70, 8},
-      {136, 76, 41, 59, 13}
-    },
-    { {202, 176, 164, 248, 14},
-      {67, 177, 211, 139, 6},
-      {113, 242, 80, 213, 3},
-      {109, 28, 184, 220, 2}
-    },
-    { {193, 236, 138, 99, 14},
-      {1, 212, 87, 238, 9},
-      {124, 101, 19, 120, 3},
-      {151, 126, 162, 184, 0}
-    },
-    { {82, 142, 30, 232, 13},
-      {4, 105, 95, 185, 10},
-      {177, 119, 135, 20, 10},
-      {89, 223, 169, 98, 0}
-    },
-    { {254, 163, 79, 210, 9},
-      {183, 75, 189, 139, 3},
-      {148, 191, 44, 87, 15},
-      {205, 27, 221, 46, 13}
-    },
-    { {92, 145, 249, 82, 6},
-      {242, 154, 212, 152, 5},
-      {100, 169, 248, 147, 10},
-      {161, 146, 181, 148, 15}
-    },
-    { {42, 103, 218, 12, 8},
-      {43, 230, 45, 49, 0},
-      {19, 5, 190, 101, 4},
-      {8, 203, 70, 125, 4}
-    },
-    { {111, 147, 7, 201, 2},
-      {210, 115, 56, 205, 2},
-      {73, 62, 12, 159, 6},
-      {75, 49, 204, 228, 11}
-    },
-    { {27, 127, 101, 218, 0},
-      {115, 47, 136, 105, 15},
-      {5, 186, 111, 237, 8},
-      {249, 97, 31, 76, 14}
-    },
-    { {96, 94, 48, 82, 3},
-      {68, 20, 168, 184, 13},
-      {196, 160, 199, 160, 6},
-      {177, 209, 82, 130, 2}
-    },
-    { {187, 3, 116, 51, 0},
-      {34, 11, 170, 87, 5},
-      {12, 194, 236, 13, 13},
-      {174, 165, 93, 4, 4}
-    },
-    { {245, 150, 230, 89, 11},
-      {228, 249, 185, 238, 4},
-      {217, 166, 118, 154, 15},
-      {39, 121, 217, 242, 7}
-    },
-    { {146, 81, 227, 36, 14},
-      {120, 222, 67, 3, 4},
-      {114, 76, 120, 164, 9},
-      {44, 12, 39, 177, 14}
-    },
-    { {37, 129, 147, 161, 3},
-      {148, 210, 50, 84, 2},
-      {200, 92, 152, 26, 4},
-      {66, 164, 196, 178, 9}
-    },
-    { {179, 35, 202, 164, 8},
-      {41, 202, 47, 67, 2},
-      {18, 85, 60, 76, 13},
-      {76, 47, 69, 57, 4}
-    },
-    { {141, 73, 29, 60, 1},
-      {158, 39, 134, 82, 8},
-      {131, 203, 137, 43, 1},
-      {20, 166, 30, 71, 9}
-    },
-    { {227, 51, 36, 195, 13},
-      {69, 3, 105, 207, 7},
-      {188, 50, 76, 204, 7},
-      {239, 57, 108, 10, 2}
-    },
-    { {184, 54, 252, 47, 7},
-      {111, 185, 110, 54, 5},
-      {239, 67, 246, 193, 13},
-      {166, 199, 105, 223, 6}
-    },
-    { {237, 209, 46, 107, 4},
-      {194, 103, 118, 206, 5},
-      {45, 103, 72, 187, 7},
-      {167, 54, 238, 100, 3}
-    },
-    { {235, 71, 59, 247, 10},
-      {26, 86, 175, 255, 7},
-      {94, 253, 206, 45, 7},
-      {239, 255, 86, 165, 8}
-    },
-    { {20, 242, 111, 82, 9},
-      {245, 77, 157, 8, 5},
-      {148, 175, 100, 242, 8},
-      {161, 11, 155, 42, 15}
-    },
-    { {205, 127, 26, 185, 15},
-      {199, 118, 207, 246, 10},
-      {249, 213, 143, 235, 3},
-      {86, 255, 54, 238, 3}
-    },
-    { {198, 53, 226, 175, 3},
-      {237, 242, 2, 167, 7},
-      {207, 84, 122, 198, 3},
-      {238, 84, 4, 251, 7}
-    },
-    { {215, 249, 12, 215, 3},
-      {205, 31, 148, 207, 11},
-      {206, 179, 9, 254, 11},
-      {223, 50, 159, 139, 3}
-    },
-    { {83, 21, 215, 208, 12},
-      {112, 203, 193, 249, 2},
-      {48, 190, 186, 140, 10},
-      {73, 248, 61, 48, 14}
-    },
-    { {86, 18, 116, 213, 1},
-      {236, 9, 136, 157, 6},
-      {138, 178, 228, 134, 10},
-      {107, 145, 25, 3, 7}
-    },
-    { {181, 26, 186, 149, 2},
-      {200, 216, 172, 86, 14},
-      {74, 149, 213, 138, 13},
-      {118, 163, 81, 177, 3}
-    },
-    { {98, 62, 7, 58, 4},
-      {81, 97, 234, 161, 9},
-      {37, 206, 7, 196, 6},
-      {152, 85, 120, 104, 10}
-    },
-    { {235, 252, 157, 72, 14},
-      {83, 181, 117, 251, 8},
-      {113, 43, 147, 253, 7},
-      {29, 250, 234, 220, 10}
-    },
-    { {129, 51, 86, 47, 14},
-      {105, 115, 75, 86, 1},
-      {127, 70, 172, 200, 1},
-      {134, 173, 44, 233, 6}
-    },
-    { {125, 43, 146, 2, 6},
-      {131, 218, 104, 208, 9},
-      {100, 4, 157, 75, 14},
-      {144, 177, 101, 188, 1}
-    },
-    { {144, 85, 192, 202, 6},
-      {96, 190, 64, 42, 3},
-      {101, 48, 58, 160, 9},
-      {197, 64, 39, 208, 6}
-    },
-    { {205, 132, 181, 92, 15},
-      {158, 177, 209, 250, 4},
-      {243, 170, 210, 27, 3},
-      {37, 248, 184, 215, 9}
-    },
-    { {11, 54, 92, 9, 4},
-      {99, 33, 76, 117, 0},
-      {41, 3, 166, 205, 0},
-      {10, 227, 40, 76, 6}
-    },
-    { {190, 98, 7, 5, 10},
-      {155, 93, 41, 7, 0},
-      {90, 14, 4, 103, 13},
-      {14, 9, 75, 173, 9}
-    },
-    { {39, 38, 95, 35, 12},
-      {177, 65, 111, 117, 1},
-      {60, 79, 166, 78, 4},
-      {138, 239, 104, 40, 13}
-    },
-    { {100, 138, 166, 99, 10},
-      {128, 209, 59, 140, 13},
-      {92, 102, 85, 18, 6},
-      {179, 29, 200, 176, 1}
-    },
-    { {254, 101, 69, 2, 13},
-      {183, 15, 97, 163, 1},
-      {180, 10, 42, 103, 15},
-      {140, 88, 111, 14, 13}
-    },
-    { {167, 99, 68, 48, 13},
-      {165, 7, 235, 67, 0},
-      {176, 194, 44, 110, 5},
-      {12, 45, 126, 10, 5}
-    },
-    { {217, 192, 126, 10, 8},
-      {34, 109, 21, 210, 5},
-      {21, 7, 224, 57, 11},
-      {164, 186, 139, 100, 4}
-    },
-    { {29, 104, 212, 20, 13},
-      {175, 141, 193, 80, 8},
-      {178, 130, 177, 107, 8},
-      {16, 168, 59, 31, 5}
-    },
-    { {203, 197, 40, 112, 3},
-      {6, 22, 150, 235, 4},
-      {192, 225, 74, 61, 3},
-      {45, 118, 150, 134, 0}
-    },
-    { {228, 40, 28, 188, 9},
-      {141, 33, 167, 146, 10},
-      {147, 211, 129, 66, 7},
-      {84, 158, 88, 75, 1}
-    },
-    { {225, 221, 170, 221, 6},
-      {72, 246, 244, 238, 14},
-      {107, 181, 91, 184, 7},
-      {119, 114, 246, 241, 2}
-    },
-    { {244, 239, 90, 230, 13},
-      {173, 78, 127, 186, 11},
-      {182, 117, 175, 114, 15},
-      {213, 223, 231, 43, 5}
-    },
-    { {122, 159, 45, 115, 15},
-      {86, 27, 255, 173, 13},
-      {252, 235, 79, 149, 14},
-      {187, 95, 253, 134, 10}
-    },
-    { {189, 215, 111, 86, 6},
-      {250, 95, 252, 106, 5},
-      {102, 175, 110, 187, 13},
-      {165, 99, 255, 165, 15}
-    },
-    { {79, 139, 34, 80, 4},
-      {130, 66, 216, 201, 12},
-      {32, 164, 77, 31, 2},
-      {57, 49, 180, 36, 1}
-    },
-    { {104, 156, 225, 61, 6},
-      {122, 176, 242, 164, 12},
-      {107, 200, 115, 145, 6},
-      {50, 84, 240, 213, 14}
-    },
-    { {23, 125, 226, 145, 13},
-      {229, 206, 193, 101, 14},
-      {184, 148, 123, 238, 8},
-      {122, 104, 55, 58, 7}
-    },
-    { {101, 27, 125, 109, 2},
-      {248, 51, 46, 220, 12},
-      {75, 107, 237, 138, 6},
-      {51, 183, 76, 193, 15}
-    },
-    { {230, 30, 244, 128, 14},
-      {224, 145, 105, 179, 14},
-      {112, 18, 247, 134, 7},
-      {124, 217, 104, 144, 7}
-    },
-    { {10, 131, 197, 183, 14},
-      {58, 147, 219, 5, 3},
-      {126, 218, 60, 21, 0},
-      {202, 13, 188, 149, 12}
-    },
-    { {113, 216, 247, 205, 5},
-      {124, 237, 112, 220, 14},
-      {171, 62, 241, 184, 14},
-      {115, 176, 235, 115, 14}
-    },
-    { {119, 102, 40, 235, 6},
-      {129, 60, 110, 237, 7},
-      {109, 113, 70, 110, 14},
-      {235, 119, 99, 200, 1}
-    },
-    { {164, 71, 35, 16, 2},
-      {144, 86, 168, 34, 4},
-      {64, 140, 78, 34, 5},
-      {36, 65, 86, 160, 9}
-    },
-    { {141, 28, 30, 136, 7},
-      {198, 113, 68, 114, 10},
-      {225, 23, 131, 139, 1},
-      {84, 226, 40, 230, 3}
-    },
-    { {174, 5, 207, 117, 0},
-      {186, 195, 166, 47, 0},
-      {10, 239, 58, 7, 5},
-      {15, 70, 92, 53, 13}
-    },
-    { {242, 185, 238, 5, 10},
-      {105, 219, 53, 135, 12},
-      {90, 7, 121, 212, 15},
-      {62, 26, 205, 185, 6}
-    },
-    { {150, 184, 220, 80, 14},
-      {225, 153, 213, 27, 8},
-      {112, 163, 177, 214, 9},
-      {29, 138, 185, 152, 7}
-    },
-    { {191, 140, 179, 54, 4},
-      {154, 200, 242, 115, 13},
-      {38, 204, 211, 31, 13},
-      {188, 228, 241, 53, 9}
-    },
-    { {77, 139, 178, 107, 7},
-      {134, 242, 90, 220, 13},
-      {237, 100, 221, 27, 2},
-      {179, 181, 164, 246, 1}
-    },
-    { {48, 111, 43, 129, 9},
-      {21, 78, 45, 36, 14},
-      {152, 29, 79, 96, 12},
-      {114, 75, 71, 42, 8}
-    },
-    { {134, 223, 39, 101, 6},
-      {216, 87, 90, 47, 12},
-      {106, 110, 79, 182, 1},
-      {63, 69, 174, 161, 11}
-    },
-    { {201, 63, 168, 244, 10},
-      {75, 146, 143, 234, 14},
-      {82, 241, 95, 201, 3},
-      {117, 127, 20, 157, 2}
-    },
-    { {178, 101, 205, 76, 0},
-      {57, 175, 36, 43, 0},
-      {3, 43, 58, 100, 13},
-      {13, 66, 79, 89, 12}
-    },
-    { {230, 107, 232, 211, 7},
-      {165, 150, 236, 143, 15},
-      {236, 177, 125, 102, 7},
-      {255, 19, 118, 154, 5}
-    },
-    { {172, 157, 252, 25, 5},
-      {230, 163, 244, 54, 12},
-      {169, 131, 251, 147, 5},
-      {54, 194, 252, 86, 7}
-    },
-    { {177, 19, 196, 190, 12},
-      {104, 171, 235, 66, 3},
-      {55, 210, 60, 136, 13},
-      {196, 45, 125, 81, 6}
-    },
-    { {211, 223, 9, 161, 13},
-      {84, 14, 95, 231, 10},
-      {184, 89, 15, 188, 11},
-      {94, 127, 167, 2, 10}
-    },
-    { {238, 69, 143, 67, 7},
-      {150, 215, 100, 175, 1},
-      {236, 47, 26, 39, 7},
-      {143, 82, 110, 182, 9}
-    },
-    { {103, 202, 12, 176, 9},
-      {132, 5, 191, 193, 10},
-      {144, 211, 5, 62, 6},
-      {88, 63, 218, 2, 1}
-    },
-    { {179, 49, 95, 108, 5},
-      {125, 107, 102, 91, 0},
-      {163, 111, 168, 204, 13},
-      {13, 166, 109, 107, 14}
-    },
-    { {51, 113, 11, 210, 2},
-      {81, 94, 164, 73, 3},
-      {68, 189, 8, 236, 12},
-      {201, 34, 87, 168, 10}
-    },
-    { {155, 233, 139, 184, 6},
-      {19, 254, 214, 67, 10},
-      {97, 221, 25, 125, 9},
-      {92, 38, 183, 252, 8}
-    },
-    { {65, 191, 62, 12, 5},
-      {77, 99, 92, 240, 12},
-      {163, 7, 207, 216, 2},
-      {48, 243, 172, 107, 2}
-    },
-    { {39, 180, 57, 11, 8},
-      {209, 32, 53, 117, 5},
-      {29, 9, 194, 222, 4},
-      {170, 234, 192, 72, 11}
-    },
-    { {22, 194, 235, 111, 10},
-      {184, 252, 31, 13, 5},
-      {95, 109, 116, 54, 8},
-      {171, 15, 131, 241, 13}
-    },
-    { {180, 216, 190, 76, 8},
-      {200, 237, 53, 26, 12},
-      {19, 39, 209, 178, 13},
-      {53, 138, 203, 113, 3}
-    },
-    { {157, 108, 51, 41, 10},
-      {147, 124, 3, 118, 12},
-      {89, 76, 195, 107, 9},
-      {54, 236, 3, 236, 9}
-    },
-    { {62, 93, 56, 87, 15},
-      {206, 30, 229, 61, 13},
-      {254, 161, 203, 167, 12},
-      {187, 202, 119, 135, 3}
-    },
-    { {180, 100, 140, 48, 10},
-      {129, 157, 167, 34, 0},
-      {80, 195, 18, 98, 13},
-      {4, 78, 91, 152, 1}
-    },
-    { {93, 101, 141, 153, 11},
-      {151, 191, 133, 228, 2},
-      {217, 155, 26, 107, 10},
-      {66, 122, 31, 222, 9}
-    },
-    { {75, 57, 30, 253, 8},
-      {75, 99, 135, 221, 10},
-      {27, 247, 137, 205, 2},
-      {91, 190, 28, 109, 2}
-    },
-    { {159, 102, 246, 244, 7},
-      {175, 221, 202, 123, 6},
-      {226, 246, 246, 111, 9},
-      {109, 229, 59, 191, 5}
-    },
-    { {99, 251, 122, 188, 8},
-      {105, 102, 191, 209, 14},
-      {19, 213, 237, 252, 6},
-      {120, 191, 214, 105, 6}
-    },
-    { {48, 213, 149, 195, 13},
-      {84, 143, 113, 60, 3},
-      {188, 58, 154, 176, 12},
-      {195, 200, 239, 18, 10}
-    },
-    { {44, 228, 218, 91, 8},
-      {163, 228, 181, 60, 1},
-      {29, 165, 178, 115, 4},
-      {131, 202, 210, 124, 5}
-    },
-    { {123, 79, 47, 122, 4},
-      {18, 111, 238, 233, 13},
-      {37, 239, 79, 45, 14},
-      {185, 119, 127, 100, 8}
-    },
-    { {80, 165, 170, 211, 11},
-      {5, 218, 149, 172, 7},
-      {220, 181, 90, 80, 10},
-      {227, 90, 149, 186, 0}
-    },
-    { {53, 99, 219, 99, 9},
-      {181, 206, 47, 92, 1},
-      {156, 109, 188, 106, 12},
-      {131, 175, 71, 58, 13}
-    },
-    { {202, 17, 193, 89, 1},
-      {118, 162, 128, 143, 0},
-      {137, 168, 56, 133, 3},
-      {15, 16, 20, 86, 14}
-    },
-    { {119, 153, 15, 22, 8},
-      {216, 75, 181, 193, 9},
-      {22, 143, 9, 158, 14},
-      {152, 58, 221, 33, 11}
-    },
-    { {6, 232, 6, 138, 11},
-      {133, 117, 17, 1, 11},
-      {213, 22, 1, 118, 0},
-      {216, 8, 138, 234, 1}
-    },
-    { {88, 242, 76, 249, 1},
-      {103, 45, 158, 140, 2},
-      {137, 243, 36, 241, 10},
-      {67, 23, 155, 78, 6}
-    },
-    { {87, 131, 120, 211, 4},
-      {160, 10, 220, 221, 7},
-      {44, 177, 236, 30, 10},
-      {235, 179, 181, 0, 5}
-    },
-    { {102, 199, 182, 12, 6},
-      {136, 247, 120, 177, 4},
-      {99, 6, 222, 54, 6},
-      {40, 209, 238, 241, 1}
-    },
-    { {120, 143, 69, 72, 0},
-      {50, 43, 56, 168, 8},
-      {1, 42, 47, 17, 14},
-      {17, 81, 205, 68, 12}
-    },
-    { {233, 239, 208, 58, 13},
-      {39, 166, 251, 242, 9},
-      {181, 192, 191, 121, 7},
-      {148, 253, 246, 94, 4}
-    },
-    { {39, 212, 15, 163, 10},
-      {208, 85, 55, 101, 3},
-      {92, 95, 2, 190, 4},
-      {202, 110, 202, 160, 11}
-    },
-    { {125, 42, 249, 128, 10},
-      {179, 152, 45, 208, 14},
-      {80, 25, 245, 75, 14},
-      {112, 187, 65, 156, 13}
-    },
-    { {86, 144, 82, 117, 6},
-      {232, 88, 210, 157, 0},
-      {106, 228, 160, 150, 10},
-      {11, 148, 177, 161, 7}
-    },
-    { {30, 225, 231, 61, 2},
-      {187, 255, 146, 5, 4},
-      {75, 206, 120, 119, 8},
-      {42, 4, 159, 253, 13}
-    },
-    { {254, 157, 166, 210, 9},
-      {198, 203, 177, 171, 15},
-      {148, 182, 91, 151, 15},
-      {253, 88, 221, 54, 3}
-    },
-    { {75, 222, 118, 252, 11},
-      {110, 117, 155, 249, 14},
-      {211, 246, 231, 189, 2},
-      {121, 253, 154, 231, 6}
-    },
-    { {50, 21, 75, 223, 8},
-      {120, 106, 165, 45, 3},
-      {31, 189, 42, 132, 12},
-      {203, 74, 85, 97, 14}
-    },
-    { {141, 94, 72, 11, 6},
-      {226, 52, 76, 102, 9},
-      {109, 1, 39, 171, 1},
-      {150, 99, 34, 196, 7}
-    },
-    { {85, 153, 228, 23, 12},
-      {232, 139, 209, 196, 13},
-      {62, 130, 121, 154, 10},
-      {178, 56, 189, 17, 7}
-    },
-    { {127, 178, 100, 131, 2},
-      {227, 25, 56, 197, 7},
-      {76, 18, 100, 223, 14},
-      {234, 49, 201, 140, 7}
-    },
-    { {6, 201, 57, 111, 3},
-      {156, 54, 22, 29, 13},
-      {207, 105, 201, 54, 0},
-      {187, 134, 134, 195, 9}
-    },
-    { {66, 202, 124, 45, 2},
-      {40, 53, 30, 149, 12},
-      {75, 67, 229, 52, 2},
-      {58, 151, 138, 193, 4}
-    },
-    { {78, 192, 248, 186, 12},
-      {162, 164, 215, 145, 7},
-      {53, 209, 240, 55, 2},
-      {232, 158, 178, 84, 5}
-    },
-    { {45, 113, 131, 30, 11},
-      {223, 246, 161, 64, 1},
-      {215, 140, 24, 235, 4},
-      {128, 40, 86, 255, 11}
-    },
-    { {128, 130, 234, 70, 4},
-      {40, 192, 92, 10, 5},
-      {38, 37, 116, 16, 1},
-      {165, 3, 160, 49, 4}
-    },
-    { {172, 206, 58, 52, 3},
-      {142, 84, 190, 50, 12},
-      {194, 197, 199, 51, 5},
-      {52, 199, 210, 167, 1}
-    },
-    { {88, 160, 32, 181, 13},
-      {15, 8, 211, 132, 6},
-      {186, 208, 64, 81, 10},
-      {98, 28, 177, 15, 0}
-    },
-    { {114, 159, 129, 35, 8},
-      {80, 138, 59, 165, 9},
-      {28, 72, 31, 148, 14},
-      {154, 93, 197, 16, 10}
-    },
-    { {123, 5, 90, 20, 12},
-      {42, 74, 229, 241, 0},
-      {50, 133, 170, 13, 14},
-      {8, 250, 117, 37, 4}
-    },
-    { {150, 248, 124, 233, 1},
-      {229, 45, 22, 31, 14},
-      {137, 115, 225, 246, 9},
-      {127, 134, 139, 74, 7}
-    },
-    { {41, 99, 28, 75, 10},
-      {3, 55, 45, 92, 1},
-      {93, 35, 140, 105, 4},
-      {131, 171, 78, 204, 0}
-    },
-    { {157, 226, 24, 237, 14},
-      {139, 60, 95, 94, 2},
-      {123, 113, 132, 123, 9},
-      {71, 175, 163, 205, 1}
-    },
-    { {58, 230, 175, 66, 4},
-      {19, 205, 124, 41, 5},
-      {36, 47, 86, 117, 12},
-      {169, 67, 235, 60, 8}
-    },
-    { {180, 56, 174, 163, 3},
-      {197, 217, 38, 6, 15},
-      {204, 87, 81, 194, 13},
-      {246, 6, 73, 186, 3}
-    },
-    { {208, 70, 61, 144, 7},
-      {20, 29, 204, 178, 6},
-      {224, 155, 198, 32, 11},
-      {100, 211, 59, 130, 8}
-    },
-    { {187, 32, 151, 39, 0},
-      {27, 201, 34, 87, 1},
-      {14, 78, 144, 77, 13},
-      {142, 164, 73, 61, 8}
-    },
-    { {229, 143, 37, 62, 0},
-      {152, 35, 186, 226, 13},
-      {7, 202, 79, 26, 7},
-      {180, 117, 220, 65, 9}
-    },
-    { {194, 117, 158, 53, 4},
-      {73, 199, 198, 183, 0},
-      {42, 199, 154, 228, 3},
-      {14, 214, 62, 57, 2}
-    },
-    { {10, 66, 188, 132, 7},
-      {14, 149, 76, 17, 6},
-      {226, 19, 212, 37, 0},
-      {104, 131, 42, 151, 0}
-    },
-    { {173, 67, 236, 130, 11},
-      {166, 151, 45, 66, 7},
-      {212, 19, 124, 43, 5},
-      {228, 43, 78, 150, 5}
-    },
-    { {61, 136, 115, 251, 11},
-      {182, 120, 179, 92, 15},
-      {221, 252, 225, 27, 12},
-      {243, 172, 209, 230, 13}
-    },
-    { {102, 161, 166, 184, 11},
-      {133, 243, 179, 129, 6},
-      {209, 214, 88, 86, 6},
-      {104, 28, 220, 250, 1}
-    },
-    { {221, 141, 175, 200, 4},
-      {146, 235, 84, 234, 14},
-      {33, 63, 91, 27, 11},
-      {117, 114, 173, 116, 9}
-    },
-    { {21, 7, 218, 203, 3},
-      {164, 250, 12, 124, 3},
-      {205, 53, 190, 10, 8},
-      {195, 227, 5, 242, 5}
-    },
-    { {137, 254, 190, 99, 3},
-      {71, 213, 30, 126, 13},
-      {204, 103, 215, 249, 1},
-      {183, 231, 138, 190, 2}
-    },
-    { {25, 7, 189, 144, 10},
-      {18, 155, 141, 112, 6},
-      {80, 155, 222, 9, 8},
-      {96, 235, 29, 148, 8}
-    },
-    { {98, 241, 188, 178, 14},
-      {65, 151, 247, 145, 7},
-      {116, 211, 216, 244, 6},
-      {232, 158, 254, 152, 2}
-    },
-    { {14, 147, 144, 200, 10},
-      {194, 178, 25, 25, 2},
-      {81, 48, 156, 151, 0},
-      {73, 137, 132, 212, 3}
-    },
-    { {102, 251, 212, 124, 10},
-      {233, 183, 187, 153, 8},
-      {83, 226, 189, 246, 6},
-      {25, 157, 222, 217, 7}
-    },
-    { {203, 127, 203, 186, 5},
-      {119, 230, 206, 227, 11},
-      {165, 221, 63, 237, 3},
-      {220, 119, 54, 126, 14}
-    },
-    { {72, 77, 150, 114, 5},
-      {6, 199, 194, 184, 9},
-      {164, 230, 155, 33, 2},
-      {145, 212, 62, 54, 0}
-    },
-    { {182, 201, 156, 184, 13},
-      {132, 175, 247, 19, 10},
-      {177, 211, 153, 54, 13},
-      {92, 142, 255, 82, 1}
-    },
-    { {214, 73, 19, 109, 6},
-      {152, 126, 66, 159, 8},
-      {107, 108, 137, 38, 11},
-      {31, 148, 39, 225, 9}
-    },
-    { {13, 229, 2, 166, 2},
-      {139, 86, 18, 96, 3},
-      {70, 84, 10, 123, 0},
-      {192, 100, 134, 173, 1}
-    },
-    { {249, 154, 61, 119, 4},
-      {90, 9, 254, 222, 13},
-      {46, 235, 197, 153, 15},
-      {183, 183, 249, 5, 10}
-    },
-    { {124, 20, 82, 167, 4},
-      {234, 72, 98, 180, 3},
-      {46, 84, 162, 131, 14},
-      {194, 212, 97, 37, 7}
-    },
-    { {57, 81, 76, 89, 15},
-      {102, 63, 229, 76, 0},
-      {249, 163, 40, 169, 12},
-      {3, 42, 127, 198, 6}
-    },
-    { {202, 63, 57, 87, 14},
-      {91, 18, 205, 191, 13},
-      {126, 169, 207, 197, 3},
-      {191, 219, 52, 141, 10}
-    },
-    { {219, 212, 95, 243, 10},
-      {114, 93, 151, 255, 3},
-      {92, 255, 162, 189, 11},
-      {207, 254, 155, 164, 14}
-    },
-    { {113, 246, 139, 38, 2},
-      {89, 220, 62, 224, 1},
-      {70, 77, 22, 248, 14},
-      {128, 119, 195, 185, 10}
-    },
-    { {61, 34, 41, 13, 7},
-      {159, 56, 108, 68, 4},
-      {235, 9, 68, 75, 12},
-      {34, 35, 97, 207, 9}
-    },
-    { {154, 77, 130, 207, 12},
-      {10, 238, 65, 47, 11},
-      {63, 52, 27, 37, 9},
-      {223, 72, 39, 117, 0}
-    },
-    { {16, 141, 72, 139, 2},
-      {32, 58, 20, 36, 11},
-      {77, 17, 43, 16, 8},
-      {210, 66, 133, 192, 4}
-    },
-    { {66, 66, 157, 48, 14},
-      {16, 149, 207, 145, 0},
-      {112, 203, 148, 36, 2},
-      {8, 159, 58, 144, 8}
-    },
-    { {191, 242, 183, 46, 9},
-      {223, 237, 59, 83, 5},
-      {151, 78, 212, 255, 13},
-      {172, 173, 203, 127, 11}
-    },
-    { {137, 69, 178, 16, 8},
-      {2, 198, 129, 114, 4},
-      {16, 132, 218, 41, 1},
-      {36, 232, 22, 52, 0}
-    },
-    { {156, 83, 206, 106, 1},
-      {230, 239, 14, 10, 1},
-      {133, 103, 60, 163, 9},
-      {133, 7, 15, 118, 7}
-    },
-    { {246, 110, 46, 178, 11},
-      {133, 93, 175, 163, 15},
-      {212, 215, 71, 102, 15},
-      {252, 95, 91, 170, 1}
-    },
-    { {123, 135, 22, 82, 6},
-      {2, 91, 248, 249, 1},
-      {100, 166, 142, 29, 14},
-      {137, 241, 253, 164, 0}
-    },
-    { {117, 48, 198, 172, 7},
-      {237, 249, 98, 192, 2},
-      {227, 86, 48, 202, 14},
-      {64, 52, 105, 251, 7}
-    },
-    { {219, 148, 76, 224, 4},
-      {98, 9, 86, 235, 2},
-      {32, 115, 34, 157, 11},
-      {77, 118, 169, 4, 6}
-    },
-    { {64, 156, 92, 188, 6},
-      {104, 49, 214, 176, 10},
-      {99, 211, 163, 144, 2},
-      {80, 214, 184, 193, 6}
-    },
-    { {96, 119, 25, 168, 12},
-      {81, 38, 111, 176, 2},
-      {49, 89, 142, 224, 6},
-      {64, 223, 102, 72, 10}
-    },
-    { {100, 136, 107, 16, 1},
-      {180, 64, 180, 128, 12},
-      {128, 141, 97, 18, 6},
-      {48, 18, 208, 34, 13}
-    },
-    { {33, 158, 169, 148, 0},
-      {88, 128, 188, 96, 14},
-      {2, 153, 87, 152, 4},
-      {112, 99, 208, 17, 10}
-    },
-    { {146, 100, 250, 242, 11},
-      {37, 220, 135, 59, 7},
-      {212, 245, 242, 100, 9},
-      {237, 206, 19, 186, 4}
-    },
-    { {214, 14, 81, 55, 9},
-      {188, 8, 139, 183, 9},
-      {158, 200, 167, 6, 11},
-      {158, 221, 17, 3, 13}
-    },
-    { {6, 232, 25, 146, 12},
-      {145, 4, 213, 17, 11},
-      {52, 153, 129, 118, 0},
-      {216, 138, 178, 8, 9}
-    },
-    { {101, 196, 213, 201, 3},
-      {180, 181, 48, 252, 2},
-      {201, 58, 178, 58, 6},
-      {67, 240, 202, 210, 13}
-    },
-    { {91, 1, 85, 227, 4},
-      {50, 11, 66, 221, 3},
-      {44, 122, 168, 13, 10},
-      {203, 180, 45, 4, 12}
-    },
-    { {93, 64, 143, 102, 1},
-      {158, 205, 6, 200, 1},
-      {134, 111, 16, 43, 10},
-      {129, 54, 11, 55, 9}
-    },
-    { {61, 239, 243, 168, 13},
-      {183, 238, 123, 112, 14},
-      {177, 92, 255, 123, 12},
-      {112, 237, 231, 126, 13}
-    },
-    { {83, 37, 200, 86, 6},
-      {41, 154, 196, 233, 1},
-      {102, 161, 58, 76, 10},
-      {137, 114, 53, 153, 4}
-    },
-    { {18, 10, 174, 82, 10},
-      {0, 217, 141, 9, 13},
-      {84, 167, 85, 4, 8},
-      {185, 11, 25, 176, 0}
-    },
-    { {155, 29, 191, 200, 11},
-      {86, 251, 5, 123, 14},
-      {209, 63, 219, 141, 9},
-      {125, 234, 13, 246, 10}
-    },
-    { {207, 183, 171, 86, 8},
-      {219, 194, 157, 235, 5},
-      {22, 173, 94, 223, 3},
-      {173, 123, 148, 61, 11}
-    },
-    { {42, 141, 220, 32, 7},
-      {38, 147, 118, 49, 8},
-      {224, 67, 187, 21, 4},
-      {24, 198, 236, 150, 4}
-    },
-    { {142, 106, 174, 19, 3},
-      {135, 213, 140, 7, 13},
-      {204, 135, 85, 103, 1},
-      {190, 3, 26, 190, 1}
-    },
-    { {171, 253, 77, 159, 3},
-      {127, 55, 180, 103, 11},
-      {207, 155, 43, 253, 5},
-      {222, 98, 222, 207, 14}
-    },
-    { {45, 9, 17, 6, 12},
-      {154, 2, 97, 80, 9},
-      {54, 8, 137, 11, 4},
-      {144, 168, 100, 5, 9}
-    },
-    { {168, 207, 127, 12, 12},
-      {58, 103, 125, 50, 12},
-      {51, 15, 239, 49, 5},
-      {52, 203, 238, 101, 12}
-    },
-    { {166, 83, 153, 76, 7},
-      {220, 182, 108, 27, 0},
-      {227, 41, 156, 166, 5},
-      {13, 131, 102, 211, 11}
-    },
-    { {135, 166, 224, 109, 0},
-      {169, 160, 26, 111, 4},
-      {11, 96, 118, 94, 1},
-      {47, 101, 128, 89, 5}
-    },
-    { {59, 232, 221, 151, 0},
-      {59, 141, 180, 85, 11},
-      {14, 155, 177, 125, 12},
-      {218, 162, 219, 29, 12}
-    },
-    { {209, 178, 226, 250, 9},
-      {101, 232, 155, 202, 7},
-      {149, 244, 116, 216, 11},
-      {229, 61, 145, 122, 6}
-    },
-    { {0, 188, 184, 78, 7},
-      {77, 176, 84, 56, 13},
-      {231, 33, 211, 208, 0},
-      {177, 194, 160, 219, 2}
-    },
-    { {166, 167, 158, 98, 11},
-      {133, 211, 63, 59, 1},
-      {212, 103, 158, 86, 5},
-      {141, 207, 204, 186, 1}
-    },
-    { {200, 134, 91, 1, 3},
-      {54, 80, 28, 182, 0},
-      {200, 13, 166, 17, 3},
-      {6, 211, 128, 166, 12}
-    },
-    { {12, 255, 119, 177, 9},
-      {247, 71, 155, 52, 14},
-      {152, 222, 239, 243, 0},
-      {114, 205, 158, 46, 15}
-    },
-    { {142, 29, 220, 148, 3},
-      {238, 147, 132, 51, 10},
-      {194, 147, 187, 135, 1},
-      {92, 194, 28, 151, 7}
-    },
-    { {18, 244, 200, 158, 7},
-      {109, 188, 212, 33, 3},
-      {231, 145, 50, 244, 8},
-      {200, 66, 179, 219, 6}
-    },
-    { {221, 245, 180, 168, 13},
-      {199, 175, 83, 242, 6},
-      {177, 82, 218, 251, 11},
-      {100, 252, 175, 94, 3}
-    },
-    { {97, 194, 86, 250, 10},
-      {32, 117, 187, 216, 3},
-      {85, 246, 164, 56, 6},
-      {193, 189, 218, 224, 4}
-    },
-    { {34, 2, 81, 216, 5},
-      {52, 32, 232, 25, 2},
-      {161, 184, 164, 4, 4},
-      {73, 129, 112, 66, 12}
-    },
-    { {160, 222, 24, 47, 2},
-      {72, 52, 62, 54, 9},
-      {79, 65, 135, 176, 5},
-      {150, 199, 194, 193, 2}
-    },
-    { {203, 116, 62, 141, 0},
-      {75, 101, 4, 247, 6},
-      {11, 23, 194, 237, 3},
-      {110, 242, 10, 109, 2}
-    },
-    { {32, 93, 174, 186, 9},
-      {68, 231, 167, 32, 15},
-      {149, 215, 91, 160, 4},
-      {240, 78, 94, 114, 2}
-    },
-    { {182, 151, 72, 253, 13},
-      {236, 42, 255, 47, 2},
-      {187, 241, 46, 150, 13},
-      {79, 79, 245, 67, 7}
-    },
-    { {244, 165, 139, 213, 6},
-      {153, 218, 244, 174, 2},
-      {106, 189, 26, 82, 15},
-      {71, 82, 245, 185, 9}
-    },
-    { {137, 147, 208, 12, 15},
-      {110, 178, 89, 82, 0},
-      {243, 0, 188, 153, 1},
-      {4, 169, 164, 215, 6}
-    },
-    { {43, 161, 206, 80, 15},
-      {39, 211, 245, 73, 0},
-      {240, 167, 56, 93, 4},
-      {9, 42, 252, 190, 4}
-    },
-    { {84, 31, 38, 148, 10},
-      {200, 91, 137, 160, 14},
-      {82, 150, 79, 130, 10},
-      {112, 89, 29, 161, 3}
-    },
-    { {250, 73, 70, 153, 5},
-      {38, 111, 224, 135, 10},
-      {169, 150, 41, 37, 15},
-      {94, 16, 127, 102, 4}
-    },
-    { {143, 119, 77, 200, 6},
-      {243, 55, 76, 107, 2},
-      {97, 59, 46, 239, 1},
-      {77, 99, 46, 204, 15}
-    },
-    { {21, 73, 52, 191, 10},
-      {136, 63, 131, 84, 15},
-      {95, 210, 201, 42, 8},
-      {242, 172, 31, 193, 1}
-    },
-    { {160, 179, 125, 121, 0},
-      {113, 35, 190, 30, 4},
-      {9, 235, 236, 208, 5},
-      {39, 135, 220, 72, 14}
-    },
-    { {94, 29, 64, 6, 12},
-      {234, 10, 65, 161, 9},
-      {54, 0, 43, 135, 10},
-      {152, 88, 37, 5, 7}
-    },
-    { {247, 121, 227, 64, 9},
-      {245, 206, 33, 203, 12},
-      {144, 44, 121, 238, 15},
-      {61, 56, 71, 58, 15}
-    },
-    { {126, 60, 103, 41, 12},
-      {243, 105, 99, 165, 12},
-      {57, 78, 99, 199, 14},
-      {58, 92, 105, 108, 15}
-    },
-    { {38, 10, 20, 204, 8},
-      {136, 33, 41, 25, 10},
-      {19, 50, 133, 6, 4},
-      {89, 137, 72, 65, 1}
-    },
-    { {210, 180, 127, 62, 15},
-      {125, 121, 215, 179, 5},
-      {247, 207, 226, 212, 11},
-      {172, 222, 185, 235, 14}
-    },
-    { {52, 74, 22, 15, 2},
-      {136, 125, 40, 20, 9},
-      {79, 6, 133, 34, 12},
-      {146, 129, 75, 225, 1}
-    },
-    { {240, 88, 87, 246, 9},
-      {124, 77, 163, 154, 11},
-      {150, 254, 161, 160, 15},
-      {213, 156, 91, 35, 14}
-    },
-    { {200, 222, 73, 90, 3},
-      {118, 52, 156, 170, 9},
-      {197, 169, 39, 177, 3},
-      {149, 83, 146, 198, 14}
-    },
-    { {41, 152, 52, 89, 7},
-      {70, 49, 240, 92, 12},
-      {233, 162, 193, 153, 4},
-      {51, 160, 248, 198, 2}
-    },
-    { {192, 28, 220, 163, 10},
-      {96, 145, 7, 182, 11},
-      {92, 83, 179, 128, 3},
-      {214, 222, 8, 144, 6}
-    },
-    { {17, 134, 214, 198, 15},
-      {44, 217, 89, 120, 3},
-      {246, 54, 182, 24, 8},
-      {193, 233, 169, 179, 4}
-    },
-    { {199, 106, 99, 224, 0},
-      {177, 68, 10, 203, 14},
-      {0, 124, 101, 110, 3},
-      {125, 53, 2, 40, 13}
-    },
-    { {250, 63, 143, 86, 4},
-      {91, 203, 236, 171, 9},
-      {38, 175, 31, 197, 15},
-      {157, 83, 125, 61, 10}
-    },
-    { {30, 208, 47, 67, 7},
-      {214, 93, 84, 13, 5},
-      {236, 47, 64, 183, 8},
-      {171, 2, 171, 166, 11}
-    },
-    { {167, 132, 152, 85, 15},
-      {140, 144, 245, 127, 0},
-      {250, 161, 146, 30, 5},
-      {15, 234, 240, 147, 1}
-    },
-    { {12, 209, 94, 200, 6},
-      {226, 119, 84, 24, 2},
-      {97, 55, 168, 179, 0},
-      {65, 130, 174, 228, 7}
-    },
-    { {222, 242, 230, 20, 0},
-      {235, 205, 152, 131, 4},
-      {2, 134, 116, 247, 11},
-      {44, 17, 155, 61, 7}
-    },
-    { {172, 114, 24, 123, 12},
-      {195, 36, 239, 30, 1},
-      {61, 225, 132, 227, 5},
-      {135, 143, 114, 76, 3}
-    },
-    { {103, 201, 15, 119, 7},
-      {156, 87, 246, 205, 9},
-      {238, 239, 9, 62, 6},
-      {155, 54, 254, 163, 9}
-    },
-    { {7, 91, 205, 34, 11},
-      {244, 151, 15, 65, 9},
-      {212, 75, 61, 174, 0},
-      {152, 47, 14, 146, 15}
-    },
-    { {201, 190, 213, 237, 13},
-      {127, 161, 91, 254, 10},
-      {187, 122, 183, 217, 3},
-      {87, 253, 168, 95, 14}
-    },
-    { {106, 147, 24, 117, 4},
-      {74, 2, 254, 157, 0},
-      {42, 225, 140, 149, 6},
-      {11, 151, 244, 5, 2}
-    },
-    { {107, 212, 146, 123, 3},
-      {70, 244, 178, 253, 1},
-      {205, 228, 146, 189, 6},
-      {139, 244, 210, 246, 2}
-    },
-    { {118, 132, 7, 115, 8},
-      {144, 73, 179, 173, 1},
-      {28, 238, 2, 22, 14},
-      {139, 92, 217, 32, 9}
-    },
-    { {181, 12, 26, 120, 15},
-      {132, 120, 231, 122, 8},
-      {241, 229, 131, 10, 13},
-      {21, 238, 113, 226, 1}
-    },
-    { {153, 76, 54, 246, 14},
-      {10, 93, 195, 122, 15},
-      {118, 246, 195, 41, 9},
-      {245, 236, 59, 165, 0}
-    },
-    { {33, 245, 36, 87, 11},
-      {77, 23, 177, 108, 5},
-      {222, 162, 74, 248, 4},
-      {163, 104, 222, 139, 2}
-    },
-    { {97, 170, 231, 238, 4},
-      {57, 225, 122, 200, 15},
-      {39, 126, 117, 88, 6},
-      {241, 53, 232, 121, 12}
-    },
-    { {36, 1, 140, 232, 5},
-      {132, 163, 102, 8, 2},
-      {161, 115, 24, 2, 4},
-      {65, 6, 108, 82, 1}
-    },
-    { {97, 41, 206, 35, 10},
-      {33, 211, 39, 196, 9},
-      {92, 71, 57, 72, 6},
-      {146, 62, 76, 184, 4}
-    },
-    { {164, 226, 123, 199, 10},
-      {185, 84, 61, 30, 7},
-      {94, 61, 228, 114, 5},
-      {231, 139, 194, 169, 13}
-    },
-    { {182, 249, 62, 111, 6},
-      {201, 127, 118, 31, 13},
-      {111, 103, 201, 246, 13},
-      {191, 134, 239, 233, 3}
-    },
-    { {184, 158, 66, 250, 4},
-      {98, 104, 250, 42, 11},
-      {37, 244, 39, 145, 13},
-      {213, 69, 241, 100, 6}
-    },
-    { {205, 168, 178, 163, 12},
-      {131, 192, 83, 214, 15},
-      {60, 84, 209, 91, 3},
-      {246, 188, 160, 60, 1}
-    },
-    { {76, 57, 177, 159, 7},
-      {223, 178, 192, 148, 15},
-      {239, 152, 217, 195, 2},
-      {242, 144, 52, 223, 11}
-    },
-    { {185, 129, 38, 244, 2},
-      {10, 91, 178, 74, 6},
-      {66, 246, 72, 25, 13},
-      {101, 36, 221, 165, 0}
-    },
-    { {14, 11, 250, 182, 8},
-      {170, 194, 143, 17, 15},
-      {22, 213, 253, 7, 0},
-      {248, 143, 20, 53, 5}
-    },
-    { {242, 177, 157, 60, 6},
-      {89, 187, 246, 147, 0},
-      {99, 203, 152, 212, 15},
-      {12, 150, 253, 217, 10}
-    },
-    { {62, 75, 92, 90, 2},
-      {162, 63, 172, 25, 9},
-      {69, 163, 173, 39, 12},
-      {153, 131, 95, 196, 5}
-    },
-    { {53, 13, 105, 45, 8},
-      {184, 42, 39, 100, 12},
-      {27, 73, 107, 10, 12},
-      {50, 110, 69, 65, 13}
-    },
-    { {180, 35, 142, 37, 5},
-      {141, 203, 110, 6, 0},
-      {170, 71, 28, 66, 13},
-      {6, 7, 109, 59, 1}
-    },
-    { {69, 98, 201, 154, 0},
-      {177, 164, 140, 192, 3},
-      {5, 153, 52, 106, 2},
-      {192, 51, 18, 88, 13}
-    },
-    { {180, 56, 177, 59, 0},
-      {209, 168, 162, 22, 13},
-      {13, 200, 209, 194, 13},
-      {182, 132, 81, 88, 11}
-    },
-    { {131, 20, 145, 146, 14},
-      {80, 144, 193, 115, 3},
-      {116, 152, 146, 140, 1},
-      {204, 232, 48, 144, 10}
-    },
-    { {255, 9, 118, 5, 7},
-      {174, 91, 96, 215, 12},
-      {234, 6, 233, 15, 15},
-      {62, 176, 109, 167, 5}
-    },
-    { {76, 85, 220, 22, 13},
-      {238, 135, 197, 176, 1},
-      {182, 131, 186, 163, 2},
-      {128, 218, 62, 23, 7}
-    },
-    { {104, 114, 128, 201, 15},
-      {71, 180, 105, 140, 2},
-      {249, 48, 20, 225, 6},
-      {67, 25, 98, 222, 2}
-    },
-    { {118, 171, 174, 160, 4},
-      {129, 203, 126, 129, 14},
-      {32, 87, 93, 86, 14},
-      {120, 23, 237, 56, 1}
-    },
-    { {145, 170, 76, 41, 14},
-      {33, 57, 95, 70, 8},
-      {121, 67, 37, 88, 9},
-      {22, 47, 169, 200, 4}
-    },
-    { {172, 153, 124, 202, 8},
-      {226, 35, 53, 26, 15},
-      {21, 51, 233, 147, 5},
-      {245, 138, 204, 68, 7}
-    },
-    { {14, 211, 209, 214, 1},
-      {254, 134, 152, 25, 3},
-      {134, 184, 188, 183, 0},
-      {201, 129, 150, 23, 15}
-    },
-    { {186, 245, 248, 135, 3},
-      {111, 158, 52, 55, 7},
-      {206, 17, 250, 245, 13},
-      {238, 194, 199, 159, 6}
-    },
-    { {24, 203, 208, 54, 12},
-      {42, 142, 219, 16, 9},
-      {54, 192, 189, 49, 8},
-      {144, 141, 183, 21, 4}
-    },
-    { {230, 136, 49, 122, 7},
-      {148, 48, 242, 155, 13},
-      {229, 232, 193, 22, 7},
-      {189, 148, 240, 194, 9}
-    },
-    { {38, 93, 140, 24, 7},
-      {196, 183, 228, 33, 8},
-      {225, 131, 27, 166, 4},
-      {24, 66, 126, 210, 3}
-    },
-    { {37, 253, 177, 16, 7},
-      {213, 150, 240, 112, 12},
-      {224, 136, 219, 250, 4},
-      {48, 224, 246, 154, 11}
-    },
-    { {46, 105, 226, 33, 9},
-      {167, 198, 35, 5, 12},
-      {152, 68, 121, 103, 4},
-      {58, 12, 70, 62, 5}
-    },
-    { {148, 212, 15, 127, 5},
-      {220, 109, 214, 46, 1},
-      {175, 239, 2, 178, 9},
-      {135, 70, 187, 99, 11}
-    },
-    { {104, 227, 24, 161, 2},
-      {3, 22, 62, 148, 2},
-      {72, 81, 140, 113, 6},
-      {66, 151, 198, 140, 0}
-    },
-    { {115, 38, 168, 12, 2},
-      {9, 184, 44, 225, 4},
-      {67, 1, 86, 76, 14},
-      {40, 115, 65, 217, 0}
-    },
-    { {8, 225, 19, 56, 4},
-      {19, 102, 210, 16, 0},
-      {33, 204, 136, 113, 0},
-      {0, 132, 182, 108, 8}
-    },
-    { {30, 74, 153, 58, 11},
-      {150, 188, 143, 17, 9},
-      {213, 201, 149, 39, 8},
-      {152, 143, 19, 214, 9}
-    },
-    { {56, 123, 230, 193, 11},
-      {103, 223, 41, 12, 14},
-      {216, 54, 125, 225, 12},
-      {115, 9, 79, 190, 6}
-    },
-    { {23, 164, 136, 165, 2},
-      {137, 152, 22, 101, 2},
-      {74, 81, 18, 94, 8},
-      {74, 102, 129, 153, 1}
-    },
-    { {100, 67, 135, 200, 8},
-      {144, 231, 41, 136, 2},
-      {17, 62, 28, 34, 6},
-      {65, 25, 78, 112, 9}
-    },
-    { {110, 7, 130, 143, 7},
-      {142, 242, 104, 165, 3},
-      {239, 20, 30, 7, 6},
-      {202, 81, 100, 247, 1}
-    },
-    { {184, 128, 233, 2, 2},
-      {50, 152, 52, 2, 5},
-      {68, 9, 112, 17, 13},
-      {164, 2, 193, 148, 12}
-    },
-    { {62, 14, 185, 83, 2},
-      {146, 152, 172, 61, 13},
-      {76, 169, 215, 7, 12},
-      {187, 195, 81, 148, 9}
-    },
-    { {143, 140, 17, 176, 2},
-      {146, 16, 146, 115, 10},
-      {64, 216, 131, 31, 1},
-      {92, 228, 144, 132, 9}
-    },
-    { {27, 141, 195, 155, 13},
-      {54, 234, 209, 101, 11},
-      {189, 156, 59, 29, 8},
-      {218, 104, 181, 118, 12}
-    },
-    { {238, 130, 108, 30, 9},
-      {174, 33, 189, 131, 5},
-      {151, 131, 100, 23, 7},
-      {172, 27, 216, 71, 5}
-    },
-    { {149, 96, 110, 240, 8},
-      {161, 77, 135, 74, 6},
-      {16, 247, 96, 106, 9},
-      {101, 46, 27, 40, 5}
-    },
-    { {80, 228, 38, 86, 2},
-      {9, 93, 144, 168, 5},
-      {70, 166, 66, 112, 10},
-      {161, 80, 155, 169, 0}
-    },
-    { {212, 77, 143, 180, 2},
-      {152, 223, 134, 162, 10},
-      {66, 223, 27, 34, 11},
-      {84, 86, 31, 177, 9}
-    },
-    { {5, 79, 54, 9, 7},
-      {132, 119, 72, 116, 12},
-      {233, 6, 207, 42, 0},
-      {50, 225, 46, 226, 1}
-    },
-    { {165, 246, 91, 233, 9},
-      {245, 100, 63, 126, 2},
-      {153, 125, 166, 250, 5},
-      {71, 239, 194, 106, 15}
-    },
-    { {246, 67, 68, 234, 5},
-      {164, 47, 106, 139, 3},
-      {165, 114, 44, 38, 15},
-      {205, 21, 111, 66, 5}
-    },
-    { {85, 81, 175, 40, 13},
-      {212, 239, 71, 192, 4},
-      {177, 79, 88, 170, 10},
-      {32, 62, 47, 114, 11}
-    },
-    { {27, 94, 104, 63, 5},
-      {110, 44, 206, 101, 13},
-      {175, 193, 103, 173, 8},
-      {186, 103, 51, 71, 6}
-    },
-    { {6, 118, 167, 222, 12},
-      {217, 229, 201, 41, 7},
-      {55, 190, 86, 230, 0},
-      {233, 73, 58, 121, 11}
-    },
-    { {70, 176, 31, 231, 11},
-      {221, 81, 23, 157, 3},
-      {222, 127, 128, 214, 2},
-      {203, 158, 136, 171, 11}
-    },
-    { {38, 80, 223, 195, 0},
-      {240, 197, 36, 29, 3},
-      {12, 63, 176, 166, 4},
-      {203, 130, 74, 48, 15}
-    },
-    { {52, 1, 83, 23, 3},
-      {188, 90, 160, 20, 1},
-      {206, 140, 168, 2, 12},
-      {130, 128, 85, 163, 13}
-    },
-    { {185, 183, 76, 10, 12},
-      {99, 43, 125, 98, 1},
-      {53, 3, 46, 217, 13},
-      {132, 107, 237, 76, 6}
-    },
-    { {103, 124, 93, 21, 5},
-      {253, 5, 228, 245, 8},
-      {170, 139, 163, 238, 6},
-      {26, 242, 122, 11, 15}
-    },
-    { {62, 14, 116, 210, 9},
-      {166, 9, 169, 57, 15},
-      {148, 178, 231, 7, 12},
-      {249, 201, 89, 6, 5}
-    },
-    { {135, 91, 221, 123, 4},
-      {240, 167, 206, 95, 9},
-      {45, 235, 189, 174, 1},
-      {159, 167, 62, 80, 15}
-    },
-    { {243, 250, 71, 202, 15},
-      {117, 125, 121, 203, 11},
-      {245, 62, 37, 252, 15},
-      {221, 57, 235, 234, 14}
-    },
-    { {215, 194, 170, 201, 7},
-      {132, 252, 92, 207, 6},
-      {233, 53, 84, 62, 11},
-      {111, 51, 163, 242, 1}
-    },
-    { {9, 112, 244, 98, 8},
-      {99, 133, 3, 88, 5},
-      {20, 98, 240, 233, 0},
-      {161, 172, 10, 28, 6}
-    },
-    { {49, 139, 231, 50, 10},
-      {48, 219, 187, 64, 13},
-      {84, 206, 125, 24, 12},
-      {176, 45, 221, 176, 12}
-    },
-    { {250, 59, 245, 187, 4},
-      {115, 171, 234, 151, 15},
-      {45, 218, 253, 197, 15},
-      {254, 149, 125, 92, 14}
-    },
-    { {119, 186, 106, 0, 14},
-      {225, 88, 125, 193, 12},
-      {112, 5, 101, 222, 14},
-      {56, 59, 225, 168, 7}
-    },
-    { {245, 7, 16, 43, 15},
-      {132, 58, 107, 246, 1},
-      {253, 64, 142, 10, 15},
-      {134, 253, 101, 194, 1}
-    },
-    { {55, 185, 16, 190, 8},
-      {201, 42, 179, 81, 11},
-      {23, 208, 137, 222, 12},
-      {216, 172, 213, 73, 3}
-    },
-    { {154, 36, 87, 204, 1},
-      {63, 105, 0, 59, 2},
-      {131, 62, 162, 69, 9},
-      {77, 192, 9, 111, 12}
-    },
-    { {86, 238, 203, 19, 12},
-      {177, 204, 221, 165, 9},
-      {60, 141, 55, 118, 10},
-      {154, 91, 179, 56, 13}
-    },
-    { {19, 93, 119, 167, 4},
-      {120, 79, 66, 117, 15},
-      {46, 94, 235, 172, 8},
-      {250, 228, 47, 33, 14}
-    },
-    { {13, 146, 253, 48, 4},
-      {242, 129, 222, 80, 4},
-      {32, 203, 244, 155, 0},
-      {32, 167, 184, 20, 15}
-    },
-    { {237, 122, 230, 34, 3},
-      {231, 213, 42, 194, 13},
-      {196, 70, 117, 235, 7},
-      {180, 53, 74, 190, 7}
-    },
-    { {141, 125, 109, 37, 12},
-      {251, 7, 71, 102, 12},
-      {58, 75, 107, 235, 1},
-      {54, 110, 46, 13, 15}
-    },
-    { {120, 62, 207, 103, 3},
-      {127, 217, 46, 172, 9},
-      {206, 111, 55, 193, 14},
-      {147, 87, 73, 191, 14}
-    },
-    { {62, 116, 93, 252, 6},
-      {251, 61, 230, 57, 2},
-      {99, 251, 162, 231, 12},
-      {73, 198, 123, 205, 15}
-    },
-    { {188, 170, 218, 5, 10},
-      {171, 216, 61, 22, 8},
-      {90, 5, 181, 83, 13},
-      {22, 139, 193, 189, 5}
-    },
-    { {13, 162, 38, 20, 8},
-      {139, 65, 153, 64, 4},
-      {18, 134, 68, 91, 0},
-      {32, 41, 152, 45, 1}
-    },
-    { {134, 217, 94, 7, 10},
-      {232, 87, 21, 23, 9},
-      {94, 7, 169, 182, 1},
-      {158, 138, 142, 161, 7}
-    },
-    { {37, 126, 156, 27, 14},
-      {193, 181, 237, 116, 9},
-      {125, 131, 151, 234, 4},
-      {146, 235, 122, 216, 3}
-    },
-    { {221, 222, 210, 16, 1},
-      {230, 204, 152, 242, 8},
-      {128, 132, 183, 187, 11},
-      {20, 241, 147, 54, 7}
-    },
-    { {233, 1, 205, 160, 13},
-      {54, 131, 103, 194, 2},
-      {176, 91, 56, 9, 7},
-      {68, 62, 108, 22, 12}
-    },
-    { {119, 152, 12, 57, 4},
-      {192, 41, 246, 197, 8},
-      {41, 195, 1, 158, 14},
-      {26, 54, 249, 64, 3}
-    },
-    { {209, 14, 75, 139, 7},
-      {52, 120, 76, 230, 11},
-      {237, 29, 39, 8, 11},
-      {214, 115, 33, 226, 12}
-    },
-    { {226, 178, 81, 251, 9},
-      {117, 32, 187, 159, 3},
-      {157, 248, 164, 212, 7},
-      {207, 157, 208, 74, 14}
-    },
-    { {108, 39, 137, 18, 7},
-      {151, 146, 236, 160, 1},
-      {228, 137, 30, 67, 6},
-      {128, 83, 116, 158, 9}
-    },
-    { {78, 213, 70, 229, 4},
-      {234, 71, 82, 173, 2},
-      {42, 118, 42, 183, 2},
-      {75, 84, 174, 37, 7}
-    },
-    { {240, 6, 14, 244, 9},
-      {12, 73, 175, 170, 2},
-      {146, 247, 6, 0, 15},
-      {69, 95, 89, 35, 0}
-    },
-    { {179, 69, 148, 196, 9},
-      {12, 143, 33, 123, 2},
-      {146, 50, 154, 44, 13},
-      {77, 232, 79, 19, 0}
-    },
-    { {183, 99, 0, 71, 12},
-      {137, 14, 105, 79, 1},
-      {62, 32, 12, 110, 13},
-      {143, 41, 103, 9, 1}
-    },
-    { {124, 196, 229, 3, 1},
-      {182, 141, 48, 164, 5},
-      {140, 10, 114, 51, 14},
-      {162, 80, 203, 22, 13}
-    },
-    { {86, 1, 102, 16, 6},
-      {160, 91, 192, 129, 4},
-      {96, 134, 104, 6, 10},
-      {40, 16, 61, 160, 5}
-    },
-    { {82, 75, 187, 242, 15},
-      {20, 222, 207, 153, 15},
-      {244, 253, 221, 36, 10},
-      {249, 159, 55, 178, 8}
-    },
-    { {142, 50, 98, 30, 15},
-      {239, 112, 201, 3, 5},
-      {247, 132, 100, 199, 1},
-      {172, 9, 48, 239, 7}
-    },
-    { {66, 68, 75, 195, 9},
-      {52, 68, 5, 173, 3},
-      {156, 61, 34, 36, 2},
-      {203, 90, 2, 34, 12}
-    },
-    { {139, 101, 126, 225, 12},
-      {35, 71, 71, 127, 6},
-      {56, 119, 234, 109, 1},
-      {111, 238, 46, 44, 4}
-    },
-    { {53, 42, 182, 84, 7},
-      {141, 217, 232, 88, 12},
-      {226, 166, 213, 74, 12},
-      {49, 161, 121, 187, 1}
-    },
-    { {231, 165, 75, 233, 2},
-      {177, 114, 54, 239, 2},
-      {73, 125, 42, 94, 7},
-      {79, 118, 196, 232, 13}
-    },
-    { {120, 30, 244, 21, 3},
-      {110, 153, 168, 180, 12},
-      {202, 130, 247, 129, 14},
-      {50, 209, 89, 151, 6}
-    },
-    { {50, 242, 74, 129, 2},
-      {97, 92, 60, 5, 2},
-      {72, 21, 36, 244, 12},
-      {74, 3, 195, 168, 6}
-    },
-    { {40, 17, 16, 119, 11},
-      {78, 18, 163, 28, 1},
-      {222, 224, 136, 129, 4},
-      {131, 140, 84, 135, 2}
-    },
-    { {37, 203, 65, 84, 13},
-      {188, 6, 249, 72, 8},
-      {178, 168, 45, 58, 4},
-      {17, 41, 246, 3, 13}
-    },
-    { {167, 103, 245, 103, 1},
-      {189, 135, 42, 127, 5},
-      {142, 106, 254, 110, 5},
-      {175, 229, 78, 27, 13}
-    },
-    { {91, 165, 158, 70, 11},
-      {15, 219, 21, 249, 1},
-      {214, 39, 154, 93, 10},
-      {137, 250, 141, 191, 0}
-    },
-    { {88, 61, 62, 106, 2},
-      {67, 123, 6, 184, 13},
-      {69, 103, 203, 193, 10},
-      {177, 214, 13, 236, 2}
-    },
-    { {191, 77, 67, 125, 10},
-      {186, 126, 163, 111, 8},
-      {91, 236, 43, 47, 13},
-      {31, 108, 87, 229, 13}
-    },
-    { {160, 164, 162, 247, 2},
-      {9, 208, 178, 46, 7},
-      {78, 244, 82, 80, 5},
-      {231, 68, 208, 185, 0}
-    },
-    { {93, 52, 153, 184, 6},
-      {211, 184, 198, 240, 2},
-      {97, 217, 146, 203, 10},
-      {64, 246, 49, 220, 11}
-    },
-    { {211, 7, 214, 157, 5},
-      {44, 235, 200, 247, 2},
-      {171, 150, 190, 12, 11},
-      {78, 241, 61, 115, 4}
-    },
-    { {155, 172, 247, 16, 14},
-      {51, 217, 209, 115, 12},
-      {112, 142, 243, 93, 9},
-      {60, 232, 185, 188, 12}
-    },
-    { {196, 108, 246, 252, 13},
-      {173, 229, 195, 186, 14},
-      {179, 246, 243, 98, 3},
-      {117, 220, 58, 123, 5}
-    },
-    { {184, 1, 141, 118, 12},
-      {26, 139, 231, 10, 1},
-      {54, 235, 24, 1, 13},
-      {133, 14, 125, 21, 8}
-    },
-    { {232, 151, 127, 181, 13},
-      {126, 67, 255, 182, 6},
-      {186, 223, 238, 145, 7},
-      {102, 223, 252, 39, 14}
-    },
-    { {11, 60, 141, 188, 5},
-      {95, 161, 198, 97, 10},
-      {163, 219, 19, 205, 0},
-      {88, 102, 56, 95, 10}
-    },
-    { {20, 20, 133, 139, 8},
-      {208, 169, 1, 36, 3},
-      {29, 26, 18, 130, 8},
-      {194, 72, 9, 80, 11}
-    },
-    { {115, 104, 16, 10, 4},
-      {1, 44, 96, 209, 9},
-      {37, 0, 129, 108, 14},
-      {152, 176, 99, 72, 0}
-    },
-    { {18, 132, 134, 239, 3},
-      {12, 249, 18, 45, 3},
-      {207, 118, 18, 20, 8},
-      {203, 68, 137, 243, 0}
-    },
-    { {210, 252, 86, 125, 0},
-      {105, 109, 146, 191, 8},
-      {11, 230, 163, 244, 11},
-      {31, 212, 155, 105, 6}
-    },
-    { {91, 207, 66, 130, 14},
-      {34, 94, 89, 225, 11},
-      {116, 20, 47, 61, 10},
-      {216, 121, 167, 164, 4}
-    },
-    { {73, 183, 123, 167, 3},
-      {127, 82, 30, 244, 7},
-      {206, 93, 238, 217, 2},
-      {226, 247, 132, 175, 14}
-    },
-    { {97, 229, 12, 169, 15},
-      {5, 55, 119, 228, 2},
-      {249, 83, 10, 120, 6},
-      {66, 126, 238, 202, 0}
-    },
-    { {28, 221, 19, 226, 0},
-      {210, 78, 18, 56, 11},
-      {4, 124, 139, 179, 8},
-      {209, 196, 135, 36, 11}
-    },
-    { {241, 23, 253, 83, 15},
-      {116, 155, 237, 254, 5},
-      {252, 171, 254, 136, 15},
-      {167, 251, 125, 146, 14}
-    },
-    { {141, 51, 92, 19, 13},
-      {231, 3, 205, 86, 1},
-      {188, 131, 172, 203, 1},
-      {134, 171, 60, 14, 7}
-    },
-    { {248, 223, 155, 48, 4},
-      {82, 206, 254, 178, 8},
-      {32, 205, 159, 177, 15},
-      {20, 215, 247, 52, 10}
-    },
-    { {205, 115, 59, 196, 0},
-      {219, 70, 12, 218, 6},
-      {2, 61, 204, 235, 3},
-      {101, 179, 6, 45, 11}
-    },
-    { {35, 29, 150, 151, 9},
-      {76, 195, 161, 117, 11},
-      {158, 150, 155, 140, 4},
-      {218, 232, 92, 51, 2}
-    },
-    { {44, 151, 177, 71, 6},
-      {218, 146, 120, 60, 5},
-      {110, 40, 222, 147, 4},
-      {163, 193, 228, 149, 11}
-    },
-    { {230, 105, 156, 80, 1},
-      {133, 135, 164, 155, 8},
-      {128, 163, 153, 102, 7},
-      {29, 146, 94, 26, 1}
-    },
-    { {181, 161, 208, 86, 14},
-      {169, 154, 241, 90, 1},
-      {118, 160, 184, 90, 13},
-      {133, 168, 245, 153, 5}
-    },
-    { {60, 125, 33, 88, 4},
-      {211, 46, 224, 40, 12},
-      {33, 168, 75, 227, 12},
-      {49, 64, 119, 76, 11}
-    },
-    { {173, 20, 11, 20, 5},
-      {222, 64, 228, 98, 0},
-      {162, 141, 2, 139, 5},
-      {4, 98, 112, 39, 11}
-    },
-    { {251, 9, 110, 114, 3},
-      {38, 91, 166, 203, 13},
-      {196, 231, 105, 13, 15},
-      {189, 54, 93, 166, 4}
-    },
-    { {23, 132, 105, 191, 13},
-      {188, 40, 215, 101, 7},
-      {191, 217, 98, 30, 8},
-      {234, 110, 177, 67, 13}
-    },
-    { {36, 48, 61, 47, 6},
-      {217, 49, 102, 20, 5},
-      {111, 75, 192, 194, 4},
-      {162, 134, 104, 201, 11}
-    },
-    { {235, 214, 231, 21, 5},
-      {126, 197, 248, 231, 4},
-      {170, 142, 118, 189, 7},
-      {46, 113, 250, 55, 14}
-    },
-    { {147, 91, 170, 215, 11},
-      {76, 222, 141, 79, 15},
-      {222, 181, 93, 172, 9},
-      {255, 43, 23, 179, 2}
-    },
-    { {209, 95, 34, 205, 13},
-      {76, 110, 73, 238, 14},
-      {187, 52, 79, 168, 11},
-      {119, 121, 39, 99, 2}
-    },
-    { {55, 178, 213, 83, 15},
-      {245, 153, 249, 93, 1},
-      {252, 170, 180, 222, 12},
-      {139, 169, 249, 154, 15}
-    },
-    { {211, 101, 213, 98, 8},
-      {49, 143, 3, 251, 1},
-      {20, 106, 186, 108, 11},
-      {141, 252, 15, 24, 12}
-    },
-    { {29, 118, 183, 146, 15},
-      {215, 221, 201, 112, 7},
-      {244, 158, 214, 235, 8},
-      {224, 233, 59, 190, 11}
-    },
-    { {87, 185, 126, 171, 11},
-      {229, 123, 23, 213, 15},
-      {221, 87, 233, 222, 10},
-      {250, 190, 141, 234, 7}
-    },
-    { {9, 11, 171, 164, 4},
-      {26, 194, 78, 64, 14},
-      {34, 93, 93, 9, 0},
-      {112, 39, 36, 53, 8}
-    },
-    { {163, 131, 97, 118, 11},
-      {60, 18, 187, 75, 5},
-      {214, 232, 108, 28, 5},
-      {173, 45, 212, 131, 12}
-    },
-    { {156, 250, 125, 156, 6},
-      {251, 61, 220, 18, 14},
-      {99, 155, 229, 243, 9},
-      {116, 131, 187, 205, 15}
-    },
-    { {76, 134, 94, 122, 15},
-      {166, 113, 223, 184, 1},
-      {245, 231, 166, 19, 2},
-      {129, 223, 184, 230, 5}
-    },
-    { {249, 13, 22, 148, 11},
-      {14, 91, 161, 242, 10},
-      {210, 150, 139, 9, 15},
-      {84, 248, 93, 167, 0}
-    },
-    { {120, 93, 12, 212, 1},
-      {78, 15, 164, 168, 10},
-      {130, 179, 11, 161, 14},
-      {81, 82, 95, 7, 2}
-    },
-    { {51, 98, 95, 192, 1},
-      {53, 77, 44, 89, 2},
-      {128, 63, 164, 108, 12},
-      {73, 163, 75, 42, 12}
-    },
-    { {0, 213, 240, 148, 3},
-      {108, 150, 144, 48, 6},
-      {194, 144, 250, 176, 0},
-      {96, 192, 150, 147, 6}
-    },
-    { {167, 185, 175, 176, 8},
-      {209, 195, 183, 67, 14},
-      {16, 223, 89, 222, 5},
-      {124, 46, 220, 56, 11}
-    },
-    { {223, 59, 151, 88, 10},
-      {211, 251, 137, 219, 8},
-      {81, 174, 157, 207, 11},
-      {29, 185, 29, 252, 11}
-    },
-    { {182, 138, 31, 89, 2},
-      {144, 121, 188, 31, 8},
-      {73, 175, 133, 22, 13},
-      {31, 131, 217, 224, 9}
-    },
-    { {103, 50, 106, 212, 0},
-      {233, 64, 172, 201, 6},
-      {2, 181, 100, 206, 6},
-      {105, 51, 80, 41, 7}
-    },
-    { {7, 184, 90, 134, 3},
-      {237, 80, 20, 81, 11},
-      {198, 21, 161, 222, 0},
-      {216, 162, 128, 171, 7}
-    },
-    { {37, 38, 25, 247, 15},
-      {157, 16, 239, 124, 3},
-      {254, 249, 134, 74, 4},
-      {195, 239, 112, 139, 9}
-    },
-    { {130, 206, 71, 104, 3},
-      {52, 117, 26, 43, 8},
-      {193, 110, 39, 52, 1},
-      {29, 69, 138, 226, 12}
-    },
-    { {108, 230, 33, 121, 12},
-      {147, 36, 251, 172, 4},
-      {57, 232, 70, 115, 6},
-      {35, 93, 242, 76, 9}
-    },
-    { {98, 230, 221, 55, 8},
-      {57, 133, 191, 181, 1},
-      {30, 203, 182, 116, 6},
-      {138, 223, 218, 25, 12}
-    },
-    { {62, 92, 11, 17, 10},
-      {210, 92, 165, 37, 8},
-      {88, 141, 3, 167, 12},
-      {26, 74, 83, 164, 11}
-    },
-    { {57, 245, 112, 80, 8},
-      {99, 14, 177, 120, 4},
-      {16, 160, 234, 249, 12},
-      {33, 232, 215, 12, 6}
-    },
-    { {214, 87, 51, 142, 6},
-      {216, 126, 72, 179, 7},
-      {103, 28, 206, 166, 11},
-      {236, 209, 39, 225, 11}
-    },
-    { {192, 98, 168, 92, 12},
-      {9, 164, 205, 138, 4},
-      {51, 161, 84, 96, 3},
-      {37, 27, 50, 89, 0}
-    },
-    { {131, 220, 0, 222, 5},
-      {76, 36, 208, 107, 11},
-      {167, 176, 3, 188, 1},
-      {221, 96, 178, 67, 2}
-    },
-    { {177, 33, 195, 250, 3},
-      {53, 250, 162, 74, 3},
-      {197, 252, 56, 72, 13},
-      {197, 36, 85, 250, 12}
-    },
-    { {227, 149, 10, 113, 14},
-      {64, 82, 247, 239, 0},
-      {120, 229, 10, 156, 7},
-      {15, 126, 244, 160, 2}
-    },
-    { {113, 29, 253, 190, 8},
-      {120, 171, 167, 240, 15},
-      {23, 219, 251, 136, 14},
-      {240, 254, 93, 81, 14}
-    },
-    { {130, 171, 112, 191, 2},
-      {41, 50, 154, 23, 15},
-      {79, 208, 237, 84, 1},
-      {254, 133, 148, 201, 4}
-    },
-    { {93, 123, 132, 66, 1},
-      {199, 143, 8, 200, 9},
-      {132, 34, 29, 235, 10},
-      {145, 49, 15, 30, 3}
-    },
-    { {103, 239, 52, 200, 12},
-      {129, 39, 121, 249, 14},
-      {49, 50, 207, 126, 6},
-      {121, 249, 238, 72, 1}
-    },
-    { {202, 53, 231, 230, 13},
-      {127, 195, 67, 171, 7},
-      {182, 126, 122, 197, 3},
-      {237, 92, 44, 63, 14}
-    },
-    { {36, 1, 77, 111, 11},
-      {188, 51, 39, 12, 1},
-      {223, 107, 40, 2, 4},
-      {131, 14, 76, 195, 13}
-    },
-    { {183, 239, 157, 161, 14},
-      {145, 159, 127, 119, 10},
-      {120, 91, 159, 126, 13},
-      {94, 239, 239, 152, 9}
-    },
-    { {176, 76, 172, 188, 7},
-      {12, 189, 230, 34, 14},
-      {227, 211, 83, 32, 13},
-      {116, 70, 123, 211, 0}
-    },
-    { {193, 166, 3, 154, 8},
-      {17, 96, 153, 226, 3},
-      {21, 156, 6, 88, 3},
-      {196, 121, 144, 104, 8}
-    },
-    { {197, 1, 82, 163, 10},
-      {160, 82, 3, 214, 3},
-      {92, 84, 168, 10, 3},
-      {198, 188, 4, 160, 5}
-    },
-    { {220, 202, 43, 43, 7},
-      {150, 124, 94, 134, 13},
-      {237, 77, 69, 51, 11},
-      {182, 23, 163, 230, 9}
-    },
-    { {88, 6, 54, 143, 3},
-      {14, 121, 8, 180, 7},
-      {207, 22, 198, 1, 10},
-      {226, 209, 9, 231, 0}
-    },
-    { {139, 223, 114, 151, 10},
-      {106, 86, 153, 119, 15},
-      {94, 148, 239, 189, 1},
-      {254, 233, 150, 165, 6}
-    },
-    { {118, 72, 225, 171, 10},
-      {176, 188, 35, 133, 15},
-      {93, 88, 113, 38, 14},
-      {250, 28, 67, 208, 13}
-    },
-    { {224, 20, 244, 247, 7},
-      {108, 145, 226, 190, 7},
-      {238, 242, 242, 128, 7},
-      {231, 212, 120, 147, 6}
-    },
-    { {113, 170, 60, 249, 0},
-      {1, 41, 190, 220, 14},
-      {9, 243, 197, 88, 14},
-      {115, 183, 217, 72, 0}
-    },
-    { {156, 171, 243, 108, 14},
-      {187, 250, 91, 26, 12},
-      {115, 108, 253, 83, 9},
-      {53, 141, 165, 253, 13}
-    },
-    { {135, 84, 73, 90, 15},
-      {244, 52, 197, 107, 1},
-      {245, 169, 34, 174, 1},
-      {141, 106, 50, 194, 15}
-    },
-    { {154, 153, 213, 71, 2},
-      {122, 155, 16, 31, 9},
-      {78, 42, 185, 149, 9},
-      {159, 128, 141, 149, 14}
-    },
-    { {231, 44, 187, 69, 6},
-      {153, 208, 100, 255, 12},
-      {106, 45, 211, 78, 7},
-      {63, 242, 96, 185, 9}
-    },
-    { {196, 176, 203, 147, 1},
-      {245, 192, 148, 134, 3},
-      {140, 157, 48, 210, 3},
-      {198, 18, 144, 58, 15}
-    },
-    { {137, 237, 4, 93, 7},
-      {15, 55, 208, 110, 8},
-      {235, 162, 11, 121, 1},
-      {23, 96, 190, 207, 0}
-    },
-    { {199, 169, 10, 58, 11},
-      {133, 114, 151, 195, 9},
-      {213, 197, 9, 94, 3},
-      {156, 62, 148, 234, 1}
-    },
-    { {65, 90, 235, 196, 2},
-      {120, 212, 12, 200, 14},
-      {66, 61, 117, 168, 2},
-      {113, 51, 2, 177, 14}
-    },
-    { {127, 85, 215, 48, 2},
-      {242, 223, 162, 241, 0},
-      {64, 206, 186, 175, 14},
-      {8, 244, 95, 180, 15}
-    },
-    { {17, 75, 16, 122, 6},
-      {0, 62, 202, 88, 9},
-      {101, 224, 141, 40, 8},
-      {145, 165, 55, 192, 0}
-    },
-    { {230, 235, 111, 39, 4},
-      {185, 71, 126, 135, 13},
-      {46, 79, 109, 118, 7},
-      {190, 23, 238, 41, 13}
-    },
-    { {132, 244, 176, 135, 15},
-      {205, 148, 81, 54, 7},
-      {254, 16, 210, 242, 1},
-      {230, 200, 162, 155, 3}
-    },
-    { {91, 222, 44, 8, 8},
-      {66, 45, 29, 225, 12},
-      {17, 3, 71, 189, 10},
-      {56, 123, 139, 68, 2}
-    },
-    { {205, 253, 149, 194, 7},
-      {215, 151, 80, 250, 11},
-      {228, 58, 155, 251, 3},
-      {213, 240, 174, 158, 11}
-    },
-    { {51, 193, 37, 123, 3},
-      {20, 63, 178, 77, 5},
-      {205, 234, 72, 60, 12},
-      {171, 36, 223, 194, 8}
-    },
-    { {99, 27, 71, 141, 15},
-      {124, 115, 105, 197, 10},
-      {251, 30, 45, 140, 6},
-      {90, 57, 108, 227, 14}
-    },
-    { {229, 239, 80, 81, 11},
-      {165, 22, 185, 254, 8},
-      {216, 160, 175, 122, 7},
-      {23, 249, 214, 138, 5}
-    },
-    { {65, 141, 160, 190, 12},
-      {8, 162, 211, 224, 15},
-      {55, 208, 91, 24, 2},
-      {240, 124, 180, 81, 0}
-    },
-    { {193, 184, 36, 139, 1},
-      {69, 33, 16, 198, 15},
-      {141, 18, 65, 216, 3},
-      {246, 48, 136, 74, 2}
-    },
-    { {118, 222, 87, 133, 11},
-      {252, 93, 57, 181, 10},
-      {218, 30, 167, 182, 14},
-      {90, 217, 203, 163, 15}
-    },
-    { {219, 201, 87, 218, 6},
-      {50, 127, 208, 219, 11},
-      {101, 190, 169, 61, 11},
-      {221, 176, 191, 228, 12}
-    },
-    { {202, 225, 244, 5, 4},
-      {43, 135, 80, 151, 4},
-      {42, 2, 248, 117, 3},
-      {46, 144, 174, 29, 4}
-    },
-    { {145, 76, 36, 42, 2},
-      {0, 61, 2, 98, 13},
-      {69, 66, 67, 40, 9},
-      {180, 100, 11, 192, 0}
-    },
-    { {69, 163, 208, 168, 2},
-      {161, 178, 26, 208, 2},
-      {65, 80, 188, 90, 2},
-      {64, 181, 132, 216, 5}
-    },
-    { {136, 154, 125, 93, 13},
-      {126, 33, 221, 30, 12},
-      {187, 171, 229, 145, 1},
-      {55, 139, 184, 71, 14}
-    },
-    { {154, 61, 179, 211, 2},
-      {83, 218, 128, 63, 15},
-      {76, 188, 219, 197, 9},
-      {255, 192, 21, 188, 10}
-    },
-    { {208, 44, 134, 112, 15},
-      {5, 217, 195, 170, 8},
-      {240, 230, 19, 64, 11},
-      {21, 92, 57, 186, 0}
-    },
-    { {21, 123, 52, 80, 12},
-      {193, 15, 201, 88, 12},
-      {48, 162, 205, 234, 8},
-      {49, 169, 63, 8, 3}
-    },
-    { {137, 13, 55, 91, 10},
-      {18, 115, 129, 126, 13},
-      {93, 174, 203, 9, 1},
-      {183, 232, 28, 228, 8}
-    },
-    { {137, 27, 201, 59, 10},
-      {114, 178, 143, 70, 9},
-      {93, 201, 61, 137, 1},
-      {150, 47, 20, 212, 14}
-    },
-    { {138, 2, 216, 10, 3},
-      {38, 176, 12, 19, 1},
-      {197, 1, 180, 5, 1},
-      {140, 131, 0, 214, 4}
-    },
-    { {30, 93, 243, 65, 14},
-      {242, 222, 65, 61, 12},
-      {120, 44, 251, 167, 8},
-      {59, 200, 39, 180, 15}
-    },
-    { {120, 109, 137, 131, 2},
-      {19, 158, 36, 164, 11},
-      {76, 25, 27, 97, 14},
-      {210, 82, 71, 156, 8}
-    },
-    { {172, 247, 228, 126, 13},
-      {239, 167, 251, 42, 5},
-      {183, 226, 126, 243, 5},
-      {165, 77, 254, 95, 7}
-    },
-    { {28, 22, 226, 90, 0},
-      {226, 232, 136, 40, 5},
-      {5, 164, 118, 131, 8},
-      {161, 65, 17, 116, 7}
-    },
-    { {46, 169, 4, 13, 9},
-      {143, 35, 49, 5, 8},
-      {155, 2, 9, 87, 4},
-      {26, 8, 204, 79, 1}
-    },
-    { {243, 38, 138, 238, 5},
-      {13, 232, 110, 235, 3},
-      {167, 117, 22, 76, 15},
-      {205, 119, 97, 123, 0}
-    },
-    { {128, 232, 75, 204, 11},
-      {61, 116, 21, 10, 10},
-      {211, 61, 33, 112, 1},
-      {85, 10, 130, 235, 12}
-    },
-    { {162, 190, 211, 245, 12},
-      {121, 192, 251, 63, 10},
-      {58, 252, 183, 212, 5},
-      {95, 205, 240, 57, 14}
-    },
-    { {179, 172, 4, 251, 2},
-      {1, 57, 178, 111, 11},
-      {77, 242, 3, 92, 13},
-      {223, 100, 217, 200, 0}
-    },
-    { {132, 89, 129, 25, 2},
-      {208, 182, 128, 6, 8},
-      {73, 136, 25, 162, 1},
-      {22, 0, 22, 208, 11}
-    },
-    { {96, 167, 159, 201, 4},
-      {17, 227, 124, 188, 2},
-      {41, 63, 158, 80, 6},
-      {67, 211, 236, 120, 8}
-    },
-    { {19, 143, 250, 197, 9},
-      {44, 202, 29, 125, 14},
-      {154, 53, 255, 28, 8},
-      {123, 235, 133, 51, 4}
-    },
-    { {214, 125, 112, 144, 3},
-      {229, 30, 128, 179, 14},
-      {192, 144, 235, 230, 11},
-      {124, 208, 23, 138, 7}
-    },
-    { {43, 138, 160, 242, 5},
-      {6, 128, 250, 73, 15},
-      {164, 240, 85, 29, 4},
-      {249, 37, 240, 22, 0}
-    },
-    { {41, 131, 176, 59, 10},
-      {2, 178, 187, 84, 5},
-      {93, 192, 220, 25, 4},
-      {162, 173, 212, 212, 0}
-    },
-    { {140, 215, 81, 28, 8},
-      {250, 38, 153, 50, 0},
-      {19, 136, 174, 179, 1},
-      {4, 201, 150, 69, 15}
-    },
-    { {47, 222, 77, 2, 12},
-      {242, 5, 125, 97, 9},
-      {52, 11, 39, 191, 4},
-      {152, 107, 234, 4, 15}
-    },
-    { {213, 4, 207, 5, 12},
-      {184, 201, 69, 230, 0},
-      {58, 15, 50, 10, 11},
-      {6, 122, 41, 49, 13}
-    },
-    { {186, 231, 214, 153, 0},
-      {35, 239, 184, 55, 2},
-      {9, 150, 190, 117, 13},
-      {78, 193, 223, 124, 4}
-    },
-    { {156, 243, 126, 164, 13},
-      {239, 79, 95, 18, 6},
-      {178, 87, 236, 243, 9},
-      {100, 143, 175, 47, 7}
-    },
-    { {143, 79, 97, 177, 14},
-      {178, 22, 203, 103, 14},
-      {120, 216, 111, 47, 1},
-      {126, 109, 54, 132, 13}
-    },
-    { {137, 255, 175, 206, 6},
-      {91, 247, 92, 106, 15},
-      {103, 63, 95, 249, 1},
-      {245, 99, 174, 253, 10}
-    },
-    { {124, 126, 177, 202, 2},
-      {211, 188, 40, 184, 15},
-      {69, 56, 215, 227, 14},
-      {241, 209, 67, 220, 11}
-    },
-    { {150, 194, 61, 167, 11},
-      {156, 29, 31, 23, 7},
-      {222, 91, 196, 54, 9},
-      {238, 143, 139, 131, 9}
-    }
+static constexpr uint64 DICT_APRILTAG_36h10_CODES[][4] = {
+    { 0xe16549538ULL, 0x3106a5ee1ULL, 0x1ca92a687ULL, 0x877a5608cULL },
+    { 0x323584a04ULL, 0x418b62212ULL, 0x20521ac4cULL, 0x48446d182ULL },
+    { 0x6bedfc5e4ULL, 0x2ba7f4f9dULL, 0x27a3fb7d6ULL, 0xb9f2fe5d4ULL },
+    { 0xd9bd732d4ULL, 0x7b6a52f6cULL, 0x2b4cebd9bULL, 0x36f4a56deULL },
+    { 0x5773de26cULL, 0xe9cf4fd11ULL, 0x3647bceeaULL, 0x88bf2f397ULL },
+    { 0xf52b50f9cULL, 0xa12aebdeaULL, 0x39f0ad4afULL, 0x57bd75485ULL },
+    { 0x2e5b999bcULL, 0xd2a6ed15bULL, 0x3d999da74ULL, 0xda8b7654bULL },
+    { 0x7fa7ed722ULL, 0xb39bbee95ULL, 0x44eb7e5feULL, 0xa977dd9cdULL },
+    { 0x48bfcf1caULL, 0x7bf39da08ULL, 0x538f3fd12ULL, 0x105b9cfdeULL },
+    { 0xeb40c1ceaULL, 0x3ab421cb3ULL, 0x5738302d7ULL, 0xcd3842d5cULL },
+    { 0xd798fdba6ULL, 0xf0b9d6d3fULL, 0x65dbf19ebULL, 0xfcb6b9d0fULL },
+    { 0x5cd436b0eULL, 0xc25dd3b06ULL, 0x70d6c2b3aULL, 0x60dcbba43ULL },
+    { 0x724215efeULL, 0x183d6b9d3ULL, 0x7f7a8424eULL, 0xcb9d6bc18ULL },
+    { 0xc812ec4c1ULL, 0x6ea10c8a4ULL, 0x832374813ULL, 0x251308576ULL },
+    { 0x1bb263361ULL, 0x7f489a415ULL, 0x86cc64dd8ULL, 0xa825912feULL },
+    { 0xb9caaae51ULL, 0x0ecc3e4eeULL, 0x8a755539dULL, 0x7727c3370ULL },
+    { 0x372640ea9ULL, 0xa5282b693ULL, 0x9570264ecULL, 0xc96d414a5ULL },
+    { 0x8d5689899ULL, 0xd6a40d662ULL, 0x991916ab1ULL, 0x466b0256bULL },
+    { 0xdc6ef5605ULL, 0xb78d4abacULL, 0xa06af763bULL, 0x35d52b1edULL },
+    { 0x51e13a6d5ULL, 0x0d6e56dc4ULL, 0xab65c878aULL, 0x23b6a76b0ULL },
+    { 0x28c95ed4dULL, 0x2e47f518aULL, 0xb2b7a9314ULL, 0x518afe274ULL },
+    { 0x9b199066dULL, 0x4e8a435b9ULL, 0xb660998d9ULL, 0x9dac25172ULL },
+    { 0xc625e4dbdULL, 0xa5a3c1af7ULL, 0xbdb27a463ULL, 0xef583c5a5ULL },
+    { 0xeeddc6a33ULL, 0xe6d732a7bULL, 0xcc563bb77ULL, 0xde54ceb67ULL },
+    { 0xa87bbd247ULL, 0x5f976e12cULL, 0xe24bdde15ULL, 0x34876e9faULL },
+    { 0x26f7562b7ULL, 0xe5777a351ULL, 0xed46aef64ULL, 0x8ac5eeea7ULL },
+    { 0x775f1192fULL, 0xd41ee9f1bULL, 0xf4988faeeULL, 0xd8f97782bULL },
+    { 0xe3e82a760ULL, 0x0944b6cbdULL, 0x06e5417c7ULL, 0xbd36d2290ULL },
+    { 0xdb74091a8ULL, 0x532c85e31ULL, 0x158902edbULL, 0x8c7a134caULL },
+    { 0xa65c75b38ULL, 0xf005a337fULL, 0x1cdae3a65ULL, 0xfecc5a00fULL },
+    { 0xf7a233424ULL, 0x914878db5ULL, 0x242cc45efULL, 0xadb1e1289ULL },
+    { 0x2dd2dabe4ULL, 0xeae4fe503ULL, 0x27d5b4bb4ULL, 0xc0a7f2757ULL },
+    { 0x9e8a57ed4ULL, 0xba695a1faULL, 0x2b7ea5179ULL, 0x5f85a965dULL },
+    { 0xc0ba10b4cULL, 0x4900db92aULL, 0x32d085d03ULL, 0x549db0092ULL },
+    { 0x1346e9e6cULL, 0x388c4f697ULL, 0x3679762c8ULL, 0xe96f2311cULL },
+    { 0xb1166445cULL, 0x6809696e4ULL, 0x3a226688dULL, 0x276969016ULL },
+    { 0x4a76ad3bcULL, 0x53a5cfa55ULL, 0x3dcb56e52ULL, 0xaa5f3a5caULL },
+    { 0x85fe46312ULL, 0xe1559a668ULL, 0x48c627fa1ULL, 0x16659aa87ULL },
+    { 0xad69796eaULL, 0xbb36275adULL, 0x5769e96b5ULL, 0xb5ae46cddULL },
+    { 0x2015d2646ULL, 0x68d262380ULL, 0x6264ba804ULL, 0x01c464b16ULL },
+    { 0x93b55b066ULL, 0x795a54731ULL, 0x660daadc9ULL, 0x8ce2a5a9eULL },
+    { 0xca9d1fab6ULL, 0x527356b7bULL, 0x6d5f8b953ULL, 0xded6ace4aULL },
+    { 0xbb2368d2eULL, 0x231aed4b7ULL, 0x74b16c4ddULL, 0xed2b758c4ULL },
+    { 0x346bc35feULL, 0xb9fee90c9ULL, 0x7fac3d62cULL, 0x930977f9dULL },
+    { 0xa0cf71f89ULL, 0x3426bb3aeULL, 0x91f8ef305ULL, 0x75cdd642cULL },
+    { 0x531fb85a9ULL, 0x44aa8df9dULL, 0x95a1df8caULL, 0xb9fb15522ULL },
+    { 0xf17f35299ULL, 0x552f2bf6cULL, 0x994acfe8fULL, 0x36fd4f4aaULL },
+    { 0x9850d3905ULL, 0x76ccc0122ULL, 0xa09cb0a19ULL, 0x44803336eULL },
+    { 0x7bf05a225ULL, 0x674c76d11ULL, 0xa445a0fdeULL, 0x88b6e32e6ULL },
+    { 0xc5a8977e5ULL, 0x9de1d2da9ULL, 0xa7ee915a3ULL, 0x95b4b87b9ULL },
+    { 0x16d81e9d5ULL, 0xcc6dd415aULL, 0xab9781b68ULL, 0x5a82bb633ULL },
+    { 0xb484e02f5ULL, 0xaca872265ULL, 0xaf407212dULL, 0xa644e1535ULL },
+    { 0xed34a496dULL, 0xcf81e1e27ULL, 0xb69252cb7ULL, 0xe478781f3ULL },
+    { 0x09920fb13ULL, 0x56519e442ULL, 0xc8df04990ULL, 0x422798a6aULL },
+    { 0xfb5ab9bcbULL, 0x5ebcafd3eULL, 0xd3d9d5adfULL, 0x7cbf53d7aULL },
+    { 0x2506341ebULL, 0x8c31a9705ULL, 0xd782c60a4ULL, 0xa0e958c31ULL },
+    { 0xe091a848fULL, 0x44b2758a4ULL, 0xf12158907ULL, 0x251ae4d22ULL },
+    { 0xc273930b8ULL, 0x51e609971ULL, 0x1d0c9ce43ULL, 0x8e990678aULL },
+    { 0x102b1ad04ULL, 0x014acc18aULL, 0x20b58d408ULL, 0x518335280ULL },
+    { 0x38d729af4ULL, 0x5a2e7e247ULL, 0x2f594eb1cULL, 0xe247e745aULL },
+    { 0xd63f82a5cULL, 0xc9ca4ba7aULL, 0x3a541fc6bULL, 0x5e5d25393ULL },
+    { 0x5db0f72a2ULL, 0xf3f912d05ULL, 0x454ef0dbaULL, 0xa0b489fcfULL },
+    { 0x7324d4fcaULL, 0x29b9a3f92ULL, 0x53f2b24ceULL, 0x49fc59d94ULL },
+    { 0x47dce6946ULL, 0xe8d5d0e1eULL, 0x629673be2ULL, 0x7870bab17ULL },
+    { 0xdd1a4c72eULL, 0xe219cfca9ULL, 0x74e3258bbULL, 0x953f39847ULL },
+    { 0x9ade31b51ULL, 0x5e0c9a37eULL, 0x8ad8c7b59ULL, 0x7ec59307aULL },
+    { 0x4c19ea4b9ULL, 0xe6e2058cdULL, 0x9d2579832ULL, 0xb31a04767ULL },
+    { 0x819520415ULL, 0x4402506e4ULL, 0xa8204a981ULL, 0x2760a4022ULL },
+    { 0xd0ad44ef5ULL, 0x2d2b52aebULL, 0xaf722b50bULL, 0xd754ad4b4ULL },
+    { 0xa9030236dULL, 0x0e42eb421ULL, 0xb6c40c095ULL, 0x842d74270ULL },
+    { 0x5a63f365dULL, 0x3fce4b9d4ULL, 0xba6cfc65aULL, 0x2b9d273fcULL },
+    { 0xa7388ca8fULL, 0xc5b16743aULL, 0xf15311ce5ULL, 0x5c2e68da3ULL },
+    { 0xc1fcd12e0ULL, 0x79a412f29ULL, 0x0748b3f83ULL, 0x94f48259eULL },
+    { 0x12a258f50ULL, 0x29089e1d2ULL, 0x0af1a4548ULL, 0x4b8791094ULL },
+    { 0xb0d295970ULL, 0x588db8163ULL, 0x0e9a94b0dULL, 0xc681db11aULL },
+    { 0xac9e847d4ULL, 0xcaa1fa2e8ULL, 0x2be217935ULL, 0x1745f8553ULL },
+    { 0x70693747cULL, 0x194f619cdULL, 0x3e2ec960eULL, 0xb3986f298ULL },
+    { 0x44b514b32ULL, 0xc11392b43ULL, 0x4cd28ad22ULL, 0xc2d49c883ULL },
+    { 0xe74dede0aULL, 0xb09727ebeULL, 0x507b7b2e7ULL, 0x7d7e4e90dULL },
+    { 0x351d6242aULL, 0xe05a2168dULL, 0x54246b8acULL, 0xb16845a07ULL },
+    { 0x8e7dab3eaULL, 0xdbf68723dULL, 0x57cd5be71ULL, 0xbc4e16fdbULL },
+    { 0x52db05856ULL, 0x581f5885aULL, 0x6a1a0db4aULL, 0x5a11af81aULL },
+    { 0xf087f43b6ULL, 0x20bbfab65ULL, 0x6dc2fe10fULL, 0xa6d5fdd04ULL },
+    { 0x4e90986e1ULL, 0xcea016991ULL, 0x876190972ULL, 0x899680573ULL },
+    { 0xd26427599ULL, 0x156d81af4ULL, 0x99ae4264bULL, 0x2f581b6a8ULL },
+    { 0x24c2f5fd5ULL, 0xbca5fa1c6ULL, 0xabfaf4324ULL, 0x6385fa53dULL },
+    { 0x328ee4293ULL, 0x24b93a25cULL, 0xc9427714cULL, 0x3a45c9d24ULL },
+    { 0x6b3ea290bULL, 0x47d0a9e1eULL, 0xd09457cd6ULL, 0x787950be2ULL },
+    { 0xd9412bc2bULL, 0x165e05ca7ULL, 0xd43d4829bULL, 0xe53a07a68ULL },
+    { 0x9ca574c57ULL, 0xaf1b503e6ULL, 0xea32ea539ULL, 0x67c0ad8f5ULL },
+    { 0x116ddb4afULL, 0x35fe45789ULL, 0xf52dbb688ULL, 0x91ea27facULL },
+    { 0xae5747868ULL, 0xfa4729233ULL, 0x161e2ea75ULL, 0xcc494e25fULL },
+    { 0x72e075614ULL, 0x310d729d4ULL, 0x286ae074eULL, 0x2b94eb08cULL },
+    { 0xc696b4566ULL, 0xc891d8bb5ULL, 0x66a2d6963ULL, 0xadd1b8913ULL },
+    { 0xa8c5c3cd1ULL, 0x3ee6302e2ULL, 0x8b3c3a315ULL, 0x4740c677cULL },
+    { 0x5b154a771ULL, 0x6e4a86ed1ULL, 0x8ee52a8daULL, 0x8b7615276ULL },
+    { 0xcda3b8c85ULL, 0x87a25cda6ULL, 0xa131dc5b3ULL, 0x65b3a45e1ULL },
+    { 0x4accddd67ULL, 0x3e95d4b9bULL, 0xe6bbb3352ULL, 0xd9d2ba97cULL },
+    { 0x6652efaafULL, 0xf4f56f817ULL, 0xf55f74a66ULL, 0xe81f6af2fULL },
+    { 0xadda25a00ULL, 0xd2053a42eULL, 0x005a45bb5ULL, 0x7425ca04bULL },
+    { 0xfce6435e0ULL, 0xbb6cb8aa1ULL, 0x07ac2673fULL, 0x8551d36ddULL },
+    { 0xbb91385b8ULL, 0x422ab55f5ULL, 0x1da1c89ddULL, 0xafaad5442ULL },
+    { 0x34d993914ULL, 0xd0cef014aULL, 0x289c99b2cULL, 0x5280f730bULL },
+    { 0xa01d2975cULL, 0x5802e72ecULL, 0x3ae94b805ULL, 0x374e7401aULL },
+    { 0xc55b77b0aULL, 0xf0578bd2eULL, 0x50deedaa3ULL, 0x74bd1ea0fULL },
+    { 0xb46730c1aULL, 0x811e293e6ULL, 0x5830ce62dULL, 0x67c947881ULL },
+    { 0x4fd7d9bdaULL, 0xfab69ff52ULL, 0x5bd9bebf2ULL, 0x4aff96d5fULL },
+    { 0x3eef9d4c6ULL, 0x9bbf7c398ULL, 0x632b9f77cULL, 0x19c3efdd9ULL },
+    { 0xd310e6476ULL, 0x68d940cf5ULL, 0x6e26708cbULL, 0xaf3029b16ULL },
+    { 0x96d483821ULL, 0xd4cc10233ULL, 0x841c12b69ULL, 0xcc408332bULL },
+    { 0xbe42bfd49ULL, 0x9ecdad1b6ULL, 0x92bfd427dULL, 0x6d8b5b379ULL },
+    { 0x421231669ULL, 0x5c000b995ULL, 0x9668c4842ULL, 0xa99d0003aULL },
+    { 0x33ca55db9ULL, 0x342db95dbULL, 0x9dbaa53ccULL, 0xdba9db42cULL },
+    { 0xa50eae00dULL, 0x84c16d62cULL, 0xb007570a5ULL, 0x346b68321ULL },
+    { 0x566e20dcdULL, 0x8d2cc9a9eULL, 0xb3b04766aULL, 0x7959334b1ULL },
+    { 0x7eb102a43ULL, 0xcf5a32812ULL, 0xc25408d7eULL, 0x4814c5af3ULL },
+    { 0xaf33a6957ULL, 0xcfd3e8476ULL, 0xea965ccf5ULL, 0x6e217cbf3ULL },
+    { 0x902785c9fULL, 0x15bb492e2ULL, 0xf93a1e409ULL, 0x47492dda8ULL },
+    { 0x1aaf72c20ULL, 0x234a1839fULL, 0x0434ef558ULL, 0xf9c1852c4ULL },
+    { 0x8c4858168ULL, 0xaa0485129ULL, 0x1681a1231ULL, 0x948a12055ULL },
+    { 0xddb81cbb8ULL, 0xc32997d6bULL, 0x1dd381dbbULL, 0xd6be994c3ULL },
+    { 0x295cc040cULL, 0x628461688ULL, 0x302033a94ULL, 0x116862146ULL },
+    { 0xcc15055aeULL, 0xd233c1aa1ULL, 0x75aa0a833ULL, 0x85583cc4bULL },
+    { 0xda6b18f49ULL, 0x0f0e8f9baULL, 0x92f18d65bULL, 0x5d9f170f0ULL },
+    { 0xa7876c259ULL, 0xac033f674ULL, 0x9a436e1e5ULL, 0x2e6fcc035ULL },
+    { 0xf6b72a985ULL, 0xc56afca36ULL, 0xa1954ed6fULL, 0x6c53f56a3ULL },
+    { 0xb008f51edULL, 0x3ca9e112dULL, 0xb78af100dULL, 0xb4887953cULL },
+    { 0x4ba87ccddULL, 0x2f2155ddeULL, 0xbb33e15d2ULL, 0x7bbaa84f4ULL },
+    { 0x84e4d7463ULL, 0xbdd5103a1ULL, 0xc62eb2721ULL, 0x85c08abbdULL },
+    { 0x6c9156620ULL, 0xe24332981ULL, 0x0466a8936ULL, 0x8194cc247ULL },
+    { 0xa159e86f0ULL, 0x68a6264edULL, 0x0f6179a85ULL, 0xb72646516ULL },
+    { 0xf065acd68ULL, 0x098fa5aa7ULL, 0x16b35a60fULL, 0xe55a5f190ULL },
+    { 0x97b02291aULL, 0xc15891476ULL, 0x589440de9ULL, 0x6e2891a83ULL },
+    { 0xbf2401ce6ULL, 0x9b38606b3ULL, 0x6738024fdULL, 0xcd6061cd9ULL },
+    { 0xa4ca1fe21ULL, 0x94453e1abULL, 0x847f85325ULL, 0xd587ca229ULL },
+    { 0x11de87879ULL, 0x5ccd1964bULL, 0x9e1e17b88ULL, 0xd2698b33aULL },
+    { 0x3949b8335ULL, 0x068ee654dULL, 0xacc1d929cULL, 0xb2a677160ULL },
+    { 0x86193560dULL, 0xd403431bcULL, 0xb06ac9861ULL, 0x3d8c2c02bULL },
+    { 0xc84b420abULL, 0x267609829ULL, 0xd5042d213ULL, 0x941906e64ULL },
+    { 0x5188162bfULL, 0x047953d49ULL, 0xfd468118aULL, 0x92bca9e20ULL },
+    { 0xc674cc9f0ULL, 0xe9a584a73ULL, 0x0f9332e63ULL, 0xce521a597ULL },
+    { 0xa8169342cULL, 0x52c0693a1ULL, 0x342c96815ULL, 0x85c96034aULL },
+    { 0x5bb61abecULL, 0x4b68dff13ULL, 0x37d586ddaULL, 0xc8ffb16d2ULL },
+    { 0x40390b8aaULL, 0x51720580bULL, 0x551d09c02ULL, 0xd01a04e8aULL },
+    { 0x31e57763aULL, 0x315f337c5ULL, 0x5c6eea78cULL, 0xa3eccfa8cULL },
+    { 0x8ab5be806ULL, 0x43d354336ULL, 0x6017dad51ULL, 0x6cc2acbc2ULL },
+    { 0xe87ff2ac9ULL, 0x6fe62bb2eULL, 0x9354ffe17ULL, 0x74dd467f6ULL },
+    { 0x859076559ULL, 0xec41915e4ULL, 0x9aa6e09a1ULL, 0x27a898237ULL },
+    { 0xad0455295ULL, 0xb62162760ULL, 0xa94aa20b5ULL, 0x06e46846dULL },
+    { 0x5e649cf35ULL, 0x878dc6bd3ULL, 0xacf39267aULL, 0xcbd63b1e1ULL },
+    { 0x71bcae9ddULL, 0x4de9f5e4eULL, 0xbb9753d8eULL, 0x727af97b2ULL },
+    { 0xcac2202fdULL, 0x0e245b875ULL, 0xbf4044353ULL, 0xae1da2470ULL },
+    { 0xed6d0ce10ULL, 0x830726eeaULL, 0x08730b6b7ULL, 0x57764e0c1ULL },
+    { 0xd3b3368e8ULL, 0x496b19d37ULL, 0x1716ccdcbULL, 0xecb98d692ULL },
+    { 0x58fb98844ULL, 0x4b8e5c90aULL, 0x22119df1aULL, 0x5093a71d2ULL },
+    { 0x42b049afcULL, 0x792057853ULL, 0x3f5920d42ULL, 0xca1ea049eULL },
+    { 0xa5acdef1aULL, 0xa1d1b77eaULL, 0x58f7b35a5ULL, 0x57eed8b85ULL },
+    { 0x7e4a622d6ULL, 0xaa7c6a85cULL, 0x6b446527eULL, 0x3a1563e55ULL },
+    { 0x5de95f4e9ULL, 0xbf6f15d89ULL, 0x972fa97baULL, 0x91ba8f6fdULL },
+    { 0x22c518179ULL, 0x0c06b5351ULL, 0x9e818a344ULL, 0x8acad6030ULL },
+    { 0x73756cba5ULL, 0x652fe6e17ULL, 0xa5d36aeceULL, 0xe8767f4a6ULL },
+    { 0x502f57d8bULL, 0x357b89b8aULL, 0xd1beaf40aULL, 0x51d91deacULL },
+    { 0x9aa019d3bULL, 0x1718951f3ULL, 0xdcb980559ULL, 0xcf8a918e8ULL },
+    { 0x3db481a6fULL, 0xdf9873603ULL, 0xf65812dbcULL, 0xc06ce19fbULL },
+    { 0x27da9f9c8ULL, 0xd8e5bd51aULL, 0x139f95be4ULL, 0x58abda71bULL },
+    { 0x3a6786ed6ULL, 0x0bff6a2d2ULL, 0x6b761e65cULL, 0x4b456ffd0ULL },
+    { 0x84370f8f6ULL, 0xd9734c263ULL, 0x6f1f0ec21ULL, 0xc6432ce9bULL },
+    { 0x35424a065ULL, 0xac4c6c401ULL, 0xa605242acULL, 0x802363235ULL },
+    { 0x83258bc27ULL, 0x15d2446b3ULL, 0xe43d1a4c1ULL, 0xcd6224ba8ULL },
+    { 0x0648f6394ULL, 0xa0e5c215cULL, 0x29c6f1260ULL, 0x3a843a705ULL },
+    { 0x2e94d561cULL, 0xf281733d0ULL, 0x386ab2974ULL, 0x0bcce814fULL },
+    { 0x4832a0672ULL, 0x4b900a8c5ULL, 0x4e6054c12ULL, 0xa315009d2ULL },
+    { 0xe47521931ULL, 0xd506a0a67ULL, 0x8c984ae27ULL, 0xe650560abULL },
+    { 0x6efd8c9e9ULL, 0xcfa7b5a1bULL, 0x97931bf76ULL, 0xd85ade5f3ULL },
+    { 0x00d3f2779ULL, 0x6cc69b1c5ULL, 0x9ee4fcb00ULL, 0xa38d96336ULL },
+    { 0x63d84444bULL, 0x6c1531c98ULL, 0xd22221bc6ULL, 0x1938ca836ULL },
+    { 0xf91cb7627ULL, 0x56d962fadULL, 0xe46ed389fULL, 0xb5f469b6aULL },
+    { 0x9422d03d7ULL, 0xadb8ca160ULL, 0xebc0b4429ULL, 0x068531db5ULL },
+    { 0xbbc8141f6ULL, 0x0a3df0579ULL, 0x6f82813ddULL, 0x9ea0fbc50ULL },
+    { 0x4598ed4ceULL, 0xf8b155c8cULL, 0x732b719a2ULL, 0x313aa8d1fULL },
+    { 0x53e2f4e09ULL, 0x258d1bd96ULL, 0x9072f47caULL, 0x69bd8b1a4ULL },
+    { 0xf1b27d829ULL, 0x75093dd27ULL, 0x941be4d8fULL, 0xe4bbc90aeULL },
+    { 0x2acab23e9ULL, 0x0ee4bb11dULL, 0x97c4d5354ULL, 0xb88dd2770ULL },
+    { 0x7b7ad68f9ULL, 0x6fed29d5bULL, 0x9f16b5edeULL, 0xdab94b7f6ULL },
+    { 0x82e12ad1dULL, 0x0546d50f6ULL, 0xb8b548741ULL, 0x6f0ab62a0ULL },
+    { 0x25f5bca4bULL, 0xcd9737706ULL, 0xd253dafa4ULL, 0x60eece9b3ULL },
+    { 0x96ad33fabULL, 0x957a933bfULL, 0xd5fccb569ULL, 0xfdcc95ea9ULL },
+    { 0x74ddda59bULL, 0xe4feb5bc8ULL, 0xd9a5bbb2eULL, 0x13dad7f27ULL },
+    { 0xbe3310527ULL, 0xc71ae81b1ULL, 0xe4a08cc7dULL, 0x8d81758e3ULL },
+    { 0xaf6a8ee3cULL, 0x83c56f4fbULL, 0x3c77156f5ULL, 0xdf2f6a3c1ULL },
+    { 0x509d0f55eULL, 0x585bd5ac8ULL, 0x7aaf0b90aULL, 0x135abda1aULL },
+    { 0x5aa887cadULL, 0x17e95189bULL, 0xb53e1155aULL, 0xd918a97e8ULL },
+    { 0xf8d80e71dULL, 0x464df78e8ULL, 0xb8e701b1fULL, 0x171efb262ULL },
+    { 0x1229d43a0ULL, 0x21ab82119ULL, 0x05c2b9448ULL, 0x98841d584ULL },
+    { 0x3ad5e6628ULL, 0x62cf33295ULL, 0x14667ab5cULL, 0xa94ccf346ULL },
+    { 0x443f9c5e2ULL, 0xc9b38cb89ULL, 0x47a39fc22ULL, 0x91d31cd93ULL },
+    { 0x35e01af72ULL, 0x895cb65c3ULL, 0x4ef5807acULL, 0xc3a6d3a91ULL },
+    { 0x52544d726ULL, 0x701dc6a91ULL, 0x64eb22a4aULL, 0x89563b80eULL },
+    { 0x08de21419ULL, 0x5604192ccULL, 0x982847b10ULL, 0x33498206aULL },
+    { 0x97e9f2e55ULL, 0xadce525feULL, 0xaa74f97e9ULL, 0x7fa4a73b5ULL },
+    { 0x75b97b875ULL, 0xfd4a74d4fULL, 0xae1de9daeULL, 0xf2b2e52bfULL },
+    { 0x1c953f6adULL, 0xd66b57385ULL, 0xb56fca938ULL, 0xa1cead66bULL },
+    { 0x4888d0aefULL, 0x2eb05390bULL, 0xf750b1112ULL, 0xd09ca0d74ULL },
+    { 0x2352857d8ULL, 0x58a5ab4d0ULL, 0x1bea14ac4ULL, 0x0b2d5a51aULL },
+    { 0x910a0c9f8ULL, 0x08298d46bULL, 0x1f9305089ULL, 0xd62b19410ULL },
+    { 0x726afdcc4ULL, 0x39ad6c99eULL, 0x233bf564eULL, 0x79936b59cULL },
+    { 0x46b6dfb8cULL, 0xf1e1dfb12ULL, 0x31dfb6d62ULL, 0x48dfb878fULL },
+    { 0x371e98c9cULL, 0xc0a86d7daULL, 0x3931978ecULL, 0x5beb61503ULL },
+    { 0xf28540b4aULL, 0x281ab3a32ULL, 0x52d02a14fULL, 0x4c5cd5814ULL },
+    { 0x9b350445aULL, 0x4b1b016f0ULL, 0x5a220acd9ULL, 0x0f680d8d2ULL },
+    { 0x8aec91f8dULL, 0x17a4d33baULL, 0xb1f893751ULL, 0x5dccb25e8ULL },
+    { 0xad55ad4dfULL, 0xdeb7656e4ULL, 0xfb2b5aab5ULL, 0x276a6ed7bULL },
+    { 0x2a18cad02ULL, 0x62d0a409aULL, 0x40b531854ULL, 0x590250b46ULL },
+    { 0xed023ca5aULL, 0x8a112fd66ULL, 0x5a53c40b7ULL, 0x66bf48851ULL },
+    { 0xbe89709b1ULL, 0xa62ab017fULL, 0x8d90e917dULL, 0xfe80d5465ULL },
+    { 0x42e9b9c89ULL, 0x15a61599eULL, 0x9139d9742ULL, 0x799a865a8ULL },
+    { 0xe0b934729ULL, 0x4503b39adULL, 0x94e2c9d07ULL, 0xb59cdc0a2ULL },
+    { 0x8720dc36bULL, 0xad9187531ULL, 0xd6c3b04e1ULL, 0x8cae189b5ULL },
+    { 0x5d8460897ULL, 0xa63850e46ULL, 0xe910621baULL, 0x6270a1c65ULL },
+    { 0x90cccd02fULL, 0x349d55229ULL, 0xf40b33309ULL, 0x944aab92cULL },
+    { 0x8c86d4a88ULL, 0xa2a11b322ULL, 0x1152b6131ULL, 0x44cd88545ULL },
+    { 0x78a94c24cULL, 0x2b0b77808ULL, 0x32432951eULL, 0x101eed0d4ULL },
+    { 0xb665fbcbcULL, 0xb1ee653f7ULL, 0x3d3dfa66dULL, 0xefca6778dULL },
+    { 0x27a7201a6ULL, 0x8132f8615ULL, 0x65804e5e4ULL, 0xa861f4c81ULL },
+    { 0xc1ca450d5ULL, 0x3c2558c68ULL, 0xab0a25383ULL, 0x1631aa43cULL },
+    { 0x4b26f206dULL, 0x2fc049f15ULL, 0xb604f64d2ULL, 0xa8f9203f4ULL },
+    { 0x92252e27bULL, 0x0d5b07275ULL, 0xde474a449ULL, 0xae4e0dab0ULL },
+    { 0xf0af62188ULL, 0x216ab9a2cULL, 0x11846f50fULL, 0x3459d5684ULL },
+    { 0x32a17c0b6ULL, 0x213b74155ULL, 0x6d03e854cULL, 0xaa82edc84ULL },
+    { 0x6b093aa2eULL, 0x025267d1fULL, 0x7455c90d6ULL, 0xf8be64a40ULL },
+    { 0x86e7bdcd5ULL, 0x9da75c3f6ULL, 0xab3bde761ULL, 0x6fc3ae5b9ULL },
+    { 0x464c80b5bULL, 0x8c9483a5aULL, 0xdad013262ULL, 0x5a5c12931ULL },
+    { 0x6e92bce97ULL, 0xc6b17e9d6ULL, 0xe973d4976ULL, 0x6b97e8d63ULL },
+    { 0x0a8dd2ad4ULL, 0x2ae25235aULL, 0x2b54bb150ULL, 0x5ac4a4754ULL },
+    { 0x851afeea9ULL, 0xe4e10f5afULL, 0x9577f58a1ULL, 0xf5af08727ULL },
+    { 0x667a70499ULL, 0xe524299dcULL, 0x9920e5e66ULL, 0x3b99424a7ULL },
+    { 0x71316166dULL, 0x7d0a63c85ULL, 0xb66868c8eULL, 0xa13c650beULL },
+    { 0xc577a052fULL, 0xc596c9ea5ULL, 0xf4a05eea3ULL, 0xa579369a3ULL },
+    { 0xe0464cbbcULL, 0x2025efa63ULL, 0x3dd326207ULL, 0xc65f7a404ULL },
+    { 0xf409558daULL, 0xb83b2196aULL, 0x5b1aa902fULL, 0x56984dc1dULL },
+    { 0x224f94a99ULL, 0x04a72b35aULL, 0x99529f244ULL, 0x5acd4e520ULL },
+    { 0xe558c8f4dULL, 0xec84e7caaULL, 0xb2f131aa7ULL, 0x553e72137ULL },
+    { 0xf312d1c0bULL, 0x749829db2ULL, 0xd038b48cfULL, 0x4db94192eULL },
+    { 0x2972587cbULL, 0x6f34af580ULL, 0xd3e1a4e94ULL, 0x01af52cf6ULL },
+    { 0x41b326624ULL, 0x41435ac85ULL, 0x24664cd82ULL, 0xa135ac282ULL },
+    { 0xda57f4d6cULL, 0x6a8fc9bb7ULL, 0x36b2fea5bULL, 0xedd93f156ULL },
+    { 0xba016dba9ULL, 0x362ba7037ULL, 0x95db6805dULL, 0xec0e5d46cULL },
+    { 0x3589c6b05ULL, 0xa4cbf240aULL, 0xa0d6391acULL, 0x5024fd325ULL },
+    { 0xdf4508bd5ULL, 0x8e2ec6e72ULL, 0xabd10a2fbULL, 0x4e7637471ULL },
+    { 0x325222fa8ULL, 0x406cab097ULL, 0x15f444a4cULL, 0xe90d53602ULL },
+    { 0x5736797d4ULL, 0xf928cefd4ULL, 0x2be9e6ceaULL, 0x2bf73149fULL },
+    { 0x644d4abeaULL, 0xa876a7a0bULL, 0x57d52b226ULL, 0xd05e56e15ULL },
+    { 0x0dbd0e4faULL, 0xcb73156c9ULL, 0x5f270bdb0ULL, 0x936a8ced3ULL },
+    { 0x14129bf6dULL, 0xdcc8cf183ULL, 0xb6fd94828ULL, 0xc18f3133bULL },
+    { 0xa0898d9e1ULL, 0x1ca3b402bULL, 0x879b19105ULL, 0xd402dc538ULL },
+    { 0x7450b6e2bULL, 0xc4dd23987ULL, 0xd476d0a2eULL, 0xe19c4bb23ULL },
+    { 0xe0e41c367ULL, 0x0d15f6b21ULL, 0xe6c382707ULL, 0x84d6fa8b0ULL },
+    { 0x699565fdbULL, 0x7e33b3ec6ULL, 0xdbfa6a996ULL, 0x637cdcc7eULL },
+    { 0x67a0e9168ULL, 0xb980b5c15ULL, 0x1689705e6ULL, 0xa83ad019dULL },
+    { 0x19fcb44dcULL, 0x4bad517ccULL, 0x3b22d3f98ULL, 0x33e8ab5d2ULL },
+    { 0xf0fe4a6c6ULL, 0x697c7eaa8ULL, 0x636527f0fULL, 0x1557e3e96ULL },
+    { 0x4ee5dc0beULL, 0xa3b755b51ULL, 0x7d03ba772ULL, 0x8adaaedc5ULL },
+    { 0xb25ab1e77ULL, 0x5c9c6a1ffULL, 0xee78d5a4dULL, 0xff856393aULL },
+    { 0x54c5a68fdULL, 0x8cef51a47ULL, 0xbf165a32aULL, 0xe258af731ULL },
+    { 0xf7152fd43ULL, 0xdc5ba4eb6ULL, 0xc2bf4a8efULL, 0x6d725da3bULL },
+    { 0x4f917de8aULL, 0xf23317d96ULL, 0x517be89f2ULL, 0x69be8cc4fULL },
+    { 0x093518ee6ULL, 0x4b3246783ULL, 0x67718ac90ULL, 0xc1e624cd2ULL },
+    { 0xaa4de58d6ULL, 0x3ab76027eULL, 0x6b1a7b255ULL, 0x7e406ed5cULL },
+    { 0xfbbda364eULL, 0x5bda73ebcULL, 0x726c5bddfULL, 0x3d7ce5bdaULL },
+    { 0xc28c4f9ddULL, 0x3c61d5a7aULL, 0xbb9f23143ULL, 0x5e5ab863cULL },
+    { 0xdddd5aec8ULL, 0xea6e17faaULL, 0x1375abbbbULL, 0x55fe87657ULL },
+    { 0x9a7b2d694ULL, 0x532f4e0fcULL, 0x296b4de59ULL, 0x3f072f4caULL },
+    { 0xda2edc911ULL, 0x27898cb7aULL, 0x8893b745bULL, 0x5ed3191e4ULL },
+    { 0x121542195ULL, 0x646ac0250ULL, 0xa9842a848ULL, 0x0a4035626ULL },
+    { 0x3afd7e41dULL, 0x674f753dcULL, 0xb827ebf5cULL, 0x3bcaef2e6ULL },
+    { 0xd2913021cULL, 0x400a53974ULL, 0x3840c894bULL, 0x2e9ca5002ULL },
+    { 0x885b7bed6ULL, 0x7a764e1eeULL, 0x6b7deda11ULL, 0x778726e5eULL },
+    { 0xff1a9403dULL, 0xc68969d79ULL, 0xbc02958ffULL, 0x9eb969163ULL },
+    { 0x8ad205daaULL, 0x5235990b3ULL, 0x55ba04b51ULL, 0xcd099ac4aULL },
+    { 0x7cfee556eULL, 0xfb9df9a8dULL, 0x76aa77f3eULL, 0xb159fb9dfULL },
+    { 0x0f1dbc2d9ULL, 0xcea30775cULL, 0x9b43db8f0ULL, 0x3aee0c573ULL },
+    { 0xad7d33779ULL, 0xdf46a37edULL, 0x9eeccbeb5ULL, 0xb7ec562fbULL },
+    { 0x5e23da945ULL, 0xafcacc912ULL, 0xa295bc47aULL, 0x4893353f5ULL },
+    { 0xca876472dULL, 0x2603dbab5ULL, 0xb4e26e153ULL, 0xad5dbc064ULL },
+    { 0x2a3456e27ULL, 0x675162393ULL, 0xe476a2c54ULL, 0xc9c468ae6ULL },
+    { 0xb380687d6ULL, 0x2838f64f4ULL, 0x6be1601cdULL, 0x2f26f1c14ULL },
+    { 0x49e0a51f6ULL, 0x1bb5d0c45ULL, 0x6f8a50792ULL, 0xa230badd8ULL },
+    { 0x90e2533e9ULL, 0x3d6c9b121ULL, 0x97cca4709ULL, 0x848d936bcULL },
+    { 0xdd010663dULL, 0x864b43ce1ULL, 0xbc66080bbULL, 0x873c2d261ULL },
+    { 0x76a05c908ULL, 0xa109b5912ULL, 0x1093a056eULL, 0x489ad9085ULL },
+    { 0x0ed903df6ULL, 0xda76d00dbULL, 0x6fbc09b70ULL, 0xdb00b6e5bULL },
+    { 0x2b70b771dULL, 0x57c5e35d4ULL, 0xb8eed0ed4ULL, 0x2bac7a3eaULL },
+    { 0x4e8ce2773ULL, 0xaed092addULL, 0xcee473172ULL, 0xbb5490b75ULL },
+    { 0xa46d048c4ULL, 0x89276022aULL, 0x23120b625ULL, 0x54406e491ULL },
+    { 0xae48885baULL, 0x82b4a50f9ULL, 0x5da111275ULL, 0x9f0a52d41ULL },
+    { 0x0aa3468f3ULL, 0x2f7318053ULL, 0xcf162c550ULL, 0xca018cef4ULL },
+    { 0x6ae16f137ULL, 0x3757f4855ULL, 0xec8f68756ULL, 0xaa12feaecULL },
+    { 0x95230dbadULL, 0x952bcf423ULL, 0xb5db0c4a9ULL, 0xc42f3d4a9ULL },
+    { 0xe488b54d4ULL, 0x98a1709ecULL, 0x2b2ad1127ULL, 0x3790e8519ULL },
+    { 0x790a4b6caULL, 0x3a782fc88ULL, 0x536d2509eULL, 0x113f41e5cULL },
+    { 0x40237f939ULL, 0x35438d947ULL, 0x9c9fec402ULL, 0xe29b1c2acULL },
+    { 0x2dbf29c83ULL, 0xd7323c68eULL, 0xc1394fdb4ULL, 0x7163c4cebULL },
+    { 0xcad64c360ULL, 0x6a059ea31ULL, 0x06c326b53ULL, 0x8c579a056ULL },
+    { 0xd3af5997aULL, 0x391a9df7bULL, 0x5e99af5cbULL, 0xdefb9589cULL },
+    { 0x9d2ea78f5ULL, 0x9fe94866fULL, 0xaf1e574b9ULL, 0xf661297f9ULL },
+    { 0x22d362067ULL, 0x6c5678015ULL, 0xe6046cb44ULL, 0xa801e6a36ULL },
+    { 0xcca92b866ULL, 0x9b525482fULL, 0x661d49533ULL, 0xf412a4ad9ULL },
+    { 0x552b9fa71ULL, 0x9dcb0ed4bULL, 0x8e5f9d4aaULL, 0xd2b70d3b9ULL },
+    { 0xcbb2adcdbULL, 0x5fb11dcf6ULL, 0xdb3b54dd3ULL, 0x6f3b88dfaULL },
+    { 0x44fa46c67ULL, 0xed555888bULL, 0xe63625f22ULL, 0xd111aaab7ULL },
+    { 0xe7268fb97ULL, 0x95f1eee72ULL, 0xe9df164e7ULL, 0x4e7778fa9ULL },
+    { 0x24af17aa2ULL, 0x91733a30bULL, 0x455e8f524ULL, 0xd0c5cce89ULL },
+    { 0x43e8c2adaULL, 0x29f413c5aULL, 0x5b54317c2ULL, 0x5a3c82f94ULL },
+    { 0x91cd1a47dULL, 0x0c4e557e9ULL, 0xbe258b389ULL, 0x97eaa7230ULL },
+    { 0x680502c2aULL, 0x025221a83ULL, 0x54340a016ULL, 0xc15844a40ULL },
+    { 0x05d57a1daULL, 0xe87695744ULL, 0x5b85eaba0ULL, 0x22ea96e17ULL },
+    { 0x5833b2148ULL, 0x4bca89904ULL, 0x1284dcc1aULL, 0x2099153d2ULL },
+    { 0xcf1718b24ULL, 0xc202cef33ULL, 0x24d18e8f3ULL, 0xccf734043ULL },
+    { 0x56147c8b2ULL, 0xe03904b57ULL, 0x4d13e286aULL, 0xead209c07ULL },
+    { 0xfe51bd2d1ULL, 0xdeaf26974ULL, 0x8b4bd8a7fULL, 0x2e964f57bULL },
+    { 0x30eea5a84ULL, 0x11ad7a20eULL, 0x215a5770cULL, 0x7045eb588ULL },
+    { 0x5e1b4ea62ULL, 0xea5b0e81bULL, 0x46572d87aULL, 0xd8170da57ULL },
+    { 0x25398e343ULL, 0xcdd3a6408ULL, 0xc2c719ca4ULL, 0x10265cbb3ULL },
+    { 0x47ee35bb2ULL, 0x91359af5fULL, 0x4ddac77e2ULL, 0xfaf59ac89ULL },
+    { 0x69e29398bULL, 0x17f4b9d02ULL, 0xd19c94796ULL, 0x40b9d2fe8ULL },
+    { 0xcbeb038b4ULL, 0x136658c7bULL, 0x2d1c0d7d3ULL, 0xde31a66c8ULL },
+    { 0x9721c1759ULL, 0xbd8a834f0ULL, 0x9ae8384e9ULL, 0x0f2c151bdULL },
+    { 0x755148979ULL, 0xec0ea5c43ULL, 0x9e9128aaeULL, 0xc23a57037ULL },
+    { 0x57f363e53ULL, 0xfd5e1acd6ULL, 0xca7c6cfeaULL, 0x6b3587abfULL },
+    { 0xae6414680ULL, 0x8325223b0ULL, 0x016282675ULL, 0x0dc44a4c1ULL },
+    { 0x7e93a19b5ULL, 0xd6aaf8857ULL, 0xad985c97eULL, 0xea11f556bULL },
+    { 0xa983d1f52ULL, 0x3a92ba5e2ULL, 0x4af8bc195ULL, 0x47a5d495cULL },
+    { 0x645b01af9ULL, 0xdc262b84bULL, 0x9f580da26ULL, 0xd21d4643bULL },
+    { 0x0da779565ULL, 0xbf02dc785ULL, 0xa6a9ee5b0ULL, 0xa1e3b40fdULL },
+    { 0x72109f93dULL, 0x54c9e5953ULL, 0xbc9f9084eULL, 0xca9a7932aULL },
+    { 0x8d0c47c6bULL, 0xbe51016abULL, 0xd63e230b1ULL, 0xd56808a7dULL },
+    { 0x6de54c423ULL, 0xa71734e81ULL, 0xc4232a7b6ULL, 0x8172ce8e5ULL },
+    { 0xf123bf66bULL, 0x1ddb2fda5ULL, 0xd66fdc48fULL, 0xa5bf4dbb8ULL },
+    { 0xb4e7ea637ULL, 0xa5de7e2e5ULL, 0xec657e72dULL, 0xa747e7ba5ULL },
+    { 0xe5e0e26c5ULL, 0xade472ca4ULL, 0xa364707a7ULL, 0x2534e27b5ULL },
+    { 0x5a31049efULL, 0x4f3bc1813ULL, 0xf79208c5aULL, 0xc8183dcf2ULL },
+    { 0x89f85117bULL, 0x7f1491569ULL, 0xde88a1f91ULL, 0x96a8928feULL },
+    { 0x6fbb9f2eaULL, 0xdbf33fd19ULL, 0x574f9ddf6ULL, 0x98bfccfdbULL },
+    { 0x50afacfa6ULL, 0x01bbdea8fULL, 0x65f35f50aULL, 0xf157bdd80ULL },
+    { 0xb57107396ULL, 0xd17fe2460ULL, 0x69ce08eadULL, 0x06247fe8bULL },
+    { 0x79772f092ULL, 0x537f2ce44ULL, 0x490f4ee9eULL, 0x22734fecaULL },
+    { 0xb11d41493ULL, 0x743a206e8ULL, 0xc9282b88dULL, 0x176045c2eULL },
+    { 0x1de3234aeULL, 0x937e59485ULL, 0x752c4c7b8ULL, 0xa129a7ec9ULL },
+    { 0xb394226cdULL, 0x4c68736b4ULL, 0xb364429cdULL, 0x2d6ce1632ULL },
+    { 0x2c7e5cad1ULL, 0xef252e34aULL, 0x8b53a7e34ULL, 0x52c74a4f7ULL },
+    { 0x5f733097dULL, 0xcf0ec9d57ULL, 0xbe90ccefaULL, 0xeab9370f3ULL },
+    { 0x45fbe0a0dULL, 0xe5865bc0eULL, 0xb0507dfa2ULL, 0x703da61a7ULL },
+    { 0x097a4ab00ULL, 0x63448e40aULL, 0x00d525e90ULL, 0x5027122c6ULL },
+    { 0xb37792a3aULL, 0x41de2b773ULL, 0x5c549eecdULL, 0xceed47b82ULL },
+    { 0x6223afdc7ULL, 0x1df3ec896ULL, 0xe3bf5c446ULL, 0x69137cfb8ULL },
+    { 0x6c9b636c9ULL, 0xfe623b88cULL, 0x936c6d936ULL, 0x311dc467fULL },
+    { 0x9b4e8e2e9ULL, 0x0eed0f639ULL, 0x9747172d9ULL, 0x9c6f0b770ULL },
+    { 0xf9c3c2153ULL, 0x2edeb8c60ULL, 0xca843c39fULL, 0x0631d7b74ULL },
+    { 0x772b0feabULL, 0x957b2fc9bULL, 0xd57f0d4eeULL, 0xd93f4dea9ULL },
+    { 0x66fa9aab4ULL, 0xc1e47e95bULL, 0x2d5595f66ULL, 0xda97e2783ULL },
+    { 0x74624ddfdULL, 0xbd2ded8c3ULL, 0xbfbb2462eULL, 0xc31b7b4bdULL },
+    { 0x19de4e664ULL, 0x6a4d5e689ULL, 0x266727b98ULL, 0x9167ab256ULL },
+    { 0x9429e635eULL, 0xa9dbc306cULL, 0x7ac679429ULL, 0x360c3db95ULL },
+    { 0x4ceca3f64ULL, 0x9bc4d2a8fULL, 0x26fc53732ULL, 0xf154b23d9ULL },
+    { 0xa4b4066a6ULL, 0xc171722a1ULL, 0x656602d25ULL, 0x8544e8e83ULL },
+    { 0x1e5658d74ULL, 0xea0ccc3d3ULL, 0x2eb1a6a78ULL, 0xcbc333057ULL },
+    { 0xdb49c0a12ULL, 0x229e02c7aULL, 0x4850392dbULL, 0x5e3407944ULL },
+    { 0x4f5190da7ULL, 0xc6b6c0d93ULL, 0xe5b098af2ULL, 0xc9b036d63ULL },
+    { 0x01432cad5ULL, 0x0c274e446ULL, 0xab534c280ULL, 0x62272e430ULL },
+    { 0x52fc28739ULL, 0x450c97addULL, 0x9ce143f4aULL, 0xbb5e930a2ULL },
+    { 0x43933ed2fULL, 0x4453ddd97ULL, 0xf4b7cc9c2ULL, 0xe9bbbca22ULL },
+    { 0x6b071dac0ULL, 0x1a232ef12ULL, 0x035b8e0d6ULL, 0x48f74c458ULL },
+    { 0x510dab8e1ULL, 0x1cea04e0fULL, 0x871d5b08aULL, 0xf07205738ULL },
+    { 0x50c91a9daULL, 0x087e9594aULL, 0x5b958930aULL, 0x529a97e10ULL },
+    { 0x5fe5942d0ULL, 0x8baf12f50ULL, 0x0b429a7faULL, 0x0af48f5d1ULL },
+    { 0x58c2b1b2aULL, 0x129c9b907ULL, 0x54d8d431aULL, 0xe09d93948ULL },
+    { 0x89414d8beULL, 0x323745463ULL, 0x7d1b28291ULL, 0xc62a2ec4cULL },
+    { 0x840a26785ULL, 0x8461ca0acULL, 0xa1e645021ULL, 0x350538621ULL },
+    { 0xb9605b01dULL, 0x374c65560ULL, 0xb80da069dULL, 0x06aa632ecULL },
+    { 0x14badcf77ULL, 0xed99de1cbULL, 0xeef3b5d28ULL, 0xd387b99b7ULL },
+    { 0xf6dbcbc64ULL, 0xf8ce7c8bbULL, 0x263d3db6fULL, 0xdd13e731fULL },
+    { 0xc0ab49a90ULL, 0x31221e86aULL, 0x09592d503ULL, 0x56178448cULL },
+    { 0x99261b9d2ULL, 0x1b788c762ULL, 0x4b9d86499ULL, 0x46e311ed8ULL },
+    { 0x6119fb136ULL, 0x70d2e4d4dULL, 0x6c8df9886ULL, 0xb2b274b0eULL },
+    { 0x88f702ec5ULL, 0x4f665a2a2ULL, 0xa3740ef11ULL, 0x4545a66f2ULL },
+    { 0x3b6dc6923ULL, 0x27dfa061bULL, 0xc4963b6dcULL, 0xd8605fbe4ULL },
+    { 0x4e6295b60ULL, 0x9b858a913ULL, 0x06da94672ULL, 0xc8951a1d9ULL },
+    { 0xd9fd26dcaULL, 0x4b7f91eaeULL, 0x53b64bf9bULL, 0x75789fed2ULL },
+    { 0xb9aad7b4dULL, 0x3fc9fb52aULL, 0xb2deb559dULL, 0x54adf93fcULL },
+    { 0x4ded5688fULL, 0xa77751f0aULL, 0xf116ab7b2ULL, 0x50f8aeee5ULL },
+    { 0x205587351ULL, 0x5cc7a2240ULL, 0x8ace1aa04ULL, 0x02445e33aULL },
+    { 0xe5c231571ULL, 0x9c04b8de5ULL, 0x8ea8c43a7ULL, 0xa7b1d2039ULL },
+    { 0xcbb988256ULL, 0x4b9256c78ULL, 0x6a4119dd3ULL, 0x1e36a49d2ULL },
+    { 0x2b172ab99ULL, 0x4662af656ULL, 0x99d54e8d4ULL, 0x6a6f54662ULL },
+    { 0xabcc19693ULL, 0x1634367f8ULL, 0xc969833d5ULL, 0x1fe6c2c68ULL },
+    { 0x889e32aafULL, 0x46705b32fULL, 0xf554c7911ULL, 0xf4cda0e62ULL },
+    { 0x0d6797b5cULL, 0x9bc7cb742ULL, 0x3ade9e6b0ULL, 0x42ed3e3d9ULL },
+    { 0x6eec3d876ULL, 0x9b1574b5fULL, 0x6e1bc3776ULL, 0xfad2ea8d9ULL },
+    { 0xa3129689eULL, 0x40f169572ULL, 0x7916948c5ULL, 0x4ea968f02ULL },
+    { 0x31277e7dbULL, 0x2d7baf7c4ULL, 0xdbe7ee48cULL, 0x23ef5deb4ULL },
+    { 0xc53b2129eULL, 0xd1324bc6cULL, 0x79484dca3ULL, 0x363d24c8bULL },
+    { 0x0e5c7499fULL, 0xe635c135eULL, 0xf992e3a70ULL, 0x7ac83ac67ULL },
+    { 0xced81f211ULL, 0xd64516978ULL, 0x884f81b73ULL, 0x1e968a26bULL },
+    { 0x11beee163ULL, 0x6dd99c60dULL, 0xc68777d88ULL, 0xb06399bb6ULL },
+    { 0x5bf677c06ULL, 0x735d58f96ULL, 0x603ee6fdaULL, 0x69f1abaceULL },
+    { 0xcd319d14eULL, 0xdb93c5d20ULL, 0x728b98cb3ULL, 0x04ba3c9dbULL },
+    { 0x21680e48dULL, 0x056565488ULL, 0xb12701684ULL, 0x112a6a6a0ULL },
+    { 0x282784fabULL, 0x07b3ab283ULL, 0xd5f21e414ULL, 0xc14d5cde0ULL },
+    { 0xa8f4a61a0ULL, 0x43e5b0225ULL, 0x058652f15ULL, 0xa440da7c2ULL },
+    { 0x3176513b4ULL, 0x712cea741ULL, 0x2dc8a6e8cULL, 0x82e57348eULL },
+    { 0xf769ce6e2ULL, 0xa9ff26cb9ULL, 0x4767396efULL, 0x9d364ff95ULL },
+    { 0x5392a3b1dULL, 0x54c8dbc56ULL, 0xb8dc549caULL, 0x6a3db132aULL },
+    { 0x5865ad6cfULL, 0x1fbf47a84ULL, 0xf36b5a61aULL, 0x215e2fdf8ULL },
+    { 0xbe73790b0ULL, 0xf32e2c175ULL, 0x0d09ece7dULL, 0xae83474cfULL },
+    { 0x5ae8ee5bbULL, 0x27fd958ddULL, 0xdda77175aULL, 0xbb1a9bfe4ULL },
+    { 0x8b6a397a0ULL, 0x13248e5bdULL, 0x05e9c56d1ULL, 0xbda7124c8ULL },
+    { 0xa3e95e7ceULL, 0x2977f75b8ULL, 0x73e7a97c5ULL, 0x1daefee94ULL },
+    { 0x5b9f9f84dULL, 0x5ecb5df1aULL, 0xb21f9f9daULL, 0x58fbad37aULL },
+    { 0x2f4b93c7bULL, 0x9ed6295dbULL, 0xde3c9d2f4ULL, 0xdba946b79ULL },
+    { 0x4c7520a96ULL, 0xc33642a46ULL, 0x69504ae32ULL, 0x625426cc3ULL },
+    { 0x62a302feeULL, 0x0972fb893ULL, 0x77f40c546ULL, 0xc91df4e90ULL },
+    { 0x67be848b7ULL, 0xc5b178e5bULL, 0xed1217de6ULL, 0xda71e8da3ULL },
+    { 0xb7511f85cULL, 0xd84f65572ULL, 0x3a1f88aedULL, 0x4eaa6f21bULL },
+    { 0x18595c467ULL, 0x6e1f44189ULL, 0xe623a9a18ULL, 0x91822f876ULL },
+    { 0x15e637750ULL, 0x994d9a7c4ULL, 0x0aeec67a8ULL, 0x23e59b299ULL },
+    { 0x9855c157dULL, 0x7e8ec12e1ULL, 0xbea83aa19ULL, 0x87483717eULL },
+    { 0xdd1f57749ULL, 0xfe4b8bfa8ULL, 0x92eeaf8bbULL, 0x15fd1d27fULL },
+    { 0x748b10ba5ULL, 0x842afa90bULL, 0xa5d08d12eULL, 0xd095f5421ULL },
+    { 0x1cfd95981ULL, 0xd7af9030aULL, 0x819a9bf38ULL, 0x50c09f5ebULL },
+    { 0x636f2bce2ULL, 0x19762ce9fULL, 0x473d4f6c6ULL, 0xf97346e98ULL },
+    { 0xaf8c2498dULL, 0x8621f163eULL, 0xb192431f5ULL, 0x7c68f8461ULL },
+    { 0x212d49365ULL, 0x3d02e6609ULL, 0xa6c92b484ULL, 0x9066740bcULL },
+    { 0xada11620eULL, 0x835373520ULL, 0x7046885b5ULL, 0x04acecac1ULL },
+    { 0xef310d59dULL, 0xd723e5cf0ULL, 0xb9ab08cf7ULL, 0x0f3a7c4ebULL },
+    { 0x9b329b41eULL, 0x53d84d5f0ULL, 0x782d94cd9ULL, 0x0fab21bcaULL },
+    { 0x5f4c01a8fULL, 0x963c43e1aULL, 0xf158032faULL, 0x587c23c69ULL },
+    { 0x6e97afee0ULL, 0xdae33ea97ULL, 0x077f5e976ULL, 0xe957cc75bULL },
+    { 0x81445bb48ULL, 0x384487722ULL, 0x12dda2281ULL, 0x44ee1221cULL },
+    { 0xc48e824e7ULL, 0x8cf058aa9ULL, 0xe72417123ULL, 0x9551a0f31ULL },
+    { 0xe127b6a0cULL, 0x01c36bf26ULL, 0x3056de487ULL, 0x64fd6c380ULL },
+    { 0x58c997bc7ULL, 0x1effd290aULL, 0xe3de9931aULL, 0x5094bff78ULL },
+    { 0x2579e0cd7ULL, 0xedb6604ceULL, 0xeb3079ea4ULL, 0x732066db7ULL },
+    { 0x6b5d04227ULL, 0x461762e19ULL, 0xe4420bad6ULL, 0x98746e862ULL },
+    { 0x6d27439c2ULL, 0xbb72a8e02ULL, 0x439c2e4b6ULL, 0x407154eddULL },
+    { 0xa86525be2ULL, 0x1b37a2227ULL, 0x47da4a615ULL, 0xe4445ecd8ULL },
+    { 0xc5bbf3eb0ULL, 0xf1e21adefULL, 0x0d7cfdda3ULL, 0xf7b58478fULL },
+    { 0xe08a3f56aULL, 0x1851bd9adULL, 0x56afc5107ULL, 0xb59bd8a18ULL },
+    { 0xd1fa31e97ULL, 0x553c5adeeULL, 0xe978c5f8bULL, 0x77b5a3caaULL },
+    { 0x66487b75aULL, 0xb854a79dcULL, 0x5aede1266ULL, 0x3b9e52a1dULL },
+    { 0x98e9ed8f5ULL, 0x3faf5406fULL, 0xaf1b79719ULL, 0xf602af5fcULL },
+    { 0x9c4cd8d1fULL, 0xa69cc53eaULL, 0xf8b1b3239ULL, 0x57ca33965ULL },
+    { 0xdba2117aeULL, 0x1338dbdb1ULL, 0x75e8845dbULL, 0x8dbdb1cc8ULL },
+    { 0xfc9d2d8fdULL, 0xde2b75a6fULL, 0xbf1b4b93fULL, 0xf65aed47bULL },
+    { 0x2ad82cabfULL, 0x46357705fULL, 0xfd5341b54ULL, 0xfa0eeac62ULL },
+    { 0xcb4dcec45ULL, 0x2ec744ebaULL, 0xa2373b2d3ULL, 0x5d722e374ULL },
+    { 0xd4e67e69aULL, 0xa17d1fbe4ULL, 0x5967e672bULL, 0x27df8be85ULL },
+    { 0xb67663345ULL, 0xfd4cea234ULL, 0xa2cc66e6dULL, 0x2c45732bfULL },
+    { 0x81a140e8dULL, 0x2522534a2ULL, 0xb17028581ULL, 0x452ca44a4ULL },
+    { 0x24f8b52adULL, 0xd5a57310dULL, 0xb54ad1f24ULL, 0xb08cea5abULL },
+    { 0x21d44b897ULL, 0x747474642ULL, 0xe91d22b84ULL, 0x4262e2e2eULL },
+    { 0x8f823a17bULL, 0x8e509d575ULL, 0xde85c41f1ULL, 0xaeab90a71ULL },
+    { 0xf6711abcaULL, 0xc97ea7932ULL, 0x53d588e6fULL, 0x4c9e57e93ULL },
+    { 0x3f5e02797ULL, 0xc67cea6d8ULL, 0xe9e407afcULL, 0x1b6573e63ULL },
+    { 0xcdd4e463fULL, 0xe69553ee5ULL, 0xfc6272bb3ULL, 0xa77caa967ULL },
+    { 0x594605315ULL, 0x160dcae40ULL, 0xa8ca0629aULL, 0x02753b068ULL },
+    { 0x20ba6661dULL, 0x65417b0ccULL, 0xb86665d04ULL, 0x330de82a6ULL },
+    { 0x97bf1a5a0ULL, 0xc16a9c7b9ULL, 0x05a58fde9ULL, 0x9de395683ULL },
+    { 0x7e42daa18ULL, 0xa2cc2f952ULL, 0x1855b427eULL, 0x4a9f43345ULL },
+    { 0x62942dd55ULL, 0x5c01f4ad6ULL, 0xaabb42946ULL, 0x6b52f803aULL },
+    { 0xb1e532047ULL, 0x0d5e70724ULL, 0xe204ca78dULL, 0x24e0e7ab0ULL },
+    { 0xde64e914cULL, 0xbb8cc5a34ULL, 0x32897267bULL, 0x2c5a331ddULL },
+    { 0x475eb1e50ULL, 0xd8840afdeULL, 0x0a78d7ae2ULL, 0x7bf50211bULL },
+    { 0x19a56ca69ULL, 0x2f0b17607ULL, 0x96536a598ULL, 0xe06e8d0f4ULL },
+    { 0x9505754fdULL, 0xbc2b417e5ULL, 0xbf2aea0a9ULL, 0xa7e82d43dULL },
+    { 0x36ab3d930ULL, 0x910bbc15fULL, 0x0c9bcd56cULL, 0xfa83dd089ULL },
+    { 0x57849d781ULL, 0x94a996f90ULL, 0x81eb921eaULL, 0x09f699529ULL },
+    { 0xa487f4ce4ULL, 0xa8a3783a7ULL, 0x2732fe125ULL, 0xe5c1ec515ULL },
+    { 0xb10196d74ULL, 0x08cbe05e3ULL, 0x2eb69808dULL, 0xc7a07d310ULL },
+    { 0xca8bdcf86ULL, 0x22b3de9baULL, 0x61f3bd153ULL, 0x5d97bcd44ULL },
+    { 0xf1680fbb1ULL, 0x156da6c6bULL, 0x8ddf0168fULL, 0xd6365b6a8ULL },
+    { 0x77eb8b849ULL, 0x9dce3dc1aULL, 0x921d1d7eeULL, 0x583bc73b9ULL },
+    { 0x025312bd4ULL, 0x4866ca152ULL, 0x2bd48ca40ULL, 0x4a8536612ULL },
+    { 0x1d2a8d5c1ULL, 0x9fa98c488ULL, 0x83ab154b8ULL, 0x1123195f9ULL },
+    { 0x27756c2faULL, 0xe93727655ULL, 0x5f436aee4ULL, 0xaa6e4ec97ULL },
+    { 0x3d5053bc9ULL, 0xfe6ca3502ULL, 0x93dca0abcULL, 0x40ac5367fULL },
+    { 0x78b5aeb64ULL, 0x4bcbf6a07ULL, 0x26d75ad1eULL, 0xe056fd3d2ULL },
+    { 0x2a5d854e1ULL, 0x5ea720299ULL, 0x872a1ba54ULL, 0x99404e57aULL },
+    { 0x00ef95cecULL, 0x19a75938bULL, 0x373a9f700ULL, 0xd1c9ae598ULL },
+    { 0xc6f8c9b0aULL, 0xf1949783aULL, 0x50d931f63ULL, 0x5c1e9298fULL },
+    { 0x348af4b48ULL, 0xa889bb10eULL, 0x12d2f512cULL, 0x708dd9115ULL },
+    { 0x9addbf763ULL, 0x5edf963bdULL, 0xc6efdbb59ULL, 0xbdc69fb7aULL },
+    { 0x44b799711ULL, 0xd5829ebc0ULL, 0x88e99ed22ULL, 0x03d7941abULL },
+    { 0x351fedc09ULL, 0xf48b2d68eULL, 0x903b7f8acULL, 0x716b4d12fULL },
+    { 0xf08485b95ULL, 0x14a9f2a62ULL, 0xa9da1210fULL, 0x4654f9528ULL },
+    { 0x82bc5d745ULL, 0x7d01d63b8ULL, 0xa2eba3d41ULL, 0x1dc6b80beULL },
+    { 0x3a86b397fULL, 0x1ed8f9357ULL, 0xfe9cd615cULL, 0xeac9f1b78ULL },
+    { 0x8ce8891dfULL, 0x9fb4d5068ULL, 0xfb8911731ULL, 0x160ab2df9ULL },
+    { 0x3f7bcd538ULL, 0xf38fad4d9ULL, 0x1cab3defcULL, 0x9b2b5f1cfULL },
+    { 0xb40d91467ULL, 0x9c9a603a9ULL, 0xe6289b02dULL, 0x95c065939ULL },
+    { 0x6dac56b66ULL, 0xab51f2f0bULL, 0x66d6a35b6ULL, 0xd0f4f8ad5ULL },
+    { 0x58956900dULL, 0x760a55a04ULL, 0xb0096a91aULL, 0x205aa506eULL },
+    { 0x4ca33f593ULL, 0x97739c9c4ULL, 0xc9afcc532ULL, 0x23939cee9ULL },
+    { 0x35a7d7501ULL, 0xb5cbb8780ULL, 0x80aebe5acULL, 0x01e1dd3adULL },
+    { 0x16e974f4bULL, 0xad1f9319eULL, 0xd2f2e9768ULL, 0x798c9f8b5ULL },
+    { 0x6adb7e633ULL, 0x66573e9ddULL, 0xcc67edb56ULL, 0xbb97cea66ULL },
+    { 0xacfec78a5ULL, 0xf7e57822bULL, 0xa51e37f35ULL, 0xd441ea7efULL },
+    { 0xc36d70356ULL, 0x2916c2f7cULL, 0x6ac0eb6c3ULL, 0x3ef436894ULL },
+    { 0x855254f56ULL, 0xe815ca5e2ULL, 0x6af2a4aa1ULL, 0x47a53a817ULL },
+    { 0xd370946e7ULL, 0x4dbd42db1ULL, 0xe76290ecbULL, 0x8db42bdb2ULL },
+    { 0x9db1ce7ecULL, 0xebebd74a1ULL, 0x37e738db9ULL, 0x852ebd7d7ULL },
+    { 0xa388d9b4eULL, 0x3890f753aULL, 0x72d9b11c5ULL, 0x5caef091cULL },
+    { 0x62fc8676eULL, 0x49d5f3a99ULL, 0x76e613f46ULL, 0x995cfab92ULL },
+    { 0xd1e4ce0f2ULL, 0x29fd14e61ULL, 0x4f073278bULL, 0x86728bf94ULL },
+    { 0xe0c577870ULL, 0x384730b67ULL, 0x0e1eea307ULL, 0xe6d0ce21cULL },
+    { 0x8889f1797ULL, 0x36b2d21ecULL, 0xe9e8f9111ULL, 0x3784b4d6cULL },
+    { 0xaf677c9e0ULL, 0xab27ac737ULL, 0x0793ee6f5ULL, 0xece35e4d5ULL },
+    { 0xfa8720ce8ULL, 0x0a2a39ab7ULL, 0x17304e15fULL, 0xed59c5450ULL },
+    { 0x20886cc5eULL, 0x2811750ceULL, 0x7a3361104ULL, 0x730ae8814ULL },
+    { 0x1a99cc8ceULL, 0x6abb5501aULL, 0x731339958ULL, 0x580aadd56ULL },
+    { 0x88a5655b1ULL, 0x3723902e5ULL, 0x8daa6a511ULL, 0xa7409c4ecULL },
+    { 0xd6f7ec025ULL, 0xe58f5ca35ULL, 0xa4037ef6bULL, 0xac53af1a7ULL },
+    { 0xf4f691084ULL, 0xd1ac78b20ULL, 0x210896f2fULL, 0x04d1e358bULL },
+    { 0x4c0aca3f5ULL, 0xaee0ce849ULL, 0xafc535032ULL, 0x921730775ULL },
+    { 0x1f05a40c7ULL, 0x8ebb40614ULL, 0xe3025a0f8ULL, 0x28602dd71ULL },
+    { 0xfa5d847c6ULL, 0x4abfe2ab8ULL, 0x63e21ba5fULL, 0x1d547fd52ULL },
+    { 0x131dadd7cULL, 0x588bc56dfULL, 0x3ebb5b8c8ULL, 0xfb6a3d11aULL },
+    { 0xc360d639fULL, 0x25f5c3d70ULL, 0xf9c6b06c3ULL, 0x0ebc3afa4ULL },
+    { 0x7ec77a953ULL, 0xae5ebcb56ULL, 0xca95ee37eULL, 0x6ad3d7a75ULL },
+    { 0x2dd4a1f81ULL, 0xd6a4b2686ULL, 0x81f852bb4ULL, 0x6164d256bULL },
+    { 0xc41ba916bULL, 0xdc928d82dULL, 0xd6895d823ULL, 0xb41b1493bULL },
+    { 0xae533020eULL, 0xc2166b134ULL, 0x7040cca75ULL, 0x2c8d66843ULL },
+    { 0x89c3766b2ULL, 0x22771a5e5ULL, 0x4d66ec391ULL, 0xa7a58ee44ULL },
+    { 0x11a768452ULL, 0x291a1c6c4ULL, 0x4a216e588ULL, 0x236385894ULL },
+    { 0x731836b8aULL, 0x4079a3d1eULL, 0x51d6c18ceULL, 0x78bc59e02ULL },
+    { 0x98c388ee2ULL, 0x0abe1e0a3ULL, 0x47711c319ULL, 0xc50787d50ULL },
+    { 0x329efe756ULL, 0x68d9fe3dcULL, 0x6ae7f794cULL, 0x3bc7f9b16ULL },
+    { 0xeb2967d52ULL, 0x3b53a0cfeULL, 0x4abe694d7ULL, 0x7f305cadcULL },
+    { 0x76f6f693dULL, 0xe5cdf9b57ULL, 0xbc96f6f6eULL, 0xead9fb3a7ULL },
+    { 0x4b36e55eaULL, 0x7bb189e95ULL, 0x57aa76cd2ULL, 0xa97918ddeULL },
+    { 0x1264f129fULL, 0x35bc43354ULL, 0xf948f2648ULL, 0x2acc23dacULL },
+    { 0xc3d8b3d8cULL, 0x50e4d1dbeULL, 0x31bcd1bc3ULL, 0x7db8b270aULL },
+    { 0xb8fcde329ULL, 0x67cdb7329ULL, 0x94c7b3f1dULL, 0x94cedb3e6ULL },
+    { 0x3561f774cULL, 0xb9cfe3584ULL, 0x32eef86acULL, 0x21ac7f39dULL },
+    { 0x74ff1f166ULL, 0xd95ffcb09ULL, 0x668f8ff2eULL, 0x90d3ffa9bULL },
+    { 0x1d50e87b6ULL, 0xe2bcc64c5ULL, 0x6de170ab8ULL, 0xa32633d47ULL },
+    { 0x47c9d82c9ULL, 0xaca617d18ULL, 0x9341b93e2ULL, 0x18be86535ULL },
+    { 0xc683872e9ULL, 0x9ce31b831ULL, 0x974e1c163ULL, 0x8c1d8c739ULL },
+    { 0xb6f5418ceULL, 0xf93e71232ULL, 0x73182af6dULL, 0x4c48e7c9fULL },
+    { 0xd12dfa1baULL, 0x21fa85f6dULL, 0x5d85fb48bULL, 0xb6fa15f84ULL },
+    { 0x7bdea4d1eULL, 0x429df9edeULL, 0x78b257bdeULL, 0x7b79fb942ULL },
+    { 0x94d70bce8ULL, 0xd86e1d2a3ULL, 0x173d0eb29ULL, 0xc54b8761bULL },
+    { 0x8ba1ebb5aULL, 0x3bd297476ULL, 0x5add785d1ULL, 0x6e2e94bdcULL },
+    { 0x024c176f5ULL, 0x1c65423d9ULL, 0xaf6e83240ULL, 0x9bc42a638ULL },
+    { 0x36689e73bULL, 0x85dda71d9ULL, 0xdce79166cULL, 0x9b8e5bba1ULL },
+    { 0xd02168e44ULL, 0x290a468a6ULL, 0x22716840bULL, 0x651625094ULL },
+    { 0x9b8f102deULL, 0x0a3a5b778ULL, 0x7b408f1d9ULL, 0x1eeda5c50ULL },
+    { 0x7e845c27bULL, 0xae1937b51ULL, 0xde43a217eULL, 0x8adec9875ULL },
+    { 0x76df0876cULL, 0xc80effa99ULL, 0x36e10fb6eULL, 0x995ff7013ULL },
+    { 0xfbbc15957ULL, 0x5f19f0f7aULL, 0xea9a83ddfULL, 0x5ef0f98faULL },
+    { 0x4680af3b2ULL, 0x90f196855ULL, 0x4dcf50162ULL, 0xaa1698f09ULL },
+    { 0xd15e0d559ULL, 0x5c0d8dee8ULL, 0x9aab07a8bULL, 0x177b1b03aULL },
+    { 0x8c226c814ULL, 0xa3014c066ULL, 0x281364431ULL, 0x6603280c5ULL },
+    { 0x762bb49c1ULL, 0x8daba891eULL, 0x8392dd46eULL, 0x78915d5b1ULL },
+    { 0x73567a290ULL, 0x606c2ef54ULL, 0x0945e6aceULL, 0x2af743606ULL },
+    { 0x415cde0b1ULL, 0x64e504f49ULL, 0x8d07b3a82ULL, 0x92f20a726ULL },
+    { 0x0998f480bULL, 0x66911150eULL, 0xd012f1990ULL, 0x70a888966ULL },
+    { 0xe335190edULL, 0x5d2265f31ULL, 0xb7098acc7ULL, 0x8cfa644baULL },
+    { 0x3685f3f43ULL, 0xbcdab2396ULL, 0xc2fcfa16cULL, 0x69c4d5b3dULL },
+    { 0x958ce3e78ULL, 0xb8c8136efULL, 0x1e7c731a9ULL, 0xf76c8131dULL },
+    { 0x77165768fULL, 0xf4796bf90ULL, 0xf16ea68eeULL, 0x09fd69e2fULL },
+    { 0xc0d3965f4ULL, 0x48e7d89e1ULL, 0x2fa69cb03ULL, 0x8791be712ULL },
+    { 0xd49f87732ULL, 0xd0db9aae9ULL, 0x4cee1f92bULL, 0x97559db0bULL },
+    { 0x45bf30478ULL, 0xc90219fcdULL, 0x1e20cfda2ULL, 0xb3f984093ULL },
+    { 0xb2f78b979ULL, 0x5dcebd273ULL, 0x9e9d1ef4dULL, 0xce4bd73baULL },
+    { 0xb651acc17ULL, 0xc49f640f6ULL, 0xe83358a6dULL, 0x6f026f923ULL },
+    { 0x12bce159aULL, 0x71b8912dcULL, 0x59a873d48ULL, 0x3b4891d8eULL },
+    { 0x8e6d42165ULL, 0xaf46c0239ULL, 0xa6842b671ULL, 0x9c40362f5ULL },
+    { 0xf7dbda116ULL, 0xe0defcd78ULL, 0x6885bdbefULL, 0x1eb3f7b07ULL },
+    { 0x5f28027ceULL, 0x8b78c3c98ULL, 0x73e4014faULL, 0x193c31ed1ULL },
+    { 0x0212a99deULL, 0x58b0cd056ULL, 0x7b9954840ULL, 0x6a0b30d1aULL },
+    { 0xbffea812aULL, 0xc39cbd63dULL, 0x548157ffdULL, 0xbc6bd39c3ULL },
+    { 0xba315ca11ULL, 0x670b26172ULL, 0x8853a8c5dULL, 0x4e864d0e6ULL },
+    { 0x07f2e11d7ULL, 0xfdb4d8454ULL, 0xeb8874fe0ULL, 0x2a21b2dbfULL },
+    { 0xea4f2ba4dULL, 0x1e466fa3eULL, 0xb25d4f257ULL, 0x7c5f66278ULL },
+    { 0xa5be22d6cULL, 0xc940f96afULL, 0x36b447da5ULL, 0xf569f0293ULL },
+    { 0xf1a9e1b8eULL, 0x31baf3c2eULL, 0x71d87958fULL, 0x743cf5d8cULL },
+    { 0xcaa89bb77ULL, 0x1fd0d697bULL, 0xeedd91553ULL, 0xde96b0bf8ULL },
+    { 0x5486c4f52ULL, 0xa8999aac2ULL, 0x4af23612aULL, 0x435599915ULL },
+    { 0x35794c1e4ULL, 0xe92fe4409ULL, 0x278329eacULL, 0x90227f497ULL },
+    { 0x6ed848898ULL, 0xe2243585aULL, 0x191121b76ULL, 0x5a1ac2447ULL },
+    { 0xbae889676ULL, 0x1b9c760f9ULL, 0x6e691175dULL, 0x9f06e39d8ULL },
+    { 0x94c028bd0ULL, 0x882c96066ULL, 0x0bd140329ULL, 0x660693411ULL },
+    { 0x734ca2b76ULL, 0x08dce2e5fULL, 0x6ed4532ceULL, 0xfa7473b10ULL },
+    { 0x2ff13c7abULL, 0xc737b7595ULL, 0xd5e3c8ff4ULL, 0xa9aedece3ULL },
+    { 0xcc0263647ULL, 0xbe504a8a4ULL, 0xe26c64033ULL, 0x251520a7dULL },
+    { 0xde9045292ULL, 0xf23912870ULL, 0x494a2097bULL, 0x0e1489c4fULL },
+    { 0x022b6c7afULL, 0x2533cf09dULL, 0xf5e36d440ULL, 0xb90f3cca4ULL },
+    { 0x404b181edULL, 0x0c26cd909ULL, 0xb7818d202ULL, 0x909b36430ULL },
+    { 0x2c312ac65ULL, 0xcf4264087ULL, 0xa63548c34ULL, 0xe102642f3ULL },
+    { 0xbfbd0f416ULL, 0xd35b746f8ULL, 0x682f0bdfdULL, 0x1f62edacbULL },
+    { 0xe83a63cbcULL, 0x7360698efULL, 0x3d3c65c17ULL, 0xf719606ceULL },
+    { 0xe7599c232ULL, 0xc09726d79ULL, 0x4c4399ae7ULL, 0x9eb64e903ULL },
+    { 0xffe6718d6ULL, 0xbb3c78f76ULL, 0x6b18e67ffULL, 0x6ef1e3cddULL },
+    { 0xc58841ee2ULL, 0xb83012cabULL, 0x4778211a3ULL, 0xd53480c1dULL },
+    { 0xabb4d9102ULL, 0x7390b4730ULL, 0x4089b2dd5ULL, 0x0ce2d09ceULL },
+    { 0x0a177b784ULL, 0x7262ce394ULL, 0x21edee850ULL, 0x29c73464eULL },
+    { 0x4e7b739ceULL, 0xfb76c991eULL, 0x739cede72ULL, 0x789936edfULL },
+    { 0x22e3fb1a1ULL, 0x35e6bc115ULL, 0x858dfc744ULL, 0xa883d67acULL },
+    { 0x365dba3d2ULL, 0xc8fea635cULL, 0x4bc5dba6cULL, 0x3ac657f13ULL },
+    { 0x3bdcbd384ULL, 0x52adf671cULL, 0x21cbd3bdcULL, 0x38e6fb54aULL },
+    { 0xc8c7bc135ULL, 0x0687dcb65ULL, 0xac83de313ULL, 0xa6d3be160ULL },
+    { 0x5b10fac86ULL, 0x62f844d96ULL, 0x6135f08daULL, 0x69b221f46ULL },
+    { 0xd0f95c5cbULL, 0x6d3f959a8ULL, 0xd3a3a9f0bULL, 0x159a9fcb6ULL },
+    { 0x99068e4d7ULL, 0x0ef94c6e0ULL, 0xeb2716099ULL, 0x076329f70ULL },
+    { 0xc82711d02ULL, 0x131288ba2ULL, 0x40b88e413ULL, 0x45d1148c8ULL },
+    { 0xa45422499ULL, 0xc464212e4ULL, 0x992442a25ULL, 0x274842623ULL },
+    { 0xa967b9c63ULL, 0x1f962c7a7ULL, 0xc639de695ULL, 0xe5e3469f8ULL },
+    { 0xe3e33dc16ULL, 0x11177cdf6ULL, 0x683bcc7c7ULL, 0x6fb3ee888ULL },
+    { 0xf2e3fa246ULL, 0x29de7e934ULL, 0x6245fc74fULL, 0x2c97e7b94ULL },
+    { 0xabd66ec2aULL, 0x62553d6b7ULL, 0x543766bd5ULL, 0xed6bcaa46ULL },
+    { 0x96a6acaecULL, 0x89a95f237ULL, 0x375356569ULL, 0xec4fa9591ULL },
+    { 0x115eda25fULL, 0x6cdc4f748ULL, 0xfa45b7a88ULL, 0x12ef23b36ULL },
+    { 0xe048d94f9ULL, 0x3ca4259e9ULL, 0x9f29b1207ULL, 0x979a4253cULL },
+    { 0x3ea2a245dULL, 0x8fc8790d4ULL, 0xba245457cULL, 0x2b09e13f1ULL },
+    { 0x937a719daULL, 0x793c8957eULL, 0x5b98e5ec9ULL, 0x7ea913c9eULL },
+    { 0x6d6535204ULL, 0x930762f04ULL, 0x204aca6b6ULL, 0x20f46e0c9ULL },
+    { 0xda06974abULL, 0x16f909bb1ULL, 0xd52e9605bULL, 0x8dd909f68ULL },
+    { 0x14b02520aULL, 0xd11913004ULL, 0x504a40d28ULL, 0x200c8988bULL },
+    { 0x7a96876d5ULL, 0x5ee97aad0ULL, 0xab6e1695eULL, 0x0b55e977aULL },
+    { 0xdd7812645ULL, 0xcf4c42da8ULL, 0xa26481ebbULL, 0x15b4232f3ULL },
+    { 0x82c37aa29ULL, 0x24461f137ULL, 0x9455ec341ULL, 0xec8f86224ULL },
+    { 0x9719fa0f4ULL, 0xe8ea4457dULL, 0x2f05f98e9ULL, 0xbea225717ULL },
+    { 0x3a6cc1b57ULL, 0x3f9ce225aULL, 0xead83365cULL, 0x5a44739fcULL },
+    { 0x6121b149dULL, 0x15a261dc4ULL, 0xb928d8486ULL, 0x23b8645a8ULL },
+    { 0xd07b061deULL, 0x497fc9868ULL, 0x7b860de0bULL, 0x16193fe92ULL },
+    { 0x45bef7269ULL, 0xfdc11bf0dULL, 0x964ef7da2ULL, 0xb0fd883bfULL },
+    { 0x9d4694424ULL, 0x828d487a1ULL, 0x2422962b9ULL, 0x85e12b141ULL },
+    { 0x4dfbbaf14ULL, 0xc3c6dedceULL, 0x28f5ddfb2ULL, 0x73b7b63c3ULL },
+    { 0xc8ec63a31ULL, 0x374412a6fULL, 0x8c5c63713ULL, 0xf654822ecULL },
+    { 0x292631609ULL, 0x17002b784ULL, 0x9068c6494ULL, 0x21ed400e8ULL },
+    { 0x22eab550aULL, 0x1195b919cULL, 0x50aad5744ULL, 0x3989da988ULL },
+    { 0x0c533e7c9ULL, 0xce678f184ULL, 0x93e7cca30ULL, 0x218f1e673ULL },
+    { 0xf1d17a419ULL, 0x644e35de4ULL, 0x9825e8b8fULL, 0x27bac7226ULL },
+    { 0xbe292d15cULL, 0x9b0be507cULL, 0x3a8b4947dULL, 0x3e0a7d0d9ULL },
+    { 0xadece605fULL, 0xafd57166cULL, 0xfa06737b5ULL, 0x3668eabf5ULL },
+    { 0x17c6939d3ULL, 0x9cfc98752ULL, 0xcb9c963e8ULL, 0x4ae193f39ULL },
+    { 0x4cc3d4589ULL, 0xa6a799980ULL, 0x91a2bc332ULL, 0x01999e565ULL },
+    { 0x9ad666214ULL, 0x624d5a274ULL, 0x284666b59ULL, 0x2e45ab246ULL },
+    { 0x138541d73ULL, 0x3c1a906d3ULL, 0xceb82a1c8ULL, 0xcb609583cULL },
+    { 0x560f97f45ULL, 0x9ccbcab9aULL, 0xa2fe9f06aULL, 0x59d53d339ULL },
+    { 0xa6c0a5f60ULL, 0x9885b20b7ULL, 0x06fa50365ULL, 0xed04da119ULL },
+    { 0x5fe2e5598ULL, 0xb3ad99cd4ULL, 0x19aa747faULL, 0x2b399b5cdULL },
+    { 0x43be88765ULL, 0x4d80dee99ULL, 0xa6e117dc2ULL, 0x9977b01b2ULL },
+    { 0x089081cd4ULL, 0x5aa0500c2ULL, 0x2b3810910ULL, 0x4300a055aULL },
+    { 0x4dea17effULL, 0x9f755bdcbULL, 0xff7e857b2ULL, 0xd3bdaaef9ULL },
+    { 0x7c3aad120ULL, 0xd389ac80dULL, 0x048b55c3eULL, 0xb013591cbULL },
+    { 0x4356a2ae9ULL, 0x4ce40be17ULL, 0x975456ac2ULL, 0xe87d02732ULL },
+    { 0xecb7004b5ULL, 0xc72278ae1ULL, 0xad200ed37ULL, 0x8751e44e3ULL },
+    { 0xf761b2b27ULL, 0x85dee2d37ULL, 0xe4d4d86efULL, 0xecb477ba1ULL },
+    { 0x8924637cdULL, 0x3f60c36a4ULL, 0xb3ec62491ULL, 0x256c306fcULL },
+    { 0x723a62b31ULL, 0x6548aa85fULL, 0x8cd465c4eULL, 0xfa15512a6ULL },
+    { 0x29b47d451ULL, 0x7f01347c4ULL, 0x8a2be2d94ULL, 0x23e2c80feULL },
+    { 0x126bef95aULL, 0x39df8d05eULL, 0x5a9f7d648ULL, 0x7a0b1fb9cULL },
+    { 0xa15e6079aULL, 0x6034ab6ecULL, 0x59e067a85ULL, 0x376d52c06ULL },
+    { 0x7e4cac3adULL, 0x86ade7a1dULL, 0xb5c35327eULL, 0xb85e7b561ULL },
+    { 0x728e15323ULL, 0x1419bab19ULL, 0xc4ca8714eULL, 0x98d5d9828ULL },
+    { 0x3205e4970ULL, 0x288ba0257ULL, 0x0e927a04cULL, 0xea405d114ULL },
+    { 0x1463578efULL, 0xbd7f49103ULL, 0xf71eac628ULL, 0xc0892febdULL },
+    { 0x4672ac908ULL, 0xc1858d816ULL, 0x109354e62ULL, 0x681b1a183ULL },
+    { 0xda58dec08ULL, 0x62cd059baULL, 0x1037b1a5bULL, 0x5d9a0b346ULL },
+    { 0xc91fe4364ULL, 0x6a83cae2dULL, 0x26c27f893ULL, 0xb4753c156ULL },
+    { 0xa1c5fe9acULL, 0x20e7f5727ULL, 0x3597fa385ULL, 0xe4eafe704ULL },
+    { 0xf746d2477ULL, 0xacdc68ff1ULL, 0xee24b62efULL, 0x8ff163b35ULL },
+    { 0x3849f8cd2ULL, 0x2abe241ceULL, 0x4b31f921cULL, 0x738247d54ULL },
+    { 0xba72240a6ULL, 0x433d68035ULL, 0x650244e5dULL, 0xac016bcc2ULL },
+    { 0x64a2637f3ULL, 0xbd70ba8c5ULL, 0xcfec64526ULL, 0xa315d0ebdULL },
+    { 0x8450dd2b3ULL, 0xf4b506161ULL, 0xcd4bb0a21ULL, 0x86860ad2fULL },
+    { 0xe986a3126ULL, 0x12d0f8e25ULL, 0x648c56197ULL, 0xa471f0b48ULL },
+    { 0x1f6a0a9bdULL, 0x876ccd45bULL, 0xbd95056f8ULL, 0xda2b336e1ULL },
+    { 0xc18313c19ULL, 0x144219de2ULL, 0x983c8c183ULL, 0x47b984228ULL },
+    { 0x44f4663bbULL, 0xe57593a45ULL, 0xddc662f22ULL, 0xa25c9aea7ULL },
+    { 0x019dd8c6aULL, 0x68921578bULL, 0x5631bb980ULL, 0xd1ea84916ULL },
+    { 0xcf6afc048ULL, 0xab850dd3cULL, 0x1203f56f3ULL, 0x3cbb0a1d5ULL },
+    { 0x92aec3056ULL, 0x39d858278ULL, 0x6a0c37549ULL, 0x1e41a1b9cULL },
+    { 0x25155d9a5ULL, 0xf423e4703ULL, 0xa59baa8a4ULL, 0xc0e27c42fULL },
+    { 0x160a5c456ULL, 0xa8194c1d8ULL, 0x6a23a5068ULL, 0x1b8329815ULL },
+    { 0x2ac3906b5ULL, 0x06a67a1d1ULL, 0xad609c354ULL, 0x8b85e6560ULL },
+    { 0x2e7ab6f6fULL, 0xcfd5eb19fULL, 0xf6f6d5e74ULL, 0xf98d7abf3ULL },
+    { 0x9efa93d6cULL, 0xdbccd91bbULL, 0x36bc95f79ULL, 0xdd89b33dbULL },
+    { 0x463493242ULL, 0xd9d002b10ULL, 0x424c92c62ULL, 0x08d400b9bULL },
+    { 0x0afd5496cULL, 0x6b07d131bULL, 0x3692abf50ULL, 0xd8c8be0d6ULL },
+    { 0xb0623d250ULL, 0x190d2e164ULL, 0x0a4bc460dULL, 0x26874b098ULL },
+    { 0x91d2c22d8ULL, 0x68ec1b460ULL, 0x1b4434b89ULL, 0x062d83716ULL },
+    { 0xb40c8cd72ULL, 0x8899a42ebULL, 0x4eb31302dULL, 0xd74259911ULL },
+    { 0x9f8915c59ULL, 0x9e0b115faULL, 0x9a3a891f9ULL, 0x5fa88d079ULL },
+    { 0xe7ab1f5c9ULL, 0x9d63bddb8ULL, 0x93af8d5e7ULL, 0x1dbbdc6b9ULL },
+    { 0x405fd06f7ULL, 0x6cb64abc9ULL, 0xef60bfa02ULL, 0x93d526d36ULL },
+    { 0x6b1ec5e06ULL, 0x72916ae9aULL, 0x607a378d6ULL, 0x59756894eULL },
+    { 0xac1be5a5aULL, 0xfa932b06eULL, 0x5a5a7d835ULL, 0x760d4c95fULL },
+    { 0xe62f036caULL, 0x99722bab8ULL, 0x536c0f467ULL, 0x1d5d44e99ULL },
+    { 0x7fe566f88ULL, 0xa36fb3e96ULL, 0x11f66a7feULL, 0x697cdf6c5ULL },
+    { 0xa3c23e32eULL, 0x0055ff535ULL, 0x74c7c43c5ULL, 0xacaffaa00ULL },
+    { 0x943e75766ULL, 0xf919ca3adULL, 0x66eae7c29ULL, 0xb5c53989fULL },
+    { 0x34ba1e5afULL, 0xc579fd189ULL, 0xf5a785d2cULL, 0x918bf9ea3ULL },
+    { 0x03a5129cbULL, 0x0d7291712ULL, 0xd3948a5c0ULL, 0x48e894eb0ULL },
+    { 0x255290837ULL, 0xc49468543ULL, 0xec1094aa4ULL, 0xc2a162923ULL },
+    { 0x98386b53fULL, 0x7758c50edULL, 0xfcad61c19ULL, 0xb70a31aeeULL },
+    { 0x5108e5392ULL, 0x30b982c4cULL, 0x49ca7108aULL, 0x323419d0cULL },
+    { 0x6d2fec2eeULL, 0xabb36fe0dULL, 0x77437f4b6ULL, 0xb07f6cdd5ULL },
+    { 0x52bc10caaULL, 0x413811b9bULL, 0x553083d4aULL, 0xd9d881c82ULL },
+    { 0xb3283643aULL, 0x0159215fdULL, 0x5c26c14cdULL, 0xbfa849a80ULL },
+    { 0x773532d76ULL, 0xc95ae0fd7ULL, 0x6eb4caceeULL, 0xebf075a93ULL },
+    { 0x3c6b7b517ULL, 0xb75eec1ccULL, 0xe8aded63cULL, 0x338377aedULL },
+    { 0x3ad2554c8ULL, 0x7a2d39190ULL, 0x132aa4b5cULL, 0x0989cb45eULL },
+    { 0x7985c06eaULL, 0x2aba33e81ULL, 0x57603a19eULL, 0x817cc5d54ULL },
+    { 0xc5bb9ac77ULL, 0xcdd25cdebULL, 0xee359dda3ULL, 0xd7b3a4bb3ULL },
+    { 0x0cc57af0bULL, 0xa65697386ULL, 0xd0f5ea330ULL, 0x61ce96a65ULL },
+    { 0xf8d0f0d62ULL, 0x6a9cb09a7ULL, 0x46b0f0b1fULL, 0xe590d3956ULL },
+    { 0x813fd3e2bULL, 0x75d20b7abULL, 0xd47cbfc81ULL, 0xd5ed04baeULL },
+    { 0x0decd8b7cULL, 0xab84d774bULL, 0x3ed1b37b0ULL, 0xd2eeb21d5ULL },
+    { 0x1b4ae3132ULL, 0x32dc8845dULL, 0x4c8c752d8ULL, 0xba2113b4cULL },
+    { 0xd22040435ULL, 0x2508408f1ULL, 0xac202044bULL, 0x8f10210a4ULL },
+    { 0x14868fe04ULL, 0x90c95e282ULL, 0x207f16128ULL, 0x4147a9309ULL },
+    { 0x819c3afcaULL, 0x4870977aeULL, 0x53f5c3981ULL, 0x75ee90e12ULL },
+    { 0x45cc5870eULL, 0xa014d7f88ULL, 0x70e1a33a2ULL, 0x11feb2805ULL },
+    { 0x55d12c1b7ULL, 0xc43fd4c45ULL, 0xed8348baaULL, 0xa232bfc23ULL },
+    { 0x7c529f19eULL, 0xd2fded940ULL, 0x798f94a3eULL, 0x029b7bf4bULL },
+    { 0x709136911ULL, 0x444bb0946ULL, 0x8896c890eULL, 0x6290dd222ULL },
+    { 0xfc5a4284aULL, 0xea5c2982aULL, 0x521425a3fULL, 0x541943a57ULL },
+    { 0x579794c13ULL, 0xc49b18fd2ULL, 0xc8329e9eaULL, 0x4bf18d923ULL },
+    { 0xa5d1c4f82ULL, 0xe0b7b24a2ULL, 0x41f238ba5ULL, 0x4524ded07ULL },
+    { 0x813cbc908ULL, 0x41818572eULL, 0x1093d3c81ULL, 0x74ea18182ULL },
+    { 0x097146d53ULL, 0x6f57804c2ULL, 0xcab628e90ULL, 0x43201eaf6ULL },
+    { 0x6acfd2d85ULL, 0x26e6f8b9aULL, 0xa1b4bf356ULL, 0x59d1f6764ULL },
+    { 0x73f477749ULL, 0x7d4db3f94ULL, 0x92eee2fceULL, 0x29fcdb2beULL },
+    { 0xf59dacb9aULL, 0xc0bbb7e6eULL, 0x59d35b9afULL, 0x767eddd03ULL },
+    { 0xcaf976e84ULL, 0x6367529beULL, 0x2176e9f53ULL, 0x7d94ae6c6ULL },
+    { 0x91dfd593eULL, 0x709fd976bULL, 0x7c9abfb89ULL, 0xd6e9bf90eULL },
+    { 0x97e08b60dULL, 0x95cc574b0ULL, 0xb06d107e9ULL, 0x0d2ea33a9ULL },
+    { 0xab18c3297ULL, 0x76f062478ULL, 0xe94c318d5ULL, 0x1e2460f6eULL },
+    { 0x0c75e9cf4ULL, 0xfba6442c7ULL, 0x2f397ae30ULL, 0xe342265dfULL },
+    { 0x12585a7ebULL, 0x6c7c87199ULL, 0xd7e5a1a48ULL, 0x998e13e36ULL },
+    { 0xe23d52319ULL, 0x6542a3b78ULL, 0x98c4abc47ULL, 0x1edc542a6ULL },
+    { 0x943ece2eaULL, 0xe9f90f229ULL, 0x574737c29ULL, 0x944f09f97ULL },
+    { 0x4d802afebULL, 0x8e7097c87ULL, 0xd7f5401b2ULL, 0xe13e90e71ULL },
+    { 0x63de1d4a1ULL, 0x54253cf99ULL, 0x852b87bc6ULL, 0x99f3ca42aULL },
+    { 0xea95f0188ULL, 0x62a2b1b34ULL, 0x1180fa957ULL, 0x2cd8d4546ULL },
+    { 0x14cc6380aULL, 0xb05c1120eULL, 0x501c63328ULL, 0x704883a0dULL },
+    { 0xc8b0314bfULL, 0x5730519e5ULL, 0xfd28c0d13ULL, 0xa798a0ceaULL },
+    { 0x9e05526efULL, 0xae7a433b1ULL, 0xf764aa079ULL, 0x8dcc25e75ULL },
+    { 0x5a31f6513ULL, 0x67db809d4ULL, 0xc8a6f8c5aULL, 0x2b901dbe6ULL },
+    { 0x02408dae9ULL, 0x1ca507013ULL, 0x975b10240ULL, 0xc80e0a538ULL },
+    { 0x0327ccbd6ULL, 0x29b3ce652ULL, 0x6bd33e4c0ULL, 0x4a673cd94ULL },
+    { 0x39c7c8885ULL, 0x26ae7c602ULL, 0xa1113e39cULL, 0x4063e7564ULL },
+    { 0x1df15f3d5ULL, 0xff6fd6540ULL, 0xabcfa8fb8ULL, 0x02a6bf6ffULL },
+    { 0x35f857928ULL, 0xf14db150bULL, 0x149ea1facULL, 0xd0a8db28fULL },
+    { 0xf6aac226fULL, 0xadd87b839ULL, 0xf6443556fULL, 0x9c1de1bb5ULL },
+    { 0xe7e05b9a9ULL, 0xb564b5d33ULL, 0x959da07e7ULL, 0xccbad26adULL },
+    { 0x2354584e2ULL, 0x683424791ULL, 0x4721a2ac4ULL, 0x89e242c16ULL },
+    { 0xa8f07bd0cULL, 0x7344f51a6ULL, 0x30bde0f15ULL, 0x658af22ceULL },
+    { 0x1f7bf23e3ULL, 0xeffe8a51dULL, 0xc7c4fdef8ULL, 0xb8a517ff7ULL },
+    { 0xa622d7fedULL, 0xbde1eb1b3ULL, 0xb7feb4465ULL, 0xcd8d787bdULL },
+    { 0x3ce0ae66aULL, 0x8bdd37085ULL, 0x56675073cULL, 0xa10ecbbd1ULL },
+    { 0x9deafcf69ULL, 0xaf8d9f5afULL, 0x96f3f57b9ULL, 0xf5af9b1f5ULL },
+    { 0x761c0f6e1ULL, 0xdc6926a99ULL, 0x876f0386eULL, 0x99564963bULL },
+    { 0x17e50fc9cULL, 0x916f556d2ULL, 0x393f0a7e8ULL, 0x4b6aaf689ULL },
+    { 0x6bd702d4cULL, 0x4a46f9e92ULL, 0x32b40ebd6ULL, 0x4979f6252ULL },
+    { 0x562c88508ULL, 0x818885a98ULL, 0x10a11346aULL, 0x195a11181ULL },
+    { 0x7512f81dfULL, 0xecb8edd44ULL, 0xfb81f48aeULL, 0x22bb71d37ULL },
+    { 0x7ee149150ULL, 0xbb0eb4850ULL, 0x0a892877eULL, 0x0a12d70ddULL },
+    { 0x1076c6f61ULL, 0x6dcd8a283ULL, 0x86f636e08ULL, 0xc1451b3b6ULL },
+    { 0xd4eb23df2ULL, 0x997e988efULL, 0x4fbc4d72bULL, 0xf71197e99ULL },
+    { 0x28cfab86aULL, 0x1ad63d20fULL, 0x561d5f314ULL, 0xf04bc6b58ULL },
+    { 0xac1471853ULL, 0xfe1020366ULL, 0xca18e2835ULL, 0x66c04087fULL },
+    { 0xaf98af67eULL, 0xdad1774fdULL, 0x7e6f519f5ULL, 0xbf2ee8b5bULL },
+    { 0xc19e729d1ULL, 0x6c6098f6eULL, 0x8b94e7983ULL, 0x76f190636ULL },
+    { 0xcf5fb5986ULL, 0xd2b7c8f3eULL, 0x619adfaf3ULL, 0x7cf13ed4bULL },
+    { 0xd5ddbb932ULL, 0xd0de94f6fULL, 0x4c9ddbbabULL, 0xf6f297b0bULL },
+    { 0x4f86256d3ULL, 0x9e311aed4ULL, 0xcb6a461f2ULL, 0x2b7588c79ULL },
+    { 0x6a24476f0ULL, 0x3b6122ad1ULL, 0x0f6e22456ULL, 0x8b54486dcULL },
+    { 0x802d931a1ULL, 0x15e280329ULL, 0x858c9b401ULL, 0x94c0147a8ULL },
+    { 0x1dcd83b49ULL, 0x9ece9360aULL, 0x92dc1b3b8ULL, 0x506c97379ULL },
+    { 0xda86c1e5cULL, 0x3a885baf2ULL, 0x3a783615bULL, 0x4f5da115cULL },
+    { 0xe6f66d2e3ULL, 0xfd353ea35ULL, 0xc74b66f67ULL, 0xac57cacbfULL },
+    { 0x3d8910957ULL, 0x8e1af054aULL, 0xea90891bcULL, 0x52a0f5871ULL },
+    { 0xd2794158cULL, 0x712ec18b8ULL, 0x31a829e4bULL, 0x1d183748eULL },
+    { 0xa0af1cbdeULL, 0x0933ff36aULL, 0x7bd38f505ULL, 0x56cffcc90ULL },
+    { 0x01576e22dULL, 0x64474f605ULL, 0xb4476ea80ULL, 0xa06f2e226ULL },
+    { 0x57f8ecf58ULL, 0xe98d97cdeULL, 0x1af371feaULL, 0x7b3e9b197ULL },
+    { 0x6aff29121ULL, 0x5706bca1dULL, 0x84894ff56ULL, 0xb853d60eaULL },
+    { 0xfb21aeca0ULL, 0x03eb24cb7ULL, 0x0537584dfULL, 0xed324d7c0ULL },
+    { 0x0b8bbd72bULL, 0x16939f59dULL, 0xd4ebdd1d0ULL, 0xb9af9c968ULL },
+    { 0xd49833c2dULL, 0xd448519afULL, 0xb43cc192bULL, 0xf598a122bULL },
+    { 0xe14b00e6eULL, 0x08166bcabULL, 0x76700d287ULL, 0xd53d66810ULL },
+    { 0x1a5f9b555ULL, 0x5ececc3d8ULL, 0xaaad9fa58ULL, 0x1bc33737aULL },
+    { 0xf08e88a5fULL, 0x0c987fa6aULL, 0xfa511710fULL, 0x565fe1930ULL },
+    { 0xa79962a76ULL, 0xe8527247fULL, 0x6e54699e5ULL, 0xfe24e4a17ULL },
+    { 0x7589cceb6ULL, 0xa0bb76ccbULL, 0x6d73391aeULL, 0xd336edd05ULL },
+    { 0x92df8f43cULL, 0x50cf5d2f9ULL, 0x3c2f1fb49ULL, 0x9f4baf30aULL },
+    { 0xae569bdf2ULL, 0xdaf4ac3f3ULL, 0x4fbd96a75ULL, 0xcfc352f5bULL },
+    { 0xd20c674a4ULL, 0x306940abdULL, 0x252e6304bULL, 0xbd502960cULL },
+    { 0x2846414e7ULL, 0x3e3468281ULL, 0xe72826214ULL, 0x814162c7cULL },
+    { 0x6cc9367f1ULL, 0x8e67b29cdULL, 0x8fe6c9336ULL, 0xb394de671ULL },
+    { 0xc2ee9c64cULL, 0x09855fbb8ULL, 0x326397743ULL, 0x1ddfaa190ULL },
+    { 0x24a3dc070ULL, 0xa9833c141ULL, 0x0e03bc524ULL, 0x8283cc195ULL },
+    { 0x29a935b7bULL, 0x1f13b354fULL, 0xdedac9594ULL, 0xf2acdc8f8ULL },
+    { 0x69098ff20ULL, 0x12c3a6c8bULL, 0x04ff19096ULL, 0xd1365c348ULL },
+    { 0xddb32d902ULL, 0xd31b9cc26ULL, 0x409b4cdbbULL, 0x64339d8cbULL },
+    { 0x111849a8dULL, 0x74284740aULL, 0xb15921888ULL, 0x502e2142eULL },
+    { 0xb6b3d9a45ULL, 0xfd8a7e132ULL, 0xa259bcd6dULL, 0x4c87e51bfULL },
+    { 0xa0cfe63c2ULL, 0x28f7ba22cULL, 0x43c67f305ULL, 0x3445def14ULL },
+    { 0x373ba63b8ULL, 0xc1ebab45dULL, 0x1dc65dcecULL, 0xba2d5d783ULL },
+    { 0xa1f2d0ce8ULL, 0x69a4395a3ULL, 0x1730b4f85ULL, 0xc5a9c2596ULL },
+    { 0x568f1251fULL, 0x845ad9bd8ULL, 0xf8a48f16aULL, 0x1bd9b5a21ULL },
+    { 0xc2e70c5eaULL, 0x09379dab1ULL, 0x57a30e743ULL, 0x8d5b9ec90ULL },
+    { 0x9c19bf5a0ULL, 0xd2eb841adULL, 0x05afd9839ULL, 0xb5821d74bULL },
+    { 0x75cfab416ULL, 0x90de7ceccULL, 0x682d5f3aeULL, 0x3373e7b09ULL },
+    { 0x7ecc296d0ULL, 0x9a2c36adcULL, 0x0b694337eULL, 0x3b56c3459ULL },
+    { 0xf35be31aeULL, 0x70fee9c3dULL, 0x758c7dacfULL, 0xbc3977f0eULL },
+    { 0xbe7585f18ULL, 0xd38fa32f2ULL, 0x18fa1ae7dULL, 0x4f4c5f1cbULL },
+    { 0x219ad95daULL, 0x78b0bd5c8ULL, 0x5ba9b5984ULL, 0x13abd0d1eULL },
+    { 0xbba2b874cULL, 0x0b88ff5b4ULL, 0x32e1d45ddULL, 0x2daff11d0ULL },
+    { 0x18aa0f4e6ULL, 0x1b795c089ULL, 0x672f05518ULL, 0x9103a9ed8ULL },
+    { 0x8da3ff41cULL, 0xb3c35d5e4ULL, 0x382ffc5b1ULL, 0x27abac3cdULL },
+    { 0xccf10d0f1ULL, 0xdf2714861ULL, 0x8f0b08f33ULL, 0x86128e4fbULL },
+    { 0x0ff9b252dULL, 0xc7c6d159dULL, 0xb4a4d9ff0ULL, 0xb9a8b63e3ULL },
+    { 0x019f05dcaULL, 0x58339968aULL, 0x53ba0f980ULL, 0x51699cc1aULL },
+    { 0xdf8ae0354ULL, 0xaa88dac7cULL, 0x2ac0751fbULL, 0x3e35b1155ULL },
+    { 0xce7ba00d5ULL, 0xcfa64887cULL, 0xab005de73ULL, 0x3e11265f3ULL },
+    { 0xd97ded586ULL, 0x73bfc4eacULL, 0x61ab7be9bULL, 0x35723fdceULL },
+    { 0xb5931e0c6ULL, 0xc87b7c520ULL, 0x63078c9adULL, 0x04a3ede13ULL },
+    { 0x128b9a6e4ULL, 0x08ea5e199ULL, 0x27659d148ULL, 0x9987a5710ULL },
+    { 0xf2163ca63ULL, 0x4c192eb37ULL, 0xc653c684fULL, 0xecd749832ULL },
+    { 0xe80a07737ULL, 0x1651ea8e9ULL, 0xecee05017ULL, 0x971578a68ULL },
+    { 0x7a731ec24ULL, 0x434f6c993ULL, 0x24378ce5eULL, 0xc9936f2c2ULL },
+    { 0x35da7ef0bULL, 0xe45dbf58eULL, 0xd0f7e5bacULL, 0x71afdba27ULL },
+    { 0x9982fd2d1ULL, 0x3ea91e564ULL, 0x8b4bf4199ULL, 0x26a78957cULL },
+    { 0xdfa9255edULL, 0x9f2bd1cbdULL, 0xb7aa495fbULL, 0xbd38bd4f9ULL },
+    { 0xa51ed6bcfULL, 0xecf1eb72aULL, 0xf3d6b78a5ULL, 0x54ed78f37ULL },
+    { 0x2408d5d19ULL, 0xb481a11caULL, 0x98bab1024ULL, 0x53885812dULL },
+    { 0xb5f8e92d6ULL, 0xf9bc7646cULL, 0x6b4971fadULL, 0x3626e3d9fULL },
+    { 0x9136bc4e0ULL, 0x49a90c7a5ULL, 0x0723d6c89ULL, 0xa5e309592ULL },
+    { 0xae58e0e85ULL, 0xe6a4620beULL, 0xa17071a75ULL, 0x7d0462567ULL },
+    { 0x2f80c5aabULL, 0xb6b133413ULL, 0xd55a301f4ULL, 0xc82cc8d6dULL },
+    { 0xda497b119ULL, 0x364e8597cULL, 0x988de925bULL, 0x3e9a1726cULL },
+    { 0xa2f6e453eULL, 0x6195f92f5ULL, 0x7ca276f45ULL, 0xaf49fa986ULL },
+    { 0x21276d84cULL, 0x39036d606ULL, 0x321b6e484ULL, 0x606b6c09cULL },
+    { 0x6b792868cULL, 0x432667c9cULL, 0x316149ed6ULL, 0x393e664c2ULL },
+    { 0x9dda5db1dULL, 0xf60ddf56aULL, 0xb8dba5bb9ULL, 0x56afbb06fULL },
+    { 0x2fcfb2b55ULL, 0x8ec6fa75eULL, 0xaad4df3f4ULL, 0x7ae5f6371ULL },
+    { 0xaf20471e8ULL, 0xbb61a1431ULL, 0x178e204f5ULL, 0x8c28586ddULL },
+    { 0xeac74b3a9ULL, 0x3666bfa31ULL, 0x95cd2e357ULL, 0x8c5fd666cULL },
+    { 0xcce51dfceULL, 0x9b37d7ba2ULL, 0x73fb8a733ULL, 0x45debecd9ULL },
+    { 0x613085321ULL, 0x5581a2c01ULL, 0x84ca10c86ULL, 0x8034581aaULL },
+    { 0xb49219291ULL, 0xd4283e160ULL, 0x89498492dULL, 0x0687c142bULL },
+    { 0xc1cfbd9daULL, 0x18b79df6eULL, 0x5b9bdf383ULL, 0x76fb9ed18ULL },
+    { 0x08dd1a366ULL, 0x4a56d6309ULL, 0x66c58bb10ULL, 0x90c6b6a52ULL },
+    { 0x78435ca8fULL, 0x263f6f902ULL, 0xf153ac21eULL, 0x409f6fc64ULL },
+    { 0x20dcba53eULL, 0x40d4f53cdULL, 0x7ca5d3b04ULL, 0xb3caf2b02ULL },
+    { 0xe384a5ec6ULL, 0x18b172eb6ULL, 0x637a521c7ULL, 0x6d74e8d18ULL },
+    { 0x8391ab7adULL, 0x54e2d74b5ULL, 0xb5ed589c1ULL, 0xad2eb472aULL },
+    { 0x72263c50bULL, 0x0519adb94ULL, 0xd0a3c644eULL, 0x29db598a0ULL },
+    { 0xf2ae0babcULL, 0x11687fa7bULL, 0x3d5d0754fULL, 0xde5fe1688ULL },
+    { 0x2e8809d63ULL, 0x9e10b409bULL, 0xc6b901174ULL, 0xd902d0879ULL },
+    { 0xb7cbf697cULL, 0xa8cff957fULL, 0x3e96fd3edULL, 0xfea9ff315ULL },
+    { 0x31fbf439eULL, 0x61bffb54cULL, 0x79c2fdf8cULL, 0x32adffd86ULL },
+    { 0x8ec7529a6ULL, 0xa276d8333ULL, 0x6594ae371ULL, 0xccc1b6e45ULL },
+    { 0x5eebf20acULL, 0xa3ee5991dULL, 0x3504fd77aULL, 0xb899a77c5ULL },
+    { 0xe33b81d4cULL, 0x5982e9cbaULL, 0x32b81dcc7ULL, 0x5d397419aULL },
+    { 0xac7cf2deaULL, 0xebf4a13afULL, 0x57b4f3e35ULL, 0xf5c852fd7ULL },
+    { 0x4e0101932ULL, 0x921280853ULL, 0x4c9808072ULL, 0xca1014849ULL },
+    { 0xc99083605ULL, 0x56c052ca0ULL, 0xa06c10993ULL, 0x0534a036aULL },
+    { 0xf56669a0dULL, 0xb50c6fe26ULL, 0xb059666afULL, 0x647f630adULL },
+    { 0x2c0396d4eULL, 0x8ad3e9182ULL, 0x72b69c034ULL, 0x41897cb51ULL },
+    { 0x76c175cc7ULL, 0xbc3f70996ULL, 0xe33ae836eULL, 0x6990efc3dULL },
+    { 0xb0fb536b5ULL, 0x756e7a1e9ULL, 0xad6cadf0dULL, 0x9785e76aeULL },
+    { 0x8735cea98ULL, 0xe1e307672ULL, 0x19573ace1ULL, 0x4e6e0c787ULL },
+    { 0xe78bf46abULL, 0xa4b33bdbdULL, 0xd562fd1e7ULL, 0xbdbdccd25ULL },
+    { 0xb9b201e21ULL, 0x57083a4a3ULL, 0x847804d9dULL, 0xc525c10eaULL },
+    { 0x2ce6f4c79ULL, 0xaf85393c7ULL, 0x9e32f6734ULL, 0xe3c9ca1f5ULL },
+    { 0xf01a3aac4ULL, 0x48686e92eULL, 0x2355c580fULL, 0x749761612ULL },
+    { 0x6b1dee8f4ULL, 0x6ae364e5fULL, 0x2f177b8d6ULL, 0xfa726c756ULL },
+    { 0x0a635916bULL, 0x3f168d111ULL, 0xd689ac650ULL, 0x888b168fcULL },
+    { 0x3d50ed8e0ULL, 0xfaad24407ULL, 0x071b70abcULL, 0xe0224b55fULL },
+    { 0x0cea892a4ULL, 0x93a45e009ULL, 0x254915730ULL, 0x9007a25c9ULL },
+    { 0x929f2c9a3ULL, 0x443b9c23fULL, 0xc5934f949ULL, 0xfc439dc22ULL },
+    { 0x90b9ab2c8ULL, 0x59ea1702cULL, 0x134d59d09ULL, 0x340e8579aULL },
+    { 0x60df8ce34ULL, 0x40877eacbULL, 0x2c731fb06ULL, 0xd357ee102ULL },
+    { 0xd3a36309bULL, 0x357a19c74ULL, 0xd90c6c5cbULL, 0x2e3985eacULL },
+    { 0x253d9fc33ULL, 0xd5d3247cbULL, 0xcc3f9bca4ULL, 0xd3e24cbabULL },
+    { 0x30191e0fdULL, 0x4c6b65149ULL, 0xbf078980cULL, 0x928a6d632ULL },
+    { 0x5a971c101ULL, 0x460b9cb10ULL, 0x80838e95aULL, 0x08d39d062ULL },
+    { 0x2a0f6b33aULL, 0x3252af25dULL, 0x5ccd6f054ULL, 0xba4f54a4cULL },
+    { 0x6a75d1ec0ULL, 0x7ba622b92ULL, 0x0378bae56ULL, 0x49d4465deULL },
+    { 0x1e9dbb8b1ULL, 0xd6ea1435fULL, 0x8d1ddb978ULL, 0xfac28576bULL },
+    { 0x2f3ae1dc9ULL, 0xffa0a949eULL, 0x93b875cf4ULL, 0x7929505ffULL },
+    { 0x63d097347ULL, 0x5cd5f2d10ULL, 0xe2ce90bc6ULL, 0x08b4fab3aULL },
+    { 0xd89d89437ULL, 0x569a54ae9ULL, 0xec291b91bULL, 0x9752a596aULL },
+    { 0x83bd8850bULL, 0x4592956b8ULL, 0xd0a11bdc1ULL, 0x1d6a949a2ULL },
+    { 0x224e7d8aeULL, 0x30356d31fULL, 0x751be7244ULL, 0xf8cb6ac0cULL },
+    { 0x794b3f9eaULL, 0x1a7fadd0fULL, 0x579fcd29eULL, 0xf0bb5fe58ULL },
+    { 0x8d33a76efULL, 0xdff34b4a5ULL, 0xf76e5ccb1ULL, 0xa52d2cffbULL },
+    { 0x2185bccd7ULL, 0x0cb3747c6ULL, 0xeb33da184ULL, 0x63e2ecd30ULL },
+    { 0xf0dae3503ULL, 0x74dcb88acULL, 0xc0ac75b0fULL, 0x3511d3b2eULL },
+    { 0xccdf2a2a8ULL, 0xc2661fa2dULL, 0x15454fb33ULL, 0xb45f86643ULL },
+    { 0x3882549d1ULL, 0x2e29b8142ULL, 0x8b92a411cULL, 0x4281d9474ULL },
+    { 0x6e2d2c5beULL, 0x8333e5addULL, 0x7da34b476ULL, 0xbb5a7ccc1ULL },
+    { 0x7a2bc82f2ULL, 0x2bba2e859ULL, 0x4f413d45eULL, 0x9a1745dd4ULL },
+    { 0x57db83708ULL, 0xd0ce9bc98ULL, 0x10ec1dbeaULL, 0x193d9730bULL },
+    { 0xc9d9ce0a6ULL, 0x62f754c29ULL, 0x650739b93ULL, 0x9432aef46ULL },
+    { 0x8c5107a8cULL, 0xd26743022ULL, 0x315e08a31ULL, 0x440c2e64bULL },
+    { 0xbd8fabf2bULL, 0x96dabf6afULL, 0xd4fd5f1bdULL, 0xf56fd5b69ULL },
+    { 0x64851a0adULL, 0x846275b01ULL, 0xb5058a126ULL, 0x80dae4621ULL },
+    { 0xdc6d3ab04ULL, 0x834ec6b2eULL, 0x20d5cb63bULL, 0x74d6372c1ULL },
+    { 0xe7fb19a83ULL, 0xd5363ed3aULL, 0xc1598dfe7ULL, 0x5cb7c6cabULL },
+    { 0xb1cc54505ULL, 0x240df07a8ULL, 0xa0a2a338dULL, 0x15e0fb024ULL },
+    { 0x616ef5947ULL, 0x3d95e8f0eULL, 0xe29af7686ULL, 0x70f17a9bcULL },
+    { 0x93530bfc1ULL, 0x5c6e8e4b2ULL, 0x83fd0cac9ULL, 0x4d271763aULL },
+    { 0x1b2901528ULL, 0x130a81499ULL, 0x14a8094d8ULL, 0x9928150c8ULL },
+    { 0xc5f507681ULL, 0xd56712ea0ULL, 0x816e0afa3ULL, 0x05748e6abULL },
+    { 0x34baf7992ULL, 0xf1f9b814eULL, 0x499ef5d2cULL, 0x7281d9f8fULL },
+    { 0xa9b0bdbbdULL, 0x57a1f7567ULL, 0xbddbd0d95ULL, 0xe6aef85eaULL },
+    { 0x9539c10c5ULL, 0xfdaa40428ULL, 0xa30839ca9ULL, 0x1420255bfULL },
+    { 0x32dfccbf2ULL, 0x68bfbe25bULL, 0x4fd33fb4cULL, 0xda47dfd16ULL },
+    { 0xedeaac6f7ULL, 0x8fb57ecedULL, 0xef63557b7ULL, 0xb737eadf1ULL },
+    { 0x4d560facaULL, 0xda750fe02ULL, 0x535f06ab2ULL, 0x407f0ae5bULL },
+    { 0x74acbe2b0ULL, 0x81e936b4dULL, 0x0d47d352eULL, 0xb2d6c9781ULL },
+    { 0x23b678ec5ULL, 0x6d207e796ULL, 0xa371e6dc4ULL, 0x69e7e04b6ULL },
+    { 0xe8d289351ULL, 0x5e84be860ULL, 0x8ac914b17ULL, 0x0617d217aULL },
+    { 0xeb96b95d6ULL, 0x5ab0fcff4ULL, 0x6ba9d69d7ULL, 0x2ff3f0d5aULL },
+    { 0x55915b690ULL, 0xf06a16dc0ULL, 0x096da89aaULL, 0x03b68560fULL },
+    { 0x28babdda6ULL, 0x53b1fc18fULL, 0x65bbd5d14ULL, 0xf183f8dcaULL },
+    { 0x23a34b82bULL, 0x35523d413ULL, 0xd41d2c5c4ULL, 0xc82bc4aacULL },
+    { 0xc1ac1454aULL, 0x091191fa8ULL, 0x52a283583ULL, 0x15f898890ULL },
+    { 0x64b6af832ULL, 0xd1d13ca47ULL, 0x4c1f56d26ULL, 0xe253c8b8bULL },
+    { 0x52199b361ULL, 0x5cca86919ULL, 0x86cd9984aULL, 0x98961533aULL },
+    { 0x63b73d364ULL, 0x5903fef15ULL, 0x26cbcedc6ULL, 0xa8f7fc09aULL },
+    { 0xc05570558ULL, 0x680681be4ULL, 0x1aa0eaa03ULL, 0x27d816016ULL },
+    { 0x34b5aba9dULL, 0xd5ea77246ULL, 0xb95d5ad2cULL, 0x624ee57abULL },
+    { 0x04d6ad747ULL, 0xdc95de284ULL, 0xe2eb56b20ULL, 0x2147ba93bULL },
+    { 0x3ab9b92ffULL, 0x5fba7715dULL, 0xff49d9d5cULL, 0xba8ee5dfaULL },
+    { 0x1ec1cc733ULL, 0xa69f960d1ULL, 0xcce338378ULL, 0x8b069f965ULL },
+    { 0xe35f970ccULL, 0x58e769f38ULL, 0x330e9fac7ULL, 0x1cf96e71aULL },
+    { 0x52e9caf47ULL, 0x2dded689aULL, 0xe2f53974aULL, 0x5916b7bb4ULL },
+    { 0xab638b166ULL, 0x1bd6ec431ULL, 0x668d1c6d5ULL, 0x8c2376bd8ULL },
+    { 0x8ae5d0537ULL, 0x2796d03f1ULL, 0xeca0ba751ULL, 0x8fc0b69e4ULL },
+    { 0x67ad512b1ULL, 0xb52232f59ULL, 0x8d48ab5e6ULL, 0x9af4c44adULL },
+    { 0xb3187a04bULL, 0x6c582553cULL, 0xd205e18cdULL, 0x3caa41a36ULL },
+    { 0x3cc689c38ULL, 0x928c3d2c3ULL, 0x1c391633cULL, 0xc34bc3149ULL },
+    { 0xfa740baf7ULL, 0x5f7c66a73ULL, 0xef5d02e5fULL, 0xce5663efaULL },
+    { 0x04fadd48bULL, 0xf5b51d188ULL, 0xd12bb5f20ULL, 0x118b8adafULL },
+    { 0x998a84c4cULL, 0x0a89594aaULL, 0x323215199ULL, 0x5529a9150ULL },
+    { 0x3ffcdaf11ULL, 0xe7ccb67daULL, 0x88f5b3ffcULL, 0x5be6d33e7ULL },
+    { 0x94fa228c9ULL, 0xcd6c1902eULL, 0x931445f29ULL, 0x7409836b3ULL },
+    { 0xe4ed3c91dULL, 0x8507f5b6eULL, 0xb893cb727ULL, 0x76dafe0a1ULL },
+    { 0x03378a14cULL, 0x49c2cd610ULL, 0x32851ecc0ULL, 0x086b34392ULL },
+    { 0xd81b22d01ULL, 0x464a888aeULL, 0x80b44d81bULL, 0x751115262ULL },
+    { 0x195b1255aULL, 0x4a5e895c8ULL, 0x5aa48da98ULL, 0x13a917a52ULL },
+    { 0x214878b62ULL, 0x2814a650fULL, 0x46d1e1284ULL, 0xf0a652814ULL },
+    { 0x285dec132ULL, 0x6297a424dULL, 0x4c837ba14ULL, 0xb2425e946ULL },
+    { 0x7b64344d7ULL, 0x0f3d60fd4ULL, 0xeb22c26deULL, 0x2bf06bcf0ULL },
+    { 0x624b978a7ULL, 0x14f76891bULL, 0xe51e9d246ULL, 0xd8916ef28ULL },
+    { 0x6777bc0b1ULL, 0xc5a72cf55ULL, 0x8d03deee6ULL, 0xaaf34e5a3ULL },
+    { 0x909071f5aULL, 0x7818931e6ULL, 0x5af8e0909ULL, 0x678c9181eULL },
+    { 0x25cee97bdULL, 0xb4a4ff6cdULL, 0xbde9773a4ULL, 0xb36ff252dULL },
+    { 0xfd53886fdULL, 0xceae6fce1ULL, 0xbf611cabfULL, 0x873f67573ULL },
+    { 0xe7693524bULL, 0x9d1723d3cULL, 0xd24ac96e7ULL, 0x3cbc4e8b9ULL },
+    { 0x18c9897f9ULL, 0x1eae970c9ULL, 0x9fe919318ULL, 0x930e97578ULL },
+    { 0x656040b0aULL, 0xa114a3c02ULL, 0x50d0206a6ULL, 0x403c52885ULL },
+    { 0x382e9dc2dULL, 0x17896d38bULL, 0xb43b9741cULL, 0xd1cb691e8ULL },
+    { 0xcdf2b125dULL, 0xdf845bd64ULL, 0xba48d4fb3ULL, 0x26bda21fbULL },
+    { 0x094eb33d6ULL, 0x1af4ca74cULL, 0x6bccd7290ULL, 0x32e532f58ULL },
+    { 0x39dfd63d1ULL, 0x6eefba748ULL, 0x8bc6bfb9cULL, 0x12e5df776ULL },
+    { 0xf936c05a7ULL, 0x67b8e8ea1ULL, 0xe5a036c9fULL, 0x857171de6ULL },
+    { 0x77f345015ULL, 0xf50f78c50ULL, 0xa80a2cfeeULL, 0x0a31ef0afULL },
+    { 0xe5aa6c983ULL, 0xa531bcc2eULL, 0xc193655a7ULL, 0x7433d8ca5ULL },
+    { 0xb0e8a713eULL, 0x11ddf106dULL, 0x7c8e5170dULL, 0xb608fbb88ULL },
+    { 0xdddb78286ULL, 0xe23e5ed2cULL, 0x6141edbbbULL, 0x34b7a7c47ULL },
+    { 0x3b099d6b2ULL, 0x12bb265d9ULL, 0x4d6b990dcULL, 0x9ba64dd48ULL },
+    { 0x40ead9233ULL, 0x35941e949ULL, 0xcc49b5702ULL, 0x9297829acULL },
+    { 0x1af7fc2c4ULL, 0x6baf5e314ULL, 0x2343fef58ULL, 0x28c7af5d6ULL },
+    { 0x3c9ad30abULL, 0xf6f839109ULL, 0xd50cb593cULL, 0x9089c1f6fULL },
+    { 0xb30651242ULL, 0x38182a730ULL, 0x4248a60cdULL, 0x0ce54181cULL },
+    { 0x32bdf3809ULL, 0x75ca3131eULL, 0x901cfbd4cULL, 0x78c8c53aeULL },
+    { 0x6ce132526ULL, 0x8356f0985ULL, 0x64a4c8736ULL, 0xa190f6ac1ULL },
+    { 0x575d3b4d8ULL, 0xd86e05fdcULL, 0x1b2dcbaeaULL, 0x3bfa0761bULL },
+    { 0x32fa7896bULL, 0x6d1cbd11fULL, 0xd691e5f4cULL, 0xf88bd38b6ULL },
+    { 0xc9254acfbULL, 0x2f7205ee3ULL, 0xdf352a493ULL, 0xc77a04ef4ULL },
+    { 0x5be358998ULL, 0x232e9dd52ULL, 0x1991ac7daULL, 0x4abb974c4ULL },
+    { 0xa2f9e1232ULL, 0x71963207dULL, 0x4c4879f45ULL, 0xbe04c698eULL },
+    { 0x77b552cd9ULL, 0xed6a31fd2ULL, 0x9b34aadeeULL, 0x4bf8c56b7ULL },
+    { 0xb0dbcdd4aULL, 0x789fbd0aaULL, 0x52bb3db0dULL, 0x550bdf91eULL },
+    { 0xcb93159deULL, 0x5a33d9d72ULL, 0x7b9a8c9d3ULL, 0x4eb9bcc5aULL },
+    { 0x7e27673ebULL, 0xbf7baba15ULL, 0xd7ce6e47eULL, 0xa85d5defdULL },
+    { 0x1b449d037ULL, 0x169d44751ULL, 0xec0b922d8ULL, 0x8ae22b968ULL },
+    { 0xd6d539e01ULL, 0xd40e16bb6ULL, 0x8079cab6bULL, 0x6dd68702bULL },
+    { 0x99113b5d5ULL, 0x5e6ac45e4ULL, 0xabadc8899ULL, 0x27a23567aULL },
+    { 0xedc9deaf0ULL, 0xaae736d6bULL, 0x0f57b93b7ULL, 0xd6b6ce755ULL },
+    { 0x984f723a0ULL, 0x226e8a32dULL, 0x05c4ef219ULL, 0xb4c517644ULL },
+    { 0x92b1c25ebULL, 0x6dfa910b1ULL, 0xd7a438d49ULL, 0x8d0895fb6ULL },
+    { 0xe95337aafULL, 0x56776bd27ULL, 0xf55ecca97ULL, 0xe4bd6ee6aULL },
+    { 0xb8f991e0bULL, 0x579e331aaULL, 0xd07899f1dULL, 0x558cc79eaULL },
+    { 0x36be29064ULL, 0xd9087c21dULL, 0x260947d6cULL, 0xb843e109bULL },
+    { 0x6d584bdffULL, 0xfe74e5ccbULL, 0xffbd21ab6ULL, 0xd33a72e7fULL },
+    { 0x7c49ff20bULL, 0xb6df2790cULL, 0xd04ff923eULL, 0x309e4fb6dULL },
+    { 0xcc04ed269ULL, 0xbe8107a25ULL, 0x964b72033ULL, 0xa45e0817dULL },
+    { 0x7ebfc358cULL, 0xf3eaf9a98ULL, 0x31ac3fd7eULL, 0x1959f57cfULL },
+    { 0x23474a34bULL, 0x2c56af610ULL, 0xd2c52e2c4ULL, 0x086f56a34ULL },
+    { 0xf7026599eULL, 0xb039e9c76ULL, 0x799a640efULL, 0x6e3979c0dULL },
+    { 0xb7860bb19ULL, 0x9448bf672ULL, 0x98dd061edULL, 0x4e6fd1229ULL },
+    { 0x1ded54d3aULL, 0xa31f917cbULL, 0x5cb2ab7b8ULL, 0xd3e89f8c5ULL },
+    { 0x13811cf4eULL, 0x081bd7592ULL, 0x72f3881c8ULL, 0x49aebd810ULL },
+    { 0x2688b7a67ULL, 0x9cd17211fULL, 0xe65ed1164ULL, 0xf884e8b39ULL },
+    { 0xdabd05f2cULL, 0x530bd3abbULL, 0x34fa0bd5bULL, 0xdd5cbd0caULL },
+    { 0xb3c419f26ULL, 0x101cf67b3ULL, 0x64f9823cdULL, 0xcde6f3808ULL },
+    { 0x03587e9ecULL, 0x6865c551fULL, 0x3797e1ac0ULL, 0xf8aa3a616ULL },
+    { 0x8ae251df4ULL, 0x3b24d81f3ULL, 0x2fb8a4751ULL, 0xcf81b24dcULL },
+    { 0x742ce2cf6ULL, 0xa9f860acfULL, 0x6f347342eULL, 0xf35061f95ULL },
+    { 0x5057ebb44ULL, 0x78cecea06ULL, 0x22dd7ea0aULL, 0x60573731eULL },
+    { 0xea7a6d98dULL, 0x7725ed83eULL, 0xb19b65e57ULL, 0x7c1b7a4eeULL },
+    { 0x517c17f22ULL, 0x515d82f8bULL, 0x44fe83e8aULL, 0xd1f41ba8aULL },
+    { 0x74ce4cee0ULL, 0xa82d3ea8bULL, 0x07732732eULL, 0xd157cb415ULL },
+    { 0xeb7047b26ULL, 0x7355e2c33ULL, 0x64de20ed7ULL, 0xcc347aaceULL },
+    { 0x2c1579360ULL, 0xfa02a6305ULL, 0x06c9ea834ULL, 0xa0c65405fULL },
+    { 0x0a6660731ULL, 0x27048a2d5ULL, 0x8ce066650ULL, 0xab45120e4ULL },
+    { 0x0ffa16543ULL, 0xcf5598598ULL, 0xc2a685ff0ULL, 0x19a19aaf3ULL },
+    { 0xf80d98f26ULL, 0x029ae6babULL, 0x64f19b01fULL, 0xd5d675940ULL },
+    { 0x1151d5892ULL, 0x70bf00542ULL, 0x491ab8a88ULL, 0x42a00fd0eULL },
+    { 0x5a7f48482ULL, 0x633e0ca98ULL, 0x41212fe5aULL, 0x195307cc6ULL },
+    { 0xdcf6899f6ULL, 0xdbbcdca63ULL, 0x6f9916f3bULL, 0xc653b3ddbULL },
+    { 0x8e74ef296ULL, 0xf3f546274ULL, 0x694f72e71ULL, 0x2e462afcfULL },
+    { 0x7acda5eb5ULL, 0x16af72adfULL, 0xad7a5b35eULL, 0xfb54ef568ULL },
+    { 0x494a9e46fULL, 0x0ed54dd89ULL, 0xf62795292ULL, 0x91bb2ab70ULL },
+    { 0x5cbc3b313ULL, 0xd75896b4cULL, 0xc8cdc3d3aULL, 0x32d691aebULL },
+    { 0x18acd63dfULL, 0x2ff9d3348ULL, 0xfbc6b3518ULL, 0x12ccb9ff4ULL },
+    { 0x8098c6de6ULL, 0x68f1d00abULL, 0x67b631901ULL, 0xd500b8f16ULL },
+    { 0xab9e5dadaULL, 0x7a313f77aULL, 0x5b5ba79d5ULL, 0x5eefc8c5eULL },
+    { 0xbbd7b5f2fULL, 0x569ffb7b7ULL, 0xf4fadebddULL, 0xededff96aULL },
+    { 0xe74013e35ULL, 0x944462df3ULL, 0xac7c802e7ULL, 0xcfb462229ULL },
+    { 0xb9b48ea1cULL, 0x43c977662ULL, 0x385712d9dULL, 0x466ee93c2ULL },
+    { 0x2daecbd26ULL, 0xb3d0fc68bULL, 0x64bd375b4ULL, 0xd163f0bcdULL },
+    { 0x0efb88593ULL, 0xc7b69c0d8ULL, 0xc9a11df70ULL, 0x1b0396de3ULL },
+    { 0x8cfdaac11ULL, 0xc7c6142eeULL, 0x88355bf31ULL, 0x7742863e3ULL },
+    { 0x50ddff606ULL, 0x70df56b8cULL, 0x606ffbb0aULL, 0x31d6afb0eULL },
+    { 0xab43c95bdULL, 0x36a6ed4f1ULL, 0xbda93c2d5ULL, 0x8f2b7656cULL },
+    { 0x50f29fa3eULL, 0x51dd5f943ULL, 0x7c5f94f0aULL, 0xc29fabb8aULL },
+    { 0x80a647f6eULL, 0x3951db2a3ULL, 0x76fe26501ULL, 0xc54db8a9cULL },
+    { 0x3ca89d1baULL, 0x93b9b5149ULL, 0x5d8b9153cULL, 0x928ad9dc9ULL },
+    { 0x184ddd611ULL, 0x368f063c8ULL, 0x886bbb218ULL, 0x13c60f16cULL },
+    { 0x537f47735ULL, 0x754fcaed9ULL, 0xacee2fecaULL, 0x9b753f2aeULL },
+    { 0xa49598b54ULL, 0xc882f6362ULL, 0x2ad19a925ULL, 0x46c6f4113ULL },
+    { 0x3aa1e9dc1ULL, 0x3faab4096ULL, 0x83b97855cULL, 0x6902d55fcULL },
+    { 0x48c1066cbULL, 0x0e7713880ULL, 0xd36608312ULL, 0x011c8ee70ULL },
+    { 0xe3db06351ULL, 0x4c47bac78ULL, 0x8ac60dbc7ULL, 0x1e35de232ULL },
+    { 0x1af13a110ULL, 0x434e94154ULL, 0x0885c8f58ULL, 0x2a82972c2ULL },
+    { 0x891fbdd51ULL, 0x5e838c7eeULL, 0x8abbdf891ULL, 0x77e31c17aULL },
+    { 0x8e4406857ULL, 0x8e5540272ULL, 0xea1602271ULL, 0x4e402aa71ULL },
+    { 0x877f2a6b5ULL, 0xc5664e6fdULL, 0xad654fee1ULL, 0xbf67266a3ULL },
+    { 0x7a9886236ULL, 0x42d972859ULL, 0x6c461195eULL, 0x9a14e9b42ULL },
+    { 0xe4c58d77aULL, 0x9897b7ae1ULL, 0x5eeb1a327ULL, 0x875ede919ULL },
+    { 0x469c2eb18ULL, 0xc04197a5eULL, 0x18d743962ULL, 0x7a5e98203ULL },
+    { 0xa5aa3e3f8ULL, 0x8961bf56dULL, 0x1fc7c55a5ULL, 0xb6afd8691ULL },
+    { 0x0e692e5d5ULL, 0x8f67c40dcULL, 0xaba749670ULL, 0x3b023e6f1ULL },
+    { 0x0639a5939ULL, 0xd5838105fULL, 0x9c9a59c60ULL, 0xfa081c1abULL },
+    { 0x603f5da76ULL, 0x79136eb4bULL, 0x6e5bafc06ULL, 0xd2d76c89eULL },
+    { 0x48dbee969ULL, 0x6ec79d80fULL, 0x96977db12ULL, 0xf01b9e376ULL },
+    { 0x5fd76de95ULL, 0xf62f5eed6ULL, 0xa97b6ebfaULL, 0x6b77af46fULL },
+    { 0x65b9b4bc6ULL, 0xc9b3f2d0eULL, 0x63d2d9da6ULL, 0x70b4fcd93ULL },
+    { 0x06b300d5fULL, 0xcd12d90d2ULL, 0xfab00cd60ULL, 0x4b09b48b3ULL },
+    { 0x4c62fbdebULL, 0xbff48d987ULL, 0xd7bdf4632ULL, 0xe19b12ffdULL },
+    { 0x9ab1e1c1fULL, 0x779a510f6ULL, 0xf83878d59ULL, 0x6f08a59eeULL },
+    { 0x74623438dULL, 0x852deb904ULL, 0xb1c2c462eULL, 0x209d7b4a1ULL },
+    { 0xe5228a728ULL, 0x81c0afca1ULL, 0x14e5144a7ULL, 0x853f50381ULL },
+    { 0x14d90952fULL, 0xd41ed5089ULL, 0xf4a909b28ULL, 0x910ab782bULL },
+    { 0xda1859e97ULL, 0x7638469faULL, 0xe979a185bULL, 0x5f9621c6eULL },
+    { 0x265090109ULL, 0xc484a1110ULL, 0x908090a64ULL, 0x088852123ULL },
+    { 0x19eb33799ULL, 0x176e9b5ccULL, 0x99eccd798ULL, 0x33ad976e8ULL },
+    { 0x69501e12cULL, 0x4245e5d01ULL, 0x348780a96ULL, 0x80ba7a242ULL },
+    { 0x968b5e3bfULL, 0xa47bdf179ULL, 0xfdc7ad169ULL, 0x9e8fbde25ULL },
+    { 0xda7430065ULL, 0x4f0c40b35ULL, 0xa600c2e5bULL, 0xacd0230f2ULL },
+    { 0x19b31690dULL, 0x474bd9502ULL, 0xb0968cd98ULL, 0x40a9bd2e2ULL },
+    { 0x19037a258ULL, 0x2a4a0f544ULL, 0x1a45ec098ULL, 0x22af05254ULL },
+    { 0x2d8318899ULL, 0x86223d542ULL, 0x99118c1b4ULL, 0x42abc4461ULL },
+    { 0x5ab3a5f51ULL, 0x5f8b9a8d6ULL, 0x8afa5cd5aULL, 0x6b159d1faULL },
+    { 0x7aa67edb8ULL, 0x2369bdbd7ULL, 0x1db7e655eULL, 0xebdbd96c4ULL },
+    { 0x4a27ec6f9ULL, 0x2fa30fad5ULL, 0x9f637e452ULL, 0xab5f0c5f4ULL },
+    { 0xc720a16a9ULL, 0x95a003cb5ULL, 0x9568504e3ULL, 0xad3c005a9ULL },
+    { 0x46654da20ULL, 0xb10706a13ULL, 0x045b2a662ULL, 0xc8560e08dULL },
+    { 0x45aa2854fULL, 0x8d10ddc8cULL, 0xf2a1455a2ULL, 0x313bb08b1ULL },
+    { 0xae7953836ULL, 0xf3566017bULL, 0x6c1ca9e75ULL, 0xde8066acfULL },
+    { 0x9c625250cULL, 0xa34cc91a0ULL, 0x30a4a4639ULL, 0x0589332c5ULL },
+    { 0x0c5834363ULL, 0xce158210dULL, 0xc6c2c1a30ULL, 0xb0841a873ULL },
+    { 0x4a2d00ae1ULL, 0x0f2202a1bULL, 0x87500b452ULL, 0xd854044f0ULL },
+    { 0x74dd1cc7aULL, 0xc81f35bcbULL, 0x5e338bb2eULL, 0xd3dacf813ULL },
+    { 0xffb88bb9bULL, 0xd7f8b7c7aULL, 0xd9dd11dffULL, 0x5e3ed1febULL },
+    { 0x480bad231ULL, 0x16830e84dULL, 0x8c4b5d012ULL, 0xb2170c168ULL },
+    { 0x072988981ULL, 0x85a28441aULL, 0x8191194e0ULL, 0x5822145a1ULL },
+    { 0xe61db88bbULL, 0xc4b225b7fULL, 0xdd11db867ULL, 0xfeda44d23ULL },
+    { 0x738a83e63ULL, 0x1cd83ac9bULL, 0xc67c151ceULL, 0xd935c1b38ULL },
+    { 0x270058d3aULL, 0xa010a55d3ULL, 0x5cb1a00e4ULL, 0xcbaa50805ULL },
+    { 0x6385ed190ULL, 0x30a3b4e54ULL, 0x098b7a1c6ULL, 0x2a72dc50cULL },
+    { 0x2b3acf96cULL, 0x7bc1ed41bULL, 0x369f35cd4ULL, 0xd82b783deULL },
+    { 0xdbd098453ULL, 0x4e9c14df0ULL, 0xca2190bdbULL, 0x0fb283972ULL },
+    { 0x9dcdd2876ULL, 0xaade5076bULL, 0x6e14bb3b9ULL, 0xd6e0a7b55ULL },
+    { 0x31f496ab1ULL, 0x45ed32743ULL, 0x8d5692f8cULL, 0xc2e4cb7a2ULL },
+    { 0x1f2f4d253ULL, 0xbf1b0e658ULL, 0xca4b2f4f8ULL, 0x1a670d8fdULL },
+    { 0xee160fe1eULL, 0xd2516faf2ULL, 0x787f06877ULL, 0x4f5f68a4bULL },
+    { 0x0aa1dd351ULL, 0x3f8396150ULL, 0x8acbb8550ULL, 0x0a869c1fcULL },
+    { 0x56ad2facaULL, 0x997b17a1eULL, 0x535f4b56aULL, 0x785e8de99ULL },
+    { 0xd37ef532fULL, 0x759dcbf3dULL, 0xf4caf7ecbULL, 0xbcfd3b9aeULL },
+    { 0x1a4da862bULL, 0x069e0729dULL, 0xd4615b258ULL, 0xb94e07960ULL },
+    { 0x0e0e53e2cULL, 0xb2404b39bULL, 0x347ca7070ULL, 0xd9cd2024dULL },
+    { 0xba1319e3cULL, 0x520a6f1f3ULL, 0x3c798c85dULL, 0xcf8f6504aULL },
+    { 0xa6260a062ULL, 0x89502c231ULL, 0x460506465ULL, 0x8c4340a91ULL },
+    { 0x3ba50b0e1ULL, 0x1f6a34611ULL, 0x870d0a5dcULL, 0x8862c56f8ULL },
+    { 0x2624d08a6ULL, 0xa1b060313ULL, 0x6510b2464ULL, 0xc8c060d85ULL },
+    { 0x22aa5db8bULL, 0x3531bf11aULL, 0xd1dba5544ULL, 0x588fd8cacULL },
+    { 0xcc591eeabULL, 0xc677079abULL, 0xd57789a33ULL, 0xd59e0ee63ULL },
+    { 0x5da3e8247ULL, 0xaf9a5ec04ULL, 0xe2417c5baULL, 0x2037a59f5ULL },
+    { 0x31461ffadULL, 0x146def783ULL, 0xb5ff8628cULL, 0xc1ef7b628ULL },
+    { 0xe1e44ddc5ULL, 0x3d25f4ea2ULL, 0xa3bb22787ULL, 0x4572fa4bcULL },
+    { 0x2cf26d685ULL, 0xf7257e084ULL, 0xa16b64f34ULL, 0x2107ea4efULL },
+    { 0xbcb817842ULL, 0xdb593012aULL, 0x421e81d3dULL, 0x5480c9adbULL },
+    { 0xe569a2dacULL, 0x81e6e1cafULL, 0x35b4596a7ULL, 0xf53876781ULL },
+    { 0x7ebb45eb1ULL, 0xf72b3a8dbULL, 0x8d7a2dd7eULL, 0xdb15cd4efULL },
+    { 0x5fc1b4d0aULL, 0x829f91d96ULL, 0x50b2d83faULL, 0x69b89f941ULL },
+    { 0x43e7e1579ULL, 0x3d8699ed5ULL, 0x9ea87e7c2ULL, 0xab79961bcULL },
+    { 0x4ae7aa0abULL, 0x07f61da15ULL, 0xd5055e752ULL, 0xa85b86fe0ULL },
+    { 0xa5b95569fULL, 0xf533735e8ULL, 0xf96aa9da5ULL, 0x17aceccafULL },
+    { 0xe0547690dULL, 0x6445e1b26ULL, 0xb096e2a07ULL, 0x64d87a226ULL },
+    { 0xd22d0e992ULL, 0x017b84a7aULL, 0x49970b44bULL, 0x5e521de80ULL },
+    { 0x18a8dfe61ULL, 0x3fc91618bULL, 0x867fb1518ULL, 0xd186893fcULL },
+    { 0x45dbaf0baULL, 0xd0f71dc4dULL, 0x5d0f5dba2ULL, 0xb23b8ef0bULL },
+    { 0x788b898d8ULL, 0x1aaa3d84aULL, 0x1b191d11eULL, 0x521bc5558ULL },
+    { 0xf1dd9c171ULL, 0x4c8fb4f69ULL, 0x8e839bb8fULL, 0x96f2df132ULL },
+    { 0xa85352b38ULL, 0x6246ab163ULL, 0x1cd4aca15ULL, 0xc68d56246ULL },
+    { 0xa86a378e9ULL, 0x1f652912fULL, 0x971ec5615ULL, 0xf4894a6f8ULL },
+    { 0xbd7e54ebeULL, 0xe33d6b7ebULL, 0x7d72a7ebdULL, 0xd7ed6bcc7ULL },
+    { 0xdfdca48d1ULL, 0xcead10e7eULL, 0x8b1253bfbULL, 0x7e708b573ULL },
+    { 0xa4b87b887ULL, 0xf5707412eULL, 0xe11de1d25ULL, 0x7482e0eafULL },
+    { 0x9c166ae50ULL, 0xea480e2e6ULL, 0x0a7566839ULL, 0x674701257ULL },
+    { 0x0742acf2fULL, 0x8495cf497ULL, 0xf4f3542e0ULL, 0xe92f3a921ULL },
+    { 0x4c789e578ULL, 0xcbc5859c9ULL, 0x1ea791e32ULL, 0x939a1a3d3ULL },
+    { 0x9aef2154cULL, 0x1b0ed92bcULL, 0x32a84f759ULL, 0x3d49b70d8ULL },
+    { 0x72218f626ULL, 0x11db66891ULL, 0x646f1844eULL, 0x89166db88ULL },
+    { 0x90164f542ULL, 0x78598c2a0ULL, 0x42af26809ULL, 0x054319a1eULL },
+    { 0xff262d2f8ULL, 0x9b292fe75ULL, 0x1f4b464ffULL, 0xae7f494d9ULL },
+    { 0x9b4b2165bULL, 0x1e1e0b4fcULL, 0xda684d2d9ULL, 0x3f2d07878ULL },
+    { 0x9dfaf2a1bULL, 0xe7dc1b56eULL, 0xd854f5fb9ULL, 0x76ad83be7ULL },
+    { 0x5897cb2b2ULL, 0x72fa1ea41ULL, 0x4d4d3e91aULL, 0x825785f4eULL },
+    { 0x472f7cf5aULL, 0xa9138ffdeULL, 0x5af3ef4e2ULL, 0x7bff1c895ULL },
+    { 0xe73af7851ULL, 0xfdc128d7eULL, 0x8a1ef5ce7ULL, 0x7eb1483bfULL },
+    { 0xcfd7f2ac4ULL, 0xeae65af36ULL, 0x2354febf3ULL, 0x6cf5a6757ULL },
+    { 0x22915a3cdULL, 0x6c62f7110ULL, 0xb3c5a8944ULL, 0x088ef4636ULL },
+    { 0x228546d19ULL, 0x2443b12d2ULL, 0x98b62a144ULL, 0x4b48dc224ULL },
+    { 0x72d05dbd9ULL, 0x7c2db7952ULL, 0x9bdba0b4eULL, 0x4a9edb43eULL },
+    { 0x42d995520ULL, 0x508790999ULL, 0x04aa99b42ULL, 0x99909e10aULL },
+    { 0x8a8579901ULL, 0x360294336ULL, 0x8099ea151ULL, 0x6cc29406cULL },
+    { 0xc5c62a184ULL, 0x8064dce24ULL, 0x2185463a3ULL, 0x2473b2601ULL },
+    { 0xe9975850dULL, 0x6602fdfa0ULL, 0xb0a1ae997ULL, 0x05fbf4066ULL },
+    { 0x0eeab1467ULL, 0x9f945819dULL, 0xe628d5770ULL, 0xb981a29f9ULL },
+    { 0x9135ad02dULL, 0x558b45625ULL, 0xb40b5ac89ULL, 0xa46a2d1aaULL },
+    { 0xbe8dc84e4ULL, 0xaaaa742b9ULL, 0x27213b17dULL, 0x9d42e5555ULL },
+    { 0xadadb84b2ULL, 0x83b2347edULL, 0x4d21db5b5ULL, 0xb7e2c4dc1ULL },
+    { 0xef12e0b08ULL, 0xe280abc36ULL, 0x10d0748f7ULL, 0x6c3d50147ULL },
+    { 0x6e1e36e44ULL, 0xca416ab9eULL, 0x2276c7876ULL, 0x79d568253ULL },
+    { 0xb6a77d19dULL, 0xb52bfd374ULL, 0xb98bee56dULL, 0x2ecbfd4adULL },
+    { 0x1756538bdULL, 0xf46c49753ULL, 0xbd1ca6ae8ULL, 0xcae92362fULL },
+    { 0x5f12d5241ULL, 0xfe890ad10ULL, 0x824ab48faULL, 0x08b50917fULL },
+    { 0x4675acf63ULL, 0xcd9786a97ULL, 0xc6f35ae62ULL, 0xe9561e9b3ULL },
+    { 0x3c6a5e2acULL, 0xa36d6f109ULL, 0x3547a563cULL, 0x908f6b6c5ULL },
+    { 0x241b03f8fULL, 0xd472eb08aULL, 0xf1fc0d824ULL, 0x510d74e2bULL },
+    { 0xaeb7aaf1aULL, 0xc3d2bf2f6ULL, 0x58f55ed75ULL, 0x6f4fd4bc3ULL },
+    { 0x807b0b955ULL, 0x5d46cc06aULL, 0xaa9d0de01ULL, 0x5603362baULL },
+    { 0x067bb98e2ULL, 0xd9b60c11fULL, 0x4719dde60ULL, 0xf88306d9bULL },
+    { 0xbbcd61cabULL, 0x363e316bfULL, 0xd5386b3ddULL, 0xfd68c7c6cULL },
+    { 0x666f9b1b2ULL, 0x91f6acb59ULL, 0x4d8d9f666ULL, 0x9ad356f89ULL },
+    { 0xdc806c775ULL, 0xae09d68e5ULL, 0xaee36013bULL, 0xa716b9075ULL },
+    { 0xf44c7725dULL, 0xbc4d63b6cULL, 0xba4ee322fULL, 0x36dc6b23dULL },
+    { 0x72db4b191ULL, 0x746ebc858ULL, 0x898d2db4eULL, 0x1a13d762eULL },
+    { 0x10126c7f9ULL, 0x6c298f0c5ULL, 0x9fe364808ULL, 0xa30f19436ULL },
+    { 0xa2017c8ddULL, 0x2c2365176ULL, 0xbb13e8045ULL, 0x6e8a6c434ULL },
+    { 0x5c2b62c7dULL, 0xaf4a498cfULL, 0xbe346d43aULL, 0xf319252f5ULL },
+    { 0xf611f932dULL, 0xf48ae7935ULL, 0xb4c9f886fULL, 0xac9e7512fULL },
+    { 0x1dcaf6593ULL, 0xa6fd985ccULL, 0xc9a6f53b8ULL, 0x33a19bf65ULL },
+    { 0xf6de5ab70ULL, 0xe84cbeb7bULL, 0x0ed5a7b6fULL, 0xded7d3217ULL },
+    { 0x02e35f854ULL, 0x39475c152ULL, 0x2a1fac740ULL, 0x4a83ae29cULL },
+    { 0x9a52c831dULL, 0x668ccf070ULL, 0xb8c134a59ULL, 0x0e0f33166ULL },
+    { 0xc99ceef8dULL, 0x66e1d7eaeULL, 0xb1f773993ULL, 0x757eb8766ULL },
+    { 0xa400b9b23ULL, 0x9490a6127ULL, 0xc4d9d0025ULL, 0xe48650929ULL },
+    { 0x53bda0953ULL, 0x4d9a90e5eULL, 0xca905bdcaULL, 0x7a70959b2ULL },
+    { 0xe59c50a8cULL, 0xe02073f2aULL, 0x3150a39a7ULL, 0x54fce0407ULL },
+    { 0xab5f94c17ULL, 0x4697687faULL, 0xe8329fad5ULL, 0x5fe16e962ULL },
+    { 0x9a019f2bdULL, 0x16eb47171ULL, 0xbd4f98059ULL, 0x8e8e2d768ULL },
+    { 0xb36f3a3dcULL, 0x096eef77cULL, 0x3bc5cf6cdULL, 0x3eef77690ULL },
+    { 0xc0bbf4193ULL, 0x65b39896cULL, 0xc982fdd03ULL, 0x36919cda6ULL },
+    { 0x147b4ec50ULL, 0xe94f0c0caULL, 0x0a372de28ULL, 0x53030f297ULL },
+    { 0x5ac747fceULL, 0x3a7fdba92ULL, 0x73fe2e35aULL, 0x495dbfe5cULL },
+    { 0x37216f9d0ULL, 0xb96ba4456ULL, 0x0b9f684ecULL, 0x6a225d69dULL },
+    { 0x016ffc2a3ULL, 0x25b70e70dULL, 0xc543ff680ULL, 0xb0e70eda4ULL },
+    { 0x590faf3d8ULL, 0x1aeb8fe4cULL, 0x1bcf5f09aULL, 0x327f1d758ULL },
+    { 0x990154d8aULL, 0x223b815a2ULL, 0x51b2a8099ULL, 0x45a81dc44ULL },
+    { 0x43ee4ca77ULL, 0x2d155ee5bULL, 0xee53277c2ULL, 0xda77aa8b4ULL },
+    { 0x365ac1cd0ULL, 0xf8ac280daULL, 0x0b3835a6cULL, 0x5b014351fULL },
+    { 0x83a6e6b75ULL, 0x2dc1da677ULL, 0xaed6765c1ULL, 0xee65b83b4ULL },
+    { 0x1326bf349ULL, 0x1dc98f714ULL, 0x92cfd64c8ULL, 0x28ef193b8ULL },
+    { 0x4b706304bULL, 0x7f5401c14ULL, 0xd20c60ed2ULL, 0x283802afeULL },
+    { 0x8af9bdb9aULL, 0x53b79717eULL, 0x59dbd9f51ULL, 0x7e8e9edcaULL },
+    { 0xd296d356dULL, 0x7cc8d9bb1ULL, 0xb6acb694bULL, 0x8dd9b133eULL },
+    { 0xbfab3be42ULL, 0x9b5a3e5beULL, 0x427dcd5fdULL, 0x7da7c5ad9ULL },
+    { 0xae56cc626ULL, 0xe2956e2b1ULL, 0x646336a75ULL, 0x8d476a947ULL },
+    { 0xb257b1001ULL, 0x548e28334ULL, 0x8008dea4dULL, 0x2cc14712aULL },
+    { 0x3e3bd4f50ULL, 0xeb8baa1daULL, 0x0af2bdc7cULL, 0x5b855d1d7ULL },
+    { 0x51e26251dULL, 0x254cd9cc4ULL, 0xb8a46478aULL, 0x2339b32a4ULL },
+    { 0x6daca340dULL, 0x97c071e8cULL, 0xb02c535b6ULL, 0x3178e03e9ULL },
+    { 0x8c61ba263ULL, 0x8fd606125ULL, 0xc645d8631ULL, 0xa48606bf1ULL },
+    { 0xbcf52d220ULL, 0xd30f36225ULL, 0x044b4af3dULL, 0xa446cf0cbULL },
+    { 0xd367fb793ULL, 0x35fe8eff4ULL, 0xc9edfe6cbULL, 0x2ff717facULL },
+    { 0x54571354cULL, 0xd84ec9b80ULL, 0x32ac8ea2aULL, 0x01d93721bULL },
+    { 0xfc456649eULL, 0xa27f61ae4ULL, 0x79266a23fULL, 0x27586fe45ULL },
+    { 0xc97409b43ULL, 0x5f1486e22ULL, 0xc2d902e93ULL, 0x4476128faULL },
+    { 0xdbdf3a756ULL, 0x4a5edeffcULL, 0x6ae5cfbdbULL, 0x3ff7b7a52ULL },
+    { 0x7cc636634ULL, 0x824d7abc5ULL, 0x2c66c633eULL, 0xa3d5eb241ULL },
+    { 0xc72515ed7ULL, 0x9d3342ff2ULL, 0xeb7a8a4e3ULL, 0x4ff42ccb9ULL },
+    { 0xf3814e8d3ULL, 0x2c7b34c72ULL, 0xcb17281cfULL, 0x4e32cde34ULL },
+    { 0x0161ec53eULL, 0x2197c54c5ULL, 0x7ca378680ULL, 0xa32a3e984ULL },
+    { 0xb90a8135eULL, 0x1a98eb468ULL, 0x7ac81509dULL, 0x162d71958ULL },
+    { 0xce0a059a5ULL, 0x9621c883bULL, 0xa59a05073ULL, 0xdc1138469ULL },
+    { 0xb18f9d393ULL, 0x14bbbe768ULL, 0xc9cb9f18dULL, 0x16e7ddd28ULL },
+    { 0x94b0081edULL, 0xcd28d5021ULL, 0xb78100d29ULL, 0x840ab14b3ULL },
+    { 0x504292d5fULL, 0x0cdcc99c2ULL, 0xfab49420aULL, 0x439933b30ULL },
+    { 0x23967250bULL, 0x6450b9794ULL, 0xd0a4e69c4ULL, 0x29e9d0a26ULL },
+    { 0x44efcc36bULL, 0xad979fa09ULL, 0xd6c33f722ULL, 0x905f9e9b5ULL },
+    { 0x1ffd84b16ULL, 0xc39fd265aULL, 0x68d21bff8ULL, 0x5a64bf9c3ULL },
+    { 0xc531b5bf8ULL, 0xd9a383d67ULL, 0x1fdad8ca3ULL, 0xe6bc1c59bULL },
+    { 0x1696b2114ULL, 0xc0c8d8354ULL, 0x2884d6968ULL, 0x2ac1b1303ULL },
+    { 0x264ff890dULL, 0xa486ed31eULL, 0xb091ff264ULL, 0x78cb76125ULL },
+    { 0xf6c4dfad7ULL, 0xbcfd76b72ULL, 0xeb5fb236fULL, 0x4ed6ebf3dULL },
+    { 0x9c1854bc5ULL, 0xee29c212aULL, 0xa3d2a1839ULL, 0x548439477ULL },
+    { 0x13d0dbe4aULL, 0x78dc17592ULL, 0x527db0bc8ULL, 0x49ae83b1eULL },
+    { 0xf9b3163b4ULL, 0x436bfad61ULL, 0x2dc68cd9fULL, 0x86b5fd6c2ULL },
+    { 0x519572fc7ULL, 0x6c7ad2f86ULL, 0xe3f4ea98aULL, 0x61f4b5e36ULL },
+    { 0xf227f9465ULL, 0x3d8a6cbb5ULL, 0xa629fe44fULL, 0xadd3651bcULL },
+    { 0x66bebdcedULL, 0xdda17db9fULL, 0xb73bd7d66ULL, 0xf9dbe85bbULL },
+    { 0xd6debfd54ULL, 0xd8cddcbfeULL, 0x2abfd7b6bULL, 0x7fd3bb31bULL },
+    { 0x2a06a02d8ULL, 0x0aa02b254ULL, 0x1b4056054ULL, 0x2a4d40550ULL },
+    { 0x14355f76bULL, 0xfd5b87381ULL, 0xd6efaac28ULL, 0x81ce1dabfULL },
+    { 0x0a933c8b0ULL, 0x42231c157ULL, 0x0d13cc950ULL, 0xea838c442ULL },
+    { 0x29b5721f7ULL, 0x6f72f0745ULL, 0xef84ead94ULL, 0xa2e0f4ef6ULL },
+    { 0x0ab0776daULL, 0x7b71131d4ULL, 0x5b6ee0d50ULL, 0x2b8c88edeULL },
+    { 0x49637d2f0ULL, 0x3b270ed45ULL, 0x0f4bec692ULL, 0xa2b70e4dcULL },
+    { 0x81119d87bULL, 0x5c9305563ULL, 0xde1b98881ULL, 0xc6aa0c93aULL },
+    { 0x8cb3333aaULL, 0xd3729b125ULL, 0x55ccccd31ULL, 0xa48d94ecbULL },
+    { 0xb21d9b610ULL, 0x50ca263f8ULL, 0x086d9b84dULL, 0x1fc64530aULL },
+    { 0xbc76ced5aULL, 0xebddad2e2ULL, 0x5ab736e3dULL, 0x474b5bbd7ULL },
+    { 0xa00f4be68ULL, 0x38422f2abULL, 0x167d2f005ULL, 0xd54f4421cULL },
+    { 0x44a8b7188ULL, 0x91e19190cULL, 0x118ed1522ULL, 0x309898789ULL },
+    { 0xc093bdd1cULL, 0x5083dd9e6ULL, 0x38bbdc903ULL, 0x679bbc10aULL },
+    { 0x4358cb39cULL, 0x70e4c7c58ULL, 0x39cd31ac2ULL, 0x1a3e3270eULL },
+    { 0x8a3d8908cULL, 0x53a245238ULL, 0x31091bc51ULL, 0x1c4a245caULL },
+    { 0xfcbe1566bULL, 0xdf193bba9ULL, 0xd66a87d3fULL, 0x95ddc98fbULL },
+    { 0xcb67b5bf5ULL, 0x1fa7caf77ULL, 0xafdade6d3ULL, 0xeef53e5f8ULL },
+    { 0xe907f8bd4ULL, 0x2aa2eef66ULL, 0x2bd1fe097ULL, 0x66f774554ULL },
+    { 0x4bba2af3aULL, 0x43509fcdfULL, 0x5cf545dd2ULL, 0xfb3f90ac2ULL },
+    { 0x71eaf507aULL, 0x399d39d4dULL, 0x5e0af578eULL, 0xb2b9cb99cULL },
+    { 0x932bb67f6ULL, 0x09fbca5fdULL, 0x6fe6dd4c9ULL, 0xbfa53df90ULL },
+    { 0x53f13d461ULL, 0x5d0f14d95ULL, 0x862bc8fcaULL, 0xa9b28f0baULL },
+    { 0x632d073d3ULL, 0x1d73a2e58ULL, 0xcbce0b4c6ULL, 0x1a745ceb8ULL },
+    { 0xbb15fed10ULL, 0x62cba47f6ULL, 0x08b7fa8ddULL, 0x6fe25d346ULL },
+    { 0xf975108bcULL, 0x432e61f63ULL, 0x3d108ae9fULL, 0xc6f8674c2ULL },
+    { 0x5289b4b7fULL, 0x0c9bd395fULL, 0xfed2d914aULL, 0xfa9cbd930ULL },
+    { 0x1bd20cd5dULL, 0x4e0ddd4d2ULL, 0xbab304bd8ULL, 0x4b2bbb072ULL },
+    { 0xb1f2e7d7bULL, 0x7dddb94e7ULL, 0xdebe74f8dULL, 0xe729dbbbeULL },
+    { 0x3bc7ea178ULL, 0x2acebd655ULL, 0x1e857e3dcULL, 0xaa6bd7354ULL },
+    { 0x81a02c0eaULL, 0x093115425ULL, 0x570340581ULL, 0xa42a88c90ULL },
+    { 0xaf2fdd288ULL, 0xb3a32f738ULL, 0x114bbf4f5ULL, 0x1cef4c5cdULL },
+    { 0x66a03f3c5ULL, 0x9d61f6914ULL, 0xa3cfc0566ULL, 0x2896f86b9ULL },
+    { 0x616b36402ULL, 0x015728d8cULL, 0x4026cd686ULL, 0x31b14ea80ULL },
+    { 0xb36edf664ULL, 0x39cd6e7b9ULL, 0x266fb76cdULL, 0x9de76b39cULL },
+    { 0xddceea8edULL, 0xaeec5de2fULL, 0xb715773bbULL, 0xf47ba3775ULL },
+    { 0xbfa1e4bf4ULL, 0xababf2477ULL, 0x2fd2785fdULL, 0xee24fd5d5ULL },
+    { 0xb532cd812ULL, 0xf1992c462ULL, 0x481b34cadULL, 0x46234998fULL },
+    { 0x5d4b1a388ULL, 0x826e8fd08ULL, 0x11c58d2baULL, 0x10bf17641ULL },
+    { 0xb2f618a5cULL, 0x490c7f372ULL, 0x3a5186f4dULL, 0x4ecfe3092ULL },
+    { 0x38ed5aa5bULL, 0x2f5e3734aULL, 0xda55ab71cULL, 0x52cec7af4ULL },
+    { 0x49dbe1135ULL, 0x7686d8c4dULL, 0xac887db92ULL, 0xb231b616eULL },
+    { 0x49aab6bd9ULL, 0x0fe19bd4eULL, 0x9bd6d5592ULL, 0x72bd987f0ULL },
+    { 0x548bea1a2ULL, 0xa0fa9c80dULL, 0x45857d12aULL, 0xb01395f05ULL },
+    { 0x9d0f46131ULL, 0xa64b88669ULL, 0x8c862f0b9ULL, 0x96611d265ULL },
+    { 0x6661130e1ULL, 0x9d6620911ULL, 0x870c88666ULL, 0x8890466b9ULL },
+    { 0xf8092f252ULL, 0x1a5b2686cULL, 0x4a4f4901fULL, 0x36164da58ULL },
+    { 0x0bc9952eeULL, 0x1ab753519ULL, 0x774a993d0ULL, 0x98acaed58ULL },
+    { 0xb81368f93ULL, 0x663aae0e6ULL, 0xc9f16c81dULL, 0x670755c66ULL },
+    { 0xf797a82d7ULL, 0xccba7ee74ULL, 0xeb415e9efULL, 0x2e77e5d33ULL },
+    { 0x40c655e0cULL, 0x30055bb82ULL, 0x307aa6302ULL, 0x41ddaa00cULL },
+    { 0x7784f6245ULL, 0xacc972f14ULL, 0xa246f21eeULL, 0x28f4e9335ULL },
+    { 0x43951f258ULL, 0x584317f50ULL, 0x1a4f8a9c2ULL, 0x0afe8c21aULL },
+    { 0x2d9f90f30ULL, 0xc282ba7cbULL, 0x0cf09f9b4ULL, 0xd3e5d4143ULL },
+    { 0x92ddb0cdbULL, 0x4cbe113feULL, 0xdb30dbb49ULL, 0x7fc887d32ULL },
+    { 0xf6c7d81acULL, 0xa0aefdb31ULL, 0x3581be36fULL, 0x8cdbf7505ULL },
+    { 0x18c259896ULL, 0x323c5c142ULL, 0x6919a4318ULL, 0x4283a3c4cULL },
+    { 0xbf5ee6771ULL, 0xeecdaa6fdULL, 0x8ee677afdULL, 0xbf655b377ULL },
+    { 0x9ab9d229aULL, 0x63fa13178ULL, 0x5944b9d59ULL, 0x1e8c85fc6ULL },
+    { 0x55867fab1ULL, 0xb4691ef47ULL, 0x8d5fe61aaULL, 0xe2f78962dULL },
+    { 0xb8d2e83eeULL, 0x6abcff025ULL, 0x77c174b1dULL, 0xa40ff3d56ULL },
+    { 0x085f1ff3aULL, 0x52578f3cbULL, 0x5cff8fa10ULL, 0xd3cf1ea4aULL },
+    { 0x12f417383ULL, 0x557d92310ULL, 0xc1ce82f48ULL, 0x08c49beaaULL },
+    { 0xa6718ddfeULL, 0xd9b7e50f3ULL, 0x7fbb18e65ULL, 0xcf0a7ed9bULL },
+    { 0xc08ece6d0ULL, 0x28e11eae8ULL, 0x0b6737103ULL, 0x175788714ULL },
+    { 0x6d950cb47ULL, 0xce13f6e02ULL, 0xe2d30a9b6ULL, 0x4076fc873ULL },
+    { 0x962ff8126ULL, 0xa19acc33dULL, 0x6481ff469ULL, 0xbcc335985ULL },
+    { 0x64b2d2c1aULL, 0xe1d0399c2ULL, 0x5834b4d26ULL, 0x4399c0b87ULL },
+    { 0xabe8a5ddcULL, 0x1ba5f14feULL, 0x3bba517d5ULL, 0x7f28fa5d8ULL },
+    { 0x010176777ULL, 0x2c53c25c5ULL, 0xeee6e8080ULL, 0xa3a43ca34ULL },
+    { 0x7a57f27faULL, 0x6afeabbd5ULL, 0x5fe4fea5eULL, 0xabdd57f56ULL },
+    { 0x313297217ULL, 0x55d96a540ULL, 0xe84e94c8cULL, 0x02a569baaULL },
+    { 0x5450b545dULL, 0xdc8d419c4ULL, 0xba2ad0a2aULL, 0x23982b13bULL },
+    { 0x0b5754fe5ULL, 0x6e27ca793ULL, 0xa7f2aead0ULL, 0xc9e53e476ULL },
+    { 0xb62d373c6ULL, 0x997be233cULL, 0x63cecb46dULL, 0x3cc47de99ULL },
+    { 0x944ebc291ULL, 0x84ad0e36cULL, 0x8943d7229ULL, 0x36c70b521ULL },
+    { 0xd4d1e1cb8ULL, 0xf0ae118e7ULL, 0x1d3878b2bULL, 0xe7188750fULL },
+    { 0x297f72d4fULL, 0x6f56e978eULL, 0xf2b4efe94ULL, 0x71e976af6ULL },
+    { 0xb9298f59bULL, 0x17fba54e8ULL, 0xd9af1949dULL, 0x172a5dfe8ULL },
+    { 0x9cb241addULL, 0xff285b062ULL, 0xbb5824d39ULL, 0x460da14ffULL },
+    { 0x090af1b1dULL, 0x3680cb54eULL, 0xb8d8f5090ULL, 0x72ad3016cULL },
+    { 0x10b987ab7ULL, 0x55fb5204bULL, 0xed5e19d08ULL, 0xd204adfaaULL },
+    { 0x7ec2e1406ULL, 0xb29c78894ULL, 0x60287437eULL, 0x2911e394dULL },
+    { 0x43a7567f1ULL, 0x2d639afd1ULL, 0x8fe6ae5c2ULL, 0x8bf59c6b4ULL },
+    { 0x1a035a136ULL, 0x225acc151ULL, 0x6c85ac058ULL, 0x8a8335a44ULL },
+    { 0x1d87d609dULL, 0xa6eb59740ULL, 0xb906be1b8ULL, 0x02e9ad765ULL },
+    { 0xa6fc42b9fULL, 0xe574f327aULL, 0xf9d423f65ULL, 0x5e4cf2ea7ULL },
+    { 0x6b81b7f76ULL, 0x1ad3f2dd7ULL, 0x6efed81d6ULL, 0xebb4fcb58ULL },
+    { 0x45fe6d81eULL, 0xf1155de4eULL, 0x781b67fa2ULL, 0x727baa88fULL },
+    { 0x35ec2bb87ULL, 0x957cf660eULL, 0xe1dd437acULL, 0x7066f3ea9ULL },
+    { 0x31580495eULL, 0x481de144aULL, 0x7a9201a8cULL, 0x52287b812ULL },
+    { 0x9813222dfULL, 0x4e7a4b064ULL, 0xfb444c819ULL, 0x260d25e72ULL },
+    { 0x9a9f5ae73ULL, 0x6e5a1e3fbULL, 0xce75af959ULL, 0xdfc785a76ULL },
+    { 0xd4e76fb61ULL, 0xbd4f9ea27ULL, 0x86df6e72bULL, 0xe4579f2bdULL },
+    { 0xe55a966aeULL, 0xc0f56bda9ULL, 0x756695aa7ULL, 0x95bd6af03ULL },
+    { 0x4fbbd4dedULL, 0xefa3d9d9bULL, 0xb7b2bddf2ULL, 0xd9b9bc5f7ULL },
+    { 0x799d8598fULL, 0x56bbf1e0aULL, 0xf19a1b99eULL, 0x5078fdd6aULL },
+    { 0x09709ea59ULL, 0x4fc507542ULL, 0x9a5790e90ULL, 0x42ae0a3f2ULL },
+    { 0x0357cdcb8ULL, 0x70a70d6d3ULL, 0x1d3b3eac0ULL, 0xcb6b0e50eULL },
+    { 0xd4b9ba3a5ULL, 0xc5ead692dULL, 0xa5c5d9d2bULL, 0xb496b57a3ULL },
+    { 0x1840a14a8ULL, 0x12ac01085ULL, 0x152850218ULL, 0xa10803548ULL },
+    { 0x765d23a40ULL, 0xd84e22a1eULL, 0x025c4ba6eULL, 0x78544721bULL },
+    { 0xd7d2fa52bULL, 0xe4dc9ddb5ULL, 0xd4a5f4bebULL, 0xadbb93b27ULL },
+    { 0x70837390eULL, 0x305af9906ULL, 0x709cec10eULL, 0x6099f5a0cULL },
+    { 0x36dbdbb29ULL, 0xf4cebf11bULL, 0x94ddbdb6cULL, 0xd88fd732fULL },
+    { 0xee41848b9ULL, 0x86a721873ULL, 0x9d1218277ULL, 0xce184e561ULL },
+    { 0x52c530986ULL, 0x003ed0b16ULL, 0x6190ca34aULL, 0x68d0b7c00ULL },
+    { 0xfc56b7162ULL, 0xdadda8b25ULL, 0x468ed6a3fULL, 0xa4d15bb5bULL },
+    { 0x74a5bd801ULL, 0x958b34b06ULL, 0x801bda52eULL, 0x60d2cd1a9ULL },
+    { 0x958fcd864ULL, 0xb88b5c62bULL, 0x261b3f1a9ULL, 0xd463ad11dULL },
+    { 0xd9b292cd0ULL, 0x4be818de2ULL, 0x0b3494d9bULL, 0x47b1817d2ULL },
+    { 0xa7eb47c1aULL, 0xb157394faULL, 0x583e2d7e5ULL, 0x5f29cea8dULL },
+    { 0x4f015e029ULL, 0xa64305d11ULL, 0x9407a80f2ULL, 0x88ba0c265ULL },
+    { 0x6a240971aULL, 0x1310a7ad0ULL, 0x58e902456ULL, 0x0b5e508c8ULL },
+    { 0xce4431089ULL, 0x962401b34ULL, 0x9108c2273ULL, 0x2cd802469ULL },
+    { 0x31ff1ee9aULL, 0x417f3f7caULL, 0x59778ff8cULL, 0x53efcfe82ULL },
+    { 0x140a0736bULL, 0x9c598b009ULL, 0xd6ce05028ULL, 0x900d19a39ULL },
+    { 0x463b56140ULL, 0xe94388918ULL, 0x0286adc62ULL, 0x18911c297ULL },
+    { 0x3b060cb7eULL, 0x0a19ef653ULL, 0x7ed3060dcULL, 0xca6f79850ULL },
+    { 0xb7c07edeaULL, 0xa87db55b7ULL, 0x57b7e03edULL, 0xedaadbe15ULL },
+    { 0x83a73bc7cULL, 0x19425d7f7ULL, 0x3e3dce5c1ULL, 0xefeba4298ULL },
+    { 0xa9443d7d8ULL, 0x1a25a77e4ULL, 0x1bebc2295ULL, 0x27ee5a458ULL },
+    { 0x593e85280ULL, 0x53a90ae08ULL, 0x014a17c9aULL, 0x1075095caULL },
+    { 0x5bdf09be3ULL, 0x5e3e9ee1bULL, 0xc7d90fbdaULL, 0xd87797c7aULL },
+    { 0x5ac751a81ULL, 0x362e1ab12ULL, 0x8158ae35aULL, 0x48d58746cULL },
+    { 0xacc50eb96ULL, 0x8277f6262ULL, 0x69d70a335ULL, 0x4646fee41ULL },
+    { 0x8c9e9f7cbULL, 0xdef19f3a8ULL, 0xd3ef97931ULL, 0x15cf98f7bULL },
+    { 0x5edf7c9eaULL, 0xea3f9db1fULL, 0x5793efb7aULL, 0xf8db9fc57ULL },
+    { 0xc2f791967ULL, 0x5d96d8b33ULL, 0xe6989ef43ULL, 0xccd1b69baULL },
+    { 0x6880fa8b3ULL, 0x26f034947ULL, 0xcd15f0116ULL, 0xe292c0f64ULL },
+    { 0xa4763db9fULL, 0xd535ef366ULL, 0xf9dbc6e25ULL, 0x66cf7acabULL },
+    { 0xe8889525bULL, 0x1e9133968ULL, 0xda4a91117ULL, 0x169cc8978ULL },
+    { 0x5e890b2a0ULL, 0x926a16819ULL, 0x054d0917aULL, 0x981685649ULL },
+    { 0xa8fc34f06ULL, 0x4315f23aeULL, 0x60f2c3f15ULL, 0x75c4fa8c2ULL },
+    { 0x6650dc9ceULL, 0xe8b5e5912ULL, 0x7393b0a66ULL, 0x489a7ad17ULL },
+    { 0xd9eb70c66ULL, 0x2b1e58dafULL, 0x6630ed79bULL, 0xf5b1a78d4ULL },
+    { 0x06391a1b7ULL, 0xc572c4159ULL, 0xed8589c60ULL, 0x9a8234ea3ULL },
+    { 0x64d5ecdbeULL, 0xe0b7f5ac7ULL, 0x7db37ab26ULL, 0xe35afed07ULL },
+    { 0x50178c623ULL, 0x449b0ea81ULL, 0xc4631e80aULL, 0x81570d922ULL },
+    { 0x80af5b5d8ULL, 0x39629d3e8ULL, 0x1badaf501ULL, 0x17cb9469cULL },
+    { 0xb26ef7bd9ULL, 0x3dedab37eULL, 0x9bdef764dULL, 0x7ecd5b7bcULL },
+    { 0xd2d9290bbULL, 0x543e1587dULL, 0xdd0949b4bULL, 0xbe1a87c2aULL },
+    { 0x8ee688f61ULL, 0x8f849e2b3ULL, 0x86f116771ULL, 0xcd47921f1ULL },
+    { 0x90857eb35ULL, 0x244bd6367ULL, 0xacd7ea109ULL, 0xe6c6bd224ULL },
+    { 0xd6f4b933eULL, 0xd19cd7b75ULL, 0x7cc9d2f6bULL, 0xaedeb398bULL },
+    { 0x44119aafcULL, 0xc8e247943ULL, 0x3f5598822ULL, 0xc29e24713ULL },
+    { 0x30b15a5d2ULL, 0x697ab41c0ULL, 0x4ba5a8d0cULL, 0x0382d5e96ULL },
+    { 0x4239fe766ULL, 0x69d3c699dULL, 0x66e7f9c42ULL, 0xb9963cb96ULL },
+    { 0x6cdfe48ccULL, 0xeaa779a0eULL, 0x33127fb36ULL, 0x7059ee557ULL },
+    { 0x6e9ffa130ULL, 0xe2c2bcb5dULL, 0x0c85ff976ULL, 0xbad3d4347ULL },
+    { 0xfbb4cddb9ULL, 0x77a9b5ef3ULL, 0x9dbb32ddfULL, 0xcf7ad95eeULL },
+    { 0x6a5e360bcULL, 0x426569b5dULL, 0x3d06c7a56ULL, 0xbad96a642ULL },
+    { 0xbb806e035ULL, 0x264974475ULL, 0xac07601ddULL, 0xae22e9264ULL },
+    { 0x97ebc5bfaULL, 0xb9bf9b47bULL, 0x5fda3d7e9ULL, 0xde2d9fd9dULL },
+    { 0x0f75e2502ULL, 0xe3d680694ULL, 0x40a47aef0ULL, 0x296016bc7ULL },
+    { 0x0b31499c8ULL, 0x7b2285412ULL, 0x139928cd0ULL, 0x482a144deULL },
+    { 0xd7aed5c18ULL, 0xb18919ffaULL, 0x183ab75ebULL, 0x5ff98918dULL },
+    { 0xd2f8b6bb9ULL, 0x45ed9397fULL, 0x9dd6d1f4bULL, 0xfe9c9b7a2ULL },
+    { 0x2237f52a9ULL, 0x75a32b315ULL, 0x954afec44ULL, 0xa8cd4c5aeULL },
+    { 0x447fca994ULL, 0xe1e6cca4aULL, 0x29953fe22ULL, 0x525336787ULL },
+    { 0x8d927e29fULL, 0xe6715f564ULL, 0xf947e49b1ULL, 0x26afa8e67ULL },
+    { 0x0d36642e5ULL, 0xef214a605ULL, 0xa74266cb0ULL, 0xa065284f7ULL },
+    { 0xd5bfedddcULL, 0xf9abddeeeULL, 0x3bbb7fdabULL, 0x777bbd59fULL },
+    { 0x8bc6d4e51ULL, 0x2e851a7f2ULL, 0x8a72b63d1ULL, 0x4fe58a174ULL },
+    { 0xddf47c6e1ULL, 0xef2d16fa5ULL, 0x8763e2fbbULL, 0xa5f68b4f7ULL },
+    { 0x459f2d931ULL, 0xd4039ce4fULL, 0x8c9b4f9a2ULL, 0xf2739c02bULL },
+    { 0x8615afac5ULL, 0xdce346236ULL, 0xa35f5a861ULL, 0x6c462c73bULL },
+    { 0x34ae2a799ULL, 0x8568bf2ccULL, 0x99e54752cULL, 0x334fd16a1ULL },
+    { 0xf6871dbf4ULL, 0x982bfeb73ULL, 0x2fdb8e16fULL, 0xced7fd419ULL },
+    { 0x16b7c10b4ULL, 0xf1aa58251ULL, 0x2d083ed68ULL, 0x8a41a558fULL },
+    { 0x7a36cba05ULL, 0x77c86ea12ULL, 0xa05d36c5eULL, 0x4857613eeULL },
+    { 0x7f421062aULL, 0x821c2bd91ULL, 0x5460842feULL, 0x89bd43841ULL },
+    { 0x677075ce8ULL, 0xf92521d97ULL, 0x173ae0ee6ULL, 0xe9b84a49fULL },
+    { 0xa7463cd1cULL, 0x8005ed7f6ULL, 0x38b3c62e5ULL, 0x6feb7a001ULL },
+    { 0x9975836e2ULL, 0x5bfe026a1ULL, 0x476c1ae99ULL, 0x856407fdaULL },
+    { 0x5191d3159ULL, 0x7cca91d40ULL, 0x9a8cb898aULL, 0x02b89533eULL },
+    { 0x354c02b98ULL, 0x806ca364aULL, 0x19d4032acULL, 0x526c53601ULL },
+    { 0xd01b80395ULL, 0x44aaca868ULL, 0xa9c01d80bULL, 0x161535522ULL },
+    { 0x7b27abe53ULL, 0x1fda2eed6ULL, 0xca7d5e4deULL, 0x6b7745bf8ULL },
+    { 0xa88caba94ULL, 0x12e07626eULL, 0x295d53115ULL, 0x7646e0748ULL },
+    { 0x8a702e64dULL, 0x4f45470b4ULL, 0xb26740e51ULL, 0x2d0e2a2f2ULL },
+    { 0x1190d84fdULL, 0x6ca8555c1ULL, 0xbf21b0988ULL, 0x83aaa1536ULL },
+    { 0xa8389ce68ULL, 0x4b81271abULL, 0x167391c15ULL, 0xd58e481d2ULL },
+    { 0x63acf508bULL, 0x35b131f1cULL, 0xd10af35c6ULL, 0x38f8c8dacULL },
+    { 0x99e0ae29bULL, 0x07fd17464ULL, 0xd94750799ULL, 0x262e8bfe0ULL },
+    { 0xe88b619d3ULL, 0x3e32b886eULL, 0xcb986d117ULL, 0x7611d4c7cULL },
+    { 0x11afbbb80ULL, 0x11ea9e70eULL, 0x01dddf588ULL, 0x70e795788ULL },
+    { 0x62fa1b78eULL, 0x5174ff998ULL, 0x71ed85f46ULL, 0x199ff2e8aULL },
+    { 0xf1abec2a5ULL, 0x25ab7ec2dULL, 0xa5437d58fULL, 0xb437ed5a4ULL },
+    { 0xa478b9402ULL, 0xd194241acULL, 0x4029d1e25ULL, 0x35824298bULL },
+    { 0x4e93701a3ULL, 0xe63298915ULL, 0xc580ec972ULL, 0xa89194c67ULL },
+    { 0x5d1fbe216ULL, 0xc2db4ef4cULL, 0x6847df8baULL, 0x32f72db43ULL },
+    { 0xde99b2947ULL, 0xcedad093eULL, 0xe294d997bULL, 0x7c90b5b73ULL },
+    { 0x7708d1747ULL, 0xbc98e2d98ULL, 0xe2e8b10eeULL, 0x19b47193dULL },
+    { 0xbbc08c9a8ULL, 0x02adb5433ULL, 0x1593103ddULL, 0xcc2adb540ULL },
+    { 0xea1c08444ULL, 0x4a0064ab8ULL, 0x222103857ULL, 0x1d5260052ULL },
+    { 0xb89aac078ULL, 0x4a893d06dULL, 0x1e035591dULL, 0xb60bc9152ULL },
+    { 0x974f793adULL, 0xb42ecf73dULL, 0xb5c9ef2e9ULL, 0xbcef3742dULL },
+    { 0x7c37a81f9ULL, 0xcfaaada45ULL, 0x9f815ec3eULL, 0xa25b555f3ULL },
+    { 0x840545b8bULL, 0xb43383222ULL, 0xd1da2a021ULL, 0x444c1cc2dULL },
+    { 0x8988e8f2aULL, 0x2290974afULL, 0x54f171191ULL, 0xf52e90944ULL },
+    { 0x7a052f8a7ULL, 0x167b64a17ULL, 0xe51f4a05eULL, 0xe8526de68ULL },
+    { 0xc06be7a83ULL, 0x35f70a82eULL, 0xc15e7d603ULL, 0x74150efacULL },
+    { 0xe1d68fe5dULL, 0x5cc57fee2ULL, 0xba7f16b87ULL, 0x477fea33aULL },
+    { 0x87c15ed01ULL, 0xa447945b2ULL, 0x80b7a83e1ULL, 0x4da29e225ULL },
+    { 0xb18d4704eULL, 0x385b71628ULL, 0x720e2b18dULL, 0x1468eda1cULL },
+    { 0xb9603037aULL, 0x0b1ca3565ULL, 0x5ec0c069dULL, 0xa6ac538d0ULL },
+    { 0x3916f9f25ULL, 0x7688ee787ULL, 0xa4f9f689cULL, 0xe1e77116eULL },
+    { 0x5bf538e1aULL, 0x431e17fd6ULL, 0x5871cafdaULL, 0x6bfe878c2ULL },
+    { 0x45028c893ULL, 0x84b10cc42ULL, 0xc913140a2ULL, 0x423308d21ULL },
+    { 0x8bf74f15eULL, 0x7b57dd670ULL, 0x7a8f2efd1ULL, 0x0e6bbeadeULL },
+    { 0x34a9260eeULL, 0x897b7100dULL, 0x77064952cULL, 0xb008ede91ULL },
+    { 0xfea1b4572ULL, 0x8b9bb09f5ULL, 0x4ea2d857fULL, 0xaf90dd9d1ULL },
+    { 0xaaac4a212ULL, 0x235036278ULL, 0x484523555ULL, 0x1e46c0ac4ULL },
+    { 0xc7958e92aULL, 0xc0d395e33ULL, 0x54971a9e3ULL, 0xcc7a9cb03ULL },
+    { 0x4d72960d7ULL, 0xcff548d40ULL, 0xeb0694eb2ULL, 0x02b12aff3ULL },
+    { 0xc6713c8adULL, 0xc52745937ULL, 0xb513c8e63ULL, 0xec9a2e4a3ULL },
+    { 0x1adb0893aULL, 0x421e9d05bULL, 0x5c910db58ULL, 0xda0b97842ULL },
+    { 0xebb25e153ULL, 0x6f51bcd70ULL, 0xca87a4dd7ULL, 0x0eb3d8af6ULL },
+    { 0x1a8c6531dULL, 0x3609d325cULL, 0xb8ca63158ULL, 0x3a4cb906cULL },
+    { 0xb8c290d2dULL, 0x068cf91a3ULL, 0xb4b09431dULL, 0xc589f3160ULL },
+    { 0xed0ab93bcULL, 0x92a0efd6dULL, 0x3dc9d50b7ULL, 0xb6bf70549ULL },
+    { 0x3540feabeULL, 0xa0fd67547ULL, 0x7d57f02acULL, 0xe2ae6bf05ULL },
+    { 0x4d8da9a3aULL, 0x929217e4fULL, 0x5c595b1b2ULL, 0xf27e84949ULL },
+    { 0x196f53079ULL, 0x3f4e09749ULL, 0x9e0caf698ULL, 0x92e9072fcULL },
+    { 0xaaa12d6c8ULL, 0x1b23370b4ULL, 0x136b48555ULL, 0x2d0ecc4d8ULL },
+    { 0xd433dbe16ULL, 0xf1da4e9e2ULL, 0x687dbcc2bULL, 0x479725b8fULL },
+    { 0x294475d2aULL, 0x3215a1787ULL, 0x54bae2294ULL, 0xe1e85a84cULL },
+    { 0xdebdd9916ULL, 0xf39ad4b7aULL, 0x6899bbd7bULL, 0x5ed2b59cfULL },
+    { 0x7b62f1081ULL, 0x37ac28d14ULL, 0x8108f46deULL, 0x28b1435ecULL },
+    { 0x10f317db8ULL, 0x516f991c3ULL, 0x1dbe8cf08ULL, 0xc3899f68aULL },
+    { 0xb87587405ULL, 0x57cf602a0ULL, 0xa02e1ae1dULL, 0x05406f3eaULL },
+    { 0x9ab64faf0ULL, 0x7b691e273ULL, 0x0f5f26d59ULL, 0xce47896deULL },
+    { 0xd404f3a01ULL, 0xb4c802b26ULL, 0x805cf202bULL, 0x64d40132dULL },
+    { 0xe16a7b7f5ULL, 0x3d64eededULL, 0xafede5687ULL, 0xb7b7726bcULL },
+    { 0x0cdabc1a8ULL, 0xc2a59d10dULL, 0x1583d5b30ULL, 0xb08b9a543ULL },
+    { 0x0460b795bULL, 0x9dd581146ULL, 0xda9ed0620ULL, 0x62881abb9ULL },
+    { 0x1ccec48f3ULL, 0xaebd1824bULL, 0xcf1237338ULL, 0xd2418bd75ULL },
+    { 0x23dee5a5cULL, 0x78857b65eULL, 0x3a5a77bc4ULL, 0x7a6dea11eULL },
+    { 0x6305ffe85ULL, 0x34e366f96ULL, 0xa17ffa0c6ULL, 0x69f66c72cULL },
+    { 0xe1c327b94ULL, 0x1067fac66ULL, 0x29de4c387ULL, 0x6635fe608ULL },
+    { 0x8c2ba41e0ULL, 0x8ba38802dULL, 0x07825d431ULL, 0xb4011c5d1ULL },
+    { 0x1cd9deb40ULL, 0xeacf9610aULL, 0x02d7b9b38ULL, 0x50869f357ULL },
+    { 0x5564f0b71ULL, 0xad8c82f47ULL, 0x8ed0f26aaULL, 0xe2f4131b5ULL },
+    { 0xb0c72a76aULL, 0x085ebf2a5ULL, 0x56e54e30dULL, 0xa54fd7a10ULL },
+    { 0xe70d50469ULL, 0xac0221fb9ULL, 0x9620ab0e7ULL, 0x9df844035ULL },
+    { 0x32957c7e3ULL, 0x6c3bb6395ULL, 0xc7e3ea94cULL, 0xa9c6ddc36ULL },
+    { 0x47825114bULL, 0xbc1099d10ULL, 0xd288a41e2ULL, 0x08b99083dULL },
+    { 0x78f21116fULL, 0x5f1cf9901ULL, 0xf68884f1eULL, 0x8099f38faULL },
+    { 0x90fb4077aULL, 0x691e9b0e9ULL, 0x5ee02df09ULL, 0x970d97896ULL },
+    { 0xa26fdb403ULL, 0x35d62c3b8ULL, 0xc02dbf645ULL, 0x1dc346bacULL },
+    { 0x242432357ULL, 0x8d50e2344ULL, 0xeac4c2424ULL, 0x22c470ab1ULL },
+    { 0x878ab4d53ULL, 0x8c91985feULL, 0xcab2d51e1ULL, 0x7fa198931ULL },
+    { 0xeea9c2ec0ULL, 0xabe2328baULL, 0x037439577ULL, 0x5d14c47d5ULL },
+    { 0xc25b5186aULL, 0x78160993bULL, 0x5618ada43ULL, 0xdc990681eULL },
+    { 0x9a1adc164ULL, 0x6a89cc139ULL, 0x2683b5859ULL, 0x9c8339156ULL },
+    { 0x7383e0651ULL, 0x2c8a3acd4ULL, 0x8a607c1ceULL, 0x2b35c5134ULL },
+    { 0x1989bfa9eULL, 0x12fb5754eULL, 0x795fd9198ULL, 0x72aeadf48ULL },
+    { 0x1d88db7cdULL, 0xbee8d7588ULL, 0xb3edb11b8ULL, 0x11aeb177dULL },
+    { 0x3a39c9621ULL, 0x778a26099ULL, 0x846939c5cULL, 0x9906451eeULL },
+    { 0xc45f6f8d1ULL, 0xfc670ca6eULL, 0x8b1f6fa23ULL, 0x76530e63fULL },
+    { 0x7fd4f458dULL, 0xe6adf1f94ULL, 0xb1a2f2bfeULL, 0x29f8fb567ULL },
+    { 0xeb5e05c6dULL, 0x5e0569ebbULL, 0xb63a07ad7ULL, 0xdd796a07aULL },
+    { 0x00de571faULL, 0x787599349ULL, 0x5f8ea7b00ULL, 0x92c99ae1eULL },
+    { 0x30b639772ULL, 0x5918be3c5ULL, 0x4ee9c6d0cULL, 0xa3c7d189aULL },
+    { 0xd9114f099ULL, 0x766b05c60ULL, 0x990f2889bULL, 0x063a0d66eULL },
+    { 0x0b8a4efedULL, 0x2e61df49bULL, 0xb7f7251d0ULL, 0xd92fb8674ULL },
+    { 0x96c894c35ULL, 0x848d501fbULL, 0xac3291369ULL, 0xdf80ab121ULL },
+    { 0xde56cf1b9ULL, 0xf6ed8da71ULL, 0x9d8f36a7bULL, 0x8e5b1b76fULL },
+    { 0xe9142ceabULL, 0x463127ea7ULL, 0xd57342897ULL, 0xe57e48c62ULL },
+    { 0xa6c1953f7ULL, 0x9cb7f2171ULL, 0xefca98365ULL, 0x8e84fed39ULL },
+    { 0x70f96335bULL, 0x7d5eb384cULL, 0xdacc69f0eULL, 0x321cd7abeULL },
+    { 0x3cd270e5cULL, 0xea0c7b1c6ULL, 0x3a70e4b3cULL, 0x638de3057ULL },
+    { 0x432c3a978ULL, 0x094085f5fULL, 0x1e95c34c2ULL, 0xfafa10290ULL },
+    { 0x6036d5532ULL, 0x7191a8bc1ULL, 0x4caab6c06ULL, 0x83d15898eULL },
+    { 0x8776f8c4eULL, 0xe9944d7b6ULL, 0x7231f6ee1ULL, 0x6deb22997ULL },
+    { 0x2055909ecULL, 0x48a6e1303ULL, 0x37909aa04ULL, 0xc0c876512ULL },
+    { 0x339593120ULL, 0x50cab0711ULL, 0x048c9a9ccULL, 0x88e0d530aULL },
+    { 0x3d810b39aULL, 0x927ab7440ULL, 0x59cd081bcULL, 0x022ed5e49ULL },
+    { 0x27431ebb2ULL, 0x8077ae553ULL, 0x4dd78c2e4ULL, 0xcaa75ee01ULL },
+    { 0xf085b9e92ULL, 0x10ba36be6ULL, 0x4979da10fULL, 0x67d6c5d08ULL },
+    { 0xa30b92e20ULL, 0x00c22a5bbULL, 0x04749d0c5ULL, 0xdda544300ULL },
+    { 0xdc1425e85ULL, 0xd62942aa6ULL, 0xa17a4283bULL, 0x65542946bULL },
+    { 0xb4ab87e7bULL, 0x9ddb3b0ebULL, 0xde7e1d52dULL, 0xd70dcdbb9ULL },
+    { 0x8fb73e270ULL, 0xcb431e775ULL, 0x0e47cedf1ULL, 0xaee78c2d3ULL },
+    { 0xffd3125f2ULL, 0xca7eb8df1ULL, 0x4fa48cbffULL, 0x8fb1d7e53ULL },
+    { 0x054c95a2aULL, 0x90950370bULL, 0x545a932a0ULL, 0xd0ec0a909ULL },
+    { 0x1d79bd436ULL, 0xd39f445cdULL, 0x6c2bd9eb8ULL, 0xb3a22f9cbULL },
+    { 0x31dcbd9bbULL, 0x54bdb574fULL, 0xdd9bd3b8cULL, 0xf2eadbd2aULL },
+    { 0x5d834ccc2ULL, 0xaa3b1cc82ULL, 0x43332c1baULL, 0x41338dc55ULL },
+    { 0xb86e5f80aULL, 0x335d2d32aULL, 0x501fa761dULL, 0x54cb4baccULL },
+    { 0xddb50237eULL, 0xcb5ad3e61ULL, 0x7ec40adbbULL, 0x867cb5ad3ULL },
+    { 0xccd4f9202ULL, 0xf29416b24ULL, 0x4049f2b33ULL, 0x24d68294fULL },
+    { 0xdeaf147b3ULL, 0x873b9abf9ULL, 0xcde28f57bULL, 0x9fd59dce1ULL },
+    { 0x9d201316fULL, 0x9f58c1521ULL, 0xf68c804b9ULL, 0x84a831af9ULL },
+    { 0x7cbdf0af1ULL, 0xefaa32b4fULL, 0x8f50fbd3eULL, 0xf2d4c55f7ULL },
+    { 0x22c3d872aULL, 0x2096bf191ULL, 0x54e1bc344ULL, 0x898fd6904ULL },
+    { 0x45c764d6cULL, 0xa807d9e87ULL, 0x36b26e3a2ULL, 0xe179be015ULL },
+    { 0x8d935a740ULL, 0xea429e5a0ULL, 0x02e5ac9b1ULL, 0x05a794257ULL },
+    { 0xb1a1ec108ULL, 0x218bb5424ULL, 0x10837858dULL, 0x242add184ULL },
+    { 0xd07935336ULL, 0x511fc296dULL, 0x6ccac9e0bULL, 0xb6943f88aULL },
+    { 0x4a515da46ULL, 0x7a1746912ULL, 0x625ba8a52ULL, 0x48962e85eULL },
+    { 0x3a2d13235ULL, 0x174a62359ULL, 0xac4c8b45cULL, 0x9ac4652e8ULL },
+    { 0xec41e6161ULL, 0xaec7a0825ULL, 0x868678237ULL, 0xa4105e375ULL },
+    { 0x7fac4e182ULL, 0xa379b4e18ULL, 0x4187235feULL, 0x1872d9ec5ULL },
+    { 0x73c6646bdULL, 0x242d7bed5ULL, 0xbd62663ceULL, 0xab7deb424ULL },
+    { 0x4dfb4c157ULL, 0xef17dcc48ULL, 0xea832dfb2ULL, 0x1233be8f7ULL },
+    { 0xe50f4e5abULL, 0xa473adea9ULL, 0xd5a72f0a7ULL, 0x957b5ce25ULL },
+    { 0x7aa139a60ULL, 0x1b0a36917ULL, 0x0659c855eULL, 0xe896c50d8ULL },
+    { 0x127afe57dULL, 0x6dcdcd1ddULL, 0xbea7f5e48ULL, 0xbb8b3b3b6ULL },
+    { 0xa8e66a9ffULL, 0x2f74fd267ULL, 0xff9566715ULL, 0xe64bf2ef4ULL },
+    { 0x599b60bd8ULL, 0x6a2a9bc4eULL, 0x1bd06d99aULL, 0x723d95456ULL },
+    { 0x31ea36669ULL, 0x0d4d3b58dULL, 0x9666c578cULL, 0xb1adcb2b0ULL },
+    { 0x37cbe4a63ULL, 0xac9f3a41fULL, 0xc6527d3ecULL, 0xf825cf935ULL },
+    { 0x863cf82adULL, 0xe5a04733dULL, 0xb541f3c61ULL, 0xbcce205a7ULL },
+    { 0x0eb5951e6ULL, 0xdbb3d0311ULL, 0x678a9ad70ULL, 0x88c0bcddbULL },
+    { 0xc5fb5576cULL, 0xf907dbda9ULL, 0x36eaadfa3ULL, 0x95bdbe09fULL },
+    { 0x7b80d2ef5ULL, 0x2ee872dd3ULL, 0xaf74b01deULL, 0xcbb4e1774ULL },
+    { 0xc3b3c332aULL, 0x71d29bc31ULL, 0x54cc3cdc3ULL, 0x8c3d94b8eULL },
+    { 0x673e1a74bULL, 0xcd50aff98ULL, 0xd2e587ce6ULL, 0x19ff50ab3ULL },
+    { 0x92c9d2961ULL, 0x2cce9013bULL, 0x8694b9349ULL, 0xdc8097334ULL },
+    { 0x7f19190cbULL, 0xde3a25d18ULL, 0xd309898feULL, 0x18ba45c7bULL },
+    { 0x9070a4c3aULL, 0x419d010e7ULL, 0x5c3250e09ULL, 0xe7080b982ULL },
+    { 0x714353b21ULL, 0x344eaad03ULL, 0x84dcac28eULL, 0xc0b55722cULL },
+    { 0xfb4bb54efULL, 0x1ebf69dbdULL, 0xf72add2dfULL, 0xbdb96fd78ULL },
+    { 0xc58168098ULL, 0xa02215c64ULL, 0x1901681a3ULL, 0x263a84405ULL },
+    { 0x2bf156790ULL, 0x6367b25d0ULL, 0x09e6a8fd4ULL, 0x0ba4de6c6ULL },
+    { 0x8b3286f48ULL, 0x4bc18b4b2ULL, 0x12f614cd1ULL, 0x4d2d183d2ULL },
+    { 0x235801eb6ULL, 0x5034624dbULL, 0x6d7801ac4ULL, 0xdb2462c0aULL },
+    { 0x2a538f328ULL, 0x52c7af011ULL, 0x14cf1ca54ULL, 0x880f5e34aULL },
+    { 0x106d7e548ULL, 0x294f8538cULL, 0x12a7eb608ULL, 0x31ca1f294ULL },
+    { 0x46fdc5e7aULL, 0xf99713adbULL, 0x5e7a3bf62ULL, 0xdb5c8e99fULL },
+    { 0x456a0a5d0ULL, 0x89648ccc8ULL, 0x0ba5056a2ULL, 0x133312691ULL },
+    { 0xd932277daULL, 0x5b798bce4ULL, 0x5bee44c9bULL, 0x273d19edaULL },
+    { 0x613beb981ULL, 0x75e2acc0eULL, 0x819d7dc86ULL, 0x7033547aeULL },
+    { 0xbf13b5460ULL, 0xda8b285b5ULL, 0x062adc8fdULL, 0xada14d15bULL },
+    { 0x82baa8cbdULL, 0x45a05d0ffULL, 0xbd3155d41ULL, 0xff0ba05a2ULL },
+    { 0x51cd631b3ULL, 0x347e90e4dULL, 0xcd8c6b38aULL, 0xb27097e2cULL },
+    { 0x70abf04c7ULL, 0x2dba7898cULL, 0xe320fd50eULL, 0x3191e5db4ULL },
+    { 0xaa66b9187ULL, 0x17b4ec334ULL, 0xe189d6655ULL, 0x2cc372de8ULL },
+    { 0x8c143c616ULL, 0xc211463e4ULL, 0x6863c2831ULL, 0x27c628843ULL },
+    { 0xf1a09d4b0ULL, 0x11a934de1ULL, 0x0d2b9058fULL, 0x87b2c9588ULL },
+    { 0x5f1b5fdc4ULL, 0xfa6bccd9aULL, 0x23bfad8faULL, 0x59b33d65fULL },
+    { 0x6848bd998ULL, 0x12a5a594eULL, 0x199bd1216ULL, 0x729a5a548ULL },
+    { 0xebf51c86aULL, 0x4b1735f33ULL, 0x56138afd7ULL, 0xccface8d2ULL },
+    { 0xc95c1735fULL, 0x5e55c3f68ULL, 0xface83a93ULL, 0x16fc3aa7aULL },
+    { 0xa4e5b2aa9ULL, 0x85e633327ULL, 0x9554da725ULL, 0xe4ccc67a1ULL },
+    { 0x89bb286d9ULL, 0x4f221f4ecULL, 0x9b614dd91ULL, 0x372f844f2ULL },
+    { 0xfc53d3519ULL, 0xf6cea99e0ULL, 0x98acbca3fULL, 0x07995736fULL },
+    { 0x84fab0fabULL, 0xc5b49b1afULL, 0xd5f0d5f21ULL, 0xf58d92da3ULL },
+    { 0x879c09ad7ULL, 0xdc305667aULL, 0xeb59039e1ULL, 0x5e66a0c3bULL },
+    { 0x541378b8aULL, 0xe03a8f906ULL, 0x51d1ec82aULL, 0x609f15c07ULL },
+    { 0x5dcf766c5ULL, 0xae6f5af8cULL, 0xa366ef3baULL, 0x31f5af675ULL },
+    { 0x0f8070b58ULL, 0xaa0093556ULL, 0x1ad0e01f0ULL, 0x6aac90055ULL },
+    { 0xd0b51c0feULL, 0x493b55b61ULL, 0x7f038ad0bULL, 0x86daadc92ULL },
+    { 0x84caa077cULL, 0x8884db0edULL, 0x3ee055321ULL, 0xb70db2111ULL },
+    { 0xedd3b4fdcULL, 0xcaa7fbde6ULL, 0x3bf2dcbb7ULL, 0x67bdfe553ULL },
+    { 0x36a197084ULL, 0x91eb70110ULL, 0x210e9856cULL, 0x0880ed789ULL },
+    { 0x8c4157f27ULL, 0xb657c21a3ULL, 0xe4fea8231ULL, 0xc5843ea6dULL },
+    { 0xec922291dULL, 0xc640f9866ULL, 0xb89444937ULL, 0x6619f0263ULL },
+    { 0x2c334a11aULL, 0xe352ad040ULL, 0x58852cc34ULL, 0x020b54ac7ULL },
+    { 0x957794778ULL, 0xc98f8b7e1ULL, 0x1ee29eea9ULL, 0x87ed1f193ULL },
+    { 0x4f9e3989dULL, 0xd6205df5eULL, 0xb919c79f2ULL, 0x7afba046bULL },
+    { 0xb5cb223bbULL, 0x847ebb46dULL, 0xddc44d3adULL, 0xb62dd7e21ULL },
+    { 0xeee2bd3bbULL, 0x97b5bf975ULL, 0xddcbd4777ULL, 0xae9fdade9ULL },
+    { 0x85d419c3cULL, 0xd004557e3ULL, 0x3c3982ba1ULL, 0xc7eaa200bULL },
+    { 0xba23d713bULL, 0x37dba9171ULL, 0xdc8ebc45dULL, 0x8e895dbecULL },
+    { 0x8d48ee9d1ULL, 0xaee58446eULL, 0x8b97712b1ULL, 0x76221a775ULL },
+    { 0x7845740e9ULL, 0x2e2f21b05ULL, 0x9702ea21eULL, 0xa0d84f474ULL },
+    { 0x64e7ea2f8ULL, 0xa9e63fa45ULL, 0x1f457e726ULL, 0xa25fc6795ULL },
+    { 0x6476f63e4ULL, 0xe9e5eab05ULL, 0x27c6f6e26ULL, 0xa0d57a797ULL },
+    { 0x0eee9e950ULL, 0x8bc59c35aULL, 0x0a9797770ULL, 0x5ac39a3d1ULL },
+    { 0xdcafa86ebULL, 0x8fba1faadULL, 0xd7615f53bULL, 0xb55f85df1ULL },
+    { 0x876d38f2eULL, 0x8116c77bfULL, 0x74f1cb6e1ULL, 0xfdee36881ULL },
+    { 0x3beb274c5ULL, 0x1f6f7849cULL, 0xa32e4d7dcULL, 0x3921ef6f8ULL },
+    { 0xb8bf59174ULL, 0x7b0afc369ULL, 0x2e89afd1dULL, 0x96c3f50deULL },
+    { 0xab20ec0d0ULL, 0x2ba124474ULL, 0x0b03704d5ULL, 0x2e22485d4ULL },
+    { 0x0d551a533ULL, 0xc656847c1ULL, 0xcca58aab0ULL, 0x83e216a63ULL },
+    { 0xa4492ea78ULL, 0x88472706fULL, 0x1e5749225ULL, 0xf60e4e211ULL },
+    { 0x5d6c5c676ULL, 0xab1d46fc9ULL, 0x6e63a36baULL, 0x93f62b8d5ULL },
+    { 0x99049946aULL, 0x1a98057a1ULL, 0x562992099ULL, 0x85ea01958ULL },
+    { 0x0a9d80e26ULL, 0x42925229bULL, 0x64701b950ULL, 0xd944a4942ULL },
+    { 0x6986b729fULL, 0x16f17bf44ULL, 0xf94ed6196ULL, 0x22fde8f68ULL },
+    { 0x8fad822cdULL, 0x8fe253638ULL, 0xb3441b5f1ULL, 0x1c6ca47f1ULL },
+    { 0xe2435f263ULL, 0x3c572e931ULL, 0xc64fac247ULL, 0x8c974ea3cULL },
+    { 0xd19bd74ebULL, 0x7cfb19da9ULL, 0xd72ebd98bULL, 0x95b98df3eULL },
+    { 0xc4da1985fULL, 0xdc145d96aULL, 0xfa1985b23ULL, 0x569ba283bULL },
+    { 0x1ac11efb4ULL, 0x026fd61d3ULL, 0x2df788358ULL, 0xcb86bf640ULL },
+    { 0x112d1c111ULL, 0x050b84748ULL, 0x88838b488ULL, 0x12e21d0a0ULL },
+    { 0x2d4c08906ULL, 0x8214e460aULL, 0x6091032b4ULL, 0x506272841ULL },
+    { 0x6ceb4ffa4ULL, 0xb367fe88bULL, 0x25ff2d736ULL, 0xd117fe6cdULL },
+    { 0xabcbc673bULL, 0x26d7bb4f9ULL, 0xdce63d3d5ULL, 0x9f2ddeb64ULL },
+    { 0x2820e9addULL, 0x3fa067046ULL, 0xbb5970414ULL, 0x620e605fcULL },
+    { 0x7ffad1b22ULL, 0xf39cbad1bULL, 0x44d8b5ffeULL, 0xd8b5d39cfULL },
+    { 0x1b666a587ULL, 0x277ccc694ULL, 0xe1a5666d8ULL, 0x296333ee4ULL },
+    { 0xa489482c7ULL, 0xac3276028ULL, 0xe34129125ULL, 0x1406e4c35ULL },
+    { 0x8d2a1c470ULL, 0x8b010c5e9ULL, 0x0e23854b1ULL, 0x97a3080d1ULL },
+    { 0x7db654d80ULL, 0xe329b8f82ULL, 0x01b2a6dbeULL, 0x41f1d94c7ULL },
+    { 0xb3de0a88bULL, 0x447c3d63aULL, 0xd11507bcdULL, 0x5c6bc3e22ULL },
+    { 0xd678ca221ULL, 0xe5cc06839ULL, 0x844531e6bULL, 0x9c16033a7ULL },
+    { 0x88615261bULL, 0x2756031e0ULL, 0xd864a8611ULL, 0x078c06ae4ULL },
+    { 0x00ee5a547ULL, 0x2d54dc388ULL, 0xe2a5a7700ULL, 0x11c3b2ab4ULL },
+    { 0x54691e8b4ULL, 0x816f4494bULL, 0x2d178962aULL, 0xd2922f681ULL },
+    { 0x80fe0d6a8ULL, 0x51251f2a9ULL, 0x156b07f01ULL, 0x954f8a48aULL },
+    { 0xc37f9ad12ULL, 0x41d68cffaULL, 0x48b59fec3ULL, 0x5ff316b82ULL },
+    { 0x39eb9bcbcULL, 0x13ee7d5cbULL, 0x3d3d9d79cULL, 0xd3abe77c8ULL },
+    { 0x9ccdf6218ULL, 0xa2cf1336cULL, 0x1846fb339ULL, 0x36cc8f345ULL },
+    { 0x53c0b8fbbULL, 0x04bc97dd7ULL, 0xddf1d03caULL, 0xebbe93d20ULL },
+    { 0x9f5d51990ULL, 0xf22e8077aULL, 0x0998abaf9ULL, 0x5ee01744fULL },
+    { 0xd0986eb93ULL, 0x64799686eULL, 0xc9d76190bULL, 0x761699e26ULL },
+    { 0x15852ace6ULL, 0x887a54687ULL, 0x67354a1a8ULL, 0xe162a5e11ULL },
+    { 0x90d479133ULL, 0x741c94365ULL, 0xcc89e2b09ULL, 0xa6c29382eULL },
+    { 0x2c16accacULL, 0xc2a16d287ULL, 0x353356834ULL, 0xe14b68543ULL },
+    { 0x70e2e9b5eULL, 0x399cff846ULL, 0x7ad97470eULL, 0x621ff399cULL },
+    { 0x24a06ab2fULL, 0xa550f7007ULL, 0xf4d560524ULL, 0xe00ef0aa5ULL },
+    { 0x7201ed2caULL, 0x38bb27814ULL, 0x534b7804eULL, 0x281e4dd1cULL },
+    { 0x4c6309428ULL, 0x93060d881ULL, 0x14290c632ULL, 0x811b060c9ULL },
+    { 0x06b9cbe6dULL, 0xfdc25709bULL, 0xb67d39d60ULL, 0xd90ea43bfULL },
+    { 0xd7f668dacULL, 0xe12cddeb7ULL, 0x35b166febULL, 0xed7bb3487ULL },
+    { 0x816df6711ULL, 0x25c7827ecULL, 0x88e6fb681ULL, 0x37e41e3a4ULL },
+    { 0x587541f05ULL, 0x770ec2a82ULL, 0xa0f82ae1aULL, 0x4154370eeULL },
+    { 0x4a7306210ULL, 0x43470a850ULL, 0x08460ce52ULL, 0x0a150e2c2ULL },
+    { 0x4809560d1ULL, 0x2e6300948ULL, 0x8b06a9012ULL, 0x12900c674ULL },
+    { 0x3b9948f5bULL, 0x6e1ab74daULL, 0xdaf1299dcULL, 0x5b2ed5876ULL },
+    { 0x3696d5946ULL, 0xf899f8312ULL, 0x629ab696cULL, 0x48c1f991fULL },
+    { 0x5122dc88cULL, 0x21a94dd02ULL, 0x3113b448aULL, 0x40bb29584ULL },
+    { 0xa8453adb0ULL, 0x0266a43e7ULL, 0x0db5ca215ULL, 0xe7c256640ULL },
+    { 0xb478d007cULL, 0xe98c61169ULL, 0x3e00b1e2dULL, 0x968863197ULL },
+    { 0xd5afe15a1ULL, 0xb5aa98eadULL, 0x85a87f5abULL, 0xb571955adULL },
+    { 0x04ffa99cdULL, 0xdda6dd20eULL, 0xb3995ff20ULL, 0x704bb65bbULL },
+    { 0xb2aa866a1ULL, 0x05e93a0b9ULL, 0x85661554dULL, 0x9d05c97a0ULL },
+    { 0x21ca390e7ULL, 0x1c347c50dULL, 0xe709c5384ULL, 0xb0a3e2c38ULL },
+    { 0xd99538880ULL, 0x422a14f26ULL, 0x0111ca99bULL, 0x64f285442ULL },
+    { 0x9e4286792ULL, 0x82fd8a0f0ULL, 0x49e614279ULL, 0x0f051bf41ULL },
+    { 0x237ee628fULL, 0x65f56b61cULL, 0xf14677ec4ULL, 0x386d6afa6ULL },
+    { 0xdfd9c26f1ULL, 0xeeee12cf9ULL, 0x8f6439bfbULL, 0x9f3487777ULL },
+    { 0x86255f92eULL, 0xb153c5333ULL, 0x749faa461ULL, 0xccca3ca8dULL },
+    { 0x59189f238ULL, 0x52c907d49ULL, 0x1c4f9189aULL, 0x92be0934aULL },
+    { 0x53a809717ULL, 0x1518d6cd8ULL, 0xe8e9015caULL, 0x1b36b18a8ULL },
+    { 0x08ab1676fULL, 0x0f53db189ULL, 0xf6e68d510ULL, 0x918dbcaf0ULL },
+    { 0xf98c981cdULL, 0x0ea8f5f28ULL, 0xb3819319fULL, 0x14faf1570ULL },
+    { 0xf988ef95bULL, 0x3ed9b5c6eULL, 0xda9f7119fULL, 0x763ad9b7cULL },
+    { 0x1f02fe1eeULL, 0xaaf9cd515ULL, 0x7787f40f8ULL, 0xa8ab39f55ULL },
+    { 0x68eafea3dULL, 0x27c57f94fULL, 0xbc57f5716ULL, 0xf29fea3e4ULL },
+    { 0x7e914ff06ULL, 0xf25bf6892ULL, 0x60ff2897eULL, 0x4916fda4fULL },
+    { 0x2c95145cdULL, 0xce23f1380ULL, 0xb3a28a934ULL, 0x01c8fc473ULL },
+    { 0x3e932cd08ULL, 0xc20bbd096ULL, 0x10b34c97cULL, 0x690bdd043ULL },
+    { 0xb75caf283ULL, 0xd4fd2663cULL, 0xc14f53aedULL, 0x3c664bf2bULL },
+    { 0xbaf5723cbULL, 0x6f7eb3334ULL, 0xd3c4eaf5dULL, 0x2cccd7ef6ULL },
+    { 0x79cb128cdULL, 0x0e6e79d0aULL, 0xb3148d39eULL, 0x50b9e7670ULL },
+    { 0x40572e1e0ULL, 0x48678ca05ULL, 0x07874ea02ULL, 0xa0531e612ULL },
+    { 0x52d49661fULL, 0x44dd53bd0ULL, 0xf86692b4aULL, 0x0bdcabb22ULL },
+    { 0xb1705c0daULL, 0x693d25560ULL, 0x5b03a0e8dULL, 0x06aa4bc96ULL },
+    { 0x6331db673ULL, 0x7dd226dd1ULL, 0xce6db8cc6ULL, 0x8bb644bbeULL },
+    { 0x109abcc41ULL, 0x4c891c18eULL, 0x8233d5908ULL, 0x718389132ULL },
+    { 0x603c7c68fULL, 0x653167b8cULL, 0xf163e3c06ULL, 0x31de68ca6ULL },
+    { 0x7332a1ffbULL, 0x5db8abcd7ULL, 0xdff854cceULL, 0xeb3d51dbaULL },
+    { 0x3d8f60e64ULL, 0xaa0a7a68fULL, 0x26706f1bcULL, 0xf165e5055ULL },
+    { 0xca61ac329ULL, 0x078787835ULL, 0x94c358653ULL, 0xac1e1e1e0ULL },
+    { 0x8419321ceULL, 0xc872c112cULL, 0x7384c9821ULL, 0x348834e13ULL },
+    { 0xaba71d8a7ULL, 0x17337c733ULL, 0xe51b8e5d5ULL, 0xcce3ecce8ULL },
+    { 0xdc694c5b7ULL, 0xa73fc48e9ULL, 0xeda32963bULL, 0x97123fce5ULL },
+    { 0xf49cfce05ULL, 0xe48976baeULL, 0xa073f392fULL, 0x75d6e9127ULL },
+    { 0xc845f33c3ULL, 0x3ef682b24ULL, 0xc3ccfa213ULL, 0x24d416f7cULL },
+    { 0x684afb52cULL, 0x32c4ed98dULL, 0x34adf5216ULL, 0xb19b7234cULL },
+    { 0xd6145b1d3ULL, 0xfc7884b70ULL, 0xcb8da286bULL, 0x0ed211e3fULL },
+    { 0x10fddfadcULL, 0x79ef5734aULL, 0x3b5fbbf08ULL, 0x52ceaf79eULL },
+    { 0x1f8b48148ULL, 0xaa0a9d418ULL, 0x12812d1f8ULL, 0x182b95055ULL },
+    { 0x9c32a3e93ULL, 0xd7f80a0e6ULL, 0xc97c54c39ULL, 0x670501febULL },
+    { 0x9d6c7c387ULL, 0xa73dc672cULL, 0xe1c3e36b9ULL, 0x34e63bce5ULL },
+    { 0xb703b1dd5ULL, 0x9caae85f6ULL, 0xabb8dc0edULL, 0x6fa175539ULL },
+    { 0x6fdd3b980ULL, 0xd266b4f1eULL, 0x019dcbbf6ULL, 0x78f2d664bULL },
+    { 0xb23eb0da4ULL, 0x41a8e83bfULL, 0x25b0d7c4dULL, 0xfdc171582ULL },
+    { 0x73ad67a20ULL, 0x314b32e1fULL, 0x045e6b5ceULL, 0xf874cd28cULL },
+    { 0x536103be8ULL, 0x196e83c13ULL, 0x17dc086caULL, 0xc83c17698ULL },
+    { 0xd67a42fc3ULL, 0xed7c8a8baULL, 0xc3f425e6bULL, 0x5d1513eb7ULL },
+    { 0x1f2877bf6ULL, 0xbb79c255fULL, 0x6fdee14f8ULL, 0xfaa439eddULL },
+    { 0x2d67aa89cULL, 0x83e66d646ULL, 0x39155e6b4ULL, 0x626b667c1ULL },
+    { 0xa83789850ULL, 0x5b822c262ULL, 0x0a191ec15ULL, 0x4643441daULL },
+    { 0x2feb3f19cULL, 0x9367fd55cULL, 0x398fcd7f4ULL, 0x3aabfe6c9ULL },
+    { 0x29a0d4765ULL, 0x2f81f2581ULL, 0xa6e2b0594ULL, 0x81a4f81f4ULL },
+    { 0x41b1e6a7fULL, 0x6dd353c47ULL, 0xfe5678d82ULL, 0xe23cacbb6ULL },
+    { 0xf85d7e8c7ULL, 0x6e7f64b2eULL, 0xe317eba1fULL, 0x74d26fe76ULL },
+    { 0x85308f234ULL, 0xd1c146461ULL, 0x2c4f10ca1ULL, 0x86262838bULL },
+    { 0x79839c475ULL, 0x0e8b7cdc1ULL, 0xae239c19eULL, 0x83b3ed170ULL },
+    { 0x4b7c66718ULL, 0x634583edcULL, 0x18e663ed2ULL, 0x3b7c1a2c6ULL },
+    { 0xe7ed02052ULL, 0x895630e78ULL, 0x4a040b7e7ULL, 0x1e70c6a91ULL },
+    { 0x3921053ddULL, 0x1f2be3440ULL, 0xbbca0849cULL, 0x022c7d4f8ULL },
+    { 0x2e5cda073ULL, 0xeed424359ULL, 0xce05b3a74ULL, 0x9ac242b77ULL },
+    { 0xbf419773eULL, 0x92dfe35f1ULL, 0x7cee982fdULL, 0x8fac7fb49ULL },
+    { 0xe5f2a771eULL, 0xd1d5fbce4ULL, 0x78ee54fa7ULL, 0x273dfab8bULL },
+    { 0xbd0dde2deULL, 0xaafb67768ULL, 0x7b47bb0bdULL, 0x16ee6df55ULL },
+    { 0x68498f17eULL, 0x1ad7e5849ULL, 0x7e8f19216ULL, 0x921a7eb58ULL },
+    { 0xb7389be6bULL, 0xddd8275bbULL, 0xd67d91cedULL, 0xddae41bbbULL },
+    { 0x297ff7af7ULL, 0x7ff76a74fULL, 0xef5effe94ULL, 0xf2e56effeULL },
+    { 0xb1c98b837ULL, 0x14de7446bULL, 0xec1d1938dULL, 0xd622e7b28ULL },
+    { 0x70ef7a032ULL, 0x215e3cb4dULL, 0x4c05ef70eULL, 0xb2d3c7a84ULL },
+    { 0x9b42224c0ULL, 0x0a6c084b4ULL, 0x0324442d9ULL, 0x2d2103650ULL },
+    { 0x2ddc180dfULL, 0xce3475748ULL, 0xfb0183bb4ULL, 0x12eae2c73ULL },
+    { 0x0abd05edfULL, 0x5f33532daULL, 0xfb7a0bd50ULL, 0x5b4caccfaULL },
+    { 0xe1be85591ULL, 0x55a1b8ee8ULL, 0x89aa17d87ULL, 0x1771d85aaULL },
+    { 0x91b756727ULL, 0x655bda7a1ULL, 0xe4e6aed89ULL, 0x85e5bdaa6ULL },
+    { 0x2d16f37dbULL, 0xfef0ab7c4ULL, 0xdbecf68b4ULL, 0x23ed50f7fULL },
+    { 0x27b0eec16ULL, 0xe1d1744d6ULL, 0x683770de4ULL, 0x6b22e8b87ULL },
+    { 0x6c8582f9dULL, 0x86e2f3ac2ULL, 0xb9f41a136ULL, 0x435cf4761ULL },
+    { 0x7353286e3ULL, 0x4c3e2ec95ULL, 0xc7614caceULL, 0xa93747c32ULL },
+    { 0x61c194391ULL, 0x04a7b2d40ULL, 0x89c298386ULL, 0x02b4de520ULL },
+    { 0x7b90f39a9ULL, 0x76e8b1d17ULL, 0x959cf09deULL, 0xe8b8d176eULL },
+    { 0xc798d0cd5ULL, 0xeca050dfaULL, 0xab30b19e3ULL, 0x5fb0a0537ULL },
+    { 0x286d274dbULL, 0x1f77212ccULL, 0xdb2e4b614ULL, 0x33484eef8ULL },
+    { 0xd9cb0cb64ULL, 0x0a0fdec2bULL, 0x26d30d39bULL, 0xd437bf050ULL },
+    { 0x4a27f7336ULL, 0x33d3cab55ULL, 0x6ccefe452ULL, 0xaad53cbccULL },
+    { 0x3ac0a3e1aULL, 0x12dc330d6ULL, 0x587c5035cULL, 0x6b0cc3b48ULL },
+    { 0x07dddce57ULL, 0xec97567daULL, 0xea73bbbe0ULL, 0x5be6ae937ULL },
+    { 0x88589b9bbULL, 0x56f48516bULL, 0xdd9d91a11ULL, 0xd68a12f6aULL },
+    { 0x8a17a31bbULL, 0x56f289275ULL, 0xdd8c5e851ULL, 0xae4914f6aULL },
+    { 0xee0552d17ULL, 0xa652e0bf2ULL, 0xe8b4aa077ULL, 0x4fd074a65ULL },
+    { 0xbb5f1f331ULL, 0x564fae779ULL, 0x8ccf8faddULL, 0x9ee75f26aULL },
+    { 0xd03cbbbe2ULL, 0x59f886b2fULL, 0x47ddd3c0bULL, 0xf4d611f9aULL },
+    { 0x98f495ac6ULL, 0x5bbd52322ULL, 0x635a92f19ULL, 0x44c4abddaULL },
+    { 0xc58bfb70fULL, 0xb4d2dfdacULL, 0xf0edfd1a3ULL, 0x35bfb4b2dULL },
+    { 0x7afd06ef8ULL, 0x4b6f33adbULL, 0x1f760bf5eULL, 0xdb5ccf6d2ULL },
+    { 0x516d7fc15ULL, 0x354f44fceULL, 0xa83feb68aULL, 0x73f22f2acULL },
+    { 0xbb95b2ef2ULL, 0x4afa327f7ULL, 0x4f74da9ddULL, 0xefe4c5f52ULL },
+    { 0x4a49aef4aULL, 0x0ad78789eULL, 0x52f759252ULL, 0x791e1eb50ULL },
+    { 0x791677d19ULL, 0x7649a9fc6ULL, 0x98bee689eULL, 0x63f95926eULL },
+    { 0xabc313fa3ULL, 0x1676ba5b3ULL, 0xc5fc8c3d5ULL, 0xcda5d6e68ULL },
+    { 0x6148bcec1ULL, 0x0ca526d8eULL, 0x8373d1286ULL, 0x71b64a530ULL },
+    { 0xbd5b38fafULL, 0xc63eef5afULL, 0xf5f1cdabdULL, 0xf5af77c63ULL },
+    { 0xa7cb165b5ULL, 0x8467f85f9ULL, 0xada68d3e5ULL, 0x9fa1fe621ULL },
+    { 0x7ad79dddcULL, 0x5aaffdbd2ULL, 0x3bbb9eb5eULL, 0x4bdbff55aULL },
+    { 0x1e217b30aULL, 0xb35a87114ULL, 0x50cde8478ULL, 0x288e15acdULL },
+    { 0x076a9f80fULL, 0x95d54d51aULL, 0xf01f956e0ULL, 0x58ab2aba9ULL },
+    { 0x4214f4495ULL, 0x64a140bd4ULL, 0xa922f2842ULL, 0x2bd028526ULL },
+    { 0x5a4d15cc4ULL, 0x1a2f40b9aULL, 0x233a8b25aULL, 0x59d02f458ULL },
+    { 0x2aed1888eULL, 0x03367531aULL, 0x71118b754ULL, 0x58cae6cc0ULL },
+    { 0x4aa2e1fedULL, 0x3fa0db897ULL, 0xb7f874552ULL, 0xe91db05fcULL },
+    { 0x848eaeb22ULL, 0x80d19e22fULL, 0x44d757121ULL, 0xf44798b01ULL },
+    { 0x3328dce1dULL, 0x2589675daULL, 0xb873b14ccULL, 0x5bae691a4ULL },
+    { 0x3adb833daULL, 0x5afebb058ULL, 0x5bcc1db5cULL, 0x1a0dd7f5aULL },
+    { 0x73a91d9fdULL, 0x1d2bf5d5bULL, 0xbf9b895ceULL, 0xdabafd4b8ULL },
+    { 0x046dda67aULL, 0xa9d6073c9ULL, 0x5e65bb620ULL, 0x93ce06b95ULL },
+    { 0x3acb78bddULL, 0x2e2eff15eULL, 0xbbd1ed35cULL, 0x7a8ff7474ULL },
+    { 0xce99e71acULL, 0xf2e3d183dULL, 0x358e79973ULL, 0xbc18bc74fULL },
+    { 0xa525a5546ULL, 0x9993e06a4ULL, 0x62aa5a4a5ULL, 0x25607c999ULL },
+    { 0xf03fa8e81ULL, 0x45aa2eaaeULL, 0x81715fc0fULL, 0x7557455a2ULL },
+    { 0x76e5c0fb1ULL, 0xa5aeb2ad3ULL, 0x8df03a76eULL, 0xcb54d75a5ULL },
+    { 0xe363ed6ecULL, 0x39a76fcb5ULL, 0x376b7c6c7ULL, 0xad3f6e59cULL },
+    { 0x74f925e05ULL, 0xd50f7288eULL, 0xa07a49f2eULL, 0x7114ef0abULL },
+    { 0xc6d9a87a2ULL, 0xc0b6968bdULL, 0x45e159b63ULL, 0xbd1696d03ULL },
+    { 0x0d60ea75bULL, 0xafd4874c4ULL, 0xdae5706b0ULL, 0x232e12bf5ULL },
+    { 0x33e34a7adULL, 0x256eff491ULL, 0xb5e52c7ccULL, 0x892ff76a4ULL },
+    { 0x717ac9604ULL, 0x718c6ec88ULL, 0x206935e8eULL, 0x11376318eULL },
+    { 0x988a30f9cULL, 0x0228db1eeULL, 0x39f0c5119ULL, 0x778db1440ULL },
+    { 0x2ea31ab3cULL, 0x8342ff153ULL, 0x3cd58c574ULL, 0xca8ff42c1ULL },
+    { 0xacb6198eaULL, 0xdb303d323ULL, 0x571986d35ULL, 0xc4cbc0cdbULL },
+    { 0xf065b66b5ULL, 0x05ef62be5ULL, 0xad66da60fULL, 0xa7d46f7a0ULL },
+    { 0xa8c658d40ULL, 0x2a04bc3a2ULL, 0x02b1a6315ULL, 0x45c3d2054ULL },
+    { 0xccad8c80bULL, 0x879315a2aULL, 0xd0131b533ULL, 0x545a8c9e1ULL },
+    { 0xa3a98582eULL, 0x11937143bULL, 0x741a195c5ULL, 0xdc28ec988ULL },
+    { 0xec2c661d0ULL, 0xab61a0a6cULL, 0x0b8663437ULL, 0x3650586d5ULL },
+    { 0x19e4a7b38ULL, 0x13cd93647ULL, 0x1cde52798ULL, 0xe26c9b3c8ULL },
+    { 0x8d1a671d6ULL, 0xfa71c846cULL, 0x6b8e658b1ULL, 0x362138e5fULL },
+    { 0xb22b03c2dULL, 0x154a690bbULL, 0xb43c0d44dULL, 0xdd09652a8ULL },
+    { 0xe96b812a2ULL, 0x13b62ac29ULL, 0x45481d697ULL, 0x943546dc8ULL },
+    { 0xafbc97b94ULL, 0xd3e1f277aULL, 0x29de93df5ULL, 0x5ee4f87cbULL },
+    { 0x2e1d92a08ULL, 0xc2c22331aULL, 0x10549b874ULL, 0x58cc44343ULL },
+    { 0x141ad6a03ULL, 0xe4d90a10aULL, 0xc056b5828ULL, 0x508509b27ULL },
+    { 0xb50c15fc0ULL, 0x9829a27aaULL, 0x03fa830adULL, 0x55e459419ULL },
+    { 0x5f28b6929ULL, 0x87c981d1fULL, 0x9496d14faULL, 0xf8b8193e1ULL },
+    { 0x0549a02afULL, 0x84b64340dULL, 0xf540592a0ULL, 0xb02c26d21ULL },
+    { 0xaa1d138cfULL, 0x5e726133aULL, 0xf31c8b855ULL, 0x5cc864e7aULL },
+    { 0xd6c5d4f26ULL, 0xa09fd2bb3ULL, 0x64f2ba36bULL, 0xcdd4bf905ULL },
+    { 0xaf2763e7fULL, 0xbf526b6f7ULL, 0xfe7c6e4f5ULL, 0xef6d64afdULL },
+    { 0x0d1e5427aULL, 0xea110b749ULL, 0x5e42a78b0ULL, 0x92ed08857ULL },
+    { 0x690d1d439ULL, 0x160325fc9ULL, 0x9c2b8b096ULL, 0x93fa4c068ULL },
+    { 0x8e7652d3bULL, 0xe754893f3ULL, 0xdcb4a6e71ULL, 0xcfc912ae7ULL },
+    { 0xb7e70dc6bULL, 0x9d1f3d6b3ULL, 0xd63b0e7edULL, 0xcd6bcf8b9ULL },
+    { 0x5b3d3d87bULL, 0x5f1b05f5fULL, 0xde1bcbcdaULL, 0xfafa0d8faULL },
+    { 0x4f868e716ULL, 0x82d1deed0ULL, 0x68e7161f2ULL, 0x0b77b8b41ULL },
+    { 0xb11fbba7cULL, 0x58ca6f76fULL, 0x3e5ddf88dULL, 0xf6ef6531aULL },
+    { 0x80aec5982ULL, 0x31b19822aULL, 0x419a37501ULL, 0x544198d8cULL },
+    { 0xd5e7c6b5fULL, 0xaddfdbe62ULL, 0xfad63e7abULL, 0x467dbfbb5ULL },
+    { 0x5d2d81763ULL, 0x9f9a82e89ULL, 0xc6e81b4baULL, 0x9174159f9ULL },
+    { 0xcba8c94c1ULL, 0x3fa014cb8ULL, 0x8329315d3ULL, 0x1d32805fcULL },
+    { 0x67e64b113ULL, 0xb554bce50ULL, 0xc88d267e6ULL, 0x0a73d2aadULL },
+    { 0xfa43505ceULL, 0x2a3ee99b0ULL, 0x73a0ac25fULL, 0x0d9977c54ULL },
+    { 0xf096aede7ULL, 0x4cf9fcaa7ULL, 0xe7b75690fULL, 0xe553f9f32ULL },
+    { 0x47da9dd3bULL, 0xd4959dddbULL, 0xdcbb95be2ULL, 0xdbbb9a92bULL },
+    { 0x9a054b85eULL, 0x3a5a45272ULL, 0x7a1d2a059ULL, 0x4e4a25a5cULL },
+    { 0x786c35f1bULL, 0x171da3bceULL, 0xd8fac361eULL, 0x73dc5b8e8ULL },
+    { 0x93aff48c6ULL, 0x29bb5873eULL, 0x6312ff5c9ULL, 0x7ce1add94ULL },
+    { 0x2ab0af34bULL, 0x5fd1b7014ULL, 0xd2cf50d54ULL, 0x280ed8bfaULL },
+    { 0xf00bfa631ULL, 0x24ca2e9edULL, 0x8c65fd00fULL, 0xb79745324ULL },
+    { 0x4ca6c6855ULL, 0xafc158a42ULL, 0xaa1636532ULL, 0x4251a83f5ULL },
+    { 0xba14e30e1ULL, 0x7ee820235ULL, 0x870c7285dULL, 0xac404177eULL },
+    { 0x21d0f2918ULL, 0x60c4b1546ULL, 0x1894f0b84ULL, 0x62a8d2306ULL },
+    { 0xc3a330642ULL, 0x09121adb4ULL, 0x4260cc5c3ULL, 0x2db584890ULL },
+    { 0x379de9997ULL, 0xf4baf465eULL, 0xe9997b9ecULL, 0x7a62f5d2fULL },
+    { 0x2284a05e1ULL, 0x0ca0b0295ULL, 0x87a052144ULL, 0xa940d0530ULL },
+    { 0x6fd5d60e1ULL, 0xeee730f11ULL, 0x8706babf6ULL, 0x88f0ce777ULL },
+    { 0xcb546fabdULL, 0x766547e77ULL, 0xbd5f62ad3ULL, 0xee7e2a66eULL },
+    { 0x9c2a91e58ULL, 0x9b880b1eaULL, 0x1a7895439ULL, 0x578d011d9ULL },
+    { 0x3dd2947efULL, 0xcebdfb581ULL, 0xf7e294bbcULL, 0x81adfbd73ULL },
+    { 0x6453e433dULL, 0xe487eb845ULL, 0xbcc27ca26ULL, 0xa21d7e127ULL },
+    { 0x2bc65618cULL, 0x2265f9710ULL, 0x3186a63d4ULL, 0x08e9fa644ULL },
+    { 0x2527b7cfeULL, 0x99f3697c7ULL, 0x7f3ede4a4ULL, 0xe3e96cf99ULL },
+    { 0x1624c726dULL, 0xbdc943211ULL, 0xb64e32468ULL, 0x884c293bdULL },
+    { 0xcab0a4f8eULL, 0x43b1d38b6ULL, 0x71f250d53ULL, 0x6d1cb8dc2ULL },
+    { 0xc1ec8a63eULL, 0x01d457ee9ULL, 0x7c6513783ULL, 0x977ea2b80ULL },
+    { 0x528e1ee8dULL, 0x04695fb9aULL, 0xb1778714aULL, 0x59dfa9620ULL },
+    { 0xfea34fd29ULL, 0xb74bbd8b3ULL, 0x94bf2c57fULL, 0xcd1bdd2edULL },
+    { 0x5c91f9526ULL, 0xf29ad4985ULL, 0x64a9f893aULL, 0xa192b594fULL },
+    { 0x2a67da0c8ULL, 0x2be62d310ULL, 0x1305be654ULL, 0x08cb467d4ULL },
+    { 0x6f9307c92ULL, 0xd27338cd2ULL, 0x493e0c9f6ULL, 0x4b31cce4bULL },
+    { 0x1b7f65da0ULL, 0x732f8869fULL, 0x05ba6fed8ULL, 0xf9611f4ceULL },
+    { 0x605e30523ULL, 0x4414a8b8dULL, 0xc4a0c7a06ULL, 0xb1d152822ULL },
+    { 0xbb0374330ULL, 0x220baa575ULL, 0x0cc2ec0ddULL, 0xaea55d044ULL },
+    { 0xf596e659bULL, 0xe4f9b9ee4ULL, 0xd9a6769afULL, 0x2779d9f27ULL },
+    { 0x9251e324eULL, 0x78de43034ULL, 0x724c78a49ULL, 0x2c0c27b1eULL },
+    { 0x258193a13ULL, 0x94d232542ULL, 0xc85c981a4ULL, 0x42a4c4b29ULL },
+    { 0xb323caa48ULL, 0x29ca2f432ULL, 0x12553c4cdULL, 0x4c2f45394ULL },
+    { 0x8d491d3c1ULL, 0x9e2786528ULL, 0x83cb892b1ULL, 0x14a61e479ULL },
+    { 0xe33324c3dULL, 0x450369cf7ULL, 0xbc324ccc7ULL, 0xef396c0a2ULL },
+    { 0xb836fc2f7ULL, 0x6fb96e365ULL, 0xef43f6c1dULL, 0xa6c769df6ULL },
+    { 0xedd12e6b4ULL, 0xc26776ce5ULL, 0x2d6748bb7ULL, 0xa736ee643ULL },
+    { 0xeb473bf7aULL, 0x1a56afff7ULL, 0x5efdce2d7ULL, 0xefff56a58ULL },
+    { 0x14f26f529ULL, 0xf54d9d085ULL, 0x94af64f28ULL, 0xa10b9b2afULL },
+    { 0xcd7f1ab9fULL, 0xc776cff6aULL, 0xf9d58feb3ULL, 0x56ff36ee3ULL },
+    { 0xc635e2af3ULL, 0xedf202a77ULL, 0xcf547ac63ULL, 0xee5404fb7ULL },
+    { 0xd7f90cd73ULL, 0xcd1f94cfbULL, 0xceb309febULL, 0xdf329f8b3ULL },
+    { 0x5315d7d0cULL, 0x70cbc1f92ULL, 0x30beba8caULL, 0x49f83d30eULL },
+    { 0x561274d51ULL, 0xec09889d6ULL, 0x8ab2e486aULL, 0x6b9119037ULL },
+    { 0xb51aba952ULL, 0xc8d8ac56eULL, 0x4a95d58adULL, 0x76a351b13ULL },
+    { 0x623e073a4ULL, 0x5161eaa19ULL, 0x25ce07c46ULL, 0x98557868aULL },
+    { 0xebfc9d48eULL, 0x53b575fb8ULL, 0x712b93fd7ULL, 0x1dfaeadcaULL },
+    { 0x8133562feULL, 0x69734b561ULL, 0x7f46acc81ULL, 0x86ad2ce96ULL },
+    { 0x7d2b92026ULL, 0x83da68d09ULL, 0x64049d4beULL, 0x90b165bc1ULL },
+    { 0x9055c0ca6ULL, 0x60be402a3ULL, 0x65303aa09ULL, 0xc54027d06ULL },
+    { 0xcd84b55cfULL, 0x9eb1d1fa4ULL, 0xf3aad21b3ULL, 0x25f8b8d79ULL },
+    { 0x0b365c094ULL, 0x63214c750ULL, 0x2903a6cd0ULL, 0x0ae3284c6ULL },
+    { 0xbe620705aULL, 0x9b5d29070ULL, 0x5a0e0467dULL, 0x0e094bad9ULL },
+    { 0x27265f23cULL, 0xb1416f751ULL, 0x3c4fa64e4ULL, 0x8aef6828dULL },
+    { 0x648aa663aULL, 0x80d13b8cdULL, 0x5c6655126ULL, 0xb31dc8b01ULL },
+    { 0xfe654502dULL, 0xb70f61a31ULL, 0xb40a2a67fULL, 0x8c586f0edULL },
+    { 0xa7634430dULL, 0xa507eb430ULL, 0xb0c22c6e5ULL, 0x0c2d7e0a5ULL },
+    { 0xd9c07e0a8ULL, 0x226d15d25ULL, 0x1507e039bULL, 0xa4ba8b644ULL },
+    { 0x1d68d414dULL, 0xaf8dc1508ULL, 0xb282b16b8ULL, 0x10a83b1f5ULL },
+    { 0xcbc528703ULL, 0x061696eb4ULL, 0xc0e14a3d3ULL, 0x2d7696860ULL },
+    { 0xe4281cbc9ULL, 0x8d21a792aULL, 0x93d381427ULL, 0x549e584b1ULL },
+    { 0xe1ddaadd6ULL, 0x48f6f4eeeULL, 0x6bb55bb87ULL, 0x7772f6f12ULL },
+    { 0xf4ef5ae6dULL, 0xad4e7fbabULL, 0xb675af72fULL, 0xd5dfe72b5ULL },
+    { 0x7a9f2d73fULL, 0x561bffaddULL, 0xfceb4f95eULL, 0xbb5ffd86aULL },
+    { 0xbdd76f566ULL, 0xfa5ffc6a5ULL, 0x66af6ebbdULL, 0xa563ffa5fULL },
+    { 0x4f8b22504ULL, 0x8242d8c9cULL, 0x20a44d1f2ULL, 0x3931b4241ULL },
+    { 0x689ce13d6ULL, 0x7ab0f2a4cULL, 0x6bc873916ULL, 0x3254f0d5eULL },
+    { 0x177de291dULL, 0xe5cec165eULL, 0xb8947bee8ULL, 0x7a68373a7ULL },
+    { 0x651b7d6d2ULL, 0xf8332edccULL, 0x4b6bed8a6ULL, 0x33b74cc1fULL },
+    { 0xe61ef480eULL, 0xe09169b3eULL, 0x7012f7867ULL, 0x7cd968907ULL },
+    { 0x0a83c5b7eULL, 0x3a93db053ULL, 0x7eda3c150ULL, 0xca0dbc95cULL },
+    { 0x71d8f7cd5ULL, 0x7ced70dceULL, 0xab3ef1b8eULL, 0x73b0eb73eULL },
+    { 0x776628eb6ULL, 0x813c6eed7ULL, 0x6d71466eeULL, 0xeb7763c81ULL },
+    { 0xa44723102ULL, 0x9056a8224ULL, 0x408c4e225ULL, 0x244156a09ULL },
+    { 0x8d1c1e887ULL, 0xc6714472aULL, 0xe117838b1ULL, 0x54e228e63ULL },
+    { 0xae05cf750ULL, 0xbac3a62f0ULL, 0x0aef3a075ULL, 0x0f465c35dULL },
+    { 0xf2b9ee05aULL, 0x69db3587cULL, 0x5a0779d4fULL, 0x3e1acdb96ULL },
+    { 0x96b8dc50eULL, 0xe199d51b8ULL, 0x70a3b1d69ULL, 0x1d8ab9987ULL },
+    { 0xbf8cb3364ULL, 0x9ac8f273dULL, 0x26ccd31fdULL, 0xbce4f1359ULL },
+    { 0x4d8bb26b7ULL, 0x86f25adcdULL, 0xed64dd1b2ULL, 0xb3b5a4f61ULL },
+    { 0x306f2b819ULL, 0x154e2d24eULL, 0x981d4f60cULL, 0x724b472a8ULL },
+    { 0x86df27656ULL, 0xd8575a2fcULL, 0x6a6e4fb61ULL, 0x3f45aea1bULL },
+    { 0xc93fa8f4aULL, 0x4b928feaeULL, 0x52f15fc93ULL, 0x757f149d2ULL },
+    { 0xb265cd4c0ULL, 0x39af242b0ULL, 0x032b3a64dULL, 0x0d424f59cULL },
+    { 0xe66be8d37ULL, 0xa596ec8ffULL, 0xecb17d667ULL, 0xff13769a5ULL },
+    { 0xac9dfc195ULL, 0xe6a3f436cULL, 0xa983fb935ULL, 0x36c2fc567ULL },
+    { 0xb113c4becULL, 0x68abeb423ULL, 0x37d23c88dULL, 0xc42d7d516ULL },
+    { 0xd3df09a1dULL, 0x540e5fe7aULL, 0xb8590fbcbULL, 0x5e7fa702aULL },
+    { 0xee458f437ULL, 0x96d764af1ULL, 0xec2f1a277ULL, 0x8f526eb69ULL },
+    { 0x67ca0cb09ULL, 0x8405bfc1aULL, 0x90d3053e6ULL, 0x583fda021ULL },
+    { 0xb3315f6c5ULL, 0x7d6b665b0ULL, 0xa36fa8ccdULL, 0x0da66d6beULL },
+    { 0x33710bd22ULL, 0x515ea4493ULL, 0x44bd08eccULL, 0xc92257a8aULL },
+    { 0x9be98bb86ULL, 0x13fed643aULL, 0x61dd197d9ULL, 0x5c26b7fc8ULL },
+    { 0x41bf3e0c5ULL, 0x4d635cf0cULL, 0xa307cfd82ULL, 0x30f3ac6b2ULL },
+    { 0x27b4390b8ULL, 0xd12035755ULL, 0x1d09c2de4ULL, 0xaaeac048bULL },
+    { 0x16c2eb6faULL, 0xb8fc1f0d5ULL, 0x5f6d74368ULL, 0xab0f83f1dULL },
+    { 0xb4d8be4c8ULL, 0xc8ed351acULL, 0x1327d1b2dULL, 0x358acb713ULL },
+    { 0x9d6c3329aULL, 0x937c0376cULL, 0x594cc36b9ULL, 0x36ec03ec9ULL },
+    { 0x3e5d3857fULL, 0xce1ee53ddULL, 0xfea1cba7cULL, 0xbbca77873ULL },
+    { 0xb4648c30aULL, 0x819da7220ULL, 0x50c31262dULL, 0x044e5b981ULL },
+    { 0x5d658d99bULL, 0x97bf85e42ULL, 0xd99b1a6baULL, 0x427a1fde9ULL },
+    { 0x4b391efd8ULL, 0x4b6387ddaULL, 0x1bf789cd2ULL, 0x5bbe1c6d2ULL },
+    { 0x9f66f6f47ULL, 0xafddca7b6ULL, 0xe2f6f66f9ULL, 0x6de53bbf5ULL },
+    { 0x63fb7abc8ULL, 0x6966bfd1eULL, 0x13d5edfc6ULL, 0x78bfd6696ULL },
+    { 0x30d595c3dULL, 0x548f713c3ULL, 0xbc3a9ab0cULL, 0xc3c8ef12aULL },
+    { 0x2ce4da5b8ULL, 0xa3e4b53c1ULL, 0x1da5b2734ULL, 0x83cad27c5ULL },
+    { 0x7b4f2f7a4ULL, 0x126feee9dULL, 0x25ef4f2deULL, 0xb9777f648ULL },
+    { 0x50a5aad3bULL, 0x05da95ac7ULL, 0xdcb55a50aULL, 0xe35a95ba0ULL },
+    { 0x3563db639ULL, 0xb5ce2f5c1ULL, 0x9c6dbc6acULL, 0x83af473adULL },
+    { 0xca11c1591ULL, 0x76a2808f0ULL, 0x89a838853ULL, 0x0f101456eULL },
+    { 0x77990f168ULL, 0xd84bb5c19ULL, 0x168f099eeULL, 0x983add21bULL },
+    { 0x06e8068abULL, 0x85751101bULL, 0xd51601760ULL, 0xd8088aea1ULL },
+    { 0x58f24cf91ULL, 0x672d9e8c2ULL, 0x89f324f1aULL, 0x43179b4e6ULL },
+    { 0x578378d34ULL, 0xa00adcdd7ULL, 0x2cb1ec1eaULL, 0xebb3b5005ULL },
+    { 0x66c7b60c6ULL, 0x88f778b14ULL, 0x6306de366ULL, 0x28d1eef11ULL },
+    { 0x788f45480ULL, 0x322b38a88ULL, 0x012a2f11eULL, 0x1151cd44cULL },
+    { 0xe9efd03adULL, 0x27a6fbf29ULL, 0xb5c0bf797ULL, 0x94fdf65e4ULL },
+    { 0x27d40fa3aULL, 0xd05537653ULL, 0x5c5f02be4ULL, 0xca6ecaa0bULL },
+    { 0x7d2af980aULL, 0xb3982dd0eULL, 0x5019f54beULL, 0x70bb419cdULL },
+    { 0x569052756ULL, 0xe858d29d0ULL, 0x6ae4a096aULL, 0x0b94b1a17ULL },
+    { 0x1ee1e73d2ULL, 0xbbff92054ULL, 0x4bce78778ULL, 0x2a049ffddULL },
+    { 0xfe9da6d29ULL, 0xc6cbb1abfULL, 0x94b65b97fULL, 0xfd58dd363ULL },
+    { 0x4bde76fcbULL, 0x6e759bf9eULL, 0xd3f6e7bd2ULL, 0x79fd9ae76ULL },
+    { 0x32154bdf8ULL, 0x786aa52d3ULL, 0x1fbd2a84cULL, 0xcb4a5561eULL },
+    { 0x8d5e480b6ULL, 0xe2344c669ULL, 0x6d0127ab1ULL, 0x966322c47ULL },
+    { 0x5599e417cULL, 0xe88bd1c4dULL, 0x3e82799aaULL, 0xb238bd117ULL },
+    { 0x7fb264832ULL, 0xe31938c57ULL, 0x4c1264dfeULL, 0xea31c98c7ULL },
+    { 0x06c9396f3ULL, 0x9c36161ddULL, 0xcf69c9360ULL, 0xbb8686c39ULL },
+    { 0x42ca7c2d2ULL, 0x28351e95cULL, 0x4b43e5342ULL, 0x3a978ac14ULL },
+    { 0x4ec0f8bacULL, 0xa2a4d7917ULL, 0x35d1f0372ULL, 0xe89eb2545ULL },
+    { 0x2d71831ebULL, 0xdff6a1401ULL, 0xd78c18eb4ULL, 0x802856ffbULL },
+    { 0x8082ea464ULL, 0x28c05c0a5ULL, 0x262574101ULL, 0xa503a0314ULL },
+    { 0xacce3a343ULL, 0x8e54be32cULL, 0xc2c5c7335ULL, 0x34c7d2a71ULL },
+    { 0x58a020b5dULL, 0x0f08d3846ULL, 0xbad04051aULL, 0x621cb10f0ULL },
+    { 0x729f81238ULL, 0x508a3ba59ULL, 0x1c481f94eULL, 0x9a5dc510aULL },
+    { 0x7b055a14cULL, 0x2a4ae5f10ULL, 0x3285aa0deULL, 0x08fa75254ULL },
+    { 0x96f87ce91ULL, 0xe52d161feULL, 0x8973e1f69ULL, 0x7f868b4a7ULL },
+    { 0x29631c4baULL, 0x03372d5c1ULL, 0x5d238c694ULL, 0x83ab4ecc0ULL },
+    { 0x9de218edeULL, 0x8b3c5f5e2ULL, 0x7b71847b9ULL, 0x47afa3cd1ULL },
+    { 0x3ae6af424ULL, 0x13cd7c295ULL, 0x242f5675cULL, 0xa943eb3c8ULL },
+    { 0xb438aea33ULL, 0xc5d92606fULL, 0xcc5751c2dULL, 0xf60649ba3ULL },
+    { 0xd0463d907ULL, 0x141dccb26ULL, 0xe09bc620bULL, 0x64d33b828ULL },
+    { 0xbb2097270ULL, 0x1bc922571ULL, 0x0e4e904ddULL, 0x8ea4493d8ULL },
+    { 0xe58f253e0ULL, 0x9823bae2dULL, 0x07ca4f1a7ULL, 0xb475dc419ULL },
+    { 0xc2759e354ULL, 0x49c7c6b70ULL, 0x2ac79ae43ULL, 0x0ed63e392ULL },
+    { 0x0a42bc847ULL, 0x0e954c116ULL, 0xe213d4250ULL, 0x68832a970ULL },
+    { 0xad43ec82bULL, 0xa6972d427ULL, 0xd4137c2b5ULL, 0xe42b4e965ULL },
+    { 0x3d8873fbbULL, 0xb678b35cfULL, 0xddfce11bcULL, 0xf3acd1e6dULL },
+    { 0x66a1a6b8bULL, 0x85f3b3816ULL, 0xd1d658566ULL, 0x681cdcfa1ULL },
+    { 0xdd8dafc84ULL, 0x92eb54eaeULL, 0x213f5b1bbULL, 0x7572ad749ULL },
+    { 0x1507dacb3ULL, 0xa4fa0c7c3ULL, 0xcd35be0a8ULL, 0xc3e305f25ULL },
+    { 0x89febe633ULL, 0x47d51e7edULL, 0xcc67d7f91ULL, 0xb7e78abe2ULL },
+    { 0x1907bd90aULL, 0x129b8d706ULL, 0x509bde098ULL, 0x60eb1d948ULL },
+    { 0x62f1bcb2eULL, 0x4197f7917ULL, 0x74d3d8f46ULL, 0xe89efe982ULL },
+    { 0x0e9390c8aULL, 0xc2b219192ULL, 0x51309c970ULL, 0x498984d43ULL },
+    { 0x66fbd47caULL, 0xe9b7bb998ULL, 0x53e2bdf66ULL, 0x199dded97ULL },
+    { 0xcb7fcbba5ULL, 0x77e6cee3bULL, 0xa5dd3fed3ULL, 0xdc77367eeULL },
+    { 0x484d96725ULL, 0x06c7c2b89ULL, 0xa4e69b212ULL, 0x91d43e360ULL },
+    { 0xb6c99cb8dULL, 0x84aff713aULL, 0xb1d39936dULL, 0x5c8eff521ULL },
+    { 0xd649136d6ULL, 0x987e429f8ULL, 0x6b6c8926bULL, 0x1f9427e19ULL },
+    { 0x0de502a62ULL, 0x8b5612603ULL, 0x46540a7b0ULL, 0xc06486ad1ULL },
+    { 0xf99a3d774ULL, 0x5a09fededULL, 0x2eebc599fULL, 0xb7b7f905aULL },
+    { 0x7c1452a74ULL, 0xea4862b43ULL, 0x2e54a283eULL, 0xc2d461257ULL },
+    { 0x39514c59fULL, 0x663fe54c0ULL, 0xf9a328a9cULL, 0x032a7fc66ULL },
+    { 0xca3f3957eULL, 0x5b12cdbfdULL, 0x7ea9cfc53ULL, 0xbfdb348daULL },
+    { 0xdbd45ff3aULL, 0x725d97ff3ULL, 0x5cffa2bdbULL, 0xcffe9ba4eULL },
+    { 0x71f68b262ULL, 0x59dc3ee01ULL, 0x464d16f8eULL, 0x8077c3b9aULL },
+    { 0x3d22290d7ULL, 0x9f386c444ULL, 0xeb09444bcULL, 0x222361cf9ULL },
+    { 0x9a4d82cfcULL, 0x0aee412fbULL, 0x3f341b259ULL, 0xdf4827750ULL },
+    { 0x108d488b2ULL, 0x203a1424bULL, 0x4d112b108ULL, 0xd24285c04ULL },
+    { 0x42429d30eULL, 0x1095cf910ULL, 0x70cb94242ULL, 0x089f3a908ULL },
+    { 0xbff2b72e9ULL, 0xdfed3b535ULL, 0x974ed4ffdULL, 0xacadcb7fbULL },
+    { 0x8945b2108ULL, 0x02c681724ULL, 0x1084da291ULL, 0x24e816340ULL },
+    { 0x9c53ce6a1ULL, 0xe6ef0e0a1ULL, 0x85673ca39ULL, 0x85070f767ULL },
+    { 0xf66e2eb2bULL, 0x855dafa3fULL, 0xd4d74766fULL, 0xfc5f5baa1ULL },
+    { 0x7b8716526ULL, 0x025bf8f91ULL, 0x64a68e1deULL, 0x89f1fda40ULL },
+    { 0x7530c6ac7ULL, 0xedf962c02ULL, 0xe35630caeULL, 0x403469fb7ULL },
+    { 0xdb944ce04ULL, 0x620956eb2ULL, 0x2073229dbULL, 0x4d76a9046ULL },
+    { 0x409c5cbc6ULL, 0x6831d6b0aULL, 0x63d3a3902ULL, 0x50d6b8c16ULL },
+    { 0x607719a8cULL, 0x51266fb02ULL, 0x31598ee06ULL, 0x40df6648aULL },
+    { 0x64886b101ULL, 0xb440b480cULL, 0x808d61126ULL, 0x3012d022dULL },
+    { 0x219ea9940ULL, 0x5880bc60eULL, 0x029957984ULL, 0x7063d011aULL },
+    { 0x9264faf2bULL, 0x25dc873b7ULL, 0xd4f5f2649ULL, 0xedce13ba4ULL },
+    { 0xd60e51379ULL, 0xbc088bb79ULL, 0x9ec8a706bULL, 0x9edd1103dULL },
+    { 0x06e81992cULL, 0x9104d511bULL, 0x349981760ULL, 0xd88ab2089ULL },
+    { 0x65c4d5c93ULL, 0xb4b530fc2ULL, 0xc93ab23a6ULL, 0x43f0cad2dULL },
+    { 0x5b0155e34ULL, 0x320b42dd3ULL, 0x2c7aa80daULL, 0xcbb42d04cULL },
+    { 0x5d408f661ULL, 0x9ecd06c81ULL, 0x866f102baULL, 0x81360b379ULL },
+    { 0x3deff3a8dULL, 0xb7ee7b70eULL, 0xb15cff7bcULL, 0x70ede77edULL },
+    { 0x5325c8566ULL, 0x299ac4e91ULL, 0x66a13a4caULL, 0x897235994ULL },
+    { 0x120aae52aULL, 0x00d98d09dULL, 0x54a755048ULL, 0xb90b19b00ULL },
+    { 0x9b1dbfc8bULL, 0x56fb057beULL, 0xd13fdb8d9ULL, 0x7dea0df6aULL },
+    { 0xcfb7ab568ULL, 0xdbc29deb5ULL, 0x16ad5edf3ULL, 0xad7b943dbULL },
+    { 0x2a8ddc207ULL, 0x269376318ULL, 0xe043bb154ULL, 0x18c6ec964ULL },
+    { 0x8e6aae133ULL, 0x87d58c07dULL, 0xcc8755671ULL, 0xbe031abe1ULL },
+    { 0xabfd4d9f3ULL, 0x7f37b467bULL, 0xcf9b2bfd5ULL, 0xde62decfeULL },
+    { 0x2d091106cULL, 0x9a0261509ULL, 0x3608890b4ULL, 0x90a864059ULL },
+    { 0xa8cf7f0ccULL, 0x3a677d32cULL, 0x330fef315ULL, 0x34cbee65cULL },
+    { 0xa653994c7ULL, 0xdcb66c1b0ULL, 0xe3299ca65ULL, 0x0d8366d3bULL },
+    { 0x87a6e06d0ULL, 0xa9a01a6f4ULL, 0x0b60765e1ULL, 0x2f6580595ULL },
+    { 0x3be8dd970ULL, 0x3b8db455bULL, 0x0e9bb17dcULL, 0xdaa2db1dcULL },
+    { 0xd1b2e2fa9ULL, 0x65e89bca7ULL, 0x95f474d8bULL, 0xe53d917a6ULL },
+    { 0x00bcb84e7ULL, 0x4db05438dULL, 0xe721d3d00ULL, 0xb1c2a0db2ULL },
+    { 0xa6a79e62bULL, 0x85d33f3b1ULL, 0xd4679e565ULL, 0x8dcfccba1ULL },
+    { 0xc8865b013ULL, 0x36501cb60ULL, 0xc80da6113ULL, 0x06d380a6cULL },
+    { 0x0cff77b19ULL, 0xf7479b34eULL, 0x98deeff30ULL, 0x72cd9e2efULL },
+    { 0x8e1ddc943ULL, 0xee938433aULL, 0xc293bb871ULL, 0x5cc21c977ULL },
+    { 0x12f4c89e7ULL, 0x6dbcd4213ULL, 0xe79132f48ULL, 0xc842b3db6ULL },
+    { 0xddf5b4a8dULL, 0xc7af53f26ULL, 0xb152dafbbULL, 0x64fcaf5e3ULL },
+    { 0x61c256faaULL, 0x2075bbd83ULL, 0x55f6a4386ULL, 0xc1bddae04ULL },
+    { 0x220251d85ULL, 0x3420e8192ULL, 0xa1b8a4044ULL, 0x49817042cULL },
+    { 0xa0de182f2ULL, 0x48343e369ULL, 0x4f4187b05ULL, 0x96c7c2c12ULL },
+    { 0xcb743e8d0ULL, 0x4b6504f76ULL, 0x0b17c2ed3ULL, 0x6ef20a6d2ULL },
+    { 0x205daeba9ULL, 0x44e7a720fULL, 0x95d75ba04ULL, 0xf04e5e722ULL },
+    { 0xb69748fddULL, 0xec2aff2f2ULL, 0xbbf12e96dULL, 0x4f4ff5437ULL },
+    { 0xf4a58bd56ULL, 0x99daf4ae2ULL, 0x6abd1a52fULL, 0x4752f5b99ULL },
+    { 0x8993d00cfULL, 0x6eb259520ULL, 0xf300bc991ULL, 0x04a9a4d76ULL },
+    { 0x2ba1ce50fULL, 0x27d3f5490ULL, 0xf0a7385d4ULL, 0x092afcbe4ULL },
+    { 0x541f2694aULL, 0xc85b89a0eULL, 0x52964f82aULL, 0x70591da13ULL },
+    { 0xfa4946995ULL, 0x266fe087aULL, 0xa9962925fULL, 0x5e107f664ULL },
+    { 0x8f774dc86ULL, 0xf3374c6b2ULL, 0x613b2eef1ULL, 0x4d632eccfULL },
+    { 0x154934bfaULL, 0x883f8354fULL, 0x5fd2c92a8ULL, 0xf2ac1fc11ULL },
+    { 0xa0b37d790ULL, 0x7123be1e4ULL, 0x09ebecd05ULL, 0x2787dc48eULL },
+    { 0x5e1d4006cULL, 0xea0a41a19ULL, 0x36002b87aULL, 0x985825057ULL },
+    { 0xf779e3409ULL, 0xf5ce21cbcULL, 0x902c79eefULL, 0x3d38473afULL },
+    { 0x7e3c6729cULL, 0xf36963a5cULL, 0x394e63c7eULL, 0x3a5c696cfULL },
+    { 0x260a14cc8ULL, 0x88212919aULL, 0x133285064ULL, 0x598948411ULL },
+    { 0xd2b47f3efULL, 0x7d79d7b35ULL, 0xf7cfe2d4bULL, 0xacdeb9ebeULL },
+    { 0x344a160f2ULL, 0x887d28149ULL, 0x4f068522cULL, 0x92814be11ULL },
+    { 0xf05857f69ULL, 0x7c4da39abULL, 0x96fea1a0fULL, 0xd59c5b23eULL },
+    { 0xc8de495a3ULL, 0x76349caa9ULL, 0xc5a927b13ULL, 0x955392c6eULL },
+    { 0x299834597ULL, 0x4631f05ccULL, 0xe9a2c1994ULL, 0x33a0f8c62ULL },
+    { 0xc01cdca3aULL, 0x609107b6bULL, 0x5c53b3803ULL, 0xd6de08906ULL },
+    { 0x1186d6c6fULL, 0x2cd959783ULL, 0xf636b6188ULL, 0xc1e9a9b34ULL },
+    { 0xc76a63e00ULL, 0xb1440acbeULL, 0x007c656e3ULL, 0x7d350228dULL },
+    { 0xfa3f8f564ULL, 0x5bcbecab9ULL, 0x26af1fc5fULL, 0x9d537d3daULL },
+    { 0x1ed02f437ULL, 0xd65d540d5ULL, 0xec2f40b78ULL, 0xab02aba6bULL },
+    { 0xa7849855fULL, 0x8c90f57f0ULL, 0xfaa1921e5ULL, 0x0feaf0931ULL },
+    { 0x0cd15ec86ULL, 0xe27754182ULL, 0x6137a8b30ULL, 0x4182aee47ULL },
+    { 0xdef2e6140ULL, 0xebcd98834ULL, 0x028674f7bULL, 0x2c119b3d7ULL },
+    { 0xac72187bcULL, 0xc324ef1e1ULL, 0x3de184e35ULL, 0x878f724c3ULL },
+    { 0x67c90f777ULL, 0x9c57f6cd9ULL, 0xeeef093e6ULL, 0x9b36fea39ULL },
+    { 0x075bcd22bULL, 0xf4970f419ULL, 0xd44b3dae0ULL, 0x982f0e92fULL },
+    { 0xc9bed5eddULL, 0x7fa15bfeaULL, 0xbb7ab7d93ULL, 0x57fda85feULL },
+    { 0x6a9318754ULL, 0x4a02fe9d0ULL, 0x2ae18c956ULL, 0x0b97f4052ULL },
+    { 0x6bd4927b3ULL, 0x46f4b2fd1ULL, 0xcde492bd6ULL, 0x8bf4d2f62ULL },
+    { 0x768407738ULL, 0x9049b3ad1ULL, 0x1cee0216eULL, 0x8b5cd9209ULL },
+    { 0xb50c1a78fULL, 0x8478e77a8ULL, 0xf1e5830adULL, 0x15ee71e21ULL },
+    { 0x994c36f6eULL, 0x0a5dc37afULL, 0x76f6c3299ULL, 0xf5ec3ba50ULL },
+    { 0x21f52457bULL, 0x4d17b16c5ULL, 0xdea24af84ULL, 0xa368de8b2ULL },
+    { 0x61aae7ee4ULL, 0x39e17ac8fULL, 0x277e75586ULL, 0xf135e879cULL },
+    { 0x24018ce85ULL, 0x84a366082ULL, 0xa17318024ULL, 0x41066c521ULL },
+    { 0x6129ce23aULL, 0x21d327c49ULL, 0x5c4739486ULL, 0x923e4cb84ULL },
+    { 0xa4e27bc7aULL, 0xb9543d1e7ULL, 0x5e3de4725ULL, 0xe78bc2a9dULL },
+    { 0xb6f93e6f6ULL, 0xc97f761fdULL, 0x6f67c9f6dULL, 0xbf86efe93ULL },
+    { 0xb89e42fa4ULL, 0x6268fa2abULL, 0x25f42791dULL, 0xd545f1646ULL },
+    { 0xcda8b2a3cULL, 0x83c053d6fULL, 0x3c54d15b3ULL, 0xf6bca03c1ULL },
+    { 0x4c39b19f7ULL, 0xdfb2c094fULL, 0xef98d9c32ULL, 0xf29034dfbULL },
+    { 0xb98126f42ULL, 0x0a5bb24a6ULL, 0x42f64819dULL, 0x6524dda50ULL },
+    { 0x0e0bfab68ULL, 0xaac28f11fULL, 0x16d5fd070ULL, 0xf88f14355ULL },
+    { 0xf2b19d3c6ULL, 0x59bbf6930ULL, 0x63cb98d4fULL, 0x0c96fdd9aULL },
+    { 0x3e4b5c5a2ULL, 0xa23fac199ULL, 0x45a3ad27cULL, 0x99835fc45ULL },
+    { 0x350d692d8ULL, 0xb82a2764cULL, 0x1b496b0acULL, 0x326e4541dULL },
+    { 0xb4238e255ULL, 0x8dcb6e060ULL, 0xaa471c42dULL, 0x06076d3b1ULL },
+    { 0x4562c99a0ULL, 0xb1a48cc03ULL, 0x0599346a2ULL, 0xc0331258dULL },
+    { 0xb438b13b0ULL, 0xd1a8a216dULL, 0x0dc8d1c2dULL, 0xb6845158bULL },
+    { 0x83149192eULL, 0x5090c1733ULL, 0x7498928c1ULL, 0xcce83090aULL },
+    { 0xff0976057ULL, 0xae5b60d7cULL, 0xea06e90ffULL, 0x3eb06da75ULL },
+    { 0x4c55dc16dULL, 0xee87c5b01ULL, 0xb683baa32ULL, 0x80da3e177ULL },
+    { 0x687280c9fULL, 0x47b4698c2ULL, 0xf93014e16ULL, 0x431962de2ULL },
+    { 0x76abaea04ULL, 0x81cb7e81eULL, 0x20575d56eULL, 0x7817ed381ULL },
+    { 0x91aa4c29eULL, 0x21395f468ULL, 0x794325589ULL, 0x162fa9c84ULL },
+    { 0xac997cca8ULL, 0xe223351afULL, 0x1533e9935ULL, 0xf58acc447ULL },
+    { 0x0ed3d1d61ULL, 0xfe8698193ULL, 0x86b8bcb70ULL, 0xc9819617fULL },
+    { 0xbaf5f8873ULL, 0x6f9e34377ULL, 0xce11faf5dULL, 0xeec2c79f6ULL },
+    { 0x18cbd036cULL, 0x2a8edb109ULL, 0x36c0bd318ULL, 0x908db7154ULL },
+    { 0xe688317a7ULL, 0x9430f29bdULL, 0xe5e8c1167ULL, 0xbd94f0c29ULL },
+    { 0x265d8c187ULL, 0xc4b7e4218ULL, 0xe1831ba64ULL, 0x18427ed23ULL },
+    { 0x25fdb1107ULL, 0xd596f070cULL, 0xe088dbfa4ULL, 0x30e0f69abULL },
+    { 0x2e69e2219ULL, 0xa7c62305cULL, 0x984479674ULL, 0x3a0c463e5ULL },
+    { 0x94d40f7f5ULL, 0xdc6dd62e1ULL, 0xafef02b29ULL, 0x8746bb63bULL },
+    { 0x68e318a12ULL, 0x03163e942ULL, 0x48518c716ULL, 0x4297c68c0ULL },
+    { 0x7326a80c2ULL, 0x09b82ce14ULL, 0x4301564ceULL, 0x287341d90ULL },
+    { 0x08e113384ULL, 0x1366d2100ULL, 0x21cc88710ULL, 0x0084b66c8ULL },
+    { 0x1e4a993abULL, 0x96bc8f119ULL, 0xd5c995278ULL, 0x988f13d69ULL },
+    { 0x387be6c1bULL, 0x67df290ceULL, 0xd8367de1cULL, 0x73094fbe6ULL },
+    { 0x17a488a52ULL, 0x899816652ULL, 0x4a51125e8ULL, 0x4a6681991ULL },
+    { 0x644387c88ULL, 0x90e729882ULL, 0x113e1c226ULL, 0x41194e709ULL },
+    { 0x6e07828f7ULL, 0x8ef268a53ULL, 0xef141e076ULL, 0xca5164f71ULL },
+    { 0xb880e9022ULL, 0x329834025ULL, 0x44097011dULL, 0xa402c194cULL },
+    { 0x3e0eb9532ULL, 0x9298ac3ddULL, 0x4ca9d707cULL, 0xbbc351949ULL },
+    { 0x8f8c11b02ULL, 0x92109273aULL, 0x40d8831f1ULL, 0x5ce490849ULL },
+    { 0x1b8dc39bdULL, 0x36ead165bULL, 0xbd9c3b1d8ULL, 0xda68b576cULL },
+    { 0xee826c1e9ULL, 0xae21bd835ULL, 0x978364177ULL, 0xac1bd8475ULL },
+    { 0x95606ef08ULL, 0xa14d874a6ULL, 0x10f7606a9ULL, 0x652e1b285ULL },
+    { 0x50e426562ULL, 0x095d90a85ULL, 0x46a64270aULL, 0xa1509ba90ULL },
+    { 0xd44d8fb42ULL, 0x98df86a2aULL, 0x42df1b22bULL, 0x54561fb19ULL },
+    { 0x054f36097ULL, 0x84774874cULL, 0xe906cf2a0ULL, 0x32e12ee21ULL },
+    { 0xa5f65be99ULL, 0xf5643f7e2ULL, 0x997da6fa5ULL, 0x47efc26afULL },
+    { 0xf64344ea5ULL, 0xa42f6a8b3ULL, 0xa5722c26fULL, 0xcd156f425ULL },
+    { 0x5551af28dULL, 0xd4ef47c04ULL, 0xb14f58aaaULL, 0x203e2f72bULL },
+    { 0x1b5e683f5ULL, 0x6e2cce65dULL, 0xafc167ad8ULL, 0xba6733476ULL },
+    { 0x0676a7decULL, 0xd9e5c9297ULL, 0x37be56e60ULL, 0xe9493a79bULL },
+    { 0x46b01fe7bULL, 0xdd51179d3ULL, 0xde7f80d62ULL, 0xcb9e88abbULL },
+    { 0x2650dfc30ULL, 0xf0c5241d3ULL, 0x0c3fb0a64ULL, 0xcb824a30fULL },
+    { 0x340153173ULL, 0xbc5aa0141ULL, 0xce8ca802cULL, 0x828055a3dULL },
+    { 0xb9b74c0acULL, 0x632b7d621ULL, 0x35032ed9dULL, 0x846bed4c6ULL },
+    { 0x677c5d155ULL, 0xfd05e4f58ULL, 0xaa8ba3ee6ULL, 0x1af27a0bfULL },
+    { 0x3e0e74d29ULL, 0xa609a939fULL, 0x94b2e707cULL, 0xf9c959065ULL },
+    { 0x875bdd7b4ULL, 0xf0a7ce5f9ULL, 0x2debbdae1ULL, 0x9fa73e50fULL },
+    { 0xf3fa47cafULL, 0x757d79cbbULL, 0xf53e25fcfULL, 0xdd39ebeaeULL },
+    { 0xd7c2aac97ULL, 0x84fc5ccf6ULL, 0xe935543ebULL, 0x6f33a3f21ULL },
+    { 0x0970f4628ULL, 0x638503585ULL, 0x1462f0e90ULL, 0xa1ac0a1c6ULL },
+    { 0x318be732aULL, 0x30dbbb40dULL, 0x54ce7d18cULL, 0xb02dddb0cULL },
+    { 0xfa3bf5bb4ULL, 0x73abea97fULL, 0x2ddafdc5fULL, 0xfe957d5ceULL },
+    { 0x77ba6a00eULL, 0xe1587dc1cULL, 0x700565deeULL, 0x383be1a87ULL },
+    { 0xf507102bfULL, 0x843a6bf61ULL, 0xfd408e0afULL, 0x86fd65c21ULL },
+    { 0x37b910be8ULL, 0xc92ab351bULL, 0x17d089decULL, 0xd8acd5493ULL },
+    { 0x9a2457cc1ULL, 0x3f69003b2ULL, 0x833ea2459ULL, 0x4dc0096fcULL },
+    { 0x56eecb13cULL, 0xb1ccdda59ULL, 0x3c8d3776aULL, 0x9a5bb338dULL },
+    { 0x135d77a74ULL, 0x784f4275fULL, 0x2e5eebac8ULL, 0xfae42f21eULL },
+    { 0x0d92fd304ULL, 0xf281de504ULL, 0x20cbf49b0ULL, 0x20a7b814fULL },
+    { 0xed7ae6223ULL, 0xe7d52ac2dULL, 0xc44675eb7ULL, 0xb4354abe7ULL },
+    { 0x8d7d6d25cULL, 0xfb074766cULL, 0x3a4b6beb1ULL, 0x366e2e0dfULL },
+    { 0x783ecf673ULL, 0x7fd92eac9ULL, 0xce6f37c1eULL, 0x935749bfeULL },
+    { 0x3e745dfc6ULL, 0xfb3de6392ULL, 0x63fba2e7cULL, 0x49c67bcdfULL },
+    { 0xbcaada05aULL, 0xabd83d168ULL, 0x5a05b553dULL, 0x168bc1bd5ULL },
+    { 0x0da226148ULL, 0x8b4199404ULL, 0x1286445b0ULL, 0x2029982d1ULL },
+    { 0x86d95e07aULL, 0xe85715179ULL, 0x5e07a9b61ULL, 0x9e8a8ea17ULL },
+    { 0x257e9c1beULL, 0xc1b5ed749ULL, 0x7d8397ea4ULL, 0x92eb7ad83ULL },
+    { 0xddded2101ULL, 0xe6cc98f28ULL, 0x8084b7bbbULL, 0x14f193367ULL },
+    { 0xe901cda0dULL, 0x368367c22ULL, 0xb05b38097ULL, 0x443e6c16cULL },
+    { 0x77980c394ULL, 0xc029f6c58ULL, 0x29c3019eeULL, 0x1a36f9403ULL },
+    { 0xd10e4b8b7ULL, 0x34784ce6bULL, 0xed1d2708bULL, 0xd67321e2cULL },
+    { 0xe2b251fb9ULL, 0x7520bb9f3ULL, 0x9df8a4d47ULL, 0xcf9dd04aeULL },
+    { 0x6c2789127ULL, 0x9792eca01ULL, 0xe4891e436ULL, 0x8053749e9ULL },
+    { 0x4ed546e54ULL, 0xea4752ad2ULL, 0x2a762ab72ULL, 0x4b54ae257ULL },
+    { 0xf0060ef49ULL, 0x0c49afaa2ULL, 0x92f70600fULL, 0x455f59230ULL },
+    { 0xb34594c49ULL, 0x0c8f217b2ULL, 0x92329a2cdULL, 0x4de84f130ULL },
+    { 0xb7630047cULL, 0x890e694f1ULL, 0x3e200c6edULL, 0x8f2967091ULL },
+    { 0x7cc4e5031ULL, 0xb68d30a45ULL, 0x8c0a7233eULL, 0xa250cb16dULL },
+    { 0x560166106ULL, 0xa05bc0814ULL, 0x60866806aULL, 0x28103da05ULL },
+    { 0x524bbbf2fULL, 0x14decf99fULL, 0xf4fddd24aULL, 0xf99f37b28ULL },
+    { 0x8e32621efULL, 0xef70c9035ULL, 0xf78464c71ULL, 0xac0930ef7ULL },
+    { 0x42444bc39ULL, 0x344405ad3ULL, 0x9c3d22242ULL, 0xcb5a0222cULL },
+    { 0x8b657ee1cULL, 0x2347477f6ULL, 0x3877ea6d1ULL, 0x6fee2e2c4ULL },
+    { 0x352ab6547ULL, 0x8dd9e858cULL, 0xe2a6d54acULL, 0x31a179bb1ULL },
+    { 0xe7a54be92ULL, 0xb17236ef2ULL, 0x497d2a5e7ULL, 0x4f76c4e8dULL },
+    { 0x781ef4153ULL, 0x6e99a8b4cULL, 0xca82f781eULL, 0x32d159976ULL },
+    { 0x32f24a812ULL, 0x615c3c052ULL, 0x481524f4cULL, 0x4a03c3a86ULL },
+    { 0x28111077bULL, 0x4e12a31c1ULL, 0xdee088814ULL, 0x838c54872ULL },
+    { 0x25cb4154dULL, 0xbc06f9488ULL, 0xb2a82d3a4ULL, 0x1129f603dULL },
+    { 0xa767f5671ULL, 0xbd872a7f5ULL, 0x8e6afe6e5ULL, 0xafe54e1bdULL },
+    { 0x5ba59e46bULL, 0x0fdb15f91ULL, 0xd6279a5daULL, 0x89fa8dbf0ULL },
+    { 0x583d3e6a2ULL, 0x437b06b8dULL, 0x4567cbc1aULL, 0xb1d60dec2ULL },
+    { 0xbf4d437daULL, 0xba7ea36f8ULL, 0x5bec2b2fdULL, 0x1f6c57e5dULL },
+    { 0xa0a4a2f72ULL, 0x09d0b22e7ULL, 0x4ef452505ULL, 0xe744d0b90ULL },
+    { 0x5d3499b86ULL, 0xd3b8c6f02ULL, 0x61d992cbaULL, 0x40f631dcbULL },
+    { 0xd307d69d5ULL, 0x2cebc8f72ULL, 0xab96be0cbULL, 0x4ef13d734ULL },
+    { 0x9bacf710eULL, 0x33d9d173cULL, 0x708ef35d9ULL, 0x3ce8b9bccULL },
+    { 0xc46cf6fcdULL, 0xade5c3baeULL, 0xb3f6f3623ULL, 0x75dc3a7b5ULL },
+    { 0xb8018d76cULL, 0x1a8be70a1ULL, 0x36eb1801dULL, 0x850e7d158ULL },
+    { 0xe8977fb5dULL, 0x7e43ffb66ULL, 0xbadfee917ULL, 0x66dffc27eULL },
+    { 0x0b3c8dbc5ULL, 0x5fa1c661aULL, 0xa3db13cd0ULL, 0x5866385faULL },
+    { 0x1414858b8ULL, 0xd0a901243ULL, 0x1d1a12828ULL, 0xc2480950bULL },
+    { 0x7368100a4ULL, 0x012c60d19ULL, 0x2500816ceULL, 0x98b063480ULL },
+    { 0x128486ef3ULL, 0x0cf9122d3ULL, 0xcf7612148ULL, 0xcb4489f30ULL },
+    { 0xd2fc567d0ULL, 0x696d92bf8ULL, 0x0be6a3f4bULL, 0x1fd49b696ULL },
+    { 0x5bcf4282eULL, 0x225e59e1bULL, 0x74142f3daULL, 0xd879a7a44ULL },
+    { 0x49b77ba73ULL, 0x7f521ef47ULL, 0xce5deed92ULL, 0xe2f784afeULL },
+    { 0x61e50ca9fULL, 0x053777e42ULL, 0xf9530a786ULL, 0x427eeeca0ULL },
+    { 0x1cdd13e20ULL, 0xd24e1238bULL, 0x047c8bb38ULL, 0xd1c48724bULL },
+    { 0xf117fd53fULL, 0x749bedfe5ULL, 0xfcabfe88fULL, 0xa7fb7d92eULL },
+    { 0x8d335c13dULL, 0xe703cd561ULL, 0xbc83accb1ULL, 0x86ab3c0e7ULL },
+    { 0xf8df9b304ULL, 0x52cefeb28ULL, 0x20cd9fb1fULL, 0x14d7f734aULL },
+    { 0xcd733bc40ULL, 0xdb460cda6ULL, 0x023dcceb3ULL, 0x65b3062dbULL },
+    { 0x231d96979ULL, 0x4cc3a175bULL, 0x9e969b8c4ULL, 0xdae85c332ULL },
+    { 0x2c97b1476ULL, 0xda92783c5ULL, 0x6e28de934ULL, 0xa3c1e495bULL },
+    { 0xe6699c501ULL, 0x8587a49b8ULL, 0x80a399667ULL, 0x1d925e1a1ULL },
+    { 0xb5a1d056eULL, 0xa99af15a1ULL, 0x76a0b85adULL, 0x85a8f5995ULL },
+    { 0x3c7d21584ULL, 0xd32ee028cULL, 0x21a84be3cULL, 0x3140774cbULL },
+    { 0xad140b145ULL, 0xde40e4620ULL, 0xa28d028b5ULL, 0x04627027bULL },
+    { 0xfb096e723ULL, 0x265ba6cbdULL, 0xc4e7690dfULL, 0xbd365da64ULL },
+    { 0x178469bfdULL, 0xbc28d7657ULL, 0xbfd9621e8ULL, 0xea6eb143dULL },
+    { 0x24303d2f6ULL, 0xd93166145ULL, 0x6f4bc0c24ULL, 0xa28668c9bULL },
+    { 0xebd6e7155ULL, 0x7ec5f8e74ULL, 0xaa8e76bd7ULL, 0x2e71fa37eULL },
+    { 0x935baad7bULL, 0x4cde8d4ffULL, 0xdeb55dac9ULL, 0xff2b17b32ULL },
+    { 0xd15f22cddULL, 0x4c6e49eeeULL, 0xbb344fa8bULL, 0x777927632ULL },
+    { 0x37b2d553fULL, 0xf599f95d1ULL, 0xfcaab4decULL, 0x8ba9f99afULL },
+    { 0xd365d5628ULL, 0x318f03fb1ULL, 0x146aba6cbULL, 0x8dfc0f18cULL },
+    { 0x1d76b792fULL, 0xd7ddc9707ULL, 0xf49ed6eb8ULL, 0xe0e93bbebULL },
+    { 0x57b97eabbULL, 0xe57b17d5fULL, 0xdd57e9deaULL, 0xfabe8dea7ULL },
+    { 0x090baba44ULL, 0x1ac24e40eULL, 0x225d5d090ULL, 0x702724358ULL },
+    { 0xa3836176bULL, 0x3c12bb4b5ULL, 0xd6e86c1c5ULL, 0xad2dd483cULL },
+    { 0x9cfa7d9c6ULL, 0xfb3ddc12eULL, 0x639be5f39ULL, 0x7483bbcdfULL },
+    { 0x4c865e7afULL, 0xa671dfb81ULL, 0xf5e7a6132ULL, 0x81dfb8e65ULL },
+    { 0xf90d1694bULL, 0x0e5ba1f2aULL, 0xd2968b09fULL, 0x54f85da70ULL },
+    { 0x785d0cd41ULL, 0x4e0fa4a8aULL, 0x82b30ba1eULL, 0x51525f072ULL },
+    { 0x33625fc01ULL, 0x354d2c592ULL, 0x803fa46ccULL, 0x49a34b2acULL },
+    { 0x00d5f0943ULL, 0x6c9690306ULL, 0xc290fab00ULL, 0x60c096936ULL },
+    { 0xa7b9afb08ULL, 0xd1c3b743eULL, 0x10df59de5ULL, 0x7c2edc38bULL },
+    { 0xdf3b9758aULL, 0xd3fb89db8ULL, 0x51ae9dcfbULL, 0x1db91dfcbULL },
+    { 0xb68a1f592ULL, 0x9079bc1f8ULL, 0x49af8516dULL, 0x1f83d9e09ULL },
+    { 0x67326ad40ULL, 0xe940acc96ULL, 0x02b564ce6ULL, 0x693350297ULL },
+    { 0x07b85a863ULL, 0xed501451bULL, 0xc615a1de0ULL, 0xd8a280ab7ULL },
+    { 0x252619f7fULL, 0x9d10ef7c3ULL, 0xfef9864a4ULL, 0xc3ef708b9ULL },
+    { 0x82ce47683ULL, 0x34751a2b8ULL, 0xc16e27341ULL, 0x1d458ae2cULL },
+    { 0x6ce62179cULL, 0x9324fbac4ULL, 0x39e846736ULL, 0x235df24c9ULL },
+    { 0x62e6dd378ULL, 0x3985bfb51ULL, 0x1ecbb6746ULL, 0x8adfda19cULL },
+    { 0x3e5c0b11aULL, 0xd25ca5258ULL, 0x588d03a7cULL, 0x1a4a53a4bULL },
+    { 0x39f570508ULL, 0x630eb1784ULL, 0x10a0eaf9cULL, 0x21e8d70c6ULL },
+    { 0xd657338e6ULL, 0xd87e48b37ULL, 0x671ccea6bULL, 0xecd127e1bULL },
+    { 0xc062a85ccULL, 0x09a4cd8a4ULL, 0x33a154603ULL, 0x251b32590ULL },
+    { 0x83dc00de5ULL, 0x4c24d06bbULL, 0xa7b003bc1ULL, 0xdd60b2432ULL },
+    { 0xb121c3fa3ULL, 0x35faa24a3ULL, 0xc5fc3848dULL, 0xc52455facULL },
+    { 0xe3950a71eULL, 0x4052f7ef0ULL, 0x78e50a9c7ULL, 0x0f7ef4a02ULL },
+    { 0x711dfdbe8ULL, 0x78aba7f0fULL, 0x17dbfb88eULL, 0xf0fe5d51eULL },
+    { 0x82ab70bf2ULL, 0x29329a17fULL, 0x4fd0ed541ULL, 0xfe8594c94ULL },
+    { 0x5d7b84421ULL, 0xc78f08c89ULL, 0x84221debaULL, 0x91310f1e3ULL },
+    { 0x67ef34c8cULL, 0x812779f9eULL, 0x3132cf7e6ULL, 0x79f9ee481ULL },
+    { 0xca35e7e6dULL, 0x7fc343ab7ULL, 0xb67e7ac53ULL, 0xed5c2c3feULL },
+    { 0x24014d6fbULL, 0xbc33270c1ULL, 0xdf6b28024ULL, 0x830e4cc3dULL },
+    { 0xb7ef9da1eULL, 0x919f7f77aULL, 0x785b9f7edULL, 0x5eefef989ULL },
+    { 0xb04cacbc7ULL, 0x0cbde622eULL, 0xe3d35320dULL, 0x74467bd30ULL },
+    { 0xc1a6039a8ULL, 0x116099e23ULL, 0x159c06583ULL, 0xc47990688ULL },
+    { 0xc50152a3aULL, 0xa05203d63ULL, 0x5c54a80a3ULL, 0xc6bc04a05ULL },
+    { 0xdcca2b2b7ULL, 0x967c5e86dULL, 0xed4d4533bULL, 0xb617a3e69ULL },
+    { 0x5806368f3ULL, 0x0e7908b47ULL, 0xcf16c601aULL, 0xe2d109e70ULL },
+    { 0x8bdf7297aULL, 0x6a569977fULL, 0x5e94efbd1ULL, 0xfee996a56ULL },
+    { 0x7648e1abaULL, 0xb0bc2385fULL, 0x5d587126eULL, 0xfa1c43d0dULL },
+    { 0xe014f4f77ULL, 0x6c91e2be7ULL, 0xeef2f2807ULL, 0xe7d478936ULL },
+    { 0x71aa3cf90ULL, 0x0129bedceULL, 0x09f3c558eULL, 0x73b7d9480ULL },
+    { 0x9cabf36ceULL, 0xbbfa5b1acULL, 0x736cfd539ULL, 0x358da5fddULL },
+    { 0x8754495afULL, 0xf434c56b1ULL, 0xf5a922ae1ULL, 0x8d6a32c2fULL },
+    { 0x9a99d5472ULL, 0x7a9b101f9ULL, 0x4e2ab9959ULL, 0x9f808d95eULL },
+    { 0xe72cbb456ULL, 0x99d064ffcULL, 0x6a2dd34e7ULL, 0x3ff260b99ULL },
+    { 0xc4b0cb931ULL, 0xf5c094863ULL, 0x8c9d30d23ULL, 0xc612903afULL },
+    { 0x89ed045d7ULL, 0x0f37d06e8ULL, 0xeba20b791ULL, 0x1760becf0ULL },
+    { 0xc7a90a3abULL, 0x857297c39ULL, 0xd5c5095e3ULL, 0x9c3e94ea1ULL },
+    { 0x415aebc42ULL, 0x78d40cc8eULL, 0x423d75a82ULL, 0x713302b1eULL },
+    { 0x7f55d7302ULL, 0xf2dfa2f10ULL, 0x40cebaafeULL, 0x08f45fb4fULL },
+    { 0x114b107a6ULL, 0x003eca589ULL, 0x65e08d288ULL, 0x91a537c00ULL },
+    { 0xe6eb6f274ULL, 0xb9477e87dULL, 0x2e4f6d767ULL, 0xbe17ee29dULL },
+    { 0x84f4b087fULL, 0xcd9451367ULL, 0xfe10d2f21ULL, 0xe6c8a29b3ULL },
+    { 0x5bde2c088ULL, 0x422d1de1cULL, 0x110347bdaULL, 0x387b8b442ULL },
+    { 0xcdfd95c27ULL, 0xd79750fabULL, 0xe43a9bfb3ULL, 0xd5f0ae9ebULL },
+    { 0x33c1257b3ULL, 0x143fb24d5ULL, 0xcdea483ccULL, 0xab24dfc28ULL },
+    { 0x631b478dfULL, 0x7c7369c5aULL, 0xfb1e2d8c6ULL, 0x5a396ce3eULL },
+    { 0xe5ef5051bULL, 0xa516b9fe8ULL, 0xd8a0af7a7ULL, 0x17f9d68a5ULL },
+    { 0x418da0becULL, 0x08a2d3e0fULL, 0x37d05b182ULL, 0xf07cb4510ULL },
+    { 0xc1b8248b1ULL, 0x452110c6fULL, 0x8d1241d83ULL, 0xf630884a2ULL },
+    { 0x76de5785bULL, 0xfc5d39b5aULL, 0xda1ea7b6eULL, 0x5ad9cba3fULL },
+    { 0xdbc957da6ULL, 0x327fd0dbbULL, 0x65bea93dbULL, 0xddb0bfe4cULL },
+    { 0xcae1f4054ULL, 0x2b8750974ULL, 0x2a02f8753ULL, 0x2e90ae1d4ULL },
+    { 0x914c242a2ULL, 0x003d0262dULL, 0x454243289ULL, 0xb4640bc00ULL },
+    { 0x45a3d0a82ULL, 0xa1b21ad02ULL, 0x4150bc5a2ULL, 0x40b584d85ULL },
+    { 0x889a7d5ddULL, 0x7e21dd1ecULL, 0xbbabe5911ULL, 0x378bb847eULL },
+    { 0x9a3db3d32ULL, 0x53da803ffULL, 0x4cbcdbc59ULL, 0xffc015bcaULL },
+    { 0xd02c8670fULL, 0x05d9c3aa8ULL, 0xf0e61340bULL, 0x155c39ba0ULL },
+    { 0x157b3450cULL, 0xc10fc958cULL, 0x30a2cdea8ULL, 0x31a93f083ULL },
+    { 0x890d375baULL, 0x1273817edULL, 0x5daecb091ULL, 0xb7e81ce48ULL },
+    { 0x891bc93baULL, 0x72b28f469ULL, 0x5dc93d891ULL, 0x962f14d4eULL },
+    { 0x8a02d80a3ULL, 0x26b00c131ULL, 0xc501b4051ULL, 0x8c8300d64ULL },
+    { 0x1e5df341eULL, 0xf2de413dcULL, 0x782cfba78ULL, 0x3bc827b4fULL },
+    { 0x786d89832ULL, 0x139e24a4bULL, 0x4c191b61eULL, 0xd252479c8ULL },
+    { 0xacf7e47edULL, 0xefa7fb2a5ULL, 0xb7e27ef35ULL, 0xa54dfe5f7ULL },
+    { 0x1c16e25a0ULL, 0xe2e888285ULL, 0x05a476838ULL, 0xa14111747ULL },
+    { 0x2ea9040d9ULL, 0x8f2331058ULL, 0x9b0209574ULL, 0x1a08cc4f1ULL },
+    { 0xf3268aee5ULL, 0x0de86eeb3ULL, 0xa775164cfULL, 0xcd77617b0ULL },
+    { 0x80e84bccbULL, 0x3d74150aaULL, 0xd33d21701ULL, 0x550a82ebcULL },
+    { 0xa2bed3f5cULL, 0x79c0fb3faULL, 0x3afcb7d45ULL, 0x5fcdf039eULL },
+    { 0xb3ac04fb2ULL, 0x0139b26fbULL, 0x4df2035cdULL, 0xdf64d9c80ULL },
+    { 0x845981192ULL, 0xd0b680068ULL, 0x498819a21ULL, 0x160016d0bULL },
+    { 0x60a79fc94ULL, 0x11e37cbc2ULL, 0x293f9e506ULL, 0x43d3ec788ULL },
+    { 0x138ffac59ULL, 0x2cca1d7deULL, 0x9a35ff1c8ULL, 0x7beb85334ULL },
+    { 0xd67d70903ULL, 0xe51e80b3eULL, 0xc090ebe6bULL, 0x7cd0178a7ULL },
+    { 0x2b8aa0f25ULL, 0x0680fa49fULL, 0xa4f0551d4ULL, 0xf925f0160ULL },
+    { 0x2983b03baULL, 0x02b2bb545ULL, 0x5dc0dc194ULL, 0xa2add4d40ULL },
+    { 0x8cd7511c8ULL, 0xfa2699320ULL, 0x1388aeb31ULL, 0x04c99645fULL },
+    { 0x2fde4d02cULL, 0xf2057d619ULL, 0x340b27bf4ULL, 0x986bea04fULL },
+    { 0xd504cf05cULL, 0xb8c945e60ULL, 0x3a0f320abULL, 0x067a2931dULL },
+    { 0xbae7d6990ULL, 0x23efb8372ULL, 0x0996be75dULL, 0x4ec1df7c4ULL },
+    { 0x9cf37ea4dULL, 0xef4f5f126ULL, 0xb257ecf39ULL, 0x648faf2f7ULL },
+    { 0x8f4f61b1eULL, 0xb216cb67eULL, 0x78d86f2f1ULL, 0x7e6d3684dULL },
+    { 0x89ffafce6ULL, 0x5bf75c6afULL, 0x673f5ff91ULL, 0xf563aefdaULL },
+    { 0x7c7eb1ca2ULL, 0xd3bc28b8fULL, 0x4538d7e3eULL, 0xf1d143dcbULL },
+    { 0x96c23da7bULL, 0x9c1d1f177ULL, 0xde5bc4369ULL, 0xee8f8b839ULL },
 };
 
-
-
-static unsigned char DICT_APRILTAG_36h11_BYTES[][4][5] =
-{
-    { {33, 161, 70, 186, 11},
-      {37, 115, 179, 64, 3},
-      {213, 214, 40, 88, 4},
-      {192, 44, 220, 234, 4}
-    },
-    { {146, 209, 143, 233, 11},
-      {84, 255, 23, 15, 2},
-      {217, 127, 24, 180, 9},
-      {79, 14, 143, 242, 10}
-    },
-    { {112, 137, 1, 75, 11},
-      {20, 58, 49, 140, 9},
-      {221, 40, 9, 16, 14},
-      {147, 24, 197, 194, 8}
-    },
-    { {25, 57, 121, 226, 7},
-      {119, 26, 70, 88, 15},
-      {228, 121, 233, 201, 8},
-      {241, 166, 37, 142, 14}
-    },
-    { {68, 21, 61, 61, 7},
-      {220, 51, 198, 180, 4},
-      {235, 203, 202, 130, 2},
-      {34, 214, 60, 195, 11}
-    },
-    { {53, 205, 91, 140, 15},
-      {188, 126, 117, 112, 10},
-      {243, 29, 171, 58, 12},
-      {80, 234, 231, 227, 13}
-    },
-    { {161, 11, 165, 106, 0},
-      {16, 163, 42, 74, 13},
-      {5, 106, 93, 8, 5},
-      {181, 37, 76, 80, 8}
-    },
-    { {43, 135, 74, 96, 8},
-      {34, 66, 63, 105, 0},
-      {16, 101, 46, 29, 4},
-      {9, 111, 196, 36, 4}
-    },
-    { {181, 127, 184, 212, 4},
-      {201, 142, 236, 122, 14},
-      {34, 177, 223, 234, 13},
-      {117, 227, 119, 25, 3}
-    },
-    { {78, 32, 181, 166, 4},
-      {155, 129, 66, 145, 7},
-      {38, 90, 208, 71, 2},
-      {232, 148, 40, 29, 9}
-    },
-    { {97, 216, 151, 242, 12},
-      {80, 197, 243, 216, 11},
-      {52, 254, 145, 184, 6},
-      {209, 188, 250, 48, 10}
-    },
-    { {171, 52, 105, 255, 12},
-      {123, 32, 231, 111, 7},
-      {63, 249, 98, 205, 5},
-      {239, 110, 112, 77, 14}
-    },
-    { {89, 76, 164, 92, 2},
-      {10, 189, 128, 232, 12},
-      {67, 162, 83, 41, 10},
-      {49, 112, 27, 213, 0}
-    },
-    { {250, 28, 45, 46, 2},
-      {90, 57, 38, 163, 13},
-      {71, 75, 67, 133, 15},
-      {188, 86, 73, 197, 10}
-    },
-    { {151, 194, 75, 151, 2},
-      {184, 92, 156, 71, 3},
-      {78, 157, 36, 62, 9},
-      {206, 35, 147, 161, 13}
-    },
-    { {117, 146, 134, 36, 10},
-      {200, 217, 59, 192, 0},
-      {82, 70, 20, 154, 14},
-      {0, 61, 201, 177, 3}
-    },
-    { {28, 170, 254, 153, 10},
-      {163, 249, 157, 20, 14},
-      {89, 151, 245, 83, 8},
-      {114, 139, 153, 252, 5}
-    },
-    { {50, 54, 221, 193, 6},
-      {113, 153, 108, 61, 2},
-      {104, 59, 182, 196, 12},
-      {75, 195, 105, 152, 14}
-    },
-    { {136, 78, 82, 125, 6},
-      {42, 116, 202, 62, 8},
-      {107, 228, 167, 33, 1},
-      {23, 197, 50, 229, 4}
-    },
-    { {87, 113, 168, 199, 14},
-      {201, 158, 69, 205, 7},
-      {126, 49, 88, 238, 10},
-      {235, 58, 39, 153, 3}
-    },
-    { {245, 41, 37, 184, 1},
-      {149, 43, 162, 194, 14},
-      {129, 218, 73, 74, 15},
-      {116, 52, 93, 74, 9}
-    },
-    { {46, 89, 204, 26, 1},
-      {230, 167, 164, 1, 9},
-      {133, 131, 57, 167, 4},
-      {152, 2, 94, 86, 7}
-    },
-    { {127, 165, 138, 179, 1},
-      {135, 202, 182, 229, 3},
-      {140, 213, 26, 95, 14},
-      {202, 118, 213, 62, 1}
-    },
-    { {235, 67, 56, 79, 9},
-      {14, 38, 45, 223, 5},
-      {159, 33, 204, 45, 7},
-      {175, 187, 70, 71, 0}
-    },
-    { {57, 19, 213, 52, 5},
-      {126, 139, 234, 80, 0},
-      {162, 202, 188, 137, 12},
-      {0, 165, 125, 23, 14}
-    },
-    { {215, 155, 26, 59, 5},
-      {196, 106, 222, 215, 9},
-      {173, 197, 141, 158, 11},
-      {158, 183, 181, 98, 3}
-    },
-    { {13, 251, 231, 104, 13},
-      {247, 231, 91, 72, 12},
-      {177, 110, 125, 251, 0},
-      {49, 45, 174, 126, 15}
-    },
-    { {92, 215, 160, 49, 13},
-      {198, 142, 219, 164, 4},
-      {184, 192, 94, 179, 10},
-      {34, 93, 183, 22, 3}
-    },
-    { {185, 200, 247, 164, 11},
-      {62, 221, 51, 82, 14},
-      {210, 94, 241, 57, 13},
-      {116, 172, 203, 183, 12}
-    },
-    { {70, 152, 126, 6, 11},
-      {236, 81, 21, 145, 13},
-      {214, 7, 225, 150, 2},
-      {184, 154, 136, 163, 7}
-    },
-    { {110, 12, 93, 82, 7},
-      {182, 17, 228, 185, 9},
-      {228, 171, 163, 7, 6},
-      {153, 210, 120, 134, 13}
-    },
-    { {91, 197, 103, 187, 4},
-      {50, 111, 210, 229, 7},
-      {45, 222, 106, 61, 10},
-      {234, 116, 191, 100, 12}
-    },
-    { {30, 99, 2, 188, 2},
-      {139, 126, 138, 1, 2},
-      {67, 212, 12, 103, 8},
-      {72, 5, 23, 237, 1}
-    },
-    { {138, 199, 208, 70, 10},
-      {42, 150, 25, 59, 1},
-      {86, 32, 190, 53, 1},
-      {141, 201, 134, 149, 4}
-    },
-    { {166, 95, 226, 50, 6},
-      {224, 214, 234, 35, 13},
-      {100, 196, 127, 166, 5},
-      {188, 69, 118, 176, 7}
-    },
-    { {84, 0, 235, 97, 6},
-      {176, 216, 70, 140, 4},
-      {104, 109, 112, 2, 10},
-      {35, 22, 33, 176, 13}
-    },
-    { {247, 160, 102, 131, 6},
-      {161, 89, 112, 199, 7},
-      {108, 22, 96, 94, 15},
-      {238, 48, 233, 168, 5}
-    },
-    { {45, 208, 175, 223, 6},
-      {218, 245, 244, 76, 7},
-      {111, 191, 80, 187, 4},
-      {227, 34, 250, 245, 11}
-    },
-    { {59, 156, 182, 11, 1},
-      {70, 233, 48, 117, 13},
-      {141, 6, 211, 157, 12},
-      {186, 224, 201, 118, 2}
-    },
-    { {173, 106, 28, 175, 9},
-      {143, 37, 47, 86, 11},
-      {159, 83, 133, 107, 5},
-      {214, 175, 74, 79, 1}
-    },
-    { {147, 182, 46, 251, 5},
-      {69, 105, 222, 111, 7},
-      {173, 247, 70, 220, 9},
-      {239, 103, 185, 106, 2}
-    },
-    { {187, 33, 13, 147, 13},
-      {23, 11, 229, 71, 3},
-      {188, 155, 8, 77, 13},
-      {206, 42, 125, 14, 8}
-    },
-    { {222, 229, 80, 148, 11},
-      {175, 30, 145, 179, 2},
-      {210, 144, 170, 119, 11},
-      {76, 216, 151, 143, 5}
-    },
-    { {160, 205, 20, 121, 11},
-      {4, 55, 179, 62, 8},
-      {217, 226, 139, 48, 5},
-      {23, 204, 222, 194, 0}
-    },
-    { {42, 35, 171, 178, 7},
-      {23, 210, 238, 1, 7},
-      {228, 221, 92, 69, 4},
-      {232, 7, 116, 190, 8}
-    },
-    { {79, 103, 244, 181, 15},
-      {175, 151, 203, 245, 6},
-      {250, 210, 254, 111, 2},
-      {106, 253, 62, 159, 5}
-    },
-    { {88, 168, 21, 129, 8},
-      {19, 9, 17, 148, 10},
-      {24, 26, 129, 81, 10},
-      {82, 152, 137, 12, 8}
-    },
-    { {116, 52, 39, 214, 4},
-      {217, 73, 224, 168, 7},
-      {38, 190, 66, 194, 14},
-      {225, 80, 121, 41, 11}
-    },
-    { {29, 236, 64, 135, 4},
-      {171, 12, 80, 100, 11},
-      {46, 16, 35, 123, 8},
-      {210, 96, 163, 13, 5}
-    },
-    { {137, 42, 179, 160, 2},
-      {19, 208, 10, 82, 14},
-      {64, 92, 213, 73, 1},
-      {116, 165, 0, 188, 8}
-    },
-    { {56, 213, 116, 46, 14},
-      {106, 63, 115, 48, 5},
-      {119, 66, 234, 177, 12},
-      {160, 204, 239, 197, 6}
-    },
-    { {12, 67, 86, 122, 1},
-      {166, 103, 138, 24, 1},
-      {133, 230, 172, 35, 0},
-      {129, 133, 30, 102, 5}
-    },
-    { {93, 179, 17, 203, 1},
-      {215, 42, 24, 220, 3},
-      {141, 56, 140, 219, 10},
-      {195, 177, 133, 78, 11}
-    },
-    { {201, 87, 202, 31, 9},
-      {110, 230, 141, 230, 1},
-      {159, 133, 62, 169, 3},
-      {134, 123, 22, 119, 6}
-    },
-    { {162, 36, 87, 130, 3},
-      {53, 81, 32, 51, 3},
-      {196, 30, 162, 68, 5},
-      {204, 192, 72, 170, 12}
-    },
-    { {41, 172, 233, 143, 3},
-      {63, 176, 52, 100, 15},
-      {207, 25, 115, 89, 4},
-      {242, 98, 192, 223, 12}
-    },
-    { {204, 197, 44, 82, 8},
-      {130, 7, 149, 170, 5},
-      {20, 163, 74, 51, 3},
-      {165, 90, 158, 4, 1}
-    },
-    { {218, 139, 53, 120, 12},
-      {18, 43, 219, 155, 12},
-      {49, 234, 205, 21, 11},
-      {61, 157, 189, 68, 8}
-    },
-    { {213, 180, 185, 227, 6},
-      {209, 152, 86, 254, 7},
-      {108, 121, 210, 218, 11},
-      {231, 246, 161, 152, 11}
-    },
-    { {172, 156, 221, 60, 14},
-      {250, 177, 247, 50, 8},
-      {115, 203, 179, 147, 5},
-      {20, 206, 248, 213, 15}
-    },
-    { {203, 218, 168, 57, 1},
-      {70, 164, 158, 199, 12},
-      {137, 193, 85, 189, 3},
-      {62, 55, 146, 86, 2}
-    },
-    { {25, 134, 37, 107, 1},
-      {22, 41, 26, 108, 5},
-      {141, 106, 70, 25, 8},
-      {163, 101, 137, 70, 8}
-    },
-    { {186, 230, 204, 136, 9},
-      {39, 173, 61, 35, 2},
-      {145, 19, 54, 117, 13},
-      {76, 75, 203, 94, 4}
-    },
-    { {223, 145, 177, 14, 5},
-      {222, 170, 80, 211, 5},
-      {167, 8, 216, 159, 11},
-      {172, 176, 165, 87, 11}
-    },
-    { {161, 169, 213, 167, 5},
-      {61, 131, 114, 86, 11},
-      {174, 90, 185, 88, 5},
-      {214, 164, 236, 27, 12}
-    },
-    { {43, 101, 26, 169, 13},
-      {7, 102, 103, 117, 2},
-      {185, 85, 138, 109, 4},
-      {74, 238, 102, 110, 0}
-    },
-    { {77, 92, 46, 25, 13},
-      {198, 101, 197, 228, 12},
-      {185, 135, 67, 171, 2},
-      {50, 122, 58, 102, 3}
-    },
-    { {91, 22, 55, 54, 11},
-      {94, 89, 139, 241, 5},
-      {214, 206, 198, 141, 10},
-      {168, 253, 25, 167, 10}
-    },
-    { {247, 83, 214, 10, 8},
-      {224, 239, 41, 211, 1},
-      {21, 6, 188, 174, 15},
-      {140, 185, 79, 112, 7}
-    },
-    { {94, 132, 179, 125, 2},
-      {154, 248, 146, 189, 4},
-      {75, 236, 210, 23, 10},
-      {43, 212, 145, 245, 9}
-    },
-    { {252, 228, 58, 159, 2},
-      {139, 124, 180, 182, 7},
-      {79, 149, 194, 115, 15},
-      {230, 210, 211, 237, 1}
-    },
-    { {187, 146, 109, 26, 6},
-      {114, 57, 252, 67, 5},
-      {101, 139, 100, 157, 13},
-      {172, 35, 249, 196, 14}
-    },
-    { {237, 141, 35, 110, 5},
-      {158, 98, 114, 234, 13},
-      {167, 108, 75, 27, 7},
-      {181, 116, 228, 103, 9}
-    },
-    { {106, 248, 70, 243, 7},
-      {103, 85, 242, 141, 11},
-      {236, 246, 33, 245, 6},
-      {219, 20, 250, 174, 6}
-    },
-    { {234, 86, 165, 19, 8},
-      {82, 133, 169, 167, 5},
-      {28, 138, 86, 165, 7},
-      {174, 89, 90, 20, 10}
-    },
-    { {93, 73, 113, 70, 12},
-      {186, 14, 65, 216, 13},
-      {54, 40, 233, 43, 10},
-      {177, 184, 39, 5, 13}
-    },
-    { {71, 3, 96, 236, 10},
-      {168, 50, 11, 201, 6},
-      {83, 112, 108, 14, 2},
-      {105, 61, 4, 193, 5}
-    },
-    { {140, 75, 205, 103, 10},
-      {186, 151, 15, 14, 9},
-      {94, 107, 61, 35, 1},
-      {151, 15, 14, 149, 13}
-    },
-    { {41, 95, 57, 1, 14},
-      {82, 22, 109, 116, 12},
-      {120, 9, 207, 169, 4},
-      {50, 235, 102, 132, 10}
-    },
-    { {246, 181, 119, 233, 7},
-      {245, 123, 114, 191, 6},
-      {233, 126, 234, 214, 15},
-      {111, 212, 237, 234, 15}
-    },
-    { {82, 6, 2, 245, 10},
-      {8, 88, 139, 173, 2},
-      {90, 244, 6, 4, 10},
-      {75, 93, 17, 161, 0}
-    },
-    { {181, 17, 148, 146, 14},
-      {192, 155, 225, 82, 3},
-      {116, 146, 152, 138, 13},
-      {196, 168, 125, 144, 3}
-    },
-    { {72, 226, 153, 171, 7},
-      {23, 180, 94, 148, 3},
-      {237, 89, 148, 113, 2},
-      {194, 151, 162, 222, 8}
-    },
-    { {183, 159, 87, 55, 10},
-      {248, 91, 187, 119, 9},
-      {94, 206, 175, 158, 13},
-      {158, 237, 221, 161, 15}
-    },
-    { {168, 20, 198, 131, 14},
-      {98, 209, 97, 38, 3},
-      {124, 22, 50, 129, 5},
-      {198, 72, 104, 180, 6}
-    },
-    { {45, 169, 0, 88, 3},
-      {135, 50, 176, 72, 8},
-      {193, 160, 9, 91, 4},
-      {17, 32, 212, 206, 1}
-    },
-    { {212, 171, 164, 121, 7},
-      {133, 187, 218, 142, 12},
-      {233, 226, 93, 82, 11},
-      {55, 21, 189, 218, 1}
-    },
-    { {152, 42, 14, 101, 12},
-      {11, 73, 79, 14, 8},
-      {58, 103, 5, 65, 9},
-      {23, 15, 41, 45, 0}
-    },
-    { {244, 128, 204, 193, 5},
-      {164, 137, 116, 142, 2},
-      {168, 51, 48, 18, 15},
-      {71, 18, 233, 18, 5}
-    },
-    { {11, 32, 234, 115, 2},
-      {35, 208, 134, 77, 5},
-      {76, 229, 112, 77, 0},
-      {171, 38, 16, 188, 4}
-    },
-    { {169, 80, 103, 16, 10},
-      {114, 85, 161, 66, 4},
-      {80, 142, 96, 169, 5},
-      {36, 40, 90, 164, 14}
-    },
-    { {4, 134, 226, 238, 1},
-      {172, 224, 26, 40, 7},
-      {135, 116, 118, 18, 0},
-      {225, 69, 128, 115, 5}
-    },
-    { {176, 169, 114, 97, 5},
-      {37, 74, 114, 30, 12},
-      {168, 100, 233, 80, 13},
-      {55, 132, 229, 42, 4}
-    },
-    { {231, 63, 58, 37, 7},
-      {205, 82, 110, 247, 12},
-      {234, 69, 207, 206, 7},
-      {62, 247, 100, 171, 3}
-    },
-    { {23, 226, 5, 185, 8},
-      {145, 45, 155, 69, 2},
-      {25, 218, 4, 126, 8},
-      {74, 45, 155, 72, 9}
-    },
-    { {236, 154, 178, 178, 4},
-      {194, 192, 250, 146, 15},
-      {36, 212, 213, 147, 7},
-      {244, 149, 240, 52, 3}
-    },
-    { {217, 51, 158, 7, 6},
-      {75, 219, 76, 214, 1},
-      {110, 7, 156, 201, 11},
-      {134, 179, 45, 189, 2}
-    },
-    { {235, 136, 116, 249, 9},
-      {38, 33, 179, 223, 14},
-      {153, 242, 225, 29, 7},
-      {127, 188, 216, 70, 4}
-    },
-    { {148, 32, 165, 92, 12},
-      {153, 169, 193, 10, 4},
-      {51, 170, 80, 66, 9},
-      {37, 8, 57, 89, 9}
-    },
-    { {227, 100, 255, 153, 2},
-      {49, 245, 164, 247, 6},
-      {73, 159, 242, 108, 7},
-      {110, 242, 90, 248, 12}
-    },
-    { {138, 76, 184, 240, 10},
-      {2, 148, 135, 59, 14},
-      {80, 241, 211, 37, 1},
-      {125, 206, 18, 148, 0}
-    },
-    { {247, 42, 238, 118, 6},
-      {169, 217, 238, 203, 13},
-      {102, 231, 117, 78, 15},
-      {189, 55, 121, 185, 5}
-    },
-    { {115, 204, 107, 86, 9},
-      {60, 76, 181, 233, 13},
-      {150, 173, 99, 60, 14},
-      {185, 122, 211, 35, 12}
-    },
-    { {201, 156, 166, 165, 9},
-      {78, 193, 19, 230, 14},
-      {154, 86, 83, 153, 3},
-      {118, 124, 136, 55, 2}
-    },
-    { {54, 106, 12, 83, 5},
-      {133, 13, 236, 13, 9},
-      {172, 163, 5, 102, 12},
-      {155, 3, 123, 10, 1}
-    },
-    { {80, 158, 81, 148, 3},
-      {124, 24, 152, 176, 10},
-      {194, 152, 167, 144, 10},
-      {80, 209, 145, 131, 14}
-    },
-    { {186, 109, 34, 125, 1},
-      {15, 110, 162, 47, 12},
-      {139, 228, 75, 101, 13},
-      {63, 68, 87, 111, 0}
-    },
-    { {210, 172, 241, 99, 11},
-      {53, 152, 19, 191, 13},
-      {220, 104, 243, 84, 11},
-      {191, 220, 129, 154, 12}
-    },
-    { {217, 137, 254, 246, 8},
-      {42, 203, 151, 218, 15},
-      {22, 247, 249, 25, 11},
-      {245, 190, 157, 53, 4}
-    },
-    { {100, 23, 7, 187, 2},
-      {208, 115, 170, 164, 3},
-      {77, 222, 14, 130, 6},
-      {194, 85, 92, 224, 11}
-    },
-    { {249, 189, 49, 42, 11},
-      {87, 58, 51, 242, 13},
-      {213, 72, 203, 217, 15},
-      {180, 252, 197, 206, 10}
-    },
-    { {119, 115, 156, 32, 7},
-      {197, 159, 110, 209, 0},
-      {224, 67, 156, 238, 14},
-      {8, 183, 111, 154, 3}
-    },
-    { {104, 191, 141, 27, 15},
-      {87, 179, 253, 164, 9},
-      {253, 139, 31, 209, 6},
-      {146, 91, 252, 222, 10}
-    },
-    { {222, 221, 132, 166, 14},
-      {202, 159, 83, 163, 11},
-      {118, 82, 27, 183, 11},
-      {220, 92, 175, 149, 3}
-    },
-    { {66, 234, 236, 73, 11},
-      {37, 181, 29, 141, 12},
-      {217, 35, 117, 116, 2},
-      {59, 27, 138, 218, 4}
-    },
-    { {48, 43, 104, 213, 3},
-      {45, 26, 172, 12, 14},
-      {202, 177, 109, 64, 12},
-      {115, 3, 85, 139, 4}
-    },
-    { {78, 187, 147, 12, 14},
-      {219, 242, 89, 145, 8},
-      {115, 12, 157, 215, 2},
-      {24, 153, 164, 253, 11}
-    },
-    { {67, 156, 93, 155, 5},
-      {116, 33, 212, 245, 11},
-      {173, 155, 163, 156, 2},
-      {218, 242, 184, 66, 14}
-    },
-    { {225, 252, 146, 40, 13},
-      {69, 228, 115, 242, 8},
-      {177, 68, 147, 248, 7},
-      {20, 252, 226, 122, 2}
-    },
-    { {248, 166, 168, 212, 10},
-      {11, 152, 189, 170, 6},
-      {82, 177, 86, 81, 15},
-      {101, 91, 209, 157, 0}
-    },
-    { {181, 57, 2, 161, 8},
-      {193, 74, 35, 70, 10},
-      {24, 84, 9, 202, 13},
-      {86, 44, 69, 40, 3}
-    },
-    { {177, 99, 71, 94, 14},
-      {57, 127, 233, 74, 1},
-      {119, 174, 44, 104, 13},
-      {133, 41, 127, 233, 12}
-    },
-    { {173, 47, 90, 242, 9},
-      {167, 66, 175, 122, 11},
-      {148, 245, 175, 75, 5},
-      {213, 239, 84, 46, 5}
-    },
-    { {170, 181, 220, 133, 0},
-      {107, 131, 52, 55, 2},
-      {10, 19, 186, 213, 5},
-      {78, 194, 204, 29, 6}
-    },
-    { {179, 236, 37, 120, 6},
-      {17, 61, 242, 107, 12},
-      {97, 234, 67, 124, 13},
-      {61, 100, 251, 200, 8}
-    },
-    { {71, 153, 196, 64, 5},
-      {228, 131, 80, 201, 8},
-      {160, 34, 57, 158, 2},
-      {25, 48, 172, 18, 7}
-    },
-    { {139, 198, 141, 192, 4},
-      {18, 133, 92, 107, 2},
-      {32, 59, 22, 61, 1},
-      {77, 99, 170, 20, 8}
-    },
-    { {112, 47, 21, 221, 14},
-      {25, 59, 233, 188, 10},
-      {123, 186, 143, 64, 14},
-      {83, 217, 125, 201, 8}
-    },
-    { {180, 34, 147, 218, 9},
-      {149, 232, 169, 26, 3},
-      {149, 188, 148, 66, 13},
-      {197, 137, 81, 122, 9}
-    },
-    { {26, 202, 208, 56, 2},
-      {34, 188, 154, 17, 8},
-      {65, 192, 181, 53, 8},
-      {24, 133, 147, 212, 4}
-    },
-    { {129, 51, 99, 151, 1},
-      {125, 66, 136, 70, 7},
-      {142, 156, 108, 200, 1},
-      {230, 33, 20, 43, 14}
-    },
-    { {14, 105, 42, 215, 0},
-      {139, 70, 132, 13, 15},
-      {14, 181, 73, 103, 0},
-      {251, 2, 22, 45, 1}
-    },
-    { {138, 208, 92, 91, 9},
-      {102, 37, 149, 31, 1},
-      {157, 163, 160, 181, 1},
-      {143, 138, 154, 70, 6}
-    },
-    { {133, 230, 84, 193, 11},
-      {165, 21, 25, 126, 2},
-      {216, 50, 166, 122, 1},
-      {71, 233, 138, 138, 5}
-    },
-    { {61, 10, 194, 179, 11},
-      {166, 216, 171, 68, 11},
-      {220, 212, 53, 11, 12},
-      {210, 45, 81, 182, 5}
-    },
-    { {75, 191, 160, 85, 2},
-      {75, 146, 152, 237, 12},
-      {74, 160, 95, 221, 2},
-      {59, 113, 148, 157, 2}
-    },
-    { {114, 45, 222, 48, 6},
-      {33, 219, 230, 177, 8},
-      {96, 199, 187, 68, 14},
-      {24, 214, 125, 184, 4}
-    },
-    { {54, 157, 26, 205, 2},
-      {200, 122, 52, 61, 10},
-      {75, 53, 139, 150, 12},
-      {91, 194, 197, 225, 3}
-    },
-    { {162, 217, 148, 230, 0},
-      {72, 135, 50, 27, 11},
-      {6, 114, 153, 180, 5},
-      {221, 132, 206, 17, 2}
-    },
-    { {95, 173, 145, 57, 13},
-      {151, 170, 211, 245, 8},
-      {185, 200, 155, 95, 10},
-      {26, 252, 181, 94, 9}
-    },
-    { {87, 83, 90, 233, 6},
-      {224, 126, 78, 221, 2},
-      {105, 117, 172, 174, 10},
-      {75, 183, 39, 224, 7}
-    },
-    { {95, 94, 241, 212, 6},
-      {250, 156, 200, 249, 14},
-      {98, 184, 247, 175, 10},
-      {121, 241, 51, 149, 15}
-    },
-    { {235, 195, 230, 172, 12},
-      {42, 231, 123, 195, 6},
-      {51, 86, 124, 61, 7},
-      {108, 61, 238, 117, 4}
-    },
-    { {10, 153, 200, 53, 13},
-      {110, 130, 215, 5, 8},
-      {186, 193, 57, 149, 0},
-      {26, 14, 180, 23, 6}
-    },
-    { {84, 99, 228, 154, 5},
-      {165, 175, 200, 128, 7},
-      {165, 146, 124, 98, 10},
-      {224, 17, 63, 90, 5}
-    },
-    { {37, 103, 104, 147, 10},
-      {161, 22, 173, 100, 7},
-      {92, 145, 110, 106, 4},
-      {226, 107, 86, 136, 5}
-    },
-    { {171, 237, 55, 6, 4},
-      {27, 71, 112, 115, 13},
-      {38, 14, 203, 125, 5},
-      {188, 224, 238, 45, 8}
-    },
-    { {89, 189, 222, 217, 4},
-      {99, 235, 212, 252, 10},
-      {41, 183, 187, 217, 10},
-      {83, 242, 189, 124, 6}
-    },
-    { {100, 250, 4, 192, 9},
-      {197, 5, 57, 136, 10},
-      {144, 50, 5, 242, 6},
-      {81, 25, 202, 10, 3}
-    },
-    { {37, 14, 68, 231, 5},
-      {172, 1, 106, 108, 11},
-      {174, 114, 39, 10, 4},
-      {211, 101, 104, 3, 5}
-    },
-    { {229, 138, 55, 75, 12},
-      {144, 97, 121, 222, 13},
-      {61, 46, 197, 26, 7},
-      {183, 185, 232, 96, 9}
-    },
-    { {36, 202, 165, 116, 1},
-      {156, 133, 186, 8, 12},
-      {130, 234, 85, 50, 4},
-      {49, 5, 218, 19, 9}
-    },
-    { {228, 44, 246, 88, 8},
-      {161, 225, 161, 186, 12},
-      {17, 166, 243, 66, 7},
-      {53, 216, 88, 120, 5}
-    },
-    { {110, 162, 56, 83, 8},
-      {131, 0, 189, 157, 5},
-      {28, 161, 196, 87, 6},
-      {171, 155, 208, 12, 1}
-    },
-    { {247, 88, 19, 2, 5},
-      {212, 76, 96, 211, 9},
-      {164, 12, 129, 174, 15},
-      {156, 176, 99, 34, 11}
-    },
-    { {12, 235, 51, 187, 13},
-      {151, 102, 219, 20, 15},
-      {189, 220, 205, 115, 0},
-      {242, 141, 182, 110, 9}
-    },
-    { {120, 106, 232, 103, 0},
-      {43, 140, 46, 140, 13},
-      {14, 97, 117, 97, 14},
-      {179, 23, 67, 29, 4}
-    },
-    { {240, 222, 140, 150, 9},
-      {76, 141, 189, 162, 11},
-      {150, 147, 23, 176, 15},
-      {212, 91, 219, 19, 2}
-    },
-    { {38, 200, 30, 254, 6},
-      {136, 117, 246, 25, 11},
-      {103, 247, 129, 54, 4},
-      {217, 134, 250, 225, 1}
-    },
-    { {105, 244, 137, 8, 6},
-      {83, 180, 116, 224, 0},
-      {97, 9, 18, 249, 6},
-      {0, 114, 226, 220, 10}
-    },
-    { {63, 191, 146, 164, 13},
-      {207, 202, 123, 113, 10},
-      {178, 84, 159, 223, 12},
-      {88, 237, 229, 63, 3}
-    },
-    { {214, 85, 90, 118, 0},
-      {232, 78, 134, 187, 1},
-      {6, 229, 170, 166, 11},
-      {141, 214, 23, 33, 7}
-    },
-    { {156, 202, 226, 54, 13},
-      {174, 204, 219, 2, 13},
-      {182, 196, 117, 51, 9},
-      {180, 13, 179, 55, 5}
-    },
-    { {178, 86, 193, 106, 3},
-      {116, 188, 42, 43, 1},
-      {197, 104, 54, 164, 13},
-      {141, 69, 67, 210, 14}
-    },
-    { {215, 138, 199, 34, 1},
-      {180, 201, 26, 195, 9},
-      {132, 78, 53, 30, 11},
-      {156, 53, 137, 50, 13}
-    },
-    { {45, 193, 254, 38, 2},
-      {170, 215, 54, 80, 5},
-      {70, 71, 248, 59, 4},
-      {160, 166, 206, 181, 5}
-    },
-    { {175, 32, 81, 9, 0},
-      {179, 32, 32, 87, 0},
-      {9, 8, 160, 79, 5},
-      {14, 160, 64, 76, 13}
-    },
-    { {147, 44, 8, 175, 14},
-      {9, 56, 71, 103, 11},
-      {127, 81, 3, 76, 9},
-      {222, 110, 33, 201, 0}
-    },
-    { {83, 254, 202, 119, 5},
-      {109, 204, 222, 237, 9},
-      {174, 229, 55, 252, 10},
-      {155, 119, 179, 59, 6}
-    },
-    { {93, 41, 36, 151, 10},
-      {139, 27, 129, 196, 15},
-      {94, 146, 73, 75, 10},
-      {242, 56, 29, 141, 1}
-    },
-    { {47, 16, 26, 34, 11},
-      {198, 80, 39, 81, 1},
-      {212, 69, 128, 143, 4},
-      {136, 174, 64, 166, 3}
-    },
-    { {198, 173, 22, 177, 4},
-      {129, 67, 210, 183, 10},
-      {40, 214, 139, 86, 3},
-      {94, 212, 188, 40, 1}
-    },
-    { {210, 236, 164, 178, 0},
-      {1, 141, 146, 163, 15},
-      {4, 210, 83, 116, 11},
-      {252, 84, 155, 24, 0}
-    },
-    { {166, 250, 96, 61, 4},
-      {233, 36, 250, 7, 12},
-      {43, 192, 101, 246, 5},
-      {62, 5, 242, 73, 7}
-    },
-    { {48, 87, 195, 182, 9},
-      {124, 206, 171, 32, 3},
-      {150, 220, 62, 160, 12},
-      {192, 77, 87, 51, 14}
-    },
-    { {232, 23, 181, 77, 2},
-      {90, 179, 40, 190, 4},
-      {75, 42, 222, 129, 7},
-      {39, 209, 76, 213, 10}
-    },
-    { {64, 171, 252, 62, 0},
-      {41, 163, 158, 144, 13},
-      {7, 195, 253, 80, 2},
-      {176, 151, 156, 89, 4}
-    },
-    { {245, 58, 209, 110, 7},
-      {253, 184, 106, 218, 9},
-      {231, 104, 181, 202, 15},
-      {149, 181, 97, 219, 15}
-    },
-    { {54, 243, 160, 110, 8},
-      {201, 174, 59, 9, 5},
-      {23, 96, 92, 246, 12},
-      {169, 13, 199, 89, 3}
-    },
-    { {39, 120, 46, 65, 8},
-      {193, 69, 37, 77, 12},
-      {24, 39, 65, 238, 4},
-      {59, 42, 74, 40, 3}
-    },
-    { {62, 144, 98, 20, 6},
-      {234, 88, 240, 1, 4},
-      {98, 132, 96, 151, 12},
-      {40, 0, 241, 165, 7}
-    },
-    { {1, 253, 122, 212, 14},
-      {105, 86, 213, 120, 14},
-      {114, 181, 235, 248, 0},
-      {113, 234, 182, 169, 6}
-    },
-    { {200, 118, 91, 198, 4},
-      {123, 68, 76, 186, 3},
-      {38, 61, 166, 225, 3},
-      {197, 211, 34, 45, 14}
-    },
-    { {173, 61, 130, 21, 15},
-      {207, 210, 225, 102, 8},
-      {250, 132, 27, 203, 5},
-      {22, 104, 116, 191, 3}
-    },
-    { {150, 49, 122, 39, 14},
-      {233, 90, 71, 23, 5},
-      {126, 69, 232, 198, 9},
-      {174, 142, 37, 169, 7}
-    },
-    { {5, 248, 19, 202, 6},
-      {209, 116, 80, 88, 11},
-      {101, 60, 129, 250, 0},
-      {209, 160, 162, 232, 11}
-    },
-    { {14, 122, 220, 34, 14},
-      {227, 149, 79, 17, 9},
-      {116, 67, 181, 231, 0},
-      {152, 143, 42, 156, 7}
-    },
-    { {191, 82, 196, 165, 0},
-      {234, 141, 42, 71, 2},
-      {10, 82, 52, 175, 13},
-      {78, 37, 75, 21, 7}
-    },
-    { {114, 79, 106, 226, 14},
-      {32, 94, 111, 169, 15},
-      {116, 117, 111, 36, 14},
-      {249, 95, 103, 160, 4}
-    },
-    { {84, 15, 215, 234, 8},
-      {176, 235, 11, 184, 11},
-      {21, 126, 191, 2, 10},
-      {209, 221, 13, 112, 13}
-    },
-    { {156, 150, 47, 116, 1},
-      {222, 73, 158, 42, 4},
-      {130, 239, 70, 147, 9},
-      {37, 71, 153, 39, 11}
-    },
-    { {38, 64, 66, 176, 1},
-      {164, 68, 162, 1, 2},
-      {128, 212, 32, 38, 4},
-      {72, 4, 82, 34, 5}
-    },
-    { {25, 124, 183, 117, 4},
-      {91, 205, 194, 124, 12},
-      {42, 238, 211, 233, 8},
-      {51, 228, 59, 61, 10}
-    },
-    { {31, 43, 184, 80, 13},
-      {135, 138, 205, 89, 12},
-      {176, 161, 221, 79, 8},
-      {57, 171, 53, 30, 1}
-    },
-    { {200, 125, 108, 42, 13},
-      {103, 39, 71, 162, 13},
-      {181, 67, 107, 225, 3},
-      {180, 94, 46, 78, 6}
-    },
-    { {220, 141, 45, 237, 14},
-      {154, 59, 87, 174, 14},
-      {123, 123, 75, 19, 11},
-      {119, 94, 173, 197, 9}
-    },
-    { {203, 107, 1, 115, 8},
-      {19, 6, 139, 207, 9},
-      {28, 232, 13, 109, 3},
-      {159, 61, 22, 12, 8}
-    },
-    { {190, 66, 16, 54, 8},
-      {138, 12, 171, 19, 1},
-      {22, 192, 132, 39, 13},
-      {140, 141, 83, 5, 1}
-    },
-    { {187, 70, 34, 167, 7},
-      {14, 92, 106, 103, 7},
-      {238, 84, 70, 45, 13},
-      {238, 101, 99, 167, 0}
-    },
-    { {115, 50, 38, 239, 8},
-      {73, 105, 43, 205, 7},
-      {31, 118, 68, 204, 14},
-      {235, 61, 73, 105, 2}
-    },
-    { {73, 51, 173, 227, 9},
-      {87, 131, 15, 204, 7},
-      {156, 123, 92, 201, 2},
-      {227, 63, 12, 30, 10}
-    },
-    { {31, 28, 137, 108, 7},
-      {222, 184, 70, 105, 8},
-      {227, 105, 19, 143, 8},
-      {25, 102, 33, 215, 11}
-    },
-    { {137, 118, 101, 171, 10},
-      {115, 53, 11, 102, 7},
-      {93, 90, 102, 233, 1},
-      {230, 109, 10, 204, 14}
-    },
-    { {146, 244, 107, 161, 2},
-      {113, 92, 22, 39, 6},
-      {72, 93, 98, 244, 9},
-      {110, 70, 131, 168, 14}
-    },
-    { {41, 121, 129, 118, 7},
-      {95, 150, 226, 72, 9},
-      {230, 232, 25, 233, 4},
-      {145, 36, 118, 159, 10}
-    },
-    { {173, 112, 44, 248, 13},
-      {199, 37, 231, 74, 6},
-      {177, 243, 64, 235, 5},
-      {101, 46, 122, 78, 3}
-    },
-    { {71, 49, 152, 185, 0},
-      {193, 162, 134, 213, 2},
-      {9, 209, 152, 206, 2},
-      {74, 182, 20, 88, 3}
-    },
-    { {236, 46, 142, 6, 11},
-      {143, 209, 45, 162, 9},
-      {214, 7, 23, 67, 7},
-      {148, 91, 72, 191, 1}
-    },
-    { {54, 161, 214, 152, 0},
-      {161, 235, 176, 17, 2},
-      {1, 150, 184, 86, 12},
-      {72, 128, 221, 120, 5}
-    },
-    { {165, 206, 134, 80, 15},
-      {132, 213, 249, 106, 8},
-      {240, 166, 23, 58, 5},
-      {21, 105, 250, 178, 1}
-    },
-    { {99, 120, 112, 52, 8},
-      {105, 4, 163, 209, 12},
-      {18, 192, 225, 236, 6},
-      {56, 188, 82, 9, 6}
-    },
-    { {243, 171, 65, 212, 6},
-      {57, 26, 248, 203, 10},
-      {98, 184, 45, 92, 15},
-      {93, 49, 245, 137, 12}
-    },
-    { {230, 3, 42, 139, 5},
-      {132, 98, 108, 135, 7},
-      {173, 21, 76, 6, 7},
-      {238, 19, 100, 98, 1}
-    },
-    { {76, 17, 238, 199, 3},
-      {238, 211, 4, 140, 7},
-      {206, 55, 120, 131, 2},
-      {227, 18, 12, 183, 7}
-    },
-    { {38, 29, 229, 13, 6},
-      {248, 179, 96, 37, 12},
-      {107, 10, 123, 134, 4},
-      {58, 64, 108, 209, 15}
-    },
-    { {41, 102, 22, 227, 2},
-      {3, 85, 42, 124, 3},
-      {76, 118, 134, 105, 4},
-      {195, 229, 74, 172, 0}
-    },
-    { {55, 207, 241, 160, 10},
-      {176, 158, 59, 113, 14},
-      {80, 88, 255, 62, 12},
-      {120, 237, 199, 144, 13}
-    },
-    { {196, 87, 132, 122, 11},
-      {196, 183, 139, 170, 1},
-      {213, 226, 30, 162, 3},
-      {133, 93, 30, 210, 3}
-    },
-    { {119, 110, 82, 255, 9},
-      {173, 108, 171, 253, 11},
-      {159, 244, 167, 110, 14},
-      {219, 253, 83, 107, 5}
-    },
-    { {152, 8, 25, 187, 9},
-      {22, 40, 135, 22, 11},
-      {157, 217, 129, 1, 9},
-      {214, 142, 17, 70, 8}
-    },
-    { {80, 203, 43, 93, 8},
-      {24, 110, 157, 140, 12},
-      {27, 173, 77, 48, 10},
-      {51, 27, 151, 97, 8}
-    },
-    { {139, 105, 24, 6, 3},
-      {15, 22, 4, 83, 9},
-      {198, 1, 137, 109, 1},
-      {156, 162, 6, 143, 0}
-    },
-    { {18, 217, 194, 206, 9},
-      {108, 238, 17, 9, 11},
-      {151, 52, 57, 180, 8},
-      {217, 8, 135, 115, 6}
-    },
-    { {21, 140, 46, 115, 8},
-      {128, 73, 151, 108, 13},
-      {28, 231, 67, 26, 8},
-      {179, 110, 153, 32, 1}
-    },
-    { {107, 132, 1, 94, 10},
-      {26, 48, 177, 233, 1},
-      {87, 168, 2, 29, 6},
-      {137, 120, 208, 197, 8}
-    },
-    { {103, 105, 93, 185, 15},
-      {181, 55, 231, 213, 10},
-      {249, 219, 169, 110, 6},
-      {90, 190, 126, 202, 13}
-    },
-    { {62, 114, 116, 92, 1},
-      {239, 45, 168, 25, 4},
-      {131, 162, 228, 231, 12},
-      {41, 129, 91, 79, 7}
-    },
-    { {1, 202, 26, 87, 1},
-      {12, 68, 156, 92, 9},
-      {142, 165, 133, 56, 0},
-      {147, 163, 146, 35, 0}
-    },
-    { {34, 231, 3, 111, 5},
-      {29, 102, 122, 45, 1},
-      {175, 108, 14, 116, 4},
-      {139, 69, 230, 107, 8}
-    },
-    { {213, 220, 237, 174, 1},
-      {252, 173, 22, 226, 15},
-      {135, 91, 115, 186, 11},
-      {244, 118, 139, 83, 15}
-    },
-    { {128, 149, 50, 197, 11},
-      {76, 82, 17, 62, 6},
-      {218, 52, 202, 144, 1},
-      {103, 200, 132, 163, 2}
-    },
-    { {247, 228, 233, 213, 4},
-      {185, 140, 244, 239, 6},
-      {42, 185, 114, 126, 15},
-      {111, 114, 243, 25, 13}
-    },
-    { {89, 216, 79, 156, 11},
-      {126, 125, 149, 192, 10},
-      {211, 159, 33, 185, 10},
-      {80, 58, 155, 231, 14}
-    },
-    { {244, 46, 208, 133, 1},
-      {173, 136, 40, 182, 10},
-      {138, 16, 183, 66, 15},
-      {86, 209, 65, 27, 5}
-    },
-    { {93, 180, 169, 31, 10},
-      {219, 184, 149, 228, 5},
-      {95, 137, 82, 219, 10},
-      {162, 122, 145, 221, 11}
-    },
-    { {13, 88, 229, 177, 15},
-      {246, 149, 195, 68, 14},
-      {248, 218, 113, 171, 0},
-      {114, 44, 58, 150, 15}
-    },
-    { {105, 251, 159, 164, 3},
-      {95, 215, 62, 208, 10},
-      {194, 95, 157, 249, 6},
-      {80, 183, 206, 191, 10}
-    },
-    { {41, 186, 81, 246, 0},
-      {123, 0, 186, 88, 11},
-      {6, 248, 165, 217, 4},
-      {209, 165, 208, 13, 14}
-    },
-    { {88, 124, 103, 66, 7},
-      {119, 93, 64, 168, 13},
-      {228, 46, 99, 225, 10},
-      {177, 80, 43, 174, 14}
-    },
-    { {216, 185, 2, 30, 13},
-      {79, 106, 209, 130, 9},
-      {183, 132, 9, 209, 11},
-      {148, 24, 181, 111, 2}
-    },
-    { {187, 89, 68, 73, 14},
-      {98, 63, 97, 79, 8},
-      {121, 34, 41, 173, 13},
-      {31, 40, 111, 196, 6}
-    },
-    { {170, 35, 31, 53, 10},
-      {27, 83, 175, 23, 0},
-      {90, 207, 140, 69, 5},
-      {14, 143, 92, 173, 8}
-    },
-    { {13, 149, 148, 63, 4},
-      {202, 163, 210, 116, 1},
-      {47, 194, 154, 155, 0},
-      {130, 228, 188, 85, 3}
-    },
-    { {222, 196, 97, 37, 7},
-      {190, 28, 82, 167, 4},
-      {234, 72, 98, 55, 11},
-      {46, 84, 163, 135, 13}
-    },
-    { {5, 161, 105, 48, 13},
-      {181, 2, 215, 64, 4},
-      {176, 201, 104, 90, 0},
-      {32, 46, 180, 10, 13}
-    },
-    { {226, 81, 46, 181, 8},
-      {72, 71, 167, 135, 6},
-      {26, 215, 72, 164, 7},
-      {110, 30, 94, 33, 2}
-    },
-    { {171, 72, 226, 220, 0},
-      {42, 228, 160, 75, 14},
-      {3, 180, 113, 45, 5},
-      {125, 32, 82, 117, 4}
-    },
-    { {12, 182, 132, 148, 15},
-      {207, 145, 217, 32, 2},
-      {242, 146, 22, 211, 0},
-      {64, 73, 184, 159, 3}
-    },
-    { {146, 122, 107, 91, 1},
-      {117, 108, 140, 15, 13},
-      {141, 173, 101, 228, 9},
-      {191, 3, 19, 106, 14}
-    },
-    { {187, 144, 243, 69, 0},
-      {122, 200, 48, 95, 4},
-      {10, 44, 240, 157, 13},
-      {47, 160, 193, 53, 14}
-    },
-    { {99, 46, 143, 173, 0},
-      {25, 225, 46, 229, 10},
-      {11, 95, 23, 76, 6},
-      {90, 119, 72, 121, 8}
-    },
-    { {194, 238, 175, 42, 7},
-      {21, 245, 94, 163, 13},
-      {229, 79, 87, 116, 3},
-      {188, 87, 170, 250, 8}
-    },
-    { {30, 178, 175, 57, 13},
-      {215, 233, 223, 5, 4},
-      {185, 207, 84, 215, 8},
-      {42, 15, 185, 126, 11}
-    },
-    { {81, 21, 72, 197, 2},
-      {104, 26, 4, 236, 2},
-      {74, 49, 42, 136, 10},
-      {67, 114, 5, 129, 6}
-    },
-    { {70, 147, 213, 222, 4},
-      {248, 163, 216, 153, 3},
-      {39, 186, 188, 150, 2},
-      {201, 145, 188, 81, 15}
-    },
-    { {136, 142, 145, 97, 13},
-      {22, 128, 91, 62, 8},
-      {184, 104, 151, 17, 1},
-      {23, 205, 160, 22, 8}
-    },
-    { {104, 131, 111, 244, 15},
-      {62, 83, 255, 136, 6},
-      {242, 255, 108, 17, 6},
-      {97, 31, 252, 167, 12}
-    },
-    { {81, 189, 46, 68, 1},
-      {77, 75, 20, 232, 12},
-      {130, 39, 75, 216, 10},
-      {49, 114, 141, 43, 2}
-    },
-    { {122, 10, 196, 14, 9},
-      {46, 169, 41, 129, 9},
-      {151, 2, 53, 5, 14},
-      {152, 25, 73, 87, 4}
-    },
-    { {139, 183, 98, 180, 10},
-      {107, 82, 155, 99, 6},
-      {82, 212, 110, 221, 1},
-      {108, 109, 148, 173, 6}
-    },
-    { {28, 175, 131, 161, 10},
-      {147, 218, 27, 36, 10},
-      {88, 92, 31, 83, 8},
-      {82, 77, 133, 188, 9}
-    },
-    { {194, 112, 11, 187, 13},
-      {85, 100, 199, 135, 3},
-      {189, 221, 0, 228, 3},
-      {206, 30, 50, 106, 10}
-    },
-    { {251, 46, 208, 154, 10},
-      {35, 184, 169, 243, 11},
-      {85, 144, 183, 77, 15},
-      {220, 249, 81, 220, 4}
-    },
-    { {248, 82, 2, 148, 14},
-      {74, 92, 233, 130, 2},
-      {114, 148, 4, 161, 15},
-      {68, 25, 115, 165, 2}
-    },
-    { {122, 161, 4, 202, 6},
-      {3, 59, 112, 137, 3},
-      {101, 50, 8, 85, 14},
-      {201, 16, 237, 204, 0}
-    },
-    { {106, 150, 210, 188, 11},
-      {110, 240, 187, 177, 2},
-      {211, 212, 182, 149, 6},
-      {72, 221, 208, 247, 6}
-    },
-    { {40, 242, 236, 117, 14},
-      {107, 149, 255, 12, 4},
-      {122, 227, 116, 241, 4},
-      {35, 15, 250, 157, 6}
-    },
-    { {96, 112, 101, 235, 4},
-      {113, 37, 98, 140, 7},
-      {45, 122, 96, 224, 6},
-      {227, 20, 106, 72, 14}
-    },
-    { {122, 217, 179, 168, 12},
-      {82, 238, 115, 145, 14},
-      {49, 92, 217, 181, 14},
-      {120, 156, 231, 116, 10}
-    },
-    { {53, 114, 214, 203, 15},
-      {229, 253, 105, 92, 3},
-      {253, 54, 180, 234, 12},
-      {195, 169, 107, 250, 7}
-    },
-    { {212, 38, 239, 184, 15},
-      {181, 249, 207, 162, 6},
-      {241, 223, 118, 66, 11},
-      {100, 95, 57, 250, 13}
-    },
-    { {100, 238, 77, 186, 10},
-      {177, 53, 191, 160, 11},
-      {85, 219, 39, 114, 6},
-      {208, 95, 218, 200, 13}
-    },
-    { {152, 61, 122, 143, 1},
-      {111, 106, 4, 54, 15},
-      {143, 21, 235, 193, 9},
-      {246, 194, 5, 111, 6}
-    },
-    { {140, 163, 31, 73, 9},
-      {151, 99, 29, 30, 0},
-      {153, 47, 140, 83, 1},
-      {7, 139, 140, 110, 9}
-    },
-    { {2, 84, 87, 180, 6},
-      {120, 85, 194, 49, 2},
-      {98, 222, 162, 164, 0},
-      {72, 196, 58, 161, 14}
-    },
-    { {213, 58, 228, 20, 9},
-      {237, 137, 137, 194, 12},
-      {146, 130, 117, 202, 11},
-      {52, 57, 25, 27, 7}
-    },
-    { {157, 60, 100, 57, 6},
-      {227, 57, 194, 102, 12},
-      {105, 194, 99, 203, 9},
-      {54, 100, 57, 204, 7}
-    },
-    { {121, 83, 50, 238, 5},
-      {78, 110, 106, 216, 7},
-      {167, 116, 204, 169, 14},
-      {225, 181, 103, 103, 2}
-    },
-    { {112, 136, 77, 102, 4},
-      {56, 9, 118, 136, 9},
-      {38, 107, 33, 16, 14},
-      {145, 22, 233, 1, 12}
-    },
-    { {29, 211, 82, 141, 8},
-      {234, 110, 25, 84, 2},
-      {27, 20, 172, 187, 8},
-      {66, 169, 135, 101, 7}
-    },
-    { {216, 229, 29, 36, 6},
-      {27, 31, 86, 178, 0},
-      {98, 75, 138, 113, 11},
-      {4, 214, 175, 141, 8}
-    },
-    { {214, 2, 156, 163, 8},
-      {128, 137, 15, 151, 3},
-      {28, 83, 148, 6, 11},
-      {206, 159, 9, 16, 1}
-    },
-    { {217, 74, 182, 16, 12},
-      {2, 205, 201, 210, 12},
-      {48, 134, 213, 41, 11},
-      {52, 185, 59, 52, 0}
-    },
-    { {118, 107, 184, 136, 0},
-      {129, 174, 44, 145, 14},
-      {1, 17, 221, 102, 14},
-      {120, 147, 71, 88, 1}
-    },
-    { {253, 12, 107, 49, 9},
-      {182, 72, 167, 230, 12},
-      {152, 205, 99, 11, 15},
-      {54, 126, 81, 38, 13}
-    },
-    { {59, 255, 139, 157, 1},
-      {95, 238, 188, 101, 10},
-      {139, 157, 31, 253, 12},
-      {90, 99, 215, 127, 10}
-    },
-    { {231, 134, 244, 212, 14},
-      {168, 145, 249, 251, 6},
-      {114, 178, 246, 30, 7},
-      {109, 249, 248, 145, 5}
-    },
-    { {212, 230, 185, 183, 9},
-      {157, 140, 159, 182, 7},
-      {158, 217, 214, 114, 11},
-      {230, 223, 147, 27, 9}
-    },
-    { {207, 168, 187, 54, 9},
-      {159, 192, 151, 211, 13},
-      {150, 205, 209, 95, 3},
-      {188, 190, 144, 63, 9}
-    },
-    { {32, 164, 54, 108, 6},
-      {9, 113, 114, 56, 4},
-      {99, 102, 194, 80, 4},
-      {33, 196, 232, 233, 0}
-    },
-    { {92, 239, 185, 83, 6},
-      {147, 158, 220, 188, 13},
-      {108, 169, 223, 115, 10},
-      {179, 211, 183, 156, 9}
-    },
-    { {15, 6, 182, 96, 5},
-      {134, 193, 74, 121, 4},
-      {160, 102, 214, 15, 0},
-      {41, 229, 40, 54, 1}
-    },
-    { {187, 81, 210, 94, 7},
-      {110, 254, 224, 91, 1},
-      {231, 164, 184, 173, 13},
-      {141, 160, 119, 247, 6}
-    },
-    { {247, 226, 98, 100, 1},
-      {173, 76, 58, 203, 4},
-      {130, 100, 100, 126, 15},
-      {45, 53, 195, 43, 5}
-    },
-    { {129, 253, 169, 133, 5},
-      {93, 134, 84, 102, 14},
-      {170, 25, 91, 248, 1},
-      {118, 98, 166, 27, 10}
-    },
-    { {34, 65, 219, 197, 9},
-      {60, 198, 37, 29, 2},
-      {154, 61, 184, 36, 4},
-      {75, 138, 70, 51, 12}
-    },
-    { {86, 251, 75, 40, 0},
-      {241, 110, 30, 129, 8},
-      {1, 77, 45, 246, 10},
-      {24, 23, 135, 104, 15}
-    },
-    { {237, 166, 76, 109, 0},
-      {171, 33, 62, 238, 0},
-      {11, 99, 38, 91, 7},
-      {7, 119, 200, 77, 5}
-    },
-    { {206, 123, 8, 15, 4},
-      {203, 38, 76, 135, 9},
-      {47, 1, 13, 231, 3},
-      {158, 19, 38, 77, 3}
-    },
-    { {97, 146, 238, 126, 9},
-      {108, 225, 191, 200, 5},
-      {151, 231, 116, 152, 6},
-      {161, 63, 216, 115, 6}
-    },
-    { {148, 63, 245, 18, 4},
-      {241, 139, 200, 50, 13},
-      {36, 138, 255, 194, 9},
-      {180, 193, 61, 24, 15}
-    },
-    { {136, 179, 190, 173, 15},
-      {79, 243, 95, 22, 6},
-      {251, 87, 220, 209, 1},
-      {102, 143, 172, 255, 2}
-    },
-    { {155, 39, 229, 141, 0},
-      {59, 171, 8, 103, 6},
-      {11, 26, 126, 77, 9},
-      {110, 97, 13, 93, 12}
-    },
-    { {190, 11, 69, 253, 2},
-      {186, 59, 170, 15, 10},
-      {75, 250, 45, 7, 13},
-      {95, 5, 93, 197, 13}
-    },
-    { {105, 251, 58, 114, 10},
-      {67, 86, 191, 216, 13},
-      {84, 229, 205, 249, 6},
-      {177, 191, 214, 172, 2}
-    },
-    { {97, 56, 58, 131, 2},
-      {65, 80, 36, 212, 15},
-      {76, 21, 193, 200, 6},
-      {242, 178, 64, 168, 2}
-    },
-    { {102, 136, 99, 155, 3},
-      {180, 112, 176, 133, 15},
-      {205, 156, 97, 22, 6},
-      {250, 16, 208, 226, 13}
-    },
-    { {84, 208, 28, 153, 2},
-      {192, 61, 148, 148, 2},
-      {73, 147, 128, 178, 10},
-      {66, 146, 155, 192, 3}
-    },
-    { {144, 177, 12, 2, 10},
-      {65, 27, 21, 2, 1},
-      {84, 3, 8, 208, 9},
-      {132, 10, 141, 136, 2}
-    },
-    { {246, 103, 252, 109, 1},
-      {173, 175, 46, 191, 4},
-      {139, 99, 254, 102, 15},
-      {47, 215, 79, 91, 5}
-    },
-    { {122, 205, 117, 129, 3},
-      {54, 31, 48, 181, 14},
-      {200, 26, 235, 53, 14},
-      {122, 208, 207, 134, 12}
-    },
-    { {58, 189, 7, 246, 1},
-      {95, 75, 178, 41, 11},
-      {134, 254, 11, 213, 12},
-      {217, 68, 221, 47, 10}
-    },
-    { {84, 48, 18, 71, 3},
-      {205, 88, 0, 156, 1},
-      {206, 36, 128, 194, 10},
-      {131, 144, 1, 171, 3}
-    },
-    { {6, 119, 148, 213, 8},
-      {201, 135, 137, 61, 2},
-      {26, 178, 158, 230, 0},
-      {75, 201, 30, 25, 3}
-    },
-    { {168, 85, 177, 32, 1},
-      {86, 134, 34, 50, 4},
-      {128, 72, 218, 161, 5},
-      {36, 196, 70, 22, 10}
-    },
-    { {156, 180, 215, 253, 11},
-      {255, 249, 147, 62, 2},
-      {219, 254, 178, 211, 9},
-      {71, 204, 153, 255, 15}
-    },
-    { {49, 161, 147, 230, 10},
-      {25, 218, 51, 88, 3},
-      {86, 124, 152, 88, 12},
-      {193, 172, 197, 185, 8}
-    },
-    { {61, 163, 183, 109, 4},
-      {155, 235, 122, 92, 4},
-      {43, 110, 220, 91, 12},
-      {35, 165, 237, 125, 9}
-    },
-    { {65, 83, 241, 224, 4},
-      {112, 134, 74, 216, 6},
-      {32, 120, 252, 168, 2},
-      {97, 181, 38, 16, 14}
-    },
-    { {85, 68, 51, 91, 5},
-      {148, 108, 192, 252, 5},
-      {173, 172, 194, 42, 10},
-      {163, 240, 51, 98, 9}
-    },
-    { {146, 246, 18, 73, 13},
-      {69, 108, 89, 63, 0},
-      {185, 36, 134, 244, 9},
-      {15, 201, 163, 106, 2}
-    },
-    { {38, 154, 53, 248, 10},
-      {208, 49, 187, 25, 14},
-      {81, 250, 197, 150, 4},
-      {121, 141, 216, 192, 11}
-    },
-    { {4, 38, 119, 137, 6},
-      {177, 113, 72, 52, 6},
-      {105, 30, 230, 66, 0},
-      {98, 193, 40, 232, 13}
-    },
-    { {148, 135, 205, 198, 15},
-      {188, 155, 93, 42, 3},
-      {246, 59, 62, 18, 9},
-      {197, 75, 173, 147, 13}
-    },
-    { {78, 167, 231, 217, 12},
-      {179, 227, 217, 173, 6},
-      {57, 190, 126, 87, 2},
-      {107, 89, 188, 124, 13}
-    },
-    { {46, 54, 115, 69, 11},
-      {255, 80, 41, 61, 4},
-      {218, 44, 230, 199, 4},
-      {43, 201, 64, 175, 15}
-    },
-    { {58, 94, 143, 48, 4},
-      {82, 205, 238, 33, 8},
-      {32, 207, 23, 165, 12},
-      {24, 71, 123, 52, 10}
-    },
-    { {118, 217, 250, 167, 7},
-      {236, 222, 118, 149, 15},
-      {238, 85, 249, 182, 14},
-      {250, 150, 231, 179, 7}
-    },
-    { {100, 228, 234, 29, 15},
-      {173, 244, 245, 164, 4},
-      {251, 133, 114, 114, 6},
-      {34, 90, 242, 251, 5}
-    },
-    { {18, 167, 180, 52, 13},
-      {13, 139, 219, 49, 4},
-      {178, 194, 222, 84, 8},
-      {40, 205, 189, 27, 0}
-    },
-    { {73, 115, 217, 85, 3},
-      {127, 150, 140, 220, 0},
-      {202, 169, 188, 233, 2},
-      {3, 179, 22, 159, 14}
-    },
-    { {205, 180, 24, 151, 5},
-      {207, 0, 212, 246, 3},
-      {174, 145, 130, 219, 3},
-      {198, 242, 176, 15, 3}
-    },
-    { {139, 218, 118, 210, 14},
-      {98, 85, 217, 91, 15},
-      {116, 182, 229, 189, 1},
-      {253, 169, 186, 164, 6}
-    },
-    { {245, 74, 77, 236, 8},
-      {184, 45, 47, 202, 10},
-      {19, 123, 37, 42, 15},
-      {85, 63, 75, 65, 13}
-    },
-    { {129, 22, 22, 248, 10},
-      {64, 113, 139, 122, 2},
-      {81, 246, 134, 136, 1},
-      {69, 237, 24, 224, 2}
-    },
-    { {64, 54, 244, 230, 11},
-      {109, 145, 11, 184, 7},
-      {214, 114, 246, 192, 2},
-      {225, 221, 8, 155, 6}
-    },
-    { {39, 54, 40, 42, 6},
-      {193, 48, 110, 97, 5},
-      {101, 65, 70, 206, 4},
-      {168, 103, 96, 200, 3}
-    },
-    { {164, 19, 210, 41, 15},
-      {228, 242, 107, 22, 0},
-      {249, 68, 188, 130, 5},
-      {6, 141, 100, 242, 7}
-    },
-    { {144, 31, 228, 193, 7},
-      {100, 155, 72, 46, 14},
-      {232, 50, 127, 128, 9},
-      {119, 65, 45, 146, 6}
-    },
-    { {154, 191, 206, 86, 14},
-      {107, 219, 221, 43, 9},
-      {118, 167, 63, 213, 9},
-      {157, 75, 189, 189, 6}
-    },
-    { {45, 50, 91, 158, 15},
-      {255, 112, 237, 80, 3},
-      {247, 157, 164, 203, 4},
-      {192, 171, 112, 239, 15}
-    },
-    { {217, 144, 31, 106, 9},
-      {86, 105, 23, 218, 1},
-      {149, 111, 128, 153, 11},
-      {133, 190, 137, 102, 10}
-    },
-    { {58, 166, 79, 173, 14},
-      {59, 121, 127, 37, 2},
-      {123, 95, 38, 85, 12},
-      {74, 79, 233, 237, 12}
-    },
-    { {101, 40, 141, 96, 11},
-      {149, 145, 39, 200, 8},
-      {208, 107, 17, 74, 6},
-      {17, 62, 72, 154, 9}
-    },
-    { {10, 83, 233, 96, 11},
-      {118, 150, 15, 9, 4},
-      {208, 105, 124, 165, 0},
-      {41, 15, 6, 150, 14}
-    },
-    { {233, 224, 156, 62, 4},
-      {11, 165, 246, 210, 1},
-      {39, 195, 144, 121, 7},
-      {132, 182, 250, 93, 0}
-    },
-    { {77, 155, 120, 99, 13},
-      {230, 2, 95, 220, 13},
-      {188, 97, 237, 155, 2},
-      {179, 191, 164, 6, 7}
-    },
-    { {217, 139, 180, 131, 3},
-      {6, 155, 24, 214, 15},
-      {204, 18, 221, 25, 11},
-      {246, 177, 141, 150, 0}
-    },
-    { {52, 177, 129, 237, 7},
-      {221, 186, 114, 12, 2},
-      {235, 120, 24, 210, 12},
-      {67, 4, 229, 219, 11}
-    },
-    { {91, 55, 63, 73, 0},
-      {83, 107, 12, 253, 4},
-      {9, 47, 206, 205, 10},
-      {43, 243, 13, 108, 10}
-    },
-    { {133, 114, 183, 185, 1},
-      {213, 229, 138, 86, 6},
-      {137, 222, 212, 234, 1},
-      {102, 165, 26, 122, 11}
-    },
-    { {44, 93, 5, 106, 4},
-      {210, 39, 98, 40, 9},
-      {37, 106, 11, 163, 4},
-      {145, 68, 110, 68, 11}
-    },
-    { {228, 103, 18, 150, 13},
-      {141, 70, 233, 178, 3},
-      {182, 148, 142, 98, 7},
-      {196, 217, 118, 43, 1}
-    },
-    { {42, 8, 214, 247, 8},
-      {42, 193, 163, 29, 11},
-      {30, 246, 177, 5, 4},
-      {219, 140, 88, 53, 4}
-    },
-    { {69, 41, 73, 198, 1},
-      {189, 2, 4, 200, 11},
-      {134, 57, 41, 74, 2},
-      {209, 50, 4, 11, 13}
-    },
-    { {37, 1, 236, 91, 7},
-      {164, 179, 228, 76, 5},
-      {237, 163, 120, 10, 4},
-      {163, 34, 124, 210, 5}
-    },
-    { {184, 245, 71, 121, 12},
-      {115, 111, 243, 46, 0},
-      {57, 238, 42, 241, 13},
-      {7, 76, 255, 108, 14}
-    },
-    { {163, 183, 234, 75, 3},
-      {101, 242, 60, 111, 5},
-      {205, 37, 126, 220, 5},
-      {175, 99, 196, 250, 6}
-    },
-    { {68, 61, 107, 155, 4},
-      {241, 98, 196, 164, 15},
-      {45, 157, 107, 194, 2},
-      {242, 82, 52, 104, 15}
-    },
-    { {190, 45, 203, 132, 8},
-      {187, 202, 37, 35, 10},
-      {18, 29, 59, 71, 13},
-      {92, 74, 69, 61, 13}
-    },
-    { {181, 31, 196, 126, 12},
-      {232, 171, 235, 106, 9},
-      {55, 226, 63, 138, 13},
-      {149, 109, 125, 81, 7}
-    },
-    { {111, 56, 207, 152, 8},
-      {243, 225, 165, 193, 10},
-      {17, 159, 49, 207, 6},
-      {88, 58, 88, 124, 15}
-    },
-    { {144, 242, 254, 147, 4},
-      {97, 205, 220, 22, 7},
-      {44, 151, 244, 240, 9},
-      {230, 131, 187, 56, 6}
-    },
-    { {7, 253, 84, 10, 11},
-      {229, 55, 17, 113, 9},
-      {213, 2, 171, 254, 0},
-      {152, 232, 142, 202, 7}
-    },
-    { {238, 83, 195, 208, 8},
-      {242, 198, 169, 139, 2},
-      {16, 188, 60, 167, 7},
-      {77, 25, 86, 52, 15}
-    },
-    { {247, 9, 142, 188, 10},
-      {136, 251, 167, 195, 10},
-      {83, 215, 25, 14, 15},
-      {92, 62, 93, 241, 1}
-    },
-    { {101, 70, 124, 48, 9},
-      {164, 5, 175, 240, 4},
-      {144, 195, 230, 42, 6},
-      {32, 255, 90, 2, 5}
-    },
-    { {174, 111, 215, 151, 14},
-      {187, 215, 233, 55, 11},
-      {126, 158, 191, 103, 5},
-      {222, 201, 126, 189, 13}
-    },
-    { {139, 196, 115, 158, 9},
-      {62, 100, 145, 115, 7},
-      {151, 156, 226, 61, 1},
-      {236, 232, 146, 103, 12}
-    },
-    { {151, 25, 48, 254, 4},
-      {200, 42, 194, 91, 15},
-      {39, 240, 201, 142, 9},
-      {253, 164, 53, 65, 3}
-    },
-    { {154, 117, 45, 245, 7},
-      {95, 31, 198, 47, 6},
-      {234, 251, 74, 229, 9},
-      {111, 70, 63, 143, 10}
-    },
-    { {189, 71, 254, 83, 14},
-      {162, 223, 237, 126, 5},
-      {124, 167, 254, 43, 13},
-      {167, 235, 127, 180, 5}
-    },
-    { {111, 21, 48, 146, 8},
-      {194, 2, 161, 241, 7},
-      {20, 144, 202, 143, 6},
-      {232, 248, 84, 4, 3}
-    },
-    { {93, 225, 204, 72, 9},
-      {167, 175, 21, 200, 0},
-      {145, 35, 56, 123, 10},
-      {1, 58, 143, 94, 5}
-    },
-    { {17, 28, 227, 220, 13},
-      {124, 232, 193, 104, 14},
-      {179, 188, 115, 136, 8},
-      {113, 104, 49, 115, 14}
-    },
-    { {164, 199, 225, 87, 12},
-      {184, 134, 249, 46, 5},
-      {62, 168, 126, 50, 5},
-      {167, 73, 246, 17, 13}
-    },
-    { {85, 38, 145, 17, 2},
-      {145, 152, 136, 244, 0},
-      {72, 136, 150, 74, 10},
-      {2, 241, 17, 152, 9}
-    },
-    { {157, 101, 17, 128, 5},
-      {151, 14, 64, 114, 2},
-      {160, 24, 138, 107, 9},
-      {68, 224, 39, 14, 9}
-    },
-    { {102, 99, 193, 203, 3},
-      {181, 182, 40, 141, 3},
-      {205, 56, 60, 102, 6},
-      {203, 17, 70, 218, 13}
-    },
-    { {191, 197, 148, 0, 2},
-      {130, 159, 48, 115, 0},
-      {64, 2, 154, 63, 13},
-      {12, 224, 207, 148, 1}
-    },
-    { {58, 53, 0, 56, 7},
-      {71, 58, 226, 33, 0},
-      {225, 192, 10, 197, 12},
-      {8, 68, 117, 206, 2}
-    },
-    { {118, 212, 246, 121, 12},
-      {224, 237, 243, 189, 4},
-      {57, 230, 242, 182, 14},
-      {43, 220, 251, 112, 7}
-    },
-    { {68, 111, 38, 103, 11},
-      {141, 87, 11, 172, 13},
-      {222, 102, 79, 98, 2},
-      {179, 93, 14, 171, 1}
-    },
-    { {23, 174, 89, 233, 7},
-      {181, 56, 94, 125, 10},
-      {233, 121, 167, 94, 8},
-      {91, 231, 161, 202, 13}
-    },
-    { {54, 19, 45, 99, 14},
-      {208, 27, 111, 13, 5},
-      {124, 107, 76, 134, 12},
-      {171, 15, 109, 128, 11}
-    },
-    { {142, 7, 73, 43, 15},
-      {182, 50, 79, 39, 1},
-      {253, 73, 46, 7, 1},
-      {142, 79, 36, 198, 13}
-    },
-    { {24, 138, 205, 223, 1},
-      {62, 169, 156, 12, 11},
-      {143, 187, 53, 17, 8},
-      {211, 3, 153, 87, 12}
-    },
-    { {237, 144, 82, 208, 2},
-      {226, 80, 176, 218, 2},
-      {64, 180, 160, 155, 7},
-      {69, 176, 208, 164, 7}
-    },
-    { {91, 107, 208, 31, 5},
-      {47, 174, 200, 213, 9},
-      {175, 128, 189, 109, 10},
-      {154, 177, 55, 95, 4}
-    },
-    { {132, 164, 208, 112, 14},
-      {161, 144, 211, 58, 0},
-      {112, 224, 178, 82, 1},
-      {5, 204, 176, 152, 5}
-    },
-    { {201, 178, 163, 175, 4},
-      {91, 224, 90, 198, 7},
-      {47, 92, 84, 217, 3},
-      {230, 53, 160, 125, 10}
-    },
-    { {171, 24, 133, 47, 12},
-      {90, 161, 99, 71, 9},
-      {63, 74, 17, 141, 5},
-      {158, 44, 104, 85, 10}
-    },
-    { {157, 233, 24, 57, 0},
-      {131, 46, 150, 86, 8},
-      {9, 193, 137, 123, 9},
-      {22, 166, 151, 76, 1}
-    },
-    { {53, 118, 238, 158, 0},
-      {233, 237, 172, 96, 7},
-      {7, 151, 118, 234, 12},
-      {224, 99, 91, 121, 7}
-    },
-    { {232, 208, 13, 33, 0},
-      {82, 5, 54, 134, 0},
-      {8, 75, 0, 177, 7},
-      {6, 22, 202, 4, 10}
-    },
-    { {112, 155, 90, 149, 12},
-      {104, 74, 253, 148, 10},
-      {58, 149, 173, 144, 14},
-      {82, 155, 245, 33, 6}
-    },
-    { {169, 2, 42, 49, 4},
-      {2, 64, 238, 70, 4},
-      {40, 197, 68, 9, 5},
-      {38, 39, 112, 36, 0}
-    },
-    { {160, 62, 162, 185, 12},
-      {65, 224, 235, 38, 14},
-      {57, 212, 87, 192, 5},
-      {118, 77, 112, 120, 2}
-    },
-    { {30, 88, 158, 197, 14},
-      {202, 221, 69, 29, 10},
-      {122, 55, 145, 167, 8},
-      {91, 138, 43, 181, 3}
-    },
-    { {116, 71, 14, 237, 13},
-      {140, 111, 111, 172, 2},
-      {187, 119, 14, 34, 14},
-      {67, 95, 111, 99, 1}
-    },
-    { {54, 189, 68, 21, 9},
-      {237, 11, 177, 37, 8},
-      {154, 130, 43, 214, 12},
-      {26, 72, 221, 11, 7}
-    },
-    { {183, 248, 210, 81, 6},
-      {225, 220, 240, 95, 8},
-      {104, 164, 177, 254, 13},
-      {31, 160, 243, 184, 7}
-    },
-    { {220, 222, 75, 250, 5},
-      {246, 108, 222, 170, 11},
-      {165, 253, 39, 179, 11},
-      {213, 87, 179, 102, 15}
-    },
-    { {158, 218, 153, 195, 0},
-      {210, 140, 28, 31, 11},
-      {12, 57, 149, 183, 9},
-      {223, 131, 131, 20, 11}
-    },
-    { {143, 251, 152, 168, 11},
-      {199, 182, 31, 83, 10},
-      {209, 81, 157, 255, 1},
-      {92, 175, 134, 222, 3}
-    },
-    { {154, 199, 119, 231, 1},
-      {62, 79, 26, 63, 7},
-      {142, 126, 238, 53, 9},
-      {239, 197, 143, 39, 12}
-    },
-    { {141, 10, 83, 203, 3},
-      {182, 112, 8, 94, 11},
-      {205, 60, 165, 11, 1},
-      {215, 161, 0, 230, 13}
-    },
-    { {201, 237, 29, 206, 13},
-      {31, 39, 85, 250, 11},
-      {183, 59, 139, 121, 3},
-      {213, 250, 174, 79, 8}
-    },
-    { {194, 56, 83, 94, 10},
-      {121, 112, 129, 155, 9},
-      {87, 172, 161, 196, 3},
-      {157, 152, 16, 233, 14}
-    },
-    { {238, 74, 166, 67, 7},
-      {134, 213, 104, 143, 13},
-      {236, 38, 85, 39, 7},
-      {191, 17, 106, 182, 1}
-    },
-    { {205, 131, 69, 161, 14},
-      {178, 19, 91, 198, 2},
-      {120, 90, 44, 27, 3},
-      {70, 61, 172, 132, 13}
-    },
-    { {90, 25, 224, 90, 14},
-      {98, 186, 193, 137, 13},
-      {117, 160, 121, 133, 10},
-      {185, 24, 53, 212, 6}
-    },
-    { {150, 215, 128, 210, 5},
-      {196, 142, 216, 43, 3},
-      {164, 176, 30, 182, 9},
-      {205, 65, 183, 18, 3}
-    },
-    { {226, 200, 133, 24, 5},
-      {20, 165, 240, 131, 8},
-      {161, 138, 17, 52, 7},
-      {28, 16, 250, 82, 8}
-    },
-    { {197, 49, 79, 141, 11},
-      {253, 115, 5, 198, 2},
-      {219, 31, 40, 202, 3},
-      {70, 58, 12, 235, 15}
-    },
-    { {164, 124, 55, 238, 1},
-      {221, 101, 34, 58, 15},
-      {135, 126, 195, 226, 5},
-      {245, 196, 74, 107, 11}
-    },
-    { {29, 130, 198, 248, 12},
-      {162, 233, 219, 72, 2},
-      {49, 246, 52, 27, 8},
-      {65, 45, 185, 116, 5}
-    },
-    { {50, 92, 92, 108, 8},
-      {104, 45, 39, 57, 8},
-      {19, 99, 163, 164, 12},
-      {25, 206, 75, 65, 6}
-    },
-    { {93, 157, 27, 174, 0},
-      {218, 106, 22, 240, 11},
-      {7, 93, 139, 155, 10},
-      {208, 246, 133, 101, 11}
-    },
-    { {149, 73, 224, 117, 14},
-      {168, 158, 195, 78, 12},
-      {122, 224, 121, 42, 9},
-      {55, 44, 55, 145, 5}
-    },
-    { {138, 104, 69, 193, 5},
-      {55, 5, 64, 15, 10},
-      {168, 58, 33, 101, 1},
-      {95, 0, 42, 14, 12}
-    },
-    { {173, 249, 241, 15, 14},
-      {251, 182, 113, 86, 13},
-      {127, 8, 249, 251, 5},
-      {182, 168, 230, 221, 15}
-    },
-    { {149, 206, 243, 11, 0},
-      {176, 236, 24, 118, 13},
-      {13, 12, 247, 58, 9},
-      {182, 225, 131, 112, 13}
-    },
-    { {113, 147, 59, 32, 13},
-      {84, 74, 127, 208, 4},
-      {176, 77, 204, 152, 14},
-      {32, 191, 229, 34, 10}
-    },
-    { {31, 13, 227, 166, 15},
-      {190, 218, 67, 97, 15},
-      {246, 92, 123, 15, 8},
-      {248, 108, 37, 183, 13}
-    },
-    { {89, 111, 91, 186, 6},
-      {51, 126, 206, 240, 11},
-      {101, 221, 175, 105, 10},
-      {208, 247, 55, 236, 12}
-    },
-    { {205, 97, 217, 243, 4},
-      {179, 134, 198, 222, 3},
-      {44, 249, 184, 107, 3},
-      {199, 182, 54, 28, 13}
-    },
-    { {164, 120, 173, 50, 8},
-      {209, 133, 167, 2, 13},
-      {20, 203, 81, 226, 5},
-      {180, 14, 90, 24, 11}
-    },
-    { {218, 222, 64, 18, 15},
-      {102, 28, 217, 163, 9},
-      {244, 128, 39, 181, 11},
-      {156, 89, 179, 134, 6}
-    },
-    { {209, 87, 100, 55, 0},
-      {104, 15, 138, 230, 5},
-      {14, 194, 110, 168, 11},
-      {166, 117, 31, 1, 6}
-    },
-    { {58, 43, 245, 210, 2},
-      {51, 155, 168, 25, 15},
-      {68, 186, 253, 69, 12},
-      {249, 129, 93, 156, 12}
-    },
-    { {35, 3, 227, 72, 13},
-      {52, 226, 105, 73, 4},
-      {177, 44, 124, 12, 4},
-      {41, 41, 100, 114, 12}
-    },
-    { {65, 185, 191, 154, 9},
-      {85, 227, 149, 208, 15},
-      {149, 159, 217, 216, 2},
-      {240, 186, 156, 122, 10}
-    },
-    { {90, 78, 147, 238, 3},
-      {30, 252, 10, 185, 11},
-      {199, 124, 151, 37, 10},
-      {217, 213, 3, 247, 8}
-    },
-    { {70, 43, 68, 81, 2},
-      {161, 19, 136, 141, 8},
-      {72, 162, 45, 70, 2},
-      {27, 17, 28, 136, 5}
-    },
-    { {78, 1, 113, 156, 1},
-      {190, 34, 128, 145, 6},
-      {131, 152, 232, 7, 2},
-      {104, 144, 20, 71, 13}
-    },
-    { {115, 160, 217, 19, 7},
-      {53, 152, 244, 213, 1},
-      {236, 137, 176, 92, 14},
-      {138, 178, 241, 154, 12}
-    },
-    { {147, 43, 65, 109, 13},
-      {61, 42, 75, 79, 8},
-      {187, 104, 45, 76, 9},
-      {31, 45, 37, 75, 12}
-    },
-    { {255, 75, 97, 90, 7},
-      {182, 62, 232, 203, 13},
-      {229, 168, 109, 47, 15},
-      {189, 49, 119, 198, 13}
-    },
-    { {44, 136, 15, 26, 12},
-      {146, 97, 245, 0, 9},
-      {53, 143, 1, 19, 4},
-      {144, 10, 248, 100, 9}
-    },
-    { {111, 59, 182, 170, 1},
-      {199, 227, 42, 209, 15},
-      {133, 86, 221, 207, 6},
-      {248, 181, 76, 126, 3}
-    },
-    { {71, 109, 33, 174, 6},
-      {153, 54, 66, 225, 15},
-      {103, 88, 75, 110, 2},
-      {248, 116, 38, 201, 9}
-    },
-    { {249, 194, 144, 104, 8},
-      {2, 172, 59, 218, 0},
-      {17, 96, 148, 57, 15},
-      {5, 189, 195, 84, 0}
-    },
-    { {118, 129, 17, 33, 0},
-      {144, 10, 50, 149, 0},
-      {8, 72, 136, 22, 14},
-      {10, 148, 197, 0, 9}
-    },
-    { {98, 52, 88, 245, 5},
-      {109, 0, 230, 189, 2},
-      {170, 241, 162, 196, 6},
-      {75, 214, 112, 11, 6}
-    },
-    { {243, 25, 25, 225, 15},
-      {84, 26, 103, 223, 10},
-      {248, 121, 137, 140, 15},
-      {95, 190, 101, 130, 10}
-    },
-    { {239, 71, 167, 221, 1},
-      {158, 231, 168, 239, 6},
-      {139, 190, 94, 47, 7},
-      {111, 113, 94, 119, 9}
-    },
-    { {198, 199, 119, 128, 8},
-      {176, 71, 25, 179, 6},
-      {16, 30, 238, 54, 3},
-      {108, 217, 142, 32, 13}
-    },
-    { {238, 201, 111, 9, 6},
-      {178, 119, 116, 135, 12},
-      {105, 15, 105, 55, 7},
-      {62, 18, 238, 228, 13}
-    },
-    { {155, 60, 155, 218, 15},
-      {87, 248, 197, 123, 11},
-      {245, 189, 147, 205, 9},
-      {221, 234, 49, 254, 10}
-    },
-    { {111, 212, 50, 87, 3},
-      {206, 84, 176, 253, 5},
-      {206, 164, 194, 191, 6},
-      {171, 240, 210, 167, 3}
-    },
-    { {96, 231, 208, 170, 9},
-      {37, 166, 59, 176, 3},
-      {149, 80, 190, 112, 6},
-      {192, 221, 198, 90, 4}
-    },
-    { {6, 81, 205, 163, 4},
-      {240, 135, 70, 5, 3},
-      {44, 91, 56, 166, 0},
-      {202, 6, 46, 16, 15}
-    },
-    { {226, 172, 192, 78, 7},
-      {45, 176, 112, 171, 9},
-      {231, 32, 51, 84, 7},
-      {157, 80, 224, 219, 4}
-    },
-    { {148, 96, 209, 162, 2},
-      {177, 156, 2, 18, 3},
-      {68, 88, 176, 98, 9},
-      {196, 132, 3, 152, 13}
-    },
-    { {130, 183, 155, 23, 7},
-      {93, 210, 220, 55, 1},
-      {238, 141, 158, 212, 1},
-      {142, 195, 180, 187, 10}
-    },
-    { {78, 177, 137, 244, 11},
-      {223, 146, 151, 137, 2},
-      {210, 249, 24, 215, 2},
-      {73, 30, 148, 159, 11}
-    },
-    { {203, 249, 195, 177, 14},
-      {115, 214, 211, 199, 10},
-      {120, 220, 57, 253, 3},
-      {94, 60, 182, 188, 14}
-    },
-    { {111, 108, 100, 132, 1},
-      {175, 5, 32, 225, 14},
-      {130, 18, 99, 111, 6},
-      {120, 112, 74, 15, 5}
-    },
-    { {229, 78, 80, 162, 14},
-      {160, 20, 107, 242, 11},
-      {116, 80, 167, 42, 7},
-      {212, 253, 98, 128, 5}
-    },
-    { {99, 47, 48, 242, 3},
-      {5, 18, 170, 249, 15},
-      {196, 240, 207, 76, 6},
-      {249, 245, 84, 138, 0}
-    },
-    { {179, 187, 61, 230, 12},
-      {89, 11, 127, 91, 15},
-      {54, 123, 205, 220, 13},
-      {253, 175, 237, 9, 10}
-    },
-    { {99, 49, 245, 56, 3},
-      {117, 179, 162, 209, 4},
-      {193, 202, 248, 204, 6},
-      {40, 180, 92, 218, 14}
-    },
-    { {188, 161, 218, 254, 5},
-      {175, 234, 246, 26, 3},
-      {167, 245, 184, 83, 13},
-      {197, 134, 245, 127, 5}
-    },
-    { {209, 129, 108, 171, 9},
-      {36, 43, 23, 198, 7},
-      {157, 83, 104, 24, 11},
-      {230, 62, 141, 66, 4}
-    },
-    { {13, 132, 7, 172, 10},
-      {154, 113, 19, 96, 2},
-      {83, 94, 2, 27, 0},
-      {64, 108, 136, 229, 9}
-    },
-    { {121, 78, 29, 126, 5},
-      {30, 45, 238, 248, 9},
-      {167, 235, 135, 41, 14},
-      {145, 247, 123, 71, 8}
-    },
-    { {146, 222, 101, 68, 2},
-      {120, 29, 24, 43, 12},
-      {66, 42, 103, 180, 9},
-      {61, 65, 139, 129, 14}
-    },
-    { {101, 20, 151, 148, 9},
-      {220, 193, 161, 240, 2},
-      {146, 158, 146, 138, 6},
-      {64, 248, 88, 51, 11}
-    },
-    { {51, 247, 81, 113, 2},
-      {113, 30, 186, 125, 0},
-      {72, 232, 174, 252, 12},
-      {11, 229, 215, 136, 14}
-    },
-    { {60, 156, 233, 25, 5},
-      {246, 168, 244, 36, 12},
-      {169, 137, 115, 147, 12},
-      {50, 66, 241, 86, 15}
-    },
-    { {126, 203, 129, 215, 10},
-      {154, 158, 185, 141, 11},
-      {94, 184, 29, 55, 14},
-      {219, 25, 215, 149, 9}
-    },
-    { {237, 225, 64, 23, 8},
-      {171, 6, 177, 198, 1},
-      {30, 128, 40, 123, 7},
-      {134, 56, 214, 13, 5}
-    },
-    { {192, 155, 14, 226, 12},
-      {64, 67, 95, 138, 11},
-      {52, 119, 13, 144, 3},
-      {213, 31, 172, 32, 2}
-    },
-    { {20, 230, 31, 119, 4},
-      {153, 77, 222, 60, 1},
-      {46, 239, 134, 114, 8},
-      {131, 199, 187, 41, 9}
-    },
-    { {109, 51, 102, 73, 10},
-      {227, 115, 41, 204, 4},
-      {89, 38, 108, 203, 6},
-      {35, 57, 76, 236, 7}
-    },
-    { {134, 93, 208, 136, 0},
-      {224, 166, 0, 51, 10},
-      {1, 16, 187, 166, 1},
-      {92, 192, 6, 80, 7}
-    },
-    { {247, 33, 75, 251, 8},
-      {177, 106, 167, 207, 3},
-      {29, 253, 40, 78, 15},
-      {207, 62, 85, 104, 13}
-    },
-    { {216, 185, 194, 226, 2},
-      {99, 218, 18, 138, 11},
-      {68, 116, 57, 209, 11},
-      {213, 20, 133, 188, 6}
-    },
-    { {153, 167, 7, 55, 15},
-      {31, 91, 219, 102, 1},
-      {254, 206, 14, 89, 9},
-      {134, 109, 189, 175, 8}
-    },
-    { {192, 236, 249, 12, 9},
-      {61, 164, 21, 178, 12},
-      {147, 9, 243, 112, 3},
-      {52, 218, 130, 91, 12}
-    },
-    { {187, 139, 38, 224, 1},
-      {6, 75, 58, 75, 14},
-      {128, 118, 77, 29, 13},
-      {125, 37, 205, 38, 0}
-    },
-    { {5, 103, 143, 202, 12},
-      {145, 231, 77, 104, 3},
-      {53, 63, 30, 106, 0},
-      {193, 107, 46, 120, 9}
-    },
-    { {51, 180, 131, 131, 4},
-      {81, 200, 112, 101, 3},
-      {44, 28, 18, 220, 12},
-      {202, 96, 225, 56, 10}
-    },
-    { {235, 157, 132, 184, 3},
-      {70, 179, 178, 227, 10},
-      {193, 210, 27, 157, 7},
-      {92, 116, 220, 214, 2}
-    },
-    { {124, 162, 119, 234, 2},
-      {179, 121, 58, 152, 7},
-      {69, 126, 228, 83, 14},
-      {225, 149, 201, 236, 13}
-    },
-    { {2, 175, 95, 102, 11},
-      {61, 83, 31, 57, 9},
-      {214, 111, 175, 84, 0},
-      {153, 207, 140, 171, 12}
-    },
-    { {74, 103, 140, 18, 2},
-      {3, 151, 140, 161, 1},
-      {68, 131, 30, 101, 2},
-      {136, 83, 30, 156, 0}
-    },
-    { {18, 21, 146, 191, 3},
-      {76, 250, 130, 53, 3},
-      {207, 212, 154, 132, 8},
-      {202, 196, 21, 243, 2}
-    },
-    { {204, 130, 180, 140, 9},
-      {142, 161, 25, 146, 6},
-      {147, 18, 212, 19, 3},
-      {100, 153, 136, 87, 1}
-    },
-    { {119, 203, 233, 15, 12},
-      {184, 174, 125, 197, 13},
-      {63, 9, 125, 62, 14},
-      {186, 59, 231, 81, 13}
-    },
-    { {94, 247, 215, 147, 1},
-      {247, 207, 152, 181, 3},
-      {140, 158, 190, 247, 10},
-      {202, 209, 159, 62, 15}
-    },
-    { {17, 121, 71, 153, 5},
-      {117, 111, 192, 68, 10},
-      {169, 158, 41, 232, 8},
-      {82, 32, 63, 106, 14}
-    },
-    { {52, 77, 95, 151, 0},
-      {184, 79, 164, 52, 11},
-      {14, 159, 171, 34, 12},
-      {210, 194, 95, 33, 13}
-    },
-    { {223, 47, 18, 231, 2},
-      {139, 90, 10, 255, 11},
-      {78, 116, 143, 79, 11},
-      {223, 245, 5, 173, 1}
-    },
-    { {17, 66, 119, 179, 7},
-      {52, 93, 202, 84, 7},
-      {236, 222, 228, 40, 8},
-      {226, 165, 59, 162, 12}
-    },
-    { {11, 143, 167, 61, 5},
-      {30, 227, 218, 101, 12},
-      {171, 206, 95, 29, 0},
-      {58, 101, 188, 119, 8}
-    },
-    { {54, 225, 111, 66, 3},
-      {181, 95, 52, 9, 5},
-      {196, 47, 104, 118, 12},
-      {169, 2, 207, 170, 13}
-    },
-    { {5, 116, 2, 183, 14},
-      {201, 84, 195, 100, 3},
-      {126, 212, 2, 234, 0},
-      {194, 108, 50, 169, 3}
-    },
-    { {195, 66, 66, 58, 7},
-      {36, 116, 202, 195, 1},
-      {229, 196, 36, 44, 3},
-      {140, 53, 50, 226, 4}
-    },
-    { {117, 140, 52, 218, 11},
-      {132, 57, 177, 248, 15},
-      {213, 178, 195, 26, 14},
-      {241, 248, 217, 194, 1}
-    },
-    { {103, 220, 97, 97, 4},
-      {240, 4, 114, 237, 12},
-      {40, 104, 99, 190, 6},
-      {59, 116, 226, 0, 15}
-    },
-    { {41, 178, 34, 6, 8},
-      {75, 64, 57, 64, 5},
-      {22, 4, 68, 217, 4},
-      {160, 41, 192, 45, 2}
-    },
-    { {113, 1, 175, 15, 10},
-      {24, 251, 37, 196, 5},
-      {95, 15, 88, 8, 14},
-      {162, 58, 77, 241, 8}
-    },
-    { {84, 210, 43, 199, 5},
-      {220, 76, 92, 140, 7},
-      {174, 61, 68, 178, 10},
-      {227, 19, 163, 35, 11}
-    },
-    { {144, 139, 163, 175, 9},
-      {28, 234, 27, 6, 15},
-      {159, 92, 93, 16, 9},
-      {246, 13, 133, 115, 8}
-    },
-    { {235, 104, 201, 181, 1},
-      {63, 132, 166, 199, 10},
-      {138, 217, 49, 109, 7},
-      {94, 54, 82, 31, 12}
-    },
-    { {38, 5, 212, 66, 12},
-      {160, 131, 97, 57, 1},
-      {52, 34, 186, 6, 4},
-      {137, 200, 108, 16, 5}
-    },
-    { {106, 184, 139, 127, 4},
-      {91, 224, 246, 141, 9},
-      {47, 237, 17, 213, 6},
-      {155, 22, 240, 125, 10}
-    },
-    { {32, 124, 118, 87, 13},
-      {109, 69, 225, 60, 13},
-      {190, 166, 227, 224, 4},
-      {179, 200, 122, 43, 6}
-    },
-    { {55, 121, 64, 210, 0},
-      {225, 14, 160, 73, 11},
-      {4, 176, 41, 238, 12},
-      {217, 32, 87, 8, 7}
-    },
-    { {172, 46, 183, 123, 6},
-      {147, 241, 234, 62, 13},
-      {109, 238, 215, 67, 5},
-      {183, 197, 120, 252, 9}
-    },
-    { {62, 135, 49, 142, 12},
-      {154, 42, 121, 49, 7},
-      {55, 24, 206, 23, 12},
-      {232, 201, 229, 69, 9}
-    },
-    { {71, 175, 234, 26, 10},
-      {161, 242, 157, 225, 13},
-      {85, 133, 127, 94, 2},
-      {184, 123, 148, 248, 5}
-    },
-    { {70, 222, 53, 183, 4},
-      {216, 5, 218, 181, 15},
-      {46, 218, 199, 182, 2},
-      {250, 213, 186, 1, 11}
-    },
-    { {72, 163, 107, 161, 0},
-      {51, 66, 30, 132, 6},
-      {8, 93, 108, 81, 2},
-      {98, 23, 132, 44, 12}
-    },
-    { {240, 113, 21, 54, 11},
-      {93, 31, 163, 146, 1},
-      {214, 202, 136, 224, 15},
-      {132, 156, 95, 139, 10}
-    },
-    { {150, 63, 135, 237, 4},
-      {217, 235, 74, 47, 10},
-      {43, 126, 31, 198, 9},
-      {95, 69, 45, 121, 11}
-    },
-    { {216, 58, 185, 150, 5},
-      {95, 136, 204, 146, 15},
-      {166, 153, 213, 193, 11},
-      {244, 147, 49, 31, 10}
-    },
-    { {123, 46, 181, 160, 15},
-      {23, 153, 107, 241, 14},
-      {240, 90, 215, 77, 14},
-      {120, 253, 105, 158, 8}
-    },
-    { {182, 173, 250, 243, 2},
-      {161, 218, 182, 63, 15},
-      {76, 245, 251, 86, 13},
-      {255, 198, 213, 184, 5}
-    },
-    { {135, 224, 122, 78, 10},
-      {169, 116, 21, 91, 5},
-      {87, 37, 224, 126, 1},
-      {173, 170, 130, 233, 5}
-    },
-    { {123, 69, 24, 244, 14},
-      {10, 30, 231, 249, 2},
-      {114, 241, 138, 45, 14},
-      {73, 254, 119, 133, 0}
-    },
-    { {144, 100, 163, 115, 8},
-      {17, 204, 131, 46, 5},
-      {28, 236, 82, 96, 9},
-      {167, 76, 19, 56, 8}
-    },
-    { {60, 36, 44, 161, 2},
-      {131, 25, 38, 36, 6},
-      {72, 83, 66, 67, 12},
-      {98, 70, 73, 140, 1}
-    },
-    { {150, 178, 92, 74, 4},
-      {225, 41, 92, 27, 1},
-      {37, 35, 164, 214, 9},
-      {141, 131, 169, 72, 7}
-    },
-    { {139, 1, 216, 58, 12},
-      {34, 162, 199, 83, 1},
-      {53, 193, 184, 13, 1},
-      {140, 174, 52, 84, 4}
-    },
-    { {229, 28, 206, 178, 5},
-      {228, 193, 230, 226, 11},
-      {164, 215, 51, 138, 7},
-      {212, 118, 120, 50, 7}
-    },
-    { {72, 15, 88, 219, 0},
-      {34, 34, 140, 188, 11},
-      {13, 177, 175, 1, 2},
-      {211, 211, 20, 68, 4}
-    },
-    { {186, 226, 149, 134, 7},
-      {31, 157, 120, 19, 3},
-      {230, 26, 148, 117, 13},
-      {204, 129, 235, 159, 8}
-    },
-    { {137, 252, 15, 186, 0},
-      {83, 101, 150, 98, 11},
-      {5, 223, 3, 249, 1},
-      {212, 102, 154, 108, 10}
-    },
-    { {221, 6, 71, 94, 9},
-      {190, 105, 137, 234, 1},
-      {151, 174, 38, 11, 11},
-      {133, 121, 25, 103, 13}
-    },
-    { {247, 254, 70, 180, 12},
-      {233, 77, 251, 227, 10},
-      {50, 214, 39, 254, 15},
-      {92, 125, 251, 41, 7}
-    },
-    { {67, 206, 240, 38, 13},
-      {44, 132, 91, 241, 13},
-      {182, 64, 247, 60, 2},
-      {184, 253, 162, 19, 4}
-    },
-    { {99, 147, 88, 90, 2},
-      {96, 50, 188, 217, 1},
-      {69, 161, 172, 156, 6},
-      {137, 179, 212, 192, 6}
-    },
-    { {135, 180, 4, 69, 6},
-      {201, 17, 80, 111, 0},
-      {106, 34, 2, 222, 1},
-      {15, 96, 168, 137, 3}
-    },
-    { {79, 164, 124, 190, 10},
-      {171, 49, 151, 241, 7},
-      {87, 211, 226, 95, 2},
-      {232, 254, 152, 205, 5}
-    },
-    { {118, 25, 249, 85, 10},
-      {248, 154, 165, 157, 12},
-      {90, 169, 249, 134, 14},
-      {59, 154, 85, 145, 15}
-    },
-    { {81, 185, 161, 51, 0},
-      {81, 138, 146, 196, 13},
-      {12, 200, 89, 216, 10},
-      {178, 52, 149, 24, 10}
-    },
-    { {21, 51, 99, 124, 7},
-      {253, 122, 202, 72, 4},
-      {227, 236, 108, 202, 8},
-      {33, 37, 53, 235, 15}
-    },
-    { {117, 135, 169, 114, 10},
-      {144, 154, 191, 232, 5},
-      {84, 233, 94, 26, 14},
-      {161, 127, 213, 144, 9}
-    },
-    { {96, 222, 17, 98, 2},
-      {80, 20, 58, 184, 9},
-      {68, 104, 135, 176, 6},
-      {145, 213, 194, 128, 10}
-    },
-    { {125, 76, 230, 138, 14},
-      {162, 253, 97, 224, 15},
-      {117, 22, 115, 43, 14},
-      {240, 120, 107, 244, 5}
-    },
-    { {175, 19, 94, 129, 12},
-      {226, 67, 109, 87, 2},
-      {56, 23, 172, 143, 5},
-      {78, 171, 108, 36, 7}
-    },
-    { {49, 201, 182, 71, 12},
-      {8, 207, 113, 92, 13},
-      {62, 38, 217, 56, 12},
-      {179, 168, 239, 49, 0}
-    },
-    { {172, 67, 216, 21, 5},
-      {174, 134, 236, 22, 0},
-      {170, 129, 188, 35, 5},
-      {6, 131, 118, 23, 5}
-    },
-    { {216, 83, 225, 207, 11},
-      {126, 190, 9, 142, 7},
-      {223, 56, 124, 161, 11},
-      {231, 25, 7, 215, 14}
-    },
-    { {79, 205, 197, 207, 0},
-      {186, 167, 16, 237, 11},
-      {15, 58, 59, 63, 2},
-      {219, 112, 142, 85, 13}
-    },
-    { {238, 105, 111, 210, 13},
-      {183, 71, 229, 139, 15},
-      {180, 191, 105, 103, 7},
-      {253, 26, 126, 46, 13}
-    },
-    { {183, 22, 24, 71, 5},
-      {204, 8, 108, 127, 1},
-      {174, 33, 134, 142, 13},
-      {143, 227, 97, 3, 3}
-    },
-    { {185, 180, 184, 120, 1},
-      {71, 168, 182, 122, 4},
-      {129, 225, 210, 217, 13},
-      {37, 230, 209, 94, 2}
-    },
-    { {50, 133, 121, 80, 5},
-      {52, 10, 244, 57, 4},
-      {160, 169, 234, 20, 12},
-      {41, 194, 245, 2, 12}
-    },
-    { {149, 233, 71, 119, 1},
-      {189, 79, 146, 78, 9},
-      {142, 238, 41, 122, 9},
-      {151, 36, 159, 43, 13}
-    },
-    { {154, 160, 48, 46, 2},
-      {11, 56, 18, 19, 5},
-      {71, 64, 192, 85, 9},
-      {172, 132, 129, 205, 0}
-    },
-    { {236, 24, 40, 209, 7},
-      {198, 16, 228, 142, 14},
-      {232, 177, 65, 131, 7},
-      {119, 18, 112, 134, 3}
-    },
-    { {188, 80, 121, 99, 5},
-      {246, 12, 102, 30, 5},
-      {172, 105, 224, 163, 13},
-      {167, 134, 99, 6, 15}
-    },
-    { {135, 133, 193, 183, 9},
-      {188, 130, 147, 103, 3},
-      {158, 216, 58, 30, 1},
-      {206, 108, 148, 19, 13}
-    },
-    { {211, 122, 173, 183, 10},
-      {89, 157, 143, 199, 15},
-      {94, 219, 85, 236, 11},
-      {254, 63, 27, 153, 10}
-    },
-    { {129, 127, 2, 206, 0},
-      {73, 102, 8, 106, 11},
-      {7, 52, 15, 232, 1},
-      {213, 97, 6, 105, 2}
-    },
-    { {253, 99, 223, 176, 10},
-      {179, 223, 175, 210, 2},
-      {80, 223, 188, 107, 15},
-      {68, 191, 95, 188, 13}
-    },
-    { {81, 10, 193, 175, 2},
-      {56, 184, 10, 196, 11},
-      {79, 88, 53, 8, 10},
-      {210, 53, 1, 209, 12}
-    },
-    { {61, 30, 223, 141, 3},
-      {254, 249, 44, 116, 10},
-      {203, 31, 183, 139, 12},
-      {82, 227, 73, 247, 15}
-    },
-    { {244, 183, 58, 64, 2},
-      {193, 90, 60, 186, 4},
-      {64, 37, 206, 210, 15},
-      {37, 211, 197, 168, 3}
-    },
-    { {55, 215, 137, 233, 12},
-      {208, 174, 127, 109, 2},
-      {57, 121, 30, 190, 12},
-      {75, 111, 231, 80, 11}
-    },
-    { {143, 17, 199, 124, 10},
-      {250, 243, 131, 75, 0},
-      {83, 238, 56, 143, 1},
-      {13, 44, 28, 245, 15}
-    },
-    { {196, 189, 3, 107, 14},
-      {209, 114, 83, 174, 9},
-      {125, 108, 11, 210, 3},
-      {151, 92, 164, 232, 11}
-    },
-    { {125, 250, 153, 92, 9},
-      {223, 172, 189, 216, 8},
-      {147, 169, 149, 251, 14},
-      {17, 187, 211, 95, 11}
-    },
-    { {123, 20, 232, 37, 1},
-      {110, 136, 38, 229, 4},
-      {138, 65, 114, 141, 14},
-      {42, 118, 65, 23, 6}
-    },
-    { {202, 7, 14, 127, 4},
-      {10, 99, 206, 175, 1},
-      {47, 231, 14, 5, 3},
-      {143, 87, 60, 101, 0}
-    },
-    { {92, 34, 219, 205, 5},
-      {191, 232, 76, 156, 2},
-      {171, 61, 180, 67, 10},
-      {67, 147, 33, 127, 13}
-    },
-    { {160, 219, 114, 108, 8},
-      {104, 102, 59, 26, 12},
-      {19, 100, 237, 176, 5},
-      {53, 141, 198, 97, 6}
-    },
-    { {107, 119, 118, 222, 2},
-      {107, 119, 168, 249, 7},
-      {71, 182, 238, 237, 6},
-      {233, 241, 94, 237, 6}
-    },
-    { {128, 245, 142, 116, 8},
-      {73, 199, 151, 42, 0},
-      {18, 231, 26, 240, 1},
-      {5, 78, 158, 57, 2}
-    },
-    { {225, 172, 31, 244, 10},
-      {25, 81, 183, 250, 10},
-      {82, 255, 131, 88, 7},
-      {85, 254, 216, 169, 8}
-    },
-    { {27, 186, 234, 133, 12},
-      {107, 200, 93, 69, 14},
-      {58, 21, 117, 221, 8},
-      {122, 43, 161, 61, 6}
-    },
-    { {38, 172, 85, 127, 12},
-      {185, 33, 243, 61, 9},
-      {63, 234, 163, 86, 4},
-      {155, 204, 248, 73, 13}
-    },
-    { {229, 209, 239, 53, 7},
-      {252, 215, 246, 198, 4},
-      {234, 207, 120, 186, 7},
-      {38, 54, 254, 179, 15}
-    },
-    { {31, 41, 212, 225, 0},
-      {163, 139, 2, 93, 10},
-      {8, 114, 185, 79, 8},
-      {91, 164, 13, 28, 5}
-    },
-    { {69, 159, 187, 21, 11},
-      {220, 210, 157, 244, 12},
-      {218, 141, 223, 154, 2},
-      {50, 251, 148, 179, 11}
-    },
-    { {212, 176, 73, 85, 9},
-      {253, 8, 149, 142, 0},
-      {154, 169, 32, 210, 11},
-      {7, 26, 145, 11, 15}
-    },
-    { {108, 183, 10, 207, 8},
-      {203, 98, 61, 172, 3},
-      {31, 53, 14, 211, 6},
-      {195, 91, 196, 109, 3}
-    },
-    { {248, 97, 122, 81, 8},
-      {35, 78, 165, 158, 4},
-      {24, 165, 232, 97, 15},
-      {39, 154, 87, 44, 4}
-    },
-    { {195, 145, 218, 195, 4},
-      {96, 194, 84, 223, 3},
-      {44, 53, 184, 156, 3},
-      {207, 178, 164, 48, 6}
-    },
-    { {81, 35, 94, 44, 12},
-      {41, 107, 79, 208, 0},
-      {51, 71, 172, 72, 10},
-      {0, 191, 45, 105, 4}
-    },
-    { {116, 64, 124, 79, 14},
-      {168, 61, 101, 156, 5},
-      {127, 35, 224, 34, 14},
-      {163, 154, 107, 193, 5}
-    },
-    { {223, 22, 9, 162, 4},
-      {210, 8, 78, 227, 3},
-      {36, 89, 6, 143, 11},
-      {204, 119, 33, 4, 11}
-    },
-    { {206, 210, 125, 193, 7},
-      {246, 21, 92, 159, 6},
-      {232, 59, 228, 183, 3},
-      {111, 147, 170, 134, 15}
-    }
+static constexpr uint64 DICT_APRILTAG_36h11_CODES[][4] = {
+    { 0x21a146babULL, 0x2573b3403ULL, 0xd5d628584ULL, 0xc02cdcea4ULL },
+    { 0x92d18fe9bULL, 0x54ff170f2ULL, 0xd97f18b49ULL, 0x4f0e8ff2aULL },
+    { 0x7089014bbULL, 0x143a318c9ULL, 0xdd280910eULL, 0x9318c5c28ULL },
+    { 0x193979e27ULL, 0x771a4658fULL, 0xe479e9c98ULL, 0xf1a6258eeULL },
+    { 0x44153d3d7ULL, 0xdc33c6b44ULL, 0xebcbca822ULL, 0x22d63cc3bULL },
+    { 0x35cd5b8cfULL, 0xbc7e7570aULL, 0xf31dab3acULL, 0x50eae7e3dULL },
+    { 0xa10ba56a0ULL, 0x10a32a4adULL, 0x056a5d085ULL, 0xb5254c508ULL },
+    { 0x2b874a608ULL, 0x22423f690ULL, 0x10652e1d4ULL, 0x096fc4244ULL },
+    { 0xb57fb8d44ULL, 0xc98eec7aeULL, 0x22b1dfeadULL, 0x75e377193ULL },
+    { 0x4e20b5a64ULL, 0x9b8142917ULL, 0x265ad0472ULL, 0xe894281d9ULL },
+    { 0x61d897f2cULL, 0x50c5f3d8bULL, 0x34fe91b86ULL, 0xd1bcfa30aULL },
+    { 0xab3469ffcULL, 0x7b20e76f7ULL, 0x3ff962cd5ULL, 0xef6e704deULL },
+    { 0x594ca45c2ULL, 0x0abd80e8cULL, 0x43a25329aULL, 0x31701bd50ULL },
+    { 0xfa1c2d2e2ULL, 0x5a3926a3dULL, 0x474b4385fULL, 0xbc5649c5aULL },
+    { 0x97c24b972ULL, 0xb85c9c473ULL, 0x4e9d243e9ULL, 0xce2393a1dULL },
+    { 0x75928624aULL, 0xc8d93bc00ULL, 0x5246149aeULL, 0x003dc9b13ULL },
+    { 0x1caafe99aULL, 0xa3f99d14eULL, 0x5997f5538ULL, 0x728b99fc5ULL },
+    { 0x3236ddc16ULL, 0x71996c3d2ULL, 0x683bb6c4cULL, 0x4bc36998eULL },
+    { 0x884e527d6ULL, 0x2a74ca3e8ULL, 0x6be4a7211ULL, 0x17c532e54ULL },
+    { 0x5771a8c7eULL, 0xc99e45cd7ULL, 0x7e3158eeaULL, 0xeb3a27993ULL },
+    { 0xf52925b81ULL, 0x952ba2c2eULL, 0x81da494afULL, 0x74345d4a9ULL },
+    { 0x2e59cc1a1ULL, 0xe6a7a4019ULL, 0x858339a74ULL, 0x98025e567ULL },
+    { 0x7fa58ab31ULL, 0x87cab6e53ULL, 0x8cd51a5feULL, 0xca76d53e1ULL },
+    { 0xeb43384f9ULL, 0x0e262ddf5ULL, 0x9f21cc2d7ULL, 0xafbb46470ULL },
+    { 0x3913d5345ULL, 0x7e8bea500ULL, 0xa2cabc89cULL, 0x00a57d17eULL },
+    { 0xd79b1a3b5ULL, 0xc46aded79ULL, 0xadc58d9ebULL, 0x9eb7b5623ULL },
+    { 0x0dfbe768dULL, 0xf7e75b48cULL, 0xb16e7dfb0ULL, 0x312dae7efULL },
+    { 0x5cd7a031dULL, 0xc68edba44ULL, 0xb8c05eb3aULL, 0x225db7163ULL },
+    { 0xb9c8f7a4bULL, 0x3edd3352eULL, 0xd25ef139dULL, 0x74accbb7cULL },
+    { 0x46987e06bULL, 0xec511591dULL, 0xd607e1962ULL, 0xb89a88a37ULL },
+    { 0x6e0c5d527ULL, 0xb611e4b99ULL, 0xe4aba3076ULL, 0x99d27886dULL },
+    { 0x5bc567bb4ULL, 0x326fd2e57ULL, 0x2dde6a3daULL, 0xea74bf64cULL },
+    { 0x1e6302bc2ULL, 0x8b7e8a012ULL, 0x43d40c678ULL, 0x480517ed1ULL },
+    { 0x8ac7d046aULL, 0x2a96193b1ULL, 0x5620be351ULL, 0x8dc986954ULL },
+    { 0xa65fe2326ULL, 0xe0d6ea23dULL, 0x64c47fa65ULL, 0xbc4576b07ULL },
+    { 0x5400eb616ULL, 0xb0d8468c4ULL, 0x686d7002aULL, 0x231621b0dULL },
+    { 0xf7a066836ULL, 0xa15970c77ULL, 0x6c16605efULL, 0xee30e9a85ULL },
+    { 0x2dd0afdf6ULL, 0xdaf5f44c7ULL, 0x6fbf50bb4ULL, 0xe322faf5bULL },
+    { 0x3b9cb60b1ULL, 0x46e93075dULL, 0x8d06d39dcULL, 0xbae0c9762ULL },
+    { 0xad6a1caf9ULL, 0x8f252f56bULL, 0x9f53856b5ULL, 0xd6af4a4f1ULL },
+    { 0x93b62efb5ULL, 0x4569de6f7ULL, 0xadf746dc9ULL, 0xef67b96a2ULL },
+    { 0xbb210d93dULL, 0x170be5473ULL, 0xbc9b084ddULL, 0xce2a7d0e8ULL },
+    { 0xdee55094bULL, 0xaf1e91b32ULL, 0xd290aa77bULL, 0x4cd8978f5ULL },
+    { 0xa0cd1479bULL, 0x0437b33e8ULL, 0xd9e28b305ULL, 0x17ccdec20ULL },
+    { 0x2a23abb27ULL, 0x17d2ee017ULL, 0xe4dd5c454ULL, 0xe80774be8ULL },
+    { 0x4f67f4b5fULL, 0xaf97cbf56ULL, 0xfad2fe6f2ULL, 0x6afd3e9f5ULL },
+    { 0x58a815818ULL, 0x13091194aULL, 0x181a8151aULL, 0x5298890c8ULL },
+    { 0x743427d64ULL, 0xd949e0a87ULL, 0x26be42c2eULL, 0xe1507929bULL },
+    { 0x1dec40874ULL, 0xab0c5064bULL, 0x2e10237b8ULL, 0xd260a30d5ULL },
+    { 0x892ab3a02ULL, 0x13d00a52eULL, 0x405cd5491ULL, 0x74a500bc8ULL },
+    { 0x38d5742eeULL, 0x6a3f73305ULL, 0x7742eab1cULL, 0xa0ccefc56ULL },
+    { 0x0c43567a1ULL, 0xa6678a181ULL, 0x85e6ac230ULL, 0x81851e665ULL },
+    { 0x5db311cb1ULL, 0xd72a18dc3ULL, 0x8d388cdbaULL, 0xc3b1854ebULL },
+    { 0xc957ca1f9ULL, 0x6ee68de61ULL, 0x9f853ea93ULL, 0x867b16776ULL },
+    { 0xa22457823ULL, 0x355120333ULL, 0xc41ea2445ULL, 0xccc048aacULL },
+    { 0x29ace98f3ULL, 0x3fb03464fULL, 0xcf1973594ULL, 0xf262c0dfcULL },
+    { 0xccc52c528ULL, 0x820795aa5ULL, 0x14a34a333ULL, 0xa55a9e041ULL },
+    { 0xda8b3578cULL, 0x122bdb9bcULL, 0x31eacd15bULL, 0x3d9dbd448ULL },
+    { 0xd5b4b9e36ULL, 0xd19856fe7ULL, 0x6c79d2dabULL, 0xe7f6a198bULL },
+    { 0xac9cdd3ceULL, 0xfab1f7328ULL, 0x73cbb3935ULL, 0x14cef8d5fULL },
+    { 0xcbdaa8391ULL, 0x46a49ec7cULL, 0x89c155bd3ULL, 0x3e3792562ULL },
+    { 0x1986256b1ULL, 0x16291a6c5ULL, 0x8d6a46198ULL, 0xa36589468ULL },
+    { 0xbae6cc889ULL, 0x27ad3d232ULL, 0x91133675dULL, 0x4c4bcb5e4ULL },
+    { 0xdf91b10e5ULL, 0xdeaa50d35ULL, 0xa708d89fbULL, 0xacb0a557bULL },
+    { 0xa1a9d5a75ULL, 0x3d837256bULL, 0xae5ab9585ULL, 0xd6a4ec1bcULL },
+    { 0x2b651aa9dULL, 0x076667752ULL, 0xb9558a6d4ULL, 0x4aee666e0ULL },
+    { 0x4d5c2e19dULL, 0xc665c5e4cULL, 0xb98743ab2ULL, 0x327a3a663ULL },
+    { 0x5b163736bULL, 0x5e598bf15ULL, 0xd6cec68daULL, 0xa8fd19a7aULL },
+    { 0xf753d60a8ULL, 0xe0ef29d31ULL, 0x1506bcaefULL, 0x8cb94f707ULL },
+    { 0x5e84b37d2ULL, 0x9af892bd4ULL, 0x4becd217aULL, 0x2bd491f59ULL },
+    { 0xfce43a9f2ULL, 0x8b7cb4b67ULL, 0x4f95c273fULL, 0xe6d2d3ed1ULL },
+    { 0xbb926d1a6ULL, 0x7239fc435ULL, 0x658b649ddULL, 0xac23f9c4eULL },
+    { 0xed8d236e5ULL, 0x9e6272eadULL, 0xa76c4b1b7ULL, 0xb574e4679ULL },
+    { 0x6af846f37ULL, 0x6755f28dbULL, 0xecf621f56ULL, 0xdb14faae6ULL },
+    { 0xea56a5138ULL, 0x5285a9a75ULL, 0x1c8a56a57ULL, 0xae595a14aULL },
+    { 0x5d497146cULL, 0xba0e41d8dULL, 0x3628e92baULL, 0xb1b82705dULL },
+    { 0x470360ecaULL, 0xa8320bc96ULL, 0x53706c0e2ULL, 0x693d04c15ULL },
+    { 0x8c4bcd67aULL, 0xba970f0e9ULL, 0x5e6b3d231ULL, 0x970f0e95dULL },
+    { 0x295f3901eULL, 0x52166d74cULL, 0x7809cfa94ULL, 0x32eb6684aULL },
+    { 0xf6b577e97ULL, 0xf57b72bf6ULL, 0xe97eead6fULL, 0x6fd4edeafULL },
+    { 0x520602f5aULL, 0x08588bad2ULL, 0x5af40604aULL, 0x4b5d11a10ULL },
+    { 0xb5119492eULL, 0xc09be1523ULL, 0x7492988adULL, 0xc4a87d903ULL },
+    { 0x48e299ab7ULL, 0x17b45e943ULL, 0xed5994712ULL, 0xc297a2de8ULL },
+    { 0xb79f5737aULL, 0xf85bbb779ULL, 0x5eceaf9edULL, 0x9eeddda1fULL },
+    { 0xa814c683eULL, 0x62d161263ULL, 0x7c1632815ULL, 0xc64868b46ULL },
+    { 0x2da900583ULL, 0x8732b0488ULL, 0xc1a0095b4ULL, 0x1120d4ce1ULL },
+    { 0xd4aba4797ULL, 0x85bbda8ecULL, 0xe9e25d52bULL, 0x3715bdda1ULL },
+    { 0x982a0e65cULL, 0x0b494f0e8ULL, 0x3a6705419ULL, 0x170f292d0ULL },
+    { 0xf480ccc15ULL, 0xa489748e2ULL, 0xa8333012fULL, 0x4712e9125ULL },
+    { 0x0b20ea732ULL, 0x23d0864d5ULL, 0x4ce5704d0ULL, 0xab2610bc4ULL },
+    { 0xa9506710aULL, 0x7255a1424ULL, 0x508e60a95ULL, 0x24285aa4eULL },
+    { 0x0486e2ee1ULL, 0xace01a287ULL, 0x877476120ULL, 0xe14580735ULL },
+    { 0xb0a972615ULL, 0x254a721ecULL, 0xa864e950dULL, 0x3784e52a4ULL },
+    { 0xe73f3a257ULL, 0xcd526ef7cULL, 0xea45cfce7ULL, 0x3ef764ab3ULL },
+    { 0x17e205b98ULL, 0x912d9b452ULL, 0x19da047e8ULL, 0x4a2d9b489ULL },
+    { 0xec9ab2b24ULL, 0xc2c0fa92fULL, 0x24d4d5937ULL, 0xf495f0343ULL },
+    { 0xd9339e076ULL, 0x4bdb4cd61ULL, 0x6e079cc9bULL, 0x86b32dbd2ULL },
+    { 0xeb8874f99ULL, 0x2621b3dfeULL, 0x99f2e11d7ULL, 0x7fbcd8464ULL },
+    { 0x9420a55ccULL, 0x99a9c10a4ULL, 0x33aa50429ULL, 0x250839599ULL },
+    { 0xe364ff992ULL, 0x31f5a4f76ULL, 0x499ff26c7ULL, 0x6ef25af8cULL },
+    { 0x8a4cb8f0aULL, 0x0294873beULL, 0x50f1d3251ULL, 0x7dce12940ULL },
+    { 0xf72aee766ULL, 0xa9d9eecbdULL, 0x66e7754efULL, 0xbd3779b95ULL },
+    { 0x73cc6b569ULL, 0x3c4cb5e9dULL, 0x96ad633ceULL, 0xb97ad323cULL },
+    { 0xc99ca6a59ULL, 0x4ec113e6eULL, 0x9a5653993ULL, 0x767c88372ULL },
+    { 0x366a0c535ULL, 0x850dec0d9ULL, 0xaca30566cULL, 0x9b037b0a1ULL },
+    { 0x509e51943ULL, 0x7c1898b0aULL, 0xc298a790aULL, 0x50d19183eULL },
+    { 0xba6d227d1ULL, 0x0f6ea22fcULL, 0x8be44b65dULL, 0x3f44576f0ULL },
+    { 0xd2acf163bULL, 0x359813bfdULL, 0xdc68f354bULL, 0xbfdc819acULL },
+    { 0xd989fef68ULL, 0x2acb97dafULL, 0x16f7f919bULL, 0xf5be9d354ULL },
+    { 0x641707bb2ULL, 0xd073aaa43ULL, 0x4dde0e826ULL, 0xc2555ce0bULL },
+    { 0xf9bd312abULL, 0x573a33f2dULL, 0xd548cbd9fULL, 0xb4fcc5ceaULL },
+    { 0x77739c207ULL, 0xc59f6ed10ULL, 0xe0439ceeeULL, 0x08b76f9a3ULL },
+    { 0x68bf8d1bfULL, 0x57b3fda49ULL, 0xfd8b1fd16ULL, 0x925bfcdeaULL },
+    { 0xdedd84a6eULL, 0xca9f53a3bULL, 0x76521bb7bULL, 0xdc5caf953ULL },
+    { 0x42eaec49bULL, 0x25b51d8dcULL, 0xd92375742ULL, 0x3b1b8ada4ULL },
+    { 0x302b68d53ULL, 0x2d1aac0ceULL, 0xcab16d40cULL, 0x7303558b4ULL },
+    { 0x4ebb930ceULL, 0xdbf259918ULL, 0x730c9dd72ULL, 0x1899a4fdbULL },
+    { 0x439c5d9b5ULL, 0x7421d4f5bULL, 0xad9ba39c2ULL, 0xdaf2b842eULL },
+    { 0xe1fc9228dULL, 0x45e473f28ULL, 0xb14493f87ULL, 0x14fce27a2ULL },
+    { 0xf8a6a8d4aULL, 0x0b98bdaa6ULL, 0x52b15651fULL, 0x655bd19d0ULL },
+    { 0xb53902a18ULL, 0xc14a2346aULL, 0x185409cadULL, 0x562c45283ULL },
+    { 0xb163475eeULL, 0x397fe94a1ULL, 0x77ae2c68dULL, 0x85297fe9cULL },
+    { 0xad2f5af29ULL, 0xa742af7abULL, 0x94f5af4b5ULL, 0xd5ef542e5ULL },
+    { 0xaab5dc850ULL, 0x6b8334372ULL, 0x0a13bad55ULL, 0x4ec2cc1d6ULL },
+    { 0xb3ec25786ULL, 0x113df26bcULL, 0x61ea437cdULL, 0x3d64fbc88ULL },
+    { 0x4799c4405ULL, 0xe48350c98ULL, 0xa022399e2ULL, 0x1930ac127ULL },
+    { 0x8bc68dc04ULL, 0x12855c6b2ULL, 0x203b163d1ULL, 0x4d63aa148ULL },
+    { 0x702f15ddeULL, 0x193be9bcaULL, 0x7bba8f40eULL, 0x53d97dc98ULL },
+    { 0xb42293da9ULL, 0x95e8a91a3ULL, 0x95bc9442dULL, 0xc589517a9ULL },
+    { 0x1acad0382ULL, 0x22bc9a118ULL, 0x41c0b5358ULL, 0x188593d44ULL },
+    { 0x813363971ULL, 0x7d4288467ULL, 0x8e9c6cc81ULL, 0xe621142beULL },
+    { 0x0e692ad70ULL, 0x8b46840dfULL, 0x0eb549670ULL, 0xfb02162d1ULL },
+    { 0x8ad05c5b9ULL, 0x6625951f1ULL, 0x9da3a0b51ULL, 0x8f8a9a466ULL },
+    { 0x85e654c1bULL, 0xa515197e2ULL, 0xd832a67a1ULL, 0x47e98a8a5ULL },
+    { 0x3d0ac2b3bULL, 0xa6d8ab44bULL, 0xdcd4350bcULL, 0xd22d51b65ULL },
+    { 0x4bbfa0552ULL, 0x4b9298edcULL, 0x4aa05fdd2ULL, 0x3b71949d2ULL },
+    { 0x722dde306ULL, 0x21dbe6b18ULL, 0x60c7bb44eULL, 0x18d67db84ULL },
+    { 0x369d1acd2ULL, 0xc87a343daULL, 0x4b358b96cULL, 0x5bc2c5e13ULL },
+    { 0xa2d994e60ULL, 0x4887321bbULL, 0x067299b45ULL, 0xdd84ce112ULL },
+    { 0x5fad9139dULL, 0x97aad3f58ULL, 0xb9c89b5faULL, 0x1afcb55e9ULL },
+    { 0x57535ae96ULL, 0xe07e4edd2ULL, 0x6975acaeaULL, 0x4bb727e07ULL },
+    { 0x5f5ef1d46ULL, 0xfa9cc8f9eULL, 0x62b8f7afaULL, 0x79f13395fULL },
+    { 0xebc3e6accULL, 0x2ae77bc36ULL, 0x33567c3d7ULL, 0x6c3dee754ULL },
+    { 0x0a99c835dULL, 0x6e82d7058ULL, 0xbac139950ULL, 0x1a0eb4176ULL },
+    { 0x5463e49a5ULL, 0xa5afc8807ULL, 0xa5927c62aULL, 0xe0113f5a5ULL },
+    { 0x25676893aULL, 0xa116ad647ULL, 0x5c916e6a4ULL, 0xe26b56885ULL },
+    { 0xabed37064ULL, 0x1b477073dULL, 0x260ecb7d5ULL, 0xbce0ee2d8ULL },
+    { 0x59bdded94ULL, 0x63ebd4fcaULL, 0x29b7bbd9aULL, 0x53f2bd7c6ULL },
+    { 0x64fa04c09ULL, 0xc5053988aULL, 0x903205f26ULL, 0x5119ca0a3ULL },
+    { 0x250e44e75ULL, 0xac016a6cbULL, 0xae72270a4ULL, 0xd36568035ULL },
+    { 0xe58a374bcULL, 0x906179dedULL, 0x3d2ec51a7ULL, 0xb7b9e8609ULL },
+    { 0x24caa5741ULL, 0x9c85ba08cULL, 0x82ea55324ULL, 0x3105da139ULL },
+    { 0xe42cf6588ULL, 0xa1e1a1bacULL, 0x11a6f3427ULL, 0x35d858785ULL },
+    { 0x6ea238538ULL, 0x8300bd9d5ULL, 0x1ca1c4576ULL, 0xab9bd00c1ULL },
+    { 0xf75813025ULL, 0xd44c60d39ULL, 0xa40c81aefULL, 0x9cb06322bULL },
+    { 0x0ceb33bbdULL, 0x9766db14fULL, 0xbddccd730ULL, 0xf28db66e9ULL },
+    { 0x786ae8670ULL, 0x2b8c2e8cdULL, 0x0e617561eULL, 0xb317431d4ULL },
+    { 0xf0de8c969ULL, 0x4c8dbda2bULL, 0x969317b0fULL, 0xd45bdb132ULL },
+    { 0x26c81efe6ULL, 0x8875f619bULL, 0x67f781364ULL, 0xd986fae11ULL },
+    { 0x69f489086ULL, 0x53b474e00ULL, 0x610912f96ULL, 0x0072e2dcaULL },
+    { 0x3fbf92a4dULL, 0xcfca7b71aULL, 0xb2549fdfcULL, 0x58ede53f3ULL },
+    { 0xd6555a760ULL, 0xe84e86bb1ULL, 0x06e5aaa6bULL, 0x8dd617217ULL },
+    { 0x9ccae236dULL, 0xaeccdb02dULL, 0xb6c475339ULL, 0xb40db3375ULL },
+    { 0xb256c16a3ULL, 0x74bc2a2b1ULL, 0xc56836a4dULL, 0x8d4543d2eULL },
+    { 0xd78ac7221ULL, 0xb4c91ac39ULL, 0x844e351ebULL, 0x9c358932dULL },
+    { 0x2dc1fe262ULL, 0xaad736505ULL, 0x4647f83b4ULL, 0xa0a6ceb55ULL },
+    { 0xaf2051090ULL, 0xb32020570ULL, 0x0908a04f5ULL, 0x0ea0404cdULL },
+    { 0x932c08afeULL, 0x09384767bULL, 0x7f51034c9ULL, 0xde6e21c90ULL },
+    { 0x53feca775ULL, 0x6dccdeed9ULL, 0xaee537fcaULL, 0x9b77b33b6ULL },
+    { 0x5d292497aULL, 0x8b1b81c4fULL, 0x5e92494baULL, 0xf2381d8d1ULL },
+    { 0x2f101a22bULL, 0xc65027511ULL, 0xd445808f4ULL, 0x88ae40a63ULL },
+    { 0xc6ad16b14ULL, 0x8143d2b7aULL, 0x28d68b563ULL, 0x5ed4bc281ULL },
+    { 0xd2eca4b20ULL, 0x018d92a3fULL, 0x04d25374bULL, 0xfc549b180ULL },
+    { 0xa6fa603d4ULL, 0xe924fa07cULL, 0x2bc065f65ULL, 0x3e05f2497ULL },
+    { 0x3057c3b69ULL, 0x7cceab203ULL, 0x96dc3ea0cULL, 0xc04d5733eULL },
+    { 0xe817b54d2ULL, 0x5ab328be4ULL, 0x4b2ade817ULL, 0x27d14cd5aULL },
+    { 0x40abfc3e0ULL, 0x29a39e90dULL, 0x07c3fd502ULL, 0xb0979c594ULL },
+    { 0xf53ad16e7ULL, 0xfdb86ada9ULL, 0xe768b5cafULL, 0x95b561dbfULL },
+    { 0x36f3a06e8ULL, 0xc9ae3b095ULL, 0x17605cf6cULL, 0xa90dc7593ULL },
+    { 0x27782e418ULL, 0xc145254dcULL, 0x182741ee4ULL, 0x3b2a4a283ULL },
+    { 0x3e9062146ULL, 0xea58f0014ULL, 0x62846097cULL, 0x2800f1a57ULL },
+    { 0x01fd7ad4eULL, 0x6956d578eULL, 0x72b5ebf80ULL, 0x71eab6a96ULL },
+    { 0xc8765bc64ULL, 0x7b444cba3ULL, 0x263da6e13ULL, 0xc5d3222deULL },
+    { 0xad3d8215fULL, 0xcfd2e1668ULL, 0xfa841bcb5ULL, 0x166874bf3ULL },
+    { 0x96317a27eULL, 0xe95a47175ULL, 0x7e45e8c69ULL, 0xae8e25a97ULL },
+    { 0x05f813ca6ULL, 0xd1745058bULL, 0x653c81fa0ULL, 0xd1a0a2e8bULL },
+    { 0x0e7adc22eULL, 0xe3954f119ULL, 0x7443b5e70ULL, 0x988f2a9c7ULL },
+    { 0xbf52c4a50ULL, 0xea8d2a472ULL, 0x0a5234afdULL, 0x4e254b157ULL },
+    { 0x724f6ae2eULL, 0x205e6fa9fULL, 0x74756f24eULL, 0xf95f67a04ULL },
+    { 0x540fd7ea8ULL, 0xb0eb0bb8bULL, 0x157ebf02aULL, 0xd1dd0d70dULL },
+    { 0x9c962f741ULL, 0xde499e2a4ULL, 0x82ef46939ULL, 0x25479927bULL },
+    { 0x264042b01ULL, 0xa444a2012ULL, 0x80d420264ULL, 0x480452225ULL },
+    { 0x197cb7754ULL, 0x5bcdc27ccULL, 0x2aeed3e98ULL, 0x33e43b3daULL },
+    { 0x1f2bb850dULL, 0x878acd59cULL, 0xb0a1dd4f8ULL, 0x39ab351e1ULL },
+    { 0xc87d6c2adULL, 0x672747a2dULL, 0xb5436be13ULL, 0xb45e2e4e6ULL },
+    { 0xdc8d2dedeULL, 0x9a3b57aeeULL, 0x7b7b4b13bULL, 0x775eadc59ULL },
+    { 0xcb6b01738ULL, 0x13068bcf9ULL, 0x1ce80d6d3ULL, 0x9f3d160c8ULL },
+    { 0xbe4210368ULL, 0x8a0cab131ULL, 0x16c08427dULL, 0x8c8d53051ULL },
+    { 0xbb4622a77ULL, 0x0e5c6a677ULL, 0xee54462ddULL, 0xee6563a70ULL },
+    { 0x733226ef8ULL, 0x49692bcd7ULL, 0x1f7644cceULL, 0xeb3d49692ULL },
+    { 0x4933ade39ULL, 0x57830fcc7ULL, 0x9c7b5cc92ULL, 0xe33f0c1eaULL },
+    { 0x1f1c896c7ULL, 0xdeb846698ULL, 0xe369138f8ULL, 0x196621d7bULL },
+    { 0x897665abaULL, 0x73350b667ULL, 0x5d5a66e91ULL, 0xe66d0acceULL },
+    { 0x92f46ba12ULL, 0x715c16276ULL, 0x485d62f49ULL, 0x6e4683a8eULL },
+    { 0x297981767ULL, 0x5f96e2489ULL, 0xe6e819e94ULL, 0x9124769faULL },
+    { 0xad702cf8dULL, 0xc725e74a6ULL, 0xb1f340eb5ULL, 0x652e7a4e3ULL },
+    { 0x473198b90ULL, 0xc1a286d52ULL, 0x09d198ce2ULL, 0x4ab614583ULL },
+    { 0xec2e8e06bULL, 0x8fd12da29ULL, 0xd60717437ULL, 0x945b48bf1ULL },
+    { 0x36a1d6980ULL, 0xa1ebb0112ULL, 0x0196b856cULL, 0x4880dd785ULL },
+    { 0xa5ce8650fULL, 0x84d5f96a8ULL, 0xf0a6173a5ULL, 0x1569fab21ULL },
+    { 0x637870348ULL, 0x6904a3d1cULL, 0x12c0e1ec6ULL, 0x38bc52096ULL },
+    { 0xf3ab41d46ULL, 0x391af8cbaULL, 0x62b82d5cfULL, 0x5d31f589cULL },
+    { 0xe6032a8b5ULL, 0x84626c877ULL, 0xad154c067ULL, 0xee1364621ULL },
+    { 0x4c11eec73ULL, 0xeed3048c7ULL, 0xce3778832ULL, 0xe3120cb77ULL },
+    { 0x261de50d6ULL, 0xf8b36025cULL, 0x6b0a7b864ULL, 0x3a406cd1fULL },
+    { 0x296616e32ULL, 0x03552a7c3ULL, 0x4c7686694ULL, 0xc3e54aac0ULL },
+    { 0x37cff1a0aULL, 0xb09e3b71eULL, 0x5058ff3ecULL, 0x78edc790dULL },
+    { 0xc457847abULL, 0xc4b78baa1ULL, 0xd5e21ea23ULL, 0x855d1ed23ULL },
+    { 0x776e52ff9ULL, 0xad6cabfdbULL, 0x9ff4a76eeULL, 0xdbfd536b5ULL },
+    { 0x980819bb9ULL, 0x16288716bULL, 0x9dd981019ULL, 0xd68e11468ULL },
+    { 0x50cb2b5d8ULL, 0x186e9d8ccULL, 0x1bad4d30aULL, 0x331b97618ULL },
+    { 0x8b6918063ULL, 0x0f1604539ULL, 0xc601896d1ULL, 0x9ca2068f0ULL },
+    { 0x12d9c2ce9ULL, 0x6cee1109bULL, 0x973439b48ULL, 0xd90887736ULL },
+    { 0x158c2e738ULL, 0x8049976cdULL, 0x1ce7431a8ULL, 0xb36e99201ULL },
+    { 0x6b84015eaULL, 0x1a30b1e91ULL, 0x57a8021d6ULL, 0x8978d0c58ULL },
+    { 0x67695db9fULL, 0xb537e7d5aULL, 0xf9dba96e6ULL, 0x5abe7ecadULL },
+    { 0x3e72745c1ULL, 0xef2da8194ULL, 0x83a2e4e7cULL, 0x29815b4f7ULL },
+    { 0x01ca1a571ULL, 0x0c449c5c9ULL, 0x8ea585380ULL, 0x93a392230ULL },
+    { 0x22e7036f5ULL, 0x1d667a2d1ULL, 0xaf6c0e744ULL, 0x8b45e66b8ULL },
+    { 0xd5dcedae1ULL, 0xfcad16e2fULL, 0x875b73babULL, 0xf4768b53fULL },
+    { 0x809532c5bULL, 0x4c52113e6ULL, 0xda34ca901ULL, 0x67c884a32ULL },
+    { 0xf7e4e9d54ULL, 0xb98cf4ef6ULL, 0x2ab9727efULL, 0x6f72f319dULL },
+    { 0x59d84f9cbULL, 0x7e7d95c0aULL, 0xd39f21b9aULL, 0x503a9be7eULL },
+    { 0xf42ed0851ULL, 0xad8828b6aULL, 0x8a10b742fULL, 0x56d1411b5ULL },
+    { 0x5db4a91faULL, 0xdbb895e45ULL, 0x5f8952dbaULL, 0xa27a91ddbULL },
+    { 0x0d58e5b1fULL, 0xf695c344eULL, 0xf8da71ab0ULL, 0x722c3a96fULL },
+    { 0x69fb9fa43ULL, 0x5fd73ed0aULL, 0xc25f9df96ULL, 0x50b7cebfaULL },
+    { 0x29ba51f60ULL, 0x7b00ba58bULL, 0x06f8a5d94ULL, 0xd1a5d00deULL },
+    { 0x587c67427ULL, 0x775d40a8dULL, 0xe42e63e1aULL, 0xb1502baeeULL },
+    { 0xd8b9021edULL, 0x4f6ad1829ULL, 0xb78409d1bULL, 0x9418b56f2ULL },
+    { 0xbb594449eULL, 0x623f614f8ULL, 0x792229addULL, 0x1f286fc46ULL },
+    { 0xaa231f35aULL, 0x1b53af170ULL, 0x5acf8c455ULL, 0x0e8f5cad8ULL },
+    { 0x0d95943f4ULL, 0xcaa3d2741ULL, 0x2fc29a9b0ULL, 0x82e4bc553ULL },
+    { 0xdec461257ULL, 0xbe1c52a74ULL, 0xea486237bULL, 0x2e54a387dULL },
+    { 0x05a16930dULL, 0xb502d7404ULL, 0xb0c9685a0ULL, 0x202eb40adULL },
+    { 0xe2512eb58ULL, 0x4847a7876ULL, 0x1ad748a47ULL, 0x6e1e5e212ULL },
+    { 0xab48e2dc0ULL, 0x2ae4a04beULL, 0x03b4712d5ULL, 0x7d2052754ULL },
+    { 0x0cb68494fULL, 0xcf91d9202ULL, 0xf29216d30ULL, 0x4049b89f3ULL },
+    { 0x927a6b5b1ULL, 0x756c8c0fdULL, 0x8dad65e49ULL, 0xbf03136aeULL },
+    { 0xbb90f3450ULL, 0x7ac8305f4ULL, 0x0a2cf09ddULL, 0x2fa0c135eULL },
+    { 0x632e8fad0ULL, 0x19e12ee5aULL, 0x0b5f174c6ULL, 0x5a7748798ULL },
+    { 0xc2eeaf2a7ULL, 0x15f55ea3dULL, 0xe54f57743ULL, 0xbc57aafa8ULL },
+    { 0x1eb2af39dULL, 0xd7e9df054ULL, 0xb9cf54d78ULL, 0x2a0fb97ebULL },
+    { 0x511548c52ULL, 0x681a04ec2ULL, 0x4a312a88aULL, 0x437205816ULL },
+    { 0x4693d5de4ULL, 0xf8a3d8993ULL, 0x27babc962ULL, 0xc991bc51fULL },
+    { 0x888e9161dULL, 0x16805b3e8ULL, 0xb86897111ULL, 0x17cda0168ULL },
+    { 0x68836ff4fULL, 0x3e53ff886ULL, 0xf2ff6c116ULL, 0x611ffca7cULL },
+    { 0x51bd2e441ULL, 0x4d4b14e8cULL, 0x82274bd8aULL, 0x31728d2b2ULL },
+    { 0x7a0ac40e9ULL, 0x2ea929819ULL, 0x97023505eULL, 0x981949574ULL },
+    { 0x8bb762b4aULL, 0x6b529b636ULL, 0x52d46edd1ULL, 0x6c6d94ad6ULL },
+    { 0x1caf83a1aULL, 0x93da1b24aULL, 0x585c1f538ULL, 0x524d85bc9ULL },
+    { 0xc2700bbbdULL, 0x5564c7873ULL, 0xbddd00e43ULL, 0xce1e326aaULL },
+    { 0xfb2ed09aaULL, 0x23b8a9f3bULL, 0x5590b74dfULL, 0xdcf951dc4ULL },
+    { 0xf8520294eULL, 0x4a5ce9822ULL, 0x729404a1fULL, 0x441973a52ULL },
+    { 0x7aa104ca6ULL, 0x033b70893ULL, 0x65320855eULL, 0xc910edcc0ULL },
+    { 0x6a96d2bcbULL, 0x6ef0bbb12ULL, 0xd3d4b6956ULL, 0x48ddd0f76ULL },
+    { 0x28f2ec75eULL, 0x6b95ff0c4ULL, 0x7ae374f14ULL, 0x230ffa9d6ULL },
+    { 0x607065eb4ULL, 0x7125628c7ULL, 0x2d7a60e06ULL, 0xe3146a48eULL },
+    { 0x7ad9b3a8cULL, 0x52ee7391eULL, 0x315cd9b5eULL, 0x789ce774aULL },
+    { 0x3572d6cbfULL, 0xe5fd695c3ULL, 0xfd36b4eacULL, 0xc3a96bfa7ULL },
+    { 0xd426efb8fULL, 0xb5f9cfa26ULL, 0xf1df7642bULL, 0x645f39fadULL },
+    { 0x64ee4dbaaULL, 0xb135bfa0bULL, 0x55db27726ULL, 0xd05fdac8dULL },
+    { 0x983d7a8f1ULL, 0x6f6a0436fULL, 0x8f15ebc19ULL, 0xf6c2056f6ULL },
+    { 0x8ca31f499ULL, 0x97631d1e0ULL, 0x992f8c531ULL, 0x078b8c6e9ULL },
+    { 0x025457b46ULL, 0x7855c2312ULL, 0x62dea2a40ULL, 0x48c43aa1eULL },
+    { 0xd53ae4149ULL, 0xed8989c2cULL, 0x928275cabULL, 0x3439191b7ULL },
+    { 0x9d3c64396ULL, 0xe339c266cULL, 0x69c263cb9ULL, 0x366439cc7ULL },
+    { 0x795332ee5ULL, 0x4e6e6ad87ULL, 0xa774cca9eULL, 0xe1b567672ULL },
+    { 0x70884d664ULL, 0x380976889ULL, 0x266b2110eULL, 0x9116e901cULL },
+    { 0x1dd3528d8ULL, 0xea6e19542ULL, 0x1b14acbb8ULL, 0x42a987657ULL },
+    { 0xd8e51d246ULL, 0x1b1f56b20ULL, 0x624b8a71bULL, 0x04d6af8d8ULL },
+    { 0xd6029ca38ULL, 0x80890f973ULL, 0x1c539406bULL, 0xce9f09101ULL },
+    { 0xd94ab610cULL, 0x02cdc9d2cULL, 0x3086d529bULL, 0x34b93b340ULL },
+    { 0x766bb8880ULL, 0x81ae2c91eULL, 0x0111dd66eULL, 0x789347581ULL },
+    { 0xfd0c6b319ULL, 0xb648a7e6cULL, 0x98cd630bfULL, 0x367e5126dULL },
+    { 0x3bff8b9d1ULL, 0x5feebc65aULL, 0x8b9d1ffdcULL, 0x5a63d77faULL },
+    { 0xe786f4d4eULL, 0xa891f9fb6ULL, 0x72b2f61e7ULL, 0x6df9f8915ULL },
+    { 0xd4e6b9b79ULL, 0x9d8c9fb67ULL, 0x9ed9d672bULL, 0xe6df931b9ULL },
+    { 0xcfa8bb369ULL, 0x9fc097d3dULL, 0x96cdd15f3ULL, 0xbcbe903f9ULL },
+    { 0x20a4366c6ULL, 0x097172384ULL, 0x6366c2504ULL, 0x21c4e8e90ULL },
+    { 0x5cefb9536ULL, 0x939edcbcdULL, 0x6ca9df73aULL, 0xb3d3b79c9ULL },
+    { 0x0f06b6605ULL, 0x86c14a794ULL, 0xa066d60f0ULL, 0x29e528361ULL },
+    { 0xbb51d25e7ULL, 0x6efee05b1ULL, 0xe7a4b8addULL, 0x8da077f76ULL },
+    { 0xf7e262641ULL, 0xad4c3acb4ULL, 0x8264647efULL, 0x2d35c32b5ULL },
+    { 0x81fda9855ULL, 0x5d865466eULL, 0xaa195bf81ULL, 0x7662a61baULL },
+    { 0x2241dbc59ULL, 0x3cc6251d2ULL, 0x9a3db8244ULL, 0x4b8a4633cULL },
+    { 0x56fb4b280ULL, 0xf16e1e818ULL, 0x014d2df6aULL, 0x18178768fULL },
+    { 0xeda64c6d0ULL, 0xab213eee0ULL, 0x0b63265b7ULL, 0x0777c84d5ULL },
+    { 0xce7b080f4ULL, 0xcb264c879ULL, 0x2f010de73ULL, 0x9e13264d3ULL },
+    { 0x6192ee7e9ULL, 0x6ce1bfc85ULL, 0x97e774986ULL, 0xa13fd8736ULL },
+    { 0x943ff5124ULL, 0xf18bc832dULL, 0x248affc29ULL, 0xb4c13d18fULL },
+    { 0x88b3beadfULL, 0x4ff35f166ULL, 0xfb57dcd11ULL, 0x668facff2ULL },
+    { 0x9b27e58d0ULL, 0x3bab08676ULL, 0x0b1a7e4d9ULL, 0x6e610d5dcULL },
+    { 0xbe0b45fd2ULL, 0xba3baa0faULL, 0x4bfa2d07dULL, 0x5f055dc5dULL },
+    { 0x69fb3a72aULL, 0x4356bfd8dULL, 0x54e5cdf96ULL, 0xb1bfd6ac2ULL },
+    { 0x61383a832ULL, 0x415024d4fULL, 0x4c15c1c86ULL, 0xf2b240a82ULL },
+    { 0x6688639b3ULL, 0xb470b085fULL, 0xcd9c61166ULL, 0xfa10d0e2dULL },
+    { 0x54d01c992ULL, 0xc03d94942ULL, 0x499380b2aULL, 0x42929bc03ULL },
+    { 0x90b10c02aULL, 0x411b15021ULL, 0x540308d09ULL, 0x840a8d882ULL },
+    { 0xf667fc6d1ULL, 0xadaf2ebf4ULL, 0x8b63fe66fULL, 0x2fd74f5b5ULL },
+    { 0x7acd75813ULL, 0x361f30b5eULL, 0xc81aeb35eULL, 0x7ad0cf86cULL },
+    { 0x3abd07f61ULL, 0x5f4bb229bULL, 0x86fe0bd5cULL, 0xd944dd2faULL },
+    { 0x543012473ULL, 0xcd58009c1ULL, 0xce2480c2aULL, 0x839001ab3ULL },
+    { 0x067794d58ULL, 0xc987893d2ULL, 0x1ab29ee60ULL, 0x4bc91e193ULL },
+    { 0xa855b1201ULL, 0x568622324ULL, 0x8048daa15ULL, 0x24c44616aULL },
+    { 0x9cb4d7fdbULL, 0xfff9933e2ULL, 0xdbfeb2d39ULL, 0x47cc99fffULL },
+    { 0x31a193e6aULL, 0x19da33583ULL, 0x567c9858cULL, 0xc1acc5b98ULL },
+    { 0x3da3b76d4ULL, 0x9beb7a5c4ULL, 0x2b6edc5bcULL, 0x23a5ed7d9ULL },
+    { 0x4153f1e04ULL, 0x70864ad86ULL, 0x2078fca82ULL, 0x61b52610eULL },
+    { 0x5544335b5ULL, 0x946cc0fc5ULL, 0xadacc22aaULL, 0xa3f033629ULL },
+    { 0x92f61249dULL, 0x456c593f0ULL, 0xb92486f49ULL, 0x0fc9a36a2ULL },
+    { 0x269a35f8aULL, 0xd031bb19eULL, 0x51fac5964ULL, 0x798dd8c0bULL },
+    { 0x042677896ULL, 0xb17148346ULL, 0x691ee6420ULL, 0x62c128e8dULL },
+    { 0x9487cdc6fULL, 0xbc9b5d2a3ULL, 0xf63b3e129ULL, 0xc54bad93dULL },
+    { 0x4ea7e7d9cULL, 0xb3e3d9ad6ULL, 0x39be7e572ULL, 0x6b59bc7cdULL },
+    { 0x2e367345bULL, 0xff50293d4ULL, 0xda2ce6c74ULL, 0x2bc940affULL },
+    { 0x3a5e8f304ULL, 0x52cdee218ULL, 0x20cf17a5cULL, 0x18477b34aULL },
+    { 0x76d9faa77ULL, 0xecde7695fULL, 0xee55f9b6eULL, 0xfa96e7b37ULL },
+    { 0x64e4ea1dfULL, 0xadf4f5a44ULL, 0xfb8572726ULL, 0x225af2fb5ULL },
+    { 0x12a7b434dULL, 0x0d8bdb314ULL, 0xb2c2de548ULL, 0x28cdbd1b0ULL },
+    { 0x4973d9553ULL, 0x7f968cdc0ULL, 0xcaa9bce92ULL, 0x03b3169feULL },
+    { 0xcdb418975ULL, 0xcf00d4f63ULL, 0xae9182db3ULL, 0xc6f2b00f3ULL },
+    { 0x8bda76d2eULL, 0x6255d95bfULL, 0x74b6e5bd1ULL, 0xfda9baa46ULL },
+    { 0xf54a4dec8ULL, 0xb82d2fcaaULL, 0x137b252afULL, 0x553f4b41dULL },
+    { 0x811616f8aULL, 0x40718b7a2ULL, 0x51f686881ULL, 0x45ed18e02ULL },
+    { 0x4036f4e6bULL, 0x6d910bb87ULL, 0xd672f6c02ULL, 0xe1dd089b6ULL },
+    { 0x2736282a6ULL, 0xc1306e615ULL, 0x654146ce4ULL, 0xa86760c83ULL },
+    { 0xa413d229fULL, 0xe4f26b160ULL, 0xf944bc825ULL, 0x068d64f27ULL },
+    { 0x901fe4c17ULL, 0x649b482eeULL, 0xe8327f809ULL, 0x77412d926ULL },
+    { 0x9abfce56eULL, 0x6bdbdd2b9ULL, 0x76a73fd59ULL, 0x9d4bbdbd6ULL },
+    { 0x2d325b9efULL, 0xff70ed503ULL, 0xf79da4cb4ULL, 0xc0ab70effULL },
+    { 0xd9901f6a9ULL, 0x566917da1ULL, 0x956f8099bULL, 0x85be8966aULL },
+    { 0x3aa64fadeULL, 0x3b797f252ULL, 0x7b5f2655cULL, 0x4a4fe9edcULL },
+    { 0x65288d60bULL, 0x959127c88ULL, 0xd06b114a6ULL, 0x113e489a9ULL },
+    { 0x0a53e960bULL, 0x76960f094ULL, 0xd0697ca50ULL, 0x290f0696eULL },
+    { 0xe9e09c3e4ULL, 0x0ba5f6d21ULL, 0x27c390797ULL, 0x84b6fa5d0ULL },
+    { 0x4d9b7863dULL, 0xe6025fdcdULL, 0xbc61ed9b2ULL, 0xb3bfa4067ULL },
+    { 0xd98bb4833ULL, 0x069b18d6fULL, 0xcc12dd19bULL, 0xf6b18d960ULL },
+    { 0x34b181ed7ULL, 0xddba720c2ULL, 0xeb7818d2cULL, 0x4304e5dbbULL },
+    { 0x5b373f490ULL, 0x536b0cfd4ULL, 0x092fcecdaULL, 0x2bf30d6caULL },
+    { 0x8572b7b91ULL, 0xd5e58a566ULL, 0x89ded4ea1ULL, 0x66a51a7abULL },
+    { 0x2c5d056a4ULL, 0xd22762289ULL, 0x256a0ba34ULL, 0x91446e44bULL },
+    { 0xe4671296dULL, 0x8d46e9b23ULL, 0xb6948e627ULL, 0xc4d9762b1ULL },
+    { 0x2a08d6f78ULL, 0x2ac1a31dbULL, 0x1ef6b1054ULL, 0xdb8c58354ULL },
+    { 0x452949c61ULL, 0xbd0204c8bULL, 0x8639294a2ULL, 0xd132040bdULL },
+    { 0x2501ec5b7ULL, 0xa4b3e44c5ULL, 0xeda3780a4ULL, 0xa3227cd25ULL },
+    { 0xb8f54779cULL, 0x736ff32e0ULL, 0x39ee2af1dULL, 0x074cff6ceULL },
+    { 0xa3b7ea4b3ULL, 0x65f23c6f5ULL, 0xcd257edc5ULL, 0xaf63c4fa6ULL },
+    { 0x443d6b9b4ULL, 0xf162c4a4fULL, 0x2d9d6bc22ULL, 0xf2523468fULL },
+    { 0xbe2dcb848ULL, 0xbbca2523aULL, 0x121d3b47dULL, 0x5c4a453ddULL },
+    { 0xb51fc47ecULL, 0xe8abeb6a9ULL, 0x37e23f8adULL, 0x956d7d517ULL },
+    { 0x6f38cf988ULL, 0xf3e1a5c1aULL, 0x119f31cf6ULL, 0x583a587cfULL },
+    { 0x90f2fe934ULL, 0x61cddc167ULL, 0x2c97f4f09ULL, 0xe683bb386ULL },
+    { 0x07fd540abULL, 0xe53711719ULL, 0xd502abfe0ULL, 0x98e88eca7ULL },
+    { 0xee53c3d08ULL, 0xf2c6a98b2ULL, 0x10bc3ca77ULL, 0x4d195634fULL },
+    { 0xf7098ebcaULL, 0x88fba7c3aULL, 0x53d7190efULL, 0x5c3e5df11ULL },
+    { 0x65467c309ULL, 0xa405aff04ULL, 0x90c3e62a6ULL, 0x20ff5a025ULL },
+    { 0xae6fd797eULL, 0xbbd7e937bULL, 0x7e9ebf675ULL, 0xdec97ebddULL },
+    { 0x8bc4739e9ULL, 0x3e6491737ULL, 0x979ce23d1ULL, 0xece89267cULL },
+    { 0x971930fe4ULL, 0xc82ac25bfULL, 0x27f0c98e9ULL, 0xfda435413ULL },
+    { 0x9a752df57ULL, 0x5f1fc62f6ULL, 0xeafb4ae59ULL, 0x6f463f8faULL },
+    { 0xbd47fe53eULL, 0xa2dfed7e5ULL, 0x7ca7fe2bdULL, 0xa7eb7fb45ULL },
+    { 0x6f1530928ULL, 0xc202a1f17ULL, 0x1490ca8f6ULL, 0xe8f854043ULL },
+    { 0x5de1cc489ULL, 0xa7af15c80ULL, 0x9123387baULL, 0x013a8f5e5ULL },
+    { 0x111ce3dcdULL, 0x7ce8c168eULL, 0xb3bc73888ULL, 0x71683173eULL },
+    { 0xa4c7e157cULL, 0xb886f92e5ULL, 0x3ea87e325ULL, 0xa749f611dULL },
+    { 0x552691112ULL, 0x919888f40ULL, 0x4888964aaULL, 0x02f111989ULL },
+    { 0x9d6511805ULL, 0x970e40722ULL, 0xa0188a6b9ULL, 0x44e0270e9ULL },
+    { 0x6663c1cb3ULL, 0xb5b6288d3ULL, 0xcd383c666ULL, 0xcb1146dadULL },
+    { 0xbfc594002ULL, 0x829f30730ULL, 0x40029a3fdULL, 0x0ce0cf941ULL },
+    { 0x3a3500387ULL, 0x473ae2210ULL, 0xe1c00ac5cULL, 0x084475ce2ULL },
+    { 0x76d4f679cULL, 0xe0edf3bd4ULL, 0x39e6f2b6eULL, 0x2bdcfb707ULL },
+    { 0x446f2667bULL, 0x8d570bacdULL, 0xde664f622ULL, 0xb35d0eab1ULL },
+    { 0x17ae59e97ULL, 0xb5385e7daULL, 0xe979a75e8ULL, 0x5be7a1cadULL },
+    { 0x36132d63eULL, 0xd01b6f0d5ULL, 0x7c6b4c86cULL, 0xab0f6d80bULL },
+    { 0x8e07492bfULL, 0xb6324f271ULL, 0xfd492e071ULL, 0x8e4f24c6dULL },
+    { 0x188acddf1ULL, 0x3ea99c0cbULL, 0x8fbb35118ULL, 0xd3039957cULL },
+    { 0xed9052d02ULL, 0xe250b0da2ULL, 0x40b4a09b7ULL, 0x45b0d0a47ULL },
+    { 0x5b6bd01f5ULL, 0x2faec8d59ULL, 0xaf80bd6daULL, 0x9ab1375f4ULL },
+    { 0x84a4d070eULL, 0xa190d33a0ULL, 0x70e0b2521ULL, 0x05ccb0985ULL },
+    { 0xc9b2a3af4ULL, 0x5be05ac67ULL, 0x2f5c54d93ULL, 0xe635a07daULL },
+    { 0xab18852fcULL, 0x5aa163479ULL, 0x3f4a118d5ULL, 0x9e2c6855aULL },
+    { 0x9de918390ULL, 0x832e96568ULL, 0x09c1897b9ULL, 0x16a6974c1ULL },
+    { 0x3576ee9e0ULL, 0xe9edac607ULL, 0x079776eacULL, 0xe0635b797ULL },
+    { 0xe8d00d210ULL, 0x520536860ULL, 0x084b00b17ULL, 0x0616ca04aULL },
+    { 0x709b5a95cULL, 0x684afd94aULL, 0x3a95ad90eULL, 0x529bf5216ULL },
+    { 0xa9022a314ULL, 0x0240ee464ULL, 0x28c544095ULL, 0x262770240ULL },
+    { 0xa03ea2b9cULL, 0x41e0eb26eULL, 0x39d457c05ULL, 0x764d70782ULL },
+    { 0x1e589ec5eULL, 0xcadd451daULL, 0x7a3791a78ULL, 0x5b8a2bb53ULL },
+    { 0x74470eeddULL, 0x8c6f6fac2ULL, 0xbb770e22eULL, 0x435f6f631ULL },
+    { 0x36bd44159ULL, 0xed0bb1258ULL, 0x9a822bd6cULL, 0x1a48dd0b7ULL },
+    { 0xb7f8d2516ULL, 0xe1dcf05f8ULL, 0x68a4b1fedULL, 0x1fa0f3b87ULL },
+    { 0xdcde4bfa5ULL, 0xf66cdeaabULL, 0xa5fd27b3bULL, 0xd557b366fULL },
+    { 0x9eda99c30ULL, 0xd28c1c1fbULL, 0x0c3995b79ULL, 0xdf838314bULL },
+    { 0x8ffb98a8bULL, 0xc7b61f53aULL, 0xd1519dff1ULL, 0x5caf86de3ULL },
+    { 0x9ac777e71ULL, 0x3e4f1a3f7ULL, 0x8e7eee359ULL, 0xefc58f27cULL },
+    { 0x8d0a53cb3ULL, 0xb670085ebULL, 0xcd3ca50b1ULL, 0xd7a100e6dULL },
+    { 0xc9ed1dcedULL, 0x1f2755fabULL, 0xb73b8b793ULL, 0xd5faae4f8ULL },
+    { 0xc238535eaULL, 0x7970819b9ULL, 0x57aca1c43ULL, 0x9d9810e9eULL },
+    { 0xee4aa6437ULL, 0x86d5688fdULL, 0xec2655277ULL, 0xbf116ab61ULL },
+    { 0xcd8345a1eULL, 0xb2135bc62ULL, 0x785a2c1b3ULL, 0x463dac84dULL },
+    { 0x5a19e05aeULL, 0x62bac189dULL, 0x75a07985aULL, 0xb91835d46ULL },
+    { 0x96d780d25ULL, 0xc48ed82b3ULL, 0xa4b01eb69ULL, 0xcd41b7123ULL },
+    { 0xe2c885185ULL, 0x14a5f0838ULL, 0xa18a11347ULL, 0x1c10fa528ULL },
+    { 0xc5314f8dbULL, 0xfd7305c62ULL, 0xdb1f28ca3ULL, 0x463a0cebfULL },
+    { 0xa47c37ee1ULL, 0xdd65223afULL, 0x877ec3e25ULL, 0xf5c44a6bbULL },
+    { 0x1d82c6f8cULL, 0xa2e9db482ULL, 0x31f6341b8ULL, 0x412db9745ULL },
+    { 0x325c5c6c8ULL, 0x682d27398ULL, 0x1363a3a4cULL, 0x19ce4b416ULL },
+    { 0x5d9d1bae0ULL, 0xda6a16f0bULL, 0x075d8b9baULL, 0xd0f68565bULL },
+    { 0x9549e075eULL, 0xa89ec34ecULL, 0x7ae0792a9ULL, 0x372c37915ULL },
+    { 0x8a6845c15ULL, 0x3705400faULL, 0xa83a21651ULL, 0x5f002a0ecULL },
+    { 0xadf9f10feULL, 0xfbb67156dULL, 0x7f08f9fb5ULL, 0xb6a8e6ddfULL },
+    { 0x95cef30b0ULL, 0xb0ec1876dULL, 0x0d0cf73a9ULL, 0xb6e18370dULL },
+    { 0x71933b20dULL, 0x544a7fd04ULL, 0xb04dcc98eULL, 0x20bfe522aULL },
+    { 0x1f0de3a6fULL, 0xbeda4361fULL, 0xf65c7b0f8ULL, 0xf86c25b7dULL },
+    { 0x596f5bba6ULL, 0x337ecef0bULL, 0x65ddaf69aULL, 0xd0f737eccULL },
+    { 0xcd61d9f34ULL, 0xb386c6de3ULL, 0x2cf9b86b3ULL, 0xc7b6361cdULL },
+    { 0xa478ad328ULL, 0xd185a702dULL, 0x14cb51e25ULL, 0xb40e5a18bULL },
+    { 0xdade4012fULL, 0x661cd9a39ULL, 0xf48027b5bULL, 0x9c59b3866ULL },
+    { 0xd15764370ULL, 0x680f8ae65ULL, 0x0ec26ea8bULL, 0xa6751f016ULL },
+    { 0x3a2bf5d22ULL, 0x339ba819fULL, 0x44bafd45cULL, 0xf9815d9ccULL },
+    { 0x2303e348dULL, 0x34e269494ULL, 0xb12c7c0c4ULL, 0x29296472cULL },
+    { 0x41b9bf9a9ULL, 0x55e395d0fULL, 0x959fd9d82ULL, 0xf0ba9c7aaULL },
+    { 0x5a4e93ee3ULL, 0x1efc0ab9bULL, 0xc77c9725aULL, 0xd9d503f78ULL },
+    { 0x462b44512ULL, 0xa113888d8ULL, 0x48a22d462ULL, 0x1b111c885ULL },
+    { 0x4e01719c1ULL, 0xbe2280916ULL, 0x8398e8072ULL, 0x68901447dULL },
+    { 0x73a0d9137ULL, 0x3598f4d51ULL, 0xec89b05ceULL, 0x8ab2f19acULL },
+    { 0x932b416ddULL, 0x3d2a4b4f8ULL, 0xbb682d4c9ULL, 0x1f2d254bcULL },
+    { 0xff4b615a7ULL, 0xb63ee8cbdULL, 0xe5a86d2ffULL, 0xbd3177c6dULL },
+    { 0x2c880f1acULL, 0x9261f5009ULL, 0x358f01134ULL, 0x900af8649ULL },
+    { 0x6f3bb6aa1ULL, 0xc7e32ad1fULL, 0x8556ddcf6ULL, 0xf8b54c7e3ULL },
+    { 0x476d21ae6ULL, 0x993642e1fULL, 0x67584b6e2ULL, 0xf87426c99ULL },
+    { 0xf9c290688ULL, 0x02ac3bda0ULL, 0x11609439fULL, 0x05bdc3540ULL },
+    { 0x768111210ULL, 0x900a32950ULL, 0x08488816eULL, 0x0a94c5009ULL },
+    { 0x623458f55ULL, 0x6d00e6bd2ULL, 0xaaf1a2c46ULL, 0x4bd6700b6ULL },
+    { 0xf31919e1fULL, 0x541a67dfaULL, 0xf879898cfULL, 0x5fbe6582aULL },
+    { 0xef47a7dd1ULL, 0x9ee7a8ef6ULL, 0x8bbe5e2f7ULL, 0x6f715e779ULL },
+    { 0xc6c777808ULL, 0xb04719b36ULL, 0x101eee363ULL, 0x6cd98e20dULL },
+    { 0xeec96f096ULL, 0xb2777487cULL, 0x690f69377ULL, 0x3e12eee4dULL },
+    { 0x9b3c9bdafULL, 0x57f8c57bbULL, 0xf5bd93cd9ULL, 0xddea31feaULL },
+    { 0x6fd432573ULL, 0xce54b0fd5ULL, 0xcea4c2bf6ULL, 0xabf0d2a73ULL },
+    { 0x60e7d0aa9ULL, 0x25a63bb03ULL, 0x9550be706ULL, 0xc0ddc65a4ULL },
+    { 0x0651cda34ULL, 0xf08746053ULL, 0x2c5b38a60ULL, 0xca062e10fULL },
+    { 0xe2acc04e7ULL, 0x2db070ab9ULL, 0xe72033547ULL, 0x9d50e0db4ULL },
+    { 0x9460d1a22ULL, 0xb19c02123ULL, 0x4458b0629ULL, 0xc4840398dULL },
+    { 0x82b79b177ULL, 0x5dd2dc371ULL, 0xee8d9ed41ULL, 0x8ec3b4bbaULL },
+    { 0x4eb189f4bULL, 0xdf9297892ULL, 0xd2f918d72ULL, 0x491e949fbULL },
+    { 0xcbf9c3b1eULL, 0x73d6d3c7aULL, 0x78dc39fd3ULL, 0x5e3cb6bceULL },
+    { 0x6f6c64841ULL, 0xaf0520e1eULL, 0x8212636f6ULL, 0x78704a0f5ULL },
+    { 0xe54e50a2eULL, 0xa0146bf2bULL, 0x7450a72a7ULL, 0xd4fd62805ULL },
+    { 0x632f30f23ULL, 0x0512aaf9fULL, 0xc4f0cf4c6ULL, 0xf9f5548a0ULL },
+    { 0xb3bb3de6cULL, 0x590b7f5bfULL, 0x367bcddcdULL, 0xfdafed09aULL },
+    { 0x6331f5383ULL, 0x75b3a2d14ULL, 0xc1caf8cc6ULL, 0x28b45cdaeULL },
+    { 0xbca1dafe5ULL, 0xafeaf61a3ULL, 0xa7f5b853dULL, 0xc586f57f5ULL },
+    { 0xd1816cab9ULL, 0x242b17c67ULL, 0x9d536818bULL, 0xe63e8d424ULL },
+    { 0x0d8407acaULL, 0x9a7113602ULL, 0x535e021b0ULL, 0x406c88e59ULL },
+    { 0x794e1d7e5ULL, 0x1e2deef89ULL, 0xa7eb8729eULL, 0x91f77b478ULL },
+    { 0x92de65442ULL, 0x781d182bcULL, 0x422a67b49ULL, 0x3d418b81eULL },
+    { 0x651497949ULL, 0xdcc1a1f02ULL, 0x929e928a6ULL, 0x40f85833bULL },
+    { 0x33f751712ULL, 0x711eba7d0ULL, 0x48e8aefccULL, 0x0be5d788eULL },
+    { 0x3c9ce9195ULL, 0xf6a8f424cULL, 0xa9897393cULL, 0x3242f156fULL },
+    { 0x7ecb81d7aULL, 0x9a9eb98dbULL, 0x5eb81d37eULL, 0xdb19d7959ULL },
+    { 0xede140178ULL, 0xab06b1c61ULL, 0x1e80287b7ULL, 0x8638d60d5ULL },
+    { 0xc09b0ee2cULL, 0x40435f8abULL, 0x34770d903ULL, 0xd51fac202ULL },
+    { 0x14e61f774ULL, 0x994dde3c1ULL, 0x2eef86728ULL, 0x83c7bb299ULL },
+    { 0x6d336649aULL, 0xe37329cc4ULL, 0x59266ccb6ULL, 0x23394cec7ULL },
+    { 0x865dd0880ULL, 0xe0a60033aULL, 0x0110bba61ULL, 0x5cc006507ULL },
+    { 0xf7214bfb8ULL, 0xb16aa7cf3ULL, 0x1dfd284efULL, 0xcf3e5568dULL },
+    { 0xd8b9c2e22ULL, 0x63da128abULL, 0x447439d1bULL, 0xd51485bc6ULL },
+    { 0x99a70737fULL, 0x1f5bdb661ULL, 0xfece0e599ULL, 0x866dbdaf8ULL },
+    { 0xc0ecf90c9ULL, 0x3da415b2cULL, 0x9309f3703ULL, 0x34da825bcULL },
+    { 0xbb8b26e01ULL, 0x064b3a4beULL, 0x80764d1ddULL, 0x7d25cd260ULL },
+    { 0x05678fcacULL, 0x91e74d683ULL, 0x353f1e6a0ULL, 0xc16b2e789ULL },
+    { 0x33b483834ULL, 0x51c870653ULL, 0x2c1c12dccULL, 0xca60e138aULL },
+    { 0xeb9d84b83ULL, 0x46b3b2e3aULL, 0xc1d21b9d7ULL, 0x5c74dcd62ULL },
+    { 0x7ca277ea2ULL, 0xb3793a987ULL, 0x457ee453eULL, 0xe195c9ecdULL },
+    { 0x02af5f66bULL, 0x3d531f399ULL, 0xd66faf540ULL, 0x99cf8cabcULL },
+    { 0x4a678c122ULL, 0x03978ca11ULL, 0x44831e652ULL, 0x88531e9c0ULL },
+    { 0x121592bf3ULL, 0x4cfa82353ULL, 0xcfd49a848ULL, 0xcac415f32ULL },
+    { 0xcc82b48c9ULL, 0x8ea119926ULL, 0x9312d4133ULL, 0x649988571ULL },
+    { 0x77cbe90fcULL, 0xb8ae7dc5dULL, 0x3f097d3eeULL, 0xba3be751dULL },
+    { 0x5ef7d7931ULL, 0xf7cf98b53ULL, 0x8c9ebef7aULL, 0xcad19f3efULL },
+    { 0x117947995ULL, 0x756fc044aULL, 0xa99e29e88ULL, 0x52203f6aeULL },
+    { 0x344d5f970ULL, 0xb84fa434bULL, 0x0e9fab22cULL, 0xd2c25f21dULL },
+    { 0xdf2f12e72ULL, 0x8b5a0affbULL, 0x4e748f4fbULL, 0xdff505ad1ULL },
+    { 0x114277b37ULL, 0x345dca547ULL, 0xecdee4288ULL, 0xe2a53ba2cULL },
+    { 0x0b8fa73d5ULL, 0x1ee3da65cULL, 0xabce5f1d0ULL, 0x3a65bc778ULL },
+    { 0x36e16f423ULL, 0xb55f34095ULL, 0xc42f6876cULL, 0xa902cfaadULL },
+    { 0x057402b7eULL, 0xc954c3643ULL, 0x7ed402ea0ULL, 0xc26c32a93ULL },
+    { 0xc342423a7ULL, 0x2474cac31ULL, 0xe5c4242c3ULL, 0x8c3532e24ULL },
+    { 0x758c34dabULL, 0x8439b1f8fULL, 0xd5b2c31aeULL, 0xf1f8d9c21ULL },
+    { 0x67dc61614ULL, 0xf00472edcULL, 0x286863be6ULL, 0x3b74e200fULL },
+    { 0x29b222068ULL, 0x4b4039405ULL, 0x160444d94ULL, 0xa029c02d2ULL },
+    { 0x7101af0faULL, 0x18fb25c45ULL, 0x5f0f5808eULL, 0xa23a4df18ULL },
+    { 0x54d22bc75ULL, 0xdc4c5c8c7ULL, 0xae3d44b2aULL, 0xe313a323bULL },
+    { 0x908ba3af9ULL, 0x1cea1b06fULL, 0x9f5c5d109ULL, 0xf60d85738ULL },
+    { 0xeb68c9b51ULL, 0x3f84a6c7aULL, 0x8ad9316d7ULL, 0x5e36521fcULL },
+    { 0x2605d442cULL, 0xa08361391ULL, 0x3422ba064ULL, 0x89c86c105ULL },
+    { 0x6ab88b7f4ULL, 0x5be0f68d9ULL, 0x2fed11d56ULL, 0x9b16f07daULL },
+    { 0x207c7657dULL, 0x6d45e13cdULL, 0xbea6e3e04ULL, 0xb3c87a2b6ULL },
+    { 0x377940d20ULL, 0xe10ea049bULL, 0x04b029eecULL, 0xd92057087ULL },
+    { 0xac2eb77b6ULL, 0x93f1ea3edULL, 0x6deed7435ULL, 0xb7c578fc9ULL },
+    { 0x3e87318ecULL, 0x9a2a79317ULL, 0x3718ce17cULL, 0xe8c9e5459ULL },
+    { 0x47afea1aaULL, 0xa1f29de1dULL, 0x55857f5e2ULL, 0xb87b94f85ULL },
+    { 0x46de35b74ULL, 0xd805dab5fULL, 0x2edac7b62ULL, 0xfad5ba01bULL },
+    { 0x48a36ba10ULL, 0x33421e846ULL, 0x085d6c512ULL, 0x6217842ccULL },
+    { 0xf0711536bULL, 0x5d1fa3921ULL, 0xd6ca88e0fULL, 0x849c5f8baULL },
+    { 0x963f87ed4ULL, 0xd9eb4a2faULL, 0x2b7e1fc69ULL, 0x5f452d79bULL },
+    { 0xd83ab9965ULL, 0x5f88cc92fULL, 0xa699d5c1bULL, 0xf493311faULL },
+    { 0x7b2eb5a0fULL, 0x17996bf1eULL, 0xf05ad74deULL, 0x78fd699e8ULL },
+    { 0xb6adfaf32ULL, 0xa1dab63ffULL, 0x4cf5fb56dULL, 0xffc6d5b85ULL },
+    { 0x87e07a4eaULL, 0xa974155b5ULL, 0x5725e07e1ULL, 0xadaa82e95ULL },
+    { 0x7b4518f4eULL, 0x0a1ee7f92ULL, 0x72f18a2deULL, 0x49fe77850ULL },
+    { 0x9064a3738ULL, 0x11cc832e5ULL, 0x1cec52609ULL, 0xa74c13388ULL },
+    { 0x3c242ca12ULL, 0x831926246ULL, 0x48534243cULL, 0x6246498c1ULL },
+    { 0x96b25c4a4ULL, 0xe1295c1b1ULL, 0x2523a4d69ULL, 0x8d83a9487ULL },
+    { 0x8b01d83acULL, 0x22a2c7531ULL, 0x35c1b80d1ULL, 0x8cae34544ULL },
+    { 0xe51cceb25ULL, 0xe4c1e6e2bULL, 0xa4d7338a7ULL, 0xd47678327ULL },
+    { 0x480f58db0ULL, 0x22228cbcbULL, 0x0db1af012ULL, 0xd3d314444ULL },
+    { 0xbae295867ULL, 0x1f9d78133ULL, 0xe61a9475dULL, 0xcc81eb9f8ULL },
+    { 0x89fc0fba0ULL, 0x53659662bULL, 0x05df03f91ULL, 0xd4669a6caULL },
+    { 0xdd06475e9ULL, 0xbe6989ea1ULL, 0x97ae260bbULL, 0x85791967dULL },
+    { 0xf7fe46b4cULL, 0xe94dfbe3aULL, 0x32d627fefULL, 0x5c7dfb297ULL },
+    { 0x43cef026dULL, 0x2c845bf1dULL, 0xb640f73c2ULL, 0xb8fda2134ULL },
+    { 0x6393585a2ULL, 0x6032bcd91ULL, 0x45a1ac9c6ULL, 0x89b3d4c06ULL },
+    { 0x87b404456ULL, 0xc911506f0ULL, 0x6a2202de1ULL, 0x0f60a8893ULL },
+    { 0x4fa47cbeaULL, 0xab3197f17ULL, 0x57d3e25f2ULL, 0xe8fe98cd5ULL },
+    { 0x7619f955aULL, 0xf89aa59dcULL, 0x5aa9f986eULL, 0x3b9a5591fULL },
+    { 0x51b9a1330ULL, 0x518a92c4dULL, 0x0cc859d8aULL, 0xb2349518aULL },
+    { 0x1533637c7ULL, 0xfd7aca484ULL, 0xe3ec6cca8ULL, 0x212535ebfULL },
+    { 0x7587a972aULL, 0x909abfe85ULL, 0x54e95e1aeULL, 0xa17fd5909ULL },
+    { 0x60de11622ULL, 0x50143ab89ULL, 0x446887b06ULL, 0x91d5c280aULL },
+    { 0x7d4ce68aeULL, 0xa2fd61e0fULL, 0x7516732beULL, 0xf0786bf45ULL },
+    { 0xaf135e81cULL, 0xe2436d572ULL, 0x3817ac8f5ULL, 0x4eab6c247ULL },
+    { 0x31c9b647cULL, 0x08cf715cdULL, 0x3e26d938cULL, 0xb3a8ef310ULL },
+    { 0xac43d8155ULL, 0xae86ec160ULL, 0xaa81bc235ULL, 0x068376175ULL },
+    { 0xd853e1cfbULL, 0x7ebe098e7ULL, 0xdf387ca1bULL, 0xe71907d7eULL },
+    { 0x4fcdc5cf0ULL, 0xbaa710edbULL, 0x0f3a3b3f2ULL, 0xdb708e55dULL },
+    { 0xee696fd2dULL, 0xb747e58bfULL, 0xb4bf69677ULL, 0xfd1a7e2edULL },
+    { 0xb71618475ULL, 0xcc086c7f1ULL, 0xae21868edULL, 0x8fe361033ULL },
+    { 0xb9b4b8781ULL, 0x47a8b67a4ULL, 0x81e1d2d9dULL, 0x25e6d15e2ULL },
+    { 0x328579505ULL, 0x340af4394ULL, 0xa0a9ea14cULL, 0x29c2f502cULL },
+    { 0x95e947771ULL, 0xbd4f924e9ULL, 0x8eee297a9ULL, 0x97249f2bdULL },
+    { 0x9aa0302e2ULL, 0x0b3812135ULL, 0x4740c0559ULL, 0xac8481cd0ULL },
+    { 0xec1828d17ULL, 0xc610e48eeULL, 0xe8b141837ULL, 0x771270863ULL },
+    { 0xbc5079635ULL, 0xf60c661e5ULL, 0xac69e0a3dULL, 0xa7866306fULL },
+    { 0x8785c1b79ULL, 0xbc8293673ULL, 0x9ed83a1e1ULL, 0xce6c9413dULL },
+    { 0xd37aadb7aULL, 0x599d8fc7fULL, 0x5edb55ecbULL, 0xfe3f1b99aULL },
+    { 0x817f02ce0ULL, 0x4966086abULL, 0x07340fe81ULL, 0xd56106692ULL },
+    { 0xfd63dfb0aULL, 0xb3dfafd22ULL, 0x50dfbc6bfULL, 0x44bf5fbcdULL },
+    { 0x510ac1af2ULL, 0x38b80ac4bULL, 0x4f583508aULL, 0xd23501d1cULL },
+    { 0x3d1edf8d3ULL, 0xfef92c74aULL, 0xcb1fb78bcULL, 0x52e349f7fULL },
+    { 0xf4b73a402ULL, 0xc15a3cba4ULL, 0x4025ced2fULL, 0x25d3c5a83ULL },
+    { 0x37d789e9cULL, 0xd0ae7f6d2ULL, 0x39791ebecULL, 0x4b6fe750bULL },
+    { 0x8f11c77caULL, 0xfaf3834b0ULL, 0x53ee388f1ULL, 0x0d2c1cf5fULL },
+    { 0xc4bd036beULL, 0xd17253ae9ULL, 0x7d6c0bd23ULL, 0x975ca4e8bULL },
+    { 0x7dfa995c9ULL, 0xdfacbdd88ULL, 0x93a995fbeULL, 0x11bbd35fbULL },
+    { 0x7b14e8251ULL, 0x6e8826e54ULL, 0x8a41728deULL, 0x2a7641176ULL },
+    { 0xca070e7f4ULL, 0x0a63ceaf1ULL, 0x2fe70e053ULL, 0x8f573c650ULL },
+    { 0x5c22dbcd5ULL, 0xbfe84c9c2ULL, 0xab3db443aULL, 0x4393217fdULL },
+    { 0xa0db726c8ULL, 0x68663b1acULL, 0x1364edb05ULL, 0x358dc6616ULL },
+    { 0x6b7776de2ULL, 0x6b77a8f97ULL, 0x47b6eeed6ULL, 0xe9f15eed6ULL },
+    { 0x80f58e748ULL, 0x49c7972a0ULL, 0x12e71af01ULL, 0x054e9e392ULL },
+    { 0xe1ac1ff4aULL, 0x1951b7faaULL, 0x52ff83587ULL, 0x55fed8a98ULL },
+    { 0x1bbaea85cULL, 0x6bc85d45eULL, 0x3a1575dd8ULL, 0x7a2ba13d6ULL },
+    { 0x26ac557fcULL, 0xb921f33d9ULL, 0x3feaa3564ULL, 0x9bccf849dULL },
+    { 0xe5d1ef357ULL, 0xfcd7f6c64ULL, 0xeacf78ba7ULL, 0x2636feb3fULL },
+    { 0x1f29d4e10ULL, 0xa38b025daULL, 0x0872b94f8ULL, 0x5ba40d1c5ULL },
+    { 0x459fbb15bULL, 0xdcd29df4cULL, 0xda8ddf9a2ULL, 0x32fb94b3bULL },
+    { 0xd4b049559ULL, 0xfd08958e0ULL, 0x9aa920d2bULL, 0x071a910bfULL },
+    { 0x6cb70acf8ULL, 0xcb623dac3ULL, 0x1f350ed36ULL, 0xc35bc46d3ULL },
+    { 0xf8617a518ULL, 0x234ea59e4ULL, 0x18a5e861fULL, 0x279a572c4ULL },
+    { 0xc391dac34ULL, 0x60c254df3ULL, 0x2c35b89c3ULL, 0xcfb2a4306ULL },
+    { 0x51235e2ccULL, 0x296b4fd00ULL, 0x3347ac48aULL, 0x00bf2d694ULL },
+    { 0x74407c4feULL, 0xa83d659c5ULL, 0x7f23e022eULL, 0xa39a6bc15ULL },
+    { 0xdf1609a24ULL, 0xd2084ee33ULL, 0x2459068fbULL, 0xcc772104bULL },
+    { 0xced27dc17ULL, 0xf6155c9f6ULL, 0xe83be4b73ULL, 0x6f93aa86fULL },
 };
 
 }//namespace
@@ -0,0 +1,264 @@
+/*
+By downloading, copying, installing or using the software you agree to this
+license. If you do not agree to this license, do not download, install,
+copy or use the software.
+
+                          License Agreement
+               For Open Source Computer Vision Library
+                       (3-clause BSD License)
+
+Copyright (C) 2013, OpenCV Foundation, all rights reserved.
+Third party copyrights are property of their respective owners.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice,
+    this list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the names of the copyright holders nor the names of the contributors
+    may be used to endorse or promote products derived from this software
+    without specific prior written permission.
+
+This software is provided by the copyright holders and contributors "as is" and
+any express or implied warranties, including, but not limited to, the implied
+warranties of merchantability and fitness for a particular purpose are
+disclaimed. In no event shall copyright holders or contributors be liable for
+any direct, indirect, incidental, special, exemplary, or consequential damages
+(including, but not limited to, procurement of substitute goods or services;
+loss of use, data, or profits; or business interruption) however caused
+and on any theory of liability, whether in contract, strict liability,
+or tort (including negligence or otherwise) arising in any way out of
+the use of this software, even if advised of the possibility of such damage.
+*/
+
+
+#include "precomp.hpp"
+#include "subpix.hpp"
+#include <opencv2/core/utility.hpp>
+#include <map>
+
+namespace cv {
+namespace aruco {
+
+using namespace std;
+
+
+/**
+  * Gaussian weights of a refinement window, zero in the zero zone, same than cornerSubPix
+  */
+static void _getWindowWeights(Size win, Size zeroZone, vector< float > &weights) {
+    int winW = 2 * win.width + 1, winH = 2 * win.height + 1;
+    weights.resize(winW * winH);
+    for(int i = 0; i < winH; i++) {
+        float y = (float)(i - win.height) / win.height;
+        float vy = std::exp(-y * y);
+        for(int j = 0; j < winW; j++) {
+            float x = (float)(j - win.width) / win.width;
+            weights[i * winW + j] = (float)(vy * std::exp(-x * x));
+        }
+    }
+
+    if(zeroZone.width >= 0 && zeroZone.height >= 0 && 2 * zeroZone.width + 1 < winW &&
+       2 * zeroZone.height + 1 < winH) {
+        for(int i = win.height - zeroZone.height; i <= win.height + zeroZone.height; i++)
+            for(int j = win.width - zeroZone.width; j <= win.width + zeroZone.width; j++)
+                weights[i * winW + j] = 0;
+    }
+}
+
+
+/**
+  * Refinement state of a corner
+  */
+struct _SubPixCorner {
+    Point2f initial, current;
+    Size win;
+    const float *weights;
+    int iterations;
+    bool done;
+    // central differences of the image in a region around the initial position, which covers the
+    // window for any position closer than win to the initial one
+    Point origin; // image position of the first gradient
+    int stride;
+    int regionRows;
+    vector< float > gradX, gradY;
+};
+
+
+/**
+  * Compute the gradients around a corner. Out of the image, the border pixels are replicated
+  */
+template< typename T >
+static void _computeGradients(const Mat &grey, _SubPixCorner &c) {
+    int rx = 2 * c.win.width + 2, ry = 2 * c.win.height + 2;
+    c.origin = Point(cvFloor(c.initial.x) - rx, cvFloor(c.initial.y) - ry);
+    c.stride = 2 * rx + 2;
+    c.regionRows = 2 * ry + 2;
+    c.gradX.resize(c.stride * c.regionRows);
+    c.gradY.resize(c.stride * c.regionRows);
+
+    vector< int > xs(c.stride + 2);
+    for(int k = 0; k < c.stride + 2; k++)
+        xs[k] = std::min(std::max(c.origin.x + k - 1, 0), grey.cols - 1);
+
+    for(int r = 0; r < c.regionRows; r++) {
+        int y = c.origin.y + r;
+        const T *row = grey.ptr< T >(std::min(std::max(y, 0), grey.rows - 1));
+        const T *rowUp = grey.ptr< T >(std::min(std::max(y - 1, 0), grey.rows - 1));
+        const T *rowDown = grey.ptr< T >(std::min(std::max(y + 1, 0), grey.rows - 1));
+        float *gx = &c.gradX[r * c.stride];
+        float *gy = &c.gradY[r * c.stride];
+        for(int k = 0; k < c.stride; k++) {
+            gx[k] = (float)row[xs[k + 2]] - (float)row[xs[k]];
+            gy[k] = (float)rowDown[xs[k + 1]] - (float)rowUp[xs[k + 1]];
+        }
+    }
+}
+
+
+/**
+  * One iteration of the refinement of a corner
+  */
+static void _subPixIteration(_SubPixCorner &c, Size imageSize, int maxIters, double eps) {
+    Point2f cI = c.current;
+
+    // first window sample, relative to the gradient region
+    float px0 = cI.x - c.win.width - c.origin.x;
+    float py0 = cI.y - c.win.height - c.origin.y;
+    int ix = cvFloor(px0), iy = cvFloor(py0);
+    int winW = 2 * c.win.width + 1, winH = 2 * c.win.height + 1;
+    if(ix < 0 || iy < 0 || ix + winW >= c.stride || iy + winH >= c.regionRows) {
+        // moved too far, it would be reverted anyway
+        c.current = c.initial;
+        c.done = true;
+        return;
+    }
+
+    // bilinear interpolation of the gradients, same weights for all the window
+    float ax = px0 - ix, ay = py0 - iy;
+    float w00 = (1.f - ax) * (1.f - ay), w01 = ax * (1.f - ay);
+    float w10 = (1.f - ax) * ay, w11 = ax * ay;
+
+    double a = 0, b = 0, cc = 0, bb1 = 0, bb2 = 0;
+    for(int i = 0; i < winH; i++) {
+        const float *gx0 = &c.gradX[(iy + i) * c.stride + ix], *gx1 = gx0 + c.stride;
+        const float *gy0 = &c.gradY[(iy + i) * c.stride + ix], *gy1 = gy0 + c.stride;
+        const float *m = c.weights + i * winW;
+        float py = (float)(i - c.win.height);
+        float sa = 0, sb = 0, sc = 0, sbb1 = 0, sbb2 = 0;
+        for(int j = 0; j < winW; j++) {
+            float tgx = w00 * gx0[j] + w01 * gx0[j + 1] + w10 * gx1[j] + w11 * gx1[j + 1];
+            float tgy = w00 * gy0[j] + w01 * gy0[j + 1] + w10 * gy1[j] + w11 * gy1[j + 1];
+            float gxx = tgx * tgx * m[j];
+            float gxy = tgx * tgy * m[j];
+            float gyy = tgy * tgy * m[j];
+            float px = (float)(j - c.win.width);
+            sa += gxx;
+            sb += gxy;
+            sc += gyy;
+            sbb1 += gxx * px + gxy * py;
+            sbb2 += gxy * px + gyy * py;
+        }
+        a += sa;
+        b += sb;
+        cc += sc;
+        bb1 += sbb1;
+        bb2 += sbb2;
+    }
+
+    c.iterations++;
+    double det = a * cc - b * b;
+    if(std::abs(det) <= DBL_EPSILON * DBL_EPSILON) {
+        c.done = true;
+        return;
+    }
+
+    double scale = 1.0 / det;
+    Point2f cI2((float)(cI.x + cc * scale * bb1 - b * scale * bb2),
+                (float)(cI.y - b * scale * bb1 + a * scale * bb2));
+    double err = (cI2.x - cI.x) * (cI2.x - cI.x) + (cI2.y - cI.y) * (cI2.y - cI.y);
+    c.current = cI2;
+
+    if(cI2.x < 0 || cI2.x >= imageSize.width || cI2.y < 0 || cI2.y >= imageSize.height ||
+       c.iterations >= maxIters || err <= eps)
+        c.done = true;
+}
+
+
+/**
+  */
+void refineCornersSubPix(const Mat &grey, vector< Point2f > &corners, const vector< Size > &winSizes,
+                         const TermCriteria &criteria, Size zeroZone) {
+
+    CV_Assert(grey.type() == CV_8UC1 || grey.type() == CV_32FC1);
+    CV_Assert(winSizes.size() == 1 || winSizes.size() == corners.size());
+    if(corners.empty()) return;
+
+    // same termination criteria than cornerSubPix
+    int maxIters = (criteria.type & TermCriteria::MAX_ITER) ? std::min(std::max(criteria.maxCount, 1), 100) : 100;
+    double eps = (criteria.type & TermCriteria::EPS) ? std::max(criteria.epsilon, 0.) : 0;
+    eps *= eps;
+
+    // window weights, shared by the corners with the same window size
+    map< pair< int, int >, vector< float > > weights;
+    for(size_t i = 0; i < winSizes.size(); i++) {
+        CV_Assert(winSizes[i].width > 0 && winSizes[i].height > 0);
+        vector< float > &w = weights[make_pair(winSizes[i].width, winSizes[i].height)];
+        if(w.empty()) _getWindowWeights(winSizes[i], zeroZone, w);
+    }
+
+    size_t nCorners = corners.size();
+    vector< _SubPixCorner > state(nCorners);
+    vector< int > active(nCorners);
+    for(size_t i = 0; i < nCorners; i++) {
+        _SubPixCorner &c = state[i];
+        c.initial = c.current = corners[i];
+        c.win = winSizes.size() == 1 ? winSizes[0] : winSizes[i];
+        c.weights = &weights[make_pair(c.win.width, c.win.height)][0];
+        c.iterations = 0;
+        c.done = false;
+        active[i] = (int)i;
+    }
+
+    // one iteration of every moving corner per round
+    Size imageSize = grey.size();
+    while(!active.empty()) {
+        parallel_for_(Range(0, (int)active.size()), [&](const Range &range) {
+            for(int k = range.start; k < range.end; k++) {
+                _SubPixCorner &c = state[active[k]];
+                if(c.gradX.empty()) {
+                    if(grey.type() == CV_8UC1)
+                        _computeGradients< uchar >(grey, c);
+                    else
+                        _computeGradients< float >(grey, c);
+                }
+                _subPixIteration(c, imageSize, maxIters, eps);
+                if(c.done) {
+                    vector< float >().swap(c.gradX);
+                    vector< float >().swap(c.gradY);
+                }
+            }
+        });
+
+        size_t stillActive = 0;
+        for(size_t k = 0; k < active.size(); k++) {
+            if(!state[active[k]].done) active[stillActive++] = active[k];
+        }
+        active.resize(stillActive);
+    }
+
+    for(size_t i = 0; i < nCorners; i++) {
+        const _SubPixCorner &c = state[i];
+        bool tooFar = std::abs(c.current.x - c.initial.x) > c.win.width ||
+                      std::abs(c.current.y - c.initial.y) > c.win.height;
+        corners[i] = tooFar ? c.initial : c.current;
+    }
+}
+
+}
+}
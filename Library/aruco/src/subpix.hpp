@@ -0,0 +1,71 @@
+/*
+By downloading, copying, installing or using the software you agree to this
+license. If you do not agree to this license, do not download, install,
+copy or use the software.
+
+                          License Agreement
+               For Open Source Computer Vision Library
+                       (3-clause BSD License)
+
+Copyright (C) 2013, OpenCV Foundation, all rights reserved.
+Third party copyrights are property of their respective owners.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice,
+    this list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the names of the copyright holders nor the names of the contributors
+    may be used to endorse or promote products derived from this software
+    without specific prior written permission.
+
+This software is provided by the copyright holders and contributors "as is" and
+any express or implied warranties, including, but not limited to, the implied
+warranties of merchantability and fitness for a particular purpose are
+disclaimed. In no event shall copyright holders or contributors be liable for
+any direct, indirect, incidental, special, exemplary, or consequential damages
+(including, but not limited to, procurement of substitute goods or services;
+loss of use, data, or profits; or business interruption) however caused
+and on any theory of liability, whether in contract, strict liability,
+or tort (including negligence or otherwise) arising in any way out of
+the use of this software, even if advised of the possibility of such damage.
+*/
+
+
+#ifndef __OPENCV_ARUCO_SUBPIX_HPP__
+#define __OPENCV_ARUCO_SUBPIX_HPP__
+
+#include <opencv2/core.hpp>
+#include <vector>
+
+namespace cv {
+namespace aruco {
+
+/**
+  * @brief Subpixel refinement of many corners at once, each one with its own window
+  *
+  * @param grey CV_8UC1 or CV_32FC1 image
+  * @param corners initial positions, refined in place
+  * @param winSizes half sizes of the search windows, one per corner or a single one for all
+  * @param criteria termination criteria of each corner
+  * @param zeroZone half size of the dead region in the middle of the windows, as in cornerSubPix.
+  * Size(-1, -1) for none
+  *
+  * Same algorithm than cornerSubPix. The gradients around each corner are
+  * computed once and the iterations of all the corners are done in rounds, so that only the
+  * corners still moving are processed in each round. A corner that moves farther than its window
+  * from its initial position keeps the initial position.
+  */
+void refineCornersSubPix(const Mat &grey, std::vector< Point2f > &corners,
+                         const std::vector< Size > &winSizes, const TermCriteria &criteria,
+                         Size zeroZone = Size(-1, -1));
+
+}
+}
+
+#endif
@@ -0,0 +1,166 @@
+/*
+By downloading, copying, installing or using the software you agree to this
+license. If you do not agree to this license, do not download, install,
+copy or use the software.
+
+                          License Agreement
+               For Open Source Computer Vision Library
+                       (3-clause BSD License)
+
+Copyright (C) 2013, OpenCV Foundation, all rights reserved.
+Third party copyrights are property of their respective owners.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice,
+    this list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the names of the copyright holders nor the names of the contributors
+    may be used to endorse or promote products derived from this software
+    without specific prior written permission.
+
+This software is provided by the copyright holders and contributors "as is" and
+any express or implied warranties, including, but not limited to, the implied
+warranties of merchantability and fitness for a particular purpose are
+disclaimed. In no event shall copyright holders or contributors be liable for
+any direct, indirect, incidental, special, exemplary, or consequential damages
+(including, but not limited to, procurement of substitute goods or services;
+loss of use, data, or profits; or business interruption) however caused
+and on any theory of liability, whether in contract, strict liability,
+or tort (including negligence or otherwise) arising in any way out of
+the use of this software, even if advised of the possibility of such damage.
+*/
+
+
+#include "precomp.hpp"
+#include "undistortion.hpp"
+#include <opencv2/core/utility.hpp>
+
+namespace cv {
+namespace aruco {
+
+using namespace std;
+
+/**
+  * @brief Camera parameters in the layout of _UndistortionMap
+  */
+static void _getCameraParameters(const Mat &camMatrix, const Mat &distCoeffs, Matx33d &K, vector< double > &D) {
+
+    CV_Assert(camMatrix.total() == 9 && (camMatrix.type() == CV_32F || camMatrix.type() == CV_64F));
+    CV_Assert(distCoeffs.total() == 4 || distCoeffs.total() == 5 || distCoeffs.total() == 8 ||
+              distCoeffs.total() == 12 || distCoeffs.total() == 14);
+
+    Mat K64, D64;
+    camMatrix.convertTo(K64, CV_64F);
+    distCoeffs.convertTo(D64, CV_64F);
+    K64 = K64.reshape(1, 3);
+    for(int i = 0; i < 3; i++)
+        for(int j = 0; j < 3; j++)
+            K(i, j) = K64.at< double >(i, j);
+    D.assign(D64.ptr< double >(), D64.ptr< double >() + D64.total());
+}
+
+
+Ptr< _UndistortionMap > _UndistortionMap::get(const Mat &camMatrix, const Mat &distCoeffs, Size imageSize) {
+
+    // enough for a few cameras used alternatively
+    const size_t maxMaps = 4;
+    static Mutex mutex;
+    static vector< Ptr< _UndistortionMap > > maps; // most recently used last
+
+    Matx33d K;
+    vector< double > D;
+    _getCameraParameters(camMatrix, distCoeffs, K, D);
+
+    AutoLock lock(mutex);
+    for(size_t i = 0; i < maps.size(); i++) {
+        if(maps[i]->matches(K, D, imageSize)) {
+            Ptr< _UndistortionMap > map = maps[i];
+            maps.erase(maps.begin() + i);
+            maps.push_back(map);
+            return map;
+        }
+    }
+    Ptr< _UndistortionMap > map = makePtr< _UndistortionMap >(K, D, imageSize);
+    if(maps.size() == maxMaps)
+        maps.erase(maps.begin());
+    maps.push_back(map);
+    return map;
+}
+
+
+_UndistortionMap::_UndistortionMap(const Matx33d &_camMatrix, const vector< double > &_distCoeffs, Size _imageSize)
+    : camMatrix(_camMatrix), distCoeffs(_distCoeffs), imageSize(_imageSize) {
+
+    CV_Assert(imageSize.width > 0 && imageSize.height > 0);
+
+    std::fill(k, k + 12, 0.);
+    std::copy(distCoeffs.begin(), distCoeffs.begin() + std::min< size_t >(distCoeffs.size(), 12), k);
+    tilted = distCoeffs.size() == 14 && (distCoeffs[12] != 0 || distCoeffs[13] != 0);
+
+    // nodes cover the whole image, the last ones may be a bit outside
+    cols = max((imageSize.width - 1 + GRID_STEP - 1) / GRID_STEP + 1, 2);
+    rows = max((imageSize.height - 1 + GRID_STEP - 1) / GRID_STEP + 1, 2);
+    vector< Point2f > nodes(cols * rows);
+    for(int y = 0; y < rows; y++)
+        for(int x = 0; x < cols; x++)
+            nodes[y * cols + x] = Point2f(float(x * GRID_STEP), float(y * GRID_STEP));
+    undistortPoints(nodes, grid, Mat(camMatrix), Mat(distCoeffs), noArray(), Mat(camMatrix));
+}
+
+
+bool _UndistortionMap::matches(const Matx33d &_camMatrix, const vector< double > &_distCoeffs,
+                               Size _imageSize) const {
+    return imageSize == _imageSize && distCoeffs == _distCoeffs && camMatrix == _camMatrix;
+}
+
+
+Point2f _UndistortionMap::undistort(Point2f p) const {
+
+    // cell of the grid, the cells of the edges extrapolate the points outside the grid
+    float gx = p.x / GRID_STEP, gy = p.y / GRID_STEP;
+    int x = min(max(cvFloor(gx), 0), cols - 2);
+    int y = min(max(cvFloor(gy), 0), rows - 2);
+    float tx = gx - x, ty = gy - y;
+
+    const Point2f *node = &grid[y * cols + x];
+    Point2f top = node[0] + tx * (node[1] - node[0]);
+    Point2f bottom = node[cols] + tx * (node[cols + 1] - node[cols]);
+    return top + ty * (bottom - top);
+}
+
+
+void _UndistortionMap::distort(vector< Point2f > &points) const {
+
+    double fx = camMatrix(0, 0), fy = camMatrix(1, 1), cx = camMatrix(0, 2), cy = camMatrix(1, 2);
+    double skew = camMatrix(0, 1);
+
+    if(tilted) {
+        // calculate 3d points and then reproject, so opencv makes the distortion internally
+        vector< Point3f > points3d;
+        for(size_t i = 0; i < points.size(); i++) {
+            double y = (points[i].y - cy) / fy;
+            points3d.push_back(Point3f(float((points[i].x - cx - skew * y) / fx), float(y), 1));
+        }
+        projectPoints(points3d, Vec3d(0, 0, 0), Vec3d(0, 0, 0), Mat(camMatrix), Mat(distCoeffs), points);
+        return;
+    }
+
+    // rational and thin prism model, as projectPoints
+    for(size_t i = 0; i < points.size(); i++) {
+        double y = (points[i].y - cy) / fy, x = (points[i].x - cx - skew * y) / fx;
+        double r2 = x * x + y * y, r4 = r2 * r2, r6 = r4 * r2;
+        double radial = (1 + k[0] * r2 + k[1] * r4 + k[4] * r6) / (1 + k[5] * r2 + k[6] * r4 + k[7] * r6);
+        double xd = x * radial + 2 * k[2] * x * y + k[3] * (r2 + 2 * x * x) + k[8] * r2 + k[9] * r4;
+        double yd = y * radial + k[2] * (r2 + 2 * y * y) + 2 * k[3] * x * y + k[10] * r2 + k[11] * r4;
+        points[i] = Point2f(float(fx * xd + cx), float(fy * yd + cy));
+    }
+}
+
+}
+}
@@ -0,0 +1,96 @@
+/*
+By downloading, copying, installing or using the software you agree to this
+license. If you do not agree to this license, do not download, install,
+copy or use the software.
+
+                          License Agreement
+               For Open Source Computer Vision Library
+                       (3-clause BSD License)
+
+Copyright (C) 2013, OpenCV Foundation, all rights reserved.
+Third party copyrights are property of their respective owners.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice,
+    this list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the names of the copyright holders nor the names of the contributors
+    may be used to endorse or promote products derived from this software
+    without specific prior written permission.
+
+This software is provided by the copyright holders and contributors "as is" and
+any express or implied warranties, including, but not limited to, the implied
+warranties of merchantability and fitness for a particular purpose are
+disclaimed. In no event shall copyright holders or contributors be liable for
+any direct, indirect, incidental, special, exemplary, or consequential damages
+(including, but not limited to, procurement of substitute goods or services;
+loss of use, data, or profits; or business interruption) however caused
+and on any theory of liability, whether in contract, strict liability,
+or tort (including negligence or otherwise) arising in any way out of
+the use of this software, even if advised of the possibility of such damage.
+*/
+
+
+#ifndef __OPENCV_ARUCO_UNDISTORTION_HPP__
+#define __OPENCV_ARUCO_UNDISTORTION_HPP__
+
+#include <opencv2/core.hpp>
+#include <vector>
+
+namespace cv {
+namespace aruco {
+
+/**
+  * Mapping between the pixels of a camera with distortion and the undistorted pixels, i.e. those
+  * of the same camera matrix without distortion. The undistortion is a bilinear lookup in a grid of
+  * undistortPoints results built once for the image size, the distortion evaluates the distortion
+  * model directly. Maps are immutable and can be shared by several threads.
+  *
+  * As in undistortPoints and projectPoints, the distorted pixels only depend on fx, fy, cx and cy:
+  * the skew camMatrix(0, 1) is ignored there. The undistorted pixels are those of the full camera
+  * matrix, skew included, and distort() inverts it.
+  */
+class _UndistortionMap {
+    public:
+    /** @brief Distance in pixels between two nodes of the lookup grid */
+    static const int GRID_STEP = 8;
+
+    /**
+      * @brief Map of a camera for images of imageSize. The maps of the last cameras used are kept,
+      * so that the grid is only built on the first call with some parameters. Building it costs an
+      * undistortPoints call on one point per GRID_STEP x GRID_STEP pixels, which every call pays if
+      * the parameters change each frame, e.g. a camera matrix refined online
+      */
+    static Ptr< _UndistortionMap > get(const Mat &camMatrix, const Mat &distCoeffs, Size imageSize);
+
+    _UndistortionMap(const Matx33d &camMatrix, const std::vector< double > &distCoeffs, Size imageSize);
+
+    /** @brief Same parameters as the ones the map was built from */
+    bool matches(const Matx33d &camMatrix, const std::vector< double > &distCoeffs, Size imageSize) const;
+
+    /** @brief Undistorted pixel coordinates, same as undistortPoints with P = camMatrix */
+    Point2f undistort(Point2f p) const;
+
+    /** @brief Inverse of undistort(), same as projectPoints of the undistorted normalized point */
+    void distort(std::vector< Point2f > &points) const;
+
+    private:
+    Matx33d camMatrix;
+    std::vector< double > distCoeffs;
+    double k[12]; // k1, k2, p1, p2, k3, k4, k5, k6, s1, s2, s3, s4, zero if not given
+    bool tilted; // tilted sensor model, distorted through projectPoints
+    Size imageSize;
+    int cols, rows;
+    std::vector< Point2f > grid; // undistorted pixel of node (x, y) at grid[y * cols + x]
+};
+
+}
+}
+
+#endif
@@ -433,7 +433,8 @@ void CV_ArucoBitCorrection::run(int) {
 
     Ptr<aruco::Dictionary> _dictionary = aruco::getPredefinedDictionary(aruco::DICT_6X6_250);
     aruco::Dictionary &dictionary = *_dictionary;
-    aruco::Dictionary dictionary2 = *_dictionary;
+    // the predefined dictionary is shared, modify a deep copy
+    aruco::Dictionary dictionary2(_dictionary);
     int markerSide = 50;
     int imageSize = 150;
     Ptr<aruco::DetectorParameters> params = aruco::DetectorParameters::create();
@@ -496,7 +497,7 @@ void CV_ArucoBitCorrection::run(int) {
 
             // dictionary3 is only composed by the modified marker (in its original form)
             Ptr<aruco::Dictionary> _dictionary3 = makePtr<aruco::Dictionary>(
-                    dictionary2.bytesList.rowRange(id, id + 1).clone(),
+                    currentCodeBytes.clone(),
                     dictionary.markerSize,
                     dictionary.maxCorrectionBits);
 
@@ -554,4 +555,357 @@ TEST(CV_ArucoBitCorrection, algorithmic) {
     test.safe_run();
 }
 
+TEST(CV_ArucoDetectionSimple, adaptiveThreshScaleScheduling) {
+    Ptr<aruco::Dictionary> dictionary = aruco::getPredefinedDictionary(aruco::DICT_6X6_250);
+
+    // markers of two different sizes
+    Mat img(600, 600, CV_8UC1, Scalar::all(255));
+    const int sizes[] = { 60, 200 };
+    for(int i = 0; i < 2; i++) {
+        Mat marker;
+        aruco::drawMarker(dictionary, i, sizes[i], marker);
+        marker.copyTo(img(Rect(50 + 250 * i, 50 + 250 * i, sizes[i], sizes[i])));
+    }
+
+    Ptr<aruco::DetectorParameters> params = aruco::DetectorParameters::create();
+    params->adaptiveThreshWinSizeMax = 53;
+    params->adaptiveThreshWinSizeStep = 5;
+    params->adaptiveThreshScaleScheduling = true;
+    params->adaptiveThreshFullSweepPeriod = 10;
+
+    // every frame of the sequence should find both markers, sweeping all the scales or not. Each
+    // marker records at most two scales, the frames between the sweeps apply fewer of them
+    const int nScales = (53 - params->adaptiveThreshWinSizeMin) / 5 + 1;
+    for(int frame = 0; frame < 25; frame++) {
+        vector< vector< Point2f > > corners;
+        vector< int > ids;
+        aruco::detectMarkers(img, dictionary, corners, ids, params);
+        ASSERT_EQ(2u, ids.size()) << "frame " << frame;
+        if(frame % 10 == 0)
+            EXPECT_EQ(nScales, params->getLastThreshScaleCount()) << "frame " << frame;
+        else
+            EXPECT_LE(params->getLastThreshScaleCount(), 4) << "frame " << frame;
+    }
+    EXPECT_EQ(3, params->getThreshFullSweepCount());
+
+    params->resetThreshScaleHistory();
+    vector< vector< Point2f > > corners;
+    vector< int > ids;
+    aruco::detectMarkers(img, dictionary, corners, ids, params);
+    EXPECT_EQ(2u, ids.size());
+}
+
+TEST(CV_ArucoDetectionSimple, timeBudget) {
+    Ptr<aruco::Dictionary> dictionary = aruco::getPredefinedDictionary(aruco::DICT_6X6_250);
+
+    Mat img(500, 500, CV_8UC1, Scalar::all(255));
+    for(int i = 0; i < 4; i++) {
+        Mat marker;
+        aruco::drawMarker(dictionary, i, 100, marker);
+        marker.copyTo(img(Rect(50 + 250 * (i % 2), 50 + 250 * (i / 2), 100, 100)));
+    }
+
+    vector< vector< Point2f > > corners, budgetCorners;
+    vector< int > ids, budgetIds;
+    aruco::detectMarkers(img, dictionary, corners, ids);
+
+    // a generous budget gives the same result as the unbounded detection
+    bool exceeded = aruco::detectMarkersWithBudget(img, dictionary, budgetCorners, budgetIds, 1e5,
+                                                   aruco::DetectorParameters::create(), corners);
+    EXPECT_FALSE(exceeded);
+    ASSERT_EQ(ids.size(), budgetIds.size());
+    for(unsigned int i = 0; i < ids.size(); i++) {
+        EXPECT_EQ(ids[i], budgetIds[i]);
+        for(int c = 0; c < 4; c++)
+            EXPECT_EQ(corners[i][c], budgetCorners[i][c]);
+    }
+}
+
+TEST(CV_ArucoDetectionSimple, timeBudgetExceeded) {
+    Ptr<aruco::Dictionary> dictionary = aruco::getPredefinedDictionary(aruco::DICT_6X6_250);
+
+    // markers among many non-marker candidates
+    Mat img(500, 500, CV_8UC1, Scalar::all(255));
+    RNG rng(0x4321);
+    for(int i = 0; i < 80; i++) {
+        Point p(rng.uniform(10, 470), rng.uniform(260, 470));
+        rectangle(img, Rect(p, Size(rng.uniform(10, 30), rng.uniform(10, 30))), Scalar::all(rng.uniform(0, 120)),
+                  FILLED);
+    }
+    for(int i = 0; i < 3; i++) {
+        Mat marker;
+        aruco::drawMarker(dictionary, i, 100, marker);
+        marker.copyTo(img(Rect(30 + 160 * i, 50, 100, 100)));
+    }
+
+    Ptr<aruco::DetectorParameters> params = aruco::DetectorParameters::create();
+    params->cornerRefinementMethod = aruco::CORNER_REFINE_SUBPIX;
+    vector< vector< Point2f > > corners, rejected;
+    vector< int > ids;
+    aruco::detectMarkers(img, dictionary, corners, ids, params, rejected);
+    ASSERT_EQ(3u, ids.size());
+
+    // the candidate search alone takes longer than the budget
+    vector< vector< Point2f > > budgetCorners, budgetRejected;
+    vector< int > budgetIds;
+    bool exceeded = aruco::detectMarkersWithBudget(img, dictionary, budgetCorners, budgetIds, 1e-6, params,
+                                                   noArray(), budgetRejected);
+    EXPECT_TRUE(exceeded);
+
+    // every candidate is either returned as a marker with its id or rejected
+    ASSERT_EQ(budgetIds.size(), budgetCorners.size());
+    EXPECT_EQ(ids.size() + rejected.size(), budgetIds.size() + budgetRejected.size());
+    for(unsigned int i = 0; i < budgetIds.size(); i++) {
+        EXPECT_TRUE(std::find(ids.begin(), ids.end(), budgetIds[i]) != ids.end()) << "id " << budgetIds[i];
+    }
+    for(unsigned int i = 0; i < ids.size(); i++) {
+        Point2f center = (corners[i][0] + corners[i][1] + corners[i][2] + corners[i][3]) * 0.25f;
+        bool found = false;
+        for(unsigned int j = 0; j < budgetIds.size() && !found; j++) {
+            Point2f c = (budgetCorners[j][0] + budgetCorners[j][1] + budgetCorners[j][2] + budgetCorners[j][3]) * 0.25f;
+            found = budgetIds[j] == ids[i] && cv::norm(c - center) < 1.;
+        }
+        for(unsigned int j = 0; j < budgetRejected.size() && !found; j++) {
+            Point2f c = (budgetRejected[j][0] + budgetRejected[j][1] + budgetRejected[j][2] + budgetRejected[j][3]) *
+                        0.25f;
+            found = cv::norm(c - center) < 1.;
+        }
+        EXPECT_TRUE(found) << "marker " << ids[i];
+    }
+}
+
+TEST(CV_ArucoDetectionSimple, timeBudgetExceededScaleScheduling) {
+    Ptr<aruco::Dictionary> dictionary = aruco::getPredefinedDictionary(aruco::DICT_6X6_250);
+
+    Mat img(500, 500, CV_8UC1, Scalar::all(255));
+    for(int i = 0; i < 3; i++) {
+        Mat marker;
+        aruco::drawMarker(dictionary, i, 100, marker);
+        marker.copyTo(img(Rect(30 + 160 * i, 50, 100, 100)));
+    }
+
+    Ptr<aruco::DetectorParameters> params = aruco::DetectorParameters::create();
+    params->adaptiveThreshScaleScheduling = true;
+    vector< vector< Point2f > > corners;
+    vector< int > ids;
+    aruco::detectMarkers(img, dictionary, corners, ids, params);
+    ASSERT_EQ(3u, ids.size());
+    ASSERT_EQ(1, params->getThreshFullSweepCount());
+
+    // the markers missed for lack of time are not lost, the next frame does not sweep all the scales
+    EXPECT_TRUE(aruco::detectMarkersWithBudget(img, dictionary, corners, ids, 1e-6, params));
+    aruco::detectMarkers(img, dictionary, corners, ids, params);
+    EXPECT_EQ(3u, ids.size());
+    EXPECT_EQ(1, params->getThreshFullSweepCount());
+}
+
+TEST(CV_ArucoDetectionSimple, mixedPolarity) {
+    Ptr<aruco::Dictionary> dictionary = aruco::getPredefinedDictionary(aruco::DICT_6X6_250);
+
+    // black markers on white and white markers on black in the same image
+    Mat img(500, 500, CV_8UC1, Scalar::all(255));
+    for(int i = 0; i < 4; i++) {
+        Mat marker;
+        aruco::drawMarker(dictionary, i, 100, marker);
+        Rect area(50 + 250 * (i % 2), 50 + 250 * (i / 2), 100, 100);
+        if(i % 2 == 1) {
+            img(Rect(area.x - 30, area.y - 30, 160, 160)).setTo(Scalar::all(0));
+            marker = ~marker;
+        }
+        marker.copyTo(img(area));
+    }
+
+    Ptr<aruco::DetectorParameters> params = aruco::DetectorParameters::create();
+    params->detectInvertedMarker = true;
+    vector< vector< Point2f > > corners;
+    vector< int > ids;
+    aruco::detectMarkers(img, dictionary, corners, ids, params);
+    ASSERT_EQ(4u, ids.size());
+    for(int i = 0; i < 4; i++)
+        EXPECT_TRUE(std::find(ids.begin(), ids.end(), i) != ids.end()) << "marker " << i;
+}
+
+TEST(CV_ArucoDetectionSimple, borderProbe) {
+    Ptr<aruco::Dictionary> dictionary = aruco::getPredefinedDictionary(aruco::DICT_6X6_250);
+
+    // markers next to a textured area producing many non-marker candidates
+    Mat img(500, 500, CV_8UC1, Scalar::all(255));
+    RNG rng(0x1234);
+    for(int i = 0; i < 60; i++) {
+        Point p(rng.uniform(260, 470), rng.uniform(10, 470));
+        rectangle(img, Rect(p, Size(rng.uniform(8, 30), rng.uniform(8, 30))), Scalar::all(rng.uniform(0, 120)),
+                  FILLED);
+    }
+    for(int i = 0; i < 3; i++) {
+        Mat marker;
+        aruco::drawMarker(dictionary, i, 100, marker);
+        marker.copyTo(img(Rect(50, 30 + 160 * i, 100, 100)));
+    }
+
+    Ptr<aruco::DetectorParameters> params = aruco::DetectorParameters::create();
+    vector< vector< Point2f > > corners, probeCorners;
+    vector< int > ids, probeIds;
+    aruco::detectMarkers(img, dictionary, corners, ids, params);
+    params->useBorderProbe = true;
+    aruco::detectMarkers(img, dictionary, probeCorners, probeIds, params);
+
+    // the probe only rejects candidates that the border check would reject
+    EXPECT_EQ(3u, ids.size());
+    ASSERT_EQ(ids.size(), probeIds.size());
+    for(unsigned int i = 0; i < ids.size(); i++) {
+        EXPECT_EQ(ids[i], probeIds[i]);
+        for(int c = 0; c < 4; c++)
+            EXPECT_EQ(corners[i][c], probeCorners[i][c]);
+    }
+}
+
+TEST(CV_ArucoDetectionSimple, bitThresholdMethods) {
+    Ptr<aruco::Dictionary> dictionary = aruco::getPredefinedDictionary(aruco::DICT_6X6_250);
+
+    // markers under a brightness gradient
+    Mat img(500, 500, CV_8UC1);
+    for(int y = 0; y < img.rows; y++)
+        img.row(y).setTo(Scalar::all(255 - y / 5));
+    for(int i = 0; i < 4; i++) {
+        Mat marker;
+        aruco::drawMarker(dictionary, i, 100, marker);
+        Mat area = img(Rect(50 + 250 * (i % 2), 50 + 250 * (i / 2), 100, 100));
+        marker.copyTo(area, marker == 0);
+    }
+
+    const int methods[] = { aruco::BIT_THRESHOLD_OTSU, aruco::BIT_THRESHOLD_LOCAL_MEAN,
+                            aruco::BIT_THRESHOLD_CLUSTERS };
+    for(int m = 0; m < 3; m++) {
+        Ptr<aruco::DetectorParameters> params = aruco::DetectorParameters::create();
+        params->bitThresholdMethod = methods[m];
+        vector< vector< Point2f > > corners;
+        vector< int > ids;
+        aruco::detectMarkers(img, dictionary, corners, ids, params);
+        ASSERT_EQ(4u, ids.size()) << "method " << methods[m];
+        for(int i = 0; i < 4; i++)
+            EXPECT_TRUE(std::find(ids.begin(), ids.end(), i) != ids.end()) << "method " << methods[m];
+    }
+}
+
+TEST(CV_ArucoDetectionSimple, contourRefinementWithCamera) {
+    Ptr<aruco::Dictionary> dictionary = aruco::getPredefinedDictionary(aruco::DICT_6X6_250);
+
+    Mat img(500, 500, CV_8UC1, Scalar::all(255));
+    for(int i = 0; i < 4; i++) {
+        Mat marker;
+        aruco::drawMarker(dictionary, i, 100, marker);
+        marker.copyTo(img(Rect(50 + 250 * (i % 2), 50 + 250 * (i / 2), 100, 100)));
+    }
+
+    Ptr<aruco::DetectorParameters> params = aruco::DetectorParameters::create();
+    params->cornerRefinementMethod = aruco::CORNER_REFINE_CONTOUR;
+    vector< vector< Point2f > > corners, cameraCorners;
+    vector< int > ids, cameraIds;
+    aruco::detectMarkers(img, dictionary, corners, ids, params);
+
+    // without distortion, the lines are fitted in the same pixels
+    Mat cameraMatrix = (Mat_< double >(3, 3) << 600, 0, 250, 0, 600, 250, 0, 0, 1);
+    Mat distCoeffs(5, 1, CV_64FC1, Scalar::all(0));
+    for(int frame = 0; frame < 2; frame++) {
+        aruco::detectMarkers(img, dictionary, cameraCorners, cameraIds, params, noArray(), cameraMatrix,
+                             distCoeffs);
+        ASSERT_EQ(4u, cameraIds.size());
+        ASSERT_EQ(ids.size(), cameraIds.size());
+        for(unsigned int i = 0; i < ids.size(); i++) {
+            EXPECT_EQ(ids[i], cameraIds[i]);
+            for(int c = 0; c < 4; c++)
+                EXPECT_LE(cv::norm(corners[i][c] - cameraCorners[i][c]), 0.01);
+        }
+    }
+}
+
+TEST(CV_ArucoDetectionSimple, rejectedOnDemand) {
+    Ptr<aruco::Dictionary> dictionary = aruco::getPredefinedDictionary(aruco::DICT_6X6_250);
+
+    // two markers and a black square that is not a marker
+    Mat img(500, 500, CV_8UC1, Scalar::all(255));
+    for(int i = 0; i < 2; i++) {
+        Mat marker;
+        aruco::drawMarker(dictionary, i, 100, marker);
+        marker.copyTo(img(Rect(50 + 250 * i, 50, 100, 100)));
+    }
+    img(Rect(200, 300, 100, 100)).setTo(Scalar::all(0));
+
+    Ptr<aruco::DetectorParameters> params = aruco::DetectorParameters::create();
+    vector< vector< Point2f > > corners, rejectedCorners, rejected;
+    vector< int > ids, rejectedIds;
+    aruco::detectMarkers(img, dictionary, corners, ids, params);
+    aruco::detectMarkers(img, dictionary, rejectedCorners, rejectedIds, params, rejected);
+
+    // asking for the rejected candidates does not change the detected markers
+    EXPECT_EQ(2u, ids.size());
+    EXPECT_FALSE(rejected.empty());
+    ASSERT_EQ(ids.size(), rejectedIds.size());
+    for(unsigned int i = 0; i < ids.size(); i++) {
+        EXPECT_EQ(ids[i], rejectedIds[i]);
+        for(int c = 0; c < 4; c++)
+            EXPECT_EQ(corners[i][c], rejectedCorners[i][c]);
+    }
+}
+
+TEST(CV_ArucoDetectionSimple, contourRefinementDistortion) {
+    Ptr<aruco::Dictionary> dictionary = aruco::getPredefinedDictionary(aruco::DICT_6X6_250);
+
+    // markers near the corners of the image, where the distortion is the strongest
+    Mat ideal(480, 640, CV_8UC1, Scalar::all(255));
+    for(int i = 0; i < 4; i++) {
+        Mat marker;
+        aruco::drawMarker(dictionary, i, 120, marker);
+        marker.copyTo(ideal(Rect(60 + 400 * (i % 2), 50 + 260 * (i / 2), 120, 120)));
+    }
+    Ptr<aruco::DetectorParameters> params = aruco::DetectorParameters::create();
+    params->cornerRefinementMethod = aruco::CORNER_REFINE_CONTOUR;
+    vector< vector< Point2f > > idealCorners;
+    vector< int > idealIds;
+    aruco::detectMarkers(ideal, dictionary, idealCorners, idealIds, params);
+    ASSERT_EQ(4u, idealIds.size());
+
+    // radial and tangential, rational and thin prism models
+    Mat cameraMatrix = (Mat_< double >(3, 3) << 500, 0, 320, 0, 500, 240, 0, 0, 1);
+    vector< Mat > distortions;
+    distortions.push_back((Mat_< double >(5, 1) << -0.15, 0.03, 0.001, -0.001, 0));
+    distortions.push_back((Mat_< double >(8, 1) << 0.1, -0.05, 0.001, -0.001, 0.01, 0.15, -0.03, 0.01));
+    distortions.push_back((Mat_< double >(12, 1) << 0.1, -0.05, 0.001, -0.001, 0.01, 0.15, -0.03, 0.01,
+                           0.002, -0.001, 0.001, 0.0005));
+
+    vector< Point2f > pixels;
+    for(int y = 0; y < ideal.rows; y++)
+        for(int x = 0; x < ideal.cols; x++)
+            pixels.push_back(Point2f((float)x, (float)y));
+
+    for(size_t d = 0; d < distortions.size(); d++) {
+        // the image seen through the distortion
+        vector< Point2f > sources;
+        undistortPoints(pixels, sources, cameraMatrix, distortions[d], noArray(), cameraMatrix);
+        Mat map = Mat(sources).reshape(2, ideal.rows);
+        Mat img;
+        remap(ideal, img, map, noArray(), INTER_LINEAR, BORDER_CONSTANT, Scalar::all(255));
+
+        vector< vector< Point2f > > corners;
+        vector< int > ids;
+        aruco::detectMarkers(img, dictionary, corners, ids, params, noArray(), cameraMatrix, distortions[d]);
+        ASSERT_EQ(4u, ids.size()) << "coefficients " << distortions[d].total();
+
+        // the lines are fitted without distortion, the corners are the distorted ideal ones
+        for(unsigned int i = 0; i < ids.size(); i++) {
+            int m = int(std::find(idealIds.begin(), idealIds.end(), ids[i]) - idealIds.begin());
+            ASSERT_LT(m, 4);
+            vector< Point3f > normalized;
+            for(int c = 0; c < 4; c++)
+                normalized.push_back(Point3f((idealCorners[m][c].x - 320.f) / 500.f,
+                                             (idealCorners[m][c].y - 240.f) / 500.f, 1.f));
+            vector< Point2f > expected;
+            projectPoints(normalized, Vec3d::all(0), Vec3d::all(0), cameraMatrix, distortions[d], expected);
+            for(int c = 0; c < 4; c++)
+                EXPECT_LE(cv::norm(corners[i][c] - expected[c]), 0.5) << "coefficients " << distortions[d].total()
+                                                                     << ", marker " << ids[i] << ", corner " << c;
+        }
+    }
+}
+
 }} // namespace
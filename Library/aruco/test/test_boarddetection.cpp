@@ -404,4 +404,93 @@ TEST(CV_ArucoBoardPose, CheckNegativeZ)
     ASSERT_GT(out.z, 0);
 }
 
+TEST(CV_ArucoBoard, markerIndex)
+{
+    Ptr<aruco::Dictionary> dictionary = aruco::getPredefinedDictionary(aruco::DICT_6X6_250);
+    Ptr<aruco::GridBoard> board = aruco::GridBoard::create(20, 30, 0.02f, 0.005f, dictionary, 10);
+    for(int i = 0; i < (int)board->ids.size(); i++)
+        EXPECT_EQ(i, board->getMarkerIndex(board->ids[i]));
+    EXPECT_EQ(-1, board->getMarkerIndex(9));
+    EXPECT_EQ(-1, board->getMarkerIndex(610));
+    EXPECT_EQ(-1, board->getMarkerIndex(-1));
+
+    vector< int > detectedIds;
+    detectedIds.push_back(12);
+    detectedIds.push_back(3);
+    detectedIds.push_back(609);
+    detectedIds.push_back(12);
+    vector< int > detectionIdx;
+    board->getDetectedMarkerIndices(detectedIds, detectionIdx);
+    ASSERT_EQ(board->ids.size(), detectionIdx.size());
+    for(int i = 0; i < (int)detectionIdx.size(); i++)
+        EXPECT_EQ(i == 2 ? 0 : (i == 599 ? 2 : -1), detectionIdx[i]);
+
+    // ids modified without rebuilding the table: the moved and removed markers are still right
+    board->ids[5] = 1000;
+    board->ids[7] = 16;
+    board->ids[6] = 17;
+    EXPECT_EQ(-1, board->getMarkerIndex(15));
+    EXPECT_EQ(7, board->getMarkerIndex(16));
+    EXPECT_EQ(6, board->getMarkerIndex(17));
+    board->updateIdIndex();
+    EXPECT_EQ(5, board->getMarkerIndex(1000));
+    EXPECT_EQ(-1, board->getMarkerIndex(15));
+    detectedIds.push_back(1000);
+    board->getDetectedMarkerIndices(detectedIds, detectionIdx);
+    EXPECT_EQ(4, detectionIdx[5]);
+
+    // sparse ids are hashed
+    vector< int > sparseIds;
+    sparseIds.push_back(2000000000);
+    sparseIds.push_back(-5);
+    sparseIds.push_back(7);
+    board->ids = sparseIds;
+    board->objPoints.resize(3);
+    board->updateIdIndex();
+    EXPECT_EQ(0, board->getMarkerIndex(2000000000));
+    EXPECT_EQ(1, board->getMarkerIndex(-5));
+    EXPECT_EQ(2, board->getMarkerIndex(7));
+    EXPECT_EQ(-1, board->getMarkerIndex(8));
+}
+
+TEST(CV_ArucoBoardPose, tracking)
+{
+    Ptr<aruco::Dictionary> dictionary = aruco::getPredefinedDictionary(aruco::DICT_6X6_250);
+    Ptr<aruco::GridBoard> board = aruco::GridBoard::create(4, 3, 0.04f, 0.01f, dictionary);
+    Ptr<aruco::Board> boardBase = board.staticCast<aruco::Board>();
+    Mat cameraMatrix = (Mat_<double>(3, 3) << 600, 0, 320, 0, 600, 240, 0, 0, 1);
+    Ptr<aruco::BoardPoseTracker> tracker = aruco::BoardPoseTracker::create();
+    int nMarkers = (int)board->ids.size();
+
+    for(int frame = 0; frame < 12; frame++) {
+        Vec3d rvecGt(0.1 + 0.005 * frame, -0.2, 0.05), tvecGt(-0.1 + 0.002 * frame, -0.05, 0.6);
+        vector< vector< Point2f > > corners(nMarkers);
+        for(int m = 0; m < nMarkers; m++)
+            projectPoints(board->objPoints[m], rvecGt, tvecGt, cameraMatrix, noArray(), corners[m]);
+
+        // wrong corners of the first marker in some frames
+        bool outlier = frame % 3 == 2;
+        if(outlier) {
+            for(int c = 0; c < 4; c++)
+                corners[0][c] += Point2f(40, -25);
+        }
+
+        Vec3d rvec, tvec;
+        int used = aruco::trackPoseBoard(corners, board->ids, boardBase, cameraMatrix, noArray(), tracker,
+                                         rvec, tvec);
+        EXPECT_EQ(outlier ? nMarkers - 1 : nMarkers, used) << "frame " << frame;
+        EXPECT_TRUE(tracker->hasPose());
+        EXPECT_LT(cv::norm(rvec - rvecGt), 1e-3) << "frame " << frame;
+        EXPECT_LT(cv::norm(tvec - tvecGt), 1e-3) << "frame " << frame;
+    }
+
+    // no board markers, the tracker is reset
+    vector< vector< Point2f > > noCorners;
+    vector< int > noIds;
+    Vec3d rvec, tvec;
+    EXPECT_EQ(0, aruco::trackPoseBoard(noCorners, noIds, boardBase, cameraMatrix, noArray(), tracker,
+                                       rvec, tvec));
+    EXPECT_FALSE(tracker->hasPose());
+}
+
 }} // namespace
@@ -677,4 +677,145 @@ TEST(Charuco, testCharucoCornersCollinear_false)
     EXPECT_FALSE(result);
 }
 
+TEST(Charuco, saveLoadBoard)
+{
+    Ptr<aruco::Dictionary> dictionary = aruco::getPredefinedDictionary(aruco::DICT_5X5_1000);
+    Ptr<aruco::CharucoBoard> board = aruco::CharucoBoard::create(24, 17, 0.03f, 0.02f, dictionary);
+
+    // each chessboard corner is next to two markers
+    ASSERT_EQ(board->chessboardCorners.size(), board->nearestMarkerIdx.size());
+    for(size_t i = 0; i < board->nearestMarkerIdx.size(); i++) {
+        ASSERT_EQ(2u, board->nearestMarkerIdx[i].size());
+        for(int j = 0; j < 2; j++) {
+            Point3f markerCorner =
+                board->objPoints[board->nearestMarkerIdx[i][j]][board->nearestMarkerCorners[i][j]];
+            EXPECT_LT(cv::norm(markerCorner - board->chessboardCorners[i]), 0.01);
+        }
+    }
+
+    string filename = cv::tempfile(".bin");
+    ASSERT_TRUE(board->save(filename));
+    Ptr<aruco::CharucoBoard> loaded = aruco::CharucoBoard::load(filename);
+    remove(filename.c_str());
+    ASSERT_FALSE(loaded.empty());
+
+    EXPECT_EQ(board->getChessboardSize(), loaded->getChessboardSize());
+    EXPECT_EQ(board->getSquareLength(), loaded->getSquareLength());
+    EXPECT_EQ(board->getMarkerLength(), loaded->getMarkerLength());
+    EXPECT_EQ(board->ids, loaded->ids);
+    EXPECT_EQ(board->objPoints, loaded->objPoints);
+    EXPECT_EQ(board->chessboardCorners, loaded->chessboardCorners);
+    EXPECT_EQ(board->nearestMarkerIdx, loaded->nearestMarkerIdx);
+    EXPECT_EQ(board->nearestMarkerCorners, loaded->nearestMarkerCorners);
+    EXPECT_EQ(dictionary->markerSize, loaded->dictionary->markerSize);
+    EXPECT_EQ(dictionary->maxCorrectionBits, loaded->dictionary->maxCorrectionBits);
+    EXPECT_EQ(0, cvtest::norm(dictionary->bytesList, loaded->dictionary->bytesList, NORM_INF));
+    EXPECT_EQ(100, loaded->getMarkerIndex(loaded->ids[100]));
+
+    EXPECT_TRUE(aruco::CharucoBoard::load(filename).empty());
+}
+
+TEST(Charuco, calibrationViewSelector)
+{
+    Ptr<aruco::Dictionary> dictionary = aruco::getPredefinedDictionary(aruco::DICT_6X6_250);
+    Ptr<aruco::CharucoBoard> board = aruco::CharucoBoard::create(5, 4, 0.04f, 0.02f, dictionary);
+    Size imageSize(640, 480);
+    Mat cameraMatrix = (Mat_< double >(3, 3) << 600, 0, 320, 0, 600, 240, 0, 0, 1);
+    Mat distCoeffs(5, 1, CV_64FC1, Scalar::all(0));
+    vector< int > charucoIds;
+    for(int i = 0; i < (int)board->chessboardCorners.size(); i++)
+        charucoIds.push_back(i);
+
+    const int maxViews = 8;
+    Ptr<aruco::CalibrationViewSelector> selector =
+        aruco::CalibrationViewSelector::create(imageSize, maxViews);
+    selector->setCamera(cameraMatrix, distCoeffs);
+    double singleViewCoverage = 0;
+
+    // the same three poses in the center of the image over and over, and once in a corner
+    const int cornerViewId = 31;
+    int viewId = 0;
+    for(int repeat = 0; repeat < 20; repeat++) {
+        for(int tilt = -30; tilt <= 30; tilt += 30) {
+            Vec3d rvec(deg2rad(tilt), deg2rad(0.5 * tilt), 0);
+            Matx33d R;
+            Rodrigues(rvec, R);
+            Vec3d tvec = Vec3d(0, 0, 0.5) - R * Vec3d(0.1, 0.08, 0);
+            if(viewId == cornerViewId) tvec += Vec3d(0.12, 0.1, 0);
+
+            vector< Point2f > corners;
+            projectPoints(board->chessboardCorners, rvec, tvec, cameraMatrix, distCoeffs, corners);
+            selector->addCharucoView(corners, charucoIds, board, viewId++);
+            if(viewId == 1) singleViewCoverage = selector->getCoverage();
+        }
+    }
+
+    // the near duplicates are not kept, the view in the corner is
+    ASSERT_EQ(maxViews, selector->getViewCount());
+    vector< int > viewIds = selector->getViewIds();
+    bool tilts[3] = { false, false, false };
+    for(size_t i = 0; i < viewIds.size(); i++)
+        tilts[viewIds[i] % 3] = true;
+    EXPECT_TRUE(tilts[0] && tilts[1] && tilts[2]);
+    EXPECT_TRUE(std::find(viewIds.begin(), viewIds.end(), cornerViewId) != viewIds.end());
+    EXPECT_GT(selector->getCoverage(), singleViewCoverage);
+    EXPECT_GE(selector->getPoseDiversity(), 0.);
+
+    vector< Mat > selectedCorners, selectedIds;
+    selector->getCharucoViews(selectedCorners, selectedIds);
+    ASSERT_EQ((size_t)maxViews, selectedCorners.size());
+    ASSERT_EQ((size_t)maxViews, selectedIds.size());
+    EXPECT_EQ(charucoIds.size(), selectedIds[0].total());
+}
+
+TEST(Charuco, incrementalCalibration)
+{
+    Ptr<aruco::Dictionary> dictionary = aruco::getPredefinedDictionary(aruco::DICT_6X6_250);
+    Ptr<aruco::CharucoBoard> board = aruco::CharucoBoard::create(8, 6, 0.03f, 0.015f, dictionary);
+    Size imageSize(640, 480);
+    Mat cameraMatrix = (Mat_< double >(3, 3) << 600, 0, 330, 0, 605, 235, 0, 0, 1);
+    Mat distCoeffs = (Mat_< double >(5, 1) << 0.1, -0.05, 0, 0, 0);
+    vector< int > charucoIds;
+    for(int i = 0; i < (int)board->chessboardCorners.size(); i++)
+        charucoIds.push_back(i);
+
+    Ptr<aruco::IncrementalCalibrator> calibrator = aruco::IncrementalCalibrator::create(
+        imageSize, CALIB_ZERO_TANGENT_DIST | CALIB_FIX_K3);
+
+    // tilted views of the board in the center and in the corners of the image
+    for(int view = 0; view < 9; view++) {
+        Vec3d rvec(deg2rad(20 * (view % 3 - 1)), deg2rad(20 * (view / 3 - 1)), deg2rad(5 * view));
+        Matx33d R;
+        Rodrigues(rvec, R);
+        Vec3d shift(0.08 * ((view + 1) % 3 - 1), 0.06 * ((view / 3 + 1) % 3 - 1), 0.05 * (view % 2));
+        Vec3d tvec = Vec3d(0, 0, 0.55) + shift - R * Vec3d(0.12, 0.09, 0);
+
+        vector< Point2f > corners;
+        projectPoints(board->chessboardCorners, rvec, tvec, cameraMatrix, distCoeffs, corners);
+        calibrator->addCharucoView(corners, charucoIds, board);
+
+        // first calibration from scratch with 5 views, then refined with each new view
+        if(view < 4) continue;
+        double rms = calibrator->refine();
+        EXPECT_LT(rms, 0.01);
+        if(view > 4) EXPECT_LE(calibrator->getIterations(), 10);
+
+        Mat estimatedCameraMatrix, estimatedDistCoeffs;
+        calibrator->getCamera(estimatedCameraMatrix, estimatedDistCoeffs);
+        EXPECT_LT(cvtest::norm(cameraMatrix, estimatedCameraMatrix, NORM_INF), 1.);
+        EXPECT_LT(cvtest::norm(distCoeffs, estimatedDistCoeffs, NORM_INF), 0.01);
+    }
+    ASSERT_EQ(9, calibrator->getViewCount());
+
+    // nothing new, nothing to refine
+    int iterations = calibrator->getIterations();
+    calibrator->refine();
+    EXPECT_EQ(iterations, calibrator->getIterations());
+
+    vector< Mat > rvecs, tvecs;
+    calibrator->getExtrinsics(rvecs, tvecs);
+    ASSERT_EQ(9u, rvecs.size());
+    ASSERT_EQ(9u, tvecs.size());
+}
+
 }} // namespace
@@ -3,6 +3,7 @@
 // of this distribution and at http://opencv.org/license.html.
 
 #include "test_precomp.hpp"
+#include <fstream>
 
 namespace opencv_test { namespace {
 
@@ -24,4 +25,174 @@ TEST(CV_ArucoDrawMarker, regression_1226)
     });
 }
 
+TEST(CV_ArucoCustomDictionary, distanceAndSeed)
+{
+    cv::Ptr<cv::aruco::Dictionary> dict = cv::aruco::generateCustomDictionary(40, 5, 7);
+    cv::Ptr<cv::aruco::Dictionary> same = cv::aruco::generateCustomDictionary(40, 5, 7);
+    ASSERT_EQ(40, dict->bytesList.rows);
+    EXPECT_EQ(0, cvtest::norm(dict->bytesList, same->bytesList, NORM_INF));
+    EXPECT_EQ(dict->maxCorrectionBits, same->maxCorrectionBits);
+
+    // same dictionary as the serial generator this seed always gave: the first markers and the last one
+    const int expectedIds[3] = { 0, 1, 39 };
+    const uchar expectedBytes[3][16] = {
+        { 122, 155, 76, 0, 166, 45, 209, 1, 25, 108, 175, 0, 197, 218, 50, 1 },
+        { 119, 21, 170, 1, 13, 179, 229, 1, 170, 212, 119, 0, 211, 230, 216, 0 },
+        { 43, 133, 213, 0, 147, 116, 177, 0, 85, 208, 234, 0, 70, 151, 100, 1 }
+    };
+    EXPECT_EQ(3, dict->maxCorrectionBits);
+    for(int i = 0; i < 3; i++) {
+        for(int k = 0; k < 16; k++)
+            EXPECT_EQ(expectedBytes[i][k], dict->bytesList.ptr(expectedIds[i])[k])
+                << "marker " << expectedIds[i] << ", byte " << k;
+    }
+
+    // the markers can be told apart with maxCorrectionBits errors, in any rotation
+    for(int i = 0; i < dict->bytesList.rows; i++) {
+        cv::Mat bits = cv::aruco::Dictionary::getBitsFromByteList(dict->bytesList.rowRange(i, i + 1), 5);
+        for(int j = i + 1; j < dict->bytesList.rows; j++)
+            EXPECT_GT(dict->getDistanceToId(bits, j), 2 * dict->maxCorrectionBits);
+    }
+
+    // extending a dictionary keeps its markers
+    cv::Ptr<cv::aruco::Dictionary> extended = cv::aruco::generateCustomDictionary(50, 5, dict, 3);
+    ASSERT_EQ(50, extended->bytesList.rows);
+    EXPECT_EQ(0, cvtest::norm(dict->bytesList, extended->bytesList.rowRange(0, 40), NORM_INF));
+}
+
+TEST(CV_ArucoDictionary, byteListRotations)
+{
+    // sizes 4 to 8 go through the specialized kernels, 3 and 9 through the generic code
+    cv::RNG rng(5);
+    for(int markerSize = 3; markerSize <= 9; markerSize++) {
+        int nbytes = (markerSize * markerSize + 7) / 8;
+        for(int i = 0; i < 20; i++) {
+            cv::Mat bits(markerSize, markerSize, CV_8UC1);
+            rng.fill(bits, cv::RNG::UNIFORM, 0, 2);
+            cv::Mat byteList = cv::aruco::Dictionary::getByteListFromBits(bits);
+            ASSERT_EQ(nbytes, byteList.cols);
+            EXPECT_EQ(0, cvtest::norm(bits, cv::aruco::Dictionary::getBitsFromByteList(byteList, markerSize), NORM_INF));
+
+            // rotation r of the list is the code of the bits rotated r times 90 degrees counter clockwise
+            cv::Mat rotated = bits.clone();
+            for(int r = 1; r < 4; r++) {
+                cv::rotate(rotated, rotated, cv::ROTATE_90_COUNTERCLOCKWISE);
+                cv::Mat rotatedList = cv::aruco::Dictionary::getByteListFromBits(rotated);
+                EXPECT_EQ(0, memcmp(byteList.ptr() + r * nbytes, rotatedList.ptr(), nbytes));
+            }
+        }
+    }
+}
+
+TEST(CV_ArucoDictionaryFile, saveAndLoad)
+{
+    cv::Ptr<cv::aruco::Dictionary> dict = cv::aruco::generateCustomDictionary(100, 6, 5);
+    std::string filename = cv::tempfile(".ardc");
+    ASSERT_TRUE(dict->save(filename));
+
+    cv::Ptr<cv::aruco::Dictionary> loaded = cv::aruco::Dictionary::load(filename);
+    ASSERT_TRUE(loaded);
+    EXPECT_EQ(dict->markerSize, loaded->markerSize);
+    EXPECT_EQ(dict->maxCorrectionBits, loaded->maxCorrectionBits);
+    ASSERT_EQ(dict->bytesList.rows, loaded->bytesList.rows);
+    EXPECT_EQ(0, cvtest::norm(dict->bytesList, loaded->bytesList, NORM_INF));
+    ASSERT_FALSE(loaded->searchIndex.empty());
+
+    // the indexed search finds the same marker and rotation as the linear one
+    cv::RNG rng(11);
+    for(int i = 0; i < 500; i++) {
+        int id = rng.uniform(0, dict->bytesList.rows);
+        cv::Mat bits;
+        cv::rotate(cv::aruco::Dictionary::getBitsFromByteList(dict->bytesList.rowRange(id, id + 1), 6), bits,
+                   rng.uniform(0, 3));
+        int flips = rng.uniform(0, dict->maxCorrectionBits + 2);
+        for(int f = 0; f < flips; f++)
+            bits.at<uchar>(rng.uniform(0, 6), rng.uniform(0, 6)) ^= 1;
+        int idx, rotation, loadedIdx, loadedRotation;
+        bool found = dict->identify(bits, idx, rotation, 1.);
+        ASSERT_EQ(found, loaded->identify(bits, loadedIdx, loadedRotation, 1.));
+        if(found) {
+            EXPECT_EQ(idx, loadedIdx);
+            EXPECT_EQ(rotation, loadedRotation);
+        }
+    }
+
+    // the mapping is copy-on-write: the codes can be edited, without changing the file
+    cv::Mat bits0 = cv::aruco::Dictionary::getBitsFromByteList(dict->bytesList.rowRange(0, 1), 6);
+    dict->bytesList.row(1).copyTo(loaded->bytesList.row(0));
+    int idx, rotation;
+    EXPECT_TRUE(!loaded->identify(bits0, idx, rotation, 0.) || idx != 0);
+    loaded = cv::aruco::Dictionary::load(filename);
+    ASSERT_TRUE(loaded);
+    EXPECT_EQ(0, cvtest::norm(dict->bytesList, loaded->bytesList, NORM_INF));
+    loaded.release();
+
+    // truncated files are rejected
+    std::vector<char> content;
+    {
+        std::ifstream in(filename.c_str(), std::ios::binary);
+        content.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    {
+        std::ofstream out(filename.c_str(), std::ios::binary | std::ios::trunc);
+        out.write(&content[0], content.size() - 4);
+    }
+    EXPECT_FALSE(cv::aruco::Dictionary::load(filename));
+    remove(filename.c_str());
+}
+
+TEST(CV_ArucoDictionary, modifiedBytesList)
+{
+    cv::Ptr<cv::aruco::Dictionary> shared = cv::aruco::getPredefinedDictionary(cv::aruco::DICT_6X6_250);
+    cv::aruco::Dictionary dict(shared);
+    ASSERT_FALSE(dict.searchIndex.empty());
+    cv::Mat bits100 = cv::aruco::Dictionary::getBitsFromByteList(dict.bytesList.rowRange(100, 101), 6);
+    cv::Mat bits5 = cv::aruco::Dictionary::getBitsFromByteList(dict.bytesList.rowRange(5, 6), 6);
+
+    // a trimmed dictionary does not find the markers it no longer has
+    dict.bytesList = dict.bytesList.rowRange(0, 10);
+    int idx, rotation;
+    EXPECT_FALSE(dict.identify(bits100, idx, rotation, 0.));
+    ASSERT_TRUE(dict.identify(bits5, idx, rotation, 0.));
+    EXPECT_EQ(5, idx);
+
+    // a new bytesList is searched linearly
+    dict.bytesList = shared->bytesList.rowRange(100, 101).clone();
+    ASSERT_TRUE(dict.identify(bits100, idx, rotation, 0.));
+    EXPECT_EQ(0, idx);
+
+    // codes edited in place are not searched with the index of the old ones
+    cv::aruco::Dictionary swapped(shared);
+    cv::Mat row5 = swapped.bytesList.row(5).clone();
+    swapped.bytesList.row(100).copyTo(swapped.bytesList.row(5));
+    row5.copyTo(swapped.bytesList.row(100));
+    ASSERT_TRUE(swapped.identify(bits100, idx, rotation, 0.));
+    EXPECT_EQ(5, idx);
+    ASSERT_TRUE(swapped.identify(bits5, idx, rotation, 0.));
+    EXPECT_EQ(100, idx);
+
+    // the shared instance is not affected
+    ASSERT_EQ(250, shared->bytesList.rows);
+    ASSERT_TRUE(shared->identify(bits100, idx, rotation, 0.));
+    EXPECT_EQ(100, idx);
+}
+
+TEST(CV_ArucoDictionary, predefinedNotShared)
+{
+    cv::Ptr<cv::aruco::Dictionary> first = cv::aruco::getPredefinedDictionary(cv::aruco::DICT_4X4_50);
+    cv::Ptr<cv::aruco::Dictionary> second = cv::aruco::getPredefinedDictionary(cv::aruco::DICT_4X4_100);
+    ASSERT_TRUE(first.get() != second.get());
+    ASSERT_TRUE(first->bytesList.data != second->bytesList.data);
+    cv::Mat bits0 = cv::aruco::Dictionary::getBitsFromByteList(second->bytesList.rowRange(0, 1), 4);
+
+    // editing the codes of one of them changes neither the other nor the following calls
+    first->bytesList.row(1).copyTo(first->bytesList.row(0));
+    int idx, rotation;
+    ASSERT_TRUE(second->identify(bits0, idx, rotation, 0.));
+    EXPECT_EQ(0, idx);
+    cv::Ptr<cv::aruco::Dictionary> third = cv::aruco::getPredefinedDictionary(cv::aruco::DICT_4X4_50);
+    ASSERT_TRUE(third->identify(bits0, idx, rotation, 0.));
+    EXPECT_EQ(0, idx);
+}
+
 }} // namespace